@@ -4,11 +4,27 @@
 
 #include "flutter/assets/asset_manager.h"
 
+#include <utility>
+
+#include "flutter/assets/compressed_asset.h"
 #include "flutter/assets/directory_asset_bundle.h"
+#include "flutter/fml/make_copyable.h"
 #include "flutter/fml/trace_event.h"
 
 namespace flutter {
 
+namespace {
+
+std::unique_ptr<fml::Mapping> OpenAsset(std::unique_ptr<fml::Mapping> mapping) {
+  // Assets that are stored compressed in pages are inflated on demand.
+  if (mapping && compressed_asset::IsCompressed(*mapping)) {
+    return compressed_asset::Open(std::move(mapping));
+  }
+  return mapping;
+}
+
+}  // namespace
+
 AssetManager::AssetManager() = default;
 
 AssetManager::~AssetManager() = default;
@@ -69,14 +85,50 @@ std::unique_ptr<fml::Mapping> AssetManager::GetAsMapping(
                asset_name.c_str());
   for (const auto& resolver : resolvers_) {
     auto mapping = resolver->GetAsMapping(asset_name);
-    if (mapping != nullptr) {
-      return mapping;
+    if (mapping == nullptr) {
+      continue;
     }
+    return OpenAsset(std::move(mapping));
   }
   FML_DLOG(WARNING) << "Could not find asset: " << asset_name;
   return nullptr;
 }
 
+void AssetManager::GetAsMappingAsync(
+    const std::string& asset_name,
+    fml::AsyncFileIO& io,
+    fml::RefPtr<fml::TaskRunner> callback_runner,
+    MappingCallback callback) const {
+  TRACE_EVENT1("flutter", "AssetManager::GetAsMappingAsync", "name",
+               asset_name.c_str());
+  std::unique_ptr<fml::Mapping> mapping;
+  if (!asset_name.empty()) {
+    for (const auto& resolver : resolvers_) {
+      fml::UniqueFD file = resolver->OpenAsFile(asset_name);
+      if (file.is_valid()) {
+        io.ReadFile(std::move(file), std::move(callback_runner),
+                    [callback = std::move(callback)](
+                        std::unique_ptr<fml::Mapping> contents) {
+                      callback(OpenAsset(std::move(contents)));
+                    });
+        return;
+      }
+      mapping = resolver->GetAsMapping(asset_name);
+      if (mapping != nullptr) {
+        break;
+      }
+    }
+  }
+  if (mapping == nullptr) {
+    FML_DLOG(WARNING) << "Could not find asset: " << asset_name;
+  }
+  callback_runner->PostTask(fml::MakeCopyable(
+      [callback = std::move(callback),
+       mapping = OpenAsset(std::move(mapping))]() mutable {
+        callback(std::move(mapping));
+      }));
+}
+
 // |AssetResolver|
 std::vector<std::unique_ptr<fml::Mapping>> AssetManager::GetAsMappings(
     const std::string& asset_pattern,
@@ -6,13 +6,16 @@
 #define FLUTTER_ASSETS_ASSET_MANAGER_H_
 
 #include <deque>
+#include <functional>
 #include <memory>
 #include <string>
 
 #include <optional>
 #include "flutter/assets/asset_resolver.h"
+#include "flutter/fml/async_file_io.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/ref_counted.h"
+#include "flutter/fml/task_runner.h"
 
 namespace flutter {
 
@@ -70,6 +73,20 @@ class AssetManager final : public AssetResolver {
 
   std::deque<std::unique_ptr<AssetResolver>> TakeResolvers();
 
+  /// Called with the asset, or null if it was not found.
+  using MappingCallback = std::function<void(std::unique_ptr<fml::Mapping>)>;
+
+  //--------------------------------------------------------------------------
+  /// @brief      Same as GetAsMapping() but calls `callback` with the asset
+  ///             on `callback_runner`. Assets that resolvers store as plain
+  ///             files are read with `io` without blocking the calling
+  ///             thread, other assets are resolved before this returns.
+  ///
+  void GetAsMappingAsync(const std::string& asset_name,
+                         fml::AsyncFileIO& io,
+                         fml::RefPtr<fml::TaskRunner> callback_runner,
+                         MappingCallback callback) const;
+
   // |AssetResolver|
   bool IsValid() const override;
 
@@ -0,0 +1,54 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/assets/asset_manager.h"
+
+#include <string>
+
+#include "flutter/assets/directory_asset_bundle.h"
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/file.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
+#include "flutter/fml/thread.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(AssetManagerTest, GetsAssetsAsynchronously) {
+  fml::ScopedTemporaryDirectory directory;
+  ASSERT_TRUE(fml::WriteAtomically(directory.fd(), "asset",
+                                   fml::DataMapping(std::string("Hello"))));
+  AssetManager manager;
+  ASSERT_TRUE(manager.PushBack(std::make_unique<DirectoryAssetBundle>(
+      fml::OpenDirectory(directory.path().c_str(), false,
+                         fml::FilePermission::kRead),
+      false)));
+
+  auto workers = fml::ConcurrentMessageLoop::Create(1);
+  auto io = fml::AsyncFileIO::Create(workers->GetTaskRunner());
+  fml::Thread callback_thread("callbacks");
+  fml::CountDownLatch latch(2);
+  manager.GetAsMappingAsync(
+      "asset", *io, callback_thread.GetTaskRunner(),
+      [&](std::unique_ptr<fml::Mapping> mapping) {
+        EXPECT_TRUE(mapping);
+        if (mapping) {
+          EXPECT_EQ(std::string(reinterpret_cast<const char*>(
+                                    mapping->GetMapping()),
+                                mapping->GetSize()),
+                    "Hello");
+        }
+        latch.CountDown();
+      });
+  manager.GetAsMappingAsync("missing", *io, callback_thread.GetTaskRunner(),
+                            [&](std::unique_ptr<fml::Mapping> mapping) {
+                              EXPECT_FALSE(mapping);
+                              latch.CountDown();
+                            });
+  latch.Wait();
+}
+
+}  // namespace testing
+}  // namespace flutter
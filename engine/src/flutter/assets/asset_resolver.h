@@ -11,12 +11,14 @@
 #include <optional>
 #include "flutter/fml/macros.h"
 #include "flutter/fml/mapping.h"
+#include "flutter/fml/unique_fd.h"
 
 namespace flutter {
 
 class AssetManager;
 class APKAssetProvider;
 class DirectoryAssetBundle;
+class PackedAssetBundle;
 
 class AssetResolver {
  public:
@@ -30,7 +32,8 @@ class AssetResolver {
   enum AssetResolverType {
     kAssetManager,
     kApkAssetProvider,
-    kDirectoryAssetBundle
+    kDirectoryAssetBundle,
+    kPackedAssetBundle,
   };
 
   virtual const AssetManager* as_asset_manager() const { return nullptr; }
@@ -40,6 +43,9 @@ class AssetResolver {
   virtual const DirectoryAssetBundle* as_directory_asset_bundle() const {
     return nullptr;
   }
+  virtual const PackedAssetBundle* as_packed_asset_bundle() const {
+    return nullptr;
+  }
 
   virtual bool IsValid() const = 0;
 
@@ -93,6 +99,19 @@ class AssetResolver {
     return {};
   };
 
+  //----------------------------------------------------------------------------
+  /// @brief      Opens the file the asset is stored in, if this resolver
+  ///             stores assets as plain files, so that the file can be read
+  ///             without mapping it.
+  ///
+  /// @return     Returns an invalid descriptor if the asset is not found or
+  ///             not stored as a plain file.
+  ///
+  [[nodiscard]] virtual fml::UniqueFD OpenAsFile(
+      const std::string& asset_name) const {
+    return {};
+  }
+
   virtual bool operator==(const AssetResolver& other) const = 0;
 
   bool operator!=(const AssetResolver& other) const {
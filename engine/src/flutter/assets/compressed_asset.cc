@@ -0,0 +1,131 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/assets/compressed_asset.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "flutter/fml/endianness.h"
+#include "flutter/fml/logging.h"
+#include "third_party/zlib/zlib.h"
+
+namespace flutter {
+namespace compressed_asset {
+
+namespace {
+
+constexpr uint8_t kMagic[4] = {'F', 'L', 'P', 'Z'};
+constexpr uint32_t kVersion = 1;
+// The magic, the version, the uncompressed size, the page size and the page
+// count.
+constexpr size_t kHeaderSize = 4 + 4 + 8 + 4 + 4;
+
+template <typename T>
+T ReadInteger(const uint8_t* data) {
+  T value;
+  memcpy(&value, data, sizeof(T));
+  return fml::LittleEndianToArch(value);
+}
+
+template <typename T>
+void WriteInteger(std::vector<uint8_t>& out, T value) {
+  value = fml::LittleEndianToArch(value);
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+  out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+}  // namespace
+
+bool IsCompressed(const fml::Mapping& mapping) {
+  return mapping.GetSize() >= kHeaderSize && mapping.GetMapping() &&
+         memcmp(mapping.GetMapping(), kMagic, sizeof(kMagic)) == 0;
+}
+
+std::unique_ptr<fml::Mapping> Open(std::unique_ptr<fml::Mapping> compressed,
+                                   size_t max_cached_pages) {
+  if (!compressed || !IsCompressed(*compressed)) {
+    return nullptr;
+  }
+  const uint8_t* header = compressed->GetMapping();
+  uint32_t version = ReadInteger<uint32_t>(header + 4);
+  uint64_t size = ReadInteger<uint64_t>(header + 8);
+  uint32_t page_size = ReadInteger<uint32_t>(header + 16);
+  uint32_t page_count = ReadInteger<uint32_t>(header + 20);
+  if (version != kVersion) {
+    FML_LOG(ERROR) << "Unsupported compressed asset version " << version;
+    return nullptr;
+  }
+  if (page_size == 0 ||
+      page_count != (size + page_size - 1) / page_size) {
+    FML_LOG(ERROR) << "Malformed compressed asset header.";
+    return nullptr;
+  }
+  size_t offsets_size = (static_cast<size_t>(page_count) + 1) * 8;
+  if (compressed->GetSize() - kHeaderSize < offsets_size) {
+    FML_LOG(ERROR) << "Truncated compressed asset page table.";
+    return nullptr;
+  }
+  const uint8_t* offsets = header + kHeaderSize;
+  size_t pages_size = compressed->GetSize() - kHeaderSize - offsets_size;
+  uint64_t previous = 0;
+  for (size_t i = 0; i <= page_count; i++) {
+    uint64_t offset = ReadInteger<uint64_t>(offsets + i * 8);
+    if (offset < previous || offset > pages_size) {
+      FML_LOG(ERROR) << "Malformed compressed asset page table.";
+      return nullptr;
+    }
+    previous = offset;
+  }
+
+  std::shared_ptr<fml::Mapping> source = std::move(compressed);
+  auto decoder = [source, offsets, pages = offsets + offsets_size](
+                     size_t index, uint8_t* page, size_t length) {
+    uint64_t begin = ReadInteger<uint64_t>(offsets + index * 8);
+    uint64_t end = ReadInteger<uint64_t>(offsets + (index + 1) * 8);
+    uLongf inflated = length;
+    int result = uncompress(page, &inflated, pages + begin, end - begin);
+    return result == Z_OK && inflated == length;
+  };
+  return std::make_unique<fml::PagedMapping>(size, page_size,
+                                              std::move(decoder),
+                                              max_cached_pages);
+}
+
+std::vector<uint8_t> Compress(const uint8_t* data,
+                              size_t size,
+                              size_t page_size) {
+  FML_DCHECK(page_size > 0);
+  uint32_t page_count = (size + page_size - 1) / page_size;
+
+  std::vector<uint8_t> pages;
+  std::vector<uint64_t> offsets = {0};
+  for (size_t index = 0; index < page_count; index++) {
+    size_t page_offset = index * page_size;
+    size_t length = std::min(page_size, size - page_offset);
+    uLongf compressed_length = compressBound(length);
+    size_t begin = pages.size();
+    pages.resize(begin + compressed_length);
+    int result = compress2(pages.data() + begin, &compressed_length,
+                           data + page_offset, length, Z_BEST_COMPRESSION);
+    FML_CHECK(result == Z_OK);
+    pages.resize(begin + compressed_length);
+    offsets.push_back(pages.size());
+  }
+
+  std::vector<uint8_t> out(kMagic, kMagic + sizeof(kMagic));
+  WriteInteger<uint32_t>(out, kVersion);
+  WriteInteger<uint64_t>(out, size);
+  WriteInteger<uint32_t>(out, page_size);
+  WriteInteger<uint32_t>(out, page_count);
+  for (uint64_t offset : offsets) {
+    WriteInteger<uint64_t>(out, offset);
+  }
+  out.insert(out.end(), pages.begin(), pages.end());
+  return out;
+}
+
+}  // namespace compressed_asset
+}  // namespace flutter
@@ -0,0 +1,62 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_ASSETS_COMPRESSED_ASSET_H_
+#define FLUTTER_ASSETS_COMPRESSED_ASSET_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/paged_mapping.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// Assets that are stored compressed in independent pages, so that they can be
+/// inflated on demand instead of all at once.
+///
+/// A compressed asset is laid out as follows, with all integers little
+/// endian:
+///
+///   - The magic "FLPZ" and a 32-bit format version, currently 1.
+///   - The 64-bit uncompressed size, the 32-bit page size and the 32-bit page
+///     count.
+///   - page count + 1 64-bit offsets of the pages, relative to the end of
+///     the offsets. The last offset is the end of the last page.
+///   - The pages, each of which is a zlib stream that inflates to the page
+///     size, except for the last one, which holds the remainder.
+///
+namespace compressed_asset {
+
+constexpr size_t kDefaultPageSize = 64 * 1024;
+
+/// Whether |mapping| holds a compressed asset, as opposed to raw contents.
+bool IsCompressed(const fml::Mapping& mapping);
+
+//------------------------------------------------------------------------------
+/// @brief      Wraps a compressed asset in a mapping that inflates its pages
+///             on demand and caches at most |max_cached_pages| of them. The
+///             returned mapping is a |fml::PagedMapping|.
+///
+/// @return     The uncompressed mapping, or nullptr if |compressed| is not a
+///             well formed compressed asset.
+///
+std::unique_ptr<fml::Mapping> Open(
+    std::unique_ptr<fml::Mapping> compressed,
+    size_t max_cached_pages = fml::PagedMapping::kDefaultMaxCachedPages);
+
+/// Compresses |size| bytes from |data| into a compressed asset. This is the
+/// format expected by |Open|.
+std::vector<uint8_t> Compress(const uint8_t* data,
+                              size_t size,
+                              size_t page_size = kDefaultPageSize);
+
+}  // namespace compressed_asset
+
+}  // namespace flutter
+
+#endif  // FLUTTER_ASSETS_COMPRESSED_ASSET_H_
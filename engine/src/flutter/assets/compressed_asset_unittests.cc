@@ -0,0 +1,81 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/assets/compressed_asset.h"
+
+#include <cstring>
+#include <vector>
+
+#include "flutter/fml/paged_mapping.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+std::vector<uint8_t> MakeContents(size_t size) {
+  std::vector<uint8_t> contents(size);
+  for (size_t i = 0; i < size; i++) {
+    contents[i] = static_cast<uint8_t>((i * 7) % 251);
+  }
+  return contents;
+}
+
+}  // namespace
+
+TEST(CompressedAssetTest, InflatesPagesOnDemand) {
+  std::vector<uint8_t> contents = MakeContents(10000);
+  auto compressed = std::make_unique<fml::DataMapping>(
+      compressed_asset::Compress(contents.data(), contents.size(), 1024));
+  ASSERT_TRUE(compressed_asset::IsCompressed(*compressed));
+  EXPECT_LT(compressed->GetSize(), contents.size());
+
+  auto mapping = compressed_asset::Open(std::move(compressed), 2);
+  ASSERT_NE(mapping, nullptr);
+  ASSERT_EQ(mapping->GetSize(), contents.size());
+  auto* paged = static_cast<fml::PagedMapping*>(mapping.get());
+  EXPECT_EQ(paged->GetPageCount(), 10u);
+
+  std::vector<uint8_t> range(3000);
+  ASSERT_TRUE(paged->Read(5000, range.size(), range.data()));
+  EXPECT_EQ(memcmp(range.data(), contents.data() + 5000, range.size()), 0);
+  EXPECT_EQ(paged->GetCachedPageCount(), 2u);
+
+  ASSERT_NE(mapping->GetMapping(), nullptr);
+  EXPECT_EQ(memcmp(mapping->GetMapping(), contents.data(), contents.size()),
+            0);
+}
+
+TEST(CompressedAssetTest, RawContentsAreNotCompressed) {
+  std::vector<uint8_t> contents = MakeContents(100);
+  auto raw = std::make_unique<fml::DataMapping>(contents);
+  EXPECT_FALSE(compressed_asset::IsCompressed(*raw));
+  EXPECT_EQ(compressed_asset::Open(std::move(raw)), nullptr);
+}
+
+TEST(CompressedAssetTest, RejectsMalformedAssets) {
+  std::vector<uint8_t> contents = MakeContents(4096);
+  std::vector<uint8_t> compressed =
+      compressed_asset::Compress(contents.data(), contents.size(), 1024);
+
+  std::vector<uint8_t> truncated(compressed.begin(), compressed.begin() + 40);
+  EXPECT_EQ(compressed_asset::Open(
+                std::make_unique<fml::DataMapping>(std::move(truncated))),
+            nullptr);
+
+  // A corrupt page is reported when it is read.
+  compressed.back() ^= 0xff;
+  auto mapping = compressed_asset::Open(
+      std::make_unique<fml::DataMapping>(std::move(compressed)));
+  ASSERT_NE(mapping, nullptr);
+  auto* paged = static_cast<fml::PagedMapping*>(mapping.get());
+  uint8_t byte = 0;
+  EXPECT_TRUE(paged->Read(0, 1, &byte));
+  EXPECT_FALSE(paged->Read(4095, 1, &byte));
+  EXPECT_EQ(mapping->GetMapping(), nullptr);
+}
+
+}  // namespace testing
+}  // namespace flutter
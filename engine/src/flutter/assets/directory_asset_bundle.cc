@@ -60,6 +60,18 @@ std::unique_ptr<fml::Mapping> DirectoryAssetBundle::GetAsMapping(
   return mapping;
 }
 
+// |AssetResolver|
+fml::UniqueFD DirectoryAssetBundle::OpenAsFile(
+    const std::string& asset_name) const {
+  if (!is_valid_) {
+    FML_DLOG(WARNING) << "Asset bundle was not valid.";
+    return {};
+  }
+
+  return fml::OpenFile(descriptor_, asset_name.c_str(), false,
+                       fml::FilePermission::kRead);
+}
+
 std::vector<std::unique_ptr<fml::Mapping>> DirectoryAssetBundle::GetAsMappings(
     const std::string& asset_pattern,
     const std::optional<std::string>& subdir) const {
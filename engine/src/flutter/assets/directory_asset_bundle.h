@@ -43,6 +43,9 @@ class DirectoryAssetBundle : public AssetResolver {
       const std::string& asset_pattern,
       const std::optional<std::string>& subdir) const override;
 
+  // |AssetResolver|
+  fml::UniqueFD OpenAsFile(const std::string& asset_name) const override;
+
   // |AssetResolver|
   bool operator==(const AssetResolver& other) const override;
 
@@ -0,0 +1,294 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/assets/packed_asset_bundle.h"
+
+#include <cstring>
+#include <regex>
+#include <utility>
+
+#include "flutter/fml/endianness.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr uint8_t kMagic[4] = {'F', 'L', 'A', 'P'};
+constexpr uint32_t kVersion = 1;
+// The magic, the version, the asset count and the bucket count.
+constexpr size_t kHeaderSize = 4 + 4 + 4 + 4;
+// The hash, the name offset and size, and the contents offset and size.
+constexpr size_t kEntrySize = 8 * 5;
+constexpr size_t kBucketSize = 4;
+
+template <typename T>
+T ReadInteger(const uint8_t* data) {
+  T value;
+  memcpy(&value, data, sizeof(T));
+  return fml::LittleEndianToArch(value);
+}
+
+template <typename T>
+void WriteInteger(std::vector<uint8_t>& out, T value) {
+  value = fml::LittleEndianToArch(value);
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+  out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+void WriteIntegerAt(std::vector<uint8_t>& out, size_t offset, T value) {
+  value = fml::LittleEndianToArch(value);
+  memcpy(out.data() + offset, &value, sizeof(T));
+}
+
+// The 64-bit FNV-1a hash, which is stable across builds and platforms.
+uint64_t HashName(std::string_view name) {
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (char c : name) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+bool IsInRange(uint64_t offset, uint64_t size, size_t pack_size) {
+  return offset <= pack_size && size <= pack_size - offset;
+}
+
+}  // namespace
+
+PackedAssetBundle::PackedAssetBundle(std::unique_ptr<fml::Mapping> pack,
+                                     bool is_valid_after_asset_manager_change)
+    : pack_(std::move(pack)),
+      is_valid_after_asset_manager_change_(
+          is_valid_after_asset_manager_change) {
+  if (!pack_ || !pack_->GetMapping() || pack_->GetSize() < kHeaderSize ||
+      memcmp(pack_->GetMapping(), kMagic, sizeof(kMagic)) != 0) {
+    return;
+  }
+  const uint8_t* header = pack_->GetMapping();
+  if (ReadInteger<uint32_t>(header + 4) != kVersion) {
+    FML_LOG(ERROR) << "Unsupported version of the asset pack.";
+    return;
+  }
+  asset_count_ = ReadInteger<uint32_t>(header + 8);
+  bucket_count_ = ReadInteger<uint32_t>(header + 12);
+  if (bucket_count_ == 0 || (bucket_count_ & (bucket_count_ - 1)) != 0 ||
+      bucket_count_ < asset_count_ ||
+      !IsInRange(kHeaderSize,
+                 static_cast<uint64_t>(asset_count_) * kEntrySize +
+                     static_cast<uint64_t>(bucket_count_) * kBucketSize,
+                 pack_->GetSize())) {
+    FML_LOG(ERROR) << "The index of the asset pack is malformed.";
+    return;
+  }
+  is_valid_ = true;
+}
+
+PackedAssetBundle::~PackedAssetBundle() = default;
+
+std::unique_ptr<PackedAssetBundle> PackedAssetBundle::OpenFromResolver(
+    const AssetResolver& resolver,
+    bool is_valid_after_asset_manager_change) {
+  if (!resolver.IsValid()) {
+    return nullptr;
+  }
+  std::unique_ptr<fml::Mapping> pack = resolver.GetAsMapping(kFileName);
+  if (!pack) {
+    return nullptr;
+  }
+  auto bundle = std::make_unique<PackedAssetBundle>(
+      std::move(pack), is_valid_after_asset_manager_change);
+  if (!bundle->IsValid()) {
+    return nullptr;
+  }
+  return bundle;
+}
+
+std::vector<uint8_t> PackedAssetBundle::Pack(
+    const std::map<std::string, std::unique_ptr<fml::Mapping>>& assets) {
+  const uint32_t asset_count = static_cast<uint32_t>(assets.size());
+  // Keep the table at most half full so that probes stay short.
+  uint32_t bucket_count = 1;
+  while (bucket_count < asset_count * 2) {
+    bucket_count *= 2;
+  }
+
+  std::vector<uint8_t> pack;
+  pack.insert(pack.end(), kMagic, kMagic + sizeof(kMagic));
+  WriteInteger<uint32_t>(pack, kVersion);
+  WriteInteger<uint32_t>(pack, asset_count);
+  WriteInteger<uint32_t>(pack, bucket_count);
+
+  const size_t entries_offset = pack.size();
+  const size_t buckets_offset = entries_offset + asset_count * kEntrySize;
+  pack.resize(buckets_offset + bucket_count * kBucketSize, 0);
+
+  std::vector<uint32_t> buckets(bucket_count, 0);
+  uint32_t index = 0;
+  for (const auto& [name, mapping] : assets) {
+    const uint64_t hash = HashName(name);
+    uint32_t bucket = hash & (bucket_count - 1);
+    while (buckets[bucket] != 0) {
+      bucket = (bucket + 1) & (bucket_count - 1);
+    }
+    buckets[bucket] = index + 1;
+
+    const size_t entry = entries_offset + index * kEntrySize;
+    WriteIntegerAt<uint64_t>(pack, entry, hash);
+    WriteIntegerAt<uint64_t>(pack, entry + 8, pack.size());
+    WriteIntegerAt<uint64_t>(pack, entry + 16, name.size());
+    pack.insert(pack.end(), name.begin(), name.end());
+    index++;
+  }
+  for (uint32_t bucket = 0; bucket < bucket_count; bucket++) {
+    WriteIntegerAt<uint32_t>(pack, buckets_offset + bucket * kBucketSize,
+                             buckets[bucket]);
+  }
+
+  index = 0;
+  for (const auto& [name, mapping] : assets) {
+    pack.resize(
+        (pack.size() + kContentsAlignment - 1) & ~(kContentsAlignment - 1), 0);
+    const size_t entry = entries_offset + index * kEntrySize;
+    const size_t size = mapping ? mapping->GetSize() : 0;
+    WriteIntegerAt<uint64_t>(pack, entry + 24, pack.size());
+    WriteIntegerAt<uint64_t>(pack, entry + 32, size);
+    if (size > 0) {
+      pack.insert(pack.end(), mapping->GetMapping(),
+                  mapping->GetMapping() + size);
+    }
+    index++;
+  }
+  return pack;
+}
+
+std::optional<PackedAssetBundle::Entry> PackedAssetBundle::ReadEntry(
+    uint32_t index) const {
+  if (index >= asset_count_) {
+    return std::nullopt;
+  }
+  const uint8_t* base = pack_->GetMapping();
+  const size_t pack_size = pack_->GetSize();
+  const uint8_t* entry = base + kHeaderSize + index * kEntrySize;
+  const uint64_t name_offset = ReadInteger<uint64_t>(entry + 8);
+  const uint64_t name_size = ReadInteger<uint64_t>(entry + 16);
+  const uint64_t offset = ReadInteger<uint64_t>(entry + 24);
+  const uint64_t size = ReadInteger<uint64_t>(entry + 32);
+  if (!IsInRange(name_offset, name_size, pack_size) ||
+      !IsInRange(offset, size, pack_size)) {
+    FML_LOG(ERROR) << "Entry " << index << " of the asset pack is malformed.";
+    return std::nullopt;
+  }
+  const char* name = reinterpret_cast<const char*>(base + name_offset);
+  return Entry{
+      .hash = ReadInteger<uint64_t>(entry),
+      .name = std::string_view(name, name_size),
+      .contents = base + offset,
+      .size = static_cast<size_t>(size),
+  };
+}
+
+std::unique_ptr<fml::Mapping> PackedAssetBundle::GetContents(
+    const Entry& entry) const {
+  // The contents are a range of the pack, which the mapping keeps alive.
+  return std::make_unique<fml::NonOwnedMapping>(
+      entry.contents, entry.size,
+      [pack = pack_](const uint8_t* data, size_t size) {});
+}
+
+// |AssetResolver|
+bool PackedAssetBundle::IsValid() const {
+  return is_valid_;
+}
+
+// |AssetResolver|
+bool PackedAssetBundle::IsValidAfterAssetManagerChange() const {
+  return is_valid_after_asset_manager_change_;
+}
+
+// |AssetResolver|
+AssetResolver::AssetResolverType PackedAssetBundle::GetType() const {
+  return AssetResolver::AssetResolverType::kPackedAssetBundle;
+}
+
+// |AssetResolver|
+std::unique_ptr<fml::Mapping> PackedAssetBundle::GetAsMapping(
+    const std::string& asset_name) const {
+  if (!is_valid_) {
+    FML_DLOG(WARNING) << "Asset pack was not valid.";
+    return nullptr;
+  }
+
+  const uint64_t hash = HashName(asset_name);
+  const uint8_t* buckets =
+      pack_->GetMapping() + kHeaderSize + asset_count_ * kEntrySize;
+  uint32_t bucket = hash & (bucket_count_ - 1);
+  for (uint32_t probe = 0; probe < bucket_count_; probe++) {
+    const uint32_t index =
+        ReadInteger<uint32_t>(buckets + bucket * kBucketSize);
+    if (index == 0) {
+      return nullptr;
+    }
+    std::optional<Entry> entry = ReadEntry(index - 1);
+    if (!entry.has_value()) {
+      return nullptr;
+    }
+    if (entry->hash == hash && entry->name == asset_name) {
+      return GetContents(entry.value());
+    }
+    bucket = (bucket + 1) & (bucket_count_ - 1);
+  }
+  return nullptr;
+}
+
+// |AssetResolver|
+std::vector<std::unique_ptr<fml::Mapping>> PackedAssetBundle::GetAsMappings(
+    const std::string& asset_pattern,
+    const std::optional<std::string>& subdir) const {
+  std::vector<std::unique_ptr<fml::Mapping>> mappings;
+  if (!is_valid_) {
+    FML_DLOG(WARNING) << "Asset pack was not valid.";
+    return mappings;
+  }
+
+  TRACE_EVENT0("flutter", "PackedAssetBundle::GetAsMappings");
+  // As with a directory of assets, the pattern is matched against the file
+  // names of the assets, which are only those directly in `subdir` if given.
+  std::regex asset_regex(asset_pattern);
+  for (uint32_t index = 0; index < asset_count_; index++) {
+    std::optional<Entry> entry = ReadEntry(index);
+    if (!entry.has_value()) {
+      continue;
+    }
+    const size_t separator = entry->name.rfind('/');
+    const std::string_view directory =
+        separator == std::string_view::npos ? std::string_view()
+                                            : entry->name.substr(0, separator);
+    const std::string_view filename =
+        separator == std::string_view::npos ? entry->name
+                                            : entry->name.substr(separator + 1);
+    if (subdir.has_value() && directory != subdir.value()) {
+      continue;
+    }
+    if (std::regex_match(filename.begin(), filename.end(), asset_regex)) {
+      mappings.push_back(GetContents(entry.value()));
+    }
+  }
+  return mappings;
+}
+
+bool PackedAssetBundle::operator==(const AssetResolver& other) const {
+  auto other_bundle = other.as_packed_asset_bundle();
+  if (!other_bundle) {
+    return false;
+  }
+  return is_valid_after_asset_manager_change_ ==
+             other_bundle->is_valid_after_asset_manager_change_ &&
+         pack_ == other_bundle->pack_;
+}
+
+}  // namespace flutter
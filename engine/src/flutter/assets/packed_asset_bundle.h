@@ -0,0 +1,131 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_ASSETS_PACKED_ASSET_BUNDLE_H_
+#define FLUTTER_ASSETS_PACKED_ASSET_BUNDLE_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "flutter/assets/asset_resolver.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// An asset resolver for assets that are packed into a single file along with
+/// an index of their names, so that finding an asset is a single probe of a
+/// hash table instead of a lookup in the file system, and reading it is a
+/// range of the mapping of the pack instead of a file of its own.
+///
+/// A pack is laid out as follows, with all integers little endian:
+///
+///   - The magic "FLAP", a 32-bit format version, currently 1, the 32-bit
+///     asset count and the 32-bit bucket count, a power of two.
+///   - An entry per asset: the 64-bit hash of its name, the 64-bit offset
+///     and size of its name and the 64-bit offset and size of its contents.
+///     Offsets are relative to the start of the pack.
+///   - The buckets of the hash table, each the 32-bit index of an entry plus
+///     one, or zero if empty. An asset is in the first bucket, starting at
+///     its hash modulo the bucket count, that isn't taken by another asset.
+///   - The names and then the contents of the assets. The contents of each
+///     asset start at a multiple of |kContentsAlignment|.
+///
+class PackedAssetBundle : public AssetResolver {
+ public:
+  //----------------------------------------------------------------------------
+  /// The name of the pack among the assets of an application, next to the
+  /// assets that it holds.
+  ///
+  static constexpr char kFileName[] = "flutter_assets.pack";
+
+  static constexpr size_t kContentsAlignment = 16;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Creates a resolver for the pack in the given mapping. The
+  ///             assets it returns are ranges of the mapping, which is kept
+  ///             alive as long as any of them is.
+  ///
+  ///             The resolver is not valid if the mapping is not a well
+  ///             formed pack.
+  ///
+  PackedAssetBundle(std::unique_ptr<fml::Mapping> pack,
+                    bool is_valid_after_asset_manager_change);
+
+  ~PackedAssetBundle() override;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Creates a resolver for the pack that `resolver` holds as the
+  ///             asset |kFileName|, such as one in a directory of assets.
+  ///
+  /// @return     The resolver, or nullptr if there is no valid pack.
+  ///
+  static std::unique_ptr<PackedAssetBundle> OpenFromResolver(
+      const AssetResolver& resolver,
+      bool is_valid_after_asset_manager_change);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Packs the assets, by name, in the format read by this class.
+  ///
+  static std::vector<uint8_t> Pack(
+      const std::map<std::string, std::unique_ptr<fml::Mapping>>& assets);
+
+ private:
+  struct Entry {
+    uint64_t hash = 0;
+    std::string_view name;
+    const uint8_t* contents = nullptr;
+    size_t size = 0;
+  };
+
+  // The index is read in place from the mapping of the pack. Only its size
+  // is checked up front, the entries are checked as they are read.
+  std::shared_ptr<const fml::Mapping> pack_;
+  uint32_t asset_count_ = 0;
+  uint32_t bucket_count_ = 0;
+  bool is_valid_ = false;
+  bool is_valid_after_asset_manager_change_ = false;
+
+  std::optional<Entry> ReadEntry(uint32_t index) const;
+
+  std::unique_ptr<fml::Mapping> GetContents(const Entry& entry) const;
+
+  // |AssetResolver|
+  bool IsValid() const override;
+
+  // |AssetResolver|
+  bool IsValidAfterAssetManagerChange() const override;
+
+  // |AssetResolver|
+  AssetResolver::AssetResolverType GetType() const override;
+
+  // |AssetResolver|
+  std::unique_ptr<fml::Mapping> GetAsMapping(
+      const std::string& asset_name) const override;
+
+  // |AssetResolver|
+  std::vector<std::unique_ptr<fml::Mapping>> GetAsMappings(
+      const std::string& asset_pattern,
+      const std::optional<std::string>& subdir) const override;
+
+  // |AssetResolver|
+  bool operator==(const AssetResolver& other) const override;
+
+  // |AssetResolver|
+  const PackedAssetBundle* as_packed_asset_bundle() const override {
+    return this;
+  }
+
+  FML_DISALLOW_COPY_AND_ASSIGN(PackedAssetBundle);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_ASSETS_PACKED_ASSET_BUNDLE_H_
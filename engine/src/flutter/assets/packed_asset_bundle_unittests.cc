@@ -0,0 +1,159 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/assets/packed_asset_bundle.h"
+
+#include <cstring>
+#include <map>
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+std::unique_ptr<fml::Mapping> MakeMapping(const std::string& contents) {
+  return std::make_unique<fml::DataMapping>(
+      std::vector<uint8_t>(contents.begin(), contents.end()));
+}
+
+std::string ToString(const fml::Mapping& mapping) {
+  return std::string(reinterpret_cast<const char*>(mapping.GetMapping()),
+                     mapping.GetSize());
+}
+
+bool IsValidPack(std::vector<uint8_t> pack) {
+  PackedAssetBundle bundle(std::make_unique<fml::DataMapping>(std::move(pack)),
+                           true);
+  return static_cast<const AssetResolver&>(bundle).IsValid();
+}
+
+std::unique_ptr<AssetResolver> MakeBundle(
+    const std::map<std::string, std::string>& assets) {
+  std::map<std::string, std::unique_ptr<fml::Mapping>> mappings;
+  for (const auto& [name, contents] : assets) {
+    mappings[name] = MakeMapping(contents);
+  }
+  return std::make_unique<PackedAssetBundle>(
+      std::make_unique<fml::DataMapping>(PackedAssetBundle::Pack(mappings)),
+      true);
+}
+
+}  // namespace
+
+TEST(PackedAssetBundleTest, FindsPackedAssets) {
+  auto bundle = MakeBundle({
+      {"AssetManifest.bin", "manifest"},
+      {"assets/image.png", "image"},
+      {"fonts/MaterialIcons-Regular.otf", "font"},
+      {"empty", ""},
+  });
+  ASSERT_TRUE(bundle->IsValid());
+  EXPECT_EQ(bundle->GetType(),
+            AssetResolver::AssetResolverType::kPackedAssetBundle);
+
+  auto image = bundle->GetAsMapping("assets/image.png");
+  ASSERT_NE(image, nullptr);
+  EXPECT_EQ(ToString(*image), "image");
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(image->GetMapping()) %
+                PackedAssetBundle::kContentsAlignment,
+            0u);
+
+  auto font = bundle->GetAsMapping("fonts/MaterialIcons-Regular.otf");
+  ASSERT_NE(font, nullptr);
+  EXPECT_EQ(ToString(*font), "font");
+
+  auto empty = bundle->GetAsMapping("empty");
+  ASSERT_NE(empty, nullptr);
+  EXPECT_EQ(empty->GetSize(), 0u);
+
+  EXPECT_EQ(bundle->GetAsMapping("assets/missing.png"), nullptr);
+  EXPECT_EQ(bundle->GetAsMapping("assets"), nullptr);
+}
+
+TEST(PackedAssetBundleTest, AssetsOutliveTheBundle) {
+  auto bundle = MakeBundle({{"a", "contents"}});
+  auto mapping = bundle->GetAsMapping("a");
+  bundle.reset();
+  ASSERT_NE(mapping, nullptr);
+  EXPECT_EQ(ToString(*mapping), "contents");
+}
+
+TEST(PackedAssetBundleTest, FindsManyAssets) {
+  std::map<std::string, std::string> assets;
+  for (int i = 0; i < 1000; i++) {
+    assets["assets/" + std::to_string(i)] = std::to_string(i * i);
+  }
+  auto bundle = MakeBundle(assets);
+  ASSERT_TRUE(bundle->IsValid());
+  for (const auto& [name, contents] : assets) {
+    auto mapping = bundle->GetAsMapping(name);
+    ASSERT_NE(mapping, nullptr) << name;
+    EXPECT_EQ(ToString(*mapping), contents);
+  }
+  EXPECT_EQ(bundle->GetAsMapping("assets/1000"), nullptr);
+}
+
+TEST(PackedAssetBundleTest, MatchesPatternInSubdirectory) {
+  auto bundle = MakeBundle({
+      {"shaders/a.frag", "a"},
+      {"shaders/b.frag", "b"},
+      {"shaders/nested/c.frag", "c"},
+      {"shaders/d.vert", "d"},
+  });
+  EXPECT_EQ(bundle->GetAsMappings(".*\\.frag", "shaders").size(), 2u);
+  EXPECT_EQ(bundle->GetAsMappings(".*\\.frag", std::nullopt).size(), 3u);
+  EXPECT_EQ(bundle->GetAsMappings(".*", "shaders/nested").size(), 1u);
+  EXPECT_TRUE(bundle->GetAsMappings(".*", "fonts").empty());
+}
+
+TEST(PackedAssetBundleTest, RejectsMalformedPacks) {
+  std::map<std::string, std::unique_ptr<fml::Mapping>> assets;
+  assets["a"] = MakeMapping("contents");
+  std::vector<uint8_t> pack = PackedAssetBundle::Pack(assets);
+
+  EXPECT_TRUE(IsValidPack(pack));
+  EXPECT_FALSE(IsValidPack({}));
+  EXPECT_FALSE(IsValidPack({pack.begin(), pack.begin() + 20}));
+
+  std::vector<uint8_t> bad_magic = pack;
+  bad_magic[0] = 'X';
+  EXPECT_FALSE(IsValidPack(bad_magic));
+
+  std::vector<uint8_t> bad_bucket_count = pack;
+  bad_bucket_count[12] = 3;
+  EXPECT_FALSE(IsValidPack(bad_bucket_count));
+
+  // An entry that points past the end of the pack is not returned.
+  std::vector<uint8_t> bad_entry = pack;
+  memset(bad_entry.data() + 16 + 24, 0xff, 8);
+  auto bundle = std::make_unique<PackedAssetBundle>(
+      std::make_unique<fml::DataMapping>(std::move(bad_entry)), true);
+  EXPECT_TRUE(static_cast<const AssetResolver&>(*bundle).IsValid());
+  EXPECT_EQ(static_cast<const AssetResolver&>(*bundle).GetAsMapping("a"),
+            nullptr);
+}
+
+TEST(PackedAssetBundleTest, OpensPackFromResolver) {
+  std::map<std::string, std::unique_ptr<fml::Mapping>> assets;
+  assets["inner"] = MakeMapping("packed");
+  std::vector<uint8_t> pack = PackedAssetBundle::Pack(assets);
+  auto outer = MakeBundle(
+      {{PackedAssetBundle::kFileName, std::string(pack.begin(), pack.end())}});
+
+  auto bundle = PackedAssetBundle::OpenFromResolver(*outer, false);
+  ASSERT_NE(bundle, nullptr);
+  auto mapping =
+      static_cast<const AssetResolver&>(*bundle).GetAsMapping("inner");
+  ASSERT_NE(mapping, nullptr);
+  EXPECT_EQ(ToString(*mapping), "packed");
+
+  auto empty = MakeBundle({{"other", "contents"}});
+  EXPECT_EQ(PackedAssetBundle::OpenFromResolver(*empty, false), nullptr);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -6,17 +6,20 @@
 
 #include "flutter/common/graphics/persistent_cache.h"
 
+#include <cctype>
 #include <future>
+#include <list>
+#include <map>
 #include <memory>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 
 #include "flutter/fml/base32.h"
 #include "flutter/fml/file.h"
 #include "flutter/fml/hex_codec.h"
 #include "flutter/fml/logging.h"
-#include "flutter/fml/make_copyable.h"
 #include "flutter/fml/mapping.h"
 #include "flutter/fml/paths.h"
 #include "flutter/fml/trace_event.h"
@@ -35,6 +38,58 @@ std::shared_ptr<AssetManager> PersistentCache::asset_manager_;
 std::mutex PersistentCache::instance_mutex_;
 std::unique_ptr<PersistentCache> PersistentCache::gPersistentCache;
 
+struct PersistentCache::Store {
+  struct PendingWrite {
+    std::shared_ptr<const fml::Mapping> mapping;
+    bool evictable = false;
+  };
+
+  // The shader files of a cache directory and their sizes, from the least to
+  // the most recently used. Files that were already on disk before they were
+  // first used are considered the least recently used.
+  struct Usage {
+    bool scanned = false;
+    size_t total_size = 0;
+    std::list<std::string> files;
+    std::unordered_map<std::string,
+                       std::pair<size_t, std::list<std::string>::iterator>>
+        entries;
+
+    void Touch(const std::string& file_name) {
+      auto found = entries.find(file_name);
+      if (found != entries.end()) {
+        files.splice(files.end(), files, found->second.second);
+      } else if (!scanned) {
+        // The size is filled in once the directory is scanned.
+        files.push_back(file_name);
+        entries[file_name] = {0, std::prev(files.end())};
+      }
+    }
+
+    void Record(const std::string& file_name, size_t size) {
+      Touch(file_name);
+      auto found = entries.find(file_name);
+      if (found == entries.end()) {
+        files.push_back(file_name);
+        found = entries
+                    .emplace(file_name,
+                             std::make_pair(0, std::prev(files.end())))
+                    .first;
+      }
+      total_size = total_size - found->second.first + size;
+      found->second.first = size;
+    }
+  };
+
+  std::mutex mutex;
+  std::map<std::pair<std::shared_ptr<fml::UniqueFD>, std::string>,
+           PendingWrite>
+      pending_writes;
+  // The task runner the next flush of |pending_writes| is posted to, if any.
+  fml::RefPtr<fml::TaskRunner> flush_task_runner;
+  std::map<std::shared_ptr<fml::UniqueFD>, Usage> usage;
+};
+
 std::string PersistentCache::SkKeyToFilePath(const SkData& key) {
   if (key.data() == nullptr || key.size() == 0) {
     return "";
@@ -52,6 +107,7 @@ bool PersistentCache::gIsReadOnly = false;
 
 std::atomic<bool> PersistentCache::cache_sksl_ = false;
 std::atomic<bool> PersistentCache::strategy_set_ = false;
+std::atomic<size_t> PersistentCache::cache_size_limit_ = 0;
 
 void PersistentCache::SetCacheSkSL(bool value) {
   if (strategy_set_ && value != cache_sksl_) {
@@ -80,6 +136,10 @@ void PersistentCache::SetCacheDirectoryPath(std::string path) {
   cache_base_path_ = std::move(path);
 }
 
+void PersistentCache::SetCacheSizeLimit(size_t bytes) {
+  cache_size_limit_ = bytes;
+}
+
 bool PersistentCache::Purge() {
   // Make sure that this is called after the worker task runner setup so all the
   // file system modifications would happen on that single thread to avoid
@@ -87,8 +147,12 @@ bool PersistentCache::Purge() {
   FML_CHECK(GetWorkerTaskRunner());
 
   std::promise<bool> removed;
-  GetWorkerTaskRunner()->PostTask([&removed,
-                                   cache_directory = cache_directory_]() {
+  GetWorkerTaskRunner()->PostTask([&removed, cache_directory = cache_directory_,
+                                   store = store_]() {
+    {
+      std::scoped_lock lock(store->mutex);
+      store->usage.clear();
+    }
     if (cache_directory->is_valid()) {
       // Only remove files but not directories.
       FML_LOG(INFO) << "Purge persistent cache.";
@@ -112,6 +176,46 @@ namespace {
 
 constexpr char kEngineComponent[] = "flutter_engine";
 
+// Whether |file_name| is the name of a file written by
+// |PersistentCache::store|, as opposed to a dumped SKP for example.
+bool IsShaderFileName(const std::string& file_name) {
+  if (file_name.size() != SHA_DIGEST_LENGTH * 2) {
+    return false;
+  }
+  for (char c : file_name) {
+    if (!std::isxdigit(static_cast<unsigned char>(c))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+sk_sp<SkData> MakeSkData(std::unique_ptr<fml::Mapping> mapping) {
+  if (!mapping || mapping->GetMapping() == nullptr) {
+    return nullptr;
+  }
+  const uint8_t* bytes = mapping->GetMapping();
+  size_t size = mapping->GetSize();
+  return SkData::MakeWithProc(
+      bytes, size,
+      [](const void* ptr, void* context) {
+        delete reinterpret_cast<fml::Mapping*>(context);
+      },
+      mapping.release());
+}
+
+sk_sp<SkData> MakeSkData(const std::shared_ptr<const fml::Mapping>& mapping) {
+  if (!mapping || mapping->GetMapping() == nullptr) {
+    return nullptr;
+  }
+  return SkData::MakeWithProc(
+      mapping->GetMapping(), mapping->GetSize(),
+      [](const void* ptr, void* context) {
+        delete reinterpret_cast<std::shared_ptr<const fml::Mapping>*>(context);
+      },
+      new std::shared_ptr<const fml::Mapping>(mapping));
+}
+
 static void FreeOldCacheDirectory(const fml::UniqueFD& cache_base_dir) {
   fml::UniqueFD engine_dir =
       fml::OpenDirectoryReadOnly(cache_base_dir, kEngineComponent);
@@ -281,7 +385,8 @@ PersistentCache::PersistentCache(bool read_only)
     : is_read_only_(read_only),
       cache_directory_(MakeCacheDirectory(cache_base_path_, read_only, false)),
       sksl_cache_directory_(
-          MakeCacheDirectory(cache_base_path_, read_only, true)) {
+          MakeCacheDirectory(cache_base_path_, read_only, true)),
+      store_(std::make_shared<Store>()) {
   if (!IsValid()) {
     FML_LOG(WARNING) << "Could not acquire the persistent cache directory. "
                         "Caching of GPU resources on disk is disabled.";
@@ -298,33 +403,41 @@ PersistentCache::SkSLCache PersistentCache::LoadFile(
     const fml::UniqueFD& dir,
     const std::string& file_name,
     bool need_key) {
-  SkSLCache result;
   auto file = fml::OpenFileReadOnly(dir, file_name.c_str());
   if (!file.is_valid()) {
-    return result;
+    return {};
   }
-  auto mapping = std::make_unique<fml::FileMapping>(file);
-  if (mapping->GetSize() < sizeof(CacheObjectHeader)) {
+  // The returned data refers to the mapping of the file instead of a copy.
+  return ParseCacheObject(MakeSkData(std::make_unique<fml::FileMapping>(file)),
+                          file_name, need_key);
+}
+
+PersistentCache::SkSLCache PersistentCache::ParseCacheObject(
+    const sk_sp<SkData>& data,
+    const std::string& file_name,
+    bool need_key) {
+  SkSLCache result;
+  if (!data || data->size() < sizeof(CacheObjectHeader)) {
     return result;
   }
   const CacheObjectHeader* header =
-      reinterpret_cast<const CacheObjectHeader*>(mapping->GetMapping());
+      reinterpret_cast<const CacheObjectHeader*>(data->bytes());
   if (header->signature != CacheObjectHeader::kSignature ||
       header->version != CacheObjectHeader::kVersion1) {
     FML_LOG(INFO) << "Persistent cache header is corrupt: " << file_name;
     return result;
   }
-  if (mapping->GetSize() < sizeof(CacheObjectHeader) + header->key_size) {
+  if (data->size() < sizeof(CacheObjectHeader) + header->key_size) {
     FML_LOG(INFO) << "Persistent cache size is corrupt: " << file_name;
     return result;
   }
   if (need_key) {
-    result.key = SkData::MakeWithCopy(
-        mapping->GetMapping() + sizeof(CacheObjectHeader), header->key_size);
+    result.key = SkData::MakeSubset(data.get(), sizeof(CacheObjectHeader),
+                                    header->key_size);
   }
   size_t value_offset = sizeof(CacheObjectHeader) + header->key_size;
-  result.value = SkData::MakeWithCopy(mapping->GetMapping() + value_offset,
-                                      mapping->GetSize() - value_offset);
+  result.value = SkData::MakeSubset(data.get(), value_offset,
+                                    data->size() - value_offset);
   return result;
 }
 
@@ -338,42 +451,154 @@ sk_sp<SkData> PersistentCache::load(const SkData& key) {
   if (file_name.empty()) {
     return nullptr;
   }
-  auto result =
-      PersistentCache::LoadFile(*cache_directory_, file_name, false).value;
+  sk_sp<SkData> result;
+  {
+    std::scoped_lock lock(store_->mutex);
+    store_->usage[cache_directory_].Touch(file_name);
+    // Serve the shaders stored since the last flush from memory.
+    auto pending = store_->pending_writes.find({cache_directory_, file_name});
+    if (pending != store_->pending_writes.end()) {
+      result = ParseCacheObject(MakeSkData(pending->second.mapping), file_name,
+                                false)
+                   .value;
+    }
+  }
+  if (result == nullptr) {
+    result = PersistentCache::LoadFile(*cache_directory_, file_name, false)
+                 .value;
+  }
   if (result != nullptr) {
     TRACE_EVENT0("flutter", "PersistentCacheLoadHit");
   }
   return result;
 }
 
-static void PersistentCacheStore(
-    const fml::RefPtr<fml::TaskRunner>& worker,
-    const std::shared_ptr<fml::UniqueFD>& cache_directory,
-    std::string key,
-    std::unique_ptr<fml::Mapping> value) {
-  // The static leak checker gets confused by the use of fml::MakeCopyable.
-  // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
-  auto task = fml::MakeCopyable([cache_directory,             //
-                                 file_name = std::move(key),  //
-                                 mapping = std::move(value)   //
-  ]() mutable {
-    TRACE_EVENT0("flutter", "PersistentCacheStore");
-    if (!fml::WriteAtomically(*cache_directory,   //
-                              file_name.c_str(),  //
-                              *mapping)           //
-    ) {
-      FML_LOG(WARNING) << "Could not write cache contents to persistent store.";
+void PersistentCache::EnqueueWrite(
+    const std::shared_ptr<fml::UniqueFD>& directory,
+    std::string file_name,
+    std::unique_ptr<fml::Mapping> mapping,
+    bool evictable) {
+  fml::RefPtr<fml::TaskRunner> worker = GetWorkerTaskRunner();
+  {
+    std::scoped_lock lock(store_->mutex);
+    store_->pending_writes[{directory, std::move(file_name)}] = {
+        std::move(mapping), evictable};
+    if (worker && store_->flush_task_runner == worker) {
+      // The write is picked up by the flush that is already scheduled.
+      return;
     }
-  });
+    store_->flush_task_runner = worker;
+  }
 
   if (!worker) {
     FML_LOG(WARNING)
         << "The persistent cache has no available workers. Performing the task "
            "on the current thread. This slow operation is going to occur on a "
            "frame workload.";
-    task();
+    FlushWrites(store_);
   } else {
-    worker->PostTask(std::move(task));
+    worker->PostTask([store = store_]() { FlushWrites(store); });
+  }
+}
+
+void PersistentCache::FlushWrites(const std::shared_ptr<Store>& store) {
+  TRACE_EVENT0("flutter", "PersistentCacheStore");
+  decltype(Store::pending_writes) writes;
+  {
+    std::scoped_lock lock(store->mutex);
+    writes = store->pending_writes;
+    store->flush_task_runner = nullptr;
+  }
+
+  for (const auto& [target, write] : writes) {
+    if (!fml::WriteAtomically(*target.first,          //
+                              target.second.c_str(),  //
+                              *write.mapping)         //
+    ) {
+      FML_LOG(WARNING) << "Could not write cache contents to persistent store.";
+    }
+  }
+
+  size_t limit = cache_size_limit_;
+  // The existing files of the directories that have not been scanned yet.
+  std::map<std::shared_ptr<fml::UniqueFD>,
+           std::vector<std::pair<std::string, size_t>>>
+      scanned_files;
+  if (limit > 0) {
+    for (const auto& [target, write] : writes) {
+      if (!write.evictable || scanned_files.count(target.first) != 0) {
+        continue;
+      }
+      {
+        std::scoped_lock lock(store->mutex);
+        if (store->usage[target.first].scanned) {
+          continue;
+        }
+      }
+      auto& files = scanned_files[target.first];
+      fml::VisitFiles(*target.first, [&files](const fml::UniqueFD& directory,
+                                              const std::string& file_name) {
+        if (IsShaderFileName(file_name)) {
+          auto mapping =
+              fml::FileMapping::CreateReadOnly(directory, file_name.c_str());
+          files.emplace_back(file_name, mapping ? mapping->GetSize() : 0);
+        }
+        return true;
+      });
+    }
+  }
+
+  std::vector<std::pair<std::shared_ptr<fml::UniqueFD>, std::string>> evicted;
+  {
+    std::scoped_lock lock(store->mutex);
+    for (auto& [directory, files] : scanned_files) {
+      Store::Usage& usage = store->usage[directory];
+      for (auto& [file_name, size] : files) {
+        auto found = usage.entries.find(file_name);
+        if (found == usage.entries.end()) {
+          usage.files.push_front(file_name);
+          found = usage.entries
+                      .emplace(file_name,
+                               std::make_pair(0, usage.files.begin()))
+                      .first;
+        }
+        usage.total_size = usage.total_size - found->second.first + size;
+        found->second.first = size;
+      }
+      usage.scanned = true;
+    }
+
+    for (const auto& [target, write] : writes) {
+      auto pending = store->pending_writes.find(target);
+      // Newer contents of the same file are written by the next flush.
+      if (pending != store->pending_writes.end() &&
+          pending->second.mapping == write.mapping) {
+        store->pending_writes.erase(pending);
+      }
+      if (write.evictable) {
+        store->usage[target.first].Record(target.second,
+                                         write.mapping->GetSize());
+      }
+    }
+
+    if (limit > 0) {
+      for (auto& [directory, usage] : store->usage) {
+        while (usage.scanned && usage.total_size > limit &&
+               usage.files.size() > 1) {
+          std::string file_name = std::move(usage.files.front());
+          usage.files.pop_front();
+          auto found = usage.entries.find(file_name);
+          usage.total_size -= found->second.first;
+          usage.entries.erase(found);
+          evicted.emplace_back(directory, std::move(file_name));
+        }
+      }
+    }
+  }
+
+  for (const auto& [directory, file_name] : evicted) {
+    TRACE_EVENT0("flutter", "PersistentCacheEvict");
+    fml::UnlinkFile(*directory, file_name.c_str());
   }
 }
 
@@ -420,9 +645,8 @@ void PersistentCache::store(const SkData& key, const SkData& data) {
     return;
   }
 
-  PersistentCacheStore(GetWorkerTaskRunner(),
-                       cache_sksl_ ? sksl_cache_directory_ : cache_directory_,
-                       std::move(file_name), std::move(mapping));
+  EnqueueWrite(cache_sksl_ ? sksl_cache_directory_ : cache_directory_,
+               std::move(file_name), std::move(mapping), /*evictable=*/true);
 }
 
 void PersistentCache::DumpSkp(const SkData& data) {
@@ -439,8 +663,8 @@ void PersistentCache::DumpSkp(const SkData& data) {
   FML_LOG(INFO) << "Dumping " << file_name;
   auto mapping = std::make_unique<fml::DataMapping>(
       std::vector<uint8_t>{data.bytes(), data.bytes() + data.size()});
-  PersistentCacheStore(GetWorkerTaskRunner(), cache_directory_,
-                       std::move(file_name), std::move(mapping));
+  EnqueueWrite(cache_directory_, std::move(file_name), std::move(mapping),
+               /*evictable=*/false);
 }
 
 void PersistentCache::AddWorkerTaskRunner(
@@ -45,6 +45,11 @@ class PersistentCache : public GrContextOptions::PersistentCache {
   // affect the cache directory returned by |GetCacheForProcess|.
   static void SetCacheDirectoryPath(std::string path);
 
+  // Limit the combined size of the shader files in each cache directory to
+  // |bytes|. The least recently used files are removed once the limit is
+  // exceeded. 0 means unlimited, which is the default.
+  static void SetCacheSizeLimit(size_t bytes);
+
   // Convert a binary SkData key into a Base32 encoded string.
   //
   // This is used to specify persistent cache filenames and service protocol
@@ -152,11 +157,19 @@ class PersistentCache : public GrContextOptions::PersistentCache {
   // strategy_set_ becomes true.
   static std::atomic<bool> strategy_set_;
 
+  static std::atomic<size_t> cache_size_limit_;
+
+  // The writes that have not been flushed to disk yet and the usage of the
+  // files on disk. Shared with the tasks that flush the writes on the worker
+  // task runner, which may outlive this cache.
+  struct Store;
+
   const bool is_read_only_;
   const std::shared_ptr<fml::UniqueFD> cache_directory_;
   const std::shared_ptr<fml::UniqueFD> sksl_cache_directory_;
   mutable std::mutex worker_task_runners_mutex_;
   std::multiset<fml::RefPtr<fml::TaskRunner>> worker_task_runners_;
+  const std::shared_ptr<Store> store_;
 
   bool stored_new_shaders_ = false;
   bool is_dumping_skp_ = false;
@@ -165,6 +178,12 @@ class PersistentCache : public GrContextOptions::PersistentCache {
                             const std::string& file_name,
                             bool need_key);
 
+  // Split |data| in the format of |BuildCacheObject| into its key and value,
+  // which refer to |data| instead of copying it.
+  static SkSLCache ParseCacheObject(const sk_sp<SkData>& data,
+                                    const std::string& file_name,
+                                    bool need_key);
+
   bool IsValid() const;
 
   explicit PersistentCache(bool read_only = false);
@@ -174,6 +193,15 @@ class PersistentCache : public GrContextOptions::PersistentCache {
 
   fml::RefPtr<fml::TaskRunner> GetWorkerTaskRunner() const;
 
+  // Queue |mapping| to be written to |file_name| in |directory| with the next
+  // batch of writes. Files with |evictable| set count towards the size limit.
+  void EnqueueWrite(const std::shared_ptr<fml::UniqueFD>& directory,
+                    std::string file_name,
+                    std::unique_ptr<fml::Mapping> mapping,
+                    bool evictable);
+
+  static void FlushWrites(const std::shared_ptr<Store>& store);
+
   friend class testing::ShellTest;
 
   FML_DISALLOW_COPY_AND_ASSIGN(PersistentCache);
@@ -90,6 +90,12 @@ void TextureRegistry::OnGrContextDestroyed() {
   }
 }
 
+void TextureRegistry::OnTrimMemory() {
+  for (auto& it : mapping_) {
+    it.second->OnTrimMemory();
+  }
+}
+
 std::shared_ptr<Texture> TextureRegistry::GetTexture(int64_t id) {
   auto it = mapping_.find(id);
   return it != mapping_.end() ? it->second : nullptr;
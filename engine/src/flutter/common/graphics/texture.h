@@ -58,6 +58,10 @@ class Texture : public ContextListener {
   // Called on raster thread.
   virtual void OnTextureUnregistered() = 0;
 
+  // Called on raster thread when the system is low on memory. Textures may
+  // release cached resources that they can recreate later.
+  virtual void OnTrimMemory() {}
+
   int64_t Id() { return id_; }
 
  private:
@@ -91,6 +95,9 @@ class TextureRegistry {
   // Called from raster thread.
   void OnGrContextDestroyed();
 
+  // Called from raster thread.
+  void OnTrimMemory();
+
  private:
   std::map<int64_t, std::shared_ptr<Texture>> mapping_;
   size_t image_counter_ = 0;
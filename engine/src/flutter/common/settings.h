@@ -15,6 +15,7 @@
 
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/closure.h"
+#include "flutter/fml/cpu_affinity.h"
 #include "flutter/fml/mapping.h"
 #include "flutter/fml/task_queue_id.h"
 #include "flutter/fml/time/time_point.h"
@@ -156,13 +157,123 @@ struct Settings {
   bool dump_skp_on_shader_compilation = false;
   bool cache_sksl = false;
   bool purge_persistent_cache = false;
+  // Whether the Skia backend replays DisplayLists that are stable across
+  // frames from recorded SkPictures. Ignored by Impeller.
+  bool enable_skia_picture_cache = false;
+  // Max bytes of shaders kept in the persistent cache, or 0 for unlimited.
+  size_t persistent_cache_max_bytes = 0;
+  // The path of a DisplayList complexity calibration profile to apply to the
+  // complexity calculator named in the profile, if any.
+  std::string complexity_calibration_path;
   bool endless_trace_buffer = false;
   bool enable_dart_profiling = false;
   bool profile_startup = false;
   bool disable_dart_asserts = false;
   bool enable_serial_gc = false;
+  // Whether large sets of sibling layers are prerolled in parallel on the
+  // concurrent worker pool rather than on the raster thread alone.
+  bool enable_parallel_preroll = false;
+  // Whether Impeller collects the independent save layer subtrees of the
+  // display lists it renders in parallel on the concurrent worker pool.
+  bool enable_parallel_recording = false;
+  // Whether the time spent painting the layer tree is attributed to the
+  // individual layers, see |LayerPaintProfiler|.
+  bool enable_layer_paint_profiling = false;
   bool profile_microtasks = false;
 
+  enum class FramePipelineMode {
+    // Use the pipeline depth of the platform.
+    kDefault,
+    // Keep a single frame in flight and start building each frame as late as
+    // the recent frame timings allow, to minimize input latency.
+    kLowLatency,
+    // Keep up to three frames in flight so that building and rasterizing
+    // overlap fully, to maximize smoothness.
+    kThroughput,
+    // Switch between the low latency and the throughput modes depending on
+    // whether the recent frames fit the frame budget.
+    kAdaptive,
+  };
+  FramePipelineMode frame_pipeline_mode = FramePipelineMode::kDefault;
+
+  // Whether frames whose predicted build and raster time exceeds the frame
+  // interval start building ahead of their vsync.
+  bool enable_predictive_frame_scheduling = false;
+
+  // Whether a frame started by vsync runs on the UI thread ahead of the other
+  // due tasks, such as platform messages and pointer events. Input that was
+  // queued before the vsync is then only dispatched after that frame, which
+  // adds a frame of input latency.
+  bool prioritize_vsync_frames = false;
+
+  // Whether the moves and hovers delivered between two frames are coalesced
+  // into one resampled event per device, see
+  // |ResamplingPointerDataDispatcher|.
+  bool enable_pointer_resampling = false;
+
+  // The cores that the engine threads are placed on, on devices whose cores
+  // have different speeds. Threads without a value keep the placement the
+  // embedder picks for them. Only honored on Android.
+  std::optional<fml::CpuAffinity> ui_thread_cpu_affinity;
+  std::optional<fml::CpuAffinity> raster_thread_cpu_affinity;
+  std::optional<fml::CpuAffinity> io_thread_cpu_affinity;
+  std::optional<fml::CpuAffinity> worker_thread_cpu_affinity;
+
+  // If set, the tasks of the concurrent worker pool of the VM are handed to
+  // this executor instead of being run on threads owned by the engine, see
+  // |fml::ConcurrentMessageLoop::CreateWithExecutor|. The executor must run
+  // each task exactly once and stay valid for as long as the VM runs.
+  // |concurrent_task_executor_worker_count| is the number of tasks it may run
+  // in parallel.
+  std::function<void(const fml::closure&)> concurrent_task_executor;
+  size_t concurrent_task_executor_worker_count = 1;
+
+  // Whether the events of the |fml::tracing::TraceRecorder| are written to
+  // |temp_directory_path| when a frame takes more than twice its budget.
+  bool dump_recorded_trace_on_jank = false;
+
+  // Whether the pages of the Dart snapshots that were resident once the first
+  // frame of an earlier launch was rasterized are read in ahead of time, in
+  // the background. The pages of the first launch, and of every launch after
+  // the snapshots change, are recorded in |temp_directory_path|.
+  bool prefetch_snapshot_pages = false;
+
+  // The number of consecutive frames whose rasterization must exceed the
+  // frame budget before the rendering quality is reduced by a step, see
+  // |FrameBudgetWatchdog|. 0 disables the watchdog.
+  size_t frame_budget_watchdog_misses = 0;
+
+  // The megabytes of GPU memory allocated by Impeller after a frame from
+  // which on the Dart VM is asked to collect garbage, see
+  // |GpuMemoryPressureMonitor|. 0 disables the collections.
+  size_t gpu_memory_gc_threshold_mb = 0;
+
+  // How much later than their target time the tasks posted to the engine
+  // threads may run when this saves waking up their loop again, see
+  // |fml::MessageLoopTaskQueues::SetWakeUpSlack|. Every task wakes up its
+  // loop if unset.
+  std::optional<fml::TimeDelta> task_wake_up_slack;
+
+  // The max estimated bytes of the images being decoded at once, or 0 for
+  // unlimited, see |ImageDecodeScheduler|.
+  size_t image_decode_max_bytes_in_flight = 0;
+
+  // How many frames of an animated image are decoded ahead of the frame being
+  // shown, on the concurrent task runner, see |AnimatedFrameCache|. 0 decodes
+  // every frame when it is asked for.
+  int animated_image_lookahead_frames = 0;
+
+  // Whether the JPEG and HEIF images are decoded with the decoders of the
+  // platform, which use the hardware decoders of the device where there are
+  // some, rather than the builtin software decoders. Only honored with
+  // Impeller, on iOS and on Android API level 31 and above.
+  bool enable_hardware_image_decoding = false;
+
+  // Whether the images that are decoded after a low memory warning, and that
+  // don't ask for a pixel format, are compressed to a block compressed
+  // texture format. Only honored with Impeller.
+  bool impeller_compress_images_on_low_memory = false;
+
   // Whether embedder only allows secure connections.
   bool may_insecurely_connect_to_all_domains = true;
   // JSON-formatted domain network policy.
@@ -184,6 +295,11 @@ struct Settings {
   // Whether the Dart VM service should be enabled.
   bool enable_vm_service = false;
 
+  // Whether the HTTP server of the Dart VM service is only started when the
+  // application asks for it, instead of when the service isolate starts.
+  // Binding the server and publishing its URL is then kept out of startup.
+  bool defer_vm_service_server = false;
+
   // Whether to publish the VM Service URL over mDNS.
   // On iOS 14 this prompts a local network permission dialog,
   // which cannot be accepted or dismissed in a CI environment.
@@ -247,6 +363,17 @@ struct Settings {
   // Requests a specific rendering backend.
   std::optional<std::string> requested_rendering_backend;
 
+  // Android board, hardware or SoC names that always try or never use the
+  // Impeller Vulkan backend when it is selected automatically.
+  std::vector<std::string> impeller_vulkan_allowlist;
+  std::vector<std::string> impeller_vulkan_denylist;
+
+  // Paths of pipeline cache files shipped with the application, in the format
+  // the Impeller Vulkan backend persists its pipeline cache in. A file
+  // generated on the same GPU model and driver bootstraps the pipeline cache
+  // of the device.
+  std::vector<std::string> impeller_vulkan_bundled_pipeline_caches;
+
   // Enable Vulkan validation on backends that support it. The validation layers
   // must be available to the application.
   bool enable_vulkan_validation = false;
@@ -364,6 +491,13 @@ struct Settings {
   /// This is used by the runOnPlatformThread API.
   bool enable_platform_isolates = false;
 
+  /// The number of background isolates that the root isolate keeps spawned,
+  /// in its isolate group, for the runOnBackgroundIsolate API. 0 disables the
+  /// pool, and kBackgroundIsolatePoolSizeFromCores sizes it from the number
+  /// of cores of the device, see |GetBackgroundIsolatePoolSize|.
+  static constexpr int kBackgroundIsolatePoolSizeFromCores = -1;
+  int background_isolate_pool_size = 0;
+
   enum class MergedPlatformUIThread {
     // Use separate threads for the UI and platform task runners.
     kDisabled,
@@ -3,12 +3,24 @@
 // found in the LICENSE file.
 
 #include "flutter/display_list/benchmarking/dl_benchmarks.h"
+#include "flutter/display_list/benchmarking/dl_complexity_calibration.h"
+#include "flutter/display_list/benchmarking/dl_complexity_gl.h"
+#if !SLIMPELLER
+#include "flutter/display_list/benchmarking/dl_complexity_metal.h"
+#endif  // !SLIMPELLER
 #include "flutter/display_list/dl_builder.h"
 #include "flutter/display_list/dl_op_flags.h"
 #include "flutter/display_list/dl_text_skia.h"
 #include "flutter/display_list/geometry/dl_path_builder.h"
 #include "flutter/display_list/skia/dl_sk_canvas.h"
 #include "flutter/display_list/testing/dl_test_snippets.h"
+#include "flutter/fml/file.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/time/time_point.h"
+
+#include <cstdlib>
+#include <map>
 
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkImage.h"
@@ -81,6 +93,62 @@ void AnnotateAttributes(unsigned attributes,
   }
 }
 
+// When the FLUTTER_DL_COMPLEXITY_CALIBRATION_OUTPUT environment variable
+// names a directory, the draw op benchmarks compare the time taken to
+// rasterize each DisplayList with the score the complexity calculator for the
+// backend predicted for it, and write the resulting calibration profile for
+// the device to dl_complexity_<backend>.txt in that directory after every
+// benchmark run. The profile can then be loaded at runtime, see
+// DlComplexityCalibration.
+//
+// The predictions are made with the calculators' built-in model, so no
+// calibration profile should be applied to them while calibrating.
+static void RecordCalibrationSample(benchmark::State& state,
+                                    BackendType backend_type,
+                                    DlComplexityCalibration::Category category,
+                                    const DisplayList& display_list,
+                                    fml::TimeDelta elapsed) {
+  static const char* output_directory =
+      std::getenv("FLUTTER_DL_COMPLEXITY_CALIBRATION_OUTPUT");
+  if (output_directory == nullptr || state.iterations() == 0) {
+    return;
+  }
+
+  DisplayListComplexityCalculator* calculator;
+  std::string backend;
+  switch (backend_type) {
+    case BackendType::kOpenGlBackend:
+      calculator = DisplayListGLComplexityCalculator::GetInstance();
+      backend = "gl";
+      break;
+#if !SLIMPELLER
+    case BackendType::kMetalBackend:
+      calculator = DisplayListMetalComplexityCalculator::GetInstance();
+      backend = "metal";
+      break;
+#endif  // !SLIMPELLER
+    default:
+      // The software backend uses the Naive calculator, which has nothing to
+      // calibrate.
+      return;
+  }
+
+  static std::map<std::string, DlComplexityCalibrator> calibrators;
+  auto it = calibrators.try_emplace(backend, backend).first;
+  it->second.AddSample(category, calculator->Compute(&display_list),
+                       state.iterations(), elapsed.ToMillisecondsF());
+
+  auto directory = fml::OpenDirectory(output_directory, true,
+                                      fml::FilePermission::kReadWrite);
+  std::string file_name = "dl_complexity_" + backend + ".txt";
+  fml::DataMapping profile(it->second.GetCalibration().Serialize());
+  if (!directory.is_valid() ||
+      !fml::WriteAtomically(directory, file_name.c_str(), profile)) {
+    FML_LOG(ERROR) << "Could not write complexity calibration profile to "
+                   << output_directory;
+  }
+}
+
 // Constants chosen to produce benchmark results in the region of 1-50ms
 constexpr size_t kLinesToDraw = 10000;
 constexpr size_t kRectsToDraw = 5000;
@@ -122,10 +190,14 @@ void BM_DrawLine(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  auto start = fml::TimePoint::Now();
   for ([[maybe_unused]] auto _ : state) {
     canvas->DrawDisplayList(display_list);
     surface->FlushSubmitCpuSync();
   }
+  RecordCalibrationSample(state, backend_type,
+                          DlComplexityCalibration::Category::kLine,
+                          *display_list, fml::TimePoint::Now() - start);
 
   auto filename = surface_provider->backend_name() + "-DrawLine-" +
                   std::to_string(state.range(0)) + ".png";
@@ -173,10 +245,14 @@ void BM_DrawRect(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  auto start = fml::TimePoint::Now();
   for ([[maybe_unused]] auto _ : state) {
     canvas->DrawDisplayList(display_list);
     surface->FlushSubmitCpuSync();
   }
+  RecordCalibrationSample(state, backend_type,
+                          DlComplexityCalibration::Category::kRect,
+                          *display_list, fml::TimePoint::Now() - start);
 
   auto filename = surface_provider->backend_name() + "-DrawRect-" +
                   std::to_string(state.range(0)) + ".png";
@@ -221,10 +297,14 @@ void BM_DrawOval(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  auto start = fml::TimePoint::Now();
   for ([[maybe_unused]] auto _ : state) {
     canvas->DrawDisplayList(display_list);
     surface->FlushSubmitCpuSync();
   }
+  RecordCalibrationSample(state, backend_type,
+                          DlComplexityCalibration::Category::kOval,
+                          *display_list, fml::TimePoint::Now() - start);
 
   auto filename = surface_provider->backend_name() + "-DrawOval-" +
                   std::to_string(state.range(0)) + ".png";
@@ -269,10 +349,14 @@ void BM_DrawCircle(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  auto start = fml::TimePoint::Now();
   for ([[maybe_unused]] auto _ : state) {
     canvas->DrawDisplayList(display_list);
     surface->FlushSubmitCpuSync();
   }
+  RecordCalibrationSample(state, backend_type,
+                          DlComplexityCalibration::Category::kCircle,
+                          *display_list, fml::TimePoint::Now() - start);
 
   auto filename = surface_provider->backend_name() + "-DrawCircle-" +
                   std::to_string(state.range(0)) + ".png";
@@ -343,10 +427,14 @@ void BM_DrawRRect(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  auto start = fml::TimePoint::Now();
   for ([[maybe_unused]] auto _ : state) {
     canvas->DrawDisplayList(display_list);
     surface->FlushSubmitCpuSync();
   }
+  RecordCalibrationSample(state, backend_type,
+                          DlComplexityCalibration::Category::kRoundRect,
+                          *display_list, fml::TimePoint::Now() - start);
 
   auto filename = surface_provider->backend_name() + "-DrawRRect-" +
                   std::to_string(state.range(0)) + ".png";
@@ -426,10 +514,14 @@ void BM_DrawDRRect(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  auto start = fml::TimePoint::Now();
   for ([[maybe_unused]] auto _ : state) {
     canvas->DrawDisplayList(display_list);
     surface->FlushSubmitCpuSync();
   }
+  RecordCalibrationSample(state, backend_type,
+                          DlComplexityCalibration::Category::kDiffRoundRect,
+                          *display_list, fml::TimePoint::Now() - start);
 
   auto filename = surface_provider->backend_name() + "-DrawDRRect-" +
                   std::to_string(state.range(0)) + ".png";
@@ -481,10 +573,14 @@ void BM_DrawArc(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  auto start = fml::TimePoint::Now();
   for ([[maybe_unused]] auto _ : state) {
     canvas->DrawDisplayList(display_list);
     surface->FlushSubmitCpuSync();
   }
+  RecordCalibrationSample(state, backend_type,
+                          DlComplexityCalibration::Category::kArc,
+                          *display_list, fml::TimePoint::Now() - start);
 
   auto filename = surface_provider->backend_name() + "-DrawArc-" +
                   std::to_string(state.range(0)) + ".png";
@@ -703,10 +799,14 @@ void BM_DrawPath(benchmark::State& state,
   surface->FlushSubmitCpuSync();
 
   // We only want to time the actual rasterization.
+  auto start = fml::TimePoint::Now();
   for ([[maybe_unused]] auto _ : state) {
     canvas->DrawDisplayList(display_list);
     surface->FlushSubmitCpuSync();
   }
+  RecordCalibrationSample(state, backend_type,
+                          DlComplexityCalibration::Category::kPath,
+                          *display_list, fml::TimePoint::Now() - start);
 
   auto filename = surface_provider->backend_name() + "-DrawPath-" + label +
                   "-" + std::to_string(state.range(0)) + ".png";
@@ -849,10 +949,14 @@ void BM_DrawVertices(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  auto start = fml::TimePoint::Now();
   for ([[maybe_unused]] auto _ : state) {
     canvas->DrawDisplayList(display_list);
     surface->FlushSubmitCpuSync();
   }
+  RecordCalibrationSample(state, backend_type,
+                          DlComplexityCalibration::Category::kVertices,
+                          *display_list, fml::TimePoint::Now() - start);
 
   auto filename = surface_provider->backend_name() + "-DrawVertices-" +
                   std::to_string(disc_count) + "-" + VertexModeToString(mode) +
@@ -946,10 +1050,14 @@ void BM_DrawPoints(benchmark::State& state,
 
   auto display_list = builder.Build();
 
+  auto start = fml::TimePoint::Now();
   for ([[maybe_unused]] auto _ : state) {
     canvas->DrawDisplayList(display_list);
     surface->FlushSubmitCpuSync();
   }
+  RecordCalibrationSample(state, backend_type,
+                          DlComplexityCalibration::Category::kPoints,
+                          *display_list, fml::TimePoint::Now() - start);
 
   auto filename = surface_provider->backend_name() + "-DrawPoints-" +
                   PointModeToString(mode) + "-" + std::to_string(point_count) +
@@ -1024,10 +1132,14 @@ void BM_DrawImage(benchmark::State& state,
 
   auto display_list = builder.Build();
 
+  auto start = fml::TimePoint::Now();
   for ([[maybe_unused]] auto _ : state) {
     canvas->DrawDisplayList(display_list);
     surface->FlushSubmitCpuSync();
   }
+  RecordCalibrationSample(state, backend_type,
+                          DlComplexityCalibration::Category::kImage,
+                          *display_list, fml::TimePoint::Now() - start);
 
   auto filename = surface_provider->backend_name() + "-DrawImage-" +
                   (upload_bitmap ? "Upload-" : "Texture-") +
@@ -1111,10 +1223,14 @@ void BM_DrawImageRect(benchmark::State& state,
 
   auto display_list = builder.Build();
 
+  auto start = fml::TimePoint::Now();
   for ([[maybe_unused]] auto _ : state) {
     canvas->DrawDisplayList(display_list);
     surface->FlushSubmitCpuSync();
   }
+  RecordCalibrationSample(state, backend_type,
+                          DlComplexityCalibration::Category::kImageRect,
+                          *display_list, fml::TimePoint::Now() - start);
 
   auto filename = surface_provider->backend_name() + "-DrawImageRect-" +
                   (upload_bitmap ? "Upload-" : "Texture-") +
@@ -1199,10 +1315,14 @@ void BM_DrawImageNine(benchmark::State& state,
 
   auto display_list = builder.Build();
 
+  auto start = fml::TimePoint::Now();
   for ([[maybe_unused]] auto _ : state) {
     canvas->DrawDisplayList(display_list);
     surface->FlushSubmitCpuSync();
   }
+  RecordCalibrationSample(state, backend_type,
+                          DlComplexityCalibration::Category::kImageNine,
+                          *display_list, fml::TimePoint::Now() - start);
 
   auto filename = surface_provider->backend_name() + "-DrawImageNine-" +
                   (upload_bitmap ? "Upload-" : "Texture-") +
@@ -1246,10 +1366,14 @@ void BM_DrawTextBlob(benchmark::State& state,
 
   auto display_list = builder.Build();
 
+  auto start = fml::TimePoint::Now();
   for ([[maybe_unused]] auto _ : state) {
     canvas->DrawDisplayList(display_list);
     surface->FlushSubmitCpuSync();
   }
+  RecordCalibrationSample(state, backend_type,
+                          DlComplexityCalibration::Category::kText,
+                          *display_list, fml::TimePoint::Now() - start);
 
   auto filename = surface_provider->backend_name() + "-DrawTextBlob-" +
                   std::to_string(draw_calls) + ".png";
@@ -1318,10 +1442,14 @@ void BM_DrawShadow(benchmark::State& state,
   surface->FlushSubmitCpuSync();
 
   // We only want to time the actual rasterization.
+  auto start = fml::TimePoint::Now();
   for ([[maybe_unused]] auto _ : state) {
     canvas->DrawDisplayList(display_list);
     surface->FlushSubmitCpuSync();
   }
+  RecordCalibrationSample(state, backend_type,
+                          DlComplexityCalibration::Category::kShadow,
+                          *display_list, fml::TimePoint::Now() - start);
 
   auto filename = surface_provider->backend_name() + "-DrawShadow-" +
                   VerbToString(type) + "-" +
@@ -1372,10 +1500,14 @@ void BM_SaveLayer(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  auto start = fml::TimePoint::Now();
   for ([[maybe_unused]] auto _ : state) {
     canvas->DrawDisplayList(display_list);
     surface->FlushSubmitCpuSync();
   }
+  RecordCalibrationSample(state, backend_type,
+                          DlComplexityCalibration::Category::kSaveLayer,
+                          *display_list, fml::TimePoint::Now() - start);
 
   auto filename = surface_provider->backend_name() + "-SaveLayer-" +
                   std::to_string(save_depth) + "-" +
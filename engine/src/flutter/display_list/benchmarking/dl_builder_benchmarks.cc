@@ -5,6 +5,7 @@
 #include "flutter/benchmarking/benchmarking.h"
 #include "flutter/display_list/testing/dl_test_snippets.h"
 #include "flutter/display_list/utils/dl_receiver_utils.h"
+#include "flutter/fml/concurrent_message_loop.h"
 
 namespace flutter {
 
@@ -33,6 +34,12 @@ enum class DisplayListDispatchBenchmarkType {
   kCulledWithRtree,
 };
 
+enum class DlRTreeBenchmarkType {
+  kInsertionOrder,
+  kHilbert,
+  kHilbertWithWorkers,
+};
+
 static void InvokeAllRenderingOps(DisplayListBuilder& builder) {
   DlOpReceiver& receiver = DisplayListBuilderBenchmarkAccessor(builder);
   for (auto& group : allRenderingOps) {
@@ -111,6 +118,25 @@ static void BM_DisplayListBuilderWithScaleAndTranslate(
   }
 }
 
+// Records the ops the way a scrolling list does, with each item drawn
+// under its own translate inside a save/restore pair.
+static void BM_DisplayListBuilderWithTranslatedListItems(
+    benchmark::State& state,
+    DisplayListBuilderBenchmarkType type) {
+  bool prepare_rtree = NeedPrepareRTree(type);
+  while (state.KeepRunning()) {
+    DisplayListBuilder builder(prepare_rtree);
+    builder.Translate(0, -37.5);
+    for (int i = 0; i < 10; i++) {
+      builder.Save();
+      builder.Translate(8, i * 56.0f);
+      InvokeAllRenderingOps(builder);
+      builder.Restore();
+    }
+    Complete(builder, type);
+  }
+}
+
 static void BM_DisplayListBuilderWithPerspective(
     benchmark::State& state,
     DisplayListBuilderBenchmarkType type) {
@@ -310,6 +336,34 @@ static void BM_DisplayListDispatchByVectorCull(
   }
 }
 
+// Builds an RTree over the bounds of |state.range(0)| ops scattered over a
+// grid in no spatial order, the way the ops of a large chart are recorded.
+static void BM_DlRTreeConstruction(benchmark::State& state,
+                                   DlRTreeBenchmarkType type) {
+  const int count = state.range(0);
+  std::vector<DlRect> rects(count);
+  std::vector<int> ids(count);
+  for (int i = 0; i < count; i++) {
+    int cell = static_cast<int>((i * 7919LL) % count);
+    rects[i] = DlRect::MakeXYWH((cell % 256) * 4, (cell / 256) * 4, 6, 6);
+    ids[i] = i;
+  }
+  DlRTree::Packing packing = type == DlRTreeBenchmarkType::kInsertionOrder
+                                 ? DlRTree::Packing::kInsertionOrder
+                                 : DlRTree::Packing::kHilbert;
+  std::shared_ptr<fml::ConcurrentMessageLoop> loop;
+  std::shared_ptr<fml::ConcurrentTaskRunner> workers;
+  if (type == DlRTreeBenchmarkType::kHilbertWithWorkers) {
+    loop = fml::ConcurrentMessageLoop::Create();
+    workers = loop->GetTaskRunner();
+  }
+  while (state.KeepRunning()) {
+    DlRTree rtree(rects.data(), count, ids.data(), [](int) { return true; },
+                  -1, packing, workers);
+    benchmark::DoNotOptimize(rtree.node_count());
+  }
+}
+
 BENCHMARK_CAPTURE(BM_DisplayListBuilderDefault,
                   kDefault,
                   DisplayListBuilderBenchmarkType::kDefault)
@@ -344,6 +398,23 @@ BENCHMARK_CAPTURE(BM_DisplayListBuilderWithScaleAndTranslate,
                   DisplayListBuilderBenchmarkType::kBoundsAndRtree)
     ->Unit(benchmark::kMicrosecond);
 
+BENCHMARK_CAPTURE(BM_DisplayListBuilderWithTranslatedListItems,
+                  kDefault,
+                  DisplayListBuilderBenchmarkType::kDefault)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DisplayListBuilderWithTranslatedListItems,
+                  kBounds,
+                  DisplayListBuilderBenchmarkType::kBounds)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DisplayListBuilderWithTranslatedListItems,
+                  kRtree,
+                  DisplayListBuilderBenchmarkType::kRtree)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DisplayListBuilderWithTranslatedListItems,
+                  kBoundsAndRtree,
+                  DisplayListBuilderBenchmarkType::kBoundsAndRtree)
+    ->Unit(benchmark::kMicrosecond);
+
 BENCHMARK_CAPTURE(BM_DisplayListBuilderWithPerspective,
                   kDefault,
                   DisplayListBuilderBenchmarkType::kDefault)
@@ -464,4 +535,25 @@ BENCHMARK_CAPTURE(BM_DisplayListDispatchByVectorCull,
                   DisplayListDispatchBenchmarkType::kCulledWithRtree)
     ->Unit(benchmark::kMicrosecond);
 
+BENCHMARK_CAPTURE(BM_DlRTreeConstruction,
+                  kInsertionOrder,
+                  DlRTreeBenchmarkType::kInsertionOrder)
+    ->RangeMultiplier(4)
+    ->Range(4096, 262144)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_DlRTreeConstruction,
+                  kHilbert,
+                  DlRTreeBenchmarkType::kHilbert)
+    ->RangeMultiplier(4)
+    ->Range(4096, 262144)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_DlRTreeConstruction,
+                  kHilbertWithWorkers,
+                  DlRTreeBenchmarkType::kHilbertWithWorkers)
+    ->RangeMultiplier(4)
+    ->Range(4096, 262144)
+    ->Unit(benchmark::kMicrosecond);
+
 }  // namespace flutter
@@ -4,6 +4,7 @@
 
 #include "flutter/display_list/benchmarking/dl_complexity.h"
 #include "flutter/display_list/benchmarking/dl_complexity_gl.h"
+#include "flutter/display_list/benchmarking/dl_complexity_impeller.h"
 #if !SLIMPELLER
 #include "flutter/display_list/benchmarking/dl_complexity_metal.h"
 #endif  // !SLIMPELLER
@@ -38,9 +39,34 @@ DisplayListComplexityCalculator* DisplayListComplexityCalculator::GetForBackend(
   }
 }
 
+DisplayListComplexityCalculator*
+DisplayListComplexityCalculator::GetForImpeller() {
+  return DisplayListImpellerComplexityCalculator::GetInstance();
+}
+
 DisplayListComplexityCalculator*
 DisplayListComplexityCalculator::GetForSoftware() {
   return DisplayListNaiveComplexityCalculator::GetInstance();
 }
 
+bool DisplayListComplexityCalculator::ApplyCalibration(
+    const DlComplexityCalibration& calibration) {
+  DisplayListComplexityCalculator* calculator = nullptr;
+  const std::string& backend = calibration.GetBackend();
+  if (backend == "gl") {
+    calculator = DisplayListGLComplexityCalculator::GetInstance();
+  } else if (backend == "impeller") {
+    calculator = DisplayListImpellerComplexityCalculator::GetInstance();
+#if !SLIMPELLER
+  } else if (backend == "metal") {
+    calculator = DisplayListMetalComplexityCalculator::GetInstance();
+#endif  // !SLIMPELLER
+  }
+  if (calculator == nullptr) {
+    return false;
+  }
+  calculator->SetCalibration(calibration);
+  return true;
+}
+
 }  // namespace flutter
@@ -5,6 +5,7 @@
 #ifndef FLUTTER_DISPLAY_LIST_BENCHMARKING_DL_COMPLEXITY_H_
 #define FLUTTER_DISPLAY_LIST_BENCHMARKING_DL_COMPLEXITY_H_
 
+#include "flutter/display_list/benchmarking/dl_complexity_calibration.h"
 #include "flutter/display_list/display_list.h"
 
 #include "third_party/skia/include/gpu/ganesh/GrTypes.h"
@@ -15,6 +16,12 @@ class DisplayListComplexityCalculator {
  public:
   static DisplayListComplexityCalculator* GetForSoftware();
   static DisplayListComplexityCalculator* GetForBackend(GrBackendApi backend);
+  static DisplayListComplexityCalculator* GetForImpeller();
+
+  // Hands |calibration| to the calculator named by its backend. Returns
+  // false if the profile does not name a calculator that can be calibrated
+  // in this build.
+  static bool ApplyCalibration(const DlComplexityCalibration& calibration);
 
   virtual ~DisplayListComplexityCalculator() = default;
 
@@ -31,6 +38,13 @@ class DisplayListComplexityCalculator {
   // This setting has no effect on non-accumulator based scorers such as
   // the Naive calculator.
   virtual void SetComplexityCeiling(unsigned int ceiling) = 0;
+
+  // Replaces the per-device corrections applied to the scores computed by
+  // this calculator. The default calibration is the identity.
+  //
+  // This setting has no effect on non-accumulator based scorers such as
+  // the Naive calculator.
+  virtual void SetCalibration(const DlComplexityCalibration& calibration) = 0;
 };
 
 class DisplayListNaiveComplexityCalculator
@@ -48,6 +62,8 @@ class DisplayListNaiveComplexityCalculator
 
   void SetComplexityCeiling(unsigned int ceiling) override {}
 
+  void SetCalibration(const DlComplexityCalibration& calibration) override {}
+
  private:
   DisplayListNaiveComplexityCalculator() {}
   static DisplayListNaiveComplexityCalculator* instance_;
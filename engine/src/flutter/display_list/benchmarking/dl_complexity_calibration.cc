@@ -0,0 +1,224 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/benchmarking/dl_complexity_calibration.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <sstream>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/mapping.h"
+
+namespace flutter {
+
+namespace {
+
+// Scores are normalized so that 100 is roughly equivalent to 0.0005ms of
+// rasterization time. See dl_complexity_helper.h.
+constexpr double kScorePerMillisecond = 200000.0;
+
+// Corrections outside of this range point at a broken measurement rather
+// than at a slow or fast device.
+constexpr uint32_t kMinScale = 1u;
+constexpr uint32_t kMaxScale = DlComplexityCalibration::kUnitScale << 10;
+
+constexpr const char* kCategoryNames[] = {
+    "paint",    "save_layer", "line",       "rect",   "oval",   "circle",
+    "rrect",    "drrect",     "path",       "arc",    "points", "vertices",
+    "image",    "image_rect", "image_nine", "text",   "shadow",
+};
+static_assert(std::size(kCategoryNames) ==
+              DlComplexityCalibration::kCategoryCount);
+
+std::optional<DlComplexityCalibration::Category> CategoryForName(
+    std::string_view name) {
+  for (size_t i = 0; i < DlComplexityCalibration::kCategoryCount; i++) {
+    if (name == kCategoryNames[i]) {
+      return static_cast<DlComplexityCalibration::Category>(i);
+    }
+  }
+  return std::nullopt;
+}
+
+bool ParseUnsigned(const std::string& token, unsigned int* value) {
+  if (token.empty() || token[0] == '-') {
+    return false;
+  }
+  char* end = nullptr;
+  unsigned long parsed = std::strtoul(token.c_str(), &end, 10);
+  if (*end != '\0' || parsed > UINT32_MAX) {
+    return false;
+  }
+  *value = static_cast<unsigned int>(parsed);
+  return true;
+}
+
+bool ParseScale(const std::string& token, float* value) {
+  char* end = nullptr;
+  float parsed = std::strtof(token.c_str(), &end);
+  if (token.empty() || *end != '\0' || !std::isfinite(parsed) ||
+      parsed <= 0.0f) {
+    return false;
+  }
+  *value = parsed;
+  return true;
+}
+
+}  // namespace
+
+DlComplexityCalibration::DlComplexityCalibration() {
+  scales_.fill(kUnitScale);
+}
+
+const char* DlComplexityCalibration::GetCategoryName(Category category) {
+  return kCategoryNames[static_cast<size_t>(category)];
+}
+
+float DlComplexityCalibration::GetScale(Category category) const {
+  return static_cast<float>(scales_[static_cast<size_t>(category)]) /
+         kUnitScale;
+}
+
+void DlComplexityCalibration::SetScale(Category category, float scale) {
+  uint32_t fixed = kUnitScale;
+  if (std::isfinite(scale) && scale > 0.0f) {
+    double scaled = std::round(static_cast<double>(scale) * kUnitScale);
+    fixed = static_cast<uint32_t>(
+        std::clamp(scaled, static_cast<double>(kMinScale),
+                   static_cast<double>(kMaxScale)));
+  }
+  scales_[static_cast<size_t>(category)] = fixed;
+}
+
+bool DlComplexityCalibration::IsIdentity() const {
+  if (cache_threshold_.has_value()) {
+    return false;
+  }
+  for (uint32_t scale : scales_) {
+    if (scale != kUnitScale) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::string DlComplexityCalibration::Serialize() const {
+  std::ostringstream stream;
+  stream << "# DisplayList complexity calibration\n";
+  stream << "version " << kFormatVersion << "\n";
+  if (!backend_.empty()) {
+    stream << "backend " << backend_ << "\n";
+  }
+  if (cache_threshold_.has_value()) {
+    stream << "threshold " << cache_threshold_.value() << "\n";
+  }
+  for (size_t i = 0; i < kCategoryCount; i++) {
+    stream << kCategoryNames[i] << " "
+           << static_cast<double>(scales_[i]) / kUnitScale << "\n";
+  }
+  return stream.str();
+}
+
+std::optional<DlComplexityCalibration> DlComplexityCalibration::Parse(
+    std::string_view text) {
+  DlComplexityCalibration calibration;
+  bool has_version = false;
+
+  std::istringstream lines{std::string(text)};
+  std::string line;
+  while (std::getline(lines, line)) {
+    std::istringstream tokens(line);
+    std::string key;
+    if (!(tokens >> key) || key[0] == '#') {
+      continue;
+    }
+    std::string value;
+    std::string trailing;
+    if (!(tokens >> value) || (tokens >> trailing)) {
+      return std::nullopt;
+    }
+
+    if (key == "version") {
+      unsigned int version;
+      if (!ParseUnsigned(value, &version) || version != kFormatVersion) {
+        return std::nullopt;
+      }
+      has_version = true;
+    } else if (key == "backend") {
+      calibration.backend_ = value;
+    } else if (key == "threshold") {
+      unsigned int threshold;
+      if (!ParseUnsigned(value, &threshold)) {
+        return std::nullopt;
+      }
+      calibration.cache_threshold_ = threshold;
+    } else if (auto category = CategoryForName(key)) {
+      float scale;
+      if (!ParseScale(value, &scale)) {
+        return std::nullopt;
+      }
+      calibration.SetScale(category.value(), scale);
+    } else {
+      return std::nullopt;
+    }
+  }
+
+  if (!has_version) {
+    return std::nullopt;
+  }
+  return calibration;
+}
+
+std::optional<DlComplexityCalibration> DlComplexityCalibration::LoadFromFile(
+    const std::string& path) {
+  auto mapping = fml::FileMapping::CreateReadOnly(path);
+  if (!mapping || mapping->GetMapping() == nullptr) {
+    FML_LOG(ERROR) << "Could not open complexity calibration profile at "
+                   << path;
+    return std::nullopt;
+  }
+  auto calibration = Parse(std::string_view(
+      reinterpret_cast<const char*>(mapping->GetMapping()),
+      mapping->GetSize()));
+  if (!calibration.has_value()) {
+    FML_LOG(ERROR) << "Malformed complexity calibration profile at " << path;
+  }
+  return calibration;
+}
+
+DlComplexityCalibrator::DlComplexityCalibrator(std::string backend)
+    : backend_(std::move(backend)) {}
+
+void DlComplexityCalibrator::AddSample(
+    DlComplexityCalibration::Category category,
+    unsigned int predicted_score,
+    uint64_t iterations,
+    double measured_milliseconds) {
+  if (predicted_score == 0u || iterations == 0u ||
+      !(measured_milliseconds > 0.0)) {
+    return;
+  }
+  Totals& totals = totals_[static_cast<size_t>(category)];
+  totals.predicted_score += static_cast<double>(predicted_score) * iterations;
+  totals.measured_score += measured_milliseconds * kScorePerMillisecond;
+}
+
+DlComplexityCalibration DlComplexityCalibrator::GetCalibration() const {
+  DlComplexityCalibration calibration;
+  calibration.SetBackend(backend_);
+  for (size_t i = 0; i < DlComplexityCalibration::kCategoryCount; i++) {
+    const Totals& totals = totals_[i];
+    if (totals.predicted_score > 0.0) {
+      calibration.SetScale(
+          static_cast<DlComplexityCalibration::Category>(i),
+          static_cast<float>(totals.measured_score / totals.predicted_score));
+    }
+  }
+  return calibration;
+}
+
+}  // namespace flutter
@@ -0,0 +1,146 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_BENCHMARKING_DL_COMPLEXITY_CALIBRATION_H_
+#define FLUTTER_DISPLAY_LIST_BENCHMARKING_DL_COMPLEXITY_CALIBRATION_H_
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace flutter {
+
+// A set of per-device corrections for the hand-tuned cost models used by
+// the accumulator based complexity calculators.
+//
+// The Metal and GL models were fitted against benchmark data from a single
+// reference device each. A calibration profile records, for each category
+// of draw operation, how much slower or faster the current device is than
+// that model predicts, so that the complexity scores (and the caching
+// decisions made from them) track the real cost on the device.
+//
+// Profiles are produced by running the display_list_benchmarks suite with
+// the FLUTTER_DL_COMPLEXITY_CALIBRATION_OUTPUT environment variable set to
+// a file path, and are loaded at runtime with |LoadFromFile|.
+class DlComplexityCalibration {
+ public:
+  enum class Category : uint8_t {
+    kPaint,
+    kSaveLayer,
+    kLine,
+    kRect,
+    kOval,
+    kCircle,
+    kRoundRect,
+    kDiffRoundRect,
+    kPath,
+    kArc,
+    kPoints,
+    kVertices,
+    kImage,
+    kImageRect,
+    kImageNine,
+    kText,
+    kShadow,
+  };
+  static constexpr size_t kCategoryCount =
+      static_cast<size_t>(Category::kShadow) + 1;
+
+  // Scales are stored as fixed point values so that applying them stays
+  // within the integer arithmetic the complexity helpers are limited to.
+  static constexpr uint32_t kUnitScale = 1u << 10;
+
+  // The version written by |Serialize| and accepted by |Parse|.
+  static constexpr uint32_t kFormatVersion = 1u;
+
+  // Constructs an identity calibration that leaves every score unchanged.
+  DlComplexityCalibration();
+
+  // Parses a profile in the format written by |Serialize|. Returns
+  // std::nullopt if the profile is malformed or has an unknown version.
+  static std::optional<DlComplexityCalibration> Parse(std::string_view text);
+
+  // Reads and parses the profile stored at |path|.
+  static std::optional<DlComplexityCalibration> LoadFromFile(
+      const std::string& path);
+
+  // Returns the name used for |category| in serialized profiles.
+  static const char* GetCategoryName(Category category);
+
+  std::string Serialize() const;
+
+  // The name of the complexity calculator this profile was measured for,
+  // one of "gl", "metal" or "impeller".
+  const std::string& GetBackend() const { return backend_; }
+  void SetBackend(std::string backend) { backend_ = std::move(backend); }
+
+  float GetScale(Category category) const;
+
+  // Sets the correction for |category|. Non-finite or non-positive scales
+  // reset the category to the identity scale.
+  void SetScale(Category category, float scale);
+
+  // The complexity score above which a DisplayList should be cached, if the
+  // profile overrides the default threshold of the calculator.
+  std::optional<unsigned int> GetCacheThreshold() const {
+    return cache_threshold_;
+  }
+  void SetCacheThreshold(std::optional<unsigned int> threshold) {
+    cache_threshold_ = threshold;
+  }
+
+  bool IsIdentity() const;
+
+  // Returns |complexity| corrected for |category|, saturating rather than
+  // overflowing.
+  unsigned int Apply(Category category, unsigned int complexity) const {
+    uint32_t scale = scales_[static_cast<size_t>(category)];
+    if (scale == kUnitScale) {
+      return complexity;
+    }
+    uint64_t scaled = (static_cast<uint64_t>(complexity) * scale) >> 10;
+    return scaled > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(scaled);
+  }
+
+ private:
+  std::string backend_;
+  std::array<uint32_t, kCategoryCount> scales_;
+  std::optional<unsigned int> cache_threshold_;
+};
+
+// Accumulates measurements of how long a category of draw operations took
+// to rasterize compared with the score predicted for it and turns them into
+// a |DlComplexityCalibration|.
+class DlComplexityCalibrator {
+ public:
+  explicit DlComplexityCalibrator(std::string backend);
+
+  // Records that |iterations| rasterizations of a DisplayList which was
+  // scored at |predicted_score| took |measured_milliseconds| in total.
+  void AddSample(DlComplexityCalibration::Category category,
+                 unsigned int predicted_score,
+                 uint64_t iterations,
+                 double measured_milliseconds);
+
+  // Returns a profile scaling each sampled category by the ratio between
+  // its measured and predicted cost. Categories without samples keep the
+  // identity scale.
+  DlComplexityCalibration GetCalibration() const;
+
+ private:
+  struct Totals {
+    double predicted_score = 0.0;
+    double measured_score = 0.0;
+  };
+
+  std::string backend_;
+  std::array<Totals, DlComplexityCalibration::kCategoryCount> totals_;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_BENCHMARKING_DL_COMPLEXITY_CALIBRATION_H_
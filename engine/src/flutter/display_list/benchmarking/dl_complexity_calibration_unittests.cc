@@ -0,0 +1,146 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/benchmarking/dl_complexity_calibration.h"
+#include "flutter/display_list/benchmarking/dl_complexity.h"
+#include "flutter/display_list/benchmarking/dl_complexity_gl.h"
+#include "flutter/display_list/benchmarking/dl_complexity_impeller.h"
+#include "flutter/display_list/dl_builder.h"
+#include "flutter/testing/testing.h"
+
+#include <limits>
+
+namespace flutter {
+namespace testing {
+
+using Category = DlComplexityCalibration::Category;
+
+TEST(DisplayListComplexityCalibration, DefaultIsIdentity) {
+  DlComplexityCalibration calibration;
+  EXPECT_TRUE(calibration.IsIdentity());
+  EXPECT_FALSE(calibration.GetCacheThreshold().has_value());
+  for (size_t i = 0; i < DlComplexityCalibration::kCategoryCount; i++) {
+    auto category = static_cast<Category>(i);
+    EXPECT_EQ(calibration.GetScale(category), 1.0f);
+    EXPECT_EQ(calibration.Apply(category, 12345u), 12345u);
+  }
+}
+
+TEST(DisplayListComplexityCalibration, ApplyScalesAndSaturates) {
+  DlComplexityCalibration calibration;
+  calibration.SetScale(Category::kPath, 2.5f);
+  calibration.SetScale(Category::kText, 0.5f);
+  EXPECT_FALSE(calibration.IsIdentity());
+
+  EXPECT_EQ(calibration.Apply(Category::kPath, 1000u), 2500u);
+  EXPECT_EQ(calibration.Apply(Category::kText, 1000u), 500u);
+  EXPECT_EQ(calibration.Apply(Category::kRect, 1000u), 1000u);
+  EXPECT_EQ(calibration.Apply(Category::kPath,
+                              std::numeric_limits<unsigned int>::max()),
+            std::numeric_limits<unsigned int>::max());
+
+  // Nonsensical scales fall back to the identity.
+  calibration.SetScale(Category::kPath, -1.0f);
+  EXPECT_EQ(calibration.GetScale(Category::kPath), 1.0f);
+  calibration.SetScale(Category::kPath, std::numeric_limits<float>::infinity());
+  EXPECT_EQ(calibration.GetScale(Category::kPath), 1.0f);
+}
+
+TEST(DisplayListComplexityCalibration, SerializeRoundTrips) {
+  DlComplexityCalibration calibration;
+  calibration.SetBackend("impeller");
+  calibration.SetCacheThreshold(150000u);
+  calibration.SetScale(Category::kCircle, 1.75f);
+  calibration.SetScale(Category::kShadow, 0.25f);
+
+  auto parsed = DlComplexityCalibration::Parse(calibration.Serialize());
+  ASSERT_TRUE(parsed.has_value());
+  EXPECT_EQ(parsed->GetBackend(), "impeller");
+  EXPECT_EQ(parsed->GetCacheThreshold(), std::optional<unsigned int>(150000u));
+  for (size_t i = 0; i < DlComplexityCalibration::kCategoryCount; i++) {
+    auto category = static_cast<Category>(i);
+    EXPECT_EQ(parsed->GetScale(category), calibration.GetScale(category))
+        << DlComplexityCalibration::GetCategoryName(category);
+  }
+}
+
+TEST(DisplayListComplexityCalibration, ParseRejectsMalformedProfiles) {
+  // Missing version.
+  EXPECT_FALSE(DlComplexityCalibration::Parse("line 1.5\n").has_value());
+  // Unknown version.
+  EXPECT_FALSE(DlComplexityCalibration::Parse("version 2\n").has_value());
+  // Unknown category.
+  EXPECT_FALSE(
+      DlComplexityCalibration::Parse("version 1\nsparkle 1.0\n").has_value());
+  // Bad values.
+  EXPECT_FALSE(
+      DlComplexityCalibration::Parse("version 1\nline fast\n").has_value());
+  EXPECT_FALSE(
+      DlComplexityCalibration::Parse("version 1\nline -2\n").has_value());
+  EXPECT_FALSE(
+      DlComplexityCalibration::Parse("version 1\nthreshold -5\n").has_value());
+  EXPECT_FALSE(
+      DlComplexityCalibration::Parse("version 1\nline 1 2\n").has_value());
+
+  auto parsed = DlComplexityCalibration::Parse(
+      "# comment\n\nversion 1\n  rect 2\n# line 3\n");
+  ASSERT_TRUE(parsed.has_value());
+  EXPECT_EQ(parsed->GetScale(Category::kRect), 2.0f);
+  EXPECT_EQ(parsed->GetScale(Category::kLine), 1.0f);
+}
+
+TEST(DisplayListComplexityCalibration, CalibratorUsesMeasuredToPredictedRatio) {
+  DlComplexityCalibrator calibrator("gl");
+  // 200000 score units per millisecond: 10 iterations of a list scored at
+  // 100000 that take 10ms in total are twice as slow as predicted.
+  calibrator.AddSample(Category::kRect, 100000u, 10u, 10.0);
+  // A second sample three times as slow as predicted, with the same weight.
+  calibrator.AddSample(Category::kRect, 100000u, 10u, 15.0);
+  // Empty samples are ignored.
+  calibrator.AddSample(Category::kOval, 0u, 10u, 10.0);
+  calibrator.AddSample(Category::kOval, 100000u, 0u, 10.0);
+
+  DlComplexityCalibration calibration = calibrator.GetCalibration();
+  EXPECT_EQ(calibration.GetBackend(), "gl");
+  EXPECT_EQ(calibration.GetScale(Category::kRect), 2.5f);
+  EXPECT_EQ(calibration.GetScale(Category::kOval), 1.0f);
+}
+
+TEST(DisplayListComplexityCalibration, CalibrationAppliesToCalculator) {
+  DisplayListBuilder builder;
+  builder.DrawRect(DlRect::MakeLTRB(10, 10, 80, 80), DlPaint());
+  auto display_list = builder.Build();
+
+  auto calculator = DisplayListImpellerComplexityCalculator::GetInstance();
+  unsigned int baseline = calculator->Compute(display_list.get());
+  ASSERT_GT(baseline, 0u);
+  EXPECT_FALSE(calculator->ShouldBeCached(baseline));
+
+  DlComplexityCalibration calibration;
+  calibration.SetBackend("impeller");
+  calibration.SetScale(Category::kRect, 4.0f);
+  calibration.SetCacheThreshold(baseline);
+  ASSERT_TRUE(DisplayListComplexityCalculator::ApplyCalibration(calibration));
+
+  unsigned int calibrated = calculator->Compute(display_list.get());
+  EXPECT_EQ(calibrated, baseline * 4);
+  EXPECT_TRUE(calculator->ShouldBeCached(calibrated));
+  // The profile only targets the Impeller calculator.
+  EXPECT_EQ(
+      DisplayListGLComplexityCalculator::GetInstance()->Compute(
+          display_list.get()),
+      baseline);
+
+  calculator->SetCalibration(DlComplexityCalibration());
+  EXPECT_EQ(calculator->Compute(display_list.get()), baseline);
+}
+
+TEST(DisplayListComplexityCalibration, ApplyCalibrationRejectsUnknownBackend) {
+  DlComplexityCalibration calibration;
+  calibration.SetBackend("vulkan-skia");
+  EXPECT_FALSE(DisplayListComplexityCalculator::ApplyCalibration(calibration));
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -45,7 +45,10 @@ unsigned int DisplayListGLComplexityCalculator::GLHelper::BatchedComplexity() {
     draw_text_blob_complexity = (draw_text_count_ + 60) * 2500 / 3;
   }
 
-  return save_layer_complexity + draw_text_blob_complexity;
+  return Calibration().Apply(DlComplexityCalibration::Category::kSaveLayer,
+                             save_layer_complexity) +
+         Calibration().Apply(DlComplexityCalibration::Category::kText,
+                             draw_text_blob_complexity);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::saveLayer(
@@ -98,7 +101,7 @@ void DisplayListGLComplexityCalculator::GLHelper::drawLine(const DlPoint& p0,
   unsigned int complexity =
       ((distance + 520) / 2) * non_hairline_penalty * aa_penalty;
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity, DlComplexityCalibration::Category::kLine);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawDashedLine(
@@ -157,7 +160,7 @@ void DisplayListGLComplexityCalculator::GLHelper::drawRect(const DlRect& rect) {
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity, DlComplexityCalibration::Category::kRect);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawOval(
@@ -196,7 +199,7 @@ void DisplayListGLComplexityCalculator::GLHelper::drawOval(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity, DlComplexityCalibration::Category::kOval);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawCircle(
@@ -234,7 +237,7 @@ void DisplayListGLComplexityCalculator::GLHelper::drawCircle(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity, DlComplexityCalibration::Category::kCircle);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawRoundRect(
@@ -280,7 +283,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawRoundRect(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DlComplexityCalibration::Category::kRoundRect);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawDiffRoundRect(
@@ -332,7 +336,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawDiffRoundRect(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DlComplexityCalibration::Category::kDiffRoundRect);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawRoundSuperellipse(
@@ -377,7 +382,7 @@ void DisplayListGLComplexityCalculator::GLHelper::drawPath(const DlPath& path) {
   complexity += CalculatePathComplexity(path, line_verb_cost, quad_verb_cost,
                                         conic_verb_cost, cubic_verb_cost);
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity, DlComplexityCalibration::Category::kPath);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawArc(
@@ -430,7 +435,7 @@ void DisplayListGLComplexityCalculator::GLHelper::drawArc(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity, DlComplexityCalibration::Category::kArc);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawPoints(
@@ -500,7 +505,7 @@ void DisplayListGLComplexityCalculator::GLHelper::drawPoints(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity, DlComplexityCalibration::Category::kPoints);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawVertices(
@@ -519,7 +524,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawVertices(
   // c = 1
   unsigned int complexity = (vertices->vertex_count() + 1600) * 250 / 2;
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DlComplexityCalibration::Category::kVertices);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawImage(
@@ -563,7 +569,7 @@ void DisplayListGLComplexityCalculator::GLHelper::drawImage(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity, DlComplexityCalibration::Category::kImage);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::ImageRect(
@@ -599,7 +605,8 @@ void DisplayListGLComplexityCalculator::GLHelper::ImageRect(
     complexity = length * 200 / 11;
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DlComplexityCalibration::Category::kImageRect);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawImageNine(
@@ -624,7 +631,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawImageNine(
     complexity *= 1.4f;
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DlComplexityCalibration::Category::kImageNine);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawDisplayList(
@@ -633,7 +641,7 @@ void DisplayListGLComplexityCalculator::GLHelper::drawDisplayList(
   if (IsComplex()) {
     return;
   }
-  GLHelper helper(Ceiling() - CurrentComplexityScore());
+  GLHelper helper(Ceiling() - CurrentComplexityScore(), Calibration());
   if (opacity < SK_Scalar1 && !display_list->can_apply_group_opacity()) {
     auto bounds = display_list->GetBounds();
     helper.saveLayer(bounds, SaveLayerOptions::kWithAttributes, nullptr,
@@ -695,7 +703,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawShadow(
   unsigned int complexity = CalculatePathComplexity(
       path, line_verb_cost, quad_verb_cost, conic_verb_cost, cubic_verb_cost);
 
-  AccumulateComplexity(complexity * occluder_penalty);
+  AccumulateComplexity(complexity * occluder_penalty,
+                       DlComplexityCalibration::Category::kShadow);
 }
 
 }  // namespace flutter
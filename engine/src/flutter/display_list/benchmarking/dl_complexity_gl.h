@@ -15,25 +15,35 @@ class DisplayListGLComplexityCalculator
   static DisplayListGLComplexityCalculator* GetInstance();
 
   unsigned int Compute(const DisplayList* display_list) override {
-    GLHelper helper(ceiling_);
+    GLHelper helper(ceiling_, calibration_);
     display_list->Dispatch(helper);
     return helper.ComplexityScore();
   }
 
   bool ShouldBeCached(unsigned int complexity_score) override {
-    // Set cache threshold at 1ms
-    return complexity_score > 200000u;
+    // Set cache threshold at 1ms unless the calibration profile says
+    // otherwise
+    return complexity_score >
+           calibration_.GetCacheThreshold().value_or(200000u);
   }
 
   void SetComplexityCeiling(unsigned int ceiling) override {
     ceiling_ = ceiling;
   }
 
+  void SetCalibration(const DlComplexityCalibration& calibration) override {
+    calibration_ = calibration;
+  }
+
+ protected:
+  DisplayListGLComplexityCalculator()
+      : ceiling_(std::numeric_limits<unsigned int>::max()) {}
+
  private:
   class GLHelper : public ComplexityCalculatorHelper {
    public:
-    explicit GLHelper(unsigned int ceiling)
-        : ComplexityCalculatorHelper(ceiling) {}
+    GLHelper(unsigned int ceiling, const DlComplexityCalibration& calibration)
+        : ComplexityCalculatorHelper(ceiling, calibration) {}
 
     void saveLayer(const DlRect& bounds,
                    const SaveLayerOptions options,
@@ -95,11 +105,10 @@ class DisplayListGLComplexityCalculator
     unsigned int draw_text_count_ = 0;
   };
 
-  DisplayListGLComplexityCalculator()
-      : ceiling_(std::numeric_limits<unsigned int>::max()) {}
   static DisplayListGLComplexityCalculator* instance_;
 
   unsigned int ceiling_;
+  DlComplexityCalibration calibration_;
 };
 
 }  // namespace flutter
@@ -6,6 +6,7 @@
 #define FLUTTER_DISPLAY_LIST_BENCHMARKING_DL_COMPLEXITY_HELPER_H_
 
 #include "flutter/display_list/benchmarking/dl_complexity.h"
+#include "flutter/display_list/benchmarking/dl_complexity_calibration.h"
 #include "flutter/display_list/dl_blend_mode.h"
 #include "flutter/display_list/dl_op_receiver.h"
 #include "flutter/display_list/geometry/dl_path.h"
@@ -91,14 +92,19 @@ namespace flutter {
 //   y = x / 5 * 200,000 / 10,000
 //   y = x / 5 * 20
 //   y = 4x
+//
+// Each accumulated cost is tagged with the category of the op that incurred
+// it so that a |DlComplexityCalibration| profile measured on the current
+// device can correct the reference device figures in here.
 
 class ComplexityCalculatorHelper
     : public virtual DlOpReceiver,
       public virtual IgnoreClipDispatchHelper,
       public virtual IgnoreTransformDispatchHelper {
  public:
-  explicit ComplexityCalculatorHelper(unsigned int ceiling)
-      : ceiling_(ceiling) {}
+  ComplexityCalculatorHelper(unsigned int ceiling,
+                             const DlComplexityCalibration& calibration)
+      : calibration_(calibration), ceiling_(ceiling) {}
 
   virtual ~ComplexityCalculatorHelper() = default;
 
@@ -132,7 +138,7 @@ class ComplexityCalculatorHelper
       return;
     }
     // Placeholder value here. This is a relatively cheap operation.
-    AccumulateComplexity(50);
+    AccumulateComplexity(50, DlComplexityCalibration::Category::kPaint);
   }
 
   void drawPaint() override {
@@ -141,7 +147,7 @@ class ComplexityCalculatorHelper
     }
     // Placeholder value here. This can be cheap (e.g. effectively a drawColor),
     // or expensive (e.g. a bitmap shader with an image filter)
-    AccumulateComplexity(50);
+    AccumulateComplexity(50, DlComplexityCalibration::Category::kPaint);
   }
 
   void drawImageRect(
@@ -209,12 +215,18 @@ class ComplexityCalculatorHelper
     complexity_score_ += complexity;
   }
 
+  void AccumulateComplexity(unsigned int complexity,
+                            DlComplexityCalibration::Category category) {
+    AccumulateComplexity(calibration_.Apply(category, complexity));
+  }
+
   inline bool IsAntiAliased() { return current_paint_.isAntiAlias(); }
   inline bool IsHairline() { return current_paint_.getStrokeWidth() == 0.0f; }
   inline DlDrawStyle DrawStyle() { return current_paint_.getDrawStyle(); }
   inline bool IsComplex() { return is_complex_; }
   inline unsigned int Ceiling() { return ceiling_; }
   inline unsigned int CurrentComplexityScore() { return complexity_score_; }
+  inline const DlComplexityCalibration& Calibration() { return calibration_; }
 
   unsigned int CalculatePathComplexity(const DlPath& dl_path,
                                        unsigned int line_verb_cost,
@@ -234,6 +246,7 @@ class ComplexityCalculatorHelper
 
  private:
   DlPaint current_paint_;
+  const DlComplexityCalibration& calibration_;
 
   // If we exceed the ceiling (defaults to the largest number representable
   // by unsigned int), then set the is_complex_ bool and we no longer
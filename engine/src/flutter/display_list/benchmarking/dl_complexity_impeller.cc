@@ -0,0 +1,20 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/benchmarking/dl_complexity_impeller.h"
+
+namespace flutter {
+
+DisplayListImpellerComplexityCalculator*
+    DisplayListImpellerComplexityCalculator::instance_ = nullptr;
+
+DisplayListImpellerComplexityCalculator*
+DisplayListImpellerComplexityCalculator::GetInstance() {
+  if (instance_ == nullptr) {
+    instance_ = new DisplayListImpellerComplexityCalculator();
+  }
+  return instance_;
+}
+
+}  // namespace flutter
@@ -0,0 +1,33 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_BENCHMARKING_DL_COMPLEXITY_IMPELLER_H_
+#define FLUTTER_DISPLAY_LIST_BENCHMARKING_DL_COMPLEXITY_IMPELLER_H_
+
+#include "flutter/display_list/benchmarking/dl_complexity_gl.h"
+
+namespace flutter {
+
+// Scores DisplayLists rendered by Impeller on its Vulkan and OpenGL ES
+// backends.
+//
+// There is no reference device data for Impeller in this suite yet, so the
+// per-op model is the one fitted for OpenGL, which is the closest match for
+// the mobile GPUs these backends target. The calculator keeps its own
+// instance, and so its own ceiling and calibration, so that a profile
+// measured for Impeller on the device ("backend impeller") corrects these
+// scores without disturbing the Skia OpenGL calculator.
+class DisplayListImpellerComplexityCalculator
+    : public DisplayListGLComplexityCalculator {
+ public:
+  static DisplayListImpellerComplexityCalculator* GetInstance();
+
+ private:
+  DisplayListImpellerComplexityCalculator() = default;
+  static DisplayListImpellerComplexityCalculator* instance_;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_BENCHMARKING_DL_COMPLEXITY_IMPELLER_H_
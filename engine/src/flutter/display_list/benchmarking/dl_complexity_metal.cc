@@ -59,7 +59,10 @@ DisplayListMetalComplexityCalculator::MetalHelper::BatchedComplexity() {
     draw_text_blob_complexity = (draw_text_count_ + 180) * 2500 / 3;
   }
 
-  return save_layer_complexity + draw_text_blob_complexity;
+  return Calibration().Apply(DlComplexityCalibration::Category::kSaveLayer,
+                             save_layer_complexity) +
+         Calibration().Apply(DlComplexityCalibration::Category::kText,
+                             draw_text_blob_complexity);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::saveLayer(
@@ -109,7 +112,7 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawLine(
   unsigned int complexity =
       ((distance + 225) * 4 / 9) * non_hairline_penalty * aa_penalty;
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity, DlComplexityCalibration::Category::kLine);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawDashedLine(
@@ -162,7 +165,7 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawRect(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity, DlComplexityCalibration::Category::kRect);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawOval(
@@ -201,7 +204,7 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawOval(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity, DlComplexityCalibration::Category::kOval);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawCircle(
@@ -239,7 +242,7 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawCircle(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity, DlComplexityCalibration::Category::kCircle);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawRoundRect(
@@ -274,7 +277,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawRoundRect(
     complexity = (area + 50000) / 625;
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DlComplexityCalibration::Category::kRoundRect);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawDiffRoundRect(
@@ -326,7 +330,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawDiffRoundRect(
     complexity = ((10 * length) + 1050) / 6;
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DlComplexityCalibration::Category::kDiffRoundRect);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawRoundSuperellipse(
@@ -365,7 +370,7 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawPath(
       200000 + CalculatePathComplexity(path, line_verb_cost, quad_verb_cost,
                                        conic_verb_cost, cubic_verb_cost);
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity, DlComplexityCalibration::Category::kPath);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawArc(
@@ -414,7 +419,7 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawArc(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity, DlComplexityCalibration::Category::kArc);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawPoints(
@@ -450,7 +455,7 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawPoints(
       }
     }
   }
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity, DlComplexityCalibration::Category::kPoints);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawVertices(
@@ -469,7 +474,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawVertices(
   // c = 1
   unsigned int complexity = (vertices->vertex_count() + 4000) * 50;
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DlComplexityCalibration::Category::kVertices);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawImage(
@@ -504,7 +510,7 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawImage(
     complexity = complexity * multiplier + 1200;
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity, DlComplexityCalibration::Category::kImage);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::ImageRect(
@@ -546,7 +552,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::ImageRect(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DlComplexityCalibration::Category::kImageRect);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawImageNine(
@@ -566,7 +573,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawImageNine(
   // m = 1/8000
   // c = 3
   unsigned int complexity = (area + 24000) / 20;
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DlComplexityCalibration::Category::kImageNine);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawDisplayList(
@@ -575,7 +583,7 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawDisplayList(
   if (IsComplex()) {
     return;
   }
-  MetalHelper helper(Ceiling() - CurrentComplexityScore());
+  MetalHelper helper(Ceiling() - CurrentComplexityScore(), Calibration());
   if (opacity < SK_Scalar1 && !display_list->can_apply_group_opacity()) {
     auto bounds = display_list->GetBounds();
     helper.saveLayer(bounds, SaveLayerOptions::kWithAttributes, nullptr,
@@ -638,7 +646,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawShadow(
       0 + CalculatePathComplexity(path, line_verb_cost, quad_verb_cost,
                                   conic_verb_cost, cubic_verb_cost);
 
-  AccumulateComplexity(complexity * occluder_penalty);
+  AccumulateComplexity(complexity * occluder_penalty,
+                       DlComplexityCalibration::Category::kShadow);
 }
 
 }  // namespace flutter
@@ -15,25 +15,32 @@ class DisplayListMetalComplexityCalculator
   static DisplayListMetalComplexityCalculator* GetInstance();
 
   unsigned int Compute(const DisplayList* display_list) override {
-    MetalHelper helper(ceiling_);
+    MetalHelper helper(ceiling_, calibration_);
     display_list->Dispatch(helper);
     return helper.ComplexityScore();
   }
 
   bool ShouldBeCached(unsigned int complexity_score) override {
-    // Set cache threshold at 1ms
-    return complexity_score > 200000u;
+    // Set cache threshold at 1ms unless the calibration profile says
+    // otherwise
+    return complexity_score >
+           calibration_.GetCacheThreshold().value_or(200000u);
   }
 
   void SetComplexityCeiling(unsigned int ceiling) override {
     ceiling_ = ceiling;
   }
 
+  void SetCalibration(const DlComplexityCalibration& calibration) override {
+    calibration_ = calibration;
+  }
+
  private:
   class MetalHelper : public ComplexityCalculatorHelper {
    public:
-    explicit MetalHelper(unsigned int ceiling)
-        : ComplexityCalculatorHelper(ceiling) {}
+    MetalHelper(unsigned int ceiling,
+                const DlComplexityCalibration& calibration)
+        : ComplexityCalculatorHelper(ceiling, calibration) {}
 
     void saveLayer(const DlRect& bounds,
                    const SaveLayerOptions options,
@@ -100,6 +107,7 @@ class DisplayListMetalComplexityCalculator
   static DisplayListMetalComplexityCalculator* instance_;
 
   unsigned int ceiling_;
+  DlComplexityCalibration calibration_;
 };
 
 }  // namespace flutter
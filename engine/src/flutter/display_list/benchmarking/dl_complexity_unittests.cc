@@ -4,6 +4,7 @@
 
 #include "flutter/display_list/benchmarking/dl_complexity.h"
 #include "flutter/display_list/benchmarking/dl_complexity_gl.h"
+#include "flutter/display_list/benchmarking/dl_complexity_impeller.h"
 #include "flutter/display_list/benchmarking/dl_complexity_metal.h"
 #include "flutter/display_list/display_list.h"
 #include "flutter/display_list/dl_builder.h"
@@ -21,12 +22,14 @@ namespace {
 std::vector<DisplayListComplexityCalculator*> Calculators() {
   return {DisplayListMetalComplexityCalculator::GetInstance(),
           DisplayListGLComplexityCalculator::GetInstance(),
+          DisplayListImpellerComplexityCalculator::GetInstance(),
           DisplayListNaiveComplexityCalculator::GetInstance()};
 }
 
 std::vector<DisplayListComplexityCalculator*> AccumulatorCalculators() {
   return {DisplayListMetalComplexityCalculator::GetInstance(),
-          DisplayListGLComplexityCalculator::GetInstance()};
+          DisplayListGLComplexityCalculator::GetInstance(),
+          DisplayListImpellerComplexityCalculator::GetInstance()};
 }
 
 std::vector<DlPoint> GetTestPoints() {
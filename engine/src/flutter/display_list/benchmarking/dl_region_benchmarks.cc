@@ -261,6 +261,49 @@ void RunIntersectsSingleRectBenchmark(benchmark::State& state, int maxSize) {
   }
 }
 
+std::vector<DlIRect> GenerateGrid(int32_t tile_size,
+                                  int32_t gap,
+                                  int32_t offset_y) {
+  std::vector<DlIRect> rects;
+  for (int32_t y = 0; y + tile_size <= 4000; y += tile_size + gap) {
+    for (int32_t x = 0; x + tile_size <= 4000; x += tile_size + gap) {
+      rects.push_back(DlIRect::MakeXYWH(x, y + offset_y, tile_size, tile_size));
+    }
+  }
+  return rects;
+}
+
+// Unions a dense grid of tiles with the same grid scrolled by half a tile,
+// which is what partial repaint computes for a scrolled grid of items.
+template <typename Region>
+void RunScrolledGridUnionBenchmark(benchmark::State& state, int tileSize) {
+  Region region1(GenerateGrid(tileSize, 2, 0));
+  Region region2(GenerateGrid(tileSize, 2, tileSize / 2));
+
+  while (state.KeepRunning()) {
+    Region::unionRegions(region1, region2);
+  }
+}
+
+// Accumulates the tiles of a dense grid into a region one tile at a time,
+// in the same way damage is accumulated across layers.
+template <typename Region>
+void RunAccumulateGridBenchmark(benchmark::State& state, int tileSize) {
+  std::vector<DlIRect> tiles = GenerateGrid(tileSize, 2, 0);
+  std::vector<Region> tile_regions;
+  tile_regions.reserve(tiles.size());
+  for (const DlIRect& tile : tiles) {
+    tile_regions.emplace_back(std::vector<DlIRect>{tile});
+  }
+
+  while (state.KeepRunning()) {
+    Region accumulator(std::vector<DlIRect>{});
+    for (const Region& tile : tile_regions) {
+      accumulator = Region::unionRegions(accumulator, tile);
+    }
+  }
+}
+
 }  // namespace
 
 namespace flutter {
@@ -321,8 +364,50 @@ static void BM_SkRegion_IntersectsSingleRect(benchmark::State& state,
   RunIntersectsSingleRectBenchmark<SkRegionAdapter>(state, maxSize);
 }
 
+static void BM_DlRegion_ScrolledGridUnion(benchmark::State& state,
+                                          int tileSize) {
+  RunScrolledGridUnionBenchmark<DlRegionAdapter>(state, tileSize);
+}
+
+static void BM_SkRegion_ScrolledGridUnion(benchmark::State& state,
+                                          int tileSize) {
+  RunScrolledGridUnionBenchmark<SkRegionAdapter>(state, tileSize);
+}
+
+static void BM_DlRegion_AccumulateGrid(benchmark::State& state,
+                                       int tileSize) {
+  RunAccumulateGridBenchmark<DlRegionAdapter>(state, tileSize);
+}
+
+static void BM_SkRegion_AccumulateGrid(benchmark::State& state,
+                                       int tileSize) {
+  RunAccumulateGridBenchmark<SkRegionAdapter>(state, tileSize);
+}
+
 const double kSizeFactorSmall = 0.3;
 
+BENCHMARK_CAPTURE(BM_DlRegion_ScrolledGridUnion, Small, 40)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SkRegion_ScrolledGridUnion, Small, 40)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DlRegion_ScrolledGridUnion, Medium, 100)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SkRegion_ScrolledGridUnion, Medium, 100)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DlRegion_ScrolledGridUnion, Large, 400)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SkRegion_ScrolledGridUnion, Large, 400)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_DlRegion_AccumulateGrid, Medium, 100)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SkRegion_AccumulateGrid, Medium, 100)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DlRegion_AccumulateGrid, Large, 400)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SkRegion_AccumulateGrid, Large, 400)
+    ->Unit(benchmark::kMicrosecond);
+
 BENCHMARK_CAPTURE(BM_DlRegion_IntersectsSingleRect, Tiny, 30)
     ->Unit(benchmark::kNanosecond);
 BENCHMARK_CAPTURE(BM_SkRegion_IntersectsSingleRect, Tiny, 30)
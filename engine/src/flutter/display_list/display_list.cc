@@ -2,11 +2,13 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <string_view>
 #include <type_traits>
 
 #include "flutter/display_list/display_list.h"
 #include "flutter/display_list/dl_op_records.h"
 #include "flutter/display_list/geometry/dl_path.h"
+#include "flutter/fml/hash_combine.h"
 #include "flutter/fml/trace_event.h"
 
 namespace flutter {
@@ -360,6 +362,18 @@ DisplayListOpType DisplayList::GetOpType(DlIndex index) const {
   return op->type;
 }
 
+sk_sp<DisplayList> DisplayList::GetSoleNestedDisplayList(
+    DlScalar* opacity) const {
+  if (offsets_.size() != 1u ||
+      GetOpType(0u) != DisplayListOpType::kDrawDisplayList) {
+    return nullptr;
+  }
+  auto op = reinterpret_cast<const DrawDisplayListOp*>(storage_.base() +
+                                                       offsets_[0u]);
+  *opacity = op->opacity;
+  return op->display_list;
+}
+
 static void FillAllIndices(std::vector<DlIndex>& indices, DlIndex size) {
   indices.reserve(size);
   for (DlIndex i = 0u; i < size; i++) {
@@ -463,6 +477,77 @@ static bool CompareOps(const DisplayListStorage& storageA,
   return true;
 }
 
+// Ops that do not override |DLOp::equals| are compared by the bulk memcmp
+// in |CompareOps| and so their bytes can contribute to the content hash.
+template <typename T>
+static constexpr bool IsBulkCompared() {
+  return std::is_same_v<decltype(&T::equals),
+                        DisplayListCompare (DLOp::*)(const DLOp*) const>;
+}
+
+static size_t HashBytes(const uint8_t* bytes, size_t length) {
+  return std::hash<std::string_view>{}(
+      std::string_view(reinterpret_cast<const char*>(bytes), length));
+}
+
+size_t DisplayList::content_hash() const {
+  size_t hash = content_hash_.load(std::memory_order_relaxed);
+  if (hash == 0u) {
+    // Racing threads compute the same value, so a relaxed store suffices.
+    hash = ComputeContentHash();
+    content_hash_.store(hash, std::memory_order_relaxed);
+  }
+  return hash;
+}
+
+size_t DisplayList::ComputeContentHash() const {
+  // Mirrors |CompareOps| which determines the byte ranges that |Equals|
+  // compares in bulk.
+  const uint8_t* base = storage_.base();
+  size_t hash = fml::HashCombine(op_count_, offsets_.size(), storage_.size());
+  size_t bulk_start = 0u;
+  for (size_t i = 0; i < offsets_.size(); i++) {
+    size_t offset = offsets_[i];
+    auto op = reinterpret_cast<const DLOp*>(base + offset);
+    bool bulk_compared;
+    switch (op->type) {
+#define DL_OP_IS_BULK_COMPARED(name)            \
+  case DisplayListOpType::k##name:              \
+    bulk_compared = IsBulkCompared<name##Op>(); \
+    break;
+
+      FOR_EACH_DISPLAY_LIST_OP(DL_OP_IS_BULK_COMPARED)
+
+#undef DL_OP_IS_BULK_COMPARED
+
+      default:
+        FML_DCHECK(false);
+        bulk_compared = false;
+        break;
+    }
+    if (bulk_compared) {
+      continue;
+    }
+    if (bulk_start < offset) {
+      fml::HashCombineSeed(hash, HashBytes(base + bulk_start,
+                                           offset - bulk_start));
+    }
+    fml::HashCombineSeed(hash, static_cast<uint32_t>(op->type));
+    if (op->type == DisplayListOpType::kDrawDisplayList) {
+      auto dl_op = static_cast<const DrawDisplayListOp*>(op);
+      fml::HashCombineSeed(hash, dl_op->opacity,
+                           dl_op->display_list->content_hash());
+    }
+    bulk_start = i + 1 < offsets_.size() ? offsets_[i + 1] : storage_.size();
+  }
+  if (bulk_start < storage_.size()) {
+    fml::HashCombineSeed(hash, HashBytes(base + bulk_start,
+                                         storage_.size() - bulk_start));
+  }
+  // 0 is reserved to mark the hash as not yet computed.
+  return hash == 0u ? 1u : hash;
+}
+
 bool DisplayList::Equals(const DisplayList* other) const {
   if (this == other) {
     return true;
@@ -5,6 +5,8 @@
 #ifndef FLUTTER_DISPLAY_LIST_DISPLAY_LIST_H_
 #define FLUTTER_DISPLAY_LIST_DISPLAY_LIST_H_
 
+#include <atomic>
+
 #include "flutter/display_list/dl_blend_mode.h"
 #include "flutter/display_list/dl_storage.h"
 #include "flutter/display_list/geometry/dl_geometry_types.h"
@@ -300,6 +302,18 @@ class DisplayList : public SkRefCnt {
     return Equals(other.get());
   }
 
+  /// @brief    A hash of the recorded operations that is consistent with
+  ///           |Equals|, i.e. any two DisplayLists that are |Equals| will
+  ///           also have the same content hash.
+  ///
+  /// Ops that are compared by reference or by a deep comparison of their
+  /// attached objects only contribute their type to the hash, so lists
+  /// with the same hash must still be compared with |Equals| before they
+  /// are treated as interchangeable.
+  ///
+  /// The hash is computed the first time it is requested and then cached.
+  size_t content_hash() const;
+
   bool can_apply_group_opacity() const { return can_apply_group_opacity_; }
   bool isUIThreadSafe() const { return is_ui_thread_safe_; }
 
@@ -500,6 +514,14 @@ class DisplayList : public SkRefCnt {
   /// @see |Dispatch(receiver, index)|
   std::vector<DlIndex> GetCulledIndices(const DlRect& cull_rect) const;
 
+  /// @brief   If the only record in this DisplayList draws another
+  ///          DisplayList, return that DisplayList and store the opacity
+  ///          it is drawn with in |opacity|. Otherwise return nullptr.
+  ///
+  /// Such a DisplayList adds a level of nesting, and the save and restore
+  /// work that goes with it at dispatch time, without adding any content.
+  sk_sp<DisplayList> GetSoleNestedDisplayList(DlScalar* opacity) const;
+
  private:
   DisplayList(DisplayListStorage&& ptr,
               std::vector<size_t>&& offsets,
@@ -542,12 +564,18 @@ class DisplayList : public SkRefCnt {
 
   const sk_sp<const DlRTree> rtree_;
 
+  // Lazily computed by |content_hash|, 0 until then.
+  mutable std::atomic<size_t> content_hash_ = 0u;
+
+  size_t ComputeContentHash() const;
+
   void DispatchOneOp(DlOpReceiver& receiver, const uint8_t* ptr) const;
 
   void RTreeResultsToIndexVector(std::vector<DlIndex>& indices,
                                  const std::vector<int>& rtree_results) const;
 
   friend class DisplayListBuilder;
+  friend class DisplayListSerializer;
 };
 
 }  // namespace flutter
@@ -342,6 +342,86 @@ TEST_F(DisplayListTest, BuilderCanBeReused) {
   ASSERT_TRUE(dl->Equals(dl2));
 }
 
+TEST_F(DisplayListTest, BuilderResetDiscardsRecording) {
+  DisplayListBuilder builder(kTestBounds);
+  builder.DrawRect(kTestBounds, DlPaint());
+  auto expected = builder.Build();
+
+  builder.Save();
+  builder.Translate(10.0f, 10.0f);
+  builder.ClipRect(DlRect::MakeLTRB(0, 0, 20, 20));
+  builder.DrawOval(kTestBounds, DlPaint(DlColor::kRed()));
+  builder.Reset();
+  check_defaults(builder, kTestBounds);
+
+  builder.DrawRect(kTestBounds, DlPaint());
+  auto dl = builder.Build();
+  EXPECT_TRUE(dl->Equals(expected));
+  EXPECT_EQ(dl->GetRecordCount(), expected->GetRecordCount());
+}
+
+TEST_F(DisplayListTest, EqualDisplayListsHaveEqualContentHash) {
+  auto record = [](DlColor color, const sk_sp<DisplayList>& nested) {
+    DisplayListBuilder builder(kTestBounds);
+    builder.DrawRect(kTestBounds, DlPaint(color));
+    builder.DrawPath(DlPath::MakeOval(kTestBounds), DlPaint());
+    if (nested) {
+      builder.DrawDisplayList(nested, 0.5f);
+    }
+    return builder.Build();
+  };
+
+  auto dl1 = record(DlColor::kBlue(), nullptr);
+  auto dl2 = record(DlColor::kBlue(), nullptr);
+  auto dl3 = record(DlColor::kRed(), nullptr);
+  ASSERT_TRUE(dl1->Equals(dl2));
+  ASSERT_FALSE(dl1->Equals(dl3));
+  EXPECT_EQ(dl1->content_hash(), dl2->content_hash());
+  EXPECT_NE(dl1->content_hash(), dl3->content_hash());
+
+  auto nested1 = record(DlColor::kGreen(), dl1);
+  auto nested2 = record(DlColor::kGreen(), dl2);
+  auto nested3 = record(DlColor::kGreen(), dl3);
+  ASSERT_TRUE(nested1->Equals(nested2));
+  EXPECT_EQ(nested1->content_hash(), nested2->content_hash());
+  EXPECT_NE(nested1->content_hash(), nested3->content_hash());
+}
+
+TEST_F(DisplayListTest, BuilderSharesEqualNestedDisplayLists) {
+  auto make_icon = []() {
+    DisplayListBuilder builder;
+    builder.DrawRect(DlRect::MakeLTRB(0, 0, 10, 10), DlPaint());
+    return builder.Build();
+  };
+  auto icon1 = make_icon();
+  auto icon2 = make_icon();
+  ASSERT_NE(icon1.get(), icon2.get());
+
+  DisplayListBuilder builder;
+  builder.DrawDisplayList(icon1);
+  builder.Translate(20, 0);
+  builder.DrawDisplayList(icon2);
+  auto display_list = builder.Build();
+
+  class NestedListCollector : public virtual DlOpReceiver,
+                              public IgnoreAttributeDispatchHelper,
+                              public IgnoreClipDispatchHelper,
+                              public IgnoreTransformDispatchHelper,
+                              public IgnoreDrawDispatchHelper {
+   public:
+    void drawDisplayList(const sk_sp<DisplayList> display_list,
+                         DlScalar opacity) override {
+      lists.push_back(display_list.get());
+    }
+    std::vector<const DisplayList*> lists;
+  };
+  NestedListCollector collector;
+  display_list->Dispatch(collector);
+  ASSERT_EQ(collector.lists.size(), 2u);
+  EXPECT_EQ(collector.lists[0], icon1.get());
+  EXPECT_EQ(collector.lists[1], icon1.get());
+}
+
 TEST_F(DisplayListTest, SaveRestoreRestoresTransform) {
   DlRect cull_rect = DlRect::MakeLTRB(-10.0f, -10.0f, 500.0f, 500.0f);
   DisplayListBuilder builder(cull_rect);
@@ -1273,6 +1353,59 @@ TEST_F(DisplayListTest, CrossOfNonOverlappingOpsSupportGroupOpacity) {
   EXPECT_TRUE(display_list->can_apply_group_opacity());
 }
 
+TEST_F(DisplayListTest, GridOfNonOverlappingOpsSupportGroupOpacity) {
+  DisplayListBuilder builder;
+  for (int row = 0; row < 4; row++) {
+    for (int column = 0; column < 4; column++) {
+      builder.DrawRect(DlRect::MakeXYWH(column * 30, row * 30, 25, 25),
+                       DlPaint());
+    }
+  }
+  auto display_list = builder.Build();
+  EXPECT_TRUE(display_list->can_apply_group_opacity());
+}
+
+TEST_F(DisplayListTest, GridWithOverlappingOpDoesNotSupportGroupOpacity) {
+  DisplayListBuilder builder;
+  for (int row = 0; row < 4; row++) {
+    for (int column = 0; column < 4; column++) {
+      builder.DrawRect(DlRect::MakeXYWH(column * 30, row * 30, 25, 25),
+                       DlPaint());
+    }
+  }
+  builder.DrawRect(DlRect::MakeXYWH(20, 20, 25, 25), DlPaint());
+  auto display_list = builder.Build();
+  EXPECT_FALSE(display_list->can_apply_group_opacity());
+}
+
+TEST_F(DisplayListTest, TooManyOpsFallBackToBoundsOverlap) {
+  // A row of ops with a last op that fills the gap between the first two.
+  // The last op intersects the bounds of the row, but none of its ops.
+  auto draw_row = [](DisplayListBuilder& builder, int count) {
+    for (int i = 0; i < count; i++) {
+      builder.DrawRect(DlRect::MakeXYWH(i * 30, 0, 25, 25), DlPaint());
+    }
+    builder.DrawRect(DlRect::MakeXYWH(25, 0, 5, 25), DlPaint());
+  };
+  int max_ops = DisplayListBuilder::kMaxGroupOpacityDisjointOps;
+
+  DisplayListBuilder builder;
+  draw_row(builder, max_ops - 1);
+  EXPECT_TRUE(builder.Build()->can_apply_group_opacity());
+
+  draw_row(builder, max_ops + 1);
+  EXPECT_FALSE(builder.Build()->can_apply_group_opacity());
+}
+
+TEST_F(DisplayListTest, SingleGlyphTextSupportsGroupOpacity) {
+  DisplayListBuilder builder;
+  builder.DrawText(DlTextSkia::Make(GetTestTextBlob("A")), 10, 10, DlPaint());
+  EXPECT_TRUE(builder.Build()->can_apply_group_opacity());
+
+  builder.DrawText(DlTextSkia::Make(GetTestTextBlob("AB")), 10, 10, DlPaint());
+  EXPECT_FALSE(builder.Build()->can_apply_group_opacity());
+}
+
 TEST_F(DisplayListTest, SaveLayerFalseSupportsGroupOpacityOverlappingChidren) {
   DisplayListBuilder builder;
   builder.SaveLayer(std::nullopt, nullptr);
@@ -2519,6 +2652,36 @@ TEST_F(DisplayListTest, NestedDisplayListRTreesAreSparse) {
              std::vector<int>({0, 1}));
 }
 
+TEST_F(DisplayListTest, WrappedDisplayListsAreRecordedDirectly) {
+  DisplayListBuilder content_builder;
+  content_builder.DrawRect(DlRect::MakeLTRB(10, 10, 20, 20), DlPaint());
+  content_builder.DrawRect(DlRect::MakeLTRB(50, 50, 60, 60), DlPaint());
+  auto content = content_builder.Build();
+
+  DisplayListBuilder wrapper_builder;
+  wrapper_builder.DrawDisplayList(content, 0.5f);
+  auto wrapper = wrapper_builder.Build();
+
+  DisplayListBuilder builder;
+  builder.DrawDisplayList(wrapper, 0.5f);
+  auto display_list = builder.Build();
+
+  DlScalar opacity = 0.0f;
+  EXPECT_EQ(display_list->GetSoleNestedDisplayList(&opacity), content);
+  EXPECT_EQ(opacity, 0.25f);
+  EXPECT_EQ(display_list->total_depth(), content->total_depth() + 1u);
+
+  // Content outside of the wrapper's cull rect must stay clipped by it.
+  DisplayListBuilder culled_wrapper_builder(DlRect::MakeLTRB(0, 0, 30, 30));
+  culled_wrapper_builder.DrawDisplayList(content);
+  auto culled_wrapper = culled_wrapper_builder.Build();
+
+  DisplayListBuilder culled_builder;
+  culled_builder.DrawDisplayList(culled_wrapper);
+  EXPECT_EQ(culled_builder.Build()->GetSoleNestedDisplayList(&opacity),
+            culled_wrapper);
+}
+
 TEST_F(DisplayListTest, RemoveUnnecessarySaveRestorePairs) {
   {
     DisplayListBuilder builder;
@@ -3386,6 +3549,70 @@ TEST_F(DisplayListTest, RTreeRenderCulling) {
   }
 }
 
+TEST_F(DisplayListTest, LargeDisplayListGetsAutomaticRTree) {
+  const uint32_t threshold = DisplayListBuilder::kAutoRTreeRenderOpThreshold;
+  auto record = [](DlCanvas& canvas, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+      canvas.DrawRect(DlRect::MakeXYWH(i * 20.0f, 0.0f, 10.0f, 10.0f),
+                      DlPaint());
+    }
+  };
+
+  {
+    DisplayListBuilder builder;
+    record(builder, threshold - 1);
+    EXPECT_FALSE(builder.Build()->has_rtree());
+  }
+
+  DisplayListBuilder builder;
+  record(builder, threshold);
+  auto display_list = builder.Build();
+  ASSERT_TRUE(display_list->has_rtree());
+  EXPECT_EQ(display_list->GetBounds(),
+            DlRect::MakeLTRB(0.0f, 0.0f, (threshold - 1) * 20.0f + 10.0f,
+                             10.0f));
+
+  // The automatic RTree does not carry over to the next recording.
+  builder.DrawRect(DlRect::MakeLTRB(0, 0, 10, 10), DlPaint());
+  EXPECT_FALSE(builder.Build()->has_rtree());
+
+  // Only the rect inside of the cull rect is dispatched.
+  DisplayListBuilder culling_builder;
+  display_list->Dispatch(ToReceiver(culling_builder),
+                         DlRect::MakeLTRB(41, 1, 49, 9));
+  DisplayListBuilder expected_builder;
+  expected_builder.DrawRect(DlRect::MakeXYWH(40.0f, 0.0f, 10.0f, 10.0f),
+                            DlPaint());
+  EXPECT_TRUE(
+      DisplayListsEQ_Verbose(culling_builder.Build(), expected_builder.Build()));
+}
+
+TEST_F(DisplayListTest, AutomaticRTreeCullsInsideSaveRestore) {
+  DisplayListBuilder builder;
+  builder.Save();
+  builder.Translate(5.0f, 5.0f);
+  for (uint32_t i = 0; i < DisplayListBuilder::kAutoRTreeRenderOpThreshold;
+       i++) {
+    builder.DrawRect(DlRect::MakeXYWH(i * 20.0f, 0.0f, 10.0f, 10.0f),
+                     DlPaint());
+  }
+  builder.Restore();
+  auto display_list = builder.Build();
+  ASSERT_TRUE(display_list->has_rtree());
+
+  DisplayListBuilder culling_builder;
+  display_list->Dispatch(ToReceiver(culling_builder),
+                         DlRect::MakeLTRB(46, 6, 54, 14));
+  DisplayListBuilder expected_builder;
+  expected_builder.Save();
+  expected_builder.Translate(5.0f, 5.0f);
+  expected_builder.DrawRect(DlRect::MakeXYWH(40.0f, 0.0f, 10.0f, 10.0f),
+                            DlPaint());
+  expected_builder.Restore();
+  EXPECT_TRUE(
+      DisplayListsEQ_Verbose(culling_builder.Build(), expected_builder.Build()));
+}
+
 TEST_F(DisplayListTest, DrawSaveDrawCannotInheritOpacity) {
   DisplayListBuilder builder;
   builder.DrawCircle(DlPoint(10, 10), 5, DlPaint());
@@ -6000,5 +6227,93 @@ TEST_F(DisplayListTest, SaveLayerWithLinearSkewDoesNotCrash) {
             nullptr);
 }
 
+TEST_F(DisplayListTest, CompactOpStreamDropsOpsThatRenderNothing) {
+  DlRect cull_rect = DlRect::MakeLTRB(0, 0, 100, 100);
+  DlRect rect = DlRect::MakeLTRB(10, 10, 20, 20);
+  DlPaint paint = DlPaint().setColor(DlColor::kBlue());
+
+  DisplayListBuilder builder(cull_rect);
+  builder.SetCompactOpStream(true);
+  builder.Save();
+  builder.Translate(10, 10);
+  builder.Restore();
+  // Culled, but only after its color has been recorded.
+  builder.DrawRect(DlRect::MakeLTRB(200, 200, 300, 300),
+                   DlPaint().setColor(DlColor::kRed()));
+  builder.DrawRect(rect, paint);
+  builder.Translate(5, 5);
+  auto display_list = builder.Build();
+  // The save, both translates, the restore and the red color.
+  EXPECT_EQ(builder.GetCompactedOpCount(), 5u);
+
+  DisplayListBuilder expected_builder(cull_rect);
+  expected_builder.DrawRect(rect, paint);
+  auto expected = expected_builder.Build();
+  EXPECT_EQ(display_list->op_count(), 2u);
+  EXPECT_EQ(display_list->total_depth(), expected->total_depth());
+  EXPECT_TRUE(DisplayListsEQ_Verbose(display_list, expected));
+}
+
+TEST_F(DisplayListTest, CompactOpStreamKeepsOpsThatAffectRendering) {
+  auto record = [](bool compact) {
+    DisplayListBuilder builder;
+    builder.SetCompactOpStream(compact);
+    builder.Save();
+    builder.ClipRect(DlRect::MakeLTRB(0, 0, 50, 50));
+    builder.Translate(10, 10);
+    builder.DrawRect(DlRect::MakeLTRB(0, 0, 10, 10), DlPaint());
+    builder.Restore();
+    builder.SaveLayer(std::nullopt, nullptr);
+    builder.Restore();
+    builder.DrawRect(DlRect::MakeLTRB(20, 20, 30, 30),
+                     DlPaint().setColor(DlColor::kGreen()));
+    auto display_list = builder.Build();
+    EXPECT_EQ(builder.GetCompactedOpCount(), 0u);
+    return display_list;
+  };
+
+  EXPECT_TRUE(DisplayListsEQ_Verbose(record(true), record(false)));
+}
+
+TEST_F(DisplayListTest, CompactOpStreamRemapsRTreeIndices) {
+  DlRect rect1 = DlRect::MakeLTRB(0, 0, 10, 10);
+  DlRect rect2 = DlRect::MakeLTRB(50, 50, 60, 60);
+  DlPaint paint1 = DlPaint().setColor(DlColor::kGreen());
+  DlPaint paint2 = DlPaint().setColor(DlColor::kBlue());
+
+  DisplayListBuilder builder(DlRect::MakeLTRB(0, 0, 100, 100),
+                             /*prepare_rtree=*/true);
+  builder.SetCompactOpStream(true);
+  builder.Save();
+  builder.Translate(50, 50);
+  builder.Restore();
+  builder.DrawRect(DlRect::MakeLTRB(200, 200, 300, 300),
+                   DlPaint().setColor(DlColor::kRed()));
+  builder.DrawRect(rect1, paint1);
+  builder.DrawRect(rect2, paint2);
+  auto display_list = builder.Build();
+  EXPECT_EQ(builder.GetCompactedOpCount(), 4u);
+  ASSERT_TRUE(display_list->has_rtree());
+
+  DisplayListBuilder expected_builder;
+  expected_builder.DrawRect(rect2, paint2);
+  auto expected = expected_builder.Build();
+
+  DlRect cull_rect = DlRect::MakeLTRB(45, 45, 65, 65);
+  {
+    DisplayListBuilder culling_builder;
+    display_list->Dispatch(ToReceiver(culling_builder), cull_rect);
+    EXPECT_TRUE(DisplayListsEQ_Verbose(culling_builder.Build(), expected));
+  }
+  {
+    DisplayListBuilder culling_builder;
+    DlOpReceiver& receiver = ToReceiver(culling_builder);
+    for (DlIndex i : display_list->GetCulledIndices(cull_rect)) {
+      EXPECT_TRUE(display_list->Dispatch(receiver, i));
+    }
+    EXPECT_TRUE(DisplayListsEQ_Verbose(culling_builder.Build(), expected));
+  }
+}
+
 }  // namespace testing
 }  // namespace flutter
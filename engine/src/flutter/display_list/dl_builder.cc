@@ -4,6 +4,10 @@
 
 #include "flutter/display_list/dl_builder.h"
 
+#include <array>
+#include <limits>
+#include <optional>
+
 #include "flutter/display_list/display_list.h"
 #include "flutter/display_list/dl_blend_mode.h"
 #include "flutter/display_list/dl_op_flags.h"
@@ -43,6 +47,13 @@ void* DisplayListBuilder::Push(size_t pod, Args&&... args) {
   size_t size = SkAlignPtr(sizeof(T) + pod);
   size_t offset = storage_.size();
 
+  // Size fresh buffers from the previous recording, if any, to avoid
+  // growing them one power of two at a time for similar content
+  if (storage_.capacity() == 0u && storage_size_hint_ > 0u) {
+    storage_.reserve(storage_size_hint_);
+    offsets_.reserve(op_count_hint_);
+  }
+
   // Allocate the space
   auto ptr = storage_.allocate(size);
   FML_CHECK(ptr);
@@ -68,6 +79,11 @@ sk_sp<DisplayList> DisplayListBuilder::Build() {
     restore();
   }
 
+  compacted_op_count_ = 0u;
+  if (compact_op_stream_) {
+    CompactOpStream();
+  }
+
   int count = render_op_count_;
   size_t nested_bytes = nested_bytes_;
   int nested_count = nested_op_count_;
@@ -79,13 +95,11 @@ sk_sp<DisplayList> DisplayListBuilder::Build() {
   bool root_is_unbounded = current_layer().is_unbounded;
   DlBlendMode max_root_blend_mode = current_layer().max_blend_mode;
 
+  bool prepare_rtree = rtree_data_.has_value();
   sk_sp<DlRTree> rtree;
   DlRect bounds;
   if (rtree_data_.has_value()) {
-    auto& rects = rtree_data_->rects;
-    auto& indices = rtree_data_->indices;
-    rtree = sk_make_sp<DlRTree>(rects.data(), rects.size(), indices.data(),
-                                [](int id) { return id >= 0; });
+    rtree = MakeRTree(rtree_data_.value());
     // RTree bounds may be tighter due to applying filter bounds
     // adjustments to each op as we restore layers rather than to
     // the entire layer bounds.
@@ -93,19 +107,20 @@ sk_sp<DisplayList> DisplayListBuilder::Build() {
     rtree_data_.reset();
   } else {
     bounds = current_layer().global_space_accumulator.GetBounds();
+    if (auto_rtree_data_.has_value() &&
+        render_op_count_ >= kAutoRTreeRenderOpThreshold) {
+      rtree = MakeRTree(auto_rtree_data_.value());
+    }
   }
+  auto_rtree_data_.reset();
 
-  render_op_count_ = op_index_ = 0;
-  nested_bytes_ = nested_op_count_ = 0;
-  depth_ = 0;
-  is_ui_thread_safe_ = true;
-  current_opacity_compatibility_ = true;
-  render_op_depth_cost_ = 1u;
-  current_ = DlPaint();
+  ResetRecordingState();
 
   save_stack_.pop_back();
-  Init(rtree != nullptr);
+  Init(prepare_rtree);
 
+  storage_size_hint_ = storage_.size();
+  op_count_hint_ = offsets_.size();
   storage_.trim();
   DisplayListStorage storage;
   std::vector<size_t> offsets;
@@ -119,6 +134,288 @@ sk_sp<DisplayList> DisplayListBuilder::Build() {
       std::move(rtree)));
 }
 
+sk_sp<DlRTree> DisplayListBuilder::MakeRTree(const RTreeData& data) const {
+  auto& rects = data.rects;
+  auto& indices = data.indices;
+  DlRTree::Packing packing = rects.size() >= kPackedRTreeRectThreshold
+                                 ? DlRTree::Packing::kHilbert
+                                 : DlRTree::Packing::kInsertionOrder;
+  return sk_make_sp<DlRTree>(
+      rects.data(), rects.size(), indices.data(),
+      [](int id) { return id >= 0; }, -1, packing, rtree_workers_);
+}
+
+// The attribute written by an attribute op. The clear and set variants of
+// each effect write the same attribute.
+enum class AttributeSlot {
+  kAntiAlias,
+  kInvertColors,
+  kStrokeCap,
+  kStrokeJoin,
+  kStyle,
+  kStrokeWidth,
+  kStrokeMiter,
+  kColor,
+  kBlendMode,
+  kColorFilter,
+  kColorSource,
+  kImageFilter,
+  kMaskFilter,
+};
+static constexpr size_t kAttributeSlotCount =
+    static_cast<size_t>(AttributeSlot::kMaskFilter) + 1;
+
+static AttributeSlot GetAttributeSlot(DisplayListOpType type) {
+  switch (type) {
+    case DisplayListOpType::kSetAntiAlias:
+      return AttributeSlot::kAntiAlias;
+    case DisplayListOpType::kSetInvertColors:
+      return AttributeSlot::kInvertColors;
+    case DisplayListOpType::kSetStrokeCap:
+      return AttributeSlot::kStrokeCap;
+    case DisplayListOpType::kSetStrokeJoin:
+      return AttributeSlot::kStrokeJoin;
+    case DisplayListOpType::kSetStyle:
+      return AttributeSlot::kStyle;
+    case DisplayListOpType::kSetStrokeWidth:
+      return AttributeSlot::kStrokeWidth;
+    case DisplayListOpType::kSetStrokeMiter:
+      return AttributeSlot::kStrokeMiter;
+    case DisplayListOpType::kSetColor:
+      return AttributeSlot::kColor;
+    case DisplayListOpType::kSetBlendMode:
+      return AttributeSlot::kBlendMode;
+    case DisplayListOpType::kClearColorFilter:
+    case DisplayListOpType::kSetPodColorFilter:
+      return AttributeSlot::kColorFilter;
+    case DisplayListOpType::kClearColorSource:
+    case DisplayListOpType::kSetPodColorSource:
+    case DisplayListOpType::kSetImageColorSource:
+    case DisplayListOpType::kSetRuntimeEffectColorSource:
+      return AttributeSlot::kColorSource;
+    case DisplayListOpType::kClearImageFilter:
+    case DisplayListOpType::kSetPodImageFilter:
+    case DisplayListOpType::kSetSharedImageFilter:
+      return AttributeSlot::kImageFilter;
+    case DisplayListOpType::kClearMaskFilter:
+    case DisplayListOpType::kSetPodMaskFilter:
+      return AttributeSlot::kMaskFilter;
+    default:
+      FML_UNREACHABLE();
+  }
+}
+
+static uint32_t GetRenderOpInc(DisplayListOpType type) {
+  switch (type) {
+#define DL_OP_RENDER_OP_INC(name) \
+  case DisplayListOpType::k##name: \
+    return name##Op::kRenderOpInc;
+
+    FOR_EACH_DISPLAY_LIST_OP(DL_OP_RENDER_OP_INC)
+
+#undef DL_OP_RENDER_OP_INC
+
+    default:
+      FML_UNREACHABLE();
+  }
+}
+
+static void DisposeOp(const DLOp* op) {
+  switch (op->type) {
+#define DL_OP_DISPOSE(name)                            \
+  case DisplayListOpType::k##name:                     \
+    if (!std::is_trivially_destructible_v<name##Op>) { \
+      static_cast<const name##Op*>(op)->~name##Op();   \
+    }                                                  \
+    break;
+
+    FOR_EACH_DISPLAY_LIST_OP(DL_OP_DISPOSE)
+
+#undef DL_OP_DISPOSE
+
+    default:
+      FML_UNREACHABLE();
+  }
+}
+
+void DisplayListBuilder::CompactOpStream() {
+  FML_DCHECK(save_stack_.size() == 1u);
+  const size_t op_count = offsets_.size();
+  if (op_count == 0u) {
+    return;
+  }
+  uint8_t* base = storage_.base();
+  auto op_at = [base, this](size_t index) {
+    return reinterpret_cast<DLOp*>(base + offsets_[index]);
+  };
+  std::vector<bool> removed(op_count, false);
+
+  // Walking backwards, a transform or clip is only needed if a rendering
+  // op follows it before the end of its save scope, and a save is only
+  // needed if anything in its scope renders. Attributes are not part of
+  // the save state, so attribute ops inside a dropped save are kept.
+  {
+    struct Scope {
+      size_t restore_index;
+      bool renders = false;
+    };
+    std::vector<Scope> scopes = {{op_count}};
+    for (size_t i = op_count; i-- > 0u;) {
+      switch (DisplayList::GetOpCategory(op_at(i)->type)) {
+        case DisplayListOpCategory::kAttribute:
+          break;
+        case DisplayListOpCategory::kTransform:
+        case DisplayListOpCategory::kClip:
+          removed[i] = !scopes.back().renders;
+          break;
+        case DisplayListOpCategory::kRestore:
+          scopes.push_back({i});
+          break;
+        case DisplayListOpCategory::kSave: {
+          FML_DCHECK(scopes.size() > 1u);
+          Scope scope = scopes.back();
+          scopes.pop_back();
+          if (scope.renders) {
+            scopes.back().renders = true;
+          } else {
+            removed[i] = removed[scope.restore_index] = true;
+          }
+          break;
+        }
+        case DisplayListOpCategory::kSaveLayer:
+          FML_DCHECK(scopes.size() > 1u);
+          scopes.pop_back();
+          scopes.back().renders = true;
+          break;
+        case DisplayListOpCategory::kRendering:
+        case DisplayListOpCategory::kSubDisplayList:
+          scopes.back().renders = true;
+          break;
+        case DisplayListOpCategory::kInvalidCategory:
+          FML_UNREACHABLE();
+      }
+    }
+    FML_DCHECK(scopes.size() == 1u);
+  }
+
+  // Walking forwards, an attribute op is dead if the same attribute is
+  // written again before any op that might use it.
+  {
+    std::array<std::optional<size_t>, kAttributeSlotCount> pending;
+    for (size_t i = 0u; i < op_count; i++) {
+      if (removed[i]) {
+        continue;
+      }
+      DisplayListOpType type = op_at(i)->type;
+      switch (DisplayList::GetOpCategory(type)) {
+        case DisplayListOpCategory::kAttribute: {
+          std::optional<size_t>& slot =
+              pending[static_cast<size_t>(GetAttributeSlot(type))];
+          if (slot.has_value()) {
+            removed[slot.value()] = true;
+          }
+          slot = i;
+          break;
+        }
+        case DisplayListOpCategory::kSaveLayer:
+        case DisplayListOpCategory::kRendering:
+        case DisplayListOpCategory::kSubDisplayList:
+          pending.fill(std::nullopt);
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+  std::vector<DlIndex> new_indices(op_count);
+  DlIndex kept_count = 0u;
+  for (size_t i = 0u; i < op_count; i++) {
+    new_indices[i] = removed[i] ? std::numeric_limits<DlIndex>::max()  //
+                                : kept_count++;
+  }
+  if (kept_count == op_count) {
+    return;
+  }
+
+  // Ops are relocated with memmove just as the storage itself relocates
+  // them when it grows.
+  std::vector<size_t> offsets;
+  offsets.reserve(kept_count);
+  size_t write_offset = 0u;
+  for (size_t i = 0u; i < op_count; i++) {
+    size_t read_offset = offsets_[i];
+    size_t size =
+        (i + 1u < op_count ? offsets_[i + 1u] : storage_.size()) - read_offset;
+    DLOp* op = op_at(i);
+    if (removed[i]) {
+      render_op_count_ -= GetRenderOpInc(op->type);
+      DisposeOp(op);
+      continue;
+    }
+    if (write_offset != read_offset) {
+      memmove(base + write_offset, base + read_offset, size);
+    }
+    op = reinterpret_cast<DLOp*>(base + write_offset);
+    switch (DisplayList::GetOpCategory(op->type)) {
+      case DisplayListOpCategory::kSave:
+      case DisplayListOpCategory::kSaveLayer: {
+        SaveOpBase* save_op = static_cast<SaveOpBase*>(op);
+        save_op->restore_index = new_indices[save_op->restore_index];
+        break;
+      }
+      default:
+        break;
+    }
+    offsets.push_back(write_offset);
+    write_offset += size;
+  }
+  storage_.truncate(write_offset);
+  offsets_ = std::move(offsets);
+  compacted_op_count_ = op_count - kept_count;
+
+  auto remap_rtree_indices = [&new_indices](std::optional<RTreeData>& data) {
+    if (!data.has_value()) {
+      return;
+    }
+    for (int& index : data->indices) {
+      if (index >= 0 && static_cast<size_t>(index) < new_indices.size()) {
+        DlIndex new_index = new_indices[index];
+        index = new_index == std::numeric_limits<DlIndex>::max()
+                    ? -1
+                    : static_cast<int>(new_index);
+      }
+    }
+  };
+  remap_rtree_indices(rtree_data_);
+  remap_rtree_indices(auto_rtree_data_);
+}
+
+void DisplayListBuilder::Reset() {
+  bool prepare_rtree = rtree_data_.has_value();
+
+  DisplayList::DisposeOps(storage_, offsets_);
+  storage_.clear();
+  offsets_.clear();
+
+  rtree_data_.reset();
+  auto_rtree_data_.reset();
+  save_stack_.clear();
+  ResetRecordingState();
+  Init(prepare_rtree);
+}
+
+void DisplayListBuilder::ResetRecordingState() {
+  render_op_count_ = op_index_ = 0;
+  nested_bytes_ = nested_op_count_ = 0;
+  depth_ = 0;
+  is_ui_thread_safe_ = true;
+  current_opacity_compatibility_ = true;
+  render_op_depth_cost_ = 1u;
+  current_ = DlPaint();
+  nested_display_lists_.Clear();
+}
+
 static constexpr DlRect kEmpty = DlRect();
 
 static const DlRect& ProtectEmpty(const DlRect& rect) {
@@ -135,11 +432,14 @@ DisplayListBuilder::DisplayListBuilder(const DlRect& cull_rect,
 void DisplayListBuilder::Init(bool prepare_rtree) {
   FML_DCHECK(save_stack_.empty());
   FML_DCHECK(!rtree_data_.has_value());
+  FML_DCHECK(!auto_rtree_data_.has_value());
 
   save_stack_.emplace_back(original_cull_rect_);
   current_info().is_nop = original_cull_rect_.IsEmpty();
   if (prepare_rtree) {
     rtree_data_.emplace();
+  } else {
+    auto_rtree_data_.emplace();
   }
 }
 
@@ -467,8 +767,8 @@ void DisplayListBuilder::saveLayer(const DlRect& bounds,
   // Accumulate information for the SaveInfo we are about to push onto the
   // stack.
   {
-    size_t rtree_index =
-        rtree_data_.has_value() ? rtree_data_->rects.size() : 0u;
+    const RTreeData* rtree_data = GetRTreeData();
+    size_t rtree_index = rtree_data ? rtree_data->rects.size() : 0u;
 
     save_stack_.emplace_back(&current_info(), filter, rtree_index);
     FML_DCHECK(current_info().is_save_layer);
@@ -710,6 +1010,13 @@ void DisplayListBuilder::TransferLayerBounds(const DlRect& content_bounds) {
       parent_is_flooded = true;
     }
   } else {
+    if (auto_rtree_data_.has_value()) {
+      // The automatic spatial index only needs to be conservative for
+      // culling, the flooding of the parent is determined from the
+      // global bounds below.
+      AdjustRTreeRects(auto_rtree_data_.value(), *filter, matrix, clip,
+                       current_layer().rtree_rects_start_index);
+    }
     DlRect global_bounds = current_layer().global_space_accumulator.GetBounds();
     if (!global_bounds.IsEmpty()) {
       DlIRect global_ibounds = DlIRect::RoundOut(global_bounds);
@@ -1631,6 +1938,19 @@ void DisplayListBuilder::DrawDisplayList(const sk_sp<DisplayList> display_list,
       current_info().is_nop) {
     return;
   }
+  // Record the contents of a DisplayList that only wraps another one
+  // directly, which saves a level of nesting each time it is dispatched.
+  // The wrapper can be skipped as long as its cull rect didn't clip the
+  // bounds of the contents, which an opacity layer would clip to.
+  DlScalar nested_opacity;
+  if (sk_sp<DisplayList> nested =
+          display_list->GetSoleNestedDisplayList(&nested_opacity)) {
+    if (nested->GetBounds() == display_list->GetBounds() &&
+        nested->root_is_unbounded() == display_list->root_is_unbounded()) {
+      DrawDisplayList(nested, opacity * nested_opacity);
+      return;
+    }
+  }
   const DlRect bounds = display_list->GetBounds();
   bool accumulated;
   sk_sp<const DlRTree> rtree;
@@ -1655,7 +1975,9 @@ void DisplayListBuilder::DrawDisplayList(const sk_sp<DisplayList> display_list,
   }
 
   DlPaint current_paint = current_;
-  Push<DrawDisplayListOp>(0, display_list,
+  // Equal sub-pictures drawn repeatedly within this recording share a
+  // single DisplayList instance.
+  Push<DrawDisplayListOp>(0, nested_display_lists_.Intern(display_list),
                           opacity < SK_Scalar1 ? opacity : SK_Scalar1);
 
   // This depth increment accounts for every draw call in the child
@@ -1718,8 +2040,14 @@ void DisplayListBuilder::drawText(const std::shared_ptr<DlText>& text,
     // there are no current guarantees from either Skia or Impeller that
     // they will protect overlapping glyphs from the effects of overdraw
     // so we must make the conservative assessment that this DL layer is
-    // not compatible with group opacity inheritance.
-    UpdateLayerOpacityCompatibility(false);
+    // not compatible with group opacity inheritance. A single glyph, such
+    // as an icon, cannot overlap itself though and is treated like any
+    // other geometry.
+    if (text->IsSingleGlyph()) {
+      CheckLayerOpacityCompatibility();
+    } else {
+      UpdateLayerOpacityCompatibility(false);
+    }
     UpdateLayerResult(result);
   }
 }
@@ -1828,6 +2156,10 @@ bool DisplayListBuilder::AccumulateUnbounded(const SaveInfo& save) {
     rtree_data_->indices.push_back(op_index_);
   } else {
     save.layer_info->global_space_accumulator.accumulate(global_clip);
+    if (auto_rtree_data_.has_value()) {
+      auto_rtree_data_->rects.push_back(global_clip);
+      auto_rtree_data_->indices.push_back(op_index_);
+    }
   }
   save.layer_info->layer_local_accumulator.accumulate(layer_clip);
   return true;
@@ -1862,6 +2194,10 @@ bool DisplayListBuilder::AccumulateBounds(const DlRect& bounds,
     }
   } else {
     layer.layer_info->global_space_accumulator.accumulate(global_bounds);
+    if (auto_rtree_data_.has_value() && id >= 0) {
+      auto_rtree_data_->rects.push_back(global_bounds);
+      auto_rtree_data_->indices.push_back(id);
+    }
   }
   layer.layer_info->layer_local_accumulator.accumulate(layer_bounds);
   return true;
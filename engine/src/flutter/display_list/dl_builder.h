@@ -16,6 +16,7 @@
 #include "flutter/display_list/image/dl_image.h"
 #include "flutter/display_list/utils/dl_accumulation_rect.h"
 #include "flutter/display_list/utils/dl_comparable.h"
+#include "flutter/display_list/utils/dl_interner.h"
 #include "flutter/display_list/utils/dl_matrix_clip_tracker.h"
 #include "flutter/fml/macros.h"
 
@@ -32,6 +33,24 @@ class DisplayListBuilder final : public virtual DlCanvas,
   static constexpr DlRect kMaxCullRect =
       DlRect::MakeLTRB(-1E9F, -1E9F, 1E9F, 1E9F);
 
+  /// The number of rendering ops above which a builder that was not asked
+  /// to |prepare_rtree| will still attach an RTree to the DisplayList it
+  /// builds so that a culled |DisplayList::Dispatch| can skip the ops that
+  /// fall outside of the cull rect.
+  static constexpr uint32_t kAutoRTreeRenderOpThreshold = 256u;
+
+  /// The number of tracked rects at or above which the RTree attached to a
+  /// built DisplayList is packed along a Hilbert curve rather than in op
+  /// order. See |DlRTree::Packing|.
+  static constexpr size_t kPackedRTreeRectThreshold = 4096u;
+
+  /// The number of rendering ops of each layer whose bounds are compared
+  /// individually to prove that they do not overlap, so that the layer can
+  /// still distribute group opacity to them when the ops are arranged in a
+  /// grid or another 2D layout. Layers with more ops only compare each op
+  /// against the combined bounds of the previous ones.
+  static constexpr size_t kMaxGroupOpacityDisjointOps = 64u;
+
   explicit DisplayListBuilder(bool prepare_rtree)
       : DisplayListBuilder(kMaxCullRect, prepare_rtree) {}
 
@@ -43,6 +62,29 @@ class DisplayListBuilder final : public virtual DlCanvas,
 
   ~DisplayListBuilder();
 
+  /// Provides a task runner on which the construction of very large RTrees
+  /// in |Build| may be parallelized. The builder still waits for the
+  /// construction to finish before |Build| returns.
+  void SetRTreeWorkers(std::shared_ptr<fml::ConcurrentTaskRunner> workers) {
+    rtree_workers_ = std::move(workers);
+  }
+
+  /// Enables a compaction pass in |Build| that rewrites the recorded ops
+  /// without changing what they render. The pass drops:
+  ///  - save/restore pairs whose contents render nothing,
+  ///  - transforms and clips that no later rendering op in their save
+  ///    scope depends on, and
+  ///  - attribute changes that are overwritten before any op uses them,
+  ///    which happens whenever a draw call is culled.
+  ///
+  /// Framework recordings contain a lot of these, so compacting them once
+  /// makes every later dispatch of the DisplayList cheaper.
+  void SetCompactOpStream(bool compact) { compact_op_stream_ = compact; }
+
+  /// Returns the number of ops that the compaction pass dropped from the
+  /// DisplayList returned by the last call to |Build|.
+  uint32_t GetCompactedOpCount() const { return compacted_op_count_; }
+
   // |DlCanvas|
   DlISize GetBaseLayerDimensions() const override;
   // |DlCanvas|
@@ -244,8 +286,14 @@ class DisplayListBuilder final : public virtual DlCanvas,
 
   sk_sp<DisplayList> Build();
 
+  /// Discards everything recorded since the last |Build| or |Reset| and
+  /// returns the builder to its freshly constructed state while keeping
+  /// the op storage allocated for the next recording.
+  void Reset();
+
  private:
   void Init(bool prepare_rtree);
+  void ResetRecordingState();
 
   // This method exposes the internal stateful DlOpReceiver implementation
   // of the DisplayListBuilder, primarily for testing purposes. Its use
@@ -507,6 +555,10 @@ class DisplayListBuilder final : public virtual DlCanvas,
 
   DisplayListStorage storage_;
   std::vector<size_t> offsets_;
+  // Sizes of the most recently built recording, used to presize the
+  // buffers for the next one
+  size_t storage_size_hint_ = 0u;
+  size_t op_count_hint_ = 0u;
   uint32_t render_op_count_ = 0u;
   uint32_t depth_ = 0u;
   // Most rendering ops will use 1 depth value, but some attributes may
@@ -520,6 +572,10 @@ class DisplayListBuilder final : public virtual DlCanvas,
 
   bool is_ui_thread_safe_ = true;
 
+  // The sub-pictures referenced by |drawDisplayList| ops in the current
+  // recording.
+  DisplayListInterner nested_display_lists_;
+
   template <typename T, typename... Args>
   void* Push(size_t extra, Args&&... args);
 
@@ -549,7 +605,7 @@ class DisplayListBuilder final : public virtual DlCanvas,
 
     // The bounds accumulator to set/verify the bounds of the most recently
     // invoked saveLayer call, relative to the root of that saveLayer
-    AccumulationRect layer_local_accumulator;
+    AccumulationRect layer_local_accumulator{kMaxGroupOpacityDisjointOps};
 
     DlBlendMode max_blend_mode = DlBlendMode::kClear;
 
@@ -642,6 +698,25 @@ class DisplayListBuilder final : public virtual DlCanvas,
   const DlRect original_cull_rect_;
   std::vector<SaveInfo> save_stack_;
   std::optional<RTreeData> rtree_data_;
+  // Op bounds gathered alongside the global bounds accumulators when no
+  // RTree was requested, used to attach an RTree to large DisplayLists.
+  std::optional<RTreeData> auto_rtree_data_;
+
+  std::shared_ptr<fml::ConcurrentTaskRunner> rtree_workers_;
+
+  bool compact_op_stream_ = false;
+  uint32_t compacted_op_count_ = 0u;
+
+  // See |SetCompactOpStream|. Must be called with all saves restored.
+  void CompactOpStream();
+
+  sk_sp<DlRTree> MakeRTree(const RTreeData& data) const;
+
+  const RTreeData* GetRTreeData() const {
+    return rtree_data_.has_value()        ? &rtree_data_.value()
+           : auto_rtree_data_.has_value() ? &auto_rtree_data_.value()
+                                          : nullptr;
+  }
 
   DlPaint current_;
 
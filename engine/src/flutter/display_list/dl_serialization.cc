@@ -0,0 +1,294 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/dl_serialization.h"
+
+#include <cstring>
+#include <vector>
+
+#include "flutter/display_list/dl_op_records.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr uint32_t kMagic = 0x544C4C44;  // "DLLT" in little endian.
+
+enum HeaderFlags : uint32_t {
+  kCanApplyGroupOpacity = 1 << 0,
+  kIsUIThreadSafe = 1 << 1,
+  kModifiesTransparentBlack = 1 << 2,
+  kRootIsUnbounded = 1 << 3,
+};
+
+struct Header {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t pointer_size;
+  uint32_t record_count;
+  uint64_t storage_size;
+  uint32_t op_count;
+  uint32_t total_depth;
+  DlScalar bounds[4];
+  uint32_t flags;
+  uint32_t max_root_blend_mode;
+};
+static_assert(sizeof(Header) % 8 == 0);
+
+size_t OffsetTableSize(size_t record_count) {
+  // Padded so that the op records that follow stay 8 byte aligned.
+  return (record_count * sizeof(uint32_t) + 7u) & ~size_t{7u};
+}
+
+size_t MinimumRecordSize(DisplayListOpType type) {
+  switch (type) {
+#define DL_OP_SIZE(name)          \
+  case DisplayListOpType::k##name: \
+    return sizeof(name##Op);
+
+    FOR_EACH_DISPLAY_LIST_OP(DL_OP_SIZE)
+
+#undef DL_OP_SIZE
+
+    case DisplayListOpType::kInvalidOp:
+      break;
+  }
+  return 0u;
+}
+
+// Checks the contents of the record that the size of the record alone
+// cannot vouch for.
+bool ValidateRecord(const DLOp* op,
+                    size_t record_size,
+                    size_t index,
+                    size_t record_count,
+                    int& save_depth) {
+  switch (op->type) {
+    case DisplayListOpType::kSave:
+    case DisplayListOpType::kSaveLayer: {
+      auto save_op = static_cast<const SaveOpBase*>(op);
+      save_depth++;
+      return save_op->restore_index > index &&
+             save_op->restore_index < record_count;
+    }
+    case DisplayListOpType::kRestore:
+      return --save_depth >= 0;
+    case DisplayListOpType::kDrawPoints:
+    case DisplayListOpType::kDrawLines:
+    case DisplayListOpType::kDrawPolygon: {
+      // All three point ops share the same layout.
+      auto points_op = static_cast<const DrawPointsOp*>(op);
+      return sizeof(DrawPointsOp) + points_op->count * sizeof(DlPoint) <=
+             record_size;
+    }
+    default:
+      return true;
+  }
+}
+
+}  // namespace
+
+bool DisplayListSerializer::CanSerialize(DisplayListOpType type) {
+  switch (type) {
+    case DisplayListOpType::kSetAntiAlias:
+    case DisplayListOpType::kSetInvertColors:
+    case DisplayListOpType::kSetStrokeCap:
+    case DisplayListOpType::kSetStrokeJoin:
+    case DisplayListOpType::kSetStyle:
+    case DisplayListOpType::kSetStrokeWidth:
+    case DisplayListOpType::kSetStrokeMiter:
+    case DisplayListOpType::kSetColor:
+    case DisplayListOpType::kSetBlendMode:
+    case DisplayListOpType::kClearColorFilter:
+    case DisplayListOpType::kClearColorSource:
+    case DisplayListOpType::kClearImageFilter:
+    case DisplayListOpType::kClearMaskFilter:
+    case DisplayListOpType::kSave:
+    case DisplayListOpType::kSaveLayer:
+    case DisplayListOpType::kRestore:
+    case DisplayListOpType::kTranslate:
+    case DisplayListOpType::kScale:
+    case DisplayListOpType::kRotate:
+    case DisplayListOpType::kSkew:
+    case DisplayListOpType::kTransform2DAffine:
+    case DisplayListOpType::kTransformFullPerspective:
+    case DisplayListOpType::kTransformReset:
+    case DisplayListOpType::kClipIntersectRect:
+    case DisplayListOpType::kClipIntersectOval:
+    case DisplayListOpType::kClipIntersectRoundRect:
+    case DisplayListOpType::kClipIntersectRoundSuperellipse:
+    case DisplayListOpType::kClipDifferenceRect:
+    case DisplayListOpType::kClipDifferenceOval:
+    case DisplayListOpType::kClipDifferenceRoundRect:
+    case DisplayListOpType::kClipDifferenceRoundSuperellipse:
+    case DisplayListOpType::kDrawPaint:
+    case DisplayListOpType::kDrawColor:
+    case DisplayListOpType::kDrawLine:
+    case DisplayListOpType::kDrawDashedLine:
+    case DisplayListOpType::kDrawRect:
+    case DisplayListOpType::kDrawOval:
+    case DisplayListOpType::kDrawCircle:
+    case DisplayListOpType::kDrawRoundRect:
+    case DisplayListOpType::kDrawDiffRoundRect:
+    case DisplayListOpType::kDrawRoundSuperellipse:
+    case DisplayListOpType::kDrawArc:
+    case DisplayListOpType::kDrawPoints:
+    case DisplayListOpType::kDrawLines:
+    case DisplayListOpType::kDrawPolygon:
+      return true;
+    default:
+      // Every other op holds a reference to an object (or, for the pod
+      // filter and color source ops, an object with a vtable) that does
+      // not survive being written out as raw bytes.
+      return false;
+  }
+}
+
+std::unique_ptr<fml::Mapping> DisplayListSerializer::Serialize(
+    const DisplayList& display_list) {
+  const DisplayListStorage& storage = display_list.storage_;
+  const std::vector<size_t>& offsets = display_list.offsets_;
+  const uint8_t* base = storage.base();
+  for (size_t offset : offsets) {
+    auto op = reinterpret_cast<const DLOp*>(base + offset);
+    if (!CanSerialize(op->type)) {
+      return nullptr;
+    }
+  }
+
+  const DlRect& bounds = display_list.GetBounds();
+  uint32_t flags = 0u;
+  if (display_list.can_apply_group_opacity()) {
+    flags |= kCanApplyGroupOpacity;
+  }
+  if (display_list.isUIThreadSafe()) {
+    flags |= kIsUIThreadSafe;
+  }
+  if (display_list.modifies_transparent_black()) {
+    flags |= kModifiesTransparentBlack;
+  }
+  if (display_list.root_is_unbounded()) {
+    flags |= kRootIsUnbounded;
+  }
+  Header header = {
+      .magic = kMagic,
+      .version = kFormatVersion,
+      .pointer_size = sizeof(void*),
+      .record_count = static_cast<uint32_t>(offsets.size()),
+      .storage_size = storage.size(),
+      .op_count = display_list.op_count(),
+      .total_depth = display_list.total_depth(),
+      .bounds = {bounds.GetLeft(), bounds.GetTop(), bounds.GetRight(),
+                 bounds.GetBottom()},
+      .flags = flags,
+      .max_root_blend_mode =
+          static_cast<uint32_t>(display_list.max_root_blend_mode()),
+  };
+
+  size_t table_size = OffsetTableSize(offsets.size());
+  std::vector<uint8_t> data(sizeof(Header) + table_size + storage.size(), 0u);
+  uint8_t* ptr = data.data();
+  memcpy(ptr, &header, sizeof(Header));
+  ptr += sizeof(Header);
+  for (size_t offset : offsets) {
+    uint32_t offset32 = static_cast<uint32_t>(offset);
+    memcpy(ptr, &offset32, sizeof(offset32));
+    ptr += sizeof(offset32);
+  }
+  ptr = data.data() + sizeof(Header) + table_size;
+  if (storage.size() > 0u) {
+    memcpy(ptr, base, storage.size());
+  }
+  return std::make_unique<fml::DataMapping>(std::move(data));
+}
+
+sk_sp<DisplayList> DisplayListSerializer::Deserialize(
+    const fml::Mapping& mapping) {
+  const uint8_t* data = mapping.GetMapping();
+  size_t size = mapping.GetSize();
+  if (data == nullptr || size < sizeof(Header)) {
+    return nullptr;
+  }
+  Header header;
+  memcpy(&header, data, sizeof(Header));
+  if (header.magic != kMagic || header.version != kFormatVersion ||
+      header.pointer_size != sizeof(void*) ||
+      header.max_root_blend_mode >
+          static_cast<uint32_t>(DlBlendMode::kLastMode)) {
+    return nullptr;
+  }
+  size_t record_count = header.record_count;
+  size_t storage_size = header.storage_size;
+  size_t table_size = OffsetTableSize(record_count);
+  if (size - sizeof(Header) < table_size ||
+      size - sizeof(Header) - table_size != storage_size) {
+    return nullptr;
+  }
+
+  const uint8_t* table = data + sizeof(Header);
+  const uint8_t* records = table + table_size;
+  std::vector<size_t> offsets;
+  offsets.reserve(record_count);
+  int save_depth = 0;
+  for (size_t i = 0; i < record_count; i++) {
+    uint32_t offset;
+    memcpy(&offset, table + i * sizeof(uint32_t), sizeof(offset));
+    uint32_t next_offset = static_cast<uint32_t>(storage_size);
+    if (i + 1 < record_count) {
+      memcpy(&next_offset, table + (i + 1) * sizeof(uint32_t),
+             sizeof(next_offset));
+    }
+    // Records are contiguous, so consecutive offsets must be increasing
+    // and the first record must start at the beginning of the storage.
+    if ((i == 0 && offset != 0u) || offset % alignof(void*) != 0u ||
+        next_offset <= offset || next_offset > storage_size) {
+      return nullptr;
+    }
+    size_t record_size = next_offset - offset;
+    if (record_size < sizeof(DLOp)) {
+      return nullptr;
+    }
+    // The op type is the first field of every record.
+    DisplayListOpType type;
+    memcpy(&type, records + offset, sizeof(type));
+    if (type >= DisplayListOpType::kMaxOp || !CanSerialize(type) ||
+        record_size < MinimumRecordSize(type)) {
+      return nullptr;
+    }
+    offsets.push_back(offset);
+  }
+
+  DisplayListStorage storage;
+  if (storage_size > 0u) {
+    storage.reserve(storage_size);
+    memcpy(storage.allocate(storage_size), records, storage_size);
+  }
+
+  // The records are now suitably aligned to inspect their contents.
+  for (size_t i = 0; i < record_count; i++) {
+    size_t next_offset = i + 1 < record_count ? offsets[i + 1] : storage_size;
+    auto op = reinterpret_cast<const DLOp*>(storage.base() + offsets[i]);
+    if (!ValidateRecord(op, next_offset - offsets[i], i, record_count,
+                        save_depth)) {
+      return nullptr;
+    }
+  }
+  if (save_depth != 0) {
+    return nullptr;
+  }
+
+  DlRect bounds = DlRect::MakeLTRB(header.bounds[0], header.bounds[1],
+                                   header.bounds[2], header.bounds[3]);
+  return sk_sp<DisplayList>(new DisplayList(
+      std::move(storage), std::move(offsets), header.op_count,
+      /*nested_byte_count=*/0u, /*nested_op_count=*/0u, header.total_depth,
+      bounds, (header.flags & kCanApplyGroupOpacity) != 0,
+      (header.flags & kIsUIThreadSafe) != 0,
+      (header.flags & kModifiesTransparentBlack) != 0,
+      static_cast<DlBlendMode>(header.max_root_blend_mode),
+      /*root_has_backdrop_filter=*/false,
+      (header.flags & kRootIsUnbounded) != 0, /*rtree=*/nullptr));
+}
+
+}  // namespace flutter
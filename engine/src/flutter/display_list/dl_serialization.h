@@ -0,0 +1,53 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_DL_SERIALIZATION_H_
+#define FLUTTER_DISPLAY_LIST_DL_SERIALIZATION_H_
+
+#include <memory>
+
+#include "flutter/display_list/display_list.h"
+#include "flutter/fml/mapping.h"
+
+namespace flutter {
+
+// Converts a DisplayList to and from a flat binary form that can be
+// written to disk and later loaded from an |fml::FileMapping| without
+// re-recording the operations.
+//
+// The serialized form is a fixed header followed by the table of op
+// offsets and then the op records exactly as they appear in the
+// |DisplayListStorage|, so loading amounts to validating the records and
+// copying them into the storage of a new DisplayList.
+//
+// Because the records are stored in their in-memory layout, only lists
+// consisting entirely of ops that do not hold references to other objects
+// (images, paths, filters, text, vertices, nested DisplayLists, runtime
+// effects, and so on) can be serialized, and the data can only be loaded
+// by an engine with the same |kFormatVersion| and pointer size.
+class DisplayListSerializer {
+ public:
+  // Bumped every time any op record layout or the header changes.
+  static constexpr uint32_t kFormatVersion = 1u;
+
+  // Returns the serialized form of the DisplayList or nullptr if the list
+  // contains any op that cannot be serialized.
+  static std::unique_ptr<fml::Mapping> Serialize(
+      const DisplayList& display_list);
+
+  // Returns a DisplayList holding the ops in the serialized data or
+  // nullptr if the data is malformed or was produced by an incompatible
+  // engine.
+  static sk_sp<DisplayList> Deserialize(const fml::Mapping& mapping);
+
+  // Whether ops of the given type can be serialized.
+  static bool CanSerialize(DisplayListOpType type);
+
+ private:
+  DisplayListSerializer() = delete;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_DL_SERIALIZATION_H_
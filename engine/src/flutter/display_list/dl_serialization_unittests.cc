@@ -0,0 +1,100 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/dl_serialization.h"
+
+#include <vector>
+
+#include "flutter/display_list/dl_builder.h"
+#include "flutter/display_list/effects/dl_image_filter.h"
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+
+static sk_sp<DisplayList> MakeVectorArt() {
+  DisplayListBuilder builder;
+  builder.DrawColor(DlColor::kWhite(), DlBlendMode::kSrc);
+  builder.Save();
+  builder.Translate(10, 10);
+  builder.ClipRect(DlRect::MakeLTRB(0, 0, 100, 100));
+  builder.DrawRect(DlRect::MakeLTRB(10, 10, 50, 50),
+                   DlPaint(DlColor::kBlue()));
+  builder.DrawCircle(DlPoint(60, 60), 20,
+                     DlPaint(DlColor::kRed())
+                         .setDrawStyle(DlDrawStyle::kStroke)
+                         .setStrokeWidth(4));
+  DlPoint points[] = {DlPoint(0, 0), DlPoint(10, 20), DlPoint(30, 5)};
+  builder.DrawPoints(DlPointMode::kPolygon, 3, points, DlPaint());
+  builder.Restore();
+  return builder.Build();
+}
+
+TEST(DisplayListSerialization, RoundTrip) {
+  auto display_list = MakeVectorArt();
+  auto serialized = DisplayListSerializer::Serialize(*display_list);
+  ASSERT_NE(serialized, nullptr);
+
+  auto loaded = DisplayListSerializer::Deserialize(*serialized);
+  ASSERT_NE(loaded, nullptr);
+  EXPECT_TRUE(loaded->Equals(display_list));
+  EXPECT_EQ(loaded->GetBounds(), display_list->GetBounds());
+  EXPECT_EQ(loaded->op_count(), display_list->op_count());
+  EXPECT_EQ(loaded->total_depth(), display_list->total_depth());
+  EXPECT_EQ(loaded->can_apply_group_opacity(),
+            display_list->can_apply_group_opacity());
+  EXPECT_EQ(loaded->modifies_transparent_black(),
+            display_list->modifies_transparent_black());
+}
+
+TEST(DisplayListSerialization, EmptyDisplayList) {
+  auto display_list = DisplayListBuilder().Build();
+  auto serialized = DisplayListSerializer::Serialize(*display_list);
+  ASSERT_NE(serialized, nullptr);
+
+  auto loaded = DisplayListSerializer::Deserialize(*serialized);
+  ASSERT_NE(loaded, nullptr);
+  EXPECT_EQ(loaded->op_count(), 0u);
+  EXPECT_TRUE(loaded->Equals(display_list));
+}
+
+TEST(DisplayListSerialization, RejectsOpsWithReferences) {
+  DisplayListBuilder builder;
+  builder.DrawPath(DlPath::MakeOval(DlRect::MakeLTRB(0, 0, 10, 10)),
+                   DlPaint());
+  EXPECT_EQ(DisplayListSerializer::Serialize(*builder.Build()), nullptr);
+
+  DlPaint save_paint;
+  save_paint.setImageFilter(DlImageFilter::MakeBlur(2, 2, DlTileMode::kClamp));
+  builder.SaveLayer(std::nullopt, &save_paint);
+  builder.DrawRect(DlRect::MakeLTRB(0, 0, 10, 10), DlPaint());
+  builder.Restore();
+  EXPECT_EQ(DisplayListSerializer::Serialize(*builder.Build()), nullptr);
+}
+
+TEST(DisplayListSerialization, RejectsMalformedData) {
+  auto serialized = DisplayListSerializer::Serialize(*MakeVectorArt());
+  ASSERT_NE(serialized, nullptr);
+  const uint8_t* data = serialized->GetMapping();
+  size_t size = serialized->GetSize();
+
+  // Truncated.
+  fml::NonOwnedMapping truncated(data, size - 8);
+  EXPECT_EQ(DisplayListSerializer::Deserialize(truncated), nullptr);
+
+  // Wrong magic.
+  std::vector<uint8_t> corrupted(data, data + size);
+  corrupted[0] ^= 0xFF;
+  fml::NonOwnedMapping bad_magic(corrupted.data(), corrupted.size());
+  EXPECT_EQ(DisplayListSerializer::Deserialize(bad_magic), nullptr);
+
+  // Wrong version.
+  corrupted.assign(data, data + size);
+  corrupted[4] ^= 0xFF;
+  fml::NonOwnedMapping bad_version(corrupted.data(), corrupted.size());
+  EXPECT_EQ(DisplayListSerializer::Deserialize(bad_version), nullptr);
+}
+
+}  // namespace testing
+}  // namespace flutter
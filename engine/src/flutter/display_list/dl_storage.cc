@@ -57,6 +57,31 @@ uint8_t* DisplayListStorage::allocate(size_t needed) {
   return ret;
 }
 
+void DisplayListStorage::reserve(size_t capacity) {
+  if (capacity <= allocated_) {
+    return;
+  }
+  size_t old_size = allocated_;
+  realloc(capacity);
+  memset(ptr_.get() + old_size, 0, allocated_ - old_size);
+}
+
+void DisplayListStorage::clear() {
+  // Storage handed out by |allocate| is always zero filled.
+  if (used_ > 0u) {
+    memset(ptr_.get(), 0, used_);
+  }
+  used_ = 0u;
+}
+
+void DisplayListStorage::truncate(size_t size) {
+  FML_CHECK(size <= used_);
+  if (size < used_) {
+    memset(ptr_.get() + size, 0, used_ - size);
+  }
+  used_ = size;
+}
+
 DisplayListStorage::DisplayListStorage(DisplayListStorage&& source) {
   ptr_ = std::move(source.ptr_);
   used_ = source.used_;
@@ -35,6 +35,19 @@ class DisplayListStorage {
   /// any other outstanding pointers into the storage.
   uint8_t* allocate(size_t needed);
 
+  /// Ensures that at least the indicated number of bytes are allocated
+  /// without changing the size and invalidates any outstanding pointers
+  /// into the storage if it has to grow.
+  void reserve(size_t capacity);
+
+  /// Empties the storage while keeping its allocation for reuse. Any
+  /// outstanding pointers into the storage are invalidated.
+  void clear();
+
+  /// Reduces the size of the storage to |size| bytes while keeping its
+  /// allocation. The released bytes are zero filled for reuse.
+  void truncate(size_t size);
+
   /// Trims the storage to the currently allocated size and invalidates
   /// any outstanding pointers into the storage.
   void trim() { realloc(used_); }
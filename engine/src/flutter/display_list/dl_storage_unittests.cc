@@ -43,6 +43,55 @@ TEST(DisplayListStorage, PostMove) {
   EXPECT_EQ(moved.capacity(), DisplayListStorage::kDLPageSize);
 }
 
+TEST(DisplayListStorage, Reserve) {
+  DisplayListStorage storage;
+  storage.reserve(10000u);
+  EXPECT_NE(storage.base(), nullptr);
+  EXPECT_EQ(storage.size(), 0u);
+  EXPECT_EQ(storage.capacity(), 10000u);
+
+  uint8_t* base = storage.base();
+  EXPECT_EQ(storage.allocate(9000u), base);
+  EXPECT_EQ(storage.base(), base);
+  EXPECT_EQ(storage.capacity(), 10000u);
+
+  // Reserving less than the capacity is a no-op.
+  storage.reserve(100u);
+  EXPECT_EQ(storage.size(), 9000u);
+  EXPECT_EQ(storage.capacity(), 10000u);
+}
+
+TEST(DisplayListStorage, ClearKeepsAllocation) {
+  DisplayListStorage storage;
+  uint8_t* ptr = storage.allocate(10u);
+  ASSERT_NE(ptr, nullptr);
+  ptr[0] = 42u;
+
+  storage.clear();
+  EXPECT_EQ(storage.size(), 0u);
+  EXPECT_EQ(storage.capacity(), DisplayListStorage::kDLPageSize);
+
+  // The same memory is handed out again, zero filled.
+  EXPECT_EQ(storage.allocate(10u), ptr);
+  EXPECT_EQ(ptr[0], 0u);
+}
+
+TEST(DisplayListStorage, TruncateZeroFillsReleasedBytes) {
+  DisplayListStorage storage;
+  uint8_t* bytes = storage.allocate(64u);
+  memset(bytes, 0xff, 64u);
+  storage.truncate(16u);
+  EXPECT_EQ(storage.size(), 16u);
+  EXPECT_GE(storage.capacity(), 64u);
+  EXPECT_EQ(storage.base()[15], 0xffu);
+
+  uint8_t* reallocated = storage.allocate(48u);
+  EXPECT_EQ(reallocated, storage.base() + 16u);
+  for (size_t i = 0; i < 48u; i++) {
+    EXPECT_EQ(reallocated[i], 0u) << i;
+  }
+}
+
 TEST(DisplayListStorage, NextPowerOfTwoSize) {
   EXPECT_EQ(DisplayListStorage::NextPowerOfTwoSize(0), 1u);
   EXPECT_EQ(DisplayListStorage::NextPowerOfTwoSize(1), 1u);
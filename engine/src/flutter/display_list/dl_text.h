@@ -22,6 +22,10 @@ class DlText {
   virtual std::shared_ptr<impeller::TextFrame> GetTextFrame() const = 0;
   virtual const SkTextBlob* GetTextBlob() const = 0;
 
+  // Whether the text consists of exactly one glyph, which unlike longer
+  // text can never overlap itself.
+  virtual bool IsSingleGlyph() const = 0;
+
   bool operator==(const DlText& other) const;
 
  protected:
@@ -11,4 +11,17 @@ std::shared_ptr<DlTextSkia> DlTextSkia::Make(const sk_sp<SkTextBlob>& blob) {
 
 DlTextSkia::DlTextSkia(const sk_sp<SkTextBlob>& blob) : blob_(blob) {}
 
+bool DlTextSkia::IsSingleGlyph() const {
+  SkTextBlob::Iter iter(*blob_);
+  SkTextBlob::Iter::Run run;
+  int glyph_count = 0;
+  while (iter.next(&run)) {
+    glyph_count += run.fGlyphCount;
+    if (glyph_count > 1) {
+      return false;
+    }
+  }
+  return glyph_count == 1;
+}
+
 }  // namespace flutter
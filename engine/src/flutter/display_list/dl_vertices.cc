@@ -220,11 +220,12 @@ DlVertices::Builder::Builder(DlVertexMode mode,
                   DlVerticesDeleter);
 }
 
+// Points are stored as pairs of floats, so interleaved coordinates can be
+// copied in one go rather than point by point.
+static_assert(sizeof(DlPoint) == 2 * sizeof(float));
+
 static void store_points(char* dst, int offset, const float* src, int count) {
-  DlPoint* points = reinterpret_cast<DlPoint*>(dst + offset);
-  for (int i = 0; i < count; i++) {
-    points[i] = DlPoint(src[i * 2], src[i * 2 + 1]);
-  }
+  memcpy(dst + offset, src, count * sizeof(DlPoint));
 }
 
 void DlVertices::Builder::store_vertices(const DlPoint vertices[]) {
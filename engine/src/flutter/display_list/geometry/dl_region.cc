@@ -100,6 +100,9 @@ DlRegion::DlRegion(const std::vector<DlIRect>& rects) {
 
 DlRegion::DlRegion(const DlIRect& rect) : bounds_(rect) {
   Span span{rect.GetLeft(), rect.GetRight()};
+  // A single chunk holding its size and one span. Reserving it exactly
+  // keeps simple regions from allocating the default chunk capacity.
+  span_buffer_.reserve(2);
   lines_.push_back(makeLine(rect.GetTop(), rect.GetBottom(), &span, &span + 1));
 }
 
@@ -166,11 +169,26 @@ size_t DlRegion::unionLineSpans(std::vector<Span>& res,
   const Span *begin2, *end2;
   b_buffer.getSpans(b_handle, begin2, end2);
 
-  size_t min_size = (end1 - begin1) + (end2 - begin2);
+  size_t size1 = end1 - begin1;
+  size_t size2 = end2 - begin2;
+  size_t min_size = size1 + size2;
   if (res.size() < min_size) {
     res.resize(min_size);
   }
 
+  // Lines whose spans do not overlap or touch horizontally, such as
+  // neighboring columns of a grid, are simply concatenated.
+  if ((end1 - 1)->right < begin2->left) {
+    memcpy(res.data(), begin1, size1 * sizeof(Span));
+    memcpy(res.data() + size1, begin2, size2 * sizeof(Span));
+    return min_size;
+  }
+  if ((end2 - 1)->right < begin1->left) {
+    memcpy(res.data(), begin2, size2 * sizeof(Span));
+    memcpy(res.data() + size2, begin1, size1 * sizeof(Span));
+    return min_size;
+  }
+
   OrderedSpanAccumulator accumulator(res);
 
   while (true) {
@@ -214,6 +232,11 @@ size_t DlRegion::intersectLineSpans(std::vector<Span>& res,
   const Span *begin2, *end2;
   b_buffer.getSpans(b_handle, begin2, end2);
 
+  // Lines that do not overlap horizontally have an empty intersection.
+  if ((end1 - 1)->right <= begin2->left || (end2 - 1)->right <= begin1->left) {
+    return 0;
+  }
+
   // Worst case scenario, interleaved overlapping spans
   //   AAAA  BBBB  CCCC
   // XXX  YYYY  XXXX
@@ -415,8 +438,10 @@ DlRegion DlRegion::MakeUnion(const DlRegion& a, const DlRegion& b) {
 
   DlRegion res;
   res.bounds_ = a.bounds_.Union(b.bounds_);
-  res.span_buffer_.reserve(a.span_buffer_.capacity() +
-                           b.span_buffer_.capacity());
+  // Size the result from the spans actually stored in the operands. Their
+  // capacities include growth slack which would otherwise compound when a
+  // region is repeatedly unioned into an accumulator.
+  res.span_buffer_.reserve(a.span_buffer_.size() + b.span_buffer_.size());
 
   auto& lines = res.lines_;
   lines.reserve(a.lines_.size() + b.lines_.size());
@@ -508,7 +533,7 @@ DlRegion DlRegion::MakeIntersection(const DlRegion& a, const DlRegion& b) {
 
   DlRegion res;
   res.span_buffer_.reserve(
-      std::max(a.span_buffer_.capacity(), b.span_buffer_.capacity()));
+      std::max(a.span_buffer_.size(), b.span_buffer_.size()));
 
   auto& lines = res.lines_;
   lines.reserve(std::min(a.lines_.size(), b.lines_.size()));
@@ -92,6 +92,7 @@ class DlRegion {
 
     void reserve(size_t capacity);
     size_t capacity() const { return capacity_; }
+    size_t size() const { return size_; }
 
     SpanChunkHandle storeChunk(const Span* begin, const Span* end);
     size_t getChunkSize(SpanChunkHandle handle) const;
@@ -322,6 +322,55 @@ TEST(DisplayListRegion, Union3) {
   EXPECT_EQ(rects, expected);
 }
 
+TEST(DisplayListRegion, UnionHorizontallyDisjointLines) {
+  DlRegion left({
+      DlIRect::MakeLTRB(0, 0, 10, 40),
+      DlIRect::MakeLTRB(20, 0, 30, 40),
+  });
+  DlRegion right({
+      DlIRect::MakeLTRB(40, 10, 50, 30),
+      DlIRect::MakeLTRB(60, 10, 70, 30),
+  });
+  std::vector<DlIRect> expected{
+      DlIRect::MakeLTRB(0, 0, 10, 10),   //
+      DlIRect::MakeLTRB(20, 0, 30, 10),  //
+      DlIRect::MakeLTRB(0, 10, 10, 30),  //
+      DlIRect::MakeLTRB(20, 10, 30, 30),
+      DlIRect::MakeLTRB(40, 10, 50, 30),
+      DlIRect::MakeLTRB(60, 10, 70, 30),
+      DlIRect::MakeLTRB(0, 30, 10, 40),
+      DlIRect::MakeLTRB(20, 30, 30, 40),
+  };
+  // Either operand order must produce the same spans.
+  EXPECT_EQ(DlRegion::MakeUnion(left, right).getRects(false), expected);
+  EXPECT_EQ(DlRegion::MakeUnion(right, left).getRects(false), expected);
+
+  // Touching spans are still merged.
+  DlRegion touching({
+      DlIRect::MakeLTRB(30, 0, 40, 40),
+  });
+  std::vector<DlIRect> merged{
+      DlIRect::MakeLTRB(0, 0, 10, 40),
+      DlIRect::MakeLTRB(20, 0, 40, 40),
+  };
+  EXPECT_EQ(DlRegion::MakeUnion(left, touching).getRects(), merged);
+  EXPECT_EQ(DlRegion::MakeUnion(touching, left).getRects(), merged);
+}
+
+TEST(DisplayListRegion, IntersectionHorizontallyDisjointLines) {
+  // The bounds overlap, but no line has spans that do.
+  DlRegion left({
+      DlIRect::MakeLTRB(0, 0, 10, 40),
+      DlIRect::MakeLTRB(40, 0, 50, 10),
+  });
+  DlRegion right({
+      DlIRect::MakeLTRB(20, 10, 30, 40),
+      DlIRect::MakeLTRB(60, 20, 70, 30),
+  });
+  EXPECT_TRUE(DlRegion::MakeIntersection(left, right).isEmpty());
+  EXPECT_TRUE(DlRegion::MakeIntersection(right, left).isEmpty());
+}
+
 TEST(DisplayListRegion, UnionEmpty) {
   {
     DlRegion region1(std::vector<DlIRect>{});
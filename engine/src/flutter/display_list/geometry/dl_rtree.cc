@@ -5,15 +5,66 @@
 #include "flutter/display_list/geometry/dl_rtree.h"
 #include "flutter/display_list/geometry/dl_region.h"
 
+#include <algorithm>
+#include <cmath>
+
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
 
 namespace flutter {
 
+namespace {
+
+// The Hilbert values are computed on a grid of this many cells along each
+// axis of the bounds of the R-Tree so that the values fit in 32 bits.
+constexpr uint32_t kHilbertGridSize = 1u << 16;
+
+// The number of leaves whose Hilbert values are computed by each task of a
+// parallel construction.
+constexpr uint32_t kHilbertChunkSize = 8192u;
+
+// Returns the distance along a Hilbert curve covering a |kHilbertGridSize|
+// square grid of the cell at |x|, |y|.
+uint32_t HilbertValue(uint32_t x, uint32_t y) {
+  uint32_t d = 0u;
+  for (uint32_t s = kHilbertGridSize / 2u; s > 0u; s /= 2u) {
+    uint32_t rx = (x & s) ? 1u : 0u;
+    uint32_t ry = (y & s) ? 1u : 0u;
+    d += s * s * ((3u * rx) ^ ry);
+    // Rotate the quadrant so that the curve segments within it connect.
+    if (ry == 0u) {
+      if (rx == 1u) {
+        x = kHilbertGridSize - 1u - x;
+        y = kHilbertGridSize - 1u - y;
+      }
+      std::swap(x, y);
+    }
+  }
+  return d;
+}
+
+uint32_t GridCell(DlScalar value, DlScalar origin, DlScalar scale) {
+  DlScalar cell = std::floor((value - origin) * scale);
+  // NaN fails both comparisons and maps to cell 0 along with underflows.
+  if (!(cell > 0.0f)) {
+    return 0u;
+  }
+  if (cell >= static_cast<DlScalar>(kHilbertGridSize - 1u)) {
+    return kHilbertGridSize - 1u;
+  }
+  return static_cast<uint32_t>(cell);
+}
+
+}  // namespace
+
 DlRTree::DlRTree(const DlRect rects[],
                  int N,
                  const int ids[],
                  bool p(int),
-                 int invalid_id)
+                 int invalid_id,
+                 Packing packing,
+                 const std::shared_ptr<fml::ConcurrentTaskRunner>& workers)
     : invalid_id_(invalid_id) {
   if (N <= 0) {
     FML_DCHECK(N >= 0);
@@ -61,6 +112,10 @@ DlRTree::DlRTree(const DlRect rects[],
   }
   FML_DCHECK(leaf_index == leaf_count);
 
+  if (packing == Packing::kHilbert && leaf_count > kMaxChildren) {
+    SortLeavesAlongHilbertCurve(workers);
+  }
+
   // --- Implementation note ---
   // Many R-Tree algorithms attempt to consolidate nearby rectangles
   // into branches of the tree in order to maximize the benefit of
@@ -77,6 +132,13 @@ DlRTree::DlRTree(const DlRect rects[],
   // are likely nearly sorted when they are delivered to this constructor
   // so leaving them in their original order should show similar results
   // to what Skia found in their empirical browser tests.
+  //
+  // Recordings with many thousands of operations, such as charts and map
+  // tiles, rarely follow that layout, so callers can opt in to sorting the
+  // leaves along a Hilbert curve (see |Packing::kHilbert|). A radix sort of
+  // the Hilbert values keeps that bulk load linear in the number of rects,
+  // which is why it was chosen over Sort-Tile-Recursive packing and its
+  // repeated comparison sorts.
   // ---
 
   // Continually process the previous level (generation) of nodes,
@@ -139,6 +201,87 @@ DlRTree::DlRTree(const DlRect rects[],
   FML_DCHECK(gen_start + gen_count == total_node_count);
 }
 
+void DlRTree::SortLeavesAlongHilbertCurve(
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& workers) {
+  const uint32_t leaf_count = leaf_count_;
+
+  DlRect world = nodes_[0].bounds;
+  for (uint32_t i = 1; i < leaf_count; i++) {
+    world = world.Union(nodes_[i].bounds);
+  }
+  DlScalar grid_max = static_cast<DlScalar>(kHilbertGridSize - 1u);
+  DlScalar width = world.GetWidth();
+  DlScalar height = world.GetHeight();
+  DlScalar scale_x = width > 0.0f ? grid_max / width : 0.0f;
+  DlScalar scale_y = height > 0.0f ? grid_max / height : 0.0f;
+  DlScalar origin_x = world.GetLeft();
+  DlScalar origin_y = world.GetTop();
+
+  std::vector<uint32_t> keys(leaf_count);
+  auto compute_keys = [this, &keys, origin_x, origin_y, scale_x, scale_y](
+                          uint32_t start, uint32_t end) {
+    for (uint32_t i = start; i < end; i++) {
+      DlPoint center = nodes_[i].bounds.GetCenter();
+      keys[i] = HilbertValue(GridCell(center.x, origin_x, scale_x),
+                             GridCell(center.y, origin_y, scale_y));
+    }
+  };
+
+  uint32_t chunk_count =
+      (leaf_count + kHilbertChunkSize - 1u) / kHilbertChunkSize;
+  if (workers && leaf_count_ >= kParallelLeafThreshold && chunk_count > 1u) {
+    // The calling thread computes the first chunk itself while the workers
+    // handle the rest. If the worker loop has already been terminated the
+    // task runner executes the posted tasks synchronously, so the latch is
+    // always released.
+    fml::CountDownLatch latch(chunk_count - 1u);
+    for (uint32_t chunk = 1u; chunk < chunk_count; chunk++) {
+      uint32_t start = chunk * kHilbertChunkSize;
+      uint32_t end = std::min(start + kHilbertChunkSize, leaf_count);
+      workers->PostTask([&compute_keys, &latch, start, end]() {
+        compute_keys(start, end);
+        latch.CountDown();
+      });
+    }
+    compute_keys(0u, std::min(kHilbertChunkSize, leaf_count));
+    latch.Wait();
+  } else {
+    compute_keys(0u, leaf_count);
+  }
+
+  // A stable least significant digit radix sort of the leaf positions by
+  // their Hilbert values, one byte at a time.
+  std::vector<uint32_t> order(leaf_count);
+  std::vector<uint32_t> scratch(leaf_count);
+  for (uint32_t i = 0; i < leaf_count; i++) {
+    order[i] = i;
+  }
+  for (uint32_t shift = 0u; shift < 32u; shift += 8u) {
+    uint32_t offsets[257] = {};
+    for (uint32_t i = 0; i < leaf_count; i++) {
+      offsets[((keys[i] >> shift) & 0xffu) + 1u]++;
+    }
+    if (offsets[((keys[0] >> shift) & 0xffu) + 1u] == leaf_count) {
+      // Every value shares this byte, nothing to reorder.
+      continue;
+    }
+    for (uint32_t b = 1u; b < 257u; b++) {
+      offsets[b] += offsets[b - 1u];
+    }
+    for (uint32_t leaf : order) {
+      scratch[offsets[(keys[leaf] >> shift) & 0xffu]++] = leaf;
+    }
+    order.swap(scratch);
+  }
+
+  std::vector<Node> sorted(leaf_count);
+  for (uint32_t i = 0; i < leaf_count; i++) {
+    sorted[i] = nodes_[order[i]];
+  }
+  std::copy(sorted.begin(), sorted.end(), nodes_.begin());
+  leaf_order_ = std::move(order);
+}
+
 void DlRTree::search(const DlRect& query, std::vector<int>* results) const {
   FML_DCHECK(results != nullptr);
   if (query.IsEmpty()) {
@@ -155,7 +298,16 @@ void DlRTree::search(const DlRect& query, std::vector<int>* results) const {
       // The root node is the only node and it is a leaf node
       results->push_back(0);
     } else {
+      size_t first_result = results->size();
       search(root, query, results);
+      if (!leaf_order_.empty()) {
+        // Leaves were reordered during construction, restore the order in
+        // which their rects were provided.
+        std::sort(results->begin() + first_result, results->end(),
+                  [this](int a, int b) {
+                    return leaf_order_[a] < leaf_order_[b];
+                  });
+      }
     }
   }
 }
@@ -6,6 +6,7 @@
 #define FLUTTER_DISPLAY_LIST_GEOMETRY_DL_RTREE_H_
 
 #include <list>
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -13,6 +14,10 @@
 #include "flutter/fml/logging.h"
 #include "third_party/skia/include/core/SkRefCnt.h"
 
+namespace fml {
+class ConcurrentTaskRunner;
+}  // namespace fml
+
 namespace flutter {
 
 /// An R-Tree that stores a list of bounding rectangles with optional
@@ -42,6 +47,25 @@ class DlRTree : public SkRefCnt {
   };
 
  public:
+  /// How the leaf rectangles are grouped under the internal nodes.
+  enum class Packing {
+    /// Group the rectangles in the order in which they were provided,
+    /// which is cheapest to build and works well for content that is
+    /// laid out in reading order.
+    kInsertionOrder,
+    /// Group the rectangles in the order of the Hilbert curve value of
+    /// their centers (a packed Hilbert R-Tree). This costs a linear-time
+    /// radix sort during construction and a sort of the results of each
+    /// search, but keeps sub-trees spatially tight for large recordings
+    /// whose operations are not drawn in any spatial order, such as
+    /// charts or map tiles.
+    kHilbert,
+  };
+
+  /// The minimum number of rectangles for which a |Packing::kHilbert|
+  /// construction will hand work to the |workers| task runner.
+  static constexpr int kParallelLeafThreshold = 16384;
+
   /// Construct an R-Tree from the list of rectangles respecting the
   /// order in which they appear in the list. An optional array of
   /// IDs can be provided to tag each rectangle with information needed
@@ -59,12 +83,19 @@ class DlRTree : public SkRefCnt {
   /// Duplicate rectangles and IDs are allowed and not processed in any
   /// way except to eliminate invalid rectangles and IDs that are rejected
   /// by the optional predicate function.
+  ///
+  /// Regardless of the |packing|, searches report rectangles in the order
+  /// in which they were provided. If |workers| is provided, a large
+  /// |Packing::kHilbert| construction computes the Hilbert values on those
+  /// workers while the calling thread waits for them.
   DlRTree(
       const DlRect rects[],
       int N,
       const int ids[] = nullptr,
       bool predicate(int id) = [](int) { return true; },
-      int invalid_id = -1);
+      int invalid_id = -1,
+      Packing packing = Packing::kInsertionOrder,
+      const std::shared_ptr<fml::ConcurrentTaskRunner>& workers = nullptr);
 
   /// Search the rectangles and return a vector of leaf node indices for
   /// rectangles that intersect the query.
@@ -100,7 +131,8 @@ class DlRTree : public SkRefCnt {
 
   /// Returns the bytes used by the object and all of its node data.
   size_t bytes_used() const {
-    return sizeof(DlRTree) + sizeof(Node) * nodes_.size();
+    return sizeof(DlRTree) + sizeof(Node) * nodes_.size() +
+           sizeof(uint32_t) * leaf_order_.size();
   }
 
   /// Returns the number of leaf nodes corresponding to non-empty
@@ -142,7 +174,14 @@ class DlRTree : public SkRefCnt {
               const DlRect& query,
               std::vector<int>* results) const;
 
+  void SortLeavesAlongHilbertCurve(
+      const std::shared_ptr<fml::ConcurrentTaskRunner>& workers);
+
   std::vector<Node> nodes_;
+  // For a |Packing::kHilbert| tree, the position in the original list of
+  // tracked rectangles of each leaf node. Empty for trees that keep their
+  // leaves in insertion order.
+  std::vector<uint32_t> leaf_order_;
   int leaf_count_ = 0;
   int invalid_id_;
   mutable std::optional<DlRegion> region_;
@@ -3,8 +3,11 @@
 // found in the LICENSE file.
 
 #include "flutter/display_list/geometry/dl_rtree.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "gtest/gtest.h"
 
+#include <algorithm>
+
 namespace flutter {
 namespace testing {
 
@@ -120,6 +123,115 @@ TEST(DisplayListRTree, HugeSize) {
   }
 }
 
+// A 200 x 100 grid of 8x8 rects on a 10 pixel pitch, listed in a
+// scrambled order so that their insertion order is not spatially coherent.
+static std::vector<DlRect> MakeScrambledGrid() {
+  const int N = 20000;
+  std::vector<DlRect> rects(N);
+  for (int i = 0; i < N; i++) {
+    int cell = static_cast<int>((i * 7919LL) % N);
+    rects[i] = DlRect::MakeXYWH((cell % 200) * 10, (cell / 200) * 10, 8, 8);
+  }
+  return rects;
+}
+
+static void TestSearchMatchesBruteForce(const DlRTree& tree,
+                                        const std::vector<DlRect>& rects,
+                                        const std::vector<int>& ids,
+                                        const DlRect& query) {
+  std::vector<int> expected;
+  for (size_t i = 0; i < rects.size(); i++) {
+    if (rects[i].IntersectsWithRect(query)) {
+      expected.push_back(ids[i]);
+    }
+  }
+  std::vector<int> results;
+  tree.search(query, &results);
+  std::vector<int> result_ids;
+  for (int index : results) {
+    result_ids.push_back(tree.id(index));
+  }
+  EXPECT_EQ(result_ids, expected) << query;
+}
+
+TEST(DisplayListRTree, HilbertPackingReportsInsertionOrder) {
+  std::vector<DlRect> rects = MakeScrambledGrid();
+  std::vector<int> ids(rects.size());
+  for (size_t i = 0; i < ids.size(); i++) {
+    ids[i] = static_cast<int>(i) * 2;
+  }
+  DlRTree tree(rects.data(), rects.size(), ids.data(),
+               [](int id) { return id % 3 != 0; }, -1,
+               DlRTree::Packing::kHilbert);
+  std::vector<DlRect> tracked_rects;
+  std::vector<int> tracked_ids;
+  for (size_t i = 0; i < ids.size(); i++) {
+    if (ids[i] % 3 != 0) {
+      tracked_rects.push_back(rects[i]);
+      tracked_ids.push_back(ids[i]);
+    }
+  }
+  EXPECT_EQ(tree.leaf_count(), static_cast<int>(tracked_ids.size()));
+  EXPECT_EQ(tree.bounds(), DlRect::MakeLTRB(0, 0, 1998, 998));
+
+  TestSearchMatchesBruteForce(tree, tracked_rects, tracked_ids,
+                              DlRect::MakeLTRB(0, 0, 2000, 1000));
+  TestSearchMatchesBruteForce(tree, tracked_rects, tracked_ids,
+                              DlRect::MakeLTRB(95, 45, 315, 205));
+  TestSearchMatchesBruteForce(tree, tracked_rects, tracked_ids,
+                              DlRect::MakeLTRB(1002, 502, 1007, 507));
+  TestSearchMatchesBruteForce(tree, tracked_rects, tracked_ids,
+                              DlRect::MakeLTRB(1008, 508, 1010, 510));
+}
+
+TEST(DisplayListRTree, HilbertPackingGroupsNearbyRects) {
+  std::vector<DlRect> rects = MakeScrambledGrid();
+  DlRTree ordered(rects.data(), rects.size());
+  DlRTree packed(rects.data(), rects.size(), nullptr,
+                 [](int) { return true; }, -1, DlRTree::Packing::kHilbert);
+  EXPECT_EQ(ordered.node_count(), packed.node_count());
+  EXPECT_GT(packed.bytes_used(), ordered.bytes_used());
+
+  // The total area of the leaf parents bounds a scrambled insertion order
+  // close to the whole grid for each of them, while sorting along the curve
+  // keeps each parent to a small neighborhood.
+  DlScalar ordered_area = 0.0f;
+  DlScalar packed_area = 0.0f;
+  for (int i = 0; i < static_cast<int>(rects.size()); i += 11) {
+    DlRect ordered_parent = ordered.bounds(i);
+    DlRect packed_parent = packed.bounds(i);
+    for (int j = i + 1; j < std::min<int>(i + 11, rects.size()); j++) {
+      ordered_parent = ordered_parent.Union(ordered.bounds(j));
+      packed_parent = packed_parent.Union(packed.bounds(j));
+    }
+    ordered_area += ordered_parent.GetWidth() * ordered_parent.GetHeight();
+    packed_area += packed_parent.GetWidth() * packed_parent.GetHeight();
+  }
+  EXPECT_LT(packed_area * 100.0f, ordered_area);
+}
+
+TEST(DisplayListRTree, ParallelHilbertPackingMatchesSerial) {
+  std::vector<DlRect> rects = MakeScrambledGrid();
+  ASSERT_GE(static_cast<int>(rects.size()), DlRTree::kParallelLeafThreshold);
+  std::vector<int> ids(rects.size());
+  for (size_t i = 0; i < ids.size(); i++) {
+    ids[i] = static_cast<int>(i);
+  }
+  auto loop = fml::ConcurrentMessageLoop::Create(2);
+  DlRTree serial(rects.data(), rects.size(), ids.data(),
+                 [](int) { return true; }, -1, DlRTree::Packing::kHilbert);
+  DlRTree parallel(rects.data(), rects.size(), ids.data(),
+                   [](int) { return true; }, -1, DlRTree::Packing::kHilbert,
+                   loop->GetTaskRunner());
+  ASSERT_EQ(serial.node_count(), parallel.node_count());
+  for (int i = 0; i < serial.leaf_count(); i++) {
+    EXPECT_EQ(serial.id(i), parallel.id(i));
+    EXPECT_EQ(serial.bounds(i), parallel.bounds(i));
+  }
+  TestSearchMatchesBruteForce(parallel, rects, ids,
+                              DlRect::MakeLTRB(505, 305, 1215, 655));
+}
+
 TEST(DisplayListRTree, Grid) {
   // Non-overlapping 10 x 10 rectangles starting at 5, 5 with
   // 10 pixels between them.
@@ -10,6 +10,7 @@
 #include "flutter/display_list/geometry/dl_geometry_conversions.h"
 #include "flutter/display_list/skia/dl_sk_conversions.h"
 #include "flutter/display_list/skia/dl_sk_dispatcher.h"
+#include "flutter/display_list/skia/dl_sk_picture_cache.h"
 #include "flutter/fml/trace_event.h"
 
 #include "third_party/skia/include/core/SkColorFilter.h"
@@ -334,6 +335,17 @@ void DlSkCanvasAdapter::DrawAtlas(const sk_sp<DlImage>& atlas,
 
 void DlSkCanvasAdapter::DrawDisplayList(const sk_sp<DisplayList> display_list,
                                         SkScalar opacity) {
+  // Pictures can only be drawn with an opacity through a save layer, which
+  // DisplayLists that apply group opacity don't need, so only opaque draws
+  // use the cache.
+  if (picture_cache_ && opacity >= SK_Scalar1) {
+    sk_sp<SkPicture> picture = picture_cache_->GetPicture(display_list);
+    if (picture) {
+      delegate_->drawPicture(picture);
+      return;
+    }
+  }
+
   const int restore_count = delegate_->getSaveCount();
 
   // Figure out whether we can apply the opacity during dispatch or
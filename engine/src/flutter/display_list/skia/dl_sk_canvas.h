@@ -16,6 +16,8 @@ class TextFrame;
 
 namespace flutter {
 
+class DlSkPictureCache;
+
 // -----------------------------------------------------------------------------
 /// @brief      Backend implementation of |DlCanvas| for |SkCanvas|.
 ///
@@ -29,6 +31,10 @@ class DlSkCanvasAdapter final : public virtual DlCanvas {
   void set_canvas(SkCanvas* canvas);
   SkCanvas* canvas() { return delegate_; }
 
+  /// Draw the DisplayLists that are stable across frames as the pictures of
+  /// |cache| instead of dispatching them. The cache must outlive this canvas.
+  void set_picture_cache(DlSkPictureCache* cache) { picture_cache_ = cache; }
+
   DlISize GetBaseLayerDimensions() const override;
   SkImageInfo GetImageInfo() const override;
 
@@ -166,6 +172,7 @@ class DlSkCanvasAdapter final : public virtual DlCanvas {
 
  private:
   SkCanvas* delegate_;
+  DlSkPictureCache* picture_cache_ = nullptr;
 };
 
 }  // namespace flutter
@@ -0,0 +1,81 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if !SLIMPELLER
+
+#include "flutter/display_list/skia/dl_sk_picture_cache.h"
+
+#include "flutter/display_list/geometry/dl_geometry_conversions.h"
+#include "flutter/display_list/skia/dl_sk_dispatcher.h"
+#include "flutter/fml/trace_event.h"
+
+#include "third_party/skia/include/core/SkBBHFactory.h"
+#include "third_party/skia/include/core/SkPictureRecorder.h"
+
+namespace flutter {
+
+namespace {
+
+sk_sp<SkPicture> RecordPicture(const sk_sp<DisplayList>& display_list) {
+  TRACE_EVENT0("flutter", "DlSkPictureCache::RecordPicture");
+  SkRTreeFactory rtree_factory;
+  SkPictureRecorder recorder;
+  SkCanvas* canvas = recorder.beginRecording(
+      ToSkRect(display_list->GetBounds()),
+      display_list->has_rtree() ? &rtree_factory : nullptr);
+  DlSkCanvasDispatcher dispatcher(canvas);
+  display_list->Dispatch(dispatcher);
+  return recorder.finishRecordingAsPicture();
+}
+
+}  // namespace
+
+DlSkPictureCache::DlSkPictureCache() = default;
+
+DlSkPictureCache::~DlSkPictureCache() = default;
+
+sk_sp<SkPicture> DlSkPictureCache::GetPicture(
+    const sk_sp<DisplayList>& display_list) {
+  // A picture culls its ops to its bounds, which an unbounded DisplayList
+  // doesn't have.
+  if (!display_list || display_list->root_is_unbounded() ||
+      display_list->GetBounds().IsEmpty()) {
+    return nullptr;
+  }
+
+  Entry& entry = entries_[display_list->unique_id()];
+  if (entry.access_count == 0 || entry.last_frame != frame_) {
+    entry.last_frame = frame_;
+    entry.access_count++;
+  }
+  if (!entry.picture && entry.access_count >= kAccessThreshold) {
+    entry.picture = RecordPicture(display_list);
+  }
+  return entry.picture;
+}
+
+void DlSkPictureCache::EndFrame() {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (it->second.last_frame != frame_) {
+      it = entries_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  frame_++;
+}
+
+size_t DlSkPictureCache::GetPictureCount() const {
+  size_t count = 0;
+  for (const auto& [id, entry] : entries_) {
+    if (entry.picture) {
+      count++;
+    }
+  }
+  return count;
+}
+
+}  // namespace flutter
+
+#endif  //  !SLIMPELLER
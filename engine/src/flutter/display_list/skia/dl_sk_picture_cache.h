@@ -0,0 +1,77 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_SKIA_DL_SK_PICTURE_CACHE_H_
+#define FLUTTER_DISPLAY_LIST_SKIA_DL_SK_PICTURE_CACHE_H_
+
+#if !SLIMPELLER
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "flutter/display_list/display_list.h"
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkPicture.h"
+
+namespace flutter {
+
+// -----------------------------------------------------------------------------
+/// @brief      Caches the |SkPicture|s recorded from the DisplayLists that are
+///             drawn in consecutive frames, so that the Skia backend replays
+///             them with the optimizations of SkPicture playback rather than
+///             dispatching every op again.
+///
+///             Entries are keyed by |DisplayList::unique_id| and are dropped
+///             at the end of the first frame that doesn't draw them, so the
+///             cache never holds more than the DisplayLists of one frame.
+///
+/// @see        DlSkCanvasAdapter::set_picture_cache
+class DlSkPictureCache {
+ public:
+  /// The number of consecutive frames a DisplayList has to be drawn in before
+  /// a picture is recorded for it.
+  static constexpr int kAccessThreshold = 3;
+
+  DlSkPictureCache();
+
+  ~DlSkPictureCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Record that |display_list| is drawn in this frame.
+  ///
+  /// @return     The picture to draw instead of dispatching |display_list|,
+  ///             or nullptr if it hasn't been stable for long enough or
+  ///             can't be recorded into a picture.
+  ///
+  sk_sp<SkPicture> GetPicture(const sk_sp<DisplayList>& display_list);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Drop the entries of the DisplayLists that weren't drawn in
+  ///             this frame.
+  ///
+  void EndFrame();
+
+  //----------------------------------------------------------------------------
+  /// @return     The number of pictures currently cached.
+  ///
+  size_t GetPictureCount() const;
+
+ private:
+  struct Entry {
+    uint64_t last_frame = 0;
+    int access_count = 0;
+    sk_sp<SkPicture> picture;
+  };
+
+  uint64_t frame_ = 0;
+  std::unordered_map<uint32_t, Entry> entries_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DlSkPictureCache);
+};
+
+}  // namespace flutter
+
+#endif  //  !SLIMPELLER
+
+#endif  // FLUTTER_DISPLAY_LIST_SKIA_DL_SK_PICTURE_CACHE_H_
@@ -0,0 +1,73 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/skia/dl_sk_picture_cache.h"
+
+#include "flutter/display_list/dl_builder.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+sk_sp<DisplayList> MakeDisplayList() {
+  DisplayListBuilder builder;
+  builder.DrawRect(DlRect::MakeLTRB(10, 10, 20, 20), DlPaint());
+  return builder.Build();
+}
+
+}  // namespace
+
+TEST(DlSkPictureCache, RecordsPictureAfterConsecutiveFrames) {
+  DlSkPictureCache cache;
+  sk_sp<DisplayList> display_list = MakeDisplayList();
+
+  for (int i = 1; i < DlSkPictureCache::kAccessThreshold; i++) {
+    EXPECT_EQ(cache.GetPicture(display_list), nullptr);
+    // Drawing the same list twice in a frame counts once.
+    EXPECT_EQ(cache.GetPicture(display_list), nullptr);
+    cache.EndFrame();
+  }
+
+  sk_sp<SkPicture> picture = cache.GetPicture(display_list);
+  ASSERT_NE(picture, nullptr);
+  EXPECT_EQ(picture->cullRect(), SkRect::MakeLTRB(10, 10, 20, 20));
+  EXPECT_EQ(cache.GetPictureCount(), 1u);
+  cache.EndFrame();
+
+  EXPECT_EQ(cache.GetPicture(display_list), picture);
+}
+
+TEST(DlSkPictureCache, DropsPicturesNotDrawnInAFrame) {
+  DlSkPictureCache cache;
+  sk_sp<DisplayList> display_list = MakeDisplayList();
+
+  for (int i = 0; i < DlSkPictureCache::kAccessThreshold; i++) {
+    cache.GetPicture(display_list);
+    cache.EndFrame();
+  }
+  EXPECT_EQ(cache.GetPictureCount(), 1u);
+
+  cache.EndFrame();
+  EXPECT_EQ(cache.GetPictureCount(), 0u);
+  EXPECT_EQ(cache.GetPicture(display_list), nullptr);
+}
+
+TEST(DlSkPictureCache, IgnoresUnboundedDisplayLists) {
+  DlSkPictureCache cache;
+  DisplayListBuilder builder;
+  builder.DrawPaint(DlPaint());
+  sk_sp<DisplayList> display_list = builder.Build();
+  ASSERT_TRUE(display_list->root_is_unbounded());
+
+  for (int i = 0; i < DlSkPictureCache::kAccessThreshold; i++) {
+    EXPECT_EQ(cache.GetPicture(display_list), nullptr);
+    cache.EndFrame();
+  }
+  EXPECT_EQ(cache.GetPictureCount(), 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -10,6 +10,7 @@ void AccumulationRect::accumulate(DlScalar x, DlScalar y) {
   if (!std::isfinite(x) || !std::isfinite(y)) {
     return;
   }
+  tracking_disjoint_rects_ = false;
   if (x >= min_x_ && x < max_x_ && y >= min_y_ && y < max_y_) {
     record_overlapping_bounds();
     return;
@@ -32,10 +33,7 @@ void AccumulationRect::accumulate(DlRect r) {
   if (r.IsEmpty()) {
     return;
   }
-  if (r.GetLeft() < max_x_ && r.GetRight() > min_x_ &&  //
-      r.GetTop() < max_y_ && r.GetBottom() > min_y_) {
-    record_overlapping_bounds();
-  }
+  AccumulateDisjoint(r);
   if (min_x_ > r.GetLeft()) {
     min_x_ = r.GetLeft();
   }
@@ -54,10 +52,7 @@ void AccumulationRect::accumulate(AccumulationRect& ar) {
   if (ar.is_empty()) {
     return;
   }
-  if (ar.min_x_ < max_x_ && ar.max_x_ > min_x_ &&  //
-      ar.min_y_ < max_y_ && ar.max_y_ > min_y_) {
-    record_overlapping_bounds();
-  }
+  AccumulateDisjoint(ar.GetBounds());
   if (min_x_ > ar.min_x_) {
     min_x_ = ar.min_x_;
   }
@@ -84,6 +79,41 @@ void AccumulationRect::reset() {
   max_x_ = -std::numeric_limits<DlScalar>::infinity();
   max_y_ = -std::numeric_limits<DlScalar>::infinity();
   overlap_detected_ = false;
+  disjoint_rects_.clear();
+  tracking_disjoint_rects_ = max_disjoint_rects_ > 0;
+}
+
+void AccumulationRect::AccumulateDisjoint(const DlRect& r) {
+  if (r.GetLeft() < max_x_ && r.GetRight() > min_x_ &&  //
+      r.GetTop() < max_y_ && r.GetBottom() > min_y_) {
+    bool overlaps = true;
+    if (tracking_disjoint_rects_) {
+      overlaps = false;
+      for (const DlRect& disjoint : disjoint_rects_) {
+        if (r.GetLeft() < disjoint.GetRight() &&
+            r.GetRight() > disjoint.GetLeft() &&
+            r.GetTop() < disjoint.GetBottom() &&
+            r.GetBottom() > disjoint.GetTop()) {
+          overlaps = true;
+          break;
+        }
+      }
+    }
+    if (overlaps) {
+      record_overlapping_bounds();
+      // Once an overlap is detected the rects are of no further use.
+      tracking_disjoint_rects_ = false;
+      disjoint_rects_.clear();
+    }
+  }
+  if (tracking_disjoint_rects_) {
+    if (disjoint_rects_.size() < max_disjoint_rects_) {
+      disjoint_rects_.push_back(r);
+    } else {
+      tracking_disjoint_rects_ = false;
+      disjoint_rects_.clear();
+    }
+  }
 }
 
 }  // namespace flutter
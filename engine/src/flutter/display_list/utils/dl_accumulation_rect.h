@@ -5,6 +5,8 @@
 #ifndef FLUTTER_DISPLAY_LIST_UTILS_DL_ACCUMULATION_RECT_H_
 #define FLUTTER_DISPLAY_LIST_UTILS_DL_ACCUMULATION_RECT_H_
 
+#include <vector>
+
 #include "flutter/display_list/geometry/dl_geometry_types.h"
 
 namespace flutter {
@@ -18,9 +20,23 @@ namespace flutter {
 // as long as they are built out from the center in the right order. True
 // detection of non-overlapping objects would require much more time and/or
 // space.
+//
+// An accumulator can optionally remember a bounded number of the rects it
+// accumulated. A new rect that intersects the accumulated bounds is then
+// only reported as an overlap if it intersects one of the remembered rects,
+// which proves the disjointness of arbitrary arrangements, such as a grid
+// or the rows of a list, as long as they consist of few enough rects.
 class AccumulationRect {
  public:
-  AccumulationRect() { reset(); }
+  AccumulationRect() : AccumulationRect(0u) {}
+
+  // An accumulator that remembers up to |max_disjoint_rects| rects to test
+  // new rects against before reporting an overlap. Accumulating a point or
+  // more rects than that falls back to testing against the bounds.
+  explicit AccumulationRect(size_t max_disjoint_rects)
+      : max_disjoint_rects_(max_disjoint_rects) {
+    reset();
+  }
 
   void accumulate(DlScalar x, DlScalar y);
   void accumulate(DlPoint p) { accumulate(p.x, p.y); }
@@ -43,6 +59,14 @@ class AccumulationRect {
   DlScalar max_x_;
   DlScalar max_y_;
   bool overlap_detected_;
+
+  const size_t max_disjoint_rects_;
+  // The rects accumulated so far, as long as they are known to be disjoint
+  // and there are no more than |max_disjoint_rects_| of them.
+  std::vector<DlRect> disjoint_rects_;
+  bool tracking_disjoint_rects_;
+
+  void AccumulateDisjoint(const DlRect& r);
 };
 
 }  // namespace flutter
@@ -234,5 +234,61 @@ TEST(DisplayListAccumulationRect, TwoRects) {
        false, true, "Overlapping");
 }
 
+TEST(DisplayListAccumulationRect, DisjointRects) {
+  // An L shape of rects, the last of which intersects the bounds of the
+  // first two but neither of the rects themselves.
+  DlRect rects[] = {
+      DlRect::MakeLTRB(0.0f, 0.0f, 10.0f, 10.0f),
+      DlRect::MakeLTRB(10.0f, 0.0f, 20.0f, 10.0f),
+      DlRect::MakeLTRB(0.0f, 10.0f, 10.0f, 20.0f),
+      DlRect::MakeLTRB(15.0f, 15.0f, 20.0f, 20.0f),
+  };
+
+  {
+    AccumulationRect accumulator;
+    for (const DlRect& rect : rects) {
+      accumulator.accumulate(rect);
+    }
+    EXPECT_TRUE(accumulator.overlap_detected());
+  }
+
+  {
+    AccumulationRect accumulator(4u);
+    for (const DlRect& rect : rects) {
+      accumulator.accumulate(rect);
+    }
+    EXPECT_FALSE(accumulator.overlap_detected());
+    EXPECT_EQ(accumulator.GetBounds(), DlRect::MakeLTRB(0, 0, 20, 20));
+
+    accumulator.accumulate(DlRect::MakeLTRB(5.0f, 5.0f, 15.0f, 15.0f));
+    EXPECT_TRUE(accumulator.overlap_detected());
+
+    accumulator.reset();
+    for (const DlRect& rect : rects) {
+      accumulator.accumulate(rect);
+    }
+    EXPECT_FALSE(accumulator.overlap_detected());
+  }
+
+  {
+    // More rects than are remembered fall back to the bounds.
+    AccumulationRect accumulator(2u);
+    for (const DlRect& rect : rects) {
+      accumulator.accumulate(rect);
+    }
+    EXPECT_TRUE(accumulator.overlap_detected());
+  }
+
+  {
+    // As does accumulating a point.
+    AccumulationRect accumulator(4u);
+    accumulator.accumulate(DlPoint(100.0f, 100.0f));
+    for (const DlRect& rect : rects) {
+      accumulator.accumulate(rect);
+    }
+    EXPECT_TRUE(accumulator.overlap_detected());
+  }
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -0,0 +1,55 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/utils/dl_interner.h"
+
+#include <algorithm>
+
+namespace flutter {
+
+static bool AreInterchangeable(const DisplayList& a, const DisplayList& b) {
+  return a.GetBounds() == b.GetBounds() && a.has_rtree() == b.has_rtree() &&
+         a.Equals(b);
+}
+
+sk_sp<DisplayList> DisplayListInterner::Intern(
+    const sk_sp<DisplayList>& display_list) {
+  if (!display_list) {
+    return display_list;
+  }
+  auto& bucket = lists_[display_list->content_hash()];
+  for (const sk_sp<DisplayList>& interned : bucket) {
+    if (AreInterchangeable(*interned, *display_list)) {
+      return interned;
+    }
+  }
+  bucket.push_back(display_list);
+  size_++;
+  return display_list;
+}
+
+void DisplayListInterner::Purge() {
+  for (auto it = lists_.begin(); it != lists_.end();) {
+    auto& bucket = it->second;
+    size_t count = bucket.size();
+    bucket.erase(std::remove_if(bucket.begin(), bucket.end(),
+                                [](const sk_sp<DisplayList>& display_list) {
+                                  return display_list->unique();
+                                }),
+                 bucket.end());
+    size_ -= count - bucket.size();
+    if (bucket.empty()) {
+      it = lists_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void DisplayListInterner::Clear() {
+  lists_.clear();
+  size_ = 0u;
+}
+
+}  // namespace flutter
@@ -0,0 +1,55 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_UTILS_DL_INTERNER_H_
+#define FLUTTER_DISPLAY_LIST_UTILS_DL_INTERNER_H_
+
+#include <unordered_map>
+#include <vector>
+
+#include "flutter/display_list/display_list.h"
+
+namespace flutter {
+
+// Utility class to share a single instance among DisplayList objects with
+// equal contents.
+//
+// Lists are looked up by their |DisplayList::content_hash| and then
+// verified with |DisplayList::Equals|, along with the bounds and RTree
+// presence that a renderer may consult. Since equal lists collapse to a
+// single instance, they also present a single |DisplayList::unique_id| to
+// any caches keyed on it, such as the RasterCache.
+//
+// The interner holds a reference to every list it returns. Lists that are
+// no longer referenced from anywhere else are released by |Purge|.
+//
+// This class is not thread safe.
+class DisplayListInterner {
+ public:
+  DisplayListInterner() = default;
+
+  // Returns a previously interned list that is equal to |display_list|,
+  // or records |display_list| and returns it if there was none.
+  sk_sp<DisplayList> Intern(const sk_sp<DisplayList>& display_list);
+
+  // Releases every interned list that is only referenced by this interner.
+  void Purge();
+
+  // Releases all interned lists.
+  void Clear();
+
+  // The number of interned lists.
+  size_t size() const { return size_; }
+
+ private:
+  std::unordered_map<size_t, std::vector<sk_sp<DisplayList>>> lists_;
+  size_t size_ = 0u;
+
+  DisplayListInterner(const DisplayListInterner&) = delete;
+  DisplayListInterner& operator=(const DisplayListInterner&) = delete;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_UTILS_DL_INTERNER_H_
@@ -0,0 +1,75 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/utils/dl_interner.h"
+#include "flutter/display_list/dl_builder.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+static sk_sp<DisplayList> MakeIcon(DlColor color) {
+  DisplayListBuilder builder;
+  builder.DrawRect(DlRect::MakeLTRB(0, 0, 10, 10), DlPaint(color));
+  builder.DrawCircle(DlPoint(5, 5), 3, DlPaint());
+  return builder.Build();
+}
+
+TEST(DisplayListInterner, EqualListsAreShared) {
+  DisplayListInterner interner;
+  auto icon1 = MakeIcon(DlColor::kBlue());
+  auto icon2 = MakeIcon(DlColor::kBlue());
+  ASSERT_NE(icon1.get(), icon2.get());
+  ASSERT_NE(icon1->unique_id(), icon2->unique_id());
+
+  EXPECT_EQ(interner.Intern(icon1).get(), icon1.get());
+  EXPECT_EQ(interner.Intern(icon2).get(), icon1.get());
+  EXPECT_EQ(interner.size(), 1u);
+}
+
+TEST(DisplayListInterner, DifferentListsAreKept) {
+  DisplayListInterner interner;
+  auto blue = MakeIcon(DlColor::kBlue());
+  auto red = MakeIcon(DlColor::kRed());
+
+  EXPECT_EQ(interner.Intern(blue).get(), blue.get());
+  EXPECT_EQ(interner.Intern(red).get(), red.get());
+  EXPECT_EQ(interner.size(), 2u);
+}
+
+TEST(DisplayListInterner, ListsWithDifferentBoundsAreKept) {
+  DisplayListInterner interner;
+  auto icon = MakeIcon(DlColor::kBlue());
+
+  // The same ops recorded with a cull rect produce tighter bounds.
+  DisplayListBuilder builder(DlRect::MakeLTRB(0, 0, 5, 5));
+  builder.DrawRect(DlRect::MakeLTRB(0, 0, 10, 10),
+                   DlPaint(DlColor::kBlue()));
+  builder.DrawCircle(DlPoint(5, 5), 3, DlPaint());
+  auto culled = builder.Build();
+  ASSERT_TRUE(culled->Equals(icon));
+  ASSERT_NE(culled->GetBounds(), icon->GetBounds());
+
+  EXPECT_EQ(interner.Intern(icon).get(), icon.get());
+  EXPECT_EQ(interner.Intern(culled).get(), culled.get());
+  EXPECT_EQ(interner.size(), 2u);
+}
+
+TEST(DisplayListInterner, PurgeReleasesUnreferencedLists) {
+  DisplayListInterner interner;
+  auto kept = MakeIcon(DlColor::kBlue());
+  interner.Intern(kept);
+  interner.Intern(MakeIcon(DlColor::kRed()));
+  EXPECT_EQ(interner.size(), 2u);
+
+  interner.Purge();
+  EXPECT_EQ(interner.size(), 1u);
+  EXPECT_EQ(interner.Intern(MakeIcon(DlColor::kBlue())).get(), kept.get());
+
+  interner.Clear();
+  EXPECT_EQ(interner.size(), 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
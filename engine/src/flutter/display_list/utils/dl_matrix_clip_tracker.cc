@@ -19,12 +19,37 @@ static const DlRect& ProtectEmpty(const DlRect& rect) {
 
 DisplayListMatrixClipState::DisplayListMatrixClipState(const DlRect& cull_rect,
                                                        const DlMatrix& matrix)
-    : cull_rect_(ProtectEmpty(cull_rect)), matrix_(matrix) {}
+    : cull_rect_(ProtectEmpty(cull_rect)),
+      matrix_(matrix),
+      matrix_kind_(Classify(matrix)) {}
+
+DisplayListMatrixClipState::MatrixKind DisplayListMatrixClipState::Classify(
+    const DlMatrix& matrix) {
+  // Only the x/y scale and translation entries may differ from the
+  // identity, in particular the z row and column must be untouched so
+  // that the invertibility and perspective shortcuts hold.
+  // clang-format off
+  if (matrix.m[1]  == 0.0f && matrix.m[2]  == 0.0f && matrix.m[3]  == 0.0f &&
+      matrix.m[4]  == 0.0f && matrix.m[6]  == 0.0f && matrix.m[7]  == 0.0f &&
+      matrix.m[8]  == 0.0f && matrix.m[9]  == 0.0f && matrix.m[10] == 1.0f &&
+      matrix.m[11] == 0.0f && matrix.m[14] == 0.0f && matrix.m[15] == 1.0f) {
+    // clang-format on
+    if (matrix.m[0] == 1.0f && matrix.m[5] == 1.0f) {
+      return MatrixKind::kTranslate;
+    }
+    return MatrixKind::kScaleTranslate;
+  }
+  return MatrixKind::kGeneral;
+}
 
 bool DisplayListMatrixClipState::inverseTransform(
     const DisplayListMatrixClipState& tracker) {
+  if (tracker.matrix_kind_ == MatrixKind::kTranslate) {
+    translate(-tracker.matrix_.m[12], -tracker.matrix_.m[13]);
+    return true;
+  }
   if (tracker.is_matrix_invertable()) {
-    matrix_ = matrix_ * tracker.matrix_.Invert();
+    transform(tracker.matrix_.Invert());
     return true;
   }
   return false;
@@ -32,7 +57,18 @@ bool DisplayListMatrixClipState::inverseTransform(
 
 bool DisplayListMatrixClipState::mapAndClipRect(const DlRect& src,
                                                 DlRect* mapped) const {
-  DlRect dl_mapped = src.TransformAndClipBounds(matrix_);
+  DlRect dl_mapped;
+  switch (matrix_kind_) {
+    case MatrixKind::kTranslate:
+      dl_mapped = MapRect<MatrixKind::kTranslate>(src, matrix_);
+      break;
+    case MatrixKind::kScaleTranslate:
+      dl_mapped = MapRect<MatrixKind::kScaleTranslate>(src, matrix_);
+      break;
+    case MatrixKind::kGeneral:
+      dl_mapped = MapRect<MatrixKind::kGeneral>(src, matrix_);
+      break;
+  }
   auto dl_intersected = dl_mapped.Intersection(cull_rect_);
   if (dl_intersected.has_value()) {
     *mapped = dl_intersected.value();
@@ -239,6 +275,9 @@ DlRect DisplayListMatrixClipState::GetLocalCullCoverage() const {
   if (!is_matrix_invertable()) {
     return DlRect();
   }
+  if (matrix_kind_ == MatrixKind::kTranslate) {
+    return cull_rect_.Shift(-matrix_.m[12], -matrix_.m[13]);
+  }
   if (matrix_.HasPerspective2D()) {
     // We could do a 4-point long-form conversion, but since this is
     // only used for culling, let's just return a non-constricting
@@ -5,6 +5,7 @@
 #ifndef FLUTTER_DISPLAY_LIST_UTILS_DL_MATRIX_CLIP_TRACKER_H_
 #define FLUTTER_DISPLAY_LIST_UTILS_DL_MATRIX_CLIP_TRACKER_H_
 
+#include <algorithm>
 #include <vector>
 
 #include "flutter/display_list/dl_canvas.h"
@@ -32,9 +33,36 @@ class DisplayListMatrixClipState {
   void resetDeviceCullRect(const DlRect& cull_rect);
   void resetLocalCullRect(const DlRect& cull_rect);
 
+  /// The shape of the current matrix as far as the bounds computations
+  /// are concerned. Most content is recorded under translate-only or
+  /// scale-translate transforms, for which rects can be mapped with a
+  /// couple of multiply-adds instead of a full 4x4 transform of 4 points.
+  enum class MatrixKind {
+    /// The identity or a 2D translation.
+    kTranslate,
+    /// A 2D scale (possibly negative or zero) followed by a translation.
+    kScaleTranslate,
+    /// Anything else, including all rotations, skews and perspective.
+    kGeneral,
+  };
+
+  MatrixKind matrix_kind() const { return matrix_kind_; }
+
   bool using_4x4_matrix() const { return !matrix_.IsAffine(); }
-  bool is_matrix_invertable() const { return matrix_.IsInvertible(); }
-  bool has_perspective() const { return matrix_.HasPerspective(); }
+  bool is_matrix_invertable() const {
+    switch (matrix_kind_) {
+      case MatrixKind::kTranslate:
+        return true;
+      case MatrixKind::kScaleTranslate:
+        return matrix_.m[0] != 0.0f && matrix_.m[5] != 0.0f;
+      case MatrixKind::kGeneral:
+        return matrix_.IsInvertible();
+    }
+    FML_UNREACHABLE();
+  }
+  bool has_perspective() const {
+    return matrix_kind_ == MatrixKind::kGeneral && matrix_.HasPerspective();
+  }
 
   const DlMatrix& matrix() const { return matrix_; }
 
@@ -49,19 +77,29 @@ class DisplayListMatrixClipState {
   bool content_culled(const DlRect& content_bounds) const;
   bool is_cull_rect_empty() const { return cull_rect_.IsEmpty(); }
 
+  // Translating or scaling never changes a matrix into a more general
+  // kind than kScaleTranslate, so those two skip the classification.
   void translate(DlScalar tx, DlScalar ty) {
     matrix_ = matrix_.Translate({tx, ty});
   }
   void scale(DlScalar sx, DlScalar sy) {
     matrix_ = matrix_.Scale({sx, sy, 1.0f});
+    if (matrix_kind_ == MatrixKind::kTranslate) {
+      matrix_kind_ = MatrixKind::kScaleTranslate;
+    }
   }
   void skew(DlScalar skx, DlScalar sky) {
     matrix_ = matrix_ * DlMatrix::MakeSkew(skx, sky);
+    matrix_kind_ = Classify(matrix_);
   }
   void rotate(DlRadians angle) {
     matrix_ = matrix_ * DlMatrix::MakeRotationZ(angle);
+    matrix_kind_ = Classify(matrix_);
+  }
+  void transform(const DlMatrix& matrix) {
+    matrix_ = matrix_ * matrix;
+    matrix_kind_ = Classify(matrix_);
   }
-  void transform(const DlMatrix& matrix) { matrix_ = matrix_ * matrix; }
   // clang-format off
   void transform2DAffine(
       DlScalar mxx, DlScalar mxy, DlScalar mxt,
@@ -72,6 +110,7 @@ class DisplayListMatrixClipState {
         0.0f, 0.0f, 1.0f, 0.0f,
          mxt,  myt, 0.0f, 1.0f
     );
+    matrix_kind_ = Classify(matrix_);
   }
   void transformFullPerspective(
       DlScalar mxx, DlScalar mxy, DlScalar mxz, DlScalar mxt,
@@ -84,10 +123,17 @@ class DisplayListMatrixClipState {
         mxz, myz, mzz, mwz,
         mxt, myt, mzt, mwt
     );
+    matrix_kind_ = Classify(matrix_);
   }
   // clang-format on
-  void setTransform(const DlMatrix& matrix) { matrix_ = matrix; }
-  void setIdentity() { matrix_ = DlMatrix(); }
+  void setTransform(const DlMatrix& matrix) {
+    matrix_ = matrix;
+    matrix_kind_ = Classify(matrix_);
+  }
+  void setIdentity() {
+    matrix_ = DlMatrix();
+    matrix_kind_ = MatrixKind::kTranslate;
+  }
   // If the matrix in |other_tracker| is invertible then transform this
   // tracker by the inverse of its matrix and return true. Otherwise,
   // return false and leave this tracker unmodified.
@@ -95,8 +141,18 @@ class DisplayListMatrixClipState {
 
   bool mapRect(DlRect* rect) const { return mapRect(*rect, rect); }
   bool mapRect(const DlRect& src, DlRect* mapped) const {
-    *mapped = src.TransformAndClipBounds(matrix_);
-    return matrix_.IsAligned2D();
+    switch (matrix_kind_) {
+      case MatrixKind::kTranslate:
+        *mapped = MapRect<MatrixKind::kTranslate>(src, matrix_);
+        return true;
+      case MatrixKind::kScaleTranslate:
+        *mapped = MapRect<MatrixKind::kScaleTranslate>(src, matrix_);
+        return true;
+      case MatrixKind::kGeneral:
+        *mapped = MapRect<MatrixKind::kGeneral>(src, matrix_);
+        return matrix_.IsAligned2D();
+    }
+    FML_UNREACHABLE();
   }
 
   /// @brief  Maps the rect by the current matrix and then clips it against
@@ -159,9 +215,36 @@ class DisplayListMatrixClipState {
       const DlMatrix& matrix,
       const DlRect& cull_bounds);
 
+  /// @brief Returns the |MatrixKind| describing the given matrix.
+  static MatrixKind Classify(const DlMatrix& matrix);
+
  private:
   DlRect cull_rect_;
   DlMatrix matrix_;
+  MatrixKind matrix_kind_;
+
+  /// Maps |src| by a |matrix| known to be of kind |kKind|, producing the
+  /// same bounds as |DlRect::TransformAndClipBounds|.
+  template <MatrixKind kKind>
+  static DlRect MapRect(const DlRect& src, const DlMatrix& matrix) {
+    if constexpr (kKind == MatrixKind::kGeneral) {
+      return src.TransformAndClipBounds(matrix);
+    } else {
+      if (src.IsEmpty()) {
+        return DlRect();
+      }
+      if constexpr (kKind == MatrixKind::kTranslate) {
+        return src.Shift(matrix.m[12], matrix.m[13]);
+      } else {
+        DlScalar x0 = src.GetLeft() * matrix.m[0] + matrix.m[12];
+        DlScalar x1 = src.GetRight() * matrix.m[0] + matrix.m[12];
+        DlScalar y0 = src.GetTop() * matrix.m[5] + matrix.m[13];
+        DlScalar y1 = src.GetBottom() * matrix.m[5] + matrix.m[13];
+        return DlRect::MakeLTRB(std::min(x0, x1), std::min(y0, y1),
+                                std::max(x0, x1), std::max(y0, y1));
+      }
+    }
+  }
 
   void adjustCullRect(const DlRect& clip, DlClipOp op, bool is_aa);
 
@@ -464,6 +464,88 @@ TEST(DisplayListMatrixClipState, MapAndClipRectScale) {
   }
 }
 
+TEST(DisplayListMatrixClipState, MatrixKindTracksTransforms) {
+  using MatrixKind = DisplayListMatrixClipState::MatrixKind;
+  const DlRect cull_rect = DlRect::MakeLTRB(20, 40, 60, 80);
+
+  DisplayListMatrixClipState state(cull_rect);
+  EXPECT_EQ(state.matrix_kind(), MatrixKind::kTranslate);
+
+  state.translate(5, 10);
+  EXPECT_EQ(state.matrix_kind(), MatrixKind::kTranslate);
+
+  state.scale(2, -3);
+  EXPECT_EQ(state.matrix_kind(), MatrixKind::kScaleTranslate);
+
+  state.translate(5, 10);
+  EXPECT_EQ(state.matrix_kind(), MatrixKind::kScaleTranslate);
+
+  // An affine transform without skew or rotation stays specialized.
+  state.transform2DAffine(2, 0, 7,  //
+                          0, 4, 9);
+  EXPECT_EQ(state.matrix_kind(), MatrixKind::kScaleTranslate);
+
+  state.rotate(DlDegrees(45));
+  EXPECT_EQ(state.matrix_kind(), MatrixKind::kGeneral);
+
+  state.setIdentity();
+  EXPECT_EQ(state.matrix_kind(), MatrixKind::kTranslate);
+
+  state.setTransform(DlMatrix::MakeTranslation({3, 4}));
+  EXPECT_EQ(state.matrix_kind(), MatrixKind::kTranslate);
+
+  // A z scale is not something the 2D shortcuts can account for.
+  state.setTransform(DlMatrix::MakeScale({1, 1, 2}));
+  EXPECT_EQ(state.matrix_kind(), MatrixKind::kGeneral);
+
+  DisplayListMatrixClipState translated(cull_rect);
+  translated.translate(12, 34);
+  state.setTransform(DlMatrix::MakeTranslation({12, 34}).Scale({2, 2, 1}));
+  ASSERT_TRUE(state.inverseTransform(translated));
+  EXPECT_EQ(state.matrix_kind(), MatrixKind::kScaleTranslate);
+  EXPECT_EQ(state.matrix(), DlMatrix::MakeTranslation({12, 34})
+                                .Scale({2, 2, 1})
+                                .Translate({-12, -34}));
+}
+
+TEST(DisplayListMatrixClipState, MapRectFastPathsMatchGeneralMapping) {
+  const DlRect cull_rect = DlRect::MakeLTRB(-1000, -1000, 1000, 1000);
+  const DlRect rects[] = {
+      DlRect::MakeLTRB(10.5f, 20.25f, 30.75f, 45.0f),
+      DlRect::MakeLTRB(-50.0f, -20.0f, 5.0f, 2.5f),
+      DlRect::MakeLTRB(10.0f, 10.0f, 10.0f, 20.0f),
+  };
+  const DlMatrix matrices[] = {
+      DlMatrix(),
+      DlMatrix::MakeTranslation({13.5f, -7.25f}),
+      DlMatrix::MakeTranslation({13.5f, -7.25f}).Scale({2.0f, 0.5f, 1.0f}),
+      DlMatrix::MakeTranslation({13.5f, -7.25f}).Scale({-2.0f, 3.0f, 1.0f}),
+      DlMatrix::MakeTranslation({13.5f, -7.25f}).Scale({4.0f, -0.25f, 1.0f}),
+      DlMatrix::MakeScale({0.0f, 2.0f, 1.0f}),
+  };
+
+  for (const DlMatrix& matrix : matrices) {
+    DisplayListMatrixClipState state(cull_rect, matrix);
+    ASSERT_NE(state.matrix_kind(),
+              DisplayListMatrixClipState::MatrixKind::kGeneral);
+    EXPECT_EQ(state.is_matrix_invertable(), matrix.IsInvertible());
+    EXPECT_FALSE(state.has_perspective());
+    for (const DlRect& rect : rects) {
+      DlRect expected = rect.TransformAndClipBounds(matrix);
+      DlRect mapped;
+      EXPECT_EQ(state.mapRect(rect, &mapped), matrix.IsAligned2D());
+      EXPECT_EQ(mapped, expected) << matrix << ", " << rect;
+
+      DlRect expected_clipped =
+          expected.Intersection(cull_rect).value_or(DlRect());
+      DlRect clipped;
+      EXPECT_EQ(state.mapAndClipRect(rect, &clipped),
+                !expected_clipped.IsEmpty());
+      EXPECT_EQ(clipped, expected_clipped) << matrix << ", " << rect;
+    }
+  }
+}
+
 TEST(DisplayListMatrixClipState, RectCoverage) {
   DlRect rect = DlRect::MakeLTRB(100.0f, 100.0f, 200.0f, 200.0f);
   DisplayListMatrixClipState state(rect);
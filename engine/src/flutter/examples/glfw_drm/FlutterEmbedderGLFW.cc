@@ -15,6 +15,7 @@
 #include <cstring>
 #include <list>
 #include <unordered_map>
+#include <vector>
 #include "GLFW/glfw3.h"
 #include "GLFW/glfw3native.h"
 #include "embedder.h"
@@ -193,17 +194,26 @@ bool RunFlutter(GLFWwindow* window,
       set_damage_region_(display_, surface_, buffer_rects.data(), 1);
     }
 
-    // Add frame damage to damage history
-    damage_history_.push_back(info->frame_damage.damage[0]);
+    // Add the bounds of the frame damage to damage history
+    FlutterRect frame_damage_bounds = info->frame_damage.damage[0];
+    for (size_t i = 1; i < info->frame_damage.num_rects; i++) {
+      JoinFlutterRect(&frame_damage_bounds, info->frame_damage.damage[i]);
+    }
+    damage_history_.push_back(frame_damage_bounds);
     if (damage_history_.size() > kMaxHistorySize) {
       damage_history_.pop_front();
     }
 
     if (swap_buffers_with_damage_) {
       // Swap buffers with frame damage.
-      auto frame_rects = RectToInts(info->frame_damage.damage[0]);
-      return swap_buffers_with_damage_(display_, surface_, frame_rects.data(),
-                                       1);
+      std::vector<EGLint> frame_rects;
+      for (size_t i = 0; i < info->frame_damage.num_rects; i++) {
+        auto rect = RectToInts(info->frame_damage.damage[i]);
+        frame_rects.insert(frame_rects.end(), rect.begin(), rect.end());
+      }
+      return swap_buffers_with_damage_(
+          display_, surface_, frame_rects.data(),
+          static_cast<EGLint>(info->frame_damage.num_rects));
     } else {
       // If the required extensions for partial repaint were not provided, do
       // full repaint.
@@ -253,6 +263,8 @@ bool RunFlutter(GLFWwindow* window,
     return reinterpret_cast<void*>(glfwGetProcAddress(name));
   };
   config.open_gl.fbo_reset_after_present = true;
+  // Separate changes are presented as separate damage rects.
+  config.open_gl.max_frame_damage_rects = 4;
 
   // This directory is generated by `flutter build bundle`.
   std::string assets_path = project_path + "/build/flutter_assets";
@@ -37,7 +37,8 @@ std::optional<DlRect> FrameDamage::ComputeClipRect(
 
     damage_ =
         context.ComputeDamage(additional_damage_, horizontal_clip_alignment_,
-                              vertical_clip_alignment_);
+                              vertical_clip_alignment_,
+                              max_frame_damage_rects_);
     return DlRect::Make(damage_->buffer_damage);
   }
   return std::nullopt;
@@ -7,13 +7,16 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "flutter/common/graphics/texture.h"
 #include "flutter/common/macros.h"
 #include "flutter/flow/diff_context.h"
 #include "flutter/flow/embedded_views.h"
+#include "flutter/flow/layer_paint_profiler.h"
 #include "flutter/flow/raster_cache.h"
 #include "flutter/flow/stopwatch.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/raster_thread_merger.h"
 #include "third_party/skia/include/gpu/ganesh/GrDirectContext.h"
@@ -66,6 +69,10 @@ class FrameDamage {
     vertical_clip_alignment_ = vertical;
   }
 
+  // Specifies how many rects the frame damage may be split into. See
+  // Damage::frame_damage_rects.
+  void SetMaxFrameDamageRects(size_t count) { max_frame_damage_rects_ = count; }
+
   // Calculates clip rect for current rasterization. This is diff of layer tree
   // and previous layer tree + any additional provided damage.
   // If previous layer tree is not specified, clip rect will be nullopt,
@@ -80,6 +87,11 @@ class FrameDamage {
     return damage_ ? std::make_optional(damage_->frame_damage) : std::nullopt;
   }
 
+  // See Damage::frame_damage_rects.
+  std::vector<DlIRect> GetFrameDamageRects() const {
+    return damage_ ? damage_->frame_damage_rects : std::vector<DlIRect>();
+  }
+
   // See Damage::buffer_damage.
   std::optional<DlIRect> GetBufferDamage() {
     return (damage_ && !ignore_damage_)
@@ -99,6 +111,7 @@ class FrameDamage {
   const LayerTree* prev_layer_tree_ = nullptr;
   int vertical_clip_alignment_ = 1;
   int horizontal_clip_alignment_ = 1;
+  size_t max_frame_damage_rects_ = 1;
   bool ignore_damage_ = false;
 };
 
@@ -193,9 +206,42 @@ class CompositorContext {
 
   Stopwatch& ui_time() { return ui_time_; }
 
+  // The worker pool that large sets of sibling layers are prerolled on in
+  // parallel. Layers are prerolled on the raster thread alone when null.
+  const std::shared_ptr<fml::ConcurrentTaskRunner>& preroll_task_runner()
+      const {
+    return preroll_task_runner_;
+  }
+  void SetPrerollTaskRunner(
+      std::shared_ptr<fml::ConcurrentTaskRunner> task_runner) {
+    preroll_task_runner_ = std::move(task_runner);
+  }
+
+  // The profiler that the paint time of every layer is attributed to, or
+  // null unless layer paint profiling has been enabled.
+  LayerPaintProfiler* layer_paint_profiler() const {
+    return layer_paint_profiler_.get();
+  }
+  void EnableLayerPaintProfiling() {
+    if (!layer_paint_profiler_) {
+      layer_paint_profiler_ = std::make_unique<LayerPaintProfiler>();
+    }
+  }
+
+  // Whether backdrop filter layers paint their children without applying
+  // the filter, which saves the read back and filtering of the backdrop
+  // when frames keep missing their deadline.
+  bool backdrop_filters_disabled() const { return backdrop_filters_disabled_; }
+  void SetBackdropFiltersDisabled(bool disabled) {
+    backdrop_filters_disabled_ = disabled;
+  }
+
  private:
   NOT_SLIMPELLER(RasterCache raster_cache_);
   std::shared_ptr<TextureRegistry> texture_registry_;
+  std::shared_ptr<fml::ConcurrentTaskRunner> preroll_task_runner_;
+  std::unique_ptr<LayerPaintProfiler> layer_paint_profiler_;
+  bool backdrop_filters_disabled_ = false;
   Stopwatch raster_time_;
   Stopwatch ui_time_;
 
@@ -4,11 +4,55 @@
 
 #include "flutter/flow/diff_context.h"
 
+#include <limits>
+
 #include "flutter/flow/layers/layer.h"
 #include "flutter/flow/raster_cache_util.h"
 
 namespace flutter {
 
+namespace {
+
+// The number of damage rects tracked separately while diffing. Beyond this
+// the cheapest pair is merged whenever more damage is added.
+constexpr size_t kMaxTrackedDamageRects = 16;
+
+// Presenting an additional damage rect has a fixed cost in the compositor
+// that is roughly equivalent to repainting this many pixels, so merging a
+// pair of rects whose union adds fewer undamaged pixels is always worth it.
+constexpr DlScalar kDamageRectMergeCost = 64 * 64;
+
+// The number of undamaged pixels that the union of |a| and |b| covers.
+DlScalar DamageRectMergeCost(const DlRect& a, const DlRect& b) {
+  DlScalar covered = a.Area() + b.Area() - a.IntersectionOrEmpty(b).Area();
+  return a.Union(b).Area() - covered;
+}
+
+void MergeDamageRects(std::vector<DlRect>& rects, size_t max_rects) {
+  while (rects.size() > 1) {
+    size_t merge_a = 0;
+    size_t merge_b = 1;
+    DlScalar min_cost = std::numeric_limits<DlScalar>::infinity();
+    for (size_t i = 0; i < rects.size(); i++) {
+      for (size_t j = i + 1; j < rects.size(); j++) {
+        DlScalar cost = DamageRectMergeCost(rects[i], rects[j]);
+        if (cost < min_cost) {
+          min_cost = cost;
+          merge_a = i;
+          merge_b = j;
+        }
+      }
+    }
+    if (rects.size() <= max_rects && min_cost > kDamageRectMergeCost) {
+      return;
+    }
+    rects[merge_a] = rects[merge_a].Union(rects[merge_b]);
+    rects.erase(rects.begin() + merge_b);
+  }
+}
+
+}  // namespace
+
 DiffContext::DiffContext(DlISize frame_size,
                          PaintRegionMap& this_frame_paint_region_map,
                          const PaintRegionMap& last_frame_paint_region_map,
@@ -121,6 +165,25 @@ Damage DiffContext::ComputeDamage(const DlIRect& accumulated_buffer_damage,
 
   DlIRect frame_clip = DlIRect::MakeSize(frame_size_);
 
+  std::vector<DlRect> frame_damage_rects;
+  if (max_frame_damage_rects > 1) {
+    frame_damage_rects = damage_rects_;
+    for (const auto& r : readbacks_) {
+      DlRect paint_rect = DlRect::Make(r.paint_rect);
+      DlRect readback_rect = DlRect::Make(r.readback_rect);
+      bool damaged = std::any_of(
+          frame_damage_rects.begin(), frame_damage_rects.end(),
+          [&](const DlRect& rect) {
+            return paint_rect.IntersectsWithRect(rect) ||
+                   readback_rect.IntersectsWithRect(rect);
+          });
+      if (damaged) {
+        frame_damage_rects.push_back(readback_rect.Union(paint_rect));
+      }
+    }
+    MergeDamageRects(frame_damage_rects, max_frame_damage_rects);
+  }
+
   Damage res;
   res.buffer_damage =
       DlIRect::RoundOut(buffer_damage).IntersectionOrEmpty(frame_clip);
@@ -133,6 +196,23 @@ Damage DiffContext::ComputeDamage(const DlIRect& accumulated_buffer_damage,
     AlignRect(res.frame_damage, horizontal_clip_alignment,
               vertical_clip_alignment);
   }
+
+  if (max_frame_damage_rects <= 1) {
+    if (!res.frame_damage.IsEmpty()) {
+      res.frame_damage_rects.push_back(res.frame_damage);
+    }
+    return res;
+  }
+  for (const DlRect& rect : frame_damage_rects) {
+    DlIRect damage = DlIRect::RoundOut(rect).IntersectionOrEmpty(frame_clip);
+    if (damage.IsEmpty()) {
+      continue;
+    }
+    if (horizontal_clip_alignment > 1 || vertical_clip_alignment > 1) {
+      AlignRect(damage, horizontal_clip_alignment, vertical_clip_alignment);
+    }
+    res.frame_damage_rects.push_back(damage);
+  }
   return res;
 }
 
@@ -230,12 +310,16 @@ PaintRegion DiffContext::CurrentSubtreeRegion() const {
 void DiffContext::AddDamage(const PaintRegion& damage) {
   FML_DCHECK(damage.is_valid());
   for (const auto& r : damage) {
-    damage_ = damage_.Union(r);
+    AddDamage(r);
   }
 }
 
 void DiffContext::AddDamage(const DlRect& rect) {
   damage_ = damage_.Union(rect);
+  if (!rect.IsEmpty()) {
+    damage_rects_.push_back(rect);
+    MergeDamageRects(damage_rects_, kMaxTrackedDamageRects);
+  }
 }
 
 void DiffContext::SetLayerPaintRegion(const Layer* layer,
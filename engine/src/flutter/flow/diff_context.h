@@ -32,6 +32,13 @@ struct Damage {
   // upfront may be useful for tile based GPUs.
   // Corresponds to "buffer damage" from EGL_KHR_partial_update.
   DlIRect buffer_damage;
+
+  // The frame_damage split into separate rects for surfaces that can present
+  // more than one damage rect. Every rect is contained in frame_damage and
+  // together they cover everything that changed since the previous frame.
+  // Holds frame_damage itself when only a single rect was requested and is
+  // empty when nothing changed.
+  std::vector<DlIRect> frame_damage_rects;
 };
 
 // Layer Unique Id to PaintRegion
@@ -139,9 +146,16 @@ class DiffContext {
   //
   // clip_alignment controls the alignment of resulting frame and surface
   // damage.
+  //
+  // max_frame_damage_rects is the number of rects the frame damage may be
+  // split into. Damaged areas are merged greedily, starting with the pair
+  // whose union adds the fewest undamaged pixels, until no more than
+  // max_frame_damage_rects remain and every remaining merge would add more
+  // undamaged pixels than presenting another rect costs.
   Damage ComputeDamage(const DlIRect& additional_damage,
                        int horizontal_clip_alignment = 0,
-                       int vertical_clip_alignment = 0) const;
+                       int vertical_clip_alignment = 0,
+                       size_t max_frame_damage_rects = 1) const;
 
   // Adds the region to current damage. Used for removed layers, where instead
   // of diffing the layer its paint region is direcly added to damage.
@@ -243,6 +257,7 @@ class DiffContext {
   DlRect ApplyFilterBoundsAdjustment(DlRect rect) const;
 
   DlRect damage_;
+  std::vector<DlRect> damage_rects_;
 
   PaintRegionMap& this_frame_paint_region_map_;
   const PaintRegionMap& last_frame_paint_region_map_;
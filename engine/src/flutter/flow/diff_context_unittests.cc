@@ -69,5 +69,70 @@ TEST_F(DiffContextTest, DisjointDamage) {
   EXPECT_EQ(damage.buffer_damage, DlIRect());
 }
 
+TEST_F(DiffContextTest, SeparateDamageRects) {
+  DlISize frame_size = DlISize(1000, 1000);
+  DlRect top_left = DlRect::MakeLTRB(10, 10, 30, 30);
+  DlRect bottom_right = DlRect::MakeLTRB(950, 950, 980, 980);
+
+  MockLayerTree t1(frame_size);
+  t1.root()->Add(CreateDisplayListLayer(CreateDisplayList(top_left)));
+  t1.root()->Add(CreateDisplayListLayer(CreateDisplayList(bottom_right)));
+
+  MockLayerTree t2(frame_size);
+  t2.root()->Add(CreateDisplayListLayer(
+      CreateDisplayList(top_left, DlColor::kGreen())));
+  t2.root()->Add(CreateDisplayListLayer(
+      CreateDisplayList(bottom_right, DlColor::kGreen())));
+
+  DiffContext dc(frame_size, t2.paint_region_map(), t1.paint_region_map(), true,
+                 false);
+  t2.root()->Diff(&dc, t1.root());
+
+  auto damage = dc.ComputeDamage(DlIRect(), 0, 0, 4);
+  EXPECT_EQ(damage.frame_damage, DlIRect::MakeLTRB(10, 10, 980, 980));
+  EXPECT_EQ(damage.buffer_damage, DlIRect::MakeLTRB(10, 10, 980, 980));
+  EXPECT_EQ(damage.frame_damage_rects,
+            std::vector<DlIRect>({DlIRect::MakeLTRB(10, 10, 30, 30),
+                                  DlIRect::MakeLTRB(950, 950, 980, 980)}));
+
+  damage = dc.ComputeDamage(DlIRect(), 0, 0, 1);
+  EXPECT_EQ(damage.frame_damage_rects,
+            std::vector<DlIRect>({DlIRect::MakeLTRB(10, 10, 980, 980)}));
+
+  damage = dc.ComputeDamage(DlIRect(), 16, 16, 4);
+  EXPECT_EQ(damage.frame_damage_rects,
+            std::vector<DlIRect>({DlIRect::MakeLTRB(0, 0, 32, 32),
+                                  DlIRect::MakeLTRB(944, 944, 992, 992)}));
+}
+
+TEST_F(DiffContextTest, CloseDamageRectsAreMerged) {
+  DlISize frame_size = DlISize(1000, 1000);
+  // The rects are 2 pixels apart, which is cheaper to repaint than to
+  // present separately.
+  DlRect left = DlRect::MakeLTRB(10, 10, 30, 30);
+  DlRect right = DlRect::MakeLTRB(32, 10, 50, 30);
+  DlRect far = DlRect::MakeLTRB(500, 500, 520, 520);
+
+  MockLayerTree t1(frame_size);
+  MockLayerTree t2(frame_size);
+  t2.root()->Add(CreateDisplayListLayer(CreateDisplayList(left)));
+  t2.root()->Add(CreateDisplayListLayer(CreateDisplayList(right)));
+  t2.root()->Add(CreateDisplayListLayer(CreateDisplayList(far)));
+
+  DiffContext dc(frame_size, t2.paint_region_map(), t1.paint_region_map(), true,
+                 false);
+  t2.root()->Diff(&dc, t1.root());
+
+  auto damage = dc.ComputeDamage(DlIRect(), 0, 0, 4);
+  EXPECT_EQ(damage.frame_damage_rects,
+            std::vector<DlIRect>({DlIRect::MakeLTRB(10, 10, 50, 30),
+                                  DlIRect::MakeLTRB(500, 500, 520, 520)}));
+
+  // Once the limit is reached the remaining rects are merged as well.
+  damage = dc.ComputeDamage(DlIRect(), 0, 0, 1);
+  EXPECT_EQ(damage.frame_damage_rects,
+            std::vector<DlIRect>({DlIRect::MakeLTRB(10, 10, 520, 520)}));
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -518,6 +518,12 @@ class ExternalViewEmbedder {
   // Returning `true` results a |RasterThreadMerger| instance to be created.
   // * See also |BegineFrame| and |EndFrame| for getting the
   // |RasterThreadMerger| instance.
+  //
+  // Merging serializes rasterization with the platform thread for as long as
+  // platform views are on screen. Embedders that can hand the platform view
+  // mutations of a frame to the platform thread as one transaction, like the
+  // iOS embedder and the Android embedder when it presents through
+  // SurfaceControl, should return `false`.
   virtual bool SupportsDynamicThreadMerging();
 
   // Called when the rasterizer is being torn down.
@@ -535,6 +541,27 @@ class ExternalViewEmbedder {
   // 'EndFrame', otherwise returns false.
   bool GetUsedThisFrame() const { return used_this_frame_; }
 
+  // The overlay layers that were composited above platform views.
+  struct OverlayLayerStatistics {
+    size_t count = 0;
+    // The number of pixels covered by the bounds of the overlay layers.
+    size_t pixels = 0;
+  };
+
+  // Records that |count| overlay layers covering |pixels| pixels were
+  // composited while submitting a view.
+  void RecordOverlayLayers(size_t count, size_t pixels) {
+    overlay_layer_statistics_.count += count;
+    overlay_layer_statistics_.pixels += pixels;
+  }
+
+  // Returns the overlay layers recorded since the last call and resets them.
+  OverlayLayerStatistics TakeOverlayLayerStatistics() {
+    OverlayLayerStatistics statistics = overlay_layer_statistics_;
+    overlay_layer_statistics_ = {};
+    return statistics;
+  }
+
   // Pushes the platform view id of a visited platform view to a list of
   // visited platform views.
   virtual void PushVisitedPlatformView(int64_t platform_view_id) {}
@@ -559,6 +586,7 @@ class ExternalViewEmbedder {
 
  private:
   bool used_this_frame_ = false;
+  OverlayLayerStatistics overlay_layer_statistics_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ExternalViewEmbedder);
 
@@ -0,0 +1,95 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/frame_timing_history.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "flutter/fml/logging.h"
+
+namespace flutter {
+
+namespace {
+
+// Returns the nearest-rank percentile of the sorted |samples|.
+fml::TimeDelta GetPercentile(const std::vector<int64_t>& samples,
+                             double percentile) {
+  FML_DCHECK(!samples.empty());
+  size_t rank = static_cast<size_t>(std::ceil(percentile * samples.size()));
+  size_t index = std::clamp<size_t>(rank, 1, samples.size()) - 1;
+  return fml::TimeDelta::FromMicroseconds(samples[index]);
+}
+
+}  // namespace
+
+FrameTimingHistory::FrameTimingHistory(size_t capacity)
+    : capacity_(std::max<size_t>(capacity, 1)) {
+  for (auto& phase_samples : samples_) {
+    phase_samples = std::make_unique<std::atomic<int64_t>[]>(capacity_);
+  }
+}
+
+FrameTimingHistory::~FrameTimingHistory() = default;
+
+uint64_t FrameTimingHistory::GetRecordedFrameCount() const {
+  return recorded_count_.load(std::memory_order_acquire);
+}
+
+fml::TimeDelta FrameTimingHistory::GetTotalDuration(Phase phase) const {
+  return fml::TimeDelta::FromMicroseconds(
+      totals_[static_cast<size_t>(phase)].load(std::memory_order_relaxed));
+}
+
+void FrameTimingHistory::Record(const FrameTiming& timing) {
+  const fml::TimePoint vsync_start = timing.Get(FrameTiming::kVsyncStart);
+  const fml::TimePoint build_start = timing.Get(FrameTiming::kBuildStart);
+  const fml::TimePoint build_finish = timing.Get(FrameTiming::kBuildFinish);
+  const fml::TimePoint raster_start = timing.Get(FrameTiming::kRasterStart);
+  const fml::TimePoint raster_finish = timing.Get(FrameTiming::kRasterFinish);
+
+  std::array<fml::TimeDelta, kPhaseCount> durations;
+  durations[static_cast<size_t>(Phase::kVsync)] = build_start - vsync_start;
+  durations[static_cast<size_t>(Phase::kBuild)] = build_finish - build_start;
+  durations[static_cast<size_t>(Phase::kRasterWait)] =
+      raster_start - build_finish;
+  durations[static_cast<size_t>(Phase::kRaster)] = raster_finish - raster_start;
+  durations[static_cast<size_t>(Phase::kTotal)] = raster_finish - vsync_start;
+
+  uint64_t count = recorded_count_.load(std::memory_order_relaxed);
+  size_t slot = count % capacity_;
+  for (size_t i = 0; i < kPhaseCount; i++) {
+    const int64_t micros = std::max<int64_t>(durations[i].ToMicroseconds(), 0);
+    samples_[i][slot].store(micros, std::memory_order_relaxed);
+    totals_[i].fetch_add(micros, std::memory_order_relaxed);
+  }
+  recorded_count_.store(count + 1, std::memory_order_release);
+}
+
+FrameTimingHistory::Summary FrameTimingHistory::ComputeSummary() const {
+  Summary summary;
+  uint64_t count = recorded_count_.load(std::memory_order_acquire);
+  summary.frame_count = static_cast<size_t>(
+      std::min<uint64_t>(count, static_cast<uint64_t>(capacity_)));
+  if (summary.frame_count == 0) {
+    return summary;
+  }
+
+  std::vector<int64_t> samples(summary.frame_count);
+  for (size_t i = 0; i < kPhaseCount; i++) {
+    for (size_t slot = 0; slot < summary.frame_count; slot++) {
+      samples[slot] = samples_[i][slot].load(std::memory_order_relaxed);
+    }
+    std::sort(samples.begin(), samples.end());
+    summary.phases[i] = {
+        .p50 = GetPercentile(samples, 0.50),
+        .p90 = GetPercentile(samples, 0.90),
+        .p99 = GetPercentile(samples, 0.99),
+    };
+  }
+  return summary;
+}
+
+}  // namespace flutter
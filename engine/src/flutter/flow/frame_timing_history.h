@@ -0,0 +1,105 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_FRAME_TIMING_HISTORY_H_
+#define FLUTTER_FLOW_FRAME_TIMING_HISTORY_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "flutter/common/settings.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_delta.h"
+
+namespace flutter {
+
+/// Keeps the durations of the phases of the most recently rasterized frames
+/// and summarizes them as percentiles.
+///
+/// Frames are recorded by a single writer, the raster thread, into a ring
+/// buffer with one array per phase. Summaries may be computed from any thread
+/// without blocking the writer. A summary computed while the writer laps the
+/// reader may mix the phases of two frames in a single slot, which is
+/// acceptable for telemetry.
+class FrameTimingHistory {
+ public:
+  /// The phases of a frame, measured between the timestamps of a
+  /// |FrameTiming|.
+  enum class Phase : uint8_t {
+    /// From the vsync signal until the UI thread started building the frame.
+    kVsync,
+    /// From the start until the end of the frame building on the UI thread.
+    kBuild,
+    /// From the end of the frame building until the raster thread picked up
+    /// the frame.
+    kRasterWait,
+    /// From the start until the end of the rasterization of the frame.
+    kRaster,
+    /// From the vsync signal until the end of the rasterization.
+    kTotal,
+  };
+  static constexpr size_t kPhaseCount = static_cast<size_t>(Phase::kTotal) + 1;
+
+  /// The number of frames kept by default, which is about 4 seconds at 120hz.
+  static constexpr size_t kDefaultCapacity = 512;
+
+  struct Percentiles {
+    fml::TimeDelta p50;
+    fml::TimeDelta p90;
+    fml::TimeDelta p99;
+  };
+
+  struct Summary {
+    /// The number of frames the percentiles were computed over. All
+    /// percentiles are zero if this is zero.
+    size_t frame_count = 0;
+    std::array<Percentiles, kPhaseCount> phases = {};
+
+    const Percentiles& Get(Phase phase) const {
+      return phases[static_cast<size_t>(phase)];
+    }
+  };
+
+  explicit FrameTimingHistory(size_t capacity = kDefaultCapacity);
+
+  ~FrameTimingHistory();
+
+  size_t GetCapacity() const { return capacity_; }
+
+  /// The number of frames recorded since construction, including the ones
+  /// that have since been overwritten.
+  uint64_t GetRecordedFrameCount() const;
+
+  /// The sum of the durations of the phase over all the frames recorded
+  /// since construction, including the ones that have since been
+  /// overwritten.
+  ///
+  /// The totals of two reads are subtracted to find the time a phase took
+  /// in between, such as how long the UI thread spent building frames.
+  fml::TimeDelta GetTotalDuration(Phase phase) const;
+
+  /// Records the phases of a rasterized frame. Must only be called from a
+  /// single thread.
+  void Record(const FrameTiming& timing);
+
+  /// Computes the percentiles of each phase over the frames that are
+  /// currently kept.
+  Summary ComputeSummary() const;
+
+ private:
+  const size_t capacity_;
+  // Durations in microseconds, indexed by phase and then by slot.
+  std::array<std::unique_ptr<std::atomic<int64_t>[]>, kPhaseCount> samples_;
+  std::atomic<uint64_t> recorded_count_ = 0;
+  // In microseconds, indexed by phase.
+  std::array<std::atomic<int64_t>, kPhaseCount> totals_ = {};
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FrameTimingHistory);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_FRAME_TIMING_HISTORY_H_
@@ -0,0 +1,103 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/frame_timing_history.h"
+
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+using Phase = FrameTimingHistory::Phase;
+
+// Returns a frame that took |build_ms| to build and |raster_ms| to raster.
+FrameTiming MakeTiming(int64_t build_ms, int64_t raster_ms) {
+  FrameTiming timing;
+  fml::TimePoint vsync = fml::TimePoint::FromEpochDelta(
+      fml::TimeDelta::FromMilliseconds(1000));
+  fml::TimePoint build_start = vsync + fml::TimeDelta::FromMilliseconds(1);
+  fml::TimePoint build_finish =
+      build_start + fml::TimeDelta::FromMilliseconds(build_ms);
+  fml::TimePoint raster_start =
+      build_finish + fml::TimeDelta::FromMilliseconds(2);
+  timing.Set(FrameTiming::kVsyncStart, vsync);
+  timing.Set(FrameTiming::kBuildStart, build_start);
+  timing.Set(FrameTiming::kBuildFinish, build_finish);
+  timing.Set(FrameTiming::kRasterStart, raster_start);
+  timing.Set(FrameTiming::kRasterFinish,
+             raster_start + fml::TimeDelta::FromMilliseconds(raster_ms));
+  return timing;
+}
+
+}  // namespace
+
+TEST(FrameTimingHistoryTest, EmptyHistoryHasEmptySummary) {
+  FrameTimingHistory history;
+  FrameTimingHistory::Summary summary = history.ComputeSummary();
+  EXPECT_EQ(summary.frame_count, 0u);
+  EXPECT_EQ(summary.Get(Phase::kTotal).p99, fml::TimeDelta::Zero());
+}
+
+TEST(FrameTimingHistoryTest, ComputesPercentilesPerPhase) {
+  FrameTimingHistory history;
+  for (int64_t i = 1; i <= 100; i++) {
+    history.Record(MakeTiming(/*build_ms=*/i, /*raster_ms=*/101 - i));
+  }
+
+  FrameTimingHistory::Summary summary = history.ComputeSummary();
+  EXPECT_EQ(summary.frame_count, 100u);
+
+  const FrameTimingHistory::Percentiles& build = summary.Get(Phase::kBuild);
+  EXPECT_EQ(build.p50, fml::TimeDelta::FromMilliseconds(50));
+  EXPECT_EQ(build.p90, fml::TimeDelta::FromMilliseconds(90));
+  EXPECT_EQ(build.p99, fml::TimeDelta::FromMilliseconds(99));
+
+  const FrameTimingHistory::Percentiles& raster = summary.Get(Phase::kRaster);
+  EXPECT_EQ(raster.p50, fml::TimeDelta::FromMilliseconds(50));
+  EXPECT_EQ(raster.p99, fml::TimeDelta::FromMilliseconds(99));
+
+  EXPECT_EQ(summary.Get(Phase::kVsync).p50,
+            fml::TimeDelta::FromMilliseconds(1));
+  EXPECT_EQ(summary.Get(Phase::kRasterWait).p99,
+            fml::TimeDelta::FromMilliseconds(2));
+  // Every frame takes 1 + 101 + 2ms in total.
+  EXPECT_EQ(summary.Get(Phase::kTotal).p50,
+            fml::TimeDelta::FromMilliseconds(104));
+}
+
+TEST(FrameTimingHistoryTest, KeepsOnlyTheMostRecentFrames) {
+  FrameTimingHistory history(/*capacity=*/10);
+  for (int64_t i = 0; i < 10; i++) {
+    history.Record(MakeTiming(/*build_ms=*/100, /*raster_ms=*/1));
+  }
+  for (int64_t i = 0; i < 10; i++) {
+    history.Record(MakeTiming(/*build_ms=*/5, /*raster_ms=*/1));
+  }
+
+  EXPECT_EQ(history.GetRecordedFrameCount(), 20u);
+  FrameTimingHistory::Summary summary = history.ComputeSummary();
+  EXPECT_EQ(summary.frame_count, 10u);
+  EXPECT_EQ(summary.Get(Phase::kBuild).p99,
+            fml::TimeDelta::FromMilliseconds(5));
+}
+
+TEST(FrameTimingHistoryTest, TotalsIncludeOverwrittenFrames) {
+  FrameTimingHistory history(/*capacity=*/4);
+  EXPECT_EQ(history.GetTotalDuration(Phase::kBuild), fml::TimeDelta::Zero());
+  for (int64_t i = 1; i <= 10; i++) {
+    history.Record(MakeTiming(/*build_ms=*/i, /*raster_ms=*/2));
+  }
+  EXPECT_EQ(history.GetTotalDuration(Phase::kBuild),
+            fml::TimeDelta::FromMilliseconds(55));
+  EXPECT_EQ(history.GetTotalDuration(Phase::kRaster),
+            fml::TimeDelta::FromMilliseconds(20));
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -126,6 +126,20 @@ size_t FrameTimingsRecorder::GetPictureCacheBytes() const {
   return picture_cache_bytes_;
 }
 
+/// Count of the overlay layers composited above platform views
+size_t FrameTimingsRecorder::GetOverlayLayerCount() const {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(state_ >= State::kRasterEnd);
+  return overlay_layer_count_;
+}
+
+/// Total pixels covered by the overlay layers
+size_t FrameTimingsRecorder::GetOverlayLayerPixels() const {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(state_ >= State::kRasterEnd);
+  return overlay_layer_pixels_;
+}
+
 void FrameTimingsRecorder::RecordVsync(fml::TimePoint vsync_start,
                                        fml::TimePoint vsync_target) {
   fml::Status status = RecordVsyncImpl(vsync_start, vsync_target);
@@ -199,6 +213,13 @@ fml::Status FrameTimingsRecorder::RecordRasterStartImpl(
   return fml::Status();
 }
 
+void FrameTimingsRecorder::RecordOverlayLayers(size_t count, size_t pixels) {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(state_ == State::kRasterStart);
+  overlay_layer_count_ += count;
+  overlay_layer_pixels_ += pixels;
+}
+
 FrameTiming FrameTimingsRecorder::RecordRasterEnd(const RasterCache* cache) {
   std::scoped_lock state_lock(state_mutex_);
   FML_DCHECK(state_ == State::kRasterStart);
@@ -268,6 +289,8 @@ std::unique_ptr<FrameTimingsRecorder> FrameTimingsRecorder::CloneUntil(
     recorder->layer_cache_bytes_ = layer_cache_bytes_;
     recorder->picture_cache_count_ = picture_cache_count_;
     recorder->picture_cache_bytes_ = picture_cache_bytes_;
+    recorder->overlay_layer_count_ = overlay_layer_count_;
+    recorder->overlay_layer_pixels_ = overlay_layer_pixels_;
   }
 
   return recorder;
@@ -87,6 +87,13 @@ class FrameTimingsRecorder {
   /// Total Bytes in all picture cache entries
   size_t GetPictureCacheBytes() const;
 
+  /// Count of the overlay layers composited above platform views
+  size_t GetOverlayLayerCount() const;
+
+  /// Total pixels covered by the overlay layers composited above platform
+  /// views
+  size_t GetOverlayLayerPixels() const;
+
   /// Records a vsync event.
   void RecordVsync(fml::TimePoint vsync_start, fml::TimePoint vsync_target);
 
@@ -99,6 +106,11 @@ class FrameTimingsRecorder {
   /// Records a raster start event.
   void RecordRasterStart(fml::TimePoint raster_start);
 
+  /// Records the overlay layers that were composited above platform views
+  /// during rasterization. May be called repeatedly between the raster start
+  /// and raster end events, for example once per view.
+  void RecordOverlayLayers(size_t count, size_t pixels);
+
   /// Clones the recorder until (and including) the specified state.
   std::unique_ptr<FrameTimingsRecorder> CloneUntil(State state);
 
@@ -157,6 +169,8 @@ class FrameTimingsRecorder {
   size_t layer_cache_bytes_;
   size_t picture_cache_count_;
   size_t picture_cache_bytes_;
+  size_t overlay_layer_count_ = 0;
+  size_t overlay_layer_pixels_ = 0;
 
   // Set when `RecordRasterEnd` is called. Cannot be reset once set.
   FrameTiming timing_;
@@ -127,6 +127,26 @@ TEST(FrameTimingsRecorderTest, RecordRasterTimesWithCache) {
 #if !defined(OS_FUCHSIA) && !defined(FML_OS_WIN) && \
     (FLUTTER_RUNTIME_MODE == FLUTTER_RUNTIME_MODE_DEBUG)
 
+TEST(FrameTimingsRecorderTest, RecordOverlayLayers) {
+  auto recorder = std::make_unique<FrameTimingsRecorder>();
+
+  const auto now = fml::TimePoint::Now();
+  recorder->RecordVsync(now, now + fml::TimeDelta::FromMilliseconds(16));
+  recorder->RecordBuildStart(fml::TimePoint::Now());
+  recorder->RecordBuildEnd(fml::TimePoint::Now());
+  recorder->RecordRasterStart(fml::TimePoint::Now());
+  recorder->RecordOverlayLayers(2u, 1000u);
+  recorder->RecordOverlayLayers(1u, 500u);
+  recorder->RecordRasterEnd();
+
+  ASSERT_EQ(recorder->GetOverlayLayerCount(), 3u);
+  ASSERT_EQ(recorder->GetOverlayLayerPixels(), 1500u);
+
+  auto cloned = recorder->CloneUntil(FrameTimingsRecorder::State::kRasterEnd);
+  ASSERT_EQ(cloned->GetOverlayLayerCount(), 3u);
+  ASSERT_EQ(cloned->GetOverlayLayerPixels(), 1500u);
+}
+
 TEST(FrameTimingsRecorderTest, ThrowWhenRecordBuildBeforeVsync) {
   auto recorder = std::make_unique<FrameTimingsRecorder>();
 
@@ -0,0 +1,82 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/layer_paint_profiler.h"
+
+#include "flutter/flow/layers/layer.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+LayerPaintProfiler::ScopedPaint::ScopedPaint(LayerPaintProfiler* profiler,
+                                             const Layer* layer)
+    : profiler_(profiler), layer_(layer), type_name_(nullptr) {
+  if (!profiler_) {
+    return;
+  }
+  type_name_ = layer_->GetTypeName();
+  fml::tracing::TraceEvent0("flutter", type_name_, /*flow_id_count=*/0,
+                            /*flow_ids=*/nullptr);
+  profiler_->BeginPaint();
+  start_ = fml::TimePoint::Now();
+}
+
+LayerPaintProfiler::ScopedPaint::~ScopedPaint() {
+  if (!profiler_) {
+    return;
+  }
+  profiler_->EndPaint(layer_, type_name_, fml::TimePoint::Now() - start_);
+  fml::tracing::TraceEventEnd(type_name_);
+}
+
+LayerPaintProfiler::LayerPaintProfiler() = default;
+
+LayerPaintProfiler::~LayerPaintProfiler() = default;
+
+void LayerPaintProfiler::Reset() {
+  FML_DCHECK(child_times_.empty());
+  frame_count_ = 0;
+  type_stats_.clear();
+  layer_stats_.clear();
+}
+
+void LayerPaintProfiler::BeginPaint() {
+  child_times_.push_back(fml::TimeDelta::Zero());
+}
+
+void LayerPaintProfiler::EndPaint(const Layer* layer,
+                                  const char* type_name,
+                                  fml::TimeDelta elapsed) {
+  FML_DCHECK(!child_times_.empty());
+  fml::TimeDelta self_time = elapsed - child_times_.back();
+  child_times_.pop_back();
+  if (child_times_.empty()) {
+    // The outermost layer is the root of the layer tree.
+    frame_count_++;
+  } else {
+    child_times_.back() = child_times_.back() + elapsed;
+  }
+
+  auto accumulate = [elapsed, self_time](Stats& stats) {
+    stats.paint_count++;
+    stats.total_time = stats.total_time + elapsed;
+    stats.self_time = stats.self_time + self_time;
+  };
+
+  accumulate(type_stats_[type_name]);
+
+  uint64_t id = layer->original_layer_id();
+  auto layer_stats = layer_stats_.find(id);
+  if (layer_stats == layer_stats_.end()) {
+    if (layer_stats_.size() >= kMaxTrackedLayers) {
+      return;
+    }
+    layer_stats = layer_stats_.emplace(id, LayerStats{.type_name = type_name})
+                      .first;
+  }
+  accumulate(layer_stats->second.stats);
+}
+
+}  // namespace flutter
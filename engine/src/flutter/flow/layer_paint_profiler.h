@@ -0,0 +1,104 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_LAYER_PAINT_PROFILER_H_
+#define FLUTTER_FLOW_LAYER_PAINT_PROFILER_H_
+
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace flutter {
+
+class Layer;
+
+/// Attributes the time spent painting a layer tree to the individual layers
+/// and to the types of layers that were painted.
+///
+/// Every painted layer is wrapped in a |ScopedPaint|, which also emits a
+/// timeline event named after the type of the layer. The time of a layer
+/// includes the time of its children, while its self time does not. The
+/// statistics accumulate across frames until |Reset| is called.
+///
+/// Only used on the raster thread.
+class LayerPaintProfiler {
+ public:
+  /// The maximum number of distinct layers that are tracked individually.
+  /// Layers painted after reaching this limit still count towards the
+  /// statistics of their type.
+  static constexpr size_t kMaxTrackedLayers = 4096;
+
+  struct Stats {
+    size_t paint_count = 0;
+    fml::TimeDelta total_time;
+    fml::TimeDelta self_time;
+  };
+
+  struct LayerStats {
+    const char* type_name = nullptr;
+    Stats stats;
+  };
+
+  /// Profiles the painting of |layer| for the lifetime of the scope. Does
+  /// nothing if |profiler| is null.
+  class ScopedPaint {
+   public:
+    ScopedPaint(LayerPaintProfiler* profiler, const Layer* layer);
+
+    ~ScopedPaint();
+
+   private:
+    LayerPaintProfiler* profiler_;
+    const Layer* layer_;
+    const char* type_name_;
+    fml::TimePoint start_;
+
+    FML_DISALLOW_COPY_AND_ASSIGN(ScopedPaint);
+  };
+
+  LayerPaintProfiler();
+
+  ~LayerPaintProfiler();
+
+  /// The number of layer trees painted since the last |Reset|.
+  size_t GetFrameCount() const { return frame_count_; }
+
+  /// The statistics per layer type, keyed by |Layer::GetTypeName|.
+  const std::unordered_map<std::string_view, Stats>& GetTypeStats() const {
+    return type_stats_;
+  }
+
+  /// The statistics per layer, keyed by |Layer::original_layer_id| so that
+  /// layers retained or replaced across frames accumulate together.
+  const std::unordered_map<uint64_t, LayerStats>& GetLayerStats() const {
+    return layer_stats_;
+  }
+
+  void Reset();
+
+ private:
+  void BeginPaint();
+
+  void EndPaint(const Layer* layer,
+                const char* type_name,
+                fml::TimeDelta elapsed);
+
+  size_t frame_count_ = 0;
+  // The accumulated time of the children of each layer that is being
+  // painted, innermost last.
+  std::vector<fml::TimeDelta> child_times_;
+  std::unordered_map<std::string_view, Stats> type_stats_;
+  std::unordered_map<uint64_t, LayerStats> layer_stats_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(LayerPaintProfiler);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_LAYER_PAINT_PROFILER_H_
@@ -0,0 +1,68 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/layer_paint_profiler.h"
+
+#include "flutter/flow/layers/container_layer.h"
+#include "flutter/flow/testing/layer_test.h"
+#include "flutter/flow/testing/mock_layer.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+using LayerPaintProfilerTest = LayerTest;
+
+TEST_F(LayerPaintProfilerTest, NullProfilerIsIgnored) {
+  auto layer = std::make_shared<ContainerLayer>();
+  LayerPaintProfiler::ScopedPaint profile(nullptr, layer.get());
+}
+
+TEST_F(LayerPaintProfilerTest, AttributesPaintTimeToNestedLayers) {
+  auto mock1 = MockLayer::Make(DlPath::MakeRectLTRB(0, 0, 10, 10));
+  auto mock2 = MockLayer::Make(DlPath::MakeRectLTRB(10, 10, 20, 20));
+  auto container = std::make_shared<ContainerLayer>();
+  container->Add(mock1);
+  container->Add(mock2);
+  container->Preroll(preroll_context());
+
+  LayerPaintProfiler profiler;
+  paint_context().paint_profiler = &profiler;
+  for (int frame = 0; frame < 2; frame++) {
+    LayerPaintProfiler::ScopedPaint profile(&profiler, container.get());
+    container->Paint(paint_context());
+  }
+  paint_context().paint_profiler = nullptr;
+
+  EXPECT_EQ(profiler.GetFrameCount(), 2u);
+
+  const auto& type_stats = profiler.GetTypeStats();
+  ASSERT_EQ(type_stats.size(), 2u);
+  const LayerPaintProfiler::Stats& containers =
+      type_stats.at(container->GetTypeName());
+  const LayerPaintProfiler::Stats& mocks = type_stats.at("MockLayer");
+  EXPECT_EQ(containers.paint_count, 2u);
+  EXPECT_EQ(mocks.paint_count, 4u);
+  EXPECT_LE(containers.self_time, containers.total_time);
+  EXPECT_EQ(mocks.self_time, mocks.total_time);
+  // The time of the children is part of the time of the container.
+  EXPECT_GE(containers.total_time, mocks.total_time);
+  EXPECT_EQ(containers.total_time, containers.self_time + mocks.total_time);
+
+  const auto& layer_stats = profiler.GetLayerStats();
+  ASSERT_EQ(layer_stats.size(), 3u);
+  EXPECT_EQ(layer_stats.at(mock1->original_layer_id()).stats.paint_count, 2u);
+  EXPECT_STREQ(layer_stats.at(mock2->original_layer_id()).type_name,
+               "MockLayer");
+  EXPECT_EQ(layer_stats.at(container->original_layer_id()).stats.total_time,
+            containers.total_time);
+
+  profiler.Reset();
+  EXPECT_EQ(profiler.GetFrameCount(), 0u);
+  EXPECT_TRUE(profiler.GetTypeStats().empty());
+  EXPECT_TRUE(profiler.GetLayerStats().empty());
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -41,6 +41,14 @@ void BackdropFilterLayer::Diff(DiffContext* context, const Layer* old_layer) {
 }
 
 void BackdropFilterLayer::Preroll(PrerollContext* context) {
+  if (context->backdrop_filters_disabled) {
+    // The children are painted as if there were no filter.
+    DlRect child_paint_bounds;
+    PrerollChildren(context, &child_paint_bounds);
+    set_paint_bounds(child_paint_bounds);
+    return;
+  }
+
   Layer::AutoPrerollSaveLayerState save =
       Layer::AutoPrerollSaveLayerState::Create(context, true, bool{filter_});
   if (filter_ && context->view_embedder != nullptr) {
@@ -58,6 +66,11 @@ void BackdropFilterLayer::Preroll(PrerollContext* context) {
 void BackdropFilterLayer::Paint(PaintContext& context) const {
   FML_DCHECK(needs_painting(context));
 
+  if (context.backdrop_filters_disabled) {
+    PaintChildren(context);
+    return;
+  }
+
   auto mutator = context.state_stack.save();
   mutator.applyBackdropFilter(paint_bounds(), filter_, blend_mode_,
                               backdrop_id_);
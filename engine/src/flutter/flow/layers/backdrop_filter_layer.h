@@ -21,6 +21,8 @@ class BackdropFilterLayer : public ContainerLayer {
 
   void Paint(PaintContext& context) const override;
 
+  const char* GetTypeName() const override { return "BackdropFilterLayer"; }
+
  private:
   std::shared_ptr<DlImageFilter> filter_;
   DlBlendMode blend_mode_;
@@ -13,20 +13,21 @@ const DlRect ClipPathLayer::clip_shape_bounds() const {
   return clip_shape().GetBounds();
 }
 
-void ClipPathLayer::ApplyClip(LayerStateStack::MutatorContext& mutator) const {
+void ClipPathLayer::ApplyClip(LayerStateStack::MutatorContext& mutator,
+                              LayerStateStack::ClipSnapshot* snapshot) const {
   bool is_aa = clip_behavior() != Clip::kHardEdge;
   DlRect rect;
   if (clip_shape().IsRect(&rect)) {
-    mutator.clipRect(rect, is_aa);
+    mutator.clipRect(rect, is_aa, snapshot);
   } else if (clip_shape().IsOval(&rect)) {
-    mutator.clipRRect(DlRoundRect::MakeOval(rect), is_aa);
+    mutator.clipRRect(DlRoundRect::MakeOval(rect), is_aa, snapshot);
   } else {
     DlRoundRect rrect;
     if (clip_shape().IsRoundRect(&rrect)) {
-      mutator.clipRRect(rrect, is_aa);
+      mutator.clipRRect(rrect, is_aa, snapshot);
     } else {
       clip_shape().WillRenderSkPath();
-      mutator.clipPath(clip_shape(), is_aa);
+      mutator.clipPath(clip_shape(), is_aa, snapshot);
     }
   }
 }
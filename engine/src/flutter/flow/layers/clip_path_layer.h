@@ -16,10 +16,13 @@ class ClipPathLayer : public ClipShapeLayer<DlPath> {
   explicit ClipPathLayer(const DlPath& clip_path,
                          Clip clip_behavior = Clip::kAntiAlias);
 
+  const char* GetTypeName() const override { return "ClipPathLayer"; }
+
  protected:
   const DlRect clip_shape_bounds() const override;
 
-  void ApplyClip(LayerStateStack::MutatorContext& mutator) const override;
+  void ApplyClip(LayerStateStack::MutatorContext& mutator,
+                 LayerStateStack::ClipSnapshot* snapshot) const override;
   void PushClipToEmbeddedNativeViewMutatorStack(
       ExternalViewEmbedder* view_embedder) const override;
 
@@ -13,8 +13,9 @@ const DlRect ClipRectLayer::clip_shape_bounds() const {
   return clip_shape();
 }
 
-void ClipRectLayer::ApplyClip(LayerStateStack::MutatorContext& mutator) const {
-  mutator.clipRect(clip_shape(), clip_behavior() != Clip::kHardEdge);
+void ClipRectLayer::ApplyClip(LayerStateStack::MutatorContext& mutator,
+                              LayerStateStack::ClipSnapshot* snapshot) const {
+  mutator.clipRect(clip_shape(), clip_behavior() != Clip::kHardEdge, snapshot);
 }
 
 void ClipRectLayer::PushClipToEmbeddedNativeViewMutatorStack(
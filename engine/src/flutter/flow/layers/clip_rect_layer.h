@@ -13,10 +13,13 @@ class ClipRectLayer : public ClipShapeLayer<DlRect> {
  public:
   ClipRectLayer(const DlRect& clip_rect, Clip clip_behavior);
 
+  const char* GetTypeName() const override { return "ClipRectLayer"; }
+
  protected:
   const DlRect clip_shape_bounds() const override;
 
-  void ApplyClip(LayerStateStack::MutatorContext& mutator) const override;
+  void ApplyClip(LayerStateStack::MutatorContext& mutator,
+                 LayerStateStack::ClipSnapshot* snapshot) const override;
   void PushClipToEmbeddedNativeViewMutatorStack(
       ExternalViewEmbedder* view_embedder) const override;
 
@@ -14,12 +14,13 @@ const DlRect ClipRRectLayer::clip_shape_bounds() const {
   return clip_shape().GetBounds();
 }
 
-void ClipRRectLayer::ApplyClip(LayerStateStack::MutatorContext& mutator) const {
+void ClipRRectLayer::ApplyClip(LayerStateStack::MutatorContext& mutator,
+                               LayerStateStack::ClipSnapshot* snapshot) const {
   bool is_aa = clip_behavior() != Clip::kHardEdge;
   if (clip_shape().IsRect()) {
-    mutator.clipRect(clip_shape().GetBounds(), is_aa);
+    mutator.clipRect(clip_shape().GetBounds(), is_aa, snapshot);
   } else {
-    mutator.clipRRect(clip_shape(), is_aa);
+    mutator.clipRRect(clip_shape(), is_aa, snapshot);
   }
 }
 
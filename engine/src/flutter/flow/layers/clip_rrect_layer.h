@@ -13,10 +13,13 @@ class ClipRRectLayer : public ClipShapeLayer<DlRoundRect> {
  public:
   ClipRRectLayer(const DlRoundRect& clip_rrect, Clip clip_behavior);
 
+  const char* GetTypeName() const override { return "ClipRRectLayer"; }
+
  protected:
   const DlRect clip_shape_bounds() const override;
 
-  void ApplyClip(LayerStateStack::MutatorContext& mutator) const override;
+  void ApplyClip(LayerStateStack::MutatorContext& mutator,
+                 LayerStateStack::ClipSnapshot* snapshot) const override;
   void PushClipToEmbeddedNativeViewMutatorStack(
       ExternalViewEmbedder* view_embedder) const override;
 
@@ -16,8 +16,10 @@ const DlRect ClipRSuperellipseLayer::clip_shape_bounds() const {
 }
 
 void ClipRSuperellipseLayer::ApplyClip(
-    LayerStateStack::MutatorContext& mutator) const {
-  mutator.clipRSuperellipse(clip_shape(), clip_behavior() != Clip::kHardEdge);
+    LayerStateStack::MutatorContext& mutator,
+    LayerStateStack::ClipSnapshot* snapshot) const {
+  mutator.clipRSuperellipse(clip_shape(), clip_behavior() != Clip::kHardEdge,
+                            snapshot);
 }
 
 void ClipRSuperellipseLayer::PushClipToEmbeddedNativeViewMutatorStack(
@@ -14,10 +14,13 @@ class ClipRSuperellipseLayer : public ClipShapeLayer<DlRoundSuperellipse> {
   ClipRSuperellipseLayer(const DlRoundSuperellipse& clip_rsuperellipse,
                          Clip clip_behavior);
 
+  const char* GetTypeName() const override { return "ClipRSuperellipseLayer"; }
+
  protected:
   const DlRect clip_shape_bounds() const override;
 
-  void ApplyClip(LayerStateStack::MutatorContext& mutator) const override;
+  void ApplyClip(LayerStateStack::MutatorContext& mutator,
+                 LayerStateStack::ClipSnapshot* snapshot) const override;
   void PushClipToEmbeddedNativeViewMutatorStack(
       ExternalViewEmbedder* view_embedder) const override;
 
@@ -62,7 +62,7 @@ class ClipShapeLayer : public CacheableContainerLayer {
     }
 
     auto mutator = context->state_stack.save();
-    ApplyClip(mutator);
+    ApplyClip(mutator, &preroll_clip_snapshot_);
 
     DlRect child_paint_bounds;
     PrerollChildren(context, &child_paint_bounds);
@@ -80,7 +80,7 @@ class ClipShapeLayer : public CacheableContainerLayer {
     FML_DCHECK(needs_painting(context));
 
     auto mutator = context.state_stack.save();
-    ApplyClip(mutator);
+    ApplyClip(mutator, nullptr);
 
     if (!UsesSaveLayer()) {
       PaintChildren(context);
@@ -111,7 +111,10 @@ class ClipShapeLayer : public CacheableContainerLayer {
 
  protected:
   virtual const DlRect clip_shape_bounds() const = 0;
-  virtual void ApplyClip(LayerStateStack::MutatorContext& mutator) const = 0;
+  // Applies the clip through the |mutator|, passing the |snapshot| on to
+  // it. The snapshot is null when painting.
+  virtual void ApplyClip(LayerStateStack::MutatorContext& mutator,
+                         LayerStateStack::ClipSnapshot* snapshot) const = 0;
   virtual void PushClipToEmbeddedNativeViewMutatorStack(
       ExternalViewEmbedder* view_embedder) const = 0;
   virtual ~ClipShapeLayer() = default;
@@ -122,6 +125,10 @@ class ClipShapeLayer : public CacheableContainerLayer {
  private:
   const ClipShape clip_shape_;
   Clip clip_behavior_;
+  // The clip as it was resolved during the last preroll of this layer, so
+  // that it can be restored when the layer is retained under an unchanged
+  // parent state.
+  LayerStateStack::ClipSnapshot preroll_clip_snapshot_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ClipShapeLayer);
 };
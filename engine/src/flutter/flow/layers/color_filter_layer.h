@@ -21,6 +21,8 @@ class ColorFilterLayer : public CacheableContainerLayer {
 
   void Paint(PaintContext& context) const override;
 
+  const char* GetTypeName() const override { return "ColorFilterLayer"; }
+
  private:
   std::shared_ptr<const DlColorFilter> filter_;
 
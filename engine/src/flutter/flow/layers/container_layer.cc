@@ -4,10 +4,29 @@
 
 #include "flutter/flow/layers/container_layer.h"
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <optional>
 
+#include "flutter/display_list/utils/dl_accumulation_rect.h"
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
+
 namespace flutter {
 
+// The number of children below which prerolling them in parallel costs
+// more in task overhead than it saves.
+static constexpr size_t kMinParallelPrerollChildren = 16;
+// The children are split into at most |kMaxParallelPrerollChunks| runs of
+// consecutive children, each of which is prerolled by a single thread.
+static constexpr size_t kMinParallelPrerollChunkSize = 8;
+static constexpr size_t kMaxParallelPrerollChunks = 8;
+// The number of children whose paint bounds are compared individually to
+// prove that they do not overlap, so that they can apply inherited state
+// such as opacity even when arranged in a grid.
+static constexpr size_t kMaxDisjointChildren = 64;
+
 ContainerLayer::ContainerLayer() {}
 
 void ContainerLayer::Diff(DiffContext* context, const Layer* old_layer) {
@@ -129,24 +148,39 @@ void ContainerLayer::PrerollChildren(PrerollContext* context,
   bool child_has_platform_view = false;
   bool child_has_texture_layer = false;
   bool all_renderable_state_flags = LayerStateStack::kCallerCanApplyAnything;
+  AccumulationRect children_bounds(kMaxDisjointChildren);
 
-  for (auto& layer : layers_) {
-    // Reset context->has_platform_view and context->has_texture_layer to false
-    // so that layers aren't treated as if they have a platform view or texture
-    // layer based on one being previously found in a sibling tree.
-    context->has_platform_view = false;
-    context->has_texture_layer = false;
+  std::vector<ChildPrerollResult> parallel_results;
+  bool prerolled_in_parallel =
+      PrerollChildrenInParallel(context, &parallel_results);
 
-    // Initialize the renderable state flags to false to force the layer to
-    // opt-in to applying state attributes during its |Preroll|
-    context->renderable_state_flags = 0;
+  for (size_t i = 0; i < layers_.size(); i++) {
+    const std::shared_ptr<Layer>& layer = layers_[i];
+    if (prerolled_in_parallel) {
+      const ChildPrerollResult& result = parallel_results[i];
+      context->has_platform_view = result.has_platform_view;
+      context->has_texture_layer = result.has_texture_layer;
+      context->renderable_state_flags = result.renderable_state_flags;
+    } else {
+      // Reset context->has_platform_view and context->has_texture_layer to
+      // false so that layers aren't treated as if they have a platform view or
+      // texture layer based on one being previously found in a sibling tree.
+      context->has_platform_view = false;
+      context->has_texture_layer = false;
+
+      // Initialize the renderable state flags to false to force the layer to
+      // opt-in to applying state attributes during its |Preroll|
+      context->renderable_state_flags = 0;
 
-    layer->Preroll(context);
+      layer->PrerollSubtree(context);
+    }
 
     all_renderable_state_flags &= context->renderable_state_flags;
-    if (child_paint_bounds->IntersectsWithRect(layer->paint_bounds())) {
-      // This will allow inheritance by a linear sequence of non-overlapping
-      // children, but will fail with a grid or other arbitrary 2D layout.
+    children_bounds.accumulate(layer->paint_bounds());
+    if (children_bounds.overlap_detected()) {
+      // This allows inheritance by non-overlapping children in a linear
+      // sequence as well as, up to |kMaxDisjointChildren| of them, in a
+      // grid or other arbitrary 2D layout.
       // See https://github.com/flutter/flutter/issues/93899
       all_renderable_state_flags = 0;
     }
@@ -166,6 +200,123 @@ void ContainerLayer::PrerollChildren(PrerollContext* context,
   set_child_paint_bounds(*child_paint_bounds);
 }
 
+bool ContainerLayer::MayHavePlatformView() const {
+  return std::any_of(layers_.begin(), layers_.end(),
+                     [](const std::shared_ptr<Layer>& layer) {
+                       return layer->MayHavePlatformView();
+                     });
+}
+
+bool ContainerLayer::PrerollChildrenInParallel(
+    PrerollContext* context,
+    std::vector<ChildPrerollResult>* results) {
+  if (!context->preroll_task_runner ||
+      layers_.size() < kMinParallelPrerollChildren ||
+      MayHavePlatformView()) {
+    return false;
+  }
+  TRACE_EVENT0("flutter", "ContainerLayer::PrerollChildrenInParallel");
+
+  // Every chunk of children is prerolled into its own context with its own
+  // state stack and list of raster cache entries. The entries are appended
+  // to the parent list in order afterwards so that it ends up the same as
+  // if the children had been prerolled serially.
+  size_t chunk_count =
+      std::min(layers_.size() / kMinParallelPrerollChunkSize,
+               kMaxParallelPrerollChunks);
+  size_t chunk_size = (layers_.size() + chunk_count - 1) / chunk_count;
+  struct ChunkResult {
+    std::vector<RasterCacheItem*> raster_cached_entries;
+    bool surface_needs_readback = false;
+  };
+  std::vector<ChunkResult> chunk_results(chunk_count);
+  results->resize(layers_.size());
+
+  DlMatrix matrix = context->state_stack.matrix();
+  DlRect device_cull_rect = context->state_stack.device_cull_rect();
+  auto preroll_chunk = [&](size_t chunk) {
+    LayerStateStack state_stack;
+    state_stack.set_preroll_delegate(device_cull_rect, matrix);
+    ChunkResult& chunk_result = chunk_results[chunk];
+    PrerollContext chunk_context = {
+#if !SLIMPELLER
+        .raster_cache = context->raster_cache,
+#endif  //  !SLIMPELLER
+        .gr_context = context->gr_context,
+        .view_embedder = context->view_embedder,
+        .state_stack = state_stack,
+        .dst_color_space = context->dst_color_space,
+        .surface_needs_readback = context->surface_needs_readback,
+        .raster_time = context->raster_time,
+        .ui_time = context->ui_time,
+        .texture_registry = context->texture_registry,
+        .impeller_enabled = context->impeller_enabled,
+        .raster_cached_entries = context->raster_cached_entries
+                                     ? &chunk_result.raster_cached_entries
+                                     : nullptr,
+        .backdrop_filters_disabled = context->backdrop_filters_disabled,
+    };
+    size_t end = std::min(layers_.size(), (chunk + 1) * chunk_size);
+    for (size_t i = chunk * chunk_size; i < end; i++) {
+      chunk_context.has_platform_view = false;
+      chunk_context.has_texture_layer = false;
+      chunk_context.renderable_state_flags = 0;
+      layers_[i]->PrerollSubtree(&chunk_context);
+      (*results)[i] = {
+          .renderable_state_flags = chunk_context.renderable_state_flags,
+          .has_platform_view = chunk_context.has_platform_view,
+          .has_texture_layer = chunk_context.has_texture_layer,
+      };
+    }
+    chunk_result.surface_needs_readback = chunk_context.surface_needs_readback;
+  };
+
+  // The workers and the raster thread claim chunks until none are left, so
+  // the raster thread never waits on a worker that has not started yet. A
+  // worker may only get to run once this method has returned, so the state
+  // it accesses before claiming a chunk is shared rather than on the stack.
+  struct ParallelPreroll {
+    ParallelPreroll(size_t chunk_count,
+                    std::function<void(size_t)> preroll_chunk)
+        : chunk_count(chunk_count),
+          preroll_chunk(std::move(preroll_chunk)),
+          latch(chunk_count) {}
+
+    void ClaimChunks() {
+      for (size_t chunk = next_chunk++; chunk < chunk_count;
+           chunk = next_chunk++) {
+        preroll_chunk(chunk);
+        latch.CountDown();
+      }
+    }
+
+    const size_t chunk_count;
+    const std::function<void(size_t)> preroll_chunk;
+    std::atomic_size_t next_chunk{0};
+    fml::CountDownLatch latch;
+  };
+  auto parallel_preroll =
+      std::make_shared<ParallelPreroll>(chunk_count, preroll_chunk);
+  for (size_t i = 1; i < chunk_count; i++) {
+    context->preroll_task_runner->PostTask(
+        [parallel_preroll]() { parallel_preroll->ClaimChunks(); });
+  }
+  parallel_preroll->ClaimChunks();
+  parallel_preroll->latch.Wait();
+
+  for (const ChunkResult& chunk_result : chunk_results) {
+    if (context->raster_cached_entries) {
+      context->raster_cached_entries->insert(
+          context->raster_cached_entries->end(),
+          chunk_result.raster_cached_entries.begin(),
+          chunk_result.raster_cached_entries.end());
+    }
+    context->surface_needs_readback =
+        context->surface_needs_readback || chunk_result.surface_needs_readback;
+  }
+  return true;
+}
+
 void ContainerLayer::PaintChildren(PaintContext& context) const {
   // We can no longer call FML_DCHECK here on the needs_painting(context)
   // condition as that test is only valid for the PaintContext that
@@ -182,6 +333,8 @@ void ContainerLayer::PaintChildren(PaintContext& context) const {
   // and the trace event on this common function has a small overhead.
   for (auto& layer : layers_) {
     if (layer->needs_painting(context)) {
+      LayerPaintProfiler::ScopedPaint profile(context.paint_profiler,
+                                              layer.get());
       layer->Paint(context);
     }
   }
@@ -23,6 +23,10 @@ class ContainerLayer : public Layer {
   void Preroll(PrerollContext* context) override;
   void Paint(PaintContext& context) const override;
 
+  const char* GetTypeName() const override { return "ContainerLayer"; }
+
+  bool MayHavePlatformView() const override;
+
   const std::vector<std::shared_ptr<Layer>>& layers() const { return layers_; }
 
   virtual void DiffChildren(DiffContext* context,
@@ -48,6 +52,19 @@ class ContainerLayer : public Layer {
   void PrerollChildren(PrerollContext* context, DlRect* child_paint_bounds);
 
  private:
+  // The effects that prerolling a child had on the |PrerollContext|.
+  struct ChildPrerollResult {
+    int renderable_state_flags = 0;
+    bool has_platform_view = false;
+    bool has_texture_layer = false;
+  };
+
+  // Prerolls the children on the |PrerollContext::preroll_task_runner| if
+  // there are enough of them to be worth it and none of them embeds a
+  // platform view. Returns false, without prerolling any child, otherwise.
+  bool PrerollChildrenInParallel(PrerollContext* context,
+                                 std::vector<ChildPrerollResult>* results);
+
   std::vector<std::shared_ptr<Layer>> layers_;
   DlRect child_paint_bounds_;
   int children_renderable_state_flags_ = 0;
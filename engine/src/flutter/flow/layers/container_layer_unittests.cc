@@ -4,11 +4,13 @@
 
 #include "flutter/flow/layers/container_layer.h"
 
+#include "flutter/flow/layers/backdrop_filter_layer.h"
 #include "flutter/flow/layers/layer.h"
 #include "flutter/flow/layers/layer_tree.h"
 #include "flutter/flow/testing/diff_context_test.h"
 #include "flutter/flow/testing/layer_test.h"
 #include "flutter/flow/testing/mock_layer.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "gtest/gtest.h"
 
@@ -244,6 +246,160 @@ TEST_F(ContainerLayerTest, NeedsSystemComposite) {
   EXPECT_TRUE(DisplayListsEQ_Verbose(display_list(), expected_builder.Build()));
 }
 
+TEST_F(ContainerLayerTest, RetainedSubtreeReusesPrerollResults) {
+  DlPath child_path = DlPath::MakeRectLTRB(5.0f, 6.0f, 20.5f, 21.5f);
+  DlPath new_child_path = DlPath::MakeRectLTRB(1.0f, 2.0f, 3.0f, 4.0f);
+  auto mock_layer = std::make_shared<MockLayer>(child_path);
+  mock_layer->set_fake_opacity_compatible(true);
+  auto retained_layer = std::make_shared<ContainerLayer>();
+  retained_layer->Add(mock_layer);
+  retained_layer->set_subtree_is_retained(true);
+  auto root = std::make_shared<ContainerLayer>();
+  root->Add(retained_layer);
+
+  root->Preroll(preroll_context());
+  EXPECT_EQ(root->paint_bounds(), child_path.GetBounds());
+  EXPECT_EQ(preroll_context()->renderable_state_flags,
+            LayerStateStack::kCallerCanApplyOpacity);
+
+  // The retained subtree is not visited again, so the changes to the mock
+  // layer are not observed.
+  mock_layer->set_fake_paint_path(new_child_path);
+  mock_layer->set_fake_has_texture_layer(true);
+  preroll_context()->renderable_state_flags = 0;
+  root->Preroll(preroll_context());
+  EXPECT_EQ(root->paint_bounds(), child_path.GetBounds());
+  EXPECT_EQ(retained_layer->paint_bounds(), child_path.GetBounds());
+  EXPECT_FALSE(preroll_context()->has_texture_layer);
+  EXPECT_EQ(preroll_context()->renderable_state_flags,
+            LayerStateStack::kCallerCanApplyOpacity);
+
+  // A different transform invalidates the results of the last preroll.
+  DlMatrix transform = DlMatrix::MakeTranslation({10.0f, 10.0f});
+  preroll_context()->state_stack.set_preroll_delegate(transform);
+  preroll_context()->has_texture_layer = false;
+  root->Preroll(preroll_context());
+  EXPECT_EQ(root->paint_bounds(), new_child_path.GetBounds());
+  EXPECT_EQ(mock_layer->parent_matrix(), transform);
+  EXPECT_TRUE(preroll_context()->has_texture_layer);
+}
+
+TEST_F(ContainerLayerTest, SubtreeThatIsNotRetainedIsAlwaysPrerolled) {
+  DlPath child_path = DlPath::MakeRectLTRB(5.0f, 6.0f, 20.5f, 21.5f);
+  DlPath new_child_path = DlPath::MakeRectLTRB(1.0f, 2.0f, 3.0f, 4.0f);
+  auto mock_layer = std::make_shared<MockLayer>(child_path);
+  auto child_layer = std::make_shared<ContainerLayer>();
+  child_layer->Add(mock_layer);
+  auto root = std::make_shared<ContainerLayer>();
+  root->Add(child_layer);
+
+  root->Preroll(preroll_context());
+  EXPECT_EQ(root->paint_bounds(), child_path.GetBounds());
+
+  mock_layer->set_fake_paint_path(new_child_path);
+  root->Preroll(preroll_context());
+  EXPECT_EQ(root->paint_bounds(), new_child_path.GetBounds());
+}
+
+TEST_F(ContainerLayerTest, RetainedSubtreeWithPlatformViewIsAlwaysPrerolled) {
+  DlPath child_path = DlPath::MakeRectLTRB(5.0f, 6.0f, 20.5f, 21.5f);
+  DlPath new_child_path = DlPath::MakeRectLTRB(1.0f, 2.0f, 3.0f, 4.0f);
+  auto mock_layer = std::make_shared<MockLayer>(child_path);
+  mock_layer->set_fake_has_platform_view(true);
+  auto retained_layer = std::make_shared<ContainerLayer>();
+  retained_layer->Add(mock_layer);
+  retained_layer->set_subtree_is_retained(true);
+  auto root = std::make_shared<ContainerLayer>();
+  root->Add(retained_layer);
+
+  root->Preroll(preroll_context());
+  EXPECT_TRUE(preroll_context()->has_platform_view);
+
+  mock_layer->set_fake_paint_path(new_child_path);
+  preroll_context()->has_platform_view = false;
+  root->Preroll(preroll_context());
+  EXPECT_EQ(root->paint_bounds(), new_child_path.GetBounds());
+  EXPECT_TRUE(preroll_context()->has_platform_view);
+}
+
+TEST_F(ContainerLayerTest, ParallelPrerollMatchesSerialPreroll) {
+  constexpr int kChildCount = 40;
+  auto make_layer = [](std::vector<std::shared_ptr<MockLayer>>* children) {
+    auto layer = std::make_shared<ContainerLayer>();
+    for (int i = 0; i < kChildCount; i++) {
+      DlPath path = DlPath::MakeRectLTRB(i * 10.0f, 0.0f, i * 10.0f + 5.0f,
+                                         5.0f + i);
+      auto child = MockLayer::MakeOpacityCompatible(path);
+      child->set_fake_has_texture_layer(i == 17);
+      child->set_fake_reads_surface(i == 33);
+      children->push_back(child);
+      layer->Add(child);
+    }
+    return layer;
+  };
+  DlMatrix transform = DlMatrix::MakeTranslation({4.0f, 8.0f});
+  preroll_context()->state_stack.set_preroll_delegate(transform);
+
+  std::vector<std::shared_ptr<MockLayer>> serial_children;
+  auto serial_layer = make_layer(&serial_children);
+  serial_layer->Preroll(preroll_context());
+  int serial_flags = preroll_context()->renderable_state_flags;
+  EXPECT_TRUE(preroll_context()->has_texture_layer);
+  EXPECT_TRUE(preroll_context()->surface_needs_readback);
+
+  auto loop = fml::ConcurrentMessageLoop::Create(4);
+  auto task_runner = loop->GetTaskRunner();
+  preroll_context()->preroll_task_runner = task_runner.get();
+  preroll_context()->has_texture_layer = false;
+  preroll_context()->surface_needs_readback = false;
+  preroll_context()->renderable_state_flags = 0;
+
+  std::vector<std::shared_ptr<MockLayer>> parallel_children;
+  auto parallel_layer = make_layer(&parallel_children);
+  parallel_layer->Preroll(preroll_context());
+  EXPECT_EQ(preroll_context()->renderable_state_flags, serial_flags);
+  EXPECT_TRUE(preroll_context()->has_texture_layer);
+  EXPECT_TRUE(preroll_context()->surface_needs_readback);
+  EXPECT_EQ(parallel_layer->paint_bounds(), serial_layer->paint_bounds());
+  EXPECT_EQ(parallel_layer->children_renderable_state_flags(),
+            serial_layer->children_renderable_state_flags());
+  for (int i = 0; i < kChildCount; i++) {
+    EXPECT_EQ(parallel_children[i]->paint_bounds(),
+              serial_children[i]->paint_bounds());
+    EXPECT_EQ(parallel_children[i]->parent_matrix(), transform);
+  }
+  preroll_context()->preroll_task_runner = nullptr;
+}
+
+TEST_F(ContainerLayerTest, ParallelPrerollKeepsBackdropFiltersDisabled) {
+  constexpr int kChildCount = 40;
+  auto layer = std::make_shared<ContainerLayer>();
+  std::vector<std::shared_ptr<BackdropFilterLayer>> backdrops;
+  for (int i = 0; i < kChildCount; i++) {
+    auto backdrop = std::make_shared<BackdropFilterLayer>(
+        DlImageFilter::MakeBlur(5, 5, DlTileMode::kClamp),
+        DlBlendMode::kSrcOver);
+    backdrop->Add(std::make_shared<MockLayer>(
+        DlPath::MakeRectLTRB(i * 10.0f, 0.0f, i * 10.0f + 5.0f, 5.0f)));
+    backdrops.push_back(backdrop);
+    layer->Add(backdrop);
+  }
+
+  auto loop = fml::ConcurrentMessageLoop::Create(4);
+  auto task_runner = loop->GetTaskRunner();
+  preroll_context()->preroll_task_runner = task_runner.get();
+  preroll_context()->backdrop_filters_disabled = true;
+
+  layer->Preroll(preroll_context());
+  EXPECT_FALSE(preroll_context()->surface_needs_readback);
+  for (int i = 0; i < kChildCount; i++) {
+    EXPECT_EQ(backdrops[i]->paint_bounds(),
+              DlRect::MakeLTRB(i * 10.0f, 0.0f, i * 10.0f + 5.0f, 5.0f));
+  }
+  preroll_context()->backdrop_filters_disabled = false;
+  preroll_context()->preroll_task_runner = nullptr;
+}
+
 TEST_F(ContainerLayerTest, RasterCacheTest) {
   // LTRB
   const DlPath child_path1 = DlPath::MakeRectLTRB(5.0f, 6.0f, 20.5f, 21.5f);
@@ -515,6 +671,28 @@ TEST_F(ContainerLayerTest, OpacityInheritance) {
   EXPECT_EQ(context->renderable_state_flags, 0);
 }
 
+TEST_F(ContainerLayerTest, OpacityInheritanceForGridOfChildren) {
+  auto container = std::make_shared<ContainerLayer>();
+  for (int row = 0; row < 3; row++) {
+    for (int column = 0; column < 3; column++) {
+      container->Add(MockLayer::MakeOpacityCompatible(DlPath::MakeRectXYWH(
+          column * 20.0f, row * 20.0f, 15.0f, 15.0f)));
+    }
+  }
+
+  // The children of the second row intersect the bounds of the first row,
+  // but none of the children overlap each other.
+  PrerollContext* context = preroll_context();
+  container->Preroll(context);
+  EXPECT_EQ(context->renderable_state_flags,
+            LayerStateStack::kCallerCanApplyOpacity);
+
+  container->Add(MockLayer::MakeOpacityCompatible(
+      DlPath::MakeRectXYWH(10.0f, 10.0f, 15.0f, 15.0f)));
+  container->Preroll(context);
+  EXPECT_EQ(context->renderable_state_flags, 0);
+}
+
 TEST_F(ContainerLayerTest, CollectionCacheableLayer) {
   DlPath child_path = DlPath::MakeRectLTRB(5.0f, 6.0f, 20.5f, 21.5f);
   DlPaint child_paint = DlPaint(DlColor::kGreen());
@@ -38,6 +38,8 @@ class DisplayListLayer : public Layer {
 
   void Paint(PaintContext& context) const override;
 
+  const char* GetTypeName() const override { return "DisplayListLayer"; }
+
 #if !SLIMPELLER
   const DisplayListRasterCacheItem* raster_cache_item() const {
     return display_list_raster_cache_item_.get();
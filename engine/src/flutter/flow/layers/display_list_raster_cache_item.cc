@@ -21,11 +21,16 @@
 
 namespace flutter {
 
+// When |impeller_limits| is provided the display list is headed for the
+// texture backed cache used under Impeller, where the decision also weighs
+// the device area covered with the given |matrix|.
 static bool IsDisplayListWorthRasterizing(
     const DisplayList* display_list,
     bool will_change,
     bool is_complex,
-    DisplayListComplexityCalculator* complexity_calculator) {
+    DisplayListComplexityCalculator* complexity_calculator,
+    const RasterCacheUtil::ImpellerCacheLimits* impeller_limits,
+    const SkMatrix& matrix) {
   if (will_change) {
     // If the display list is going to change in the future, there is no point
     // in doing to extra work to rasterize.
@@ -39,6 +44,21 @@ static bool IsDisplayListWorthRasterizing(
     return false;
   }
 
+  if (impeller_limits) {
+    SkRect device_bounds = RasterCacheUtil::GetRoundedOutDeviceBounds(
+        ToSkRect(display_list->GetBounds()), matrix);
+    if (is_complex) {
+      // Complex display lists are cached whenever they fit in a texture.
+      return RasterCacheUtil::FitsImpellerCacheTexture(device_bounds,
+                                                       *impeller_limits);
+    }
+    unsigned int complexity_score =
+        complexity_calculator->Compute(display_list);
+    return complexity_calculator->ShouldBeCached(complexity_score) &&
+           RasterCacheUtil::IsWorthCachingWithImpeller(
+               complexity_score, device_bounds, *impeller_limits);
+  }
+
   if (is_complex) {
     // The caller seems to have extra information about the display list and
     // thinks the display list is always worth rasterizing.
@@ -74,20 +94,30 @@ std::unique_ptr<DisplayListRasterCacheItem> DisplayListRasterCacheItem::Make(
 void DisplayListRasterCacheItem::PrerollSetup(PrerollContext* context,
                                               const DlMatrix& matrix) {
   cache_state_ = CacheState::kNone;
-  DisplayListComplexityCalculator* complexity_calculator =
-      context->gr_context ? DisplayListComplexityCalculator::GetForBackend(
-                                context->gr_context->backend())
-                          : DisplayListComplexityCalculator::GetForSoftware();
+  DisplayListComplexityCalculator* complexity_calculator;
+  const RasterCacheUtil::ImpellerCacheLimits* impeller_limits = nullptr;
+  if (context->impeller_enabled) {
+    complexity_calculator = DisplayListComplexityCalculator::GetForImpeller();
+    if (context->raster_cache) {
+      impeller_limits = &context->raster_cache->impeller_cache_limits();
+    }
+  } else if (context->gr_context) {
+    complexity_calculator = DisplayListComplexityCalculator::GetForBackend(
+        context->gr_context->backend());
+  } else {
+    complexity_calculator = DisplayListComplexityCalculator::GetForSoftware();
+  }
+
+  transformation_matrix_ = ToSkMatrix(matrix);
+  transformation_matrix_.preTranslate(offset_.x(), offset_.y());
 
   if (!IsDisplayListWorthRasterizing(display_list(), will_change_, is_complex_,
-                                     complexity_calculator)) {
+                                     complexity_calculator, impeller_limits,
+                                     transformation_matrix_)) {
     // We only deal with display lists that are worthy of rasterization.
     return;
   }
 
-  transformation_matrix_ = ToSkMatrix(matrix);
-  transformation_matrix_.preTranslate(offset_.x(), offset_.y());
-
   if (!transformation_matrix_.invert(nullptr)) {
     // The matrix was singular. No point in going further.
     return;
@@ -168,6 +198,7 @@ bool DisplayListRasterCacheItem::TryToPrepareRasterCache(
       .matrix             = transformation_matrix_,
       .logical_rect       = bounds,
       .flow_type          = flow_type,
+      .aiks_context       = context.aiks_context,
       // clang-format on
   };
   return context.raster_cache->UpdateCacheEntry(
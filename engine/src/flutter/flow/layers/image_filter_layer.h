@@ -21,6 +21,8 @@ class ImageFilterLayer : public CacheableContainerLayer {
 
   void Paint(PaintContext& context) const override;
 
+  const char* GetTypeName() const override { return "ImageFilterLayer"; }
+
  private:
   DlPoint offset_;
   const std::shared_ptr<DlImageFilter> filter_;
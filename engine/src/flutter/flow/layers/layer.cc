@@ -21,6 +21,57 @@ uint64_t Layer::NextUniqueID() {
   return id;
 }
 
+void Layer::PrerollSubtree(PrerollContext* context) {
+  LayerStateStack& state_stack = context->state_stack;
+#if !SLIMPELLER
+  const void* raster_cache = context->raster_cache;
+#else   // !SLIMPELLER
+  const void* raster_cache = nullptr;
+#endif  // !SLIMPELLER
+  if (subtree_is_retained_ && retained_preroll_.has_value()) {
+    const RetainedPreroll& retained = retained_preroll_.value();
+    if (retained.raster_cache == raster_cache &&
+        retained.backdrop_filters_disabled ==
+            context->backdrop_filters_disabled &&
+        retained.matrix == state_stack.matrix() &&
+        retained.device_cull_rect == state_stack.device_cull_rect()) {
+      context->renderable_state_flags = retained.renderable_state_flags;
+      context->has_texture_layer = retained.has_texture_layer;
+      if (retained.surface_needs_readback) {
+        context->surface_needs_readback = true;
+      }
+      return;
+    }
+  }
+
+  retained_preroll_.reset();
+  bool needed_readback = context->surface_needs_readback;
+  size_t cache_entry_count = context->raster_cached_entries
+                                 ? context->raster_cached_entries->size()
+                                 : 0u;
+  DlMatrix matrix = state_stack.matrix();
+  DlRect device_cull_rect = state_stack.device_cull_rect();
+
+  Preroll(context);
+
+  // Whether the subtree sets |surface_needs_readback| is only known if the
+  // flag was clear to begin with.
+  if (context->has_platform_view || needed_readback ||
+      (context->raster_cached_entries &&
+       context->raster_cached_entries->size() != cache_entry_count)) {
+    return;
+  }
+  retained_preroll_ = RetainedPreroll{
+      .matrix = matrix,
+      .device_cull_rect = device_cull_rect,
+      .raster_cache = raster_cache,
+      .backdrop_filters_disabled = context->backdrop_filters_disabled,
+      .renderable_state_flags = context->renderable_state_flags,
+      .has_texture_layer = context->has_texture_layer,
+      .surface_needs_readback = context->surface_needs_readback,
+  };
+}
+
 Layer::AutoPrerollSaveLayerState::AutoPrerollSaveLayerState(
     PrerollContext* preroll_context,
     bool save_layer_is_active,
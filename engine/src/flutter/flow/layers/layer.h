@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <unordered_set>
 #include <vector>
 
@@ -15,6 +16,7 @@
 #include "flutter/display_list/dl_canvas.h"
 #include "flutter/flow/diff_context.h"
 #include "flutter/flow/embedded_views.h"
+#include "flutter/flow/layer_paint_profiler.h"
 #include "flutter/flow/layers/layer_state_stack.h"
 #include "flutter/flow/raster_cache.h"
 #include "flutter/flow/stopwatch.h"
@@ -25,6 +27,10 @@
 
 class GrDirectContext;
 
+namespace fml {
+class ConcurrentTaskRunner;
+}  // namespace fml
+
 namespace flutter {
 
 namespace testing {
@@ -42,6 +48,9 @@ static constexpr DlRect kGiantRect = DlRect::MakeLTRB(-1E9F, -1E9F, 1E9F, 1E9F);
 // This should be an exact copy of the Clip enum in painting.dart.
 enum Clip { kNone, kHardEdge, kAntiAlias, kAntiAliasWithSaveLayer };
 
+// The per-frame fields of a |PrerollContext| must also be forwarded to the
+// contexts that |ContainerLayer::PrerollChildrenInParallel| creates, which
+// can't copy the context since they have their own |state_stack|.
 struct PrerollContext {
   NOT_SLIMPELLER(RasterCache* raster_cache);
   GrDirectContext* gr_context;
@@ -62,6 +71,10 @@ struct PrerollContext {
   // presence of a texture layer during Preroll.
   bool has_texture_layer = false;
 
+  // Whether the frame is rendered by Impeller, which changes how the raster
+  // cache scores and renders its entries.
+  bool impeller_enabled = false;
+
   // The list of flags that describe which rendering state attributes
   // (such as opacity, ColorFilter, ImageFilter) a given layer can
   // render itself without requiring the parent to perform a protective
@@ -73,6 +86,14 @@ struct PrerollContext {
   int renderable_state_flags = 0;
 
   std::vector<RasterCacheItem*>* raster_cached_entries;
+
+  // The worker pool that |ContainerLayer|s may preroll large sets of
+  // children on in parallel. Children are prerolled serially when null.
+  fml::ConcurrentTaskRunner* preroll_task_runner = nullptr;
+
+  // Whether backdrop filters are skipped to save raster time. See
+  // |CompositorContext::SetBackdropFiltersDisabled|.
+  bool backdrop_filters_disabled = false;
 };
 
 struct PaintContext {
@@ -106,6 +127,14 @@ struct PaintContext {
 
   bool impeller_enabled = false;
   impeller::AiksContext* aiks_context;
+
+  // Attributes the time spent painting to individual layers, if layer paint
+  // profiling is enabled.
+  LayerPaintProfiler* paint_profiler = nullptr;
+
+  // Whether backdrop filters are skipped to save raster time. See
+  // |CompositorContext::SetBackdropFiltersDisabled|.
+  bool backdrop_filters_disabled = false;
 };
 
 // Represents a single composited layer. Created on the UI thread but then
@@ -154,6 +183,22 @@ class Layer {
 
   virtual void Preroll(PrerollContext* context) = 0;
 
+  // Whether prerolling this subtree may embed a platform view through the
+  // |ExternalViewEmbedder|. Subtrees that do must be prerolled in order on
+  // the raster thread.
+  virtual bool MayHavePlatformView() const { return false; }
+
+  // Prerolls this layer on behalf of a parent that is prerolling its
+  // children.
+  //
+  // If the subtree is retained and is prerolled with the same matrix, cull
+  // rect and raster cache as the last time, the results of that preroll,
+  // which are still stored in the layers of the subtree, are reused without
+  // visiting the subtree at all. Subtrees that embed platform views or
+  // register raster cache entries are always prerolled since those side
+  // effects have to happen on every frame.
+  void PrerollSubtree(PrerollContext* context);
+
   // Used during Preroll by layers that employ a saveLayer to manage the
   // PrerollContext settings with values affected by the saveLayer mechanism.
   // This object must be created before calling Preroll on the children to
@@ -184,11 +229,21 @@ class Layer {
 
   virtual void PaintChildren(PaintContext& context) const { FML_DCHECK(false); }
 
+  // The name of the concrete type of this layer used to attribute the time
+  // spent painting it, see |LayerPaintProfiler|.
+  virtual const char* GetTypeName() const { return "Layer"; }
+
   bool subtree_has_platform_view() const { return subtree_has_platform_view_; }
   void set_subtree_has_platform_view(bool value) {
     subtree_has_platform_view_ = value;
   }
 
+  // Whether the framework guarantees that this subtree has not changed since
+  // it was last prerolled, which is the case for the layers that
+  // |SceneBuilder.addRetained| adds back into a scene.
+  bool subtree_is_retained() const { return subtree_is_retained_; }
+  void set_subtree_is_retained(bool value) { subtree_is_retained_ = value; }
+
   // Returns the paint bounds in the layer's local coordinate system
   // as determined during Preroll().  The bounds should include any
   // transform, clip or distortions performed by the layer itself,
@@ -252,10 +307,24 @@ class Layer {
   virtual const testing::MockLayer* as_mock_layer() const { return nullptr; }
 
  private:
+  // The state a subtree was last prerolled with by |PrerollSubtree| and the
+  // effects that preroll had on the |PrerollContext|.
+  struct RetainedPreroll {
+    DlMatrix matrix;
+    DlRect device_cull_rect;
+    const void* raster_cache;
+    bool backdrop_filters_disabled;
+    int renderable_state_flags;
+    bool has_texture_layer;
+    bool surface_needs_readback;
+  };
+
   DlRect paint_bounds_;
   uint64_t unique_id_;
   uint64_t original_layer_id_;
   bool subtree_has_platform_view_ = false;
+  bool subtree_is_retained_ = false;
+  std::optional<RetainedPreroll> retained_preroll_;
 
   static uint64_t NextUniqueID();
 
@@ -119,6 +119,8 @@ bool Rasterize(RasterCacheItem::CacheState cache_state,
       .ui_time                       = paint_context.ui_time,
       .texture_registry              = paint_context.texture_registry,
       .raster_cache                  = paint_context.raster_cache,
+      .impeller_enabled              = paint_context.impeller_enabled,
+      .aiks_context                  = paint_context.aiks_context,
       // clang-format on
   };
 
@@ -154,6 +156,7 @@ bool LayerRasterCacheItem::TryToPrepareRasterCache(const PaintContext& context,
           .matrix             = matrix_,
           .logical_rect       = *paint_bounds,
           .flow_type          = flow_type,
+          .aiks_context       = context.aiks_context,
           // clang-format on
       };
       const auto& id = maybe_id.value();
@@ -193,6 +193,11 @@ class PrerollDelegate : public LayerStateStack::Delegate {
     state().clipPath(path, op, is_aa);
   }
 
+  bool can_restore_device_cull_rect() const override { return true; }
+  void restoreDeviceCullRect(const DlRect& cull_rect) override {
+    state().resetDeviceCullRect(cull_rect);
+  }
+
  private:
   DisplayListMatrixClipState& state() { return save_stack_.back(); }
   const DisplayListMatrixClipState& state() const { return save_stack_.back(); }
@@ -591,29 +596,36 @@ void MutatorContext::integralTransform() {
   layer_state_stack_->push_integral_transform();
 }
 
-void MutatorContext::clipRect(const DlRect& rect, bool is_aa) {
+void MutatorContext::clipRect(const DlRect& rect,
+                              bool is_aa,
+                              ClipSnapshot* snapshot) {
   layer_state_stack_->maybe_save_layer_for_clip(save_needed_);
   save_needed_ = false;
-  layer_state_stack_->push_clip_rect(rect, is_aa);
+  layer_state_stack_->push_clip_rect(rect, is_aa, snapshot);
 }
 
-void MutatorContext::clipRRect(const DlRoundRect& rrect, bool is_aa) {
+void MutatorContext::clipRRect(const DlRoundRect& rrect,
+                               bool is_aa,
+                               ClipSnapshot* snapshot) {
   layer_state_stack_->maybe_save_layer_for_clip(save_needed_);
   save_needed_ = false;
-  layer_state_stack_->push_clip_rrect(rrect, is_aa);
+  layer_state_stack_->push_clip_rrect(rrect, is_aa, snapshot);
 }
 
 void MutatorContext::clipRSuperellipse(const DlRoundSuperellipse& rse,
-                                       bool is_aa) {
+                                       bool is_aa,
+                                       ClipSnapshot* snapshot) {
   layer_state_stack_->maybe_save_layer_for_clip(save_needed_);
   save_needed_ = false;
-  layer_state_stack_->push_clip_rsuperellipse(rse, is_aa);
+  layer_state_stack_->push_clip_rsuperellipse(rse, is_aa, snapshot);
 }
 
-void MutatorContext::clipPath(const DlPath& path, bool is_aa) {
+void MutatorContext::clipPath(const DlPath& path,
+                              bool is_aa,
+                              ClipSnapshot* snapshot) {
   layer_state_stack_->maybe_save_layer_for_clip(save_needed_);
   save_needed_ = false;
-  layer_state_stack_->push_clip_path(path, is_aa);
+  layer_state_stack_->push_clip_path(path, is_aa, snapshot);
 }
 
 // ==============================================================
@@ -730,26 +742,53 @@ void LayerStateStack::push_integral_transform() {
   apply_last_entry();
 }
 
-void LayerStateStack::push_clip_rect(const DlRect& rect, bool is_aa) {
+void LayerStateStack::push_clip_rect(const DlRect& rect,
+                                     bool is_aa,
+                                     ClipSnapshot* snapshot) {
   state_stack_.emplace_back(std::make_unique<ClipRectEntry>(rect, is_aa));
-  apply_last_entry();
+  apply_last_clip_entry(snapshot);
 }
 
-void LayerStateStack::push_clip_rrect(const DlRoundRect& rrect, bool is_aa) {
+void LayerStateStack::push_clip_rrect(const DlRoundRect& rrect,
+                                      bool is_aa,
+                                      ClipSnapshot* snapshot) {
   state_stack_.emplace_back(std::make_unique<ClipRRectEntry>(rrect, is_aa));
-  apply_last_entry();
+  apply_last_clip_entry(snapshot);
 }
 
 void LayerStateStack::push_clip_rsuperellipse(const DlRoundSuperellipse& rse,
-                                              bool is_aa) {
+                                              bool is_aa,
+                                              ClipSnapshot* snapshot) {
   state_stack_.emplace_back(
       std::make_unique<ClipRSuperellipseEntry>(rse, is_aa));
-  apply_last_entry();
+  apply_last_clip_entry(snapshot);
 }
 
-void LayerStateStack::push_clip_path(const DlPath& path, bool is_aa) {
+void LayerStateStack::push_clip_path(const DlPath& path,
+                                     bool is_aa,
+                                     ClipSnapshot* snapshot) {
   state_stack_.emplace_back(std::make_unique<ClipPathEntry>(path, is_aa));
+  apply_last_clip_entry(snapshot);
+}
+
+void LayerStateStack::apply_last_clip_entry(ClipSnapshot* snapshot) {
+  if (!snapshot || !delegate_->can_restore_device_cull_rect()) {
+    apply_last_entry();
+    return;
+  }
+  DlMatrix matrix = delegate_->matrix();
+  DlRect parent_cull_rect = delegate_->device_cull_rect();
+  if (snapshot->Matches(matrix, parent_cull_rect)) {
+    // Clips never change the matrix, so the cull rect is all there is to
+    // restore.
+    delegate_->restoreDeviceCullRect(snapshot->cull_rect_);
+    return;
+  }
   apply_last_entry();
+  snapshot->is_valid_ = true;
+  snapshot->parent_matrix_ = matrix;
+  snapshot->parent_cull_rect_ = parent_cull_rect;
+  snapshot->cull_rect_ = delegate_->device_cull_rect();
 }
 
 bool LayerStateStack::needs_save_layer(int flags) const {
@@ -153,6 +153,35 @@ class LayerStateStack {
     FML_DISALLOW_COPY_ASSIGN_AND_MOVE(AutoRestore);
   };
 
+  // Remembers the device cull rect that a clip resolved to during a
+  // preroll, along with the matrix and device cull rect of the state it
+  // was resolved under.
+  //
+  // A layer that is retained across frames can keep one of these for its
+  // clip and pass it to the clip methods of |MutatorContext|. When the
+  // state of its parent has not changed since the previous frame, the
+  // resolved cull rect is then restored from the snapshot rather than
+  // resolving the clip again. Only the preroll delegate makes use of the
+  // snapshots, a canvas delegate always records the clip.
+  class ClipSnapshot {
+   public:
+    bool is_valid() const { return is_valid_; }
+    void Invalidate() { is_valid_ = false; }
+
+   private:
+    bool Matches(const DlMatrix& matrix, const DlRect& cull_rect) const {
+      return is_valid_ && parent_cull_rect_ == cull_rect &&
+             parent_matrix_ == matrix;
+    }
+
+    bool is_valid_ = false;
+    DlMatrix parent_matrix_;
+    DlRect parent_cull_rect_;
+    DlRect cull_rect_;
+
+    friend class LayerStateStack;
+  };
+
   class MutatorContext {
    public:
     ~MutatorContext() {
@@ -205,10 +234,20 @@ class LayerStateStack {
     void transform(const DlMatrix& matrix);
     void integralTransform();
 
-    void clipRect(const DlRect& rect, bool is_aa);
-    void clipRRect(const DlRoundRect& rrect, bool is_aa);
-    void clipRSuperellipse(const DlRoundSuperellipse& rse, bool is_aa);
-    void clipPath(const DlPath& path, bool is_aa);
+    // The optional |snapshot| is used to restore or remember the
+    // resolved clip, see |ClipSnapshot|.
+    void clipRect(const DlRect& rect,
+                  bool is_aa,
+                  ClipSnapshot* snapshot = nullptr);
+    void clipRRect(const DlRoundRect& rrect,
+                   bool is_aa,
+                   ClipSnapshot* snapshot = nullptr);
+    void clipRSuperellipse(const DlRoundSuperellipse& rse,
+                           bool is_aa,
+                           ClipSnapshot* snapshot = nullptr);
+    void clipPath(const DlPath& path,
+                  bool is_aa,
+                  ClipSnapshot* snapshot = nullptr);
 
    private:
     explicit MutatorContext(LayerStateStack* stack)
@@ -333,10 +372,19 @@ class LayerStateStack {
   void push_transform(const DlMatrix& matrix);
   void push_integral_transform();
 
-  void push_clip_rect(const DlRect& rect, bool is_aa);
-  void push_clip_rrect(const DlRoundRect& rrect, bool is_aa);
-  void push_clip_rsuperellipse(const DlRoundSuperellipse& rse, bool is_aa);
-  void push_clip_path(const DlPath& path, bool is_aa);
+  void push_clip_rect(const DlRect& rect, bool is_aa, ClipSnapshot* snapshot);
+  void push_clip_rrect(const DlRoundRect& rrect,
+                       bool is_aa,
+                       ClipSnapshot* snapshot);
+  void push_clip_rsuperellipse(const DlRoundSuperellipse& rse,
+                               bool is_aa,
+                               ClipSnapshot* snapshot);
+  void push_clip_path(const DlPath& path, bool is_aa, ClipSnapshot* snapshot);
+
+  // Applies the clip entry that was just pushed, restoring its resolved
+  // cull rect from the |snapshot| when possible and remembering it in the
+  // |snapshot| otherwise.
+  void apply_last_clip_entry(ClipSnapshot* snapshot);
   // ---------------------
 
   // The maybe/needs_save_layer methods will determine if the indicated
@@ -454,6 +502,12 @@ class LayerStateStack {
                                    DlClipOp op,
                                    bool is_aa) = 0;
     virtual void clipPath(const DlPath& path, DlClipOp op, bool is_aa) = 0;
+
+    // Whether the delegate only tracks the device cull rect of its clips,
+    // in which case |restoreDeviceCullRect| can stand in for resolving a
+    // clip whose outcome is already known.
+    virtual bool can_restore_device_cull_rect() const { return false; }
+    virtual void restoreDeviceCullRect(const DlRect& cull_rect) {}
   };
   friend class DummyDelegate;
   friend class DlCanvasDelegate;
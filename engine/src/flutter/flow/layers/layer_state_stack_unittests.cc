@@ -541,5 +541,61 @@ TEST(LayerStateStack, ColorFilterAndImageFilterInteraction) {
   ASSERT_EQ(state_stack.outstanding_color_filter(), nullptr);
 }
 
+TEST(LayerStateStack, ClipSnapshotRestoresResolvedClip) {
+  LayerStateStack state_stack;
+  state_stack.set_preroll_delegate(DlRect::MakeWH(100, 100));
+  LayerStateStack::ClipSnapshot snapshot;
+  DlRect clip = DlRect::MakeLTRB(0, 0, 50, 50);
+
+  {
+    auto mutator = state_stack.save();
+    mutator.translate(10, 10);
+    mutator.clipRect(clip, false, &snapshot);
+    EXPECT_TRUE(snapshot.is_valid());
+    EXPECT_EQ(state_stack.device_cull_rect(), DlRect::MakeLTRB(10, 10, 60, 60));
+  }
+  EXPECT_EQ(state_stack.device_cull_rect(), DlRect::MakeWH(100, 100));
+
+  {
+    // The snapshot belongs to a single clip, so under an unchanged parent
+    // state it is restored without looking at the clip at all.
+    auto mutator = state_stack.save();
+    mutator.translate(10, 10);
+    mutator.clipRect(DlRect::MakeLTRB(0, 0, 20, 20), false, &snapshot);
+    EXPECT_EQ(state_stack.device_cull_rect(), DlRect::MakeLTRB(10, 10, 60, 60));
+  }
+
+  {
+    // A different parent matrix resolves the clip again.
+    auto mutator = state_stack.save();
+    mutator.translate(20, 20);
+    mutator.clipRect(clip, false, &snapshot);
+    EXPECT_EQ(state_stack.device_cull_rect(), DlRect::MakeLTRB(20, 20, 70, 70));
+  }
+
+  {
+    // As does a different parent cull rect.
+    auto mutator = state_stack.save();
+    mutator.clipRect(DlRect::MakeLTRB(30, 30, 100, 100), false);
+    mutator.translate(20, 20);
+    mutator.clipRect(clip, false, &snapshot);
+    EXPECT_EQ(state_stack.device_cull_rect(), DlRect::MakeLTRB(30, 30, 70, 70));
+  }
+}
+
+TEST(LayerStateStack, ClipSnapshotIsIgnoredByCanvasDelegate) {
+  DisplayListBuilder builder(DlRect::MakeWH(100, 100));
+  LayerStateStack state_stack;
+  state_stack.set_delegate(&builder);
+  LayerStateStack::ClipSnapshot snapshot;
+
+  {
+    auto mutator = state_stack.save();
+    mutator.clipRect(DlRect::MakeLTRB(0, 0, 50, 50), false, &snapshot);
+    EXPECT_FALSE(snapshot.is_valid());
+    EXPECT_EQ(state_stack.device_cull_rect(), DlRect::MakeLTRB(0, 0, 50, 50));
+  }
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -55,7 +55,10 @@ bool LayerTree::Preroll(CompositorContext::ScopedFrame& frame,
       .raster_time = frame.context().raster_time(),
       .ui_time = frame.context().ui_time(),
       .texture_registry = frame.context().texture_registry(),
+      .impeller_enabled = !!frame.aiks_context(),
       .raster_cached_entries = &raster_cache_items_,
+      .preroll_task_runner = frame.context().preroll_task_runner().get(),
+      .backdrop_filters_disabled = frame.context().backdrop_filters_disabled(),
   };
 
   root_layer_->Preroll(&context);
@@ -129,6 +132,8 @@ void LayerTree::Paint(CompositorContext::ScopedFrame& frame,
 #endif  //  !SLIMPELLER
       .impeller_enabled              = !!frame.aiks_context(),
       .aiks_context                  = frame.aiks_context(),
+      .backdrop_filters_disabled     =
+          frame.context().backdrop_filters_disabled(),
       // clang-format on
   };
 
@@ -139,7 +144,13 @@ void LayerTree::Paint(CompositorContext::ScopedFrame& frame,
   }
 #endif  //  !SLIMPELLER
 
+  // The raster cache entries above are rendered without the profiler, so
+  // their cost is not attributed to the layers that are cached.
+  context.paint_profiler = frame.context().layer_paint_profiler();
+
   if (root_layer_->needs_painting(context)) {
+    LayerPaintProfiler::ScopedPaint profile(context.paint_profiler,
+                                            root_layer_.get());
     root_layer_->Paint(context);
   }
 }
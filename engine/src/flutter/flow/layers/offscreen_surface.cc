@@ -6,6 +6,7 @@
 
 #include "flutter/flow/layers/offscreen_surface.h"
 
+#include "third_party/skia/include/core/SkCanvas.h"
 #include "third_party/skia/include/core/SkColorSpace.h"
 #include "third_party/skia/include/core/SkData.h"
 #include "third_party/skia/include/core/SkImage.h"
@@ -69,13 +70,38 @@ static sk_sp<SkData> GetRasterData(const sk_sp<SkSurface>& offscreen_surface,
 }
 
 OffscreenSurface::OffscreenSurface(GrDirectContext* surface_context,
-                                   const DlISize& size) {
-  offscreen_surface_ = CreateSnapshotSurface(surface_context, size);
+                                   const DlISize& size,
+                                   SkiaSnapshotSurfacePool* pool)
+    : pool_(pool), pool_key_{.size = size} {
+  if (pool_) {
+    offscreen_surface_ = pool_->Acquire(pool_key_);
+    // The pool outlives a change of the context, which the surface must not.
+    if (offscreen_surface_ &&
+        offscreen_surface_->recordingContext() != surface_context) {
+      offscreen_surface_ = nullptr;
+    }
+    if (offscreen_surface_) {
+      SkCanvas* canvas = offscreen_surface_->getCanvas();
+      canvas->restoreToCount(1);
+      canvas->resetMatrix();
+      canvas->clear(SK_ColorTRANSPARENT);
+    }
+  }
+  if (!offscreen_surface_) {
+    offscreen_surface_ = CreateSnapshotSurface(surface_context, size);
+  }
   if (offscreen_surface_) {
     adapter_.set_canvas(offscreen_surface_->getCanvas());
   }
 }
 
+OffscreenSurface::~OffscreenSurface() {
+  if (pool_ && offscreen_surface_) {
+    size_t byte_size = offscreen_surface_->imageInfo().computeMinByteSize();
+    pool_->Release(pool_key_, std::move(offscreen_surface_), byte_size);
+  }
+}
+
 sk_sp<SkData> OffscreenSurface::GetRasterData(bool compressed) const {
   return flutter::GetRasterData(offscreen_surface_, compressed);
 }
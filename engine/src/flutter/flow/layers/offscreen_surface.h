@@ -12,6 +12,7 @@
 
 #include "flutter/display_list/dl_canvas.h"
 #include "flutter/display_list/skia/dl_sk_canvas.h"
+#include "flutter/flow/snapshot_surface_pool.h"
 #include "third_party/skia/include/core/SkData.h"
 #include "third_party/skia/include/core/SkSurface.h"
 
@@ -21,10 +22,16 @@ namespace flutter {
 
 class OffscreenSurface {
  public:
+  /// Creates a surface of |size| for |surface_context|, or a raster surface
+  /// if |surface_context| is null.
+  ///
+  /// If |pool| is not null, the surface is taken from the pool if it holds a
+  /// matching one and is returned to the pool on destruction.
   explicit OffscreenSurface(GrDirectContext* surface_context,
-                            const DlISize& size);
+                            const DlISize& size,
+                            SkiaSnapshotSurfacePool* pool = nullptr);
 
-  ~OffscreenSurface() = default;
+  ~OffscreenSurface();
 
   sk_sp<SkData> GetRasterData(bool compressed) const;
 
@@ -33,6 +40,8 @@ class OffscreenSurface {
   bool IsValid() const;
 
  private:
+  SkiaSnapshotSurfacePool* pool_;
+  SkiaSnapshotSurfacePool::Key pool_key_;
   sk_sp<SkSurface> offscreen_surface_;
   DlSkCanvasAdapter adapter_;
 
@@ -35,4 +35,32 @@ TEST(OffscreenSurfaceTest, PaintSurfaceBlack) {
   ASSERT_EQ(actual[0], 0xFF000000u);
 }
 
+TEST(OffscreenSurfaceTest, PooledSurfaceIsReusedAndCleared) {
+  SkiaSnapshotSurfacePool pool;
+  auto surface =
+      std::make_unique<OffscreenSurface>(nullptr, DlISize(1, 1), &pool);
+  ASSERT_TRUE(surface->IsValid());
+  surface->GetCanvas()->Clear(DlColor::kBlack());
+  surface->GetCanvas()->Scale(2, 2);
+  surface.reset();
+  EXPECT_EQ(pool.GetCachedCount(), 1u);
+
+  surface = std::make_unique<OffscreenSurface>(nullptr, DlISize(1, 1), &pool);
+  ASSERT_TRUE(surface->IsValid());
+  EXPECT_EQ(pool.GetCachedCount(), 0u);
+  EXPECT_EQ(surface->GetCanvas()->GetMatrix(), DlMatrix());
+
+  auto raster_data = surface->GetRasterData(false);
+  const uint32_t* actual =
+      reinterpret_cast<const uint32_t*>(raster_data->data());
+  ASSERT_EQ(actual[0], 0x00000000u);
+
+  // Surfaces of a different size are not shared.
+  auto other =
+      std::make_unique<OffscreenSurface>(nullptr, DlISize(2, 2), &pool);
+  surface.reset();
+  other.reset();
+  EXPECT_EQ(pool.GetCachedCount(), 2u);
+}
+
 }  // namespace flutter::testing
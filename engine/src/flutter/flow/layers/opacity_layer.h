@@ -34,6 +34,8 @@ class OpacityLayer : public CacheableContainerLayer {
 
   void Paint(PaintContext& context) const override;
 
+  const char* GetTypeName() const override { return "OpacityLayer"; }
+
   // Returns whether the children are capable of inheriting an opacity value
   // and modifying their rendering accordingly. This value is only guaranteed
   // to be valid after the local |Preroll| method is called.
@@ -7,6 +7,8 @@
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 
 #include "display_list/dl_text_skia.h"
@@ -65,6 +67,25 @@ void VisualizeStopWatch(DlCanvas* canvas,
   }
 }
 
+// Matching or loading the typeface can read a font file, which is too slow to
+// do on every frame the overlay is painted. The layer itself is rebuilt every
+// frame, so the font of the last path is kept here instead.
+SkFont GetStatisticsFont(const std::string& font_path) {
+  struct FontCache {
+    std::mutex mutex;
+    std::optional<std::string> font_path;
+    SkFont font;
+  };
+  static FontCache* cache = new FontCache();
+
+  std::scoped_lock lock(cache->mutex);
+  if (cache->font_path != font_path) {
+    cache->font = PerformanceOverlayLayer::MakeStatisticsFont(font_path);
+    cache->font_path = font_path;
+  }
+  return cache->font;
+}
+
 }  // namespace
 
 // static
@@ -139,7 +160,7 @@ void PerformanceOverlayLayer::Paint(PaintContext& context) const {
   // Cached storage for vertex output.
   std::vector<DlPoint> vertices_storage;
   std::vector<DlColor> color_storage;
-  SkFont font = MakeStatisticsFont(font_path_);
+  SkFont font = GetStatisticsFont(font_path_);
 
   VisualizeStopWatch(context.canvas, context.impeller_enabled,
                      context.raster_time, x, y, width, height - padding,
@@ -44,6 +44,8 @@ class PerformanceOverlayLayer : public Layer {
   void Preroll(PrerollContext* context) override {}
   void Paint(PaintContext& context) const override;
 
+  const char* GetTypeName() const override { return "PerformanceOverlayLayer"; }
+
  private:
   int options_;
   std::string font_path_;
@@ -17,6 +17,10 @@ class PlatformViewLayer : public Layer {
   void Preroll(PrerollContext* context) override;
   void Paint(PaintContext& context) const override;
 
+  const char* GetTypeName() const override { return "PlatformViewLayer"; }
+
+  bool MayHavePlatformView() const override { return true; }
+
  private:
   DlPoint offset_;
   DlSize size_;
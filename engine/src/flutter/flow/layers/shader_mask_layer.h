@@ -22,6 +22,8 @@ class ShaderMaskLayer : public CacheableContainerLayer {
 
   void Paint(PaintContext& context) const override;
 
+  const char* GetTypeName() const override { return "ShaderMaskLayer"; }
+
  private:
   std::shared_ptr<DlColorSource> color_source_;
   DlRect mask_rect_;
@@ -28,6 +28,8 @@ class TextureLayer : public Layer {
   void Preroll(PrerollContext* context) override;
   void Paint(PaintContext& context) const override;
 
+  const char* GetTypeName() const override { return "TextureLayer"; }
+
  private:
   DlPoint offset_;
   DlSize size_;
@@ -19,6 +19,8 @@ class TransformLayer : public ContainerLayer {
 
   void Paint(PaintContext& context) const override;
 
+  const char* GetTypeName() const override { return "TransformLayer"; }
+
  private:
   DlMatrix transform_;
 
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "flutter/common/constants.h"
+#include "flutter/display_list/dl_builder.h"
 #include "flutter/display_list/skia/dl_sk_dispatcher.h"
 #include "flutter/flow/layers/container_layer.h"
 #include "flutter/flow/layers/layer.h"
@@ -23,6 +24,13 @@
 #include "third_party/skia/include/gpu/ganesh/GrDirectContext.h"
 #include "third_party/skia/include/gpu/ganesh/SkSurfaceGanesh.h"
 
+#if IMPELLER_SUPPORTS_RENDERING
+#include "impeller/display_list/aiks_context.h"         // nogncheck
+#include "impeller/display_list/dl_dispatcher.h"        // nogncheck
+#include "impeller/display_list/dl_image_impeller.h"    // nogncheck
+#include "impeller/entity/contents/content_context.h"  // nogncheck
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
 namespace flutter {
 
 RasterCacheResult::RasterCacheResult(sk_sp<DlImage> image,
@@ -70,6 +78,52 @@ void RasterCacheResult::draw(DlCanvas& canvas,
   }
 }
 
+#if IMPELLER_SUPPORTS_RENDERING
+static sk_sp<DlImage> RasterizeWithImpeller(
+    impeller::AiksContext& aiks_context,
+    const SkRect& dest_rect,
+    const sk_sp<DisplayList>& display_list) {
+  impeller::ContentContext& renderer = aiks_context.GetContentContext();
+  std::shared_ptr<impeller::Context> context = renderer.GetContext();
+  const std::shared_ptr<impeller::RenderTargetAllocator>& allocator =
+      renderer.GetRenderTargetCache();
+  impeller::ISize size(dest_rect.width(), dest_rect.height());
+
+  // The render target cache hands out any texture that was not used during
+  // the current frame to the next pass that asks for one of the same size,
+  // but a cache entry keeps its texture for as long as the entry lives.
+  // Allocate it with the cache disabled so that it is never recycled.
+  allocator->DisableCache();
+  impeller::RenderTarget target;
+  if (context->GetCapabilities()->SupportsOffscreenMSAA()) {
+    target = allocator->CreateOffscreenMSAA(
+        *context, size, /*mip_count=*/1, "Raster Cache MSAA",
+        impeller::RenderTarget::kDefaultColorAttachmentConfigMSAA,
+        /*stencil_attachment_config=*/std::nullopt);
+  } else {
+    target = allocator->CreateOffscreen(
+        *context, size, /*mip_count=*/1, "Raster Cache",
+        impeller::RenderTarget::kDefaultColorAttachmentConfig,
+        /*stencil_attachment_config=*/std::nullopt);
+  }
+  allocator->EnableCache();
+  if (!target.IsValid()) {
+    return nullptr;
+  }
+
+  // The transient buffers are still in use by the frame being recorded, so
+  // they must not be reset here.
+  if (!impeller::RenderToTarget(renderer, target, display_list,
+                                impeller::Rect::MakeSize(size),
+                                /*reset_host_buffer=*/false,
+                                /*is_onscreen=*/false)) {
+    return nullptr;
+  }
+  return impeller::DlImageImpeller::Make(target.GetRenderTargetTexture(),
+                                         DlImage::OwningContext::kRaster);
+}
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
 RasterCache::RasterCache(size_t access_threshold,
                          size_t display_list_cache_limit_per_frame)
     : access_threshold_(access_threshold),
@@ -86,6 +140,33 @@ std::unique_ptr<RasterCacheResult> RasterCache::Rasterize(
   SkRect dest_rect =
       RasterCacheUtil::GetRoundedOutDeviceBounds(context.logical_rect, matrix);
 
+#if IMPELLER_SUPPORTS_RENDERING
+  if (context.aiks_context) {
+    if (dest_rect.isEmpty() ||
+        !RasterCacheUtil::FitsImpellerCacheTexture(dest_rect,
+                                                   impeller_cache_limits_)) {
+      return nullptr;
+    }
+    DisplayListBuilder builder(DlRect::MakeWH(dest_rect.width(),  //
+                                              dest_rect.height()));
+    builder.Translate(-dest_rect.left(), -dest_rect.top());
+    builder.Transform(ToDlMatrix(matrix));
+    draw_function(&builder);
+
+    if (checkerboard_images_) {
+      draw_checkerboard(&builder, ToDlRect(context.logical_rect));
+    }
+
+    auto image = RasterizeWithImpeller(*context.aiks_context, dest_rect,
+                                       builder.Build());
+    if (!image) {
+      return nullptr;
+    }
+    return std::make_unique<RasterCacheResult>(
+        image, context.logical_rect, context.flow_type, std::move(rtree));
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
   const SkImageInfo image_info = SkImageInfo::MakeN32Premul(
       dest_rect.width(), dest_rect.height(), context.dst_color_space);
 
@@ -145,6 +226,7 @@ RasterCache::CacheInfo RasterCache::MarkSeen(const RasterCacheKeyID& id,
                                              const SkMatrix& matrix,
                                              bool visible) const {
   RasterCacheKey key = RasterCacheKey(id, matrix);
+  std::scoped_lock lock(mark_seen_mutex_);
   Entry& entry = cache_[key];
   entry.encountered_this_frame = true;
   entry.visible_this_frame = visible;
@@ -8,6 +8,7 @@
 #if !SLIMPELLER
 
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include "flutter/display_list/dl_canvas.h"
@@ -23,6 +24,10 @@
 class GrDirectContext;
 class SkColorSpace;
 
+namespace impeller {
+class AiksContext;
+}  // namespace impeller
+
 namespace flutter {
 
 enum class RasterCacheLayerStrategy { kLayer, kLayerChildren };
@@ -96,6 +101,11 @@ struct RasterCacheMetrics {
  * RasterCache is used to cache rasterized layers or display lists to improve
  * performance.
  *
+ * Under Skia the entries are rasterized into Skia surfaces. Under Impeller,
+ * which is selected by |Context::aiks_context|, they are rendered into
+ * textures allocated from the render target allocator of the Impeller
+ * content context and are subject to |impeller_cache_limits|.
+ *
  * Life cycle of RasterCache methods:
  * - Preroll stage
  *   - LayerTree::Preroll - for each Layer in the tree:
@@ -124,6 +134,9 @@ class RasterCache {
     const SkMatrix& matrix;
     const SkRect& logical_rect;
     const char* flow_type;
+    // When set, entries are rendered by Impeller into textures owned by
+    // this context instead of into Skia surfaces.
+    impeller::AiksContext* aiks_context = nullptr;
   };
   struct CacheInfo {
     const size_t accesses_since_visible;
@@ -137,8 +150,11 @@ class RasterCache {
       const std::function<void(DlCanvas*, const DlRect& rect)>&
           draw_checkerboard) const;
 
+  // The number of frames an entry must be prepared in before it is cached.
+  static constexpr size_t kDefaultAccessThreshold = 3;
+
   explicit RasterCache(
-      size_t access_threshold = 3,
+      size_t access_threshold = kDefaultAccessThreshold,
       size_t picture_and_display_list_cache_limit_per_frame =
           RasterCacheUtil::kDefaultPictureAndDisplayListCacheLimitPerFrame);
 
@@ -216,6 +232,28 @@ class RasterCache {
    */
   size_t access_threshold() const { return access_threshold_; }
 
+  /**
+   * @brief Change the access threshold, for example to cache entries sooner
+   * when frames keep missing their deadline. Entries that were already
+   * cached are kept.
+   */
+  void SetAccessThreshold(size_t access_threshold) {
+    access_threshold_ = access_threshold;
+  }
+
+  /**
+   * @brief The limits that decide which entries are worth caching, and can
+   * be cached at all, when rendering with Impeller.
+   */
+  const RasterCacheUtil::ImpellerCacheLimits& impeller_cache_limits() const {
+    return impeller_cache_limits_;
+  }
+
+  void SetImpellerCacheLimits(
+      const RasterCacheUtil::ImpellerCacheLimits& limits) {
+    impeller_cache_limits_ = limits;
+  }
+
   bool GenerateNewCacheInThisFrame() const {
     // Disabling caching when access_threshold is zero is historic behavior.
     return access_threshold_ != 0 && display_list_cached_this_frame_ <
@@ -259,13 +297,17 @@ class RasterCache {
 
   RasterCacheMetrics& GetMetricsForKind(RasterCacheKeyKind kind);
 
-  const size_t access_threshold_;
+  size_t access_threshold_;
   const size_t display_list_cache_limit_per_frame_;
   mutable size_t display_list_cached_this_frame_ = 0;
   RasterCacheMetrics layer_metrics_;
   RasterCacheMetrics picture_metrics_;
   mutable RasterCacheKey::Map<Entry> cache_;
+  // Guards |cache_| in |MarkSeen|, which is called by the layers that
+  // |ContainerLayer| prerolls in parallel.
+  mutable std::mutex mark_seen_mutex_;
   bool checkerboard_images_ = false;
+  RasterCacheUtil::ImpellerCacheLimits impeller_cache_limits_;
 
   void TraceStatsToTimeline() const;
 
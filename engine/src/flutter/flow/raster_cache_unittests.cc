@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <limits>
+
 #include "flutter/display_list/benchmarking/dl_complexity.h"
 #include "flutter/display_list/display_list.h"
 #include "flutter/display_list/dl_builder.h"
@@ -556,6 +558,40 @@ TEST(RasterCache, DisplayListWithSingularMatrixIsNotCached) {
   }
 }
 
+TEST(RasterCache, ImpellerLimitsBoundCachedDisplayListSize) {
+  flutter::RasterCache cache;
+  DlMatrix matrix;
+
+  DisplayListBuilder builder;
+  builder.DrawRect(DlRect::MakeLTRB(0, 0, 5000, 10), DlPaint());
+  auto display_list = builder.Build();
+
+  LayerStateStack preroll_state_stack;
+  preroll_state_stack.set_preroll_delegate(kGiantRect, matrix);
+  FixedRefreshRateStopwatch raster_time;
+  FixedRefreshRateStopwatch ui_time;
+  PrerollContextHolder preroll_context_holder = GetSamplePrerollContextHolder(
+      preroll_state_stack, &cache, &raster_time, &ui_time);
+  auto& preroll_context = preroll_context_holder.preroll_context;
+
+  // Marked as complex, so only the texture size limit applies.
+  DisplayListRasterCacheItem display_list_item(display_list, SkPoint(), true,
+                                               false);
+
+  display_list_item.PrerollSetup(&preroll_context, matrix);
+  EXPECT_TRUE(display_list_item.need_caching());
+
+  preroll_context.impeller_enabled = true;
+  display_list_item.PrerollSetup(&preroll_context, matrix);
+  EXPECT_FALSE(display_list_item.need_caching());
+
+  RasterCacheUtil::ImpellerCacheLimits limits;
+  limits.max_texture_dimension = 8192;
+  cache.SetImpellerCacheLimits(limits);
+  display_list_item.PrerollSetup(&preroll_context, matrix);
+  EXPECT_TRUE(display_list_item.need_caching());
+}
+
 TEST(RasterCache, PrepareLayerTransform) {
   DlRect child_bounds = DlRect::MakeLTRB(10, 10, 50, 50);
   DlPath child_path = DlPath::MakeOval(child_bounds);
@@ -775,6 +811,33 @@ TEST_F(RasterCacheTest, RasterCacheKeyIDLayerChildrenIds) {
   ASSERT_EQ(ids, expected_ids);
 }
 
+TEST(RasterCacheUtilsTest, ImpellerCachingWeighsComplexityAgainstArea) {
+  RasterCacheUtil::ImpellerCacheLimits limits;
+  limits.max_texture_dimension = 2048;
+  limits.complexity_per_megapixel = 10000u;
+
+  // One megapixel.
+  SkRect bounds = SkRect::MakeWH(1000, 1000);
+  EXPECT_TRUE(RasterCacheUtil::FitsImpellerCacheTexture(bounds, limits));
+  EXPECT_TRUE(RasterCacheUtil::IsWorthCachingWithImpeller(10000u, bounds,
+                                                          limits));
+  EXPECT_FALSE(RasterCacheUtil::IsWorthCachingWithImpeller(9999u, bounds,
+                                                           limits));
+
+  // A quarter of the area needs a quarter of the complexity.
+  bounds = SkRect::MakeWH(500, 500);
+  EXPECT_TRUE(RasterCacheUtil::IsWorthCachingWithImpeller(2500u, bounds,
+                                                          limits));
+  EXPECT_FALSE(RasterCacheUtil::IsWorthCachingWithImpeller(2499u, bounds,
+                                                           limits));
+
+  // Entries that do not fit in a texture are never worth caching.
+  bounds = SkRect::MakeWH(2049, 10);
+  EXPECT_FALSE(RasterCacheUtil::FitsImpellerCacheTexture(bounds, limits));
+  EXPECT_FALSE(RasterCacheUtil::IsWorthCachingWithImpeller(
+      std::numeric_limits<unsigned int>::max(), bounds, limits));
+}
+
 TEST(RasterCacheUtilsTest, SkMatrixIntegralTransCTM) {
 #define EXPECT_EQ_WITH_TRANSLATE(test, expected, expected_tx, expected_ty) \
   do {                                                                     \
@@ -6,6 +6,19 @@
 
 namespace flutter {
 
+bool RasterCacheUtil::IsWorthCachingWithImpeller(
+    unsigned int complexity_score,
+    const SkRect& device_bounds,
+    const ImpellerCacheLimits& limits) {
+  if (!FitsImpellerCacheTexture(device_bounds, limits)) {
+    return false;
+  }
+  double megapixels =
+      static_cast<double>(device_bounds.width()) * device_bounds.height() /
+      1000000.0;
+  return complexity_score >= megapixels * limits.complexity_per_megapixel;
+}
+
 bool RasterCacheUtil::ComputeIntegralTransCTM(const SkMatrix& in,
                                               SkMatrix* out) {
   // Avoid integral snapping if the matrix has complex transformation to avoid
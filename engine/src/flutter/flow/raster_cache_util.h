@@ -36,6 +36,42 @@ struct RasterCacheUtil {
   // filtered output of this layer.
   static constexpr int kMinimumRendersBeforeCachingFilterLayer = 3;
 
+  // The limits applied to the texture backed raster cache used when
+  // rendering with Impeller.
+  //
+  // Impeller renders every cache entry in a render pass of its own and then
+  // samples the resulting texture for every device pixel it covers each
+  // frame, so caching only pays off for content that is expensive relative
+  // to the area it covers. Small but finely detailed content such as vector
+  // illustrations benefits the most.
+  struct ImpellerCacheLimits {
+    // The largest width or height, in device pixels, of a cached entry.
+    int max_texture_dimension = 4096;
+
+    // The complexity score, in the units of the Impeller complexity
+    // calculator, that drawing one million cached device pixels is
+    // expected to cost. Display lists that score lower than this for their
+    // device area are cheaper to render again than to draw from the cache.
+    unsigned int complexity_per_megapixel = 20000u;
+  };
+
+  // Returns true if a display list with |complexity_score| that covers
+  // |device_bounds| should be cached under the given Impeller |limits|.
+  //
+  // This is applied on top of |DisplayListComplexityCalculator::
+  // ShouldBeCached|.
+  static bool IsWorthCachingWithImpeller(unsigned int complexity_score,
+                                         const SkRect& device_bounds,
+                                         const ImpellerCacheLimits& limits);
+
+  // Returns true if an entry covering |device_bounds| fits in a texture of
+  // the size allowed by |limits|.
+  static bool FitsImpellerCacheTexture(const SkRect& device_bounds,
+                                       const ImpellerCacheLimits& limits) {
+    return device_bounds.width() <= limits.max_texture_dimension &&
+           device_bounds.height() <= limits.max_texture_dimension;
+  }
+
   static bool CanRasterizeRect(const SkRect& cull_rect) {
     if (cull_rect.isEmpty()) {
       // No point in ever rasterizing an empty display list.
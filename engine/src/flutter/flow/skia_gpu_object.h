@@ -12,6 +12,8 @@
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/fml/task_runner.h"
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
 #include "flutter/fml/trace_event.h"
 #include "third_party/skia/include/core/SkRefCnt.h"
 #include "third_party/skia/include/gpu/ganesh/GrBackendSurface.h"
@@ -22,11 +24,22 @@ namespace flutter {
 
 // A queue that holds Skia objects that must be destructed on the given task
 // runner.
+//
+// The drains the queue schedules for itself stop once they exceed their time
+// budget and leave the remaining objects to a later task. This keeps a burst
+// of releases, such as when a route with many images is popped, from stalling
+// the task runner for a whole frame.
 template <class T>
 class UnrefQueue : public fml::RefCountedThreadSafe<UnrefQueue<T>> {
  public:
   using ResourceContext = T;
 
+  // The number of objects unref'd between checks of the drain budget.
+  static constexpr size_t kUnrefBatchSize = 32u;
+
+  static constexpr fml::TimeDelta kDefaultDrainBudget =
+      fml::TimeDelta::FromMilliseconds(2);
+
   void Unref(SkRefCnt* object) {
     if (drain_immediate_) {
       object->unref();
@@ -37,7 +50,8 @@ class UnrefQueue : public fml::RefCountedThreadSafe<UnrefQueue<T>> {
     if (!drain_pending_) {
       drain_pending_ = true;
       task_runner_->PostDelayedTask(
-          [strong = fml::Ref(this)]() { strong->Drain(); }, drain_delay_);
+          [strong = fml::Ref(this)]() { strong->DrainWithinBudget(); },
+          drain_delay_);
     }
   }
 
@@ -50,7 +64,8 @@ class UnrefQueue : public fml::RefCountedThreadSafe<UnrefQueue<T>> {
     if (!drain_pending_) {
       drain_pending_ = true;
       task_runner_->PostDelayedTask(
-          [strong = fml::Ref(this)]() { strong->Drain(); }, drain_delay_);
+          [strong = fml::Ref(this)]() { strong->DrainWithinBudget(); },
+          drain_delay_);
     }
   }
 #endif  //  !SLIMPELLER
@@ -86,6 +101,7 @@ class UnrefQueue : public fml::RefCountedThreadSafe<UnrefQueue<T>> {
  private:
   const fml::RefPtr<fml::TaskRunner> task_runner_;
   const fml::TimeDelta drain_delay_;
+  const fml::TimeDelta drain_budget_;
   std::mutex mutex_;
   std::deque<SkRefCnt*> objects_;
   NOT_SLIMPELLER(std::deque<GrBackendTexture> textures_);
@@ -101,9 +117,11 @@ class UnrefQueue : public fml::RefCountedThreadSafe<UnrefQueue<T>> {
   UnrefQueue(fml::RefPtr<fml::TaskRunner> task_runner,
              fml::TimeDelta delay,
              sk_sp<ResourceContext> context = nullptr,
-             bool drain_immediate = false)
+             bool drain_immediate = false,
+             fml::TimeDelta drain_budget = kDefaultDrainBudget)
       : task_runner_(std::move(task_runner)),
         drain_delay_(delay),
+        drain_budget_(drain_budget),
         context_(std::move(context)),
         drain_immediate_(drain_immediate) {}
 
@@ -128,14 +146,63 @@ class UnrefQueue : public fml::RefCountedThreadSafe<UnrefQueue<T>> {
         });
   }
 
+  void DrainWithinBudget() {
+    TRACE_EVENT0("flutter", "SkiaUnrefQueue::DrainWithinBudget");
+    std::deque<SkRefCnt*> skia_objects;
+
+    NOT_SLIMPELLER(std::deque<GrBackendTexture> textures);
+
+    {
+      std::scoped_lock lock(mutex_);
+      objects_.swap(skia_objects);
+      NOT_SLIMPELLER(textures_.swap(textures));
+      drain_pending_ = false;
+    }
+    DoDrain(skia_objects,
+#if !SLIMPELLER
+            textures,
+#endif  //  !SLIMPELLER
+            context_, fml::TimePoint::Now() + drain_budget_);
+
+    size_t pending = 0u;
+    {
+      std::scoped_lock lock(mutex_);
+      // Objects queued during the drain go after the ones left over from it.
+      skia_objects.insert(skia_objects.end(), objects_.begin(),
+                          objects_.end());
+      objects_.swap(skia_objects);
+      pending = objects_.size();
+      if (pending > 0u && !drain_pending_) {
+        drain_pending_ = true;
+        task_runner_->PostTask(
+            [strong = fml::Ref(this)]() { strong->DrainWithinBudget(); });
+      }
+    }
+    FML_TRACE_COUNTER("flutter", "SkiaUnrefQueue",
+                      reinterpret_cast<int64_t>(this), "Pending",
+                      static_cast<int64_t>(pending));
+  }
+
+  // Unrefs the objects until the deadline passes, leaving the rest in
+  // |skia_objects|. The textures are always deleted since there are few of
+  // them.
+  //
   // static
-  static void DoDrain(const std::deque<SkRefCnt*>& skia_objects,
+  static void DoDrain(std::deque<SkRefCnt*>& skia_objects,
 #if !SLIMPELLER
                       const std::deque<GrBackendTexture>& textures,
 #endif  //  !SLIMPELLER
-                      const sk_sp<ResourceContext>& context) {
-    for (SkRefCnt* skia_object : skia_objects) {
-      skia_object->unref();
+                      const sk_sp<ResourceContext>& context,
+                      fml::TimePoint deadline = fml::TimePoint::Max()) {
+    size_t unref_count = 0u;
+    while (!skia_objects.empty()) {
+      if (unref_count > 0u && unref_count % kUnrefBatchSize == 0u &&
+          fml::TimePoint::Now() >= deadline) {
+        break;
+      }
+      skia_objects.front()->unref();
+      skia_objects.pop_front();
+      unref_count++;
     }
 
 #if !SLIMPELLER
@@ -144,7 +211,7 @@ class UnrefQueue : public fml::RefCountedThreadSafe<UnrefQueue<T>> {
         context->deleteBackendTexture(texture);
       }
 
-      if (!skia_objects.empty()) {
+      if (unref_count > 0u) {
         context->performDeferredCleanup(std::chrono::milliseconds(0));
       }
 
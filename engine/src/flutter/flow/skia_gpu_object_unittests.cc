@@ -4,6 +4,7 @@
 
 #include "flutter/flow/skia_gpu_object.h"
 
+#include <atomic>
 #include <future>
 #include <utility>
 
@@ -142,6 +143,44 @@ TEST_F(SkiaGpuObjectTest, ObjectResetTwice) {
   ASSERT_EQ(dtor_task_queue_id, unref_task_runner()->GetTaskQueueId());
 }
 
+TEST_F(SkiaGpuObjectTest, DrainLeavesObjectsOverBudgetToLaterTasks) {
+  constexpr size_t kObjectCount = 2u * SkiaUnrefQueue::kUnrefBatchSize;
+  std::shared_ptr<fml::AutoResetWaitableEvent> latch =
+      std::make_shared<fml::AutoResetWaitableEvent>();
+  std::atomic<size_t> destroyed = 0u;
+
+  class CountingSkObject : public SkRefCnt {
+   public:
+    explicit CountingSkObject(std::atomic<size_t>* destroyed)
+        : destroyed_(destroyed) {}
+    ~CountingSkObject() override { (*destroyed_)++; }
+
+   private:
+    std::atomic<size_t>* destroyed_;
+  };
+
+  fml::RefPtr<SkiaUnrefQueue> queue;
+  size_t destroyed_after_first_drain = 0u;
+  unref_task_runner()->PostTask([&]() {
+    // With no budget, every drain stops after its first batch.
+    queue = fml::MakeRefCounted<SkiaUnrefQueue>(
+        unref_task_runner(), fml::TimeDelta::Zero(), /*context=*/nullptr,
+        /*drain_immediate=*/false, /*drain_budget=*/fml::TimeDelta::Zero());
+    for (size_t i = 0; i < kObjectCount; i++) {
+      queue->Unref(new CountingSkObject(&destroyed));
+    }
+    unref_task_runner()->PostTask([&]() {
+      destroyed_after_first_drain = destroyed;
+      unref_task_runner()->PostTask([&]() { latch->Signal(); });
+    });
+  });
+  latch->Wait();
+
+  EXPECT_EQ(destroyed_after_first_drain, SkiaUnrefQueue::kUnrefBatchSize);
+  EXPECT_EQ(destroyed, kObjectCount);
+  queue = nullptr;
+}
+
 TEST_F(SkiaGpuObjectTest, UnrefResourceContextInTaskRunnerThread) {
   std::shared_ptr<fml::AutoResetWaitableEvent> latch =
       std::make_shared<fml::AutoResetWaitableEvent>();
@@ -0,0 +1,135 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_SNAPSHOT_SURFACE_POOL_H_
+#define FLUTTER_FLOW_SNAPSHOT_SURFACE_POOL_H_
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <utility>
+
+#include "flutter/display_list/geometry/dl_geometry_types.h"
+#include "flutter/fml/macros.h"
+
+#if !SLIMPELLER
+#include "third_party/skia/include/core/SkRefCnt.h"
+#include "third_party/skia/include/core/SkSurface.h"
+#endif  //  !SLIMPELLER
+
+namespace impeller {
+class Texture;
+}  // namespace impeller
+
+namespace flutter {
+
+/// A pool of the offscreen surfaces that snapshots are rendered into, keyed
+/// by their size and format.
+///
+/// Rendering `Picture.toImage` or `Scene.toImage` repeatedly at the same size
+/// reuses the surfaces released by earlier snapshots instead of allocating
+/// new ones. Surfaces are dropped, least recently released first, while the
+/// released surfaces exceed the byte budget of the pool.
+///
+/// Only surfaces whose contents do not outlive the snapshot may be released
+/// to the pool. Only used on the raster thread.
+template <typename T>
+class SnapshotSurfacePool {
+ public:
+  /// The default budget for surfaces that are not in use.
+  static constexpr size_t kDefaultMaxBytes = 64u * 1024u * 1024u;
+
+  struct Key {
+    DlISize size;
+    /// A description of the pixel format of the surface that is specific to
+    /// the backend.
+    uint32_t format = 0;
+
+    bool operator==(const Key& other) const {
+      return size == other.size && format == other.format;
+    }
+  };
+
+  explicit SnapshotSurfacePool(size_t max_bytes = kDefaultMaxBytes)
+      : max_bytes_(max_bytes) {}
+
+  ~SnapshotSurfacePool() = default;
+
+  size_t GetMaxBytes() const { return max_bytes_; }
+
+  /// The number of bytes of the surfaces that are not in use.
+  size_t GetCachedBytes() const { return cached_bytes_; }
+
+  /// The number of surfaces that are not in use.
+  size_t GetCachedCount() const { return entries_.size(); }
+
+  /// Removes the most recently released surface matching |key| from the pool
+  /// and returns it, or returns a null surface if there is none.
+  T Acquire(const Key& key) {
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if (it->key == key) {
+        T surface = std::move(it->surface);
+        cached_bytes_ -= it->byte_size;
+        entries_.erase(it);
+        return surface;
+      }
+    }
+    return T();
+  }
+
+  /// Returns a surface of |byte_size| bytes that is no longer in use to the
+  /// pool. Surfaces larger than the budget of the pool are dropped.
+  void Release(const Key& key, T surface, size_t byte_size) {
+    if (!surface || byte_size > max_bytes_) {
+      return;
+    }
+    entries_.push_front({
+        .key = key,
+        .surface = std::move(surface),
+        .byte_size = byte_size,
+    });
+    cached_bytes_ += byte_size;
+    while (cached_bytes_ > max_bytes_) {
+      cached_bytes_ -= entries_.back().byte_size;
+      entries_.pop_back();
+    }
+  }
+
+  /// Drops all surfaces that are not in use, for example because the context
+  /// they were created with is going away.
+  void Clear() {
+    entries_.clear();
+    cached_bytes_ = 0;
+  }
+
+ private:
+  struct Entry {
+    Key key;
+    T surface;
+    size_t byte_size = 0;
+  };
+
+  const size_t max_bytes_;
+  // The most recently released surfaces first.
+  std::list<Entry> entries_;
+  size_t cached_bytes_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(SnapshotSurfacePool);
+};
+
+#if !SLIMPELLER
+/// Render target surfaces for snapshots rendered with Skia.
+using SkiaSnapshotSurfacePool = SnapshotSurfacePool<sk_sp<SkSurface>>;
+#endif  //  !SLIMPELLER
+
+/// The multisample color attachments of snapshots rendered with Impeller.
+///
+/// The resolved textures are not pooled as they are handed out as the
+/// resulting images.
+using ImpellerSnapshotTexturePool =
+    SnapshotSurfacePool<std::shared_ptr<impeller::Texture>>;
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_SNAPSHOT_SURFACE_POOL_H_
@@ -0,0 +1,63 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/snapshot_surface_pool.h"
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+namespace flutter::testing {
+
+using TestPool = SnapshotSurfacePool<std::shared_ptr<int>>;
+
+TEST(SnapshotSurfacePoolTest, AcquireReturnsReleasedSurfaceOfSameKey) {
+  TestPool pool(1000);
+  TestPool::Key key{.size = DlISize(10, 10)};
+  EXPECT_EQ(pool.Acquire(key), nullptr);
+
+  auto surface = std::make_shared<int>(1);
+  pool.Release(key, surface, 400);
+  EXPECT_EQ(pool.GetCachedCount(), 1u);
+  EXPECT_EQ(pool.GetCachedBytes(), 400u);
+
+  EXPECT_EQ(pool.Acquire({.size = DlISize(10, 20)}), nullptr);
+  EXPECT_EQ(pool.Acquire({.size = DlISize(10, 10), .format = 1}), nullptr);
+  EXPECT_EQ(pool.Acquire(key), surface);
+  EXPECT_EQ(pool.GetCachedCount(), 0u);
+  EXPECT_EQ(pool.GetCachedBytes(), 0u);
+  EXPECT_EQ(pool.Acquire(key), nullptr);
+}
+
+TEST(SnapshotSurfacePoolTest, ReleaseEvictsLeastRecentlyReleased) {
+  TestPool pool(1000);
+  auto a = std::make_shared<int>(1);
+  auto b = std::make_shared<int>(2);
+  auto c = std::make_shared<int>(3);
+  pool.Release({.size = DlISize(1, 1)}, a, 400);
+  pool.Release({.size = DlISize(2, 2)}, b, 400);
+  pool.Release({.size = DlISize(3, 3)}, c, 400);
+
+  EXPECT_EQ(pool.GetCachedCount(), 2u);
+  EXPECT_EQ(pool.GetCachedBytes(), 800u);
+  EXPECT_EQ(pool.Acquire({.size = DlISize(1, 1)}), nullptr);
+  EXPECT_EQ(pool.Acquire({.size = DlISize(2, 2)}), b);
+  EXPECT_EQ(pool.Acquire({.size = DlISize(3, 3)}), c);
+}
+
+TEST(SnapshotSurfacePoolTest, SurfacesOverBudgetAreNotPooled) {
+  TestPool pool(1000);
+  pool.Release({.size = DlISize(1, 1)}, std::make_shared<int>(1), 400);
+  pool.Release({.size = DlISize(2, 2)}, std::make_shared<int>(2), 1001);
+  pool.Release({.size = DlISize(3, 3)}, nullptr, 4);
+
+  EXPECT_EQ(pool.GetCachedCount(), 1u);
+  EXPECT_EQ(pool.GetCachedBytes(), 400u);
+
+  pool.Clear();
+  EXPECT_EQ(pool.GetCachedCount(), 0u);
+  EXPECT_EQ(pool.GetCachedBytes(), 0u);
+}
+
+}  // namespace flutter::testing
@@ -36,7 +36,9 @@ void DlStopwatchVisualizer::Visualize(DlCanvas* canvas,
   const DlScalar max_unit_interval = UnitFrameInterval(max_interval);
   const DlScalar sample_unit_width = width / kMaxSamples;
 
-  // resize backing storage to match expected lap count.
+  // Resize backing storage to fit the expected lap count. Only the vertices
+  // that are actually painted are uploaded, so fewer frame markers than the
+  // maximum don't add degenerate triangles.
   size_t required_storage =
       (stopwatch_.GetLapsCount() + 2 + kMaxFrameMarkers) * 6;
   if (vertices_storage_.size() < required_storage) {
@@ -149,7 +151,7 @@ std::shared_ptr<DlVertices> DlVertexPainter::IntoVertices(
     const DlRect& bounds_rect) {
   return DlVertices::Make(
       /*mode=*/DlVertexMode::kTriangles,
-      /*vertex_count=*/vertices_.size(),
+      /*vertex_count=*/vertices_offset_,
       /*vertices=*/vertices_.data(),
       /*texture_coordinates=*/nullptr,
       /*colors=*/colors_.data(),
@@ -52,7 +52,8 @@ class DlVertexPainter final {
   /// Draws a rectangle with the given color to a buffer.
   void DrawRect(const DlRect& rect, const DlColor& color);
 
-  /// Converts the buffered vertices into a |DlVertices| object.
+  /// Converts the vertices drawn so far into a |DlVertices| object. Storage
+  /// past the last drawn rectangle is not included.
   ///
   /// @note This method clears the buffer.
   std::shared_ptr<DlVertices> IntoVertices(const DlRect& bounds_rect);
@@ -72,5 +72,16 @@ TEST(DlVertexPainter, DrawRectIntoVertices) {
   EXPECT_EQ(colors[11], DlColor::kBlue());
 }
 
+TEST(DlVertexPainter, IntoVerticesSkipsUnusedStorage) {
+  std::vector<DlPoint> point_storage(18);
+  std::vector<DlColor> color_storage(18);
+  auto painter = DlVertexPainter(point_storage, color_storage);
+
+  painter.DrawRect(DlRect::MakeLTRB(0, 0, 10, 10), DlColor::kRed());
+
+  auto vertices = painter.IntoVertices(DlRect::MakeLTRB(0, 0, 10, 10));
+  EXPECT_EQ(vertices->vertex_count(), 6);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -7,10 +7,12 @@
 
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "flutter/common/graphics/gl_context_switch.h"
 #include "flutter/display_list/dl_builder.h"
 #include "flutter/display_list/skia/dl_sk_canvas.h"
+#include "flutter/display_list/skia/dl_sk_picture_cache.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/time/time_point.h"
 
@@ -46,6 +48,11 @@ class SurfaceFrame {
     int vertical_clip_alignment = 1;
     int horizontal_clip_alignment = 1;
 
+    // The number of separate rects the surface can present as frame damage.
+    // With the default of 1 the frame damage is reported as a single rect
+    // bounding everything that changed.
+    size_t max_frame_damage_rects = 1;
+
     // This is the area of framebuffer that lags behind the front buffer.
     //
     // Correctly providing exiting_damage is necessary for supporting double and
@@ -75,6 +82,11 @@ class SurfaceFrame {
     // Corresponds to EGL_KHR_swap_buffers_with_damage
     std::optional<DlIRect> frame_damage;
 
+    // The frame damage split into at most
+    // |FramebufferInfo::max_frame_damage_rects| rects, each of which is
+    // contained in |frame_damage|.
+    std::vector<DlIRect> frame_damage_rects;
+
     // The buffer damage for a frame is the area changed since that same buffer
     // was last used. If the buffer has not been used before, the buffer damage
     // is the entire area of the buffer.
@@ -117,6 +129,14 @@ class SurfaceFrame {
 
   DlCanvas* Canvas();
 
+#if !SLIMPELLER
+  /// Draw stable DisplayLists from the pictures of |cache| when this frame
+  /// renders to a Skia surface. The cache must outlive the frame.
+  void set_picture_cache(DlSkPictureCache* cache) {
+    adapter_.set_picture_cache(cache);
+  }
+#endif  //  !SLIMPELLER
+
   const FramebufferInfo& framebuffer_info() const { return framebuffer_info_; }
 
   void set_submit_info(const SubmitInfo& submit_info) {
@@ -40,6 +40,7 @@ class MockLayer : public Layer {
 
   void Preroll(PrerollContext* context) override;
   void Paint(PaintContext& context) const override;
+  const char* GetTypeName() const override { return "MockLayer"; }
 
   const MutatorsStack& parent_mutators() { return parent_mutators_; }
   const DlMatrix& parent_matrix() { return parent_matrix_; }
@@ -103,6 +104,8 @@ class MockLayer : public Layer {
     return *this;
   }
 
+  void set_fake_paint_path(const DlPath& path) { fake_paint_path_ = path; }
+
   void set_expected_paint_matrix(const DlMatrix& matrix) {
     expected_paint_matrix_ = matrix;
   }
@@ -34,16 +34,19 @@ class MockTexture : public Texture {
   void OnGrContextDestroyed() override { gr_context_destroyed_ = true; }
   void MarkNewFrameAvailable() override {}
   void OnTextureUnregistered() override { unregistered_ = true; }
+  void OnTrimMemory() override { trimmed_ = true; }
 
   bool gr_context_created() { return gr_context_created_; }
   bool gr_context_destroyed() { return gr_context_destroyed_; }
   bool unregistered() { return unregistered_; }
+  bool trimmed() { return trimmed_; }
 
  private:
   sk_sp<DlImage> texture_;
   bool gr_context_created_ = false;
   bool gr_context_destroyed_ = false;
   bool unregistered_ = false;
+  bool trimmed_ = false;
 };
 
 }  // namespace testing
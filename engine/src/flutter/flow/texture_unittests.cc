@@ -79,6 +79,19 @@ TEST(TextureRegistryTest, GrContextCallbackTriggered) {
   ASSERT_TRUE(mock_texture2->gr_context_created());
 }
 
+TEST(TextureRegistryTest, TrimMemoryCallbackTriggered) {
+  TextureRegistry registry;
+  auto mock_texture1 = std::make_shared<MockTexture>(0);
+  auto mock_texture2 = std::make_shared<MockTexture>(1);
+
+  registry.RegisterTexture(mock_texture1);
+  registry.RegisterTexture(mock_texture2);
+  registry.UnregisterTexture(0);
+  registry.OnTrimMemory();
+  ASSERT_FALSE(mock_texture1->trimmed());
+  ASSERT_TRUE(mock_texture2->trimmed());
+}
+
 TEST(TextureRegistryTest, RegisterTextureTwice) {
   TextureRegistry registry;
   auto mock_texture1 = std::make_shared<MockTexture>(0);
@@ -4,19 +4,158 @@
 
 #include "flutter/flow/view_slicer.h"
 
+#include <iterator>
+#include <limits>
 #include <unordered_map>
+#include <utility>
 #include "flow/embedded_views.h"
 #include "fml/logging.h"
 
 namespace flutter {
 
-std::unordered_map<int64_t, DlRect> SliceViews(
+namespace {
+
+// The cost of an additional overlay layer, expressed as a number of
+// composited pixels. Besides its own composition pass, every overlay layer
+// is backed by a surface the size of the frame, so it is worth compositing
+// a fair amount of transparent pixels to save one.
+constexpr DlScalar kOverlayLayerCost = 512.0f * 512.0f;
+
+// An overlay stacked above the platform view at |index| in the composition
+// order.
+struct PendingOverlay {
+  size_t index;
+  SlicedOverlay overlay;
+};
+
+// Returns the area of the content of |overlay| that would end up below the
+// platform views stacked in (|from|, |to|] of |composition_order| if the
+// overlay was moved above them.
+DlScalar ComputeOccludedArea(
+    const SlicedOverlay& overlay,
+    size_t from,
+    size_t to,
+    const std::vector<int64_t>& composition_order,
+    const std::unordered_map<int64_t, DlRect>& view_rects) {
+  DlScalar occluded_area = 0.0f;
+  for (size_t j = from + 1; j <= to; j++) {
+    auto view_rect = view_rects.find(composition_order[j]);
+    if (view_rect == view_rects.end()) {
+      continue;
+    }
+    for (const SlicedOverlay::Piece& piece : overlay.pieces) {
+      occluded_area +=
+          piece.rect.IntersectionOrEmpty(view_rect->second).Area();
+    }
+  }
+  return occluded_area;
+}
+
+// Returns how much more expensive it is to composite |lower| and |upper| as
+// a single overlay rather than as two, which is negative if merging them is
+// worth it.
+DlScalar ComputeMergeCost(const PendingOverlay& lower,
+                          const PendingOverlay& upper) {
+  DlRect merged_rect = lower.overlay.rect.Union(upper.overlay.rect);
+  return merged_rect.Area() - lower.overlay.rect.Area() -
+         upper.overlay.rect.Area() - kOverlayLayerCost;
+}
+
+// Moves the content of |lower| into |upper|, cutting the platform views
+// stacked in between out of it.
+void MergeOverlays(PendingOverlay& lower,
+                   PendingOverlay& upper,
+                   const std::vector<int64_t>& composition_order,
+                   const std::unordered_map<int64_t, DlRect>& view_rects) {
+  for (SlicedOverlay::Piece& piece : lower.overlay.pieces) {
+    for (size_t j = lower.index + 1; j <= upper.index; j++) {
+      auto view_rect = view_rects.find(composition_order[j]);
+      if (view_rect != view_rects.end() &&
+          piece.rect.IntersectsWithRect(view_rect->second)) {
+        piece.occluders.push_back(view_rect->second);
+      }
+    }
+  }
+  upper.overlay.pieces.insert(
+      upper.overlay.pieces.begin(),
+      std::make_move_iterator(lower.overlay.pieces.begin()),
+      std::make_move_iterator(lower.overlay.pieces.end()));
+  upper.overlay.rect = lower.overlay.rect.Union(upper.overlay.rect);
+}
+
+// Merges the overlays in |pending| according to |options|.
+void MinimizeOverlays(std::vector<PendingOverlay>& pending,
+                      const std::vector<int64_t>& composition_order,
+                      const std::unordered_map<int64_t, DlRect>& view_rects,
+                      const ViewSlicerOptions& options) {
+  if (options.merge_overlays) {
+    std::vector<PendingOverlay> merged;
+    for (PendingOverlay& overlay : pending) {
+      if (!merged.empty()) {
+        PendingOverlay& lower = merged.back();
+        bool is_exact = ComputeOccludedArea(lower.overlay, lower.index,
+                                            overlay.index, composition_order,
+                                            view_rects) <= 0.0f;
+        if (is_exact && ComputeMergeCost(lower, overlay) < 0.0f) {
+          MergeOverlays(lower, overlay, composition_order, view_rects);
+          lower = std::move(overlay);
+          continue;
+        }
+      }
+      merged.push_back(std::move(overlay));
+    }
+    pending = std::move(merged);
+  }
+
+  if (options.max_overlay_count == 0) {
+    return;
+  }
+  while (pending.size() > options.max_overlay_count) {
+    // Merge the pair that composites the fewest additional pixels and hides
+    // the least content below the platform views in between.
+    size_t cheapest = 0;
+    DlScalar cheapest_cost = std::numeric_limits<DlScalar>::infinity();
+    for (size_t i = 0; i + 1 < pending.size(); i++) {
+      DlScalar cost =
+          ComputeMergeCost(pending[i], pending[i + 1]) +
+          ComputeOccludedArea(pending[i].overlay, pending[i].index,
+                              pending[i + 1].index, composition_order,
+                              view_rects);
+      if (cost < cheapest_cost) {
+        cheapest = i;
+        cheapest_cost = cost;
+      }
+    }
+    MergeOverlays(pending[cheapest], pending[cheapest + 1], composition_order,
+                  view_rects);
+    pending.erase(pending.begin() + cheapest);
+  }
+}
+
+}  // namespace
+
+void SlicedOverlay::RenderInto(
+    DlCanvas* canvas,
+    const std::unordered_map<int64_t, std::unique_ptr<EmbedderViewSlice>>&
+        slices) const {
+  for (const Piece& piece : pieces) {
+    DlAutoCanvasRestore save(canvas, /*do_save=*/true);
+    canvas->ClipRect(piece.rect);
+    for (const DlRect& occluder : piece.occluders) {
+      canvas->ClipRect(occluder, DlClipOp::kDifference);
+    }
+    slices.at(piece.view_id)->render_into(canvas);
+  }
+}
+
+std::unordered_map<int64_t, SlicedOverlay> SliceViewsIntoOverlays(
     DlCanvas* background_canvas,
     const std::vector<int64_t>& composition_order,
     const std::unordered_map<int64_t, std::unique_ptr<EmbedderViewSlice>>&
         slices,
-    const std::unordered_map<int64_t, DlRect>& view_rects) {
-  std::unordered_map<int64_t, DlRect> overlay_layers;
+    const std::unordered_map<int64_t, DlRect>& view_rects,
+    const ViewSlicerOptions& options) {
+  std::vector<PendingOverlay> pending_overlays;
 
   auto current_frame_view_count = composition_order.size();
 
@@ -108,7 +247,12 @@ std::unordered_map<int64_t, DlRect> SliceViews(
     }
 
     if (!full_joined_rect.IsEmpty()) {
-      overlay_layers.insert({view_id, full_joined_rect});
+      pending_overlays.push_back({
+          .index = i,
+          .overlay = {.rect = full_joined_rect,
+                      .pieces = {{.view_id = view_id,
+                                  .rect = full_joined_rect}}},
+      });
 
       // Clip the background canvas, so it doesn't contain any of the pixels
       // drawn on the overlay layer.
@@ -120,6 +264,28 @@ std::unordered_map<int64_t, DlRect> SliceViews(
   // Manually trigger the DlAutoCanvasRestore before we submit the frame
   save.Restore();
 
+  MinimizeOverlays(pending_overlays, composition_order, view_rects, options);
+
+  std::unordered_map<int64_t, SlicedOverlay> overlay_layers;
+  for (PendingOverlay& pending : pending_overlays) {
+    overlay_layers.insert({composition_order[pending.index],
+                           std::move(pending.overlay)});
+  }
+  return overlay_layers;
+}
+
+std::unordered_map<int64_t, DlRect> SliceViews(
+    DlCanvas* background_canvas,
+    const std::vector<int64_t>& composition_order,
+    const std::unordered_map<int64_t, std::unique_ptr<EmbedderViewSlice>>&
+        slices,
+    const std::unordered_map<int64_t, DlRect>& view_rects) {
+  std::unordered_map<int64_t, DlRect> overlay_layers;
+  for (const auto& [view_id, overlay] :
+       SliceViewsIntoOverlays(background_canvas, composition_order, slices,
+                              view_rects, ViewSlicerOptions())) {
+    overlay_layers.insert({view_id, overlay.rect});
+  }
   return overlay_layers;
 }
 
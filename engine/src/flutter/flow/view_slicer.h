@@ -6,13 +6,74 @@
 #define FLUTTER_FLOW_VIEW_SLICER_H_
 
 #include <unordered_map>
+#include <vector>
 #include "display_list/dl_canvas.h"
 #include "flow/embedded_views.h"
 
 namespace flutter {
 
+/// @brief Options that control how |SliceViewsIntoOverlays| trades overlay
+///        layers for composition work.
+struct ViewSlicerOptions {
+  /// Whether the content of consecutive overlays may be rendered into a
+  /// single overlay layer when that is cheaper than compositing them
+  /// separately. Overlays are only merged this way if none of their content
+  /// intersects the platform views stacked in between, so the result is
+  /// pixel identical.
+  bool merge_overlays = false;
+
+  /// The maximum number of overlay layers to produce, or 0 for no limit.
+  ///
+  /// Once exact merging runs out, the cheapest pairs of consecutive overlays
+  /// are merged and the platform views stacked in between are cut out of the
+  /// lower overlay's content instead. This assumes those platform views are
+  /// opaque rectangles.
+  size_t max_overlay_count = 0;
+};
+
+/// @brief The content of a single overlay layer above a platform view.
+struct SlicedOverlay {
+  /// A clipped view slice rendered into the overlay.
+  struct Piece {
+    int64_t view_id;
+    DlRect rect;
+    /// The platform views that are stacked above the slice but below the
+    /// overlay, which are cut out of the slice when it's rendered.
+    std::vector<DlRect> occluders;
+  };
+
+  /// The bounds of all pieces, in the coordinate space of the background
+  /// canvas.
+  DlRect rect;
+
+  /// The slices to render, in composition order.
+  std::vector<Piece> pieces;
+
+  /// Renders all pieces of the overlay into |canvas|.
+  void RenderInto(
+      DlCanvas* canvas,
+      const std::unordered_map<int64_t, std::unique_ptr<EmbedderViewSlice>>&
+          slices) const;
+};
+
+/// @brief Compute the required overlay layers and clip the view slices
+///        according to the size and position of the platform views.
+///
+/// The returned overlays are keyed by the platform view they are stacked
+/// directly above.
+std::unordered_map<int64_t, SlicedOverlay> SliceViewsIntoOverlays(
+    DlCanvas* background_canvas,
+    const std::vector<int64_t>& composition_order,
+    const std::unordered_map<int64_t, std::unique_ptr<EmbedderViewSlice>>&
+        slices,
+    const std::unordered_map<int64_t, DlRect>& view_rects,
+    const ViewSlicerOptions& options);
+
 /// @brief Compute the required overlay layers and clip the view slices
 ///        according to the size and position of the platform views.
+///
+/// Returns the bounds of one overlay above each platform view that has
+/// content stacked over it, which contains that view's slice only.
 std::unordered_map<int64_t, DlRect> SliceViews(
     DlCanvas* background_canvas,
     const std::vector<int64_t>& composition_order,
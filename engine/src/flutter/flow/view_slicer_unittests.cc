@@ -134,5 +134,97 @@ TEST(ViewSlicerTest, OverlappingTwoPVs) {
   EXPECT_EQ(overlay->second, DlRect::MakeLTRB(0, 0, 100, 100));
 }
 
+TEST(ViewSlicerTest, MergesOverlaysThatDoNotIntersectViewsInBetween) {
+  DisplayListBuilder builder(DlRect::MakeLTRB(0, 0, 100, 100));
+
+  std::vector<int64_t> composition_order = {1, 2};
+  std::unordered_map<int64_t, std::unique_ptr<EmbedderViewSlice>> slices;
+  AddSliceOfSize(slices, 1, DlRect::MakeLTRB(0, 0, 20, 20));
+  AddSliceOfSize(slices, 2, DlRect::MakeLTRB(60, 60, 80, 80));
+
+  std::unordered_map<int64_t, DlRect> view_rects = {
+      {1, DlRect::MakeLTRB(0, 0, 50, 50)},      //
+      {2, DlRect::MakeLTRB(50, 50, 100, 100)},  //
+  };
+
+  auto computed_overlays =
+      SliceViewsIntoOverlays(&builder, composition_order, slices, view_rects,
+                             {.merge_overlays = true});
+
+  // The content above view 1 doesn't intersect view 2, so a single overlay
+  // above view 2 can hold both slices.
+  EXPECT_EQ(computed_overlays.size(), 1u);
+  auto overlay = computed_overlays.find(2);
+  ASSERT_NE(overlay, computed_overlays.end());
+  EXPECT_EQ(overlay->second.rect, DlRect::MakeLTRB(0, 0, 80, 80));
+
+  ASSERT_EQ(overlay->second.pieces.size(), 2u);
+  EXPECT_EQ(overlay->second.pieces[0].view_id, 1);
+  EXPECT_EQ(overlay->second.pieces[0].rect, DlRect::MakeLTRB(0, 0, 20, 20));
+  EXPECT_TRUE(overlay->second.pieces[0].occluders.empty());
+  EXPECT_EQ(overlay->second.pieces[1].view_id, 2);
+  EXPECT_EQ(overlay->second.pieces[1].rect, DlRect::MakeLTRB(60, 60, 80, 80));
+  EXPECT_TRUE(overlay->second.pieces[1].occluders.empty());
+}
+
+TEST(ViewSlicerTest, DoesNotMergeOverlaysAcrossIntersectingViews) {
+  DisplayListBuilder builder(DlRect::MakeLTRB(0, 0, 100, 100));
+
+  std::vector<int64_t> composition_order = {1, 2};
+  std::unordered_map<int64_t, std::unique_ptr<EmbedderViewSlice>> slices;
+  AddSliceOfSize(slices, 1, DlRect::MakeLTRB(0, 0, 40, 40));
+  AddSliceOfSize(slices, 2, DlRect::MakeLTRB(60, 60, 90, 90));
+
+  std::unordered_map<int64_t, DlRect> view_rects = {
+      {1, DlRect::MakeLTRB(0, 0, 100, 100)},  //
+      {2, DlRect::MakeLTRB(0, 0, 50, 50)},    //
+  };
+
+  auto computed_overlays =
+      SliceViewsIntoOverlays(&builder, composition_order, slices, view_rects,
+                             {.merge_overlays = true});
+
+  // View 2 covers part of the content above view 1.
+  EXPECT_EQ(computed_overlays.size(), 2u);
+  auto overlay = computed_overlays.find(1);
+  ASSERT_NE(overlay, computed_overlays.end());
+  EXPECT_EQ(overlay->second.rect, DlRect::MakeLTRB(0, 0, 40, 40));
+  overlay = computed_overlays.find(2);
+  ASSERT_NE(overlay, computed_overlays.end());
+  EXPECT_EQ(overlay->second.rect, DlRect::MakeLTRB(60, 60, 90, 90));
+}
+
+TEST(ViewSlicerTest, CapsOverlayCount) {
+  DisplayListBuilder builder(DlRect::MakeLTRB(0, 0, 100, 100));
+
+  std::vector<int64_t> composition_order = {1, 2};
+  std::unordered_map<int64_t, std::unique_ptr<EmbedderViewSlice>> slices;
+  AddSliceOfSize(slices, 1, DlRect::MakeLTRB(0, 0, 40, 40));
+  AddSliceOfSize(slices, 2, DlRect::MakeLTRB(60, 60, 90, 90));
+
+  std::unordered_map<int64_t, DlRect> view_rects = {
+      {1, DlRect::MakeLTRB(0, 0, 100, 100)},  //
+      {2, DlRect::MakeLTRB(0, 0, 50, 50)},    //
+  };
+
+  auto computed_overlays =
+      SliceViewsIntoOverlays(&builder, composition_order, slices, view_rects,
+                             {.merge_overlays = true, .max_overlay_count = 1});
+
+  EXPECT_EQ(computed_overlays.size(), 1u);
+  auto overlay = computed_overlays.find(2);
+  ASSERT_NE(overlay, computed_overlays.end());
+  EXPECT_EQ(overlay->second.rect, DlRect::MakeLTRB(0, 0, 90, 90));
+
+  // View 2 is cut out of the content that was stacked below it.
+  ASSERT_EQ(overlay->second.pieces.size(), 2u);
+  EXPECT_EQ(overlay->second.pieces[0].view_id, 1);
+  ASSERT_EQ(overlay->second.pieces[0].occluders.size(), 1u);
+  EXPECT_EQ(overlay->second.pieces[0].occluders[0],
+            DlRect::MakeLTRB(0, 0, 50, 50));
+  EXPECT_EQ(overlay->second.pieces[1].view_id, 2);
+  EXPECT_TRUE(overlay->second.pieces[1].occluders.empty());
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -0,0 +1,116 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/async_file_io.h"
+
+#include <utility>
+#include <vector>
+
+#include "flutter/fml/build_config.h"
+#include "flutter/fml/file.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/make_copyable.h"
+#include "flutter/fml/trace_event.h"
+
+#if FML_OS_MACOSX || FML_OS_IOS
+#include "flutter/fml/platform/darwin/async_file_io_darwin.h"
+#elif FML_OS_LINUX
+#include "flutter/fml/platform/linux/async_file_io_uring.h"
+#endif
+
+namespace fml {
+
+namespace {
+
+std::unique_ptr<Mapping> ReadContents(const UniqueFD& file) {
+  FileMapping mapping(file);
+  if (!mapping.IsValid()) {
+    return nullptr;
+  }
+  if (mapping.GetSize() == 0) {
+    return std::make_unique<DataMapping>(std::vector<uint8_t>{});
+  }
+  return std::make_unique<MallocMapping>(
+      MallocMapping::Copy(mapping.GetMapping(), mapping.GetSize()));
+}
+
+}  // namespace
+
+std::unique_ptr<AsyncFileIO> AsyncFileIO::Create(
+    std::shared_ptr<BasicTaskRunner> workers) {
+#if FML_OS_MACOSX || FML_OS_IOS
+  return std::make_unique<AsyncFileIODarwin>(std::move(workers));
+#elif FML_OS_LINUX
+  std::unique_ptr<AsyncFileIO> io_uring = AsyncFileIOUring::Create(workers);
+  if (io_uring) {
+    return io_uring;
+  }
+  return CreateWithWorkers(std::move(workers));
+#else
+  // Android apps may not use io_uring.
+  return CreateWithWorkers(std::move(workers));
+#endif
+}
+
+std::unique_ptr<AsyncFileIO> AsyncFileIO::CreateWithWorkers(
+    std::shared_ptr<BasicTaskRunner> workers) {
+  return std::unique_ptr<AsyncFileIO>(new AsyncFileIO(std::move(workers)));
+}
+
+AsyncFileIO::AsyncFileIO(std::shared_ptr<BasicTaskRunner> workers)
+    : workers_(std::move(workers)) {
+  FML_DCHECK(workers_);
+}
+
+AsyncFileIO::~AsyncFileIO() = default;
+
+void AsyncFileIO::ReadFile(UniqueFD file,
+                           RefPtr<TaskRunner> callback_runner,
+                           ReadCallback callback) {
+  ReadFileOnWorkers(std::move(file), std::move(callback_runner),
+                    std::move(callback));
+}
+
+void AsyncFileIO::ReadFileOnWorkers(UniqueFD file,
+                                    RefPtr<TaskRunner> callback_runner,
+                                    ReadCallback callback) {
+  workers_->PostTask(fml::MakeCopyable(
+      [file = std::move(file), callback_runner = std::move(callback_runner),
+       callback = std::move(callback)]() mutable {
+        TRACE_EVENT0("flutter", "AsyncFileIO::ReadFileOnWorkers");
+        PostReadResult(callback_runner, std::move(callback),
+                       ReadContents(file));
+      }));
+}
+
+void AsyncFileIO::WriteFileAtomically(
+    std::shared_ptr<const UniqueFD> base_directory,
+    std::string file_name,
+    std::shared_ptr<const Mapping> data,
+    RefPtr<TaskRunner> callback_runner,
+    WriteCallback callback) {
+  workers_->PostTask(
+      [base_directory = std::move(base_directory),
+       file_name = std::move(file_name), data = std::move(data),
+       callback_runner = std::move(callback_runner),
+       callback = std::move(callback)]() {
+        TRACE_EVENT0("flutter", "AsyncFileIO::WriteFileAtomically");
+        bool success =
+            WriteAtomically(*base_directory, file_name.c_str(), *data);
+        callback_runner->PostTask(
+            [callback, success]() { callback(success); });
+      });
+}
+
+void AsyncFileIO::PostReadResult(const RefPtr<TaskRunner>& callback_runner,
+                                 ReadCallback callback,
+                                 std::unique_ptr<Mapping> contents) {
+  callback_runner->PostTask(
+      fml::MakeCopyable([callback = std::move(callback),
+                         contents = std::move(contents)]() mutable {
+        callback(std::move(contents));
+      }));
+}
+
+}  // namespace fml
@@ -0,0 +1,105 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_ASYNC_FILE_IO_H_
+#define FLUTTER_FML_ASYNC_FILE_IO_H_
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/memory/ref_ptr.h"
+#include "flutter/fml/task_runner.h"
+#include "flutter/fml/unique_fd.h"
+
+namespace fml {
+
+//------------------------------------------------------------------------------
+/// Reads and writes files without blocking the calling thread, and delivers
+/// the results to a task runner of the caller's choosing.
+///
+/// Reads are done with the asynchronous I/O facility of the platform where
+/// there is one that the process may use: io_uring on Linux and dispatch I/O
+/// on Darwin. Elsewhere, and for requests the platform facility can't
+/// handle, the I/O is done by blocking tasks posted to the workers the
+/// instance is created with. Writes always are.
+///
+/// The callbacks are not called for requests that are still in flight when
+/// the workers are shut down. Destroying the instance waits for the reads
+/// that the platform facility has in flight.
+///
+class AsyncFileIO {
+ public:
+  /// Called with the contents of the file, or null if it could not be read.
+  using ReadCallback = std::function<void(std::unique_ptr<Mapping> contents)>;
+
+  /// Called with whether the file was written.
+  using WriteCallback = std::function<void(bool success)>;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Creates an instance that uses the asynchronous I/O facility
+  ///             of the platform if there is one, and the |workers|
+  ///             otherwise.
+  ///
+  static std::unique_ptr<AsyncFileIO> Create(
+      std::shared_ptr<BasicTaskRunner> workers);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Creates an instance that does all the I/O on the |workers|.
+  ///
+  static std::unique_ptr<AsyncFileIO> CreateWithWorkers(
+      std::shared_ptr<BasicTaskRunner> workers);
+
+  virtual ~AsyncFileIO();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Reads all of |file| into memory, and calls |callback| with
+  ///             the contents on |callback_runner|. Unlike a |FileMapping|,
+  ///             the contents are read before the callback is called, so
+  ///             that using them doesn't fault pages in from storage.
+  ///
+  virtual void ReadFile(UniqueFD file,
+                        RefPtr<TaskRunner> callback_runner,
+                        ReadCallback callback);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Writes |data| to |file_name| in |base_directory| like
+  ///             |WriteAtomically|, and calls |callback| with the result on
+  ///             |callback_runner|.
+  ///
+  void WriteFileAtomically(std::shared_ptr<const UniqueFD> base_directory,
+                           std::string file_name,
+                           std::shared_ptr<const Mapping> data,
+                           RefPtr<TaskRunner> callback_runner,
+                           WriteCallback callback);
+
+ protected:
+  explicit AsyncFileIO(std::shared_ptr<BasicTaskRunner> workers);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Reads |file| on the workers. This is what |ReadFile| does
+  ///             unless overridden.
+  ///
+  void ReadFileOnWorkers(UniqueFD file,
+                         RefPtr<TaskRunner> callback_runner,
+                         ReadCallback callback);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Calls |callback| with |contents| on |callback_runner|.
+  ///
+  static void PostReadResult(const RefPtr<TaskRunner>& callback_runner,
+                             ReadCallback callback,
+                             std::unique_ptr<Mapping> contents);
+
+ private:
+  const std::shared_ptr<BasicTaskRunner> workers_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(AsyncFileIO);
+};
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_ASYNC_FILE_IO_H_
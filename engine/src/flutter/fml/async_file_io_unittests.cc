@@ -0,0 +1,161 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/async_file_io.h"
+
+#include <string>
+#include <vector>
+
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/file.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
+#include "flutter/fml/thread.h"
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace testing {
+
+namespace {
+
+std::string ToString(const Mapping& mapping) {
+  return std::string(reinterpret_cast<const char*>(mapping.GetMapping()),
+                     mapping.GetSize());
+}
+
+bool WriteFile(const UniqueFD& directory,
+               const char* name,
+               const std::string& contents) {
+  if (contents.empty()) {
+    // |WriteAtomically| doesn't write empty files.
+    return OpenFile(directory, name, true, FilePermission::kReadWrite)
+        .is_valid();
+  }
+  return WriteAtomically(directory, name, DataMapping(contents));
+}
+
+UniqueFD OpenForReading(const UniqueFD& directory, const char* name) {
+  return OpenFile(directory, name, false, FilePermission::kRead);
+}
+
+}  // namespace
+
+class AsyncFileIOTest : public ::testing::TestWithParam<bool> {
+ public:
+  AsyncFileIOTest()
+      : workers_(ConcurrentMessageLoop::Create(2)),
+        callback_thread_("callbacks"),
+        io_(GetParam() ? AsyncFileIO::Create(workers_->GetTaskRunner())
+                       : AsyncFileIO::CreateWithWorkers(
+                             workers_->GetTaskRunner())) {}
+
+  ~AsyncFileIOTest() override {
+    io_.reset();
+    callback_thread_.Join();
+  }
+
+  AsyncFileIO& io() { return *io_; }
+
+  RefPtr<TaskRunner> callback_runner() {
+    return callback_thread_.GetTaskRunner();
+  }
+
+  const UniqueFD& directory() { return directory_.fd(); }
+
+ private:
+  ScopedTemporaryDirectory directory_;
+  std::shared_ptr<ConcurrentMessageLoop> workers_;
+  Thread callback_thread_;
+  std::unique_ptr<AsyncFileIO> io_;
+};
+
+TEST_P(AsyncFileIOTest, ReadsFile) {
+  ASSERT_TRUE(WriteFile(directory(), "file", "Hello"));
+  CountDownLatch latch(1);
+  io().ReadFile(OpenForReading(directory(), "file"), callback_runner(),
+                [&](std::unique_ptr<Mapping> contents) {
+                  EXPECT_TRUE(callback_runner()->RunsTasksOnCurrentThread());
+                  EXPECT_TRUE(contents);
+                  if (contents) {
+                    EXPECT_EQ(ToString(*contents), "Hello");
+                  }
+                  latch.CountDown();
+                });
+  latch.Wait();
+}
+
+TEST_P(AsyncFileIOTest, ReadsEmptyFile) {
+  ASSERT_TRUE(WriteFile(directory(), "file", ""));
+  CountDownLatch latch(1);
+  io().ReadFile(OpenForReading(directory(), "file"), callback_runner(),
+                [&](std::unique_ptr<Mapping> contents) {
+                  EXPECT_TRUE(contents);
+                  if (contents) {
+                    EXPECT_EQ(contents->GetSize(), 0u);
+                  }
+                  latch.CountDown();
+                });
+  latch.Wait();
+}
+
+TEST_P(AsyncFileIOTest, FailsToReadInvalidFile) {
+  CountDownLatch latch(1);
+  io().ReadFile(OpenForReading(directory(), "missing"), callback_runner(),
+                [&](std::unique_ptr<Mapping> contents) {
+                  EXPECT_FALSE(contents);
+                  latch.CountDown();
+                });
+  latch.Wait();
+}
+
+TEST_P(AsyncFileIOTest, ReadsManyFilesAtOnce) {
+  // More than the reads the platform facility may have in flight.
+  constexpr size_t kFileCount = 200;
+  auto contents_of = [](size_t i) {
+    return std::string(i * 100, static_cast<char>('a' + i % 26));
+  };
+  for (size_t i = 0; i < kFileCount; i++) {
+    std::string name = std::to_string(i);
+    ASSERT_TRUE(WriteFile(directory(), name.c_str(), contents_of(i)));
+  }
+  CountDownLatch latch(kFileCount);
+  for (size_t i = 0; i < kFileCount; i++) {
+    std::string name = std::to_string(i);
+    io().ReadFile(OpenForReading(directory(), name.c_str()), callback_runner(),
+                  [&, i](std::unique_ptr<Mapping> contents) {
+                    EXPECT_TRUE(contents);
+                    if (contents) {
+                      EXPECT_EQ(ToString(*contents), contents_of(i));
+                    }
+                    latch.CountDown();
+                  });
+  }
+  latch.Wait();
+}
+
+TEST_P(AsyncFileIOTest, WritesFileAtomically) {
+  auto base_directory = std::make_shared<UniqueFD>(
+      OpenDirectory(directory(), ".", false, FilePermission::kRead));
+  auto data = std::make_shared<DataMapping>("World");
+  CountDownLatch latch(1);
+  io().WriteFileAtomically(base_directory, "file", data, callback_runner(),
+                           [&](bool success) {
+                             EXPECT_TRUE(success);
+                             latch.CountDown();
+                           });
+  latch.Wait();
+
+  FileMapping mapping(OpenForReading(directory(), "file"));
+  ASSERT_TRUE(mapping.IsValid());
+  EXPECT_EQ(ToString(mapping), "World");
+}
+
+INSTANTIATE_TEST_SUITE_P(AsyncFileIO,
+                         AsyncFileIOTest,
+                         ::testing::Bool(),
+                         [](const ::testing::TestParamInfo<bool>& info) {
+                           return info.param ? "Platform" : "Workers";
+                         });
+
+}  // namespace testing
+}  // namespace fml
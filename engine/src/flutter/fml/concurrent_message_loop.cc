@@ -11,19 +11,33 @@
 
 namespace fml {
 
+namespace {
+
+// The loop and index of the worker running on this thread, if any.
+thread_local const ConcurrentMessageLoop* tls_worker_loop = nullptr;
+thread_local size_t tls_worker_index = 0;
+
+}  // namespace
+
+ConcurrentMessageLoop::ConcurrentMessageLoop(size_t worker_count,
+                                             Executor executor)
+    : worker_count_(std::max<size_t>(worker_count, 1ul)),
+      executor_(std::move(executor)) {
+  for (size_t i = 0; i < worker_count_; ++i) {
+    worker_queues_.emplace_back(std::make_unique<Worker>());
+  }
+}
+
 ConcurrentMessageLoop::ConcurrentMessageLoop(size_t worker_count)
-    : worker_count_(std::max<size_t>(worker_count, 1ul)) {
+    : ConcurrentMessageLoop(worker_count, nullptr) {
+  // The queues exist before the workers that read them start.
   for (size_t i = 0; i < worker_count_; ++i) {
     workers_.emplace_back([i, this]() {
       fml::Thread::SetCurrentThreadName(fml::Thread::ThreadConfig(
           std::string{"io.worker." + std::to_string(i + 1)}));
-      WorkerMain();
+      WorkerMain(i);
     });
   }
-
-  for (const auto& worker : workers_) {
-    worker_thread_ids_.emplace_back(worker.get_id());
-  }
 }
 
 ConcurrentMessageLoop::~ConcurrentMessageLoop() {
@@ -43,73 +57,139 @@ std::shared_ptr<ConcurrentTaskRunner> ConcurrentMessageLoop::GetTaskRunner() {
 }
 
 void ConcurrentMessageLoop::PostTask(const fml::closure& task) {
+  // Keep the tasks posted by a worker on that worker, their data is likely
+  // still in its cache. Spread the other tasks over all workers.
+  size_t worker_index = tls_worker_loop == this
+                            ? tls_worker_index
+                            : next_worker_.fetch_add(1) % worker_count_;
+  PostTaskToWorker(task, worker_index);
+}
+
+void ConcurrentMessageLoop::PostTaskToWorker(const fml::closure& task,
+                                             size_t worker_index) {
   if (!task) {
     return;
   }
 
-  std::unique_lock lock(tasks_mutex_);
-
   // Don't just drop tasks on the floor in case of shutdown.
   if (shutdown_) {
     FML_DLOG(WARNING)
         << "Tried to post a task to shutdown concurrent message "
            "loop. The task will be executed on the callers thread.";
-    lock.unlock();
     ExecuteTask(task);
     return;
   }
 
-  tasks_.push(task);
+  {
+    Worker& worker = *worker_queues_[worker_index % worker_count_];
+    std::scoped_lock lock(worker.mutex);
+    worker.tasks.push_back(task);
+    ++task_count_;
+  }
 
-  // Unlock the mutex before notifying the condition variable because that mutex
-  // has to be acquired on the other thread anyway. Waiting in this scope till
-  // it is acquired there is a pessimization.
-  lock.unlock();
+  // The executor runs one task for each one posted, though not necessarily
+  // the one posted here if another worker stole it.
+  if (executor_) {
+    executor_([weak_loop = weak_from_this(), worker_index]() {
+      if (auto loop = weak_loop.lock()) {
+        loop->RunExecutorTask(worker_index % loop->worker_count_);
+      }
+    });
+    return;
+  }
 
-  tasks_condition_.notify_one();
+  // A worker going to sleep counts itself as sleeping before it checks for
+  // tasks, so either it sees the task counted above or it is seen here. The
+  // notification may only be skipped when no worker is sleeping, which saves
+  // taking the lock shared by all workers.
+  if (sleeping_worker_count_ == 0) {
+    return;
+  }
+  {
+    // Wait for a worker that saw no task to be sleeping before notifying it.
+    std::scoped_lock lock(sleep_mutex_);
+  }
+  sleep_condition_.notify_one();
 }
 
-void ConcurrentMessageLoop::WorkerMain() {
-  while (true) {
-    std::unique_lock lock(tasks_mutex_);
-    tasks_condition_.wait(lock, [&]() {
-      return !tasks_.empty() || shutdown_ || HasThreadTasksLocked();
-    });
+fml::closure ConcurrentMessageLoop::TakeTask(size_t worker_index) {
+  for (size_t i = 0; i < worker_count_; ++i) {
+    Worker& worker = *worker_queues_[(worker_index + i) % worker_count_];
+    std::scoped_lock lock(worker.mutex);
+    if (!worker.tasks.empty()) {
+      fml::closure task = std::move(worker.tasks.front());
+      worker.tasks.pop_front();
+      --task_count_;
+      return task;
+    }
+  }
+  return nullptr;
+}
 
-    // Shutdown cannot be read with the task mutex unlocked.
-    bool shutdown_now = shutdown_;
-    fml::closure task;
-    std::vector<fml::closure> thread_tasks;
+void ConcurrentMessageLoop::RunThreadTasks(Worker& worker) {
+  if (!worker.has_thread_tasks) {
+    return;
+  }
+  std::vector<fml::closure> thread_tasks;
+  {
+    std::scoped_lock lock(worker.mutex);
+    std::swap(thread_tasks, worker.thread_tasks);
+    worker.has_thread_tasks = false;
+  }
+  for (const auto& thread_task : thread_tasks) {
+    ExecuteTask(thread_task);
+  }
+}
 
-    if (!tasks_.empty()) {
-      task = tasks_.front();
-      tasks_.pop();
-    }
+void ConcurrentMessageLoop::RunExecutorTask(size_t worker_index) {
+  if (shutdown_) {
+    return;
+  }
 
-    if (HasThreadTasksLocked()) {
-      thread_tasks = GetThreadTasksLocked();
-      FML_DCHECK(!HasThreadTasksLocked());
-    }
+  // The executor may run the task from within another one, for example when
+  // it helps out while waiting for a job.
+  const ConcurrentMessageLoop* previous_loop = tls_worker_loop;
+  const size_t previous_index = tls_worker_index;
+  tls_worker_loop = this;
+  tls_worker_index = worker_index;
+  if (fml::closure task = TakeTask(worker_index)) {
+    ExecuteTask(task);
+  }
+  tls_worker_loop = previous_loop;
+  tls_worker_index = previous_index;
+}
 
-    // Don't hold onto the mutex while tasks are being executed as they could
-    // themselves try to post more tasks to the message loop.
-    lock.unlock();
+void ConcurrentMessageLoop::WorkerMain(size_t worker_index) {
+  tls_worker_loop = this;
+  tls_worker_index = worker_index;
+  Worker& worker = *worker_queues_[worker_index];
+
+  while (true) {
+    RunThreadTasks(worker);
 
-    TRACE_EVENT0("flutter", "ConcurrentWorkerWake");
-    // Execute the primary task we woke up for.
-    if (task) {
+    // Don't hold onto any lock while tasks are being executed as they could
+    // themselves try to post more tasks to the message loop.
+    if (fml::closure task = TakeTask(worker_index)) {
+      TRACE_EVENT0("flutter", "ConcurrentWorkerWake");
       ExecuteTask(task);
+      continue;
     }
 
-    // Execute any thread tasks.
-    for (const auto& thread_task : thread_tasks) {
-      ExecuteTask(thread_task);
-    }
+    std::unique_lock lock(sleep_mutex_);
+    ++sleeping_worker_count_;
+    sleep_condition_.wait(lock, [&]() {
+      return task_count_ > 0 || shutdown_ || worker.has_thread_tasks;
+    });
+    --sleeping_worker_count_;
 
-    if (shutdown_now) {
+    if (shutdown_) {
+      lock.unlock();
+      RunThreadTasks(worker);
       break;
     }
   }
+
+  tls_worker_loop = nullptr;
 }
 
 void ConcurrentMessageLoop::ExecuteTask(const fml::closure& task) {
@@ -117,34 +197,27 @@ void ConcurrentMessageLoop::ExecuteTask(const fml::closure& task) {
 }
 
 void ConcurrentMessageLoop::Terminate() {
-  std::scoped_lock lock(tasks_mutex_);
+  std::scoped_lock lock(sleep_mutex_);
   shutdown_ = true;
-  tasks_condition_.notify_all();
+  sleep_condition_.notify_all();
 }
 
 void ConcurrentMessageLoop::PostTaskToAllWorkers(const fml::closure& task) {
-  if (!task) {
+  if (!task || executor_) {
     return;
   }
 
-  std::scoped_lock lock(tasks_mutex_);
-  for (const auto& worker_thread_id : worker_thread_ids_) {
-    thread_tasks_[worker_thread_id].emplace_back(task);
+  for (auto& worker : worker_queues_) {
+    std::scoped_lock lock(worker->mutex);
+    worker->thread_tasks.emplace_back(task);
+    worker->has_thread_tasks = true;
   }
-  tasks_condition_.notify_all();
-}
-
-bool ConcurrentMessageLoop::HasThreadTasksLocked() const {
-  return thread_tasks_.count(std::this_thread::get_id()) > 0;
+  std::scoped_lock lock(sleep_mutex_);
+  sleep_condition_.notify_all();
 }
 
-std::vector<fml::closure> ConcurrentMessageLoop::GetThreadTasksLocked() {
-  auto found = thread_tasks_.find(std::this_thread::get_id());
-  FML_DCHECK(found != thread_tasks_.end());
-  std::vector<fml::closure> pending_tasks;
-  std::swap(pending_tasks, found->second);
-  thread_tasks_.erase(found);
-  return pending_tasks;
+bool ConcurrentMessageLoop::RunsTasksOnCurrentThread() {
+  return tls_worker_loop == this;
 }
 
 ConcurrentTaskRunner::ConcurrentTaskRunner(
@@ -169,14 +242,73 @@ void ConcurrentTaskRunner::PostTask(const fml::closure& task) {
   task();
 }
 
-bool ConcurrentMessageLoop::RunsTasksOnCurrentThread() {
-  std::scoped_lock lock(tasks_mutex_);
-  for (const auto& worker_thread_id : worker_thread_ids_) {
-    if (worker_thread_id == std::this_thread::get_id()) {
-      return true;
+void ConcurrentTaskRunner::PostTaskWithAffinity(const fml::closure& task,
+                                                size_t affinity_hint) {
+  if (!task) {
+    return;
+  }
+
+  if (auto loop = weak_loop_.lock()) {
+    loop->PostTaskToWorker(task, affinity_hint);
+    return;
+  }
+
+  FML_DLOG(WARNING)
+      << "Tried to post to a concurrent message loop that has already died. "
+         "Executing the task on the callers thread.";
+  task();
+}
+
+void ConcurrentTaskRunner::ParallelFor(
+    size_t count,
+    size_t grain_size,
+    const std::function<void(size_t begin, size_t end)>& task) {
+  if (count == 0 || !task) {
+    return;
+  }
+  grain_size = std::max<size_t>(grain_size, 1u);
+  const size_t chunk_count = (count + grain_size - 1) / grain_size;
+
+  struct State {
+    std::atomic_size_t next_chunk = 0;
+    std::mutex mutex;
+    std::condition_variable condition;
+    size_t done_chunks = 0;
+  };
+  auto state = std::make_shared<State>();
+
+  // Helpers that start after all chunks were taken return without touching
+  // |task|, which only lives until all chunks are done.
+  auto run_chunks = [state, &task, count, grain_size, chunk_count]() {
+    size_t ran_chunks = 0;
+    for (size_t chunk = state->next_chunk++; chunk < chunk_count;
+         chunk = state->next_chunk++) {
+      const size_t begin = chunk * grain_size;
+      task(begin, std::min(begin + grain_size, count));
+      ran_chunks++;
+    }
+    if (ran_chunks == 0) {
+      return;
+    }
+    std::scoped_lock lock(state->mutex);
+    state->done_chunks += ran_chunks;
+    if (state->done_chunks == chunk_count) {
+      state->condition.notify_all();
+    }
+  };
+
+  if (auto loop = weak_loop_.lock()) {
+    const size_t helper_count =
+        std::min(loop->GetWorkerCount(), chunk_count - 1);
+    for (size_t i = 0; i < helper_count; ++i) {
+      loop->PostTask(run_chunks);
     }
   }
-  return false;
+
+  run_chunks();
+  std::unique_lock lock(state->mutex);
+  state->condition.wait(
+      lock, [&]() { return state->done_chunks == chunk_count; });
 }
 
 }  // namespace fml
@@ -5,10 +5,14 @@
 #ifndef FLUTTER_FML_CONCURRENT_MESSAGE_LOOP_H_
 #define FLUTTER_FML_CONCURRENT_MESSAGE_LOOP_H_
 
+#include <atomic>
 #include <condition_variable>
-#include <map>
-#include <queue>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include "flutter/fml/closure.h"
 #include "flutter/fml/macros.h"
@@ -18,12 +22,40 @@ namespace fml {
 
 class ConcurrentTaskRunner;
 
+//------------------------------------------------------------------------------
+/// A pool of worker threads that run tasks in parallel.
+///
+/// Each worker has its own queue. Tasks posted from a worker go to its own
+/// queue, so that related work stays on the thread whose cache holds its
+/// data. Other tasks are spread over the queues, or put on the queue of the
+/// worker named by an affinity hint. A worker whose queue is empty steals
+/// the oldest task of another worker. As each queue has its own lock,
+/// workers only contend when they steal.
+///
+/// A loop may also be created with an executor that runs its tasks on threads
+/// the loop does not own, such as the job system of the application that
+/// embeds Flutter. The queues, affinity hints and stealing work the same way,
+/// but the executor decides which thread runs a task and when.
+///
 class ConcurrentMessageLoop
     : public std::enable_shared_from_this<ConcurrentMessageLoop> {
  public:
+  /// Runs |task| exactly once, on any thread.
+  using Executor = std::function<void(const fml::closure& task)>;
+
   static std::shared_ptr<ConcurrentMessageLoop> Create(
       size_t worker_count = std::thread::hardware_concurrency());
 
+  //----------------------------------------------------------------------------
+  /// @brief      Creates a loop without threads of its own that hands each
+  ///             posted task to |executor|. |worker_count| is the number of
+  ///             tasks the executor may run in parallel, which sizes the
+  ///             queues and the work split up by |ParallelFor|.
+  ///
+  static std::shared_ptr<ConcurrentMessageLoop> CreateWithExecutor(
+      size_t worker_count,
+      Executor executor);
+
   virtual ~ConcurrentMessageLoop();
 
   size_t GetWorkerCount() const;
@@ -32,33 +64,56 @@ class ConcurrentMessageLoop
 
   void Terminate();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Runs |task| once on each thread owned by the loop. Does
+  ///             nothing for a loop created with an executor, whose threads
+  ///             belong to someone else.
+  ///
   void PostTaskToAllWorkers(const fml::closure& task);
 
   bool RunsTasksOnCurrentThread();
 
  protected:
   explicit ConcurrentMessageLoop(size_t worker_count);
+  ConcurrentMessageLoop(size_t worker_count, Executor executor);
   virtual void ExecuteTask(const fml::closure& task);
 
  private:
   friend ConcurrentTaskRunner;
 
+  struct Worker {
+    std::mutex mutex;
+    std::deque<fml::closure> tasks;
+    std::vector<fml::closure> thread_tasks;
+    std::atomic_bool has_thread_tasks = false;
+  };
+
   size_t worker_count_ = 0;
+  Executor executor_;
+  std::vector<std::unique_ptr<Worker>> worker_queues_;
   std::vector<std::thread> workers_;
-  std::mutex tasks_mutex_;
-  std::condition_variable tasks_condition_;
-  std::queue<fml::closure> tasks_;
-  std::vector<std::thread::id> worker_thread_ids_;
-  std::map<std::thread::id, std::vector<fml::closure>> thread_tasks_;
-  bool shutdown_ = false;
+  std::atomic_size_t next_worker_ = 0;
+  // The number of tasks in all worker queues, updated with the lock of the
+  // queue held.
+  std::atomic_size_t task_count_ = 0;
+  std::atomic_size_t sleeping_worker_count_ = 0;
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_condition_;
+  std::atomic_bool shutdown_ = false;
 
-  void WorkerMain();
+  void WorkerMain(size_t worker_index);
 
   void PostTask(const fml::closure& task);
 
-  bool HasThreadTasksLocked() const;
+  void PostTaskToWorker(const fml::closure& task, size_t worker_index);
 
-  std::vector<fml::closure> GetThreadTasksLocked();
+  // Takes the oldest task of the worker, or steals one from another worker.
+  fml::closure TakeTask(size_t worker_index);
+
+  void RunThreadTasks(Worker& worker);
+
+  // Runs a task as the worker at |worker_index| on a thread of the executor.
+  void RunExecutorTask(size_t worker_index);
 
   FML_DISALLOW_COPY_AND_ASSIGN(ConcurrentMessageLoop);
 };
@@ -71,6 +126,28 @@ class ConcurrentTaskRunner : public BasicTaskRunner {
 
   void PostTask(const fml::closure& task) override;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Posts a task that prefers to run on the same worker as the
+  ///             other tasks posted with the same |affinity_hint|, such as
+  ///             the index of the tile or image the task works on. Another
+  ///             worker may still run it if that one is busy.
+  ///
+  void PostTaskWithAffinity(const fml::closure& task, size_t affinity_hint);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Splits the range [0, |count|) into chunks of at most
+  ///             |grain_size| items and calls |task| with the bounds of each
+  ///             chunk, in parallel on the workers and the calling thread.
+  ///             Returns once all chunks are done.
+  ///
+  ///             The calling thread runs chunks too, so this may be called
+  ///             from a worker without deadlocking when all other workers
+  ///             are busy.
+  ///
+  void ParallelFor(size_t count,
+                   size_t grain_size,
+                   const std::function<void(size_t begin, size_t end)>& task);
+
  private:
   friend ConcurrentMessageLoop;
 
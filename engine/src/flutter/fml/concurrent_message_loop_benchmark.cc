@@ -0,0 +1,73 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/concurrent_message_loop.h"
+
+#include <atomic>
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
+
+namespace fml {
+namespace benchmarking {
+
+static constexpr size_t kTaskCount = 1000;
+
+// Many small tasks posted from a thread that is not a worker, like bursts of
+// image decodes posted from the IO thread.
+static void BM_PostTasks(benchmark::State& state) {  // NOLINT
+  auto loop = ConcurrentMessageLoop::Create(state.range(0));
+  auto task_runner = loop->GetTaskRunner();
+  while (state.KeepRunning()) {
+    CountDownLatch latch(kTaskCount);
+    for (size_t i = 0; i < kTaskCount; i++) {
+      task_runner->PostTask([&latch]() { latch.CountDown(); });
+    }
+    latch.Wait();
+  }
+}
+
+// Tasks that fork other tasks, like parallel tessellation splitting its
+// work. The forked tasks stay on the queue of the worker that posted them
+// unless another worker is idle.
+static void BM_PostTasksFromWorkers(benchmark::State& state) {  // NOLINT
+  auto loop = ConcurrentMessageLoop::Create(state.range(0));
+  auto task_runner = loop->GetTaskRunner();
+  const size_t fork_count = loop->GetWorkerCount();
+  while (state.KeepRunning()) {
+    CountDownLatch latch(fork_count * kTaskCount);
+    for (size_t i = 0; i < fork_count; i++) {
+      task_runner->PostTask([&latch, task_runner]() {
+        for (size_t j = 0; j < kTaskCount; j++) {
+          task_runner->PostTask([&latch]() { latch.CountDown(); });
+        }
+      });
+    }
+    latch.Wait();
+  }
+}
+
+static void BM_ParallelFor(benchmark::State& state) {  // NOLINT
+  auto loop = ConcurrentMessageLoop::Create(state.range(0));
+  auto task_runner = loop->GetTaskRunner();
+  std::atomic_size_t sum = 0;
+  while (state.KeepRunning()) {
+    task_runner->ParallelFor(kTaskCount * 100, 100,
+                             [&sum](size_t begin, size_t end) {
+                               size_t chunk_sum = 0;
+                               for (size_t i = begin; i < end; i++) {
+                                 chunk_sum += i;
+                               }
+                               sum += chunk_sum;
+                             });
+  }
+  benchmark::DoNotOptimize(sum.load());
+}
+
+BENCHMARK(BM_PostTasks)->RangeMultiplier(2)->Range(1, 8);
+BENCHMARK(BM_PostTasksFromWorkers)->RangeMultiplier(2)->Range(1, 8);
+BENCHMARK(BM_ParallelFor)->RangeMultiplier(2)->Range(1, 8);
+
+}  // namespace benchmarking
+}  // namespace fml
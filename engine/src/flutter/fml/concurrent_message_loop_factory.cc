@@ -12,4 +12,11 @@ std::shared_ptr<ConcurrentMessageLoop> ConcurrentMessageLoop::Create(
       new ConcurrentMessageLoop(worker_count)};
 }
 
+std::shared_ptr<ConcurrentMessageLoop>
+ConcurrentMessageLoop::CreateWithExecutor(size_t worker_count,
+                                          Executor executor) {
+  return std::shared_ptr<ConcurrentMessageLoop>{
+      new ConcurrentMessageLoop(worker_count, std::move(executor))};
+}
+
 }  // namespace fml
@@ -5,6 +5,7 @@
 #include "flutter/fml/cpu_affinity.h"
 #include "flutter/fml/build_config.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <fstream>
 #include <optional>
@@ -32,6 +33,14 @@ bool RequestAffinity(CpuAffinity affinity) {
 #endif
 }
 
+CpuCluster CurrentCpuCluster() {
+#ifdef FML_OS_ANDROID
+  return AndroidCurrentCpuCluster();
+#else
+  return CpuCluster::kUnknown;
+#endif
+}
+
 CPUSpeedTracker::CPUSpeedTracker(std::vector<CpuIndexAndSpeed> data)
     : cpu_speeds_(std::move(data)) {
   std::optional<int64_t> max_speed = std::nullopt;
@@ -85,6 +94,60 @@ const std::vector<size_t>& CPUSpeedTracker::GetIndices(
   }
 }
 
+CpuCluster CPUSpeedTracker::GetCluster(size_t index) const {
+  if (!valid_) {
+    return CpuCluster::kUnknown;
+  }
+  auto contains = [index](const std::vector<size_t>& indices) {
+    return std::find(indices.begin(), indices.end(), index) != indices.end();
+  };
+  if (contains(performance_)) {
+    return CpuCluster::kPerformance;
+  }
+  if (contains(efficiency_)) {
+    return CpuCluster::kEfficiency;
+  }
+  if (contains(not_performance_)) {
+    return CpuCluster::kMiddle;
+  }
+  return CpuCluster::kUnknown;
+}
+
+bool CPUSpeedTracker::IsPerformanceThrottled(
+    const std::vector<CpuIndexAndSpeed>& current_max_speeds) const {
+  if (!valid_) {
+    return false;
+  }
+  // The fastest of the other cores. Once the performance cores are no faster,
+  // keeping threads on them only leaves fewer cores to run on.
+  int64_t other_max_speed = 0;
+  for (const auto& data : cpu_speeds_) {
+    if (GetCluster(data.index) != CpuCluster::kPerformance) {
+      other_max_speed = std::max(other_max_speed, data.speed);
+    }
+  }
+  bool has_performance_speed = false;
+  for (const auto& data : current_max_speeds) {
+    if (GetCluster(data.index) != CpuCluster::kPerformance) {
+      continue;
+    }
+    if (data.speed > other_max_speed) {
+      return false;
+    }
+    has_performance_speed = true;
+  }
+  return has_performance_speed;
+}
+
+void CpuClusterTimes::Add(CpuCluster cluster, fml::TimeDelta duration) {
+  auto& time = times_[static_cast<size_t>(cluster)];
+  time = time + duration;
+}
+
+fml::TimeDelta CpuClusterTimes::Get(CpuCluster cluster) const {
+  return times_[static_cast<size_t>(cluster)];
+}
+
 // Get the size of the cpuinfo file by reading it until the end. This is
 // required because files under /proc do not always return a valid size
 // when using fseek(0, SEEK_END) + ftell(). Nor can they be mmap()-ed.
@@ -5,11 +5,14 @@
 #ifndef FLUTTER_FML_CPU_AFFINITY_H_
 #define FLUTTER_FML_CPU_AFFINITY_H_
 
+#include <array>
 #include <cstdint>
 #include <optional>
 #include <string>
 #include <vector>
 
+#include "flutter/fml/time/time_delta.h"
+
 namespace fml {
 
 /// The CPU Affinity provides a hint to the operating system on which cores a
@@ -32,6 +35,21 @@ enum class CpuAffinity {
   kNotEfficiency,
 };
 
+/// The group of cores, by their maximum speed, that a CPU belongs to.
+enum class CpuCluster {
+  /// @brief The cores could not be told apart.
+  kUnknown,
+
+  /// @brief The slowest cores.
+  kEfficiency,
+
+  /// @brief The cores that are neither the slowest nor the fastest.
+  kMiddle,
+
+  /// @brief The fastest cores.
+  kPerformance,
+};
+
 /// @brief Request count of efficiency cores.
 ///
 ///        Efficiency cores are defined as those with the lowest reported
@@ -48,8 +66,20 @@ std::optional<size_t> EfficiencyCoreCount();
 ///        Affinity requests are based on documented CPU speed. This speed data
 ///        is parsed from cpuinfo_max_freq files, see also:
 ///        https://www.kernel.org/doc/Documentation/cpu-freq/user-guide.txt
+///
+///        While the performance cores are throttled, see
+///        `CPUSpeedTracker::IsPerformanceThrottled`, a request for
+///        `CpuAffinity::kPerformance` is widened to
+///        `CpuAffinity::kNotEfficiency`. Requesting the affinity again moves
+///        the thread back once the throttling ends.
 bool RequestAffinity(CpuAffinity affinity);
 
+/// @brief The cluster of the core that the current thread is running on.
+///
+///        This is only supported on Android devices, and returns
+///        `CpuCluster::kUnknown` elsewhere.
+CpuCluster CurrentCpuCluster();
+
 struct CpuIndexAndSpeed {
   // The index of the given CPU.
   size_t index;
@@ -77,6 +107,18 @@ class CPUSpeedTracker {
   ///        If the tracker is valid, this will always return a non-empty set.
   const std::vector<size_t>& GetIndices(CpuAffinity affinity) const;
 
+  /// @brief Return the cluster of the CPU with the given index, or
+  ///        `CpuCluster::kUnknown` if the tracker is not valid.
+  CpuCluster GetCluster(size_t index) const;
+
+  /// @brief Whether the performance cores are limited to no more than the
+  ///        speed of the other cores, for example by thermal throttling.
+  ///
+  ///        The `current_max_speeds` are the speeds that the cores are
+  ///        currently limited to, as reported by scaling_max_freq.
+  bool IsPerformanceThrottled(
+      const std::vector<CpuIndexAndSpeed>& current_max_speeds) const;
+
  private:
   bool valid_ = false;
   std::vector<CpuIndexAndSpeed> cpu_speeds_;
@@ -86,6 +128,20 @@ class CPUSpeedTracker {
   std::vector<size_t> not_efficiency_;
 };
 
+/// @brief The time that a thread spent running on each `CpuCluster`.
+///
+///        This is not thread-safe, and is meant to be owned by the thread it
+///        accounts for.
+class CpuClusterTimes {
+ public:
+  void Add(CpuCluster cluster, fml::TimeDelta duration);
+
+  fml::TimeDelta Get(CpuCluster cluster) const;
+
+ private:
+  std::array<fml::TimeDelta, 4> times_;
+};
+
 /// @note Visible for testing.
 std::optional<int64_t> ReadIntFromFile(const std::string& path);
 
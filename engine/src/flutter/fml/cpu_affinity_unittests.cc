@@ -15,6 +15,7 @@ namespace testing {
 TEST(CpuAffinity, NonAndroidPlatformDefaults) {
   ASSERT_FALSE(fml::EfficiencyCoreCount().has_value());
   ASSERT_TRUE(fml::RequestAffinity(fml::CpuAffinity::kEfficiency));
+  ASSERT_EQ(fml::CurrentCpuCluster(), CpuCluster::kUnknown);
 }
 
 TEST(CpuAffinity, NormalSlowMedFastCores) {
@@ -34,6 +35,48 @@ TEST(CpuAffinity, NormalSlowMedFastCores) {
   ASSERT_EQ(tracker.GetIndices(CpuAffinity::kNotEfficiency)[1], 2u);
 }
 
+TEST(CpuAffinity, Clusters) {
+  auto speeds = {CpuIndexAndSpeed{.index = 0, .speed = 1},
+                 CpuIndexAndSpeed{.index = 1, .speed = 2},
+                 CpuIndexAndSpeed{.index = 2, .speed = 3}};
+  auto tracker = CPUSpeedTracker(speeds);
+
+  ASSERT_EQ(tracker.GetCluster(0), CpuCluster::kEfficiency);
+  ASSERT_EQ(tracker.GetCluster(1), CpuCluster::kMiddle);
+  ASSERT_EQ(tracker.GetCluster(2), CpuCluster::kPerformance);
+  ASSERT_EQ(tracker.GetCluster(3), CpuCluster::kUnknown);
+  ASSERT_EQ(CPUSpeedTracker({}).GetCluster(0), CpuCluster::kUnknown);
+}
+
+TEST(CpuAffinity, PerformanceThrottling) {
+  auto speeds = {CpuIndexAndSpeed{.index = 0, .speed = 1},
+                 CpuIndexAndSpeed{.index = 1, .speed = 2},
+                 CpuIndexAndSpeed{.index = 2, .speed = 3},
+                 CpuIndexAndSpeed{.index = 3, .speed = 3}};
+  auto tracker = CPUSpeedTracker(speeds);
+
+  ASSERT_FALSE(tracker.IsPerformanceThrottled({}));
+  ASSERT_FALSE(tracker.IsPerformanceThrottled(
+      {CpuIndexAndSpeed{.index = 2, .speed = 3},
+       CpuIndexAndSpeed{.index = 3, .speed = 2}}));
+  ASSERT_TRUE(tracker.IsPerformanceThrottled(
+      {CpuIndexAndSpeed{.index = 2, .speed = 2},
+       CpuIndexAndSpeed{.index = 3, .speed = 1}}));
+}
+
+TEST(CpuAffinity, ClusterTimes) {
+  CpuClusterTimes times;
+  times.Add(CpuCluster::kPerformance, fml::TimeDelta::FromMilliseconds(2));
+  times.Add(CpuCluster::kEfficiency, fml::TimeDelta::FromMilliseconds(1));
+  times.Add(CpuCluster::kPerformance, fml::TimeDelta::FromMilliseconds(3));
+
+  ASSERT_EQ(times.Get(CpuCluster::kPerformance),
+            fml::TimeDelta::FromMilliseconds(5));
+  ASSERT_EQ(times.Get(CpuCluster::kEfficiency),
+            fml::TimeDelta::FromMilliseconds(1));
+  ASSERT_EQ(times.Get(CpuCluster::kMiddle), fml::TimeDelta::Zero());
+}
+
 TEST(CpuAffinity, NoCpuData) {
   auto tracker = CPUSpeedTracker({});
 
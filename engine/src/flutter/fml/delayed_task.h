@@ -15,10 +15,13 @@ namespace fml {
 
 class DelayedTask {
  public:
+  /// The |deadline| is the time by which the task should have run, if any,
+  /// such as the end of the frame a vsync task is for.
   DelayedTask(size_t order,
               const fml::closure& task,
               fml::TimePoint target_time,
-              fml::TaskSourceGrade task_source_grade);
+              fml::TaskSourceGrade task_source_grade,
+              fml::TimePoint deadline = fml::TimePoint::Max());
 
   DelayedTask(const DelayedTask& other);
 
@@ -30,6 +33,8 @@ class DelayedTask {
 
   fml::TaskSourceGrade GetTaskSourceGrade() const;
 
+  fml::TimePoint GetDeadline() const;
+
   bool operator>(const DelayedTask& other) const;
 
  private:
@@ -37,6 +42,7 @@ class DelayedTask {
   fml::closure task_;
   fml::TimePoint target_time_;
   fml::TaskSourceGrade task_source_grade_;
+  fml::TimePoint deadline_;
 };
 
 using DelayedTaskQueue = std::priority_queue<DelayedTask,
@@ -0,0 +1,66 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/mapping_registry.h"
+
+namespace fml {
+
+MappingRegistry& MappingRegistry::GetRegistryForProcess() {
+  static MappingRegistry* registry = new MappingRegistry();
+  return *registry;
+}
+
+MappingRegistry::MappingRegistry() = default;
+
+MappingRegistry::~MappingRegistry() = default;
+
+std::shared_ptr<const Mapping> MappingRegistry::GetOrCreate(
+    const std::string& key,
+    const Factory& create) {
+  std::scoped_lock lock(mutex_);
+  auto found = mappings_.find(key);
+  if (found != mappings_.end()) {
+    if (std::shared_ptr<const Mapping> mapping = found->second.lock()) {
+      return mapping;
+    }
+  }
+
+  // The entries of released mappings are only dropped here, which keeps the
+  // registry as large as the number of mappings that were in use at once.
+  for (auto it = mappings_.begin(); it != mappings_.end();) {
+    if (it->second.expired()) {
+      it = mappings_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  std::shared_ptr<const Mapping> mapping = create();
+  if (mapping) {
+    mappings_[key] = mapping;
+  }
+  return mapping;
+}
+
+size_t MappingRegistry::GetUseCount(const std::string& key) const {
+  std::scoped_lock lock(mutex_);
+  auto found = mappings_.find(key);
+  if (found == mappings_.end()) {
+    return 0;
+  }
+  return found->second.use_count();
+}
+
+size_t MappingRegistry::GetMappingCount() const {
+  std::scoped_lock lock(mutex_);
+  size_t count = 0;
+  for (const auto& [key, mapping] : mappings_) {
+    if (!mapping.expired()) {
+      count++;
+    }
+  }
+  return count;
+}
+
+}  // namespace fml
@@ -0,0 +1,73 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_MAPPING_REGISTRY_H_
+#define FLUTTER_FML_MAPPING_REGISTRY_H_
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
+
+namespace fml {
+
+//------------------------------------------------------------------------------
+/// @brief      Mappings of data by a key that identifies the data, such as the
+///             path of the file that it is read from, so that all the users
+///             of the same data in the process share one mapping of it.
+///
+///             The registry doesn't keep the mappings alive. A mapping is
+///             released once none of its users hold it, and the next request
+///             for its key creates it again.
+///
+class MappingRegistry {
+ public:
+  using Factory = std::function<std::shared_ptr<const Mapping>()>;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The registry shared by all the engines in the process.
+  ///
+  static MappingRegistry& GetRegistryForProcess();
+
+  MappingRegistry();
+
+  ~MappingRegistry();
+
+  //----------------------------------------------------------------------------
+  /// @brief      The mapping for `key` if one is in use, or else the mapping
+  ///             created by `create`, which is then shared with the later
+  ///             users of `key`.
+  ///
+  ///             The mapping isn't registered if `create` returns nullptr.
+  ///             The registry is locked while `create` runs, so it must not
+  ///             use the registry.
+  ///
+  std::shared_ptr<const Mapping> GetOrCreate(const std::string& key,
+                                             const Factory& create);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of holders of the mapping for `key`, or zero if
+  ///             it isn't in use.
+  ///
+  size_t GetUseCount(const std::string& key) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of mappings that are in use.
+  ///
+  size_t GetMappingCount() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, std::weak_ptr<const Mapping>> mappings_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(MappingRegistry);
+};
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_MAPPING_REGISTRY_H_
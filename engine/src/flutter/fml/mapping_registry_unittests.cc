@@ -0,0 +1,68 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/mapping_registry.h"
+
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace testing {
+
+namespace {
+
+std::shared_ptr<const Mapping> MakeMapping(int* create_count) {
+  (*create_count)++;
+  return std::make_shared<DataMapping>(std::vector<uint8_t>{1, 2, 3});
+}
+
+}  // namespace
+
+TEST(MappingRegistryTest, SharesMappingsInUse) {
+  MappingRegistry registry;
+  int create_count = 0;
+  auto first = registry.GetOrCreate(
+      "snapshot", [&create_count] { return MakeMapping(&create_count); });
+  auto second = registry.GetOrCreate(
+      "snapshot", [&create_count] { return MakeMapping(&create_count); });
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(create_count, 1);
+  EXPECT_EQ(registry.GetUseCount("snapshot"), 2u);
+
+  auto other = registry.GetOrCreate(
+      "other", [&create_count] { return MakeMapping(&create_count); });
+  EXPECT_NE(other, first);
+  EXPECT_EQ(create_count, 2);
+  EXPECT_EQ(registry.GetMappingCount(), 2u);
+}
+
+TEST(MappingRegistryTest, ReleasesUnusedMappings) {
+  MappingRegistry registry;
+  int create_count = 0;
+  auto mapping = registry.GetOrCreate(
+      "snapshot", [&create_count] { return MakeMapping(&create_count); });
+  std::weak_ptr<const Mapping> weak = mapping;
+  mapping.reset();
+  EXPECT_TRUE(weak.expired());
+  EXPECT_EQ(registry.GetUseCount("snapshot"), 0u);
+  EXPECT_EQ(registry.GetMappingCount(), 0u);
+
+  mapping = registry.GetOrCreate(
+      "snapshot", [&create_count] { return MakeMapping(&create_count); });
+  EXPECT_NE(mapping, nullptr);
+  EXPECT_EQ(create_count, 2);
+}
+
+TEST(MappingRegistryTest, DoesNotRegisterMissingMappings) {
+  MappingRegistry registry;
+  EXPECT_EQ(registry.GetOrCreate("missing", [] { return nullptr; }), nullptr);
+  int create_count = 0;
+  EXPECT_NE(registry.GetOrCreate(
+                "missing",
+                [&create_count] { return MakeMapping(&create_count); }),
+            nullptr);
+  EXPECT_EQ(create_count, 1);
+}
+
+}  // namespace testing
+}  // namespace fml
@@ -0,0 +1,103 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#define FML_USED_ON_EMBEDDER
+
+#include "flutter/fml/memory/biased_ref_counted.h"
+
+#include "flutter/fml/message_loop.h"
+#include "flutter/fml/task_runner.h"
+
+namespace fml {
+namespace internal {
+
+BiasedRefCountedThreadSafeBase::BiasedRefCountedThreadSafeBase()
+    : owner_thread_(std::this_thread::get_id()) {
+  if (MessageLoop::IsInitializedForCurrentThread()) {
+    owner_task_runner_ = MessageLoop::GetCurrent().GetTaskRunner();
+  }
+  if (owner_task_runner_) {
+    biased_count_ = 1u;
+    owner_merged_ = false;
+    shared_ = 0;
+  } else {
+    biased_count_ = 0u;
+    owner_merged_ = true;
+    shared_ = kCountUnit | kMerged;
+  }
+}
+
+BiasedRefCountedThreadSafeBase::~BiasedRefCountedThreadSafeBase() {
+#ifndef NDEBUG
+  FML_DCHECK(!adoption_required_);
+  // Should only be destroyed as a result of |Release()|.
+  FML_DCHECK(destruction_started_);
+#endif
+}
+
+bool BiasedRefCountedThreadSafeBase::HasOneRef() const {
+  int64_t shared = shared_.load(std::memory_order_acquire);
+  if (IsBiased()) {
+    return biased_count_ == 1u && shared < kCountUnit && shared >= 0;
+  }
+  return (shared & kMerged) && shared >= kCountUnit &&
+         shared < 2 * kCountUnit;
+}
+
+bool BiasedRefCountedThreadSafeBase::MergeOnOwnerThread() const {
+  FML_DCHECK(std::this_thread::get_id() == owner_thread_ ||
+             owner_task_runner_->RunsTasksOnCurrentThread());
+  FML_DCHECK(!owner_merged_);
+  int64_t merged = biased_count_ * kCountUnit + kMerged;
+  int64_t shared =
+      shared_.fetch_add(merged, std::memory_order_acq_rel) + merged;
+  biased_count_ = 0u;
+  owner_merged_ = true;
+  if (shared < kCountUnit) {
+#ifndef NDEBUG
+    destruction_started_ = true;
+#endif
+    return true;
+  }
+  return false;
+}
+
+bool BiasedRefCountedThreadSafeBase::ReleaseUnmerged(
+    ReleaseProc release) const {
+  int64_t shared = shared_.load(std::memory_order_relaxed);
+  int64_t released;
+  bool queue_merge;
+  do {
+    // A negative count means some of the references counted by the owner
+    // thread were released here. Instead of being released, the first such
+    // reference is handed to a task that merges the counts on the owner
+    // thread, so that the object outlives the merge.
+    queue_merge = !(shared & (kMerged | kMergeQueued)) && shared < kCountUnit;
+    released = queue_merge ? shared | kMergeQueued : shared - kCountUnit;
+  } while (!shared_.compare_exchange_weak(shared, released,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_relaxed));
+
+  if (queue_merge) {
+    owner_task_runner_->PostTask([this, release]() {
+      if (!owner_merged_) {
+        [[maybe_unused]] bool deleted = MergeOnOwnerThread();
+        FML_DCHECK(!deleted);
+      }
+      release(this);
+    });
+    return false;
+  }
+
+  if ((released & kMerged) && released < kCountUnit) {
+#ifndef NDEBUG
+    destruction_started_ = true;
+#endif
+    return true;
+  }
+  return false;
+}
+
+}  // namespace internal
+}  // namespace fml
@@ -0,0 +1,203 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Provides a base class for reference-counted classes whose references are
+// mostly taken and released on a single thread.
+
+#ifndef FLUTTER_FML_MEMORY_BIASED_REF_COUNTED_H_
+#define FLUTTER_FML_MEMORY_BIASED_REF_COUNTED_H_
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/memory/ref_ptr.h"
+
+namespace fml {
+
+class TaskRunner;
+
+namespace internal {
+
+// See |BiasedRefCountedThreadSafe| below for comments on the public methods.
+class BiasedRefCountedThreadSafeBase {
+ public:
+  void AddRef() const {
+#ifndef NDEBUG
+    FML_DCHECK(!adoption_required_);
+    FML_DCHECK(!destruction_started_);
+#endif
+    if (IsBiased()) {
+      biased_count_++;
+      return;
+    }
+    shared_.fetch_add(kCountUnit, std::memory_order_relaxed);
+  }
+
+  bool HasOneRef() const;
+
+  void AssertHasOneRef() const { FML_DCHECK(HasOneRef()); }
+
+ protected:
+  using ReleaseProc = void (*)(const BiasedRefCountedThreadSafeBase*);
+
+  BiasedRefCountedThreadSafeBase();
+  ~BiasedRefCountedThreadSafeBase();
+
+  // Returns true if the object should self-delete. |release| releases a
+  // reference the way the subclass does, and is used to release the
+  // reference held while the owner thread merges the counts.
+  bool Release(ReleaseProc release) const {
+#ifndef NDEBUG
+    FML_DCHECK(!adoption_required_);
+    FML_DCHECK(!destruction_started_);
+#endif
+    if (IsBiased()) {
+      FML_DCHECK(biased_count_ != 0u);
+      if (--biased_count_ != 0u) {
+        return false;
+      }
+      return MergeOnOwnerThread();
+    }
+    // Once merged, the counts stay merged.
+    if (!(shared_.load(std::memory_order_relaxed) & kMerged)) {
+      return ReleaseUnmerged(release);
+    }
+    int64_t shared =
+        shared_.fetch_sub(kCountUnit, std::memory_order_release) - kCountUnit;
+    if (shared < kCountUnit) {
+      std::atomic_thread_fence(std::memory_order_acquire);
+#ifndef NDEBUG
+      destruction_started_ = true;
+#endif
+      return true;
+    }
+    return false;
+  }
+
+#ifndef NDEBUG
+  void Adopt() {
+    FML_DCHECK(adoption_required_);
+    adoption_required_ = false;
+  }
+#endif
+
+ private:
+  // The shared count is stored in multiples of |kCountUnit|, and the low
+  // bits hold flags.
+  static constexpr int64_t kMerged = 1;
+  static constexpr int64_t kMergeQueued = 2;
+  static constexpr int64_t kCountUnit = 4;
+
+  bool IsBiased() const {
+    return std::this_thread::get_id() == owner_thread_ && !owner_merged_;
+  }
+
+  // Folds the biased count into the shared count, after which all
+  // references are counted atomically. Must be called on the owner thread.
+  // Returns true if no references are left.
+  bool MergeOnOwnerThread() const;
+
+  // Releases a reference on a thread other than the owner thread while the
+  // counts may not be merged yet. If the reference was counted by the owner
+  // thread, the owner thread is asked to merge the counts, and the reference
+  // is released after it has. Returns true if the object should self-delete.
+  bool ReleaseUnmerged(ReleaseProc release) const;
+
+  const std::thread::id owner_thread_;
+  // The owner thread's task runner, or null if it has none, in which case
+  // the counts start merged.
+  RefPtr<TaskRunner> owner_task_runner_;
+
+  // Only accessed on the owner thread.
+  mutable uint32_t biased_count_;
+  mutable bool owner_merged_;
+
+  mutable std::atomic<int64_t> shared_;
+
+#ifndef NDEBUG
+  mutable bool adoption_required_ = true;
+  mutable bool destruction_started_ = false;
+#endif
+
+  FML_DISALLOW_COPY_AND_ASSIGN(BiasedRefCountedThreadSafeBase);
+};
+
+}  // namespace internal
+
+// A base class for thread-safe reference-counted classes that are mostly
+// referenced on the thread that created them, the "owner" thread. Use like
+// |RefCountedThreadSafe| (see ref_counted.h).
+//
+// References taken and released on the owner thread only update a plain
+// integer, and references on other threads are counted atomically, as
+// described in "Biased Reference Counting" (Choi, Shull and Torrellas, PACT
+// 2018). When a reference is released on another thread than the one it was
+// taken on, the owner thread is asked, through a task posted to its task
+// runner, to merge both counts, after which all references are counted
+// atomically. The owner thread also merges the counts when it releases its
+// last reference.
+//
+// The owner thread must therefore have a |MessageLoop| for the counts to be
+// biased. Objects created on other threads count all references atomically.
+// Because releasing a reference on another thread may post a task, such
+// objects must not be released while holding task queue locks, for example
+// from tasks destroyed while a task queue is being disposed of. An object
+// whose owner thread stops running tasks before the merge is leaked.
+template <typename T>
+class BiasedRefCountedThreadSafe
+    : public internal::BiasedRefCountedThreadSafeBase {
+ public:
+  // Adds a reference to this object.
+  // Inherited from the internal superclass:
+  //   void AddRef() const;
+
+  // Releases a reference to this object. This will destroy this object once the
+  // last reference is released.
+  void Release() const {
+    if (internal::BiasedRefCountedThreadSafeBase::Release(&ReleaseRef)) {
+      delete static_cast<const T*>(this);
+    }
+  }
+
+  // Returns true if there is exactly one reference to this object. Returns
+  // false on threads other than the owner thread until the counts have been
+  // merged.
+  // Inherited from the internal superclass:
+  //   bool HasOneRef();
+
+  // Asserts that there is exactly one reference to this object; does nothing in
+  // Release builds (when |NDEBUG| is defined).
+  // Inherited from the internal superclass:
+  //   void AssertHasOneRef();
+
+ protected:
+  BiasedRefCountedThreadSafe() {}
+
+  ~BiasedRefCountedThreadSafe() {}
+
+ private:
+  static void ReleaseRef(const internal::BiasedRefCountedThreadSafeBase* base) {
+    static_cast<const BiasedRefCountedThreadSafe<T>*>(base)->Release();
+  }
+
+#ifndef NDEBUG
+  template <typename U>
+  friend RefPtr<U> AdoptRef(U*);
+  void Adopt() { internal::BiasedRefCountedThreadSafeBase::Adopt(); }
+#endif
+
+  FML_DISALLOW_COPY_AND_ASSIGN(BiasedRefCountedThreadSafe);
+};
+
+// Like |FML_FRIEND_REF_COUNTED_THREAD_SAFE()|, for subclasses of
+// |BiasedRefCountedThreadSafe|.
+#define FML_FRIEND_BIASED_REF_COUNTED_THREAD_SAFE(T) \
+  friend class ::fml::BiasedRefCountedThreadSafe<T>
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_MEMORY_BIASED_REF_COUNTED_H_
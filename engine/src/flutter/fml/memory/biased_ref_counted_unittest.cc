@@ -0,0 +1,146 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/memory/biased_ref_counted.h"
+
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/task_runner.h"
+#include "flutter/fml/thread.h"
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace {
+
+class MyBiasedClass : public BiasedRefCountedThreadSafe<MyBiasedClass> {
+ public:
+  static RefPtr<MyBiasedClass> Create(ManualResetWaitableEvent* destroyed) {
+    return AdoptRef(new MyBiasedClass(destroyed));
+  }
+
+ private:
+  FML_FRIEND_BIASED_REF_COUNTED_THREAD_SAFE(MyBiasedClass);
+
+  explicit MyBiasedClass(ManualResetWaitableEvent* destroyed)
+      : destroyed_(destroyed) {}
+
+  ~MyBiasedClass() { destroyed_->Signal(); }
+
+  ManualResetWaitableEvent* destroyed_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(MyBiasedClass);
+};
+
+TEST(BiasedRefCountedTest, WithoutMessageLoop) {
+  // Other tests may have initialized a message loop on the main thread.
+  std::thread([]() {
+    ManualResetWaitableEvent destroyed;
+    RefPtr<MyBiasedClass> r1 = MyBiasedClass::Create(&destroyed);
+    EXPECT_TRUE(r1->HasOneRef());
+    RefPtr<MyBiasedClass> r2 = r1;
+    EXPECT_FALSE(r1->HasOneRef());
+
+    std::thread([r2 = std::move(r2)]() mutable {
+      EXPECT_FALSE(r2->HasOneRef());
+      r2 = nullptr;
+    }).join();
+    EXPECT_TRUE(r1->HasOneRef());
+    EXPECT_FALSE(destroyed.IsSignaledForTest());
+
+    r1 = nullptr;
+    EXPECT_TRUE(destroyed.IsSignaledForTest());
+  }).join();
+}
+
+TEST(BiasedRefCountedTest, OwnerThreadDropsLastReference) {
+  Thread owner("owner");
+  ManualResetWaitableEvent destroyed;
+  AutoResetWaitableEvent done;
+  owner.GetTaskRunner()->PostTask([&]() {
+    RefPtr<MyBiasedClass> r1 = MyBiasedClass::Create(&destroyed);
+    {
+      RefPtr<MyBiasedClass> r2 = r1;
+      EXPECT_FALSE(r1->HasOneRef());
+    }
+    EXPECT_TRUE(r1->HasOneRef());
+
+    // A reference taken on another thread is counted atomically.
+    RefPtr<MyBiasedClass> r3;
+    std::thread([&]() { r3 = r1; }).join();
+    EXPECT_FALSE(r1->HasOneRef());
+    r3 = nullptr;
+    EXPECT_TRUE(r1->HasOneRef());
+
+    r1 = nullptr;
+    EXPECT_TRUE(destroyed.IsSignaledForTest());
+    done.Signal();
+  });
+  done.Wait();
+}
+
+TEST(BiasedRefCountedTest, ReleaseOnOtherThreadMergesCounts) {
+  Thread owner("owner");
+  ManualResetWaitableEvent destroyed;
+  std::vector<RefPtr<MyBiasedClass>> refs;
+  AutoResetWaitableEvent created;
+  owner.GetTaskRunner()->PostTask([&]() {
+    RefPtr<MyBiasedClass> r = MyBiasedClass::Create(&destroyed);
+    for (size_t i = 0; i < 3; i++) {
+      refs.push_back(r);
+    }
+    created.Signal();
+  });
+  created.Wait();
+
+  // These references were counted by the owner thread, so the last one is
+  // only freed once the owner thread has merged the counts.
+  refs.clear();
+  destroyed.Wait();
+}
+
+TEST(BiasedRefCountedTest, ConcurrentReleases) {
+  Thread owner("owner");
+  ManualResetWaitableEvent destroyed;
+  std::vector<RefPtr<MyBiasedClass>> refs;
+  AutoResetWaitableEvent created;
+  owner.GetTaskRunner()->PostTask([&]() {
+    RefPtr<MyBiasedClass> r = MyBiasedClass::Create(&destroyed);
+    for (size_t i = 0; i < 64; i++) {
+      refs.push_back(r);
+    }
+    // Keep churning references on the owner thread while other threads
+    // release theirs.
+    owner.GetTaskRunner()->PostTask([r]() {
+      for (size_t i = 0; i < 1000; i++) {
+        RefPtr<MyBiasedClass> copy = r;
+      }
+    });
+    created.Signal();
+  });
+  created.Wait();
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < 4; i++) {
+    std::vector<RefPtr<MyBiasedClass>> thread_refs(
+        refs.begin() + i * 16, refs.begin() + (i + 1) * 16);
+    threads.emplace_back([thread_refs = std::move(thread_refs)]() mutable {
+      for (auto& ref : thread_refs) {
+        RefPtr<MyBiasedClass> copy = ref;
+        ref = nullptr;
+      }
+    });
+  }
+  refs.clear();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  destroyed.Wait();
+}
+
+}  // namespace
+}  // namespace fml
@@ -57,8 +57,10 @@ namespace fml {
 //     ...
 //   };
 //
-// For now, we only have thread-safe reference counting, since that's all we
-// need. It's easy enough to add thread-unsafe versions if necessary.
+// Objects that never leave the thread they are created on may use
+// |RefCounted| instead, which avoids atomic operations, and objects that are
+// mostly referenced on the thread they are created on may use
+// |BiasedRefCountedThreadSafe| (see biased_ref_counted.h).
 template <typename T>
 class RefCountedThreadSafe : public internal::RefCountedThreadSafeBase {
  public:
@@ -121,11 +123,58 @@ class RefCountedThreadSafe : public internal::RefCountedThreadSafeBase {
   FML_DISALLOW_COPY_AND_ASSIGN(RefCountedThreadSafe);
 };
 
+// A base class for reference-counted classes whose references are only ever
+// taken and released on the thread that created them. This makes the
+// reference count a plain integer. Use as |RefCountedThreadSafe| (see above);
+// references taken or released on another thread are caught by assertions in
+// Debug builds (when |NDEBUG| is not defined).
+template <typename T>
+class RefCounted : public internal::RefCountedBase {
+ public:
+  // Adds a reference to this object.
+  // Inherited from the internal superclass:
+  //   void AddRef() const;
+
+  // Releases a reference to this object. This will destroy this object once the
+  // last reference is released.
+  void Release() const {
+    if (internal::RefCountedBase::Release()) {
+      delete static_cast<const T*>(this);
+    }
+  }
+
+  // Returns true if there is exactly one reference to this object.
+  // Inherited from the internal superclass:
+  //   bool HasOneRef();
+
+  // Asserts that there is exactly one reference to this object; does nothing in
+  // Release builds (when |NDEBUG| is defined).
+  // Inherited from the internal superclass:
+  //   void AssertHasOneRef();
+
+ protected:
+  RefCounted() {}
+
+  ~RefCounted() {}
+
+ private:
+#ifndef NDEBUG
+  template <typename U>
+  friend RefPtr<U> AdoptRef(U*);
+  void Adopt() { internal::RefCountedBase::Adopt(); }
+#endif
+
+  FML_DISALLOW_COPY_AND_ASSIGN(RefCounted);
+};
+
 // If you subclass |RefCountedThreadSafe| and want to keep your destructor
 // private, use this. (See the example above |RefCountedThreadSafe|.)
 #define FML_FRIEND_REF_COUNTED_THREAD_SAFE(T) \
   friend class ::fml::RefCountedThreadSafe<T>
 
+// Like |FML_FRIEND_REF_COUNTED_THREAD_SAFE()|, for subclasses of |RefCounted|.
+#define FML_FRIEND_REF_COUNTED(T) friend class ::fml::RefCounted<T>
+
 // If you want to keep your constructor(s) private and still want to use
 // |MakeRefCounted<T>()|, use this. (See the example above
 // |RefCountedThreadSafe|.)
@@ -8,6 +8,8 @@
 
 #include "flutter/fml/memory/ref_counted.h"
 
+#include <thread>
+
 #include "flutter/fml/macros.h"
 #include "gtest/gtest.h"
 
@@ -639,6 +641,48 @@ TEST(RefCountedTest, DebugChecks) {
 }
 #endif
 
+class MyThreadUnsafeClass : public RefCounted<MyThreadUnsafeClass> {
+ private:
+  FML_FRIEND_REF_COUNTED(MyThreadUnsafeClass);
+  FML_FRIEND_MAKE_REF_COUNTED(MyThreadUnsafeClass);
+
+  explicit MyThreadUnsafeClass(bool* was_destroyed)
+      : was_destroyed_(was_destroyed) {}
+
+  ~MyThreadUnsafeClass() { *was_destroyed_ = true; }
+
+  bool* was_destroyed_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(MyThreadUnsafeClass);
+};
+
+TEST(RefCountedTest, ThreadUnsafe) {
+  bool was_destroyed = false;
+  {
+    RefPtr<MyThreadUnsafeClass> r1 =
+        MakeRefCounted<MyThreadUnsafeClass>(&was_destroyed);
+    EXPECT_TRUE(r1->HasOneRef());
+    {
+      RefPtr<MyThreadUnsafeClass> r2 = r1;
+      EXPECT_FALSE(r1->HasOneRef());
+    }
+    EXPECT_TRUE(r1->HasOneRef());
+    EXPECT_FALSE(was_destroyed);
+  }
+  EXPECT_TRUE(was_destroyed);
+}
+
+#ifndef NDEBUG
+TEST(RefCountedTest, ThreadUnsafeDebugChecks) {
+  bool was_destroyed = false;
+  RefPtr<MyThreadUnsafeClass> r =
+      MakeRefCounted<MyThreadUnsafeClass>(&was_destroyed);
+  EXPECT_DEATH_IF_SUPPORTED(
+      std::thread([&r]() { RefPtr<MyThreadUnsafeClass> copy = r; }).join(),
+      "IsCreationThreadCurrent");
+}
+#endif
+
 // TODO(vtl): Add (threaded) stress tests.
 
 }  // namespace
@@ -0,0 +1,23 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/memory_residency.h"
+
+namespace fml {
+
+size_t MemoryRegion::GetPageCount() const {
+  const size_t page_size = GetMemoryPageSize();
+  return (size + page_size - 1) / page_size;
+}
+
+MemoryRegion GetPageAlignedRegion(const void* address, size_t size) {
+  const uintptr_t page_size = GetMemoryPageSize();
+  const uintptr_t begin = reinterpret_cast<uintptr_t>(address);
+  const uintptr_t start = begin & ~(page_size - 1);
+  const uintptr_t end = (begin + size + page_size - 1) & ~(page_size - 1);
+  return {.start = reinterpret_cast<const uint8_t*>(start),
+          .size = static_cast<size_t>(end - start)};
+}
+
+}  // namespace fml
@@ -0,0 +1,60 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_MEMORY_RESIDENCY_H_
+#define FLUTTER_FML_MEMORY_RESIDENCY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace fml {
+
+/// A range of the address space of the process that starts at a page
+/// boundary.
+struct MemoryRegion {
+  const uint8_t* start = nullptr;
+  size_t size = 0;
+
+  /// @brief The number of pages of the region, including the partial page at
+  ///        its end.
+  size_t GetPageCount() const;
+
+  bool operator==(const MemoryRegion& other) const = default;
+};
+
+/// @brief The size of the pages of virtual memory.
+size_t GetMemoryPageSize();
+
+/// @brief The region of pages that covers `size` bytes at `address`.
+MemoryRegion GetPageAlignedRegion(const void* address, size_t size);
+
+/// @brief The region of the address space that `address` was mapped in as a
+///        whole, such as the segment of the library that a symbol belongs
+///        to.
+///
+///        This is how the size of a mapping that doesn't know its own size,
+///        like a symbol in a library, is found. If the mappings of the
+///        process can't be queried on the platform, or the address isn't
+///        mapped, this returns std::nullopt.
+std::optional<MemoryRegion> GetMappedRegionContaining(const void* address);
+
+/// @brief Whether each page of the region is resident in memory, so that
+///        accessing it does not fault it in.
+///
+///        If the residency of the pages can't be queried on the platform,
+///        this returns std::nullopt.
+std::optional<std::vector<bool>> GetResidentPages(const MemoryRegion& region);
+
+/// @brief Hint to the operating system that the pages of the region will be
+///        accessed soon, so that it starts reading them in the background.
+///
+///        The pages must be mapped. This does not wait for the pages to be
+///        read in, and returns false if the hint could not be given.
+bool PrefetchMemory(const MemoryRegion& region);
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_MEMORY_RESIDENCY_H_
@@ -0,0 +1,80 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/memory_residency.h"
+
+#include <vector>
+
+#include "flutter/fml/build_config.h"
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace testing {
+
+namespace {
+
+const uint8_t kMappedConstant[] = {1, 2, 3, 4};
+
+}  // namespace
+
+TEST(MemoryResidencyTest, PageAlignedRegionCoversTheBytes) {
+  const size_t page_size = GetMemoryPageSize();
+  ASSERT_GT(page_size, 0u);
+  EXPECT_EQ(page_size & (page_size - 1), 0u);
+
+  const uint8_t* base = reinterpret_cast<const uint8_t*>(page_size * 16);
+  EXPECT_EQ(GetPageAlignedRegion(base, page_size),
+            (MemoryRegion{.start = base, .size = page_size}));
+  EXPECT_EQ(GetPageAlignedRegion(base + 1, page_size),
+            (MemoryRegion{.start = base, .size = page_size * 2}));
+  EXPECT_EQ(GetPageAlignedRegion(base + page_size - 1, 1),
+            (MemoryRegion{.start = base, .size = page_size}));
+  EXPECT_EQ(GetPageAlignedRegion(base, 0).GetPageCount(), 0u);
+}
+
+TEST(MemoryResidencyTest, TouchedPagesAreResident) {
+  const size_t page_size = GetMemoryPageSize();
+  std::vector<uint8_t> buffer(page_size * 4, 1);
+  MemoryRegion region = GetPageAlignedRegion(buffer.data(), buffer.size());
+  ASSERT_GE(region.GetPageCount(), 4u);
+
+  std::optional<std::vector<bool>> resident = GetResidentPages(region);
+#if FML_OS_WIN || FML_OS_FUCHSIA
+  EXPECT_FALSE(resident.has_value());
+#else
+  ASSERT_TRUE(resident.has_value());
+  ASSERT_EQ(resident->size(), region.GetPageCount());
+  for (bool page : resident.value()) {
+    EXPECT_TRUE(page);
+  }
+#endif
+}
+
+TEST(MemoryResidencyTest, CanPrefetchMappedPages) {
+  MemoryRegion region =
+      GetPageAlignedRegion(kMappedConstant, sizeof(kMappedConstant));
+#if FML_OS_FUCHSIA
+  EXPECT_FALSE(PrefetchMemory(region));
+#else
+  EXPECT_TRUE(PrefetchMemory(region));
+#endif
+  EXPECT_TRUE(PrefetchMemory(MemoryRegion{}));
+}
+
+TEST(MemoryResidencyTest, FindsTheMappedRegionOfAnAddress) {
+  std::optional<MemoryRegion> region =
+      GetMappedRegionContaining(kMappedConstant);
+#if FML_OS_LINUX || FML_OS_ANDROID || FML_OS_WIN
+  ASSERT_TRUE(region.has_value());
+  EXPECT_LE(region->start, kMappedConstant);
+  EXPECT_GE(region->start + region->size,
+            kMappedConstant + sizeof(kMappedConstant));
+  EXPECT_EQ(GetPageAlignedRegion(region->start, region->size), region.value());
+#else
+  EXPECT_FALSE(region.has_value());
+#endif
+}
+
+}  // namespace testing
+}  // namespace fml
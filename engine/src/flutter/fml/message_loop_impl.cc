@@ -54,14 +54,25 @@ MessageLoopImpl::~MessageLoopImpl() {
 }
 
 void MessageLoopImpl::PostTask(const fml::closure& task,
-                               fml::TimePoint target_time) {
+                               fml::TimePoint target_time,
+                               fml::TaskSourceGrade task_source_grade,
+                               fml::TimePoint deadline) {
   FML_DCHECK(task != nullptr);
   if (terminated_) {
     // If the message loop has already been terminated, PostTask should destruct
     // |task| synchronously within this function.
     return;
   }
-  task_queue_->RegisterTask(queue_id_, task, target_time);
+  task_queue_->RegisterTask(queue_id_, task, target_time, task_source_grade,
+                            deadline);
+}
+
+void MessageLoopImpl::PostTasks(const std::vector<fml::closure>& tasks,
+                                fml::TimePoint target_time) {
+  if (terminated_) {
+    return;
+  }
+  task_queue_->RegisterTasks(queue_id_, tasks, target_time);
 }
 
 void MessageLoopImpl::AddTaskObserver(intptr_t key,
@@ -123,9 +134,8 @@ void MessageLoopImpl::FlushTasks(FlushType type) {
     if (!invocation) {
       break;
     }
-    invocation();
     std::vector<fml::closure> observers =
-        task_queue_->GetObserversToNotify(queue_id_);
+        task_queue_->RunTask(queue_id_, invocation);
     for (const auto& observer : observers) {
       observer();
     }
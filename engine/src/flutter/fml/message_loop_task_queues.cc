@@ -10,6 +10,8 @@
 #include <iostream>
 #include <memory>
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/task_source.h"
@@ -30,13 +32,24 @@ class TaskSourceGradeHolder {
   explicit TaskSourceGradeHolder(TaskSourceGrade task_source_grade_arg)
       : task_source_grade(task_source_grade_arg) {}
 };
+
+// The tasks posted to the queue whose task is running on this thread, see
+// |MessageLoopTaskQueues::RunTask|.
+struct StagedTasks {
+  TaskQueueId running_queue = TaskQueueId::Invalid();
+  std::vector<std::pair<TaskQueueId, DelayedTask>> tasks;
+};
 }  // namespace
 
 static thread_local std::unique_ptr<TaskSourceGradeHolder>
     tls_task_source_grade;
 
+static thread_local StagedTasks tls_staged_tasks;
+
 TaskQueueEntry::TaskQueueEntry(TaskQueueId created_for_arg)
-    : subsumed_by(kUnmerged), created_for(created_for_arg) {
+    : subsumed_by(kUnmerged),
+      created_for(created_for_arg),
+      wake_time(fml::TimePoint::Max()) {
   wakeable = NULL;
   task_observers = TaskObservers();
   task_source = std::make_unique<TaskSource>(created_for);
@@ -64,6 +77,7 @@ MessageLoopTaskQueues::~MessageLoopTaskQueues() = default;
 
 void MessageLoopTaskQueues::Dispose(TaskQueueId queue_id) {
   std::lock_guard guard(queue_mutex_);
+  RegisterStagedTasksUnlocked();
   const auto& queue_entry = queue_entries_.at(queue_id);
   FML_DCHECK(queue_entry->subsumed_by == kUnmerged);
   auto& subsumed_set = queue_entry->owner_of;
@@ -76,6 +90,7 @@ void MessageLoopTaskQueues::Dispose(TaskQueueId queue_id) {
 
 void MessageLoopTaskQueues::DisposeTasks(TaskQueueId queue_id) {
   std::lock_guard guard(queue_mutex_);
+  RegisterStagedTasksUnlocked();
   const auto& queue_entry = queue_entries_.at(queue_id);
   FML_DCHECK(queue_entry->subsumed_by == kUnmerged);
   auto& subsumed_set = queue_entry->owner_of;
@@ -93,12 +108,57 @@ void MessageLoopTaskQueues::RegisterTask(
     TaskQueueId queue_id,
     const fml::closure& task,
     fml::TimePoint target_time,
-    fml::TaskSourceGrade task_source_grade) {
+    fml::TaskSourceGrade task_source_grade,
+    fml::TimePoint deadline) {
+  // Posting to the queue whose task is running on this thread is the most
+  // common case. The task is registered once the running task returns, which
+  // also takes the lock only once for all the tasks the running task posts.
+  if (queue_id == tls_staged_tasks.running_queue) {
+    tls_staged_tasks.tasks.emplace_back(
+        queue_id, DelayedTask(order_++, task, target_time, task_source_grade,
+                              deadline));
+    return;
+  }
+
   std::lock_guard guard(queue_mutex_);
   size_t order = order_++;
   const auto& queue_entry = queue_entries_.at(queue_id);
   queue_entry->task_source->RegisterTask(
-      {order, task, target_time, task_source_grade});
+      {order, task, target_time, task_source_grade, deadline});
+  TaskQueueId loop_to_wake = queue_id;
+  if (queue_entry->subsumed_by != kUnmerged) {
+    loop_to_wake = queue_entry->subsumed_by;
+  }
+
+  // This can happen when the secondary tasks are paused.
+  if (HasPendingTasksUnlocked(loop_to_wake)) {
+    WakeUpIfNeededUnlocked(loop_to_wake, GetNextWakeTimeUnlocked(loop_to_wake));
+  }
+}
+
+void MessageLoopTaskQueues::RegisterTasks(
+    TaskQueueId queue_id,
+    const std::vector<fml::closure>& tasks,
+    fml::TimePoint target_time) {
+  if (tasks.empty()) {
+    return;
+  }
+  if (queue_id == tls_staged_tasks.running_queue) {
+    for (const fml::closure& task : tasks) {
+      tls_staged_tasks.tasks.emplace_back(
+          queue_id, DelayedTask(order_++, task, target_time,
+                                fml::TaskSourceGrade::kUnspecified));
+    }
+    return;
+  }
+
+  std::lock_guard guard(queue_mutex_);
+  const auto& queue_entry = queue_entries_.at(queue_id);
+  for (const fml::closure& task : tasks) {
+    size_t order = order_++;
+    queue_entry->task_source->RegisterTask(
+        {order, task, target_time, fml::TaskSourceGrade::kUnspecified});
+  }
   TaskQueueId loop_to_wake = queue_id;
   if (queue_entry->subsumed_by != kUnmerged) {
     loop_to_wake = queue_entry->subsumed_by;
@@ -106,7 +166,7 @@ void MessageLoopTaskQueues::RegisterTask(
 
   // This can happen when the secondary tasks are paused.
   if (HasPendingTasksUnlocked(loop_to_wake)) {
-    WakeUpUnlocked(loop_to_wake, GetNextWakeTimeUnlocked(loop_to_wake));
+    WakeUpIfNeededUnlocked(loop_to_wake, GetNextWakeTimeUnlocked(loop_to_wake));
   }
 }
 
@@ -118,10 +178,13 @@ bool MessageLoopTaskQueues::HasPendingTasks(TaskQueueId queue_id) const {
 fml::closure MessageLoopTaskQueues::GetNextTaskToRun(TaskQueueId queue_id,
                                                      fml::TimePoint from_time) {
   std::lock_guard guard(queue_mutex_);
+  // Tasks may be run from the task that staged them, for example by
+  // |MessageLoop::RunExpiredTasksNow|.
+  RegisterStagedTasksUnlocked();
   if (!HasPendingTasksUnlocked(queue_id)) {
     return nullptr;
   }
-  TaskSource::TopTask top = PeekNextTaskUnlocked(queue_id);
+  TaskSource::TopTask top = PeekNextTaskUnlocked(queue_id, from_time);
 
   if (!HasPendingTasksUnlocked(queue_id)) {
     WakeUpUnlocked(queue_id, fml::TimePoint::Max());
@@ -139,11 +202,67 @@ fml::closure MessageLoopTaskQueues::GetNextTaskToRun(TaskQueueId queue_id,
   return invocation;
 }
 
+std::vector<fml::closure> MessageLoopTaskQueues::RunTask(
+    TaskQueueId queue_id,
+    const fml::closure& invocation) {
+  // Tasks may run nested, for example by |MessageLoop::RunExpiredTasksNow|.
+  TaskQueueId previous_running_queue = tls_staged_tasks.running_queue;
+  tls_staged_tasks.running_queue = queue_id;
+  invocation();
+  tls_staged_tasks.running_queue = previous_running_queue;
+
+  std::lock_guard guard(queue_mutex_);
+  RegisterStagedTasksUnlocked();
+  return GetObserversToNotifyUnlocked(queue_id);
+}
+
+void MessageLoopTaskQueues::RegisterStagedTasksUnlocked() {
+  if (tls_staged_tasks.tasks.empty()) {
+    return;
+  }
+  std::vector<std::pair<TaskQueueId, DelayedTask>> staged_tasks;
+  std::swap(staged_tasks, tls_staged_tasks.tasks);
+
+  std::set<TaskQueueId> loops_to_wake;
+  for (const auto& [queue_id, task] : staged_tasks) {
+    auto found = queue_entries_.find(queue_id);
+    if (found == queue_entries_.end()) {
+      // The queue was disposed by the task that staged this one.
+      continue;
+    }
+    const auto& queue_entry = found->second;
+    queue_entry->task_source->RegisterTask(task);
+    loops_to_wake.insert(queue_entry->subsumed_by != kUnmerged
+                             ? queue_entry->subsumed_by
+                             : queue_id);
+  }
+
+  // This can happen when the secondary tasks are paused.
+  for (TaskQueueId loop_to_wake : loops_to_wake) {
+    if (HasPendingTasksUnlocked(loop_to_wake)) {
+      WakeUpIfNeededUnlocked(loop_to_wake,
+                             GetNextWakeTimeUnlocked(loop_to_wake));
+    }
+  }
+}
+
 void MessageLoopTaskQueues::WakeUpUnlocked(TaskQueueId queue_id,
                                            fml::TimePoint time) const {
-  if (queue_entries_.at(queue_id)->wakeable) {
-    queue_entries_.at(queue_id)->wakeable->WakeUp(time);
+  const auto& entry = queue_entries_.at(queue_id);
+  if (entry->wakeable) {
+    entry->wake_time = time;
+    entry->wakeable->WakeUp(time);
+  }
+}
+
+void MessageLoopTaskQueues::WakeUpIfNeededUnlocked(TaskQueueId queue_id,
+                                                   fml::TimePoint time) const {
+  const auto& entry = queue_entries_.at(queue_id);
+  if (entry->wake_up_slack.has_value() &&
+      entry->wake_time - time <= entry->wake_up_slack.value()) {
+    return;
   }
+  WakeUpUnlocked(queue_id, time);
 }
 
 size_t MessageLoopTaskQueues::GetNumPendingTasks(TaskQueueId queue_id) const {
@@ -181,6 +300,11 @@ void MessageLoopTaskQueues::RemoveTaskObserver(TaskQueueId queue_id,
 std::vector<fml::closure> MessageLoopTaskQueues::GetObserversToNotify(
     TaskQueueId queue_id) const {
   std::lock_guard guard(queue_mutex_);
+  return GetObserversToNotifyUnlocked(queue_id);
+}
+
+std::vector<fml::closure> MessageLoopTaskQueues::GetObserversToNotifyUnlocked(
+    TaskQueueId queue_id) const {
   std::vector<fml::closure> observers;
 
   if (queue_entries_.at(queue_id)->subsumed_by != kUnmerged) {
@@ -209,11 +333,19 @@ void MessageLoopTaskQueues::SetWakeable(TaskQueueId queue_id,
   queue_entries_.at(queue_id)->wakeable = wakeable;
 }
 
+void MessageLoopTaskQueues::SetWakeUpSlack(
+    TaskQueueId queue_id,
+    std::optional<fml::TimeDelta> slack) {
+  std::lock_guard guard(queue_mutex_);
+  queue_entries_.at(queue_id)->wake_up_slack = slack;
+}
+
 bool MessageLoopTaskQueues::Merge(TaskQueueId owner, TaskQueueId subsumed) {
   if (owner == subsumed) {
     return true;
   }
   std::lock_guard guard(queue_mutex_);
+  RegisterStagedTasksUnlocked();
   auto& owner_entry = queue_entries_.at(owner);
   auto& subsumed_entry = queue_entries_.at(subsumed);
   auto& subsumed_set = owner_entry->owner_of;
@@ -262,6 +394,7 @@ bool MessageLoopTaskQueues::Merge(TaskQueueId owner, TaskQueueId subsumed) {
 
 bool MessageLoopTaskQueues::Unmerge(TaskQueueId owner, TaskQueueId subsumed) {
   std::lock_guard guard(queue_mutex_);
+  RegisterStagedTasksUnlocked();
   const auto& owner_entry = queue_entries_.at(owner);
   if (owner_entry->owner_of.empty()) {
     FML_LOG(WARNING)
@@ -360,22 +493,38 @@ fml::TimePoint MessageLoopTaskQueues::GetNextWakeTimeUnlocked(
 }
 
 TaskSource::TopTask MessageLoopTaskQueues::PeekNextTaskUnlocked(
-    TaskQueueId owner) const {
+    TaskQueueId owner,
+    fml::TimePoint now) const {
   FML_DCHECK(HasPendingTasksUnlocked(owner));
   const auto& entry = queue_entries_.at(owner);
   if (entry->owner_of.empty()) {
     FML_CHECK(!entry->task_source->IsEmpty());
-    return entry->task_source->Top();
+    return entry->task_source->Top(now);
   }
 
   // Use optional for the memory of TopTask object.
   std::optional<TaskSource::TopTask> top_task;
 
+  // Like within a task source, a due user-interaction task runs first.
+  auto is_due_user_interaction = [now](const DelayedTask& task) {
+    return task.GetTaskSourceGrade() == TaskSourceGrade::kUserInteraction &&
+           task.GetTargetTime() <= now;
+  };
   std::function<void(const TaskSource*)> top_task_updater =
-      [&top_task](const TaskSource* source) {
+      [&top_task, &is_due_user_interaction, now](const TaskSource* source) {
         if (source && !source->IsEmpty()) {
-          TaskSource::TopTask other_task = source->Top();
-          if (!top_task.has_value() || top_task->task > other_task.task) {
+          TaskSource::TopTask other_task = source->Top(now);
+          if (!top_task.has_value()) {
+            top_task.emplace(other_task);
+            return;
+          }
+          bool top_is_due = is_due_user_interaction(top_task->task);
+          bool other_is_due = is_due_user_interaction(other_task.task);
+          if (top_is_due != other_is_due) {
+            if (other_is_due) {
+              top_task.emplace(other_task);
+            }
+          } else if (top_task->task > other_task.task) {
             top_task.emplace(other_task);
           }
         }
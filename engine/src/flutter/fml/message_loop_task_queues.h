@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <set>
 #include <vector>
 
@@ -45,6 +46,13 @@ class TaskQueueEntry {
 
   TaskQueueId created_for;
 
+  /// The time the wakeable was last asked to wake up at, or
+  /// |fml::TimePoint::Max| if it was not.
+  fml::TimePoint wake_time;
+
+  /// See |MessageLoopTaskQueues::SetWakeUpSlack|.
+  std::optional<fml::TimeDelta> wake_up_slack;
+
   explicit TaskQueueEntry(TaskQueueId created_for);
 
  private:
@@ -80,12 +88,29 @@ class MessageLoopTaskQueues {
                     const fml::closure& task,
                     fml::TimePoint target_time,
                     fml::TaskSourceGrade task_source_grade =
-                        fml::TaskSourceGrade::kUnspecified);
+                        fml::TaskSourceGrade::kUnspecified,
+                    fml::TimePoint deadline = fml::TimePoint::Max());
+
+  /// Registers \p tasks to run in order at \p target_time, taking the lock
+  /// shared by all queues and waking up the loop only once.
+  void RegisterTasks(TaskQueueId queue_id,
+                     const std::vector<fml::closure>& tasks,
+                     fml::TimePoint target_time);
 
   bool HasPendingTasks(TaskQueueId queue_id) const;
 
   fml::closure GetNextTaskToRun(TaskQueueId queue_id, fml::TimePoint from_time);
 
+  /// Runs \p invocation, a task returned by \p GetNextTaskToRun for
+  /// \p queue_id, and returns the observers to notify once it ran.
+  ///
+  /// The tasks that \p invocation posts to \p queue_id from this thread are
+  /// staged without taking the lock shared by all queues, and registered
+  /// together once it returns. Until then, they are not counted by
+  /// \p HasPendingTasks and \p GetNumPendingTasks on other threads.
+  std::vector<fml::closure> RunTask(TaskQueueId queue_id,
+                                    const fml::closure& invocation);
+
   size_t GetNumPendingTasks(TaskQueueId queue_id) const;
 
   static TaskSourceGrade GetCurrentTaskSourceGrade();
@@ -104,6 +129,17 @@ class MessageLoopTaskQueues {
 
   void SetWakeable(TaskQueueId queue_id, fml::Wakeable* wakeable);
 
+  /// Lets the tasks registered to \p queue_id run up to \p slack later than
+  /// their target time when the loop is already due to wake up by then,
+  /// instead of waking it up again. With a zero \p slack, only the wake ups
+  /// that would not make any task run sooner are skipped. With no \p slack,
+  /// the default, every registered task wakes up the loop.
+  ///
+  /// This saves the system calls that rearm the timer of the loop, which
+  /// adds up on loops that many threads post to.
+  void SetWakeUpSlack(TaskQueueId queue_id,
+                      std::optional<fml::TimeDelta> slack);
+
   // Invariants for merge and un-merge
   //  1. RegisterTask will always submit to the queue_id that is passed
   //     to it. It is not aware of whether a queue is merged or not. Same with
@@ -145,9 +181,25 @@ class MessageLoopTaskQueues {
 
   void WakeUpUnlocked(TaskQueueId queue_id, fml::TimePoint time) const;
 
+  // Like |WakeUpUnlocked|, unless the loop is already due to wake up by
+  // |time|, give or take its wake up slack. Only used when registering tasks:
+  // the loop rearms its wake up every time it looks for the next task to
+  // run, so a wake up that has already fired is never skipped.
+  void WakeUpIfNeededUnlocked(TaskQueueId queue_id, fml::TimePoint time) const;
+
+  // Registers the tasks staged by the task running on this thread.
+  void RegisterStagedTasksUnlocked();
+
+  std::vector<fml::closure> GetObserversToNotifyUnlocked(
+      TaskQueueId queue_id) const;
+
   bool HasPendingTasksUnlocked(TaskQueueId queue_id) const;
 
-  TaskSource::TopTask PeekNextTaskUnlocked(TaskQueueId owner) const;
+  // Returns the task to run at |now|. Called with the default |now|, it returns
+  // the earliest task, by which the loop must wake.
+  TaskSource::TopTask PeekNextTaskUnlocked(
+      TaskQueueId owner,
+      fml::TimePoint now = fml::TimePoint::Min()) const;
 
   fml::TimePoint GetNextWakeTimeUnlocked(TaskQueueId queue_id) const;
 
@@ -4,6 +4,7 @@
 
 #include "flutter/fml/message_loop_task_queues.h"
 
+#include <atomic>
 #include <cassert>
 #include <string>
 #include <thread>
@@ -64,7 +65,61 @@ static void BM_RegisterAndGetTasks(benchmark::State& state) {  // NOLINT
   }
 }
 
+// A task that posts more tasks to its own queue, like engine work split into
+// smaller steps, while other threads post to other queues.
+static void BM_PostFromRunningTask(benchmark::State& state) {  // NOLINT
+  auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
+  const int num_tasks_per_run = 100;
+  const TaskQueueId queue_id = task_queue->CreateTaskQueue();
+  const int num_other_threads = state.range(0);
+  std::vector<TaskQueueId> other_queue_ids;
+  for (int i = 0; i < num_other_threads; i++) {
+    other_queue_ids.push_back(task_queue->CreateTaskQueue());
+  }
+
+  std::atomic_bool done = false;
+  std::vector<std::thread> other_threads;
+  for (TaskQueueId other_queue_id : other_queue_ids) {
+    other_threads.emplace_back([&task_queue, other_queue_id, &done]() {
+      while (!done) {
+        task_queue->RegisterTask(other_queue_id, [] {}, fml::TimePoint::Now());
+        task_queue->GetNextTaskToRun(other_queue_id, fml::TimePoint::Now());
+      }
+    });
+  }
+
+  const fml::TimePoint past = fml::TimePoint::Now();
+  while (state.KeepRunning()) {
+    task_queue->RegisterTask(
+        queue_id,
+        [&task_queue, queue_id, past]() {
+          for (int i = 0; i < num_tasks_per_run; i++) {
+            task_queue->RegisterTask(queue_id, [] {}, past);
+          }
+        },
+        past);
+    for (;;) {
+      fml::closure invocation =
+          task_queue->GetNextTaskToRun(queue_id, fml::TimePoint::Now());
+      if (!invocation) {
+        break;
+      }
+      task_queue->RunTask(queue_id, invocation);
+    }
+  }
+
+  done = true;
+  for (auto& thread : other_threads) {
+    thread.join();
+  }
+  task_queue->Dispose(queue_id);
+  for (TaskQueueId other_queue_id : other_queue_ids) {
+    task_queue->Dispose(other_queue_id);
+  }
+}
+
 BENCHMARK(BM_RegisterAndGetTasks);
+BENCHMARK(BM_PostFromRunningTask)->Arg(0)->Arg(1)->Arg(4);
 
 }  // namespace benchmarking
 }  // namespace fml
@@ -295,6 +295,114 @@ TEST(MessageLoopTaskQueue, WokenUpWithNewerTime) {
   latch.Wait();
 }
 
+TEST(MessageLoopTaskQueue, TasksPostedByTheRunningTaskAreRegisteredAtOnce) {
+  auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
+  auto queue_id = task_queue->CreateTaskQueue();
+  auto other_queue_id = task_queue->CreateTaskQueue();
+
+  int num_wakes = 0;
+  auto wakeable = std::make_unique<TestWakeable>(
+      [&num_wakes](fml::TimePoint wake_time) { ++num_wakes; });
+  task_queue->SetWakeable(queue_id, wakeable.get());
+
+  int test_val = 0;
+  task_queue->RegisterTask(
+      queue_id,
+      [&]() {
+        for (int i = 0; i < 3; i++) {
+          task_queue->RegisterTask(
+              queue_id, [&test_val]() { test_val++; }, ChronoTicksSinceEpoch());
+        }
+        task_queue->RegisterTask(other_queue_id, []() {},
+                                 ChronoTicksSinceEpoch());
+        // Only the tasks posted to other queues are registered right away.
+        ASSERT_EQ(task_queue->GetNumPendingTasks(queue_id), 0u);
+        ASSERT_EQ(task_queue->GetNumPendingTasks(other_queue_id), 1u);
+      },
+      ChronoTicksSinceEpoch());
+
+  fml::closure invocation =
+      task_queue->GetNextTaskToRun(queue_id, ChronoTicksSinceEpoch());
+  ASSERT_TRUE(invocation);
+  num_wakes = 0;
+  task_queue->RunTask(queue_id, invocation);
+  ASSERT_EQ(task_queue->GetNumPendingTasks(queue_id), 3u);
+  ASSERT_EQ(num_wakes, 1);
+
+  // Tasks posted outside of a running task are registered right away.
+  task_queue->RegisterTask(queue_id, []() {}, ChronoTicksSinceEpoch());
+  ASSERT_EQ(task_queue->GetNumPendingTasks(queue_id), 4u);
+  ASSERT_EQ(num_wakes, 2);
+
+  const auto now = ChronoTicksSinceEpoch();
+  while (fml::closure task = task_queue->GetNextTaskToRun(queue_id, now)) {
+    task_queue->RunTask(queue_id, task);
+  }
+  ASSERT_EQ(test_val, 3);
+}
+
+TEST(MessageLoopTaskQueue, RegisterTasksWakesUpOnce) {
+  auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
+  auto queue_id = task_queue->CreateTaskQueue();
+
+  int num_wakes = 0;
+  auto wakeable = std::make_unique<TestWakeable>(
+      [&num_wakes](fml::TimePoint wake_time) { ++num_wakes; });
+  task_queue->SetWakeable(queue_id, wakeable.get());
+
+  std::vector<int> order;
+  std::vector<fml::closure> tasks;
+  for (int i = 0; i < 3; i++) {
+    tasks.push_back([&order, i]() { order.push_back(i); });
+  }
+  task_queue->RegisterTasks(queue_id, tasks, ChronoTicksSinceEpoch());
+  ASSERT_EQ(num_wakes, 1);
+  ASSERT_EQ(task_queue->GetNumPendingTasks(queue_id), 3u);
+
+  const auto now = ChronoTicksSinceEpoch();
+  while (fml::closure task = task_queue->GetNextTaskToRun(queue_id, now)) {
+    task_queue->RunTask(queue_id, task);
+  }
+  ASSERT_EQ(order, (std::vector<int>{0, 1, 2}));
+}
+
+TEST(MessageLoopTaskQueue, WakeUpSlackSkipsRedundantWakeUps) {
+  auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
+  auto queue_id = task_queue->CreateTaskQueue();
+
+  std::vector<fml::TimePoint> wakes;
+  auto wakeable = std::make_unique<TestWakeable>(
+      [&wakes](fml::TimePoint wake_time) { wakes.push_back(wake_time); });
+  task_queue->SetWakeable(queue_id, wakeable.get());
+  task_queue->SetWakeUpSlack(queue_id, fml::TimeDelta::FromMilliseconds(2));
+
+  const auto time = ChronoTicksSinceEpoch() + fml::TimeDelta::FromSeconds(10);
+  task_queue->RegisterTask(queue_id, []() {}, time);
+  ASSERT_EQ(wakes.size(), 1u);
+
+  // The loop is already due to wake up by then.
+  task_queue->RegisterTask(queue_id, []() {},
+                           time + fml::TimeDelta::FromMilliseconds(5));
+  // Within the slack.
+  task_queue->RegisterTask(queue_id, []() {},
+                           time - fml::TimeDelta::FromMilliseconds(1));
+  ASSERT_EQ(wakes.size(), 1u);
+
+  // Beyond the slack.
+  task_queue->RegisterTask(queue_id, []() {},
+                           time - fml::TimeDelta::FromMilliseconds(5));
+  ASSERT_EQ(wakes.size(), 2u);
+  ASSERT_EQ(wakes[1], time - fml::TimeDelta::FromMilliseconds(5));
+
+  // Looking for the next task always rearms the wake up.
+  ASSERT_FALSE(task_queue->GetNextTaskToRun(queue_id, ChronoTicksSinceEpoch()));
+  ASSERT_EQ(wakes.size(), 3u);
+
+  task_queue->SetWakeUpSlack(queue_id, std::nullopt);
+  task_queue->RegisterTask(queue_id, []() {}, time);
+  ASSERT_EQ(wakes.size(), 4u);
+}
+
 TEST(MessageLoopTaskQueue, NotifyObserversWhileCreatingQueues) {
   auto task_queues = fml::MessageLoopTaskQueues::GetInstance();
   fml::TaskQueueId queue_id = task_queues->CreateTaskQueue();
@@ -100,6 +100,34 @@ TEST(MessageLoop, NonDelayedTasksAreRunInOrder) {
   ASSERT_TRUE(terminated);
 }
 
+TEST(MessageLoop, BulkPostedTasksAreRunInOrder) {
+  const size_t count = 100;
+  size_t current = 0;
+  fml::AutoResetWaitableEvent done;
+  std::thread thread([&current, &done, count]() {
+    fml::MessageLoop::EnsureInitializedForCurrentThread();
+    auto& loop = fml::MessageLoop::GetCurrent();
+    // Tasks posted from a task on the same loop are interleaved correctly.
+    loop.GetTaskRunner()->PostTask([&current]() { current++; });
+    std::vector<fml::closure> tasks;
+    for (size_t i = 0; i < count; i++) {
+      tasks.push_back([&current, i, count]() {
+        ASSERT_EQ(current, i + 1);
+        current++;
+        if (count == i + 1) {
+          fml::MessageLoop::GetCurrent().Terminate();
+        }
+      });
+    }
+    loop.GetTaskRunner()->PostTasks(tasks);
+    loop.Run();
+    done.Signal();
+  });
+  done.Wait();
+  thread.join();
+  ASSERT_EQ(current, count + 1);
+}
+
 TEST(MessageLoop, DelayedTasksAtSameTimeAreRunInOrder) {
   const size_t count = 100;
   bool started = false;
@@ -212,3 +240,104 @@ TEST(MessageLoop, CanCreateConcurrentMessageLoop) {
   latch.Wait();
   ASSERT_GE(thread_ids.size(), 1u);
 }
+
+TEST(MessageLoop, ConcurrentMessageLoopRunsTasksPostedToAllWorkers) {
+  const size_t kWorkerCount = 4;
+  auto loop = fml::ConcurrentMessageLoop::Create(kWorkerCount);
+  fml::CountDownLatch latch(kWorkerCount);
+  std::mutex thread_ids_mutex;
+  std::set<std::thread::id> thread_ids;
+  loop->PostTaskToAllWorkers([&]() {
+    {
+      std::scoped_lock lock(thread_ids_mutex);
+      thread_ids.insert(std::this_thread::get_id());
+    }
+    latch.CountDown();
+  });
+  latch.Wait();
+  ASSERT_EQ(thread_ids.size(), kWorkerCount);
+}
+
+TEST(MessageLoop, ConcurrentMessageLoopStealsTasksOfBusyWorkers) {
+  auto loop = fml::ConcurrentMessageLoop::Create(2u);
+  auto task_runner = loop->GetTaskRunner();
+  fml::AutoResetWaitableEvent first_task_blocked;
+  fml::AutoResetWaitableEvent second_task_ran;
+  // Whichever worker runs the first task, the other one has to run the
+  // second task for the first one to be unblocked.
+  task_runner->PostTaskWithAffinity(
+      [&]() {
+        second_task_ran.Wait();
+        first_task_blocked.Signal();
+      },
+      0u);
+  task_runner->PostTaskWithAffinity([&]() { second_task_ran.Signal(); }, 0u);
+  first_task_blocked.Wait();
+}
+
+TEST(MessageLoop, ConcurrentMessageLoopParallelForCoversTheRange) {
+  auto loop = fml::ConcurrentMessageLoop::Create(4u);
+  auto task_runner = loop->GetTaskRunner();
+  const size_t kCount = 1000;
+  std::vector<int> visits(kCount, 0);
+  task_runner->ParallelFor(kCount, 7u, [&](size_t begin, size_t end) {
+    ASSERT_LT(begin, end);
+    ASSERT_LE(end - begin, 7u);
+    for (size_t i = begin; i < end; ++i) {
+      visits[i]++;
+    }
+  });
+  for (size_t i = 0; i < kCount; ++i) {
+    ASSERT_EQ(visits[i], 1) << "at index " << i;
+  }
+}
+
+TEST(MessageLoop, ConcurrentMessageLoopRunsTasksOnTheExecutor) {
+  // Stands in for the job system of an embedder.
+  auto pool = fml::ConcurrentMessageLoop::Create(2u);
+  auto pool_runner = pool->GetTaskRunner();
+  std::atomic_size_t executed_count = 0;
+  auto loop = fml::ConcurrentMessageLoop::CreateWithExecutor(
+      2u, [&](const fml::closure& task) {
+        executed_count++;
+        pool_runner->PostTask(task);
+      });
+  auto task_runner = loop->GetTaskRunner();
+
+  const size_t kTaskCount = 10;
+  fml::CountDownLatch latch(kTaskCount);
+  for (size_t i = 0; i < kTaskCount; ++i) {
+    task_runner->PostTask([&]() {
+      ASSERT_TRUE(loop->RunsTasksOnCurrentThread());
+      latch.CountDown();
+    });
+  }
+  latch.Wait();
+  ASSERT_EQ(executed_count, kTaskCount);
+  ASSERT_FALSE(loop->RunsTasksOnCurrentThread());
+
+  size_t visits = 0;
+  std::mutex visits_mutex;
+  task_runner->ParallelFor(100u, 3u, [&](size_t begin, size_t end) {
+    std::scoped_lock lock(visits_mutex);
+    visits += end - begin;
+  });
+  ASSERT_EQ(visits, 100u);
+}
+
+TEST(MessageLoop, ConcurrentMessageLoopParallelForOnAWorkerDoesNotDeadlock) {
+  auto loop = fml::ConcurrentMessageLoop::Create(1u);
+  auto task_runner = loop->GetTaskRunner();
+  fml::AutoResetWaitableEvent latch;
+  size_t visits = 0;
+  task_runner->PostTask([&]() {
+    // The only worker is running this task, so the calling thread has to
+    // run all chunks itself.
+    task_runner->ParallelFor(100u, 1u, [&](size_t begin, size_t end) {
+      visits += end - begin;
+    });
+    latch.Signal();
+  });
+  latch.Wait();
+  ASSERT_EQ(visits, 100u);
+}
@@ -0,0 +1,135 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/paged_mapping.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+
+namespace fml {
+
+PagedMapping::PagedMapping(size_t size,
+                           size_t page_size,
+                           PageDecoder decoder,
+                           size_t max_cached_pages)
+    : size_(size),
+      page_size_(page_size),
+      decoder_(std::move(decoder)),
+      max_cached_pages_(std::max<size_t>(max_cached_pages, 1u)) {
+  FML_DCHECK(page_size_ > 0);
+  FML_DCHECK(decoder_);
+}
+
+PagedMapping::~PagedMapping() = default;
+
+size_t PagedMapping::GetSize() const {
+  return size_;
+}
+
+const uint8_t* PagedMapping::GetMapping() const {
+  std::scoped_lock lock(mutex_);
+  if (contents_ || contents_failed_ || size_ == 0) {
+    return contents_.get();
+  }
+
+  TRACE_EVENT1("flutter", "PagedMapping::GetMapping", "size",
+               std::to_string(size_).c_str());
+  auto contents = std::make_unique<uint8_t[]>(size_);
+  for (size_t index = 0; index < GetPageCount(); index++) {
+    uint8_t* page = contents.get() + index * page_size_;
+    // Pages that are already cached need not be decoded again.
+    auto cached = std::find_if(pages_.begin(), pages_.end(),
+                               [&](const Page& p) { return p.index == index; });
+    if (cached != pages_.end()) {
+      memcpy(page, cached->data.data(), cached->data.size());
+    } else if (!decoder_(index, page, GetPageLength(index))) {
+      FML_LOG(ERROR) << "Could not decode page " << index << " of a "
+                     << size_ << " byte mapping.";
+      contents_failed_ = true;
+      return nullptr;
+    }
+  }
+  contents_ = std::move(contents);
+  // The cache is redundant from now on.
+  pages_.clear();
+  return contents_.get();
+}
+
+bool PagedMapping::IsDontNeedSafe() const {
+  return false;
+}
+
+bool PagedMapping::Read(size_t offset, size_t length, uint8_t* out) const {
+  if (offset > size_ || length > size_ - offset) {
+    return false;
+  }
+
+  std::scoped_lock lock(mutex_);
+  if (contents_) {
+    memcpy(out, contents_.get() + offset, length);
+    return true;
+  }
+
+  while (length > 0) {
+    const Page* page = LockPage(offset / page_size_);
+    if (!page) {
+      return false;
+    }
+    size_t page_offset = offset % page_size_;
+    size_t count = std::min(length, page->data.size() - page_offset);
+    memcpy(out, page->data.data() + page_offset, count);
+    out += count;
+    offset += count;
+    length -= count;
+  }
+  return true;
+}
+
+size_t PagedMapping::GetPageSize() const {
+  return page_size_;
+}
+
+size_t PagedMapping::GetPageCount() const {
+  return (size_ + page_size_ - 1) / page_size_;
+}
+
+size_t PagedMapping::GetCachedPageCount() const {
+  std::scoped_lock lock(mutex_);
+  return pages_.size();
+}
+
+const PagedMapping::Page* PagedMapping::LockPage(size_t index) const {
+  auto cached = std::find_if(pages_.begin(), pages_.end(),
+                             [&](const Page& page) {
+                               return page.index == index;
+                             });
+  if (cached != pages_.end()) {
+    pages_.splice(pages_.begin(), pages_, cached);
+    return &pages_.front();
+  }
+
+  TRACE_EVENT0("flutter", "PagedMapping::DecodePage");
+  std::vector<uint8_t> data(GetPageLength(index));
+  if (!decoder_(index, data.data(), data.size())) {
+    FML_LOG(ERROR) << "Could not decode page " << index << " of a " << size_
+                   << " byte mapping.";
+    return nullptr;
+  }
+  if (pages_.size() >= max_cached_pages_) {
+    pages_.pop_back();
+  }
+  pages_.push_front({.index = index, .data = std::move(data)});
+  return &pages_.front();
+}
+
+size_t PagedMapping::GetPageLength(size_t index) const {
+  return std::min(page_size_, size_ - index * page_size_);
+}
+
+}  // namespace fml
@@ -0,0 +1,108 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_PAGED_MAPPING_H_
+#define FLUTTER_FML_PAGED_MAPPING_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
+
+namespace fml {
+
+//------------------------------------------------------------------------------
+/// A mapping whose contents are produced one fixed-size page at a time, for
+/// example by inflating an asset that was compressed in independent pages.
+///
+/// Pages are decoded on demand by |Read| and kept in a cache that holds at
+/// most |max_cached_pages| pages, evicting the least recently used one. Only
+/// |GetMapping| needs the contents to be contiguous, so the first call to it
+/// decodes all pages into a buffer that is kept for the lifetime of the
+/// mapping. Callers that can read ranges should prefer |Read|.
+///
+/// All methods are thread-safe.
+///
+class PagedMapping final : public Mapping {
+ public:
+  //----------------------------------------------------------------------------
+  /// Decodes the page |index| into |page|, which is |page_size| bytes long,
+  /// except for the last page, which holds the remainder of the contents.
+  /// Returns false if the page could not be decoded.
+  ///
+  using PageDecoder =
+      std::function<bool(size_t index, uint8_t* page, size_t page_size)>;
+
+  static constexpr size_t kDefaultMaxCachedPages = 8;
+
+  PagedMapping(size_t size,
+               size_t page_size,
+               PageDecoder decoder,
+               size_t max_cached_pages = kDefaultMaxCachedPages);
+
+  ~PagedMapping() override;
+
+  // |Mapping|
+  size_t GetSize() const override;
+
+  // |Mapping|
+  //
+  // Decodes the whole contents on the first call. Returns nullptr if a page
+  // could not be decoded.
+  const uint8_t* GetMapping() const override;
+
+  // |Mapping|
+  bool IsDontNeedSafe() const override;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Copies |length| bytes starting at |offset| into |out|,
+  ///             decoding only the pages that overlap the range.
+  ///
+  /// @return     False if the range is out of bounds or a page could not be
+  ///             decoded.
+  ///
+  bool Read(size_t offset, size_t length, uint8_t* out) const;
+
+  size_t GetPageSize() const;
+
+  size_t GetPageCount() const;
+
+  /// The number of decoded pages currently held in the cache.
+  size_t GetCachedPageCount() const;
+
+ private:
+  struct Page {
+    size_t index;
+    std::vector<uint8_t> data;
+  };
+
+  // Returns the cached page |index|, decoding it if needed, and marks it as
+  // most recently used. Returns nullptr if the page could not be decoded.
+  const Page* LockPage(size_t index) const;
+
+  size_t GetPageLength(size_t index) const;
+
+  const size_t size_;
+  const size_t page_size_;
+  const PageDecoder decoder_;
+  const size_t max_cached_pages_;
+
+  mutable std::mutex mutex_;
+  // Most recently used first.
+  mutable std::list<Page> pages_;
+  mutable std::unique_ptr<uint8_t[]> contents_;
+  mutable bool contents_failed_ = false;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(PagedMapping);
+};
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_PAGED_MAPPING_H_
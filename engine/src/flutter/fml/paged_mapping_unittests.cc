@@ -0,0 +1,105 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/paged_mapping.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace testing {
+
+namespace {
+
+// A decoder that fills each byte with its offset in the contents and records
+// the pages it decodes.
+PagedMapping::PageDecoder MakeDecoder(size_t page_size,
+                                      std::vector<size_t>* decoded) {
+  return [page_size, decoded](size_t index, uint8_t* page, size_t length) {
+    decoded->push_back(index);
+    for (size_t i = 0; i < length; i++) {
+      page[i] = static_cast<uint8_t>(index * page_size + i);
+    }
+    return true;
+  };
+}
+
+}  // namespace
+
+TEST(PagedMappingTest, ReadsDecodeOnlyOverlappingPages) {
+  std::vector<size_t> decoded;
+  PagedMapping mapping(100, 16, MakeDecoder(16, &decoded));
+  EXPECT_EQ(mapping.GetSize(), 100u);
+  EXPECT_EQ(mapping.GetPageCount(), 7u);
+  EXPECT_FALSE(mapping.IsDontNeedSafe());
+
+  uint8_t out[20] = {};
+  ASSERT_TRUE(mapping.Read(30, 20, out));
+  for (size_t i = 0; i < 20; i++) {
+    EXPECT_EQ(out[i], 30 + i);
+  }
+  EXPECT_EQ(decoded, std::vector<size_t>({1, 2, 3}));
+
+  // The last page is shorter than the others.
+  ASSERT_TRUE(mapping.Read(96, 4, out));
+  EXPECT_EQ(out[3], 99);
+  EXPECT_EQ(decoded, std::vector<size_t>({1, 2, 3, 6}));
+
+  EXPECT_FALSE(mapping.Read(96, 5, out));
+  EXPECT_FALSE(mapping.Read(101, 0, out));
+}
+
+TEST(PagedMappingTest, CacheEvictsLeastRecentlyUsedPage) {
+  std::vector<size_t> decoded;
+  PagedMapping mapping(64, 16, MakeDecoder(16, &decoded), 2);
+
+  uint8_t out = 0;
+  ASSERT_TRUE(mapping.Read(0, 1, &out));
+  ASSERT_TRUE(mapping.Read(16, 1, &out));
+  ASSERT_TRUE(mapping.Read(0, 1, &out));
+  EXPECT_EQ(mapping.GetCachedPageCount(), 2u);
+  EXPECT_EQ(decoded, std::vector<size_t>({0, 1}));
+
+  // Page 1 is the least recently used one.
+  ASSERT_TRUE(mapping.Read(32, 1, &out));
+  ASSERT_TRUE(mapping.Read(0, 1, &out));
+  ASSERT_TRUE(mapping.Read(16, 1, &out));
+  EXPECT_EQ(mapping.GetCachedPageCount(), 2u);
+  EXPECT_EQ(decoded, std::vector<size_t>({0, 1, 2, 1}));
+}
+
+TEST(PagedMappingTest, GetMappingDecodesUncachedPagesOnce) {
+  std::vector<size_t> decoded;
+  PagedMapping mapping(40, 16, MakeDecoder(16, &decoded));
+
+  uint8_t out = 0;
+  ASSERT_TRUE(mapping.Read(20, 1, &out));
+  const uint8_t* contents = mapping.GetMapping();
+  ASSERT_NE(contents, nullptr);
+  for (size_t i = 0; i < 40; i++) {
+    EXPECT_EQ(contents[i], i);
+  }
+  EXPECT_EQ(decoded, std::vector<size_t>({1, 0, 2}));
+  EXPECT_EQ(mapping.GetCachedPageCount(), 0u);
+
+  EXPECT_EQ(mapping.GetMapping(), contents);
+  ASSERT_TRUE(mapping.Read(39, 1, &out));
+  EXPECT_EQ(out, 39);
+  EXPECT_EQ(decoded.size(), 3u);
+}
+
+TEST(PagedMappingTest, DecodeFailuresAreReported) {
+  PagedMapping mapping(32, 16, [](size_t index, uint8_t*, size_t) {
+    return index == 0;
+  });
+
+  uint8_t out[32] = {};
+  EXPECT_TRUE(mapping.Read(0, 16, out));
+  EXPECT_FALSE(mapping.Read(0, 32, out));
+  EXPECT_EQ(mapping.GetMapping(), nullptr);
+}
+
+}  // namespace testing
+}  // namespace fml
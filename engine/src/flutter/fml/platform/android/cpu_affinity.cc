@@ -5,6 +5,7 @@
 #include "flutter/fml/platform/android/cpu_affinity.h"
 
 #include <pthread.h>
+#include <sched.h>
 #include <sys/resource.h>
 #include <sys/time.h>
 #include <unistd.h>
@@ -56,10 +57,28 @@ std::optional<size_t> AndroidEfficiencyCoreCount() {
   return result;
 }
 
+// Whether the performance cores are currently limited, for example by thermal
+// throttling, to no more than the speed of the other cores.
+static bool IsPerformanceThrottled() {
+  std::vector<CpuIndexAndSpeed> current_max_speeds;
+  for (const auto index : gCPUTracker->GetIndices(CpuAffinity::kPerformance)) {
+    auto path = "/sys/devices/system/cpu/cpu" + std::to_string(index) +
+                "/cpufreq/scaling_max_freq";
+    auto speed = ReadIntFromFile(path);
+    if (speed.has_value()) {
+      current_max_speeds.push_back({.index = index, .speed = speed.value()});
+    }
+  }
+  return gCPUTracker->IsPerformanceThrottled(current_max_speeds);
+}
+
 bool AndroidRequestAffinity(CpuAffinity affinity) {
   if (!SetUpCPUTracker()) {
     return true;
   }
+  if (affinity == CpuAffinity::kPerformance && IsPerformanceThrottled()) {
+    affinity = CpuAffinity::kNotEfficiency;
+  }
 
   cpu_set_t set;
   CPU_ZERO(&set);
@@ -69,4 +88,15 @@ bool AndroidRequestAffinity(CpuAffinity affinity) {
   return sched_setaffinity(gettid(), sizeof(set), &set) == 0;
 }
 
+CpuCluster AndroidCurrentCpuCluster() {
+  if (!SetUpCPUTracker()) {
+    return CpuCluster::kUnknown;
+  }
+  int cpu = sched_getcpu();
+  if (cpu < 0) {
+    return CpuCluster::kUnknown;
+  }
+  return gCPUTracker->GetCluster(cpu);
+}
+
 }  // namespace fml
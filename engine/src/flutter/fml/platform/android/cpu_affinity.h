@@ -15,6 +15,9 @@ std::optional<size_t> AndroidEfficiencyCoreCount();
 /// @brief Android specific implementation of RequestAffinity.
 bool AndroidRequestAffinity(CpuAffinity affinity);
 
+/// @brief Android specific implementation of CurrentCpuCluster.
+CpuCluster AndroidCurrentCpuCluster();
+
 }  // namespace fml
 
 #endif  // FLUTTER_FML_PLATFORM_ANDROID_CPU_AFFINITY_H_
@@ -0,0 +1,42 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_PLATFORM_DARWIN_ASYNC_FILE_IO_DARWIN_H_
+#define FLUTTER_FML_PLATFORM_DARWIN_ASYNC_FILE_IO_DARWIN_H_
+
+#include <dispatch/dispatch.h>
+
+#include <memory>
+
+#include "flutter/fml/async_file_io.h"
+#include "flutter/fml/macros.h"
+
+namespace fml {
+
+//------------------------------------------------------------------------------
+/// An |AsyncFileIO| that reads files with dispatch I/O.
+///
+class AsyncFileIODarwin final : public AsyncFileIO {
+ public:
+  explicit AsyncFileIODarwin(std::shared_ptr<BasicTaskRunner> workers);
+
+  ~AsyncFileIODarwin() override;
+
+  // |AsyncFileIO|
+  void ReadFile(UniqueFD file,
+                RefPtr<TaskRunner> callback_runner,
+                ReadCallback callback) override;
+
+ private:
+  // The queue the reads complete on.
+  dispatch_queue_t queue_;
+  // Entered by the reads in flight.
+  dispatch_group_t in_flight_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(AsyncFileIODarwin);
+};
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_PLATFORM_DARWIN_ASYNC_FILE_IO_DARWIN_H_
@@ -0,0 +1,105 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/platform/darwin/async_file_io_darwin.h"
+
+#include <sys/stat.h>
+
+#include <cstdint>
+#include <utility>
+
+namespace fml {
+
+namespace {
+
+// The contents of a file read with dispatch I/O, made contiguous.
+class DispatchDataMapping final : public Mapping {
+ public:
+  explicit DispatchDataMapping(dispatch_data_t data) {
+    const void* buffer = nullptr;
+    map_ = dispatch_data_create_map(data, &buffer, &size_);
+    data_ = static_cast<const uint8_t*>(buffer);
+  }
+
+  ~DispatchDataMapping() override {
+    if (map_) {
+      dispatch_release(map_);
+    }
+  }
+
+  // |Mapping|
+  size_t GetSize() const override { return size_; }
+
+  // |Mapping|
+  const uint8_t* GetMapping() const override { return data_; }
+
+  // |Mapping|
+  bool IsDontNeedSafe() const override { return false; }
+
+ private:
+  dispatch_data_t map_ = nullptr;
+  const uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DispatchDataMapping);
+};
+
+struct PendingRead {
+  UniqueFD file;
+  RefPtr<TaskRunner> callback_runner;
+  AsyncFileIO::ReadCallback callback;
+};
+
+}  // namespace
+
+AsyncFileIODarwin::AsyncFileIODarwin(std::shared_ptr<BasicTaskRunner> workers)
+    : AsyncFileIO(std::move(workers)),
+      queue_(dispatch_queue_create("io.flutter.async_file_io",
+                                   DISPATCH_QUEUE_SERIAL)),
+      in_flight_(dispatch_group_create()) {}
+
+AsyncFileIODarwin::~AsyncFileIODarwin() {
+  dispatch_group_wait(in_flight_, DISPATCH_TIME_FOREVER);
+  dispatch_release(in_flight_);
+  dispatch_release(queue_);
+}
+
+void AsyncFileIODarwin::ReadFile(UniqueFD file,
+                                 RefPtr<TaskRunner> callback_runner,
+                                 ReadCallback callback) {
+  struct stat stat_buffer = {};
+  if (!file.is_valid() || ::fstat(file.get(), &stat_buffer) != 0) {
+    PostReadResult(callback_runner, std::move(callback), nullptr);
+    return;
+  }
+  // Dispatch I/O would wait for the data of pipes and sockets that don't
+  // have any yet, which may keep the destructor waiting.
+  if (!S_ISREG(stat_buffer.st_mode)) {
+    ReadFileOnWorkers(std::move(file), std::move(callback_runner),
+                      std::move(callback));
+    return;
+  }
+
+  // Owned by the handler, which dispatch I/O calls exactly once as the whole
+  // file is read at once.
+  PendingRead* read = new PendingRead{std::move(file),
+                                      std::move(callback_runner),
+                                      std::move(callback)};
+  dispatch_group_t in_flight = in_flight_;
+  dispatch_group_enter(in_flight);
+  dispatch_read(read->file.get(), SIZE_MAX, queue_,
+                ^(dispatch_data_t data, int error) {
+                  std::unique_ptr<PendingRead> owned_read(read);
+                  std::unique_ptr<Mapping> contents;
+                  if (error == 0) {
+                    contents = std::make_unique<DispatchDataMapping>(data);
+                  }
+                  PostReadResult(owned_read->callback_runner,
+                                 std::move(owned_read->callback),
+                                 std::move(contents));
+                  dispatch_group_leave(in_flight);
+                });
+}
+
+}  // namespace fml
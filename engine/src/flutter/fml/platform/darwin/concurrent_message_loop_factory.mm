@@ -11,6 +11,8 @@ class ConcurrentMessageLoopDarwin : public ConcurrentMessageLoop {
 
  protected:
   explicit ConcurrentMessageLoopDarwin(size_t worker_count) : ConcurrentMessageLoop(worker_count) {}
+  ConcurrentMessageLoopDarwin(size_t worker_count, Executor executor)
+      : ConcurrentMessageLoop(worker_count, std::move(executor)) {}
 
   void ExecuteTask(const fml::closure& task) override {
     @autoreleasepool {
@@ -23,4 +25,11 @@ std::shared_ptr<ConcurrentMessageLoop> ConcurrentMessageLoop::Create(size_t work
   return std::shared_ptr<ConcurrentMessageLoop>{new ConcurrentMessageLoopDarwin(worker_count)};
 }
 
+std::shared_ptr<ConcurrentMessageLoop> ConcurrentMessageLoop::CreateWithExecutor(
+    size_t worker_count,
+    Executor executor) {
+  return std::shared_ptr<ConcurrentMessageLoop>{
+      new ConcurrentMessageLoopDarwin(worker_count, std::move(executor))};
+}
+
 }  // namespace fml
@@ -0,0 +1,382 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/platform/linux/async_file_io_uring.h"
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/thread.h"
+
+namespace fml {
+
+namespace {
+
+// The number of reads in flight at once. More are queued until some
+// complete.
+constexpr unsigned kRingEntries = 64;
+
+// The number of times in a row waiting for completions may fail before the
+// ring is given up on.
+constexpr int kMaxWaitFailures = 8;
+
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+int IoUringSetup(unsigned entries, io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int fd, unsigned to_submit, unsigned min_complete) {
+  return static_cast<int>(
+      syscall(__NR_io_uring_enter, fd, to_submit, min_complete,
+              min_complete > 0 ? IORING_ENTER_GETEVENTS : 0, nullptr, 0));
+}
+#else
+int IoUringSetup(unsigned entries, io_uring_params* params) {
+  errno = ENOSYS;
+  return -1;
+}
+
+int IoUringEnter(int fd, unsigned to_submit, unsigned min_complete) {
+  errno = ENOSYS;
+  return -1;
+}
+#endif
+
+void* MapRing(int fd, size_t size, off_t offset) {
+  void* ring = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, fd, offset);
+  return ring == MAP_FAILED ? nullptr : ring;
+}
+
+template <typename T>
+T* RingField(void* ring, uint32_t offset) {
+  return reinterpret_cast<T*>(static_cast<uint8_t*>(ring) + offset);
+}
+
+}  // namespace
+
+// The memory shared with the kernel.
+struct AsyncFileIOUring::Ring {
+  UniqueFD fd;
+  unsigned entries = 0;
+
+  void* sq_ring = nullptr;
+  size_t sq_ring_size = 0;
+  void* cq_ring = nullptr;
+  size_t cq_ring_size = 0;
+  io_uring_sqe* sqes = nullptr;
+  size_t sqes_size = 0;
+
+  // The kernel consumes the submission queue from its head, and fills the
+  // completion queue from its tail.
+  unsigned* sq_head = nullptr;
+  unsigned* sq_tail = nullptr;
+  unsigned sq_mask = 0;
+  unsigned* sq_array = nullptr;
+  unsigned* cq_head = nullptr;
+  unsigned* cq_tail = nullptr;
+  unsigned cq_mask = 0;
+  io_uring_cqe* cqes = nullptr;
+
+  ~Ring() {
+    if (sqes) {
+      ::munmap(sqes, sqes_size);
+    }
+    if (cq_ring && cq_ring != sq_ring) {
+      ::munmap(cq_ring, cq_ring_size);
+    }
+    if (sq_ring) {
+      ::munmap(sq_ring, sq_ring_size);
+    }
+  }
+};
+
+struct AsyncFileIOUring::Read {
+  UniqueFD file;
+  RefPtr<TaskRunner> callback_runner;
+  ReadCallback callback;
+  uint8_t* buffer = nullptr;
+  size_t size = 0;
+  size_t offset = 0;
+  bool failed = false;
+  // Read by the kernel until the read completes.
+  struct iovec iovec = {};
+
+  ~Read() { ::free(buffer); }
+};
+
+std::unique_ptr<AsyncFileIOUring> AsyncFileIOUring::Create(
+    std::shared_ptr<BasicTaskRunner> workers) {
+  io_uring_params params = {};
+  UniqueFD fd(IoUringSetup(kRingEntries, &params));
+  if (!fd.is_valid()) {
+    // Sandboxes commonly deny io_uring.
+    FML_DLOG(INFO) << "io_uring is not available: " << std::strerror(errno);
+    return nullptr;
+  }
+
+  auto ring = std::make_unique<Ring>();
+  ring->entries = params.sq_entries;
+  ring->sq_ring_size =
+      params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  ring->cq_ring_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+  if (single_mmap) {
+    ring->sq_ring_size = std::max(ring->sq_ring_size, ring->cq_ring_size);
+  }
+  ring->sq_ring = MapRing(fd.get(), ring->sq_ring_size, IORING_OFF_SQ_RING);
+  if (!ring->sq_ring) {
+    return nullptr;
+  }
+  if (single_mmap) {
+    ring->cq_ring = ring->sq_ring;
+  } else {
+    ring->cq_ring = MapRing(fd.get(), ring->cq_ring_size, IORING_OFF_CQ_RING);
+    if (!ring->cq_ring) {
+      return nullptr;
+    }
+  }
+  ring->sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+  ring->sqes = static_cast<io_uring_sqe*>(
+      MapRing(fd.get(), ring->sqes_size, IORING_OFF_SQES));
+  if (!ring->sqes) {
+    return nullptr;
+  }
+
+  ring->sq_head = RingField<unsigned>(ring->sq_ring, params.sq_off.head);
+  ring->sq_tail = RingField<unsigned>(ring->sq_ring, params.sq_off.tail);
+  ring->sq_mask = *RingField<unsigned>(ring->sq_ring, params.sq_off.ring_mask);
+  ring->sq_array = RingField<unsigned>(ring->sq_ring, params.sq_off.array);
+  ring->cq_head = RingField<unsigned>(ring->cq_ring, params.cq_off.head);
+  ring->cq_tail = RingField<unsigned>(ring->cq_ring, params.cq_off.tail);
+  ring->cq_mask = *RingField<unsigned>(ring->cq_ring, params.cq_off.ring_mask);
+  ring->cqes = RingField<io_uring_cqe>(ring->cq_ring, params.cq_off.cqes);
+  ring->fd = std::move(fd);
+
+  return std::unique_ptr<AsyncFileIOUring>(
+      new AsyncFileIOUring(std::move(workers), std::move(ring)));
+}
+
+AsyncFileIOUring::AsyncFileIOUring(std::shared_ptr<BasicTaskRunner> workers,
+                                   std::unique_ptr<Ring> ring)
+    : AsyncFileIO(std::move(workers)), ring_(std::move(ring)) {
+  completion_thread_ = std::thread([this]() {
+    fml::Thread::SetCurrentThreadName(
+        fml::Thread::ThreadConfig("io.flutter.async_file_io"));
+    WaitForCompletions();
+  });
+}
+
+AsyncFileIOUring::~AsyncFileIOUring() {
+  {
+    std::scoped_lock lock(mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_one();
+  completion_thread_.join();
+}
+
+void AsyncFileIOUring::ReadFile(UniqueFD file,
+                                RefPtr<TaskRunner> callback_runner,
+                                ReadCallback callback) {
+  struct stat stat_buffer = {};
+  if (!file.is_valid() || ::fstat(file.get(), &stat_buffer) != 0) {
+    PostReadResult(callback_runner, std::move(callback), nullptr);
+    return;
+  }
+  // The size of other files is not known ahead of the read.
+  if (!S_ISREG(stat_buffer.st_mode)) {
+    ReadFileOnWorkers(std::move(file), std::move(callback_runner),
+                      std::move(callback));
+    return;
+  }
+  if (stat_buffer.st_size == 0) {
+    PostReadResult(callback_runner, std::move(callback),
+                   std::make_unique<DataMapping>(std::vector<uint8_t>{}));
+    return;
+  }
+
+  auto read = std::make_unique<Read>();
+  read->size = stat_buffer.st_size;
+  read->buffer = static_cast<uint8_t*>(::malloc(read->size));
+  if (!read->buffer) {
+    PostReadResult(callback_runner, std::move(callback), nullptr);
+    return;
+  }
+  read->file = std::move(file);
+  read->callback_runner = std::move(callback_runner);
+  read->callback = std::move(callback);
+
+  std::unique_lock lock(mutex_);
+  FML_DCHECK(!stopping_);
+  if (ring_failed_) {
+    lock.unlock();
+    ReadFileOnWorkers(std::move(read->file), std::move(read->callback_runner),
+                      std::move(read->callback));
+    return;
+  }
+  SubmitLocked(read.release());
+  wake_.notify_one();
+}
+
+void AsyncFileIOUring::SubmitLocked(Read* read) {
+  if (in_flight_.size() >= ring_->entries) {
+    pending_.push_back(read);
+    return;
+  }
+  in_flight_.insert(read);
+  read->iovec.iov_base = read->buffer + read->offset;
+  read->iovec.iov_len = read->size - read->offset;
+
+  // At most |entries| reads are in flight, which the completion queue has
+  // room for.
+  const unsigned tail = *ring_->sq_tail;
+  const unsigned index = tail & ring_->sq_mask;
+  io_uring_sqe* sqe = &ring_->sqes[index];
+  std::memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = IORING_OP_READV;
+  sqe->fd = read->file.get();
+  sqe->addr = reinterpret_cast<uint64_t>(&read->iovec);
+  sqe->len = 1;
+  sqe->off = read->offset;
+  sqe->user_data = reinterpret_cast<uint64_t>(read);
+  ring_->sq_array[index] = index;
+  __atomic_store_n(ring_->sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+  int result;
+  do {
+    result = IoUringEnter(ring_->fd.get(), 1, 0);
+  } while (result < 0 && errno == EINTR);
+  if (__atomic_load_n(ring_->sq_head, __ATOMIC_ACQUIRE) != tail + 1) {
+    // The kernel only consumes submissions in io_uring_enter, which is only
+    // called to submit with |mutex_| held, so the entry can be taken back.
+    // Otherwise the read would never complete.
+    FML_LOG(ERROR) << "Could not submit to io_uring: "
+                   << (result < 0 ? std::strerror(errno) : "not consumed");
+    __atomic_store_n(ring_->sq_tail, tail, __ATOMIC_RELEASE);
+    in_flight_.erase(read);
+    PostReadResult(read->callback_runner, std::move(read->callback), nullptr);
+    delete read;
+  }
+}
+
+void AsyncFileIOUring::WaitForCompletions() {
+  int wait_failures = 0;
+  std::vector<std::pair<Read*, int>> completions;
+  std::vector<Read*> done;
+  while (true) {
+    {
+      std::unique_lock lock(mutex_);
+      wake_.wait(lock, [this]() {
+        return stopping_ || !in_flight_.empty() || !pending_.empty();
+      });
+      // Reads whose submission failed leave room for the queued ones.
+      while (!pending_.empty() && in_flight_.size() < ring_->entries) {
+        Read* read = pending_.front();
+        pending_.pop_front();
+        SubmitLocked(read);
+      }
+      if (in_flight_.empty()) {
+        if (stopping_) {
+          return;
+        }
+        continue;
+      }
+    }
+
+    if (IoUringEnter(ring_->fd.get(), 0, 1) < 0 && errno != EINTR) {
+      FML_LOG(ERROR) << "Could not wait for io_uring: " << std::strerror(errno);
+      if (++wait_failures >= kMaxWaitFailures) {
+        std::scoped_lock lock(mutex_);
+        FailAllLocked();
+        return;
+      }
+      continue;
+    }
+    wait_failures = 0;
+
+    unsigned head = *ring_->cq_head;
+    const unsigned tail = __atomic_load_n(ring_->cq_tail, __ATOMIC_ACQUIRE);
+    for (; head != tail; head++) {
+      const io_uring_cqe& cqe = ring_->cqes[head & ring_->cq_mask];
+      completions.emplace_back(reinterpret_cast<Read*>(cqe.user_data),
+                               cqe.res);
+    }
+    __atomic_store_n(ring_->cq_head, head, __ATOMIC_RELEASE);
+
+    {
+      // The reads were filled in with the lock held, which orders those
+      // writes before the reads here, as the kernel hands the reads over.
+      std::scoped_lock lock(mutex_);
+      for (const auto& [read, result] : completions) {
+        in_flight_.erase(read);
+        if (OnCompletion(read, result)) {
+          done.push_back(read);
+        } else {
+          SubmitLocked(read);
+        }
+      }
+    }
+    completions.clear();
+
+    for (Read* read : done) {
+      std::unique_ptr<Mapping> contents;
+      if (!read->failed) {
+        contents = std::make_unique<MallocMapping>(
+            std::exchange(read->buffer, nullptr), read->offset);
+      }
+      PostReadResult(read->callback_runner, std::move(read->callback),
+                     std::move(contents));
+      delete read;
+    }
+    done.clear();
+  }
+}
+
+void AsyncFileIOUring::FailAllLocked() {
+  ring_failed_ = true;
+  for (Read* read : pending_) {
+    PostReadResult(read->callback_runner, std::move(read->callback), nullptr);
+    delete read;
+  }
+  pending_.clear();
+  for (Read* read : in_flight_) {
+    // The kernel may still write to the buffer of a read it has not
+    // completed, so the read is leaked rather than deleted.
+    PostReadResult(read->callback_runner, std::move(read->callback), nullptr);
+  }
+  in_flight_.clear();
+}
+
+bool AsyncFileIOUring::OnCompletion(Read* read, int result) {
+  if (result == -EINTR || result == -EAGAIN) {
+    return false;
+  }
+  if (result < 0) {
+    FML_DLOG(ERROR) << "Could not read file: " << std::strerror(-result);
+    read->failed = true;
+    return true;
+  }
+  // The file was truncated since the read started.
+  if (result == 0) {
+    return true;
+  }
+  read->offset += result;
+  return read->offset >= read->size;
+}
+
+}  // namespace fml
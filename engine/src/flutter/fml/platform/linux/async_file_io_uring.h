@@ -0,0 +1,80 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_PLATFORM_LINUX_ASYNC_FILE_IO_URING_H_
+#define FLUTTER_FML_PLATFORM_LINUX_ASYNC_FILE_IO_URING_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+#include "flutter/fml/async_file_io.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/unique_fd.h"
+
+namespace fml {
+
+//------------------------------------------------------------------------------
+/// An |AsyncFileIO| that reads files with io_uring. One thread waits for the
+/// completions of all the reads, and posts their callbacks.
+///
+class AsyncFileIOUring final : public AsyncFileIO {
+ public:
+  //----------------------------------------------------------------------------
+  /// @brief      Sets up a ring, or returns null if the kernel has no
+  ///             io_uring or does not let this process use it.
+  ///
+  static std::unique_ptr<AsyncFileIOUring> Create(
+      std::shared_ptr<BasicTaskRunner> workers);
+
+  ~AsyncFileIOUring() override;
+
+  // |AsyncFileIO|
+  void ReadFile(UniqueFD file,
+                RefPtr<TaskRunner> callback_runner,
+                ReadCallback callback) override;
+
+ private:
+  struct Ring;
+  struct Read;
+
+  AsyncFileIOUring(std::shared_ptr<BasicTaskRunner> workers,
+                   std::unique_ptr<Ring> ring);
+
+  // Submits the rest of |read|, or queues it until fewer reads are in
+  // flight. If the kernel does not take the submission, the read fails and
+  // is deleted. Must be called with |mutex_| held.
+  void SubmitLocked(Read* read);
+
+  void WaitForCompletions();
+
+  // Returns true if |read| is done, whether it failed or not. Must be called
+  // with |mutex_| held.
+  bool OnCompletion(Read* read, int result);
+
+  // Fails all the reads once the ring can no longer be waited on. Later
+  // reads are done on the workers. Must be called with |mutex_| held.
+  void FailAllLocked();
+
+  const std::unique_ptr<Ring> ring_;
+  std::mutex mutex_;
+  // Signaled when reads are submitted or the instance is being destroyed.
+  std::condition_variable wake_;
+  // The reads submitted to the ring, and those waiting for room in it.
+  std::unordered_set<Read*> in_flight_;
+  std::deque<Read*> pending_;
+  bool stopping_ = false;
+  bool ring_failed_ = false;
+  std::thread completion_thread_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(AsyncFileIOUring);
+};
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_PLATFORM_LINUX_ASYNC_FILE_IO_URING_H_
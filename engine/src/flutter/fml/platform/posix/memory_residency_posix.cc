@@ -0,0 +1,87 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/memory_residency.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cinttypes>
+#include <cstdio>
+
+#include "flutter/fml/build_config.h"
+
+namespace fml {
+
+size_t GetMemoryPageSize() {
+  static const size_t page_size = sysconf(_SC_PAGESIZE);
+  return page_size;
+}
+
+std::optional<MemoryRegion> GetMappedRegionContaining(const void* address) {
+#if FML_OS_LINUX || FML_OS_ANDROID
+  FILE* maps = fopen("/proc/self/maps", "re");
+  if (maps == nullptr) {
+    return std::nullopt;
+  }
+  const uintptr_t target = reinterpret_cast<uintptr_t>(address);
+  std::optional<MemoryRegion> region;
+  char line[512];
+  while (fgets(line, sizeof(line), maps) != nullptr) {
+    uintptr_t start = 0;
+    uintptr_t end = 0;
+    if (sscanf(line, "%" SCNxPTR "-%" SCNxPTR, &start, &end) != 2) {
+      continue;
+    }
+    if (target >= start && target < end) {
+      region = MemoryRegion{.start = reinterpret_cast<const uint8_t*>(start),
+                            .size = static_cast<size_t>(end - start)};
+      break;
+    }
+  }
+  fclose(maps);
+  return region;
+#else
+  return std::nullopt;
+#endif
+}
+
+std::optional<std::vector<bool>> GetResidentPages(const MemoryRegion& region) {
+#if FML_OS_FUCHSIA
+  return std::nullopt;
+#else
+  const size_t page_count = region.GetPageCount();
+#if FML_OS_MACOSX || FML_OS_IOS
+  std::vector<char> residency(page_count);
+#else
+  std::vector<unsigned char> residency(page_count);
+#endif
+  if (page_count == 0) {
+    return std::vector<bool>();
+  }
+  if (::mincore(const_cast<uint8_t*>(region.start), region.size,
+                residency.data()) != 0) {
+    return std::nullopt;
+  }
+  std::vector<bool> resident(page_count);
+  for (size_t i = 0; i < page_count; i++) {
+    resident[i] = (residency[i] & 1) != 0;
+  }
+  return resident;
+#endif
+}
+
+bool PrefetchMemory(const MemoryRegion& region) {
+#if FML_OS_FUCHSIA
+  return false;
+#else
+  if (region.size == 0) {
+    return true;
+  }
+  return ::madvise(const_cast<uint8_t*>(region.start), region.size,
+                   MADV_WILLNEED) == 0;
+#endif
+}
+
+}  // namespace fml
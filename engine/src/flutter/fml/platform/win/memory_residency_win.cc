@@ -0,0 +1,47 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/memory_residency.h"
+
+#include <windows.h>
+
+namespace fml {
+
+size_t GetMemoryPageSize() {
+  static const size_t page_size = [] {
+    SYSTEM_INFO info;
+    ::GetSystemInfo(&info);
+    return static_cast<size_t>(info.dwPageSize);
+  }();
+  return page_size;
+}
+
+std::optional<MemoryRegion> GetMappedRegionContaining(const void* address) {
+  MEMORY_BASIC_INFORMATION info;
+  if (::VirtualQuery(address, &info, sizeof(info)) == 0 ||
+      info.State != MEM_COMMIT) {
+    return std::nullopt;
+  }
+  return MemoryRegion{.start = static_cast<const uint8_t*>(info.BaseAddress),
+                      .size = info.RegionSize};
+}
+
+std::optional<std::vector<bool>> GetResidentPages(const MemoryRegion& region) {
+  // QueryWorkingSetEx only tells the pages of the working set of this
+  // process apart, not the ones in the standby list that don't fault from
+  // the disk.
+  return std::nullopt;
+}
+
+bool PrefetchMemory(const MemoryRegion& region) {
+  if (region.size == 0) {
+    return true;
+  }
+  WIN32_MEMORY_RANGE_ENTRY range;
+  range.VirtualAddress = const_cast<uint8_t*>(region.start);
+  range.NumberOfBytes = region.size;
+  return ::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0) != 0;
+}
+
+}  // namespace fml
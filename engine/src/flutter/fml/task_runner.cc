@@ -26,6 +26,16 @@ void TaskRunner::PostTask(const fml::closure& task) {
   loop_->PostTask(task, fml::TimePoint::Now());
 }
 
+void TaskRunner::PostTasks(const std::vector<fml::closure>& tasks) {
+  if (!loop_) {
+    for (const fml::closure& task : tasks) {
+      PostTask(task);
+    }
+    return;
+  }
+  loop_->PostTasks(tasks, fml::TimePoint::Now());
+}
+
 void TaskRunner::PostTaskForTime(const fml::closure& task,
                                  fml::TimePoint target_time) {
   loop_->PostTask(task, target_time);
@@ -36,6 +46,16 @@ void TaskRunner::PostDelayedTask(const fml::closure& task,
   loop_->PostTask(task, fml::TimePoint::Now() + delay);
 }
 
+void TaskRunner::PostTaskWithGrade(const fml::closure& task,
+                                   fml::TaskSourceGrade grade,
+                                   fml::TimePoint deadline) {
+  if (!loop_) {
+    PostTask(task);
+    return;
+  }
+  loop_->PostTask(task, fml::TimePoint::Now(), grade, deadline);
+}
+
 TaskQueueId TaskRunner::GetTaskQueueId() {
   FML_DCHECK(loop_);
   return loop_->GetTaskQueueId();
@@ -5,6 +5,8 @@
 #ifndef FLUTTER_FML_TASK_RUNNER_H_
 #define FLUTTER_FML_TASK_RUNNER_H_
 
+#include <vector>
+
 #include "flutter/fml/closure.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/ref_counted.h"
@@ -38,6 +40,14 @@ class TaskRunner : public fml::RefCountedThreadSafe<TaskRunner>,
 
   virtual void PostTask(const fml::closure& task) override;
 
+  /// Schedules \p tasks to be run in order, as if each was posted with
+  /// \p PostTask, but waking up the MessageLoop only once. Use this over
+  /// posting in a loop when many tasks are ready at the same time.
+  ///
+  /// Task runners that are not backed by a \p fml::MessageLoop post the tasks
+  /// one by one.
+  virtual void PostTasks(const std::vector<fml::closure>& tasks);
+
   virtual void PostTaskForTime(const fml::closure& task,
                                fml::TimePoint target_time);
 
@@ -49,6 +59,18 @@ class TaskRunner : public fml::RefCountedThreadSafe<TaskRunner>,
   /// tens of milliseconds.
   virtual void PostDelayedTask(const fml::closure& task, fml::TimeDelta delay);
 
+  /// Schedules \p task to be run now, with the priority of its \p grade. A
+  /// \p TaskSourceGrade::kUserInteraction task runs before the other tasks
+  /// that are due, and gets precedence while it can still meet its
+  /// \p deadline.
+  ///
+  /// Task runners that are not backed by a \p fml::MessageLoop post the task
+  /// like \p PostTask.
+  virtual void PostTaskWithGrade(const fml::closure& task,
+                                 fml::TaskSourceGrade grade,
+                                 fml::TimePoint deadline =
+                                     fml::TimePoint::Max());
+
   /// Returns \p true when the current executing thread's TaskRunner matches
   /// this instance.
   virtual bool RunsTasksOnCurrentThread();
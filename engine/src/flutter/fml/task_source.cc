@@ -16,6 +16,7 @@ TaskSource::~TaskSource() {
 }
 
 void TaskSource::ShutDown() {
+  user_interaction_task_queue_ = {};
   primary_task_queue_ = {};
   secondary_task_queue_ = {};
 }
@@ -23,7 +24,7 @@ void TaskSource::ShutDown() {
 void TaskSource::RegisterTask(const DelayedTask& task) {
   switch (task.GetTaskSourceGrade()) {
     case TaskSourceGrade::kUserInteraction:
-      primary_task_queue_.push(task);
+      user_interaction_task_queue_.push(task);
       break;
     case TaskSourceGrade::kUnspecified:
       primary_task_queue_.push(task);
@@ -37,8 +38,9 @@ void TaskSource::RegisterTask(const DelayedTask& task) {
 void TaskSource::PopTask(TaskSourceGrade grade) {
   switch (grade) {
     case TaskSourceGrade::kUserInteraction:
-      primary_task_queue_.pop();
-      break;
+      user_interaction_task_queue_.pop();
+      consecutive_user_interaction_tasks_++;
+      return;
     case TaskSourceGrade::kUnspecified:
       primary_task_queue_.pop();
       break;
@@ -46,10 +48,12 @@ void TaskSource::PopTask(TaskSourceGrade grade) {
       secondary_task_queue_.pop();
       break;
   }
+  consecutive_user_interaction_tasks_ = 0;
 }
 
 size_t TaskSource::GetNumPendingTasks() const {
-  size_t size = primary_task_queue_.size();
+  size_t size =
+      user_interaction_task_queue_.size() + primary_task_queue_.size();
   if (secondary_pause_requests_ == 0) {
     size += secondary_task_queue_.size();
   }
@@ -60,35 +64,52 @@ bool TaskSource::IsEmpty() const {
   return GetNumPendingTasks() == 0;
 }
 
-TaskSource::TopTask TaskSource::Top() const {
+TaskSource::TopTask TaskSource::Top(fml::TimePoint now) const {
   FML_CHECK(!IsEmpty());
-  if (secondary_pause_requests_ > 0 || secondary_task_queue_.empty()) {
-    const auto& primary_top = primary_task_queue_.top();
-    return {
-        .task_queue_id = task_queue_id_,
-        .task = primary_top,
-    };
-  } else if (primary_task_queue_.empty()) {
-    const auto& secondary_top = secondary_task_queue_.top();
-    return {
-        .task_queue_id = task_queue_id_,
-        .task = secondary_top,
-    };
-  } else {
-    const auto& primary_top = primary_task_queue_.top();
-    const auto& secondary_top = secondary_task_queue_.top();
-    if (primary_top > secondary_top) {
-      return {
-          .task_queue_id = task_queue_id_,
-          .task = secondary_top,
-      };
-    } else {
-      return {
-          .task_queue_id = task_queue_id_,
-          .task = primary_top,
-      };
+  TopTask earliest_top = EarliestTop();
+  if (user_interaction_task_queue_.empty()) {
+    return earliest_top;
+  }
+  const auto& user_interaction_top = user_interaction_task_queue_.top();
+  if (&earliest_top.task == &user_interaction_top ||
+      user_interaction_top.GetTargetTime() > now) {
+    return earliest_top;
+  }
+
+  // The earliest task is due too, as it is scheduled before the
+  // user-interaction task. Let it run if user-interaction tasks have kept it
+  // waiting, unless the user-interaction task can still make its deadline.
+  const bool can_meet_deadline =
+      user_interaction_top.GetDeadline() != fml::TimePoint::Max() &&
+      now <= user_interaction_top.GetDeadline();
+  if (consecutive_user_interaction_tasks_ >=
+          kMaxConsecutiveUserInteractionTasks &&
+      !can_meet_deadline) {
+    return earliest_top;
+  }
+  return {
+      .task_queue_id = task_queue_id_,
+      .task = user_interaction_top,
+  };
+}
+
+TaskSource::TopTask TaskSource::EarliestTop() const {
+  const DelayedTask* top = nullptr;
+  auto update_top = [&top](const DelayedTaskQueue& queue) {
+    if (!queue.empty() && (top == nullptr || *top > queue.top())) {
+      top = &queue.top();
     }
+  };
+  update_top(user_interaction_task_queue_);
+  update_top(primary_task_queue_);
+  if (secondary_pause_requests_ == 0) {
+    update_top(secondary_task_queue_);
   }
+  FML_CHECK(top);
+  return {
+      .task_queue_id = task_queue_id_,
+      .task = *top,
+  };
 }
 
 void TaskSource::PauseSecondary() {
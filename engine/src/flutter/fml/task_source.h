@@ -31,6 +31,12 @@ class MessageLoopTaskQueues;
  * Task dispatcher provides the event loop a way to acquire tasks to run via
  * `GetNextTaskToRun`. Task dispatcher asks the underlying `TaskSource` for the
  * next task.
+ *
+ * Tasks run in the order of their scheduled time, except that due tasks of
+ * `TaskSourceGrade::kUserInteraction` run before the other due tasks. So that
+ * a stream of them does not starve the other tasks, one of those runs after
+ * `kMaxConsecutiveUserInteractionTasks` in a row, unless the next
+ * user-interaction task can still meet its deadline.
  */
 class TaskSource {
  public:
@@ -39,6 +45,10 @@ class TaskSource {
     const DelayedTask& task;
   };
 
+  /// The number of user-interaction tasks that may run in a row while other
+  /// tasks are due.
+  static constexpr int kMaxConsecutiveUserInteractionTasks = 4;
+
   /// Construts a TaskSource with the given `task_queue_id`.
   explicit TaskSource(TaskQueueId task_queue_id);
 
@@ -62,8 +72,10 @@ class TaskSource {
   bool IsEmpty() const;
 
   /// Returns the top task based on scheduled time, taking into account whether
-  /// the secondary heap has been paused or not.
-  TopTask Top() const;
+  /// the secondary heap has been paused or not. If a user-interaction task is
+  /// due at `now`, it is returned instead of the other due tasks, as allowed by
+  /// the starvation protection.
+  TopTask Top(fml::TimePoint now = fml::TimePoint::Min()) const;
 
   /// Pause providing tasks from secondary task heap.
   void PauseSecondary();
@@ -73,9 +85,13 @@ class TaskSource {
 
  private:
   const fml::TaskQueueId task_queue_id_;
+  fml::DelayedTaskQueue user_interaction_task_queue_;
   fml::DelayedTaskQueue primary_task_queue_;
   fml::DelayedTaskQueue secondary_task_queue_;
   int secondary_pause_requests_ = 0;
+  int consecutive_user_interaction_tasks_ = 0;
+
+  TopTask EarliestTop() const;
 
   FML_DISALLOW_COPY_ASSIGN_AND_MOVE(TaskSource);
 };
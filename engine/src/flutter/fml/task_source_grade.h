@@ -14,7 +14,8 @@ namespace fml {
  */
 enum class TaskSourceGrade {
   /// This `TaskSourceGrade` indicates that a task is critical to user
-  /// interaction.
+  /// interaction, such as producing the next frame. Once due, these tasks run
+  /// before the due tasks of other grades.
   kUserInteraction,
   /// This `TaskSourceGrade` indicates that a task corresponds to servicing a
   /// dart event loop task. These aren't critical to user interaction.
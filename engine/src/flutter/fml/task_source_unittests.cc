@@ -4,6 +4,7 @@
 
 #include <atomic>
 #include <thread>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "flutter/fml/task_source.h"
@@ -97,5 +98,89 @@ TEST(TaskSourceTests, OrderingMultiTaskHeapsSecondaryPaused) {
   ASSERT_EQ(value, 1);
 }
 
+TEST(TaskSourceTests, DueUserInteractionTaskRunsFirst) {
+  TaskSource task_source = TaskSource(TaskQueueId(1));
+  auto time_stamp = ChronoTicksSinceEpoch();
+  auto now = time_stamp + fml::TimeDelta::FromMilliseconds(1);
+  int value = 0;
+  task_source.RegisterTask(
+      {1, [&] { value = 1; }, time_stamp, TaskSourceGrade::kUnspecified});
+  task_source.RegisterTask(
+      {2, [&] { value = 7; }, now, TaskSourceGrade::kUserInteraction});
+
+  // The earliest task is the one to wake for.
+  ASSERT_EQ(task_source.Top().task.GetTargetTime(), time_stamp);
+
+  auto top_task = task_source.Top(now);
+  top_task.task.GetTask()();
+  task_source.PopTask(top_task.task.GetTaskSourceGrade());
+  ASSERT_EQ(value, 7);
+
+  auto second_task = task_source.Top(now);
+  second_task.task.GetTask()();
+  task_source.PopTask(second_task.task.GetTaskSourceGrade());
+  ASSERT_EQ(value, 1);
+}
+
+TEST(TaskSourceTests, FutureUserInteractionTaskDoesNotRunFirst) {
+  TaskSource task_source = TaskSource(TaskQueueId(1));
+  auto time_stamp = ChronoTicksSinceEpoch();
+  task_source.RegisterTask(
+      {1, [] {}, time_stamp, TaskSourceGrade::kUnspecified});
+  task_source.RegisterTask({2, [] {},
+                            time_stamp + fml::TimeDelta::FromMilliseconds(1),
+                            TaskSourceGrade::kUserInteraction});
+  ASSERT_EQ(task_source.Top(time_stamp).task.GetTaskSourceGrade(),
+            TaskSourceGrade::kUnspecified);
+}
+
+TEST(TaskSourceTests, UserInteractionTasksDoNotStarveOtherTasks) {
+  TaskSource task_source = TaskSource(TaskQueueId(1));
+  auto time_stamp = ChronoTicksSinceEpoch();
+  auto now = time_stamp + fml::TimeDelta::FromMilliseconds(1);
+  task_source.RegisterTask(
+      {0, [] {}, time_stamp, TaskSourceGrade::kUnspecified});
+  for (size_t i = 1; i <= 10; i++) {
+    task_source.RegisterTask(
+        {i, [] {}, time_stamp, TaskSourceGrade::kUserInteraction});
+  }
+
+  std::vector<TaskSourceGrade> grades;
+  for (int i = 0; i <= TaskSource::kMaxConsecutiveUserInteractionTasks; i++) {
+    auto top_task = task_source.Top(now);
+    grades.push_back(top_task.task.GetTaskSourceGrade());
+    task_source.PopTask(top_task.task.GetTaskSourceGrade());
+  }
+  std::vector<TaskSourceGrade> expected(
+      TaskSource::kMaxConsecutiveUserInteractionTasks,
+      TaskSourceGrade::kUserInteraction);
+  expected.push_back(TaskSourceGrade::kUnspecified);
+  ASSERT_EQ(grades, expected);
+}
+
+TEST(TaskSourceTests, UserInteractionTaskThatCanMeetDeadlineKeepsPriority) {
+  TaskSource task_source = TaskSource(TaskQueueId(1));
+  auto time_stamp = ChronoTicksSinceEpoch();
+  auto now = time_stamp + fml::TimeDelta::FromMilliseconds(1);
+  auto deadline = now + fml::TimeDelta::FromMilliseconds(16);
+  task_source.RegisterTask(
+      {0, [] {}, time_stamp, TaskSourceGrade::kUnspecified});
+  for (size_t i = 1; i <= 10; i++) {
+    task_source.RegisterTask({i, [] {}, time_stamp,
+                              TaskSourceGrade::kUserInteraction, deadline});
+  }
+  for (int i = 0; i <= TaskSource::kMaxConsecutiveUserInteractionTasks; i++) {
+    auto top_task = task_source.Top(now);
+    ASSERT_EQ(top_task.task.GetTaskSourceGrade(),
+              TaskSourceGrade::kUserInteraction);
+    task_source.PopTask(top_task.task.GetTaskSourceGrade());
+  }
+
+  // Once the deadline has passed, the other task gets its turn.
+  ASSERT_EQ(task_source.Top(deadline + fml::TimeDelta::FromMilliseconds(1))
+                .task.GetTaskSourceGrade(),
+            TaskSourceGrade::kUnspecified);
+}
+
 }  // namespace testing
 }  // namespace fml
@@ -0,0 +1,139 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/trace_recorder.h"
+
+#include <sstream>
+
+#include "flutter/fml/logging.h"
+
+namespace fml {
+namespace tracing {
+
+namespace {
+
+std::atomic<int64_t> gNextThreadId = 1;
+
+int64_t CurrentThreadId() {
+  thread_local int64_t thread_id = gNextThreadId.fetch_add(1);
+  return thread_id;
+}
+
+void WriteJsonString(std::ostringstream& stream, const char* string) {
+  stream << '"';
+  for (const char* c = string; *c != '\0'; c++) {
+    if (*c == '"' || *c == '\\') {
+      stream << '\\';
+    }
+    stream << *c;
+  }
+  stream << '"';
+}
+
+}  // namespace
+
+TraceRecorder& TraceRecorder::GetInstance() {
+  static TraceRecorder* recorder = new TraceRecorder();
+  return *recorder;
+}
+
+TraceRecorder::TraceRecorder(size_t capacity)
+    : capacity_(capacity), slots_(std::make_unique<Slot[]>(capacity)) {
+  FML_DCHECK(capacity_ > 0);
+}
+
+TraceRecorder::~TraceRecorder() = default;
+
+void TraceRecorder::SetEnabled(bool enabled) {
+  enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+bool TraceRecorder::IsEnabled() const {
+  return enabled_.load(std::memory_order_relaxed);
+}
+
+void TraceRecorder::Record(const char* name,
+                           fml::TimePoint start,
+                           fml::TimePoint end) {
+  if (!IsEnabled()) {
+    return;
+  }
+  const uint64_t index = next_index_.fetch_add(1, std::memory_order_relaxed);
+  Slot& slot = slots_[index % capacity_];
+  slot.sequence.store(index * 2 + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.name.store(name, std::memory_order_relaxed);
+  slot.thread_id.store(CurrentThreadId(), std::memory_order_relaxed);
+  slot.start_micros.store(start.ToEpochDelta().ToMicroseconds(),
+                          std::memory_order_relaxed);
+  slot.duration_micros.store((end - start).ToMicroseconds(),
+                             std::memory_order_relaxed);
+  slot.sequence.store(index * 2 + 2, std::memory_order_release);
+}
+
+std::vector<TraceRecorder::Event> TraceRecorder::GetEvents() const {
+  const uint64_t end = next_index_.load(std::memory_order_acquire);
+  const uint64_t begin = end > capacity_ ? end - capacity_ : 0;
+  std::vector<Event> events;
+  events.reserve(end - begin);
+  for (uint64_t index = begin; index < end; index++) {
+    const Slot& slot = slots_[index % capacity_];
+    if (slot.sequence.load(std::memory_order_acquire) != index * 2 + 2) {
+      // Not written yet, being written, or overwritten since.
+      continue;
+    }
+    const int64_t start_micros =
+        slot.start_micros.load(std::memory_order_relaxed);
+    Event event = {
+        .name = slot.name.load(std::memory_order_relaxed),
+        .thread_id = slot.thread_id.load(std::memory_order_relaxed),
+        .start = fml::TimePoint::FromEpochDelta(
+            fml::TimeDelta::FromMicroseconds(start_micros)),
+        .duration = fml::TimeDelta::FromMicroseconds(
+            slot.duration_micros.load(std::memory_order_relaxed)),
+    };
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.sequence.load(std::memory_order_relaxed) != index * 2 + 2) {
+      continue;
+    }
+    events.push_back(event);
+  }
+  return events;
+}
+
+std::string TraceRecorder::ToJson() const {
+  std::ostringstream stream;
+  stream << "{\"traceEvents\":[";
+  bool first = true;
+  for (const Event& event : GetEvents()) {
+    if (!first) {
+      stream << ',';
+    }
+    first = false;
+    stream << "{\"name\":";
+    WriteJsonString(stream, event.name);
+    stream << ",\"cat\":\"flutter\",\"ph\":\"X\",\"pid\":0"
+           << ",\"tid\":" << event.thread_id
+           << ",\"ts\":" << event.start.ToEpochDelta().ToMicroseconds()
+           << ",\"dur\":" << event.duration.ToMicroseconds() << '}';
+  }
+  stream << "],\"displayTimeUnit\":\"ms\"}";
+  return stream.str();
+}
+
+ScopedRecordedEvent::ScopedRecordedEvent(const char* name) : name_(name) {
+  if (TraceRecorder::GetInstance().IsEnabled()) {
+    start_ = fml::TimePoint::Now();
+  }
+}
+
+ScopedRecordedEvent::~ScopedRecordedEvent() {
+  TraceRecorder& recorder = TraceRecorder::GetInstance();
+  if (recorder.IsEnabled() && start_ != fml::TimePoint()) {
+    recorder.Record(name_, start_, fml::TimePoint::Now());
+  }
+}
+
+}  // namespace tracing
+}  // namespace fml
@@ -0,0 +1,121 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_TRACE_RECORDER_H_
+#define FLUTTER_FML_TRACE_RECORDER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+#include "flutter/fml/trace_event.h"
+
+namespace fml {
+namespace tracing {
+
+//------------------------------------------------------------------------------
+/// Records a curated set of trace events into a fixed-size ring buffer, in all
+/// runtime modes, so that traces of jank can be collected from release builds
+/// where the timeline is disabled.
+///
+/// Recording does not allocate or lock. It costs two timestamps and a few
+/// atomic stores per event, so that it can stay enabled for hot-path events
+/// such as frame phases, pipeline compiles, glyph atlas updates and image
+/// decodes. Once the buffer is full, the oldest events are overwritten.
+///
+/// The events are exported in the JSON trace event format, which Perfetto and
+/// chrome://tracing open.
+///
+class TraceRecorder {
+ public:
+  static constexpr size_t kDefaultCapacity = 4096;
+
+  struct Event {
+    /// A static string.
+    const char* name;
+    /// Identifies the thread the event was recorded on, in the order the
+    /// threads first recorded an event.
+    int64_t thread_id;
+    fml::TimePoint start;
+    fml::TimeDelta duration;
+  };
+
+  /// The recorder shared by the process, which the
+  /// `FML_RECORDED_TRACE_EVENT0` events are recorded into.
+  static TraceRecorder& GetInstance();
+
+  explicit TraceRecorder(size_t capacity = kDefaultCapacity);
+
+  ~TraceRecorder();
+
+  void SetEnabled(bool enabled);
+
+  bool IsEnabled() const;
+
+  /// Records the event |name|, a static string, from |start| to |end| on the
+  /// current thread. This is thread-safe.
+  void Record(const char* name, fml::TimePoint start, fml::TimePoint end);
+
+  /// The recorded events, oldest first. Events that are being overwritten
+  /// while this is called are skipped.
+  std::vector<Event> GetEvents() const;
+
+  /// The recorded events in the JSON trace event format.
+  std::string ToJson() const;
+
+ private:
+  // A slot is written under a sequence lock, so that readers can tell when
+  // they raced with a writer. The sequence is odd while the slot is written.
+  struct Slot {
+    std::atomic<uint64_t> sequence = 0;
+    std::atomic<const char*> name = nullptr;
+    std::atomic<int64_t> thread_id = 0;
+    std::atomic<int64_t> start_micros = 0;
+    std::atomic<int64_t> duration_micros = 0;
+  };
+
+  const size_t capacity_;
+  std::unique_ptr<Slot[]> slots_;
+  std::atomic<uint64_t> next_index_ = 0;
+  std::atomic<bool> enabled_ = true;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(TraceRecorder);
+};
+
+/// Records the scope it lives in into the process-wide `TraceRecorder`.
+class ScopedRecordedEvent {
+ public:
+  explicit ScopedRecordedEvent(const char* name);
+
+  ~ScopedRecordedEvent();
+
+ private:
+  const char* name_;
+  fml::TimePoint start_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ScopedRecordedEvent);
+};
+
+}  // namespace tracing
+}  // namespace fml
+
+#define __FML__RECORDED_TOKEN_CAT__(x, y) x##y
+#define __FML__RECORDED_TOKEN_CAT__2(x, y) __FML__RECORDED_TOKEN_CAT__(x, y)
+
+// Like `TRACE_EVENT0`, except that the event is also recorded into the
+// process-wide `fml::tracing::TraceRecorder`, in all runtime modes. The
+// |name| must be a static string. Reserve this for the events that explain
+// jank, as each one displaces older events from the recorder.
+#define FML_RECORDED_TRACE_EVENT0(category_group, name)              \
+  TRACE_EVENT0(category_group, name);                                \
+  ::fml::tracing::ScopedRecordedEvent __FML__RECORDED_TOKEN_CAT__2(  \
+      __recorded_event_, __LINE__)(name);
+
+#endif  // FLUTTER_FML_TRACE_RECORDER_H_
@@ -0,0 +1,97 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/trace_recorder.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace tracing {
+namespace testing {
+
+TEST(TraceRecorderTest, RecordsEventsInOrder) {
+  TraceRecorder recorder(4);
+  fml::TimePoint start = fml::TimePoint::Now();
+  recorder.Record("A", start, start + fml::TimeDelta::FromMilliseconds(1));
+  recorder.Record("B", start, start + fml::TimeDelta::FromMilliseconds(2));
+
+  auto events = recorder.GetEvents();
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(std::string(events[0].name), "A");
+  EXPECT_EQ(events[0].duration, fml::TimeDelta::FromMilliseconds(1));
+  EXPECT_EQ(std::string(events[1].name), "B");
+  EXPECT_EQ(events[1].duration, fml::TimeDelta::FromMilliseconds(2));
+  EXPECT_EQ(events[0].thread_id, events[1].thread_id);
+}
+
+TEST(TraceRecorderTest, OverwritesOldestEvents) {
+  TraceRecorder recorder(2);
+  fml::TimePoint start = fml::TimePoint::Now();
+  recorder.Record("A", start, start);
+  recorder.Record("B", start, start);
+  recorder.Record("C", start, start);
+
+  auto events = recorder.GetEvents();
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(std::string(events[0].name), "B");
+  EXPECT_EQ(std::string(events[1].name), "C");
+}
+
+TEST(TraceRecorderTest, DoesNotRecordWhenDisabled) {
+  TraceRecorder recorder(2);
+  recorder.SetEnabled(false);
+  fml::TimePoint start = fml::TimePoint::Now();
+  recorder.Record("A", start, start);
+  EXPECT_TRUE(recorder.GetEvents().empty());
+}
+
+TEST(TraceRecorderTest, ExportsJsonTraceEvents) {
+  TraceRecorder recorder(2);
+  fml::TimePoint start =
+      fml::TimePoint::FromEpochDelta(fml::TimeDelta::FromMicroseconds(10));
+  recorder.Record("A", start, start + fml::TimeDelta::FromMicroseconds(5));
+
+  std::string json = recorder.ToJson();
+  EXPECT_NE(json.find("\"traceEvents\":[{\"name\":\"A\""), std::string::npos);
+  EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+  EXPECT_NE(json.find("\"ts\":10,\"dur\":5}"), std::string::npos);
+}
+
+TEST(TraceRecorderTest, RecordsFromThreadsWhileRead) {
+  TraceRecorder recorder(16);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([&recorder] {
+      for (int j = 0; j < 1000; j++) {
+        fml::TimePoint start = fml::TimePoint::Now();
+        recorder.Record("Event", start, start);
+      }
+    });
+  }
+  for (int i = 0; i < 100; i++) {
+    for (const auto& event : recorder.GetEvents()) {
+      EXPECT_EQ(std::string(event.name), "Event");
+    }
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(recorder.GetEvents().size(), 16u);
+}
+
+TEST(TraceRecorderTest, RecordsScopedEventsIntoTheProcessRecorder) {
+  size_t count = TraceRecorder::GetInstance().GetEvents().size();
+  { FML_RECORDED_TRACE_EVENT0("flutter", "TraceRecorderTest::Scope"); }
+  auto events = TraceRecorder::GetInstance().GetEvents();
+  ASSERT_GT(events.size(), count);
+  EXPECT_EQ(std::string(events.back().name), "TraceRecorderTest::Scope");
+}
+
+}  // namespace testing
+}  // namespace tracing
+}  // namespace fml
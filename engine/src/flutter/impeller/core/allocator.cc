@@ -66,6 +66,24 @@ std::shared_ptr<Texture> Allocator::CreateTexture(const TextureDescriptor& desc,
   return OnCreateTexture(desc, threadsafe);
 }
 
+std::optional<HostMappedTexture> Allocator::CreateHostMappedTexture(
+    const TextureDescriptor& desc) {
+  if (desc.type != TextureType::kTexture2D || desc.mip_count != 1u ||
+      desc.sample_count != SampleCount::kCount1 || desc.size.IsEmpty()) {
+    return std::nullopt;
+  }
+  const auto max_size = GetMaxTextureSizeSupported();
+  if (desc.size.width > max_size.width || desc.size.height > max_size.height) {
+    return std::nullopt;
+  }
+  return OnCreateHostMappedTexture(desc);
+}
+
+std::optional<HostMappedTexture> Allocator::OnCreateHostMappedTexture(
+    const TextureDescriptor& desc) {
+  return std::nullopt;
+}
+
 uint16_t Allocator::MinimumBytesPerRow(PixelFormat format) const {
   return BytesPerPixelForPixelFormat(format);
 }
@@ -5,6 +5,9 @@
 #ifndef FLUTTER_IMPELLER_CORE_ALLOCATOR_H_
 #define FLUTTER_IMPELLER_CORE_ALLOCATOR_H_
 
+#include <functional>
+#include <optional>
+
 #include "flutter/fml/mapping.h"
 #include "impeller/base/allocation_size.h"
 #include "impeller/core/device_buffer_descriptor.h"
@@ -18,6 +21,26 @@ namespace impeller {
 class Context;
 class DeviceBuffer;
 
+//------------------------------------------------------------------------------
+/// @brief      A texture whose only mip level is mapped into host memory so
+///             that it can be filled in place, without a staging buffer or a
+///             blit.
+///
+///             The host may write |bytes_per_row| * height bytes starting at
+///             |contents|. |unmap| must be invoked exactly once after all
+///             writes are done and before the texture is handed to the GPU.
+///             It returns false if the texture cannot be used. Unmapping
+///             records no GPU work: on Vulkan the texture must still be moved
+///             to a shader readable layout, see
+///             |BlitPass::ConvertTextureToShaderRead|.
+///
+struct HostMappedTexture {
+  std::shared_ptr<Texture> texture;
+  uint8_t* contents = nullptr;
+  size_t bytes_per_row = 0u;
+  std::function<bool()> unmap;
+};
+
 //------------------------------------------------------------------------------
 /// @brief      An object that allocates device memory.
 ///
@@ -48,6 +71,20 @@ class Allocator {
   std::shared_ptr<Texture> CreateTexture(const TextureDescriptor& desc,
                                          bool threadsafe = false);
 
+  //------------------------------------------------------------------------------
+  /// @brief      Creates a sampleable texture that the host can write into
+  ///             directly.
+  ///
+  ///             Backends that cannot share memory between the host and the
+  ///             GPU without a copy return std::nullopt, and callers should
+  ///             fall back to uploading a host buffer.
+  ///
+  /// @param[in]  desc  The descriptor of the texture to create. Only single
+  ///                   mip level 2D textures are supported.
+  ///
+  std::optional<HostMappedTexture> CreateHostMappedTexture(
+      const TextureDescriptor& desc);
+
   //------------------------------------------------------------------------------
   /// @brief      Minimum value for `row_bytes` on a Texture. The row
   ///             bytes parameter of that method must be aligned to this value.
@@ -71,6 +108,16 @@ class Allocator {
   // Visible for testing.
   virtual Bytes DebugGetHeapUsage() const { return Bytes{0}; }
 
+  /// @brief The device memory currently allocated for the buffers and
+  ///        textures of the context, or std::nullopt if the backend can't
+  ///        tell outside of debug builds.
+  ///
+  ///        Unlike |DebugGetHeapUsage|, this is meant to be cheap enough to
+  ///        be queried after every frame in release builds.
+  virtual std::optional<Bytes> GetAllocatedBytes() const {
+    return std::nullopt;
+  }
+
  protected:
   Allocator();
 
@@ -81,6 +128,9 @@ class Allocator {
       const TextureDescriptor& desc,
       bool threadsafe = false) = 0;
 
+  virtual std::optional<HostMappedTexture> OnCreateHostMappedTexture(
+      const TextureDescriptor& desc);
+
  private:
   Allocator(const Allocator&) = delete;
 
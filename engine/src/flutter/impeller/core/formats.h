@@ -115,8 +115,31 @@ enum class PixelFormat : uint8_t {
   kS8UInt,
   kD24UnormS8Uint,
   kD32FloatS8UInt,
+  // Block compressed formats, which store blocks of 4x4 texels in 16 bytes.
+  // They can be sampled from, but not rendered to.
+  kETC2R8G8B8A8UNormInt,
+  kASTC4x4UNormInt,
+  kBC7UNormInt,
 };
 
+/// The width and height in texels of the blocks of the block compressed
+/// formats.
+constexpr int64_t kCompressedBlockSize = 4;
+
+/// The bytes of a block of the block compressed formats.
+constexpr size_t kCompressedBlockBytes = 16;
+
+constexpr bool IsBlockCompressed(PixelFormat format) {
+  switch (format) {
+    case PixelFormat::kETC2R8G8B8A8UNormInt:
+    case PixelFormat::kASTC4x4UNormInt:
+    case PixelFormat::kBC7UNormInt:
+      return true;
+    default:
+      return false;
+  }
+}
+
 constexpr bool IsDepthWritable(PixelFormat format) {
   switch (format) {
     case PixelFormat::kD24UnormS8Uint:
@@ -174,6 +197,12 @@ constexpr const char* PixelFormatToString(PixelFormat format) {
       return "D32FloatS8UInt";
     case PixelFormat::kR32Float:
       return "R32Float";
+    case PixelFormat::kETC2R8G8B8A8UNormInt:
+      return "ETC2R8G8B8A8UNormInt";
+    case PixelFormat::kASTC4x4UNormInt:
+      return "ASTC4x4UNormInt";
+    case PixelFormat::kBC7UNormInt:
+      return "BC7UNormInt";
   }
   FML_UNREACHABLE();
 }
@@ -351,6 +380,28 @@ enum class IndexType : uint8_t {
   kNone,
 };
 
+/// The arguments of a single non-indexed draw read by the GPU from the
+/// indirect buffer given to `RenderPass::DrawIndirect`. The layout matches
+/// `VkDrawIndirectCommand` and `MTLDrawPrimitivesIndirectArguments`.
+struct DrawIndirectArguments {
+  uint32_t vertex_count = 0u;
+  uint32_t instance_count = 0u;
+  uint32_t first_vertex = 0u;
+  uint32_t first_instance = 0u;
+};
+
+/// The arguments of a single indexed draw read by the GPU from the indirect
+/// buffer given to `RenderPass::DrawIndirect`. The layout matches
+/// `VkDrawIndexedIndirectCommand` and
+/// `MTLDrawIndexedPrimitivesIndirectArguments`.
+struct DrawIndexedIndirectArguments {
+  uint32_t index_count = 0u;
+  uint32_t instance_count = 0u;
+  uint32_t first_index = 0u;
+  int32_t base_vertex = 0;
+  uint32_t first_instance = 0u;
+};
+
 /// Decides how backend draws pixels based on input vertices.
 enum class PrimitiveType : uint8_t {
   /// Draws a triangle for each separate set of three vertices.
@@ -493,10 +544,35 @@ constexpr size_t BytesPerPixelForPixelFormat(PixelFormat format) {
       return 8u;
     case PixelFormat::kR32G32B32A32Float:
       return 16u;
+    // A block of 16 texels takes 16 bytes. Use |BytesForPixelFormat| for the
+    // sizes of regions that are not made of whole blocks.
+    case PixelFormat::kETC2R8G8B8A8UNormInt:
+    case PixelFormat::kASTC4x4UNormInt:
+    case PixelFormat::kBC7UNormInt:
+      return 1u;
   }
   return 0u;
 }
 
+/// The bytes of a row of `width` texels, or of the row of blocks that covers
+/// them for the block compressed formats.
+constexpr size_t BytesPerRowForPixelFormat(PixelFormat format, int64_t width) {
+  if (IsBlockCompressed(format)) {
+    return (width + kCompressedBlockSize - 1) / kCompressedBlockSize *
+           kCompressedBlockBytes;
+  }
+  return width * BytesPerPixelForPixelFormat(format);
+}
+
+/// The bytes of a tightly packed region of `size` texels.
+constexpr size_t BytesForPixelFormat(PixelFormat format, ISize size) {
+  if (IsBlockCompressed(format)) {
+    return BytesPerRowForPixelFormat(format, size.width) *
+           ((size.height + kCompressedBlockSize - 1) / kCompressedBlockSize);
+  }
+  return size.Area() * BytesPerPixelForPixelFormat(format);
+}
+
 //------------------------------------------------------------------------------
 /// @brief      Describe the color attachment that will be used with this
 ///             pipeline.
@@ -7,6 +7,7 @@
 #include <cstring>
 #include <tuple>
 
+#include "flutter/fml/trace_event.h"
 #include "impeller/base/validation.h"
 #include "impeller/core/allocator.h"
 #include "impeller/core/buffer_view.h"
@@ -21,21 +22,26 @@ constexpr size_t kAllocatorBlockSize = 1024000;  // 1024 Kb.
 std::shared_ptr<HostBuffer> HostBuffer::Create(
     const std::shared_ptr<Allocator>& allocator,
     const std::shared_ptr<const IdleWaiter>& idle_waiter,
-    size_t minimum_uniform_alignment) {
-  return std::shared_ptr<HostBuffer>(
-      new HostBuffer(allocator, idle_waiter, minimum_uniform_alignment));
+    size_t minimum_uniform_alignment,
+    size_t frame_count) {
+  return std::shared_ptr<HostBuffer>(new HostBuffer(
+      allocator, idle_waiter, minimum_uniform_alignment, frame_count));
 }
 
 HostBuffer::HostBuffer(const std::shared_ptr<Allocator>& allocator,
                        const std::shared_ptr<const IdleWaiter>& idle_waiter,
-                       size_t minimum_uniform_alignment)
+                       size_t minimum_uniform_alignment,
+                       size_t frame_count)
     : allocator_(allocator),
       idle_waiter_(idle_waiter),
+      device_buffers_(std::max(frame_count, static_cast<size_t>(1u))),
+      frame_used_bytes_(device_buffers_.size(), 0u),
+      frame_block_bytes_(device_buffers_.size(), 0u),
       minimum_uniform_alignment_(minimum_uniform_alignment) {
   DeviceBufferDescriptor desc;
   desc.size = kAllocatorBlockSize;
   desc.storage_mode = StorageMode::kHostVisible;
-  for (auto i = 0u; i < kHostBufferArenaSize; i++) {
+  for (auto i = 0u; i < device_buffers_.size(); i++) {
     std::shared_ptr<DeviceBuffer> device_buffer = allocator->CreateBuffer(desc);
     FML_CHECK(device_buffer) << "Failed to allocate device buffer.";
     device_buffers_[i].push_back(device_buffer);
@@ -64,6 +70,31 @@ BufferView HostBuffer::Emplace(const void* buffer,
   }
 }
 
+BufferView HostBuffer::EmplaceUniformBytes(const void* buffer,
+                                           size_t length,
+                                           size_t align) {
+  if (length > kMaxReusedUniformSize) {
+    return Emplace(buffer, length, align);
+  }
+  for (const RecentUniform& recent : recent_uniforms_) {
+    if (recent.length == length && recent.view &&
+        (align == 0 || recent.view.GetRange().offset % align == 0) &&
+        ::memcmp(recent.bytes.data(), buffer, length) == 0) {
+      reused_uniform_count_++;
+      return recent.view;
+    }
+  }
+  BufferView view = Emplace(buffer, length, align);
+  if (view) {
+    RecentUniform& recent = recent_uniforms_[next_recent_uniform_];
+    recent.view = view;
+    recent.length = length;
+    ::memcpy(recent.bytes.data(), buffer, length);
+    next_recent_uniform_ = (next_recent_uniform_ + 1) % kReusedUniformCount;
+  }
+  return view;
+}
+
 BufferView HostBuffer::Emplace(const void* buffer, size_t length) {
   auto [range, device_buffer, raw_device_buffer] =
       EmplaceInternal(buffer, length);
@@ -95,9 +126,29 @@ HostBuffer::TestStateQuery HostBuffer::GetStateForTest() {
       .current_frame = frame_index_,
       .current_buffer = current_buffer_,
       .total_buffer_count = device_buffers_[frame_index_].size(),
+      .used_bytes = GetUsedBytes(),
+      .peak_used_bytes = *std::max_element(frame_used_bytes_.begin(),
+                                           frame_used_bytes_.end()),
+      .reused_uniform_count = reused_uniform_count_,
   };
 }
 
+size_t HostBuffer::GetUsedBytes() const {
+  return current_buffer_ * kAllocatorBlockSize + offset_ + one_off_bytes_;
+}
+
+size_t HostBuffer::GetPeakBlockCount() const {
+  size_t peak_blocks = 1u;
+  // One-off allocations have buffers of their own that are not retained, so
+  // only the bytes served from blocks count.
+  for (size_t block_bytes : frame_block_bytes_) {
+    peak_blocks = std::max(
+        peak_blocks,
+        (block_bytes + kAllocatorBlockSize - 1) / kAllocatorBlockSize);
+  }
+  return peak_blocks;
+}
+
 bool HostBuffer::MaybeCreateNewBuffer() {
   current_buffer_++;
   if (current_buffer_ >= device_buffers_[frame_index_].size()) {
@@ -138,6 +189,7 @@ HostBuffer::EmplaceInternal(size_t length,
       cb(device_buffer->OnGetContents());
       device_buffer->Flush(Range{0, length});
     }
+    one_off_bytes_ += length;
     return std::make_tuple(Range{0, length}, std::move(device_buffer), nullptr);
   }
 
@@ -182,6 +234,7 @@ HostBuffer::EmplaceInternal(const void* buffer, size_t length) {
         return {};
       }
     }
+    one_off_bytes_ += length;
     return std::make_tuple(Range{0, length}, std::move(device_buffer), nullptr);
   }
 
@@ -227,15 +280,53 @@ const std::shared_ptr<DeviceBuffer>& HostBuffer::GetCurrentBuffer() const {
 }
 
 void HostBuffer::Reset() {
+  const size_t used_bytes = GetUsedBytes();
+  frame_used_bytes_[frame_index_] = used_bytes;
+  frame_block_bytes_[frame_index_] =
+      current_buffer_ * kAllocatorBlockSize + offset_;
+  const size_t peak_blocks = GetPeakBlockCount();
+
+  FML_TRACE_COUNTER("flutter", "HostBuffer",
+                    reinterpret_cast<int64_t>(this),  // Trace Counter ID
+                    "UsedBytes", used_bytes,          //
+                    "Blocks", current_buffer_ + 1,    //
+                    "PeakBlocks", peak_blocks,        //
+                    "ReusedUniforms", reused_uniform_count_);
+
   // When resetting the host buffer state at the end of the frame, check if
-  // there are any unused buffers and remove them.
-  while (device_buffers_[frame_index_].size() > current_buffer_ + 1) {
+  // there are any buffers that neither this frame nor the recent frames in
+  // the ring needed and remove them.
+  const size_t retained_blocks = std::max(current_buffer_ + 1, peak_blocks);
+  while (device_buffers_[frame_index_].size() > retained_blocks) {
     device_buffers_[frame_index_].pop_back();
   }
 
   offset_ = 0u;
   current_buffer_ = 0u;
-  frame_index_ = (frame_index_ + 1) % kHostBufferArenaSize;
+  one_off_bytes_ = 0u;
+  // Views into this frame's blocks must not be handed out to the next one.
+  recent_uniforms_ = {};
+  next_recent_uniform_ = 0u;
+  reused_uniform_count_ = 0u;
+  frame_index_ = (frame_index_ + 1) % device_buffers_.size();
+
+  // Pre-size the next frame for the recent peak usage so that it does not
+  // have to allocate blocks while it is being recorded.
+  std::vector<std::shared_ptr<DeviceBuffer>>& next =
+      device_buffers_[frame_index_];
+  if (next.size() < peak_blocks) {
+    DeviceBufferDescriptor desc;
+    desc.size = kAllocatorBlockSize;
+    desc.storage_mode = StorageMode::kHostVisible;
+    while (next.size() < peak_blocks) {
+      std::shared_ptr<DeviceBuffer> buffer = allocator_->CreateBuffer(desc);
+      if (!buffer) {
+        // Not fatal, the frame will retry the allocation if it needs it.
+        break;
+      }
+      next.push_back(std::move(buffer));
+    }
+  }
 }
 
 size_t HostBuffer::GetMinimumUniformAlignment() const {
@@ -10,6 +10,7 @@
 #include <functional>
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 #include "impeller/core/allocator.h"
 #include "impeller/core/buffer_view.h"
@@ -22,13 +23,19 @@ static const constexpr size_t kHostBufferArenaSize = 4u;
 /// The host buffer class manages one more 1024 Kb blocks of device buffer
 /// allocations.
 ///
-/// These are reset per-frame.
+/// These are reset per-frame. Each frame in the ring of |frame_count| frames
+/// owns its own set of blocks so that a frame may be recorded while the
+/// previous frames are still in flight. The number of blocks retained for a
+/// frame is sized from the peak usage of the most recent frames in the ring,
+/// so that a frame that goes over a single block does not allocate mid-frame
+/// on every subsequent frame.
 class HostBuffer {
  public:
   static std::shared_ptr<HostBuffer> Create(
       const std::shared_ptr<Allocator>& allocator,
       const std::shared_ptr<const IdleWaiter>& idle_waiter,
-      size_t minimum_uniform_alignment);
+      size_t minimum_uniform_alignment,
+      size_t frame_count = kHostBufferArenaSize);
 
   ~HostBuffer();
 
@@ -36,6 +43,12 @@ class HostBuffer {
   /// @brief      Emplace uniform data onto the host buffer. Ensure that backend
   ///             specific uniform alignment requirements are respected.
   ///
+  ///             Uniform blocks that are byte for byte identical to one of the
+  ///             last few blocks emplaced this frame are not written again,
+  ///             the earlier view is returned instead. Draws that share a
+  ///             material, such as runs of solid color fills, then upload only
+  ///             the data that changes between them.
+  ///
   /// @param[in]  uniform     The uniform struct to emplace onto the buffer.
   ///
   /// @tparam     UniformType The type of the uniform struct.
@@ -47,9 +60,9 @@ class HostBuffer {
   [[nodiscard]] BufferView EmplaceUniform(const UniformType& uniform) {
     const auto alignment =
         std::max(alignof(UniformType), GetMinimumUniformAlignment());
-    return Emplace(reinterpret_cast<const void*>(&uniform),  // buffer
-                   sizeof(UniformType),                      // size
-                   alignment                                 // alignment
+    return EmplaceUniformBytes(reinterpret_cast<const void*>(&uniform),  //
+                               sizeof(UniformType),                      //
+                               alignment                                 //
     );
   }
 
@@ -130,12 +143,37 @@ class HostBuffer {
     size_t current_frame;
     size_t current_buffer;
     size_t total_buffer_count;
+    /// The number of bytes used by the current frame so far, including
+    /// alignment padding and one-off allocations larger than a block.
+    size_t used_bytes;
+    /// The largest number of bytes used by any of the recent frames in the
+    /// ring, excluding the current frame.
+    size_t peak_used_bytes;
+    /// The number of uniform blocks this frame that reused an identical
+    /// block instead of being written again.
+    size_t reused_uniform_count;
   };
 
   /// @brief Retrieve internal buffer state for test expectations.
   TestStateQuery GetStateForTest();
 
  private:
+  /// Uniform blocks up to this size are remembered for reuse.
+  static constexpr size_t kMaxReusedUniformSize = 256u;
+  /// The number of recent uniform blocks that are remembered. Draws usually
+  /// bind a vertex and a fragment block, so this covers a few of each.
+  static constexpr size_t kReusedUniformCount = 4u;
+
+  struct RecentUniform {
+    BufferView view;
+    size_t length = 0u;
+    std::array<uint8_t, kMaxReusedUniformSize> bytes;
+  };
+
+  [[nodiscard]] BufferView EmplaceUniformBytes(const void* buffer,
+                                               size_t length,
+                                               size_t align);
+
   [[nodiscard]] std::tuple<Range, std::shared_ptr<DeviceBuffer>, DeviceBuffer*>
   EmplaceInternal(const void* buffer, size_t length);
 
@@ -153,13 +191,20 @@ class HostBuffer {
   /// A false return value indicates an unrecoverable allocation failure.
   [[nodiscard]] bool MaybeCreateNewBuffer();
 
+  /// The bytes used by the current frame so far.
+  size_t GetUsedBytes() const;
+
+  /// The number of blocks needed to hold the peak usage of the recent frames.
+  size_t GetPeakBlockCount() const;
+
   const std::shared_ptr<DeviceBuffer>& GetCurrentBuffer() const;
 
   [[nodiscard]] BufferView Emplace(const void* buffer, size_t length);
 
   explicit HostBuffer(const std::shared_ptr<Allocator>& allocator,
                       const std::shared_ptr<const IdleWaiter>& idle_waiter,
-                      size_t minimum_uniform_alignment);
+                      size_t minimum_uniform_alignment,
+                      size_t frame_count);
 
   HostBuffer(const HostBuffer&) = delete;
 
@@ -167,12 +212,20 @@ class HostBuffer {
 
   std::shared_ptr<Allocator> allocator_;
   std::shared_ptr<const IdleWaiter> idle_waiter_;
-  std::array<std::vector<std::shared_ptr<DeviceBuffer>>, kHostBufferArenaSize>
-      device_buffers_;
+  std::vector<std::vector<std::shared_ptr<DeviceBuffer>>> device_buffers_;
+  /// The high water mark in bytes of each frame in the ring, recorded when
+  /// that frame is reset.
+  std::vector<size_t> frame_used_bytes_;
+  /// Like |frame_used_bytes_|, without the one-off allocations.
+  std::vector<size_t> frame_block_bytes_;
   size_t current_buffer_ = 0u;
   size_t offset_ = 0u;
   size_t frame_index_ = 0u;
+  size_t one_off_bytes_ = 0u;
   size_t minimum_uniform_alignment_ = 0u;
+  std::array<RecentUniform, kReusedUniformCount> recent_uniforms_;
+  size_t next_recent_uniform_ = 0u;
+  size_t reused_uniform_count_ = 0u;
 };
 
 }  // namespace impeller
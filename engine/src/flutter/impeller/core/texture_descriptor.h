@@ -49,7 +49,7 @@ struct TextureDescriptor {
     if (!IsValid()) {
       return 0u;
     }
-    return size.Area() * BytesPerPixelForPixelFormat(format);
+    return BytesForPixelFormat(format, size);
   }
 
   constexpr size_t GetByteSizeOfAllMipLevels() const {
@@ -60,8 +60,7 @@ struct TextureDescriptor {
     int64_t width = size.width;
     int64_t height = size.height;
     for (auto i = 0u; i < mip_count; i++) {
-      result +=
-          ISize(width, height).Area() * BytesPerPixelForPixelFormat(format);
+      result += BytesForPixelFormat(format, ISize(width, height));
       width /= 2;
       height /= 2;
     }
@@ -72,7 +71,7 @@ struct TextureDescriptor {
     if (!IsValid()) {
       return 0u;
     }
-    return size.width * BytesPerPixelForPixelFormat(format);
+    return BytesPerRowForPixelFormat(format, size.width);
   }
 
   constexpr bool SamplingOptionsAreValid() const {
@@ -29,6 +29,27 @@ AiksContext::AiksContext(
   is_valid_ = true;
 }
 
+AiksContext::AiksContext(
+    std::shared_ptr<Context> context,
+    const AiksContext& parent,
+    std::optional<std::shared_ptr<RenderTargetAllocator>>
+        render_target_allocator)
+    : context_(std::move(context)) {
+  if (!context_ || !context_->IsValid() || !parent.IsValid()) {
+    return;
+  }
+
+  content_context_ = std::make_unique<ContentContext>(
+      context_, parent.GetContentContext(),
+      render_target_allocator.has_value() ? render_target_allocator.value()
+                                          : nullptr);
+  if (!content_context_->IsValid()) {
+    return;
+  }
+
+  is_valid_ = true;
+}
+
 AiksContext::~AiksContext() = default;
 
 bool AiksContext::IsValid() const {
@@ -35,6 +35,19 @@ class AiksContext {
               std::optional<std::shared_ptr<RenderTargetAllocator>>
                   render_target_allocator = std::nullopt);
 
+  /// Construct a new AiksContext that shares the pipelines and the glyph atlas
+  /// of |parent|, for example for the surface of a spawned engine. The
+  /// transient buffers and the frame caches are not shared.
+  ///
+  /// @param context  The Impeller context that Aiks should use. It must be
+  ///                 |parent|'s context or share its pipeline library.
+  /// @param parent   The context to share resources with. Both contexts must
+  ///                 be used on the same thread.
+  AiksContext(std::shared_ptr<Context> context,
+              const AiksContext& parent,
+              std::optional<std::shared_ptr<RenderTargetAllocator>>
+                  render_target_allocator = std::nullopt);
+
   ~AiksContext();
 
   bool IsValid() const;
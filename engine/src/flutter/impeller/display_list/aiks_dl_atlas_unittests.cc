@@ -190,10 +190,9 @@ TEST_P(AiksTest, DlAtlasGeometryNoBlendRenamed) {
   EXPECT_FALSE(geom.ShouldSkip());
 
   ContentContext context(GetContext(), nullptr);
-  auto vertex_buffer =
-      geom.CreateSimpleVertexBuffer(context.GetTransientsDataBuffer());
+  auto vertex_buffer = geom.CreateSimpleVertexBuffer(context);
 
-  EXPECT_EQ(vertex_buffer.index_type, IndexType::kNone);
+  EXPECT_EQ(vertex_buffer.index_type, IndexType::k16bit);
   EXPECT_EQ(vertex_buffer.vertex_count, texture_coordinates.size() * 6);
 }
 
@@ -213,10 +212,9 @@ TEST_P(AiksTest, DlAtlasGeometryBlend) {
   EXPECT_FALSE(geom.ShouldSkip());
 
   ContentContext context(GetContext(), nullptr);
-  auto vertex_buffer =
-      geom.CreateBlendVertexBuffer(context.GetTransientsDataBuffer());
+  auto vertex_buffer = geom.CreateBlendVertexBuffer(context);
 
-  EXPECT_EQ(vertex_buffer.index_type, IndexType::kNone);
+  EXPECT_EQ(vertex_buffer.index_type, IndexType::k16bit);
   EXPECT_EQ(vertex_buffer.vertex_count, texture_coordinates.size() * 6);
 }
 
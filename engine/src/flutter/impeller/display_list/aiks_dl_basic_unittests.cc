@@ -35,6 +35,69 @@ TEST_P(AiksTest, CanRenderColoredRect) {
   ASSERT_TRUE(OpenPlaygroundHere(builder.Build()));
 }
 
+TEST_P(AiksTest, CanRenderBatchedRects) {
+  DisplayListBuilder builder;
+  builder.Scale(GetContentScale().x, GetContentScale().y);
+  builder.DrawColor(DlColor::kWhite(), DlBlendMode::kSrc);
+
+  DlPaint paint;
+  // Adjacent overlapping translucent rects are batched and must still blend
+  // in draw order.
+  for (int i = 0; i < 10; i++) {
+    paint.setColor(DlColor::kRed().withAlphaF(0.5f).withBlue(i * 25));
+    builder.DrawRect(DlRect::MakeXYWH(50 + i * 20, 50, 60, 60), paint);
+  }
+
+  // A rotated run of rects is batched with the transform applied per rect.
+  builder.Save();
+  builder.Translate(200, 250);
+  for (int i = 0; i < 8; i++) {
+    builder.Rotate(10);
+    paint.setColor(DlColor::kGreen().withAlphaF(0.5f));
+    builder.DrawRect(DlRect::MakeXYWH(0, 0, 100, 20), paint);
+  }
+  builder.Restore();
+
+  // A clip and a non-rect draw in the middle of a run split the batch.
+  for (int i = 0; i < 5; i++) {
+    paint.setColor(DlColor::kBlue().withAlphaF(0.5f));
+    builder.DrawRect(DlRect::MakeXYWH(50 + i * 30, 400, 50, 50), paint);
+  }
+  builder.ClipRect(DlRect::MakeXYWH(50, 420, 300, 100));
+  paint.setColor(DlColor::kMagenta());
+  builder.DrawCircle(DlPoint(250, 450), 30, paint);
+  for (int i = 0; i < 5; i++) {
+    paint.setColor(DlColor::kBlue().withAlphaF(0.5f));
+    builder.DrawRect(DlRect::MakeXYWH(200 + i * 30, 400, 50, 50), paint);
+  }
+
+  ASSERT_TRUE(OpenPlaygroundHere(builder.Build()));
+}
+
+TEST_P(AiksTest, CanRenderBatchedOpaqueRectsFrontToBack) {
+  DisplayListBuilder builder;
+  builder.Scale(GetContentScale().x, GetContentScale().y);
+  builder.DrawColor(DlColor::kWhite(), DlBlendMode::kSrc);
+
+  DlPaint paint;
+  // A stack of opaque overlapping cards is drawn front-to-back, and the last
+  // card must still end up on top.
+  for (int i = 0; i < 10; i++) {
+    paint.setColor(DlColor::kBlue().withRed(i * 25));
+    builder.DrawRect(DlRect::MakeXYWH(50 + i * 20, 50 + i * 20, 200, 150),
+                     paint);
+  }
+
+  // Clipped out parts of an opaque batch stay clipped.
+  builder.ClipRect(DlRect::MakeXYWH(350, 50, 150, 400));
+  for (int i = 0; i < 5; i++) {
+    paint.setColor(DlColor::kGreen().withBlue(i * 50));
+    builder.DrawRect(DlRect::MakeXYWH(300 + i * 30, 100, 100, 300), paint);
+  }
+
+  ASSERT_TRUE(OpenPlaygroundHere(builder.Build()));
+}
+
 namespace {
 using DrawRectProc =
     std::function<void(DisplayListBuilder&, const DlRect&, const DlPaint&)>;
@@ -944,5 +944,32 @@ TEST_P(AiksTest, EmulatedAdvancedBlendRestore) {
   ASSERT_TRUE(OpenPlaygroundHere(builder.Build()));
 }
 
+TEST_P(AiksTest, EmulatedAdvancedBlendsShareBackdrop) {
+  DisplayListBuilder builder;
+  builder.DrawPaint(DlPaint(DlColor::kWhite()));
+  builder.DrawRect(DlRect::MakeLTRB(0, 0, 600, 200),
+                   DlPaint(DlColor::kBlue()));
+
+  // The blends in the first row don't overlap each other and can share one
+  // backdrop.
+  for (int i = 0; i < 6; i++) {
+    builder.DrawRect(DlRect::MakeXYWH(i * 100 + 10, 10, 80, 180),
+                     DlPaint()
+                         .setColor(DlColor::kRed())
+                         .setBlendMode(DlBlendMode::kScreen));
+  }
+
+  // Each blend in the second row overlaps the previous one and must read its
+  // result.
+  for (int i = 0; i < 6; i++) {
+    builder.DrawRect(DlRect::MakeXYWH(i * 80 + 10, 210, 120, 180),
+                     DlPaint()
+                         .setColor(DlColor::kGreen().withAlphaF(0.5))
+                         .setBlendMode(DlBlendMode::kMultiply));
+  }
+
+  ASSERT_TRUE(OpenPlaygroundHere(builder.Build()));
+}
+
 }  // namespace testing
 }  // namespace impeller
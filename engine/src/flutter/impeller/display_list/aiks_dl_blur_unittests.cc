@@ -422,6 +422,38 @@ TEST_P(AiksTest, CanRenderClippedBlur) {
   ASSERT_TRUE(OpenPlaygroundHere(builder.Build()));
 }
 
+// The left layer is blurred by enough to skip MSAA, while the right layer's
+// blur is scaled down below a device pixel and keeps it. Both should render
+// without visible aliasing.
+TEST_P(AiksTest, BlurredSaveLayersSkipMSAAOnlyForVisibleBlurs) {
+  DisplayListBuilder builder;
+  builder.Scale(GetContentScale().x, GetContentScale().y);
+
+  DlPaint save_paint;
+  save_paint.setImageFilter(DlImageFilter::MakeBlur(4, 4, DlTileMode::kDecal));
+
+  DlPaint paint;
+  paint.setColor(DlColor::kBlue());
+
+  builder.SaveLayer(std::nullopt, &save_paint);
+  builder.Rotate(5);
+  builder.DrawRect(DlRect::MakeXYWH(100, 100, 200, 200), paint);
+  builder.Restore();
+
+  builder.Save();
+  builder.Translate(400, 100);
+  builder.Scale(10, 10);
+  save_paint.setImageFilter(
+      DlImageFilter::MakeBlur(0.04, 0.04, DlTileMode::kDecal));
+  builder.SaveLayer(std::nullopt, &save_paint);
+  builder.Rotate(5);
+  builder.DrawRect(DlRect::MakeXYWH(0, 0, 20, 20), paint);
+  builder.Restore();
+  builder.Restore();
+
+  ASSERT_TRUE(OpenPlaygroundHere(builder.Build()));
+}
+
 TEST_P(AiksTest, ComposePaintBlurOuter) {
   DisplayListBuilder builder;
 
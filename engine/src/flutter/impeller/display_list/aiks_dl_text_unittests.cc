@@ -109,6 +109,46 @@ TEST_P(AiksTest, CanRenderTextFrame) {
   ASSERT_TRUE(OpenPlaygroundHere(builder.Build()));
 }
 
+TEST_P(AiksTest, CanRenderBatchedTextFrames) {
+  DisplayListBuilder builder;
+  builder.Scale(GetContentScale().x, GetContentScale().y);
+
+  DlPaint paint;
+  paint.setColor(DlColor::ARGB(1, 0.1, 0.1, 0.1));
+  builder.DrawPaint(paint);
+
+  auto mapping = flutter::testing::OpenFixtureAsSkData("Roboto-Regular.ttf");
+  ASSERT_TRUE(mapping);
+  sk_sp<SkFontMgr> font_mgr = txt::GetDefaultFontManager();
+  SkFont font(font_mgr->makeFromData(mapping), 24);
+
+  // Adjacent lines of the same color are drawn together, each snapped to the
+  // pixel grid at its own position. The stroked and translucent lines, and
+  // the lines under a rotation, split the batch.
+  DlPaint text_paint;
+  for (int i = 0; i < 12; i++) {
+    text_paint.setColor(i < 8 ? DlColor::kYellow()
+                              : DlColor::kAqua().withAlphaF(0.5));
+    text_paint.setDrawStyle(i % 4 == 3 ? DlDrawStyle::kStroke
+                                       : DlDrawStyle::kFill);
+    std::string text = "Line " + std::to_string(i) + " of batched text";
+    auto blob = SkTextBlob::MakeFromString(text.c_str(), font);
+    ASSERT_TRUE(blob);
+    builder.DrawText(DlTextImpeller::Make(MakeTextFrameFromTextBlobSkia(blob)),
+                     50 + (i % 3) * 0.5, 50 + i * 30.25, text_paint);
+  }
+  builder.Translate(600, 100);
+  builder.Rotate(30);
+  for (int i = 0; i < 4; i++) {
+    auto blob = SkTextBlob::MakeFromString("Rotated", font);
+    ASSERT_TRUE(blob);
+    builder.DrawText(DlTextImpeller::Make(MakeTextFrameFromTextBlobSkia(blob)),
+                     0, i * 30, text_paint);
+  }
+
+  ASSERT_TRUE(OpenPlaygroundHere(builder.Build()));
+}
+
 TEST_P(AiksTest, CanRenderTextFrameWithInvertedTransform) {
   DisplayListBuilder builder;
 
@@ -802,6 +842,43 @@ TEST_P(AiksTest, TextWithShadowCache) {
             1u);
 }
 
+TEST_P(AiksTest, TextShadowCacheSurvivesFramesWithoutTheText) {
+  DisplayListBuilder builder;
+  builder.Scale(GetContentScale().x, GetContentScale().y);
+  DlPaint paint;
+  paint.setColor(DlColor::ARGB(1, 0.1, 0.1, 0.1));
+  builder.DrawPaint(paint);
+  ASSERT_TRUE(RenderTextInCanvasSkia(
+      GetContext(), builder, "Hello World", kFontFixture,
+      TextRenderOptions{
+          .color = DlColor::kBlue(),
+          .filter = DlBlurMaskFilter::Make(DlBlurStyle::kNormal, 4)}));
+  sk_sp<DisplayList> text_display_list = builder.Build();
+
+  DisplayListBuilder empty_builder;
+  empty_builder.DrawPaint(paint);
+  sk_sp<DisplayList> empty_display_list = empty_builder.Build();
+
+  AiksContext aiks_context(GetContext(),
+                           std::make_shared<TypographerContextSkia>());
+  const TextShadowCache& cache =
+      aiks_context.GetContentContext().GetTextShadowCache();
+
+  DisplayListToTexture(text_display_list, {400, 400}, aiks_context);
+  EXPECT_EQ(cache.GetStats().miss_count, 1u);
+  EXPECT_EQ(cache.GetStats().hit_count, 0u);
+  EXPECT_GT(cache.GetStats().resident_bytes, 0u);
+
+  // A frame that doesn't draw the text keeps the shadow within the budget.
+  DisplayListToTexture(empty_display_list, {400, 400}, aiks_context);
+  EXPECT_EQ(cache.GetCacheSizeForTesting(), 1u);
+  EXPECT_EQ(cache.GetStats().evicted_count, 0u);
+
+  DisplayListToTexture(text_display_list, {400, 400}, aiks_context);
+  EXPECT_EQ(cache.GetStats().miss_count, 0u);
+  EXPECT_EQ(cache.GetStats().hit_count, 1u);
+}
+
 TEST_P(AiksTest, MultipleTextWithShadowCache) {
   DisplayListBuilder builder;
   builder.Scale(GetContentScale().x, GetContentScale().y);
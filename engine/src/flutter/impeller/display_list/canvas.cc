@@ -4,6 +4,7 @@
 
 #include "impeller/display_list/canvas.h"
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <unordered_map>
@@ -15,6 +16,7 @@
 #include "display_list/effects/dl_color_filter.h"
 #include "display_list/effects/dl_color_source.h"
 #include "display_list/effects/dl_image_filter.h"
+#include "display_list/effects/image_filters/dl_blur_image_filter.h"
 #include "display_list/image/dl_image.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/trace_event.h"
@@ -32,6 +34,7 @@
 #include "impeller/entity/contents/filters/filter_contents.h"
 #include "impeller/entity/contents/framebuffer_blend_contents.h"
 #include "impeller/entity/contents/line_contents.h"
+#include "impeller/entity/contents/round_rect_contents.h"
 #include "impeller/entity/contents/shadow_vertices_contents.h"
 #include "impeller/entity/contents/solid_rrect_blur_contents.h"
 #include "impeller/entity/contents/solid_rsuperellipse_blur_contents.h"
@@ -60,6 +63,22 @@ namespace impeller {
 
 namespace {
 
+/// The largest number of rects batched into one draw, limited by the 16 bit
+/// indices of the batched vertices.
+static constexpr size_t kMaxBatchedRects = 16383u;
+
+/// The largest number of glyphs batched into one text draw, limited by the
+/// 16 bit indices of the glyph quads.
+static constexpr size_t kMaxBatchedGlyphs = 16383u;
+
+size_t GetGlyphCount(const TextFrame& frame) {
+  size_t glyph_count = 0u;
+  for (const TextRun& run : frame.GetRuns()) {
+    glyph_count += run.GetGlyphCount();
+  }
+  return glyph_count;
+}
+
 bool IsPipelineBlendOrMatrixFilter(const flutter::DlColorFilter* filter) {
   return filter->type() == flutter::DlColorFilterType::kMatrix ||
          (filter->type() == flutter::DlColorFilterType::kBlend &&
@@ -133,7 +152,8 @@ static const constexpr RenderTarget::AttachmentConfig kDefaultStencilConfig =
 static std::unique_ptr<EntityPassTarget> CreateRenderTarget(
     ContentContext& renderer,
     ISize size,
-    const Color& clear_color) {
+    const Color& clear_color,
+    bool allow_msaa = true) {
   const std::shared_ptr<Context>& context = renderer.GetContext();
 
   /// All of the load/store actions are managed by `InlinePassContext` when
@@ -142,7 +162,8 @@ static std::unique_ptr<EntityPassTarget> CreateRenderTarget(
   /// changed for the lifetime of the textures.
 
   RenderTarget target;
-  if (context->GetCapabilities()->SupportsOffscreenMSAA()) {
+  if (allow_msaa && context->GetCapabilities()->SupportsOffscreenMSAA() &&
+      !renderer.GetQualityReductions().disable_offscreen_msaa) {
     target = renderer.GetRenderTargetCache()->CreateOffscreenMSAA(
         /*context=*/*context,
         /*size=*/size,
@@ -179,6 +200,27 @@ static std::unique_ptr<EntityPassTarget> CreateRenderTarget(
   );
 }
 
+/// The smallest device space blur sigma that hides the aliased edges MSAA
+/// would otherwise smooth out.
+static constexpr Scalar kMinBlurSigmaToSkipMSAA = 1.0f;
+
+/// Whether the layer contents are blurred by enough that multisampling them
+/// first is wasted work.
+static bool ImageFilterHidesAliasing(const flutter::DlImageFilter* filter,
+                                     const Matrix& transform) {
+  if (!filter) {
+    return false;
+  }
+  const flutter::DlBlurImageFilter* blur = filter->asBlur();
+  if (!blur) {
+    return false;
+  }
+  Scalar scale = std::min(transform.GetBasisX().GetLength(),
+                          transform.GetBasisY().GetLength());
+  return std::min(blur->sigma_x(), blur->sigma_y()) * scale >=
+         kMinBlurSigmaToSkipMSAA;
+}
+
 }  // namespace
 
 class Canvas::RRectBlurShape : public BlurShape {
@@ -412,7 +454,7 @@ void Canvas::RestoreToCount(size_t count) {
 
 void Canvas::DrawPath(const flutter::DlPath& path, const Paint& paint) {
   if (IsShadowBlurDrawOperation(paint)) {
-    if (AttemptDrawBlurredPathSource(path, paint)) {
+    if (AttemptDrawBlurredPathSource(path, paint, &path)) {
       return;
     }
   }
@@ -547,6 +589,39 @@ bool Canvas::AttemptDrawAntialiasedCircle(const Point& center,
   return true;
 }
 
+bool Canvas::AttemptDrawAntialiasedRoundRect(const RoundRect& round_rect,
+                                             const Paint& paint) {
+  if (paint.HasColorFilter() || paint.image_filter || paint.invert_colors ||
+      paint.color_source || paint.mask_blur_descriptor.has_value()) {
+    return false;
+  }
+  if (GetCurrentTransform().HasPerspective()) {
+    return false;
+  }
+
+  std::unique_ptr<RoundRectContents> contents;
+  if (paint.style == Paint::Style::kStroke) {
+    if (!RoundRectContents::CanStroke(round_rect, paint.stroke)) {
+      return false;
+    }
+    contents = RoundRectContents::MakeStroked(round_rect, paint.stroke.width,
+                                              paint.color);
+  } else {
+    if (!RoundRectContents::CanRender(round_rect)) {
+      return false;
+    }
+    contents = RoundRectContents::Make(round_rect, paint.color);
+  }
+
+  Entity entity;
+  entity.SetTransform(GetCurrentTransform());
+  entity.SetBlendMode(paint.blend_mode);
+  entity.SetContents(std::move(contents));
+  AddRenderEntityToCurrentPass(entity);
+
+  return true;
+}
+
 bool Canvas::IsShadowBlurDrawOperation(const Paint& paint) {
   if (paint.style != Paint::Style::kFill) {
     return false;
@@ -576,7 +651,8 @@ bool Canvas::IsShadowBlurDrawOperation(const Paint& paint) {
 }
 
 bool Canvas::AttemptDrawBlurredPathSource(const PathSource& source,
-                                          const Paint& paint) {
+                                          const Paint& paint,
+                                          const flutter::DlPath* path) {
   FML_DCHECK(IsShadowBlurDrawOperation);
 
   // This has_value() test should always succeed as it is checked by the
@@ -593,9 +669,16 @@ bool Canvas::AttemptDrawBlurredPathSource(const PathSource& source,
     const Matrix& matrix = GetCurrentTransform();
     Scalar basis_scale = matrix.GetMaxBasisLengthXY();
     Scalar device_radius = sigma.sigma * kSigmaScale * basis_scale;
+    RetainedGeometryCache& cache = renderer_.GetRetainedGeometryCache();
     std::shared_ptr<ShadowVertices> shadow_vertices =
-        ShadowPathGeometry::MakeAmbientShadowVertices(
-            renderer_.GetTessellator(), source, device_radius, matrix);
+        path ? cache.LookupShadow(*path, device_radius, matrix) : nullptr;
+    if (!shadow_vertices) {
+      shadow_vertices = ShadowPathGeometry::MakeAmbientShadowVertices(
+          renderer_.GetTessellator(), source, device_radius, matrix);
+      if (path) {
+        cache.OfferShadow(*path, device_radius, matrix, shadow_vertices);
+      }
+    }
     if (shadow_vertices) {
       PathBlurShape shape(source, std::move(shadow_vertices), sigma);
       return AttemptDrawBlur(shape, paint);
@@ -816,6 +899,19 @@ void Canvas::DrawRect(const Rect& rect, const Paint& paint) {
     }
   }
 
+  if (AttemptBatchRect(rect, paint)) {
+    return;
+  }
+
+  // Axis aligned rects have no edges to anti-alias beyond what rasterization
+  // already gives, so only fills under other transforms use the analytic
+  // path.
+  if (paint.style == Paint::Style::kFill &&
+      !GetCurrentTransform().IsTranslationScaleOnly() &&
+      AttemptDrawAntialiasedRoundRect(RoundRect::MakeRect(rect), paint)) {
+    return;
+  }
+
   Entity entity;
   entity.SetTransform(GetCurrentTransform());
   entity.SetBlendMode(paint.blend_mode);
@@ -829,6 +925,119 @@ void Canvas::DrawRect(const Rect& rect, const Paint& paint) {
   }
 }
 
+bool Canvas::AttemptBatchRect(const Rect& rect, const Paint& paint) {
+  if (paint.style != Paint::Style::kFill || paint.color_source ||
+      paint.color_filter || paint.image_filter || paint.invert_colors ||
+      paint.mask_blur_descriptor.has_value() ||
+      paint.blend_mode != BlendMode::kSrcOver) {
+    return false;
+  }
+  // Draws that may still fold into the clear color, and draws under an
+  // inherited opacity, take the regular path.
+  if (IsSkipping() || render_passes_.back().IsApplyingClearColor() ||
+      transform_stack_.back().distributed_opacity < 1.0) {
+    return false;
+  }
+  const Matrix& transform = GetCurrentTransform();
+  if (transform.HasPerspective()) {
+    return false;
+  }
+
+  FlushTextBatch();
+  if (pending_rects_.size() >= kMaxBatchedRects) {
+    FlushRectBatch();
+  }
+  pending_rects_.push_back(PendingRect{
+      .rect = rect,
+      .transform = transform,
+      .color = paint.color,
+  });
+  return true;
+}
+
+void Canvas::FlushRectBatch() {
+  if (pending_rects_.empty()) {
+    return;
+  }
+  // Move the batch out first as encoding it re-enters this method through
+  // AddRenderEntityToCurrentPass.
+  std::vector<PendingRect> rects = std::move(pending_rects_);
+  pending_rects_.clear();
+
+  if (rects.size() == 1u) {
+    const PendingRect& pending = rects.front();
+    Entity entity;
+    entity.SetTransform(pending.transform);
+    entity.SetBlendMode(BlendMode::kSrcOver);
+
+    Paint paint;
+    paint.color = pending.color;
+    FillRectGeometry geom(pending.rect);
+    AddRenderEntityWithFiltersToCurrentPass(entity, &geom, paint);
+  } else {
+    TRACE_EVENT0("impeller", "Canvas::FlushRectBatch");
+    // When every rect is opaque the result does not depend on the order they
+    // are drawn in. They are then drawn front-to-back with a strict depth
+    // test, so that the pixels of rects covered by later rects in the batch
+    // are rejected before they are shaded.
+    const bool all_opaque =
+        std::all_of(rects.begin(), rects.end(), [](const PendingRect& rect) {
+          return rect.color.IsOpaque();
+        });
+    if (all_opaque) {
+      std::reverse(rects.begin(), rects.end());
+    }
+
+    std::vector<flutter::DlPoint> positions;
+    std::vector<flutter::DlColor> colors;
+    std::vector<uint16_t> indices;
+    positions.reserve(rects.size() * 4);
+    colors.reserve(rects.size() * 4);
+    indices.reserve(rects.size() * 6);
+    for (const PendingRect& pending : rects) {
+      uint16_t base = static_cast<uint16_t>(positions.size());
+      for (const Point& point :
+           pending.rect.GetTransformedPoints(pending.transform)) {
+        positions.push_back(point);
+      }
+      flutter::DlColor color(pending.color.alpha, pending.color.red,
+                             pending.color.green, pending.color.blue,
+                             flutter::DlColorSpace::kExtendedSRGB);
+      colors.insert(colors.end(), 4, color);
+      // The transformed points are in TL, TR, BL, BR order.
+      for (uint16_t index : {0, 1, 2, 1, 3, 2}) {
+        indices.push_back(base + index);
+      }
+    }
+
+    auto geometry = std::make_shared<DlVerticesGeometry>(
+        flutter::DlVertices::Make(flutter::DlVertexMode::kTriangles,
+                                  positions.size(), positions.data(),
+                                  /*texture_coordinates=*/nullptr,
+                                  colors.data(), indices.size(),
+                                  indices.data()),
+        renderer_);
+    auto contents = std::make_shared<VerticesSimpleBlendContents>();
+    contents->SetBlendMode(BlendMode::kDst);
+    contents->SetAlpha(1.0);
+    contents->SetGeometry(std::move(geometry));
+    contents->SetPreventOverdraw(all_opaque);
+
+    Entity entity;
+    entity.SetBlendMode(BlendMode::kSrcOver);
+    entity.SetContents(std::move(contents));
+
+    // Each rect in the batch was allotted its own depth by the display list.
+    // None of them can be clipped separately, so the batch is drawn at the
+    // depth of the last one.
+    current_depth_ += rects.size() - 1;
+    AddRenderEntityToCurrentPass(entity);
+  }
+
+  rects.clear();
+  pending_rects_ = std::move(rects);
+}
+
 void Canvas::DrawOval(const Rect& rect, const Paint& paint) {
   // TODO(jonahwilliams): This additional condition avoids an assert in the
   // stroke circle geometry generator. I need to verify the condition that this
@@ -857,6 +1066,10 @@ void Canvas::DrawOval(const Rect& rect, const Paint& paint) {
     }
   }
 
+  if (AttemptDrawAntialiasedRoundRect(RoundRect::MakeOval(rect), paint)) {
+    return;
+  }
+
   Entity entity;
   entity.SetTransform(GetCurrentTransform());
   entity.SetBlendMode(paint.blend_mode);
@@ -929,6 +1142,10 @@ void Canvas::DrawRoundRect(const RoundRect& round_rect, const Paint& paint) {
     }
   }
 
+  if (AttemptDrawAntialiasedRoundRect(round_rect, paint)) {
+    return;
+  }
+
   if (round_rect.GetRadii().AreAllCornersSame() &&
       paint.style == Paint::Style::kFill) {
     Entity entity;
@@ -1024,6 +1241,8 @@ void Canvas::DrawCircle(const Point& center,
 void Canvas::ClipGeometry(const Geometry& geometry,
                           Entity::ClipOperation clip_op,
                           bool is_aa) {
+  FlushRectBatch();
+  FlushTextBatch();
   if (IsSkipping()) {
     return;
   }
@@ -1331,6 +1550,7 @@ void Canvas::DrawAtlas(const std::shared_ptr<AtlasContents>& atlas_contents,
 
 void Canvas::SetupRenderPass() {
   renderer_.GetRenderTargetCache()->Start();
+  renderer_.GetBlurDownsampleCache().Clear();
   ColorAttachment color0 = render_target_.GetColorAttachment(0);
 
   auto& stencil_attachment = render_target_.GetStencilAttachment();
@@ -1443,6 +1663,8 @@ void Canvas::SaveLayer(const Paint& paint,
                        uint32_t total_content_depth,
                        bool can_distribute_opacity,
                        std::optional<int64_t> backdrop_id) {
+  FlushRectBatch();
+  FlushTextBatch();
   TRACE_EVENT0("flutter", "Canvas::saveLayer");
   if (IsSkipping()) {
     return SkipUntilMatchingRestore(total_content_depth);
@@ -1622,6 +1844,7 @@ void Canvas::SaveLayer(const Paint& paint,
         backdrop_entity.SetClipDepth(++current_depth_);
         backdrop_entity.SetBlendMode(paint.blend_mode);
 
+        MarkBlendBackdropDirty(backdrop_entity.GetCoverage());
         backdrop_entity.Render(renderer_, GetCurrentRenderPass());
         Save(0);
         return;
@@ -1636,9 +1859,13 @@ void Canvas::SaveLayer(const Paint& paint,
 
   render_passes_.push_back(
       LazyRenderingConfig(renderer_,                                    //
-                          CreateRenderTarget(renderer_,                 //
-                                             subpass_size,              //
-                                             Color::BlackTransparent()  //
+                          CreateRenderTarget(renderer_,                  //
+                                             subpass_size,               //
+                                             Color::BlackTransparent(),  //
+                                             /*allow_msaa=*/
+                                             !ImageFilterHidesAliasing(
+                                                 paint.image_filter,
+                                                 GetCurrentTransform())  //
                                              )));
   save_layer_state_.push_back(SaveLayerState{
       paint_copy, subpass_coverage.Shift(-coverage_origin_adjustment)});
@@ -1675,6 +1902,8 @@ void Canvas::SaveLayer(const Paint& paint,
 }
 
 bool Canvas::Restore() {
+  FlushRectBatch();
+  FlushTextBatch();
   FML_DCHECK(transform_stack_.size() > 0);
   if (transform_stack_.size() == 1) {
     return false;
@@ -1708,6 +1937,10 @@ bool Canvas::Restore() {
           Entity::RenderingMode::kSubpassPrependSnapshotTransform) {
     auto lazy_render_pass = std::move(render_passes_.back());
     render_passes_.pop_back();
+    if (blend_backdrop_.has_value() &&
+        blend_backdrop_->pass_count > render_passes_.size()) {
+      blend_backdrop_.reset();
+    }
     // Force the render pass to be constructed if it never was.
     lazy_render_pass.GetInlinePassContext()->GetRenderPass();
 
@@ -1780,6 +2013,7 @@ bool Canvas::Restore() {
       }
     }
 
+    MarkBlendBackdropDirty(element_entity.GetCoverage());
     element_entity.Render(
         renderer_,                                                      //
         *render_passes_.back().GetInlinePassContext()->GetRenderPass()  //
@@ -1852,7 +2086,7 @@ bool Canvas::AttemptBlurredTextOptimization(
       /*p_color=*/paint.color);
 
   std::optional<Entity> result = renderer_.GetTextShadowCache().Lookup(
-      renderer_, entity, filter, cache_key);
+      renderer_, entity, filter, cache_key, text_frame);
   if (result.has_value()) {
     AddRenderEntityToCurrentPass(result.value(), /*reuse_depth=*/false);
     return true;
@@ -1871,7 +2105,8 @@ void Canvas::DrawTextFrame(const std::shared_ptr<TextFrame>& text_frame,
                            const Paint& paint) {
   Scalar max_scale = GetCurrentTransform().GetMaxBasisLengthXY();
   if (max_scale * text_frame->GetFont().GetMetrics().point_size >
-      kMaxTextScale) {
+          kMaxTextScale ||
+      text_frame->ShouldRenderAsPath()) {
     fml::StatusOr<flutter::DlPath> path = text_frame->GetPath();
     if (path.ok()) {
       Save(1);
@@ -1882,6 +2117,10 @@ void Canvas::DrawTextFrame(const std::shared_ptr<TextFrame>& text_frame,
     }
   }
 
+  if (AttemptBatchText(text_frame, position, paint)) {
+    return;
+  }
+
   Entity entity;
   entity.SetClipDepth(GetClipHeight());
   entity.SetBlendMode(paint.blend_mode);
@@ -1909,6 +2148,94 @@ void Canvas::DrawTextFrame(const std::shared_ptr<TextFrame>& text_frame,
   AddRenderEntityToCurrentPass(entity, false);
 }
 
+bool Canvas::AttemptBatchText(const std::shared_ptr<TextFrame>& text_frame,
+                              Point position,
+                              const Paint& paint) {
+  if (paint.color_source || paint.color_filter || paint.image_filter ||
+      paint.invert_colors || paint.mask_blur_descriptor.has_value() ||
+      paint.blend_mode != BlendMode::kSrcOver) {
+    return false;
+  }
+  if (IsSkipping() || transform_stack_.back().distributed_opacity < 1.0) {
+    return false;
+  }
+  const Matrix transform =
+      GetCurrentTransform() * Matrix::MakeTranslation(position);
+  const size_t glyph_count = GetGlyphCount(*text_frame);
+  if (transform.HasPerspective() || glyph_count > kMaxBatchedGlyphs) {
+    return false;
+  }
+
+  // The frames of a batch share the uniforms and the atlas sampler of one
+  // draw.
+  if (!pending_texts_.empty()) {
+    const PendingText& first = pending_texts_.front();
+    if (first.frame->GetAtlasType() != text_frame->GetAtlasType() ||
+        first.color != paint.color ||
+        first.transform.IsTranslationScaleOnly() !=
+            transform.IsTranslationScaleOnly() ||
+        pending_glyph_count_ + glyph_count > kMaxBatchedGlyphs) {
+      FlushTextBatch();
+    }
+  }
+  FlushRectBatch();
+  pending_texts_.push_back(PendingText{
+      .frame = text_frame,
+      .position = position,
+      .transform = transform,
+      .scale = GetCurrentTransform().GetMaxBasisLengthXY(),
+      .color = paint.color,
+      .stroke = paint.style == Paint::Style::kStroke
+                    ? std::optional(paint.stroke)
+                    : std::nullopt,
+  });
+  pending_glyph_count_ += glyph_count;
+  return true;
+}
+
+void Canvas::FlushTextBatch() {
+  if (pending_texts_.empty()) {
+    return;
+  }
+  // Move the batch out first as encoding it re-enters this method through
+  // AddRenderEntityToCurrentPass.
+  std::vector<PendingText> texts = std::move(pending_texts_);
+  pending_texts_.clear();
+  pending_glyph_count_ = 0u;
+
+  const PendingText& first = texts.front();
+  auto text_contents = std::make_shared<TextContents>();
+  text_contents->SetScale(first.scale);
+  text_contents->SetColor(first.color);
+  text_contents->SetOffset(first.position);
+
+  Entity entity;
+  entity.SetClipDepth(GetClipHeight());
+  entity.SetBlendMode(BlendMode::kSrcOver);
+  if (texts.size() == 1u) {
+    text_contents->SetTextFrame(first.frame);
+    text_contents->SetTextProperties(first.color, first.stroke);
+    entity.SetTransform(first.transform);
+  } else {
+    TRACE_EVENT0("impeller", "Canvas::FlushTextBatch");
+    // Each frame is positioned by its own transform, so that its glyphs are
+    // snapped to the pixel grid exactly as if it were drawn alone.
+    for (const PendingText& pending : texts) {
+      text_contents->AddTextFrame(pending.frame, pending.transform,
+                                  pending.color, pending.stroke);
+    }
+  }
+  entity.SetContents(std::move(text_contents));
+
+  // As with the batched rects, each frame was allotted its own depth and the
+  // batch is drawn at the depth of the last one.
+  current_depth_ += texts.size() - 1;
+  AddRenderEntityToCurrentPass(entity);
+
+  texts.clear();
+  pending_texts_ = std::move(texts);
+}
+
 void Canvas::AddRenderEntityWithFiltersToCurrentPass(Entity& entity,
                                                      const Geometry* geometry,
                                                      const Paint& paint,
@@ -1988,6 +2315,8 @@ void Canvas::AddRenderEntityWithFiltersToCurrentPass(Entity& entity,
 }
 
 void Canvas::AddRenderEntityToCurrentPass(Entity& entity, bool reuse_depth) {
+  FlushRectBatch();
+  FlushTextBatch();
   if (IsSkipping()) {
     return;
   }
@@ -2047,12 +2376,36 @@ void Canvas::AddRenderEntityToCurrentPass(Entity& entity, bool reuse_depth) {
       // to the render target texture so far need to execute before it's bound
       // for blending (otherwise the blend pass will end up executing before
       // all the previous commands in the active pass).
-      auto input_texture = FlipBackdrop(GetGlobalPassPosition(),  //
-                                        /*should_remove_texture=*/false,
-                                        /*should_use_onscreen=*/false,
-                                        /*post_depth_increment=*/true);
+      //
+      // Where the source is transparent every advanced blend leaves the
+      // destination as is, so the blend only needs to be written within the
+      // source coverage. Consecutive blends that don't overlap anything drawn
+      // since the last flip can then share its backdrop texture.
+      std::optional<Rect> blend_coverage = entity.GetCoverage();
+      std::optional<Rect> clip_coverage =
+          clip_coverage_stack_.CurrentClipCoverage();
+      if (blend_coverage.has_value() && clip_coverage.has_value()) {
+        blend_coverage = blend_coverage->Intersection(
+            clip_coverage->Shift(-GetGlobalPassPosition()));
+        if (!blend_coverage.has_value()) {
+          return;
+        }
+      }
+
+      std::shared_ptr<Texture> input_texture =
+          GetSharedBlendBackdrop(blend_coverage);
       if (!input_texture) {
-        return;
+        input_texture = FlipBackdrop(GetGlobalPassPosition(),  //
+                                     /*should_remove_texture=*/false,
+                                     /*should_use_onscreen=*/false,
+                                     /*post_depth_increment=*/true);
+        if (!input_texture) {
+          return;
+        }
+        blend_backdrop_ = BlendBackdrop{
+            .texture = input_texture,
+            .pass_count = render_passes_.size(),
+        };
       }
 
       // The coverage hint tells the rendered Contents which portion of the
@@ -2068,6 +2421,7 @@ void Canvas::AddRenderEntityToCurrentPass(Entity& entity, bool reuse_depth) {
           FilterInput::Make(entity.GetContents())};
       auto contents =
           ColorFilterContents::MakeBlend(entity.GetBlendMode(), inputs);
+      contents->SetCoverageHint(blend_coverage);
       entity.SetContents(std::move(contents));
       entity.SetBlendMode(BlendMode::kSrc);
     }
@@ -2082,9 +2436,41 @@ void Canvas::AddRenderEntityToCurrentPass(Entity& entity, bool reuse_depth) {
     return;
   }
 
+  if (blend_backdrop_.has_value()) {
+    MarkBlendBackdropDirty(entity.GetCoverage());
+  }
   entity.Render(renderer_, *result);
 }
 
+std::shared_ptr<Texture> Canvas::GetSharedBlendBackdrop(
+    const std::optional<Rect>& coverage) const {
+  if (!blend_backdrop_.has_value() || !coverage.has_value() ||
+      blend_backdrop_->pass_count != render_passes_.size()) {
+    return nullptr;
+  }
+  // Targets that read from their resolve texture or don't use MSAA render to
+  // the texture the flip returned, which is then not a stable snapshot.
+  if (render_passes_.back().GetInlinePassContext()->GetTexture() ==
+      blend_backdrop_->texture) {
+    return nullptr;
+  }
+  if (blend_backdrop_->dirty_coverage.has_value() &&
+      blend_backdrop_->dirty_coverage->IntersectsWithRect(coverage.value())) {
+    return nullptr;
+  }
+  return blend_backdrop_->texture;
+}
+
+void Canvas::MarkBlendBackdropDirty(const std::optional<Rect>& coverage) {
+  if (!blend_backdrop_.has_value() ||
+      blend_backdrop_->pass_count != render_passes_.size() ||
+      !coverage.has_value()) {
+    return;
+  }
+  blend_backdrop_->dirty_coverage =
+      Rect::Union(blend_backdrop_->dirty_coverage, coverage.value());
+}
+
 RenderPass& Canvas::GetCurrentRenderPass() const {
   return *render_passes_.back().GetInlinePassContext()->GetRenderPass();
 }
@@ -2100,6 +2486,7 @@ std::shared_ptr<Texture> Canvas::FlipBackdrop(Point global_pass_position,
                                               bool should_remove_texture,
                                               bool should_use_onscreen,
                                               bool post_depth_increment) {
+  blend_backdrop_.reset();
   LazyRenderingConfig rendering_config = std::move(render_passes_.back());
   render_passes_.pop_back();
 
@@ -2130,6 +2517,10 @@ std::shared_ptr<Texture> Canvas::FlipBackdrop(Point global_pass_position,
   const std::shared_ptr<Texture>& input_texture =
       rendering_config.GetInlinePassContext()->GetTexture();
 
+  // The pass textures are ping-ponged, so down-sampled backdrops rendered
+  // before this point may hold stale contents.
+  renderer_.GetBlurDownsampleCache().Clear();
+
   if (!input_texture) {
     VALIDATION_LOG << "Failed to fetch the color texture in order to "
                       "apply an advanced blend or backdrop filter.";
@@ -2165,6 +2556,18 @@ std::shared_ptr<Texture> Canvas::FlipBackdrop(Point global_pass_position,
       render_passes_.back().GetEntityPassTarget()->RemoveSecondary();
     }
   }
+  // The backdrop restore below draws the previous pass texture over the whole
+  // MSAA attachment with kSrc, so clearing it first is wasted bandwidth.
+  {
+    const RenderTarget& next_target =
+        render_passes_.back().GetEntityPassTarget()->GetRenderTarget();
+    if (next_target.GetColorAttachment(0).resolve_texture != nullptr &&
+        next_target.GetRenderTargetSize() == input_texture->GetSize()) {
+      render_passes_.back()
+          .GetInlinePassContext()
+          ->MarkNextPassOverwritesColor();
+    }
+  }
   RenderPass& current_render_pass =
       *render_passes_.back().GetInlinePassContext()->GetRenderPass();
 
@@ -2289,6 +2692,8 @@ bool Canvas::EnsureFinalMipmapGeneration() const {
 }
 
 void Canvas::EndReplay() {
+  FlushRectBatch();
+  FlushTextBatch();
   FML_DCHECK(render_passes_.size() == 1u);
   render_passes_.back().GetInlinePassContext()->GetRenderPass();
   render_passes_.back().GetInlinePassContext()->EndPass(
@@ -2310,6 +2715,7 @@ void Canvas::EndReplay() {
   }
   render_passes_.clear();
   renderer_.GetRenderTargetCache()->End();
+  renderer_.GetBlurDownsampleCache().Clear();
   clip_geometry_.clear();
 
   Reset();
@@ -330,6 +330,49 @@ class Canvas {
 
   uint64_t current_depth_ = 0u;
 
+  /// A solid color rect that has been accepted into the current batch but
+  /// not yet encoded into the render pass.
+  struct PendingRect {
+    Rect rect;
+    Matrix transform;
+    Color color;
+  };
+
+  /// Consecutive solid color fill rects waiting to be encoded as a single
+  /// draw by |FlushRectBatch|.
+  std::vector<PendingRect> pending_rects_;
+
+  /// A text frame that has been accepted into the current text batch but not
+  /// yet encoded into the render pass.
+  struct PendingText {
+    std::shared_ptr<TextFrame> frame;
+    Point position;
+    Matrix transform;
+    Scalar scale;
+    Color color;
+    std::optional<StrokeParameters> stroke;
+  };
+
+  /// Consecutive text frames that share a glyph atlas and a color, waiting to
+  /// be encoded as a single draw by |FlushTextBatch|.
+  std::vector<PendingText> pending_texts_;
+  size_t pending_glyph_count_ = 0u;
+
+  /// The destination texture produced by the last |FlipBackdrop| of an
+  /// emulated advanced blend.
+  ///
+  /// Until the pass is flipped again this texture is not written to, so later
+  /// advanced blends in the same pass can read it instead of flipping again as
+  /// long as nothing drawn since overlaps them.
+  struct BlendBackdrop {
+    std::shared_ptr<Texture> texture;
+    /// The size of |render_passes_| when the backdrop was flipped.
+    size_t pass_count = 0u;
+    /// The pass local coverage of everything drawn since the flip.
+    std::optional<Rect> dirty_coverage;
+  };
+  std::optional<BlendBackdrop> blend_backdrop_;
+
   Point GetGlobalPassPosition() const;
 
   // clip depth of the previous save or 0.
@@ -385,16 +428,62 @@ class Canvas {
   /// operation.
   static bool IsShadowBlurDrawOperation(const Paint& paint);
 
+  /// Defer a solid color fill rect so that it can be encoded together with
+  /// the adjacent compatible rects in one draw.
+  ///
+  /// Returns whether the rect was added to the pending batch.
+  bool AttemptBatchRect(const Rect& rect, const Paint& paint);
+
+  /// Returns the shared advanced blend backdrop if an emulated advanced blend
+  /// limited to the pass local [coverage] can read it, or nullptr if the pass
+  /// must be flipped.
+  std::shared_ptr<Texture> GetSharedBlendBackdrop(
+      const std::optional<Rect>& coverage) const;
+
+  /// Record that [coverage] was drawn to the current pass, which makes that
+  /// part of the shared advanced blend backdrop stale.
+  void MarkBlendBackdropDirty(const std::optional<Rect>& coverage);
+
+  /// Encode the pending batch of rects, if any, into the current pass.
+  ///
+  /// This must be called before anything else is encoded into the current
+  /// pass or the clip and pass state is changed.
+  void FlushRectBatch();
+
+  /// Defer a text frame with a plain fill or stroke paint so that it can be
+  /// encoded together with the adjacent frames that use the same glyph atlas
+  /// and color in one draw.
+  ///
+  /// Returns whether the frame was added to the pending batch.
+  bool AttemptBatchText(const std::shared_ptr<TextFrame>& text_frame,
+                        Point position,
+                        const Paint& paint);
+
+  /// Encode the pending batch of text frames, if any, into the current pass.
+  ///
+  /// Like |FlushRectBatch|, this must be called before anything else is
+  /// encoded into the current pass or the clip and pass state is changed.
+  void FlushTextBatch();
+
   bool AttemptDrawAntialiasedCircle(const Point& center,
                                     Scalar radius,
                                     const Paint& paint);
 
+  /// Draws a solid color round rect, oval or rect with a shader computed
+  /// anti-aliasing ramp instead of tessellating it. Returns false if the
+  /// paint or shape need the general path.
+  bool AttemptDrawAntialiasedRoundRect(const RoundRect& round_rect,
+                                       const Paint& paint);
+
   /// Returns the radius common to both width and height of all corners,
   /// or -1 if the radii are not uniform.
   static Scalar GetCommonRRectLikeRadius(const RoundingRadii& radii);
 
+  /// The shadow mesh is cached across frames if |path| is the path that
+  /// |source| iterates.
   bool AttemptDrawBlurredPathSource(const PathSource& source,
-                                    const Paint& paint);
+                                    const Paint& paint,
+                                    const flutter::DlPath* path = nullptr);
 
   bool AttemptDrawBlurredRRect(const RoundRect& round_rect, const Paint& paint);
 
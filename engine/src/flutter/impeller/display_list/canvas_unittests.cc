@@ -4,15 +4,19 @@
 
 #include <unordered_map>
 
+#include "flutter/display_list/dl_builder.h"
 #include "flutter/display_list/dl_tile_mode.h"
 #include "flutter/display_list/effects/dl_image_filter.h"
 #include "flutter/display_list/geometry/dl_geometry_types.h"
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/synchronization/waitable_event.h"
 #include "flutter/testing/testing.h"
 #include "gtest/gtest.h"
 #include "impeller/core/formats.h"
 #include "impeller/core/texture_descriptor.h"
 #include "impeller/display_list/aiks_unittests.h"
 #include "impeller/display_list/canvas.h"
+#include "impeller/display_list/dl_dispatcher.h"
 #include "impeller/display_list/dl_runtime_effect_impeller.h"
 #include "impeller/display_list/dl_vertices_geometry.h"
 #include "impeller/geometry/geometry_asserts.h"
@@ -463,5 +467,85 @@ TEST_P(AiksTest, RoundSuperellipseShadowComparison) {
   ASSERT_TRUE(Playground::OpenPlaygroundHere(callback));
 }
 
+TEST_P(AiksTest, ParallelFirstPassMatchesSerialBackdropData) {
+  flutter::DisplayListBuilder builder;
+  auto blur =
+      flutter::DlImageFilter::MakeBlur(4, 4, flutter::DlTileMode::kClamp);
+  auto other_blur =
+      flutter::DlImageFilter::MakeBlur(8, 8, flutter::DlTileMode::kClamp);
+  flutter::DlRect rect = flutter::DlRect::MakeLTRB(0, 0, 50, 50);
+  for (int i = 0; i < 4; i++) {
+    builder.Translate(10, 10);
+    builder.SaveLayer(rect, nullptr, blur.get(), /*backdrop_id=*/1);
+    builder.DrawRect(rect, flutter::DlPaint());
+    builder.Restore();
+  }
+  builder.SaveLayer(rect, nullptr, other_blur.get(), /*backdrop_id=*/1);
+  builder.Restore();
+  builder.SaveLayer(rect, nullptr, blur.get(), /*backdrop_id=*/2);
+  builder.Restore();
+  auto display_list = builder.Build();
+  Rect cull_rect = Rect::MakeLTRB(0, 0, 1000, 1000);
+
+  ContentContext context(GetContext(), nullptr);
+  FirstPassDispatcher serial(context, Matrix(), cull_rect);
+  serial.DispatchDisplayList(display_list, cull_rect);
+  const auto& [serial_data, serial_count] = serial.TakeBackdropData();
+
+  auto loop = fml::ConcurrentMessageLoop::Create(2);
+  context.SetParallelRecordingTaskRunner(loop->GetTaskRunner());
+  FirstPassDispatcher parallel(context, Matrix(), cull_rect);
+  parallel.DispatchDisplayList(display_list, cull_rect);
+  const auto& [parallel_data, parallel_count] = parallel.TakeBackdropData();
+  context.SetParallelRecordingTaskRunner(nullptr);
+
+  EXPECT_EQ(serial_count, 6u);
+  EXPECT_EQ(parallel_count, serial_count);
+  ASSERT_EQ(parallel_data.size(), serial_data.size());
+  for (const auto& [id, data] : serial_data) {
+    ASSERT_TRUE(parallel_data.count(id));
+    EXPECT_EQ(parallel_data.at(id).backdrop_count, data.backdrop_count);
+    EXPECT_EQ(parallel_data.at(id).all_filters_equal, data.all_filters_equal);
+  }
+  EXPECT_EQ(serial_data.at(1).backdrop_count, 5u);
+  EXPECT_FALSE(serial_data.at(1).all_filters_equal);
+  EXPECT_TRUE(serial_data.at(2).all_filters_equal);
+}
+
+TEST_P(AiksTest, ParallelFirstPassRunsOnBusyWorkers) {
+  flutter::DisplayListBuilder builder;
+  auto blur =
+      flutter::DlImageFilter::MakeBlur(4, 4, flutter::DlTileMode::kClamp);
+  flutter::DlRect rect = flutter::DlRect::MakeLTRB(0, 0, 50, 50);
+  for (int i = 0; i < 4; i++) {
+    builder.SaveLayer(rect, nullptr, blur.get(), /*backdrop_id=*/1);
+    builder.Restore();
+  }
+  auto display_list = builder.Build();
+  Rect cull_rect = Rect::MakeLTRB(0, 0, 1000, 1000);
+
+  // Occupy the only worker until the first pass is done.
+  auto loop = fml::ConcurrentMessageLoop::Create(1);
+  fml::AutoResetWaitableEvent worker_blocked;
+  fml::AutoResetWaitableEvent unblock_worker;
+  loop->GetTaskRunner()->PostTask([&]() {
+    worker_blocked.Signal();
+    unblock_worker.Wait();
+  });
+  worker_blocked.Wait();
+
+  ContentContext context(GetContext(), nullptr);
+  context.SetParallelRecordingTaskRunner(loop->GetTaskRunner());
+  FirstPassDispatcher parallel(context, Matrix(), cull_rect);
+  parallel.DispatchDisplayList(display_list, cull_rect);
+  const auto& [parallel_data, parallel_count] = parallel.TakeBackdropData();
+  context.SetParallelRecordingTaskRunner(nullptr);
+  unblock_worker.Signal();
+
+  EXPECT_EQ(parallel_count, 4u);
+  ASSERT_TRUE(parallel_data.count(1));
+  EXPECT_EQ(parallel_data.at(1).backdrop_count, 4u);
+}
+
 }  // namespace testing
 }  // namespace impeller
@@ -4,9 +4,13 @@
 
 #include "impeller/display_list/dl_atlas_geometry.h"
 
+#include <limits>
+#include <optional>
+
 #include "impeller/core/formats.h"
 #include "impeller/core/vertex_buffer.h"
 #include "impeller/display_list/skia_conversions.h"
+#include "impeller/entity/contents/content_context.h"
 #include "impeller/entity/porter_duff_blend.vert.h"
 #include "impeller/entity/texture_fill.vert.h"
 #include "impeller/geometry/color.h"
@@ -14,6 +18,74 @@
 
 namespace impeller {
 
+namespace {
+
+/// The corners of a sprite quad, in the order of |RSTransform::GetQuad|.
+constexpr size_t kQuadCorners[4] = {0, 1, 2, 3};
+
+/// The corners that make up the two triangles of a sprite quad.
+constexpr size_t kQuadIndices[6] = {0, 1, 2, 1, 2, 3};
+
+struct QuadIndices {
+  BufferView index_buffer;
+  IndexType index_type;
+};
+
+template <typename IndexT>
+BufferView EmplaceQuadIndices(HostBuffer& indexes_host_buffer,
+                              size_t quad_count) {
+  return indexes_host_buffer.Emplace(
+      sizeof(IndexT) * quad_count * 6, alignof(IndexT), [&](uint8_t* raw_data) {
+        IndexT* indices = reinterpret_cast<IndexT*>(raw_data);
+        for (size_t i = 0; i < quad_count; i++) {
+          for (size_t j = 0; j < 6; j++) {
+            *indices++ = static_cast<IndexT>(i * 4 + kQuadIndices[j]);
+          }
+        }
+      });
+}
+
+/// Create the indices that let every sprite share its corner vertices between
+/// its two triangles, or nullopt if the sprites can't be indexed with the
+/// index types the device supports.
+///
+/// This writes two thirds of the vertices the unindexed triangles would need,
+/// and the indices are much smaller than the vertices they replace.
+std::optional<QuadIndices> CreateQuadIndices(const ContentContext& renderer,
+                                             size_t quad_count) {
+  HostBuffer& indexes_host_buffer = renderer.GetTransientsIndexesBuffer();
+  if (quad_count * 4 <= std::numeric_limits<uint16_t>::max() + 1u) {
+    return QuadIndices{
+        .index_buffer =
+            EmplaceQuadIndices<uint16_t>(indexes_host_buffer, quad_count),
+        .index_type = IndexType::k16bit,
+    };
+  }
+  if (renderer.GetDeviceCapabilities().Supports32BitPrimitiveIndices()) {
+    return QuadIndices{
+        .index_buffer =
+            EmplaceQuadIndices<uint32_t>(indexes_host_buffer, quad_count),
+        .index_type = IndexType::k32bit,
+    };
+  }
+  return std::nullopt;
+}
+
+VertexBuffer MakeQuadVertexBuffer(BufferView vertex_buffer,
+                                  const std::optional<QuadIndices>& indices,
+                                  size_t quad_count) {
+  return VertexBuffer{
+      .vertex_buffer = std::move(vertex_buffer),
+      .index_buffer =
+          indices.has_value() ? indices->index_buffer : BufferView{},
+      .vertex_count = quad_count * 6,
+      .index_type =
+          indices.has_value() ? indices->index_type : IndexType::kNone,
+  };
+}
+
+}  // namespace
+
 DlAtlasGeometry::DlAtlasGeometry(const std::shared_ptr<Texture>& atlas,
                                  const RSTransform* xform,
                                  const flutter::DlRect* tex,
@@ -66,14 +138,35 @@ BlendMode DlAtlasGeometry::GetBlendMode() const {
   return mode_;
 }
 
+std::optional<RetainedGeometryCache::AtlasKey>
+DlAtlasGeometry::GetRetentionKey() const {
+  if (!atlas_) {
+    return std::nullopt;
+  }
+  // The arrays are owned by the drawAtlas op of an immutable display list,
+  // and the cache verifies their contents before reusing any vertices.
+  return RetainedGeometryCache::AtlasKey{
+      .xform = xform_,
+      .tex = tex_,
+      .colors = colors_,
+      .colors_length = colors_ ? sizeof(flutter::DlColor) * count_ : 0u,
+      .count = count_,
+      .texture_size = atlas_->GetSize(),
+  };
+}
+
 VertexBuffer DlAtlasGeometry::CreateSimpleVertexBuffer(
-    HostBuffer& data_host_buffer) const {
+    const ContentContext& renderer) const {
   using VS = TextureFillVertexShader;
-  constexpr size_t indices[6] = {0, 1, 2, 1, 2, 3};
 
-  BufferView buffer_view = data_host_buffer.Emplace(
-      sizeof(VS::PerVertexData) * count_ * 6, alignof(VS::PerVertexData),
-      [&](uint8_t* raw_data) {
+  std::optional<QuadIndices> quad_indices = CreateQuadIndices(renderer, count_);
+  const size_t* corners =
+      quad_indices.has_value() ? kQuadCorners : kQuadIndices;
+  const size_t vertices_per_quad = quad_indices.has_value() ? 4u : 6u;
+
+  BufferView buffer_view = renderer.GetTransientsDataBuffer().Emplace(
+      sizeof(VS::PerVertexData) * count_ * vertices_per_quad,
+      alignof(VS::PerVertexData), [&](uint8_t* raw_data) {
         VS::PerVertexData* data =
             reinterpret_cast<VS::PerVertexData*>(raw_data);
         int offset = 0;
@@ -82,30 +175,29 @@ VertexBuffer DlAtlasGeometry::CreateSimpleVertexBuffer(
           flutter::DlRect sample_rect = tex_[i];
           auto points = sample_rect.GetPoints();
           auto transformed_points = xform_[i].GetQuad(sample_rect.GetSize());
-          for (size_t j = 0; j < 6; j++) {
-            data[offset].position = transformed_points[indices[j]];
-            data[offset].texture_coords = points[indices[j]] / texture_size;
+          for (size_t j = 0; j < vertices_per_quad; j++) {
+            data[offset].position = transformed_points[corners[j]];
+            data[offset].texture_coords = points[corners[j]] / texture_size;
             offset += 1;
           }
         }
       });
 
-  return VertexBuffer{
-      .vertex_buffer = buffer_view,
-      .index_buffer = {},
-      .vertex_count = count_ * 6,
-      .index_type = IndexType::kNone,
-  };
+  return MakeQuadVertexBuffer(std::move(buffer_view), quad_indices, count_);
 }
 
 VertexBuffer DlAtlasGeometry::CreateBlendVertexBuffer(
-    HostBuffer& data_host_buffer) const {
+    const ContentContext& renderer) const {
   using VS = PorterDuffBlendVertexShader;
-  constexpr size_t indices[6] = {0, 1, 2, 1, 2, 3};
 
-  BufferView buffer_view = data_host_buffer.Emplace(
-      sizeof(VS::PerVertexData) * count_ * 6, alignof(VS::PerVertexData),
-      [&](uint8_t* raw_data) {
+  std::optional<QuadIndices> quad_indices = CreateQuadIndices(renderer, count_);
+  const size_t* corners =
+      quad_indices.has_value() ? kQuadCorners : kQuadIndices;
+  const size_t vertices_per_quad = quad_indices.has_value() ? 4u : 6u;
+
+  BufferView buffer_view = renderer.GetTransientsDataBuffer().Emplace(
+      sizeof(VS::PerVertexData) * count_ * vertices_per_quad,
+      alignof(VS::PerVertexData), [&](uint8_t* raw_data) {
         VS::PerVertexData* data =
             reinterpret_cast<VS::PerVertexData*>(raw_data);
         int offset = 0;
@@ -114,22 +206,17 @@ VertexBuffer DlAtlasGeometry::CreateBlendVertexBuffer(
           flutter::DlRect sample_rect = tex_[i];
           auto points = sample_rect.GetPoints();
           auto transformed_points = xform_[i].GetQuad(sample_rect.GetSize());
-          for (size_t j = 0; j < 6; j++) {
-            data[offset].vertices = transformed_points[indices[j]];
-            data[offset].texture_coords = points[indices[j]] / texture_size;
-            data[offset].color =
-                skia_conversions::ToColor(colors_[i]).Premultiply();
+          Color color = skia_conversions::ToColor(colors_[i]).Premultiply();
+          for (size_t j = 0; j < vertices_per_quad; j++) {
+            data[offset].vertices = transformed_points[corners[j]];
+            data[offset].texture_coords = points[corners[j]] / texture_size;
+            data[offset].color = color;
             offset += 1;
           }
         }
       });
 
-  return VertexBuffer{
-      .vertex_buffer = buffer_view,
-      .index_buffer = {},
-      .vertex_count = count_ * 6,
-      .index_type = IndexType::kNone,
-  };
+  return MakeQuadVertexBuffer(std::move(buffer_view), quad_indices, count_);
 }
 
 }  // namespace impeller
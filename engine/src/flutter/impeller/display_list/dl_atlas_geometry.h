@@ -32,9 +32,11 @@ class DlAtlasGeometry : public AtlasGeometry {
 
   bool ShouldSkip() const override;
 
-  VertexBuffer CreateSimpleVertexBuffer(HostBuffer& host_buffer) const override;
+  VertexBuffer CreateSimpleVertexBuffer(
+      const ContentContext& renderer) const override;
 
-  VertexBuffer CreateBlendVertexBuffer(HostBuffer& host_buffer) const override;
+  VertexBuffer CreateBlendVertexBuffer(
+      const ContentContext& renderer) const override;
 
   Rect ComputeBoundingBox() const override;
 
@@ -44,6 +46,9 @@ class DlAtlasGeometry : public AtlasGeometry {
 
   BlendMode GetBlendMode() const override;
 
+  std::optional<RetainedGeometryCache::AtlasKey> GetRetentionKey()
+      const override;
+
  private:
   const std::shared_ptr<Texture> atlas_;
   const RSTransform* xform_;
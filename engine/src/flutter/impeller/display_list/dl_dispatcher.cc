@@ -5,6 +5,7 @@
 #include "impeller/display_list/dl_dispatcher.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <memory>
 #include <optional>
@@ -13,6 +14,8 @@
 #include "display_list/dl_sampling_options.h"
 #include "display_list/effects/dl_image_filter.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/time/time_point.h"
+#include "flutter/fml/trace_event.h"
 #include "fml/closure.h"
 #include "impeller/core/formats.h"
 #include "impeller/display_list/aiks_context.h"
@@ -987,20 +990,13 @@ void FirstPassDispatcher::saveLayer(const DlRect& bounds,
 
   backdrop_count_ += (backdrop == nullptr ? 0 : 1);
   if (backdrop != nullptr && backdrop_id.has_value()) {
-    std::shared_ptr<flutter::DlImageFilter> shared_backdrop =
-        backdrop->shared();
-    std::unordered_map<int64_t, BackdropData>::iterator existing =
-        backdrop_data_.find(backdrop_id.value());
-    if (existing == backdrop_data_.end()) {
-      backdrop_data_[backdrop_id.value()] =
-          BackdropData{.backdrop_count = 1, .last_backdrop = shared_backdrop};
+    if (deferred_) {
+      deferred_backdrops_.push_back(DeferredBackdrop{
+          .backdrop_id = backdrop_id.value(),
+          .backdrop = backdrop->shared(),
+      });
     } else {
-      BackdropData& data = existing->second;
-      data.backdrop_count++;
-      if (data.all_filters_equal) {
-        data.all_filters_equal = (*data.last_backdrop == *shared_backdrop);
-        data.last_backdrop = shared_backdrop;
-      }
+      AccumulateBackdrop(backdrop_id.value(), backdrop->shared());
     }
   }
 
@@ -1096,16 +1092,29 @@ void FirstPassDispatcher::drawText(const std::shared_ptr<flutter::DlText>& text,
   }
   auto scale = TextFrame::RoundScaledFontSize(
       (matrix_ * Matrix::MakeTranslation(Point(x, y))).GetMaxBasisLengthXY());
+  std::optional<GlyphProperties> frame_properties =
+      (properties.stroke.has_value() || text_frame->HasColor())
+          ? std::optional<GlyphProperties>(properties)
+          : std::nullopt;
+
+  if (deferred_) {
+    // TextFrame::SetPerFrameData is not thread safe, defer the update until
+    // this collector is merged back on the raster thread.
+    deferred_text_frames_.push_back(DeferredTextFrame{
+        .frame = text_frame,
+        .scale = scale,
+        .offset = Point(x, y),
+        .transform = matrix_,
+        .properties = frame_properties,
+    });
+    return;
+  }
 
-  renderer_.GetLazyGlyphAtlas()->AddTextFrame(
-      text_frame,   //
-      scale,        //
-      Point(x, y),  //
-      matrix_,
-      (properties.stroke.has_value() || text_frame->HasColor())  //
-          ? std::optional<GlyphProperties>(properties)           //
-          : std::nullopt                                         //
-  );
+  renderer_.GetLazyGlyphAtlas()->AddTextFrame(text_frame,   //
+                                              scale,        //
+                                              Point(x, y),  //
+                                              matrix_,      //
+                                              frame_properties);
 }
 
 const Rect FirstPassDispatcher::GetCurrentLocalCullingBounds() const {
@@ -1217,13 +1226,181 @@ FirstPassDispatcher::TakeBackdropData() {
   return std::make_pair(temp, backdrop_count_);
 }
 
+void FirstPassDispatcher::AccumulateBackdrop(
+    int64_t backdrop_id,
+    const std::shared_ptr<flutter::DlImageFilter>& backdrop) {
+  std::unordered_map<int64_t, BackdropData>::iterator existing =
+      backdrop_data_.find(backdrop_id);
+  if (existing == backdrop_data_.end()) {
+    backdrop_data_[backdrop_id] =
+        BackdropData{.backdrop_count = 1, .last_backdrop = backdrop};
+  } else {
+    BackdropData& data = existing->second;
+    data.backdrop_count++;
+    if (data.all_filters_equal) {
+      data.all_filters_equal = (*data.last_backdrop == *backdrop);
+      data.last_backdrop = backdrop;
+    }
+  }
+}
+
+std::unique_ptr<FirstPassDispatcher> FirstPassDispatcher::ForkDeferred()
+    const {
+  FML_DCHECK(stack_.empty());
+  auto fork = std::make_unique<FirstPassDispatcher>(renderer_, matrix_,
+                                                    cull_rect_state_.back());
+  fork->has_image_filter_ = has_image_filter_;
+  fork->paint_ = paint_;
+  fork->deferred_ = true;
+  return fork;
+}
+
+void FirstPassDispatcher::MergeDeferred(const FirstPassDispatcher& deferred) {
+  FML_DCHECK(deferred.deferred_);
+  for (const DeferredTextFrame& text : deferred.deferred_text_frames_) {
+    if (deferred_) {
+      deferred_text_frames_.push_back(text);
+    } else {
+      renderer_.GetLazyGlyphAtlas()->AddTextFrame(
+          text.frame, text.scale, text.offset, text.transform, text.properties);
+    }
+  }
+  for (const DeferredBackdrop& backdrop : deferred.deferred_backdrops_) {
+    if (deferred_) {
+      deferred_backdrops_.push_back(backdrop);
+    } else {
+      AccumulateBackdrop(backdrop.backdrop_id, backdrop.backdrop);
+    }
+  }
+  backdrop_count_ += deferred.backdrop_count_;
+}
+
+namespace {
+// The minimum number of independent top level save layers that must be
+// present before the first pass is split across worker threads. Below this
+// the cost of posting tasks outweighs the parallel benefit.
+constexpr size_t kMinParallelSaveLayerCount = 2u;
+
+struct FirstPassSegment {
+  std::unique_ptr<FirstPassDispatcher> collector;
+  std::vector<flutter::DlIndex> indices;
+  bool is_save_layer = false;
+};
+}  // namespace
+
+void FirstPassDispatcher::DispatchDisplayList(
+    const sk_sp<flutter::DisplayList>& display_list,
+    const DlRect& cull_rect) {
+  const std::shared_ptr<fml::ConcurrentTaskRunner>& task_runner =
+      renderer_.GetParallelRecordingTaskRunner();
+  if (!task_runner || deferred_ || !stack_.empty() || cull_rect.IsEmpty()) {
+    display_list->Dispatch(*this, cull_rect);
+    return;
+  }
+
+  TRACE_EVENT0("impeller", "FirstPassDispatcher::DispatchDisplayList");
+  fml::TimePoint start_time = fml::TimePoint::Now();
+
+  // Split the culled op stream into segments. Every top level save layer and
+  // its matching restore becomes its own segment that can be collected
+  // independently. The ops in between are grouped into inline segments.
+  //
+  // This collector tracks the state at the start of each segment. It only
+  // sees top level transforms and all attributes (which are not scoped by
+  // save and restore), so none of the expensive text or nested display list
+  // ops are visited twice.
+  std::vector<FirstPassSegment> segments;
+  size_t save_layer_count = 0u;
+  size_t depth = 0u;
+  for (flutter::DlIndex index : display_list->GetCulledIndices(cull_rect)) {
+    flutter::DisplayListOpCategory category =
+        display_list->GetOpCategory(index);
+    if (depth == 0u) {
+      bool starts_layer =
+          category == flutter::DisplayListOpCategory::kSaveLayer;
+      if (segments.empty() || starts_layer ||
+          segments.back().is_save_layer) {
+        segments.push_back(FirstPassSegment{
+            .collector = ForkDeferred(),
+            .is_save_layer = starts_layer,
+        });
+        save_layer_count += starts_layer ? 1u : 0u;
+      }
+    }
+    segments.back().indices.push_back(index);
+
+    switch (category) {
+      case flutter::DisplayListOpCategory::kAttribute:
+        display_list->Dispatch(*this, index);
+        break;
+      case flutter::DisplayListOpCategory::kTransform:
+        if (depth == 0u) {
+          display_list->Dispatch(*this, index);
+        }
+        break;
+      case flutter::DisplayListOpCategory::kSave:
+      case flutter::DisplayListOpCategory::kSaveLayer:
+        depth++;
+        break;
+      case flutter::DisplayListOpCategory::kRestore:
+        FML_DCHECK(depth > 0u);
+        depth--;
+        break;
+      default:
+        break;
+    }
+  }
+
+  if (save_layer_count < kMinParallelSaveLayerCount) {
+    // Not enough independent work. Replay the segments serially, they
+    // already hold the state they need.
+    for (FirstPassSegment& segment : segments) {
+      for (flutter::DlIndex index : segment.indices) {
+        display_list->Dispatch(*segment.collector, index);
+      }
+      MergeDeferred(*segment.collector);
+    }
+    return;
+  }
+
+  // The raster thread collects segments too, so a busy worker pool only
+  // delays the frame by the segments its workers have already started.
+  std::atomic<int64_t> segment_micros = 0;
+  task_runner->ParallelFor(
+      segments.size(), /*grain_size=*/1u,
+      [&display_list, &segments, &segment_micros](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+          fml::TimePoint segment_start = fml::TimePoint::Now();
+          FirstPassSegment& segment = segments[i];
+          for (flutter::DlIndex index : segment.indices) {
+            display_list->Dispatch(*segment.collector, index);
+          }
+          segment_micros +=
+              (fml::TimePoint::Now() - segment_start).ToMicroseconds();
+        }
+      });
+
+  for (const FirstPassSegment& segment : segments) {
+    MergeDeferred(*segment.collector);
+  }
+
+  int64_t elapsed_micros = std::max<int64_t>(
+      (fml::TimePoint::Now() - start_time).ToMicroseconds(), 1);
+  FML_TRACE_COUNTER("flutter", "ParallelFirstPass",
+                    reinterpret_cast<int64_t>(&renderer_),  //
+                    "Segments", save_layer_count,           //
+                    "SpeedupPercent",
+                    segment_micros.load() * 100 / elapsed_micros);
+}
+
 std::shared_ptr<Texture> DisplayListToTexture(
     const sk_sp<flutter::DisplayList>& display_list,
     ISize size,
     AiksContext& context,
     bool reset_host_buffer,
     bool generate_mips,
-    std::optional<PixelFormat> target_pixel_format) {
+    std::optional<PixelFormat> target_pixel_format,
+    std::shared_ptr<Texture>* msaa_texture) {
   int mip_count = 1;
   if (generate_mips) {
     mip_count = size.MipCount();
@@ -1236,6 +1413,18 @@ std::shared_ptr<Texture> DisplayListToTexture(
   impeller::RenderTarget target;
   if (context.GetContext()->GetCapabilities()->SupportsOffscreenMSAA() &&
       PixelFormatSupportsMSAA(target_pixel_format)) {
+    // Unlike the resolve texture, the multisample attachment does not outlive
+    // the render pass and may be shared by consecutive snapshots.
+    std::shared_ptr<Texture> existing_color_msaa_texture;
+    if (msaa_texture && *msaa_texture) {
+      const TextureDescriptor& desc = (*msaa_texture)->GetTextureDescriptor();
+      PixelFormat pixel_format = target_pixel_format.value_or(
+          context.GetContext()->GetCapabilities()->GetDefaultColorFormat());
+      if (desc.size == size && desc.format == pixel_format &&
+          desc.sample_count == SampleCount::kCount4) {
+        existing_color_msaa_texture = *msaa_texture;
+      }
+    }
     target = render_target_allocator.CreateOffscreenMSAA(
         *context.GetContext(),  // context
         size,                   // size
@@ -1244,7 +1433,7 @@ std::shared_ptr<Texture> DisplayListToTexture(
         impeller::RenderTarget::
             kDefaultColorAttachmentConfigMSAA,  // color_attachment_config
         std::nullopt,                           // stencil_attachment_config
-        nullptr,                                // existing_color_msaa_texture
+        existing_color_msaa_texture,            // existing_color_msaa_texture
         nullptr,             // existing_color_resolve_texture
         nullptr,             // existing_depth_stencil_texture
         target_pixel_format  // target_format
@@ -1263,14 +1452,25 @@ std::shared_ptr<Texture> DisplayListToTexture(
         target_pixel_format                 // target_format
     );
   }
+  if (msaa_texture) {
+    *msaa_texture = nullptr;
+  }
   if (!target.IsValid()) {
     return nullptr;
   }
+  if (msaa_texture) {
+    // The resolve texture, or the color texture without MSAA, is the result
+    // and must not be reused.
+    ColorAttachment color0 = target.GetColorAttachment(0);
+    if (color0.resolve_texture) {
+      *msaa_texture = color0.texture;
+    }
+  }
 
   DlIRect cull_rect = DlIRect::MakeWH(size.width, size.height);
   impeller::FirstPassDispatcher collector(
       context.GetContentContext(), impeller::Matrix(), Rect::MakeSize(size));
-  display_list->Dispatch(collector, cull_rect);
+  collector.DispatchDisplayList(display_list, DlRect::Make(cull_rect));
   impeller::CanvasDlDispatcher impeller_dispatcher(
       context.GetContentContext(),               //
       target,                                    //
@@ -1282,12 +1482,15 @@ std::shared_ptr<Texture> DisplayListToTexture(
   const auto& [data, count] = collector.TakeBackdropData();
   impeller_dispatcher.SetBackdropData(data, count);
   context.GetContentContext().GetTextShadowCache().MarkFrameStart();
+  context.GetContentContext().GetRetainedGeometryCache().MarkFrameStart();
   fml::ScopedCleanupClosure cleanup([&] {
     if (reset_host_buffer) {
       context.GetContentContext().GetTransientsDataBuffer().Reset();
       context.GetContentContext().GetTransientsIndexesBuffer().Reset();
     }
     context.GetContentContext().GetTextShadowCache().MarkFrameEnd();
+    context.GetContentContext().GetRetainedGeometryCache().MarkFrameEnd();
+    context.GetContentContext().PersistPipelineVariantManifestIfNeeded();
     context.GetContentContext().GetLazyGlyphAtlas()->ResetTextFrames();
     context.GetContext()->DisposeThreadLocalCachedResources();
   });
@@ -1305,7 +1508,7 @@ bool RenderToTarget(ContentContext& context,
                     bool reset_host_buffer,
                     bool is_onscreen) {
   FirstPassDispatcher collector(context, impeller::Matrix(), cull_rect);
-  display_list->Dispatch(collector, cull_rect);
+  collector.DispatchDisplayList(display_list, cull_rect);
 
   impeller::CanvasDlDispatcher impeller_dispatcher(
       context,                                   //
@@ -1318,11 +1521,14 @@ bool RenderToTarget(ContentContext& context,
   const auto& [data, count] = collector.TakeBackdropData();
   impeller_dispatcher.SetBackdropData(data, count);
   context.GetTextShadowCache().MarkFrameStart();
+  context.GetRetainedGeometryCache().MarkFrameStart();
   fml::ScopedCleanupClosure cleanup([&] {
     if (reset_host_buffer) {
       context.ResetTransientsBuffers();
     }
     context.GetTextShadowCache().MarkFrameEnd();
+    context.GetRetainedGeometryCache().MarkFrameEnd();
+    context.PersistPipelineVariantManifestIfNeeded();
   });
 
   display_list->Dispatch(impeller_dispatcher, cull_rect);
@@ -383,7 +383,44 @@ class FirstPassDispatcher : public flutter::IgnoreAttributeDispatchHelper,
   std::pair<std::unordered_map<int64_t, BackdropData>, size_t>
   TakeBackdropData();
 
+  /// @brief Dispatch |display_list| into this collector.
+  ///
+  /// When the content context has a parallel recording task runner, the
+  /// top level save layer subtrees are collected on the workers of that
+  /// runner and merged back in op order. Otherwise this is equivalent to
+  /// dispatching the display list directly.
+  void DispatchDisplayList(const sk_sp<flutter::DisplayList>& display_list,
+                           const DlRect& cull_rect);
+
  private:
+  struct DeferredTextFrame {
+    std::shared_ptr<TextFrame> frame;
+    Rational scale;
+    Point offset;
+    Matrix transform;
+    std::optional<GlyphProperties> properties;
+  };
+
+  struct DeferredBackdrop {
+    int64_t backdrop_id;
+    std::shared_ptr<flutter::DlImageFilter> backdrop;
+  };
+
+  /// Creates a collector that starts from the current transform and paint
+  /// state of this collector, but which defers all text frame and backdrop
+  /// bookkeeping until it is merged back with |MergeDeferred|.
+  ///
+  /// Must only be called at the top level of the save stack.
+  std::unique_ptr<FirstPassDispatcher> ForkDeferred() const;
+
+  /// Applies the text frames and backdrops recorded by a deferred collector
+  /// as if they had been dispatched to this collector directly.
+  void MergeDeferred(const FirstPassDispatcher& deferred);
+
+  void AccumulateBackdrop(
+      int64_t backdrop_id,
+      const std::shared_ptr<flutter::DlImageFilter>& backdrop);
+
   const Rect GetCurrentLocalCullingBounds() const;
 
   const ContentContext& renderer_;
@@ -395,16 +432,26 @@ class FirstPassDispatcher : public flutter::IgnoreAttributeDispatchHelper,
   bool has_image_filter_ = false;
   size_t backdrop_count_ = 0;
   Paint paint_;
+  bool deferred_ = false;
+  std::vector<DeferredTextFrame> deferred_text_frames_;
+  std::vector<DeferredBackdrop> deferred_backdrops_;
 };
 
 /// Render the provided display list to a texture with the given size.
+///
+/// If [msaa_texture] is not null and points to a multisample texture that
+/// matches the size and format of the render target, it is used as the
+/// multisample color attachment instead of allocating a new one. On return it
+/// points to the multisample attachment that was used, if any, so that it can
+/// be reused by a later call.
 std::shared_ptr<Texture> DisplayListToTexture(
     const sk_sp<flutter::DisplayList>& display_list,
     ISize size,
     AiksContext& context,
     bool reset_host_buffer = true,
     bool generate_mips = false,
-    std::optional<PixelFormat> target_pixel_format = std::nullopt);
+    std::optional<PixelFormat> target_pixel_format = std::nullopt,
+    std::shared_ptr<Texture>* msaa_texture = nullptr);
 
 /// @brief Render the provided display list to the render target.
 ///
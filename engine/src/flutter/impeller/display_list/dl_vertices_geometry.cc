@@ -8,6 +8,7 @@
 #include "impeller/core/formats.h"
 #include "impeller/display_list/skia_conversions.h"
 #include "impeller/entity/contents/pipelines.h"
+#include "impeller/entity/geometry/retained_geometry_cache.h"
 #include "impeller/geometry/point.h"
 
 namespace impeller {
@@ -31,6 +32,7 @@ static std::vector<uint16_t> fromFanIndices(size_t vertex_count,
       return {};
     }
 
+    unrolled_indices.reserve((index_count - 2) * 3);
     auto center_point = indices[0];
     for (auto i = 1u; i < index_count - 1; i++) {
       unrolled_indices.push_back(center_point);
@@ -44,6 +46,7 @@ static std::vector<uint16_t> fromFanIndices(size_t vertex_count,
 
     // If indices were not provided, create an index buffer that unfans
     // triangles instead of re-writing points, colors, et cetera.
+    unrolled_indices.reserve((vertex_count - 2) * 3);
     for (auto i = 1u; i < vertex_count - 1; i++) {
       unrolled_indices.push_back(0);
       unrolled_indices.push_back(i);
@@ -112,34 +115,56 @@ std::optional<Rect> DlVerticesGeometry::GetTextureCoordinateCoverage() const {
   return Rect::MakeLTRB(left, top, right, bottom);
 }
 
-GeometryResult DlVerticesGeometry::GetPositionBuffer(
-    const ContentContext& renderer,
-    const Entity& entity,
-    RenderPass& pass) const {
-  int vertex_count = vertices_->vertex_count();
-  BufferView vertex_buffer = renderer.GetTransientsDataBuffer().Emplace(
-      vertices_->vertex_data(), vertex_count * sizeof(Point), alignof(Point));
-
-  BufferView index_buffer = {};
+BufferView DlVerticesGeometry::EmplaceIndices(
+    const ContentContext& renderer) const {
   auto index_count =
       performed_normalization_ ? indices_.size() : vertices_->index_count();
   const uint16_t* indices_data =
       performed_normalization_ ? indices_.data() : vertices_->indices();
-  if (index_count) {
-    index_buffer = renderer.GetTransientsIndexesBuffer().Emplace(
-        indices_data, index_count * sizeof(uint16_t), alignof(uint16_t));
+  if (index_count == 0) {
+    return {};
+  }
+  return renderer.GetTransientsIndexesBuffer().Emplace(
+      indices_data, index_count * sizeof(uint16_t), alignof(uint16_t));
+}
+
+VertexBuffer DlVerticesGeometry::MakeVertexBuffer(
+    BufferView vertex_buffer,
+    BufferView index_buffer) const {
+  size_t index_count =
+      performed_normalization_ ? indices_.size() : vertices_->index_count();
+  return VertexBuffer{
+      .vertex_buffer = std::move(vertex_buffer),
+      .index_buffer = std::move(index_buffer),
+      .vertex_count = index_count > 0
+                          ? index_count
+                          : static_cast<size_t>(vertices_->vertex_count()),
+      .index_type = index_count > 0 ? IndexType::k16bit : IndexType::kNone,
+  };
+}
+
+GeometryResult DlVerticesGeometry::GetPositionBuffer(
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass) const {
+  RetainedGeometryCache& cache = renderer.GetRetainedGeometryCache();
+  std::optional<VertexBuffer> vertex_buffer =
+      cache.LookupVertices(vertices_, std::nullopt);
+  if (!vertex_buffer.has_value()) {
+    int vertex_count = vertices_->vertex_count();
+    vertex_buffer = MakeVertexBuffer(
+        renderer.GetTransientsDataBuffer().Emplace(
+            vertices_->vertex_data(), vertex_count * sizeof(Point),
+            alignof(Point)),
+        EmplaceIndices(renderer));
+    cache.OfferVertices(vertices_, std::nullopt, vertex_buffer.value(),
+                        vertex_count,
+                        *renderer.GetContext()->GetResourceAllocator());
   }
 
   return GeometryResult{
       .type = GetPrimitiveType(),
-      .vertex_buffer =
-          {
-              .vertex_buffer = vertex_buffer,
-              .index_buffer = index_buffer,
-              .vertex_count = index_count > 0 ? index_count : vertex_count,
-              .index_type =
-                  index_count > 0 ? IndexType::k16bit : IndexType::kNone,
-          },
+      .vertex_buffer = std::move(vertex_buffer.value()),
       .transform = entity.GetShaderTransform(pass),
   };
 }
@@ -152,9 +177,19 @@ GeometryResult DlVerticesGeometry::GetPositionUVColorBuffer(
     RenderPass& pass) const {
   using VS = PorterDuffBlendPipeline::VertexShader;
 
-  int vertex_count = vertices_->vertex_count();
   Matrix uv_transform =
       texture_coverage.GetNormalizingTransform() * effect_transform;
+  RetainedGeometryCache& cache = renderer.GetRetainedGeometryCache();
+  if (std::optional<VertexBuffer> retained =
+          cache.LookupVertices(vertices_, uv_transform)) {
+    return GeometryResult{
+        .type = GetPrimitiveType(),
+        .vertex_buffer = std::move(retained.value()),
+        .transform = entity.GetShaderTransform(pass),
+    };
+  }
+
+  int vertex_count = vertices_->vertex_count();
   bool has_texture_coordinates = HasTextureCoordinates();
   bool has_colors = HasVertexColors();
 
@@ -181,26 +216,14 @@ GeometryResult DlVerticesGeometry::GetPositionUVColorBuffer(
         }
       });
 
-  BufferView index_buffer = {};
-  auto index_count =
-      performed_normalization_ ? indices_.size() : vertices_->index_count();
-  const uint16_t* indices_data =
-      performed_normalization_ ? indices_.data() : vertices_->indices();
-  if (index_count) {
-    index_buffer = renderer.GetTransientsIndexesBuffer().Emplace(
-        indices_data, index_count * sizeof(uint16_t), alignof(uint16_t));
-  }
+  VertexBuffer result =
+      MakeVertexBuffer(std::move(vertex_buffer), EmplaceIndices(renderer));
+  cache.OfferVertices(vertices_, uv_transform, result, vertex_count,
+                      *renderer.GetContext()->GetResourceAllocator());
 
   return GeometryResult{
       .type = GetPrimitiveType(),
-      .vertex_buffer =
-          {
-              .vertex_buffer = vertex_buffer,
-              .index_buffer = index_buffer,
-              .vertex_count = index_count > 0 ? index_count : vertex_count,
-              .index_type =
-                  index_count > 0 ? IndexType::k16bit : IndexType::kNone,
-          },
+      .vertex_buffer = std::move(result),
       .transform = entity.GetShaderTransform(pass),
   };
 }
@@ -7,6 +7,7 @@
 
 #include "flutter/display_list/dl_vertices.h"
 #include "impeller/core/formats.h"
+#include "impeller/core/vertex_buffer.h"
 #include "impeller/entity/geometry/vertices_geometry.h"
 
 namespace impeller {
@@ -52,6 +53,13 @@ class DlVerticesGeometry final : public VerticesGeometry {
   /// indices.
   bool MaybePerformIndexNormalization(const ContentContext& renderer);
 
+  /// @brief Emplace the (possibly normalized) indices into the transient
+  ///        index buffer, returning an empty view if there are no indices.
+  BufferView EmplaceIndices(const ContentContext& renderer) const;
+
+  VertexBuffer MakeVertexBuffer(BufferView vertex_buffer,
+                                BufferView index_buffer) const;
+
   const std::shared_ptr<const flutter::DlVertices> vertices_;
   std::vector<uint16_t> indices_;
   bool performed_normalization_ = false;
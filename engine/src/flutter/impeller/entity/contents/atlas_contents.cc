@@ -17,6 +17,30 @@
 
 namespace impeller {
 
+namespace {
+VertexBuffer CreateAtlasVertexBuffer(const ContentContext& renderer,
+                                     const AtlasGeometry& geometry,
+                                     bool blend) {
+  std::optional<RetainedGeometryCache::AtlasKey> key =
+      geometry.GetRetentionKey();
+  if (!key.has_value()) {
+    return blend ? geometry.CreateBlendVertexBuffer(renderer)
+                 : geometry.CreateSimpleVertexBuffer(renderer);
+  }
+  key->blend = blend;
+  RetainedGeometryCache& cache = renderer.GetRetainedGeometryCache();
+  if (std::optional<VertexBuffer> retained = cache.LookupAtlas(key.value())) {
+    return std::move(retained.value());
+  }
+  VertexBuffer vertex_buffer =
+      blend ? geometry.CreateBlendVertexBuffer(renderer)
+            : geometry.CreateSimpleVertexBuffer(renderer);
+  cache.OfferAtlas(key.value(), vertex_buffer,
+                   *renderer.GetContext()->GetResourceAllocator());
+  return vertex_buffer;
+}
+}  // namespace
+
 DrawImageRectAtlasGeometry::DrawImageRectAtlasGeometry(
     std::shared_ptr<Texture> texture,
     const Rect& source,
@@ -44,11 +68,11 @@ bool DrawImageRectAtlasGeometry::ShouldSkip() const {
 }
 
 VertexBuffer DrawImageRectAtlasGeometry::CreateSimpleVertexBuffer(
-    HostBuffer& data_host_buffer) const {
+    const ContentContext& renderer) const {
   using VS = TextureFillVertexShader;
   constexpr size_t indices[6] = {0, 1, 2, 1, 2, 3};
 
-  BufferView buffer_view = data_host_buffer.Emplace(
+  BufferView buffer_view = renderer.GetTransientsDataBuffer().Emplace(
       sizeof(VS::PerVertexData) * 6, alignof(VS::PerVertexData),
       [&](uint8_t* raw_data) {
         VS::PerVertexData* data =
@@ -74,11 +98,11 @@ VertexBuffer DrawImageRectAtlasGeometry::CreateSimpleVertexBuffer(
 }
 
 VertexBuffer DrawImageRectAtlasGeometry::CreateBlendVertexBuffer(
-    HostBuffer& data_host_buffer) const {
+    const ContentContext& renderer) const {
   using VS = PorterDuffBlendVertexShader;
   constexpr size_t indices[6] = {0, 1, 2, 1, 2, 3};
 
-  BufferView buffer_view = data_host_buffer.Emplace(
+  BufferView buffer_view = renderer.GetTransientsDataBuffer().Emplace(
       sizeof(VS::PerVertexData) * 6, alignof(VS::PerVertexData),
       [&](uint8_t* raw_data) {
         VS::PerVertexData* data =
@@ -184,7 +208,8 @@ bool AtlasContents::Render(const ContentContext& renderer,
         pipeline_options.blend_mode == BlendMode::kSrc;
 
     pass.SetPipeline(renderer.GetTexturePipeline(pipeline_options));
-    pass.SetVertexBuffer(geometry_->CreateSimpleVertexBuffer(data_host_buffer));
+    pass.SetVertexBuffer(
+        CreateAtlasVertexBuffer(renderer, *geometry_, /*blend=*/false));
 #ifdef IMPELLER_DEBUG
     pass.SetCommandLabel("DrawAtlas");
 #endif  // IMPELLER_DEBUG
@@ -212,7 +237,8 @@ bool AtlasContents::Render(const ContentContext& renderer,
 #ifdef IMPELLER_DEBUG
     pass.SetCommandLabel("DrawAtlas Blend");
 #endif  // IMPELLER_DEBUG
-    pass.SetVertexBuffer(geometry_->CreateBlendVertexBuffer(data_host_buffer));
+    pass.SetVertexBuffer(
+        CreateAtlasVertexBuffer(renderer, *geometry_, /*blend=*/true));
     BlendMode inverted_blend_mode =
         geometry_->ShouldInvertBlendMode()
             ? (InvertPorterDuffBlend(blend_mode).value_or(BlendMode::kSrc))
@@ -256,7 +282,8 @@ bool AtlasContents::Render(const ContentContext& renderer,
 #ifdef IMPELLER_DEBUG
   pass.SetCommandLabel("DrawAtlas Advanced Blend");
 #endif  // IMPELLER_DEBUG
-  pass.SetVertexBuffer(geometry_->CreateBlendVertexBuffer(data_host_buffer));
+  pass.SetVertexBuffer(
+      CreateAtlasVertexBuffer(renderer, *geometry_, /*blend=*/true));
 
   pass.SetPipeline(renderer.GetDrawVerticesUberPipeline(
       blend_mode, OptionsFromPassAndEntity(pass, entity)));
@@ -330,7 +357,7 @@ bool ColorFilterAtlasContents::Render(const ContentContext& renderer,
 #ifdef IMPELLER_DEBUG
   pass.SetCommandLabel("Atlas ColorFilter");
 #endif  // IMPELLER_DEBUG
-  pass.SetVertexBuffer(geometry_->CreateSimpleVertexBuffer(data_host_buffer));
+  pass.SetVertexBuffer(geometry_->CreateSimpleVertexBuffer(renderer));
   pass.SetPipeline(
       renderer.GetColorMatrixColorFilterPipeline(OptionsFromPass(pass)));
 
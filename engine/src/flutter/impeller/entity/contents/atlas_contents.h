@@ -10,6 +10,7 @@
 #include "impeller/core/sampler_descriptor.h"
 #include "impeller/entity/contents/contents.h"
 #include "impeller/entity/entity.h"
+#include "impeller/entity/geometry/retained_geometry_cache.h"
 #include "impeller/geometry/color.h"
 
 namespace impeller {
@@ -25,10 +26,10 @@ class AtlasGeometry {
   virtual bool ShouldSkip() const = 0;
 
   virtual VertexBuffer CreateSimpleVertexBuffer(
-      HostBuffer& host_buffer) const = 0;
+      const ContentContext& renderer) const = 0;
 
   virtual VertexBuffer CreateBlendVertexBuffer(
-      HostBuffer& host_buffer) const = 0;
+      const ContentContext& renderer) const = 0;
 
   virtual Rect ComputeBoundingBox() const = 0;
 
@@ -45,6 +46,16 @@ class AtlasGeometry {
   ///
   /// See also `Canvas::AttemptColorFilterOptimization`
   virtual std::optional<Rect> GetStrictSrcRect() const { return std::nullopt; }
+
+  /// @brief The inputs the vertices are generated from if they are immutable
+  ///        and the vertices may be retained across frames, or nullopt.
+  ///
+  /// The |RetainedGeometryCache::AtlasKey::blend| flag is filled in by the
+  /// caller depending on which vertex buffer is created.
+  virtual std::optional<RetainedGeometryCache::AtlasKey> GetRetentionKey()
+      const {
+    return std::nullopt;
+  }
 };
 
 /// @brief An atlas geometry that adapts for drawImageRect.
@@ -64,9 +75,11 @@ class DrawImageRectAtlasGeometry : public AtlasGeometry {
 
   bool ShouldSkip() const override;
 
-  VertexBuffer CreateSimpleVertexBuffer(HostBuffer& host_buffer) const override;
+  VertexBuffer CreateSimpleVertexBuffer(
+      const ContentContext& renderer) const override;
 
-  VertexBuffer CreateBlendVertexBuffer(HostBuffer& host_buffer) const override;
+  VertexBuffer CreateBlendVertexBuffer(
+      const ContentContext& renderer) const override;
 
   Rect ComputeBoundingBox() const override;
 
@@ -9,7 +9,6 @@
 #include "impeller/entity/contents/gradient_generator.h"
 #include "impeller/entity/entity.h"
 #include "impeller/entity/geometry/geometry.h"
-#include "impeller/geometry/gradient.h"
 #include "impeller/renderer/render_pass.h"
 
 namespace impeller {
@@ -192,9 +191,8 @@ bool ConicalGradientContents::RenderTexture(const ContentContext& renderer,
   using VS = ConicalGradientFillConicalPipeline::VertexShader;
   using FS = ConicalGradientFillConicalPipeline::FragmentShader;
 
-  auto gradient_data = CreateGradientBuffer(colors_, stops_);
-  auto gradient_texture =
-      CreateGradientTexture(gradient_data, renderer.GetContext());
+  auto gradient_texture = renderer.GetGradientTextureCache().GetOrCreate(
+      colors_, stops_, renderer.GetContext());
   if (gradient_texture == nullptr) {
     return false;
   }
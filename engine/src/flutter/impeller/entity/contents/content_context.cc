@@ -6,6 +6,8 @@
 
 #include <format>
 #include <memory>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 
 #include "fml/trace_event.h"
@@ -13,6 +15,7 @@
 #include "impeller/core/formats.h"
 #include "impeller/core/texture_descriptor.h"
 #include "impeller/entity/contents/framebuffer_blend_contents.h"
+#include "impeller/entity/contents/pipeline_variant_manifest.h"
 #include "impeller/entity/contents/pipelines.h"
 #include "impeller/entity/contents/text_shadow_cache.h"
 #include "impeller/entity/entity.h"
@@ -26,6 +29,10 @@
 #include "impeller/tessellator/tessellator.h"
 #include "impeller/typographer/typographer_context.h"
 
+#ifdef IMPELLER_ENABLE_COMPUTE
+#include "impeller/renderer/compute_tessellator.h"
+#endif  // IMPELLER_ENABLE_COMPUTE
+
 namespace impeller {
 
 namespace {
@@ -33,6 +40,8 @@ namespace {
 /// A generic version of `Variants` which mostly exists to reduce code size.
 class GenericVariants {
  public:
+  virtual ~GenericVariants() = default;
+
   void Set(const ContentContextOptions& options,
            std::unique_ptr<GenericRenderPipelineHandle> pipeline) {
     uint64_t p_key = options.ToKey();
@@ -73,7 +82,46 @@ class GenericVariants {
            opts.ToKey() == default_options_.value().ToKey();
   }
 
+  void SetName(std::string_view name) { name_ = name; }
+
+  std::string_view GetName() const { return name_; }
+
+  /// Start compiling the variant for |options| without waiting for it or for
+  /// the default pipeline. A later |CreateIfNeeded| for the same options
+  /// picks up the pending variant instead of compiling it synchronously.
+  void WarmUp(const Context& context, const ContentContextOptions& options) {
+    if (Get(options) != nullptr) {
+      return;
+    }
+    if (IsDefault(options)) {
+      // A deferred default is compiled from its declared descriptor.
+      if (desc_.has_value()) {
+        Set(options, MakeHandle(context.GetPipelineLibrary()->GetPipeline(
+                         desc_, /*async=*/true)));
+      }
+      return;
+    }
+    std::optional<PipelineDescriptor> desc = desc_;
+    if (!desc.has_value() && default_options_.has_value()) {
+      if (GenericRenderPipelineHandle* handle = Get(default_options_.value())) {
+        desc = handle->GetDescriptor();
+      }
+    }
+    if (!desc.has_value()) {
+      return;
+    }
+    options.ApplyToPipelineDescriptor(*desc);
+    desc->SetLabel(
+        std::format("{} V#{}", desc->GetLabel(), GetPipelineCount()));
+    Set(options, MakeHandle(context.GetPipelineLibrary()->GetPipeline(
+                     std::move(desc), /*async=*/true)));
+  }
+
  protected:
+  virtual std::unique_ptr<GenericRenderPipelineHandle> MakeHandle(
+      PipelineFuture<PipelineDescriptor> future) const = 0;
+
+  std::string_view name_;
   std::optional<PipelineDescriptor> desc_;
   std::optional<ContentContextOptions> default_options_;
   std::vector<std::pair<uint64_t, std::unique_ptr<GenericRenderPipelineHandle>>>
@@ -118,22 +166,17 @@ class Variants : public GenericVariants {
   void CreateDefault(const Context& context,
                      const ContentContextOptions& options,
                      const std::vector<Scalar>& constants = {}) {
-    std::optional<PipelineDescriptor> desc =
-        PipelineHandleT::Builder::MakeDefaultPipelineDescriptor(context,
-                                                                constants);
-    if (!desc.has_value()) {
-      VALIDATION_LOG << "Failed to create default pipeline.";
-      return;
-    }
-    context.GetPipelineLibrary()->LogPipelineCreation(*desc);
-    options.ApplyToPipelineDescriptor(*desc);
-    desc_ = desc;
-    if (context.GetFlags().lazy_shader_mode) {
-      SetDefault(options, nullptr);
-    } else {
-      SetDefault(options, std::make_unique<PipelineHandleT>(context, desc_,
-                                                            /*async=*/true));
-    }
+    DeclareDefault(context, options, constants,
+                   /*compile=*/!context.GetFlags().lazy_shader_mode);
+  }
+
+  /// Like |CreateDefault|, but the default pipeline is only compiled when it
+  /// is first requested or warmed up. Meant for specializations that most
+  /// frames never use.
+  void CreateDeferredDefault(const Context& context,
+                             const ContentContextOptions& options,
+                             const std::vector<Scalar>& constants) {
+    DeclareDefault(context, options, constants, /*compile=*/false);
   }
 
   PipelineHandleT* Get(const ContentContextOptions& options) const {
@@ -155,6 +198,33 @@ class Variants : public GenericVariants {
   }
 
  private:
+  std::unique_ptr<GenericRenderPipelineHandle> MakeHandle(
+      PipelineFuture<PipelineDescriptor> future) const override {
+    return std::make_unique<PipelineHandleT>(std::move(future));
+  }
+
+  void DeclareDefault(const Context& context,
+                      const ContentContextOptions& options,
+                      const std::vector<Scalar>& constants,
+                      bool compile) {
+    std::optional<PipelineDescriptor> desc =
+        PipelineHandleT::Builder::MakeDefaultPipelineDescriptor(context,
+                                                                constants);
+    if (!desc.has_value()) {
+      VALIDATION_LOG << "Failed to create default pipeline.";
+      return;
+    }
+    context.GetPipelineLibrary()->LogPipelineCreation(*desc);
+    options.ApplyToPipelineDescriptor(*desc);
+    desc_ = desc;
+    if (compile) {
+      SetDefault(options, std::make_unique<PipelineHandleT>(context, desc_,
+                                                            /*async=*/true));
+    } else {
+      SetDefault(options, nullptr);
+    }
+  }
+
   Variants(const Variants&) = delete;
 
   Variants& operator=(const Variants&) = delete;
@@ -176,6 +246,11 @@ RenderPipelineHandleT* CreateIfNeeded(
   RenderPipelineHandleT* default_handle =
       container.GetDefault(*context->GetContext());
   if (container.IsDefault(opts)) {
+    // The default was deferred. Record it so that later launches warm it up
+    // along with the other variants.
+    if (default_handle != nullptr) {
+      context->RecordPipelineVariant(container.GetName(), opts);
+    }
     return default_handle;
   }
 
@@ -197,6 +272,7 @@ RenderPipelineHandleT* CreateIfNeeded(
   std::unique_ptr<RenderPipelineHandleT> variant =
       std::make_unique<RenderPipelineHandleT>(std::move(variant_future));
   container.Set(opts, std::move(variant));
+  context->RecordPipelineVariant(container.GetName(), opts);
   return container.Get(opts);
 }
 
@@ -288,6 +364,7 @@ struct ContentContext::Pipelines {
   Variants<RadialGradientFillPipeline> radial_gradient_fill;
   Variants<RadialGradientSSBOFillPipeline> radial_gradient_ssbo_fill;
   Variants<RadialGradientUniformFillPipeline> radial_gradient_uniform_fill;
+  Variants<RoundRectPipeline> round_rect;
   Variants<RRectBlurPipeline> rrect_blur;
   Variants<RSuperellipseBlurPipeline> rsuperellipse_blur;
   Variants<ShadowVerticesShader> shadow_vertices_;
@@ -315,8 +392,156 @@ struct ContentContext::Pipelines {
   Variants<TextureDownsampleGlesPipeline> texture_downsample_gles;
 #endif  // IMPELLER_ENABLE_OPENGLES
   // clang-format on
+
+  std::unordered_map<RuntimeEffectPipelineKey,
+                     std::shared_ptr<Pipeline<PipelineDescriptor>>,
+                     RuntimeEffectPipelineKey::Hash,
+                     RuntimeEffectPipelineKey::Equal>
+      runtime_effects;
+
+  PipelineVariantManifest variant_manifest;
+
+  /// Visit every variant container along with a name for it that is stable
+  /// across runs.
+  template <typename Visitor>
+  void ForEach(const Visitor& visitor) {
+    // clang-format off
+    visitor("blend_colorburn", blend_colorburn);
+    visitor("blend_colordodge", blend_colordodge);
+    visitor("blend_color", blend_color);
+    visitor("blend_darken", blend_darken);
+    visitor("blend_difference", blend_difference);
+    visitor("blend_exclusion", blend_exclusion);
+    visitor("blend_hardlight", blend_hardlight);
+    visitor("blend_hue", blend_hue);
+    visitor("blend_lighten", blend_lighten);
+    visitor("blend_luminosity", blend_luminosity);
+    visitor("blend_multiply", blend_multiply);
+    visitor("blend_overlay", blend_overlay);
+    visitor("blend_saturation", blend_saturation);
+    visitor("blend_screen", blend_screen);
+    visitor("blend_softlight", blend_softlight);
+    visitor("border_mask_blur", border_mask_blur);
+    visitor("circle", circle);
+    visitor("clip", clip);
+    visitor("color_matrix_color_filter", color_matrix_color_filter);
+    visitor("conical_gradient_fill", conical_gradient_fill);
+    visitor("conical_gradient_fill_radial", conical_gradient_fill_radial);
+    visitor("conical_gradient_fill_strip", conical_gradient_fill_strip);
+    visitor("conical_gradient_fill_strip_and_radial", conical_gradient_fill_strip_and_radial);
+    visitor("conical_gradient_ssbo_fill", conical_gradient_ssbo_fill);
+    visitor("conical_gradient_ssbo_fill_radial", conical_gradient_ssbo_fill_radial);
+    visitor("conical_gradient_ssbo_fill_strip_and_radial", conical_gradient_ssbo_fill_strip_and_radial);
+    visitor("conical_gradient_ssbo_fill_strip", conical_gradient_ssbo_fill_strip);
+    visitor("conical_gradient_uniform_fill", conical_gradient_uniform_fill);
+    visitor("conical_gradient_uniform_fill_radial", conical_gradient_uniform_fill_radial);
+    visitor("conical_gradient_uniform_fill_strip", conical_gradient_uniform_fill_strip);
+    visitor("conical_gradient_uniform_fill_strip_and_radial", conical_gradient_uniform_fill_strip_and_radial);
+    visitor("fast_gradient", fast_gradient);
+    visitor("framebuffer_blend_colorburn", framebuffer_blend_colorburn);
+    visitor("framebuffer_blend_colordodge", framebuffer_blend_colordodge);
+    visitor("framebuffer_blend_color", framebuffer_blend_color);
+    visitor("framebuffer_blend_darken", framebuffer_blend_darken);
+    visitor("framebuffer_blend_difference", framebuffer_blend_difference);
+    visitor("framebuffer_blend_exclusion", framebuffer_blend_exclusion);
+    visitor("framebuffer_blend_hardlight", framebuffer_blend_hardlight);
+    visitor("framebuffer_blend_hue", framebuffer_blend_hue);
+    visitor("framebuffer_blend_lighten", framebuffer_blend_lighten);
+    visitor("framebuffer_blend_luminosity", framebuffer_blend_luminosity);
+    visitor("framebuffer_blend_multiply", framebuffer_blend_multiply);
+    visitor("framebuffer_blend_overlay", framebuffer_blend_overlay);
+    visitor("framebuffer_blend_saturation", framebuffer_blend_saturation);
+    visitor("framebuffer_blend_screen", framebuffer_blend_screen);
+    visitor("framebuffer_blend_softlight", framebuffer_blend_softlight);
+    visitor("gaussian_blur", gaussian_blur);
+    visitor("glyph_atlas", glyph_atlas);
+    visitor("line", line);
+    visitor("linear_gradient_fill", linear_gradient_fill);
+    visitor("linear_gradient_ssbo_fill", linear_gradient_ssbo_fill);
+    visitor("linear_gradient_uniform_fill", linear_gradient_uniform_fill);
+    visitor("linear_to_srgb_filter", linear_to_srgb_filter);
+    visitor("morphology_filter", morphology_filter);
+    visitor("clear_blend", clear_blend);
+    visitor("destination_a_top_blend", destination_a_top_blend);
+    visitor("destination_blend", destination_blend);
+    visitor("destination_in_blend", destination_in_blend);
+    visitor("destination_out_blend", destination_out_blend);
+    visitor("destination_over_blend", destination_over_blend);
+    visitor("modulate_blend", modulate_blend);
+    visitor("plus_blend", plus_blend);
+    visitor("screen_blend", screen_blend);
+    visitor("source_a_top_blend", source_a_top_blend);
+    visitor("source_blend", source_blend);
+    visitor("source_in_blend", source_in_blend);
+    visitor("source_out_blend", source_out_blend);
+    visitor("source_over_blend", source_over_blend);
+    visitor("xor_blend", xor_blend);
+    visitor("radial_gradient_fill", radial_gradient_fill);
+    visitor("radial_gradient_ssbo_fill", radial_gradient_ssbo_fill);
+    visitor("radial_gradient_uniform_fill", radial_gradient_uniform_fill);
+    visitor("round_rect", round_rect);
+    visitor("rrect_blur", rrect_blur);
+    visitor("rsuperellipse_blur", rsuperellipse_blur);
+    visitor("shadow_vertices_", shadow_vertices_);
+    visitor("solid_fill", solid_fill);
+    visitor("srgb_to_linear_filter", srgb_to_linear_filter);
+    visitor("sweep_gradient_fill", sweep_gradient_fill);
+    visitor("sweep_gradient_ssbo_fill", sweep_gradient_ssbo_fill);
+    visitor("sweep_gradient_uniform_fill", sweep_gradient_uniform_fill);
+    visitor("texture_downsample", texture_downsample);
+    visitor("texture_downsample_bounded", texture_downsample_bounded);
+    visitor("texture", texture);
+    visitor("texture_strict_src", texture_strict_src);
+    visitor("tiled_texture", tiled_texture);
+    visitor("vertices_uber_1_", vertices_uber_1_);
+    visitor("vertices_uber_2_", vertices_uber_2_);
+    visitor("yuv_to_rgb_filter", yuv_to_rgb_filter);
+#if defined(IMPELLER_ENABLE_OPENGLES) && !defined(FML_OS_EMSCRIPTEN)
+    visitor("tiled_texture_external", tiled_texture_external);
+    visitor("tiled_texture_uv_external", tiled_texture_uv_external);
+#endif
+#if defined(IMPELLER_ENABLE_OPENGLES)
+    visitor("texture_downsample_gles", texture_downsample_gles);
+#endif  // IMPELLER_ENABLE_OPENGLES
+    // clang-format on
+  }
 };
 
+std::optional<ContentContextOptions> ContentContextOptions::FromKey(
+    uint64_t key) {
+  // Bit 1 and bits 4-7 are unused, as is the top byte.
+  constexpr uint64_t kUnusedBits = 0xFF000000000000F2;
+  if ((key & kUnusedBits) != 0) {
+    return std::nullopt;
+  }
+  auto sample_count = static_cast<SampleCount>((key >> 48) & 0xFF);
+  auto blend_mode = static_cast<BlendMode>((key >> 40) & 0xFF);
+  auto depth_compare = static_cast<CompareFunction>((key >> 32) & 0xFF);
+  auto stencil_mode = static_cast<StencilMode>((key >> 24) & 0xFF);
+  auto primitive_type = static_cast<PrimitiveType>((key >> 16) & 0xFF);
+  auto pixel_format = static_cast<PixelFormat>((key >> 8) & 0xFF);
+  if ((sample_count != SampleCount::kCount1 &&
+       sample_count != SampleCount::kCount4) ||
+      blend_mode > Entity::kLastPipelineBlendMode ||
+      depth_compare > CompareFunction::kGreaterEqual ||
+      stencil_mode > StencilMode::kCoverCompareInverted ||
+      primitive_type > PrimitiveType::kTriangleFan ||
+      pixel_format > PixelFormat::kBC7UNormInt) {
+    return std::nullopt;
+  }
+  return ContentContextOptions{
+      .sample_count = sample_count,
+      .blend_mode = blend_mode,
+      .depth_compare = depth_compare,
+      .stencil_mode = stencil_mode,
+      .primitive_type = primitive_type,
+      .color_attachment_pixel_format = pixel_format,
+      .has_depth_stencil_attachments = ((key >> 2) & 1) != 0,
+      .depth_write_enabled = ((key >> 3) & 1) != 0,
+      .is_for_rrect_blur_clear = (key & 1) != 0,
+  };
+}
+
 void ContentContextOptions::ApplyToPipelineDescriptor(
     PipelineDescriptor& desc) const {
   auto pipeline_blend = blend_mode;
@@ -553,7 +778,7 @@ ContentContext::ContentContext(
     : context_(std::move(context)),
       lazy_glyph_atlas_(
           std::make_shared<LazyGlyphAtlas>(std::move(typographer_context))),
-      pipelines_(new Pipelines()),
+      pipelines_(std::make_shared<Pipelines>()),
       tessellator_(std::make_shared<Tessellator>(
           context_->GetCapabilities()->Supports32BitPrimitiveIndices())),
       render_target_cache_(render_target_allocator == nullptr
@@ -564,11 +789,20 @@ ContentContext::ContentContext(
           context_->GetResourceAllocator(),
           context_->GetIdleWaiter(),
           context_->GetCapabilities()->GetMinimumUniformAlignment())),
-      text_shadow_cache_(std::make_unique<TextShadowCache>()) {
+      text_shadow_cache_(std::make_unique<TextShadowCache>()),
+      retained_geometry_cache_(std::make_unique<RetainedGeometryCache>()),
+      blur_downsample_cache_(std::make_unique<BlurDownsampleCache>()),
+      gradient_texture_cache_(std::make_unique<GradientTextureCache>()) {
   if (!context_ || !context_->IsValid()) {
     return;
   }
 
+#ifdef IMPELLER_ENABLE_COMPUTE
+  if (context_->GetCapabilities()->SupportsCompute()) {
+    compute_tessellator_ = std::make_unique<ComputeTessellator>();
+  }
+#endif  // IMPELLER_ENABLE_COMPUTE
+
   // On most backends, indexes and other data can be allocated into the same
   // buffers. However, some backends (namely WebGL) require indexes used in
   // indexed draws to be allocated separately from other data. For those
@@ -634,6 +868,7 @@ ContentContext::ContentContext(
     pipelines_->fast_gradient.CreateDefault(*context_, options);
     pipelines_->line.CreateDefault(*context_, options);
     pipelines_->circle.CreateDefault(*context_, options);
+    pipelines_->round_rect.CreateDefault(*context_, options);
 
     if (context_->GetCapabilities()->SupportsSSBO()) {
       pipelines_->linear_gradient_ssbo_fill.CreateDefault(*context_, options);
@@ -756,98 +991,62 @@ ContentContext::ContentContext(
                                            porter_duff_constants[14]);
   }
 
-  if (context_->GetCapabilities()->SupportsFramebufferFetch()) {
-    pipelines_->framebuffer_blend_color.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kColor), supports_decal});
-    pipelines_->framebuffer_blend_colorburn.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kColorBurn), supports_decal});
-    pipelines_->framebuffer_blend_colordodge.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kColorDodge), supports_decal});
-    pipelines_->framebuffer_blend_darken.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kDarken), supports_decal});
-    pipelines_->framebuffer_blend_difference.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kDifference), supports_decal});
-    pipelines_->framebuffer_blend_exclusion.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kExclusion), supports_decal});
-    pipelines_->framebuffer_blend_hardlight.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kHardLight), supports_decal});
-    pipelines_->framebuffer_blend_hue.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kHue), supports_decal});
-    pipelines_->framebuffer_blend_lighten.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kLighten), supports_decal});
-    pipelines_->framebuffer_blend_luminosity.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kLuminosity), supports_decal});
-    pipelines_->framebuffer_blend_multiply.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kMultiply), supports_decal});
-    pipelines_->framebuffer_blend_overlay.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kOverlay), supports_decal});
-    pipelines_->framebuffer_blend_saturation.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kSaturation), supports_decal});
-    pipelines_->framebuffer_blend_screen.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kScreen), supports_decal});
-    pipelines_->framebuffer_blend_softlight.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kSoftLight), supports_decal});
-  } else {
-    pipelines_->blend_color.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kColor), supports_decal});
-    pipelines_->blend_colorburn.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kColorBurn), supports_decal});
-    pipelines_->blend_colordodge.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kColorDodge), supports_decal});
-    pipelines_->blend_darken.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kDarken), supports_decal});
-    pipelines_->blend_difference.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kDifference), supports_decal});
-    pipelines_->blend_exclusion.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kExclusion), supports_decal});
-    pipelines_->blend_hardlight.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kHardLight), supports_decal});
-    pipelines_->blend_hue.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kHue), supports_decal});
-    pipelines_->blend_lighten.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kLighten), supports_decal});
-    pipelines_->blend_luminosity.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kLuminosity), supports_decal});
-    pipelines_->blend_multiply.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kMultiply), supports_decal});
-    pipelines_->blend_overlay.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kOverlay), supports_decal});
-    pipelines_->blend_saturation.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kSaturation), supports_decal});
-    pipelines_->blend_screen.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kScreen), supports_decal});
-    pipelines_->blend_softlight.CreateDefault(
-        *context_, options_trianglestrip,
-        {static_cast<Scalar>(BlendSelectValues::kSoftLight), supports_decal});
+  {
+    // Advanced blends are rare, so each specialization of the blend shader
+    // is only compiled the first time a frame uses it.
+    const bool framebuffer_fetch =
+        context_->GetCapabilities()->SupportsFramebufferFetch();
+    auto declare = [&](BlendSelectValues mode, auto& framebuffer_variants,
+                       auto& variants) {
+      std::vector<Scalar> constants = {static_cast<Scalar>(mode),
+                                       supports_decal};
+      if (framebuffer_fetch) {
+        framebuffer_variants.CreateDeferredDefault(
+            *context_, options_trianglestrip, constants);
+      } else {
+        variants.CreateDeferredDefault(*context_, options_trianglestrip,
+                                       constants);
+      }
+    };
+    declare(BlendSelectValues::kColor, pipelines_->framebuffer_blend_color,
+            pipelines_->blend_color);
+    declare(BlendSelectValues::kColorBurn,
+            pipelines_->framebuffer_blend_colorburn,
+            pipelines_->blend_colorburn);
+    declare(BlendSelectValues::kColorDodge,
+            pipelines_->framebuffer_blend_colordodge,
+            pipelines_->blend_colordodge);
+    declare(BlendSelectValues::kDarken, pipelines_->framebuffer_blend_darken,
+            pipelines_->blend_darken);
+    declare(BlendSelectValues::kDifference,
+            pipelines_->framebuffer_blend_difference,
+            pipelines_->blend_difference);
+    declare(BlendSelectValues::kExclusion,
+            pipelines_->framebuffer_blend_exclusion,
+            pipelines_->blend_exclusion);
+    declare(BlendSelectValues::kHardLight,
+            pipelines_->framebuffer_blend_hardlight,
+            pipelines_->blend_hardlight);
+    declare(BlendSelectValues::kHue, pipelines_->framebuffer_blend_hue,
+            pipelines_->blend_hue);
+    declare(BlendSelectValues::kLighten, pipelines_->framebuffer_blend_lighten,
+            pipelines_->blend_lighten);
+    declare(BlendSelectValues::kLuminosity,
+            pipelines_->framebuffer_blend_luminosity,
+            pipelines_->blend_luminosity);
+    declare(BlendSelectValues::kMultiply,
+            pipelines_->framebuffer_blend_multiply,
+            pipelines_->blend_multiply);
+    declare(BlendSelectValues::kOverlay, pipelines_->framebuffer_blend_overlay,
+            pipelines_->blend_overlay);
+    declare(BlendSelectValues::kSaturation,
+            pipelines_->framebuffer_blend_saturation,
+            pipelines_->blend_saturation);
+    declare(BlendSelectValues::kScreen, pipelines_->framebuffer_blend_screen,
+            pipelines_->blend_screen);
+    declare(BlendSelectValues::kSoftLight,
+            pipelines_->framebuffer_blend_softlight,
+            pipelines_->blend_softlight);
   }
 
   pipelines_->morphology_filter.CreateDefault(*context_, options_trianglestrip,
@@ -872,8 +1071,55 @@ ContentContext::ContentContext(
 #endif  // IMPELLER_ENABLE_OPENGLES
   }
 
+  pipelines_->ForEach([](std::string_view name, GenericVariants& variants) {
+    variants.SetName(name);
+  });
+
   is_valid_ = true;
   InitializeCommonlyUsedShadersIfNeeded();
+  WarmUpPipelineVariants();
+}
+
+ContentContext::ContentContext(
+    std::shared_ptr<Context> context,
+    const ContentContext& parent,
+    std::shared_ptr<RenderTargetAllocator> render_target_allocator)
+    : context_(std::move(context)),
+      lazy_glyph_atlas_(parent.lazy_glyph_atlas_),
+      pipelines_(parent.pipelines_),
+      tessellator_(std::make_shared<Tessellator>(
+          context_->GetCapabilities()->Supports32BitPrimitiveIndices())),
+      render_target_cache_(render_target_allocator == nullptr
+                               ? std::make_shared<RenderTargetCache>(
+                                     context_->GetResourceAllocator())
+                               : std::move(render_target_allocator)),
+      data_host_buffer_(HostBuffer::Create(
+          context_->GetResourceAllocator(),
+          context_->GetIdleWaiter(),
+          context_->GetCapabilities()->GetMinimumUniformAlignment())),
+      empty_texture_(parent.empty_texture_),
+      text_shadow_cache_(std::make_unique<TextShadowCache>()),
+      retained_geometry_cache_(std::make_unique<RetainedGeometryCache>()),
+      blur_downsample_cache_(std::make_unique<BlurDownsampleCache>()),
+      gradient_texture_cache_(std::make_unique<GradientTextureCache>()),
+      parallel_recording_task_runner_(parent.parallel_recording_task_runner_) {
+  if (!context_ || !context_->IsValid() || !parent.IsValid()) {
+    return;
+  }
+
+#ifdef IMPELLER_ENABLE_COMPUTE
+  if (context_->GetCapabilities()->SupportsCompute()) {
+    compute_tessellator_ = std::make_unique<ComputeTessellator>();
+  }
+#endif  // IMPELLER_ENABLE_COMPUTE
+
+  indexes_host_buffer_ =
+      context_->GetCapabilities()->NeedsPartitionedHostBuffer()
+          ? HostBuffer::Create(
+                context_->GetResourceAllocator(), context_->GetIdleWaiter(),
+                context_->GetCapabilities()->GetMinimumUniformAlignment())
+          : data_host_buffer_;
+  is_valid_ = true;
 }
 
 ContentContext::~ContentContext() = default;
@@ -966,6 +1212,14 @@ Tessellator& ContentContext::GetTessellator() const {
   return *tessellator_;
 }
 
+ComputeTessellator* ContentContext::GetComputeTessellator() const {
+#ifdef IMPELLER_ENABLE_COMPUTE
+  return compute_tessellator_.get();
+#else
+  return nullptr;
+#endif  // IMPELLER_ENABLE_COMPUTE
+}
+
 std::shared_ptr<Context> ContentContext::GetContext() const {
   return context_;
 }
@@ -980,9 +1234,10 @@ PipelineRef ContentContext::GetCachedRuntimeEffectPipeline(
     const std::function<std::shared_ptr<Pipeline<PipelineDescriptor>>()>&
         create_callback) const {
   RuntimeEffectPipelineKey key{unique_entrypoint_name, options};
-  auto it = runtime_effect_pipelines_.find(key);
-  if (it == runtime_effect_pipelines_.end()) {
-    it = runtime_effect_pipelines_.insert(it, {key, create_callback()});
+  auto& runtime_effects = pipelines_->runtime_effects;
+  auto it = runtime_effects.find(key);
+  if (it == runtime_effects.end()) {
+    it = runtime_effects.insert(it, {key, create_callback()});
   }
   return raw_ptr(it->second);
 }
@@ -996,10 +1251,10 @@ void ContentContext::ClearCachedRuntimeEffectPipeline(
     idle_waiter->WaitIdle();
   }
 #endif  // IMPELLER_DEBUG
-  for (auto it = runtime_effect_pipelines_.begin();
-       it != runtime_effect_pipelines_.end();) {
+  auto& runtime_effects = pipelines_->runtime_effects;
+  for (auto it = runtime_effects.begin(); it != runtime_effects.end();) {
     if (it->first.unique_entrypoint_name == unique_entrypoint_name) {
-      it = runtime_effect_pipelines_.erase(it);
+      it = runtime_effects.erase(it);
     } else {
       it++;
     }
@@ -1017,6 +1272,55 @@ void ContentContext::ResetTransientsBuffers() {
   }
 }
 
+void ContentContext::WarmUpPipelineVariants() {
+  if (GetContext()->GetFlags().lazy_shader_mode) {
+    return;
+  }
+  std::unique_ptr<fml::Mapping> data =
+      GetContext()->GetPipelineLibrary()->RetrievePipelineVariantManifest();
+  PipelineVariantManifest& manifest = pipelines_->variant_manifest;
+  manifest = PipelineVariantManifest::Parse(data.get());
+  if (manifest.GetEntries().empty()) {
+    return;
+  }
+  TRACE_EVENT0("impeller", "ContentContext::WarmUpPipelineVariants");
+
+  std::unordered_map<std::string_view, GenericVariants*> containers;
+  pipelines_->ForEach([&containers](std::string_view name,
+                                    GenericVariants& variants) {
+    containers[name] = &variants;
+  });
+  // The pipeline library compiles asynchronous requests in submission order,
+  // so the variants the previous run needed first are ready first.
+  for (const PipelineVariantManifest::Entry& entry : manifest.GetEntries()) {
+    auto found = containers.find(entry.container);
+    if (found == containers.end()) {
+      continue;
+    }
+    std::optional<ContentContextOptions> options =
+        ContentContextOptions::FromKey(entry.options_key);
+    if (!options.has_value()) {
+      continue;
+    }
+    found->second->WarmUp(*GetContext(), options.value());
+  }
+}
+
+void ContentContext::RecordPipelineVariant(
+    std::string_view container,
+    const ContentContextOptions& options) const {
+  pipelines_->variant_manifest.Add(container, options.ToKey());
+}
+
+void ContentContext::PersistPipelineVariantManifestIfNeeded() {
+  PipelineVariantManifest& manifest = pipelines_->variant_manifest;
+  if (!manifest.IsDirty()) {
+    return;
+  }
+  GetContext()->GetPipelineLibrary()->PersistPipelineVariantManifest(
+      manifest.Serialize());
+}
+
 void ContentContext::InitializeCommonlyUsedShadersIfNeeded() const {
   if (GetContext()->GetFlags().lazy_shader_mode) {
     return;
@@ -1530,6 +1834,11 @@ PipelineRef ContentContext::GetCirclePipeline(
   return GetPipeline(this, pipelines_->circle, opts);
 }
 
+PipelineRef ContentContext::GetRoundRectPipeline(
+    ContentContextOptions opts) const {
+  return GetPipeline(this, pipelines_->round_rect, opts);
+}
+
 PipelineRef ContentContext::GetLinePipeline(ContentContextOptions opts) const {
   return GetPipeline(this, pipelines_->line, opts);
 }
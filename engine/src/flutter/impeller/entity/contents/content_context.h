@@ -11,12 +11,17 @@
 #include <unordered_map>
 #include <utility>
 
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/status_or.h"
 #include "impeller/base/validation.h"
 #include "impeller/core/formats.h"
 #include "impeller/core/host_buffer.h"
+#include "impeller/entity/contents/filters/blur_downsample_cache.h"
+#include "impeller/entity/contents/gradient_texture_cache.h"
+#include "impeller/entity/contents/pipeline_variant_manifest.h"
 #include "impeller/entity/contents/text_shadow_cache.h"
+#include "impeller/entity/geometry/retained_geometry_cache.h"
 #include "impeller/geometry/color.h"
 #include "impeller/renderer/capabilities.h"
 #include "impeller/renderer/command_buffer.h"
@@ -106,6 +111,11 @@ struct ContentContextOptions {
            static_cast<uint64_t>(sample_count) << 48;
   }
 
+  /// The inverse of |ToKey|. Returns std::nullopt if the key has bits set
+  /// that |ToKey| never sets or a field outside its enum's range, which is
+  /// the case for keys read back from a corrupt manifest.
+  static std::optional<ContentContextOptions> FromKey(uint64_t key);
+
   void ApplyToPipelineDescriptor(PipelineDescriptor& desc) const;
 };
 
@@ -117,6 +127,7 @@ enum ConicalKind {
 };
 
 class Tessellator;
+class ComputeTessellator;
 class RenderTargetCache;
 
 class ContentContext {
@@ -126,12 +137,34 @@ class ContentContext {
       std::shared_ptr<TypographerContext> typographer_context,
       std::shared_ptr<RenderTargetAllocator> render_target_allocator = nullptr);
 
+  /// @brief Create a content context that shares the pipelines, the glyph
+  ///        atlas and the empty texture of |parent|, for example for the
+  ///        surface of a spawned engine.
+  ///
+  /// Pipelines are not created again and the pipeline variants used by
+  /// either context are warmed up for both. The transients buffers, the
+  /// tessellator, the render target allocator and the caches that track
+  /// frames are not shared, as the two contexts render independent frames.
+  /// Both contexts must be used on the same thread.
+  ///
+  /// @param context  The context of this content context. It must create
+  ///                 its pipelines with the pipeline library of the context
+  ///                 of |parent|.
+  ContentContext(std::shared_ptr<Context> context,
+                 const ContentContext& parent,
+                 std::shared_ptr<RenderTargetAllocator>
+                     render_target_allocator = nullptr);
+
   ~ContentContext();
 
   bool IsValid() const;
 
   Tessellator& GetTessellator() const;
 
+  /// @brief The compute shader fill tessellator, or nullptr if the device
+  ///        does not support compute.
+  ComputeTessellator* GetComputeTessellator() const;
+
   // clang-format off
   PipelineRef GetBlendColorBurnPipeline(ContentContextOptions opts) const;
   PipelineRef GetBlendColorDodgePipeline(ContentContextOptions opts) const;
@@ -195,6 +228,7 @@ class ContentContext {
   PipelineRef GetRadialGradientFillPipeline(ContentContextOptions opts) const;
   PipelineRef GetRadialGradientSSBOFillPipeline(ContentContextOptions opts) const;
   PipelineRef GetRadialGradientUniformFillPipeline(ContentContextOptions opts) const;
+  PipelineRef GetRoundRectPipeline(ContentContextOptions opts) const;
   PipelineRef GetRRectBlurPipeline(ContentContextOptions opts) const;
   PipelineRef GetRSuperellipseBlurPipeline(ContentContextOptions opts) const;
   PipelineRef GetScreenBlendPipeline(ContentContextOptions opts) const;
@@ -259,6 +293,26 @@ class ContentContext {
     return render_target_cache_;
   }
 
+  /// Rendering quality traded for GPU time, for example when frames keep
+  /// missing their deadline.
+  struct QualityReductions {
+    /// Render offscreen passes without multisampling, as on devices that
+    /// don't support offscreen MSAA.
+    bool disable_offscreen_msaa = false;
+    /// Down-sample gaussian blurs by another factor of two.
+    bool reduce_blur_quality = false;
+
+    constexpr bool operator==(const QualityReductions& o) const = default;
+  };
+
+  void SetQualityReductions(const QualityReductions& reductions) {
+    quality_reductions_ = reductions;
+  }
+
+  const QualityReductions& GetQualityReductions() const {
+    return quality_reductions_;
+  }
+
   /// RuntimeEffect pipelines must be obtained via this method to avoid
   /// re-creating them every frame.
   ///
@@ -303,6 +357,51 @@ class ContentContext {
 
   TextShadowCache& GetTextShadowCache() const { return *text_shadow_cache_; }
 
+  RetainedGeometryCache& GetRetainedGeometryCache() const {
+    return *retained_geometry_cache_;
+  }
+
+  BlurDownsampleCache& GetBlurDownsampleCache() const {
+    return *blur_downsample_cache_;
+  }
+
+  GradientTextureCache& GetGradientTextureCache() const {
+    return *gradient_texture_cache_;
+  }
+
+  /// @brief Record that a pipeline variant was created so that the next run
+  ///        can compile it ahead of time.
+  ///
+  /// Called by the pipeline variant containers, which are identified by
+  /// |container|.
+  void RecordPipelineVariant(std::string_view container,
+                             const ContentContextOptions& options) const;
+
+  /// @brief Hand the manifest of the pipeline variants used so far to the
+  ///        pipeline library for persistence, if new variants were recorded
+  ///        since the last call.
+  ///
+  /// This is cheap when there is nothing new and is meant to be called once
+  /// per frame.
+  void PersistPipelineVariantManifestIfNeeded();
+
+  /// @brief Sets the worker pool used to record independent save layer
+  ///        subtrees of a display list in parallel.
+  ///
+  /// Parallel recording is disabled when the task runner is `nullptr`,
+  /// which is the default.
+  void SetParallelRecordingTaskRunner(
+      std::shared_ptr<fml::ConcurrentTaskRunner> task_runner) {
+    parallel_recording_task_runner_ = std::move(task_runner);
+  }
+
+  /// @brief The worker pool used for parallel display list recording, or
+  ///        `nullptr` if parallel recording is disabled.
+  const std::shared_ptr<fml::ConcurrentTaskRunner>&
+  GetParallelRecordingTaskRunner() const {
+    return parallel_recording_task_runner_;
+  }
+
  protected:
   // Visible for testing.
   void SetTransientsIndexesBuffer(std::shared_ptr<HostBuffer> host_buffer) {
@@ -346,22 +445,29 @@ class ContentContext {
     };
   };
 
-  mutable std::unordered_map<RuntimeEffectPipelineKey,
-                             std::shared_ptr<Pipeline<PipelineDescriptor>>,
-                             RuntimeEffectPipelineKey::Hash,
-                             RuntimeEffectPipelineKey::Equal>
-      runtime_effect_pipelines_;
-
   struct Pipelines;
-  std::unique_ptr<Pipelines> pipelines_;
+  // Shared with the content contexts created from this one.
+  std::shared_ptr<Pipelines> pipelines_;
 
   bool is_valid_ = false;
   std::shared_ptr<Tessellator> tessellator_;
+#ifdef IMPELLER_ENABLE_COMPUTE
+  std::unique_ptr<ComputeTessellator> compute_tessellator_;
+#endif  // IMPELLER_ENABLE_COMPUTE
   std::shared_ptr<RenderTargetAllocator> render_target_cache_;
   std::shared_ptr<HostBuffer> data_host_buffer_;
   std::shared_ptr<HostBuffer> indexes_host_buffer_;
   std::shared_ptr<Texture> empty_texture_;
   std::unique_ptr<TextShadowCache> text_shadow_cache_;
+  std::unique_ptr<RetainedGeometryCache> retained_geometry_cache_;
+  std::unique_ptr<BlurDownsampleCache> blur_downsample_cache_;
+  std::unique_ptr<GradientTextureCache> gradient_texture_cache_;
+  std::shared_ptr<fml::ConcurrentTaskRunner> parallel_recording_task_runner_;
+  QualityReductions quality_reductions_;
+
+  /// Start compiling the pipeline variants recorded by previous runs, in the
+  /// order they were first used.
+  void WarmUpPipelineVariants();
 
   ContentContext(const ContentContext&) = delete;
 
@@ -0,0 +1,35 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/contents/filters/blur_downsample_cache.h"
+
+namespace impeller {
+
+bool BlurDownsampleCache::Key::operator==(const Key& other) const {
+  return texture == other.texture && subpass_size == other.subpass_size &&
+         uvs == other.uvs && effective_scalar == other.effective_scalar &&
+         tile_mode == other.tile_mode &&
+         SamplerDescriptor::ToKey(sampler_descriptor) ==
+             SamplerDescriptor::ToKey(other.sampler_descriptor);
+}
+
+std::optional<RenderTarget> BlurDownsampleCache::Lookup(const Key& key) const {
+  for (const Entry& entry : entries_) {
+    if (entry.key == key) {
+      return entry.render_target;
+    }
+  }
+  return std::nullopt;
+}
+
+void BlurDownsampleCache::Insert(Key key, const RenderTarget& render_target) {
+  entries_.push_back(
+      Entry{.key = std::move(key), .render_target = render_target});
+}
+
+void BlurDownsampleCache::Clear() {
+  entries_.clear();
+}
+
+}  // namespace impeller
@@ -0,0 +1,82 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_ENTITY_CONTENTS_FILTERS_BLUR_DOWNSAMPLE_CACHE_H_
+#define FLUTTER_IMPELLER_ENTITY_CONTENTS_FILTERS_BLUR_DOWNSAMPLE_CACHE_H_
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "impeller/core/sampler_descriptor.h"
+#include "impeller/core/texture.h"
+#include "impeller/entity/entity.h"
+#include "impeller/geometry/point.h"
+#include "impeller/geometry/size.h"
+#include "impeller/renderer/render_target.h"
+
+namespace impeller {
+
+/// @brief A cache for the output of the gaussian blur down-sample pass.
+///
+/// Several backdrop filters in a scene frequently blur the same backdrop
+/// texture over the same region, for example stacked frosted glass panels
+/// with slightly different sigmas. The down-sample region is aligned to the
+/// power of two down-sample divisor, so blurs with nearby sigmas produce
+/// identical down-sample passes that only need to be rendered once.
+///
+/// Cached render targets are only valid while the contents of the input
+/// textures do not change, so the cache must be cleared whenever a backdrop
+/// texture is flipped and at the end of every frame.
+class BlurDownsampleCache {
+ public:
+  /// @brief The inputs of a down-sample pass that determine its output.
+  struct Key {
+    std::shared_ptr<Texture> texture;
+    ISize subpass_size;
+    Quad uvs;
+    Vector2 effective_scalar;
+    Entity::TileMode tile_mode;
+    SamplerDescriptor sampler_descriptor;
+
+    bool operator==(const Key& other) const;
+  };
+
+  BlurDownsampleCache() = default;
+
+  ~BlurDownsampleCache() = default;
+
+  /// @brief Lookup the down-sampled render target for |key|.
+  std::optional<RenderTarget> Lookup(const Key& key) const;
+
+  /// @brief Store the down-sampled |render_target| for |key|.
+  ///
+  /// The render target must not be rendered to again until the cache is
+  /// cleared.
+  void Insert(Key key, const RenderTarget& render_target);
+
+  /// @brief Drop all cached render targets.
+  void Clear();
+
+  // Visible for testing.
+  size_t GetCacheSizeForTesting() const { return entries_.size(); }
+
+ private:
+  struct Entry {
+    Key key;
+    RenderTarget render_target;
+  };
+
+  // There are rarely more than a handful of blurs in a frame, so a linear
+  // search is cheaper than hashing the keys.
+  std::vector<Entry> entries_;
+
+  BlurDownsampleCache(const BlurDownsampleCache&) = delete;
+
+  BlurDownsampleCache& operator=(const BlurDownsampleCache&) = delete;
+};
+
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_ENTITY_CONTENTS_FILTERS_BLUR_DOWNSAMPLE_CACHE_H_
@@ -4,6 +4,7 @@
 
 #include "impeller/entity/contents/filters/color_matrix_filter_contents.h"
 
+#include <algorithm>
 #include <optional>
 
 #include "impeller/entity/contents/anonymous_contents.h"
@@ -25,6 +26,53 @@ void ColorMatrixFilterContents::SetMatrix(const ColorMatrix& matrix) {
   matrix_ = matrix;
 }
 
+std::optional<ColorMatrix> ColorMatrixFilterContents::GetPerPixelColorMatrix()
+    const {
+  // Absorbing the input opacity and limiting the output to the coverage hint
+  // both depend on rendering this filter on its own.
+  if (GetInputs().size() != 1u ||
+      GetAbsorbOpacity() == ColorFilterContents::AbsorbOpacity::kYes ||
+      GetCoverageHint().has_value()) {
+    return std::nullopt;
+  }
+  return matrix_;
+}
+
+bool ColorMatrixFilterContents::CanFold(const ColorMatrix& outer,
+                                        const ColorMatrix& inner) {
+  for (int row = 0; row < 4; row++) {
+    const Scalar* m = inner.array + row * 5;
+    Scalar min = m[4];
+    Scalar max = m[4];
+    for (int column = 0; column < 4; column++) {
+      min += std::min(m[column], 0.0f);
+      max += std::max(m[column], 0.0f);
+    }
+    if (min < 0.0f || max > 1.0f) {
+      return false;
+    }
+  }
+  const Scalar* alpha = outer.array + 15;
+  return alpha[0] == 0.0f && alpha[1] == 0.0f && alpha[2] == 0.0f &&
+         alpha[4] == 0.0f;
+}
+
+ColorMatrix ColorMatrixFilterContents::Fold(const ColorMatrix& outer,
+                                            const ColorMatrix& inner) {
+  ColorMatrix result;
+  for (int row = 0; row < 4; row++) {
+    const Scalar* o = outer.array + row * 5;
+    for (int column = 0; column < 5; column++) {
+      Scalar value = column == 4 ? o[4] : 0.0f;
+      for (int i = 0; i < 4; i++) {
+        value += o[i] * inner.array[i * 5 + column];
+      }
+      result.array[row * 5 + column] = value;
+    }
+  }
+  return result;
+}
+
 std::optional<Entity> ColorMatrixFilterContents::RenderFilter(
     const FilterInput::Vector& inputs,
     const ContentContext& renderer,
@@ -43,7 +91,25 @@ std::optional<Entity> ColorMatrixFilterContents::RenderFilter(
     return std::nullopt;
   }
 
-  auto input_snapshot = inputs[0]->GetSnapshot("ColorMatrix", renderer, entity);
+  // Fold directly nested color matrix filters into this pass so that their
+  // results aren't rendered to intermediate snapshots.
+  FilterInput::Ref input = inputs[0];
+  ColorMatrix color_matrix = matrix_;
+  AbsorbOpacity absorb_opacity = GetAbsorbOpacity();
+  while (const FilterContents* inner_filter = input->GetFilterContents()) {
+    std::optional<ColorMatrix> inner_matrix =
+        inner_filter->GetPerPixelColorMatrix();
+    if (!inner_matrix.has_value() ||
+        !CanFold(color_matrix, inner_matrix.value())) {
+      break;
+    }
+    color_matrix = Fold(color_matrix, inner_matrix.value());
+    // The snapshot of the inner filter had an opacity of 1.
+    absorb_opacity = AbsorbOpacity::kNo;
+    input = inner_filter->GetInputs()[0];
+  }
+
+  auto input_snapshot = input->GetSnapshot("ColorMatrix", renderer, entity);
   if (!input_snapshot.has_value()) {
     return std::nullopt;
   }
@@ -51,8 +117,8 @@ std::optional<Entity> ColorMatrixFilterContents::RenderFilter(
   //----------------------------------------------------------------------------
   /// Create AnonymousContents for rendering.
   ///
-  RenderProc render_proc = [input_snapshot, color_matrix = matrix_,
-                            absorb_opacity = GetAbsorbOpacity()](
+  RenderProc render_proc = [input_snapshot, color_matrix,
+                            absorb_opacity](
                                const ContentContext& renderer,
                                const Entity& entity, RenderPass& pass) -> bool {
     pass.SetCommandLabel("Color Matrix Filter");
@@ -23,6 +23,21 @@ class ColorMatrixFilterContents final : public ColorFilterContents {
 
   void SetMatrix(const ColorMatrix& matrix);
 
+  // |FilterContents|
+  std::optional<ColorMatrix> GetPerPixelColorMatrix() const override;
+
+  /// @brief  Whether applying [inner] and then [outer] in one pass renders
+  ///         the same result as rendering [inner] to an intermediate texture
+  ///         first.
+  ///
+  ///         This holds if [inner] never has to clamp its output and [outer]
+  ///         leaves colors that are transparent after [inner] transparent, as
+  ///         the intermediate texture would have lost their color channels.
+  static bool CanFold(const ColorMatrix& outer, const ColorMatrix& inner);
+
+  /// @brief  Returns the matrix that applies [inner] and then [outer].
+  static ColorMatrix Fold(const ColorMatrix& outer, const ColorMatrix& inner);
+
  private:
   // |FilterContents|
   std::optional<Entity> RenderFilter(
@@ -0,0 +1,83 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/testing/testing.h"
+#include "impeller/entity/contents/filters/color_filter_contents.h"
+#include "impeller/entity/contents/filters/color_matrix_filter_contents.h"
+#include "impeller/entity/contents/filters/inputs/filter_input.h"
+#include "impeller/geometry/geometry_asserts.h"
+
+namespace impeller {
+namespace testing {
+
+namespace {
+
+// clang-format off
+constexpr ColorMatrix kGrayscale = {
+    0.2126f, 0.7152f, 0.0722f, 0.0f, 0.0f,
+    0.2126f, 0.7152f, 0.0722f, 0.0f, 0.0f,
+    0.2126f, 0.7152f, 0.0722f, 0.0f, 0.0f,
+    0.0f,    0.0f,    0.0f,    1.0f, 0.0f,
+};
+
+constexpr ColorMatrix kHalfOpacity = {
+    1.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.5f, 0.0f,
+};
+
+constexpr ColorMatrix kBrighten = {
+    2.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 2.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 2.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+};
+
+constexpr ColorMatrix kOpaque = {
+    1.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+};
+// clang-format on
+
+}  // namespace
+
+TEST(ColorMatrixFilterContentsTest, FoldAppliesInnerMatrixFirst) {
+  Color color = Color(0.2, 0.4, 0.6, 0.8);
+  Color expected =
+      color.ApplyColorMatrix(kGrayscale).ApplyColorMatrix(kHalfOpacity);
+
+  ColorMatrix folded =
+      ColorMatrixFilterContents::Fold(kHalfOpacity, kGrayscale);
+  EXPECT_COLOR_NEAR(color.ApplyColorMatrix(folded), expected);
+}
+
+TEST(ColorMatrixFilterContentsTest, CanFoldRejectsClampingInnerMatrix) {
+  EXPECT_TRUE(ColorMatrixFilterContents::CanFold(kHalfOpacity, kGrayscale));
+  EXPECT_FALSE(ColorMatrixFilterContents::CanFold(kHalfOpacity, kBrighten));
+}
+
+TEST(ColorMatrixFilterContentsTest, CanFoldRejectsOuterMatrixFillingAlpha) {
+  // The inner result of transparent pixels has lost its color in the
+  // intermediate texture, which the outer matrix would bring back.
+  EXPECT_FALSE(ColorMatrixFilterContents::CanFold(kOpaque, kGrayscale));
+}
+
+TEST(ColorMatrixFilterContentsTest, OnlyPlainColorMatrixIsPerPixel) {
+  auto inner = ColorFilterContents::MakeColorMatrix(
+      FilterInput::Make(Rect::MakeXYWH(0, 0, 10, 10)), kGrayscale);
+  EXPECT_TRUE(inner->GetPerPixelColorMatrix().has_value());
+
+  inner->SetAbsorbOpacity(ColorFilterContents::AbsorbOpacity::kYes);
+  EXPECT_FALSE(inner->GetPerPixelColorMatrix().has_value());
+
+  auto srgb = ColorFilterContents::MakeSrgbToLinearFilter(
+      FilterInput::Make(Rect::MakeXYWH(0, 0, 10, 10)));
+  EXPECT_FALSE(srgb->GetPerPixelColorMatrix().has_value());
+}
+
+}  // namespace testing
+}  // namespace impeller
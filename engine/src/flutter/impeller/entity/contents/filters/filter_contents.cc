@@ -138,6 +138,10 @@ void FilterContents::SetInputs(FilterInput::Vector inputs) {
   inputs_ = std::move(inputs);
 }
 
+const FilterInput::Vector& FilterContents::GetInputs() const {
+  return inputs_;
+}
+
 void FilterContents::SetEffectTransform(const Matrix& effect_transform) {
   effect_transform_ = effect_transform;
 
@@ -287,4 +291,8 @@ void FilterContents::SetRenderingMode(Entity::RenderingMode rendering_mode) {
   }
 }
 
+std::optional<ColorMatrix> FilterContents::GetPerPixelColorMatrix() const {
+  return std::nullopt;
+}
+
 }  // namespace impeller
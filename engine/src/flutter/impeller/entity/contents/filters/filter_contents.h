@@ -15,6 +15,7 @@
 #include "impeller/entity/contents/runtime_effect_contents.h"
 #include "impeller/entity/entity.h"
 #include "impeller/entity/geometry/geometry.h"
+#include "impeller/geometry/color.h"
 #include "impeller/geometry/matrix.h"
 #include "impeller/geometry/sigma.h"
 #include "impeller/runtime_stage/runtime_stage.h"
@@ -98,6 +99,8 @@ class FilterContents : public Contents {
   ///         particular filter's implementation.
   void SetInputs(FilterInput::Vector inputs);
 
+  const FilterInput::Vector& GetInputs() const;
+
   /// @brief  Sets the transform which gets appended to the effect of this
   ///         filter. Note that this is in addition to the entity's transform.
   ///
@@ -171,6 +174,14 @@ class FilterContents : public Contents {
   ///         is used in this case.
   virtual void SetRenderingMode(Entity::RenderingMode rendering_mode);
 
+  /// @brief  If this filter does nothing but map every pixel of its only input
+  ///         through a color matrix, returns that matrix.
+  ///
+  ///         Filters reading this filter may then apply the matrix in their
+  ///         own pass and read its input directly, which skips rendering the
+  ///         intermediate snapshot of this filter.
+  virtual std::optional<ColorMatrix> GetPerPixelColorMatrix() const;
+
  private:
   /// @brief  Internal utility method for |GetLocalCoverage| that computes
   ///         the output coverage of this filter across the specified inputs,
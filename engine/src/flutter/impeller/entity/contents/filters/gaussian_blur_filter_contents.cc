@@ -310,6 +310,10 @@ struct DownsamplePassArgs {
   /// This can differ if we request a coverage hint but it is rejected, as is
   /// the case with backdrop filters.
   Matrix transform;
+  /// Whether the coverage hint was ignored by the input and a region of it is
+  /// cut out instead. Other blurs of the same input, usually a backdrop
+  /// texture, may then produce the same down-sample pass.
+  bool is_region_of_input = false;
 };
 
 /// Calculates info required for the down-sampling pass.
@@ -320,10 +324,15 @@ DownsamplePassArgs CalculateDownsamplePassArgs(
     const std::optional<Rect>& source_expanded_coverage_hint,
     const std::optional<Quad>& source_bounds,
     const std::shared_ptr<FilterInput>& input,
-    const Entity& snapshot_entity) {
+    const Entity& snapshot_entity,
+    bool reduce_quality) {
   Scalar desired_scalar =
       std::min(GaussianBlurFilterContents::CalculateScale(scaled_sigma.x),
                GaussianBlurFilterContents::CalculateScale(scaled_sigma.y));
+  if (reduce_quality) {
+    // Same 1/16th floor as |CalculateScale|.
+    desired_scalar = std::max(desired_scalar * 0.5f, 0.0625f);
+  }
 
   // TODO(jonahwilliams): If desired_scalar is 1.0 and we fully acquired the
   // gutter from the expanded_coverage_hint, we can skip the downsample pass.
@@ -384,7 +393,8 @@ DownsamplePassArgs CalculateDownsamplePassArgs(
         .uv_bounds = uv_bounds,
         .effective_scalar = effective_scalar,
         .transform = Matrix::MakeTranslation(
-            {aligned_coverage_hint.GetX(), aligned_coverage_hint.GetY(), 0})};
+            {aligned_coverage_hint.GetX(), aligned_coverage_hint.GetY(), 0}),
+        .is_region_of_input = true};
   } else {
     //////////////////////////////////////////////////////////////////////////////
     auto input_snapshot_size = input_snapshot.texture->GetSize();
@@ -909,16 +919,47 @@ std::optional<Entity> GaussianBlurFilterContents::RenderFilter(
 
   DownsamplePassArgs downsample_pass_args = CalculateDownsamplePassArgs(
       blur_info.scaled_sigma, blur_info.padding, input_snapshot.value(),
-      source_expanded_coverage_hint, source_bounds, inputs[0], snapshot_entity);
+      source_expanded_coverage_hint, source_bounds, inputs[0], snapshot_entity,
+      renderer.GetQualityReductions().reduce_blur_quality);
+
+  // Unbounded blurs of the same region of an input share their down-sample
+  // pass. A shared pass can't be used as the ping pong target below.
+  std::optional<BlurDownsampleCache::Key> downsample_cache_key;
+  if (downsample_pass_args.is_region_of_input &&
+      !downsample_pass_args.uv_bounds.has_value()) {
+    downsample_cache_key = BlurDownsampleCache::Key{
+        .texture = input_snapshot->texture,
+        .subpass_size = downsample_pass_args.subpass_size,
+        .uvs = downsample_pass_args.uvs,
+        .effective_scalar = downsample_pass_args.effective_scalar,
+        .tile_mode = tile_mode_,
+        .sampler_descriptor = input_snapshot->sampler_descriptor,
+    };
+  }
 
-  fml::StatusOr<RenderTarget> pass1_out = MakeDownsampleSubpass(
-      renderer, command_buffer_1, input_snapshot->texture,
-      input_snapshot->sampler_descriptor, downsample_pass_args, tile_mode_);
+  std::optional<RenderTarget> cached_pass1_out;
+  if (downsample_cache_key.has_value()) {
+    cached_pass1_out =
+        renderer.GetBlurDownsampleCache().Lookup(downsample_cache_key.value());
+  }
+
+  fml::StatusOr<RenderTarget> pass1_out =
+      cached_pass1_out.has_value()
+          ? fml::StatusOr<RenderTarget>(cached_pass1_out.value())
+          : MakeDownsampleSubpass(renderer, command_buffer_1,
+                                  input_snapshot->texture,
+                                  input_snapshot->sampler_descriptor,
+                                  downsample_pass_args, tile_mode_);
 
   if (!pass1_out.ok()) {
     return std::nullopt;
   }
 
+  if (downsample_cache_key.has_value() && !cached_pass1_out.has_value()) {
+    renderer.GetBlurDownsampleCache().Insert(
+        std::move(downsample_cache_key.value()), pass1_out.value());
+  }
+
   Vector2 pass1_pixel_size =
       1.0 / Vector2(pass1_out.value().GetRenderTargetTexture()->GetSize());
 
@@ -954,9 +995,11 @@ std::optional<Entity> GaussianBlurFilterContents::RenderFilter(
     return std::nullopt;
   }
 
-  // Only ping pong if the first pass actually created a render target.
-  auto pass3_destination = pass2_out.value().GetRenderTargetTexture() !=
-                                   pass1_out.value().GetRenderTargetTexture()
+  // Only ping pong if the first pass actually created a render target and it
+  // isn't shared with other blurs.
+  auto pass3_destination = !downsample_cache_key.has_value() &&
+                                   pass2_out.value().GetRenderTargetTexture() !=
+                                       pass1_out.value().GetRenderTargetTexture()
                                ? std::optional<RenderTarget>(pass1_out.value())
                                : std::optional<RenderTarget>(std::nullopt);
 
@@ -467,6 +467,46 @@ TEST_P(GaussianBlurFilterContentsTest, TextureContentsWithEffectTransform) {
   }
 }
 
+TEST_P(GaussianBlurFilterContentsTest, BlursOfSameRegionShareDownsample) {
+  std::shared_ptr<Texture> texture = MakeTexture(ISize(400, 400));
+  fml::StatusOr<Scalar> sigma_radius_8 =
+      CalculateSigmaForBlurRadius(8.0, Matrix());
+  ASSERT_TRUE(sigma_radius_8.ok());
+  auto make_contents = [&] {
+    auto contents = std::make_shared<GaussianBlurFilterContents>(
+        sigma_radius_8.value(), sigma_radius_8.value(),
+        Entity::TileMode::kDecal,
+        /*bounds=*/std::nullopt, FilterContents::BlurStyle::kNormal,
+        /*mask_geometry=*/nullptr);
+    contents->SetInputs({FilterInput::Make(texture)});
+    return contents;
+  };
+  std::shared_ptr<ContentContext> renderer = GetContentContext();
+  BlurDownsampleCache& cache = renderer->GetBlurDownsampleCache();
+  cache.Clear();
+
+  Entity entity;
+  std::optional<Entity> first = make_contents()->GetEntity(
+      *renderer, entity, Rect::MakeLTRB(100, 100, 200, 200));
+  ASSERT_TRUE(first.has_value());
+  EXPECT_EQ(cache.GetCacheSizeForTesting(), 1u);
+
+  std::optional<Entity> second = make_contents()->GetEntity(
+      *renderer, entity, Rect::MakeLTRB(100, 100, 200, 200));
+  ASSERT_TRUE(second.has_value());
+  EXPECT_EQ(cache.GetCacheSizeForTesting(), 1u);
+  EXPECT_TRUE(RectNear(first->GetCoverage().value(),
+                       second->GetCoverage().value()));
+
+  std::optional<Entity> other_region = make_contents()->GetEntity(
+      *renderer, entity, Rect::MakeLTRB(200, 200, 300, 300));
+  ASSERT_TRUE(other_region.has_value());
+  EXPECT_EQ(cache.GetCacheSizeForTesting(), 2u);
+
+  cache.Clear();
+  EXPECT_EQ(cache.GetCacheSizeForTesting(), 0u);
+}
+
 TEST(GaussianBlurFilterContentsTest, CalculateSigmaForBlurRadius) {
   Scalar sigma = 1.0;
   Scalar radius = GaussianBlurFilterContents::CalculateBlurRadius(
@@ -63,4 +63,8 @@ void FilterContentsFilterInput::SetRenderingMode(
   filter_->SetRenderingMode(rendering_mode);
 }
 
+const FilterContents* FilterContentsFilterInput::GetFilterContents() const {
+  return filter_.get();
+}
+
 }  // namespace impeller
@@ -40,6 +40,9 @@ class FilterContentsFilterInput final : public FilterInput {
   // |FilterInput|
   virtual void SetRenderingMode(Entity::RenderingMode rendering_mode) override;
 
+  // |FilterInput|
+  const FilterContents* GetFilterContents() const override;
+
  private:
   explicit FilterContentsFilterInput(std::shared_ptr<FilterContents> filter);
 
@@ -82,4 +82,8 @@ void FilterInput::SetEffectTransform(const Matrix& matrix) {}
 
 void FilterInput::SetRenderingMode(Entity::RenderingMode rendering_mode) {}
 
+const FilterContents* FilterInput::GetFilterContents() const {
+  return nullptr;
+}
+
 }  // namespace impeller
@@ -95,6 +95,10 @@ class FilterInput {
 
   /// @brief  Turns on subpass mode for filter inputs.
   virtual void SetRenderingMode(Entity::RenderingMode rendering_mode);
+
+  /// @brief  Returns the filter this input evaluates, or nullptr if the input
+  ///         isn't a filter.
+  virtual const FilterContents* GetFilterContents() const;
 };
 
 }  // namespace impeller
@@ -0,0 +1,83 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/contents/gradient_texture_cache.h"
+
+#include "flutter/fml/hash_combine.h"
+#include "impeller/entity/contents/gradient_generator.h"
+#include "impeller/geometry/gradient.h"
+
+namespace impeller {
+
+static size_t HashGradient(const std::vector<Color>& colors,
+                           const std::vector<Scalar>& stops) {
+  size_t hash = fml::HashCombine(colors.size(), stops.size());
+  for (const Color& color : colors) {
+    fml::HashCombineSeed(hash, color.red, color.green, color.blue,
+                         color.alpha);
+  }
+  for (Scalar stop : stops) {
+    fml::HashCombineSeed(hash, stop);
+  }
+  return hash;
+}
+
+std::shared_ptr<Texture> GradientTextureCache::GetOrCreate(
+    const std::vector<Color>& colors,
+    const std::vector<Scalar>& stops,
+    const std::shared_ptr<Context>& context) {
+  const size_t hash = HashGradient(colors, stops);
+  use_count_++;
+
+  auto it = entries_.find(hash);
+  if (it != entries_.end()) {
+    Entry& entry = it->second;
+    if (entry.colors == colors && entry.stops == stops) {
+      entry.last_used = use_count_;
+      return entry.texture;
+    }
+    resident_bytes_ -= entry.byte_size;
+    entries_.erase(it);
+  }
+
+  GradientData gradient_data = CreateGradientBuffer(colors, stops);
+  std::shared_ptr<Texture> texture =
+      CreateGradientTexture(gradient_data, context);
+  if (!texture) {
+    return nullptr;
+  }
+
+  const size_t byte_size = gradient_data.color_bytes.size();
+  entries_[hash] = Entry{
+      .colors = colors,
+      .stops = stops,
+      .texture = texture,
+      .byte_size = byte_size,
+      .last_used = use_count_,
+  };
+  resident_bytes_ += byte_size;
+  EvictToBudget();
+  return texture;
+}
+
+void GradientTextureCache::EvictToBudget() {
+  // Evicted ramps stay alive for as long as the commands that sample them.
+  while (resident_bytes_ > max_bytes_ && entries_.size() > 1u) {
+    auto oldest = entries_.begin();
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if (it->second.last_used < oldest->second.last_used) {
+        oldest = it;
+      }
+    }
+    resident_bytes_ -= oldest->second.byte_size;
+    entries_.erase(oldest);
+  }
+}
+
+void GradientTextureCache::Clear() {
+  entries_.clear();
+  resident_bytes_ = 0u;
+}
+
+}  // namespace impeller
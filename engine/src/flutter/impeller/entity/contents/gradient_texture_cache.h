@@ -0,0 +1,80 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_ENTITY_CONTENTS_GRADIENT_TEXTURE_CACHE_H_
+#define FLUTTER_IMPELLER_ENTITY_CONTENTS_GRADIENT_TEXTURE_CACHE_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "impeller/core/texture.h"
+#include "impeller/geometry/color.h"
+#include "impeller/geometry/scalar.h"
+#include "third_party/abseil-cpp/absl/container/flat_hash_map.h"
+
+namespace impeller {
+
+class Context;
+
+/// @brief A cache for the color ramp textures of gradients.
+///
+/// Backends without storage buffers draw gradients with more stops than fit
+/// in a uniform block by sampling a baked color ramp. The same gradients are
+/// usually drawn every frame, so the ramps are keyed by their colors and
+/// stops and kept across frames until the cached textures exceed the byte
+/// budget, at which point the least recently used ramps are evicted.
+///
+/// This is only safe to use from the raster thread.
+class GradientTextureCache {
+ public:
+  /// The default budget for the cached ramp textures.
+  static constexpr size_t kDefaultMaxBytes = 1024u * 1024u;
+
+  explicit GradientTextureCache(size_t max_bytes = kDefaultMaxBytes)
+      : max_bytes_(max_bytes) {}
+
+  ~GradientTextureCache() = default;
+
+  /// @brief Lookup the color ramp for the gradient with |colors| and |stops|,
+  ///        baking and caching it with |context| if it is not present.
+  ///
+  /// @return The ramp texture or nullptr if it could not be created.
+  std::shared_ptr<Texture> GetOrCreate(const std::vector<Color>& colors,
+                                       const std::vector<Scalar>& stops,
+                                       const std::shared_ptr<Context>& context);
+
+  /// @brief Drop all cached ramps.
+  void Clear();
+
+  // Visible for testing.
+  size_t GetCacheSizeForTesting() const { return entries_.size(); }
+
+ private:
+  GradientTextureCache(const GradientTextureCache&) = delete;
+
+  GradientTextureCache& operator=(const GradientTextureCache&) = delete;
+
+  struct Entry {
+    std::vector<Color> colors;
+    std::vector<Scalar> stops;
+    std::shared_ptr<Texture> texture;
+    size_t byte_size = 0u;
+    uint64_t last_used = 0u;
+  };
+
+  void EvictToBudget();
+
+  size_t max_bytes_;
+  size_t resident_bytes_ = 0u;
+  uint64_t use_count_ = 0u;
+
+  // Keyed by the hash of the colors and stops. A colliding gradient replaces
+  // the cached one.
+  absl::flat_hash_map<size_t, Entry> entries_;
+};
+
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_ENTITY_CONTENTS_GRADIENT_TEXTURE_CACHE_H_
@@ -177,6 +177,101 @@ TEST_P(HostBufferTest, UnusedBuffersAreDiscardedWhenResetting) {
   EXPECT_EQ(buffer->GetStateForTest().current_frame, 0u);
 }
 
+TEST_P(HostBufferTest, FrameCountIsConfigurable) {
+  auto buffer = HostBuffer::Create(GetContext()->GetResourceAllocator(),
+                                   GetContext()->GetIdleWaiter(), 256,
+                                   /*frame_count=*/2u);
+
+  EXPECT_EQ(buffer->GetStateForTest().current_frame, 0u);
+  buffer->Reset();
+  EXPECT_EQ(buffer->GetStateForTest().current_frame, 1u);
+  buffer->Reset();
+  EXPECT_EQ(buffer->GetStateForTest().current_frame, 0u);
+}
+
+TEST_P(HostBufferTest, ReportsUsedAndPeakBytes) {
+  auto buffer = HostBuffer::Create(GetContext()->GetResourceAllocator(),
+                                   GetContext()->GetIdleWaiter(), 256);
+
+  EXPECT_EQ(buffer->GetStateForTest().used_bytes, 0u);
+  EXPECT_EQ(buffer->GetStateForTest().peak_used_bytes, 0u);
+
+  auto view_a = buffer->Emplace(100, 0, [](uint8_t* data) {});
+  auto view_b = buffer->Emplace(1024000 + 10, 0, [](uint8_t* data) {});
+  EXPECT_EQ(buffer->GetStateForTest().used_bytes, 100u + 1024000u + 10u);
+
+  buffer->Reset();
+  EXPECT_EQ(buffer->GetStateForTest().used_bytes, 0u);
+  EXPECT_EQ(buffer->GetStateForTest().peak_used_bytes, 100u + 1024000u + 10u);
+
+  // The peak ages out once every frame in the ring has been reused.
+  for (auto i = 0; i < 4; i++) {
+    buffer->Reset();
+  }
+  EXPECT_EQ(buffer->GetStateForTest().peak_used_bytes, 0u);
+}
+
+TEST_P(HostBufferTest, NextFrameIsPresizedFromPeakUsage) {
+  auto buffer = HostBuffer::Create(GetContext()->GetResourceAllocator(),
+                                   GetContext()->GetIdleWaiter(), 256);
+
+  // Use three blocks in the first frame.
+  auto view_a = buffer->Emplace(1020000, 0, [](uint8_t* data) {});
+  auto view_b = buffer->Emplace(1020000, 0, [](uint8_t* data) {});
+  auto view_c = buffer->Emplace(1020000, 0, [](uint8_t* data) {});
+  EXPECT_EQ(buffer->GetStateForTest().total_buffer_count, 3u);
+
+  // The following frame has its blocks allocated ahead of time.
+  buffer->Reset();
+  EXPECT_EQ(buffer->GetStateForTest().current_frame, 1u);
+  EXPECT_EQ(buffer->GetStateForTest().total_buffer_count, 3u);
+
+  auto view_d = buffer->Emplace(1020000, 0, [](uint8_t* data) {});
+  auto view_e = buffer->Emplace(1020000, 0, [](uint8_t* data) {});
+  EXPECT_EQ(buffer->GetStateForTest().current_buffer, 1u);
+  EXPECT_EQ(buffer->GetStateForTest().total_buffer_count, 3u);
+}
+
+TEST_P(HostBufferTest, OneOffAllocationsDoNotPresizeFrames) {
+  auto buffer = HostBuffer::Create(GetContext()->GetResourceAllocator(),
+                                   GetContext()->GetIdleWaiter(), 256);
+
+  // Larger than a block, so it gets a buffer of its own.
+  auto view_a = buffer->Emplace(5 * 1024000, 0, [](uint8_t* data) {});
+  auto view_b = buffer->Emplace(100, 0, [](uint8_t* data) {});
+  EXPECT_EQ(buffer->GetStateForTest().total_buffer_count, 1u);
+
+  for (auto i = 0; i < 4; i++) {
+    buffer->Reset();
+    EXPECT_EQ(buffer->GetStateForTest().total_buffer_count, 1u);
+  }
+}
+
+TEST_P(HostBufferTest, IdenticalUniformsAreReusedWithinAFrame) {
+  struct Uniform {
+    float values[4];
+  };
+  auto buffer = HostBuffer::Create(GetContext()->GetResourceAllocator(),
+                                   GetContext()->GetIdleWaiter(), 256);
+
+  BufferView red = buffer->EmplaceUniform(Uniform{{1, 0, 0, 1}});
+  BufferView blue = buffer->EmplaceUniform(Uniform{{0, 0, 1, 1}});
+  size_t used_bytes = buffer->GetStateForTest().used_bytes;
+
+  BufferView red_again = buffer->EmplaceUniform(Uniform{{1, 0, 0, 1}});
+  EXPECT_EQ(red_again.GetRange(), red.GetRange());
+  EXPECT_EQ(red_again.GetBuffer(), red.GetBuffer());
+  EXPECT_NE(blue.GetRange(), red.GetRange());
+  EXPECT_EQ(buffer->GetStateForTest().used_bytes, used_bytes);
+  EXPECT_EQ(buffer->GetStateForTest().reused_uniform_count, 1u);
+
+  // The next frame writes the block again.
+  buffer->Reset();
+  BufferView next_frame = buffer->EmplaceUniform(Uniform{{1, 0, 0, 1}});
+  EXPECT_EQ(next_frame.GetRange(), Range(0, sizeof(Uniform)));
+  EXPECT_EQ(buffer->GetStateForTest().reused_uniform_count, 0u);
+}
+
 TEST_P(HostBufferTest, EmplaceWithProcIsAligned) {
   auto buffer = HostBuffer::Create(GetContext()->GetResourceAllocator(),
                                    GetContext()->GetIdleWaiter(), 256);
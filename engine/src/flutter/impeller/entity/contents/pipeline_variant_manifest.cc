@@ -0,0 +1,100 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/contents/pipeline_variant_manifest.h"
+
+#include <algorithm>
+#include <charconv>
+
+#include "flutter/shell/version/version.h"
+
+namespace impeller {
+
+static constexpr std::string_view kManifestFormat = "impeller-variants 2 ";
+
+static std::string ManifestHeader() {
+  std::string header(kManifestFormat);
+  header.append(flutter::GetFlutterEngineVersion());
+  header.push_back('\n');
+  return header;
+}
+
+PipelineVariantManifest::PipelineVariantManifest() = default;
+
+PipelineVariantManifest::~PipelineVariantManifest() = default;
+
+PipelineVariantManifest PipelineVariantManifest::Parse(
+    const fml::Mapping* mapping) {
+  PipelineVariantManifest manifest;
+  if (!mapping || !mapping->GetMapping()) {
+    return manifest;
+  }
+  std::string_view data(reinterpret_cast<const char*>(mapping->GetMapping()),
+                        mapping->GetSize());
+  const std::string header = ManifestHeader();
+  if (!data.starts_with(header)) {
+    return manifest;
+  }
+  data.remove_prefix(header.size());
+
+  while (!data.empty()) {
+    size_t line_end = data.find('\n');
+    if (line_end == std::string_view::npos) {
+      // A truncated trailing line. Keep the entries read so far.
+      break;
+    }
+    std::string_view line = data.substr(0, line_end);
+    data.remove_prefix(line_end + 1);
+
+    size_t separator = line.find(' ');
+    if (separator == std::string_view::npos || separator == 0) {
+      return PipelineVariantManifest();
+    }
+    uint64_t options_key = 0;
+    std::string_view key = line.substr(separator + 1);
+    auto [end, error] =
+        std::from_chars(key.data(), key.data() + key.size(), options_key);
+    if (error != std::errc() || end != key.data() + key.size()) {
+      return PipelineVariantManifest();
+    }
+    manifest.Add(line.substr(0, separator), options_key);
+  }
+  manifest.dirty_ = false;
+  return manifest;
+}
+
+bool PipelineVariantManifest::Add(std::string_view container,
+                                  uint64_t options_key) {
+  if (entries_.size() >= kMaxEntries) {
+    return false;
+  }
+  auto found = std::find_if(entries_.begin(), entries_.end(),
+                            [&](const Entry& entry) {
+                              return entry.options_key == options_key &&
+                                     entry.container == container;
+                            });
+  if (found != entries_.end()) {
+    return false;
+  }
+  entries_.push_back(Entry{
+      .container = std::string(container),
+      .options_key = options_key,
+  });
+  dirty_ = true;
+  return true;
+}
+
+std::shared_ptr<fml::Mapping> PipelineVariantManifest::Serialize() {
+  std::string data = ManifestHeader();
+  for (const Entry& entry : entries_) {
+    data.append(entry.container);
+    data.push_back(' ');
+    data.append(std::to_string(entry.options_key));
+    data.push_back('\n');
+  }
+  dirty_ = false;
+  return std::make_shared<fml::DataMapping>(data);
+}
+
+}  // namespace impeller
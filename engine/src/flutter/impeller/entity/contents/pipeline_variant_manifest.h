@@ -0,0 +1,66 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_ENTITY_CONTENTS_PIPELINE_VARIANT_MANIFEST_H_
+#define FLUTTER_IMPELLER_ENTITY_CONTENTS_PIPELINE_VARIANT_MANIFEST_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "flutter/fml/mapping.h"
+
+namespace impeller {
+
+/// @brief An ordered record of the pipeline variants the |ContentContext|
+///        created, persisted between runs so that the next run can compile
+///        them ahead of the first frame that uses them.
+///
+/// Entries are kept in the order they were first used, which is also the
+/// order they are compiled in on the next run. Variants are identified by the
+/// name of their container and the key of their |ContentContextOptions|.
+/// Neither is stable across engine builds, so the header records the engine
+/// version and a manifest written by a different engine is discarded.
+class PipelineVariantManifest {
+ public:
+  /// The manifest is kept small, variants past this count are not recorded.
+  static constexpr size_t kMaxEntries = 512u;
+
+  struct Entry {
+    std::string container;
+    uint64_t options_key;
+
+    bool operator==(const Entry& other) const = default;
+  };
+
+  PipelineVariantManifest();
+
+  ~PipelineVariantManifest();
+
+  /// @brief Parse a manifest produced by |Serialize|. Returns an empty
+  ///        manifest if the data is missing, malformed, or was written by a
+  ///        different engine version.
+  static PipelineVariantManifest Parse(const fml::Mapping* mapping);
+
+  /// @brief Record a variant. Returns whether it was not already present.
+  bool Add(std::string_view container, uint64_t options_key);
+
+  const std::vector<Entry>& GetEntries() const { return entries_; }
+
+  /// @brief Whether variants were added since the last call to |Serialize|.
+  bool IsDirty() const { return dirty_; }
+
+  /// @brief Serialize the manifest and clear the dirty flag.
+  std::shared_ptr<fml::Mapping> Serialize();
+
+ private:
+  std::vector<Entry> entries_;
+  bool dirty_ = false;
+};
+
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_ENTITY_CONTENTS_PIPELINE_VARIANT_MANIFEST_H_
@@ -0,0 +1,122 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/version/version.h"
+#include "flutter/testing/testing.h"
+#include "impeller/entity/contents/content_context.h"
+#include "impeller/entity/contents/pipeline_variant_manifest.h"
+
+namespace impeller {
+namespace testing {
+
+TEST(PipelineVariantManifestTest, RoundTripsEntriesInOrder) {
+  PipelineVariantManifest manifest;
+  EXPECT_FALSE(manifest.IsDirty());
+  EXPECT_TRUE(manifest.Add("solid_fill", 42u));
+  EXPECT_TRUE(manifest.Add("texture", 7u));
+  EXPECT_TRUE(manifest.Add("solid_fill", 3u));
+  EXPECT_FALSE(manifest.Add("texture", 7u));
+  EXPECT_TRUE(manifest.IsDirty());
+
+  std::shared_ptr<fml::Mapping> data = manifest.Serialize();
+  EXPECT_FALSE(manifest.IsDirty());
+
+  PipelineVariantManifest parsed = PipelineVariantManifest::Parse(data.get());
+  EXPECT_FALSE(parsed.IsDirty());
+  EXPECT_EQ(parsed.GetEntries(), manifest.GetEntries());
+  ASSERT_EQ(parsed.GetEntries().size(), 3u);
+  EXPECT_EQ(parsed.GetEntries()[0].container, "solid_fill");
+  EXPECT_EQ(parsed.GetEntries()[0].options_key, 42u);
+  EXPECT_EQ(parsed.GetEntries()[2].options_key, 3u);
+}
+
+TEST(PipelineVariantManifestTest, RejectsMalformedData) {
+  EXPECT_TRUE(PipelineVariantManifest::Parse(nullptr).GetEntries().empty());
+
+  fml::DataMapping bad_header(std::string("solid_fill 1\n"));
+  EXPECT_TRUE(
+      PipelineVariantManifest::Parse(&bad_header).GetEntries().empty());
+
+  fml::DataMapping bad_key(std::string("impeller-variants 2 ") +
+                           flutter::GetFlutterEngineVersion() +
+                           "\nsolid_fill x\n");
+  EXPECT_TRUE(PipelineVariantManifest::Parse(&bad_key).GetEntries().empty());
+}
+
+TEST(PipelineVariantManifestTest, RejectsOtherEngineVersions) {
+  PipelineVariantManifest manifest;
+  EXPECT_TRUE(manifest.Add("solid_fill", 42u));
+  std::shared_ptr<fml::Mapping> data = manifest.Serialize();
+  ASSERT_EQ(PipelineVariantManifest::Parse(data.get()).GetEntries().size(),
+            1u);
+
+  fml::DataMapping stale(
+      std::string("impeller-variants 2 stale-engine\nsolid_fill 42\n"));
+  EXPECT_TRUE(PipelineVariantManifest::Parse(&stale).GetEntries().empty());
+
+  fml::DataMapping old_format(
+      std::string("impeller-variants 1\nsolid_fill 42\n"));
+  EXPECT_TRUE(
+      PipelineVariantManifest::Parse(&old_format).GetEntries().empty());
+}
+
+TEST(PipelineVariantManifestTest, IsBounded) {
+  PipelineVariantManifest manifest;
+  for (size_t i = 0; i < PipelineVariantManifest::kMaxEntries; i++) {
+    EXPECT_TRUE(manifest.Add("solid_fill", i));
+  }
+  EXPECT_FALSE(manifest.Add("texture", 0u));
+  EXPECT_EQ(manifest.GetEntries().size(), PipelineVariantManifest::kMaxEntries);
+}
+
+TEST(PipelineVariantManifestTest, OptionsRoundTripThroughKey) {
+  ContentContextOptions options{
+      .sample_count = SampleCount::kCount4,
+      .blend_mode = BlendMode::kPlus,
+      .depth_compare = CompareFunction::kGreaterEqual,
+      .stencil_mode = ContentContextOptions::StencilMode::kCoverCompare,
+      .primitive_type = PrimitiveType::kTriangleStrip,
+      .color_attachment_pixel_format = PixelFormat::kB8G8R8A8UNormInt,
+      .has_depth_stencil_attachments = false,
+      .depth_write_enabled = true,
+      .is_for_rrect_blur_clear = true,
+  };
+  std::optional<ContentContextOptions> parsed =
+      ContentContextOptions::FromKey(options.ToKey());
+  ASSERT_TRUE(parsed.has_value());
+  EXPECT_EQ(parsed->ToKey(), options.ToKey());
+
+  std::optional<ContentContextOptions> parsed_default =
+      ContentContextOptions::FromKey(ContentContextOptions{}.ToKey());
+  ASSERT_TRUE(parsed_default.has_value());
+  EXPECT_EQ(parsed_default->ToKey(), ContentContextOptions{}.ToKey());
+}
+
+TEST(PipelineVariantManifestTest, RejectsOutOfRangeKeys) {
+  const uint64_t key = ContentContextOptions{}.ToKey();
+  ASSERT_TRUE(ContentContextOptions::FromKey(key).has_value());
+
+  // Unused bits.
+  EXPECT_FALSE(ContentContextOptions::FromKey(key | (1llu << 1)).has_value());
+  EXPECT_FALSE(ContentContextOptions::FromKey(key | (1llu << 56)).has_value());
+
+  auto with_byte = [key](int shift, uint64_t value) {
+    return (key & ~(0xFFllu << shift)) | (value << shift);
+  };
+  // Sample count.
+  EXPECT_FALSE(ContentContextOptions::FromKey(with_byte(48, 2)).has_value());
+  // Blend mode, the advanced blends are not pipeline blends.
+  EXPECT_FALSE(ContentContextOptions::FromKey(
+                   with_byte(40, static_cast<uint64_t>(BlendMode::kScreen)))
+                   .has_value());
+  EXPECT_FALSE(ContentContextOptions::FromKey(with_byte(40, 0xFF)).has_value());
+  // Depth compare, stencil mode, primitive type and pixel format.
+  EXPECT_FALSE(ContentContextOptions::FromKey(with_byte(32, 0xFF)).has_value());
+  EXPECT_FALSE(ContentContextOptions::FromKey(with_byte(24, 0xFF)).has_value());
+  EXPECT_FALSE(ContentContextOptions::FromKey(with_byte(16, 0xFF)).has_value());
+  EXPECT_FALSE(ContentContextOptions::FromKey(with_byte(8, 0xFF)).has_value());
+}
+
+}  // namespace testing
+}  // namespace impeller
@@ -0,0 +1,131 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/contents/round_rect_contents.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "impeller/entity/contents/color_source_contents.h"
+#include "impeller/entity/contents/content_context.h"
+
+namespace impeller {
+
+namespace {
+using PipelineBuilderCallback =
+    std::function<PipelineRef(ContentContextOptions)>;
+
+using VS = RoundRectPipeline::VertexShader;
+using FS = RoundRectPipeline::FragmentShader;
+
+bool CornerFits(const Size& radii, const Size& half_size) {
+  return radii.width <= half_size.width && radii.height <= half_size.height;
+}
+
+bool CornerCanStroke(const Size& radii, const StrokeParameters& stroke) {
+  if (radii.IsEmpty()) {
+    return stroke.join == Join::kRound;
+  }
+  if (ScalarNearlyEqual(radii.width, radii.height)) {
+    // Circular corners have an exact distance function.
+    return true;
+  }
+  return stroke.width <= std::min(radii.width, radii.height);
+}
+}  // namespace
+
+bool RoundRectContents::CanRender(const RoundRect& round_rect) {
+  if (!round_rect.IsFinite() || round_rect.IsEmpty()) {
+    return false;
+  }
+  const Size half_size = round_rect.GetBounds().GetSize() * 0.5f;
+  const RoundingRadii& radii = round_rect.GetRadii();
+  return CornerFits(radii.top_left, half_size) &&
+         CornerFits(radii.top_right, half_size) &&
+         CornerFits(radii.bottom_right, half_size) &&
+         CornerFits(radii.bottom_left, half_size);
+}
+
+bool RoundRectContents::CanStroke(const RoundRect& round_rect,
+                                  const StrokeParameters& stroke) {
+  if (!CanRender(round_rect) || !(stroke.width > 0.0f) ||
+      !std::isfinite(stroke.width)) {
+    return false;
+  }
+  const RoundingRadii& radii = round_rect.GetRadii();
+  return CornerCanStroke(radii.top_left, stroke) &&
+         CornerCanStroke(radii.top_right, stroke) &&
+         CornerCanStroke(radii.bottom_right, stroke) &&
+         CornerCanStroke(radii.bottom_left, stroke);
+}
+
+std::unique_ptr<RoundRectContents> RoundRectContents::Make(
+    const RoundRect& round_rect,
+    Color color) {
+  return std::unique_ptr<RoundRectContents>(new RoundRectContents(
+      round_rect, color, /*stroke_width=*/0.0f, /*stroked=*/false));
+}
+
+std::unique_ptr<RoundRectContents> RoundRectContents::MakeStroked(
+    const RoundRect& round_rect,
+    Scalar stroke_width,
+    Color color) {
+  return std::unique_ptr<RoundRectContents>(
+      new RoundRectContents(round_rect, color, stroke_width, /*stroked=*/true));
+}
+
+RoundRectContents::RoundRectContents(const RoundRect& round_rect,
+                                     Color color,
+                                     Scalar stroke_width,
+                                     bool stroked)
+    : round_rect_(round_rect),
+      color_(color),
+      stroke_width_(stroke_width),
+      stroked_(stroked),
+      quad_(stroked ? round_rect.GetBounds().Expand(stroke_width * 0.5f)
+                    : round_rect.GetBounds()) {}
+
+bool RoundRectContents::Render(const ContentContext& renderer,
+                               const Entity& entity,
+                               RenderPass& pass) const {
+  auto& data_host_buffer = renderer.GetTransientsDataBuffer();
+
+  const Rect& bounds = round_rect_.GetBounds();
+  const RoundingRadii& radii = round_rect_.GetRadii();
+
+  VS::FrameInfo frame_info;
+  FS::FragInfo frag_info;
+  frag_info.color = color_.WithAlpha(color_.alpha * GetOpacityFactor());
+  frag_info.center = bounds.GetCenter();
+  frag_info.half_size = Point(bounds.GetSize() * 0.5f);
+  frag_info.radii_x = Vector4(radii.top_left.width, radii.top_right.width,
+                              radii.bottom_right.width,
+                              radii.bottom_left.width);
+  frag_info.radii_y = Vector4(radii.top_left.height, radii.top_right.height,
+                              radii.bottom_right.height,
+                              radii.bottom_left.height);
+  frag_info.stroke_width = stroke_width_;
+  frag_info.aa_pixels = 1.0;
+  frag_info.stroked = stroked_ ? 1.0f : 0.0f;
+
+  PipelineBuilderCallback pipeline_callback =
+      [&renderer](ContentContextOptions options) {
+        return renderer.GetRoundRectPipeline(options);
+      };
+
+  return ColorSourceContents::DrawGeometry<VS>(
+      this, &quad_, renderer, entity, pass, pipeline_callback, frame_info,
+      /*bind_fragment_callback=*/
+      [&frag_info, &data_host_buffer](RenderPass& pass) {
+        FS::BindFragInfo(pass, data_host_buffer.EmplaceUniform(frag_info));
+        pass.SetCommandLabel("RoundRect");
+        return true;
+      });
+}
+
+std::optional<Rect> RoundRectContents::GetCoverage(const Entity& entity) const {
+  return quad_.GetCoverage(entity.GetTransform());
+}
+
+}  // namespace impeller
@@ -0,0 +1,67 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_ENTITY_CONTENTS_ROUND_RECT_CONTENTS_H_
+#define FLUTTER_IMPELLER_ENTITY_CONTENTS_ROUND_RECT_CONTENTS_H_
+
+#include <memory>
+
+#include "flutter/impeller/entity/contents/color_source_contents.h"
+#include "flutter/impeller/entity/contents/contents.h"
+#include "impeller/entity/geometry/rect_geometry.h"
+#include "impeller/geometry/round_rect.h"
+#include "impeller/geometry/stroke_parameters.h"
+
+namespace impeller {
+
+/// Draws a solid color round rect or oval, filled or stroked, by evaluating
+/// its signed distance in the fragment shader over a single bounding quad.
+///
+/// The anti-aliasing ramp is computed analytically, so the result does not
+/// depend on the sample count of the render target and the vertex count does
+/// not grow with the device size of the corners.
+class RoundRectContents : public ColorSourceContents {
+ public:
+  /// Whether |round_rect| can be drawn by these contents. Every corner must
+  /// fit within its own quadrant of the bounds.
+  static bool CanRender(const RoundRect& round_rect);
+
+  /// Whether a stroke of |round_rect| can be drawn by these contents.
+  ///
+  /// Sharp corners are only supported with round joins, and elliptical
+  /// corners only for strokes that stay close to the corner curve, where the
+  /// distance approximation used by the shader holds.
+  static bool CanStroke(const RoundRect& round_rect,
+                        const StrokeParameters& stroke);
+
+  static std::unique_ptr<RoundRectContents> Make(const RoundRect& round_rect,
+                                                 Color color);
+
+  static std::unique_ptr<RoundRectContents>
+  MakeStroked(const RoundRect& round_rect, Scalar stroke_width, Color color);
+
+  bool Render(const ContentContext& renderer,
+              const Entity& entity,
+              RenderPass& pass) const override;
+
+  std::optional<Rect> GetCoverage(const Entity& entity) const override;
+
+ private:
+  RoundRectContents(const RoundRect& round_rect,
+                    Color color,
+                    Scalar stroke_width,
+                    bool stroked);
+
+  const RoundRect round_rect_;
+  const Color color_;
+  const Scalar stroke_width_;
+  const bool stroked_;
+  // The quad the shader is evaluated over, the bounds of the round rect
+  // outset by half of the stroke width.
+  const FillRectGeometry quad_;
+};
+
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_ENTITY_CONTENTS_ROUND_RECT_CONTENTS_H_
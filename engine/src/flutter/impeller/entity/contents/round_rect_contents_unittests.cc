@@ -0,0 +1,78 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/contents/round_rect_contents.h"
+
+#include "impeller/entity/entity.h"
+#include "impeller/geometry/geometry_asserts.h"
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace impeller {
+namespace testing {
+
+TEST(RoundRectContents, CoverageIncludesHalfTheStroke) {
+  RoundRect round_rect =
+      RoundRect::MakeRectRadius(Rect::MakeLTRB(10, 20, 110, 70), 10);
+  Entity entity;
+
+  auto fill = RoundRectContents::Make(round_rect, Color::Red());
+  EXPECT_RECT_NEAR(fill->GetCoverage(entity).value_or(Rect()),
+                   Rect::MakeLTRB(10, 20, 110, 70));
+
+  auto stroke = RoundRectContents::MakeStroked(round_rect, 4, Color::Red());
+  EXPECT_RECT_NEAR(stroke->GetCoverage(entity).value_or(Rect()),
+                   Rect::MakeLTRB(8, 18, 112, 72));
+}
+
+TEST(RoundRectContents, CanRenderRequiresCornersInTheirQuadrant) {
+  Rect bounds = Rect::MakeLTRB(0, 0, 100, 50);
+  EXPECT_TRUE(RoundRectContents::CanRender(RoundRect::MakeRect(bounds)));
+  EXPECT_TRUE(RoundRectContents::CanRender(RoundRect::MakeOval(bounds)));
+  EXPECT_TRUE(RoundRectContents::CanRender(
+      RoundRect::MakeRectRadii(bounds, {
+                                           .top_left = Size(10, 5),
+                                           .top_right = Size(20, 10),
+                                           .bottom_left = Size(0, 0),
+                                           .bottom_right = Size(50, 25),
+                                       })));
+  // A corner wider than half the bounds overlaps its neighbor's quadrant.
+  EXPECT_FALSE(RoundRectContents::CanRender(
+      RoundRect::MakeRectRadii(bounds, {
+                                           .top_left = Size(80, 10),
+                                           .top_right = Size(20, 10),
+                                       })));
+  EXPECT_FALSE(RoundRectContents::CanRender(
+      RoundRect::MakeRect(Rect::MakeLTRB(0, 0, 0, 50))));
+}
+
+TEST(RoundRectContents, CanStrokeChecksJoinsAndEllipticalCorners) {
+  Rect bounds = Rect::MakeLTRB(0, 0, 100, 50);
+  StrokeParameters miter{.width = 4, .join = Join::kMiter};
+  StrokeParameters round{.width = 4, .join = Join::kRound};
+
+  // Sharp corners need a round join.
+  EXPECT_FALSE(
+      RoundRectContents::CanStroke(RoundRect::MakeRect(bounds), miter));
+  EXPECT_TRUE(
+      RoundRectContents::CanStroke(RoundRect::MakeRect(bounds), round));
+
+  // Circular corners are exact for any width.
+  EXPECT_TRUE(RoundRectContents::CanStroke(
+      RoundRect::MakeRectRadius(bounds, 2),
+      StrokeParameters{.width = 20, .join = Join::kMiter}));
+
+  // Elliptical corners only for strokes no wider than the corner.
+  EXPECT_TRUE(RoundRectContents::CanStroke(RoundRect::MakeOval(bounds), miter));
+  EXPECT_FALSE(RoundRectContents::CanStroke(
+      RoundRect::MakeOval(bounds),
+      StrokeParameters{.width = 40, .join = Join::kMiter}));
+
+  // Hairlines take the general path.
+  EXPECT_FALSE(RoundRectContents::CanStroke(
+      RoundRect::MakeRectRadius(bounds, 10),
+      StrokeParameters{.width = 0, .join = Join::kRound}));
+}
+
+}  // namespace testing
+}  // namespace impeller
@@ -5,6 +5,7 @@
 #include "impeller/entity/contents/runtime_effect_contents.h"
 
 #include <algorithm>
+#include <cstring>
 #include <future>
 #include <memory>
 
@@ -35,24 +36,34 @@ BufferView RuntimeEffectContents::EmplaceVulkanUniform(
     HostBuffer& data_host_buffer,
     const RuntimeUniformDescription& uniform,
     size_t minimum_uniform_alignment) {
-  // TODO(jonahwilliams): rewrite this to emplace directly into
-  // HostBuffer.
-  std::vector<float> uniform_buffer;
-  uniform_buffer.reserve(uniform.struct_layout.size());
-  size_t uniform_byte_index = 0u;
-  for (char byte_type : uniform.struct_layout) {
-    if (byte_type == kPaddingType) {
-      uniform_buffer.push_back(0.f);
-    } else {
-      FML_DCHECK(byte_type == kFloatType);
-      uniform_buffer.push_back(reinterpret_cast<const float*>(
-          input_data->data())[uniform_byte_index++]);
-    }
-  }
+  const std::vector<uint8_t>& layout = uniform.struct_layout;
+  const float* source = reinterpret_cast<const float*>(input_data->data());
 
+  // The layout is written straight into the host buffer. Consecutive members
+  // of the same kind are copied or cleared together, so a block without
+  // padding is a single memcpy.
   return data_host_buffer.Emplace(
-      reinterpret_cast<const void*>(uniform_buffer.data()),
-      sizeof(float) * uniform_buffer.size(), minimum_uniform_alignment);
+      sizeof(float) * layout.size(), minimum_uniform_alignment,
+      [&layout, &source](uint8_t* buffer) {
+        float* destination = reinterpret_cast<float*>(buffer);
+        size_t index = 0u;
+        while (index < layout.size()) {
+          const uint8_t byte_type = layout[index];
+          size_t run_end = index + 1u;
+          while (run_end < layout.size() && layout[run_end] == byte_type) {
+            run_end++;
+          }
+          const size_t run_bytes = sizeof(float) * (run_end - index);
+          if (byte_type == kPaddingType) {
+            ::memset(destination + index, 0, run_bytes);
+          } else {
+            FML_DCHECK(byte_type == kFloatType);
+            ::memcpy(destination + index, source, run_bytes);
+            source += run_end - index;
+          }
+          index = run_end;
+        }
+      });
 }
 
 void RuntimeEffectContents::SetRuntimeStage(
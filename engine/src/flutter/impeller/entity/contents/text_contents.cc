@@ -30,7 +30,21 @@ TextContents::TextContents() = default;
 TextContents::~TextContents() = default;
 
 void TextContents::SetTextFrame(const std::shared_ptr<TextFrame>& frame) {
-  frame_ = frame;
+  frames_.clear();
+  frames_.push_back(FrameEntry{.frame = frame});
+}
+
+void TextContents::AddTextFrame(const std::shared_ptr<TextFrame>& frame,
+                                const Matrix& transform,
+                                Color color,
+                                const std::optional<StrokeParameters>& stroke) {
+  FML_DCHECK(frames_.empty() ||
+             frame->GetAtlasType() == frames_.front().frame->GetAtlasType());
+  frames_.push_back(FrameEntry{
+      .frame = frame,
+      .transform = transform,
+      .properties = MakeGlyphProperties(*frame, color, stroke),
+  });
 }
 
 void TextContents::SetColor(Color color) {
@@ -54,18 +68,34 @@ void TextContents::SetForceTextColor(bool value) {
 }
 
 std::optional<Rect> TextContents::GetCoverage(const Entity& entity) const {
-  return frame_->GetBounds().TransformBounds(entity.GetTransform());
+  std::optional<Rect> coverage;
+  for (const FrameEntry& entry : frames_) {
+    coverage = Rect::Union(coverage, entry.frame->GetBounds().TransformBounds(
+                                         entity.GetTransform() *
+                                         entry.transform));
+  }
+  return coverage;
 }
 
-void TextContents::SetTextProperties(
+GlyphProperties TextContents::MakeGlyphProperties(
+    const TextFrame& frame,
     Color color,
     const std::optional<StrokeParameters>& stroke) {
-  if (frame_->HasColor()) {
+  GlyphProperties properties;
+  if (frame.HasColor()) {
     // Alpha is always applied when rendering, remove it here so
     // we do not double-apply the alpha.
-    properties_.color = color.WithAlpha(1.0);
+    properties.color = color.WithAlpha(1.0);
   }
-  properties_.stroke = stroke;
+  properties.stroke = stroke;
+  return properties;
+}
+
+void TextContents::SetTextProperties(
+    Color color,
+    const std::optional<StrokeParameters>& stroke) {
+  FrameEntry& entry = frames_.front();
+  entry.properties = MakeGlyphProperties(*entry.frame, color, stroke);
 }
 
 namespace {
@@ -82,6 +112,14 @@ Scalar AttractToOne(Scalar x) {
   return x;
 }
 
+bool IsSameGlyphProperties(const std::optional<GlyphProperties>& a,
+                           const std::optional<GlyphProperties>& b) {
+  if (a.has_value() != b.has_value()) {
+    return false;
+  }
+  return !a.has_value() || GlyphProperties::Equal{}(a.value(), b.value());
+}
+
 }  // namespace
 
 void TextContents::ComputeVertexData(
@@ -106,6 +144,30 @@ void TextContents::ComputeVertexData(
   bool is_translation_scale = entity_transform.IsTranslationScaleOnly();
   Matrix basis_transform = entity_transform.Basis();
 
+  // The vertices only depend on the translation through the pixel grid the
+  // glyphs are snapped to, so a frame that has only moved by whole pixels
+  // since it was last drawn, as it does when it scrolls, reuses them.
+  TextFrame::VertexCache& cache = frame->GetVertexCache();
+  const std::pair<size_t, intptr_t> atlas_generation =
+      frame->GetAtlasGenerationAndID();
+  if (is_translation_scale && !cache.vertices.empty() &&
+      cache.scale == frame->GetScale() && cache.atlas_size == atlas_size &&
+      cache.atlas_generation == atlas_generation &&
+      IsSameGlyphProperties(cache.properties, glyph_properties) &&
+      cache.transform.Basis() == basis_transform) {
+    Point shift =
+        entity_transform * Point(0, 0) - cache.transform * Point(0, 0);
+    if (shift == shift.Round()) {
+      for (size_t v = 0; v < cache.vertices.size(); v++) {
+        vtx_contents[v].position = cache.vertices[v].position + shift;
+        vtx_contents[v].uv = cache.vertices[v].uv;
+      }
+      return;
+    }
+  }
+  std::vector<GlyphVertex> cache_vertices = std::move(cache.vertices);
+  cache_vertices.clear();
+
   VS::PerVertexData vtx;
   size_t i = 0u;
   size_t bounds_offset = 0u;
@@ -212,9 +274,22 @@ void TextContents::ComputeVertexData(
         vtx.uv = uv_origin + (uv_size * point);
         vtx.position = position;
         vtx_contents[i++] = vtx;
+        if (is_translation_scale) {
+          cache_vertices.push_back({.position = position, .uv = vtx.uv});
+        }
       }
     }
   }
+
+  // Frames with glyphs missing from the atlas are looked up again.
+  if (is_translation_scale && i == bounds_offset * unit_points.size()) {
+    cache.transform = entity_transform;
+    cache.scale = rounded_scale;
+    cache.atlas_size = atlas_size;
+    cache.atlas_generation = atlas_generation;
+    cache.properties = glyph_properties;
+    cache.vertices = std::move(cache_vertices);
+  }
 }
 
 bool TextContents::Render(const ContentContext& renderer,
@@ -225,7 +300,7 @@ bool TextContents::Render(const ContentContext& renderer,
     return true;
   }
 
-  GlyphAtlas::Type type = frame_->GetAtlasType();
+  GlyphAtlas::Type type = frames_.front().frame->GetAtlasType();
   const std::shared_ptr<GlyphAtlas>& atlas =
       renderer.GetLazyGlyphAtlas()->CreateOrGetGlyphAtlas(
           *renderer.GetContext(), renderer.GetTransientsDataBuffer(), type);
@@ -234,9 +309,11 @@ bool TextContents::Render(const ContentContext& renderer,
     VALIDATION_LOG << "Cannot render glyphs without prepared atlas.";
     return false;
   }
-  if (!frame_->IsFrameComplete()) {
-    VALIDATION_LOG << "Failed to find font glyph bounds.";
-    return false;
+  for (const FrameEntry& entry : frames_) {
+    if (!entry.frame->IsFrameComplete()) {
+      VALIDATION_LOG << "Failed to find font glyph bounds.";
+      return false;
+    }
   }
 
   // Information shared by all glyph draw calls.
@@ -290,8 +367,10 @@ bool TextContents::Render(const ContentContext& renderer,
   HostBuffer& data_host_buffer = renderer.GetTransientsDataBuffer();
   HostBuffer& indexes_host_buffer = renderer.GetTransientsIndexesBuffer();
   size_t glyph_count = 0;
-  for (const auto& run : frame_->GetRuns()) {
-    glyph_count += run.GetGlyphPositions().size();
+  for (const FrameEntry& entry : frames_) {
+    for (const auto& run : entry.frame->GetRuns()) {
+      glyph_count += run.GetGlyphPositions().size();
+    }
   }
   size_t vertex_count = glyph_count * 4;
   size_t index_count = glyph_count * 6;
@@ -301,13 +380,20 @@ bool TextContents::Render(const ContentContext& renderer,
       [&](uint8_t* data) {
         VS::PerVertexData* vtx_contents =
             reinterpret_cast<VS::PerVertexData*>(data);
-        ComputeVertexData(/*vtx_contents=*/vtx_contents,
-                          /*frame=*/frame_,
-                          /*scale=*/scale_,
-                          /*entity_transform=*/entity_transform,
-                          /*offset=*/offset_,
-                          /*glyph_properties=*/GetGlyphProperties(),
-                          /*atlas=*/atlas);
+        // The frames drawn together are appended to the same vertices.
+        for (const FrameEntry& entry : frames_) {
+          ComputeVertexData(
+              /*vtx_contents=*/vtx_contents,
+              /*frame=*/entry.frame,
+              /*scale=*/scale_,
+              /*entity_transform=*/entity_transform * entry.transform,
+              /*offset=*/offset_,
+              /*glyph_properties=*/entry.GetGlyphProperties(),
+              /*atlas=*/atlas);
+          for (const auto& run : entry.frame->GetRuns()) {
+            vtx_contents += run.GetGlyphPositions().size() * 4;
+          }
+        }
       });
   BufferView index_buffer_view = indexes_host_buffer.Emplace(
       index_count * sizeof(uint16_t), alignof(uint16_t), [&](uint8_t* data) {
@@ -331,9 +417,10 @@ bool TextContents::Render(const ContentContext& renderer,
   return pass.Draw().ok();
 }
 
-std::optional<GlyphProperties> TextContents::GetGlyphProperties() const {
-  return (properties_.stroke || frame_->HasColor())
-             ? std::optional<GlyphProperties>(properties_)
+std::optional<GlyphProperties> TextContents::FrameEntry::GetGlyphProperties()
+    const {
+  return (properties.stroke || frame->HasColor())
+             ? std::optional<GlyphProperties>(properties)
              : std::nullopt;
 }
 
@@ -6,6 +6,7 @@
 #define FLUTTER_IMPELLER_ENTITY_CONTENTS_TEXT_CONTENTS_H_
 
 #include <memory>
+#include <vector>
 
 #include "impeller/entity/contents/content_context.h"
 #include "impeller/entity/contents/contents.h"
@@ -28,6 +29,20 @@ class TextContents final : public Contents {
 
   void SetTextFrame(const std::shared_ptr<TextFrame>& frame);
 
+  /// @brief Draw a text frame with the same draw call as the other frames of
+  ///        the contents, such as the one set with |SetTextFrame|.
+  ///
+  ///        The frame is positioned by `transform`, relative to the transform
+  ///        of the entity, and `color` and `stroke` are its properties as in
+  ///        |SetTextProperties|. All the frames are drawn in the color of the
+  ///        contents, so they must share it, use the same glyph atlas, and
+  ///        either all or none of their transforms may be translation and
+  ///        scale only.
+  void AddTextFrame(const std::shared_ptr<TextFrame>& frame,
+                    const Matrix& transform,
+                    Color color,
+                    const std::optional<StrokeParameters>& stroke);
+
   void SetColor(Color color);
 
   /// @brief Force the text color to apply to the rendered glyphs, even if those
@@ -70,15 +85,28 @@ class TextContents final : public Contents {
       const std::shared_ptr<GlyphAtlas>& atlas);
 
  private:
-  std::optional<GlyphProperties> GetGlyphProperties() const;
-
-  std::shared_ptr<TextFrame> frame_;
+  struct FrameEntry {
+    std::shared_ptr<TextFrame> frame;
+    // The transform of the frame relative to the entity.
+    Matrix transform;
+    GlyphProperties properties;
+
+    std::optional<GlyphProperties> GetGlyphProperties() const;
+  };
+
+  static GlyphProperties MakeGlyphProperties(
+      const TextFrame& frame,
+      Color color,
+      const std::optional<StrokeParameters>& stroke);
+
+  // The frames in the order they are drawn. |SetTextFrame| replaces them
+  // with a single frame at the transform of the entity.
+  std::vector<FrameEntry> frames_;
   Scalar scale_ = 1.0;
   Scalar inherited_opacity_ = 1.0;
   Vector2 offset_;
   bool force_text_color_ = false;
   Color color_;
-  GlyphProperties properties_;
 
   TextContents(const TextContents&) = delete;
 
@@ -384,5 +384,56 @@ TEST_P(TextContentsTest, SimpleSubpixel80) {
   EXPECT_RECT_NEAR(uv_rect, Rect::MakeXYWH(1.0, 1.0, 54, 52));
 }
 
+TEST_P(TextContentsTest, ReusesVerticesOfFramesTranslatedByWholePixels) {
+  std::shared_ptr<TypographerContext> context = TypographerContextSkia::Make();
+  std::shared_ptr<GlyphAtlasContext> atlas_context =
+      context->CreateGlyphAtlasContext(GlyphAtlas::Type::kAlphaBitmap);
+  std::shared_ptr<HostBuffer> data_host_buffer = HostBuffer::Create(
+      GetContext()->GetResourceAllocator(), GetContext()->GetIdleWaiter(),
+      GetContext()->GetCapabilities()->GetMinimumUniformAlignment());
+  ASSERT_TRUE(context && context->IsValid());
+
+  auto compute_vertices = [&](const std::shared_ptr<TextFrame>& frame,
+                              Point translation) {
+    std::shared_ptr<GlyphAtlas> atlas =
+        CreateGlyphAtlas(*GetContext(), context.get(), *data_host_buffer,
+                         GlyphAtlas::Type::kAlphaBitmap, /*scale=*/Rational(1),
+                         atlas_context, frame, /*offset=*/{0, 0});
+    std::vector<GlyphAtlasPipeline::VertexShader::PerVertexData> data(8);
+    TextContents::ComputeVertexData(
+        data.data(), frame, /*scale=*/1.0,
+        /*entity_transform=*/Matrix::MakeTranslation(translation),
+        /*offset=*/Vector2(0, 0),
+        /*glyph_properties=*/std::nullopt, atlas);
+    return data;
+  };
+
+  std::shared_ptr<TextFrame> fresh_frame =
+      MakeTextFrame("th", "ahem.ttf", TextOptions{.font_size = 50});
+  std::shared_ptr<TextFrame> scrolled_frame =
+      MakeTextFrame("th", "ahem.ttf", TextOptions{.font_size = 50});
+
+  // The vertices of the scrolled frame are computed at the origin, and then
+  // translated from the cache.
+  compute_vertices(scrolled_frame, Point(0, 0));
+  EXPECT_FALSE(scrolled_frame->GetVertexCache().vertices.empty());
+  auto scrolled = compute_vertices(scrolled_frame, Point(3, -7));
+  auto fresh = compute_vertices(fresh_frame, Point(3, -7));
+  for (size_t i = 0; i < fresh.size(); i++) {
+    EXPECT_EQ(scrolled[i].position, fresh[i].position) << i;
+    EXPECT_EQ(scrolled[i].uv, fresh[i].uv) << i;
+  }
+  EXPECT_EQ(scrolled_frame->GetVertexCache().transform, Matrix());
+
+  // Translations by fractions of a pixel compute the vertices again.
+  auto moved = compute_vertices(scrolled_frame, Point(3.5, -7));
+  auto fresh_moved = compute_vertices(fresh_frame, Point(3.5, -7));
+  for (size_t i = 0; i < fresh.size(); i++) {
+    EXPECT_EQ(moved[i].position, fresh_moved[i].position) << i;
+  }
+  EXPECT_EQ(scrolled_frame->GetVertexCache().transform,
+            Matrix::MakeTranslation({3.5, -7}));
+}
+
 }  // namespace testing
 }  // namespace impeller
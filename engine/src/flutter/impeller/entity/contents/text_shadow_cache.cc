@@ -4,7 +4,11 @@
 
 #include "impeller/entity/contents/text_shadow_cache.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "fml/closure.h"
+#include "fml/trace_event.h"
 #include "impeller/entity/contents/content_context.h"
 #include "impeller/entity/contents/contents.h"
 #include "impeller/entity/contents/filters/filter_contents.h"
@@ -15,6 +19,24 @@ namespace impeller {
 // Rounds sigma values for gaussian blur to nearest decimal.
 static constexpr int32_t kMaxSigmaDenominator = 10;
 
+// The cached shadows are rendered into RGBA8 textures.
+static constexpr size_t kBytesPerPixel = 4u;
+
+/// Estimate the size of the texture backing the blurred |entity| from the
+/// coverage of its contents in texture space.
+static size_t EstimateByteSize(const Entity& entity) {
+  Entity texture_space_entity = entity.Clone();
+  texture_space_entity.SetTransform(Matrix());
+  std::optional<Rect> coverage =
+      entity.GetContents()->GetCoverage(texture_space_entity);
+  if (!coverage.has_value() || coverage->IsEmpty()) {
+    return 0u;
+  }
+  return static_cast<size_t>(std::ceil(coverage->GetWidth())) *
+         static_cast<size_t>(std::ceil(coverage->GetHeight())) *
+         kBytesPerPixel;
+}
+
 TextShadowCache::TextShadowCacheKey::TextShadowCacheKey(Scalar p_max_basis,
                                                         int64_t p_identifier,
                                                         bool p_is_single_glyph,
@@ -30,31 +52,72 @@ TextShadowCache::TextShadowCacheKey::TextShadowCacheKey(Scalar p_max_basis,
       color(p_color) {}
 
 void TextShadowCache::MarkFrameStart() {
-  for (auto& entry : entries_) {
-    entry.second.used_this_frame = false;
-  }
+  frame_count_++;
+  stats_.hit_count = 0u;
+  stats_.miss_count = 0u;
+  stats_.evicted_count = 0u;
 }
 
 void TextShadowCache::MarkFrameEnd() {
-  absl::erase_if(entries_,
-                 [](const auto& pair) { return !pair.second.used_this_frame; });
+  size_t resident_bytes = 0u;
+  for (const auto& entry : entries_) {
+    resident_bytes += entry.second.byte_size;
+  }
+
+  if (resident_bytes > max_bytes_) {
+    std::vector<std::pair<uint64_t, TextShadowCacheKey>> evictable;
+    for (const auto& entry : entries_) {
+      if (entry.second.last_used_frame != frame_count_) {
+        evictable.emplace_back(entry.second.last_used_frame, entry.first);
+      }
+    }
+    std::stable_sort(
+        evictable.begin(), evictable.end(),
+        [](const auto& a, const auto& b) { return a.first < b.first; });
+    for (const auto& [last_used_frame, key] : evictable) {
+      if (resident_bytes <= max_bytes_) {
+        break;
+      }
+      auto it = entries_.find(key);
+      resident_bytes -= it->second.byte_size;
+      entries_.erase(it);
+      stats_.evicted_count++;
+    }
+  }
+  stats_.resident_bytes = resident_bytes;
+
+  FML_TRACE_COUNTER("flutter", "TextShadowCache",
+                    reinterpret_cast<int64_t>(this),  // Trace Counter ID
+                    "Hits", stats_.hit_count,         //
+                    "Misses", stats_.miss_count,      //
+                    "Evicted", stats_.evicted_count,  //
+                    "ResidentBytes", stats_.resident_bytes);
+}
+
+void TextShadowCache::Clear() {
+  stats_.evicted_count += entries_.size();
+  stats_.resident_bytes = 0u;
+  entries_.clear();
 }
 
 std::optional<Entity> TextShadowCache::Lookup(
     const ContentContext& renderer,
     const Entity& entity,
     const std::shared_ptr<FilterContents>& contents,
-    const TextShadowCacheKey& text_key) {
+    const TextShadowCacheKey& text_key,
+    const std::shared_ptr<TextFrame>& text_frame) {
   auto it = entries_.find(text_key);
 
   if (it != entries_.end()) {
-    it->second.used_this_frame = true;
+    stats_.hit_count++;
+    it->second.last_used_frame = frame_count_;
     Entity cache_entity = it->second.entity.Clone();
     cache_entity.SetClipDepth(entity.GetClipDepth());
     cache_entity.SetTransform(entity.GetTransform() * it->second.key_matrix);
     return cache_entity;
   }
 
+  stats_.miss_count++;
   std::optional<Rect> filter_coverage = contents->GetCoverage(entity);
   if (!filter_coverage.has_value()) {
     return std::nullopt;
@@ -85,10 +148,13 @@ std::optional<Entity> TextShadowCache::Lookup(
   // them.
   Matrix key_matrix =
       entity.GetTransform().Invert() * maybe_entity->GetTransform();
-  entries_[text_key] =
-      TextShadowCacheData{.entity = maybe_entity.value().Clone(),
-                          .used_this_frame = true,
-                          .key_matrix = key_matrix};
+  entries_[text_key] = TextShadowCacheData{
+      .entity = maybe_entity.value().Clone(),
+      .last_used_frame = frame_count_,
+      .key_matrix = key_matrix,
+      .byte_size = EstimateByteSize(maybe_entity.value()),
+      .text_frame = text_key.is_single_glyph ? nullptr : text_frame,
+  };
 
   maybe_entity->SetClipDepth(entity.GetClipDepth());
   return maybe_entity;
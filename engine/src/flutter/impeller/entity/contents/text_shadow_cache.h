@@ -11,6 +11,7 @@
 #include "impeller/entity/entity.h"
 #include "impeller/geometry/scalar.h"
 #include "impeller/geometry/sigma.h"
+#include "impeller/typographer/text_frame.h"
 #include "third_party/abseil-cpp/absl/container/flat_hash_map.h"
 
 namespace impeller {
@@ -19,7 +20,10 @@ namespace impeller {
 ///
 /// Text shadows are generally stable, but expensive to compute as we use a
 /// full gaussian blur. This class caches these shadows by text blob identifier
-/// and holds them for at least one frame.
+/// and holds them across frames until the cached textures exceed the byte
+/// budget, at which point the least recently used shadows are evicted. The
+/// cached shadows are re-positioned relative to the entity transform, so
+/// scrolling text keeps hitting the cache.
 ///
 /// Additionally, there is an optimization for a single glyph (generally an
 /// Icon) that uses the content itself as a key.
@@ -30,7 +34,11 @@ namespace impeller {
 /// substantially better performance than Skia.
 class TextShadowCache {
  public:
-  TextShadowCache() = default;
+  /// The default budget for the textures of cached shadows.
+  static constexpr size_t kDefaultMaxBytes = 16u * 1024u * 1024u;
+
+  explicit TextShadowCache(size_t max_bytes = kDefaultMaxBytes)
+      : max_bytes_(max_bytes) {}
 
   ~TextShadowCache() = default;
 
@@ -71,20 +79,41 @@ class TextShadowCache {
     };
   };
 
-  /// @brief Mark all glyph textures as unused this frame.
+  /// @brief The effectiveness of the cache over the last frame.
+  struct Stats {
+    size_t hit_count = 0u;
+    size_t miss_count = 0u;
+    size_t evicted_count = 0u;
+    /// The estimated size of the textures of all cached shadows.
+    size_t resident_bytes = 0u;
+  };
+
+  /// @brief Reset the per-frame stats and start a new frame.
   void MarkFrameStart();
 
-  /// @brief Remove all glyph textures that were not referenced at least once.
+  /// @brief Remove the least recently used glyph textures until the cache fits
+  ///        in its byte budget and report the stats of the frame.
   void MarkFrameEnd();
 
+  /// @brief Remove all cached shadows, for example because the cache is over
+  ///        the global GPU resource budget.
+  void Clear();
+
   /// @brief Lookup the entity in the cache with the given filter/text contents,
   ///        returning the new entity to render.
   ///
-  /// If the entity is not present, render and place in the cache.
+  /// If the entity is not present, render and place in the cache. The
+  /// |text_frame| identified by a key that isn't a single glyph is retained
+  /// by the cache so that its identifier can't be re-used by another frame.
   std::optional<Entity> Lookup(const ContentContext& renderer,
                                const Entity& entity,
                                const std::shared_ptr<FilterContents>& contents,
-                               const TextShadowCacheKey&);
+                               const TextShadowCacheKey&,
+                               const std::shared_ptr<TextFrame>& text_frame);
+
+  /// @brief The stats of the current frame, or the last frame if no frame is
+  ///        in progress.
+  const Stats& GetStats() const { return stats_; }
 
   // Visible for testing.
   size_t GetCacheSizeForTesting() const { return entries_.size(); }
@@ -96,10 +125,16 @@ class TextShadowCache {
 
   struct TextShadowCacheData {
     Entity entity;
-    bool used_this_frame = true;
+    uint64_t last_used_frame = 0u;
     Matrix key_matrix;
+    size_t byte_size = 0u;
+    std::shared_ptr<TextFrame> text_frame;
   };
 
+  size_t max_bytes_;
+  uint64_t frame_count_ = 0u;
+  Stats stats_;
+
   absl::flat_hash_map<TextShadowCacheKey,
                       TextShadowCacheData,
                       TextShadowCacheKey::Hash,
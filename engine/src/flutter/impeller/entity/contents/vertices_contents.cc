@@ -96,6 +96,17 @@ void VerticesSimpleBlendContents::SetLazyTextureCoverage(Rect rect) {
   lazy_texture_coverage_ = rect;
 }
 
+void VerticesSimpleBlendContents::SetPreventOverdraw(bool prevent_overdraw) {
+  prevent_overdraw_ = prevent_overdraw;
+}
+
+static void ApplyPreventOverdraw(ContentContextOptions& options) {
+  // All primitives of the draw share one depth value, so a strict depth test
+  // with depth writes keeps the first fragment written to each pixel.
+  options.depth_write_enabled = true;
+  options.depth_compare = CompareFunction::kGreater;
+}
+
 bool VerticesSimpleBlendContents::Render(const ContentContext& renderer,
                                          const Entity& entity,
                                          RenderPass& pass) const {
@@ -153,6 +164,9 @@ bool VerticesSimpleBlendContents::Render(const ContentContext& renderer,
 
     auto options = OptionsFromPassAndEntity(pass, entity);
     options.primitive_type = geometry_result.type;
+    if (prevent_overdraw_) {
+      ApplyPreventOverdraw(options);
+    }
     auto inverted_blend_mode =
         InvertPorterDuffBlend(blend_mode).value_or(BlendMode::kSrc);
     pass.SetPipeline(
@@ -189,6 +203,9 @@ bool VerticesSimpleBlendContents::Render(const ContentContext& renderer,
 
   auto options = OptionsFromPassAndEntity(pass, entity);
   options.primitive_type = geometry_result.type;
+  if (prevent_overdraw_) {
+    ApplyPreventOverdraw(options);
+  }
   pass.SetPipeline(renderer.GetDrawVerticesUberPipeline(blend_mode, options));
 
   FS::BindTextureSampler(pass, texture, dst_sampler);
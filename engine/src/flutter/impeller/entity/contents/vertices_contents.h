@@ -44,6 +44,12 @@ class VerticesSimpleBlendContents final : public Contents {
 
   void SetLazyTextureCoverage(Rect rect);
 
+  /// Reject the fragments of later primitives that land on pixels already
+  /// written by earlier primitives of the same draw. This lets opaque
+  /// geometry be submitted front-to-back so that hidden fragments are not
+  /// shaded.
+  void SetPreventOverdraw(bool prevent_overdraw);
+
   // |Contents|
   std::optional<Rect> GetCoverage(const Entity& entity) const override;
 
@@ -63,6 +69,7 @@ class VerticesSimpleBlendContents final : public Contents {
   Matrix inverse_matrix_ = {};
   std::optional<Rect> lazy_texture_coverage_;
   LazyTexture lazy_texture_;
+  bool prevent_overdraw_ = false;
 
   VerticesSimpleBlendContents(const VerticesSimpleBlendContents&) = delete;
 
@@ -0,0 +1,159 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/benchmarking/benchmarking.h"
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "impeller/core/allocator.h"
+#include "impeller/core/device_buffer.h"
+#include "impeller/core/host_buffer.h"
+#include "impeller/geometry/matrix.h"
+#include "impeller/tessellator/tessellator.h"
+
+namespace impeller {
+
+namespace {
+
+/// A device buffer in host memory so that the host buffer can be measured
+/// without a backend.
+class HostMemoryDeviceBuffer final : public DeviceBuffer {
+ public:
+  explicit HostMemoryDeviceBuffer(const DeviceBufferDescriptor& desc)
+      : DeviceBuffer(desc), storage_(desc.size) {}
+
+  bool SetLabel(std::string_view label) override { return true; }
+
+  bool SetLabel(std::string_view label, Range range) override { return true; }
+
+  uint8_t* OnGetContents() const override {
+    return const_cast<uint8_t*>(storage_.data());
+  }
+
+ private:
+  std::vector<uint8_t> storage_;
+
+  bool OnCopyHostBuffer(const uint8_t* source,
+                        Range source_range,
+                        size_t offset) override {
+    ::memcpy(storage_.data() + offset, source + source_range.offset,
+             source_range.length);
+    return true;
+  }
+};
+
+class HostMemoryAllocator final : public Allocator {
+ public:
+  HostMemoryAllocator() = default;
+
+  ISize GetMaxTextureSizeSupported() const override { return {4096, 4096}; }
+
+ private:
+  std::shared_ptr<DeviceBuffer> OnCreateBuffer(
+      const DeviceBufferDescriptor& desc) override {
+    return std::make_shared<HostMemoryDeviceBuffer>(desc);
+  }
+
+  std::shared_ptr<Texture> OnCreateTexture(const TextureDescriptor& desc,
+                                           bool threadsafe) override {
+    return nullptr;
+  }
+};
+
+/// The size of a typical fragment uniform block, such as the frag info of a
+/// gradient.
+struct BenchmarkUniform {
+  Matrix matrix;
+  Vector4 values[4];
+};
+
+/// The number of uniform blocks emplaced per simulated frame.
+constexpr size_t kUniformsPerFrame = 256u;
+
+std::shared_ptr<HostBuffer> CreateHostBuffer() {
+  return HostBuffer::Create(std::make_shared<HostMemoryAllocator>(),
+                            /*idle_waiter=*/nullptr,
+                            /*minimum_uniform_alignment=*/256u);
+}
+
+}  // namespace
+
+static void BM_HostBufferEmplaceUniform(benchmark::State& state,
+                                        bool identical) {
+  std::shared_ptr<HostBuffer> host_buffer = CreateHostBuffer();
+  BenchmarkUniform uniform = {};
+
+  while (state.KeepRunning()) {
+    for (size_t i = 0; i < kUniformsPerFrame; i++) {
+      if (!identical) {
+        uniform.values[0].x = static_cast<Scalar>(i);
+      }
+      benchmark::DoNotOptimize(host_buffer->EmplaceUniform(uniform));
+    }
+    host_buffer->Reset();
+  }
+  state.SetItemsProcessed(state.iterations() * kUniformsPerFrame);
+}
+
+static void BM_HostBufferEmplaceVertices(benchmark::State& state) {
+  std::shared_ptr<HostBuffer> host_buffer = CreateHostBuffer();
+  const size_t length = state.range(0) * sizeof(Point);
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(host_buffer->Emplace(
+        length, alignof(Point), [length](uint8_t* buffer) {
+          ::memset(buffer, 0, length);
+        }));
+    host_buffer->Reset();
+  }
+  state.SetBytesProcessed(state.iterations() * length);
+}
+
+template <class Generator>
+static void RunVertexGenerator(benchmark::State& state,
+                               const Generator& generator) {
+  size_t vertex_count = 0u;
+  while (state.KeepRunning()) {
+    vertex_count = 0u;
+    generator.GenerateVertices(
+        [&vertex_count](const Point& p) { vertex_count++; });
+    benchmark::DoNotOptimize(vertex_count);
+  }
+  state.counters["VertexCount"] = vertex_count;
+  state.SetItemsProcessed(state.iterations() * vertex_count);
+}
+
+static void BM_TessellatorFilledCircle(benchmark::State& state) {
+  Tessellator tessellator;
+  RunVertexGenerator(state, tessellator.FilledCircle(
+                                Matrix(), Point(0, 0), state.range(0)));
+}
+
+static void BM_TessellatorStrokedCircle(benchmark::State& state) {
+  Tessellator tessellator;
+  RunVertexGenerator(state,
+                     tessellator.StrokedCircle(Matrix(), Point(0, 0),
+                                               state.range(0), 2.0f));
+}
+
+static void BM_TessellatorFilledRoundRect(benchmark::State& state) {
+  Tessellator tessellator;
+  const Scalar radius = state.range(0);
+  RunVertexGenerator(
+      state, tessellator.FilledRoundRect(
+                 Matrix(), Rect::MakeLTRB(0, 0, radius * 4, radius * 3),
+                 Size(radius, radius)));
+}
+
+BENCHMARK_CAPTURE(BM_HostBufferEmplaceUniform, distinct, false);
+BENCHMARK_CAPTURE(BM_HostBufferEmplaceUniform, identical, true);
+BENCHMARK(BM_HostBufferEmplaceVertices)->Arg(64)->Arg(1024)->Arg(16384);
+
+BENCHMARK(BM_TessellatorFilledCircle)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BM_TessellatorStrokedCircle)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BM_TessellatorFilledRoundRect)->Arg(10)->Arg(100)->Arg(1000);
+
+}  // namespace impeller
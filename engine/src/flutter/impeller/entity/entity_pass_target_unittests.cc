@@ -9,6 +9,7 @@
 #include "impeller/core/formats.h"
 #include "impeller/entity/entity_pass_target.h"
 #include "impeller/entity/entity_playground.h"
+#include "impeller/entity/inline_pass_context.h"
 
 namespace impeller {
 namespace testing {
@@ -99,5 +100,40 @@ TEST_P(EntityPassTargetTest, SwapWithMSAAImplicitResolve) {
   ASSERT_EQ(color0.texture, color0.resolve_texture);
 }
 
+TEST_P(EntityPassTargetTest, OverwrittenMSAAPassDoesNotClearColor) {
+  auto content_context = GetContentContext();
+  auto render_target =
+      content_context->GetRenderTargetCache()->CreateOffscreenMSAA(
+          *content_context->GetContext(), {100, 100},
+          /*mip_count=*/1);
+  auto entity_pass_target = EntityPassTarget(
+      render_target,
+      content_context->GetDeviceCapabilities().SupportsReadFromResolve(),
+      content_context->GetDeviceCapabilities().SupportsImplicitResolvingMSAA());
+
+  InlinePassContext pass_context(*content_context, entity_pass_target);
+  ASSERT_TRUE(pass_context.GetRenderPass());
+  EXPECT_EQ(entity_pass_target.GetRenderTarget()
+                .GetColorAttachment(0)
+                .load_action,
+            LoadAction::kClear);
+  ASSERT_TRUE(pass_context.EndPass());
+
+  pass_context.MarkNextPassOverwritesColor();
+  ASSERT_TRUE(pass_context.GetRenderPass());
+  EXPECT_EQ(entity_pass_target.GetRenderTarget()
+                .GetColorAttachment(0)
+                .load_action,
+            LoadAction::kDontCare);
+  ASSERT_TRUE(pass_context.EndPass());
+
+  // The hint only applies to a single pass.
+  ASSERT_TRUE(pass_context.GetRenderPass());
+  EXPECT_EQ(entity_pass_target.GetRenderTarget()
+                .GetColorAttachment(0)
+                .load_action,
+            LoadAction::kClear);
+}
+
 }  // namespace testing
 }  // namespace impeller
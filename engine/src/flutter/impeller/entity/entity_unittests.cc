@@ -25,6 +25,7 @@
 #include "impeller/entity/contents/filters/filter_contents.h"
 #include "impeller/entity/contents/filters/gaussian_blur_filter_contents.h"
 #include "impeller/entity/contents/filters/inputs/filter_input.h"
+#include "impeller/entity/contents/gradient_texture_cache.h"
 #include "impeller/entity/contents/linear_gradient_contents.h"
 #include "impeller/entity/contents/radial_gradient_contents.h"
 #include "impeller/entity/contents/runtime_effect_contents.h"
@@ -49,6 +50,9 @@
 #include "impeller/playground/playground.h"
 #include "impeller/playground/widgets.h"
 #include "impeller/renderer/command.h"
+#ifdef IMPELLER_ENABLE_COMPUTE
+#include "impeller/renderer/compute_tessellator.h"
+#endif  // IMPELLER_ENABLE_COMPUTE
 #include "impeller/renderer/pipeline_descriptor.h"
 #include "impeller/renderer/render_pass.h"
 #include "impeller/renderer/render_target.h"
@@ -1934,6 +1938,40 @@ TEST_P(EntityTest, RuntimeEffectSetsRightSizeWhenUniformIsStruct) {
   //   4 bytes for iTime
   //   4 bytes padding
   EXPECT_EQ(buffer_view.GetRange().length, 16u);
+
+  const float* contents = reinterpret_cast<const float*>(
+      buffer_view.GetBuffer()->OnGetContents() + buffer_view.GetRange().offset);
+  EXPECT_EQ(contents[0], frag_uniforms.iResolution.x);
+  EXPECT_EQ(contents[1], frag_uniforms.iResolution.y);
+  EXPECT_EQ(contents[2], frag_uniforms.iTime);
+  EXPECT_EQ(contents[3], 0.0f);
+}
+
+TEST_P(EntityTest, GradientTextureCacheReusesIdenticalGradients) {
+  // Two color ramps are 8 bytes each, so the budget fits two of them.
+  GradientTextureCache cache(/*max_bytes=*/16u);
+  const std::shared_ptr<Context>& context = GetContext();
+  std::vector<Color> colors = {Color::Red(), Color::Blue()};
+  std::vector<Scalar> stops = {0.0, 1.0};
+
+  auto texture = cache.GetOrCreate(colors, stops, context);
+  ASSERT_TRUE(texture);
+  EXPECT_EQ(cache.GetOrCreate(colors, stops, context), texture);
+  EXPECT_EQ(cache.GetCacheSizeForTesting(), 1u);
+
+  std::vector<Color> other_colors = {Color::Green(), Color::Blue()};
+  auto other_texture = cache.GetOrCreate(other_colors, stops, context);
+  ASSERT_TRUE(other_texture);
+  EXPECT_NE(other_texture, texture);
+  EXPECT_EQ(cache.GetCacheSizeForTesting(), 2u);
+
+  // Touch the first ramp so that the second one is the least recently used.
+  EXPECT_EQ(cache.GetOrCreate(colors, stops, context), texture);
+  std::vector<Color> third_colors = {Color::White(), Color::Blue()};
+  ASSERT_TRUE(cache.GetOrCreate(third_colors, stops, context));
+  EXPECT_EQ(cache.GetCacheSizeForTesting(), 2u);
+  EXPECT_EQ(cache.GetOrCreate(colors, stops, context), texture);
+  EXPECT_NE(cache.GetOrCreate(other_colors, stops, context), other_texture);
 }
 
 TEST_P(EntityTest, ColorFilterWithForegroundColorAdvancedBlend) {
@@ -2224,6 +2262,30 @@ TEST_P(EntityTest, SpecializationConstantsAreAppliedToVariants) {
             expected_constants);
 }
 
+TEST_P(EntityTest, SpawnedContentContextSharesPipelines) {
+  auto content_context = GetContentContext();
+  ContentContext spawned_context(GetContext(), *content_context);
+  ASSERT_TRUE(spawned_context.IsValid());
+
+  ContentContextOptions options = {
+      .color_attachment_pixel_format = PixelFormat::kR8G8B8A8UNormInt,
+  };
+  EXPECT_EQ(spawned_context.GetSolidFillPipeline(options),
+            content_context->GetSolidFillPipeline(options));
+  EXPECT_EQ(spawned_context.GetLazyGlyphAtlas(),
+            content_context->GetLazyGlyphAtlas());
+  EXPECT_EQ(spawned_context.GetEmptyTexture(),
+            content_context->GetEmptyTexture());
+
+  // Frames of the two contexts must not write to each other's buffers.
+  EXPECT_NE(&spawned_context.GetTransientsDataBuffer(),
+            &content_context->GetTransientsDataBuffer());
+  EXPECT_NE(spawned_context.GetRenderTargetCache(),
+            content_context->GetRenderTargetCache());
+  EXPECT_NE(&spawned_context.GetTextShadowCache(),
+            &content_context->GetTextShadowCache());
+}
+
 TEST_P(EntityTest, DecalSpecializationAppliedToMorphologyFilter) {
   auto content_context = GetContentContext();
   auto default_color_burn = content_context->GetMorphologyFilterPipeline({
@@ -2315,6 +2377,38 @@ TEST_P(EntityTest, FillPathGeometryGetPositionBufferReturnsExpectedMode) {
   }
 }
 
+#ifdef IMPELLER_ENABLE_COMPUTE
+TEST_P(EntityTest, FillPathGeometryTessellatesDensePathsWithCompute) {
+  RenderTarget target;
+  testing::MockRenderPass mock_pass(GetContext(), target);
+
+  flutter::DlPathBuilder builder;
+  builder.MoveTo({0, 0});
+  for (int i = 0; i < 256; i++) {
+    Scalar x = i * 100.0f;
+    builder.CubicCurveTo({x, 100}, {x + 100, 100}, {x + 100, 0});
+  }
+  builder.Close();
+  flutter::DlPath path = builder.TakePath();
+
+  auto geometry = Geometry::MakeFillPath(path);
+  GeometryResult result =
+      geometry->GetPositionBuffer(*GetContentContext(), {}, mock_pass);
+
+  std::vector<ComputeTessellator::CS::Segment> segments;
+  size_t vertex_count =
+      ComputeTessellator::PrepareSegments(path, 1.0f, segments);
+  ASSERT_GE(vertex_count, ComputeTessellator::kMinVertexCount);
+  if (GetContentContext()->GetComputeTessellator()) {
+    EXPECT_EQ(result.type, PrimitiveType::kTriangle);
+    EXPECT_EQ(result.vertex_buffer.index_type, IndexType::kNone);
+    EXPECT_EQ(result.vertex_buffer.vertex_count, vertex_count);
+  } else {
+    EXPECT_NE(result.type, PrimitiveType::kTriangle);
+  }
+}
+#endif  // IMPELLER_ENABLE_COMPUTE
+
 TEST_P(EntityTest, StrokeArcGeometryGetPositionBufferReturnsExpectedMode) {
   RenderTarget target;
   testing::MockRenderPass mock_pass(GetContext(), target);
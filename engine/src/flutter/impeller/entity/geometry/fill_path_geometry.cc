@@ -9,9 +9,51 @@
 #include "impeller/core/vertex_buffer.h"
 #include "impeller/entity/contents/content_context.h"
 #include "impeller/entity/geometry/geometry.h"
+#include "impeller/entity/geometry/retained_geometry_cache.h"
+
+#ifdef IMPELLER_ENABLE_COMPUTE
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/compute_pass.h"
+#include "impeller/renderer/compute_tessellator.h"
+#endif  // IMPELLER_ENABLE_COMPUTE
 
 namespace impeller {
 
+#ifdef IMPELLER_ENABLE_COMPUTE
+/// Tessellates |source| in a compute pass if it produces enough vertices to
+/// be worth the dispatch.
+///
+/// The compute pass is encoded into its own command buffer, which is enqueued
+/// before the command buffer of the render pass that draws the vertices, the
+/// same way filters enqueue their subpasses.
+static std::optional<VertexBuffer> TessellateWithCompute(
+    const ContentContext& renderer,
+    const PathSource& source,
+    Scalar scale) {
+  ComputeTessellator* tessellator = renderer.GetComputeTessellator();
+  if (!tessellator || tessellator->Prepare(source, scale) <
+                          ComputeTessellator::kMinVertexCount) {
+    return std::nullopt;
+  }
+  std::shared_ptr<Context> context = renderer.GetContext();
+  std::shared_ptr<CommandBuffer> cmd_buffer = context->CreateCommandBuffer();
+  if (!cmd_buffer) {
+    return std::nullopt;
+  }
+  std::shared_ptr<ComputePass> compute_pass = cmd_buffer->CreateComputePass();
+  if (!compute_pass || !compute_pass->IsValid()) {
+    return std::nullopt;
+  }
+  fml::StatusOr<VertexBuffer> vertex_buffer = tessellator->Encode(
+      *compute_pass, renderer.GetTransientsDataBuffer());
+  if (!vertex_buffer.ok() || !compute_pass->EncodeCommands() ||
+      !context->EnqueueCommandBuffer(std::move(cmd_buffer))) {
+    return std::nullopt;
+  }
+  return std::move(vertex_buffer.value());
+}
+#endif  // IMPELLER_ENABLE_COMPUTE
+
 FillPathSourceGeometry::FillPathSourceGeometry(std::optional<Rect> inner_rect)
     : inner_rect_(inner_rect) {}
 
@@ -43,11 +85,46 @@ GeometryResult FillPathSourceGeometry::GetPositionBuffer(
   bool supports_triangle_fan =
       renderer.GetDeviceCapabilities().SupportsTriangleFan() &&
       supports_primitive_restart;
-  VertexBuffer vertex_buffer = renderer.GetTessellator().TessellateConvex(
-      GetSource(), data_host_buffer, indexes_host_buffer,
-      entity.GetTransform().GetMaxBasisLengthXY(),
-      /*supports_primitive_restart=*/supports_primitive_restart,
-      /*supports_triangle_fan=*/supports_triangle_fan);
+  Scalar scale = entity.GetTransform().GetMaxBasisLengthXY();
+  const flutter::DlPath* retainable_path = GetRetainablePath();
+  std::optional<VertexBuffer> retained;
+  if (retainable_path) {
+    retained =
+        renderer.GetRetainedGeometryCache().Lookup(*retainable_path, scale);
+  }
+
+#ifdef IMPELLER_ENABLE_COMPUTE
+  if (!retained.has_value()) {
+    // The compute output is a device private triangle list, which is not
+    // offered to the retained geometry cache.
+    std::optional<VertexBuffer> computed =
+        TessellateWithCompute(renderer, GetSource(), scale);
+    if (computed.has_value()) {
+      return GeometryResult{
+          .type = PrimitiveType::kTriangle,
+          .vertex_buffer = std::move(computed.value()),
+          .transform = entity.GetShaderTransform(pass),
+          .mode = GetResultMode(),
+      };
+    }
+  }
+#endif  // IMPELLER_ENABLE_COMPUTE
+
+  VertexBuffer vertex_buffer;
+  if (retained.has_value()) {
+    vertex_buffer = std::move(retained.value());
+  } else {
+    vertex_buffer = renderer.GetTessellator().TessellateConvex(
+        GetSource(), data_host_buffer, indexes_host_buffer, scale,
+        /*supports_primitive_restart=*/supports_primitive_restart,
+        /*supports_triangle_fan=*/supports_triangle_fan);
+    if (retainable_path) {
+      renderer.GetRetainedGeometryCache().Offer(
+          *retainable_path, scale, vertex_buffer,
+          vertex_buffer.vertex_buffer.GetRange().length / sizeof(Point),
+          *renderer.GetContext()->GetResourceAllocator());
+    }
+  }
 
   return GeometryResult{
       .type = supports_triangle_fan ? PrimitiveType::kTriangleFan
@@ -107,6 +184,10 @@ const PathSource& FillPathGeometry::GetSource() const {
   return path_;
 }
 
+const flutter::DlPath* FillPathGeometry::GetRetainablePath() const {
+  return &path_;
+}
+
 FillDiffRoundRectGeometry::FillDiffRoundRectGeometry(const RoundRect& outer,
                                                      const RoundRect& inner)
     : FillPathSourceGeometry(std::nullopt), source_(outer, inner) {}
@@ -30,6 +30,10 @@ class FillPathSourceGeometry : public Geometry {
   /// vertices.
   virtual const PathSource& GetSource() const = 0;
 
+  /// The DlPath backing |GetSource|, if any, whose tessellation may be
+  /// retained across frames in the |RetainedGeometryCache|.
+  virtual const flutter::DlPath* GetRetainablePath() const { return nullptr; }
+
  private:
   // |Geometry|
   GeometryResult GetPositionBuffer(const ContentContext& renderer,
@@ -73,6 +77,8 @@ class FillPathGeometry final : public FillPathSourceGeometry {
  protected:
   const PathSource& GetSource() const override;
 
+  const flutter::DlPath* GetRetainablePath() const override;
+
  private:
   const flutter::DlPath path_;
 };
@@ -161,10 +161,8 @@ std::optional<Rect> LineGeometry::GetCoverage(const Matrix& transform) const {
     return {};
   }
 
-  for (int i = 0; i < 4; i++) {
-    corners[i] = transform * corners[i];
-  }
-  return Rect::MakePointBounds(std::begin(corners), std::end(corners));
+  return Rect::MakeTransformedPointBounds(transform, std::begin(corners),
+                                         std::end(corners));
 }
 
 bool LineGeometry::CoversArea(const Matrix& transform, const Rect& rect) const {
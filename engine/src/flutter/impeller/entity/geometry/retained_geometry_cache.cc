@@ -0,0 +1,395 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/geometry/retained_geometry_cache.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "impeller/core/device_buffer.h"
+
+namespace impeller {
+
+namespace {
+BufferView RetainBufferView(const BufferView& view, Allocator& allocator) {
+  if (!view) {
+    return {};
+  }
+  const uint8_t* contents =
+      view.GetBuffer()->OnGetContents() + view.GetRange().offset;
+  std::shared_ptr<DeviceBuffer> buffer =
+      allocator.CreateBufferWithCopy(contents, view.GetRange().length);
+  if (!buffer) {
+    return {};
+  }
+  buffer->SetLabel("RetainedGeometryCache");
+  return DeviceBuffer::AsBufferView(std::move(buffer));
+}
+
+size_t GetAtlasContentsLength(const RetainedGeometryCache::AtlasKey& key) {
+  return key.count * (sizeof(RSTransform) + sizeof(Rect)) + key.colors_length;
+}
+
+void CopyAtlasContents(const RetainedGeometryCache::AtlasKey& key,
+                       std::vector<uint8_t>& contents) {
+  contents.resize(GetAtlasContentsLength(key));
+  uint8_t* data = contents.data();
+  std::memcpy(data, key.xform, key.count * sizeof(RSTransform));
+  data += key.count * sizeof(RSTransform);
+  std::memcpy(data, key.tex, key.count * sizeof(Rect));
+  data += key.count * sizeof(Rect);
+  if (key.colors_length > 0u) {
+    std::memcpy(data, key.colors, key.colors_length);
+  }
+}
+
+// Shadow meshes are reused across translations, see |LookupShadow|.
+std::optional<Matrix> GetShadowBasis(const Matrix& transform) {
+  if (transform.HasPerspective()) {
+    return std::nullopt;
+  }
+  Matrix basis = transform;
+  basis.m[12] = 0;
+  basis.m[13] = 0;
+  basis.m[14] = 0;
+  return basis;
+}
+
+bool AtlasContentsMatch(const RetainedGeometryCache::AtlasKey& key,
+                        const std::vector<uint8_t>& contents) {
+  if (contents.size() != GetAtlasContentsLength(key)) {
+    return false;
+  }
+  const uint8_t* data = contents.data();
+  if (std::memcmp(data, key.xform, key.count * sizeof(RSTransform)) != 0) {
+    return false;
+  }
+  data += key.count * sizeof(RSTransform);
+  if (std::memcmp(data, key.tex, key.count * sizeof(Rect)) != 0) {
+    return false;
+  }
+  data += key.count * sizeof(Rect);
+  return key.colors_length == 0u ||
+         std::memcmp(data, key.colors, key.colors_length) == 0;
+}
+}  // namespace
+
+void RetainedGeometryCache::MarkFrameStart() {
+  for (auto& entry : entries_) {
+    entry.second.used_this_frame = false;
+    entry.second.seen_last_frame = true;
+  }
+  for (auto& entry : stroke_entries_) {
+    entry.second.used_this_frame = false;
+    entry.second.seen_last_frame = true;
+  }
+  for (auto& entry : vertices_entries_) {
+    entry.second.used_this_frame = false;
+    entry.second.seen_last_frame = true;
+  }
+  for (auto& entry : atlas_entries_) {
+    entry.second.used_this_frame = false;
+    entry.second.seen_last_frame = true;
+  }
+  for (auto& entry : shadow_entries_) {
+    entry.second.used_this_frame = false;
+  }
+}
+
+void RetainedGeometryCache::MarkFrameEnd() {
+  absl::erase_if(entries_,
+                 [](const auto& pair) { return !pair.second.used_this_frame; });
+  absl::erase_if(stroke_entries_,
+                 [](const auto& pair) { return !pair.second.used_this_frame; });
+  absl::erase_if(vertices_entries_, [](const auto& pair) {
+    return !pair.second.used_this_frame || pair.second.source.expired();
+  });
+  absl::erase_if(atlas_entries_,
+                 [](const auto& pair) { return !pair.second.used_this_frame; });
+  absl::erase_if(shadow_entries_,
+                 [](const auto& pair) { return !pair.second.used_this_frame; });
+
+  retained_bytes_ = 0u;
+  for (const auto& entry : entries_) {
+    retained_bytes_ += entry.second.byte_size;
+  }
+  for (const auto& entry : stroke_entries_) {
+    retained_bytes_ += entry.second.byte_size;
+  }
+  for (const auto& entry : vertices_entries_) {
+    retained_bytes_ += entry.second.byte_size;
+  }
+  for (const auto& entry : atlas_entries_) {
+    retained_bytes_ += entry.second.byte_size;
+  }
+}
+
+void RetainedGeometryCache::Clear() {
+  entries_.clear();
+  stroke_entries_.clear();
+  vertices_entries_.clear();
+  atlas_entries_.clear();
+  shadow_entries_.clear();
+  retained_bytes_ = 0u;
+}
+
+void RetainedGeometryCache::MarkUsed(Data& data) {
+  data.used_this_frame = true;
+  data.last_used = ++use_count_;
+}
+
+void RetainedGeometryCache::Release(Data& data) {
+  retained_bytes_ -= data.byte_size;
+  data.vertex_buffer.reset();
+  data.byte_size = 0u;
+  // Start over as if the geometry had not been drawn before.
+  data.seen_last_frame = false;
+}
+
+bool RetainedGeometryCache::EvictToFit(size_t byte_size, const Data* keep) {
+  if (byte_size > max_bytes_) {
+    return false;
+  }
+  if (retained_bytes_ + byte_size <= max_bytes_) {
+    return true;
+  }
+  std::vector<Data*> evictable;
+  auto add_evictable = [&evictable, keep](auto& map) {
+    for (auto& entry : map) {
+      if (&entry.second != keep && entry.second.vertex_buffer.has_value()) {
+        evictable.push_back(&entry.second);
+      }
+    }
+  };
+  add_evictable(entries_);
+  add_evictable(stroke_entries_);
+  add_evictable(vertices_entries_);
+  add_evictable(atlas_entries_);
+  std::sort(evictable.begin(), evictable.end(),
+            [](const Data* a, const Data* b) {
+              return a->last_used < b->last_used;
+            });
+  for (Data* data : evictable) {
+    if (retained_bytes_ + byte_size <= max_bytes_) {
+      break;
+    }
+    Release(*data);
+  }
+  return retained_bytes_ + byte_size <= max_bytes_;
+}
+
+bool RetainedGeometryCache::MaybeRetain(Data& data,
+                                        bool inserted,
+                                        const VertexBuffer& vertex_buffer,
+                                        Allocator& allocator) {
+  MarkUsed(data);
+  if (inserted || !data.seen_last_frame || data.vertex_buffer.has_value()) {
+    return false;
+  }
+  const size_t byte_size = vertex_buffer.vertex_buffer.GetRange().length +
+                           vertex_buffer.index_buffer.GetRange().length;
+  if (!EvictToFit(byte_size, &data)) {
+    return false;
+  }
+
+  VertexBuffer retained = vertex_buffer;
+  retained.vertex_buffer =
+      RetainBufferView(vertex_buffer.vertex_buffer, allocator);
+  retained.index_buffer =
+      RetainBufferView(vertex_buffer.index_buffer, allocator);
+  if (!retained) {
+    // Allocation failed, try again the next time this geometry is drawn.
+    return false;
+  }
+  data.vertex_buffer = std::move(retained);
+  data.byte_size = byte_size;
+  retained_bytes_ += byte_size;
+  return true;
+}
+
+std::optional<VertexBuffer> RetainedGeometryCache::Lookup(
+    const flutter::DlPath& path,
+    Scalar scale) {
+  auto it = entries_.find(Key{.path = path, .scale = scale});
+  if (it == entries_.end()) {
+    return std::nullopt;
+  }
+  MarkUsed(it->second);
+  return it->second.vertex_buffer;
+}
+
+void RetainedGeometryCache::Offer(const flutter::DlPath& path,
+                                  Scalar scale,
+                                  const VertexBuffer& vertex_buffer,
+                                  size_t point_count,
+                                  Allocator& allocator) {
+  if (point_count < kMinRetainedPointCount || !vertex_buffer) {
+    return;
+  }
+  auto [it, inserted] =
+      entries_.try_emplace(Key{.path = path, .scale = scale}, Data{});
+  MaybeRetain(it->second, inserted, vertex_buffer, allocator);
+}
+
+std::optional<VertexBuffer> RetainedGeometryCache::LookupStroke(
+    const flutter::DlPath& path,
+    const StrokeParameters& stroke,
+    Scalar scale) {
+  auto it = stroke_entries_.find(
+      StrokeKey{.path = path, .stroke = stroke, .scale = scale});
+  if (it == stroke_entries_.end()) {
+    return std::nullopt;
+  }
+  MarkUsed(it->second);
+  return it->second.vertex_buffer;
+}
+
+void RetainedGeometryCache::OfferStroke(const flutter::DlPath& path,
+                                        const StrokeParameters& stroke,
+                                        Scalar scale,
+                                        const VertexBuffer& vertex_buffer,
+                                        size_t point_count,
+                                        Allocator& allocator) {
+  if (point_count < kMinRetainedPointCount || !vertex_buffer) {
+    return;
+  }
+  auto [it, inserted] = stroke_entries_.try_emplace(
+      StrokeKey{.path = path, .stroke = stroke, .scale = scale}, Data{});
+  MaybeRetain(it->second, inserted, vertex_buffer, allocator);
+}
+
+std::optional<VertexBuffer> RetainedGeometryCache::LookupVertices(
+    const std::shared_ptr<const void>& source,
+    std::optional<Matrix> uv_transform) {
+  auto it = vertices_entries_.find(
+      VerticesKey{.source = source.get(), .uv_transform = uv_transform});
+  if (it == vertices_entries_.end()) {
+    return std::nullopt;
+  }
+  if (it->second.source.expired()) {
+    // The address was reused by a new object.
+    retained_bytes_ -= it->second.byte_size;
+    vertices_entries_.erase(it);
+    return std::nullopt;
+  }
+  MarkUsed(it->second);
+  return it->second.vertex_buffer;
+}
+
+void RetainedGeometryCache::OfferVertices(
+    const std::shared_ptr<const void>& source,
+    std::optional<Matrix> uv_transform,
+    const VertexBuffer& vertex_buffer,
+    size_t point_count,
+    Allocator& allocator) {
+  if (point_count < kMinRetainedPointCount || !vertex_buffer || !source) {
+    return;
+  }
+  auto [it, inserted] = vertices_entries_.try_emplace(
+      VerticesKey{.source = source.get(), .uv_transform = uv_transform},
+      VerticesData{});
+  VerticesData& data = it->second;
+  if (!inserted && data.source.expired()) {
+    Release(data);
+    data = VerticesData{};
+    inserted = true;
+  }
+  data.source = source;
+  MaybeRetain(data, inserted, vertex_buffer, allocator);
+}
+
+std::optional<VertexBuffer> RetainedGeometryCache::LookupAtlas(
+    const AtlasKey& key) {
+  auto it = atlas_entries_.find(key);
+  if (it == atlas_entries_.end()) {
+    return std::nullopt;
+  }
+  AtlasData& data = it->second;
+  if (!data.vertex_buffer.has_value()) {
+    return std::nullopt;
+  }
+  if (!AtlasContentsMatch(key, data.contents)) {
+    // The arrays were rewritten in place or their storage was reused, start
+    // over as if the inputs had never been drawn.
+    Release(data);
+    data = AtlasData{};
+    return std::nullopt;
+  }
+  MarkUsed(data);
+  return data.vertex_buffer;
+}
+
+void RetainedGeometryCache::OfferAtlas(const AtlasKey& key,
+                                       const VertexBuffer& vertex_buffer,
+                                       Allocator& allocator) {
+  if (key.count * 6u < kMinRetainedPointCount || !vertex_buffer) {
+    return;
+  }
+  auto [it, inserted] = atlas_entries_.try_emplace(key, AtlasData{});
+  AtlasData& data = it->second;
+  if (MaybeRetain(data, inserted, vertex_buffer, allocator)) {
+    CopyAtlasContents(key, data.contents);
+  }
+}
+
+std::shared_ptr<ShadowVertices> RetainedGeometryCache::LookupShadow(
+    const flutter::DlPath& path,
+    Scalar occluder_height,
+    const Matrix& transform) {
+  std::optional<Matrix> basis = GetShadowBasis(transform);
+  if (!basis.has_value()) {
+    return nullptr;
+  }
+  auto it = shadow_entries_.find(ShadowKey{.path = path,
+                                           .occluder_height = occluder_height,
+                                           .basis = basis.value()});
+  if (it == shadow_entries_.end()) {
+    return nullptr;
+  }
+  it->second.used_this_frame = true;
+  return it->second.vertices;
+}
+
+void RetainedGeometryCache::OfferShadow(
+    const flutter::DlPath& path,
+    Scalar occluder_height,
+    const Matrix& transform,
+    std::shared_ptr<ShadowVertices> vertices) {
+  std::optional<Matrix> basis = GetShadowBasis(transform);
+  if (!basis.has_value() || !vertices) {
+    return;
+  }
+  shadow_entries_.insert_or_assign(
+      ShadowKey{.path = path,
+                .occluder_height = occluder_height,
+                .basis = basis.value()},
+      ShadowData{.vertices = std::move(vertices)});
+}
+
+size_t RetainedGeometryCache::GetRetainedCountForTesting() const {
+  size_t count = 0u;
+  for (const auto& entry : entries_) {
+    if (entry.second.vertex_buffer.has_value()) {
+      count++;
+    }
+  }
+  for (const auto& entry : stroke_entries_) {
+    if (entry.second.vertex_buffer.has_value()) {
+      count++;
+    }
+  }
+  for (const auto& entry : vertices_entries_) {
+    if (entry.second.vertex_buffer.has_value()) {
+      count++;
+    }
+  }
+  for (const auto& entry : atlas_entries_) {
+    if (entry.second.vertex_buffer.has_value()) {
+      count++;
+    }
+  }
+  return count + shadow_entries_.size();
+}
+
+}  // namespace impeller
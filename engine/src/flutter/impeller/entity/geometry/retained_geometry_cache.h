@@ -0,0 +1,369 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_ENTITY_GEOMETRY_RETAINED_GEOMETRY_CACHE_H_
+#define FLUTTER_IMPELLER_ENTITY_GEOMETRY_RETAINED_GEOMETRY_CACHE_H_
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "flutter/display_list/geometry/dl_path.h"
+#include "flutter/fml/hash_combine.h"
+#include "impeller/core/allocator.h"
+#include "impeller/core/vertex_buffer.h"
+#include "impeller/geometry/matrix.h"
+#include "impeller/geometry/rstransform.h"
+#include "impeller/geometry/scalar.h"
+#include "impeller/geometry/size.h"
+#include "impeller/geometry/stroke_parameters.h"
+#include "third_party/abseil-cpp/absl/container/flat_hash_map.h"
+
+namespace impeller {
+
+class ShadowVertices;
+
+/// @brief A cache for tessellated fill paths that re-uses the vertices across
+///        frames.
+///
+/// Content recorded into a retained display list (for example a
+/// DisplayListLayer in a scrolling list) draws the same paths with the same
+/// scale every frame and only the translation changes. The tessellation only
+/// depends on the path and the scale of the transform, so the vertices can be
+/// uploaded once into device buffers that outlive the per-frame host buffers
+/// and reused until the path is no longer drawn.
+///
+/// The same applies to the outlines generated for stroked paths, which also
+/// depend on the stroke parameters, and to the vertices generated for
+/// immutable drawVertices and drawAtlas inputs, which sprite based games and
+/// particle systems draw unchanged for many frames.
+///
+/// Geometry is only retained once it has been drawn on two consecutive
+/// frames, so content that changes every frame does not pay for an extra
+/// copy.
+///
+/// The shadow meshes generated for blurred paths, such as the ones drawShadow
+/// emits for elevated cards, are also kept while they are drawn. These are
+/// generated in the local coordinates of the path and are held on the CPU
+/// since uploading them each frame is cheap compared to generating them.
+///
+/// The device buffers of the retained geometry are bounded by a byte budget.
+/// Retaining geometry that would exceed the budget first releases the least
+/// recently used retained geometry, which falls back to being tessellated
+/// every frame until it has again been drawn on two consecutive frames.
+class RetainedGeometryCache {
+ public:
+  /// @brief The inputs a drawAtlas call generates its vertices from.
+  ///
+  /// Atlas entries are found by the identity of the arrays, which are
+  /// usually stored in a retained display list, and are only reused after
+  /// checking that the contents of the arrays did not change.
+  struct AtlasKey {
+    const RSTransform* xform = nullptr;
+    const Rect* tex = nullptr;
+    /// The per sprite colors, if any, as raw bytes.
+    const void* colors = nullptr;
+    size_t colors_length = 0u;
+    size_t count = 0u;
+    ISize texture_size;
+    /// Whether the vertices include the per sprite colors for blending.
+    bool blend = false;
+  };
+
+  /// Paths which tessellate into fewer points than this are cheaper to
+  /// re-tessellate than to track.
+  static constexpr size_t kMinRetainedPointCount = 64u;
+
+  /// The default budget for the device buffers of retained geometry.
+  static constexpr size_t kDefaultMaxBytes = 32u * 1024u * 1024u;
+
+  explicit RetainedGeometryCache(size_t max_bytes = kDefaultMaxBytes)
+      : max_bytes_(max_bytes) {}
+
+  ~RetainedGeometryCache() = default;
+
+  /// @brief Mark all retained geometry as unused this frame.
+  void MarkFrameStart();
+
+  /// @brief Remove all retained geometry that was not referenced at least
+  ///        once.
+  void MarkFrameEnd();
+
+  /// @brief Remove all retained geometry, for example because the device is
+  ///        low on memory or over the global GPU resource budget.
+  void Clear();
+
+  /// @brief The size of the device buffers of all retained geometry.
+  size_t GetRetainedBytes() const { return retained_bytes_; }
+
+  /// @brief Lookup the retained vertices for |path| tessellated at the given
+  ///        scale, or std::nullopt if they have not been retained yet.
+  std::optional<VertexBuffer> Lookup(const flutter::DlPath& path,
+                                     Scalar scale);
+
+  /// @brief Offer freshly tessellated vertices for |path| at |scale|.
+  ///
+  /// The |vertex_buffer| is copied into device buffers allocated from
+  /// |allocator| if the path was also drawn on the previous frame.
+  void Offer(const flutter::DlPath& path,
+             Scalar scale,
+             const VertexBuffer& vertex_buffer,
+             size_t point_count,
+             Allocator& allocator);
+
+  /// @brief Lookup the retained stroke outline for |path| stroked with
+  ///        |stroke| at the given scale, or std::nullopt if it has not been
+  ///        retained yet.
+  std::optional<VertexBuffer> LookupStroke(const flutter::DlPath& path,
+                                           const StrokeParameters& stroke,
+                                           Scalar scale);
+
+  /// @brief Offer a freshly generated stroke outline for |path| stroked
+  ///        with |stroke| at |scale|.
+  ///
+  /// The |vertex_buffer| is copied into device buffers allocated from
+  /// |allocator| if the same stroke was also drawn on the previous frame.
+  void OfferStroke(const flutter::DlPath& path,
+                   const StrokeParameters& stroke,
+                   Scalar scale,
+                   const VertexBuffer& vertex_buffer,
+                   size_t point_count,
+                   Allocator& allocator);
+
+  /// @brief Lookup the retained vertices generated from the immutable
+  ///        |source| object, or std::nullopt if they have not been retained
+  ///        yet.
+  ///
+  /// Vertices generated with texture coordinates are keyed on the
+  /// |uv_transform| that was applied to them.
+  std::optional<VertexBuffer> LookupVertices(
+      const std::shared_ptr<const void>& source,
+      std::optional<Matrix> uv_transform);
+
+  /// @brief Offer freshly generated vertices for the immutable |source|
+  ///        object.
+  ///
+  /// The entry is released at the end of the first frame after |source|
+  /// is destroyed.
+  void OfferVertices(const std::shared_ptr<const void>& source,
+                     std::optional<Matrix> uv_transform,
+                     const VertexBuffer& vertex_buffer,
+                     size_t point_count,
+                     Allocator& allocator);
+
+  /// @brief Lookup the retained vertices for the drawAtlas inputs described
+  ///        by |key|, or std::nullopt if they have not been retained yet or
+  ///        the inputs changed since.
+  std::optional<VertexBuffer> LookupAtlas(const AtlasKey& key);
+
+  /// @brief Offer freshly generated vertices for the drawAtlas inputs
+  ///        described by |key|.
+  void OfferAtlas(const AtlasKey& key,
+                  const VertexBuffer& vertex_buffer,
+                  Allocator& allocator);
+
+  /// @brief Lookup the shadow mesh for |path| with the device space
+  ///        |occluder_height| under |transform|, or nullptr if it has not
+  ///        been generated yet.
+  ///
+  /// Meshes are reused across transforms that only differ in translation.
+  /// The mesh is snapped to a device sub-pixel grid while it is generated,
+  /// so a reused mesh can be off by a fraction of that grid, which is not
+  /// visible under the blur.
+  std::shared_ptr<ShadowVertices> LookupShadow(const flutter::DlPath& path,
+                                               Scalar occluder_height,
+                                               const Matrix& transform);
+
+  /// @brief Offer a freshly generated shadow mesh for |path| with the device
+  ///        space |occluder_height| under |transform|.
+  void OfferShadow(const flutter::DlPath& path,
+                   Scalar occluder_height,
+                   const Matrix& transform,
+                   std::shared_ptr<ShadowVertices> vertices);
+
+  // Visible for testing.
+  size_t GetCacheSizeForTesting() const {
+    return entries_.size() + stroke_entries_.size() +
+           vertices_entries_.size() + atlas_entries_.size() +
+           shadow_entries_.size();
+  }
+
+  // Visible for testing.
+  size_t GetRetainedCountForTesting() const;
+
+ private:
+  struct Key {
+    flutter::DlPath path;
+    Scalar scale;
+
+    struct Hash {
+      std::size_t operator()(const Key& key) const {
+        const Rect bounds = key.path.GetBounds();
+        return fml::HashCombine(bounds.GetLeft(), bounds.GetTop(),
+                                bounds.GetRight(), bounds.GetBottom(),
+                                key.path.GetFillType(), key.scale);
+      }
+    };
+
+    struct Equal {
+      bool operator()(const Key& lhs, const Key& rhs) const {
+        return lhs.scale == rhs.scale && lhs.path == rhs.path;
+      }
+    };
+  };
+
+  struct Data {
+    std::optional<VertexBuffer> vertex_buffer;
+    // The size of the device buffers of |vertex_buffer|.
+    size_t byte_size = 0u;
+    // The value of |use_count_| when this entry was last drawn.
+    uint64_t last_used = 0u;
+    bool used_this_frame = true;
+    // Whether this entry survived the end of the previous frame.
+    bool seen_last_frame = false;
+  };
+
+  struct StrokeKey {
+    flutter::DlPath path;
+    StrokeParameters stroke;
+    Scalar scale;
+
+    struct Hash {
+      std::size_t operator()(const StrokeKey& key) const {
+        const Rect bounds = key.path.GetBounds();
+        return fml::HashCombine(bounds.GetLeft(), bounds.GetTop(),
+                                bounds.GetRight(), bounds.GetBottom(),
+                                key.stroke.width, key.stroke.cap,
+                                key.stroke.join, key.stroke.miter_limit,
+                                key.scale);
+      }
+    };
+
+    struct Equal {
+      bool operator()(const StrokeKey& lhs, const StrokeKey& rhs) const {
+        return lhs.scale == rhs.scale && lhs.stroke == rhs.stroke &&
+               lhs.path == rhs.path;
+      }
+    };
+  };
+
+  struct VerticesKey {
+    const void* source;
+    std::optional<Matrix> uv_transform;
+
+    struct Hash {
+      std::size_t operator()(const VerticesKey& key) const {
+        return fml::HashCombine(key.source, key.uv_transform.has_value());
+      }
+    };
+
+    struct Equal {
+      bool operator()(const VerticesKey& lhs, const VerticesKey& rhs) const {
+        return lhs.source == rhs.source && lhs.uv_transform == rhs.uv_transform;
+      }
+    };
+  };
+
+  struct VerticesData : Data {
+    // Detects a new source object allocated at the address of a destroyed
+    // one.
+    std::weak_ptr<const void> source;
+  };
+
+  struct AtlasKeyHash {
+    std::size_t operator()(const AtlasKey& key) const {
+      return fml::HashCombine(static_cast<const void*>(key.xform), key.count,
+                              key.texture_size.width, key.texture_size.height,
+                              key.blend);
+    }
+  };
+
+  struct AtlasKeyEqual {
+    bool operator()(const AtlasKey& lhs, const AtlasKey& rhs) const {
+      return lhs.xform == rhs.xform && lhs.tex == rhs.tex &&
+             lhs.colors == rhs.colors &&
+             lhs.colors_length == rhs.colors_length &&
+             lhs.count == rhs.count && lhs.texture_size == rhs.texture_size &&
+             lhs.blend == rhs.blend;
+    }
+  };
+
+  struct AtlasData : Data {
+    // A copy of the inputs the retained vertices were generated from.
+    std::vector<uint8_t> contents;
+  };
+
+  struct ShadowKey {
+    flutter::DlPath path;
+    Scalar occluder_height;
+    // The transform the mesh is generated under, without its translation.
+    Matrix basis;
+
+    struct Hash {
+      std::size_t operator()(const ShadowKey& key) const {
+        const Rect bounds = key.path.GetBounds();
+        return fml::HashCombine(bounds.GetLeft(), bounds.GetTop(),
+                                bounds.GetRight(), bounds.GetBottom(),
+                                key.occluder_height, key.basis.m[0],
+                                key.basis.m[1], key.basis.m[4],
+                                key.basis.m[5]);
+      }
+    };
+
+    struct Equal {
+      bool operator()(const ShadowKey& lhs, const ShadowKey& rhs) const {
+        return lhs.occluder_height == rhs.occluder_height &&
+               lhs.basis == rhs.basis && lhs.path == rhs.path;
+      }
+    };
+  };
+
+  struct ShadowData {
+    std::shared_ptr<ShadowVertices> vertices;
+    bool used_this_frame = true;
+  };
+
+  // Retains a copy of |vertex_buffer| in |data| if the entry was also used
+  // on the previous frame and fits in the budget, returning whether it did.
+  bool MaybeRetain(Data& data,
+                   bool inserted,
+                   const VertexBuffer& vertex_buffer,
+                   Allocator& allocator);
+
+  // Marks |data| as drawn this frame.
+  void MarkUsed(Data& data);
+
+  // Releases the least recently used retained geometry, other than |keep|,
+  // until |byte_size| more bytes fit in the budget. Returns whether they do.
+  bool EvictToFit(size_t byte_size, const Data* keep);
+
+  // Releases the device buffers retained by |data|.
+  void Release(Data& data);
+
+  size_t max_bytes_;
+  size_t retained_bytes_ = 0u;
+  uint64_t use_count_ = 0u;
+
+  absl::flat_hash_map<Key, Data, Key::Hash, Key::Equal> entries_;
+  absl::flat_hash_map<StrokeKey, Data, StrokeKey::Hash, StrokeKey::Equal>
+      stroke_entries_;
+  absl::flat_hash_map<VerticesKey,
+                      VerticesData,
+                      VerticesKey::Hash,
+                      VerticesKey::Equal>
+      vertices_entries_;
+  absl::flat_hash_map<AtlasKey, AtlasData, AtlasKeyHash, AtlasKeyEqual>
+      atlas_entries_;
+  absl::flat_hash_map<ShadowKey, ShadowData, ShadowKey::Hash, ShadowKey::Equal>
+      shadow_entries_;
+
+  RetainedGeometryCache(const RetainedGeometryCache&) = delete;
+
+  RetainedGeometryCache& operator=(const RetainedGeometryCache&) = delete;
+};
+
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_ENTITY_GEOMETRY_RETAINED_GEOMETRY_CACHE_H_
@@ -0,0 +1,292 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <vector>
+
+#include "flutter/display_list/geometry/dl_path_builder.h"
+#include "flutter/testing/testing.h"
+#include "gtest/gtest.h"
+#include "impeller/core/device_buffer.h"
+#include "impeller/entity/entity_playground.h"
+#include "impeller/entity/geometry/retained_geometry_cache.h"
+#include "impeller/entity/geometry/shadow_path_geometry.h"
+#include "impeller/playground/playground_test.h"
+
+namespace impeller {
+namespace testing {
+
+using RetainedGeometryCacheTest = EntityPlayground;
+INSTANTIATE_PLAYGROUND_SUITE(RetainedGeometryCacheTest);
+
+namespace {
+VertexBuffer MakeVertexBuffer(Allocator& allocator, size_t point_count) {
+  std::vector<Point> points(point_count, Point(1, 2));
+  std::vector<uint16_t> indices(point_count, 0);
+  std::shared_ptr<DeviceBuffer> point_buffer = allocator.CreateBufferWithCopy(
+      reinterpret_cast<const uint8_t*>(points.data()),
+      points.size() * sizeof(Point));
+  std::shared_ptr<DeviceBuffer> index_buffer = allocator.CreateBufferWithCopy(
+      reinterpret_cast<const uint8_t*>(indices.data()),
+      indices.size() * sizeof(uint16_t));
+  return VertexBuffer{
+      .vertex_buffer = DeviceBuffer::AsBufferView(std::move(point_buffer)),
+      .index_buffer = DeviceBuffer::AsBufferView(std::move(index_buffer)),
+      .vertex_count = point_count,
+      .index_type = IndexType::k16bit,
+  };
+}
+}  // namespace
+
+TEST_P(RetainedGeometryCacheTest, RetainsPathsDrawnOnConsecutiveFrames) {
+  Allocator& allocator = *GetContext()->GetResourceAllocator();
+  RetainedGeometryCache cache;
+  flutter::DlPath path =
+      flutter::DlPath::MakeCircle(flutter::DlPoint(50, 50), 40);
+  VertexBuffer vertices = MakeVertexBuffer(
+      allocator, RetainedGeometryCache::kMinRetainedPointCount);
+
+  // First frame: the path becomes a candidate but is not retained.
+  cache.MarkFrameStart();
+  EXPECT_FALSE(cache.Lookup(path, 1.0f).has_value());
+  cache.Offer(path, 1.0f, vertices,
+              RetainedGeometryCache::kMinRetainedPointCount, allocator);
+  cache.MarkFrameEnd();
+  EXPECT_EQ(cache.GetCacheSizeForTesting(), 1u);
+  EXPECT_EQ(cache.GetRetainedCountForTesting(), 0u);
+
+  // Second frame: the path is drawn again and is retained.
+  cache.MarkFrameStart();
+  EXPECT_FALSE(cache.Lookup(path, 1.0f).has_value());
+  cache.Offer(path, 1.0f, vertices,
+              RetainedGeometryCache::kMinRetainedPointCount, allocator);
+  cache.MarkFrameEnd();
+  EXPECT_EQ(cache.GetRetainedCountForTesting(), 1u);
+
+  // Third frame: an equal path hits the cache, a different scale misses.
+  cache.MarkFrameStart();
+  flutter::DlPath same_path =
+      flutter::DlPath::MakeCircle(flutter::DlPoint(50, 50), 40);
+  std::optional<VertexBuffer> retained = cache.Lookup(same_path, 1.0f);
+  ASSERT_TRUE(retained.has_value());
+  EXPECT_EQ(retained->vertex_count, vertices.vertex_count);
+  EXPECT_NE(retained->vertex_buffer.GetBuffer(),
+            vertices.vertex_buffer.GetBuffer());
+  EXPECT_FALSE(cache.Lookup(path, 2.0f).has_value());
+  cache.MarkFrameEnd();
+
+  // Fourth frame: the path is not drawn and is evicted.
+  cache.MarkFrameStart();
+  cache.MarkFrameEnd();
+  EXPECT_EQ(cache.GetCacheSizeForTesting(), 0u);
+}
+
+TEST_P(RetainedGeometryCacheTest, IgnoresSimplePaths) {
+  Allocator& allocator = *GetContext()->GetResourceAllocator();
+  RetainedGeometryCache cache;
+  flutter::DlPath path =
+      flutter::DlPath::MakeRect(flutter::DlRect::MakeLTRB(0, 0, 10, 10));
+  VertexBuffer vertices = MakeVertexBuffer(allocator, 4);
+
+  for (int i = 0; i < 3; i++) {
+    cache.MarkFrameStart();
+    EXPECT_FALSE(cache.Lookup(path, 1.0f).has_value());
+    cache.Offer(path, 1.0f, vertices, 4, allocator);
+    cache.MarkFrameEnd();
+  }
+  EXPECT_EQ(cache.GetCacheSizeForTesting(), 0u);
+}
+
+TEST_P(RetainedGeometryCacheTest, RetainsStrokesWithMatchingParameters) {
+  Allocator& allocator = *GetContext()->GetResourceAllocator();
+  RetainedGeometryCache cache;
+  flutter::DlPath path =
+      flutter::DlPath::MakeCircle(flutter::DlPoint(50, 50), 40);
+  StrokeParameters stroke{.width = 4.0f, .join = Join::kRound};
+  VertexBuffer vertices = MakeVertexBuffer(
+      allocator, RetainedGeometryCache::kMinRetainedPointCount);
+
+  for (int i = 0; i < 2; i++) {
+    cache.MarkFrameStart();
+    EXPECT_FALSE(cache.LookupStroke(path, stroke, 1.0f).has_value());
+    cache.OfferStroke(path, stroke, 1.0f, vertices,
+                      RetainedGeometryCache::kMinRetainedPointCount,
+                      allocator);
+    cache.MarkFrameEnd();
+  }
+  EXPECT_EQ(cache.GetRetainedCountForTesting(), 1u);
+
+  cache.MarkFrameStart();
+  std::optional<VertexBuffer> retained = cache.LookupStroke(path, stroke, 1.0f);
+  ASSERT_TRUE(retained.has_value());
+  EXPECT_EQ(retained->vertex_count, vertices.vertex_count);
+  // Fills of the same path and strokes with other parameters miss.
+  EXPECT_FALSE(cache.Lookup(path, 1.0f).has_value());
+  StrokeParameters wider = stroke;
+  wider.width = 5.0f;
+  EXPECT_FALSE(cache.LookupStroke(path, wider, 1.0f).has_value());
+  StrokeParameters mitered = stroke;
+  mitered.join = Join::kMiter;
+  EXPECT_FALSE(cache.LookupStroke(path, mitered, 1.0f).has_value());
+  EXPECT_FALSE(cache.LookupStroke(path, stroke, 2.0f).has_value());
+  cache.MarkFrameEnd();
+
+  // The stroke is not drawn and is evicted.
+  cache.MarkFrameStart();
+  cache.MarkFrameEnd();
+  EXPECT_EQ(cache.GetCacheSizeForTesting(), 0u);
+}
+
+TEST_P(RetainedGeometryCacheTest, RetainsVerticesUntilSourceIsDestroyed) {
+  Allocator& allocator = *GetContext()->GetResourceAllocator();
+  RetainedGeometryCache cache;
+  auto source = std::make_shared<const std::vector<Point>>(100);
+  VertexBuffer vertices = MakeVertexBuffer(allocator, 100u);
+  Matrix uv_transform = Matrix::MakeScale({0.5, 0.5, 1});
+
+  for (int i = 0; i < 2; i++) {
+    cache.MarkFrameStart();
+    EXPECT_FALSE(cache.LookupVertices(source, std::nullopt).has_value());
+    cache.OfferVertices(source, std::nullopt, vertices, 100u, allocator);
+    cache.MarkFrameEnd();
+  }
+  EXPECT_EQ(cache.GetRetainedCountForTesting(), 1u);
+
+  // Vertices with texture coordinates are keyed on their uv transform.
+  cache.MarkFrameStart();
+  EXPECT_TRUE(cache.LookupVertices(source, std::nullopt).has_value());
+  EXPECT_FALSE(cache.LookupVertices(source, uv_transform).has_value());
+  cache.MarkFrameEnd();
+
+  // Destroying the source releases its vertices at the end of the frame
+  // even though they were drawn.
+  cache.MarkFrameStart();
+  EXPECT_TRUE(cache.LookupVertices(source, std::nullopt).has_value());
+  source.reset();
+  cache.MarkFrameEnd();
+  EXPECT_EQ(cache.GetCacheSizeForTesting(), 0u);
+}
+
+TEST_P(RetainedGeometryCacheTest, RetainsAtlasVerticesWhileInputsAreUnchanged) {
+  Allocator& allocator = *GetContext()->GetResourceAllocator();
+  RetainedGeometryCache cache;
+  std::vector<RSTransform> xforms(20,
+                                  RSTransform::Make({10, 10}, 1, Radians(0)));
+  std::vector<Rect> tex(20, Rect::MakeXYWH(0, 0, 16, 16));
+  VertexBuffer vertices = MakeVertexBuffer(allocator, 120u);
+  RetainedGeometryCache::AtlasKey key{
+      .xform = xforms.data(),
+      .tex = tex.data(),
+      .count = xforms.size(),
+      .texture_size = ISize(64, 64),
+  };
+
+  for (int i = 0; i < 2; i++) {
+    cache.MarkFrameStart();
+    EXPECT_FALSE(cache.LookupAtlas(key).has_value());
+    cache.OfferAtlas(key, vertices, allocator);
+    cache.MarkFrameEnd();
+  }
+  EXPECT_EQ(cache.GetRetainedCountForTesting(), 1u);
+
+  cache.MarkFrameStart();
+  EXPECT_TRUE(cache.LookupAtlas(key).has_value());
+  RetainedGeometryCache::AtlasKey blend_key = key;
+  blend_key.blend = true;
+  EXPECT_FALSE(cache.LookupAtlas(blend_key).has_value());
+  cache.MarkFrameEnd();
+
+  // Rewriting the inputs in place invalidates the retained vertices.
+  xforms[3] = RSTransform::Make({20, 10}, 1, Radians(0));
+  cache.MarkFrameStart();
+  EXPECT_FALSE(cache.LookupAtlas(key).has_value());
+  cache.OfferAtlas(key, vertices, allocator);
+  cache.MarkFrameEnd();
+  EXPECT_EQ(cache.GetRetainedCountForTesting(), 0u);
+}
+
+TEST_P(RetainedGeometryCacheTest, EvictsLeastRecentlyUsedGeometryOverBudget) {
+  Allocator& allocator = *GetContext()->GetResourceAllocator();
+  VertexBuffer vertices = MakeVertexBuffer(allocator, 100u);
+  const size_t byte_size = vertices.vertex_buffer.GetRange().length +
+                           vertices.index_buffer.GetRange().length;
+  // Only fits one of the paths.
+  RetainedGeometryCache cache(byte_size * 3 / 2);
+  flutter::DlPath path_a =
+      flutter::DlPath::MakeCircle(flutter::DlPoint(50, 50), 40);
+  flutter::DlPath path_b =
+      flutter::DlPath::MakeCircle(flutter::DlPoint(150, 50), 40);
+
+  for (int i = 0; i < 2; i++) {
+    cache.MarkFrameStart();
+    cache.Offer(path_a, 1.0f, vertices, 100u, allocator);
+    cache.Offer(path_b, 1.0f, vertices, 100u, allocator);
+    cache.MarkFrameEnd();
+  }
+  // Retaining |path_b| released |path_a|, which was used before it.
+  EXPECT_EQ(cache.GetRetainedCountForTesting(), 1u);
+  EXPECT_EQ(cache.GetRetainedBytes(), byte_size);
+
+  cache.MarkFrameStart();
+  EXPECT_FALSE(cache.Lookup(path_a, 1.0f).has_value());
+  EXPECT_TRUE(cache.Lookup(path_b, 1.0f).has_value());
+  cache.MarkFrameEnd();
+
+  // Geometry that doesn't fit in the budget by itself is never retained.
+  RetainedGeometryCache small_cache(byte_size / 2);
+  for (int i = 0; i < 3; i++) {
+    small_cache.MarkFrameStart();
+    small_cache.Offer(path_a, 1.0f, vertices, 100u, allocator);
+    small_cache.MarkFrameEnd();
+  }
+  EXPECT_EQ(small_cache.GetRetainedCountForTesting(), 0u);
+  EXPECT_EQ(small_cache.GetRetainedBytes(), 0u);
+}
+
+TEST_P(RetainedGeometryCacheTest, ClearReleasesAllGeometry) {
+  Allocator& allocator = *GetContext()->GetResourceAllocator();
+  RetainedGeometryCache cache;
+  flutter::DlPath path =
+      flutter::DlPath::MakeCircle(flutter::DlPoint(50, 50), 40);
+  VertexBuffer vertices = MakeVertexBuffer(allocator, 100u);
+
+  for (int i = 0; i < 2; i++) {
+    cache.MarkFrameStart();
+    cache.Offer(path, 1.0f, vertices, 100u, allocator);
+    cache.MarkFrameEnd();
+  }
+  EXPECT_EQ(cache.GetRetainedCountForTesting(), 1u);
+  EXPECT_GT(cache.GetRetainedBytes(), 0u);
+
+  cache.Clear();
+  EXPECT_EQ(cache.GetCacheSizeForTesting(), 0u);
+  EXPECT_EQ(cache.GetRetainedBytes(), 0u);
+}
+
+TEST_P(RetainedGeometryCacheTest, ReusesShadowMeshesAcrossTranslations) {
+  RetainedGeometryCache cache;
+  flutter::DlPath path = flutter::DlPath::MakeRoundRectXY(
+      flutter::DlRect::MakeXYWH(10, 10, 100, 50), 8, 8);
+  std::shared_ptr<ShadowVertices> mesh = ShadowVertices::Make(
+      {Point(0, 0), Point(1, 0), Point(0, 1)}, {0, 1, 2}, {1, 1, 1});
+  Matrix transform = Matrix::MakeScale({2, 2, 1});
+
+  cache.MarkFrameStart();
+  EXPECT_EQ(cache.LookupShadow(path, 4.0f, transform), nullptr);
+  cache.OfferShadow(path, 4.0f, transform, mesh);
+  EXPECT_EQ(cache.LookupShadow(
+                path, 4.0f, Matrix::MakeTranslation({30, -20, 0}) * transform),
+            mesh);
+  EXPECT_EQ(cache.LookupShadow(path, 8.0f, transform), nullptr);
+  EXPECT_EQ(cache.LookupShadow(path, 4.0f, Matrix()), nullptr);
+  cache.MarkFrameEnd();
+  EXPECT_EQ(cache.GetCacheSizeForTesting(), 1u);
+
+  // A frame that doesn't draw the shadow releases it.
+  cache.MarkFrameStart();
+  cache.MarkFrameEnd();
+  EXPECT_EQ(cache.GetCacheSizeForTesting(), 0u);
+}
+
+}  // namespace testing
+}  // namespace impeller
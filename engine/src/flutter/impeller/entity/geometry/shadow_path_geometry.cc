@@ -543,9 +543,8 @@ const std::shared_ptr<ShadowVertices> PolygonInfo::CalculateConvexShadowMesh(
   ComputeMesh(pins, centroid, list, trigs, direction);
 
   Matrix inverted_matrix = matrix.Invert();
-  for (Point& vertex : vertices_) {
-    vertex = inverted_matrix * vertex;
-  }
+  inverted_matrix.TransformPoints(vertices_.data(), vertices_.data(),
+                                  vertices_.size());
   return ShadowVertices::Make(std::move(vertices_), std::move(indices_),
                               std::move(gaussians_));
 }
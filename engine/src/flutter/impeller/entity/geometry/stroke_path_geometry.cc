@@ -8,8 +8,11 @@
 #include "impeller/core/buffer_view.h"
 #include "impeller/core/formats.h"
 #include "impeller/core/host_buffer.h"
+#include "impeller/core/vertex_buffer.h"
+#include "impeller/entity/contents/content_context.h"
 #include "impeller/entity/contents/pipelines.h"
 #include "impeller/entity/geometry/geometry.h"
+#include "impeller/entity/geometry/retained_geometry_cache.h"
 #include "impeller/geometry/constants.h"
 #include "impeller/geometry/separated_vector.h"
 #include "impeller/geometry/wangs_formula.h"
@@ -757,53 +760,71 @@ GeometryResult StrokeSegmentsGeometry::GetPositionBuffer(
   auto scale = entity.GetTransform().GetMaxBasisLengthXY();
   auto& tessellator = renderer.GetTessellator();
 
+  // The outline only depends on the path, the stroke and the scale, so it
+  // can be reused when only the translation of the transform changes.
+  const flutter::DlPath* retainable_path = GetRetainablePath();
+  if (retainable_path) {
+    std::optional<VertexBuffer> retained =
+        renderer.GetRetainedGeometryCache().LookupStroke(
+            *retainable_path, adjusted_stroke, scale);
+    if (retained.has_value()) {
+      return GeometryResult{.type = PrimitiveType::kTriangleStrip,
+                            .vertex_buffer = std::move(retained.value()),
+                            .transform = entity.GetShaderTransform(pass),
+                            .mode = GeometryResult::Mode::kPreventOverdraw};
+    }
+  }
+
   PositionWriter position_writer(tessellator.GetStrokePointCache());
   StrokePathSegmentReceiver receiver(tessellator, position_writer,
                                      adjusted_stroke, scale);
   Dispatch(receiver, tessellator, scale);
 
   const auto [arena_length, oversized_length] = position_writer.GetUsedSize();
+  VertexBuffer vertex_buffer;
   if (!position_writer.HasOversizedBuffer()) {
-    BufferView buffer_view =
-        data_host_buffer.Emplace(tessellator.GetStrokePointCache().data(),
-                                 arena_length * sizeof(Point), alignof(Point));
-
-    return GeometryResult{.type = PrimitiveType::kTriangleStrip,
-                          .vertex_buffer =
-                              {
-                                  .vertex_buffer = buffer_view,
-                                  .vertex_count = arena_length,
-                                  .index_type = IndexType::kNone,
-                              },
-                          .transform = entity.GetShaderTransform(pass),
-                          .mode = GeometryResult::Mode::kPreventOverdraw};
-  }
-  const std::vector<Point>& oversized_data =
-      position_writer.GetOversizedBuffer();
-  BufferView buffer_view = data_host_buffer.Emplace(
-      /*buffer=*/nullptr,                                 //
-      (arena_length + oversized_length) * sizeof(Point),  //
-      alignof(Point)                                      //
-  );
-  memcpy(buffer_view.GetBuffer()->OnGetContents() +
-             buffer_view.GetRange().offset,         //
-         tessellator.GetStrokePointCache().data(),  //
-         arena_length * sizeof(Point)               //
-  );
-  memcpy(buffer_view.GetBuffer()->OnGetContents() +
-             buffer_view.GetRange().offset + arena_length * sizeof(Point),  //
-         oversized_data.data(),                                             //
-         oversized_data.size() * sizeof(Point)                              //
-  );
-  buffer_view.GetBuffer()->Flush(buffer_view.GetRange());
+    vertex_buffer = {
+        .vertex_buffer = data_host_buffer.Emplace(
+            tessellator.GetStrokePointCache().data(),
+            arena_length * sizeof(Point), alignof(Point)),
+        .vertex_count = arena_length,
+        .index_type = IndexType::kNone,
+    };
+  } else {
+    const std::vector<Point>& oversized_data =
+        position_writer.GetOversizedBuffer();
+    BufferView buffer_view = data_host_buffer.Emplace(
+        /*buffer=*/nullptr,                                 //
+        (arena_length + oversized_length) * sizeof(Point),  //
+        alignof(Point)                                      //
+    );
+    memcpy(buffer_view.GetBuffer()->OnGetContents() +
+               buffer_view.GetRange().offset,         //
+           tessellator.GetStrokePointCache().data(),  //
+           arena_length * sizeof(Point)               //
+    );
+    memcpy(buffer_view.GetBuffer()->OnGetContents() +
+               buffer_view.GetRange().offset + arena_length * sizeof(Point),  //
+           oversized_data.data(),                                             //
+           oversized_data.size() * sizeof(Point)                              //
+    );
+    buffer_view.GetBuffer()->Flush(buffer_view.GetRange());
+    vertex_buffer = {
+        .vertex_buffer = buffer_view,
+        .vertex_count = arena_length + oversized_length,
+        .index_type = IndexType::kNone,
+    };
+  }
+
+  if (retainable_path) {
+    renderer.GetRetainedGeometryCache().OfferStroke(
+        *retainable_path, adjusted_stroke, scale, vertex_buffer,
+        vertex_buffer.vertex_count,
+        *renderer.GetContext()->GetResourceAllocator());
+  }
 
   return GeometryResult{.type = PrimitiveType::kTriangleStrip,
-                        .vertex_buffer =
-                            {
-                                .vertex_buffer = buffer_view,
-                                .vertex_count = arena_length + oversized_length,
-                                .index_type = IndexType::kNone,
-                            },
+                        .vertex_buffer = std::move(vertex_buffer),
                         .transform = entity.GetShaderTransform(pass),
                         .mode = GeometryResult::Mode::kPreventOverdraw};
 }
@@ -859,6 +880,10 @@ const PathSource& StrokePathGeometry::GetSource() const {
   return path_;
 }
 
+const flutter::DlPath* StrokePathGeometry::GetRetainablePath() const {
+  return &path_;
+}
+
 ArcStrokeGeometry::ArcStrokeGeometry(const Arc& arc,
                                      const StrokeParameters& parameters)
     : StrokeSegmentsGeometry(parameters), arc_(arc) {}
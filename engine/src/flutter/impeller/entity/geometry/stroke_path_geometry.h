@@ -55,6 +55,10 @@ class StrokeSegmentsGeometry : public Geometry {
                         Tessellator& tessellator,
                         Scalar scale) const = 0;
 
+  /// The DlPath providing the segments, if any, whose stroked outline may be
+  /// retained across frames in the |RetainedGeometryCache|.
+  virtual const flutter::DlPath* GetRetainablePath() const { return nullptr; }
+
   /// Provide the stroke-padded bounds for the provided bounds of the
   /// segments themselves.
   std::optional<Rect> GetStrokeCoverage(const Matrix& transform,
@@ -121,6 +125,9 @@ class StrokePathGeometry final : public StrokePathSourceGeometry {
   // |StrokePathSourceGeometry|
   const PathSource& GetSource() const override;
 
+  // |StrokeSegmentsGeometry|
+  const flutter::DlPath* GetRetainablePath() const override;
+
  private:
   const flutter::DlPath path_;
 };
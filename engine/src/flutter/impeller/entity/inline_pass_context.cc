@@ -107,11 +107,16 @@ const std::shared_ptr<RenderPass>& InlinePassContext::GetRenderPass() {
   ColorAttachment color0 = pass_target_.GetRenderTarget().GetColorAttachment(0);
   bool is_msaa = color0.resolve_texture != nullptr;
 
-  if (pass_count_ > 0) {
+  if (next_pass_overwrites_color_ && is_msaa) {
+    // The MSAA attachment is never stored, so there is nothing to load, and
+    // the caller is about to overwrite every pixel.
+    color0.load_action = LoadAction::kDontCare;
+  } else if (pass_count_ > 0) {
     color0.load_action = is_msaa ? LoadAction::kClear : LoadAction::kLoad;
   } else {
     color0.load_action = LoadAction::kClear;
   }
+  next_pass_overwrites_color_ = false;
 
   color0.store_action =
       is_msaa ? StoreAction::kMultisampleResolve : StoreAction::kStore;
@@ -151,6 +156,10 @@ const std::shared_ptr<RenderPass>& InlinePassContext::GetRenderPass() {
   return pass_;
 }
 
+void InlinePassContext::MarkNextPassOverwritesColor() {
+  next_pass_overwrites_color_ = true;
+}
+
 uint32_t InlinePassContext::GetPassCount() const {
   return pass_count_;
 }
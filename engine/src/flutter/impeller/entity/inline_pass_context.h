@@ -35,12 +35,22 @@ class InlinePassContext {
 
   const std::shared_ptr<RenderPass>& GetRenderPass();
 
+  /// @brief  Indicate that the next render pass created by |GetRenderPass|
+  ///         will overwrite every pixel of the color attachment before
+  ///         anything reads from it.
+  ///
+  ///         When the target is multisampled, the MSAA attachment is then
+  ///         neither loaded nor cleared, which saves a full attachment
+  ///         clear on tiled GPUs.
+  void MarkNextPassOverwritesColor();
+
  private:
   const ContentContext& renderer_;
   EntityPassTarget& pass_target_;
   std::shared_ptr<CommandBuffer> command_buffer_;
   std::shared_ptr<RenderPass> pass_;
   uint32_t pass_count_ = 0;
+  bool next_pass_overwrites_color_ = false;
 
   InlinePassContext(const InlinePassContext&) = delete;
 
@@ -3,15 +3,50 @@
 // found in the LICENSE file.
 
 #include "impeller/entity/render_target_cache.h"
+
+#include <algorithm>
+
 #include "impeller/core/formats.h"
 #include "impeller/renderer/render_target.h"
 
 namespace impeller {
 
+namespace {
+/// The size of the textures of |render_target|, not counting
+/// |shared_texture|, which is accounted for by the target it was shared from.
+size_t GetRenderTargetByteSize(const RenderTarget& render_target,
+                               const Texture* shared_texture = nullptr) {
+  std::vector<const Texture*> counted = {shared_texture};
+  size_t byte_size = 0u;
+  auto count_texture = [&](const std::shared_ptr<Texture>& texture) {
+    if (!texture ||
+        std::find(counted.begin(), counted.end(), texture.get()) !=
+            counted.end()) {
+      return;
+    }
+    counted.push_back(texture.get());
+    const TextureDescriptor& desc = texture->GetTextureDescriptor();
+    if (desc.storage_mode == StorageMode::kDeviceTransient) {
+      return;
+    }
+    byte_size += desc.GetByteSizeOfAllMipLevels() *
+                 static_cast<size_t>(desc.sample_count);
+  };
+  render_target.IterateAllAttachments([&](const Attachment& attachment) {
+    count_texture(attachment.texture);
+    count_texture(attachment.resolve_texture);
+    return true;
+  });
+  return byte_size;
+}
+}  // namespace
+
 RenderTargetCache::RenderTargetCache(std::shared_ptr<Allocator> allocator,
-                                     uint32_t keep_alive_frame_count)
+                                     uint32_t keep_alive_frame_count,
+                                     size_t max_cached_bytes)
     : RenderTargetAllocator(std::move(allocator)),
-      keep_alive_frame_count_(keep_alive_frame_count) {}
+      keep_alive_frame_count_(keep_alive_frame_count),
+      max_cached_bytes_(max_cached_bytes) {}
 
 void RenderTargetCache::Start() {
   cache_disabled_count_ = 0;
@@ -23,18 +58,70 @@ void RenderTargetCache::Start() {
 void RenderTargetCache::End() {
   cache_disabled_count_ = 0;
   std::vector<RenderTargetData> retain;
+  size_t unused_bytes = 0u;
 
   for (RenderTargetData& td : render_target_data_) {
     if (td.used_this_frame) {
       retain.push_back(td);
     } else if (td.keep_alive_frame_count > 0) {
       td.keep_alive_frame_count--;
+      unused_bytes += td.byte_size;
       retain.push_back(td);
     }
   }
+
+  if (unused_bytes > max_cached_bytes_) {
+    // Release the unused textures that are closest to expiring first.
+    std::stable_sort(retain.begin(), retain.end(),
+                     [](const RenderTargetData& a, const RenderTargetData& b) {
+                       if (a.used_this_frame != b.used_this_frame) {
+                         return a.used_this_frame;
+                       }
+                       return a.keep_alive_frame_count >
+                              b.keep_alive_frame_count;
+                     });
+    while (unused_bytes > max_cached_bytes_ &&
+           !retain.back().used_this_frame) {
+      unused_bytes -= retain.back().byte_size;
+      retain.pop_back();
+    }
+  }
   render_target_data_.swap(retain);
 }
 
+std::shared_ptr<Texture> RenderTargetCache::FindShareableDepthStencil(
+    const RenderTargetConfig& config,
+    const std::optional<RenderTarget::AttachmentConfig>&
+        stencil_attachment_config) const {
+  // Contents of the attachment must not be expected to outlive the pass.
+  if (!stencil_attachment_config.has_value() ||
+      stencil_attachment_config->load_action == LoadAction::kLoad ||
+      stencil_attachment_config->store_action != StoreAction::kDontCare) {
+    return nullptr;
+  }
+  for (const RenderTargetData& td : render_target_data_) {
+    if (td.config.size != config.size ||
+        td.config.has_msaa != config.has_msaa ||
+        !td.config.has_depth_stencil) {
+      continue;
+    }
+    std::optional<DepthAttachment> depth =
+        td.render_target.GetDepthAttachment();
+    if (depth.has_value() && depth->texture) {
+      return depth->texture;
+    }
+  }
+  return nullptr;
+}
+
+void RenderTargetCache::Trim() {
+  render_target_data_.erase(
+      std::remove_if(
+          render_target_data_.begin(), render_target_data_.end(),
+          [](const RenderTargetData& td) { return !td.used_this_frame; }),
+      render_target_data_.end());
+}
+
 void RenderTargetCache::DisableCache() {
   cache_disabled_count_++;
 }
@@ -92,9 +179,14 @@ RenderTarget RenderTargetCache::CreateOffscreen(
       }
     }
   }
+  std::shared_ptr<Texture> shared_depth_stencil =
+      CacheEnabled()
+          ? FindShareableDepthStencil(config, stencil_attachment_config)
+          : nullptr;
   RenderTarget created_target = RenderTargetAllocator::CreateOffscreen(
       context, size, mip_count, label, color_attachment_config,
-      stencil_attachment_config, nullptr, nullptr, target_pixel_format);
+      stencil_attachment_config, nullptr, shared_depth_stencil,
+      target_pixel_format);
   if (!created_target.IsValid()) {
     return created_target;
   }
@@ -103,7 +195,9 @@ RenderTarget RenderTargetCache::CreateOffscreen(
         .used_this_frame = true,                            //
         .keep_alive_frame_count = keep_alive_frame_count_,  //
         .config = config,                                   //
-        .render_target = created_target                     //
+        .render_target = created_target,                    //
+        .byte_size = GetRenderTargetByteSize(created_target,
+                                             shared_depth_stencil.get())  //
     });
   }
   return created_target;
@@ -151,9 +245,13 @@ RenderTarget RenderTargetCache::CreateOffscreenMSAA(
       }
     }
   }
+  std::shared_ptr<Texture> shared_depth_stencil =
+      CacheEnabled()
+          ? FindShareableDepthStencil(config, stencil_attachment_config)
+          : nullptr;
   RenderTarget created_target = RenderTargetAllocator::CreateOffscreenMSAA(
       context, size, mip_count, label, color_attachment_config,
-      stencil_attachment_config, nullptr, nullptr, nullptr,
+      stencil_attachment_config, nullptr, nullptr, shared_depth_stencil,
       target_pixel_format);
   if (!created_target.IsValid()) {
     return created_target;
@@ -163,7 +261,9 @@ RenderTarget RenderTargetCache::CreateOffscreenMSAA(
         .used_this_frame = true,                            //
         .keep_alive_frame_count = keep_alive_frame_count_,  //
         .config = config,                                   //
-        .render_target = created_target                     //
+        .render_target = created_target,                    //
+        .byte_size = GetRenderTargetByteSize(created_target,
+                                             shared_depth_stencil.get())  //
     });
   }
   return created_target;
@@ -173,4 +273,16 @@ size_t RenderTargetCache::CachedTextureCount() const {
   return render_target_data_.size();
 }
 
+size_t RenderTargetCache::CachedTextureBytes() const {
+  size_t byte_size = 0u;
+  for (const RenderTargetData& td : render_target_data_) {
+    byte_size += td.byte_size;
+  }
+  return byte_size;
+}
+
+size_t RenderTargetCache::GetCachedBytes() const {
+  return CachedTextureBytes();
+}
+
 }  // namespace impeller
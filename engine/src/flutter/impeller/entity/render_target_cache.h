@@ -14,11 +14,23 @@ namespace impeller {
 /// @brief An implementation of the [RenderTargetAllocator] that caches all
 ///        allocated texture data for one frame.
 ///
-///        Any textures unused after a frame are immediately discarded.
+///        Textures unused after a frame are kept alive for
+///        `keep_alive_frame_count` frames, as long as the unused textures do
+///        not exceed `max_cached_bytes`.
+///
+///        Depth/stencil attachments that are cleared on load and discarded on
+///        store only live for the duration of a single render pass. Targets
+///        of the same size and sample count share one such attachment instead
+///        of each allocating their own.
 class RenderTargetCache : public RenderTargetAllocator {
  public:
+  /// The default budget for cached textures that were not used in the last
+  /// frame.
+  static constexpr size_t kDefaultMaxCachedBytes = 128u * 1024u * 1024u;
+
   explicit RenderTargetCache(std::shared_ptr<Allocator> allocator,
-                             uint32_t keep_alive_frame_count = 4);
+                             uint32_t keep_alive_frame_count = 4,
+                             size_t max_cached_bytes = kDefaultMaxCachedBytes);
 
   ~RenderTargetCache() = default;
 
@@ -34,6 +46,12 @@ class RenderTargetCache : public RenderTargetAllocator {
   // |RenderTargetAllocator|
   void EnableCache() override;
 
+  // |RenderTargetAllocator|
+  void Trim() override;
+
+  // |RenderTargetAllocator|
+  size_t GetCachedBytes() const override;
+
   RenderTarget CreateOffscreen(
       const Context& context,
       ISize size,
@@ -64,18 +82,33 @@ class RenderTargetCache : public RenderTargetAllocator {
   // visible for testing.
   size_t CachedTextureCount() const;
 
+  /// @brief The number of bytes of device memory held by cached textures.
+  ///
+  /// Transient attachments, which are usually never backed by memory, are
+  /// not counted.
+  size_t CachedTextureBytes() const;
+
  private:
   struct RenderTargetData {
     bool used_this_frame;
     uint32_t keep_alive_frame_count;
     RenderTargetConfig config;
     RenderTarget render_target;
+    size_t byte_size;
   };
 
   bool CacheEnabled() const;
 
+  /// Find the depth/stencil texture of a cached target that a new target with
+  /// the given configuration can share, if any.
+  std::shared_ptr<Texture> FindShareableDepthStencil(
+      const RenderTargetConfig& config,
+      const std::optional<RenderTarget::AttachmentConfig>&
+          stencil_attachment_config) const;
+
   std::vector<RenderTargetData> render_target_data_;
   uint32_t keep_alive_frame_count_;
+  size_t max_cached_bytes_;
   uint32_t cache_disabled_count_ = 0;
 
   RenderTargetCache(const RenderTargetCache&) = delete;
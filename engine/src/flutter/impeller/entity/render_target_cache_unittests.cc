@@ -163,5 +163,98 @@ TEST_P(RenderTargetCacheTest, CreateWithEmptySize) {
   }
 }
 
+TEST_P(RenderTargetCacheTest, CachedTextureBytesCountsNonTransientTextures) {
+  auto render_target_cache = RenderTargetCache(
+      GetContext()->GetResourceAllocator(), /*keep_alive_frame_count=*/0);
+
+  render_target_cache.Start();
+  RenderTarget target =
+      render_target_cache.CreateOffscreen(*GetContext(), {100, 100}, 1);
+  render_target_cache.End();
+
+  // The depth/stencil attachment is transient and isn't counted.
+  EXPECT_EQ(render_target_cache.CachedTextureBytes(),
+            target.GetRenderTargetTexture()
+                ->GetTextureDescriptor()
+                .GetByteSizeOfBaseMipLevel());
+}
+
+TEST_P(RenderTargetCacheTest, UnusedTexturesAreReleasedOverBudget) {
+  RenderTargetCache measure_cache(GetContext()->GetResourceAllocator());
+  measure_cache.Start();
+  measure_cache.CreateOffscreen(*GetContext(), {100, 100}, 1);
+  const size_t target_bytes = measure_cache.CachedTextureBytes();
+  ASSERT_GT(target_bytes, 0u);
+
+  auto render_target_cache = RenderTargetCache(
+      GetContext()->GetResourceAllocator(), /*keep_alive_frame_count=*/3,
+      /*max_cached_bytes=*/target_bytes);
+
+  render_target_cache.Start();
+  render_target_cache.CreateOffscreen(*GetContext(), {100, 100}, 1);
+  render_target_cache.CreateOffscreen(*GetContext(), {100, 100}, 1);
+  render_target_cache.End();
+  EXPECT_EQ(render_target_cache.CachedTextureCount(), 2u);
+
+  // Neither texture is used, but only one fits in the budget.
+  render_target_cache.Start();
+  render_target_cache.End();
+  EXPECT_EQ(render_target_cache.CachedTextureCount(), 1u);
+  EXPECT_EQ(render_target_cache.CachedTextureBytes(), target_bytes);
+}
+
+TEST_P(RenderTargetCacheTest, TrimReleasesTexturesUnusedLastFrame) {
+  auto render_target_cache = RenderTargetCache(
+      GetContext()->GetResourceAllocator(), /*keep_alive_frame_count=*/3);
+
+  render_target_cache.Start();
+  render_target_cache.CreateOffscreen(*GetContext(), {100, 100}, 1);
+  render_target_cache.CreateOffscreen(*GetContext(), {100, 100}, 1);
+  render_target_cache.End();
+
+  render_target_cache.Start();
+  render_target_cache.CreateOffscreen(*GetContext(), {100, 100}, 1);
+  render_target_cache.End();
+  EXPECT_EQ(render_target_cache.CachedTextureCount(), 2u);
+
+  render_target_cache.Trim();
+  EXPECT_EQ(render_target_cache.CachedTextureCount(), 1u);
+}
+
+TEST_P(RenderTargetCacheTest, TargetsOfTheSameSizeShareDepthStencil) {
+  auto render_target_cache = RenderTargetCache(
+      GetContext()->GetResourceAllocator(), /*keep_alive_frame_count=*/0);
+
+  render_target_cache.Start();
+  RenderTarget first =
+      render_target_cache.CreateOffscreen(*GetContext(), {100, 100}, 1);
+  RenderTarget second =
+      render_target_cache.CreateOffscreen(*GetContext(), {100, 100}, 1);
+  RenderTarget other_size =
+      render_target_cache.CreateOffscreen(*GetContext(), {200, 100}, 1);
+  RenderTarget loaded = render_target_cache.CreateOffscreen(
+      *GetContext(), {100, 100}, 1, "Offscreen",
+      RenderTarget::kDefaultColorAttachmentConfig,
+      RenderTarget::AttachmentConfig{
+          .storage_mode = StorageMode::kDevicePrivate,
+          .load_action = LoadAction::kLoad,
+          .store_action = StoreAction::kStore,
+      });
+  render_target_cache.End();
+
+  ASSERT_TRUE(first.GetDepthAttachment().has_value());
+  ASSERT_TRUE(second.GetDepthAttachment().has_value());
+  ASSERT_TRUE(other_size.GetDepthAttachment().has_value());
+  ASSERT_TRUE(loaded.GetDepthAttachment().has_value());
+  EXPECT_NE(first.GetRenderTargetTexture(), second.GetRenderTargetTexture());
+  EXPECT_EQ(first.GetDepthAttachment()->texture,
+            second.GetDepthAttachment()->texture);
+  EXPECT_NE(first.GetDepthAttachment()->texture,
+            other_size.GetDepthAttachment()->texture);
+  // Attachments whose contents are kept can't be shared.
+  EXPECT_NE(first.GetDepthAttachment()->texture,
+            loaded.GetDepthAttachment()->texture);
+}
+
 }  // namespace testing
 }  // namespace impeller
@@ -0,0 +1,76 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Positions and extents are in local coordinates and may be thousands of
+// units, which mediump cannot represent precisely enough for a 1px ramp.
+precision highp float;
+
+#include <impeller/color.glsl>
+#include <impeller/types.glsl>
+
+uniform FragInfo {
+  vec4 color;
+  vec2 center;
+  vec2 half_size;
+  // Corner radii in the order top-left, top-right, bottom-right, bottom-left.
+  vec4 radii_x;
+  vec4 radii_y;
+  float stroke_width;
+  float aa_pixels;
+  float stroked;
+}
+frag_info;
+
+out vec4 frag_color;
+
+in vec2 v_position;
+
+vec2 cornerRadii(vec2 offset) {
+  if (offset.y < 0.0) {
+    return offset.x < 0.0 ? vec2(frag_info.radii_x.x, frag_info.radii_y.x)
+                          : vec2(frag_info.radii_x.y, frag_info.radii_y.y);
+  }
+  return offset.x < 0.0 ? vec2(frag_info.radii_x.w, frag_info.radii_y.w)
+                        : vec2(frag_info.radii_x.z, frag_info.radii_y.z);
+}
+
+// Signed distance to the round rect, exact along the straight edges and a
+// first order approximation (f / |grad f|) along elliptical corners. Near the
+// edge, which is all the anti-aliasing ramp looks at, the two agree.
+float distanceFromRoundRect(vec2 point) {
+  vec2 offset = point - frag_info.center;
+  vec2 radii = cornerRadii(offset);
+  vec2 corner = abs(offset) - frag_info.half_size + radii;
+  if (corner.x > 0.0 && corner.y > 0.0 && radii.x > 0.0 && radii.y > 0.0) {
+    vec2 normalized = corner / radii;
+    float len = length(normalized);
+    return (len - 1.0) * len / length(normalized / radii);
+  }
+  vec2 edge = abs(offset) - frag_info.half_size;
+  return length(max(edge, 0.0)) + min(max(edge.x, edge.y), 0.0);
+}
+
+void main() {
+  float dist_filled = distanceFromRoundRect(v_position);
+  float dist_stroked = abs(dist_filled) - frag_info.stroke_width * 0.5;
+  float sdf_distance = mix(dist_filled, dist_stroked, frag_info.stroked);
+
+  float pixel_derivative_sdf = fwidth(sdf_distance);
+  float coverage = 1.0;
+
+  // Strokes thinner than the ramp would never reach full alpha, so they are
+  // drawn as a ramp-wide band whose coverage integrates to the stroke width.
+  if (frag_info.stroked > 0.0 &&
+      pixel_derivative_sdf * 2.0 >= frag_info.stroke_width) {
+    sdf_distance = abs(dist_filled) - pixel_derivative_sdf;
+    coverage = frag_info.stroke_width / max(pixel_derivative_sdf, 1e-6);
+    coverage = min(coverage, 1.0);
+  }
+
+  float fade_width = pixel_derivative_sdf * frag_info.aa_pixels;
+  float alpha = (1.0 - smoothstep(-fade_width, 0.0, sdf_distance)) * coverage;
+
+  frag_color = IPPremultiply(
+      vec4(frag_info.color.xyz, frag_info.color.w * alpha));
+}
@@ -119,6 +119,86 @@ static void BM_ShadowPathVerticesImpeller(benchmark::State& state,
   }
 }
 
+static std::vector<Point> CreateTransformPoints(size_t count) {
+  std::vector<Point> points;
+  points.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    points.emplace_back(static_cast<Scalar>(i % 97), static_cast<Scalar>(i));
+  }
+  return points;
+}
+
+static void BM_TransformPoints(benchmark::State& state, Matrix matrix) {
+  std::vector<Point> points = CreateTransformPoints(state.range(0));
+  std::vector<Point> transformed(points.size());
+  while (state.KeepRunning()) {
+    matrix.TransformPoints(transformed.data(), points.data(), points.size());
+    benchmark::DoNotOptimize(transformed.data());
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(points.size()));
+}
+
+static void BM_TransformPointsScalar(benchmark::State& state, Matrix matrix) {
+  std::vector<Point> points = CreateTransformPoints(state.range(0));
+  std::vector<Point> transformed(points.size());
+  while (state.KeepRunning()) {
+    for (size_t i = 0; i < points.size(); i++) {
+      transformed[i] = matrix * points[i];
+    }
+    benchmark::DoNotOptimize(transformed.data());
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(points.size()));
+}
+
+static void BM_TransformPointBounds(benchmark::State& state, Matrix matrix) {
+  std::vector<Point> points = CreateTransformPoints(state.range(0));
+  while (state.KeepRunning()) {
+    auto bounds =
+        Rect::MakeTransformedPointBounds(matrix, points.begin(), points.end());
+    benchmark::DoNotOptimize(bounds);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(points.size()));
+}
+
+static void BM_TransformRectBounds(benchmark::State& state, Matrix matrix) {
+  Rect rect = Rect::MakeLTRB(10, 20, 300, 400);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(rect.TransformBounds(matrix));
+  }
+}
+
+static void BM_MatrixMultiply(benchmark::State& state) {
+  Matrix a = Matrix::MakeRotationZ(Degrees(30)) *
+             Matrix::MakeTranslation({10, 20}) * Matrix::MakeScale({2, 2, 1});
+  Matrix b = Matrix::MakePerspective(Degrees(60), 1.5f, 1.0f, 100.0f);
+  while (state.KeepRunning()) {
+    a = a * b;
+    benchmark::DoNotOptimize(a);
+  }
+}
+
+#define MAKE_TRANSFORM_BENCHMARK_CAPTURE(name, matrix)                   \
+  BENCHMARK_CAPTURE(BM_TransformPoints, name, matrix)->Arg(1024);        \
+  BENCHMARK_CAPTURE(BM_TransformPointsScalar, name, matrix)->Arg(1024);  \
+  BENCHMARK_CAPTURE(BM_TransformPointBounds, name, matrix)->Arg(1024);   \
+  BENCHMARK_CAPTURE(BM_TransformRectBounds, name, matrix)
+
+MAKE_TRANSFORM_BENCHMARK_CAPTURE(scale_translate,
+                                 Matrix::MakeTranslateScale({2, 3, 1},
+                                                            {10, 20, 0}));
+MAKE_TRANSFORM_BENCHMARK_CAPTURE(affine,
+                                 Matrix::MakeRotationZ(Degrees(30)) *
+                                     Matrix::MakeTranslation({10, 20}));
+MAKE_TRANSFORM_BENCHMARK_CAPTURE(perspective,
+                                 Matrix::MakeRow(1.0, 0.0, 0.0, 0.0,  //
+                                                 0.0, 1.0, 0.0, 0.0,  //
+                                                 0.0, 0.0, 1.0, 0.0,  //
+                                                 0.001, 0.002, 0.0, 1.0));
+BENCHMARK(BM_MatrixMultiply);
+
 #define MAKE_SHADOW_BENCHMARK_CAPTURE(clockwise, shape, backend) \
   BENCHMARK_CAPTURE(BM_ShadowPathVertices##backend,              \
                     shadow_##clockwise##_##shape##_##backend,    \
@@ -620,6 +620,31 @@ struct Matrix {
     return Vector2(v.x * m[0] + v.y * m[4], v.x * m[1] + v.y * m[5]);
   }
 
+  /// @brief  Transforms |count| points from |src| into |dst| with the same
+  ///         result as applying |operator*| to each point. |src| and |dst|
+  ///         may be the same array.
+  ///
+  ///         The kind of matrix is determined once for the whole batch so
+  ///         the common non-perspective cases run as straight multiply-add
+  ///         loops without the per-point homogeneous divide.
+  constexpr void TransformPoints(Point* dst,
+                                 const Point* src,
+                                 size_t count) const {
+    if (HasPerspective2D()) {
+      for (size_t i = 0; i < count; i++) {
+        dst[i] = *this * src[i];
+      }
+      return;
+    }
+    const Scalar m0 = m[0], m1 = m[1], m4 = m[4], m5 = m[5];
+    const Scalar tx = m[12], ty = m[13];
+    for (size_t i = 0; i < count; i++) {
+      const Scalar x = src[i].x;
+      const Scalar y = src[i].y;
+      dst[i] = Point(x * m0 + y * m4 + tx, x * m1 + y * m5 + ty);
+    }
+  }
+
   constexpr Quad Transform(const Quad& quad) const {
     return {
         *this * quad[0],
@@ -322,6 +322,41 @@ TEST(MatrixTest, To3x3) {
   EXPECT_TRUE(MatrixNear(x.To3x3(), Matrix()));
 }
 
+TEST(MatrixTest, TransformPointsMatchesPointTransform) {
+  const Point points[] = {
+      Point(0, 0), Point(10, -20), Point(-3.5, 7.25), Point(1e6, 1e-6),
+  };
+  constexpr size_t kCount = sizeof(points) / sizeof(points[0]);
+  const Matrix matrices[] = {
+      Matrix(),
+      Matrix::MakeTranslation({10, 20}),
+      Matrix::MakeScale({2, -3, 1}),
+      Matrix::MakeRotationZ(Degrees(30)) * Matrix::MakeTranslation({1, 2}),
+      // clang-format off
+      Matrix::MakeRow(1.0, 0.0, 0.0, 0.0,
+                      0.0, 1.0, 0.0, 0.0,
+                      0.0, 0.0, 1.0, 0.0,
+                      0.001, 0.002, 0.0, 1.0),
+      // clang-format on
+  };
+
+  for (const Matrix& matrix : matrices) {
+    Point transformed[kCount];
+    matrix.TransformPoints(transformed, points, kCount);
+    for (size_t i = 0; i < kCount; i++) {
+      EXPECT_EQ(transformed[i], matrix * points[i]) << matrix;
+    }
+
+    // Transforming in place gives the same result.
+    Point in_place[kCount];
+    std::copy(std::begin(points), std::end(points), std::begin(in_place));
+    matrix.TransformPoints(in_place, in_place, kCount);
+    for (size_t i = 0; i < kCount; i++) {
+      EXPECT_EQ(in_place[i], transformed[i]) << matrix;
+    }
+  }
+}
+
 TEST(MatrixTest, MinMaxScales2D) {
   // The GetScales2D() method is allowed to return the scales in any
   // order so we need to take special care in verifying the return
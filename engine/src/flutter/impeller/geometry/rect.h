@@ -185,6 +185,52 @@ struct TRect {
     return TRect::MakeLTRB(left, top, right, bottom);
   }
 
+  /// @brief  Returns the bounds of the points in [first, last) after they
+  ///         are transformed by |transform|, or nullopt if there are no
+  ///         points. The transformed points are not stored.
+  template <typename PointIter>
+  constexpr static std::optional<TRect> MakeTransformedPointBounds(
+      const Matrix& transform,
+      const PointIter first,
+      const PointIter last) {
+    if (first == last) {
+      return std::nullopt;
+    }
+    if (transform.HasPerspective2D()) {
+      TPoint<Type> point = transform * *first;
+      auto left = point.x;
+      auto top = point.y;
+      auto right = point.x;
+      auto bottom = point.y;
+      for (auto it = first + 1; it < last; ++it) {
+        point = transform * *it;
+        left = std::min(left, point.x);
+        top = std::min(top, point.y);
+        right = std::max(right, point.x);
+        bottom = std::max(bottom, point.y);
+      }
+      return TRect::MakeLTRB(left, top, right, bottom);
+    }
+    const Scalar m0 = transform.m[0], m1 = transform.m[1];
+    const Scalar m4 = transform.m[4], m5 = transform.m[5];
+    const Scalar tx = transform.m[12], ty = transform.m[13];
+    Scalar left = first->x * m0 + first->y * m4 + tx;
+    Scalar top = first->x * m1 + first->y * m5 + ty;
+    Scalar right = left;
+    Scalar bottom = top;
+    for (auto it = first + 1; it < last; ++it) {
+      const Scalar x = it->x * m0 + it->y * m4 + tx;
+      const Scalar y = it->x * m1 + it->y * m5 + ty;
+      left = std::min(left, x);
+      top = std::min(top, y);
+      right = std::max(right, x);
+      bottom = std::max(bottom, y);
+    }
+    return TRect::MakeLTRB(static_cast<Type>(left), static_cast<Type>(top),
+                           static_cast<Type>(right),
+                           static_cast<Type>(bottom));
+  }
+
   [[nodiscard]] constexpr static TRect MakeMaximum() {
     return TRect::MakeLTRB(std::numeric_limits<Type>::lowest(),
                            std::numeric_limits<Type>::lowest(),
@@ -473,8 +519,9 @@ struct TRect {
     if (IsEmpty()) {
       return {};
     }
-    auto points = GetTransformedPoints(transform);
-    auto bounds = TRect::MakePointBounds(points.begin(), points.end());
+    auto points = GetPoints();
+    auto bounds = TRect::MakeTransformedPointBounds(transform, points.begin(),
+                                                    points.end());
     if (bounds.has_value()) {
       return bounds.value();
     }
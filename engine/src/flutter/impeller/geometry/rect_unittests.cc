@@ -1224,6 +1224,41 @@ TEST(RectTest, MakePointBoundsQuad) {
   }
 }
 
+TEST(RectTest, MakeTransformedPointBounds) {
+  const Point points[] = {
+      Point(10, 10),
+      Point(20, 10),
+      Point(15, 30),
+  };
+
+  EXPECT_FALSE(Rect::MakeTransformedPointBounds(Matrix(), std::begin(points),
+                                                std::begin(points))
+                   .has_value());
+
+  auto check = [&points](const Matrix& matrix) {
+    std::vector<Point> transformed;
+    for (const Point& point : points) {
+      transformed.push_back(matrix * point);
+    }
+    std::optional<Rect> expected = Rect::MakePointBounds(transformed);
+    std::optional<Rect> bounds = Rect::MakeTransformedPointBounds(
+        matrix, std::begin(points), std::end(points));
+    ASSERT_TRUE(bounds.has_value()) << matrix;
+    EXPECT_EQ(bounds.value(), expected.value()) << matrix;
+  };
+
+  check(Matrix());
+  check(Matrix::MakeTranslation({5, -5}));
+  check(Matrix::MakeScale({-2, 3, 1}));
+  check(Matrix::MakeRotationZ(Degrees(45)));
+  // clang-format off
+  check(Matrix::MakeRow(1.0, 0.0, 0.0, 0.0,
+                        0.0, 1.0, 0.0, 0.0,
+                        0.0, 0.0, 1.0, 0.0,
+                        0.01, 0.0, 0.0, 1.0));
+  // clang-format on
+}
+
 TEST(RectTest, IsSquare) {
   EXPECT_TRUE(Rect::MakeXYWH(10, 30, 20, 20).IsSquare());
   EXPECT_FALSE(Rect::MakeXYWH(10, 30, 20, 19).IsSquare());
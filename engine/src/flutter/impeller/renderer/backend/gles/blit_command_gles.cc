@@ -205,6 +205,9 @@ struct TexImage2DData {
       case PixelFormat::kB10G10R10XRSRGB:
       case PixelFormat::kB10G10R10XR:
       case PixelFormat::kB10G10R10A10XR:
+      case PixelFormat::kETC2R8G8B8A8UNormInt:
+      case PixelFormat::kASTC4x4UNormInt:
+      case PixelFormat::kBC7UNormInt:
         return;
     }
     is_valid_ = true;
@@ -29,6 +29,10 @@ static const constexpr char* kMultisampledRenderToTexture2Ext =
 // https://registry.khronos.org/OpenGL/extensions/OES/OES_element_index_uint.txt
 static const constexpr char* kElementIndexUintExt = "GL_OES_element_index_uint";
 
+// https://registry.khronos.org/OpenGL/extensions/KHR/KHR_parallel_shader_compile.txt
+static const constexpr char* kParallelShaderCompileExt =
+    "GL_KHR_parallel_shader_compile";
+
 CapabilitiesGLES::CapabilitiesGLES(const ProcTableGLES& gl) {
   {
     GLint value = 0;
@@ -110,6 +114,12 @@ CapabilitiesGLES::CapabilitiesGLES(const ProcTableGLES& gl) {
     num_shader_binary_formats = value;
   }
 
+  if (desc->GetGlVersion().major_version >= 3) {
+    GLint value = 0;
+    gl.GetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &value);
+    num_program_binary_formats = value;
+  }
+
   if (desc->IsES()) {
     default_glyph_atlas_format_ = PixelFormat::kA8UNormInt;
   } else {
@@ -131,6 +141,10 @@ CapabilitiesGLES::CapabilitiesGLES(const ProcTableGLES& gl) {
     supports_32bit_primitive_indices_ = true;
   }
 
+  if (desc->HasExtension(kParallelShaderCompileExt)) {
+    supports_parallel_shader_compile_ = true;
+  }
+
   if (desc->HasExtension(kMultisampledRenderToTextureExt)) {
     supports_implicit_msaa_ = true;
 
@@ -153,6 +167,10 @@ bool CapabilitiesGLES::IsES() const {
   return is_es_;
 }
 
+bool CapabilitiesGLES::SupportsParallelShaderCompile() const {
+  return supports_parallel_shader_compile_;
+}
+
 size_t CapabilitiesGLES::GetMaxTextureUnits(ShaderStage stage) const {
   switch (stage) {
     case ShaderStage::kVertex:
@@ -210,6 +228,10 @@ bool CapabilitiesGLES::SupportsTriangleFan() const {
   return true;
 }
 
+bool CapabilitiesGLES::SupportsIndirectDraw() const {
+  return false;
+}
+
 PixelFormat CapabilitiesGLES::GetDefaultColorFormat() const {
   return PixelFormat::kR8G8B8A8UNormInt;
 }
@@ -73,10 +73,17 @@ class CapabilitiesGLES final
   // May be 0.
   size_t num_shader_binary_formats = 0;
 
+  // May be 0.
+  size_t num_program_binary_formats = 0;
+
   size_t GetMaxTextureUnits(ShaderStage stage) const;
 
   bool IsANGLE() const;
 
+  /// @brief Whether the driver can compile and link programs on background
+  ///        threads, reporting their status with `GL_COMPLETION_STATUS_KHR`.
+  bool SupportsParallelShaderCompile() const;
+
   /// @brief Whether this is an ES GL variant or (if false) desktop GL.
   bool IsES() const;
 
@@ -113,6 +120,9 @@ class CapabilitiesGLES final
   // |Capabilities|
   bool SupportsTriangleFan() const override;
 
+  // |Capabilities|
+  bool SupportsIndirectDraw() const override;
+
   // |Capabilities|
   bool SupportsPrimitiveRestart() const override;
 
@@ -150,6 +160,7 @@ class CapabilitiesGLES final
   bool supports_offscreen_msaa_ = false;
   bool supports_implicit_msaa_ = false;
   bool supports_32bit_primitive_indices_ = false;
+  bool supports_parallel_shader_compile_ = false;
   bool is_angle_ = false;
   bool is_es_ = false;
   PixelFormat default_glyph_atlas_format_ = PixelFormat::kUnknown;
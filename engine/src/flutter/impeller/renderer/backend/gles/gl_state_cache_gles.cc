@@ -0,0 +1,203 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/renderer/backend/gles/gl_state_cache_gles.h"
+
+#include "impeller/renderer/backend/gles/formats_gles.h"
+#include "impeller/renderer/backend/gles/pipeline_gles.h"
+
+namespace impeller {
+
+static void ConfigureBlending(const ProcTableGLES& gl,
+                              const ColorAttachmentDescriptor* color) {
+  if (color->blending_enabled) {
+    gl.Enable(GL_BLEND);
+    gl.BlendFuncSeparate(
+        ToBlendFactor(color->src_color_blend_factor),  // src color
+        ToBlendFactor(color->dst_color_blend_factor),  // dst color
+        ToBlendFactor(color->src_alpha_blend_factor),  // src alpha
+        ToBlendFactor(color->dst_alpha_blend_factor)   // dst alpha
+    );
+    gl.BlendEquationSeparate(
+        ToBlendOperation(color->color_blend_op),  // mode color
+        ToBlendOperation(color->alpha_blend_op)   // mode alpha
+    );
+  } else {
+    gl.Disable(GL_BLEND);
+  }
+
+  {
+    const auto is_set = [](ColorWriteMask mask,
+                           ColorWriteMask check) -> GLboolean {
+      return (mask & check) ? GL_TRUE : GL_FALSE;
+    };
+
+    gl.ColorMask(
+        is_set(color->write_mask, ColorWriteMaskBits::kRed),    // red
+        is_set(color->write_mask, ColorWriteMaskBits::kGreen),  // green
+        is_set(color->write_mask, ColorWriteMaskBits::kBlue),   // blue
+        is_set(color->write_mask, ColorWriteMaskBits::kAlpha)   // alpha
+    );
+  }
+}
+
+static void ConfigureStencil(GLenum face,
+                             const ProcTableGLES& gl,
+                             const StencilAttachmentDescriptor& stencil,
+                             uint32_t stencil_reference) {
+  gl.StencilOpSeparate(
+      face,                                    // face
+      ToStencilOp(stencil.stencil_failure),    // stencil fail
+      ToStencilOp(stencil.depth_failure),      // depth fail
+      ToStencilOp(stencil.depth_stencil_pass)  // depth stencil pass
+  );
+  gl.StencilFuncSeparate(face,                                        // face
+                         ToCompareFunction(stencil.stencil_compare),  // func
+                         stencil_reference,                           // ref
+                         stencil.read_mask                            // mask
+  );
+  gl.StencilMaskSeparate(face, stencil.write_mask);
+}
+
+static void ConfigureStencil(const ProcTableGLES& gl,
+                             const PipelineDescriptor& pipeline,
+                             uint32_t stencil_reference) {
+  if (!pipeline.HasStencilAttachmentDescriptors()) {
+    gl.Disable(GL_STENCIL_TEST);
+    return;
+  }
+
+  gl.Enable(GL_STENCIL_TEST);
+  const auto& front = pipeline.GetFrontStencilAttachmentDescriptor();
+  const auto& back = pipeline.GetBackStencilAttachmentDescriptor();
+
+  if (front.has_value() && back.has_value() && front == back) {
+    ConfigureStencil(GL_FRONT_AND_BACK, gl, *front, stencil_reference);
+    return;
+  }
+  if (front.has_value()) {
+    ConfigureStencil(GL_FRONT, gl, *front, stencil_reference);
+  }
+  if (back.has_value()) {
+    ConfigureStencil(GL_BACK, gl, *back, stencil_reference);
+  }
+}
+
+void GLStateCacheGLES::Invalidate() {
+  blending_.reset();
+  stencil_.reset();
+  depth_.reset();
+  scissor_.reset();
+  cull_mode_.reset();
+  winding_order_.reset();
+  program_pipeline_ = nullptr;
+}
+
+void GLStateCacheGLES::SetBlending(const ProcTableGLES& gl,
+                                   const ColorAttachmentDescriptor& color) {
+  if (blending_.has_value() && blending_.value() == color) {
+    return;
+  }
+  ConfigureBlending(gl, &color);
+  blending_ = color;
+}
+
+void GLStateCacheGLES::SetStencil(const ProcTableGLES& gl,
+                                  const PipelineDescriptor& pipeline,
+                                  uint32_t stencil_reference) {
+  StencilState stencil;
+  if (pipeline.HasStencilAttachmentDescriptors()) {
+    stencil.front = pipeline.GetFrontStencilAttachmentDescriptor();
+    stencil.back = pipeline.GetBackStencilAttachmentDescriptor();
+    stencil.reference = stencil_reference;
+  }
+  if (stencil_.has_value() && stencil_.value() == stencil) {
+    return;
+  }
+  ConfigureStencil(gl, pipeline, stencil_reference);
+  stencil_ = stencil;
+}
+
+void GLStateCacheGLES::SetDepth(
+    const ProcTableGLES& gl,
+    const std::optional<DepthAttachmentDescriptor>& depth) {
+  if (depth_.has_value() && depth_.value() == depth) {
+    return;
+  }
+  if (depth.has_value()) {
+    gl.Enable(GL_DEPTH_TEST);
+    gl.DepthFunc(ToCompareFunction(depth->depth_compare));
+    gl.DepthMask(depth->depth_write_enabled ? GL_TRUE : GL_FALSE);
+  } else {
+    gl.Disable(GL_DEPTH_TEST);
+  }
+  depth_ = depth;
+}
+
+void GLStateCacheGLES::SetScissor(const ProcTableGLES& gl,
+                                  const IRect32& scissor) {
+  if (scissor_.has_value() && scissor_.value() == scissor) {
+    return;
+  }
+  if (!scissor_.has_value()) {
+    gl.Enable(GL_SCISSOR_TEST);
+  }
+  gl.Scissor(scissor.GetX(),      // x
+             scissor.GetY(),      // y
+             scissor.GetWidth(),  // width
+             scissor.GetHeight()  // height
+  );
+  scissor_ = scissor;
+}
+
+void GLStateCacheGLES::SetCullMode(const ProcTableGLES& gl,
+                                   CullMode cull_mode) {
+  if (cull_mode_.has_value() && cull_mode_.value() == cull_mode) {
+    return;
+  }
+  switch (cull_mode) {
+    case CullMode::kNone:
+      gl.Disable(GL_CULL_FACE);
+      break;
+    case CullMode::kFrontFace:
+      gl.Enable(GL_CULL_FACE);
+      gl.CullFace(GL_FRONT);
+      break;
+    case CullMode::kBackFace:
+      gl.Enable(GL_CULL_FACE);
+      gl.CullFace(GL_BACK);
+      break;
+  }
+  cull_mode_ = cull_mode;
+}
+
+void GLStateCacheGLES::SetWindingOrder(const ProcTableGLES& gl,
+                                       WindingOrder winding_order) {
+  if (winding_order_.has_value() && winding_order_.value() == winding_order) {
+    return;
+  }
+  switch (winding_order) {
+    case WindingOrder::kClockwise:
+      gl.FrontFace(GL_CW);
+      break;
+    case WindingOrder::kCounterClockwise:
+      gl.FrontFace(GL_CCW);
+      break;
+  }
+  winding_order_ = winding_order;
+}
+
+bool GLStateCacheGLES::BindProgram(const PipelineGLES& pipeline) {
+  if (program_pipeline_ == &pipeline) {
+    return true;
+  }
+  if (!pipeline.BindProgram()) {
+    program_pipeline_ = nullptr;
+    return false;
+  }
+  program_pipeline_ = &pipeline;
+  return true;
+}
+
+}  // namespace impeller
@@ -0,0 +1,87 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_RENDERER_BACKEND_GLES_GL_STATE_CACHE_GLES_H_
+#define FLUTTER_IMPELLER_RENDERER_BACKEND_GLES_GL_STATE_CACHE_GLES_H_
+
+#include <cstdint>
+#include <optional>
+
+#include "impeller/core/formats.h"
+#include "impeller/geometry/rect.h"
+#include "impeller/renderer/backend/gles/proc_table_gles.h"
+#include "impeller/renderer/pipeline_descriptor.h"
+
+namespace impeller {
+
+class PipelineGLES;
+
+//------------------------------------------------------------------------------
+/// @brief      Shadows the GL state set while encoding the commands of a render
+///             pass so that calls which wouldn't change the state can be
+///             skipped.
+///
+///             Consecutive commands usually share most of their pipeline
+///             state, and on drivers that are CPU bound every redundant state
+///             change costs time.
+///
+///             All state is unknown until it is first set, so the first
+///             command always configures everything. The cache must be
+///             invalidated whenever GL state is changed without going through
+///             it.
+///
+class GLStateCacheGLES {
+ public:
+  GLStateCacheGLES() = default;
+
+  ~GLStateCacheGLES() = default;
+
+  /// @brief Forget all shadowed state.
+  void Invalidate();
+
+  void SetBlending(const ProcTableGLES& gl,
+                   const ColorAttachmentDescriptor& color);
+
+  void SetStencil(const ProcTableGLES& gl,
+                  const PipelineDescriptor& pipeline,
+                  uint32_t stencil_reference);
+
+  void SetDepth(const ProcTableGLES& gl,
+                const std::optional<DepthAttachmentDescriptor>& depth);
+
+  /// @brief Enable the scissor test with a rect in GL framebuffer
+  ///        coordinates.
+  void SetScissor(const ProcTableGLES& gl, const IRect32& scissor);
+
+  void SetCullMode(const ProcTableGLES& gl, CullMode cull_mode);
+
+  void SetWindingOrder(const ProcTableGLES& gl, WindingOrder winding_order);
+
+  [[nodiscard]] bool BindProgram(const PipelineGLES& pipeline);
+
+ private:
+  struct StencilState {
+    std::optional<StencilAttachmentDescriptor> front;
+    std::optional<StencilAttachmentDescriptor> back;
+    uint32_t reference = 0u;
+
+    bool operator==(const StencilState& other) const = default;
+  };
+
+  std::optional<ColorAttachmentDescriptor> blending_;
+  std::optional<StencilState> stencil_;
+  std::optional<std::optional<DepthAttachmentDescriptor>> depth_;
+  std::optional<IRect32> scissor_;
+  std::optional<CullMode> cull_mode_;
+  std::optional<WindingOrder> winding_order_;
+  const PipelineGLES* program_pipeline_ = nullptr;
+
+  GLStateCacheGLES(const GLStateCacheGLES&) = delete;
+
+  GLStateCacheGLES& operator=(const GLStateCacheGLES&) = delete;
+};
+
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_RENDERER_BACKEND_GLES_GL_STATE_CACHE_GLES_H_
@@ -0,0 +1,66 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/testing/testing.h"  // IWYU pragma: keep
+#include "gtest/gtest.h"
+#include "impeller/renderer/backend/gles/gl_state_cache_gles.h"
+#include "impeller/renderer/backend/gles/test/mock_gles.h"
+
+namespace impeller {
+namespace testing {
+
+using ::testing::NiceMock;
+
+TEST(GLStateCacheGLESTest, SkipsRedundantBlendState) {
+  auto mock_gles_impl = std::make_unique<NiceMock<MockGLESImpl>>();
+  EXPECT_CALL(*mock_gles_impl, Enable(GL_BLEND)).Times(2);
+
+  std::shared_ptr<MockGLES> mock_gl = MockGLES::Init(std::move(mock_gles_impl));
+  const ProcTableGLES& gl = mock_gl->GetProcTable();
+
+  GLStateCacheGLES state_cache;
+  ColorAttachmentDescriptor color;
+  color.blending_enabled = true;
+  state_cache.SetBlending(gl, color);
+  state_cache.SetBlending(gl, color);
+
+  color.src_color_blend_factor = BlendFactor::kOne;
+  state_cache.SetBlending(gl, color);
+  state_cache.SetBlending(gl, color);
+}
+
+TEST(GLStateCacheGLESTest, InvalidateForgetsState) {
+  auto mock_gles_impl = std::make_unique<NiceMock<MockGLESImpl>>();
+  EXPECT_CALL(*mock_gles_impl, Disable(GL_CULL_FACE)).Times(2);
+  EXPECT_CALL(*mock_gles_impl, Disable(GL_DEPTH_TEST)).Times(2);
+
+  std::shared_ptr<MockGLES> mock_gl = MockGLES::Init(std::move(mock_gles_impl));
+  const ProcTableGLES& gl = mock_gl->GetProcTable();
+
+  GLStateCacheGLES state_cache;
+  state_cache.SetCullMode(gl, CullMode::kNone);
+  state_cache.SetDepth(gl, std::nullopt);
+  state_cache.SetCullMode(gl, CullMode::kNone);
+  state_cache.SetDepth(gl, std::nullopt);
+
+  state_cache.Invalidate();
+  state_cache.SetCullMode(gl, CullMode::kNone);
+  state_cache.SetDepth(gl, std::nullopt);
+}
+
+TEST(GLStateCacheGLESTest, EnablesScissorTestOnce) {
+  auto mock_gles_impl = std::make_unique<NiceMock<MockGLESImpl>>();
+  EXPECT_CALL(*mock_gles_impl, Enable(GL_SCISSOR_TEST)).Times(1);
+
+  std::shared_ptr<MockGLES> mock_gl = MockGLES::Init(std::move(mock_gles_impl));
+  const ProcTableGLES& gl = mock_gl->GetProcTable();
+
+  GLStateCacheGLES state_cache;
+  state_cache.SetScissor(gl, IRect32::MakeXYWH(0, 0, 10, 10));
+  state_cache.SetScissor(gl, IRect32::MakeXYWH(5, 5, 10, 10));
+  state_cache.SetScissor(gl, IRect32::MakeXYWH(5, 5, 10, 10));
+}
+
+}  // namespace testing
+}  // namespace impeller
@@ -4,20 +4,37 @@
 
 #include "impeller/renderer/backend/gles/pipeline_library_gles.h"
 
+#include <optional>
 #include <sstream>
 #include <string>
+#include <string_view>
 
+#include "flutter/fml/time/time_point.h"
 #include "flutter/fml/trace_event.h"
+#include "flutter/fml/trace_recorder.h"
 #include "fml/closure.h"
 #include "impeller/base/promise.h"
 #include "impeller/renderer/backend/gles/pipeline_gles.h"
+#include "impeller/renderer/backend/gles/program_binary_gles.h"
 #include "impeller/renderer/backend/gles/shader_function_gles.h"
 #include "impeller/renderer/pipeline_descriptor.h"
 
 namespace impeller {
 
-PipelineLibraryGLES::PipelineLibraryGLES(std::shared_ptr<ReactorGLES> reactor)
-    : reactor_(std::move(reactor)) {}
+PipelineLibraryGLES::PipelineLibraryGLES(std::shared_ptr<ReactorGLES> reactor,
+                                         fml::UniqueFD cache_directory)
+    : reactor_(std::move(reactor)),
+      cache_directory_(std::move(cache_directory)) {
+  if (!reactor_ || !cache_directory_.is_valid()) {
+    return;
+  }
+  const auto& gl = reactor_->GetProcTable();
+  uses_program_binaries_ =
+      gl.GetProgramBinary.IsAvailable() && gl.ProgramBinary.IsAvailable() &&
+      gl.ProgramParameteri.IsAvailable() &&
+      gl.GetCapabilities()->num_program_binary_formats > 0;
+  driver_hash_ = std::hash<std::string>{}(gl.GetDescription()->GetString());
+}
 
 static std::string GetShaderInfoLog(const ProcTableGLES& gl, GLuint shader) {
   GLint log_length = 0;
@@ -74,12 +91,25 @@ static void LogShaderCompilationFailure(const ProcTableGLES& gl,
   VALIDATION_LOG << stream.str();
 }
 
-static bool LinkProgram(
+namespace {
+
+// The shaders of a program whose link has been issued to the driver but whose
+// result has not been checked yet.
+struct PendingProgramLink {
+  GLuint program = 0;
+  GLuint vert_shader = 0;
+  GLuint frag_shader = 0;
+};
+
+}  // namespace
+
+static std::optional<PendingProgramLink> BeginLinkProgram(
     const ReactorGLES& reactor,
     const std::shared_ptr<PipelineGLES>& pipeline,
     const std::shared_ptr<const ShaderFunction>& vert_function,
-    const std::shared_ptr<const ShaderFunction>& frag_function) {
-  TRACE_EVENT0("impeller", __FUNCTION__);
+    const std::shared_ptr<const ShaderFunction>& frag_function,
+    bool binary_retrievable) {
+  FML_RECORDED_TRACE_EVENT0("impeller", __FUNCTION__);
 
   const auto& descriptor = pipeline->GetDescriptor();
 
@@ -95,7 +125,7 @@ static bool LinkProgram(
 
   if (vert_shader == 0 || frag_shader == 0) {
     VALIDATION_LOG << "Could not create shader handles.";
-    return false;
+    return std::nullopt;
   }
 
   gl.SetDebugLabel(DebugResourceType::kShader, vert_shader,
@@ -103,10 +133,11 @@ static bool LinkProgram(
   gl.SetDebugLabel(DebugResourceType::kShader, frag_shader,
                    std::format("{} Fragment Shader", descriptor.GetLabel()));
 
-  fml::ScopedCleanupClosure delete_vert_shader(
-      [&gl, vert_shader]() { gl.DeleteShader(vert_shader); });
-  fml::ScopedCleanupClosure delete_frag_shader(
-      [&gl, frag_shader]() { gl.DeleteShader(frag_shader); });
+  fml::ScopedCleanupClosure delete_shaders(
+      [&gl, vert_shader, frag_shader]() {
+        gl.DeleteShader(vert_shader);
+        gl.DeleteShader(frag_shader);
+      });
 
   gl.ShaderSourceMapping(vert_shader, *vert_mapping,
                          descriptor.GetSpecializationConstants());
@@ -116,42 +147,15 @@ static bool LinkProgram(
   gl.CompileShader(vert_shader);
   gl.CompileShader(frag_shader);
 
-  GLint vert_status = GL_FALSE;
-  GLint frag_status = GL_FALSE;
-
-  gl.GetShaderiv(vert_shader, GL_COMPILE_STATUS, &vert_status);
-  gl.GetShaderiv(frag_shader, GL_COMPILE_STATUS, &frag_status);
-
-  if (vert_status != GL_TRUE) {
-    LogShaderCompilationFailure(gl, vert_shader, descriptor.GetLabel(),
-                                *vert_mapping, ShaderStage::kVertex);
-    return false;
-  }
-
-  if (frag_status != GL_TRUE) {
-    LogShaderCompilationFailure(gl, frag_shader, descriptor.GetLabel(),
-                                *frag_mapping, ShaderStage::kFragment);
-    return false;
-  }
-
   auto program = reactor.GetGLHandle(pipeline->GetProgramHandle());
   if (!program.has_value()) {
     VALIDATION_LOG << "Could not get program handle from reactor.";
-    return false;
+    return std::nullopt;
   }
 
   gl.AttachShader(*program, vert_shader);
   gl.AttachShader(*program, frag_shader);
 
-  fml::ScopedCleanupClosure detach_vert_shader(
-      [&gl, program = *program, vert_shader]() {
-        gl.DetachShader(program, vert_shader);
-      });
-  fml::ScopedCleanupClosure detach_frag_shader(
-      [&gl, program = *program, frag_shader]() {
-        gl.DetachShader(program, frag_shader);
-      });
-
   for (const auto& stage_input :
        descriptor.GetVertexDescriptor()->GetStageInputs()) {
     gl.BindAttribLocation(*program,                                   //
@@ -160,39 +164,120 @@ static bool LinkProgram(
     );
   }
 
+  if (binary_retrievable) {
+    gl.ProgramParameteri(*program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                         GL_TRUE);
+  }
+
+  // The compile and link statuses are only queried in |EndLinkProgram| as
+  // querying them waits for the driver to finish.
   gl.LinkProgram(*program);
 
+  delete_shaders.Release();
+  return PendingProgramLink{*program, vert_shader, frag_shader};
+}
+
+static bool EndLinkProgram(
+    const ProcTableGLES& gl,
+    const PendingProgramLink& link,
+    const PipelineDescriptor& descriptor,
+    const std::shared_ptr<const ShaderFunction>& vert_function,
+    const std::shared_ptr<const ShaderFunction>& frag_function) {
+  FML_RECORDED_TRACE_EVENT0("impeller", __FUNCTION__);
+
+  fml::ScopedCleanupClosure delete_vert_shader(
+      [&gl, vert_shader = link.vert_shader]() {
+        gl.DeleteShader(vert_shader);
+      });
+  fml::ScopedCleanupClosure delete_frag_shader(
+      [&gl, frag_shader = link.frag_shader]() {
+        gl.DeleteShader(frag_shader);
+      });
+  fml::ScopedCleanupClosure detach_vert_shader(
+      [&gl, program = link.program, vert_shader = link.vert_shader]() {
+        gl.DetachShader(program, vert_shader);
+      });
+  fml::ScopedCleanupClosure detach_frag_shader(
+      [&gl, program = link.program, frag_shader = link.frag_shader]() {
+        gl.DetachShader(program, frag_shader);
+      });
+
+  GLint vert_status = GL_FALSE;
+  GLint frag_status = GL_FALSE;
+
+  gl.GetShaderiv(link.vert_shader, GL_COMPILE_STATUS, &vert_status);
+  gl.GetShaderiv(link.frag_shader, GL_COMPILE_STATUS, &frag_status);
+
+  if (vert_status != GL_TRUE) {
+    LogShaderCompilationFailure(
+        gl, link.vert_shader, descriptor.GetLabel(),
+        *ShaderFunctionGLES::Cast(*vert_function).GetSourceMapping(),
+        ShaderStage::kVertex);
+    return false;
+  }
+
+  if (frag_status != GL_TRUE) {
+    LogShaderCompilationFailure(
+        gl, link.frag_shader, descriptor.GetLabel(),
+        *ShaderFunctionGLES::Cast(*frag_function).GetSourceMapping(),
+        ShaderStage::kFragment);
+    return false;
+  }
+
   GLint link_status = GL_FALSE;
-  gl.GetProgramiv(*program, GL_LINK_STATUS, &link_status);
+  gl.GetProgramiv(link.program, GL_LINK_STATUS, &link_status);
 
   if (link_status != GL_TRUE) {
     VALIDATION_LOG << "Could not link shader program: "
-                   << gl.GetProgramInfoLogString(*program)
+                   << gl.GetProgramInfoLogString(link.program)
                    << "\nVertex Shader:\n"
-                   << GetShaderSource(gl, vert_shader) << "\nFragment Shader:\n"
-                   << GetShaderSource(gl, frag_shader);
+                   << GetShaderSource(gl, link.vert_shader)
+                   << "\nFragment Shader:\n"
+                   << GetShaderSource(gl, link.frag_shader);
     return false;
   }
   return true;
 }
 
+// A hash of everything the linked program depends on, used to key its binary.
+static uint64_t GetProgramBinaryHash(
+    const std::shared_ptr<const ShaderFunction>& vert_function,
+    const std::shared_ptr<const ShaderFunction>& frag_function,
+    const std::vector<Scalar>& specialization_constants) {
+  auto seed = fml::HashCombine();
+  for (const auto& function : {vert_function, frag_function}) {
+    const auto& mapping =
+        ShaderFunctionGLES::Cast(*function).GetSourceMapping();
+    fml::HashCombineSeed(
+        seed, std::hash<std::string_view>{}(std::string_view(
+                  reinterpret_cast<const char*>(mapping->GetMapping()),
+                  mapping->GetSize())));
+  }
+  for (const auto& constant : specialization_constants) {
+    fml::HashCombineSeed(seed, constant);
+  }
+  return seed;
+}
+
 // |PipelineLibrary|
 bool PipelineLibraryGLES::IsValid() const {
   return reactor_ != nullptr;
 }
 
-std::shared_ptr<PipelineGLES> PipelineLibraryGLES::CreatePipeline(
+void PipelineLibraryGLES::CreatePipeline(
     const std::weak_ptr<PipelineLibrary>& weak_library,
     const PipelineDescriptor& desc,
     const std::shared_ptr<const ShaderFunction>& vert_function,
     const std::shared_ptr<const ShaderFunction>& frag_function,
-    bool threadsafe) {
+    bool threadsafe,
+    const PipelineCallback& callback) {
   auto strong_library = weak_library.lock();
 
   if (!strong_library) {
     VALIDATION_LOG << "Library was collected before a pending pipeline "
                       "creation could finish.";
-    return nullptr;
+    callback(nullptr);
+    return;
   }
 
   auto& library = PipelineLibraryGLES::Cast(*strong_library);
@@ -200,7 +285,8 @@ std::shared_ptr<PipelineGLES> PipelineLibraryGLES::CreatePipeline(
   const auto& reactor = library.GetReactor();
 
   if (!reactor) {
-    return nullptr;
+    callback(nullptr);
+    return;
   }
 
   auto program_key = ProgramKey{vert_function, frag_function,
@@ -231,22 +317,80 @@ std::shared_ptr<PipelineGLES> PipelineLibraryGLES::CreatePipeline(
 
   if (!program.has_value()) {
     VALIDATION_LOG << "Could not obtain program handle.";
-    return nullptr;
+    callback(nullptr);
+    return;
+  }
+
+  if (has_cached_program) {
+    callback(library.FinishPipeline(pipeline, program_key, true, std::nullopt));
+    return;
   }
 
-  const auto link_result = !has_cached_program ? LinkProgram(*reactor,       //
-                                                             pipeline,       //
-                                                             vert_function,  //
-                                                             frag_function   //
-                                                             )
-                                               : true;
+  const fml::TimePoint compile_start = fml::TimePoint::Now();
+  std::optional<uint64_t> program_hash;
+  if (library.uses_program_binaries_) {
+    program_hash = GetProgramBinaryHash(vert_function, frag_function,
+                                        desc.GetSpecializationConstants());
+    if (library.LoadProgramBinary(program.value(), program_hash.value())) {
+      library.LogPipelineCompile(fml::TimePoint::Now() - compile_start);
+      callback(
+          library.FinishPipeline(pipeline, program_key, false, std::nullopt));
+      return;
+    }
+  }
 
-  if (!link_result) {
+  auto link = BeginLinkProgram(*reactor, pipeline, vert_function,
+                               frag_function, program_hash.has_value());
+  if (!link.has_value()) {
     VALIDATION_LOG << "Could not link pipeline program.";
+    callback(nullptr);
+    return;
+  }
+
+  auto end_link = [weak_library, pipeline, program_key, program_hash,
+                   link = link.value(), vert_function, frag_function, callback,
+                   compile_start](const ReactorGLES& reactor) {
+    if (!EndLinkProgram(reactor.GetProcTable(), link,
+                        pipeline->GetDescriptor(), vert_function,
+                        frag_function)) {
+      VALIDATION_LOG << "Could not link pipeline program.";
+      callback(nullptr);
+      return;
+    }
+    auto strong_library = weak_library.lock();
+    if (!strong_library) {
+      VALIDATION_LOG << "Library was collected before a pending pipeline "
+                        "creation could finish.";
+      callback(nullptr);
+      return;
+    }
+    strong_library->LogPipelineCompile(fml::TimePoint::Now() - compile_start);
+    callback(PipelineLibraryGLES::Cast(*strong_library)
+                 .FinishPipeline(pipeline, program_key, false, program_hash));
+  };
+
+  const auto& capabilities = reactor->GetProcTable().GetCapabilities();
+  if (capabilities->SupportsParallelShaderCompile()) {
+    // Check the link once the other pending pipelines have been issued too, so
+    // that the driver compiles and links them concurrently in the meantime.
+    reactor->AddOperation(std::move(end_link), /*defer=*/true);
+  } else {
+    end_link(*reactor);
+  }
+}
+
+std::shared_ptr<PipelineGLES> PipelineLibraryGLES::FinishPipeline(
+    const std::shared_ptr<PipelineGLES>& pipeline,
+    const ProgramKey& program_key,
+    bool has_cached_program,
+    std::optional<uint64_t> program_hash) {
+  auto program = reactor_->GetGLHandle(pipeline->GetProgramHandle());
+  if (!program.has_value()) {
+    VALIDATION_LOG << "Could not obtain program handle.";
     return nullptr;
   }
 
-  if (!pipeline->BuildVertexDescriptor(reactor->GetProcTable(),
+  if (!pipeline->BuildVertexDescriptor(reactor_->GetProcTable(),
                                        program.value())) {
     VALIDATION_LOG << "Could not build pipeline vertex descriptors.";
     return nullptr;
@@ -258,12 +402,58 @@ std::shared_ptr<PipelineGLES> PipelineLibraryGLES::CreatePipeline(
   }
 
   if (!has_cached_program) {
-    library.SetProgramForKey(program_key, pipeline->GetSharedHandle());
+    SetProgramForKey(program_key, pipeline->GetSharedHandle());
+  }
+
+  if (program_hash.has_value()) {
+    StoreProgramBinary(program.value(), program_hash.value());
   }
 
   return pipeline;
 }
 
+bool PipelineLibraryGLES::LoadProgramBinary(GLuint program,
+                                            uint64_t program_hash) const {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  uint32_t format = 0;
+  auto binary = ProgramBinaryRetrieve(cache_directory_, driver_hash_,
+                                      program_hash, &format);
+  if (!binary) {
+    return false;
+  }
+  const auto& gl = reactor_->GetProcTable();
+  gl.ProgramBinary(program, format, binary->GetMapping(),
+                   static_cast<GLsizei>(binary->GetSize()));
+  // Drivers may still reject binaries, for instance after an update that did
+  // not change the driver strings. The program is then linked from source.
+  GLint link_status = GL_FALSE;
+  gl.GetProgramiv(program, GL_LINK_STATUS, &link_status);
+  return link_status == GL_TRUE;
+}
+
+void PipelineLibraryGLES::StoreProgramBinary(GLuint program,
+                                             uint64_t program_hash) const {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  const auto& gl = reactor_->GetProcTable();
+  GLint length = 0;
+  gl.GetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length <= 0) {
+    return;
+  }
+  std::vector<uint8_t> binary(length);
+  GLsizei written = 0;
+  GLenum format = 0;
+  gl.GetProgramBinary(program, length, &written, &format, binary.data());
+  if (written <= 0) {
+    return;
+  }
+  ProgramBinaryPersist(
+      cache_directory_,
+      ProgramBinaryHeaderGLES{driver_hash_, program_hash, format,
+                              static_cast<uint64_t>(written)},
+      fml::NonOwnedMapping(binary.data(), written));
+}
+
 // |PipelineLibrary|
 PipelineFuture<PipelineDescriptor> PipelineLibraryGLES::GetPipeline(
     PipelineDescriptor descriptor,
@@ -303,8 +493,11 @@ PipelineFuture<PipelineDescriptor> PipelineLibraryGLES::GetPipeline(
                                               frag_function,                 //
                                               threadsafe                     //
   ](const ReactorGLES& reactor) {
-    promise->set_value(CreatePipeline(weak_this, descriptor, vert_function,
-                                      frag_function, threadsafe));
+    CreatePipeline(weak_this, descriptor, vert_function, frag_function,
+                   threadsafe,
+                   [promise](std::shared_ptr<PipelineGLES> pipeline) {
+                     promise->set_value(std::move(pipeline));
+                   });
   });
   FML_CHECK(result);
 
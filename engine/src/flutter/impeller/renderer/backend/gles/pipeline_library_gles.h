@@ -5,10 +5,13 @@
 #ifndef FLUTTER_IMPELLER_RENDERER_BACKEND_GLES_PIPELINE_LIBRARY_GLES_H_
 #define FLUTTER_IMPELLER_RENDERER_BACKEND_GLES_PIPELINE_LIBRARY_GLES_H_
 
+#include <functional>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
 #include "flutter/fml/hash_combine.h"
+#include "flutter/fml/unique_fd.h"
 #include "impeller/base/thread.h"
 #include "impeller/renderer/backend/gles/reactor_gles.h"
 #include "impeller/renderer/backend/gles/unique_handle_gles.h"
@@ -87,12 +90,22 @@ class PipelineLibraryGLES final
                                         ProgramKey::Hash,
                                         ProgramKey::Equal>;
 
+  using PipelineCallback = std::function<void(std::shared_ptr<PipelineGLES>)>;
+
   std::shared_ptr<ReactorGLES> reactor_;
   PipelineMap pipelines_;
   Mutex programs_mutex_;
   ProgramMap programs_ IPLR_GUARDED_BY(programs_mutex_);
+  //----------------------------------------------------------------------------
+  /// The directory the binaries of linked programs are persisted in so that
+  /// they don't have to be compiled and linked from source on the next launch.
+  ///
+  const fml::UniqueFD cache_directory_;
+  bool uses_program_binaries_ = false;
+  uint64_t driver_hash_ = 0;
 
-  explicit PipelineLibraryGLES(std::shared_ptr<ReactorGLES> reactor);
+  PipelineLibraryGLES(std::shared_ptr<ReactorGLES> reactor,
+                      fml::UniqueFD cache_directory);
 
   // |PipelineLibrary|
   bool IsValid() const override;
@@ -116,12 +129,31 @@ class PipelineLibraryGLES final
 
   const std::shared_ptr<ReactorGLES>& GetReactor() const;
 
-  static std::shared_ptr<PipelineGLES> CreatePipeline(
+  //----------------------------------------------------------------------------
+  /// @brief      Create the pipeline and invoke the callback with it, or with
+  ///             nullptr if it could not be created.
+  ///
+  ///             If the driver supports parallel shader compilation, the
+  ///             callback is invoked from a later reactor operation so that
+  ///             the driver can link other programs in the meantime.
+  ///
+  static void CreatePipeline(
       const std::weak_ptr<PipelineLibrary>& weak_library,
       const PipelineDescriptor& desc,
       const std::shared_ptr<const ShaderFunction>& vert_shader,
       const std::shared_ptr<const ShaderFunction>& frag_shader,
-      bool threadsafe);
+      bool threadsafe,
+      const PipelineCallback& callback);
+
+  std::shared_ptr<PipelineGLES> FinishPipeline(
+      const std::shared_ptr<PipelineGLES>& pipeline,
+      const ProgramKey& program_key,
+      bool has_cached_program,
+      std::optional<uint64_t> program_hash);
+
+  bool LoadProgramBinary(GLuint program, uint64_t program_hash) const;
+
+  void StoreProgramBinary(GLuint program, uint64_t program_hash) const;
 
   std::shared_ptr<UniqueHandleGLES> GetProgramForKey(const ProgramKey& key);
 
@@ -252,7 +252,10 @@ void(glDepthRange)(GLdouble n, GLdouble f);
   PROC(BindBufferRange);                   \
   PROC(WaitSync);                          \
   PROC(RenderbufferStorageMultisample)     \
-  PROC(BlitFramebuffer);
+  PROC(BlitFramebuffer);                   \
+  PROC(GetProgramBinary);                  \
+  PROC(ProgramBinary);                     \
+  PROC(ProgramParameteri);
 
 #define FOR_EACH_IMPELLER_EXT_PROC(PROC)    \
   PROC(DebugMessageControlKHR);             \
@@ -0,0 +1,108 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/renderer/backend/gles/program_binary_gles.h"
+
+#include <cstring>
+#include <format>
+#include <string>
+
+#include "flutter/fml/file.h"
+#include "impeller/base/allocation.h"
+#include "impeller/base/validation.h"
+
+namespace impeller {
+
+static std::string GetProgramBinaryFileName(uint64_t program_hash) {
+  return std::format("flutter.impeller.glprogram.{:016x}", program_hash);
+}
+
+ProgramBinaryHeaderGLES::ProgramBinaryHeaderGLES() = default;
+
+ProgramBinaryHeaderGLES::ProgramBinaryHeaderGLES(uint64_t p_driver_hash,
+                                                 uint64_t p_program_hash,
+                                                 uint32_t p_format,
+                                                 uint64_t p_data_size)
+    : format(p_format),
+      driver_hash(p_driver_hash),
+      program_hash(p_program_hash),
+      data_size(p_data_size) {}
+
+bool ProgramBinaryHeaderGLES::IsCompatibleWith(
+    const ProgramBinaryHeaderGLES& other) const {
+  return magic == other.magic &&              //
+         driver_hash == other.driver_hash &&  //
+         program_hash == other.program_hash;
+}
+
+bool ProgramBinaryPersist(const fml::UniqueFD& cache_directory,
+                          const ProgramBinaryHeaderGLES& header,
+                          const fml::Mapping& binary) {
+  if (!cache_directory.is_valid() || binary.GetMapping() == nullptr) {
+    return false;
+  }
+  if (binary.GetSize() != header.data_size) {
+    VALIDATION_LOG << "Program binary size does not match its header.";
+    return false;
+  }
+  auto allocation = std::make_shared<Allocation>();
+  if (!allocation->Truncate(Bytes{sizeof(header) + binary.GetSize()}, false)) {
+    VALIDATION_LOG << "Could not allocate program binary staging buffer.";
+    return false;
+  }
+  std::memcpy(allocation->GetBuffer(), &header, sizeof(header));
+  std::memcpy(allocation->GetBuffer() + sizeof(header), binary.GetMapping(),
+              binary.GetSize());
+
+  fml::NonOwnedMapping allocation_mapping(allocation->GetBuffer(),
+                                          sizeof(header) + binary.GetSize());
+  const auto file_name = GetProgramBinaryFileName(header.program_hash);
+  if (!fml::WriteAtomically(cache_directory, file_name.c_str(),
+                            allocation_mapping)) {
+    VALIDATION_LOG << "Could not write program binary to disk.";
+    return false;
+  }
+  return true;
+}
+
+std::unique_ptr<fml::Mapping> ProgramBinaryRetrieve(
+    const fml::UniqueFD& cache_directory,
+    uint64_t driver_hash,
+    uint64_t program_hash,
+    uint32_t* format) {
+  if (!cache_directory.is_valid()) {
+    return nullptr;
+  }
+  std::shared_ptr<fml::FileMapping> on_disk_data =
+      fml::FileMapping::CreateReadOnly(
+          cache_directory, GetProgramBinaryFileName(program_hash));
+  if (!on_disk_data || !on_disk_data->GetMapping()) {
+    return nullptr;
+  }
+  if (on_disk_data->GetSize() < sizeof(ProgramBinaryHeaderGLES)) {
+    return nullptr;
+  }
+  auto header = ProgramBinaryHeaderGLES{};
+  std::memcpy(&header,                     //
+              on_disk_data->GetMapping(),  //
+              sizeof(header)               //
+  );
+  const auto current_header =
+      ProgramBinaryHeaderGLES{driver_hash, program_hash, 0u, 0u};
+  if (!header.IsCompatibleWith(current_header)) {
+    return nullptr;
+  }
+  if (header.data_size == 0u ||
+      header.data_size > on_disk_data->GetSize() - sizeof(header)) {
+    return nullptr;
+  }
+  if (format) {
+    *format = header.format;
+  }
+  return std::make_unique<fml::NonOwnedMapping>(
+      on_disk_data->GetMapping() + sizeof(header), header.data_size,
+      [on_disk_data](auto, auto) {});
+}
+
+}  // namespace impeller
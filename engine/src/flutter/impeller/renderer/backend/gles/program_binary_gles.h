@@ -0,0 +1,104 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_RENDERER_BACKEND_GLES_PROGRAM_BINARY_GLES_H_
+#define FLUTTER_IMPELLER_RENDERER_BACKEND_GLES_PROGRAM_BINARY_GLES_H_
+
+#include <cstdint>
+#include <memory>
+
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/unique_fd.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      An Impeller specific header prepended to the linked program
+///             binaries that are persisted on disk.
+///
+///             Program binaries are only valid for the exact driver that
+///             produced them. Drivers are supposed to reject incompatible
+///             binaries in |glProgramBinary|, but checking the driver string
+///             up front avoids relying on that.
+///
+struct ProgramBinaryHeaderGLES {
+  // This can be used by Impeller to manually invalidate all old binaries.
+  uint32_t magic = 0xB1AB1A55;
+  // The binary format returned by |glGetProgramBinary|.
+  uint32_t format = 0;
+  // A hash of the vendor, renderer, and version strings of the driver.
+  uint64_t driver_hash = 0;
+  // A hash of the shader sources and specialization constants of the program.
+  uint64_t program_hash = 0;
+  uint64_t data_size = 0;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Constructs a new empty instance.
+  ///
+  ProgramBinaryHeaderGLES();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Constructs a new instance for the binary of a program.
+  ///
+  /// @param[in]  p_driver_hash   The driver hash.
+  /// @param[in]  p_program_hash  The program hash.
+  /// @param[in]  p_format        The binary format.
+  /// @param[in]  p_data_size     The data size.
+  ///
+  ProgramBinaryHeaderGLES(uint64_t p_driver_hash,
+                          uint64_t p_program_hash,
+                          uint32_t p_format,
+                          uint64_t p_data_size);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Determines whether a binary with the other header can be
+  ///             loaded in place of the program described by this one.
+  ///
+  ///             The format and the size of the data are not part of
+  ///             compatibility checks.
+  ///
+  /// @param[in]  other     The other header.
+  ///
+  /// @return     True if the specified header is compatible with this one,
+  ///             False otherwise.
+  ///
+  bool IsCompatibleWith(const ProgramBinaryHeaderGLES& other) const;
+};
+
+//------------------------------------------------------------------------------
+/// @brief      Persist the binary of a linked program to a file in the given
+///             cache directory. The file is named after the program hash of
+///             the header.
+///
+/// @param[in]  cache_directory  The cache directory
+/// @param[in]  header           The header describing the binary
+/// @param[in]  binary           The binary returned by |glGetProgramBinary|
+///
+/// @return     If the binary could be persisted to disk.
+///
+bool ProgramBinaryPersist(const fml::UniqueFD& cache_directory,
+                          const ProgramBinaryHeaderGLES& header,
+                          const fml::Mapping& binary);
+
+//------------------------------------------------------------------------------
+/// @brief      Retrieve the previously persisted binary of a program.
+///
+/// @param[in]  cache_directory  The cache directory
+/// @param[in]  driver_hash      The driver hash of the current driver
+/// @param[in]  program_hash     The program hash of the program
+/// @param[out] format           The binary format of the retrieved binary
+///
+/// @return     The binary stripped of its header if one was found and
+///             produced by the same driver for the same program. nullptr
+///             otherwise.
+///
+std::unique_ptr<fml::Mapping> ProgramBinaryRetrieve(
+    const fml::UniqueFD& cache_directory,
+    uint64_t driver_hash,
+    uint64_t program_hash,
+    uint32_t* format);
+
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_RENDERER_BACKEND_GLES_PROGRAM_BINARY_GLES_H_
@@ -16,6 +16,7 @@
 #include "impeller/renderer/backend/gles/context_gles.h"
 #include "impeller/renderer/backend/gles/device_buffer_gles.h"
 #include "impeller/renderer/backend/gles/formats_gles.h"
+#include "impeller/renderer/backend/gles/gl_state_cache_gles.h"
 #include "impeller/renderer/backend/gles/gpu_tracer_gles.h"
 #include "impeller/renderer/backend/gles/pipeline_gles.h"
 #include "impeller/renderer/backend/gles/texture_gles.h"
@@ -43,81 +44,6 @@ void RenderPassGLES::OnSetLabel(std::string_view label) {
   label_ = label;
 }
 
-void ConfigureBlending(const ProcTableGLES& gl,
-                       const ColorAttachmentDescriptor* color) {
-  if (color->blending_enabled) {
-    gl.Enable(GL_BLEND);
-    gl.BlendFuncSeparate(
-        ToBlendFactor(color->src_color_blend_factor),  // src color
-        ToBlendFactor(color->dst_color_blend_factor),  // dst color
-        ToBlendFactor(color->src_alpha_blend_factor),  // src alpha
-        ToBlendFactor(color->dst_alpha_blend_factor)   // dst alpha
-    );
-    gl.BlendEquationSeparate(
-        ToBlendOperation(color->color_blend_op),  // mode color
-        ToBlendOperation(color->alpha_blend_op)   // mode alpha
-    );
-  } else {
-    gl.Disable(GL_BLEND);
-  }
-
-  {
-    const auto is_set = [](ColorWriteMask mask,
-                           ColorWriteMask check) -> GLboolean {
-      return (mask & check) ? GL_TRUE : GL_FALSE;
-    };
-
-    gl.ColorMask(
-        is_set(color->write_mask, ColorWriteMaskBits::kRed),    // red
-        is_set(color->write_mask, ColorWriteMaskBits::kGreen),  // green
-        is_set(color->write_mask, ColorWriteMaskBits::kBlue),   // blue
-        is_set(color->write_mask, ColorWriteMaskBits::kAlpha)   // alpha
-    );
-  }
-}
-
-void ConfigureStencil(GLenum face,
-                      const ProcTableGLES& gl,
-                      const StencilAttachmentDescriptor& stencil,
-                      uint32_t stencil_reference) {
-  gl.StencilOpSeparate(
-      face,                                    // face
-      ToStencilOp(stencil.stencil_failure),    // stencil fail
-      ToStencilOp(stencil.depth_failure),      // depth fail
-      ToStencilOp(stencil.depth_stencil_pass)  // depth stencil pass
-  );
-  gl.StencilFuncSeparate(face,                                        // face
-                         ToCompareFunction(stencil.stencil_compare),  // func
-                         stencil_reference,                           // ref
-                         stencil.read_mask                            // mask
-  );
-  gl.StencilMaskSeparate(face, stencil.write_mask);
-}
-
-void ConfigureStencil(const ProcTableGLES& gl,
-                      const PipelineDescriptor& pipeline,
-                      uint32_t stencil_reference) {
-  if (!pipeline.HasStencilAttachmentDescriptors()) {
-    gl.Disable(GL_STENCIL_TEST);
-    return;
-  }
-
-  gl.Enable(GL_STENCIL_TEST);
-  const auto& front = pipeline.GetFrontStencilAttachmentDescriptor();
-  const auto& back = pipeline.GetBackStencilAttachmentDescriptor();
-
-  if (front.has_value() && back.has_value() && front == back) {
-    ConfigureStencil(GL_FRONT_AND_BACK, gl, *front, stencil_reference);
-    return;
-  }
-  if (front.has_value()) {
-    ConfigureStencil(GL_FRONT, gl, *front, stencil_reference);
-  }
-  if (back.has_value()) {
-    ConfigureStencil(GL_BACK, gl, *back, stencil_reference);
-  }
-}
-
 //------------------------------------------------------------------------------
 /// @brief      Encapsulates data that will be needed in the reactor for the
 ///             encoding of commands for this render pass.
@@ -322,9 +248,7 @@ void RenderPassGLES::ResetGLState(const ProcTableGLES& gl) {
     }
   }
 
-  CullMode current_cull_mode = CullMode::kNone;
-  WindingOrder current_winding_order = WindingOrder::kClockwise;
-  gl.FrontFace(GL_CW);
+  GLStateCacheGLES state_cache;
 
   for (const auto& command : commands) {
 #ifdef IMPELLER_DEBUG
@@ -350,25 +274,19 @@ void RenderPassGLES::ResetGLState(const ProcTableGLES& gl) {
     //--------------------------------------------------------------------------
     /// Configure blending.
     ///
-    ConfigureBlending(gl, color_attachment);
+    state_cache.SetBlending(gl, *color_attachment);
 
     //--------------------------------------------------------------------------
     /// Setup stencil.
     ///
-    ConfigureStencil(gl, pipeline.GetDescriptor(), command.stencil_reference);
+    state_cache.SetStencil(gl, pipeline.GetDescriptor(),
+                           command.stencil_reference);
 
     //--------------------------------------------------------------------------
     /// Configure depth.
     ///
-    if (auto depth =
-            pipeline.GetDescriptor().GetDepthStencilAttachmentDescriptor();
-        depth.has_value()) {
-      gl.Enable(GL_DEPTH_TEST);
-      gl.DepthFunc(ToCompareFunction(depth->depth_compare));
-      gl.DepthMask(depth->depth_write_enabled ? GL_TRUE : GL_FALSE);
-    } else {
-      gl.Disable(GL_DEPTH_TEST);
-    }
+    state_cache.SetDepth(
+        gl, pipeline.GetDescriptor().GetDepthStencilAttachmentDescriptor());
 
     //--------------------------------------------------------------------------
     /// Setup the viewport.
@@ -396,52 +314,22 @@ void RenderPassGLES::ResetGLState(const ProcTableGLES& gl) {
     ///
     if (command.scissor.has_value()) {
       const auto& scissor = command.scissor.value();
-      gl.Enable(GL_SCISSOR_TEST);
-      gl.Scissor(
-          scissor.GetX(),                                             // x
-          target_size.height - scissor.GetY() - scissor.GetHeight(),  // y
-          scissor.GetWidth(),                                         // width
-          scissor.GetHeight()                                         // height
-      );
+      state_cache.SetScissor(
+          gl, IRect32::MakeXYWH(scissor.GetX(),
+                                target_size.height - scissor.GetY() -
+                                    scissor.GetHeight(),
+                                scissor.GetWidth(), scissor.GetHeight()));
     }
 
     //--------------------------------------------------------------------------
     /// Setup culling.
     ///
-    CullMode pipeline_cull_mode = pipeline.GetDescriptor().GetCullMode();
-    if (current_cull_mode != pipeline_cull_mode) {
-      switch (pipeline_cull_mode) {
-        case CullMode::kNone:
-          gl.Disable(GL_CULL_FACE);
-          break;
-        case CullMode::kFrontFace:
-          gl.Enable(GL_CULL_FACE);
-          gl.CullFace(GL_FRONT);
-          break;
-        case CullMode::kBackFace:
-          gl.Enable(GL_CULL_FACE);
-          gl.CullFace(GL_BACK);
-          break;
-      }
-      current_cull_mode = pipeline_cull_mode;
-    }
+    state_cache.SetCullMode(gl, pipeline.GetDescriptor().GetCullMode());
 
     //--------------------------------------------------------------------------
     /// Setup winding order.
     ///
-    WindingOrder pipeline_winding_order =
-        pipeline.GetDescriptor().GetWindingOrder();
-    if (current_winding_order != pipeline_winding_order) {
-      switch (pipeline.GetDescriptor().GetWindingOrder()) {
-        case WindingOrder::kClockwise:
-          gl.FrontFace(GL_CW);
-          break;
-        case WindingOrder::kCounterClockwise:
-          gl.FrontFace(GL_CCW);
-          break;
-      }
-      current_winding_order = pipeline_winding_order;
-    }
+    state_cache.SetWindingOrder(gl, pipeline.GetDescriptor().GetWindingOrder());
 
     BufferBindingsGLES* vertex_desc_gles = pipeline.GetBufferBindings();
 
@@ -463,7 +351,7 @@ void RenderPassGLES::ResetGLState(const ProcTableGLES& gl) {
     //--------------------------------------------------------------------------
     /// Bind the pipeline program.
     ///
-    if (!pipeline.BindProgram()) {
+    if (!state_cache.BindProgram(pipeline)) {
       return false;
     }
 
@@ -62,6 +62,22 @@ TEST(CapabilitiesGLES, SupportsFramebufferFetch) {
   EXPECT_TRUE(capabilities->SupportsFramebufferFetch());
 }
 
+TEST(CapabilitiesGLES, SupportsParallelShaderCompile) {
+  {
+    auto mock_gles = MockGLES::Init();
+    auto capabilities = mock_gles->GetProcTable().GetCapabilities();
+    EXPECT_FALSE(capabilities->SupportsParallelShaderCompile());
+  }
+  {
+    auto const extensions = std::vector<const char*>{
+        "GL_KHR_parallel_shader_compile",
+    };
+    auto mock_gles = MockGLES::Init(extensions);
+    auto capabilities = mock_gles->GetProcTable().GetCapabilities();
+    EXPECT_TRUE(capabilities->SupportsParallelShaderCompile());
+  }
+}
+
 TEST(CapabilitiesGLES, SupportsMSAA) {
   auto const extensions = std::vector<const char*>{
       "GL_EXT_multisampled_render_to_texture",
@@ -70,6 +70,8 @@ class IMockGLESImpl {
                                      GLsizei numAttachments,
                                      const GLenum* attachments) {};
   virtual void GetIntegerv(GLenum name, GLint* attachments) {};
+  virtual void Enable(GLenum cap) {}
+  virtual void Disable(GLenum cap) {}
 };
 
 class MockGLESImpl : public IMockGLESImpl {
@@ -160,6 +162,8 @@ class MockGLESImpl : public IMockGLESImpl {
                const GLenum* attachments),
               (override));
   MOCK_METHOD(void, GetIntegerv, (GLenum name, GLint* value), (override));
+  MOCK_METHOD(void, Enable, (GLenum cap), (override));
+  MOCK_METHOD(void, Disable, (GLenum cap), (override));
 };
 
 /// @brief      Provides a mocked version of the |ProcTableGLES| class.
@@ -0,0 +1,73 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstring>
+#include <string>
+
+#include "flutter/fml/file.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/testing/testing.h"
+#include "impeller/renderer/backend/gles/program_binary_gles.h"
+
+namespace impeller::testing {
+
+TEST(ProgramBinaryGLESTest, CanTestHeaderCompatibility) {
+  {
+    ProgramBinaryHeaderGLES a(1u, 2u, 3u, 4u);
+    ProgramBinaryHeaderGLES b(1u, 2u, 5u, 6u);
+    // The format and data size don't matter.
+    EXPECT_TRUE(a.IsCompatibleWith(b));
+  }
+  {
+    ProgramBinaryHeaderGLES a(1u, 2u, 3u, 4u);
+    ProgramBinaryHeaderGLES b(7u, 2u, 3u, 4u);
+    EXPECT_FALSE(a.IsCompatibleWith(b));
+  }
+  {
+    ProgramBinaryHeaderGLES a(1u, 2u, 3u, 4u);
+    ProgramBinaryHeaderGLES b(1u, 7u, 3u, 4u);
+    EXPECT_FALSE(a.IsCompatibleWith(b));
+  }
+  {
+    ProgramBinaryHeaderGLES a(1u, 2u, 3u, 4u);
+    ProgramBinaryHeaderGLES b(1u, 2u, 3u, 4u);
+    b.magic = 100;
+    EXPECT_FALSE(a.IsCompatibleWith(b));
+  }
+}
+
+TEST(ProgramBinaryGLESTest, CanPersistAndRetrieveBinaries) {
+  fml::ScopedTemporaryDirectory temp_dir;
+  const std::string binary = "linked program";
+  fml::NonOwnedMapping mapping(
+      reinterpret_cast<const uint8_t*>(binary.data()), binary.size());
+  ASSERT_TRUE(ProgramBinaryPersist(
+      temp_dir.fd(), ProgramBinaryHeaderGLES{1u, 2u, 42u, binary.size()},
+      mapping));
+
+  uint32_t format = 0;
+  auto retrieved = ProgramBinaryRetrieve(temp_dir.fd(), 1u, 2u, &format);
+  ASSERT_NE(retrieved, nullptr);
+  EXPECT_EQ(format, 42u);
+  ASSERT_EQ(retrieved->GetSize(), binary.size());
+  EXPECT_EQ(std::memcmp(retrieved->GetMapping(), binary.data(), binary.size()),
+            0);
+
+  // Binaries of other drivers or programs are not retrieved.
+  EXPECT_EQ(ProgramBinaryRetrieve(temp_dir.fd(), 3u, 2u, &format), nullptr);
+  EXPECT_EQ(ProgramBinaryRetrieve(temp_dir.fd(), 1u, 3u, &format), nullptr);
+}
+
+TEST(ProgramBinaryGLESTest, RejectsMismatchedSizes) {
+  fml::ScopedTemporaryDirectory temp_dir;
+  const std::string binary = "linked program";
+  fml::NonOwnedMapping mapping(
+      reinterpret_cast<const uint8_t*>(binary.data()), binary.size());
+  EXPECT_FALSE(ProgramBinaryPersist(
+      temp_dir.fd(), ProgramBinaryHeaderGLES{1u, 2u, 42u, binary.size() + 1},
+      mapping));
+  EXPECT_EQ(ProgramBinaryRetrieve(temp_dir.fd(), 1u, 2u, nullptr), nullptr);
+}
+
+}  // namespace impeller::testing
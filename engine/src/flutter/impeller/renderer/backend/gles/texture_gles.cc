@@ -41,6 +41,9 @@ static bool IsDepthStencilFormat(PixelFormat format) {
     case PixelFormat::kB10G10R10XRSRGB:
     case PixelFormat::kB10G10R10A10XR:
     case PixelFormat::kR32Float:
+    case PixelFormat::kETC2R8G8B8A8UNormInt:
+    case PixelFormat::kASTC4x4UNormInt:
+    case PixelFormat::kBC7UNormInt:
       return false;
   }
   FML_UNREACHABLE();
@@ -120,6 +123,9 @@ struct TexImage2DData {
       case PixelFormat::kB10G10R10XRSRGB:
       case PixelFormat::kB10G10R10XR:
       case PixelFormat::kB10G10R10A10XR:
+      case PixelFormat::kETC2R8G8B8A8UNormInt:
+      case PixelFormat::kASTC4x4UNormInt:
+      case PixelFormat::kBC7UNormInt:
         return;
     }
     is_valid_ = true;
@@ -408,6 +414,9 @@ static std::optional<GLenum> ToRenderBufferFormat(PixelFormat format) {
     case PixelFormat::kB10G10R10XR:
     case PixelFormat::kB10G10R10A10XR:
     case PixelFormat::kR32Float:
+    case PixelFormat::kETC2R8G8B8A8UNormInt:
+    case PixelFormat::kASTC4x4UNormInt:
+    case PixelFormat::kBC7UNormInt:
       return std::nullopt;
   }
   FML_UNREACHABLE();
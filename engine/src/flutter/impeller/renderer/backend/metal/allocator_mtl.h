@@ -44,6 +44,9 @@ class AllocatorMTL final : public Allocator {
   // |Allocator|
   Bytes DebugGetHeapUsage() const override;
 
+  // |Allocator|
+  std::optional<Bytes> GetAllocatedBytes() const override;
+
   // visible for testing.
   void DebugSetSupportsUMA(bool value);
 
@@ -222,6 +222,13 @@ Bytes AllocatorMTL::DebugGetHeapUsage() const {
 #endif  // IMPELLER_DEBUG
 }
 
+std::optional<Bytes> AllocatorMTL::GetAllocatedBytes() const {
+  if (!device_) {
+    return std::nullopt;
+  }
+  return Bytes{static_cast<double>(device_.currentAllocatedSize)};
+}
+
 void AllocatorMTL::DebugTraceMemoryStatistics() const {
 #ifdef IMPELLER_DEBUG
   FML_TRACE_COUNTER("flutter", "AllocatorMTL",
@@ -46,6 +46,24 @@ static bool DeviceSupportsExtendedRangeFormats(id<MTLDevice> device) {
   return [device supportsFamily:MTLGPUFamilyApple3];
 }
 
+// See "Texture capabilities" in the metal feature set tables. ETC2 and ASTC
+// are supported by every Apple GPU, BC by the Mac GPUs and some recent Apple
+// GPUs.
+static std::vector<PixelFormat> DeviceSupportedCompressedFormats(
+    id<MTLDevice> device) {
+  std::vector<PixelFormat> formats;
+  if ([device supportsFamily:MTLGPUFamilyApple2]) {
+    formats.push_back(PixelFormat::kETC2R8G8B8A8UNormInt);
+    formats.push_back(PixelFormat::kASTC4x4UNormInt);
+  }
+  if (@available(iOS 16.4, macOS 11.0, *)) {
+    if (device.supportsBCTextureCompression) {
+      formats.push_back(PixelFormat::kBC7UNormInt);
+    }
+  }
+  return formats;
+}
+
 static std::unique_ptr<Capabilities> InferMetalCapabilities(
     id<MTLDevice> device,
     PixelFormat color_format) {
@@ -64,9 +82,11 @@ static std::unique_ptr<Capabilities> InferMetalCapabilities(
       .SetSupportsDeviceTransientTextures(true)
       .SetDefaultGlyphAtlasFormat(PixelFormat::kA8UNormInt)
       .SetSupportsTriangleFan(false)
+      .SetSupportsIndirectDraw(true)
       .SetMaximumRenderPassAttachmentSize(DeviceMaxTextureSizeSupported(device))
       .SetSupportsExtendedRangeFormats(
           DeviceSupportsExtendedRangeFormats(device))
+      .SetSupportedCompressedFormats(DeviceSupportedCompressedFormats(device))
 #if FML_OS_IOS && !TARGET_OS_SIMULATOR
       .SetMinimumUniformAlignment(16)
 #else
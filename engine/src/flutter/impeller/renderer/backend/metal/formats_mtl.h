@@ -73,6 +73,20 @@ MTLPixelFormat SafeMTLPixelFormatBGR10_XR();
 /// Returns PixelFormat::kUnknown if MTLPixelFormatBGR10_XR isn't supported.
 MTLPixelFormat SafeMTLPixelFormatBGRA10_XR();
 
+/// Safe accessor for MTLPixelFormatEAC_RGBA8.
+/// Returns MTLPixelFormatInvalid if MTLPixelFormatEAC_RGBA8 isn't supported.
+MTLPixelFormat SafeMTLPixelFormatEAC_RGBA8();
+
+/// Safe accessor for MTLPixelFormatASTC_4x4_LDR.
+/// Returns MTLPixelFormatInvalid if MTLPixelFormatASTC_4x4_LDR isn't
+/// supported.
+MTLPixelFormat SafeMTLPixelFormatASTC_4x4_LDR();
+
+/// Safe accessor for MTLPixelFormatBC7_RGBAUnorm.
+/// Returns MTLPixelFormatInvalid if MTLPixelFormatBC7_RGBAUnorm isn't
+/// supported.
+MTLPixelFormat SafeMTLPixelFormatBC7_RGBAUnorm();
+
 constexpr MTLPixelFormat ToMTLPixelFormat(PixelFormat format) {
   switch (format) {
     case PixelFormat::kUnknown:
@@ -109,6 +123,12 @@ constexpr MTLPixelFormat ToMTLPixelFormat(PixelFormat format) {
       return SafeMTLPixelFormatBGRA10_XR();
     case PixelFormat::kR32Float:
       return MTLPixelFormatR32Float;
+    case PixelFormat::kETC2R8G8B8A8UNormInt:
+      return SafeMTLPixelFormatEAC_RGBA8();
+    case PixelFormat::kASTC4x4UNormInt:
+      return SafeMTLPixelFormatASTC_4x4_LDR();
+    case PixelFormat::kBC7UNormInt:
+      return SafeMTLPixelFormatBC7_RGBAUnorm();
   }
   return MTLPixelFormatInvalid;
 };
@@ -7,6 +7,8 @@
 
 #include <Metal/Metal.h>
 
+#include <array>
+
 #include "impeller/renderer/render_pass.h"
 #include "impeller/renderer/render_target.h"
 
@@ -82,20 +84,34 @@ struct PassBindingsCacheMTL {
   void SetStencilRef(uint32_t stencil_ref);
 
  private:
+  // The smallest per-stage argument table sizes across the supported GPU
+  // families. Bindings past these indices are still set on the encoder, just
+  // never elided.
+  static constexpr size_t kMaxBufferBindings = 31u;
+  static constexpr size_t kMaxTextureBindings = 31u;
+  static constexpr size_t kMaxSamplerBindings = 16u;
+
   struct BufferOffsetPair {
     id<MTLBuffer> buffer = nullptr;
     size_t offset = 0u;
   };
-  using BufferMap = std::map<uint64_t, BufferOffsetPair>;
-  using TextureMap = std::map<uint64_t, id<MTLTexture>>;
-  using SamplerMap = std::map<uint64_t, id<MTLSamplerState>>;
+
+  /// The bindings of a single shader stage. These are looked up for every
+  /// bound resource of every draw, so they are kept in flat arrays indexed by
+  /// the binding instead of in maps.
+  struct StageBindings {
+    std::array<BufferOffsetPair, kMaxBufferBindings> buffers = {};
+    std::array<id<MTLTexture>, kMaxTextureBindings> textures = {};
+    std::array<id<MTLSamplerState>, kMaxSamplerBindings> samplers = {};
+  };
+
+  StageBindings* GetStageBindings(ShaderStage stage);
 
   id<MTLRenderCommandEncoder> encoder_;
   id<MTLRenderPipelineState> pipeline_ = nullptr;
   id<MTLDepthStencilState> depth_stencil_ = nullptr;
-  std::map<ShaderStage, BufferMap> buffers_;
-  std::map<ShaderStage, TextureMap> textures_;
-  std::map<ShaderStage, SamplerMap> samplers_;
+  StageBindings vertex_bindings_;
+  StageBindings fragment_bindings_;
   std::optional<Viewport> viewport_;
   std::optional<IRect32> scissor_;
   std::optional<uint32_t> stencil_ref_;
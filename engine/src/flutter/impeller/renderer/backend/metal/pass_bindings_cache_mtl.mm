@@ -28,21 +28,35 @@ void PassBindingsCacheMTL::SetDepthStencilState(
   [encoder_ setDepthStencilState:depth_stencil_];
 }
 
+PassBindingsCacheMTL::StageBindings* PassBindingsCacheMTL::GetStageBindings(
+    ShaderStage stage) {
+  switch (stage) {
+    case ShaderStage::kVertex:
+      return &vertex_bindings_;
+    case ShaderStage::kFragment:
+      return &fragment_bindings_;
+    default:
+      return nullptr;
+  }
+}
+
 bool PassBindingsCacheMTL::SetBuffer(ShaderStage stage,
                                      uint64_t index,
                                      uint64_t offset,
                                      id<MTLBuffer> buffer) {
-  auto& buffers_map = buffers_[stage];
-  auto found = buffers_map.find(index);
-  if (found != buffers_map.end() && found->second.buffer == buffer) {
+  StageBindings* bindings = GetStageBindings(stage);
+  BufferOffsetPair* bound = (bindings && index < kMaxBufferBindings)
+                                ? &bindings->buffers[index]
+                                : nullptr;
+  if (bound && bound->buffer == buffer) {
     // The right buffer is bound. Check if its offset needs to be updated.
-    if (found->second.offset == offset) {
+    if (bound->offset == offset) {
       // Buffer and its offset is identical. Nothing to do.
       return true;
     }
 
     // Only the offset needs to be updated.
-    found->second.offset = offset;
+    bound->offset = offset;
 
     switch (stage) {
       case ShaderStage::kVertex:
@@ -57,7 +71,9 @@ bool PassBindingsCacheMTL::SetBuffer(ShaderStage stage,
     }
     return true;
   }
-  buffers_map[index] = {buffer, static_cast<size_t>(offset)};
+  if (bound) {
+    *bound = {buffer, static_cast<size_t>(offset)};
+  }
   switch (stage) {
     case ShaderStage::kVertex:
       [encoder_ setVertexBuffer:buffer offset:offset atIndex:index];
@@ -75,13 +91,14 @@ bool PassBindingsCacheMTL::SetBuffer(ShaderStage stage,
 bool PassBindingsCacheMTL::SetTexture(ShaderStage stage,
                                       uint64_t index,
                                       id<MTLTexture> texture) {
-  auto& texture_map = textures_[stage];
-  auto found = texture_map.find(index);
-  if (found != texture_map.end() && found->second == texture) {
-    // Already bound.
-    return true;
+  StageBindings* bindings = GetStageBindings(stage);
+  if (bindings && index < kMaxTextureBindings) {
+    if (bindings->textures[index] == texture) {
+      // Already bound.
+      return true;
+    }
+    bindings->textures[index] = texture;
   }
-  texture_map[index] = texture;
   switch (stage) {
     case ShaderStage::kVertex:
       [encoder_ setVertexTexture:texture atIndex:index];
@@ -99,13 +116,14 @@ bool PassBindingsCacheMTL::SetTexture(ShaderStage stage,
 bool PassBindingsCacheMTL::SetSampler(ShaderStage stage,
                                       uint64_t index,
                                       id<MTLSamplerState> sampler) {
-  auto& sampler_map = samplers_[stage];
-  auto found = sampler_map.find(index);
-  if (found != sampler_map.end() && found->second == sampler) {
-    // Already bound.
-    return true;
+  StageBindings* bindings = GetStageBindings(stage);
+  if (bindings && index < kMaxSamplerBindings) {
+    if (bindings->samplers[index] == sampler) {
+      // Already bound.
+      return true;
+    }
+    bindings->samplers[index] = sampler;
   }
-  sampler_map[index] = sampler;
   switch (stage) {
     case ShaderStage::kVertex:
       [encoder_ setVertexSamplerState:sampler atIndex:index];
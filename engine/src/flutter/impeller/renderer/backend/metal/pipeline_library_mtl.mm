@@ -9,6 +9,7 @@
 
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/container.h"
+#include "flutter/fml/time/time_point.h"
 #include "impeller/base/promise.h"
 #include "impeller/renderer/backend/metal/compute_pipeline_mtl.h"
 #include "impeller/renderer/backend/metal/formats_mtl.h"
@@ -151,6 +152,7 @@ PipelineFuture<PipelineDescriptor> PipelineLibraryMTL::GetPipeline(
       [NSThread isMainThread] ? "main"
                               : [[[NSThread currentThread] name] UTF8String];
 #endif
+  const fml::TimePoint compile_start = fml::TimePoint::Now();
   auto completion_handler = ^(
       id<MTLRenderPipelineState> _Nullable render_pipeline_state,
       NSError* _Nullable error) {
@@ -169,6 +171,7 @@ PipelineFuture<PipelineDescriptor> PipelineLibraryMTL::GetPipeline(
       promise->set_value(nullptr);
       return;
     }
+    strong_this->LogPipelineCompile(fml::TimePoint::Now() - compile_start);
 
     auto new_pipeline = std::shared_ptr<PipelineMTL>(new PipelineMTL(
         weak_this,
@@ -91,6 +91,14 @@ class RenderPassMTL final : public RenderPass {
   // |RenderPass|
   fml::Status Draw() override;
 
+  // |RenderPass|
+  fml::Status DrawIndirect(BufferView indirect_buffer,
+                           uint32_t draw_count,
+                           uint32_t stride) override;
+
+  /// Clears the pending command state after a draw has been recorded.
+  void ResetCommandState();
+
   // |RenderPass|
   bool BindResource(ShaderStage stage,
                     DescriptorType type,
@@ -367,6 +367,53 @@ fml::Status RenderPassMTL::Draw() {
     }
   }
 
+  ResetCommandState();
+  return fml::Status();
+}
+
+// |RenderPass|
+fml::Status RenderPassMTL::DrawIndirect(BufferView indirect_buffer,
+                                        uint32_t draw_count,
+                                        uint32_t stride) {
+  if (!has_valid_pipeline_) {
+    return fml::Status(fml::StatusCode::kCancelled, "Invalid pipeline.");
+  }
+  if (!ValidateIndirectBuffer(indirect_buffer, draw_count, stride,
+                              !!index_buffer_)) {
+    return fml::Status(fml::StatusCode::kInvalidArgument,
+                       "Invalid indirect draw arguments.");
+  }
+
+  id<MTLBuffer> mtl_indirect_buffer =
+      DeviceBufferMTL::Cast(*indirect_buffer.GetBuffer()).GetMTLBuffer();
+  const size_t indirect_offset = indirect_buffer.GetRange().offset;
+
+  // Metal has no multi-draw variant of the indirect draw calls outside of
+  // indirect command buffers, so each draw is issued on its own.
+  if (!index_buffer_) {
+    for (uint32_t i = 0u; i < draw_count; i++) {
+      [encoder_ drawPrimitives:ToMTLPrimitiveType(primitive_type_)
+                indirectBuffer:mtl_indirect_buffer
+          indirectBufferOffset:indirect_offset + i * stride];
+    }
+  } else {
+    id<MTLBuffer> mtl_index_buffer =
+        DeviceBufferMTL::Cast(*index_buffer_.GetBuffer()).GetMTLBuffer();
+    for (uint32_t i = 0u; i < draw_count; i++) {
+      [encoder_ drawIndexedPrimitives:ToMTLPrimitiveType(primitive_type_)
+                            indexType:index_type_
+                          indexBuffer:mtl_index_buffer
+                    indexBufferOffset:index_buffer_.GetRange().offset
+                       indirectBuffer:mtl_indirect_buffer
+                 indirectBufferOffset:indirect_offset + i * stride];
+    }
+  }
+
+  ResetCommandState();
+  return fml::Status();
+}
+
+void RenderPassMTL::ResetCommandState() {
 #ifdef IMPELLER_DEBUG
   if (has_label_) {
     [encoder_ popDebugGroup];
@@ -379,8 +426,6 @@ fml::Status RenderPassMTL::Draw() {
   index_buffer_ = {};
   has_valid_pipeline_ = false;
   has_label_ = false;
-
-  return fml::Status();
 }
 
 // |RenderPass|
@@ -37,6 +37,13 @@ class ShaderLibraryMTL final : public ShaderLibrary {
   NSMutableArray<id<MTLLibrary>>* libraries_ IPLR_GUARDED_BY(libraries_mutex_) =
       nullptr;
   ShaderFunctionMap functions_;
+  // Libraries compiled from runtime stage sources, keyed by the source. A
+  // stage that is registered again with the same source, for example by a
+  // second FragmentProgram loaded from the same asset, reuses the library
+  // instead of compiling it again.
+  Mutex compiled_sources_mutex_;
+  std::unordered_map<std::string, id<MTLLibrary>> compiled_sources_
+      IPLR_GUARDED_BY(compiled_sources_mutex_);
   bool is_valid_ = false;
 
   explicit ShaderLibraryMTL(NSArray<id<MTLLibrary>>* libraries);
@@ -58,6 +65,10 @@ class ShaderLibraryMTL final : public ShaderLibrary {
 
   void RegisterLibrary(id<MTLLibrary> library);
 
+  id<MTLLibrary> FindCompiledSource(const std::string& source);
+
+  void CacheCompiledSource(std::string source, id<MTLLibrary> library);
+
   ShaderLibraryMTL(const ShaderLibraryMTL&) = delete;
 
   ShaderLibraryMTL& operator=(const ShaderLibraryMTL&) = delete;
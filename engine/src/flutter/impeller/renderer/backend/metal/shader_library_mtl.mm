@@ -4,12 +4,27 @@
 
 #include "impeller/renderer/backend/metal/shader_library_mtl.h"
 
+#include <cstring>
+
 #include "flutter/fml/closure.h"
 #include "impeller/base/validation.h"
 #include "impeller/renderer/backend/metal/shader_function_mtl.h"
 
 namespace impeller {
 
+// Runtime stages normally carry MSL source, but a stage may instead carry a
+// library precompiled by the Metal toolchain, which starts with this magic.
+static constexpr char kMetalLibraryMagic[] = {'M', 'T', 'L', 'B'};
+
+// The number of compiled runtime stage libraries kept for reuse.
+static constexpr size_t kMaxCompiledSources = 32u;
+
+static bool IsMetalLibrary(const fml::Mapping& code) {
+  return code.GetSize() >= sizeof(kMetalLibraryMagic) &&
+         ::memcmp(code.GetMapping(), kMetalLibraryMagic,
+                  sizeof(kMetalLibraryMagic)) == 0;
+}
+
 ShaderLibraryMTL::ShaderLibraryMTL(NSArray<id<MTLLibrary>>* libraries)
     : libraries_([libraries mutableCopy]) {
   if (libraries_ == nil || libraries_.count == 0) {
@@ -117,11 +132,47 @@ void ShaderLibraryMTL::RegisterFunction(std::string name,   // unused
     return;
   }
 
+  // Precompiled libraries only need to be loaded.
+  if (IsMetalLibrary(*code)) {
+    __block auto data = code;
+    auto dispatch_data =
+        ::dispatch_data_create(code->GetMapping(),        // buffer
+                               code->GetSize(),           // size
+                               dispatch_get_main_queue(),  // queue
+                               ^() {
+                                 // We just need a reference.
+                                 data.reset();
+                               }  // destructor
+        );
+    NSError* error = nil;
+    id<MTLLibrary> library = [device newLibraryWithData:dispatch_data
+                                                  error:&error];
+    if (!library) {
+      VALIDATION_LOG << "Could not load precompiled dynamic stage library: "
+                     << error.localizedDescription.UTF8String;
+      return;
+    }
+    RegisterLibrary(library);
+    failure_callback->Release();
+    callback(true);
+    return;
+  }
+
+  std::string source_key(reinterpret_cast<const char*>(code->GetMapping()),
+                         code->GetSize());
+  if (id<MTLLibrary> library = FindCompiledSource(source_key)) {
+    RegisterLibrary(library);
+    failure_callback->Release();
+    callback(true);
+    return;
+  }
+
   auto source = [[NSString alloc] initWithBytes:code->GetMapping()
                                          length:code->GetSize()
                                        encoding:NSUTF8StringEncoding];
 
   auto weak_this = weak_from_this();
+  auto shared_source_key = std::make_shared<std::string>(std::move(source_key));
   [device newLibraryWithSource:source
                        options:NULL
              completionHandler:^(id<MTLLibrary> library, NSError* error) {
@@ -136,8 +187,11 @@ void ShaderLibraryMTL::RegisterFunction(std::string name,   // unused
                                 << error.localizedDescription.UTF8String;
                  return;
                }
-               reinterpret_cast<ShaderLibraryMTL*>(strong_this.get())
-                   ->RegisterLibrary(library);
+               auto library_mtl =
+                   reinterpret_cast<ShaderLibraryMTL*>(strong_this.get());
+               library_mtl->CacheCompiledSource(std::move(*shared_source_key),
+                                                library);
+               library_mtl->RegisterLibrary(library);
                failure_callback->Release();
                callback(true);
              }];
@@ -183,4 +237,19 @@ void ShaderLibraryMTL::RegisterLibrary(id<MTLLibrary> library) {
   [libraries_ addObject:library];
 }
 
+id<MTLLibrary> ShaderLibraryMTL::FindCompiledSource(const std::string& source) {
+  Lock lock(compiled_sources_mutex_);
+  auto found = compiled_sources_.find(source);
+  return found == compiled_sources_.end() ? nil : found->second;
+}
+
+void ShaderLibraryMTL::CacheCompiledSource(std::string source,
+                                           id<MTLLibrary> library) {
+  Lock lock(compiled_sources_mutex_);
+  if (compiled_sources_.size() >= kMaxCompiledSources) {
+    compiled_sources_.clear();
+  }
+  compiled_sources_[std::move(source)] = library;
+}
+
 }  // namespace impeller
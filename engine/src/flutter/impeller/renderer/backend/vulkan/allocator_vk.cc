@@ -18,6 +18,11 @@
 #include "impeller/renderer/backend/vulkan/texture_vk.h"
 #include "vulkan/vulkan_enums.hpp"
 
+#ifdef FML_OS_ANDROID
+#include "impeller/renderer/backend/vulkan/android/ahb_texture_source_vk.h"
+#include "impeller/toolkit/android/hardware_buffer.h"
+#endif  // FML_OS_ANDROID
+
 namespace impeller {
 
 static constexpr vk::Flags<vk::MemoryPropertyFlagBits>
@@ -62,6 +67,7 @@ static PoolVMA CreateBufferPool(VmaAllocator allocator) {
                       vk::BufferUsageFlagBits::eIndexBuffer |
                       vk::BufferUsageFlagBits::eUniformBuffer |
                       vk::BufferUsageFlagBits::eStorageBuffer |
+                      vk::BufferUsageFlagBits::eIndirectBuffer |
                       vk::BufferUsageFlagBits::eTransferSrc |
                       vk::BufferUsageFlagBits::eTransferDst;
   buffer_info.size = 1u;  // doesn't matter
@@ -494,6 +500,69 @@ std::shared_ptr<Texture> AllocatorVK::OnCreateTexture(
   return std::make_shared<TextureVK>(context_, std::move(source));
 }
 
+// |Allocator|
+std::optional<HostMappedTexture> AllocatorVK::OnCreateHostMappedTexture(
+    const TextureDescriptor& desc) {
+#ifdef FML_OS_ANDROID
+  // Hardware buffers are the only way to share image memory between the host
+  // and the GPU without a copy, and only RGBA8888 buffers are supported.
+  if (!IsValid() || desc.format != PixelFormat::kR8G8B8A8UNormInt ||
+      !android::HardwareBuffer::IsAvailableOnPlatform()) {
+    return std::nullopt;
+  }
+  auto context = context_.lock();
+  if (!context) {
+    return std::nullopt;
+  }
+
+  android::HardwareBufferDescriptor ahb_desc;
+  ahb_desc.format = android::HardwareBufferFormat::kR8G8B8A8UNormInt;
+  ahb_desc.size = desc.size;
+  ahb_desc.usage = android::HardwareBufferUsageFlags::kSampledImage |
+                   android::HardwareBufferUsageFlags::kCPUWriteOften;
+  if (!ahb_desc.IsAllocatable()) {
+    return std::nullopt;
+  }
+  auto ahb = std::make_unique<android::HardwareBuffer>(ahb_desc);
+  if (!ahb->IsValid()) {
+    return std::nullopt;
+  }
+  // The stride is only known once the buffer has been allocated.
+  std::optional<AHardwareBuffer_Desc> allocated_desc =
+      android::HardwareBuffer::Describe(ahb->GetHandle());
+  if (!allocated_desc.has_value()) {
+    return std::nullopt;
+  }
+  const size_t bytes_per_row =
+      allocated_desc->stride * BytesPerPixelForPixelFormat(desc.format);
+
+  auto source = std::make_shared<AHBTextureSourceVK>(
+      context, std::move(ahb), /*is_swapchain_image=*/false);
+  if (!source->IsValid()) {
+    return std::nullopt;
+  }
+  const android::HardwareBuffer* backing_store = source->GetBackingStore();
+  auto contents = reinterpret_cast<uint8_t*>(
+      backing_store->Lock(android::HardwareBuffer::CPUAccessType::kWrite));
+  if (!contents) {
+    return std::nullopt;
+  }
+
+  auto texture = std::make_shared<TextureVK>(context_, std::move(source));
+  // The image is moved to shader read layout by whoever first uses it, on a
+  // thread that may submit GPU work.
+  auto unmap = [backing_store]() -> bool { return backing_store->Unlock(); };
+  return HostMappedTexture{
+      .texture = std::move(texture),
+      .contents = contents,
+      .bytes_per_row = bytes_per_row,
+      .unmap = std::move(unmap),
+  };
+#else
+  return std::nullopt;
+#endif  // FML_OS_ANDROID
+}
+
 // |Allocator|
 std::shared_ptr<DeviceBuffer> AllocatorVK::OnCreateBuffer(
     const DeviceBufferDescriptor& desc) {
@@ -502,6 +571,7 @@ std::shared_ptr<DeviceBuffer> AllocatorVK::OnCreateBuffer(
                       vk::BufferUsageFlagBits::eIndexBuffer |
                       vk::BufferUsageFlagBits::eUniformBuffer |
                       vk::BufferUsageFlagBits::eStorageBuffer |
+                      vk::BufferUsageFlagBits::eIndirectBuffer |
                       vk::BufferUsageFlagBits::eTransferSrc |
                       vk::BufferUsageFlagBits::eTransferDst;
   buffer_info.size = desc.size;
@@ -562,6 +632,11 @@ Bytes AllocatorVK::DebugGetHeapUsage() const {
   return Bytes{static_cast<double>(total_usage)};
 }
 
+std::optional<Bytes> AllocatorVK::GetAllocatedBytes() const {
+  // The budgets of VMA are cheap to query and tracked in all builds.
+  return DebugGetHeapUsage();
+}
+
 void AllocatorVK::DebugTraceMemoryStatistics() const {
 #ifdef IMPELLER_DEBUG
   FML_TRACE_COUNTER("flutter", "AllocatorVK",
@@ -24,6 +24,9 @@ class AllocatorVK final : public Allocator {
   // |Allocator|
   Bytes DebugGetHeapUsage() const override;
 
+  // |Allocator|
+  std::optional<Bytes> GetAllocatedBytes() const override;
+
   /// @brief Select a matching memory type for the given
   ///        [memory_type_bits_requirement], or -1 if none is found.
   ///
@@ -71,6 +74,10 @@ class AllocatorVK final : public Allocator {
   std::shared_ptr<Texture> OnCreateTexture(const TextureDescriptor& desc,
                                            bool threadsafe) override;
 
+  // |Allocator|
+  std::optional<HostMappedTexture> OnCreateHostMappedTexture(
+      const TextureDescriptor& desc) override;
+
   // |Allocator|
   ISize GetMaxTextureSizeSupported() const override;
 
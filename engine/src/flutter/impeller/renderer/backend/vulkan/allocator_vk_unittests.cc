@@ -93,6 +93,21 @@ TEST(AllocatorVKTest, ImageResourceKeepsVulkanDeviceAlive) {
   ASSERT_TRUE(weak_allocator.lock());
 }
 
+TEST(AllocatorVKTest, AllocatedBytesAreAvailableInAllBuilds) {
+  auto const context = MockVulkanContextBuilder().Build();
+  auto allocator = context->GetResourceAllocator();
+
+  allocator->CreateBuffer(DeviceBufferDescriptor{
+      .storage_mode = StorageMode::kDevicePrivate,
+      .size = 1024,
+  });
+
+  std::optional<Bytes> allocated = allocator->GetAllocatedBytes();
+  ASSERT_TRUE(allocated.has_value());
+  EXPECT_EQ(allocated->GetByteSize(),
+            allocator->DebugGetHeapUsage().GetByteSize());
+}
+
 #ifdef IMPELLER_DEBUG
 
 TEST(AllocatorVKTest, RecreateSwapchainWhenSizeChanges) {
@@ -46,11 +46,19 @@ static void InsertImageMemoryBarrier(const vk::CommandBuffer& cmd,
 
 BlitPassVK::BlitPassVK(std::shared_ptr<CommandBufferVK> command_buffer,
                        const WorkaroundsVK& workarounds)
-    : command_buffer_(std::move(command_buffer)), workarounds_(workarounds) {}
+    : command_buffer_(std::move(command_buffer)), workarounds_(workarounds) {
+  command_buffer_->GetGPUProbe().RecordPassStart(
+      command_buffer_->GetCommandBuffer());
+}
 
 BlitPassVK::~BlitPassVK() = default;
 
-void BlitPassVK::OnSetLabel(std::string_view label) {}
+void BlitPassVK::OnSetLabel(std::string_view label) {
+  if (label.empty()) {
+    return;
+  }
+  label_ = std::string(label);
+}
 
 // |BlitPass|
 bool BlitPassVK::IsValid() const {
@@ -59,6 +67,8 @@ bool BlitPassVK::IsValid() const {
 
 // |BlitPass|
 bool BlitPassVK::EncodeCommands() const {
+  command_buffer_->GetGPUProbe().RecordPassEnd(
+      command_buffer_->GetCommandBuffer(), label_);
   return true;
 }
 
@@ -5,6 +5,8 @@
 #ifndef FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_BLIT_PASS_VK_H_
 #define FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_BLIT_PASS_VK_H_
 
+#include <string>
+
 #include "flutter/fml/macros.h"
 #include "impeller/base/config.h"
 #include "impeller/geometry/rect.h"
@@ -28,6 +30,7 @@ class BlitPassVK final : public BlitPass {
 
   std::shared_ptr<CommandBufferVK> command_buffer_;
   const WorkaroundsVK workarounds_;
+  std::string label_ = "BlitPass";
 
   explicit BlitPassVK(std::shared_ptr<CommandBufferVK> command_buffer,
                       const WorkaroundsVK& workarounds);
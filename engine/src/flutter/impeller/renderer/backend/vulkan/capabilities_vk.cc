@@ -9,6 +9,7 @@
 
 #include "impeller/base/validation.h"
 #include "impeller/core/formats.h"
+#include "impeller/renderer/backend/vulkan/formats_vk.h"
 #include "impeller/renderer/backend/vulkan/vk.h"
 #include "impeller/renderer/backend/vulkan/workarounds_vk.h"
 
@@ -225,6 +226,8 @@ static const char* GetExtensionName(OptionalDeviceExtensionVK ext) {
       return "VK_KHR_portability_subset";
     case OptionalDeviceExtensionVK::kEXTImageCompressionControl:
       return VK_EXT_IMAGE_COMPRESSION_CONTROL_EXTENSION_NAME;
+    case OptionalDeviceExtensionVK::kKHRTimelineSemaphore:
+      return VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME;
     case OptionalDeviceExtensionVK::kLast:
       return "Unknown";
   }
@@ -355,6 +358,16 @@ static bool HasSuitableDepthStencilFormat(const vk::PhysicalDevice& device,
             vk::FormatFeatureFlagBits::eDepthStencilAttachment);
 }
 
+static bool HasSuitableCompressedFormat(const vk::PhysicalDevice& device,
+                                        vk::Format format) {
+  const auto props = device.getFormatProperties(format);
+  const vk::FormatFeatureFlags required =
+      vk::FormatFeatureFlagBits::eSampledImage |
+      vk::FormatFeatureFlagBits::eSampledImageFilterLinear |
+      vk::FormatFeatureFlagBits::eTransferDst;
+  return (props.optimalTilingFeatures & required) == required;
+}
+
 static bool PhysicalDeviceSupportsRequiredFormats(
     const vk::PhysicalDevice& device) {
   const auto has_color_format =
@@ -430,6 +443,10 @@ CapabilitiesVK::GetEnabledDeviceFeatures(
     supported_chain
         .unlink<vk::PhysicalDeviceImageCompressionControlFeaturesEXT>();
   }
+  if (!IsExtensionInList(enabled_extensions.value(),
+                         OptionalDeviceExtensionVK::kKHRTimelineSemaphore)) {
+    supported_chain.unlink<vk::PhysicalDeviceTimelineSemaphoreFeaturesKHR>();
+  }
 
   device.getFeatures2(&supported_chain.get());
 
@@ -443,6 +460,10 @@ CapabilitiesVK::GetEnabledDeviceFeatures(
     // We require this for enabling wireframes in the playground. But its not
     // necessarily a big deal if we don't have this feature.
     required.fillModeNonSolid = supported.fillModeNonSolid;
+
+    // Lets a single indirect draw call issue many draws. Without it, indirect
+    // draws are issued one at a time.
+    required.multiDrawIndirect = supported.multiDrawIndirect;
   }
   // VK_KHR_sampler_ycbcr_conversion features.
   if (IsExtensionInList(
@@ -475,6 +496,19 @@ CapabilitiesVK::GetEnabledDeviceFeatures(
         .unlink<vk::PhysicalDeviceImageCompressionControlFeaturesEXT>();
   }
 
+  // VK_KHR_timeline_semaphore
+  if (IsExtensionInList(enabled_extensions.value(),
+                        OptionalDeviceExtensionVK::kKHRTimelineSemaphore)) {
+    auto& required =
+        required_chain.get<vk::PhysicalDeviceTimelineSemaphoreFeaturesKHR>();
+    const auto& supported =
+        supported_chain.get<vk::PhysicalDeviceTimelineSemaphoreFeaturesKHR>();
+
+    required.timelineSemaphore = supported.timelineSemaphore;
+  } else {
+    required_chain.unlink<vk::PhysicalDeviceTimelineSemaphoreFeaturesKHR>();
+  }
+
   // Vulkan 1.1
   {
     auto& required =
@@ -543,9 +577,22 @@ bool CapabilitiesVK::SetPhysicalDevice(
     default_stencil_format_ = default_depth_stencil_format_;
   }
 
+  supported_compressed_formats_.clear();
+  for (PixelFormat format :
+       {PixelFormat::kETC2R8G8B8A8UNormInt, PixelFormat::kASTC4x4UNormInt,
+        PixelFormat::kBC7UNormInt}) {
+    if (HasSuitableCompressedFormat(device, ToVKImageFormat(format))) {
+      supported_compressed_formats_.insert(format);
+    }
+  }
+
   physical_device_ = device;
   device_properties_ = device.getProperties();
 
+  supports_multi_draw_indirect_ =
+      enabled_features.get().features.multiDrawIndirect &&
+      device_properties_.limits.maxDrawIndirectCount > 1u;
+
   auto physical_properties_2 =
       device.getProperties2<vk::PhysicalDeviceProperties2,
                             vk::PhysicalDeviceSubgroupProperties>();
@@ -631,6 +678,12 @@ bool CapabilitiesVK::SetPhysicalDevice(
           .get<vk::PhysicalDeviceImageCompressionControlFeaturesEXT>()
           .imageCompressionControl;
 
+  supports_timeline_semaphores_ =
+      enabled_features
+          .isLinked<vk::PhysicalDeviceTimelineSemaphoreFeaturesKHR>() &&
+      enabled_features.get<vk::PhysicalDeviceTimelineSemaphoreFeaturesKHR>()
+          .timelineSemaphore;
+
   max_render_pass_attachment_size_ =
       ISize{device_properties_.limits.maxFramebufferWidth,
             device_properties_.limits.maxFramebufferHeight};
@@ -768,6 +821,10 @@ bool CapabilitiesVK::SupportsTextureFixedRateCompression() const {
   return supports_texture_fixed_rate_compression_;
 }
 
+bool CapabilitiesVK::SupportsTimelineSemaphores() const {
+  return supports_timeline_semaphores_;
+}
+
 std::optional<vk::ImageCompressionFixedRateFlagBitsEXT>
 CapabilitiesVK::GetSupportedFRCRate(CompressionType compression_type,
                                     const FRCFormatDescriptor& desc) const {
@@ -825,6 +882,14 @@ bool CapabilitiesVK::SupportsTriangleFan() const {
   return has_triangle_fans_;
 }
 
+bool CapabilitiesVK::SupportsIndirectDraw() const {
+  return true;
+}
+
+bool CapabilitiesVK::SupportsMultiDrawIndirect() const {
+  return supports_multi_draw_indirect_;
+}
+
 ISize CapabilitiesVK::GetMaximumRenderPassAttachmentSize() const {
   return max_render_pass_attachment_size_;
 }
@@ -842,6 +907,10 @@ bool CapabilitiesVK::SupportsExtendedRangeFormats() const {
   return false;
 }
 
+bool CapabilitiesVK::SupportsCompressedFormat(PixelFormat format) const {
+  return supported_compressed_formats_.count(format) > 0;
+}
+
 }  // namespace impeller
 
 // NOLINTEND(clang-analyzer-security.PointerSub)
@@ -151,6 +151,14 @@ enum class OptionalDeviceExtensionVK : uint32_t {
   ///
   kEXTImageCompressionControl,
 
+  //----------------------------------------------------------------------------
+  /// To track command buffer completion with a single semaphore counter
+  /// instead of a fence per submission.
+  ///
+  /// https://registry.khronos.org/vulkan/specs/1.3-extensions/man/html/VK_KHR_timeline_semaphore.html
+  ///
+  kKHRTimelineSemaphore,
+
   kLast,
 };
 
@@ -211,7 +219,8 @@ class CapabilitiesVK final : public Capabilities,
       vk::StructureChain<vk::PhysicalDeviceFeatures2,
                          vk::PhysicalDeviceSamplerYcbcrConversionFeaturesKHR,
                          vk::PhysicalDevice16BitStorageFeatures,
-                         vk::PhysicalDeviceImageCompressionControlFeaturesEXT>;
+                         vk::PhysicalDeviceImageCompressionControlFeaturesEXT,
+                         vk::PhysicalDeviceTimelineSemaphoreFeaturesKHR>;
 
   std::optional<PhysicalDeviceFeatures> GetEnabledDeviceFeatures(
       const vk::PhysicalDevice& physical_device) const;
@@ -257,6 +266,14 @@ class CapabilitiesVK final : public Capabilities,
   // |Capabilities|
   bool SupportsTriangleFan() const override;
 
+  // |Capabilities|
+  bool SupportsIndirectDraw() const override;
+
+  /// @brief Whether one indirect draw call may issue more than one draw.
+  ///        Otherwise `RenderPassVK::DrawIndirect` issues the draws one at a
+  ///        time.
+  bool SupportsMultiDrawIndirect() const;
+
   // |Capabilities|
   bool SupportsPrimitiveRestart() const override;
 
@@ -290,12 +307,20 @@ class CapabilitiesVK final : public Capabilities,
   // |Capabilities|
   bool NeedsPartitionedHostBuffer() const override;
 
+  // |Capabilities|
+  bool SupportsCompressedFormat(PixelFormat format) const override;
+
   //----------------------------------------------------------------------------
   /// @return     If fixed-rate compression for non-onscreen surfaces is
   ///             supported.
   ///
   bool SupportsTextureFixedRateCompression() const;
 
+  //----------------------------------------------------------------------------
+  /// @return     If timeline semaphores are enabled on the device.
+  ///
+  bool SupportsTimelineSemaphores() const;
+
   /// Whether the external fence and semaphore extensions used for AHB support
   /// are available.
   bool SupportsExternalSemaphoreExtensions() const;
@@ -336,8 +361,11 @@ class CapabilitiesVK final : public Capabilities,
   bool supports_compute_subgroups_ = false;
   bool supports_device_transient_textures_ = false;
   bool supports_texture_fixed_rate_compression_ = false;
+  bool supports_timeline_semaphores_ = false;
+  std::set<PixelFormat> supported_compressed_formats_;
   ISize max_render_pass_attachment_size_ = ISize{0, 0};
   bool has_triangle_fans_ = true;
+  bool supports_multi_draw_indirect_ = false;
   bool has_primitive_restart_ = true;
   bool has_framebuffer_fetch_ = true;
   bool supports_external_fence_and_semaphore_ = false;
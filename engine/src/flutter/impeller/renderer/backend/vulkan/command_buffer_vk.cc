@@ -117,6 +117,10 @@ bool CommandBufferVK::EndCommandBuffer() const {
   return true;
 }
 
+GPUProbe& CommandBufferVK::GetGPUProbe() const {
+  return tracked_objects_->GetGPUProbe();
+}
+
 vk::CommandBuffer CommandBufferVK::GetCommandBuffer() const {
   if (tracked_objects_) {
     return tracked_objects_->GetCommandBuffer();
@@ -71,6 +71,10 @@ class CommandBufferVK final
   /// @brief End recording of the current command buffer.
   bool EndCommandBuffer() const;
 
+  /// @brief Retrieve the probe that traces the GPU time of this command
+  ///        buffer and its passes.
+  GPUProbe& GetGPUProbe() const;
+
   /// @brief Allocate a new descriptor set for the given [layout].
   fml::StatusOr<vk::DescriptorSet> AllocateDescriptorSets(
       const vk::DescriptorSetLayout& layout,
@@ -9,6 +9,7 @@
 #include <optional>
 #include <utility>
 
+#include "flutter/fml/time/time_delta.h"
 #include "impeller/base/thread.h"
 #include "impeller/renderer/backend/vulkan/vk.h"  // IWYU pragma: keep.
 #include "vulkan/vulkan_handles.hpp"
@@ -109,6 +110,19 @@ class CommandPoolRecyclerVK final
     std::vector<vk::UniqueCommandBuffer> buffers;
   };
 
+  /// The number of pools handed out and the cost of resetting them over the
+  /// lifetime of the recycler.
+  struct Stats {
+    /// Pools that had to be created because none were recycled.
+    size_t created_count = 0u;
+    /// Pools that were reused after being reset in the background.
+    size_t reused_count = 0u;
+    /// Pools that were reset in the background.
+    size_t reset_count = 0u;
+    /// The total time spent in |vkResetCommandPool|.
+    fml::TimeDelta reset_time;
+  };
+
   /// @brief      Clean up resources held by all per-thread command pools
   ///             associated with the context.
   void DestroyThreadLocalPools();
@@ -135,6 +149,9 @@ class CommandPoolRecyclerVK final
   /// @brief      Clears this context's thread-local command pool.
   void Dispose();
 
+  /// @brief      The pool counters accumulated so far.
+  Stats GetStats() const;
+
   // Visible for testing.
   static int GetGlobalPoolCount(const ContextVK& context);
 
@@ -142,8 +159,9 @@ class CommandPoolRecyclerVK final
   std::weak_ptr<ContextVK> context_;
   uint64_t context_hash_;
 
-  Mutex recycled_mutex_;
+  mutable Mutex recycled_mutex_;
   std::vector<RecycledData> recycled_ IPLR_GUARDED_BY(recycled_mutex_);
+  Stats stats_ IPLR_GUARDED_BY(recycled_mutex_);
 
   /// @brief      Creates a new |vk::CommandPool|.
   ///
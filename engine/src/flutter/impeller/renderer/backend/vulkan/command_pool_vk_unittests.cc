@@ -219,6 +219,32 @@ TEST(CommandPoolRecyclerVKTest, ExtraCommandBufferAllocationsTriggerTrim) {
   context->Shutdown();
 }
 
+TEST(CommandPoolRecyclerVKTest, StatsCountCreatedResetAndReusedPools) {
+  auto const context = MockVulkanContextBuilder().Build();
+  auto const recycler = context->GetCommandPoolRecycler();
+
+  {
+    auto const pool = recycler->Get();
+    recycler->Dispose();
+  }
+
+  WaitForReclaim(context);
+
+  {
+    auto const pool = recycler->Get();
+    recycler->Dispose();
+  }
+
+  WaitForReclaim(context);
+
+  auto const stats = recycler->GetStats();
+  EXPECT_EQ(stats.created_count, 1u);
+  EXPECT_EQ(stats.reused_count, 1u);
+  EXPECT_EQ(stats.reset_count, 2u);
+
+  context->Shutdown();
+}
+
 TEST(CommandPoolRecyclerVKTest, RecyclerGlobalPoolMapSize) {
   auto context = MockVulkanContextBuilder().Build();
   auto const recycler = context->GetCommandPoolRecycler();
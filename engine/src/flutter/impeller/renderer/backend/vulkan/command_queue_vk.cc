@@ -10,6 +10,7 @@
 #include "impeller/renderer/backend/vulkan/command_buffer_vk.h"
 #include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/fence_waiter_vk.h"
+#include "impeller/renderer/backend/vulkan/timeline_waiter_vk.h"
 #include "impeller/renderer/backend/vulkan/tracked_objects_vk.h"
 #include "impeller/renderer/command_buffer.h"
 
@@ -24,7 +25,14 @@ fml::Status CommandQueueVK::Submit(
     const std::vector<std::shared_ptr<CommandBuffer>>& buffers,
     const CompletionCallback& completion_callback,
     bool block_on_schedule) {
-  if (buffers.empty()) {
+  return SubmitWithSemaphores(buffers, {}, completion_callback);
+}
+
+fml::Status CommandQueueVK::SubmitWithSemaphores(
+    const std::vector<std::shared_ptr<CommandBuffer>>& buffers,
+    const SubmitSemaphoresVK& semaphores,
+    const CompletionCallback& completion_callback) {
+  if (buffers.empty() && semaphores.IsEmpty()) {
     return fml::Status(fml::StatusCode::kInvalidArgument,
                        "No command buffers provided.");
   }
@@ -54,32 +62,52 @@ fml::Status CommandQueueVK::Submit(
     VALIDATION_LOG << "Device lost.";
     return fml::Status(fml::StatusCode::kCancelled, "Device lost.");
   }
+  FML_DCHECK(semaphores.wait_semaphores.size() ==
+             semaphores.wait_stages.size());
+  vk::SubmitInfo submit_info;
+  submit_info.setCommandBuffers(vk_buffers);
+  submit_info.setWaitSemaphores(semaphores.wait_semaphores);
+  submit_info.setWaitDstStageMask(semaphores.wait_stages);
+  submit_info.setSignalSemaphores(semaphores.signal_semaphores);
+
+  // Submit will proceed, call callback with true when it is done and do not
+  // call when `reset` is collected.
+  auto on_completed = [completion_callback,
+                       tracked_objects = std::move(tracked_objects)]() mutable {
+    // Ensure tracked objects are destructed before calling any final
+    // callbacks.
+    tracked_objects.clear();
+    if (completion_callback) {
+      completion_callback(CommandBuffer::Status::kCompleted);
+    }
+  };
+
+  // With timeline semaphores, the submission signals the next value of a
+  // single semaphore instead of a new fence.
+  if (auto timeline_waiter = context->GetTimelineWaiter()) {
+    if (!timeline_waiter->Submit(*context->GetGraphicsQueue(), submit_info,
+                                 std::move(on_completed))) {
+      return fml::Status(fml::StatusCode::kCancelled,
+                         "Failed to submit queue.");
+    }
+    reset.Release();
+    return fml::Status();
+  }
+
   auto [fence_result, fence] = context->GetDevice().createFenceUnique({});
   if (fence_result != vk::Result::eSuccess) {
     VALIDATION_LOG << "Failed to create fence: " << vk::to_string(fence_result);
     return fml::Status(fml::StatusCode::kCancelled, "Failed to create fence.");
   }
 
-  vk::SubmitInfo submit_info;
-  submit_info.setCommandBuffers(vk_buffers);
   auto status = context->GetGraphicsQueue()->Submit(submit_info, *fence);
   if (status != vk::Result::eSuccess) {
     VALIDATION_LOG << "Failed to submit queue: " << vk::to_string(status);
     return fml::Status(fml::StatusCode::kCancelled, "Failed to submit queue: ");
   }
 
-  // Submit will proceed, call callback with true when it is done and do not
-  // call when `reset` is collected.
   auto added_fence = context->GetFenceWaiter()->AddFence(
-      std::move(fence), [completion_callback, tracked_objects = std::move(
-                                                  tracked_objects)]() mutable {
-        // Ensure tracked objects are destructed before calling any final
-        // callbacks.
-        tracked_objects.clear();
-        if (completion_callback) {
-          completion_callback(CommandBuffer::Status::kCompleted);
-        }
-      });
+      std::move(fence), std::move(on_completed));
   if (!added_fence) {
     return fml::Status(fml::StatusCode::kCancelled, "Failed to add fence.");
   }
@@ -5,12 +5,28 @@
 #ifndef FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_COMMAND_QUEUE_VK_H_
 #define FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_COMMAND_QUEUE_VK_H_
 
+#include <vector>
+
+#include "impeller/renderer/backend/vulkan/vk.h"
 #include "impeller/renderer/command_queue.h"
 
 namespace impeller {
 
 class ContextVK;
 
+/// Binary semaphores owned by the embedder that a queue submission waits on
+/// before executing and signals once it has completed. They must be created
+/// on the same device as the context.
+struct SubmitSemaphoresVK {
+  std::vector<vk::Semaphore> wait_semaphores;
+  std::vector<vk::PipelineStageFlags> wait_stages;
+  std::vector<vk::Semaphore> signal_semaphores;
+
+  bool IsEmpty() const {
+    return wait_semaphores.empty() && signal_semaphores.empty();
+  }
+};
+
 class CommandQueueVK : public CommandQueue {
  public:
   explicit CommandQueueVK(const std::weak_ptr<ContextVK>& context);
@@ -21,6 +37,14 @@ class CommandQueueVK : public CommandQueue {
                      const CompletionCallback& completion_callback = {},
                      bool block_on_schedule = false) override;
 
+  /// Submit the command buffers in a single batch that waits on and signals
+  /// the given semaphores. Unlike `Submit`, the list of command buffers may
+  /// be empty if there are semaphores to wait on or signal.
+  fml::Status SubmitWithSemaphores(
+      const std::vector<std::shared_ptr<CommandBuffer>>& buffers,
+      const SubmitSemaphoresVK& semaphores,
+      const CompletionCallback& completion_callback = {});
+
  private:
   std::weak_ptr<ContextVK> context_;
 
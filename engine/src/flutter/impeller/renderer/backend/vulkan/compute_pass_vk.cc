@@ -23,6 +23,8 @@ ComputePassVK::ComputePassVK(std::shared_ptr<const Context> context,
                      .GetPhysicalDevice()
                      .getProperties()
                      .limits.maxComputeWorkGroupSize;
+  command_buffer_->GetGPUProbe().RecordPassStart(
+      command_buffer_->GetCommandBuffer());
   is_valid_ = true;
 }
 
@@ -258,6 +260,9 @@ bool ComputePassVK::EncodeCommands() const {
       vk::PipelineStageFlagBits::eComputeShader,
       vk::PipelineStageFlagBits::eVertexInput, {}, 1, &barrier, 0, {}, 0, {});
 
+  command_buffer_->GetGPUProbe().RecordPassEnd(
+      command_buffer_->GetCommandBuffer(),
+      label_.empty() ? "ComputePass" : label_);
   return true;
 }
 
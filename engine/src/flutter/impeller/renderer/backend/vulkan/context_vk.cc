@@ -41,6 +41,7 @@
 #include "impeller/renderer/backend/vulkan/gpu_tracer_vk.h"
 #include "impeller/renderer/backend/vulkan/resource_manager_vk.h"
 #include "impeller/renderer/backend/vulkan/surface_context_vk.h"
+#include "impeller/renderer/backend/vulkan/timeline_waiter_vk.h"
 #include "impeller/renderer/backend/vulkan/yuv_conversion_library_vk.h"
 #include "impeller/renderer/capabilities.h"
 
@@ -89,12 +90,12 @@ static std::vector<vk::DeviceQueueCreateInfo> GetQueueCreateInfos(
 }
 
 static std::optional<QueueIndexVK> PickQueue(const vk::PhysicalDevice& device,
-                                             vk::QueueFlagBits flags) {
+                                             vk::QueueFlags flags) {
   // This can be modified to ensure that dedicated queues are returned for each
   // queue type depending on support.
   const auto families = device.getQueueFamilyProperties();
   for (size_t i = 0u; i < families.size(); i++) {
-    if (!(families[i].queueFlags & flags)) {
+    if ((families[i].queueFlags & flags) != flags) {
       continue;
     }
     return QueueIndexVK{.family = i, .index = 0};
@@ -289,12 +290,23 @@ void ContextVK::Setup(Settings settings) {
   //----------------------------------------------------------------------------
   /// Pick device queues.
   ///
+  // Compute passes are recorded into the same command buffers as render
+  // passes and submitted on the graphics queue. Prefer a family that supports
+  // both, which Vulkan guarantees to exist on devices with graphics support,
+  // and use it for compute too. Picking the first compute capable family
+  // instead could create a queue that nothing is ever submitted to.
   auto graphics_queue =
-      PickQueue(device_holder->physical_device, vk::QueueFlagBits::eGraphics);
+      PickQueue(device_holder->physical_device,
+                vk::QueueFlagBits::eGraphics | vk::QueueFlagBits::eCompute);
+  std::optional<QueueIndexVK> compute_queue = graphics_queue;
+  if (!graphics_queue.has_value()) {
+    graphics_queue =
+        PickQueue(device_holder->physical_device, vk::QueueFlagBits::eGraphics);
+    compute_queue =
+        PickQueue(device_holder->physical_device, vk::QueueFlagBits::eCompute);
+  }
   auto transfer_queue =
       PickQueue(device_holder->physical_device, vk::QueueFlagBits::eTransfer);
-  auto compute_queue =
-      PickQueue(device_holder->physical_device, vk::QueueFlagBits::eCompute);
 
   if (!graphics_queue.has_value()) {
     VALIDATION_LOG << "Could not pick graphics queue.";
@@ -381,10 +393,11 @@ void ContextVK::Setup(Settings settings) {
   /// Setup the pipeline library.
   ///
   auto pipeline_library = std::shared_ptr<PipelineLibraryVK>(
-      new PipelineLibraryVK(device_holder,                         //
-                            caps,                                  //
-                            std::move(settings.cache_directory),   //
-                            raster_message_loop_->GetTaskRunner()  //
+      new PipelineLibraryVK(device_holder,                          //
+                            caps,                                   //
+                            std::move(settings.cache_directory),    //
+                            raster_message_loop_->GetTaskRunner(),  //
+                            settings.bundled_pipeline_caches        //
                             ));
 
   if (!pipeline_library->IsValid()) {
@@ -411,6 +424,14 @@ void ContextVK::Setup(Settings settings) {
   auto fence_waiter =
       std::shared_ptr<FenceWaiterVK>(new FenceWaiterVK(device_holder));
 
+  // Devices created by the embedder may not have the timeline semaphore
+  // feature enabled even if it is supported.
+  std::shared_ptr<TimelineWaiterVK> timeline_waiter;
+  if (!settings.embedder_data.has_value() &&
+      caps->SupportsTimelineSemaphores()) {
+    timeline_waiter = TimelineWaiterVK::Create(device_holder);
+  }
+
   //----------------------------------------------------------------------------
   /// Create the resource manager and command pool recycler.
   ///
@@ -468,6 +489,7 @@ void ContextVK::Setup(Settings settings) {
   workarounds_ = GetWorkaroundsFromDriverInfo(*driver_info);
   caps->ApplyWorkarounds(workarounds_);
   sampler_library->ApplyWorkarounds(workarounds_);
+  sampler_library->CreateCommonSamplers();
 
   device_holder_ = std::move(device_holder);
   idle_waiter_vk_ = std::make_shared<IdleWaiterVK>(device_holder_);
@@ -482,12 +504,14 @@ void ContextVK::Setup(Settings settings) {
   queues_ = std::move(queues);
   device_capabilities_ = std::move(caps);
   fence_waiter_ = std::move(fence_waiter);
+  timeline_waiter_ = std::move(timeline_waiter);
   resource_manager_ = std::move(resource_manager);
   command_pool_recycler_ = std::move(command_pool_recycler);
   descriptor_pool_recycler_ = std::move(descriptor_pool_recycler);
   device_name_ = std::string(physical_device_properties.deviceName);
   command_queue_vk_ = std::make_shared<CommandQueueVK>(weak_from_this());
   should_enable_surface_control_ = settings.enable_surface_control;
+  khr_present_settings_ = settings.khr_present_settings;
   should_batch_cmd_buffers_ = !workarounds_.batch_submit_command_buffer_timeout;
   is_valid_ = true;
 
@@ -602,6 +626,9 @@ void ContextVK::Shutdown() {
   //
   // tl;dr: Without it, we get thread::join failures on shutdown.
   fence_waiter_->Terminate();
+  if (timeline_waiter_) {
+    timeline_waiter_->Terminate();
+  }
   resource_manager_.reset();
 
   raster_message_loop_->Terminate();
@@ -627,6 +654,10 @@ std::shared_ptr<FenceWaiterVK> ContextVK::GetFenceWaiter() const {
   return fence_waiter_;
 }
 
+std::shared_ptr<TimelineWaiterVK> ContextVK::GetTimelineWaiter() const {
+  return timeline_waiter_;
+}
+
 std::shared_ptr<ResourceManagerVK> ContextVK::GetResourceManager() const {
   return resource_manager_;
 }
@@ -651,7 +682,7 @@ std::shared_ptr<CommandQueue> ContextVK::GetCommandQueue() const {
 
 bool ContextVK::EnqueueCommandBuffer(
     std::shared_ptr<CommandBuffer> command_buffer) {
-  if (should_batch_cmd_buffers_) {
+  if (should_batch_cmd_buffers_ || pending_submit_semaphores_.has_value()) {
     pending_command_buffers_.push_back(std::move(command_buffer));
     return true;
   } else {
@@ -660,6 +691,16 @@ bool ContextVK::EnqueueCommandBuffer(
 }
 
 bool ContextVK::FlushCommandBuffers() {
+  if (pending_submit_semaphores_.has_value()) {
+    bool result = command_queue_vk_
+                      ->SubmitWithSemaphores(pending_command_buffers_,
+                                             pending_submit_semaphores_.value())
+                      .ok();
+    pending_command_buffers_.clear();
+    pending_submit_semaphores_.reset();
+    return result;
+  }
+
   if (pending_command_buffers_.empty()) {
     return true;
   }
@@ -733,6 +774,10 @@ const std::unique_ptr<DriverInfoVK>& ContextVK::GetDriverInfo() const {
   return driver_info_;
 }
 
+const KHRPresentSettingsVK& ContextVK::GetKHRPresentSettings() const {
+  return khr_present_settings_;
+}
+
 bool ContextVK::GetShouldEnableSurfaceControlSwapchain() const {
   return should_enable_surface_control_ &&
          CapabilitiesVK::Cast(*device_capabilities_)
@@ -743,6 +788,14 @@ RuntimeStageBackend ContextVK::GetRuntimeStageBackend() const {
   return RuntimeStageBackend::kVulkan;
 }
 
+void ContextVK::SetPendingSubmitSemaphores(SubmitSemaphoresVK semaphores) {
+  if (semaphores.IsEmpty()) {
+    pending_submit_semaphores_.reset();
+    return;
+  }
+  pending_submit_semaphores_ = std::move(semaphores);
+}
+
 bool ContextVK::SubmitOnscreen(std::shared_ptr<CommandBuffer> cmd_buffer) {
   return EnqueueCommandBuffer(std::move(cmd_buffer));
 }
@@ -7,6 +7,7 @@
 
 #include <format>
 #include <memory>
+#include <optional>
 
 #include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/mapping.h"
@@ -15,12 +16,14 @@
 #include "impeller/core/formats.h"
 #include "impeller/core/runtime_types.h"
 #include "impeller/renderer/backend/vulkan/command_pool_vk.h"
+#include "impeller/renderer/backend/vulkan/command_queue_vk.h"
 #include "impeller/renderer/backend/vulkan/device_holder_vk.h"
 #include "impeller/renderer/backend/vulkan/driver_info_vk.h"
 #include "impeller/renderer/backend/vulkan/pipeline_library_vk.h"
 #include "impeller/renderer/backend/vulkan/queue_vk.h"
 #include "impeller/renderer/backend/vulkan/sampler_library_vk.h"
 #include "impeller/renderer/backend/vulkan/shader_library_vk.h"
+#include "impeller/renderer/backend/vulkan/swapchain/khr/khr_present_tuner_vk.h"
 #include "impeller/renderer/backend/vulkan/workarounds_vk.h"
 #include "impeller/renderer/capabilities.h"
 #include "impeller/renderer/command_buffer.h"
@@ -36,11 +39,11 @@ class CommandEncoderVK;
 class CommandPoolRecyclerVK;
 class DebugReportVK;
 class FenceWaiterVK;
+class TimelineWaiterVK;
 class ResourceManagerVK;
 class SurfaceContextVK;
 class GPUTracerVK;
 class DescriptorPoolRecyclerVK;
-class CommandQueueVK;
 class DescriptorPoolVK;
 
 class IdleWaiterVK : public IdleWaiter {
@@ -80,9 +83,17 @@ class ContextVK final : public Context,
     PFN_vkGetInstanceProcAddr proc_address_callback = nullptr;
     std::vector<std::shared_ptr<fml::Mapping>> shader_libraries_data;
     fml::UniqueFD cache_directory;
+    /// Pipeline cache blobs shipped with the application, in the format
+    /// persisted to the |cache_directory| (`flutter.impeller.vkcache`). The
+    /// first blob generated by a device with the same vendor, device, driver
+    /// version, and pipeline cache UUID is merged into the on-device cache.
+    std::vector<std::shared_ptr<fml::Mapping>> bundled_pipeline_caches;
     bool enable_validation = false;
     bool enable_gpu_tracing = false;
     bool enable_surface_control = false;
+    /// How KHR swapchains created for this context pick their present mode
+    /// and image count.
+    KHRPresentSettingsVK khr_present_settings;
     /// If validations are requested but cannot be enabled, log a fatal error.
     bool fatal_missing_validations = false;
     Flags flags;
@@ -209,6 +220,15 @@ class ContextVK final : public Context,
 
   std::shared_ptr<FenceWaiterVK> GetFenceWaiter() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The waiter that tracks graphics queue submissions with a
+  ///             timeline semaphore.
+  ///
+  /// @return     The waiter, or nullptr if the device doesn't support timeline
+  ///             semaphores. Submissions then use the fence waiter.
+  ///
+  std::shared_ptr<TimelineWaiterVK> GetTimelineWaiter() const;
+
   std::shared_ptr<ResourceManagerVK> GetResourceManager() const;
 
   std::shared_ptr<CommandPoolRecyclerVK> GetCommandPoolRecycler() const;
@@ -231,6 +251,8 @@ class ContextVK final : public Context,
   ///        enabled
   bool GetShouldEnableSurfaceControlSwapchain() const;
 
+  const KHRPresentSettingsVK& GetKHRPresentSettings() const;
+
   // | Context |
   bool EnqueueCommandBuffer(
       std::shared_ptr<CommandBuffer> command_buffer) override;
@@ -238,6 +260,15 @@ class ContextVK final : public Context,
   // | Context |
   bool FlushCommandBuffers() override;
 
+  /// @brief Make the next flush of the enqueued command buffers wait on and
+  ///        signal the given semaphores. Until then, command buffers are
+  ///        batched even if batching is otherwise disabled, so that the
+  ///        whole workload is covered by the semaphores. The flush is
+  ///        submitted even if there are no command buffers.
+  ///
+  ///        Like `EnqueueCommandBuffer`, this is not thread safe.
+  void SetPendingSubmitSemaphores(SubmitSemaphoresVK semaphores);
+
   RuntimeStageBackend GetRuntimeStageBackend() const override;
 
   std::shared_ptr<const IdleWaiter> GetIdleWaiter() const override {
@@ -277,13 +308,14 @@ class ContextVK final : public Context,
   QueuesVK queues_;
   std::shared_ptr<const Capabilities> device_capabilities_;
   std::shared_ptr<FenceWaiterVK> fence_waiter_;
+  std::shared_ptr<TimelineWaiterVK> timeline_waiter_;
   std::shared_ptr<ResourceManagerVK> resource_manager_;
   std::shared_ptr<DescriptorPoolRecyclerVK> descriptor_pool_recycler_;
   std::shared_ptr<CommandPoolRecyclerVK> command_pool_recycler_;
   std::string device_name_;
   std::shared_ptr<fml::ConcurrentMessageLoop> raster_message_loop_;
   std::shared_ptr<GPUTracerVK> gpu_tracer_;
-  std::shared_ptr<CommandQueue> command_queue_vk_;
+  std::shared_ptr<CommandQueueVK> command_queue_vk_;
   std::shared_ptr<const IdleWaiter> idle_waiter_vk_;
   WorkaroundsVK workarounds_;
 
@@ -294,8 +326,10 @@ class ContextVK final : public Context,
   mutable DescriptorPoolMap IPLR_GUARDED_BY(desc_pool_mutex_)
       cached_descriptor_pool_;
   bool should_enable_surface_control_ = false;
+  KHRPresentSettingsVK khr_present_settings_;
   bool should_batch_cmd_buffers_ = false;
   std::vector<std::shared_ptr<CommandBuffer>> pending_command_buffers_;
+  std::optional<SubmitSemaphoresVK> pending_submit_semaphores_;
 
   const uint64_t hash_;
 
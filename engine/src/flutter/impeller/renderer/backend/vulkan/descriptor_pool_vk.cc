@@ -4,12 +4,26 @@
 
 #include "impeller/renderer/backend/vulkan/descriptor_pool_vk.h"
 
+#include <algorithm>
 #include <optional>
 
+#include "flutter/fml/hash_combine.h"
 #include "impeller/base/validation.h"
 
 namespace impeller {
 
+std::size_t DescriptorSetKeyVK::Hash::operator()(
+    const DescriptorSetKeyVK& key) const {
+  std::size_t hash = key.bindings.size();
+  for (const DescriptorBindingKeyVK& binding : key.bindings) {
+    fml::HashCombineSeed(hash, binding.binding,
+                         static_cast<uint32_t>(binding.type),
+                         binding.resource_id, binding.handle, binding.sampler,
+                         binding.offset, binding.range);
+  }
+  return hash;
+}
+
 struct DescriptorPoolSize {
   size_t buffer_bindings;
   size_t texture_bindings;
@@ -38,7 +52,11 @@ DescriptorPoolVK::DescriptorPoolVK(std::weak_ptr<const ContextVK> context,
                                    std::vector<vk::UniqueDescriptorPool> pools)
     : context_(std::move(context)),
       descriptor_sets_(std::move(descriptor_sets)),
-      pools_(std::move(pools)) {}
+      pools_(std::move(pools)) {
+  for (const auto& [_, cache] : descriptor_sets_) {
+    retained_count_ += cache.retained.size();
+  }
+}
 
 DescriptorPoolVK::~DescriptorPoolVK() {
   if (pools_.empty()) {
@@ -98,6 +116,46 @@ fml::StatusOr<vk::DescriptorSet> DescriptorPoolVK::AllocateDescriptorSets(
   return set;
 }
 
+std::optional<vk::DescriptorSet> DescriptorPoolVK::FindRetainedDescriptorSet(
+    PipelineKey pipeline_key,
+    const DescriptorSetKeyVK& key) {
+  DescriptorCacheMap::iterator existing = descriptor_sets_.find(pipeline_key);
+  if (existing == descriptor_sets_.end()) {
+    return std::nullopt;
+  }
+  auto retained = existing->second.retained.find(key);
+  if (retained == existing->second.retained.end()) {
+    return std::nullopt;
+  }
+  retained->second.used = true;
+  return retained->second.set;
+}
+
+void DescriptorPoolVK::RetainDescriptorSet(PipelineKey pipeline_key,
+                                           const DescriptorSetKeyVK& key,
+                                           vk::DescriptorSet set) {
+  if (retained_count_ >= kMaxRetainedDescriptorSets) {
+    return;
+  }
+  DescriptorCacheMap::iterator existing = descriptor_sets_.find(pipeline_key);
+  if (existing == descriptor_sets_.end()) {
+    return;
+  }
+  // The set was just allocated, so it is almost always the last used set.
+  std::vector<vk::DescriptorSet>& used = existing->second.used;
+  auto found = std::find(used.rbegin(), used.rend(), set);
+  if (found == used.rend()) {
+    return;
+  }
+  if (!existing->second.retained
+           .try_emplace(key, RetainedDescriptorSet{.set = set})
+           .second) {
+    return;
+  }
+  used.erase(std::next(found).base());
+  retained_count_++;
+}
+
 fml::Status DescriptorPoolVK::CreateNewPool(const ContextVK& context_vk) {
   auto new_pool = context_vk.GetDescriptorPoolRecycler()->Get();
   if (!new_pool) {
@@ -121,6 +179,17 @@ void DescriptorPoolRecyclerVK::Reclaim(
     cache.unused.insert(cache.unused.end(), cache.used.begin(),
                         cache.used.end());
     cache.used.clear();
+    // Retained sets that no draw asked for are likely stale. Make them
+    // available for rewriting instead of holding onto pool capacity.
+    for (auto it = cache.retained.begin(); it != cache.retained.end();) {
+      if (it->second.used) {
+        it->second.used = false;
+        ++it;
+      } else {
+        cache.unused.push_back(it->second.set);
+        it = cache.retained.erase(it);
+      }
+    }
   }
 
   // Move the pool to the recycled list. If more than 32 pool are
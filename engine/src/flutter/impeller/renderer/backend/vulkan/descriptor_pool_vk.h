@@ -6,7 +6,9 @@
 #define FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_DESCRIPTOR_POOL_VK_H_
 
 #include <cstdint>
+#include <optional>
 #include <unordered_map>
+#include <vector>
 
 #include "fml/status_or.h"
 #include "impeller/renderer/backend/vulkan/context_vk.h"
@@ -14,10 +16,57 @@
 
 namespace impeller {
 
+/// A single resource written to a descriptor set.
+struct DescriptorBindingKeyVK {
+  uint32_t binding = 0u;
+  vk::DescriptorType type = vk::DescriptorType::eUniformBuffer;
+  /// The |UniqueID| of the bound buffer or texture. Vulkan handles may be
+  /// reused once the resource they refer to is destroyed, so they alone can't
+  /// identify a resource across frames.
+  size_t resource_id = 0u;
+  /// The VkBuffer or VkImageView.
+  uint64_t handle = 0u;
+  /// The VkSampler, if any.
+  uint64_t sampler = 0u;
+  /// The buffer offset or the image layout.
+  uint64_t offset = 0u;
+  uint64_t range = 0u;
+
+  constexpr bool operator==(const DescriptorBindingKeyVK& o) const = default;
+};
+
+/// The contents of a descriptor set, used to find descriptor sets that were
+/// already written with identical resources by a previous draw.
+struct DescriptorSetKeyVK {
+  std::vector<DescriptorBindingKeyVK> bindings;
+
+  bool operator==(const DescriptorSetKeyVK& o) const {
+    return bindings == o.bindings;
+  }
+
+  struct Hash {
+    std::size_t operator()(const DescriptorSetKeyVK& key) const;
+  };
+};
+
+/// A descriptor set retained with its contents.
+struct RetainedDescriptorSet {
+  vk::DescriptorSet set;
+  /// Whether a draw used the set since the pool was last reclaimed.
+  bool used = true;
+};
+
+using RetainedDescriptorSetMap = std::unordered_map<DescriptorSetKeyVK,
+                                                    RetainedDescriptorSet,
+                                                    DescriptorSetKeyVK::Hash>;
+
 /// Used and un-used descriptor sets.
 struct DescriptorCache {
   std::vector<vk::DescriptorSet> unused;
   std::vector<vk::DescriptorSet> used;
+  /// Descriptor sets that are never rewritten and are instead reused by draws
+  /// binding the same resources.
+  RetainedDescriptorSetMap retained;
 };
 
 using DescriptorCacheMap = std::unordered_map<PipelineKey, DescriptorCache>;
@@ -48,12 +97,35 @@ class DescriptorPoolVK {
       PipelineKey pipeline_key,
       const ContextVK& context_vk);
 
+  /// The maximum number of descriptor sets this pool will retain for reuse.
+  static constexpr size_t kMaxRetainedDescriptorSets = 256u;
+
+  /// @brief      Find a descriptor set that was written with the resources in
+  ///             [key] and retained with |RetainDescriptorSet|. The set may
+  ///             be bound as-is, without being updated.
+  std::optional<vk::DescriptorSet> FindRetainedDescriptorSet(
+      PipelineKey pipeline_key,
+      const DescriptorSetKeyVK& key);
+
+  /// @brief      Retain [set], which was just allocated with
+  ///             |AllocateDescriptorSets| and written with the resources in
+  ///             [key], so that later draws with the same resources can reuse
+  ///             it.
+  ///
+  ///             Retained sets that go unused for an entire use of the pool
+  ///             are handed back out for rewriting when the pool is
+  ///             reclaimed.
+  void RetainDescriptorSet(PipelineKey pipeline_key,
+                           const DescriptorSetKeyVK& key,
+                           vk::DescriptorSet set);
+
  private:
   friend class DescriptorPoolRecyclerVK;
 
   std::weak_ptr<const ContextVK> context_;
   DescriptorCacheMap descriptor_sets_;
   std::vector<vk::UniqueDescriptorPool> pools_;
+  size_t retained_count_ = 0u;
 
   void Destroy();
 
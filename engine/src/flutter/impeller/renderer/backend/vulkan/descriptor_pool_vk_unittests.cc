@@ -133,5 +133,77 @@ TEST(DescriptorPoolRecyclerVKTest, DescriptorsAreRecycled) {
       2);
 }
 
+static DescriptorSetKeyVK CreateTestDescriptorSetKey() {
+  DescriptorSetKeyVK key;
+  key.bindings.push_back(DescriptorBindingKeyVK{
+      .binding = 1u,
+      .type = vk::DescriptorType::eUniformBuffer,
+      .resource_id = 42u,
+      .offset = 256u,
+      .range = 64u,
+  });
+  return key;
+}
+
+TEST(DescriptorPoolRecyclerVKTest, RetainedDescriptorSetsAreReused) {
+  std::shared_ptr<ContextVK> context = MockVulkanContextBuilder().Build();
+  DescriptorSetKeyVK key = CreateTestDescriptorSetKey();
+
+  {
+    DescriptorPoolVK pool = DescriptorPoolVK(context);
+    EXPECT_FALSE(pool.FindRetainedDescriptorSet(/*pipeline_key=*/0, key));
+    auto set = pool.AllocateDescriptorSets({}, /*pipeline_key=*/0, *context);
+    ASSERT_TRUE(set.ok());
+    pool.RetainDescriptorSet(/*pipeline_key=*/0, key, set.value());
+    EXPECT_TRUE(pool.FindRetainedDescriptorSet(/*pipeline_key=*/0, key));
+    // Retained sets are specific to the pipeline.
+    EXPECT_FALSE(pool.FindRetainedDescriptorSet(/*pipeline_key=*/1, key));
+  }
+
+  // The recycled pool still has the retained set.
+  std::shared_ptr<DescriptorPoolVK> pool =
+      context->GetDescriptorPoolRecycler()->GetDescriptorPool();
+  EXPECT_TRUE(pool->FindRetainedDescriptorSet(/*pipeline_key=*/0, key));
+
+  DescriptorSetKeyVK other_key = key;
+  other_key.bindings[0].offset = 512u;
+  EXPECT_FALSE(pool->FindRetainedDescriptorSet(/*pipeline_key=*/0, other_key));
+
+  // The retained set is not handed out for rewriting.
+  pool->AllocateDescriptorSets({}, /*pipeline_key=*/0, *context);
+  std::shared_ptr<std::vector<std::string>> called =
+      GetMockVulkanFunctions(context->GetDevice());
+  EXPECT_EQ(
+      std::count(called->begin(), called->end(), "vkAllocateDescriptorSets"),
+      2);
+}
+
+TEST(DescriptorPoolRecyclerVKTest, UnusedRetainedDescriptorSetsAreReleased) {
+  std::shared_ptr<ContextVK> context = MockVulkanContextBuilder().Build();
+  DescriptorSetKeyVK key = CreateTestDescriptorSetKey();
+
+  {
+    DescriptorPoolVK pool = DescriptorPoolVK(context);
+    auto set = pool.AllocateDescriptorSets({}, /*pipeline_key=*/0, *context);
+    ASSERT_TRUE(set.ok());
+    pool.RetainDescriptorSet(/*pipeline_key=*/0, key, set.value());
+  }
+
+  // Reclaim the pool once without using the retained set.
+  context->GetDescriptorPoolRecycler()->GetDescriptorPool().reset();
+
+  std::shared_ptr<DescriptorPoolVK> pool =
+      context->GetDescriptorPoolRecycler()->GetDescriptorPool();
+  EXPECT_FALSE(pool->FindRetainedDescriptorSet(/*pipeline_key=*/0, key));
+
+  // The released set is reused instead of allocating a new one.
+  pool->AllocateDescriptorSets({}, /*pipeline_key=*/0, *context);
+  std::shared_ptr<std::vector<std::string>> called =
+      GetMockVulkanFunctions(context->GetDevice());
+  EXPECT_EQ(
+      std::count(called->begin(), called->end(), "vkAllocateDescriptorSets"),
+      1);
+}
+
 }  // namespace testing
 }  // namespace impeller
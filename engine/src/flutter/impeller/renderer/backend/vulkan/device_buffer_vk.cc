@@ -25,6 +25,10 @@ DeviceBufferVK::DeviceBufferVK(DeviceBufferDescriptor desc,
 
 DeviceBufferVK::~DeviceBufferVK() = default;
 
+UniqueID DeviceBufferVK::GetUniqueID() const {
+  return id_;
+}
+
 uint8_t* DeviceBufferVK::OnGetContents() const {
   return static_cast<uint8_t*>(resource_->info.pMappedData);
 }
@@ -8,6 +8,7 @@
 #include <memory>
 
 #include "impeller/base/backend_cast.h"
+#include "impeller/base/comparable.h"
 #include "impeller/core/device_buffer.h"
 #include "impeller/renderer/backend/vulkan/resource_manager_vk.h"
 #include "impeller/renderer/backend/vulkan/vma.h"
@@ -28,6 +29,10 @@ class DeviceBufferVK final : public DeviceBuffer,
 
   vk::Buffer GetBuffer() const;
 
+  /// An identifier for this buffer that, unlike the Vulkan handle, is never
+  /// reused after the buffer is destroyed.
+  UniqueID GetUniqueID() const;
+
   // Visible for testing.
   bool IsHostCoherent() const;
 
@@ -56,6 +61,7 @@ class DeviceBufferVK final : public DeviceBuffer,
   std::weak_ptr<Context> context_;
   UniqueResourceVKT<BufferResource> resource_;
   bool is_host_coherent_ = false;
+  const UniqueID id_;
 
   // |DeviceBuffer|
   uint8_t* OnGetContents() const override;
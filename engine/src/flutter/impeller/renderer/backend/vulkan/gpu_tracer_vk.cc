@@ -4,6 +4,7 @@
 
 #include "impeller/renderer/backend/vulkan/gpu_tracer_vk.h"
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <thread>
@@ -100,6 +101,7 @@ void GPUTracerVK::MarkFrameEnd() {
   FML_DCHECK(state.pending_buffers == 0u);
   state.pending_buffers = 0;
   state.current_index = 0;
+  state.pass_queries.clear();
 }
 
 std::unique_ptr<GPUProbe> GPUTracerVK::CreateGPUProbe() {
@@ -158,6 +160,84 @@ void GPUTracerVK::RecordCmdBufferEnd(const vk::CommandBuffer& buffer,
   state.current_index += 1;
 }
 
+void GPUTracerVK::RecordPassStart(const vk::CommandBuffer& buffer,
+                                  GPUProbe& probe) {
+  if (!enabled_ || std::this_thread::get_id() != raster_thread_id_ ||
+      !in_frame_ || !probe.index_.has_value()) {
+    return;
+  }
+  Lock lock(trace_state_mutex_);
+  GPUTraceState& state = trace_states_[probe.index_.value()];
+
+  // Leave room for the end of the pass and of the cmd buffer.
+  if (state.current_index + 2 >= kPoolSize) {
+    return;
+  }
+
+  buffer.writeTimestamp(vk::PipelineStageFlagBits::eTopOfPipe,
+                        state.query_pool.get(), state.current_index);
+  probe.pass_start_index_ = state.current_index;
+  state.current_index += 1;
+}
+
+void GPUTracerVK::RecordPassEnd(const vk::CommandBuffer& buffer,
+                                GPUProbe& probe,
+                                std::string_view label) {
+  if (!probe.pass_start_index_.has_value()) {
+    return;
+  }
+  uint32_t start_index = probe.pass_start_index_.value();
+  probe.pass_start_index_ = std::nullopt;
+
+  Lock lock(trace_state_mutex_);
+  GPUTraceState& state = trace_states_[probe.index_.value()];
+  if (state.current_index >= kPoolSize) {
+    return;
+  }
+
+  buffer.writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe,
+                        state.query_pool.get(), state.current_index);
+  state.pass_queries.push_back(PassQuery{
+      .start_index = start_index,
+      .end_index = static_cast<uint32_t>(state.current_index),
+      .label = std::string(label),
+  });
+  state.current_index += 1;
+}
+
+std::vector<GPUTracerVK::PassTiming> GPUTracerVK::GetPassTimings() const {
+  Lock lock(pass_timings_mutex_);
+  return last_pass_timings_;
+}
+
+void GPUTracerVK::AccumulatePassTimings(
+    const std::vector<PassTiming>& frame_passes) {
+  Lock lock(pass_timings_mutex_);
+  for (const PassTiming& pass : frame_passes) {
+    PassTiming& timing = window_pass_timings_[pass.label];
+    timing.label = pass.label;
+    timing.count += pass.count;
+    timing.total_ms += pass.total_ms;
+    timing.max_ms = std::max(timing.max_ms, pass.max_ms);
+  }
+
+  window_frames_ += 1;
+  if (window_frames_ < kPassTimingWindow) {
+    return;
+  }
+
+  last_pass_timings_.clear();
+  for (auto& [label, timing] : window_pass_timings_) {
+    last_pass_timings_.push_back(std::move(timing));
+  }
+  std::sort(last_pass_timings_.begin(), last_pass_timings_.end(),
+            [](const PassTiming& a, const PassTiming& b) {
+              return a.total_ms > b.total_ms;
+            });
+  window_pass_timings_.clear();
+  window_frames_ = 0u;
+}
+
 void GPUTracerVK::OnFenceComplete(size_t frame_index) {
   if (!enabled_) {
     return;
@@ -166,6 +246,7 @@ void GPUTracerVK::OnFenceComplete(size_t frame_index) {
   size_t pending = 0;
   size_t query_count = 0;
   vk::QueryPool pool;
+  std::vector<PassQuery> pass_queries;
   {
     Lock lock(trace_state_mutex_);
     GPUTraceState& state = trace_states_[frame_index];
@@ -175,6 +256,9 @@ void GPUTracerVK::OnFenceComplete(size_t frame_index) {
     pending = state.pending_buffers;
     query_count = state.current_index;
     pool = state.query_pool.get();
+    if (pending == 0) {
+      pass_queries.swap(state.pass_queries);
+    }
   }
 
   if (pending == 0) {
@@ -205,9 +289,35 @@ void GPUTracerVK::OnFenceComplete(size_t frame_index) {
       auto gpu_ms =
           (((largest_timestamp - smallest_timestamp) * timestamp_period_) /
            1000000);
+
+      // Sum up the passes of this frame by label.
+      std::vector<PassTiming> frame_passes;
+      double slowest_pass_ms = 0.0;
+      for (const PassQuery& query : pass_queries) {
+        uint64_t start = bits[query.start_index];
+        uint64_t end = bits[query.end_index];
+        double pass_ms =
+            end > start ? ((end - start) * timestamp_period_) / 1000000 : 0.0;
+        slowest_pass_ms = std::max(slowest_pass_ms, pass_ms);
+
+        auto timing = std::find_if(
+            frame_passes.begin(), frame_passes.end(),
+            [&](const PassTiming& pass) { return pass.label == query.label; });
+        if (timing == frame_passes.end()) {
+          frame_passes.push_back(PassTiming{.label = query.label});
+          timing = frame_passes.end() - 1;
+        }
+        timing->count += 1;
+        timing->total_ms += pass_ms;
+        timing->max_ms = std::max(timing->max_ms, pass_ms);
+      }
+      AccumulatePassTimings(frame_passes);
+
       FML_TRACE_COUNTER("flutter", "GPUTracer",
                         reinterpret_cast<int64_t>(this),  // Trace Counter ID
-                        "FrameTimeMS", gpu_ms);
+                        "FrameTimeMS", gpu_ms, "SlowestPassMS",
+                        slowest_pass_ms, "PassCount",
+                        static_cast<int64_t>(pass_queries.size()));
     }
 
     // Record this query to be reset the next time a command is recorded.
@@ -246,4 +356,21 @@ void GPUProbe::RecordCmdBufferEnd(const vk::CommandBuffer& buffer) {
   tracer->RecordCmdBufferEnd(buffer, *this);
 }
 
+void GPUProbe::RecordPassStart(const vk::CommandBuffer& buffer) {
+  auto tracer = tracer_.lock();
+  if (!tracer) {
+    return;
+  }
+  tracer->RecordPassStart(buffer, *this);
+}
+
+void GPUProbe::RecordPassEnd(const vk::CommandBuffer& buffer,
+                             std::string_view label) {
+  auto tracer = tracer_.lock();
+  if (!tracer) {
+    return;
+  }
+  tracer->RecordPassEnd(buffer, *this, label);
+}
+
 }  // namespace impeller
@@ -6,7 +6,12 @@
 #define FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_GPU_TRACER_VK_H_
 
 #include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/device_holder_vk.h"
@@ -48,11 +53,39 @@ class GPUTracerVK : public std::enable_shared_from_this<GPUTracerVK> {
   /// Initialize the set of query pools.
   void InitializeQueryPool(const ContextVK& context);
 
+  /// The GPU time spent in the passes that share a label.
+  struct PassTiming {
+    std::string label;
+    size_t count = 0u;
+    double total_ms = 0.0;
+    double max_ms = 0.0;
+  };
+
+  /// The number of traced frames the pass timings are aggregated over.
+  static constexpr size_t kPassTimingWindow = 120u;
+
+  /// @brief Get the pass timings of the last complete window of
+  ///        [kPassTimingWindow] traced frames, slowest first.
+  std::vector<PassTiming> GetPassTimings() const;
+
  private:
   friend class GPUProbe;
 
   static const constexpr size_t kTraceStatesSize = 16u;
 
+  /// @brief Record a timestamp query into the provided cmd buffer to record
+  ///        the start time of a pass.
+  void RecordPassStart(const vk::CommandBuffer& buffer, GPUProbe& probe);
+
+  /// @brief Record a timestamp query into the provided cmd buffer to record
+  ///        the end time of a pass.
+  void RecordPassEnd(const vk::CommandBuffer& buffer,
+                     GPUProbe& probe,
+                     std::string_view label);
+
+  /// @brief Accumulate the pass timings of a completed frame.
+  void AccumulatePassTimings(const std::vector<PassTiming>& frame_passes);
+
   /// @brief Signal that the cmd buffer is completed.
   ///
   ///        If [frame_index] is std::nullopt, this frame recording is ignored.
@@ -68,10 +101,17 @@ class GPUTracerVK : public std::enable_shared_from_this<GPUTracerVK> {
 
   std::weak_ptr<ContextVK> context_;
 
+  struct PassQuery {
+    uint32_t start_index = 0u;
+    uint32_t end_index = 0u;
+    std::string label;
+  };
+
   struct GPUTraceState {
     size_t current_index = 0;
     size_t pending_buffers = 0;
     vk::UniqueQueryPool query_pool;
+    std::vector<PassQuery> pass_queries;
   };
 
   mutable Mutex trace_state_mutex_;
@@ -80,6 +120,13 @@ class GPUTracerVK : public std::enable_shared_from_this<GPUTracerVK> {
   size_t current_state_ IPLR_GUARDED_BY(trace_state_mutex_) = 0u;
   std::vector<size_t> IPLR_GUARDED_BY(trace_state_mutex_) states_to_reset_ = {};
 
+  mutable Mutex pass_timings_mutex_;
+  std::unordered_map<std::string, PassTiming> window_pass_timings_
+      IPLR_GUARDED_BY(pass_timings_mutex_);
+  size_t window_frames_ IPLR_GUARDED_BY(pass_timings_mutex_) = 0u;
+  std::vector<PassTiming> last_pass_timings_
+      IPLR_GUARDED_BY(pass_timings_mutex_);
+
   // The number of nanoseconds for each timestamp unit.
   float timestamp_period_ = 1;
 
@@ -115,11 +162,23 @@ class GPUProbe {
   ///        time.
   void RecordCmdBufferEnd(const vk::CommandBuffer& buffer);
 
+  /// @brief Record a timestamp query into the provided cmd buffer to record
+  ///        the start time of a render, blit or compute pass.
+  ///
+  ///        Passes must not overlap within a cmd buffer.
+  void RecordPassStart(const vk::CommandBuffer& buffer);
+
+  /// @brief Record a timestamp query into the provided cmd buffer to record
+  ///        the end time of the pass started last. The GPU time of the pass
+  ///        is attributed to [label].
+  void RecordPassEnd(const vk::CommandBuffer& buffer, std::string_view label);
+
  private:
   friend class GPUTracerVK;
 
   std::weak_ptr<GPUTracerVK> tracer_;
   std::optional<size_t> index_ = std::nullopt;
+  std::optional<uint32_t> pass_start_index_ = std::nullopt;
 };
 
 }  // namespace impeller
@@ -13,6 +13,9 @@ namespace impeller {
 static constexpr const char* kPipelineCacheFileName =
     "flutter.impeller.vkcache";
 
+static constexpr const char* kPipelineVariantManifestFileName =
+    "flutter.impeller.pipeline_variants";
+
 bool PipelineCacheDataPersist(const fml::UniqueFD& cache_directory,
                               const VkPhysicalDeviceProperties& props,
                               const vk::UniquePipelineCache& cache) {
@@ -62,6 +65,35 @@ bool PipelineCacheDataPersist(const fml::UniqueFD& cache_directory,
   return true;
 }
 
+std::unique_ptr<fml::Mapping> PipelineCacheDataValidate(
+    const std::shared_ptr<const fml::Mapping>& data,
+    const VkPhysicalDeviceProperties& props) {
+  if (!data || !data->GetMapping()) {
+    return nullptr;
+  }
+  if (data->GetSize() < sizeof(PipelineCacheHeaderVK)) {
+    VALIDATION_LOG << "Pipeline cache data size is too small.";
+    return nullptr;
+  }
+  auto header = PipelineCacheHeaderVK{};
+  std::memcpy(&header,             //
+              data->GetMapping(),  //
+              sizeof(header)       //
+  );
+  const auto current_header = PipelineCacheHeaderVK{props, 0u};
+  if (!header.IsCompatibleWith(current_header)) {
+    return nullptr;
+  }
+  // Zero sized data is known to cause issues.
+  if (header.data_size == 0u ||
+      header.data_size > data->GetSize() - sizeof(header)) {
+    return nullptr;
+  }
+  return std::make_unique<fml::NonOwnedMapping>(
+      data->GetMapping() + sizeof(header), header.data_size,
+      [data](auto, auto) {});
+}
+
 std::unique_ptr<fml::Mapping> PipelineCacheDataRetrieve(
     const fml::UniqueFD& cache_directory,
     const VkPhysicalDeviceProperties& props) {
@@ -73,29 +105,69 @@ std::unique_ptr<fml::Mapping> PipelineCacheDataRetrieve(
   if (!on_disk_data) {
     return nullptr;
   }
-  if (on_disk_data->GetSize() < sizeof(PipelineCacheHeaderVK)) {
-    VALIDATION_LOG << "Pipeline cache data size is too small.";
-    return nullptr;
-  }
-  auto on_disk_header = PipelineCacheHeaderVK{};
-  std::memcpy(&on_disk_header,             //
-              on_disk_data->GetMapping(),  //
-              sizeof(on_disk_header)       //
-  );
-  const auto current_header = PipelineCacheHeaderVK{props, 0u};
-  if (!on_disk_header.IsCompatibleWith(current_header)) {
+  auto data = PipelineCacheDataValidate(on_disk_data, props);
+  if (!data) {
     FML_LOG(WARNING)
         << "Persisted pipeline cache is not compatible with current "
            "Vulkan context. Ignoring.";
+  }
+  return data;
+}
+
+std::unique_ptr<fml::Mapping> PipelineCacheDataFindBundled(
+    const std::vector<std::shared_ptr<fml::Mapping>>& bundled_caches,
+    const VkPhysicalDeviceProperties& props) {
+  for (const auto& bundled_cache : bundled_caches) {
+    if (auto data = PipelineCacheDataValidate(bundled_cache, props)) {
+      return data;
+    }
+  }
+  return nullptr;
+}
+
+std::vector<std::shared_ptr<fml::Mapping>> PipelineCacheDataReadBundled(
+    const std::vector<std::string>& paths) {
+  std::vector<std::shared_ptr<fml::Mapping>> bundled_caches;
+  bundled_caches.reserve(paths.size());
+  for (const auto& path : paths) {
+    std::shared_ptr<fml::Mapping> mapping =
+        fml::FileMapping::CreateReadOnly(path);
+    if (!mapping) {
+      FML_LOG(INFO) << "Could not read bundled pipeline cache " << path;
+      continue;
+    }
+    bundled_caches.push_back(std::move(mapping));
+  }
+  return bundled_caches;
+}
+
+bool PipelineVariantManifestPersist(const fml::UniqueFD& cache_directory,
+                                    const fml::Mapping& manifest) {
+  if (!cache_directory.is_valid()) {
+    return false;
+  }
+  if (!fml::WriteAtomically(cache_directory, kPipelineVariantManifestFileName,
+                            manifest)) {
+    VALIDATION_LOG << "Could not write pipeline variant manifest to disk.";
+    return false;
+  }
+  return true;
+}
+
+std::unique_ptr<fml::Mapping> PipelineVariantManifestRetrieve(
+    const fml::UniqueFD& cache_directory) {
+  if (!cache_directory.is_valid()) {
     return nullptr;
   }
-  // Zero sized data is known to cause issues.
-  if (on_disk_header.data_size == 0u) {
+  std::shared_ptr<fml::FileMapping> on_disk_data =
+      fml::FileMapping::CreateReadOnly(cache_directory,
+                                       kPipelineVariantManifestFileName);
+  if (!on_disk_data || on_disk_data->GetSize() == 0u) {
     return nullptr;
   }
   return std::make_unique<fml::NonOwnedMapping>(
-      on_disk_data->GetMapping() + sizeof(on_disk_header),
-      on_disk_header.data_size, [on_disk_data](auto, auto) {});
+      on_disk_data->GetMapping(), on_disk_data->GetSize(),
+      [on_disk_data](auto, auto) {});
 }
 
 PipelineCacheHeaderVK::PipelineCacheHeaderVK() = default;
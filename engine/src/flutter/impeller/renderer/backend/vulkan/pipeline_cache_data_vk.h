@@ -5,6 +5,10 @@
 #ifndef FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_PIPELINE_CACHE_DATA_VK_H_
 #define FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_PIPELINE_CACHE_DATA_VK_H_
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "flutter/fml/mapping.h"
 #include "flutter/fml/unique_fd.h"
 #include "impeller/renderer/backend/vulkan/vk.h"
@@ -104,6 +108,80 @@ std::unique_ptr<fml::Mapping> PipelineCacheDataRetrieve(
     const fml::UniqueFD& cache_directory,
     const VkPhysicalDeviceProperties& props);
 
+//------------------------------------------------------------------------------
+/// @brief      Validate pipeline cache data in the format written by
+///             |PipelineCacheDataPersist| against the given physical device
+///             properties.
+///
+///             The data is stripped of the Impeller specific header. The
+///             returned mapping keeps the original data alive.
+///
+/// @param[in]  data   The cache data including the Impeller header.
+/// @param[in]  props  The properties
+///
+/// @return     The cache data if the header is compatible with the device and
+///             the data is not empty. nullptr otherwise.
+///
+std::unique_ptr<fml::Mapping> PipelineCacheDataValidate(
+    const std::shared_ptr<const fml::Mapping>& data,
+    const VkPhysicalDeviceProperties& props);
+
+//------------------------------------------------------------------------------
+/// @brief      Find the first pipeline cache blob bundled with the application
+///             that was generated on a device with the same vendor, device,
+///             driver version, and pipeline cache UUID as the current one.
+///
+///             Bundled blobs are |PipelineCacheDataPersist| files collected
+///             from each GPU model the application targets.
+///
+/// @param[in]  bundled_caches  The bundled cache blobs.
+/// @param[in]  props           The properties
+///
+/// @return     The cache data stripped of its header, or nullptr if no bundled
+///             blob is compatible.
+///
+std::unique_ptr<fml::Mapping> PipelineCacheDataFindBundled(
+    const std::vector<std::shared_ptr<fml::Mapping>>& bundled_caches,
+    const VkPhysicalDeviceProperties& props);
+
+//------------------------------------------------------------------------------
+/// @brief      Map the pipeline cache blobs bundled with the application from
+///             the given files, for |ContextVK::Settings|.
+///
+///             Files that can't be read are skipped.
+///
+/// @param[in]  paths  The paths of |PipelineCacheDataPersist| files.
+///
+/// @return     The mappings of the files that could be read, in order.
+///
+std::vector<std::shared_ptr<fml::Mapping>> PipelineCacheDataReadBundled(
+    const std::vector<std::string>& paths);
+
+//------------------------------------------------------------------------------
+/// @brief      Persist the manifest of pipeline variants used by the renderer
+///             next to the pipeline cache in the given cache directory.
+///
+///             The contents of the manifest are opaque to the backend.
+///
+/// @param[in]  cache_directory  The cache directory
+/// @param[in]  manifest         The manifest
+///
+/// @return     If the manifest could be persisted to disk.
+///
+bool PipelineVariantManifestPersist(const fml::UniqueFD& cache_directory,
+                                    const fml::Mapping& manifest);
+
+//------------------------------------------------------------------------------
+/// @brief      Retrieve the manifest of pipeline variants persisted by
+///             |PipelineVariantManifestPersist|.
+///
+/// @param[in]  cache_directory  The cache directory
+///
+/// @return     The manifest if one was found.
+///
+std::unique_ptr<fml::Mapping> PipelineVariantManifestRetrieve(
+    const fml::UniqueFD& cache_directory);
+
 }  // namespace impeller
 
 #endif  // FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_PIPELINE_CACHE_DATA_VK_H_
@@ -2,8 +2,11 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/file.h"
+#include "flutter/fml/paths.h"
 #include "flutter/testing/testing.h"
 #include "impeller/playground/playground_test.h"
 #include "impeller/renderer/backend/vulkan/capabilities_vk.h"
@@ -111,6 +114,115 @@ TEST(PipelineCacheDataVKTest, WritesIncompleteCacheData) {
   ASSERT_EQ(mapping->GetSize(), sizeof(header) + header.data_size);
 }
 
+static std::shared_ptr<fml::Mapping> CreateBundledCache(
+    const VkPhysicalDeviceProperties& props,
+    std::vector<uint8_t> payload) {
+  PipelineCacheHeaderVK header(props, payload.size());
+  std::vector<uint8_t> data(sizeof(header) + payload.size());
+  std::memcpy(data.data(), &header, sizeof(header));
+  std::memcpy(data.data() + sizeof(header), payload.data(), payload.size());
+  return std::make_shared<fml::DataMapping>(std::move(data));
+}
+
+TEST(PipelineCacheDataVKTest, FindsCompatibleBundledCache) {
+  vk::PhysicalDeviceProperties props;
+  props.deviceID = 10;
+  props.vendorID = 11;
+  props.driverVersion = 12;
+  auto other_driver = props;
+  other_driver.driverVersion = 13;
+
+  EXPECT_EQ(PipelineCacheDataFindBundled({}, props), nullptr);
+
+  std::vector<std::shared_ptr<fml::Mapping>> bundled = {
+      CreateBundledCache(other_driver, {1, 2, 3}),
+      CreateBundledCache(props, {4, 5, 6, 7}),
+  };
+  auto data = PipelineCacheDataFindBundled(bundled, props);
+  ASSERT_NE(data, nullptr);
+  ASSERT_EQ(data->GetSize(), 4u);
+  EXPECT_EQ(data->GetMapping()[0], 4u);
+  EXPECT_EQ(data->GetMapping()[3], 7u);
+
+  auto other_data = PipelineCacheDataFindBundled(bundled, other_driver);
+  ASSERT_NE(other_data, nullptr);
+  EXPECT_EQ(other_data->GetSize(), 3u);
+}
+
+TEST(PipelineCacheDataVKTest, RejectsTruncatedBundledCache) {
+  vk::PhysicalDeviceProperties props;
+  auto bundled = CreateBundledCache(props, {1, 2, 3, 4});
+  auto truncated = std::make_shared<fml::NonOwnedMapping>(
+      bundled->GetMapping(), bundled->GetSize() - 1u,
+      [bundled](auto, auto) {});
+  EXPECT_EQ(PipelineCacheDataValidate(truncated, props), nullptr);
+  EXPECT_EQ(PipelineCacheDataValidate(CreateBundledCache(props, {}), props),
+            nullptr);
+  EXPECT_NE(PipelineCacheDataValidate(bundled, props), nullptr);
+}
+
+TEST(PipelineCacheDataVKTest, MergesBundledCacheIntoExistingCache) {
+  fml::ScopedTemporaryDirectory temp_dir;
+  vk::PhysicalDeviceProperties props;
+  {
+    auto context = MockVulkanContextBuilder().Build();
+    auto cache = context->GetDevice().createPipelineCacheUnique({});
+    const auto& caps = CapabilitiesVK::Cast(*context->GetCapabilities());
+    props = caps.GetPhysicalDeviceProperties();
+    ASSERT_TRUE(PipelineCacheDataPersist(temp_dir.fd(), props, cache.value));
+  }
+
+  auto context = MockVulkanContextBuilder()
+                     .SetSettingsCallback([&](ContextVK::Settings& settings) {
+                       settings.cache_directory = fml::OpenDirectory(
+                           temp_dir.path().c_str(), false,
+                           fml::FilePermission::kRead);
+                       settings.bundled_pipeline_caches = {
+                           CreateBundledCache(props, {1, 2, 3, 4}),
+                       };
+                     })
+                     .Build();
+  ASSERT_NE(context, nullptr);
+  auto functions = GetMockVulkanFunctions(context->GetDevice());
+  EXPECT_NE(std::find(functions->begin(), functions->end(),
+                      "vkMergePipelineCaches"),
+            functions->end());
+}
+
+TEST(PipelineCacheDataVKTest, MergesBundledCacheReadFromFile) {
+  fml::ScopedTemporaryDirectory temp_dir;
+  vk::PhysicalDeviceProperties props;
+  {
+    auto context = MockVulkanContextBuilder().Build();
+    auto cache = context->GetDevice().createPipelineCacheUnique({});
+    const auto& caps = CapabilitiesVK::Cast(*context->GetCapabilities());
+    props = caps.GetPhysicalDeviceProperties();
+    ASSERT_TRUE(PipelineCacheDataPersist(temp_dir.fd(), props, cache.value));
+  }
+  ASSERT_TRUE(fml::WriteAtomically(temp_dir.fd(), "bundled.vkcache",
+                                   *CreateBundledCache(props, {1, 2, 3, 4})));
+
+  auto bundled = PipelineCacheDataReadBundled({
+      fml::paths::JoinPaths({temp_dir.path(), "missing.vkcache"}),
+      fml::paths::JoinPaths({temp_dir.path(), "bundled.vkcache"}),
+  });
+  ASSERT_EQ(bundled.size(), 1u);
+
+  auto context = MockVulkanContextBuilder()
+                     .SetSettingsCallback([&](ContextVK::Settings& settings) {
+                       settings.cache_directory = fml::OpenDirectory(
+                           temp_dir.path().c_str(), false,
+                           fml::FilePermission::kRead);
+                       settings.bundled_pipeline_caches = bundled;
+                     })
+                     .Build();
+  ASSERT_NE(context, nullptr);
+  auto functions = GetMockVulkanFunctions(context->GetDevice());
+  EXPECT_NE(std::find(functions->begin(), functions->end(),
+                      "vkMergePipelineCaches"),
+            functions->end());
+}
+
 using PipelineCacheDataVKPlaygroundTest = PlaygroundTest;
 INSTANTIATE_VULKAN_PLAYGROUND_SUITE(PipelineCacheDataVKPlaygroundTest);
 
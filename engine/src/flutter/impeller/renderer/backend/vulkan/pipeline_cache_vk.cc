@@ -15,9 +15,11 @@
 
 namespace impeller {
 
-PipelineCacheVK::PipelineCacheVK(std::shared_ptr<const Capabilities> caps,
-                                 std::shared_ptr<DeviceHolderVK> device_holder,
-                                 fml::UniqueFD cache_directory)
+PipelineCacheVK::PipelineCacheVK(
+    std::shared_ptr<const Capabilities> caps,
+    std::shared_ptr<DeviceHolderVK> device_holder,
+    fml::UniqueFD cache_directory,
+    const std::vector<std::shared_ptr<fml::Mapping>>& bundled_caches)
     : caps_(std::move(caps)),
       device_holder_(device_holder),
       cache_directory_(std::move(cache_directory)) {
@@ -30,6 +32,16 @@ PipelineCacheVK::PipelineCacheVK(std::shared_ptr<const Capabilities> caps,
   auto existing_cache_data = PipelineCacheDataRetrieve(
       cache_directory_, vk_caps.GetPhysicalDeviceProperties());
 
+  auto bundled_cache_data = PipelineCacheDataFindBundled(
+      bundled_caches, vk_caps.GetPhysicalDeviceProperties());
+
+  // With nothing on disk yet (first launch), the bundled cache can bootstrap
+  // the cache directly. Otherwise it is merged in below so that pipelines
+  // added by a newer bundle are picked up by existing installs too.
+  if (!existing_cache_data && bundled_cache_data) {
+    existing_cache_data = std::move(bundled_cache_data);
+  }
+
   vk::PipelineCacheCreateInfo cache_info;
   if (existing_cache_data) {
     cache_info.initialDataSize = existing_cache_data->GetSize();
@@ -59,9 +71,33 @@ PipelineCacheVK::PipelineCacheVK(std::shared_ptr<const Capabilities> caps,
     }
   }
 
+  if (cache_ && bundled_cache_data) {
+    MergeBundledCache(device_holder->GetDevice(), *bundled_cache_data);
+  }
+
   is_valid_ = !!cache_;
 }
 
+void PipelineCacheVK::MergeBundledCache(const vk::Device& device,
+                                        const fml::Mapping& bundled_data) {
+  vk::PipelineCacheCreateInfo bundled_info;
+  bundled_info.initialDataSize = bundled_data.GetSize();
+  bundled_info.pInitialData = bundled_data.GetMapping();
+  auto [result, bundled_cache] =
+      device.createPipelineCacheUnique(bundled_info);
+  if (result != vk::Result::eSuccess) {
+    // The header matched but the driver may still reject the data.
+    FML_LOG(INFO) << "Bundled pipeline cache was invalid: "
+                  << vk::to_string(result) << ". Ignoring.";
+    return;
+  }
+  auto merge_result = device.mergePipelineCaches(*cache_, {*bundled_cache});
+  if (merge_result != vk::Result::eSuccess) {
+    FML_LOG(INFO) << "Could not merge bundled pipeline cache: "
+                  << vk::to_string(merge_result) << ". Ignoring.";
+  }
+}
+
 PipelineCacheVK::~PipelineCacheVK() {
   std::shared_ptr<DeviceHolderVK> device_holder = device_holder_.lock();
   if (device_holder) {
@@ -122,6 +158,23 @@ void PipelineCacheVK::PersistCacheToDisk() {
   );
 }
 
+void PipelineCacheVK::PersistVariantManifestToDisk(
+    const fml::Mapping& manifest) {
+  // Serialized with the cache data for the same reason as above.
+  Lock persist_lock(persist_mutex_);
+  if (!is_valid_) {
+    return;
+  }
+  PipelineVariantManifestPersist(cache_directory_, manifest);
+}
+
+std::unique_ptr<fml::Mapping> PipelineCacheVK::RetrieveVariantManifest() const {
+  if (!is_valid_) {
+    return nullptr;
+  }
+  return PipelineVariantManifestRetrieve(cache_directory_);
+}
+
 const CapabilitiesVK* PipelineCacheVK::GetCapabilities() const {
   return CapabilitiesVK::Cast(caps_.get());
 }
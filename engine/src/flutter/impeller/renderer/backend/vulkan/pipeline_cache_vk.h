@@ -5,7 +5,10 @@
 #ifndef FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_PIPELINE_CACHE_VK_H_
 #define FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_PIPELINE_CACHE_VK_H_
 
+#include <vector>
+
 #include "flutter/fml/file.h"
+#include "flutter/fml/mapping.h"
 #include "impeller/base/thread.h"
 #include "impeller/renderer/backend/vulkan/capabilities_vk.h"
 #include "impeller/renderer/backend/vulkan/device_holder_vk.h"
@@ -18,9 +21,14 @@ class PipelineCacheVK {
   // constructor directly. The [device_holder] isn't guaranteed to be valid
   // at the time of executing `PipelineCacheVK` because of how `ContextVK` does
   // initialization.
-  explicit PipelineCacheVK(std::shared_ptr<const Capabilities> caps,
-                           std::shared_ptr<DeviceHolderVK> device_holder,
-                           fml::UniqueFD cache_directory);
+  //
+  // Any [bundled_caches] compatible with the current device are merged into
+  // the cache retrieved from [cache_directory].
+  explicit PipelineCacheVK(
+      std::shared_ptr<const Capabilities> caps,
+      std::shared_ptr<DeviceHolderVK> device_holder,
+      fml::UniqueFD cache_directory,
+      const std::vector<std::shared_ptr<fml::Mapping>>& bundled_caches = {});
 
   ~PipelineCacheVK();
 
@@ -34,6 +42,10 @@ class PipelineCacheVK {
 
   void PersistCacheToDisk();
 
+  void PersistVariantManifestToDisk(const fml::Mapping& manifest);
+
+  std::unique_ptr<fml::Mapping> RetrieveVariantManifest() const;
+
  private:
   const std::shared_ptr<const Capabilities> caps_;
   std::weak_ptr<DeviceHolderVK> device_holder_;
@@ -42,6 +54,9 @@ class PipelineCacheVK {
   bool is_valid_ = false;
   Mutex persist_mutex_;
 
+  void MergeBundledCache(const vk::Device& device,
+                         const fml::Mapping& bundled_data);
+
   PipelineCacheVK(const PipelineCacheVK&) = delete;
 
   PipelineCacheVK& operator=(const PipelineCacheVK&) = delete;
@@ -7,6 +7,7 @@
 #include <cstdint>
 
 #include "flutter/fml/container.h"
+#include "flutter/fml/time/time_point.h"
 #include "flutter/fml/trace_event.h"
 #include "impeller/base/promise.h"
 #include "impeller/base/validation.h"
@@ -21,11 +22,13 @@ PipelineLibraryVK::PipelineLibraryVK(
     const std::shared_ptr<DeviceHolderVK>& device_holder,
     std::shared_ptr<const Capabilities> caps,
     fml::UniqueFD cache_directory,
-    std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner)
+    std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner,
+    const std::vector<std::shared_ptr<fml::Mapping>>& bundled_caches)
     : device_holder_(device_holder),
       pso_cache_(std::make_shared<PipelineCacheVK>(std::move(caps),
                                                    device_holder,
-                                                   std::move(cache_directory))),
+                                                   std::move(cache_directory),
+                                                   bundled_caches)),
       worker_task_runner_(std::move(worker_task_runner)) {
   FML_DCHECK(worker_task_runner_);
   if (!pso_cache_->IsValid() || !worker_task_runner_) {
@@ -184,12 +187,15 @@ PipelineFuture<PipelineDescriptor> PipelineLibraryVK::GetPipeline(
       return;
     }
 
-    promise->set_value(PipelineVK::Create(
+    const fml::TimePoint compile_start = fml::TimePoint::Now();
+    auto pipeline = PipelineVK::Create(
         descriptor,                                            //
         PipelineLibraryVK::Cast(*thiz).device_holder_.lock(),  //
         weak_this,                                             //
         next_key                                               //
-        ));
+    );
+    thiz->LogPipelineCompile(fml::TimePoint::Now() - compile_start);
+    promise->set_value(std::move(pipeline));
   };
 
   if (async) {
@@ -295,6 +301,27 @@ void PipelineLibraryVK::PersistPipelineCacheToDisk() {
       });
 }
 
+std::unique_ptr<fml::Mapping>
+PipelineLibraryVK::RetrievePipelineVariantManifest() const {
+  return pso_cache_->RetrieveVariantManifest();
+}
+
+void PipelineLibraryVK::PersistPipelineVariantManifest(
+    std::shared_ptr<const fml::Mapping> manifest) {
+  if (!manifest) {
+    return;
+  }
+  worker_task_runner_->PostTask(
+      [weak_cache = decltype(pso_cache_)::weak_type(pso_cache_),
+       manifest = std::move(manifest)]() {
+        auto cache = weak_cache.lock();
+        if (!cache) {
+          return;
+        }
+        cache->PersistVariantManifestToDisk(*manifest);
+      });
+}
+
 const std::shared_ptr<PipelineCacheVK>& PipelineLibraryVK::GetPSOCache() const {
   return pso_cache_;
 }
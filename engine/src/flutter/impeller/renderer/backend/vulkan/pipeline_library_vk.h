@@ -53,7 +53,8 @@ class PipelineLibraryVK final
       const std::shared_ptr<DeviceHolderVK>& device_holder,
       std::shared_ptr<const Capabilities> caps,
       fml::UniqueFD cache_directory,
-      std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner);
+      std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner,
+      const std::vector<std::shared_ptr<fml::Mapping>>& bundled_caches = {});
 
   // |PipelineLibrary|
   bool IsValid() const override;
@@ -76,6 +77,14 @@ class PipelineLibraryVK final
   void RemovePipelinesWithEntryPoint(
       std::shared_ptr<const ShaderFunction> function) override;
 
+  // |PipelineLibrary|
+  std::unique_ptr<fml::Mapping> RetrievePipelineVariantManifest()
+      const override;
+
+  // |PipelineLibrary|
+  void PersistPipelineVariantManifest(
+      std::shared_ptr<const fml::Mapping> manifest) override;
+
   std::unique_ptr<ComputePipelineVK> CreateComputePipeline(
       const ComputePipelineDescriptor& desc,
       PipelineKey pipeline_key);
@@ -9,6 +9,7 @@
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/status_or.h"
 #include "flutter/fml/trace_event.h"
+#include "flutter/fml/trace_recorder.h"
 #include "impeller/base/timing.h"
 #include "impeller/renderer/backend/vulkan/capabilities_vk.h"
 #include "impeller/renderer/backend/vulkan/context_vk.h"
@@ -468,6 +469,7 @@ std::unique_ptr<PipelineVK> PipelineVK::Create(
     PipelineKey pipeline_key,
     std::shared_ptr<SamplerVK> immutable_sampler) {
   TRACE_EVENT1("flutter", "PipelineVK::Create", "Name", desc.GetLabel().data());
+  fml::tracing::ScopedRecordedEvent recorded_event("PipelineVK::Create");
 
   auto library = weak_library.lock();
 
@@ -4,6 +4,7 @@
 
 #include "impeller/renderer/backend/vulkan/render_pass_vk.h"
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 
@@ -15,6 +16,7 @@
 #include "impeller/core/texture.h"
 #include "impeller/core/vertex_buffer.h"
 #include "impeller/renderer/backend/vulkan/barrier_vk.h"
+#include "impeller/renderer/backend/vulkan/capabilities_vk.h"
 #include "impeller/renderer/backend/vulkan/command_buffer_vk.h"
 #include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/device_buffer_vk.h"
@@ -34,6 +36,11 @@ namespace impeller {
 // See: impeller/entity/shaders/blending/framebuffer_blend.frag
 static constexpr size_t kMagicSubpassInputBinding = 64u;
 
+template <class T>
+static uint64_t ToDescriptorKeyHandle(T handle) {
+  return reinterpret_cast<uint64_t>(static_cast<typename T::CType>(handle));
+}
+
 static vk::ClearColorValue VKClearValueFromColor(Color color) {
   vk::ClearColorValue value;
   value.setFloat32(
@@ -225,6 +232,7 @@ RenderPassVK::RenderPassVK(const std::shared_ptr<const Context>& context,
   pass_info.setPClearValues(clears.data());
   pass_info.setClearValueCount(clear_count);
 
+  command_buffer_->GetGPUProbe().RecordPassStart(command_buffer_vk_);
   command_buffer_vk_.beginRenderPass(pass_info, vk::SubpassContents::eInline);
 
   if (resolve_image_vk_) {
@@ -271,6 +279,7 @@ bool RenderPassVK::IsValid() const {
 
 void RenderPassVK::OnSetLabel(std::string_view label) {
 #ifdef IMPELLER_DEBUG
+  debug_label_ = std::string(label);
   ContextVK::Cast(*context_).SetDebugName(render_pass_->Get(), label.data());
 #endif  // IMPELLER_DEBUG
 }
@@ -359,6 +368,13 @@ void RenderPassVK::SetPipeline(PipelineRef pipeline) {
     write_set.pImageInfo = &image_workspace_[bound_image_offset_ - 1];
 
     write_workspace_[descriptor_write_offset_++] = write_set;
+    descriptor_set_key_.bindings.push_back(DescriptorBindingKeyVK{
+        .binding = kMagicSubpassInputBinding,
+        .type = vk::DescriptorType::eInputAttachment,
+        .resource_id = TextureVK::Cast(*color_image_vk_).GetUniqueID().id,
+        .handle = ToDescriptorKeyHandle(image_info.imageView),
+        .offset = static_cast<uint64_t>(image_info.imageLayout),
+    });
   }
 }
 
@@ -483,6 +499,77 @@ bool RenderPassVK::SetIndexBuffer(BufferView index_buffer,
 
 // |RenderPass|
 fml::Status RenderPassVK::Draw() {
+  fml::Status status = EncodeCommandState();
+  if (!status.ok()) {
+    return status;
+  }
+
+  if (has_index_buffer_) {
+    command_buffer_vk_.drawIndexed(element_count_,   // index count
+                                   instance_count_,  // instance count
+                                   0u,               // first index
+                                   base_vertex_,     // vertex offset
+                                   0u                // first instance
+    );
+  } else {
+    command_buffer_vk_.draw(element_count_,   // vertex count
+                            instance_count_,  // instance count
+                            base_vertex_,     // vertex offset
+                            0u                // first instance
+    );
+  }
+
+  ResetCommandState();
+  return fml::Status();
+}
+
+fml::Status RenderPassVK::DrawIndirect(BufferView indirect_buffer,
+                                       uint32_t draw_count,
+                                       uint32_t stride) {
+  if (!ValidateIndirectBuffer(indirect_buffer, draw_count, stride,
+                              has_index_buffer_)) {
+    return fml::Status(fml::StatusCode::kInvalidArgument,
+                       "Invalid indirect draw arguments.");
+  }
+
+  fml::Status status = EncodeCommandState();
+  if (!status.ok()) {
+    return status;
+  }
+
+  vk::Buffer buffer =
+      DeviceBufferVK::Cast(*indirect_buffer.GetBuffer()).GetBuffer();
+  const vk::DeviceSize offset = indirect_buffer.GetRange().offset;
+  std::shared_ptr<const DeviceBuffer> device_buffer =
+      indirect_buffer.TakeBuffer();
+  if (device_buffer && !command_buffer_->Track(device_buffer)) {
+    return fml::Status(fml::StatusCode::kAborted,
+                       "Could not track the indirect buffer.");
+  }
+
+  // Without multi-draw support each call may only issue a single draw.
+  const auto& caps = CapabilitiesVK::Cast(*context_->GetCapabilities());
+  const uint32_t max_draws_per_call =
+      caps.SupportsMultiDrawIndirect()
+          ? caps.GetPhysicalDeviceProperties().limits.maxDrawIndirectCount
+          : 1u;
+  for (uint32_t i = 0u; i < draw_count; i += max_draws_per_call) {
+    const uint32_t count = std::min(max_draws_per_call, draw_count - i);
+    const vk::DeviceSize draw_offset =
+        offset + static_cast<vk::DeviceSize>(i) * stride;
+    if (has_index_buffer_) {
+      command_buffer_vk_.drawIndexedIndirect(buffer, draw_offset, count,
+                                             stride);
+    } else {
+      command_buffer_vk_.drawIndirect(buffer, draw_offset, count, stride);
+    }
+  }
+
+  ResetCommandState();
+  return fml::Status();
+}
+
+fml::Status RenderPassVK::EncodeCommandState() {
   if (!pipeline_) {
     return fml::Status(fml::StatusCode::kCancelled,
                        "No valid pipeline is bound to the RenderPass.");
@@ -520,25 +607,39 @@ fml::Status RenderPassVK::Draw() {
   const auto& context_vk = ContextVK::Cast(*context_);
   const auto& pipeline_vk = PipelineVK::Cast(*pipeline_);
 
-  auto descriptor_result = command_buffer_->AllocateDescriptorSets(
-      pipeline_vk.GetDescriptorSetLayout(), pipeline_vk.GetPipelineKey(),
-      context_vk);
-  if (!descriptor_result.ok()) {
-    return fml::Status(fml::StatusCode::kAborted,
-                       "Could not allocate descriptor sets.");
+  // Draws that bind exactly the same resources as an earlier draw with this
+  // pipeline can reuse its descriptor set without allocating or updating one.
+  DescriptorPoolVK& descriptor_pool = command_buffer_->GetDescriptorPool();
+  std::optional<vk::DescriptorSet> retained_set =
+      descriptor_pool.FindRetainedDescriptorSet(pipeline_vk.GetPipelineKey(),
+                                                descriptor_set_key_);
+  vk::DescriptorSet descriptor_set;
+  if (retained_set.has_value()) {
+    descriptor_set = retained_set.value();
+  } else {
+    auto descriptor_result = command_buffer_->AllocateDescriptorSets(
+        pipeline_vk.GetDescriptorSetLayout(), pipeline_vk.GetPipelineKey(),
+        context_vk);
+    if (!descriptor_result.ok()) {
+      return fml::Status(fml::StatusCode::kAborted,
+                         "Could not allocate descriptor sets.");
+    }
+    descriptor_set = descriptor_result.value();
+
+    for (auto i = 0u; i < descriptor_write_offset_; i++) {
+      write_workspace_[i].dstSet = descriptor_set;
+    }
+
+    context_vk.GetDevice().updateDescriptorSets(
+        descriptor_write_offset_, write_workspace_.data(), 0u, {});
+    descriptor_pool.RetainDescriptorSet(pipeline_vk.GetPipelineKey(),
+                                        descriptor_set_key_, descriptor_set);
   }
-  const auto descriptor_set = descriptor_result.value();
+
   const auto pipeline_layout = pipeline_vk.GetPipelineLayout();
   command_buffer_vk_.bindPipeline(vk::PipelineBindPoint::eGraphics,
                                   pipeline_vk.GetPipeline());
 
-  for (auto i = 0u; i < descriptor_write_offset_; i++) {
-    write_workspace_[i].dstSet = descriptor_set;
-  }
-
-  context_vk.GetDevice().updateDescriptorSets(descriptor_write_offset_,
-                                              write_workspace_.data(), 0u, {});
-
   command_buffer_vk_.bindDescriptorSets(
       vk::PipelineBindPoint::eGraphics,  // bind point
       pipeline_layout,                   // layout
@@ -554,21 +655,10 @@ fml::Status RenderPassVK::Draw() {
         command_buffer_vk_, TextureVK::Cast(*color_image_vk_).GetImage());
   }
 
-  if (has_index_buffer_) {
-    command_buffer_vk_.drawIndexed(element_count_,   // index count
-                                   instance_count_,  // instance count
-                                   0u,               // first index
-                                   base_vertex_,     // vertex offset
-                                   0u                // first instance
-    );
-  } else {
-    command_buffer_vk_.draw(element_count_,   // vertex count
-                            instance_count_,  // instance count
-                            base_vertex_,     // vertex offset
-                            0u                // first instance
-    );
-  }
+  return fml::Status();
+}
 
+void RenderPassVK::ResetCommandState() {
 #ifdef IMPELLER_DEBUG
   if (has_label_) {
     command_buffer_->PopDebugGroup();
@@ -579,13 +669,13 @@ fml::Status RenderPassVK::Draw() {
   bound_image_offset_ = 0u;
   bound_buffer_offset_ = 0u;
   descriptor_write_offset_ = 0u;
+  descriptor_set_key_.bindings.clear();
   instance_count_ = 1u;
   base_vertex_ = 0u;
   element_count_ = 0u;
   pipeline_ = PipelineRef(nullptr);
   pipeline_uses_input_attachments_ = false;
   immutable_sampler_ = nullptr;
-  return fml::Status();
 }
 
 // The RenderPassVK binding methods only need the binding, set, and buffer type
@@ -638,6 +728,14 @@ bool RenderPassVK::BindResource(size_t binding,
   write_set.pBufferInfo = &buffer_workspace_[bound_buffer_offset_ - 1];
 
   write_workspace_[descriptor_write_offset_++] = write_set;
+  descriptor_set_key_.bindings.push_back(DescriptorBindingKeyVK{
+      .binding = static_cast<uint32_t>(binding),
+      .type = write_set.descriptorType,
+      .resource_id = DeviceBufferVK::Cast(*view.GetBuffer()).GetUniqueID().id,
+      .handle = ToDescriptorKeyHandle(buffer),
+      .offset = buffer_info.offset,
+      .range = buffer_info.range,
+  });
   return true;
 }
 
@@ -686,11 +784,21 @@ bool RenderPassVK::BindResource(ShaderStage stage,
   write_set.pImageInfo = &image_workspace_[bound_image_offset_ - 1];
 
   write_workspace_[descriptor_write_offset_++] = write_set;
+  descriptor_set_key_.bindings.push_back(DescriptorBindingKeyVK{
+      .binding = static_cast<uint32_t>(slot.binding),
+      .type = vk::DescriptorType::eCombinedImageSampler,
+      .resource_id = texture_vk.GetUniqueID().id,
+      .handle = ToDescriptorKeyHandle(image_info.imageView),
+      .sampler = ToDescriptorKeyHandle(image_info.sampler),
+      .offset = static_cast<uint64_t>(image_info.imageLayout),
+  });
   return true;
 }
 
 bool RenderPassVK::OnEncodeCommands(const Context& context) const {
   command_buffer_->GetCommandBuffer().endRenderPass();
+  command_buffer_->GetGPUProbe().RecordPassEnd(
+      command_buffer_vk_, debug_label_.empty() ? "RenderPass" : debug_label_);
   return true;
 }
 
@@ -7,6 +7,7 @@
 
 #include "impeller/core/buffer_view.h"
 #include "impeller/renderer/backend/vulkan/context_vk.h"
+#include "impeller/renderer/backend/vulkan/descriptor_pool_vk.h"
 #include "impeller/renderer/backend/vulkan/pipeline_vk.h"
 #include "impeller/renderer/backend/vulkan/shared_object_vk.h"
 #include "impeller/renderer/command_buffer.h"
@@ -44,6 +45,7 @@ class RenderPassVK final : public RenderPass {
   size_t bound_image_offset_ = 0u;
   size_t bound_buffer_offset_ = 0u;
   size_t descriptor_write_offset_ = 0u;
+  DescriptorSetKeyVK descriptor_set_key_;
   size_t instance_count_ = 1u;
   size_t base_vertex_ = 0u;
   size_t element_count_ = 0u;
@@ -91,6 +93,17 @@ class RenderPassVK final : public RenderPass {
   // |RenderPass|
   fml::Status Draw() override;
 
+  // |RenderPass|
+  fml::Status DrawIndirect(BufferView indirect_buffer,
+                           uint32_t draw_count,
+                           uint32_t stride) override;
+
+  /// Binds the pipeline and descriptor set for the pending command.
+  fml::Status EncodeCommandState();
+
+  /// Clears the pending command state after a draw has been recorded.
+  void ResetCommandState();
+
   // |ResourceBinder|
   bool BindResource(ShaderStage stage,
                     DescriptorType type,
@@ -19,6 +19,22 @@ void SamplerLibraryVK::ApplyWorkarounds(const WorkaroundsVK& workarounds) {
   mips_disabled_workaround_ = workarounds.broken_mipmap_generation;
 }
 
+void SamplerLibraryVK::CreateCommonSamplers() {
+  // The default sampler and the ones that `DlImageSampling` maps to.
+  static const SamplerDescriptor kCommonSamplers[] = {
+      SamplerDescriptor(),
+      SamplerDescriptor("Nearest Sampler", MinMagFilter::kNearest,
+                        MinMagFilter::kNearest, MipFilter::kBase),
+      SamplerDescriptor("Linear Sampler", MinMagFilter::kLinear,
+                        MinMagFilter::kLinear, MipFilter::kBase),
+      SamplerDescriptor("Mipmap Linear Sampler", MinMagFilter::kLinear,
+                        MinMagFilter::kLinear, MipFilter::kLinear),
+  };
+  for (const SamplerDescriptor& desc : kCommonSamplers) {
+    GetSampler(desc);
+  }
+}
+
 raw_ptr<const Sampler> SamplerLibraryVK::GetSampler(
     const SamplerDescriptor& desc) {
   SamplerDescriptor desc_copy = desc;
@@ -25,6 +25,12 @@ class SamplerLibraryVK final
 
   void ApplyWorkarounds(const WorkaroundsVK& workarounds);
 
+  /// @brief Create the samplers used by the common image sampling options
+  ///        ahead of time so that the first frames don't create them.
+  ///
+  ///        Must be called after the workarounds are applied.
+  void CreateCommonSamplers();
+
  private:
   friend class ContextVK;
 
@@ -0,0 +1,154 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/renderer/backend/vulkan/swapchain/khr/khr_present_tuner_vk.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "flutter/fml/trace_event.h"
+
+namespace impeller {
+
+KHRPresentTunerVK::KHRPresentTunerVK(KHRPresentSettingsVK settings)
+    : settings_(settings) {}
+
+KHRPresentTunerVK::~KHRPresentTunerVK() = default;
+
+void KHRPresentTunerVK::SetSurfaceLimits(
+    std::vector<vk::PresentModeKHR> supported_modes,
+    uint32_t min_image_count,
+    uint32_t max_image_count) {
+  supported_modes_ = std::move(supported_modes);
+  min_image_count_ = std::max(min_image_count, 1u);
+  max_image_count_ = max_image_count;
+}
+
+vk::PresentModeKHR KHRPresentTunerVK::GetPresentMode() const {
+  return GetPresentMode(level_);
+}
+
+uint32_t KHRPresentTunerVK::GetImageCount() const {
+  return GetImageCount(level_);
+}
+
+bool KHRPresentTunerVK::IsSupported(vk::PresentModeKHR mode) const {
+  return std::find(supported_modes_.begin(), supported_modes_.end(), mode) !=
+         supported_modes_.end();
+}
+
+vk::PresentModeKHR KHRPresentTunerVK::GetPresentMode(Level level) const {
+  // FIFO is the only mode the presentation engine is required to support.
+  switch (settings_.policy) {
+    case KHRPresentPolicyVK::kFifo:
+      return vk::PresentModeKHR::eFifo;
+    case KHRPresentPolicyVK::kFifoRelaxed:
+      return IsSupported(vk::PresentModeKHR::eFifoRelaxed)
+                 ? vk::PresentModeKHR::eFifoRelaxed
+                 : vk::PresentModeKHR::eFifo;
+    case KHRPresentPolicyVK::kMailbox:
+      return IsSupported(vk::PresentModeKHR::eMailbox)
+                 ? vk::PresentModeKHR::eMailbox
+                 : vk::PresentModeKHR::eFifo;
+    case KHRPresentPolicyVK::kAuto:
+      return level == Level::kFifoRelaxedExtraImage &&
+                     IsSupported(vk::PresentModeKHR::eFifoRelaxed)
+                 ? vk::PresentModeKHR::eFifoRelaxed
+                 : vk::PresentModeKHR::eFifo;
+  }
+  return vk::PresentModeKHR::eFifo;
+}
+
+uint32_t KHRPresentTunerVK::GetImageCount(Level level) const {
+  uint32_t count = settings_.image_count == 0u ? min_image_count_ + 1u
+                                               : settings_.image_count;
+  if (settings_.policy == KHRPresentPolicyVK::kAuto && level != Level::kFifo) {
+    count++;
+  }
+  // A max of zero means there is no limit.
+  const uint32_t max_count = max_image_count_ == 0u
+                                 ? std::numeric_limits<uint32_t>::max()
+                                 : max_image_count_;
+  return std::clamp(count, min_image_count_, max_count);
+}
+
+bool KHRPresentTunerVK::StepTo(Level level) {
+  if (GetPresentMode(level) == GetPresentMode(level_) &&
+      GetImageCount(level) == GetImageCount(level_)) {
+    return false;
+  }
+  level_ = level;
+  return true;
+}
+
+void KHRPresentTunerVK::ResetWindow() {
+  window_frames_ = 0u;
+  window_blocked_frames_ = 0u;
+  window_late_frames_ = 0u;
+  shortest_interval_ = fml::TimeDelta::Max();
+}
+
+bool KHRPresentTunerVK::RecordFrame(fml::TimeDelta acquire_wait,
+                                    fml::TimeDelta frame_interval) {
+  if (settings_.policy != KHRPresentPolicyVK::kAuto ||
+      frame_interval <= fml::TimeDelta::Zero()) {
+    return false;
+  }
+
+  window_frames_++;
+  shortest_interval_ = std::min(shortest_interval_, frame_interval);
+  // Blocking for more than half the frame means the frame was queued behind
+  // the ones already waiting for presentation.
+  if (acquire_wait * 2 > frame_interval) {
+    window_blocked_frames_++;
+  } else if (frame_interval * 2 > shortest_interval_ * 3) {
+    window_late_frames_++;
+  }
+
+  if (window_frames_ < kWindowSize) {
+    return false;
+  }
+
+  bool changed = false;
+  if (window_blocked_frames_ * 2 > window_frames_) {
+    // Latency bound. Prefer fewer queued frames.
+    switch (level_) {
+      case Level::kFifo:
+        break;
+      case Level::kFifoExtraImage:
+        changed = StepTo(Level::kFifo);
+        break;
+      case Level::kFifoRelaxedExtraImage:
+        changed = StepTo(Level::kFifoExtraImage);
+        break;
+    }
+  } else if (window_late_frames_ * 10 > window_frames_) {
+    // Frames keep missing the vertical blank. Buffer more, then tear.
+    switch (level_) {
+      case Level::kFifo:
+        changed = StepTo(Level::kFifoExtraImage) ||
+                  StepTo(Level::kFifoRelaxedExtraImage);
+        break;
+      case Level::kFifoExtraImage:
+        changed = StepTo(Level::kFifoRelaxedExtraImage);
+        break;
+      case Level::kFifoRelaxedExtraImage:
+        break;
+    }
+  }
+  ResetWindow();
+
+  if (changed) {
+    FML_TRACE_COUNTER("flutter", "KHRPresentTunerVK",
+                      reinterpret_cast<int64_t>(this),  // Trace Counter ID
+                      "ImageCount", GetImageCount(),    //
+                      "FifoRelaxed",
+                      GetPresentMode() == vk::PresentModeKHR::eFifoRelaxed ? 1
+                                                                           : 0);
+  }
+  return changed;
+}
+
+}  // namespace impeller
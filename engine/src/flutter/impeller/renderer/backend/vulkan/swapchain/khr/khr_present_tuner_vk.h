@@ -0,0 +1,139 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_SWAPCHAIN_KHR_KHR_PRESENT_TUNER_VK_H_
+#define FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_SWAPCHAIN_KHR_KHR_PRESENT_TUNER_VK_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "flutter/fml/time/time_delta.h"
+#include "impeller/renderer/backend/vulkan/vk.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      How the present mode of a KHR swapchain is picked.
+///
+enum class KHRPresentPolicyVK {
+  /// Always use FIFO, which every presentation engine supports.
+  kFifo,
+  /// Use FIFO_RELAXED if supported. Late frames tear instead of waiting for
+  /// the next vertical blank.
+  kFifoRelaxed,
+  /// Use MAILBOX if supported. Acquisition rarely blocks, but frames that are
+  /// replaced before the vertical blank are rendered for nothing.
+  kMailbox,
+  /// Start with FIFO and adapt the present mode and image count to the
+  /// acquire waits and frame intervals measured at runtime.
+  kAuto,
+};
+
+//------------------------------------------------------------------------------
+/// @brief      The embedder facing settings of KHR swapchains.
+///
+struct KHRPresentSettingsVK {
+  KHRPresentPolicyVK policy = KHRPresentPolicyVK::kFifo;
+  /// The number of swapchain images to request, clamped to the surface
+  /// limits. Zero picks one more than the surface minimum.
+  uint32_t image_count = 0u;
+};
+
+//------------------------------------------------------------------------------
+/// @brief      Picks the present mode and image count of a KHR swapchain and,
+///             with |KHRPresentPolicyVK::kAuto|, tunes them at runtime.
+///
+///             Every frame reports how long acquiring the drawable blocked
+///             and how long it was since the previous acquisition. Over a
+///             window of frames:
+///
+///             - If acquisition blocks for most of the frame interval, frames
+///               are queued ahead of the display, which adds latency. The
+///               tuner steps towards fewer images, then back to FIFO.
+///             - If acquisition barely blocks but frame intervals often
+///               exceed the shortest one seen by half, frames miss their
+///               vertical blank. The tuner steps towards an extra image, then
+///               FIFO_RELAXED.
+///
+///             MAILBOX is only used when requested since the renderer can't
+///             tell how many of its frames were dropped.
+///
+class KHRPresentTunerVK {
+ public:
+  /// The number of frames measured before a decision is made.
+  static constexpr size_t kWindowSize = 120u;
+
+  explicit KHRPresentTunerVK(KHRPresentSettingsVK settings = {});
+
+  ~KHRPresentTunerVK();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Update the limits of the surface the next swapchain is
+  ///             created for.
+  ///
+  void SetSurfaceLimits(std::vector<vk::PresentModeKHR> supported_modes,
+                        uint32_t min_image_count,
+                        uint32_t max_image_count);
+
+  //----------------------------------------------------------------------------
+  /// @return     The present mode to create the swapchain with.
+  ///
+  vk::PresentModeKHR GetPresentMode() const;
+
+  //----------------------------------------------------------------------------
+  /// @return     The image count to create the swapchain with.
+  ///
+  uint32_t GetImageCount() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Record the timings of one acquired frame.
+  ///
+  /// @param[in]  acquire_wait    How long acquiring the drawable blocked.
+  /// @param[in]  frame_interval  The time since the previous acquisition.
+  ///
+  /// @return     If the present mode or image count changed and the swapchain
+  ///             should be recreated.
+  ///
+  bool RecordFrame(fml::TimeDelta acquire_wait, fml::TimeDelta frame_interval);
+
+ private:
+  // The configurations the auto policy can step through, from the lowest
+  // latency to the most tolerant of late frames.
+  enum class Level {
+    kFifo,
+    kFifoExtraImage,
+    kFifoRelaxedExtraImage,
+  };
+
+  KHRPresentSettingsVK settings_;
+  std::vector<vk::PresentModeKHR> supported_modes_ = {
+      vk::PresentModeKHR::eFifo};
+  uint32_t min_image_count_ = 1u;
+  uint32_t max_image_count_ = 0u;
+  Level level_ = Level::kFifo;
+
+  size_t window_frames_ = 0u;
+  size_t window_blocked_frames_ = 0u;
+  size_t window_late_frames_ = 0u;
+  fml::TimeDelta shortest_interval_ = fml::TimeDelta::Max();
+
+  bool IsSupported(vk::PresentModeKHR mode) const;
+
+  vk::PresentModeKHR GetPresentMode(Level level) const;
+
+  uint32_t GetImageCount(Level level) const;
+
+  // Move to the given level if that changes the swapchain configuration.
+  bool StepTo(Level level);
+
+  void ResetWindow();
+
+  KHRPresentTunerVK(const KHRPresentTunerVK&) = delete;
+
+  KHRPresentTunerVK& operator=(const KHRPresentTunerVK&) = delete;
+};
+
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_SWAPCHAIN_KHR_KHR_PRESENT_TUNER_VK_H_
@@ -0,0 +1,107 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "gtest/gtest.h"
+#include "impeller/renderer/backend/vulkan/swapchain/khr/khr_present_tuner_vk.h"
+
+namespace impeller {
+namespace testing {
+
+namespace {
+
+const std::vector<vk::PresentModeKHR> kAllModes = {
+    vk::PresentModeKHR::eFifo,
+    vk::PresentModeKHR::eFifoRelaxed,
+    vk::PresentModeKHR::eMailbox,
+};
+
+// Record a full window of frames, the given number of which are late. The late
+// frames come last so that the shortest interval is known by then.
+bool RecordWindow(KHRPresentTunerVK& tuner,
+                  size_t late_frames,
+                  fml::TimeDelta acquire_wait = fml::TimeDelta::Zero()) {
+  bool changed = false;
+  for (size_t i = 0; i < KHRPresentTunerVK::kWindowSize; i++) {
+    auto interval = fml::TimeDelta::FromMilliseconds(
+        i + late_frames >= KHRPresentTunerVK::kWindowSize ? 33 : 16);
+    changed |= tuner.RecordFrame(acquire_wait, interval);
+  }
+  return changed;
+}
+
+}  // namespace
+
+TEST(KHRPresentTunerVKTest, DefaultsToFifoWithOneExtraImage) {
+  KHRPresentTunerVK tuner;
+  tuner.SetSurfaceLimits(kAllModes, 2u, 0u);
+
+  EXPECT_EQ(tuner.GetPresentMode(), vk::PresentModeKHR::eFifo);
+  EXPECT_EQ(tuner.GetImageCount(), 3u);
+
+  // Only the auto policy adapts.
+  EXPECT_FALSE(RecordWindow(tuner, KHRPresentTunerVK::kWindowSize / 2));
+  EXPECT_EQ(tuner.GetImageCount(), 3u);
+}
+
+TEST(KHRPresentTunerVKTest, FallsBackToFifoIfModeIsUnsupported) {
+  KHRPresentTunerVK tuner({.policy = KHRPresentPolicyVK::kMailbox});
+  tuner.SetSurfaceLimits({vk::PresentModeKHR::eFifo}, 2u, 3u);
+  EXPECT_EQ(tuner.GetPresentMode(), vk::PresentModeKHR::eFifo);
+
+  tuner.SetSurfaceLimits(kAllModes, 2u, 3u);
+  EXPECT_EQ(tuner.GetPresentMode(), vk::PresentModeKHR::eMailbox);
+}
+
+TEST(KHRPresentTunerVKTest, ClampsImageCountToSurfaceLimits) {
+  KHRPresentTunerVK tuner({.image_count = 8u});
+  tuner.SetSurfaceLimits(kAllModes, 2u, 4u);
+  EXPECT_EQ(tuner.GetImageCount(), 4u);
+}
+
+TEST(KHRPresentTunerVKTest, AutoAddsImageThenRelaxesWhenFramesAreLate) {
+  KHRPresentTunerVK tuner({.policy = KHRPresentPolicyVK::kAuto});
+  tuner.SetSurfaceLimits(kAllModes, 2u, 0u);
+
+  EXPECT_TRUE(RecordWindow(tuner, KHRPresentTunerVK::kWindowSize / 4));
+  EXPECT_EQ(tuner.GetPresentMode(), vk::PresentModeKHR::eFifo);
+  EXPECT_EQ(tuner.GetImageCount(), 4u);
+
+  EXPECT_TRUE(RecordWindow(tuner, KHRPresentTunerVK::kWindowSize / 4));
+  EXPECT_EQ(tuner.GetPresentMode(), vk::PresentModeKHR::eFifoRelaxed);
+
+  // There is nothing left to step to.
+  EXPECT_FALSE(RecordWindow(tuner, KHRPresentTunerVK::kWindowSize / 4));
+}
+
+TEST(KHRPresentTunerVKTest, AutoKeepsConfigurationForSmoothFrames) {
+  KHRPresentTunerVK tuner({.policy = KHRPresentPolicyVK::kAuto});
+  tuner.SetSurfaceLimits(kAllModes, 2u, 0u);
+
+  EXPECT_FALSE(RecordWindow(tuner, 0u));
+  EXPECT_EQ(tuner.GetImageCount(), 3u);
+}
+
+TEST(KHRPresentTunerVKTest, AutoStepsBackWhenAcquisitionBlocks) {
+  KHRPresentTunerVK tuner({.policy = KHRPresentPolicyVK::kAuto});
+  tuner.SetSurfaceLimits(kAllModes, 2u, 0u);
+
+  EXPECT_TRUE(RecordWindow(tuner, KHRPresentTunerVK::kWindowSize / 4));
+  EXPECT_EQ(tuner.GetImageCount(), 4u);
+
+  EXPECT_TRUE(RecordWindow(tuner, 0u, fml::TimeDelta::FromMilliseconds(12)));
+  EXPECT_EQ(tuner.GetPresentMode(), vk::PresentModeKHR::eFifo);
+  EXPECT_EQ(tuner.GetImageCount(), 3u);
+}
+
+TEST(KHRPresentTunerVKTest, AutoSkipsExtraImageAtSurfaceLimit) {
+  KHRPresentTunerVK tuner({.policy = KHRPresentPolicyVK::kAuto});
+  tuner.SetSurfaceLimits(kAllModes, 2u, 3u);
+
+  EXPECT_TRUE(RecordWindow(tuner, KHRPresentTunerVK::kWindowSize / 4));
+  EXPECT_EQ(tuner.GetPresentMode(), vk::PresentModeKHR::eFifoRelaxed);
+  EXPECT_EQ(tuner.GetImageCount(), 3u);
+}
+
+}  // namespace testing
+}  // namespace impeller
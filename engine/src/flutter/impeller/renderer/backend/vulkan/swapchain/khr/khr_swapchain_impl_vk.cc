@@ -11,6 +11,7 @@
 #include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/formats_vk.h"
 #include "impeller/renderer/backend/vulkan/gpu_tracer_vk.h"
+#include "impeller/renderer/backend/vulkan/swapchain/khr/khr_present_tuner_vk.h"
 #include "impeller/renderer/backend/vulkan/swapchain/khr/khr_swapchain_image_vk.h"
 #include "impeller/renderer/backend/vulkan/swapchain/surface_vk.h"
 #include "impeller/renderer/backend/vulkan/texture_vk.h"
@@ -112,15 +113,17 @@ std::shared_ptr<KHRSwapchainImplVK> KHRSwapchainImplVK::Create(
     const std::shared_ptr<Context>& context,
     vk::UniqueSurfaceKHR surface,
     const ISize& size,
+    KHRPresentTunerVK& tuner,
     bool enable_msaa,
     vk::SwapchainKHR old_swapchain) {
   return std::shared_ptr<KHRSwapchainImplVK>(new KHRSwapchainImplVK(
-      context, std::move(surface), size, enable_msaa, old_swapchain));
+      context, std::move(surface), size, tuner, enable_msaa, old_swapchain));
 }
 
 KHRSwapchainImplVK::KHRSwapchainImplVK(const std::shared_ptr<Context>& context,
                                        vk::UniqueSurfaceKHR surface,
                                        const ISize& size,
+                                       KHRPresentTunerVK& tuner,
                                        bool enable_msaa,
                                        vk::SwapchainKHR old_swapchain) {
   if (!context) {
@@ -154,6 +157,16 @@ KHRSwapchainImplVK::KHRSwapchainImplVK(const std::shared_ptr<Context>& context,
   }
   vk_context.SetOffscreenFormat(ToPixelFormat(format.value().format));
 
+  // FIFO is always supported. If the present modes can't be queried, the
+  // tuner falls back to it.
+  auto [modes_result, present_modes] =
+      vk_context.GetPhysicalDevice().getSurfacePresentModesKHR(*surface);
+  if (modes_result != vk::Result::eSuccess) {
+    present_modes = {vk::PresentModeKHR::eFifo};
+  }
+  tuner.SetSurfaceLimits(std::move(present_modes), surface_caps.minImageCount,
+                         surface_caps.maxImageCount);
+
   const auto composite =
       ChooseAlphaCompositionMode(surface_caps.supportedCompositeAlpha);
   if (!composite.has_value()) {
@@ -165,7 +178,7 @@ KHRSwapchainImplVK::KHRSwapchainImplVK(const std::shared_ptr<Context>& context,
   swapchain_info.surface = *surface;
   swapchain_info.imageFormat = format.value().format;
   swapchain_info.imageColorSpace = format.value().colorSpace;
-  swapchain_info.presentMode = vk::PresentModeKHR::eFifo;
+  swapchain_info.presentMode = tuner.GetPresentMode();
   swapchain_info.imageExtent = vk::Extent2D{
       std::clamp(static_cast<uint32_t>(size.width),
                  surface_caps.minImageExtent.width,
@@ -174,13 +187,7 @@ KHRSwapchainImplVK::KHRSwapchainImplVK(const std::shared_ptr<Context>& context,
                  surface_caps.minImageExtent.height,
                  surface_caps.maxImageExtent.height),
   };
-  swapchain_info.minImageCount =
-      std::clamp(surface_caps.minImageCount + 1u,  // preferred image count
-                 surface_caps.minImageCount,       // min count cannot be zero
-                 surface_caps.maxImageCount == 0u
-                     ? surface_caps.minImageCount + 1u
-                     : surface_caps.maxImageCount  // max zero means no limit
-      );
+  swapchain_info.minImageCount = tuner.GetImageCount();
   swapchain_info.imageArrayLayers = 1u;
   // Swapchain images are primarily used as color attachments (via resolve) or
   // input attachments.
@@ -16,6 +16,7 @@ namespace impeller {
 
 class Context;
 class KHRSwapchainImageVK;
+class KHRPresentTunerVK;
 class Surface;
 struct KHRFrameSynchronizerVK;
 
@@ -34,6 +35,7 @@ class KHRSwapchainImplVK final
       const std::shared_ptr<Context>& context,
       vk::UniqueSurfaceKHR surface,
       const ISize& size,
+      KHRPresentTunerVK& tuner,
       bool enable_msaa = true,
       vk::SwapchainKHR old_swapchain = VK_NULL_HANDLE);
 
@@ -83,6 +85,7 @@ class KHRSwapchainImplVK final
   KHRSwapchainImplVK(const std::shared_ptr<Context>& context,
                      vk::UniqueSurfaceKHR surface,
                      const ISize& size,
+                     KHRPresentTunerVK& tuner,
                      bool enable_msaa,
                      vk::SwapchainKHR old_swapchain);
 
@@ -7,6 +7,7 @@
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/trace_event.h"
 #include "impeller/base/validation.h"
+#include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/swapchain/khr/khr_swapchain_impl_vk.h"
 
 namespace impeller {
@@ -15,10 +16,14 @@ KHRSwapchainVK::KHRSwapchainVK(const std::shared_ptr<Context>& context,
                                vk::UniqueSurfaceKHR surface,
                                const ISize& size,
                                bool enable_msaa)
-    : size_(size), enable_msaa_(enable_msaa) {
+    : size_(size),
+      enable_msaa_(enable_msaa),
+      tuner_(context ? ContextVK::Cast(*context).GetKHRPresentSettings()
+                     : KHRPresentSettingsVK{}) {
   auto impl = KHRSwapchainImplVK::Create(context,             //
                                          std::move(surface),  //
                                          size_,               //
+                                         tuner_,              //
                                          enable_msaa_         //
   );
   if (!impl || !impl->IsValid()) {
@@ -57,8 +62,16 @@ std::unique_ptr<Surface> KHRSwapchainVK::AcquireNextDrawable(
 
   TRACE_EVENT0("impeller", __FUNCTION__);
 
+  const auto acquire_start = fml::TimePoint::Now();
   auto result = impl_->AcquireNextDrawable();
-  if (!result.out_of_date && size_ == impl_->GetSize()) {
+  if (result.surface && last_acquire_start_.has_value()) {
+    needs_reconfigure_ |=
+        tuner_.RecordFrame(fml::TimePoint::Now() - acquire_start,
+                           acquire_start - last_acquire_start_.value());
+  }
+  last_acquire_start_ = acquire_start;
+  if (!result.out_of_date && size_ == impl_->GetSize() &&
+      !needs_reconfigure_) {
     return std::move(result.surface);
   }
 
@@ -85,6 +98,10 @@ std::unique_ptr<Surface> KHRSwapchainVK::AcquireNextDrawable(
 
   TRACE_EVENT0("impeller", "RecreateSwapchain");
 
+  // The tuner measures frames from the new swapchain only.
+  needs_reconfigure_ = false;
+  last_acquire_start_.reset();
+
   // This swapchain implementation indicates that it is out of date. Tear it
   // down and make a new one.
   auto context = impl_->GetContext();
@@ -93,6 +110,7 @@ std::unique_ptr<Surface> KHRSwapchainVK::AcquireNextDrawable(
   auto new_impl = KHRSwapchainImplVK::Create(context,             //
                                              std::move(surface),  //
                                              size_,               //
+                                             tuner_,              //
                                              enable_msaa_,        //
                                              *old_swapchain       //
   );
@@ -6,8 +6,11 @@
 #define FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_SWAPCHAIN_KHR_KHR_SWAPCHAIN_VK_H_
 
 #include <memory>
+#include <optional>
 
+#include "flutter/fml/time/time_point.h"
 #include "impeller/geometry/size.h"
+#include "impeller/renderer/backend/vulkan/swapchain/khr/khr_present_tuner_vk.h"
 #include "impeller/renderer/backend/vulkan/swapchain/swapchain_vk.h"
 #include "impeller/renderer/backend/vulkan/vk.h"
 #include "impeller/renderer/context.h"
@@ -47,6 +50,9 @@ class KHRSwapchainVK final : public SwapchainVK {
   std::shared_ptr<KHRSwapchainImplVK> impl_;
   ISize size_;
   const bool enable_msaa_;
+  KHRPresentTunerVK tuner_;
+  std::optional<fml::TimePoint> last_acquire_start_;
+  bool needs_reconfigure_ = false;
 
   KHRSwapchainVK(const std::shared_ptr<Context>& context,
                  vk::UniqueSurfaceKHR surface,
@@ -150,6 +150,46 @@ TEST(GPUTracerVK, TracesWithPartialFrameOverlap) {
                         "vkGetQueryPoolResults") != called->end());
 }
 
+TEST(GPUTracerVK, AggregatesPassTimingsByLabel) {
+  auto const context =
+      MockVulkanContextBuilder()
+          .SetSettingsCallback([](ContextVK::Settings& settings) {
+            settings.enable_gpu_tracing = true;
+          })
+          .Build();
+  auto tracer = context->GetGPUTracer();
+  ASSERT_TRUE(tracer->IsEnabled());
+  EXPECT_TRUE(tracer->GetPassTimings().empty());
+
+  for (auto i = 0u; i < GPUTracerVK::kPassTimingWindow; i++) {
+    tracer->MarkFrameStart();
+
+    auto cmd_buffer = context->CreateCommandBuffer();
+    for (auto j = 0u; j < 2u; j++) {
+      auto blit_pass = cmd_buffer->CreateBlitPass();
+      blit_pass->SetLabel("Upload");
+      blit_pass->EncodeCommands();
+    }
+
+    auto latch = std::make_shared<fml::CountDownLatch>(1u);
+    if (!context->GetCommandQueue()
+             ->Submit(
+                 {cmd_buffer},
+                 [latch](CommandBuffer::Status status) { latch->CountDown(); })
+             .ok()) {
+      GTEST_FAIL() << "Failed to submit cmd buffer";
+    }
+    tracer->MarkFrameEnd();
+    // The probe reports the frame before the completion callback is invoked.
+    latch->Wait();
+  }
+
+  auto timings = tracer->GetPassTimings();
+  ASSERT_EQ(timings.size(), 1u);
+  EXPECT_EQ(timings[0].label, "Upload");
+  EXPECT_EQ(timings[0].count, 2u * GPUTracerVK::kPassTimingWindow);
+}
+
 #endif  // IMPELLER_DEBUG
 
 }  // namespace testing
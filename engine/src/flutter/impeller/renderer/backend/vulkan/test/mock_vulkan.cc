@@ -4,6 +4,7 @@
 
 #include "impeller/renderer/backend/vulkan/test/mock_vulkan.h"
 
+#include <atomic>
 #include <cstdint>
 #include <cstring>
 #include <utility>
@@ -43,7 +44,9 @@ struct MockSwapchainKHR {
   size_t current_image = 0;
 };
 
-struct MockSemaphore {};
+struct MockSemaphore {
+  std::atomic<uint64_t> value = 0u;
+};
 
 struct MockFramebuffer {};
 
@@ -538,6 +541,25 @@ VkResult vkQueueSubmit(VkQueue queue,
                        uint32_t submitCount,
                        const VkSubmitInfo* pSubmits,
                        VkFence fence) {
+  // Submissions complete immediately, so timeline semaphores are advanced to
+  // their signal values right away.
+  for (uint32_t i = 0; i < submitCount; i++) {
+    auto timeline_info =
+        reinterpret_cast<const VkTimelineSemaphoreSubmitInfo*>(
+            pSubmits[i].pNext);
+    if (!timeline_info ||
+        timeline_info->sType !=
+            VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO) {
+      continue;
+    }
+    for (uint32_t j = 0; j < timeline_info->signalSemaphoreValueCount; j++) {
+      if (timeline_info->pSignalSemaphoreValues[j] == 0u) {
+        continue;
+      }
+      reinterpret_cast<MockSemaphore*>(pSubmits[i].pSignalSemaphores[j])
+          ->value = timeline_info->pSignalSemaphoreValues[j];
+    }
+  }
   return VK_SUCCESS;
 }
 
@@ -667,6 +689,18 @@ VkResult vkGetPhysicalDeviceSurfaceFormatsKHR(
   return VK_SUCCESS;
 }
 
+VkResult vkGetPhysicalDeviceSurfacePresentModesKHR(
+    VkPhysicalDevice physicalDevice,
+    VkSurfaceKHR surface,
+    uint32_t* pPresentModeCount,
+    VkPresentModeKHR* pPresentModes) {
+  *pPresentModeCount = 1u;
+  if (pPresentModes != nullptr) {
+    pPresentModes[0] = VK_PRESENT_MODE_FIFO_KHR;
+  }
+  return VK_SUCCESS;
+}
+
 VkResult vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
     VkPhysicalDevice physicalDevice,
     VkSurfaceKHR surface,
@@ -753,6 +787,25 @@ void vkDestroySemaphore(VkDevice device,
   delete reinterpret_cast<MockSemaphore*>(semaphore);
 }
 
+VkResult vkWaitSemaphoresKHR(VkDevice device,
+                             const VkSemaphoreWaitInfo* pWaitInfo,
+                             uint64_t timeout) {
+  for (uint32_t i = 0; i < pWaitInfo->semaphoreCount; i++) {
+    if (reinterpret_cast<MockSemaphore*>(pWaitInfo->pSemaphores[i])->value <
+        pWaitInfo->pValues[i]) {
+      return VK_TIMEOUT;
+    }
+  }
+  return VK_SUCCESS;
+}
+
+VkResult vkGetSemaphoreCounterValueKHR(VkDevice device,
+                                       VkSemaphore semaphore,
+                                       uint64_t* pValue) {
+  *pValue = reinterpret_cast<MockSemaphore*>(semaphore)->value;
+  return VK_SUCCESS;
+}
+
 VkResult vkAcquireNextImageKHR(VkDevice device,
                                VkSwapchainKHR swapchain,
                                uint64_t timeout,
@@ -803,6 +856,15 @@ VkResult vkGetPipelineCacheData(VkDevice device,
   }
 }
 
+VkResult vkMergePipelineCaches(VkDevice device,
+                               VkPipelineCache dstCache,
+                               uint32_t srcCacheCount,
+                               const VkPipelineCache* pSrcCaches) {
+  MockDevice* mock_device = reinterpret_cast<MockDevice*>(device);
+  mock_device->AddCalledFunction("vkMergePipelineCaches");
+  return VK_SUCCESS;
+}
+
 PFN_vkVoidFunction GetMockVulkanProcAddress(VkInstance instance,
                                             const char* pName) {
   if (strcmp("vkEnumerateInstanceExtensionProperties", pName) == 0) {
@@ -929,6 +991,10 @@ PFN_vkVoidFunction GetMockVulkanProcAddress(VkInstance instance,
     return reinterpret_cast<PFN_vkVoidFunction>(vkResetDescriptorPool);
   } else if (strcmp("vkAllocateDescriptorSets", pName) == 0) {
     return reinterpret_cast<PFN_vkVoidFunction>(vkAllocateDescriptorSets);
+  } else if (strcmp("vkGetPhysicalDeviceSurfacePresentModesKHR", pName) ==
+             0) {
+    return reinterpret_cast<PFN_vkVoidFunction>(
+        vkGetPhysicalDeviceSurfacePresentModesKHR);
   } else if (strcmp("vkGetPhysicalDeviceSurfaceFormatsKHR", pName) == 0) {
     return reinterpret_cast<PFN_vkVoidFunction>(
         vkGetPhysicalDeviceSurfaceFormatsKHR);
@@ -948,6 +1014,10 @@ PFN_vkVoidFunction GetMockVulkanProcAddress(VkInstance instance,
     return reinterpret_cast<PFN_vkVoidFunction>(vkCreateSemaphore);
   } else if (strcmp("vkDestroySemaphore", pName) == 0) {
     return reinterpret_cast<PFN_vkVoidFunction>(vkDestroySemaphore);
+  } else if (strcmp("vkWaitSemaphoresKHR", pName) == 0) {
+    return reinterpret_cast<PFN_vkVoidFunction>(vkWaitSemaphoresKHR);
+  } else if (strcmp("vkGetSemaphoreCounterValueKHR", pName) == 0) {
+    return reinterpret_cast<PFN_vkVoidFunction>(vkGetSemaphoreCounterValueKHR);
   } else if (strcmp("vkDestroySurfaceKHR", pName) == 0) {
     return reinterpret_cast<PFN_vkVoidFunction>(vkDestroySurfaceKHR);
   } else if (strcmp("vkAcquireNextImageKHR", pName) == 0) {
@@ -960,6 +1030,8 @@ PFN_vkVoidFunction GetMockVulkanProcAddress(VkInstance instance,
     return reinterpret_cast<PFN_vkVoidFunction>(vkTrimCommandPool);
   } else if (strcmp("vkGetPipelineCacheData", pName) == 0) {
     return reinterpret_cast<PFN_vkVoidFunction>(vkGetPipelineCacheData);
+  } else if (strcmp("vkMergePipelineCaches", pName) == 0) {
+    return reinterpret_cast<PFN_vkVoidFunction>(vkMergePipelineCaches);
   }
   return noop;
 }
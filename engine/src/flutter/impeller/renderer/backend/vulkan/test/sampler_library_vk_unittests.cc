@@ -35,5 +35,20 @@ TEST(SamplerLibraryVK, WorkaroundsCanDisableReadingFromMipLevels) {
   EXPECT_EQ(sampler->GetDescriptor().mip_filter, MipFilter::kBase);
 }
 
+TEST(SamplerLibraryVK, CreatingCommonSamplersKeepsCachedSamplers) {
+  auto const context = MockVulkanContextBuilder().Build();
+
+  auto library_vk =
+      std::make_shared<SamplerLibraryVK>(context->GetDeviceHolder());
+  std::shared_ptr<SamplerLibrary> library = library_vk;
+
+  const SamplerDescriptor linear_desc("Linear Sampler", MinMagFilter::kLinear,
+                                      MinMagFilter::kLinear, MipFilter::kBase);
+  auto linear = library->GetSampler(linear_desc);
+
+  library_vk->CreateCommonSamplers();
+  EXPECT_TRUE(library->GetSampler(linear_desc) == linear);
+}
+
 }  // namespace testing
 }  // namespace impeller
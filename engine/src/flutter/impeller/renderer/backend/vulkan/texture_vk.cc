@@ -179,6 +179,10 @@ std::shared_ptr<const TextureSourceVK> TextureVK::GetTextureSource() const {
   return source_;
 }
 
+UniqueID TextureVK::GetUniqueID() const {
+  return id_;
+}
+
 bool TextureVK::SetLayout(const BarrierVK& barrier) const {
   return source_ ? source_->SetLayout(barrier).ok() : false;
 }
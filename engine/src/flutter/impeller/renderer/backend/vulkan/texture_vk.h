@@ -6,6 +6,7 @@
 #define FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_TEXTURE_VK_H_
 
 #include "impeller/base/backend_cast.h"
+#include "impeller/base/comparable.h"
 #include "impeller/core/formats.h"
 #include "impeller/core/texture.h"
 #include "impeller/renderer/backend/vulkan/context_vk.h"
@@ -39,6 +40,10 @@ class TextureVK final : public Texture, public BackendCast<TextureVK, Texture> {
 
   std::shared_ptr<const TextureSourceVK> GetTextureSource() const;
 
+  /// An identifier for this texture that, unlike the Vulkan handles, is never
+  /// reused after the texture is destroyed.
+  UniqueID GetUniqueID() const;
+
   // |Texture|
   ISize GetSize() const override;
 
@@ -69,6 +74,7 @@ class TextureVK final : public Texture, public BackendCast<TextureVK, Texture> {
   std::weak_ptr<Context> context_;
   std::shared_ptr<TextureSourceVK> source_;
   bool has_validation_layers_ = false;
+  const UniqueID id_;
 
   // |Texture|
   void SetLabel(std::string_view label) override;
@@ -0,0 +1,212 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/renderer/backend/vulkan/timeline_waiter_vk.h"
+
+#include <chrono>
+#include <utility>
+#include <vector>
+
+#include "flutter/fml/cpu_affinity.h"
+#include "flutter/fml/thread.h"
+#include "flutter/fml/trace_event.h"
+#include "impeller/base/validation.h"
+
+namespace impeller {
+
+std::shared_ptr<TimelineWaiterVK> TimelineWaiterVK::Create(
+    std::weak_ptr<DeviceHolderVK> device_holder) {
+  auto strong_device_holder = device_holder.lock();
+  if (!strong_device_holder) {
+    return nullptr;
+  }
+
+  vk::StructureChain<vk::SemaphoreCreateInfo, vk::SemaphoreTypeCreateInfoKHR>
+      semaphore_chain;
+  auto& type_info = semaphore_chain.get<vk::SemaphoreTypeCreateInfoKHR>();
+  type_info.semaphoreType = vk::SemaphoreType::eTimeline;
+  type_info.initialValue = 0u;
+
+  auto [result, semaphore] =
+      strong_device_holder->GetDevice().createSemaphoreUnique(
+          semaphore_chain.get());
+  if (result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Could not create timeline semaphore: "
+                   << vk::to_string(result);
+    return nullptr;
+  }
+
+  return std::shared_ptr<TimelineWaiterVK>(
+      new TimelineWaiterVK(std::move(device_holder), std::move(semaphore)));
+}
+
+TimelineWaiterVK::TimelineWaiterVK(std::weak_ptr<DeviceHolderVK> device_holder,
+                                   vk::UniqueSemaphore semaphore)
+    : device_holder_(std::move(device_holder)),
+      semaphore_(std::move(semaphore)) {
+  waiter_thread_ = std::make_unique<std::thread>([&]() { Main(); });
+}
+
+TimelineWaiterVK::~TimelineWaiterVK() {
+  Terminate();
+}
+
+bool TimelineWaiterVK::Submit(const QueueVK& queue,
+                              const vk::SubmitInfo& submit_info,
+                              const fml::closure& callback) {
+  if (!callback) {
+    return false;
+  }
+  FML_DCHECK(submit_info.pNext == nullptr);
+
+  {
+    // The lock is held across the queue submission so that the semaphore
+    // values reach the queue in increasing order.
+    std::scoped_lock lock(pending_mutex_);
+    if (terminate_) {
+      return false;
+    }
+
+    const uint64_t value = last_submitted_value_ + 1u;
+
+    // Binary semaphores ignore their entry in the signal values. Only the
+    // timeline semaphore, which is signaled last, needs a real value.
+    std::vector<vk::Semaphore> signal_semaphores(
+        submit_info.pSignalSemaphores,
+        submit_info.pSignalSemaphores + submit_info.signalSemaphoreCount);
+    signal_semaphores.push_back(semaphore_.get());
+    std::vector<uint64_t> signal_values(signal_semaphores.size(), 0u);
+    signal_values.back() = value;
+
+    vk::TimelineSemaphoreSubmitInfoKHR timeline_info;
+    timeline_info.setSignalSemaphoreValues(signal_values);
+
+    vk::SubmitInfo timeline_submit_info = submit_info;
+    timeline_submit_info.setSignalSemaphores(signal_semaphores);
+    timeline_submit_info.pNext = &timeline_info;
+
+    auto result = queue.Submit(timeline_submit_info, {});
+    if (result != vk::Result::eSuccess) {
+      VALIDATION_LOG << "Failed to submit queue: " << vk::to_string(result);
+      return false;
+    }
+
+    last_submitted_value_ = value;
+    pending_.push_back(PendingSubmit{value, callback});
+  }
+  pending_cv_.notify_one();
+  return true;
+}
+
+void TimelineWaiterVK::Main() {
+  fml::Thread::SetCurrentThreadName(
+      fml::Thread::ThreadConfig{"IplrVkTimelineWait"});
+  // Since this thread mostly waits on the semaphore, it doesn't need to be
+  // fast.
+  fml::RequestAffinity(fml::CpuAffinity::kEfficiency);
+
+  while (true) {
+    bool terminate = false;
+    {
+      std::unique_lock lock(pending_mutex_);
+      pending_cv_.wait(lock, [&]() { return !pending_.empty() || terminate_; });
+      // Keep servicing submissions after termination until none are left.
+      terminate = terminate_ && pending_.empty();
+    }
+
+    if (terminate || !Wait()) {
+      break;
+    }
+  }
+
+  // If the waiter bailed out early, the remaining submissions will never be
+  // observed. Like the fence waiter, still invoke their callbacks so that
+  // tracked resources are released.
+  std::deque<PendingSubmit> abandoned;
+  {
+    std::scoped_lock lock(pending_mutex_);
+    terminate_ = true;
+    abandoned.swap(pending_);
+  }
+  for (const auto& pending : abandoned) {
+    pending.callback();
+  }
+}
+
+bool TimelineWaiterVK::Wait() {
+  uint64_t wait_value = 0u;
+  {
+    std::scoped_lock lock(pending_mutex_);
+    if (pending_.empty()) {
+      return true;
+    }
+    wait_value = pending_.front().value;
+  }
+
+  // Check if the context had died in the meantime.
+  auto device_holder = device_holder_.lock();
+  if (!device_holder) {
+    return false;
+  }
+  const auto& device = device_holder->GetDevice();
+
+  using namespace std::literals::chrono_literals;
+
+  // Wait for the oldest pending submission only. Every later submission that
+  // completed in the meantime is picked up by the counter read below. A
+  // timeout bails out the wait so that termination is never stalled.
+  vk::SemaphoreWaitInfoKHR wait_info;
+  wait_info.setSemaphores(semaphore_.get());
+  wait_info.setValues(wait_value);
+  auto result = device.waitSemaphoresKHR(
+      wait_info, std::chrono::nanoseconds{100ms}.count());
+  if (!(result == vk::Result::eSuccess || result == vk::Result::eTimeout)) {
+    VALIDATION_LOG << "Timeline waiter encountered an unexpected error. "
+                      "Tearing down the waiter thread.";
+    return false;
+  }
+
+  auto [counter_result, completed_value] =
+      device.getSemaphoreCounterValueKHR(semaphore_.get());
+  if (counter_result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Could not read timeline semaphore counter: "
+                   << vk::to_string(counter_result);
+    return false;
+  }
+
+  // Quickly pop the completed submissions and invoke their callbacks after
+  // the lock is released. These might touch allocators.
+  std::vector<fml::closure> completed;
+  {
+    std::scoped_lock lock(pending_mutex_);
+    while (!pending_.empty() && pending_.front().value <= completed_value) {
+      completed.push_back(std::move(pending_.front().callback));
+      pending_.pop_front();
+    }
+  }
+
+  if (!completed.empty()) {
+    TRACE_EVENT0("impeller", "TimelineWaiterCallbacks");
+    for (const auto& callback : completed) {
+      callback();
+    }
+  }
+
+  return true;
+}
+
+void TimelineWaiterVK::Terminate() {
+  {
+    std::scoped_lock lock(pending_mutex_);
+    terminate_ = true;
+  }
+  pending_cv_.notify_one();
+  // The waiter thread may also have set the flag itself when it bailed out,
+  // so whether it still needs joining is tracked by the thread.
+  if (waiter_thread_->joinable()) {
+    waiter_thread_->join();
+  }
+}
+
+}  // namespace impeller
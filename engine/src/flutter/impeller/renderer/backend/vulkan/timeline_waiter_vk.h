@@ -0,0 +1,99 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_TIMELINE_WAITER_VK_H_
+#define FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_TIMELINE_WAITER_VK_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "flutter/fml/closure.h"
+#include "impeller/renderer/backend/vulkan/device_holder_vk.h"
+#include "impeller/renderer/backend/vulkan/queue_vk.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      Tracks the completion of submissions to a queue with a single
+///             timeline semaphore instead of a fence per submission.
+///
+///             Every submission signals the next value of the semaphore. The
+///             waiter thread waits on the oldest pending value and then reads
+///             the counter once, so every submission that completed in the
+///             meantime has its callback invoked in the same batch.
+///
+///             Requires VK_KHR_timeline_semaphore. Contexts without it use
+///             the |FenceWaiterVK| instead.
+///
+class TimelineWaiterVK {
+ public:
+  //----------------------------------------------------------------------------
+  /// @brief      Create a waiter with a new timeline semaphore on the device.
+  ///
+  /// @return     The waiter, or nullptr if the semaphore could not be created.
+  ///
+  static std::shared_ptr<TimelineWaiterVK> Create(
+      std::weak_ptr<DeviceHolderVK> device_holder);
+
+  ~TimelineWaiterVK();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Stop accepting submissions and wait for the pending ones to
+  ///             complete before joining the waiter thread.
+  ///
+  void Terminate();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Submit to the queue, additionally signaling the timeline
+  ///             semaphore, and invoke the callback on the waiter thread once
+  ///             the submission has completed.
+  ///
+  ///             All submissions through a waiter must go to the same queue
+  ///             for the semaphore values to complete in order.
+  ///
+  /// @param[in]  queue        The queue to submit to.
+  /// @param[in]  submit_info  The submission. It must not have a pNext chain.
+  /// @param[in]  callback     The callback to invoke on completion.
+  ///
+  /// @return     If the submission was made. On failure, the callback is not
+  ///             invoked.
+  ///
+  bool Submit(const QueueVK& queue,
+              const vk::SubmitInfo& submit_info,
+              const fml::closure& callback);
+
+ private:
+  struct PendingSubmit {
+    uint64_t value = 0u;
+    fml::closure callback;
+  };
+
+  std::weak_ptr<DeviceHolderVK> device_holder_;
+  vk::UniqueSemaphore semaphore_;
+  std::unique_ptr<std::thread> waiter_thread_;
+  std::mutex pending_mutex_;
+  std::condition_variable pending_cv_;
+  std::deque<PendingSubmit> pending_;
+  uint64_t last_submitted_value_ = 0u;
+  bool terminate_ = false;
+
+  TimelineWaiterVK(std::weak_ptr<DeviceHolderVK> device_holder,
+                   vk::UniqueSemaphore semaphore);
+
+  void Main();
+
+  bool Wait();
+
+  TimelineWaiterVK(const TimelineWaiterVK&) = delete;
+
+  TimelineWaiterVK& operator=(const TimelineWaiterVK&) = delete;
+};
+
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_TIMELINE_WAITER_VK_H_
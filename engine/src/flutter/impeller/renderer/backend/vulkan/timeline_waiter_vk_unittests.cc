@@ -0,0 +1,54 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "fml/synchronization/count_down_latch.h"
+#include "fml/synchronization/waitable_event.h"
+#include "gtest/gtest.h"  // IWYU pragma: keep
+#include "impeller/renderer/backend/vulkan/test/mock_vulkan.h"
+#include "impeller/renderer/backend/vulkan/timeline_waiter_vk.h"  // IWYU pragma: keep
+
+namespace impeller {
+namespace testing {
+
+TEST(TimelineWaiterVKTest, IgnoresNullCallback) {
+  auto const context = MockVulkanContextBuilder().Build();
+  auto const waiter = TimelineWaiterVK::Create(context->GetDeviceHolder());
+  ASSERT_TRUE(waiter);
+
+  EXPECT_FALSE(waiter->Submit(*context->GetGraphicsQueue(), {}, nullptr));
+}
+
+TEST(TimelineWaiterVKTest, ExecutesCallbacksOfAllCompletedSubmissions) {
+  auto const context = MockVulkanContextBuilder().Build();
+  auto const waiter = TimelineWaiterVK::Create(context->GetDeviceHolder());
+  ASSERT_TRUE(waiter);
+
+  fml::CountDownLatch latch(3u);
+  for (auto i = 0; i < 3; i++) {
+    EXPECT_TRUE(waiter->Submit(*context->GetGraphicsQueue(), {},
+                               [&latch]() { latch.CountDown(); }));
+  }
+
+  latch.Wait();
+}
+
+TEST(TimelineWaiterVKTest, SubmitDoesNothingIfTerminated) {
+  auto signal = fml::ManualResetWaitableEvent();
+
+  {
+    auto const context = MockVulkanContextBuilder().Build();
+    auto const waiter = TimelineWaiterVK::Create(context->GetDeviceHolder());
+    ASSERT_TRUE(waiter);
+    waiter->Terminate();
+
+    EXPECT_FALSE(waiter->Submit(*context->GetGraphicsQueue(), {},
+                                [&signal]() { signal.Signal(); }));
+  }
+
+  // Ensure the callback was _not_ called.
+  EXPECT_TRUE(signal.WaitWithTimeout(fml::TimeDelta::FromMilliseconds(100)));
+}
+
+}  // namespace testing
+}  // namespace impeller
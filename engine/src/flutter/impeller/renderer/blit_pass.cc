@@ -92,9 +92,8 @@ bool BlitPass::AddCopy(std::shared_ptr<Texture> source,
     source_region = IRect::MakeSize(source->GetSize());
   }
 
-  auto bytes_per_pixel =
-      BytesPerPixelForPixelFormat(source->GetTextureDescriptor().format);
-  auto bytes_per_image = source_region->Area() * bytes_per_pixel;
+  auto bytes_per_image = BytesForPixelFormat(
+      source->GetTextureDescriptor().format, source_region->GetSize());
   if (destination_offset + bytes_per_image >
       destination->GetDeviceBufferDescriptor().size) {
     VALIDATION_LOG
@@ -136,9 +135,9 @@ bool BlitPass::AddCopy(BufferView source,
     return false;
   }
 
-  auto bytes_per_pixel =
-      BytesPerPixelForPixelFormat(destination->GetTextureDescriptor().format);
-  auto bytes_per_region = destination_region_value.Area() * bytes_per_pixel;
+  auto bytes_per_region =
+      BytesForPixelFormat(destination->GetTextureDescriptor().format,
+                          destination_region_value.GetSize());
 
   if (source.GetRange().length != bytes_per_region) {
     VALIDATION_LOG
@@ -3,6 +3,9 @@
 // found in the LICENSE file.
 
 #include "impeller/renderer/capabilities.h"
+
+#include <algorithm>
+
 #include "impeller/core/formats.h"
 
 namespace impeller {
@@ -15,6 +18,10 @@ size_t Capabilities::GetMinimumStorageBufferAlignment() const {
   return GetMinimumUniformAlignment();
 }
 
+bool Capabilities::SupportsCompressedFormat(PixelFormat format) const {
+  return false;
+}
+
 class StandardCapabilities final : public Capabilities {
  public:
   // |Capabilities|
@@ -62,6 +69,11 @@ class StandardCapabilities final : public Capabilities {
   // |Capabilities|
   bool SupportsTriangleFan() const override { return supports_triangle_fan_; }
 
+  // |Capabilities|
+  bool SupportsIndirectDraw() const override {
+    return supports_indirect_draw_;
+  }
+
   // |Capabilities|
   PixelFormat GetDefaultColorFormat() const override {
     return default_color_format_;
@@ -113,6 +125,14 @@ class StandardCapabilities final : public Capabilities {
     return needs_partitioned_host_buffer_;
   }
 
+  // |Capabilities|
+  bool SupportsCompressedFormat(PixelFormat format) const override {
+    return IsBlockCompressed(format) &&
+           std::find(supported_compressed_formats_.begin(),
+                     supported_compressed_formats_.end(),
+                     format) != supported_compressed_formats_.end();
+  }
+
  private:
   StandardCapabilities(bool supports_offscreen_msaa,
                        bool supports_ssbo,
@@ -124,6 +144,7 @@ class StandardCapabilities final : public Capabilities {
                        bool supports_decal_sampler_address_mode,
                        bool supports_device_transient_textures,
                        bool supports_triangle_fan,
+                       bool supports_indirect_draw,
                        bool supports_extended_range_formats,
                        PixelFormat default_color_format,
                        PixelFormat default_stencil_format,
@@ -131,7 +152,8 @@ class StandardCapabilities final : public Capabilities {
                        PixelFormat default_glyph_atlas_format,
                        ISize default_maximum_render_pass_attachment_size,
                        size_t minimum_uniform_alignment,
-                       bool needs_partitioned_host_buffer)
+                       bool needs_partitioned_host_buffer,
+                       std::vector<PixelFormat> supported_compressed_formats)
       : supports_offscreen_msaa_(supports_offscreen_msaa),
         supports_ssbo_(supports_ssbo),
         supports_texture_to_texture_blits_(supports_texture_to_texture_blits),
@@ -143,6 +165,7 @@ class StandardCapabilities final : public Capabilities {
             supports_decal_sampler_address_mode),
         supports_device_transient_textures_(supports_device_transient_textures),
         supports_triangle_fan_(supports_triangle_fan),
+        supports_indirect_draw_(supports_indirect_draw),
         supports_extended_range_formats_(supports_extended_range_formats),
         needs_partitioned_host_buffer_(needs_partitioned_host_buffer),
         default_color_format_(default_color_format),
@@ -151,7 +174,9 @@ class StandardCapabilities final : public Capabilities {
         default_glyph_atlas_format_(default_glyph_atlas_format),
         default_maximum_render_pass_attachment_size_(
             default_maximum_render_pass_attachment_size),
-        minimum_uniform_alignment_(minimum_uniform_alignment) {}
+        minimum_uniform_alignment_(minimum_uniform_alignment),
+        supported_compressed_formats_(std::move(supported_compressed_formats)) {
+  }
 
   friend class CapabilitiesBuilder;
 
@@ -165,6 +190,7 @@ class StandardCapabilities final : public Capabilities {
   bool supports_decal_sampler_address_mode_ = false;
   bool supports_device_transient_textures_ = false;
   bool supports_triangle_fan_ = false;
+  bool supports_indirect_draw_ = false;
   bool supports_extended_range_formats_ = false;
   bool needs_partitioned_host_buffer_ = false;
   PixelFormat default_color_format_ = PixelFormat::kUnknown;
@@ -173,6 +199,7 @@ class StandardCapabilities final : public Capabilities {
   PixelFormat default_glyph_atlas_format_ = PixelFormat::kUnknown;
   ISize default_maximum_render_pass_attachment_size_ = ISize(1, 1);
   size_t minimum_uniform_alignment_ = 256;
+  std::vector<PixelFormat> supported_compressed_formats_;
 
   StandardCapabilities(const StandardCapabilities&) = delete;
 
@@ -263,6 +290,11 @@ CapabilitiesBuilder& CapabilitiesBuilder::SetSupportsTriangleFan(bool value) {
   return *this;
 }
 
+CapabilitiesBuilder& CapabilitiesBuilder::SetSupportsIndirectDraw(bool value) {
+  supports_indirect_draw_ = value;
+  return *this;
+}
+
 CapabilitiesBuilder& CapabilitiesBuilder::SetMaximumRenderPassAttachmentSize(
     ISize size) {
   default_maximum_render_pass_attachment_size_ = size;
@@ -287,6 +319,12 @@ CapabilitiesBuilder& CapabilitiesBuilder::SetNeedsPartitionedHostBuffer(
   return *this;
 }
 
+CapabilitiesBuilder& CapabilitiesBuilder::SetSupportedCompressedFormats(
+    std::vector<PixelFormat> value) {
+  supported_compressed_formats_ = std::move(value);
+  return *this;
+}
+
 std::unique_ptr<Capabilities> CapabilitiesBuilder::Build() {
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
   return std::unique_ptr<StandardCapabilities>(new StandardCapabilities(   //
@@ -300,6 +338,7 @@ std::unique_ptr<Capabilities> CapabilitiesBuilder::Build() {
       supports_decal_sampler_address_mode_,                                //
       supports_device_transient_textures_,                                 //
       supports_triangle_fan_,                                              //
+      supports_indirect_draw_,                                             //
       supports_extended_range_formats_,                                    //
       default_color_format_.value_or(PixelFormat::kUnknown),               //
       default_stencil_format_.value_or(PixelFormat::kUnknown),             //
@@ -307,7 +346,8 @@ std::unique_ptr<Capabilities> CapabilitiesBuilder::Build() {
       default_glyph_atlas_format_.value_or(PixelFormat::kUnknown),         //
       default_maximum_render_pass_attachment_size_.value_or(ISize{1, 1}),  //
       minimum_uniform_alignment_,                                          //
-      needs_partitioned_host_buffer_                                       //
+      needs_partitioned_host_buffer_,                                      //
+      supported_compressed_formats_                                        //
       ));
 }
 
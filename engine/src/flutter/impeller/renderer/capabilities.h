@@ -6,6 +6,7 @@
 #define FLUTTER_IMPELLER_RENDERER_CAPABILITIES_H_
 
 #include <memory>
+#include <vector>
 
 #include "impeller/core/formats.h"
 
@@ -93,6 +94,10 @@ class Capabilities {
   ///        primitives.
   virtual bool Supports32BitPrimitiveIndices() const = 0;
 
+  /// @brief Whether `RenderPass::DrawIndirect` is supported, so that draw
+  ///        arguments can be read by the GPU from a device buffer.
+  virtual bool SupportsIndirectDraw() const = 0;
+
   /// @brief  Returns a supported `PixelFormat` for textures that store
   ///         4-channel colors (red/green/blue/alpha).
   virtual PixelFormat GetDefaultColorFormat() const = 0;
@@ -133,6 +138,12 @@ class Capabilities {
   /// @brief The minimum alignment of storage buffer value offsets in bytes.
   virtual size_t GetMinimumStorageBufferAlignment() const;
 
+  /// @brief Whether textures of the block compressed `format` can be created
+  ///        and sampled from.
+  ///
+  /// This is always false for formats that are not block compressed.
+  virtual bool SupportsCompressedFormat(PixelFormat format) const;
+
   /// @brief Whether the host buffer should use separate device buffers
   /// for indexes from other data.
   virtual bool NeedsPartitionedHostBuffer() const = 0;
@@ -181,12 +192,17 @@ class CapabilitiesBuilder {
 
   CapabilitiesBuilder& SetSupportsTriangleFan(bool value);
 
+  CapabilitiesBuilder& SetSupportsIndirectDraw(bool value);
+
   CapabilitiesBuilder& SetMaximumRenderPassAttachmentSize(ISize size);
 
   CapabilitiesBuilder& SetMinimumUniformAlignment(size_t value);
 
   CapabilitiesBuilder& SetNeedsPartitionedHostBuffer(bool value);
 
+  CapabilitiesBuilder& SetSupportedCompressedFormats(
+      std::vector<PixelFormat> value);
+
   std::unique_ptr<Capabilities> Build();
 
  private:
@@ -200,6 +216,7 @@ class CapabilitiesBuilder {
   bool supports_decal_sampler_address_mode_ = false;
   bool supports_device_transient_textures_ = false;
   bool supports_triangle_fan_ = false;
+  bool supports_indirect_draw_ = false;
   bool supports_extended_range_formats_ = false;
   bool needs_partitioned_host_buffer_ = false;
   std::optional<PixelFormat> default_color_format_ = std::nullopt;
@@ -209,6 +226,7 @@ class CapabilitiesBuilder {
   std::optional<ISize> default_maximum_render_pass_attachment_size_ =
       std::nullopt;
   size_t minimum_uniform_alignment_ = 256;
+  std::vector<PixelFormat> supported_compressed_formats_;
 
   CapabilitiesBuilder(const CapabilitiesBuilder&) = delete;
 
@@ -0,0 +1,218 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/renderer/compute_tessellator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "impeller/core/device_buffer.h"
+#include "impeller/core/formats.h"
+#include "impeller/geometry/wangs_formula.h"
+#include "impeller/renderer/compute_pipeline_builder.h"
+#include "impeller/renderer/context.h"
+#include "impeller/renderer/pipeline_library.h"
+
+namespace impeller {
+
+namespace {
+
+enum class SegmentType : uint32_t {
+  kLine = 0,
+  kQuad = 1,
+  kConic = 2,
+  kCubic = 3,
+};
+
+uint32_t ClampSubdivisions(Scalar subdivisions) {
+  if (!std::isfinite(subdivisions)) {
+    return ComputeTessellator::kMaxSubdivisions;
+  }
+  return std::clamp(static_cast<uint32_t>(std::ceil(subdivisions)), 1u,
+                    ComputeTessellator::kMaxSubdivisions);
+}
+
+/// Flattens path verbs into |ComputeTessellator::CS::Segment|s, computing the
+/// output vertex offset of each segment as it goes.
+class SegmentCollector : public PathReceiver {
+ public:
+  SegmentCollector(std::vector<ComputeTessellator::CS::Segment>& segments,
+                   Scalar scale)
+      : segments_(segments), scale_(scale) {}
+
+  size_t GetVertexCount() const { return vertex_count_; }
+
+  // |PathReceiver|
+  void MoveTo(const Point& p2, bool will_be_closed) override {
+    contour_origin_ = p2;
+    current_ = p2;
+  }
+
+  // |PathReceiver|
+  void LineTo(const Point& p2) override {
+    Append(SegmentType::kLine, current_, p2, {}, {}, 1.0f, 1u);
+  }
+
+  // |PathReceiver|
+  void QuadTo(const Point& cp, const Point& p2) override {
+    Append(SegmentType::kQuad, current_, cp, p2, {}, 1.0f,
+           ClampSubdivisions(
+               ComputeQuadradicSubdivisions(scale_, current_, cp, p2)));
+  }
+
+  // |PathReceiver|
+  bool ConicTo(const Point& cp, const Point& p2, Scalar weight) override {
+    Append(SegmentType::kConic, current_, cp, p2, {}, weight,
+           ClampSubdivisions(
+               ComputeConicSubdivisions(scale_, current_, cp, p2, weight)));
+    return true;
+  }
+
+  // |PathReceiver|
+  void CubicTo(const Point& cp1, const Point& cp2, const Point& p2) override {
+    Append(SegmentType::kCubic, current_, cp1, cp2, p2, 1.0f,
+           ClampSubdivisions(
+               ComputeCubicSubdivisions(scale_, current_, cp1, cp2, p2)));
+  }
+
+  // |PathReceiver|
+  void Close() override {
+    // The fan around the contour origin implicitly closes the contour.
+    current_ = contour_origin_;
+  }
+
+ private:
+  std::vector<ComputeTessellator::CS::Segment>& segments_;
+  const Scalar scale_;
+  Point contour_origin_;
+  Point current_;
+  size_t vertex_count_ = 0u;
+
+  void Append(SegmentType type,
+              Point p0,
+              Point p1,
+              Point p2,
+              Point p3,
+              Scalar weight,
+              uint32_t subdivisions) {
+    segments_.push_back(ComputeTessellator::CS::Segment{
+        .p0 = p0,
+        .p1 = p1,
+        .p2 = p2,
+        .p3 = p3,
+        .contour_origin = contour_origin_,
+        .weight = weight,
+        .type = static_cast<uint32_t>(type),
+        .subdivisions = subdivisions,
+        .vertex_offset = static_cast<uint32_t>(vertex_count_),
+    });
+    vertex_count_ += 3u * subdivisions;
+    current_ = type == SegmentType::kCubic ? p3
+               : type == SegmentType::kLine ? p1
+                                            : p2;
+  }
+};
+
+}  // namespace
+
+ComputeTessellator::ComputeTessellator() = default;
+
+ComputeTessellator::~ComputeTessellator() = default;
+
+size_t ComputeTessellator::PrepareSegments(
+    const PathSource& path,
+    Scalar scale,
+    std::vector<CS::Segment>& segments) {
+  segments.clear();
+  SegmentCollector collector(segments, scale);
+  path.Dispatch(collector);
+  return collector.GetVertexCount();
+}
+
+size_t ComputeTessellator::Prepare(const PathSource& path, Scalar scale) {
+  vertex_count_ = PrepareSegments(path, scale, segments_);
+  return vertex_count_;
+}
+
+fml::StatusOr<VertexBuffer> ComputeTessellator::Tessellate(
+    const PathSource& path,
+    Scalar scale,
+    ComputePass& pass,
+    HostBuffer& host_buffer,
+    StorageMode storage_mode) {
+  Prepare(path, scale);
+  return Encode(pass, host_buffer, storage_mode);
+}
+
+fml::StatusOr<VertexBuffer> ComputeTessellator::Encode(
+    ComputePass& pass,
+    HostBuffer& host_buffer,
+    StorageMode storage_mode) {
+  const Context& context = pass.GetContext();
+  if (!context.GetCapabilities()->SupportsCompute()) {
+    return fml::Status(fml::StatusCode::kFailedPrecondition,
+                       "Compute is not supported on this device.");
+  }
+
+  if (vertex_count_ == 0u) {
+    return VertexBuffer{
+        .vertex_buffer = {},
+        .vertex_count = 0u,
+        .index_type = IndexType::kNone,
+    };
+  }
+
+  if (!pipeline_) {
+    pipeline_ =
+        context.GetPipelineLibrary()
+            ->GetPipeline(
+                ComputePipelineBuilder<CS>::MakeDefaultPipelineDescriptor(
+                    context))
+            .Get();
+    if (!pipeline_) {
+      return fml::Status(fml::StatusCode::kUnknown,
+                         "Could not create the path fill compute pipeline.");
+    }
+  }
+
+  DeviceBufferDescriptor desc;
+  desc.storage_mode = storage_mode;
+  desc.size = vertex_count_ * sizeof(Point);
+  std::shared_ptr<DeviceBuffer> output =
+      context.GetResourceAllocator()->CreateBuffer(desc);
+  if (!output) {
+    return fml::Status(fml::StatusCode::kResourceExhausted,
+                       "Could not allocate the tessellation output buffer.");
+  }
+  output->SetLabel("ComputeTessellator Vertices");
+
+  pass.SetCommandLabel("Path Fill Tessellation");
+  pass.SetPipeline(pipeline_);
+
+  CS::FrameInfo frame_info;
+  frame_info.segment_count = segments_.size();
+  CS::BindFrameInfo(pass, host_buffer.EmplaceUniform(frame_info));
+  CS::BindSegments(
+      pass, host_buffer.Emplace(
+                segments_.data(), segments_.size() * sizeof(CS::Segment),
+                std::max(alignof(CS::Segment),
+                         context.GetCapabilities()
+                             ->GetMinimumStorageBufferAlignment())));
+  BufferView vertices = DeviceBuffer::AsBufferView(output);
+  CS::BindVertices(pass, vertices);
+
+  fml::Status status = pass.Compute(ISize(segments_.size(), 1));
+  if (!status.ok()) {
+    return status;
+  }
+  pass.AddBufferMemoryBarrier();
+
+  return VertexBuffer{
+      .vertex_buffer = std::move(vertices),
+      .vertex_count = vertex_count_,
+      .index_type = IndexType::kNone,
+  };
+}
+
+}  // namespace impeller
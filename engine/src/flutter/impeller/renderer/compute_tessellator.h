@@ -0,0 +1,120 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_RENDERER_COMPUTE_TESSELLATOR_H_
+#define FLUTTER_IMPELLER_RENDERER_COMPUTE_TESSELLATOR_H_
+
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/status_or.h"
+#include "impeller/core/host_buffer.h"
+#include "impeller/core/vertex_buffer.h"
+#include "impeller/geometry/path_source.h"
+#include "impeller/renderer/compute_pass.h"
+#include "impeller/renderer/path_fill.comp.h"
+#include "impeller/renderer/pipeline.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      A fill path tessellator that evaluates curves on the GPU.
+///
+///             The path verbs are flattened into a list of segments on the
+///             CPU, where only Wang's formula is evaluated per curve to
+///             determine the number of subdivisions and the output offsets.
+///             The curve evaluation and triangle generation, which dominate
+///             the cost of tessellating dense curves, run in a compute pass.
+///
+///             The output is a non-indexed triangle list fanned around the
+///             first point of each contour. It can be drawn with the same
+///             stencil-then-cover modes as the output of
+///             |Tessellator::TessellateConvex|.
+///
+///             This object is not thread safe.
+///
+class ComputeTessellator {
+ public:
+  using CS = PathFillComputeShader;
+
+  /// The maximum number of parametric steps a single curve is split into.
+  static constexpr uint32_t kMaxSubdivisions = 1024u;
+
+  /// Paths that produce fewer vertices than this are cheaper to tessellate on
+  /// the CPU than to dispatch to a compute pass.
+  static constexpr size_t kMinVertexCount = 4096u;
+
+  ComputeTessellator();
+
+  ~ComputeTessellator();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Flatten the path into the segments consumed by the compute
+  ///             shader.
+  ///
+  /// @param[in]  path      The path to flatten.
+  /// @param[in]  scale     The max basis length of the transform the path is
+  ///                       drawn with, used to choose the subdivisions.
+  /// @param[out] segments  The segments of the path. Cleared first.
+  ///
+  /// @return     The number of vertices the compute shader will write.
+  ///
+  static size_t PrepareSegments(const PathSource& path,
+                                Scalar scale,
+                                std::vector<CS::Segment>& segments);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Flatten |path| into the segments used by the next call to
+  ///             |Encode|.
+  ///
+  /// @return     The number of vertices |Encode| will write.
+  ///
+  size_t Prepare(const PathSource& path, Scalar scale);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Encode the tessellation of the path passed to the last call
+  ///             to |Prepare| into |pass|.
+  ///
+  ///             The returned vertex buffer is only valid for rendering once
+  ///             the commands encoded into |pass| have executed.
+  ///
+  /// @param[in]  pass          The compute pass to encode into.
+  /// @param[in]  host_buffer   Host buffer used to upload the segments.
+  /// @param[in]  storage_mode  The storage mode of the output vertices.
+  ///
+  fml::StatusOr<VertexBuffer> Encode(
+      ComputePass& pass,
+      HostBuffer& host_buffer,
+      StorageMode storage_mode = StorageMode::kDevicePrivate);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Encode the tessellation of |path| into |pass|. Equivalent to
+  ///             |Prepare| followed by |Encode|.
+  ///
+  /// @param[in]  path          The path to tessellate.
+  /// @param[in]  scale         The max basis length of the transform.
+  /// @param[in]  pass          The compute pass to encode into.
+  /// @param[in]  host_buffer   Host buffer used to upload the segments.
+  /// @param[in]  storage_mode  The storage mode of the output vertices.
+  ///
+  fml::StatusOr<VertexBuffer> Tessellate(
+      const PathSource& path,
+      Scalar scale,
+      ComputePass& pass,
+      HostBuffer& host_buffer,
+      StorageMode storage_mode = StorageMode::kDevicePrivate);
+
+ private:
+  std::shared_ptr<Pipeline<ComputePipelineDescriptor>> pipeline_;
+  std::vector<CS::Segment> segments_;
+  size_t vertex_count_ = 0u;
+
+  ComputeTessellator(const ComputeTessellator&) = delete;
+
+  ComputeTessellator& operator=(const ComputeTessellator&) = delete;
+};
+
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_RENDERER_COMPUTE_TESSELLATOR_H_
@@ -0,0 +1,123 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/geometry/dl_path_builder.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/testing/testing.h"
+#include "impeller/core/host_buffer.h"
+#include "impeller/playground/compute_playground_test.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/compute_tessellator.h"
+
+namespace impeller {
+namespace testing {
+
+using ComputeTessellatorTest = ComputePlaygroundTest;
+INSTANTIATE_COMPUTE_SUITE(ComputeTessellatorTest);
+
+TEST(ComputeTessellatorSegmentsTest, LinesUseSingleSubdivision) {
+  flutter::DlPath path = flutter::DlPathBuilder()
+                             .MoveTo({0, 0})
+                             .LineTo({10, 0})
+                             .LineTo({10, 10})
+                             .Close()
+                             .TakePath();
+
+  std::vector<ComputeTessellator::CS::Segment> segments;
+  size_t vertex_count =
+      ComputeTessellator::PrepareSegments(path, 1.0f, segments);
+
+  ASSERT_GE(segments.size(), 2u);
+  EXPECT_EQ(vertex_count, segments.size() * 3u);
+  for (size_t i = 0; i < segments.size(); i++) {
+    EXPECT_EQ(segments[i].subdivisions, 1u);
+    EXPECT_EQ(segments[i].vertex_offset, i * 3u);
+    EXPECT_EQ(segments[i].contour_origin, Point(0, 0));
+  }
+}
+
+TEST(ComputeTessellatorSegmentsTest, CurveSubdivisionsScaleAndClamp) {
+  flutter::DlPath path = flutter::DlPathBuilder()
+                             .MoveTo({0, 0})
+                             .CubicCurveTo({0, 100}, {100, 100}, {100, 0})
+                             .TakePath();
+
+  std::vector<ComputeTessellator::CS::Segment> segments;
+  ComputeTessellator::PrepareSegments(path, 1.0f, segments);
+  ASSERT_EQ(segments.size(), 1u);
+  uint32_t base = segments[0].subdivisions;
+  EXPECT_GT(base, 1u);
+
+  ComputeTessellator::PrepareSegments(path, 4.0f, segments);
+  ASSERT_EQ(segments.size(), 1u);
+  EXPECT_GT(segments[0].subdivisions, base);
+
+  ComputeTessellator::PrepareSegments(path, 1e12f, segments);
+  ASSERT_EQ(segments.size(), 1u);
+  EXPECT_EQ(segments[0].subdivisions, ComputeTessellator::kMaxSubdivisions);
+}
+
+TEST_P(ComputeTessellatorTest, TessellatesQuadIntoFan) {
+  auto context = GetContext();
+  ASSERT_TRUE(context);
+  ASSERT_TRUE(context->GetCapabilities()->SupportsCompute());
+  auto host_buffer = HostBuffer::Create(
+      context->GetResourceAllocator(), context->GetIdleWaiter(),
+      context->GetCapabilities()->GetMinimumUniformAlignment());
+
+  Point p0(0, 0);
+  Point cp(50, 100);
+  Point p2(100, 0);
+  flutter::DlPath path = flutter::DlPathBuilder()
+                             .MoveTo(p0)
+                             .QuadraticCurveTo(cp, p2)
+                             .Close()
+                             .TakePath();
+
+  auto cmd_buffer = context->CreateCommandBuffer();
+  auto pass = cmd_buffer->CreateComputePass();
+  ASSERT_TRUE(pass && pass->IsValid());
+
+  ComputeTessellator tessellator;
+  auto result = tessellator.Tessellate(path, 1.0f, *pass, *host_buffer,
+                                       StorageMode::kHostVisible);
+  ASSERT_TRUE(result.ok());
+  VertexBuffer vertex_buffer = result.value();
+  ASSERT_GT(vertex_buffer.vertex_count, 0u);
+  EXPECT_EQ(vertex_buffer.vertex_count % 3u, 0u);
+  ASSERT_TRUE(pass->EncodeCommands());
+
+  std::vector<ComputeTessellator::CS::Segment> segments;
+  ComputeTessellator::PrepareSegments(path, 1.0f, segments);
+  ASSERT_FALSE(segments.empty());
+  uint32_t subdivisions = segments[0].subdivisions;
+
+  fml::AutoResetWaitableEvent latch;
+  ASSERT_TRUE(
+      context->GetCommandQueue()
+          ->Submit({cmd_buffer},
+                   [&latch, &vertex_buffer, p0, cp, p2,
+                    subdivisions](CommandBuffer::Status status) {
+                     EXPECT_EQ(status, CommandBuffer::Status::kCompleted);
+                     const Point* points = reinterpret_cast<const Point*>(
+                         vertex_buffer.vertex_buffer.GetBuffer()
+                             ->OnGetContents() +
+                         vertex_buffer.vertex_buffer.GetRange().offset);
+                     for (uint32_t i = 1; i <= subdivisions; i++) {
+                       Scalar t = static_cast<Scalar>(i) / subdivisions;
+                       Point expected = (1 - t) * (1 - t) * p0 +
+                                        2 * (1 - t) * t * cp + t * t * p2;
+                       const Point* triangle = points + 3 * (i - 1);
+                       EXPECT_EQ(triangle[0], p0);
+                       EXPECT_NEAR(triangle[2].x, expected.x, 1e-3);
+                       EXPECT_NEAR(triangle[2].y, expected.y, 1e-3);
+                     }
+                     latch.Signal();
+                   })
+          .ok());
+  latch.Wait();
+}
+
+}  // namespace testing
+}  // namespace impeller
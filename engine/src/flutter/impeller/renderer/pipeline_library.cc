@@ -3,6 +3,8 @@
 // found in the LICENSE file.
 
 #include "impeller/renderer/pipeline_library.h"
+
+#include <algorithm>
 #include <unordered_map>
 
 #include "impeller/base/thread.h"
@@ -38,6 +40,14 @@ PipelineFuture<ComputePipelineDescriptor> PipelineLibrary::GetPipeline(
   return {descriptor, promise->get_future()};
 }
 
+std::unique_ptr<fml::Mapping>
+PipelineLibrary::RetrievePipelineVariantManifest() const {
+  return nullptr;
+}
+
+void PipelineLibrary::PersistPipelineVariantManifest(
+    std::shared_ptr<const fml::Mapping> manifest) {}
+
 void PipelineLibrary::LogPipelineCreation(const PipelineDescriptor& p) {
 #if FLUTTER_RUNTIME_MODE == FLUTTER_RUNTIME_MODE_DEBUG || \
     FLUTTER_RUNTIME_MODE == FLUTTER_RUNTIME_MODE_PROFILE
@@ -48,6 +58,21 @@ void PipelineLibrary::LogPipelineCreation(const PipelineDescriptor& p) {
 #endif
 }
 
+void PipelineLibrary::LogPipelineCompile(fml::TimeDelta duration) {
+  Lock lock(compile_stats_mutex_);
+  compile_stats_.compile_count++;
+  compile_stats_.total_compile_time =
+      compile_stats_.total_compile_time + duration;
+  compile_stats_.max_compile_time =
+      std::max(compile_stats_.max_compile_time, duration);
+}
+
+PipelineLibrary::CompileStats PipelineLibrary::GetPipelineCompileStats()
+    const {
+  Lock lock(compile_stats_mutex_);
+  return compile_stats_;
+}
+
 void PipelineLibrary::LogPipelineUsage(const PipelineDescriptor& p) {
 #if FLUTTER_RUNTIME_MODE == FLUTTER_RUNTIME_MODE_DEBUG || \
     FLUTTER_RUNTIME_MODE == FLUTTER_RUNTIME_MODE_PROFILE
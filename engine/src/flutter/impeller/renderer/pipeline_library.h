@@ -9,6 +9,8 @@
 #include <unordered_map>
 
 #include "compute_pipeline_descriptor.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/time/time_delta.h"
 #include "impeller/base/thread.h"
 #include "impeller/base/thread_safety.h"
 #include "impeller/renderer/pipeline.h"
@@ -76,10 +78,45 @@ class PipelineLibrary : public std::enable_shared_from_this<PipelineLibrary> {
   virtual void RemovePipelinesWithEntryPoint(
       std::shared_ptr<const ShaderFunction> function) = 0;
 
+  //------------------------------------------------------------------------------
+  /// @brief      Retrieve the manifest of pipeline variants persisted by a
+  ///             previous run, if the backend supports persisting one.
+  ///
+  ///             The manifest is written and interpreted by the renderer, the
+  ///             pipeline library only stores it alongside its own caches.
+  ///
+  virtual std::unique_ptr<fml::Mapping> RetrievePipelineVariantManifest()
+      const;
+
+  //------------------------------------------------------------------------------
+  /// @brief      Persist the manifest of pipeline variants for the next run.
+  ///             Backends that do not persist pipeline caches ignore this.
+  ///
+  virtual void PersistPipelineVariantManifest(
+      std::shared_ptr<const fml::Mapping> manifest);
+
   void LogPipelineUsage(const PipelineDescriptor& p);
 
   void LogPipelineCreation(const PipelineDescriptor& p);
 
+  /// @brief The pipelines that the backend compiled and how long that took.
+  struct CompileStats {
+    size_t compile_count = 0;
+    fml::TimeDelta total_compile_time;
+    fml::TimeDelta max_compile_time;
+  };
+
+  //------------------------------------------------------------------------------
+  /// @brief      Record that the backend compiled a pipeline, which took
+  ///             `duration` from the request until the pipeline was ready.
+  ///
+  ///             Pipelines that are found in a cache of the backend or the
+  ///             driver are counted too, as the time is spent either way.
+  ///
+  void LogPipelineCompile(fml::TimeDelta duration);
+
+  CompileStats GetPipelineCompileStats() const;
+
   std::unordered_map<PipelineDescriptor,
                      int,
                      ComparableHash<PipelineDescriptor>,
@@ -104,6 +141,8 @@ class PipelineLibrary : public std::enable_shared_from_this<PipelineLibrary> {
       pipeline_use_counts_ IPLR_GUARDED_BY(pipeline_use_counts_mutex_);
 
 #endif
+  mutable Mutex compile_stats_mutex_;
+  CompileStats compile_stats_ IPLR_GUARDED_BY(compile_stats_mutex_);
 };
 
 }  // namespace impeller
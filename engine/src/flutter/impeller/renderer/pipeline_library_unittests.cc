@@ -7,6 +7,20 @@
 namespace impeller {
 namespace testing {
 
+TEST(MockPipelineLibrary, LogAndGetPipelineCompileStats) {
+  MockPipelineLibrary pipeline_library;
+  EXPECT_EQ(pipeline_library.GetPipelineCompileStats().compile_count, 0u);
+
+  pipeline_library.LogPipelineCompile(fml::TimeDelta::FromMilliseconds(3));
+  pipeline_library.LogPipelineCompile(fml::TimeDelta::FromMilliseconds(10));
+
+  PipelineLibrary::CompileStats stats =
+      pipeline_library.GetPipelineCompileStats();
+  EXPECT_EQ(stats.compile_count, 2u);
+  EXPECT_EQ(stats.total_compile_time, fml::TimeDelta::FromMilliseconds(13));
+  EXPECT_EQ(stats.max_compile_time, fml::TimeDelta::FromMilliseconds(10));
+}
+
 TEST(MockPipelineLibrary, LogAndGetPipelineUsageSinglePipeline) {
   MockPipelineLibrary pipeline_library;
 
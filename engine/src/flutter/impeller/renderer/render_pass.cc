@@ -190,6 +190,36 @@ bool RenderPass::ValidateVertexBuffers(const BufferView vertex_buffers[],
   return true;
 }
 
+bool RenderPass::ValidateIndirectBuffer(const BufferView& indirect_buffer,
+                                        uint32_t draw_count,
+                                        uint32_t stride,
+                                        bool indexed) {
+  if (!indirect_buffer) {
+    VALIDATION_LOG << "Attempted to draw with an invalid indirect buffer.";
+    return false;
+  }
+  if (draw_count == 0u) {
+    VALIDATION_LOG << "Attempted an indirect draw with a draw count of zero.";
+    return false;
+  }
+  const size_t arguments_size = indexed ? sizeof(DrawIndexedIndirectArguments)
+                                        : sizeof(DrawIndirectArguments);
+  if (stride < arguments_size || stride % 4u != 0u) {
+    VALIDATION_LOG << "Indirect draw stride " << stride
+                   << " must be a multiple of 4 of at least " << arguments_size
+                   << " bytes.";
+    return false;
+  }
+  const size_t required_length =
+      static_cast<size_t>(stride) * (draw_count - 1u) + arguments_size;
+  if (indirect_buffer.GetRange().length < required_length) {
+    VALIDATION_LOG << "Indirect buffer of " << indirect_buffer.GetRange().length
+                   << " bytes is too small for " << draw_count << " draws.";
+    return false;
+  }
+  return true;
+}
+
 bool RenderPass::ValidateIndexBuffer(const BufferView& index_buffer,
                                      IndexType index_type) {
   if (index_type == IndexType::kUnknown) {
@@ -221,6 +251,17 @@ fml::Status RenderPass::Draw() {
                      "Failed to encode command");
 }
 
+fml::Status RenderPass::DrawIndirect(BufferView indirect_buffer,
+                                     uint32_t draw_count,
+                                     uint32_t stride) {
+  pending_ = Command{};
+  bound_textures_start_ = std::nullopt;
+  bound_buffers_start_ = std::nullopt;
+  vertex_buffers_start_ = std::nullopt;
+  return fml::Status(fml::StatusCode::kUnimplemented,
+                     "Indirect draws are not supported by this backend.");
+}
+
 // |ResourceBinder|
 bool RenderPass::BindResource(ShaderStage stage,
                               DescriptorType type,
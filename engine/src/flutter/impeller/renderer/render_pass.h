@@ -171,6 +171,32 @@ class RenderPass : public ResourceBinder {
   /// Record the currently pending command.
   virtual fml::Status Draw();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Record `draw_count` draws of the currently pending command
+  ///             with arguments that the GPU reads from `indirect_buffer`.
+  ///
+  ///             The draws read `DrawIndexedIndirectArguments` if an index
+  ///             buffer is bound, and `DrawIndirectArguments` otherwise. The
+  ///             first set of arguments is at the start of `indirect_buffer`,
+  ///             and each following set is `stride` bytes after the last. The
+  ///             element count, instance count and base vertex of the pending
+  ///             command are ignored.
+  ///
+  ///             This is only available when
+  ///             `Capabilities::SupportsIndirectDraw` is true. Otherwise the
+  ///             pending command is discarded and an error is returned.
+  ///
+  /// @param[in]  indirect_buffer  The buffer view holding the draw arguments.
+  /// @param[in]  draw_count       The number of draws to record.
+  /// @param[in]  stride           The distance in bytes between the arguments
+  ///                              of consecutive draws. Must be a multiple of
+  ///                              four and at least the size of the
+  ///                              arguments.
+  ///
+  virtual fml::Status DrawIndirect(BufferView indirect_buffer,
+                                   uint32_t draw_count,
+                                   uint32_t stride);
+
   // |ResourceBinder|
   virtual bool BindResource(ShaderStage stage,
                             DescriptorType type,
@@ -271,6 +297,11 @@ class RenderPass : public ResourceBinder {
   static bool ValidateIndexBuffer(const BufferView& index_buffer,
                                   IndexType index_type);
 
+  static bool ValidateIndirectBuffer(const BufferView& indirect_buffer,
+                                     uint32_t draw_count,
+                                     uint32_t stride,
+                                     bool indexed);
+
   virtual void OnSetLabel(std::string_view label) = 0;
 
   virtual bool OnEncodeCommands(const Context& context) const = 0;
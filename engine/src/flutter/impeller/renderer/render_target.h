@@ -185,6 +185,14 @@ class RenderTargetAllocator {
   /// @brief Re-enable any caching if disabled.
   virtual void EnableCache() {}
 
+  /// @brief Release any cached textures that were not used by the most recent
+  ///        frame, for example in response to a low memory warning.
+  virtual void Trim() {}
+
+  /// @brief The number of bytes of device memory held by the cached textures,
+  ///        if any.
+  virtual size_t GetCachedBytes() const { return 0u; }
+
   /// @brief Mark the beginning of a frame workload.
   ///
   ///       This may be used to reset any tracking state on whether or not a
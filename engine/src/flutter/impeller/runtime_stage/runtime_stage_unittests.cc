@@ -338,6 +338,40 @@ TEST_P(RuntimeStageTest, CanRegisterStage) {
   }
 }
 
+TEST_P(RuntimeStageTest, CanRegisterSameStageAgain) {
+  const std::shared_ptr<fml::Mapping> fixture =
+      flutter::testing::OpenFixtureAsMapping("ink_sparkle.frag.iplr");
+  ASSERT_TRUE(fixture);
+  auto stages = RuntimeStage::DecodeRuntimeStages(fixture);
+  ABSL_ASSERT_OK(stages);
+  auto stage =
+      stages.value()[PlaygroundBackendToRuntimeStageBackend(GetBackend())];
+  ASSERT_TRUE(stage);
+  auto library = GetContext()->GetShaderLibrary();
+
+  // The second registration of identical code may reuse the library built
+  // for the first one, but must behave the same.
+  for (int i = 0; i < 2; i++) {
+    std::promise<bool> registration;
+    auto future = registration.get_future();
+    library->RegisterFunction(
+        stage->GetEntrypoint(),                  //
+        ToShaderStage(stage->GetShaderStage()),  //
+        stage->GetCodeMapping(),                 //
+        fml::MakeCopyable([reg = std::move(registration)](bool result) mutable {
+          reg.set_value(result);
+        }));
+    ASSERT_TRUE(future.get());
+    EXPECT_NE(
+        library->GetFunction(stage->GetEntrypoint(), ShaderStage::kFragment),
+        nullptr);
+    library->UnregisterFunction(stage->GetEntrypoint(), ShaderStage::kFragment);
+    EXPECT_EQ(
+        library->GetFunction(stage->GetEntrypoint(), ShaderStage::kFragment),
+        nullptr);
+  }
+}
+
 TEST_P(RuntimeStageTest, CanCreatePipelineFromRuntimeStage) {
   auto stages_result = OpenAssetAsRuntimeStage("ink_sparkle.frag.iplr");
   ABSL_ASSERT_OK(stages_result);
@@ -32,31 +32,8 @@ static const TESSalloc kAlloc = {
     0                                    /* =extraVertices */
 };
 
-TessellatorLibtess::TessellatorLibtess()
-    : c_tessellator_(nullptr, &DestroyTessellator) {
-  TESSalloc alloc = kAlloc;
-  {
-    // libTess2 copies the TESSalloc despite the non-const argument.
-    CTessellator tessellator(::tessNewTess(&alloc), &DestroyTessellator);
-    c_tessellator_ = std::move(tessellator);
-  }
-}
-
-TessellatorLibtess::~TessellatorLibtess() = default;
-
-static int ToTessWindingRule(FillType fill_type) {
-  switch (fill_type) {
-    case FillType::kOdd:
-      return TESS_WINDING_ODD;
-    case FillType::kNonZero:
-      return TESS_WINDING_NONZERO;
-  }
-  return TESS_WINDING_ODD;
-}
-
-namespace {
-
-class Polyline : public impeller::PathTessellator::VertexWriter {
+class TessellatorLibtess::Polyline
+    : public impeller::PathTessellator::VertexWriter {
  public:
   struct Contour {
     const size_t start;
@@ -73,6 +50,13 @@ class Polyline : public impeller::PathTessellator::VertexWriter {
     contour_start_ = contour_end;
   }
 
+  /// Empties the polyline while keeping its storage.
+  void Reset() {
+    points.clear();
+    contours.clear();
+    contour_start_ = 0u;
+  }
+
   std::vector<Point> points;
   std::vector<Contour> contours;
 
@@ -80,7 +64,28 @@ class Polyline : public impeller::PathTessellator::VertexWriter {
   size_t contour_start_ = 0u;
 };
 
-}  // namespace
+TessellatorLibtess::TessellatorLibtess()
+    : c_tessellator_(nullptr, &DestroyTessellator),
+      polyline_(std::make_unique<Polyline>()) {
+  TESSalloc alloc = kAlloc;
+  {
+    // libTess2 copies the TESSalloc despite the non-const argument.
+    CTessellator tessellator(::tessNewTess(&alloc), &DestroyTessellator);
+    c_tessellator_ = std::move(tessellator);
+  }
+}
+
+TessellatorLibtess::~TessellatorLibtess() = default;
+
+static int ToTessWindingRule(FillType fill_type) {
+  switch (fill_type) {
+    case FillType::kOdd:
+      return TESS_WINDING_ODD;
+    case FillType::kNonZero:
+      return TESS_WINDING_NONZERO;
+  }
+  return TESS_WINDING_ODD;
+}
 
 TessellatorLibtess::Result TessellatorLibtess::Tessellate(
     const PathSource& source,
@@ -90,7 +95,8 @@ TessellatorLibtess::Result TessellatorLibtess::Tessellate(
     return TessellatorLibtess::Result::kInputError;
   }
 
-  Polyline polyline;
+  Polyline& polyline = *polyline_;
+  polyline.Reset();
   PathTessellator::PathToFilledVertices(source, polyline, tolerance);
 
   auto fill_type = source.GetFillType();
@@ -99,6 +105,29 @@ TessellatorLibtess::Result TessellatorLibtess::Tessellate(
     return TessellatorLibtess::Result::kInputError;
   }
 
+  static_assert(sizeof(Point) == 2 * sizeof(float));
+
+  //----------------------------------------------------------------------------
+  /// A single convex contour is the same under either fill rule and is
+  /// covered exactly by a fan around its first point.
+  ///
+  if (source.IsConvex() && polyline.contours.size() == 1u &&
+      polyline.points.size() >= 3u && polyline.points.size() < USHRT_MAX) {
+    auto point_count = static_cast<uint16_t>(polyline.points.size());
+    indices_.clear();
+    indices_.reserve((point_count - 2u) * 3u);
+    for (uint16_t i = 1u; i + 1u < point_count; i++) {
+      indices_.push_back(0u);
+      indices_.push_back(i);
+      indices_.push_back(i + 1u);
+    }
+    if (!callback(reinterpret_cast<const float*>(polyline.points.data()),
+                  point_count, indices_.data(), indices_.size())) {
+      return TessellatorLibtess::Result::kInputError;
+    }
+    return TessellatorLibtess::Result::kSuccess;
+  }
+
   auto tessellator = c_tessellator_.get();
   if (!tessellator) {
     return TessellatorLibtess::Result::kTessellationError;
@@ -110,7 +139,6 @@ TessellatorLibtess::Result TessellatorLibtess::Tessellate(
   //----------------------------------------------------------------------------
   /// Feed contour information to the tessellator.
   ///
-  static_assert(sizeof(Point) == 2 * sizeof(float));
   for (auto contour : polyline.contours) {
     ::tessAddContour(tessellator,  // the C tessellator
                      kVertexSize,  //
@@ -149,11 +177,11 @@ TessellatorLibtess::Result TessellatorLibtess::Tessellate(
 
     // libtess uses an int index internally due to usage of -1 as a sentinel
     // value.
-    std::vector<uint16_t> indices(element_item_count);
+    indices_.resize(element_item_count);
     for (int i = 0; i < element_item_count; i++) {
-      indices[i] = static_cast<uint16_t>(elements[i]);
+      indices_[i] = static_cast<uint16_t>(elements[i]);
     }
-    if (!callback(vertices, vertex_item_count, indices.data(),
+    if (!callback(vertices, vertex_item_count, indices_.data(),
                   element_item_count)) {
       return TessellatorLibtess::Result::kInputError;
     }
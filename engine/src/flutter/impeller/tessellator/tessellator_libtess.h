@@ -7,6 +7,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "flutter/impeller/geometry/path_source.h"
 
@@ -58,6 +59,11 @@ class TessellatorLibtess {
   ///                        path for rendering.
   /// @param[in]  callback  The callback, return false to indicate failure.
   ///
+  ///             Convex sources made of a single contour are triangulated as
+  ///             a fan without going through libtess. The polyline and index
+  ///             storage is kept between calls, so reusing one tessellator
+  ///             for many paths avoids reallocating it.
+  ///
   /// @return The result status of the tessellation.
   ///
   TessellatorLibtess::Result Tessellate(const PathSource& source,
@@ -65,7 +71,11 @@ class TessellatorLibtess {
                                         const BuilderCallback& callback);
 
  private:
+  class Polyline;
+
   CTessellator c_tessellator_;
+  std::unique_ptr<Polyline> polyline_;
+  std::vector<uint16_t> indices_;
 
   TessellatorLibtess(const TessellatorLibtess&) = delete;
 
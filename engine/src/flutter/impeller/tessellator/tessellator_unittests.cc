@@ -94,6 +94,58 @@ TEST(TessellatorTest, TessellatorBuilderReturnsCorrectResultStatus) {
   }
 }
 
+TEST(TessellatorTest, LibtessFansSingleConvexContours) {
+  TessellatorLibtess t;
+  auto area = [](const float* vertices, const uint16_t* indices,
+                 size_t indices_count) {
+    Scalar total = 0;
+    for (size_t i = 0; i < indices_count; i += 3) {
+      Point a(vertices[indices[i] * 2], vertices[indices[i] * 2 + 1]);
+      Point b(vertices[indices[i + 1] * 2], vertices[indices[i + 1] * 2 + 1]);
+      Point c(vertices[indices[i + 2] * 2], vertices[indices[i + 2] * 2 + 1]);
+      total += std::abs((b - a).Cross(c - a)) * 0.5f;
+    }
+    return total;
+  };
+
+  // A convex contour skips libtess and comes back as a fan over the polyline.
+  auto rect = flutter::DlPath::MakeRect(Rect::MakeLTRB(0, 0, 10, 10));
+  size_t fan_vertex_count = 0;
+  Scalar fan_area = 0;
+  ASSERT_EQ(t.Tessellate(rect, 1.0f,
+                         [&](const float* vertices, size_t vertices_count,
+                             const uint16_t* indices, size_t indices_count) {
+                           fan_vertex_count = vertices_count;
+                           EXPECT_EQ(indices_count, (vertices_count - 2) * 3);
+                           fan_area = area(vertices, indices, indices_count);
+                           return true;
+                         }),
+            TessellatorLibtess::Result::kSuccess);
+  EXPECT_EQ(fan_vertex_count, 5u);
+  EXPECT_FLOAT_EQ(fan_area, 100.0f);
+
+  // A concave contour still goes through libtess, reusing the same storage.
+  auto notched = flutter::DlPathBuilder{}
+                     .MoveTo({0, 0})
+                     .LineTo({10, 0})
+                     .LineTo({10, 10})
+                     .LineTo({5, 5})
+                     .LineTo({0, 10})
+                     .Close()
+                     .TakePath();
+  ASSERT_FALSE(notched.IsConvex());
+  Scalar notched_area = 0;
+  ASSERT_EQ(t.Tessellate(notched, 1.0f,
+                         [&](const float* vertices, size_t vertices_count,
+                             const uint16_t* indices, size_t indices_count) {
+                           notched_area =
+                               area(vertices, indices, indices_count);
+                           return true;
+                         }),
+            TessellatorLibtess::Result::kSuccess);
+  EXPECT_FLOAT_EQ(notched_area, 75.0f);
+}
+
 TEST(TessellatorTest, TessellateConvex) {
   {
     std::vector<Point> points;
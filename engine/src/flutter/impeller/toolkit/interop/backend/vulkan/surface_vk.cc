@@ -4,6 +4,10 @@
 
 #include "impeller/toolkit/interop/backend/vulkan/surface_vk.h"
 
+#include <mutex>
+
+#include "impeller/renderer/backend/vulkan/context_vk.h"
+
 namespace impeller::interop {
 
 SurfaceVK::SurfaceVK(Context& context,
@@ -12,4 +16,22 @@ SurfaceVK::SurfaceVK(Context& context,
 
 SurfaceVK::~SurfaceVK() = default;
 
+bool SurfaceVK::DrawDisplayList(const DisplayList& dl,
+                                SubmitSemaphoresVK semaphores) const {
+  if (!IsValid() || !dl.IsValid()) {
+    return false;
+  }
+
+  std::scoped_lock lock(GetContext().GetDrawMutex());
+  auto& context_vk = impeller::ContextVK::Cast(*GetContext().GetContext());
+  context_vk.SetPendingSubmitSemaphores(std::move(semaphores));
+  auto result = RenderLocked(dl.GetDisplayList());
+  // Flush even if rendering failed so that the semaphores are always signaled
+  // and the waits consumed.
+  if (!context_vk.FlushCommandBuffers()) {
+    return false;
+  }
+  return result;
+}
+
 }  // namespace impeller::interop
@@ -5,6 +5,7 @@
 #ifndef FLUTTER_IMPELLER_TOOLKIT_INTEROP_BACKEND_VULKAN_SURFACE_VK_H_
 #define FLUTTER_IMPELLER_TOOLKIT_INTEROP_BACKEND_VULKAN_SURFACE_VK_H_
 
+#include "impeller/renderer/backend/vulkan/command_queue_vk.h"
 #include "impeller/toolkit/interop/surface.h"
 
 namespace impeller::interop {
@@ -18,6 +19,21 @@ class SurfaceVK final : public Surface {
   SurfaceVK(const SurfaceVK&) = delete;
 
   SurfaceVK& operator=(const SurfaceVK&) = delete;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Draw the display list in a queue submission that waits on
+  ///             and then signals the given semaphores.
+  ///
+  /// @param[in]  dl          The display list.
+  /// @param[in]  semaphores  The semaphores. They must have been created on
+  ///                         the device of the context.
+  ///
+  /// @return     True if the display list was drawn and submitted.
+  ///
+  bool DrawDisplayList(const DisplayList& dl,
+                       SubmitSemaphoresVK semaphores) const;
+
+  using Surface::DrawDisplayList;
 };
 
 }  // namespace impeller::interop
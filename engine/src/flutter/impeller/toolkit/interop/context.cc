@@ -25,6 +25,10 @@ AiksContext& Context::GetAiksContext() {
   return context_;
 }
 
+std::mutex& Context::GetDrawMutex() {
+  return draw_mutex_;
+}
+
 bool Context::IsBackend(impeller::Context::BackendType type) const {
   if (!IsValid()) {
     return false;
@@ -5,6 +5,8 @@
 #ifndef FLUTTER_IMPELLER_TOOLKIT_INTEROP_CONTEXT_H_
 #define FLUTTER_IMPELLER_TOOLKIT_INTEROP_CONTEXT_H_
 
+#include <mutex>
+
 #include "impeller/display_list/aiks_context.h"
 #include "impeller/renderer/context.h"
 #include "impeller/toolkit/interop/impeller.h"
@@ -35,11 +37,16 @@ class Context
 
   bool IsVulkan() const;
 
+  /// Surfaces of the same context share its content context and host buffer,
+  /// so their draws must not overlap. Hold this lock while drawing.
+  std::mutex& GetDrawMutex();
+
  protected:
   explicit Context(std::shared_ptr<impeller::Context> context);
 
  private:
   impeller::AiksContext context_;
+  std::mutex draw_mutex_;
 };
 
 }  // namespace impeller::interop
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <iterator>
 #include <sstream>
+#include <vector>
 
 #include "flutter/fml/mapping.h"
 #include "impeller/base/validation.h"
@@ -781,6 +782,48 @@ bool ImpellerSurfaceDrawDisplayList(ImpellerSurface surface,
   return GetPeer(surface)->DrawDisplayList(*GetPeer(display_list));
 }
 
+IMPELLER_EXTERN_C
+bool ImpellerSurfaceDrawDisplayLists(
+    ImpellerSurface surface,
+    const ImpellerDisplayList* display_lists,
+    uint32_t display_list_count) {
+  std::vector<const DisplayList*> dls;
+  dls.reserve(display_list_count);
+  for (uint32_t i = 0; i < display_list_count; i++) {
+    dls.push_back(GetPeer(display_lists[i]));
+  }
+  return GetPeer(surface)->DrawDisplayLists(dls);
+}
+
+IMPELLER_EXTERN_C
+bool ImpellerSurfaceDrawDisplayListVulkan(
+    ImpellerSurface surface,
+    ImpellerDisplayList display_list,
+    const ImpellerVulkanSemaphores* semaphores) {
+#if IMPELLER_ENABLE_VULKAN
+  if (!GetPeer(surface)->GetContext().IsVulkan()) {
+    VALIDATION_LOG << "Not a Vulkan surface.";
+    return false;
+  }
+  SubmitSemaphoresVK submit_semaphores;
+  for (uint32_t i = 0; i < semaphores->wait_semaphore_count; i++) {
+    submit_semaphores.wait_semaphores.push_back(
+        reinterpret_cast<VkSemaphore>(semaphores->wait_semaphores[i]));
+    submit_semaphores.wait_stages.push_back(
+        vk::PipelineStageFlagBits::eAllCommands);
+  }
+  for (uint32_t i = 0; i < semaphores->signal_semaphore_count; i++) {
+    submit_semaphores.signal_semaphores.push_back(
+        reinterpret_cast<VkSemaphore>(semaphores->signal_semaphores[i]));
+  }
+  return reinterpret_cast<SurfaceVK*>(GetPeer(surface))
+      ->DrawDisplayList(*GetPeer(display_list), std::move(submit_semaphores));
+#else   // IMPELLER_ENABLE_VULKAN
+  VALIDATION_LOG << "Vulkan not available.";
+  return false;
+#endif  // IMPELLER_ENABLE_VULKAN
+}
+
 IMPELLER_EXTERN_C
 bool ImpellerSurfacePresent(ImpellerSurface surface) {
   return GetPeer(surface)->Present();
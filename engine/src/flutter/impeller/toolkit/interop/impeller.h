@@ -173,6 +173,11 @@ IMPELLER_DEFINE_HANDLE(ImpellerDisplayList);
 ///
 /// Display list builders are context-agnostic.
 ///
+/// A builder must only be used by one thread at a time. Separate builders do
+/// not share any state and may record concurrently on different threads. The
+/// resulting display lists can be combined into a single frame with
+/// `ImpellerSurfaceDrawDisplayLists`.
+///
 IMPELLER_DEFINE_HANDLE(ImpellerDisplayListBuilder);
 
 //------------------------------------------------------------------------------
@@ -288,6 +293,9 @@ IMPELLER_DEFINE_HANDLE(ImpellerPathBuilder);
 ///
 /// Creating surfaces is typically platform and client-rendering-API specific.
 ///
+/// Draws to surfaces created from the same context are serialized because
+/// they share the rendering resources of that context.
+///
 IMPELLER_DEFINE_HANDLE(ImpellerSurface);
 
 //------------------------------------------------------------------------------
@@ -643,6 +651,17 @@ typedef struct ImpellerContextVulkanInfo {
   uint32_t graphics_queue_index;
 } ImpellerContextVulkanInfo;
 
+typedef struct ImpellerVulkanSemaphores {
+  /// The number of semaphores in `wait_semaphores`.
+  uint32_t wait_semaphore_count;
+  /// Binary `VkSemaphore`s the draw waits on before it executes.
+  void* IMPELLER_NULLABLE const* IMPELLER_NULLABLE wait_semaphores;
+  /// The number of semaphores in `signal_semaphores`.
+  uint32_t signal_semaphore_count;
+  /// Binary `VkSemaphore`s signaled once the draw completes.
+  void* IMPELLER_NULLABLE const* IMPELLER_NULLABLE signal_semaphores;
+} ImpellerVulkanSemaphores;
+
 typedef struct ImpellerTextDecoration {
   /// A mask of `ImpellerTextDecorationType`s to enable.
   int types;
@@ -917,6 +936,58 @@ bool ImpellerSurfaceDrawDisplayList(ImpellerSurface IMPELLER_NONNULL surface,
                                     ImpellerDisplayList IMPELLER_NONNULL
                                         display_list);
 
+//------------------------------------------------------------------------------
+/// @brief      Draw multiple display lists onto the surface, in order, with a
+///             single submission to the GPU. This is cheaper than drawing each
+///             display list with `ImpellerSurfaceDrawDisplayList`, and allows
+///             display lists recorded on different threads to be combined
+///             into one frame.
+///
+/// @warning    The same OpenGL state caveats as
+///             `ImpellerSurfaceDrawDisplayList` apply.
+///
+/// @param[in]  surface             The surface to draw the display lists to.
+/// @param[in]  display_lists       The display lists to draw onto the surface,
+///                                 from bottom to top.
+/// @param[in]  display_list_count  The number of display lists. Must be at
+///                                 least one.
+///
+/// @return     If the display lists could be drawn onto the surface.
+///
+IMPELLER_EXPORT
+bool ImpellerSurfaceDrawDisplayLists(
+    ImpellerSurface IMPELLER_NONNULL surface,
+    const ImpellerDisplayList IMPELLER_NONNULL* IMPELLER_NONNULL display_lists,
+    uint32_t display_list_count);
+
+//------------------------------------------------------------------------------
+/// @brief      Draw a display list onto a Vulkan surface in a queue submission
+///             that waits on and signals semaphores owned by the embedder.
+///             This allows the embedder to synchronize drawing with work it
+///             submits itself, such as producing a texture that is drawn by
+///             the display list or consuming the rendered surface, without
+///             waiting for the device to become idle.
+///
+///             The semaphores must be binary semaphores created on the logical
+///             device returned by `ImpellerContextGetVulkanInfo`. Impeller
+///             does not take ownership of them. Waits happen before any
+///             command in the submission executes.
+///
+/// @warning    If the surface is not a Vulkan surface, False is returned and
+///             nothing is drawn.
+///
+/// @param[in]  surface       The surface to draw the display list to.
+/// @param[in]  display_list  The display list to draw onto the surface.
+/// @param[in]  semaphores    The semaphores to wait on and signal.
+///
+/// @return     If the display list could be drawn onto the surface.
+///
+IMPELLER_EXPORT
+bool ImpellerSurfaceDrawDisplayListVulkan(
+    ImpellerSurface IMPELLER_NONNULL surface,
+    ImpellerDisplayList IMPELLER_NONNULL display_list,
+    const ImpellerVulkanSemaphores* IMPELLER_NONNULL semaphores);
+
 //------------------------------------------------------------------------------
 /// @brief      Present the surface to the underlying window system.
 ///
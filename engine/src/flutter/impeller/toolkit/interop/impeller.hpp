@@ -206,6 +206,8 @@ struct Proc {
   PROC(ImpellerSurfaceCreateWrappedFBONew)                        \
   PROC(ImpellerSurfaceCreateWrappedMetalDrawableNew)              \
   PROC(ImpellerSurfaceDrawDisplayList)                            \
+  PROC(ImpellerSurfaceDrawDisplayListVulkan)                      \
+  PROC(ImpellerSurfaceDrawDisplayLists)                           \
   PROC(ImpellerSurfacePresent)                                    \
   PROC(ImpellerSurfaceRelease)                                    \
   PROC(ImpellerSurfaceRetain)                                     \
@@ -1482,6 +1484,28 @@ class Surface : public Object<ImpellerSurface, ImpellerSurfaceTraits> {
                                                            display_list.Get());
   }
 
+  //----------------------------------------------------------------------------
+  /// @see      ImpellerSurfaceDrawDisplayLists
+  ///
+  bool Draw(const std::vector<DisplayList>& display_lists) const {
+    std::vector<ImpellerDisplayList> handles;
+    handles.reserve(display_lists.size());
+    for (const auto& display_list : display_lists) {
+      handles.push_back(display_list.Get());
+    }
+    return gGlobalProcTable.ImpellerSurfaceDrawDisplayLists(
+        Get(), handles.data(), static_cast<uint32_t>(handles.size()));
+  }
+
+  //----------------------------------------------------------------------------
+  /// @see      ImpellerSurfaceDrawDisplayListVulkan
+  ///
+  bool DrawVulkan(const DisplayList& display_list,
+                  const ImpellerVulkanSemaphores& semaphores) const {
+    return gGlobalProcTable.ImpellerSurfaceDrawDisplayListVulkan(
+        Get(), display_list.Get(), &semaphores);
+  }
+
   //----------------------------------------------------------------------------
   /// @see      ImpellerSurfacePresent
   ///
@@ -2,11 +2,15 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <thread>
+#include <vector>
+
 #include "flutter/fml/native_library.h"
 #include "flutter/fml/string_conversion.h"
 #include "flutter/testing/testing.h"
 #include "impeller/base/allocation.h"
 #include "impeller/renderer/backend/gles/context_gles.h"
+#include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/toolkit/interop/context.h"
 #include "impeller/toolkit/interop/dl.h"
 #include "impeller/toolkit/interop/dl_builder.h"
@@ -96,6 +100,83 @@ TEST_P(InteropPlaygroundTest, CanDrawRect) {
       }));
 }
 
+TEST_P(InteropPlaygroundTest, CanDrawDisplayListsRecordedOnManyThreads) {
+  constexpr size_t kListCount = 4u;
+  std::vector<ScopedObject<DisplayList>> dls(kListCount);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kListCount; i++) {
+    threads.emplace_back([&dls, i]() {
+      auto builder =
+          Adopt<DisplayListBuilder>(ImpellerDisplayListBuilderNew(nullptr));
+      auto paint = Adopt<Paint>(ImpellerPaintNew());
+      ImpellerColor color = {0.25f * (i + 1), 0.0, 1.0, 1.0};
+      ImpellerPaintSetColor(paint.GetC(), &color);
+      ImpellerRect rect = {10.0f + 110.0f * i, 20, 100, 200};
+      ImpellerDisplayListBuilderDrawRect(builder.GetC(), &rect, paint.GetC());
+      dls[i] = Adopt<DisplayList>(
+          ImpellerDisplayListBuilderCreateDisplayListNew(builder.GetC()));
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  std::vector<ImpellerDisplayList> handles;
+  for (const auto& dl : dls) {
+    ASSERT_TRUE(dl);
+    handles.push_back(dl.GetC());
+  }
+  ASSERT_TRUE(
+      OpenPlaygroundHere([&](const auto& context, const auto& surface) -> bool {
+        return ImpellerSurfaceDrawDisplayLists(surface.GetC(), handles.data(),
+                                               handles.size());
+      }));
+}
+
+TEST_P(InteropPlaygroundTest, CanDrawWithVulkanSemaphores) {
+  auto context = GetInteropContext();
+  auto impeller_context = context->GetContext();
+  if (impeller_context->GetBackendType() !=
+      impeller::Context::BackendType::kVulkan) {
+    GTEST_SKIP() << "This test checks Vulkan semaphores.";
+    return;
+  }
+  const auto& device = impeller::ContextVK::Cast(*impeller_context).GetDevice();
+
+  auto semaphore = device.createSemaphoreUnique({});
+  ASSERT_EQ(semaphore.result, vk::Result::eSuccess);
+  void* handle = static_cast<VkSemaphore>(semaphore.value.get());
+
+  auto builder =
+      Adopt<DisplayListBuilder>(ImpellerDisplayListBuilderNew(nullptr));
+  auto paint = Adopt<Paint>(ImpellerPaintNew());
+  ImpellerColor color = {0.0, 1.0, 0.0, 1.0};
+  ImpellerPaintSetColor(paint.GetC(), &color);
+  ImpellerRect rect = {10, 20, 100, 200};
+  ImpellerDisplayListBuilderDrawRect(builder.GetC(), &rect, paint.GetC());
+  auto dl = Adopt<DisplayList>(
+      ImpellerDisplayListBuilderCreateDisplayListNew(builder.GetC()));
+  ASSERT_TRUE(dl);
+
+  ImpellerVulkanSemaphores signal = {};
+  signal.signal_semaphore_count = 1u;
+  signal.signal_semaphores = &handle;
+  ImpellerVulkanSemaphores wait = {};
+  wait.wait_semaphore_count = 1u;
+  wait.wait_semaphores = &handle;
+
+  ASSERT_TRUE(
+      OpenPlaygroundHere([&](const auto& context, const auto& surface) -> bool {
+        // Each frame signals the semaphore and then consumes the signal so
+        // that it is unsignaled again for the next frame.
+        return ImpellerSurfaceDrawDisplayListVulkan(surface.GetC(), dl.GetC(),
+                                                    &signal) &&
+               ImpellerSurfaceDrawDisplayListVulkan(surface.GetC(), dl.GetC(),
+                                                    &wait);
+      }));
+  ASSERT_EQ(device.waitIdle(), vk::Result::eSuccess);
+}
+
 TEST_P(InteropPlaygroundTest, CanDrawImage) {
   auto compressed = LoadFixtureImageCompressed(
       flutter::testing::OpenFixtureAsMapping("boston.jpg"));
@@ -4,6 +4,7 @@
 
 #include "impeller/toolkit/interop/surface.h"
 
+#include "flutter/display_list/dl_builder.h"
 #include "impeller/base/validation.h"
 #include "impeller/display_list/aiks_context.h"
 #include "impeller/display_list/dl_dispatcher.h"
@@ -27,8 +28,43 @@ bool Surface::DrawDisplayList(const DisplayList& dl) const {
   if (!IsValid() || !dl.IsValid()) {
     return false;
   }
+  return Render(dl.GetDisplayList());
+}
+
+bool Surface::DrawDisplayLists(
+    const std::vector<const DisplayList*>& dls) const {
+  if (!IsValid() || dls.empty()) {
+    return false;
+  }
+  for (const auto* dl : dls) {
+    if (!dl || !dl->IsValid()) {
+      return false;
+    }
+  }
+  if (dls.size() == 1u) {
+    return Render(dls.front()->GetDisplayList());
+  }
+
+  // Nest the lists in one display list so that they are rendered in a single
+  // pass and submission, in order.
+  flutter::DisplayListBuilder builder(Rect::MakeSize(surface_->GetSize()));
+  for (const auto* dl : dls) {
+    builder.DrawDisplayList(dl->GetDisplayList());
+  }
+  return Render(builder.Build());
+}
+
+Context& Surface::GetContext() const {
+  return *context_;
+}
+
+bool Surface::Render(const sk_sp<flutter::DisplayList>& display_list) const {
+  std::scoped_lock lock(context_->GetDrawMutex());
+  return RenderLocked(display_list);
+}
 
-  auto display_list = dl.GetDisplayList();
+bool Surface::RenderLocked(
+    const sk_sp<flutter::DisplayList>& display_list) const {
   auto& content_context = context_->GetAiksContext().GetContentContext();
   auto render_target = surface_->GetRenderTarget();
 
@@ -6,6 +6,7 @@
 #define FLUTTER_IMPELLER_TOOLKIT_INTEROP_SURFACE_H_
 
 #include <memory>
+#include <vector>
 
 #include "impeller/renderer/surface.h"
 #include "impeller/toolkit/interop/context.h"
@@ -28,16 +29,26 @@ class Surface
 
   bool DrawDisplayList(const DisplayList& dl) const;
 
+  bool DrawDisplayLists(const std::vector<const DisplayList*>& dls) const;
+
   bool Present() const;
 
+  Context& GetContext() const;
+
  protected:
   explicit Surface(Context& context,
                    std::shared_ptr<impeller::Surface> surface);
 
+  /// Render the display list to the surface. The caller must hold the draw
+  /// mutex of the context.
+  bool RenderLocked(const sk_sp<flutter::DisplayList>& display_list) const;
+
  private:
   ScopedObject<Context> context_;
   std::shared_ptr<impeller::Surface> surface_;
   bool is_valid_ = false;
+
+  bool Render(const sk_sp<flutter::DisplayList>& display_list) const;
 };
 
 }  // namespace impeller::interop
@@ -13,7 +13,7 @@
 
 #include "flutter/fml/logging.h"
 #include "flutter/fml/trace_event.h"
-#include "fml/closure.h"
+#include "flutter/fml/trace_recorder.h"
 
 #include "impeller/base/validation.h"
 #include "impeller/core/allocator.h"
@@ -261,20 +261,28 @@ static void DrawGlyph(SkCanvas* canvas,
 
 /// @brief Batch render to a single surface.
 ///
-/// This is only safe for use when updating a fresh texture.
+/// This is only safe for use when updating a fresh texture. Only the rows at
+/// and below [upload_top] are rendered and uploaded, as all the new glyphs
+/// are placed below the region the previous atlas is copied into.
 static bool BulkUpdateAtlasBitmap(const GlyphAtlas& atlas,
                                   std::shared_ptr<BlitPass>& blit_pass,
                                   HostBuffer& data_host_buffer,
                                   const std::shared_ptr<Texture>& texture,
                                   const std::vector<FontGlyphPair>& new_pairs,
                                   size_t start_index,
-                                  size_t end_index) {
+                                  size_t end_index,
+                                  int64_t upload_top) {
   TRACE_EVENT0("impeller", __FUNCTION__);
 
   bool has_color = atlas.GetType() == GlyphAtlas::Type::kColorBitmap;
 
+  const ISize texture_size = texture->GetSize();
+  FML_DCHECK(upload_top >= 0 && upload_top < texture_size.height);
+  const ISize upload_size(texture_size.width,
+                          texture_size.height - upload_top);
+
   SkBitmap bitmap;
-  bitmap.setInfo(GetImageInfo(atlas, Size(texture->GetSize())));
+  bitmap.setInfo(GetImageInfo(atlas, Size(upload_size)));
   if (!bitmap.tryAllocPixels()) {
     return false;
   }
@@ -301,7 +309,8 @@ static bool BulkUpdateAtlasBitmap(const GlyphAtlas& atlas,
       continue;
     }
 
-    DrawGlyph(canvas, SkPoint::Make(pos.GetLeft(), pos.GetTop()),
+    FML_DCHECK(pos.GetTop() >= upload_top);
+    DrawGlyph(canvas, SkPoint::Make(pos.GetLeft(), pos.GetTop() - upload_top),
               pair.scaled_font, pair.glyph, bounds, pair.glyph.properties,
               has_color);
   }
@@ -310,15 +319,15 @@ static bool BulkUpdateAtlasBitmap(const GlyphAtlas& atlas,
   // benchmarks as substantially faster on a number of Android devices.
   BufferView buffer_view = data_host_buffer.Emplace(
       bitmap.getAddr(0, 0),
-      texture->GetSize().Area() *
+      upload_size.Area() *
           BytesPerPixelForPixelFormat(
               atlas.GetTexture()->GetTextureDescriptor().format),
       data_host_buffer.GetMinimumUniformAlignment());
 
   return blit_pass->AddCopy(std::move(buffer_view),  //
                             texture,                 //
-                            IRect::MakeXYWH(0, 0, texture->GetSize().width,
-                                            texture->GetSize().height));
+                            IRect::MakeXYWH(0, upload_top, upload_size.width,
+                                            upload_size.height));
 }
 
 static bool UpdateAtlasBitmap(const GlyphAtlas& atlas,
@@ -502,11 +511,12 @@ TypographerContextSkia::CollectNewGlyphs(
 
 std::shared_ptr<GlyphAtlas> TypographerContextSkia::CreateGlyphAtlas(
     Context& context,
+    GlyphAtlasUploads& uploads,
     GlyphAtlas::Type type,
     HostBuffer& data_host_buffer,
     const std::shared_ptr<GlyphAtlasContext>& atlas_context,
     const std::vector<std::shared_ptr<TextFrame>>& text_frames) const {
-  TRACE_EVENT0("impeller", __FUNCTION__);
+  FML_RECORDED_TRACE_EVENT0("impeller", __FUNCTION__);
   if (!IsValid()) {
     return nullptr;
   }
@@ -551,15 +561,10 @@ std::shared_ptr<GlyphAtlas> TypographerContextSkia::CreateGlyphAtlas(
           new_glyphs[i], glyph_positions[i], glyph_sizes[i]);
     }
 
-    std::shared_ptr<CommandBuffer> cmd_buffer = context.CreateCommandBuffer();
-    std::shared_ptr<BlitPass> blit_pass = cmd_buffer->CreateBlitPass();
-
-    fml::ScopedCleanupClosure closure([&]() {
-      blit_pass->EncodeCommands();
-      if (!context.EnqueueCommandBuffer(std::move(cmd_buffer))) {
-        VALIDATION_LOG << "Failed to submit glyph atlas command buffer";
-      }
-    });
+    std::shared_ptr<BlitPass> blit_pass = uploads.GetBlitPass();
+    if (!blit_pass) {
+      return nullptr;
+    }
 
     // ---------------------------------------------------------------------------
     // Step 4a: Draw new font-glyph pairs into the a host buffer and encode
@@ -644,15 +649,12 @@ std::shared_ptr<GlyphAtlas> TypographerContextSkia::CreateGlyphAtlas(
 
   new_texture->SetLabel("GlyphAtlas");
 
-  std::shared_ptr<CommandBuffer> cmd_buffer = context.CreateCommandBuffer();
-  std::shared_ptr<BlitPass> blit_pass = cmd_buffer->CreateBlitPass();
-
-  fml::ScopedCleanupClosure closure([&]() {
-    blit_pass->EncodeCommands();
-    if (!context.EnqueueCommandBuffer(std::move(cmd_buffer))) {
-      VALIDATION_LOG << "Failed to submit glyph atlas command buffer";
-    }
-  });
+  // The appends to the old atlas above, if any, are recorded into the same
+  // blit pass ahead of the copy of the old atlas below.
+  std::shared_ptr<BlitPass> blit_pass = uploads.GetBlitPass();
+  if (!blit_pass) {
+    return nullptr;
+  }
 
   // Now append all remaining glyphs. This should never have any missing data...
   auto old_texture = new_atlas->GetTexture();
@@ -671,9 +673,14 @@ std::shared_ptr<GlyphAtlas> TypographerContextSkia::CreateGlyphAtlas(
   // Step 4a: Draw new font-glyph pairs into the a host buffer and encode
   // the uploads into the blit pass.
   // ---------------------------------------------------------------------------
+  // When growing, the rows above height_adjustment are filled by the blit of
+  // the old atlas below, so there is no need to rasterize or upload them.
+  const int64_t upload_top =
+      (blit_old_atlas && old_texture) ? height_adjustment : 0;
   if (!BulkUpdateAtlasBitmap(*new_atlas, blit_pass, data_host_buffer,
                              new_atlas->GetTexture(), new_glyphs,
-                             first_missing_index, new_glyphs.size())) {
+                             first_missing_index, new_glyphs.size(),
+                             upload_top)) {
     return nullptr;
   }
 
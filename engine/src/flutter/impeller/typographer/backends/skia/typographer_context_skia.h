@@ -21,9 +21,12 @@ class TypographerContextSkia : public TypographerContext {
   std::shared_ptr<GlyphAtlasContext> CreateGlyphAtlasContext(
       GlyphAtlas::Type type) const override;
 
+  using TypographerContext::CreateGlyphAtlas;
+
   // |TypographerContext|
   std::shared_ptr<GlyphAtlas> CreateGlyphAtlas(
       Context& context,
+      GlyphAtlasUploads& uploads,
       GlyphAtlas::Type type,
       HostBuffer& host_buffer,
       const std::shared_ptr<GlyphAtlasContext>& atlas_context,
@@ -38,6 +38,11 @@ void LazyGlyphAtlas::AddTextFrame(const std::shared_ptr<TextFrame>& frame,
                                   std::optional<GlyphProperties> properties) {
   frame->SetPerFrameData(scale, offset, transform, properties);
   FML_DCHECK(alpha_atlas_ == nullptr && color_atlas_ == nullptr);
+  // Frames with an animating scale are rendered as paths and don't need any
+  // glyphs in the atlas.
+  if (frame->ShouldRenderAsPath()) {
+    return;
+  }
   if (frame->GetAtlasType() == GlyphAtlas::Type::kAlphaBitmap) {
     alpha_text_frames_.push_back(frame);
   } else {
@@ -52,6 +57,24 @@ void LazyGlyphAtlas::ResetTextFrames() {
   color_atlas_.reset();
 }
 
+LazyGlyphAtlas::AtlasStats LazyGlyphAtlas::GetAtlasStats(
+    GlyphAtlas::Type type) const {
+  const std::shared_ptr<GlyphAtlasContext>& atlas_context =
+      type == GlyphAtlas::Type::kAlphaBitmap ? alpha_context_ : color_context_;
+  std::shared_ptr<GlyphAtlas> atlas =
+      atlas_context ? atlas_context->GetGlyphAtlas() : nullptr;
+  if (!atlas) {
+    return {};
+  }
+  AtlasStats stats;
+  stats.glyph_count = atlas->GetGlyphCount();
+  if (const std::shared_ptr<Texture>& texture = atlas->GetTexture()) {
+    stats.texture_bytes =
+        texture->GetTextureDescriptor().GetByteSizeOfBaseMipLevel();
+  }
+  return stats;
+}
+
 const std::shared_ptr<GlyphAtlas>& LazyGlyphAtlas::CreateOrGetGlyphAtlas(
     Context& context,
     HostBuffer& data_host_buffer,
@@ -76,14 +99,24 @@ const std::shared_ptr<GlyphAtlas>& LazyGlyphAtlas::CreateOrGetGlyphAtlas(
     return kNullGlyphAtlas;
   }
 
-  auto& glyph_map = type == GlyphAtlas::Type::kAlphaBitmap ? alpha_text_frames_
-                                                           : color_text_frames_;
-  const std::shared_ptr<GlyphAtlasContext>& atlas_context =
-      type == GlyphAtlas::Type::kAlphaBitmap ? alpha_context_ : color_context_;
-  std::shared_ptr<GlyphAtlas> atlas = typographer_context_->CreateGlyphAtlas(
-      context, type, data_host_buffer, atlas_context, glyph_map);
-  if (!atlas || !atlas->IsValid()) {
-    VALIDATION_LOG << "Could not create valid atlas.";
+  GlyphAtlasUploads uploads(context);
+  std::shared_ptr<GlyphAtlas> atlas =
+      CreateGlyphAtlas(context, data_host_buffer, uploads, type);
+
+  // Prepare the other atlas now if it will be needed this frame, so that its
+  // uploads share the command buffer.
+  if (type == GlyphAtlas::Type::kAlphaBitmap) {
+    if (!color_atlas_ && !color_text_frames_.empty()) {
+      color_atlas_ = CreateGlyphAtlas(context, data_host_buffer, uploads,
+                                      GlyphAtlas::Type::kColorBitmap);
+    }
+  } else if (!alpha_atlas_ && !alpha_text_frames_.empty()) {
+    alpha_atlas_ = CreateGlyphAtlas(context, data_host_buffer, uploads,
+                                    GlyphAtlas::Type::kAlphaBitmap);
+  }
+  uploads.Submit();
+
+  if (!atlas) {
     return kNullGlyphAtlas;
   }
   if (type == GlyphAtlas::Type::kAlphaBitmap) {
@@ -97,4 +130,22 @@ const std::shared_ptr<GlyphAtlas>& LazyGlyphAtlas::CreateOrGetGlyphAtlas(
   FML_UNREACHABLE();
 }
 
+std::shared_ptr<GlyphAtlas> LazyGlyphAtlas::CreateGlyphAtlas(
+    Context& context,
+    HostBuffer& data_host_buffer,
+    GlyphAtlasUploads& uploads,
+    GlyphAtlas::Type type) const {
+  auto& glyph_map = type == GlyphAtlas::Type::kAlphaBitmap ? alpha_text_frames_
+                                                           : color_text_frames_;
+  const std::shared_ptr<GlyphAtlasContext>& atlas_context =
+      type == GlyphAtlas::Type::kAlphaBitmap ? alpha_context_ : color_context_;
+  std::shared_ptr<GlyphAtlas> atlas = typographer_context_->CreateGlyphAtlas(
+      context, uploads, type, data_host_buffer, atlas_context, glyph_map);
+  if (!atlas || !atlas->IsValid()) {
+    VALIDATION_LOG << "Could not create valid atlas.";
+    return nullptr;
+  }
+  return atlas;
+}
+
 }  // namespace impeller
@@ -28,11 +28,23 @@ class LazyGlyphAtlas {
 
   void ResetTextFrames();
 
+  /// @brief Get the atlas of the given type for the text frames of this
+  ///        frame. The first call also prepares the atlas of the other type
+  ///        if any of its text frames were added, so that the uploads of both
+  ///        are submitted in a single command buffer.
   const std::shared_ptr<GlyphAtlas>& CreateOrGetGlyphAtlas(
       Context& context,
       HostBuffer& host_buffer,
       GlyphAtlas::Type type) const;
 
+  /// @brief The size of the atlas of a type that is kept across frames.
+  struct AtlasStats {
+    size_t glyph_count = 0u;
+    size_t texture_bytes = 0u;
+  };
+
+  AtlasStats GetAtlasStats(GlyphAtlas::Type type) const;
+
  private:
   std::shared_ptr<TypographerContext> typographer_context_;
 
@@ -43,6 +55,11 @@ class LazyGlyphAtlas {
   mutable std::shared_ptr<GlyphAtlas> alpha_atlas_;
   mutable std::shared_ptr<GlyphAtlas> color_atlas_;
 
+  std::shared_ptr<GlyphAtlas> CreateGlyphAtlas(Context& context,
+                                               HostBuffer& host_buffer,
+                                               GlyphAtlasUploads& uploads,
+                                               GlyphAtlas::Type type) const;
+
   LazyGlyphAtlas(const LazyGlyphAtlas&) = delete;
 
   LazyGlyphAtlas& operator=(const LazyGlyphAtlas&) = delete;
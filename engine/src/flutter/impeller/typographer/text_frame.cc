@@ -47,6 +47,9 @@ bool TextFrame::HasColor() const {
 
 namespace {
 constexpr uint32_t kDenominator = 200;
+// The number of consecutive frames with a changing scale after which a text
+// frame is considered to be animating its scale.
+constexpr uint32_t kScaleAnimationFrameCount = 3u;
 constexpr int32_t kMaximumTextScale = 48;
 constexpr Rational kZero(0, kDenominator);
 }  // namespace
@@ -120,6 +123,11 @@ void TextFrame::SetPerFrameData(Rational scale,
                                 const Matrix& transform,
                                 std::optional<GlyphProperties> properties) {
   bound_values_.clear();
+  if (scale != scale_) {
+    scale_change_count_++;
+  } else {
+    scale_change_count_ = 0u;
+  }
   scale_ = scale;
   offset_ = offset;
   properties_ = properties;
@@ -153,6 +161,12 @@ fml::StatusOr<flutter::DlPath> TextFrame::GetPath() const {
   return fml::Status(fml::StatusCode::kCancelled, "no path creator specified.");
 }
 
+bool TextFrame::ShouldRenderAsPath() const {
+  // Color glyphs can't be represented by their outlines.
+  return !has_color_ && path_creator_ &&
+         scale_change_count_ >= kScaleAnimationFrameCount;
+}
+
 bool TextFrame::IsFrameComplete() const {
   size_t run_size = 0;
   for (const auto& x : runs_) {
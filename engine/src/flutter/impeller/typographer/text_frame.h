@@ -18,6 +18,12 @@ namespace impeller {
 
 using PathCreator = std::function<fml::StatusOr<flutter::DlPath>()>;
 
+/// The position and atlas texture coordinates of a corner of a glyph quad.
+struct GlyphVertex {
+  Point position;
+  Point uv;
+};
+
 //------------------------------------------------------------------------------
 /// @brief      Represents a collection of shaped text runs.
 ///
@@ -115,10 +121,33 @@ class TextFrame {
 
   fml::StatusOr<flutter::DlPath> GetPath() const;
 
+  /// @brief Whether the rounded scale passed to |SetPerFrameData| changed in
+  ///        each of the last few frames, as it does during a scale animation,
+  ///        and this frame can be rendered from its outline path instead.
+  ///
+  /// Rasterizing glyphs into the atlas at every intermediate scale of an
+  /// animation is wasted work, so such frames are filled as paths on the GPU
+  /// until their scale settles.
+  bool ShouldRenderAsPath() const;
+
   Point GetOffset() const;
 
   Matrix GetOffsetTransform() const;
 
+  /// @brief The glyph vertices computed the last time this frame was drawn,
+  ///        which are reused while the frame is only translated by whole
+  ///        pixels, as it is when it scrolls.
+  struct VertexCache {
+    Matrix transform;
+    Rational scale = Rational(0, 1);
+    ISize atlas_size;
+    std::pair<size_t, intptr_t> atlas_generation = {0, 0};
+    std::optional<GlyphProperties> properties;
+    std::vector<GlyphVertex> vertices;
+  };
+
+  VertexCache& GetVertexCache() { return vertex_cache_; }
+
  private:
   friend class TypographerContextSkia;
   friend class LazyGlyphAtlas;
@@ -145,6 +174,9 @@ class TextFrame {
   Point offset_;
   std::optional<GlyphProperties> properties_;
   Matrix transform_;
+  // The number of consecutive |SetPerFrameData| calls that changed the scale.
+  uint32_t scale_change_count_ = 0u;
+  VertexCache vertex_cache_;
 };
 
 }  // namespace impeller
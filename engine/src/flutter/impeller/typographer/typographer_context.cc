@@ -6,8 +6,47 @@
 
 #include <utility>
 
+#include "flutter/fml/logging.h"
+#include "impeller/base/validation.h"
+
 namespace impeller {
 
+GlyphAtlasUploads::GlyphAtlasUploads(Context& context) : context_(context) {}
+
+GlyphAtlasUploads::~GlyphAtlasUploads() {
+  FML_DCHECK(!cmd_buffer_) << "Glyph atlas uploads were never submitted.";
+}
+
+std::shared_ptr<BlitPass> GlyphAtlasUploads::GetBlitPass() {
+  if (blit_pass_) {
+    return blit_pass_;
+  }
+  cmd_buffer_ = context_.CreateCommandBuffer();
+  if (!cmd_buffer_) {
+    return nullptr;
+  }
+  cmd_buffer_->SetLabel("GlyphAtlas Uploads");
+  blit_pass_ = cmd_buffer_->CreateBlitPass();
+  if (!blit_pass_) {
+    cmd_buffer_.reset();
+  }
+  return blit_pass_;
+}
+
+bool GlyphAtlasUploads::Submit() {
+  if (!cmd_buffer_) {
+    return true;
+  }
+  std::shared_ptr<CommandBuffer> cmd_buffer = std::move(cmd_buffer_);
+  std::shared_ptr<BlitPass> blit_pass = std::move(blit_pass_);
+  if (!blit_pass->EncodeCommands() ||
+      !context_.EnqueueCommandBuffer(std::move(cmd_buffer))) {
+    VALIDATION_LOG << "Failed to submit glyph atlas command buffer";
+    return false;
+  }
+  return true;
+}
+
 TypographerContext::TypographerContext() {
   is_valid_ = true;
 }
@@ -18,4 +57,17 @@ bool TypographerContext::IsValid() const {
   return is_valid_;
 }
 
+std::shared_ptr<GlyphAtlas> TypographerContext::CreateGlyphAtlas(
+    Context& context,
+    GlyphAtlas::Type type,
+    HostBuffer& host_buffer,
+    const std::shared_ptr<GlyphAtlasContext>& atlas_context,
+    const std::vector<std::shared_ptr<TextFrame>>& text_frames) const {
+  GlyphAtlasUploads uploads(context);
+  std::shared_ptr<GlyphAtlas> atlas = CreateGlyphAtlas(
+      context, uploads, type, host_buffer, atlas_context, text_frames);
+  uploads.Submit();
+  return atlas;
+}
+
 }  // namespace impeller
@@ -7,12 +7,55 @@
 
 #include <memory>
 
+#include "impeller/renderer/blit_pass.h"
+#include "impeller/renderer/command_buffer.h"
 #include "impeller/renderer/context.h"
 #include "impeller/typographer/glyph_atlas.h"
 #include "impeller/typographer/text_frame.h"
 
 namespace impeller {
 
+//------------------------------------------------------------------------------
+/// @brief      Collects the texture uploads of one or more glyph atlas updates
+///             into a single blit pass, so that they are submitted in one
+///             command buffer.
+///
+///             The command buffer is only created once an update has uploads
+///             to record.
+///
+class GlyphAtlasUploads {
+ public:
+  explicit GlyphAtlasUploads(Context& context);
+
+  ~GlyphAtlasUploads();
+
+  //----------------------------------------------------------------------------
+  /// @brief      The blit pass to record uploads into, created on first use.
+  ///
+  /// @return     The blit pass or nullptr if it could not be created.
+  ///
+  std::shared_ptr<BlitPass> GetBlitPass();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Encode the recorded uploads and enqueue them on the context.
+  ///             This must happen before any command that samples the updated
+  ///             atlases is enqueued.
+  ///
+  /// @return     False if the uploads could not be submitted. True if they
+  ///             were or if there was nothing to submit.
+  ///
+  bool Submit();
+
+ private:
+  Context& context_;
+  std::shared_ptr<CommandBuffer> cmd_buffer_;
+  std::shared_ptr<BlitPass> blit_pass_;
+
+  GlyphAtlasUploads(const GlyphAtlasUploads&) = delete;
+
+  GlyphAtlasUploads& operator=(const GlyphAtlasUploads&) = delete;
+};
+
 //------------------------------------------------------------------------------
 /// @brief      The graphics context necessary to render text.
 ///
@@ -29,8 +72,26 @@ class TypographerContext {
   virtual std::shared_ptr<GlyphAtlasContext> CreateGlyphAtlasContext(
       GlyphAtlas::Type type) const = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Create or update the glyph atlas of the given type so that it
+  ///             contains the glyphs of the text frames, and submit the
+  ///             uploads.
+  ///
+  std::shared_ptr<GlyphAtlas> CreateGlyphAtlas(
+      Context& context,
+      GlyphAtlas::Type type,
+      HostBuffer& host_buffer,
+      const std::shared_ptr<GlyphAtlasContext>& atlas_context,
+      const std::vector<std::shared_ptr<TextFrame>>& text_frames) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Like the variant above, but records the uploads into
+  ///             `uploads` for the caller to submit instead of submitting
+  ///             them.
+  ///
   virtual std::shared_ptr<GlyphAtlas> CreateGlyphAtlas(
       Context& context,
+      GlyphAtlasUploads& uploads,
       GlyphAtlas::Type type,
       HostBuffer& host_buffer,
       const std::shared_ptr<GlyphAtlasContext>& atlas_context,
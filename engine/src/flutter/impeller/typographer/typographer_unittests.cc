@@ -152,10 +152,74 @@ TEST_P(TypographerTest, LazyAtlasTracksColor) {
   auto color_atlas = lazy_atlas.CreateOrGetGlyphAtlas(
       *GetContext(), *data_host_buffer, GlyphAtlas::Type::kColorBitmap);
 
+  // The bitmap atlas was prepared along with the color atlas, so that their
+  // uploads share a command buffer.
+  EXPECT_GT(
+      lazy_atlas.GetAtlasStats(GlyphAtlas::Type::kAlphaBitmap).glyph_count,
+      0u);
+
   auto bitmap_atlas = lazy_atlas.CreateOrGetGlyphAtlas(
       *GetContext(), *data_host_buffer, GlyphAtlas::Type::kAlphaBitmap);
 
   ASSERT_FALSE(color_atlas == bitmap_atlas);
+
+  // The atlases are kept across frames and reported by their type.
+  lazy_atlas.ResetTextFrames();
+  LazyGlyphAtlas::AtlasStats bitmap_stats =
+      lazy_atlas.GetAtlasStats(GlyphAtlas::Type::kAlphaBitmap);
+  EXPECT_EQ(bitmap_stats.glyph_count, bitmap_atlas->GetGlyphCount());
+  EXPECT_GT(bitmap_stats.texture_bytes, 0u);
+  EXPECT_EQ(lazy_atlas.GetAtlasStats(GlyphAtlas::Type::kColorBitmap)
+                .glyph_count,
+            color_atlas->GetGlyphCount());
+}
+
+TEST_P(TypographerTest, TextFrameRendersAsPathWhileScaleAnimates) {
+  SkFont font = flutter::testing::CreateTestFontOfSize(12);
+  auto frame =
+      MakeTextFrameFromTextBlobSkia(SkTextBlob::MakeFromString("hello", font));
+
+  frame->SetPerFrameData(Rational(1), {0, 0}, Matrix(), std::nullopt);
+  frame->SetPerFrameData(Rational(1), {0, 0}, Matrix(), std::nullopt);
+  EXPECT_FALSE(frame->ShouldRenderAsPath());
+
+  frame->SetPerFrameData(Rational(2), {0, 0}, Matrix(), std::nullopt);
+  frame->SetPerFrameData(Rational(3), {0, 0}, Matrix(), std::nullopt);
+  EXPECT_FALSE(frame->ShouldRenderAsPath());
+
+  frame->SetPerFrameData(Rational(4), {0, 0}, Matrix(), std::nullopt);
+  EXPECT_TRUE(frame->ShouldRenderAsPath());
+
+  // Once the scale settles, the frame goes back to the glyph atlas.
+  frame->SetPerFrameData(Rational(4), {0, 0}, Matrix(), std::nullopt);
+  EXPECT_FALSE(frame->ShouldRenderAsPath());
+}
+
+TEST_P(TypographerTest, LazyAtlasSkipsFramesWithAnimatingScale) {
+  auto data_host_buffer = HostBuffer::Create(
+      GetContext()->GetResourceAllocator(), GetContext()->GetIdleWaiter(),
+      GetContext()->GetCapabilities()->GetMinimumUniformAlignment());
+  SkFont font = flutter::testing::CreateTestFontOfSize(12);
+  auto animating_frame =
+      MakeTextFrameFromTextBlobSkia(SkTextBlob::MakeFromString("hello", font));
+  auto static_frame =
+      MakeTextFrameFromTextBlobSkia(SkTextBlob::MakeFromString("x", font));
+
+  LazyGlyphAtlas lazy_atlas(TypographerContextSkia::Make());
+  for (int i = 1; i <= 3; i++) {
+    lazy_atlas.AddTextFrame(animating_frame, Rational(i), {0, 0}, Matrix(),
+                            {});
+    lazy_atlas.ResetTextFrames();
+  }
+  ASSERT_TRUE(animating_frame->ShouldRenderAsPath());
+
+  lazy_atlas.AddTextFrame(animating_frame, Rational(4), {0, 0}, Matrix(), {});
+  lazy_atlas.AddTextFrame(static_frame, Rational(1), {0, 0}, Matrix(), {});
+  auto atlas = lazy_atlas.CreateOrGetGlyphAtlas(
+      *GetContext(), *data_host_buffer, GlyphAtlas::Type::kAlphaBitmap);
+  ASSERT_TRUE(atlas);
+  // Only the glyph of the static frame was rasterized.
+  EXPECT_EQ(atlas->GetGlyphCount(), 1u);
 }
 
 TEST_P(TypographerTest, GlyphAtlasWithOddUniqueGlyphSize) {
@@ -504,6 +568,47 @@ TEST_P(TypographerTest, GlyphAtlasTextureWillGrowTilMaxTextureSize) {
   ASSERT_EQ(atlas->GetGlyphCount(), 2u);
 }
 
+TEST_P(TypographerTest, GlyphAtlasGrowthOnlyUploadsNewRows) {
+  if (GetBackend() == PlaygroundBackend::kOpenGLES) {
+    GTEST_SKIP() << "Atlas growth isn't supported for OpenGLES currently.";
+  }
+
+  auto data_host_buffer = HostBuffer::Create(
+      GetContext()->GetResourceAllocator(), GetContext()->GetIdleWaiter(),
+      GetContext()->GetCapabilities()->GetMinimumUniformAlignment());
+  auto context = TypographerContextSkia::Make();
+  auto atlas_context =
+      context->CreateGlyphAtlasContext(GlyphAtlas::Type::kAlphaBitmap);
+  ASSERT_TRUE(context && context->IsValid());
+
+  std::shared_ptr<GlyphAtlas> atlas;
+  ISize previous_size;
+  for (int i = 0; i < 6; i++) {
+    SkFont sk_font = flutter::testing::CreateTestFontOfSize(50 + i);
+    auto blob = SkTextBlob::MakeFromString("A", sk_font);
+    ASSERT_TRUE(blob);
+
+    size_t used_before = data_host_buffer->GetStateForTest().used_bytes;
+    atlas =
+        CreateGlyphAtlas(*GetContext(), context.get(), *data_host_buffer,
+                         GlyphAtlas::Type::kAlphaBitmap, Rational(50 + i, 1),
+                         atlas_context, MakeTextFrameFromTextBlobSkia(blob));
+    ASSERT_TRUE(!!atlas);
+    size_t uploaded = data_host_buffer->GetStateForTest().used_bytes -
+                      used_before;
+
+    const TextureDescriptor& desc = atlas->GetTexture()->GetTextureDescriptor();
+    if (!previous_size.IsEmpty() && desc.size != previous_size) {
+      // The rows copied from the previous atlas are not uploaded again.
+      EXPECT_LT(uploaded,
+                desc.size.Area() * BytesPerPixelForPixelFormat(desc.format));
+    }
+    previous_size = desc.size;
+  }
+  // The atlas grew at least once.
+  EXPECT_GT(previous_size.height, 4096);
+}
+
 TEST_P(TypographerTest, TextFrameInitialBoundsArePlaceholder) {
   SkFont font = flutter::testing::CreateTestFontOfSize(12);
   auto blob = SkTextBlob::MakeFromString(
@@ -129,3 +129,8 @@ extern bool InternalFlutterGpu_Context_GetSupportsOffscreenMSAA(
     flutter::gpu::Context* wrapper) {
   return flutter::gpu::SupportsNormalOffscreenMSAA(wrapper->GetContext());
 }
+
+extern bool InternalFlutterGpu_Context_GetSupportsIndirectDraw(
+    flutter::gpu::Context* wrapper) {
+  return wrapper->GetContext().GetCapabilities()->SupportsIndirectDraw();
+}
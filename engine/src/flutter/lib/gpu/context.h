@@ -82,6 +82,10 @@ FLUTTER_GPU_EXPORT
 extern bool InternalFlutterGpu_Context_GetSupportsOffscreenMSAA(
     flutter::gpu::Context* wrapper);
 
+FLUTTER_GPU_EXPORT
+extern bool InternalFlutterGpu_Context_GetSupportsIndirectDraw(
+    flutter::gpu::Context* wrapper);
+
 }  // extern "C"
 
 #endif  // FLUTTER_LIB_GPU_CONTEXT_H_
@@ -19,6 +19,14 @@ namespace gpu {
 
 IMPLEMENT_WRAPPERTYPEINFO(flutter_gpu, DeviceBuffer);
 
+namespace {
+
+void FinalizeMappedDeviceBuffer(void* isolate_callback_data, void* peer) {
+  delete reinterpret_cast<std::shared_ptr<impeller::DeviceBuffer>*>(peer);
+}
+
+}  // namespace
+
 DeviceBuffer::DeviceBuffer(
     std::shared_ptr<impeller::DeviceBuffer> device_buffer)
     : device_buffer_(std::move(device_buffer)) {}
@@ -40,6 +48,24 @@ bool DeviceBuffer::Overwrite(const tonic::DartByteData& source_bytes,
   return true;
 }
 
+Dart_Handle DeviceBuffer::AsByteData() {
+  uint8_t* contents = device_buffer_->OnGetContents();
+  if (!contents) {
+    return Dart_Null();
+  }
+  const size_t length = device_buffer_->GetDeviceBufferDescriptor().size;
+  // The memory belongs to the device buffer rather than the Dart heap, so no
+  // external allocation size is reported for it.
+  auto* peer = new std::shared_ptr<impeller::DeviceBuffer>(device_buffer_);
+  Dart_Handle handle = Dart_NewExternalTypedDataWithFinalizer(
+      Dart_TypedData_kByteData, contents, length, peer, 0,
+      FinalizeMappedDeviceBuffer);
+  if (Dart_IsError(handle)) {
+    delete peer;
+  }
+  return handle;
+}
+
 }  // namespace gpu
 }  // namespace flutter
 
@@ -105,6 +131,11 @@ bool InternalFlutterGpu_DeviceBuffer_Overwrite(
                                   destination_offset_in_bytes);
 }
 
+Dart_Handle InternalFlutterGpu_DeviceBuffer_AsByteData(
+    flutter::gpu::DeviceBuffer* device_buffer) {
+  return device_buffer->AsByteData();
+}
+
 bool InternalFlutterGpu_DeviceBuffer_Flush(
     flutter::gpu::DeviceBuffer* device_buffer,
     int offset_in_bytes,
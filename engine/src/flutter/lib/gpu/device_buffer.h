@@ -28,6 +28,11 @@ class DeviceBuffer : public RefCountedDartWrappable<DeviceBuffer> {
   bool Overwrite(const tonic::DartByteData& source_bytes,
                  size_t destination_offset_in_bytes);
 
+  /// Returns an external `ByteData` that aliases the buffer's host mapped
+  /// contents, or `Dart_Null()` if the buffer is not mapped into host memory.
+  /// The `ByteData` keeps the buffer alive until it is collected.
+  Dart_Handle AsByteData();
+
  private:
   std::shared_ptr<impeller::DeviceBuffer> device_buffer_;
 
@@ -62,6 +67,10 @@ extern bool InternalFlutterGpu_DeviceBuffer_Overwrite(
     Dart_Handle source_byte_data,
     int destination_offset_in_bytes);
 
+FLUTTER_GPU_EXPORT
+extern Dart_Handle InternalFlutterGpu_DeviceBuffer_AsByteData(
+    flutter::gpu::DeviceBuffer* wrapper);
+
 FLUTTER_GPU_EXPORT
 extern bool InternalFlutterGpu_DeviceBuffer_Flush(
     flutter::gpu::DeviceBuffer* wrapper,
@@ -107,6 +107,11 @@ constexpr FlutterGPUPixelFormat FromImpellerPixelFormat(
     case impeller::PixelFormat::kR32Float:
       FML_DCHECK(false) << "k32Float not implemented.";
       return FlutterGPUPixelFormat::kUnknown;
+    case impeller::PixelFormat::kETC2R8G8B8A8UNormInt:
+    case impeller::PixelFormat::kASTC4x4UNormInt:
+    case impeller::PixelFormat::kBC7UNormInt:
+      FML_DCHECK(false) << "Compressed formats not implemented.";
+      return FlutterGPUPixelFormat::kUnknown;
     case impeller::PixelFormat::kA8UNormInt:
       return FlutterGPUPixelFormat::kA8UNormInt;
     case impeller::PixelFormat::kR8UNormInt:
@@ -148,6 +148,40 @@ base class DeviceBuffer extends NativeFieldWrapperClass1 {
   )
   external bool _overwrite(ByteData bytes, int destinationOffsetInBytes);
 
+  ByteData? _mappedBytes;
+
+  /// Returns a [ByteData] that aliases the contents of the [DeviceBuffer]
+  /// directly, so that data can be written into the buffer without first
+  /// being staged in a separate Dart [ByteData] and copied by [overwrite].
+  ///
+  /// This method can only be used if the [DeviceBuffer] was created with
+  /// [StorageMode.hostVisible]. An exception will be thrown otherwise, or if
+  /// the buffer is not mapped into host memory on this backend.
+  ///
+  /// The same [ByteData] is returned on every call and stays valid for as
+  /// long as it is reachable. Writes to it must be followed by
+  /// [DeviceBuffer.flush] before the buffer is used by a command. The caller
+  /// is responsible for not writing to a range that the GPU may still be
+  /// reading from a previous frame; [HostBuffer] handles this by cycling
+  /// through [HostBuffer.frameCount] sets of blocks.
+  ByteData asByteData() {
+    if (storageMode != StorageMode.hostVisible) {
+      throw Exception(
+        'DeviceBuffer.asByteData can only be used with DeviceBuffers that are host visible',
+      );
+    }
+    final ByteData? bytes = _mappedBytes ??= _asByteData();
+    if (bytes == null) {
+      throw Exception('DeviceBuffer is not mapped into host memory');
+    }
+    return bytes;
+  }
+
+  @Native<Handle Function(Pointer<Void>)>(
+    symbol: 'InternalFlutterGpu_DeviceBuffer_AsByteData',
+  )
+  external ByteData? _asByteData();
+
   /// Flush the contents of the [DeviceBuffer] to the GPU.
   ///
   /// This method can only be used if the [DeviceBuffer] was created with
@@ -249,12 +283,12 @@ base class HostBuffer {
 
   /// Prepare a new buffer range to be used for storing the given bytes.
   /// Allocates a new block if necessary.
-  BufferView _allocateEmplacement(ByteData bytes) {
-    if (bytes.lengthInBytes > blockLengthInBytes) {
+  BufferView _allocateEmplacement(int lengthInBytes) {
+    if (lengthInBytes > blockLengthInBytes) {
       return BufferView(
-        _allocateNewBlock(bytes.lengthInBytes),
+        _allocateNewBlock(lengthInBytes),
         offsetInBytes: 0,
-        lengthInBytes: bytes.lengthInBytes,
+        lengthInBytes: lengthInBytes,
       );
     }
 
@@ -264,26 +298,22 @@ base class HostBuffer {
     // If the padding is the full alignment size, then we're already aligned.
     // So reset the padding to zero.
     padding %= _gpuContext.minimumUniformByteAlignment;
-    if (_offsetCursor + padding >= blockLengthInBytes) {
+    if (_offsetCursor + padding + lengthInBytes > blockLengthInBytes) {
       DeviceBuffer buffer = _allocateNewBlock(blockLengthInBytes);
       _buffers[_frameCursor].add(buffer);
       _bufferCursor++;
-      _offsetCursor = bytes.lengthInBytes;
+      _offsetCursor = lengthInBytes;
 
-      return BufferView(
-        buffer,
-        offsetInBytes: 0,
-        lengthInBytes: blockLengthInBytes,
-      );
+      return BufferView(buffer, offsetInBytes: 0, lengthInBytes: lengthInBytes);
     }
 
     _offsetCursor += padding;
     final view = BufferView(
       _buffers[_frameCursor][_bufferCursor],
       offsetInBytes: _offsetCursor,
-      lengthInBytes: bytes.lengthInBytes,
+      lengthInBytes: lengthInBytes,
     );
-    _offsetCursor += bytes.lengthInBytes;
+    _offsetCursor += lengthInBytes;
     return view;
   }
 
@@ -298,7 +328,7 @@ base class HostBuffer {
   /// flushed, so there is no need to call [DeviceBuffer.flush] before
   /// referencing it in a command.
   BufferView emplace(ByteData bytes) {
-    BufferView view = _allocateEmplacement(bytes);
+    BufferView view = _allocateEmplacement(bytes.lengthInBytes);
     if (!view.buffer.overwrite(
       bytes,
       destinationOffsetInBytes: view.offsetInBytes,
@@ -312,6 +342,22 @@ base class HostBuffer {
     return view;
   }
 
+  /// Reserve [lengthInBytes] bytes at the end of the [HostBuffer] and produce
+  /// a [BufferView] that references them, without writing anything.
+  ///
+  /// The range is aligned in the same way as [emplace]. Fill it in place by
+  /// writing into [DeviceBuffer.asByteData] of the view's buffer starting at
+  /// [BufferView.offsetInBytes], then call [DeviceBuffer.flush] for the range
+  /// before referencing it in a command.
+  ///
+  /// The range is not reused until [reset] has been called [frameCount] times.
+  BufferView allocate(int lengthInBytes) {
+    if (lengthInBytes <= 0) {
+      throw Exception('lengthInBytes must be positive');
+    }
+    return _allocateEmplacement(lengthInBytes);
+  }
+
   /// Resets the bump allocator to the beginning of the first [DeviceBuffer]
   /// block.
   void reset() {
@@ -58,6 +58,13 @@ base class GpuContext extends NativeFieldWrapperClass1 {
     return _getSupportsOffscreenMSAA();
   }
 
+  /// Whether the backend supports [RenderPass.drawIndirect], which reads draw
+  /// arguments from a [DeviceBuffer] on the GPU. This is supported by Metal
+  /// and Vulkan, but not by OpenGLES.
+  bool get doesSupportIndirectDraw {
+    return _getSupportsIndirectDraw();
+  }
+
   /// Allocates a new region of GPU-resident memory.
   ///
   /// The [storageMode] must be either [StorageMode.hostVisible] or
@@ -192,6 +199,11 @@ base class GpuContext extends NativeFieldWrapperClass1 {
     symbol: 'InternalFlutterGpu_Context_GetSupportsOffscreenMSAA',
   )
   external bool _getSupportsOffscreenMSAA();
+
+  @Native<Bool Function(Pointer<Void>)>(
+    symbol: 'InternalFlutterGpu_Context_GetSupportsIndirectDraw',
+  )
+  external bool _getSupportsIndirectDraw();
 }
 
 /// The default graphics context.
@@ -453,6 +453,36 @@ base class RenderPass extends NativeFieldWrapperClass1 {
     }
   }
 
+  /// Append [drawCount] draws whose vertex or index counts, instance counts
+  /// and offsets are read by the GPU from [indirectBuffer], so that they can
+  /// be produced by a compute pass without reading them back on the CPU.
+  ///
+  /// If an index buffer is bound, each draw reads five 32-bit values from the
+  /// buffer: the index count, the instance count, the first index, the
+  /// (signed) base vertex and the first instance. Otherwise each draw reads
+  /// four 32-bit values: the vertex count, the instance count, the first
+  /// vertex and the first instance. Consecutive draws are [stride] bytes
+  /// apart. A [stride] of zero means that they are tightly packed.
+  ///
+  /// Only available when [GpuContext.doesSupportIndirectDraw] is true.
+  void drawIndirect(BufferView indirectBuffer, {int drawCount = 1, int stride = 0}) {
+    if (drawCount <= 0) {
+      throw Exception('drawCount must be positive');
+    }
+    if (stride < 0) {
+      throw Exception('stride must not be negative');
+    }
+    if (!_drawIndirect(
+      indirectBuffer.buffer,
+      indirectBuffer.offsetInBytes,
+      indirectBuffer.lengthInBytes,
+      drawCount,
+      stride,
+    )) {
+      throw Exception("Failed to append indirect draw");
+    }
+  }
+
   /// Wrap with native counterpart.
   @Native<Void Function(Handle)>(
     symbol: 'InternalFlutterGpu_RenderPass_Initialize',
@@ -667,4 +697,15 @@ base class RenderPass extends NativeFieldWrapperClass1 {
     symbol: 'InternalFlutterGpu_RenderPass_Draw',
   )
   external bool _draw();
+
+  @Native<Bool Function(Pointer<Void>, Pointer<Void>, Int, Int, Int, Int)>(
+    symbol: 'InternalFlutterGpu_RenderPass_DrawIndirect',
+  )
+  external bool _drawIndirect(
+    DeviceBuffer indirectBuffer,
+    int offsetInBytes,
+    int lengthInBytes,
+    int drawCount,
+    int stride,
+  );
 }
@@ -38,6 +38,7 @@ const std::shared_ptr<const impeller::Context>& RenderPass::GetContext() const {
 }
 
 impeller::RenderTarget& RenderPass::GetRenderTarget() {
+  cached_pipeline_.reset();
   return render_target_;
 }
 
@@ -47,6 +48,7 @@ const impeller::RenderTarget& RenderPass::GetRenderTarget() const {
 
 impeller::ColorAttachmentDescriptor& RenderPass::GetColorAttachmentDescriptor(
     size_t color_attachment_index) {
+  cached_pipeline_.reset();
   auto color = color_descriptors_.find(color_attachment_index);
   if (color == color_descriptors_.end()) {
     return color_descriptors_[color_attachment_index] = {};
@@ -56,20 +58,24 @@ impeller::ColorAttachmentDescriptor& RenderPass::GetColorAttachmentDescriptor(
 
 impeller::DepthAttachmentDescriptor&
 RenderPass::GetDepthAttachmentDescriptor() {
+  cached_pipeline_.reset();
   return depth_desc_;
 }
 
 impeller::StencilAttachmentDescriptor&
 RenderPass::GetStencilFrontAttachmentDescriptor() {
+  cached_pipeline_.reset();
   return stencil_front_desc_;
 }
 
 impeller::StencilAttachmentDescriptor&
 RenderPass::GetStencilBackAttachmentDescriptor() {
+  cached_pipeline_.reset();
   return stencil_back_desc_;
 }
 
 impeller::PipelineDescriptor& RenderPass::GetPipelineDescriptor() {
+  cached_pipeline_.reset();
   return pipeline_descriptor_;
 }
 
@@ -86,6 +92,9 @@ bool RenderPass::Begin(flutter::gpu::CommandBuffer& command_buffer) {
 void RenderPass::SetPipeline(fml::RefPtr<RenderPipeline> pipeline) {
   // On debug this makes a difference, but not on release builds.
   // NOLINTNEXTLINE(performance-move-const-arg)
+  if (pipeline != render_pipeline_) {
+    cached_pipeline_.reset();
+  }
   render_pipeline_ = std::move(pipeline);
 }
 
@@ -179,8 +188,11 @@ RenderPass::GetOrCreatePipeline() {
   return pipeline;
 }
 
-bool RenderPass::Draw() {
-  render_pass_->SetPipeline(impeller::PipelineRef(GetOrCreatePipeline()));
+void RenderPass::BindCommandState() {
+  if (!cached_pipeline_) {
+    cached_pipeline_ = GetOrCreatePipeline();
+  }
+  render_pass_->SetPipeline(impeller::PipelineRef(cached_pipeline_));
 
   for (const auto& [_, buffer] : vertex_uniform_bindings) {
     render_pass_->BindDynamicResource(
@@ -226,12 +238,42 @@ bool RenderPass::Draw() {
   if (scissor.has_value()) {
     render_pass_->SetScissor(scissor.value());
   }
+}
+
+bool RenderPass::Draw() {
+  BindCommandState();
 
   bool result = render_pass_->Draw().ok();
 
   return result;
 }
 
+bool RenderPass::DrawIndirect(
+    std::shared_ptr<const impeller::DeviceBuffer> indirect_buffer,
+    size_t offset_in_bytes,
+    size_t length_in_bytes,
+    uint32_t draw_count,
+    uint32_t stride) {
+  if (!GetContext()->GetCapabilities()->SupportsIndirectDraw()) {
+    return false;
+  }
+  if (stride == 0u) {
+    stride = index_buffer_type == impeller::IndexType::kNone
+                 ? sizeof(impeller::DrawIndirectArguments)
+                 : sizeof(impeller::DrawIndexedIndirectArguments);
+  }
+
+  BindCommandState();
+
+  return render_pass_
+      ->DrawIndirect(
+          impeller::BufferView(std::move(indirect_buffer),
+                               impeller::Range(offset_in_bytes,
+                                               length_in_bytes)),
+          draw_count, stride)
+      .ok();
+}
+
 }  // namespace gpu
 }  // namespace flutter
 
@@ -653,3 +695,14 @@ void InternalFlutterGpu_RenderPass_SetPolygonMode(
 bool InternalFlutterGpu_RenderPass_Draw(flutter::gpu::RenderPass* wrapper) {
   return wrapper->Draw();
 }
+
+bool InternalFlutterGpu_RenderPass_DrawIndirect(
+    flutter::gpu::RenderPass* wrapper,
+    flutter::gpu::DeviceBuffer* device_buffer,
+    int offset_in_bytes,
+    int length_in_bytes,
+    int draw_count,
+    int stride) {
+  return wrapper->DrawIndirect(device_buffer->GetBuffer(), offset_in_bytes,
+                               length_in_bytes, draw_count, stride);
+}
@@ -57,6 +57,15 @@ class RenderPass : public RefCountedDartWrappable<RenderPass> {
 
   bool Draw();
 
+  /// Draws with arguments read by the GPU from `indirect_buffer`. A `stride`
+  /// of zero means that the arguments are tightly packed.
+  bool DrawIndirect(
+      std::shared_ptr<const impeller::DeviceBuffer> indirect_buffer,
+      size_t offset_in_bytes,
+      size_t length_in_bytes,
+      uint32_t draw_count,
+      uint32_t stride);
+
   struct BufferAndUniformSlot {
     impeller::ShaderUniformSlot slot;
     impeller::BufferResource view;
@@ -93,6 +102,10 @@ class RenderPass : public RefCountedDartWrappable<RenderPass> {
   std::shared_ptr<impeller::Pipeline<impeller::PipelineDescriptor>>
   GetOrCreatePipeline();
 
+  /// Applies the pipeline, bindings and dynamic state of the pending command
+  /// to the underlying render pass ahead of a draw.
+  void BindCommandState();
+
   impeller::RenderTarget render_target_;
   std::shared_ptr<impeller::RenderPass> render_pass_;
 
@@ -107,6 +120,13 @@ class RenderPass : public RefCountedDartWrappable<RenderPass> {
   impeller::StencilAttachmentDescriptor stencil_back_desc_;
   impeller::DepthAttachmentDescriptor depth_desc_;
 
+  // The pipeline resolved by the last draw. Consecutive draws that share the
+  // same pipeline state reuse it instead of rebuilding the descriptor and
+  // looking it up in the pipeline library again. Any accessor that can mutate
+  // the pipeline state resets it.
+  std::shared_ptr<impeller::Pipeline<impeller::PipelineDescriptor>>
+      cached_pipeline_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(RenderPass);
 };
 
@@ -284,6 +304,15 @@ FLUTTER_GPU_EXPORT
 extern bool InternalFlutterGpu_RenderPass_Draw(
     flutter::gpu::RenderPass* wrapper);
 
+FLUTTER_GPU_EXPORT
+extern bool InternalFlutterGpu_RenderPass_DrawIndirect(
+    flutter::gpu::RenderPass* wrapper,
+    flutter::gpu::DeviceBuffer* device_buffer,
+    int offset_in_bytes,
+    int length_in_bytes,
+    int draw_count,
+    int stride);
+
 }  // extern "C"
 
 #endif  // FLUTTER_LIB_GPU_RENDER_PASS_H_
@@ -5,6 +5,7 @@
 #include "flutter/lib/io/dart_io.h"
 
 #include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
 #include "third_party/dart/runtime/include/bin/dart_io_api.h"
 #include "third_party/dart/runtime/include/dart_api.h"
 #include "third_party/tonic/converter/dart_converter.h"
@@ -17,6 +18,7 @@ namespace flutter {
 
 void DartIO::InitForIsolate(bool may_insecurely_connect_to_all_domains,
                             const std::string& domain_network_policy) {
+  TRACE_EVENT0("flutter", "DartIO::InitForIsolate");
   // TODO(https://dartbug.com/61694): move this code into dart_io_api.h
   Dart_Handle io_lib = Dart_LookupLibrary(ToDart("dart:io"));
   Dart_Handle result = Dart_SetNativeResolver(io_lib, dart::bin::LookupIONative,
@@ -226,6 +226,9 @@ void SceneBuilder::pushShaderMask(Dart_Handle layer_handle,
 }
 
 void SceneBuilder::addRetained(const fml::RefPtr<EngineLayer>& retained_layer) {
+  // The framework only retains layers whose subtree it did not rebuild, so
+  // the results of their last preroll can be reused.
+  retained_layer->Layer()->set_subtree_is_retained(true);
   AddLayer(retained_layer->Layer());
 }
 
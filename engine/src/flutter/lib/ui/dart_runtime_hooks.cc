@@ -13,6 +13,7 @@
 #include "flutter/common/settings.h"
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
 #include "flutter/lib/ui/plugins/callback_cache.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "flutter/runtime/dart_plugin_registrant.h"
@@ -159,6 +160,7 @@ static void InitDartIO(Dart_Handle builtin_library,
 void DartRuntimeHooks::Install(bool is_ui_isolate,
                                bool enable_microtask_profiling,
                                const std::string& script_uri) {
+  TRACE_EVENT0("flutter", "DartRuntimeHooks::Install");
   Dart_Handle builtin = Dart_LookupLibrary(ToDart("dart:ui"));
   InitDartInternal(builtin, is_ui_isolate);
   InitDartCore(builtin, script_uri);
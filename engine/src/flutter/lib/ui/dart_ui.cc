@@ -4,12 +4,14 @@
 
 #include "flutter/lib/ui/dart_ui.h"
 
-#include <mutex>
+#include <algorithm>
+#include <array>
 #include <string_view>
 
 #include "flutter/common/constants.h"
 #include "flutter/common/settings.h"
 #include "flutter/fml/build_config.h"
+#include "flutter/fml/trace_event.h"
 #include "flutter/lib/ui/compositing/scene.h"
 #include "flutter/lib/ui/compositing/scene_builder.h"
 #include "flutter/lib/ui/dart_runtime_hooks.h"
@@ -38,6 +40,8 @@
 #include "flutter/lib/ui/text/font_collection.h"
 #include "flutter/lib/ui/text/paragraph.h"
 #include "flutter/lib/ui/text/paragraph_builder.h"
+#include "flutter/lib/ui/ui_dart_state.h"
+#include "flutter/lib/ui/window/background_isolate_pool.h"
 #include "flutter/lib/ui/window/platform_configuration.h"
 #include "flutter/lib/ui/window/platform_isolate.h"
 #include "third_party/tonic/converter/dart_converter.h"
@@ -116,6 +120,7 @@ typedef CanvasPath Path;
   V(PlatformConfigurationNativeApi::SendPortPlatformMessage)       \
   V(PlatformConfigurationNativeApi::RequestViewFocusChange)        \
   V(PlatformConfigurationNativeApi::SendChannelUpdate)             \
+  V(PlatformConfigurationNativeApi::SetPortPlatformMessageHandler) \
   V(PlatformConfigurationNativeApi::GetScaledFontSize)             \
   V(PlatformIsolateNativeApi::IsRunningOnPlatformThread)           \
   V(PlatformIsolateNativeApi::Spawn)                               \
@@ -148,22 +153,29 @@ typedef CanvasPath Path;
   V(Canvas, clipRRect)                           \
   V(Canvas, clipRSuperellipse)                   \
   V(Canvas, drawArc)                             \
+  V(Canvas, drawArcWithPaintData)                \
   V(Canvas, drawAtlas)                           \
   V(Canvas, drawCircle)                          \
+  V(Canvas, drawCircleWithPaintData)             \
   V(Canvas, drawColor)                           \
+  V(Canvas, drawCommands)                        \
   V(Canvas, drawDRRect)                          \
   V(Canvas, drawRSuperellipse)                   \
   V(Canvas, drawImage)                           \
   V(Canvas, drawImageNine)                       \
   V(Canvas, drawImageRect)                       \
   V(Canvas, drawLine)                            \
+  V(Canvas, drawLineWithPaintData)               \
   V(Canvas, drawOval)                            \
+  V(Canvas, drawOvalWithPaintData)               \
   V(Canvas, drawPaint)                           \
+  V(Canvas, drawPaintWithPaintData)              \
   V(Canvas, drawPath)                            \
   V(Canvas, drawPicture)                         \
   V(Canvas, drawPoints)                          \
   V(Canvas, drawRRect)                           \
   V(Canvas, drawRect)                            \
+  V(Canvas, drawRectWithPaintData)               \
   V(Canvas, drawShadow)                          \
   V(Canvas, drawVertices)                        \
   V(Canvas, getDestinationClipBounds)            \
@@ -204,6 +216,7 @@ typedef CanvasPath Path;
   V(Image, toByteData)                           \
   V(Image, colorSpace)                           \
   V(ImageDescriptor, bytesPerPixel)              \
+  V(ImageDescriptor, decodeRegion)               \
   V(ImageDescriptor, dispose)                    \
   V(ImageDescriptor, height)                     \
   V(ImageDescriptor, instantiateCodec)           \
@@ -222,6 +235,7 @@ typedef CanvasPath Path;
   V(ParagraphBuilder, addPlaceholder)            \
   V(ParagraphBuilder, addText)                   \
   V(ParagraphBuilder, build)                     \
+  V(ParagraphBuilder, buildInBackground)         \
   V(ParagraphBuilder, pop)                       \
   V(ParagraphBuilder, pushStyle)                 \
   V(Paragraph, alphabeticBaseline)               \
@@ -318,39 +332,87 @@ typedef CanvasPath Path;
   V(SemanticsUpdate, dispose)                    \
   V(Vertices, dispose)
 
-#define FFI_FUNCTION_INSERT(FUNCTION)           \
-  g_function_dispatchers.insert(std::make_pair( \
-      std::string_view(#FUNCTION),              \
-      reinterpret_cast<void*>(                  \
-          tonic::FfiDispatcher<void, decltype(&FUNCTION), &FUNCTION>::Call)));
+#define FFI_FUNCTION_NAME(FUNCTION) std::string_view(#FUNCTION),
 
-#define FFI_METHOD_INSERT(CLASS, METHOD)                                       \
-  g_function_dispatchers.insert(                                               \
-      std::make_pair(std::string_view(#CLASS "::" #METHOD),                    \
-                     reinterpret_cast<void*>(                                  \
-                         tonic::FfiDispatcher<CLASS, decltype(&CLASS::METHOD), \
-                                              &CLASS::METHOD>::Call)));
+#define FFI_METHOD_NAME(CLASS, METHOD) std::string_view(#CLASS "::" #METHOD),
+
+#define FFI_FUNCTION_DISPATCHER(FUNCTION)  \
+  reinterpret_cast<void*>(                 \
+      tonic::FfiDispatcher<void, decltype(&FUNCTION), &FUNCTION>::Call),
+
+#define FFI_METHOD_DISPATCHER(CLASS, METHOD)                   \
+  reinterpret_cast<void*>(                                     \
+      tonic::FfiDispatcher<CLASS, decltype(&CLASS::METHOD),    \
+                           &CLASS::METHOD>::Call),
 
 namespace {
 
-std::once_flag g_dispatchers_init_flag;
-std::unordered_map<std::string_view, void*> g_function_dispatchers;
+// The names of the natives, and their dispatchers in the same order. They are
+// looked up in a table sorted at compile time, so that starting an isolate
+// doesn't have to build a map of them. Most natives are only resolved when
+// the app first calls them, if ever.
+constexpr std::string_view kFfiNativeNames[] = {
+    FFI_FUNCTION_LIST(FFI_FUNCTION_NAME)  //
+    FFI_METHOD_LIST(FFI_METHOD_NAME)      //
+};
 
-void* ResolveFfiNativeFunction(const char* name, uintptr_t args) {
-  auto it = g_function_dispatchers.find(name);
-  return (it != g_function_dispatchers.end()) ? it->second : nullptr;
+constexpr size_t kFfiNativeCount = std::size(kFfiNativeNames);
+
+void* const kFfiNativeDispatchers[] = {
+    FFI_FUNCTION_LIST(FFI_FUNCTION_DISPATCHER)  //
+    FFI_METHOD_LIST(FFI_METHOD_DISPATCHER)      //
+};
+
+static_assert(sizeof(kFfiNativeDispatchers) / sizeof(void*) ==
+              kFfiNativeCount);
+
+using FfiNativeOrder = std::array<uint16_t, kFfiNativeCount>;
+
+// The indices of the natives in the order of their names.
+constexpr FfiNativeOrder SortFfiNatives() {
+  FfiNativeOrder order = {};
+  for (size_t i = 0; i < kFfiNativeCount; i++) {
+    order[i] = static_cast<uint16_t>(i);
+  }
+  std::sort(order.begin(), order.end(), [](uint16_t a, uint16_t b) {
+    return kFfiNativeNames[a] < kFfiNativeNames[b];
+  });
+  return order;
+}
+
+constexpr FfiNativeOrder kFfiNativeOrder = SortFfiNatives();
+
+constexpr bool AreFfiNativeNamesUnique() {
+  for (size_t i = 1; i < kFfiNativeCount; i++) {
+    if (kFfiNativeNames[kFfiNativeOrder[i - 1]] ==
+        kFfiNativeNames[kFfiNativeOrder[i]]) {
+      return false;
+    }
+  }
+  return true;
 }
 
-void InitDispatcherMap() {
-  FFI_FUNCTION_LIST(FFI_FUNCTION_INSERT)
-  FFI_METHOD_LIST(FFI_METHOD_INSERT)
+static_assert(AreFfiNativeNamesUnique(),
+              "A native is listed more than once in FFI_FUNCTION_LIST or "
+              "FFI_METHOD_LIST.");
+
+void* ResolveFfiNativeFunction(const char* name, uintptr_t args) {
+  const std::string_view native_name(name);
+  auto it = std::lower_bound(kFfiNativeOrder.begin(), kFfiNativeOrder.end(),
+                             native_name,
+                             [](uint16_t index, std::string_view name) {
+                               return kFfiNativeNames[index] < name;
+                             });
+  if (it == kFfiNativeOrder.end() || kFfiNativeNames[*it] != native_name) {
+    return nullptr;
+  }
+  return kFfiNativeDispatchers[*it];
 }
 
 }  // anonymous namespace
 
 void DartUI::InitForIsolate(const Settings& settings) {
-  std::call_once(g_dispatchers_init_flag, InitDispatcherMap);
-
+  TRACE_EVENT0("flutter", "DartUI::InitForIsolate");
   auto dart_ui = Dart_LookupLibrary(ToDart("dart:ui"));
   if (Dart_IsError(dart_ui)) {
     Dart_PropagateError(dart_ui);
@@ -378,6 +440,21 @@ void DartUI::InitForIsolate(const Settings& settings) {
     }
   }
 
+  // Only the root isolate keeps a pool of background isolates. The isolates
+  // it spawns, including those of the pool, spawn theirs when asked to.
+  UIDartState* ui_dart_state = UIDartState::Current();
+  const size_t background_isolate_pool_size =
+      GetBackgroundIsolatePoolSize(settings);
+  if (background_isolate_pool_size > 0 && ui_dart_state != nullptr &&
+      ui_dart_state->IsRootIsolate() &&
+      !Dart_IsServiceIsolate(Dart_CurrentIsolate())) {
+    result = Dart_SetField(dart_ui, ToDart("_backgroundIsolatePoolSize"),
+                           Dart_NewInteger(background_isolate_pool_size));
+    if (Dart_IsError(result)) {
+      Dart_PropagateError(result);
+    }
+  }
+
   result = Dart_SetField(dart_ui, ToDart("_implicitViewId"),
                          Dart_NewInteger(kFlutterImplicitViewId));
   if (Dart_IsError(result)) {
@@ -549,6 +549,35 @@ external void _finishCallResponse(bool didPass);
 @pragma('vm:entry-point')
 void messageCallback(dynamic data) {}
 
+@pragma('vm:entry-point')
+void drawRectsForBenchmark(int count, bool withPaintObjects) {
+  final PictureRecorder recorder = PictureRecorder();
+  final Canvas canvas = Canvas(recorder);
+  final Paint paint = Paint()..color = const Color(0xFF2196F3);
+  if (withPaintObjects) {
+    // A paint that has had a filter keeps its list of objects, so its draws
+    // pass the paint through handles.
+    paint.colorFilter = const ColorFilter.mode(Color(0xFF000000), BlendMode.dst);
+    paint.colorFilter = null;
+  }
+  for (int i = 0; i < count; i++) {
+    canvas.drawRect(Rect.fromLTWH(i.toDouble(), 0, 10, 10), paint);
+  }
+  recorder.endRecording().dispose();
+}
+
+@pragma('vm:entry-point')
+void drawRectCommandsForBenchmark(int count) {
+  final PictureRecorder recorder = PictureRecorder();
+  final Canvas canvas = Canvas(recorder);
+  final CanvasCommands commands = CanvasCommands();
+  for (int i = 0; i < count; i++) {
+    commands.drawRect(Rect.fromLTWH(i.toDouble(), 0, 10, 10));
+  }
+  canvas.drawCommands(commands, Paint()..color = const Color(0xFF2196F3));
+  recorder.endRecording().dispose();
+}
+
 @pragma('vm:entry-point')
 @pragma('vm:external-name', 'ValidateConfiguration')
 external void validateConfiguration();
@@ -808,9 +837,22 @@ void convertPaintToDlPaint() {
 @pragma('vm:external-name', 'ConvertPaintToDlPaint')
 external void _convertPaintToDlPaint(Paint paint);
 
+@pragma('vm:entry-point')
+void convertPaintDataToDlPaint() {
+  Paint paint = Paint();
+  paint.blendMode = BlendMode.modulate;
+  paint.color = Color.fromARGB(0x11, 0x22, 0x33, 0x44);
+  paint.maskFilter = MaskFilter.blur(BlurStyle.inner, .75);
+  paint.style = PaintingStyle.stroke;
+  _convertPaintDataToDlPaint(paint);
+}
+
+@pragma('vm:external-name', 'ConvertPaintDataToDlPaint')
+external void _convertPaintDataToDlPaint(Paint paint);
+
 /// Hooks for platform_configuration_unittests.cc
 @pragma('vm:entry-point')
-void _beginFrameHijack(int microseconds, int frameNumber) {
+void _beginFrameHijack(int microseconds, int frameNumber, int buildDeadlineMicroseconds) {
   nativeBeginFrame(microseconds, frameNumber);
 }
 
@@ -1179,7 +1221,7 @@ void hooksTests() async {
       };
     });
 
-    _callHook('_beginFrame', 2, 1234, 1);
+    _callHook('_beginFrame', 3, 1234, 1, 1234);
     expectIdentical(runZone, innerZone);
     expectEquals(start, const Duration(microseconds: 1234));
   });
@@ -1345,7 +1387,7 @@ void hooksTests() async {
       };
     });
 
-    _callHook('_beginFrame', 2, 0, 2);
+    _callHook('_beginFrame', 3, 0, 2, 0);
     expectNotEquals(runZone, null);
     expectIdentical(runZone, innerZone);
     expectEquals(frameNumber, 2);
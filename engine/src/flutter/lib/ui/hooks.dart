@@ -313,9 +313,9 @@ void _dispatchSemanticsAction(int viewId, int nodeId, int action, ByteData? args
 }
 
 @pragma('vm:entry-point')
-void _beginFrame(int microseconds, int frameNumber) {
+void _beginFrame(int microseconds, int frameNumber, int buildDeadlineMicroseconds) {
   PlatformDispatcher.instance._beginFrame(microseconds);
-  PlatformDispatcher.instance._updateFrameData(frameNumber);
+  PlatformDispatcher.instance._updateFrameData(frameNumber, buildDeadlineMicroseconds);
 }
 
 @pragma('vm:entry-point')
@@ -323,6 +323,11 @@ void _reportTimings(List<int> timings) {
   PlatformDispatcher.instance._reportTimings(timings);
 }
 
+@pragma('vm:entry-point')
+void _warmUpBackgroundIsolatePool() {
+  _BackgroundIsolatePool.instance?.warmUp();
+}
+
 @pragma('vm:entry-point')
 void _drawFrame() {
   PlatformDispatcher.instance._drawFrame();
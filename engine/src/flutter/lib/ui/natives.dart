@@ -124,3 +124,8 @@ int? _implicitViewId;
 // are enabled.
 @pragma('vm:entry-point')
 bool _platformIsolatesEnabled = false;
+
+// Used internally to indicate how many background isolates this isolate keeps
+// spawned for [runOnBackgroundIsolate], or 0 if it doesn't keep a pool.
+@pragma('vm:entry-point')
+int _backgroundIsolatePoolSize = 0;
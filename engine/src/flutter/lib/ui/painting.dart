@@ -1308,6 +1308,10 @@ final class Paint {
   @pragma('vm:entry-point')
   final ByteData _data = ByteData(_kDataByteCount);
 
+  // The bytes of _data. For paints without objects, Canvas passes their
+  // address to leaf calls, which read the data in place.
+  late final Uint8List _dataBytes = _data.buffer.asUint8List();
+
   // Must match //lib/ui/painting/paint.cc.
   static const int _kIsAntiAliasIndex = 0;
   static const int _kColorRedIndex = 1;
@@ -1926,6 +1930,16 @@ enum TargetPixelFormat {
 
   /// Each pixel is 32 bits, the red channel is just one 32 bit float.
   rFloat32,
+
+  /// Each block of 4x4 pixels is compressed to 128 bits, in a block
+  /// compressed format the GPU samples from, such as BC7 or ETC2.
+  ///
+  /// The image takes a quarter of the memory of an image with 32 bits per
+  /// pixel, at the cost of some quality. The engine compresses the image once
+  /// it is decoded and resized, and picks the format. Images are left
+  /// uncompressed where the backend supports no such format, or where it
+  /// doesn't use Impeller.
+  compressed,
 }
 
 /// Signature for [Image] lifecycle events.
@@ -6030,6 +6044,135 @@ enum ClipOp {
   intersect,
 }
 
+/// A list of simple drawing commands that a [Canvas] records all at once,
+/// with [Canvas.drawCommands].
+///
+/// Each call to a [Canvas] is a separate call into the engine. Painters that
+/// draw thousands of small shapes, like the points and bars of a chart, can
+/// spend more time making those calls than recording the shapes. The
+/// commands are instead written into a buffer in Dart, and the canvas records
+/// the shapes from the buffer in a single call.
+///
+/// The shapes are drawn with the [Paint] given to [Canvas.drawCommands]. The
+/// commands may change its color and stroke width for the shapes that follow
+/// them, with [setColor] and [setStrokeWidth].
+///
+/// The commands can be drawn any number of times, and reused after a [clear].
+///
+/// {@tool snippet}
+///
+/// ```dart
+/// void paintBars(Canvas canvas, List<double> heights) {
+///   final CanvasCommands commands = CanvasCommands();
+///   for (int i = 0; i < heights.length; i++) {
+///     commands.setColor(i.isEven ? const Color(0xFF2196F3) : const Color(0xFF4CAF50));
+///     commands.drawRect(Rect.fromLTWH(i * 10.0, 100.0 - heights[i], 8.0, heights[i]));
+///   }
+///   canvas.drawCommands(commands, Paint());
+/// }
+/// ```
+/// {@end-tool}
+final class CanvasCommands {
+  /// Creates an empty list of commands.
+  CanvasCommands();
+
+  // Must match //lib/ui/painting/canvas_commands.h.
+  static const int _kSetColor = 0;
+  static const int _kSetStrokeWidth = 1;
+  static const int _kDrawLine = 2;
+  static const int _kDrawRect = 3;
+  static const int _kDrawOval = 4;
+  static const int _kDrawCircle = 5;
+
+  // The commands, each an operation followed by its arguments.
+  Float32List _data = Float32List(64);
+  int _length = 0;
+
+  /// Whether there are no commands.
+  bool get isEmpty => _length == 0;
+
+  void _reserve(int count) {
+    if (_length + count > _data.length) {
+      final Float32List data = Float32List(math.max(_data.length * 2, _length + count));
+      data.setRange(0, _length, _data);
+      _data = data;
+    }
+  }
+
+  void _add4(int op, double a, double b, double c, double d) {
+    _reserve(5);
+    _data[_length++] = op.toDouble();
+    _data[_length++] = a;
+    _data[_length++] = b;
+    _data[_length++] = c;
+    _data[_length++] = d;
+  }
+
+  /// Draws the shapes of the commands that follow in the given color.
+  ///
+  /// This replaces the color of the [Paint] for those shapes, as set by
+  /// [Paint.color].
+  void setColor(Color color) {
+    _reserve(6);
+    _data[_length++] = _kSetColor.toDouble();
+    _data[_length++] = color.r;
+    _data[_length++] = color.g;
+    _data[_length++] = color.b;
+    _data[_length++] = color.a;
+    _data[_length++] = _colorSpaceToIndex(color.colorSpace).toDouble();
+  }
+
+  /// Strokes the shapes of the commands that follow with lines of the given
+  /// width.
+  ///
+  /// This replaces the stroke width of the [Paint] for those shapes, as set
+  /// by [Paint.strokeWidth].
+  void setStrokeWidth(double width) {
+    _reserve(2);
+    _data[_length++] = _kSetStrokeWidth.toDouble();
+    _data[_length++] = width;
+  }
+
+  /// Draws a line between the given points, as with [Canvas.drawLine].
+  void drawLine(Offset p1, Offset p2) {
+    assert(_offsetIsValid(p1));
+    assert(_offsetIsValid(p2));
+    _add4(_kDrawLine, p1.dx, p1.dy, p2.dx, p2.dy);
+  }
+
+  /// Draws a rectangle, as with [Canvas.drawRect].
+  void drawRect(Rect rect) {
+    assert(_rectIsValid(rect));
+    rect = _NativeCanvas._sorted(rect);
+    _add4(_kDrawRect, rect.left, rect.top, rect.right, rect.bottom);
+  }
+
+  /// Draws an axis-aligned oval that fills the given rectangle, as with
+  /// [Canvas.drawOval].
+  void drawOval(Rect rect) {
+    assert(_rectIsValid(rect));
+    rect = _NativeCanvas._sorted(rect);
+    _add4(_kDrawOval, rect.left, rect.top, rect.right, rect.bottom);
+  }
+
+  /// Draws a circle centered at the point given by the first argument and
+  /// that has the radius given by the second argument, as with
+  /// [Canvas.drawCircle].
+  void drawCircle(Offset c, double radius) {
+    assert(_offsetIsValid(c));
+    _reserve(4);
+    _data[_length++] = _kDrawCircle.toDouble();
+    _data[_length++] = c.dx;
+    _data[_length++] = c.dy;
+    _data[_length++] = radius;
+  }
+
+  /// Removes all the commands.
+  void clear() {
+    _length = 0;
+  }
+}
+
 /// An interface for recording graphical operations.
 ///
 /// [Canvas] objects are used in creating [Picture] objects, which can
@@ -6550,6 +6693,17 @@ abstract class Canvas {
   ///    [List<Float32List>].
   void drawRawPoints(PointMode pointMode, Float32List points, Paint paint);
 
+  /// Draws the shapes of the given commands, in order, with the given [Paint].
+  ///
+  /// This records the same shapes as making the draw calls of the commands on
+  /// this canvas one by one, with the paint changed by their
+  /// [CanvasCommands.setColor] and [CanvasCommands.setStrokeWidth] commands,
+  /// but in a single call.
+  ///
+  /// Whether the shapes other than lines are filled or stroked is
+  /// controlled by [Paint.style] of `paint`.
+  void drawCommands(CanvasCommands commands, Paint paint);
+
   /// Draws a set of [Vertices] onto the canvas as one or more triangles.
   ///
   /// The [Paint.color] property specifies the default color to use for the
@@ -7087,7 +7241,11 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
   void drawLine(Offset p1, Offset p2, Paint paint) {
     assert(_offsetIsValid(p1));
     assert(_offsetIsValid(p2));
-    _drawLine(p1.dx, p1.dy, p2.dx, p2.dy, paint._objects, paint._data);
+    if (paint._objects == null) {
+      _drawLineWithPaintData(p1.dx, p1.dy, p2.dx, p2.dy, paint._dataBytes.address);
+    } else {
+      _drawLine(p1.dx, p1.dy, p2.dx, p2.dy, paint._objects, paint._data);
+    }
   }
 
   @Native<Void Function(Pointer<Void>, Double, Double, Double, Double, Handle, Handle)>(
@@ -7102,20 +7260,52 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
     ByteData paintData,
   );
 
+  @Native<Void Function(Pointer<Void>, Double, Double, Double, Double, Pointer<Uint8>)>(
+    symbol: 'Canvas::drawLineWithPaintData',
+    isLeaf: true,
+  )
+  external void _drawLineWithPaintData(
+    double x1,
+    double y1,
+    double x2,
+    double y2,
+    Pointer<Uint8> paintData,
+  );
+
   @override
   void drawPaint(Paint paint) {
-    _drawPaint(paint._objects, paint._data);
+    if (paint._objects == null) {
+      _drawPaintWithPaintData(paint._dataBytes.address);
+    } else {
+      _drawPaint(paint._objects, paint._data);
+    }
   }
 
   @Native<Void Function(Pointer<Void>, Handle, Handle)>(symbol: 'Canvas::drawPaint')
   external void _drawPaint(List<Object?>? paintObjects, ByteData paintData);
 
+  @Native<Void Function(Pointer<Void>, Pointer<Uint8>)>(
+    symbol: 'Canvas::drawPaintWithPaintData',
+    isLeaf: true,
+  )
+  external void _drawPaintWithPaintData(Pointer<Uint8> paintData);
+
   @override
   void drawRect(Rect rect, Paint paint) {
     assert(_rectIsValid(rect));
     rect = _sorted(rect);
     if (paint.style != PaintingStyle.fill || !rect.isEmpty) {
-      _drawRect(rect.left, rect.top, rect.right, rect.bottom, paint._objects, paint._data);
+      if (paint._objects == null) {
+        _drawRectWithPaintData(
+          rect.left,
+          rect.top,
+          rect.right,
+          rect.bottom,
+          paint._dataBytes.address,
+        );
+      } else {
+        _drawRect(rect.left, rect.top, rect.right, rect.bottom, paint._objects, paint._data);
+      }
     }
   }
 
@@ -7131,6 +7321,18 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
     ByteData paintData,
   );
 
+  @Native<Void Function(Pointer<Void>, Double, Double, Double, Double, Pointer<Uint8>)>(
+    symbol: 'Canvas::drawRectWithPaintData',
+    isLeaf: true,
+  )
+  external void _drawRectWithPaintData(
+    double left,
+    double top,
+    double right,
+    double bottom,
+    Pointer<Uint8> paintData,
+  );
+
   @override
   void drawRRect(RRect rrect, Paint paint) {
     assert(_rrectIsValid(rrect));
@@ -7177,7 +7379,17 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
     assert(_rectIsValid(rect));
     rect = _sorted(rect);
     if (paint.style != PaintingStyle.fill || !rect.isEmpty) {
-      _drawOval(rect.left, rect.top, rect.right, rect.bottom, paint._objects, paint._data);
+      if (paint._objects == null) {
+        _drawOvalWithPaintData(
+          rect.left,
+          rect.top,
+          rect.right,
+          rect.bottom,
+          paint._dataBytes.address,
+        );
+      } else {
+        _drawOval(rect.left, rect.top, rect.right, rect.bottom, paint._objects, paint._data);
+      }
     }
   }
 
@@ -7193,10 +7405,26 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
     ByteData paintData,
   );
 
+  @Native<Void Function(Pointer<Void>, Double, Double, Double, Double, Pointer<Uint8>)>(
+    symbol: 'Canvas::drawOvalWithPaintData',
+    isLeaf: true,
+  )
+  external void _drawOvalWithPaintData(
+    double left,
+    double top,
+    double right,
+    double bottom,
+    Pointer<Uint8> paintData,
+  );
+
   @override
   void drawCircle(Offset c, double radius, Paint paint) {
     assert(_offsetIsValid(c));
-    _drawCircle(c.dx, c.dy, radius, paint._objects, paint._data);
+    if (paint._objects == null) {
+      _drawCircleWithPaintData(c.dx, c.dy, radius, paint._dataBytes.address);
+    } else {
+      _drawCircle(c.dx, c.dy, radius, paint._objects, paint._data);
+    }
   }
 
   @Native<Void Function(Pointer<Void>, Double, Double, Double, Handle, Handle)>(
@@ -7210,20 +7438,44 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
     ByteData paintData,
   );
 
+  @Native<Void Function(Pointer<Void>, Double, Double, Double, Pointer<Uint8>)>(
+    symbol: 'Canvas::drawCircleWithPaintData',
+    isLeaf: true,
+  )
+  external void _drawCircleWithPaintData(
+    double x,
+    double y,
+    double radius,
+    Pointer<Uint8> paintData,
+  );
+
   @override
   void drawArc(Rect rect, double startAngle, double sweepAngle, bool useCenter, Paint paint) {
     assert(_rectIsValid(rect));
-    _drawArc(
-      rect.left,
-      rect.top,
-      rect.right,
-      rect.bottom,
-      startAngle,
-      sweepAngle,
-      useCenter,
-      paint._objects,
-      paint._data,
-    );
+    if (paint._objects == null) {
+      _drawArcWithPaintData(
+        rect.left,
+        rect.top,
+        rect.right,
+        rect.bottom,
+        startAngle,
+        sweepAngle,
+        useCenter,
+        paint._dataBytes.address,
+      );
+    } else {
+      _drawArc(
+        rect.left,
+        rect.top,
+        rect.right,
+        rect.bottom,
+        startAngle,
+        sweepAngle,
+        useCenter,
+        paint._objects,
+        paint._data,
+      );
+    }
   }
 
   @Native<
@@ -7252,6 +7504,30 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
     ByteData paintData,
   );
 
+  @Native<
+    Void Function(
+      Pointer<Void>,
+      Double,
+      Double,
+      Double,
+      Double,
+      Double,
+      Double,
+      Bool,
+      Pointer<Uint8>,
+    )
+  >(symbol: 'Canvas::drawArcWithPaintData', isLeaf: true)
+  external void _drawArcWithPaintData(
+    double left,
+    double top,
+    double right,
+    double bottom,
+    double startAngle,
+    double sweepAngle,
+    bool useCenter,
+    Pointer<Uint8> paintData,
+  );
+
   @override
   void drawPath(Path path, Paint paint) {
     _drawPath(path as _NativePath, paint._objects, paint._data);
@@ -7440,6 +7716,24 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
     Float32List points,
   );
 
+  @override
+  void drawCommands(CanvasCommands commands, Paint paint) {
+    if (!commands.isEmpty) {
+      _drawCommands(
+        paint._objects,
+        paint._data,
+        Float32List.sublistView(commands._data, 0, commands._length),
+      );
+    }
+  }
+
+  @Native<Void Function(Pointer<Void>, Handle, Handle, Handle)>(symbol: 'Canvas::drawCommands')
+  external void _drawCommands(
+    List<Object?>? paintObjects,
+    ByteData paintData,
+    Float32List commands,
+  );
+
   @override
   void drawVertices(Vertices vertices, BlendMode blendMode, Paint paint) {
     assert(!vertices.debugDisposed);
@@ -8212,6 +8506,25 @@ abstract class ImageDescriptor {
     int? targetHeight,
     TargetPixelFormat targetFormat = TargetPixelFormat.dontCare,
   });
+
+  /// Decodes only the part of the image inside `region`, as if the whole image
+  /// were decoded at `scale` times its [width] and [height].
+  ///
+  /// This allows viewers of very large images to decode just the tiles that
+  /// are visible, at a resolution that suits the current zoom level, instead
+  /// of the whole image. `region` is in the pixel coordinates of the image,
+  /// and the returned image is `region` scaled by `scale`, rounded out to
+  /// whole pixels and clipped to the image.
+  ///
+  /// The `scale` must be greater than zero and at most one. Where the image
+  /// format allows it, only the rows and columns that hold the region are
+  /// decoded.
+  ///
+  /// The most recently decoded regions are cached, so decoding a region
+  /// again at the same scale is cheap.
+  ///
+  /// This is not supported on the Web.
+  Future<Image> decodeRegion(Rect region, {double scale = 1.0});
 }
 
 base class _NativeImageDescriptor extends NativeFieldWrapperClass1 implements ImageDescriptor {
@@ -8323,6 +8636,45 @@ base class _NativeImageDescriptor extends NativeFieldWrapperClass1 implements Im
     int targetFormat,
   );
 
+  @override
+  Future<Image> decodeRegion(Rect region, {double scale = 1.0}) {
+    final completer = Completer<Image>.sync();
+    final String? error = _decodeRegion(
+      (_Image? image, String decodeError) {
+        if (image == null) {
+          if (decodeError.isEmpty) {
+            decodeError = 'Failed to decode the image region.';
+          }
+          completer.completeError(Exception(decodeError));
+        } else {
+          completer.complete(Image._(image, image.width, image.height));
+        }
+      },
+      region.left,
+      region.top,
+      region.right,
+      region.bottom,
+      scale,
+    );
+    if (error != null) {
+      throw Exception(error);
+    }
+    return completer.future;
+  }
+
+  /// Returns an error message on failure, null on success.
+  @Native<Handle Function(Pointer<Void>, Handle, Double, Double, Double, Double, Double)>(
+    symbol: 'ImageDescriptor::decodeRegion',
+  )
+  external String? _decodeRegion(
+    void Function(_Image?, String) callback,
+    double left,
+    double top,
+    double right,
+    double bottom,
+    double scale,
+  );
+
   @override
   String toString() =>
       'ImageDescriptor(width: ${_width ?? '?'}, height: ${_height ?? '?'}, bytes per pixel: ${_bytesPerPixel ?? '?'})';
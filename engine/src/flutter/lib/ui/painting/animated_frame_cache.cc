@@ -0,0 +1,277 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/animated_frame_cache.h"
+
+#include <algorithm>
+#include <sstream>
+#include <unordered_map>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+#include "third_party/skia/include/codec/SkCodec.h"
+#include "third_party/skia/include/codec/SkCodecAnimation.h"
+
+namespace flutter {
+
+static std::mutex gCachesMutex;
+static std::unordered_map<const SkData*, std::weak_ptr<AnimatedFrameCache>>
+    gCaches;
+
+std::shared_ptr<AnimatedFrameCache> AnimatedFrameCache::ForData(
+    const sk_sp<SkData>& data,
+    std::shared_ptr<ImageGenerator> generator) {
+  if (!data) {
+    return std::make_shared<AnimatedFrameCache>(std::move(generator));
+  }
+  std::scoped_lock lock(gCachesMutex);
+  std::weak_ptr<AnimatedFrameCache>& weak_cache = gCaches[data.get()];
+  std::shared_ptr<AnimatedFrameCache> cache = weak_cache.lock();
+  if (!cache) {
+    cache = std::make_shared<AnimatedFrameCache>(std::move(generator), data);
+    weak_cache = cache;
+  }
+  return cache;
+}
+
+AnimatedFrameCache::AnimatedFrameCache(
+    std::shared_ptr<ImageGenerator> generator,
+    sk_sp<SkData> data)
+    : generator_(std::move(generator)),
+      data_(std::move(data)),
+      frame_count_(generator_->GetFrameCount()),
+      repetition_count_(generator_->GetPlayCount() ==
+                                ImageGenerator::kInfinitePlayCount
+                            ? -1
+                            : generator_->GetPlayCount() - 1) {}
+
+AnimatedFrameCache::~AnimatedFrameCache() {
+  if (!data_) {
+    return;
+  }
+  std::scoped_lock lock(gCachesMutex);
+  auto found = gCaches.find(data_.get());
+  // A new cache may have taken the place of this one already.
+  if (found != gCaches.end() && found->second.expired()) {
+    gCaches.erase(found);
+  }
+}
+
+void AnimatedFrameCache::AddClient(int lookahead) {
+  std::scoped_lock lock(mutex_);
+  needed_frames_ += lookahead + 1;
+}
+
+void AnimatedFrameCache::RemoveClient(int lookahead) {
+  std::scoped_lock lock(mutex_);
+  FML_DCHECK(needed_frames_ >= static_cast<size_t>(lookahead + 1));
+  needed_frames_ -= lookahead + 1;
+  EvictLocked();
+}
+
+std::pair<std::optional<AnimatedFrameCache::Frame>, std::string>
+AnimatedFrameCache::GetFrame(int index, const void* upload_context) {
+  std::scoped_lock lock(mutex_);
+  auto found = FindLocked(index);
+  if (found != frames_.end()) {
+    stats_.hit_count++;
+  } else {
+    std::string decode_error;
+    std::tie(found, decode_error) = DecodeLocked(index);
+    if (found == frames_.end()) {
+      return std::make_pair(std::nullopt, std::move(decode_error));
+    }
+  }
+  // Mark the frame as the most recently used.
+  frames_.splice(frames_.begin(), frames_, found);
+  Frame frame = found->frame;
+  if (found->upload_context != upload_context) {
+    frame.image.reset();
+  }
+  return std::make_pair(std::move(frame), std::string());
+}
+
+void AnimatedFrameCache::SetUploadedImage(int index,
+                                          const void* upload_context,
+                                          sk_sp<DlImage> image) {
+  std::scoped_lock lock(mutex_);
+  auto found = FindLocked(index);
+  if (found != frames_.end()) {
+    found->frame.image = std::move(image);
+    found->upload_context = upload_context;
+  }
+}
+
+void AnimatedFrameCache::DecodeAhead(int index, int count) {
+  TRACE_EVENT0("flutter", "AnimatedFrameCache::DecodeAhead");
+  count = std::min(count, frame_count_ - 1);
+  for (int i = 1; i <= count; i++) {
+    const int frame_index = (index + i) % frame_count_;
+    std::scoped_lock lock(mutex_);
+    if (FindLocked(frame_index) == frames_.end()) {
+      DecodeLocked(frame_index);
+    }
+  }
+}
+
+AnimatedFrameCache::Stats AnimatedFrameCache::GetStats() const {
+  std::scoped_lock lock(mutex_);
+  Stats stats = stats_;
+  stats.cached_count = frames_.size();
+  stats.cached_bytes = bytes_;
+  return stats;
+}
+
+std::list<AnimatedFrameCache::CachedFrame>::iterator
+AnimatedFrameCache::FindLocked(int index) {
+  return std::find_if(
+      frames_.begin(), frames_.end(),
+      [index](const CachedFrame& frame) { return frame.index == index; });
+}
+
+std::pair<std::list<AnimatedFrameCache::CachedFrame>::iterator, std::string>
+AnimatedFrameCache::DecodeLocked(int index) {
+  // Start from the latest of the first frame, the frame after the previous
+  // decode, and the frames after the cached frames, that isn't past `index`.
+  int start = next_index_ <= index ? next_index_ : 0;
+  const CachedFrame* start_after = nullptr;
+  for (const CachedFrame& frame : frames_) {
+    if (frame.index < index && frame.index + 1 > start) {
+      start = frame.index + 1;
+      start_after = &frame;
+    }
+  }
+  if (start_after) {
+    state_ = start_after->state;
+  } else if (start == 0) {
+    state_ = {};
+  }
+  next_index_ = start;
+
+  while (true) {
+    const int frame_index = next_index_;
+    auto [frame, decode_error] = DecodeNextLocked();
+    if (!frame.has_value()) {
+      return std::make_pair(frames_.end(), std::move(decode_error));
+    }
+    bytes_ += frame->bitmap.computeByteSize();
+    frames_.push_front({.index = frame_index,
+                        .frame = std::move(frame.value()),
+                        .state = state_});
+    EvictLocked();
+    if (frame_index == index) {
+      return std::make_pair(frames_.begin(), std::string());
+    }
+  }
+}
+
+std::pair<std::optional<AnimatedFrameCache::Frame>, std::string>
+AnimatedFrameCache::DecodeNextLocked() {
+  TRACE_EVENT0("flutter", "AnimatedFrameCache::DecodeNextLocked");
+  const int frame_index = next_index_;
+  // A frame that fails to decode is skipped, like the frames decoded after it
+  // would be.
+  next_index_ = (next_index_ + 1) % frame_count_;
+
+  SkBitmap bitmap = SkBitmap();
+  SkImageInfo info = generator_->GetInfo().makeColorType(kN32_SkColorType);
+  if (info.alphaType() == kUnpremul_SkAlphaType) {
+    SkImageInfo updated = info.makeAlphaType(kPremul_SkAlphaType);
+    info = updated;
+  }
+  if (!bitmap.tryAllocPixels(info)) {
+    std::ostringstream ostr;
+    ostr << "Failed to allocate memory for bitmap of size "
+         << info.computeMinByteSize() << "B";
+    std::string decode_error = ostr.str();
+    FML_LOG(ERROR) << decode_error;
+    return std::make_pair(std::nullopt, decode_error);
+  }
+
+  ImageGenerator::FrameInfo frameInfo = generator_->GetFrameInfo(frame_index);
+
+  const int requiredFrameIndex =
+      frameInfo.required_frame.value_or(SkCodec::kNoFrame);
+
+  if (requiredFrameIndex != SkCodec::kNoFrame) {
+    // We are here when the frame said |disposal_method| is
+    // `DisposalMethod::kKeep` or `DisposalMethod::kRestorePrevious` and
+    // |requiredFrameIndex| is set to ex-frame or ex-ex-frame.
+    if (!state_.last_required_frame.has_value()) {
+      FML_DLOG(INFO)
+          << "Frame " << frame_index << " depends on frame "
+          << requiredFrameIndex
+          << " and no required frames are cached. Using blank slate instead.";
+    } else {
+      // Copy the previous frame's output buffer into the current frame as the
+      // starting point.
+      bitmap.writePixels(state_.last_required_frame->pixmap());
+      if (state_.restore_bg_color_rect.has_value()) {
+        bitmap.erase(SK_ColorTRANSPARENT, state_.restore_bg_color_rect.value());
+      }
+    }
+  }
+
+  // Write the new frame to the output buffer. The bitmap pixels as supplied
+  // are already set in accordance with the previous frame's disposal policy.
+  if (!generator_->GetPixels(info, bitmap.getPixels(), bitmap.rowBytes(),
+                             frame_index, requiredFrameIndex)) {
+    std::ostringstream ostr;
+    ostr << "Could not getPixels for frame " << frame_index;
+    std::string decode_error = ostr.str();
+    FML_LOG(ERROR) << decode_error;
+    return std::make_pair(std::nullopt, decode_error);
+  }
+  // The frame is shared by the codecs and kept as the backdrop of the next
+  // frames, so it must not change.
+  bitmap.setImmutable();
+
+  const bool keep_current_frame =
+      frameInfo.disposal_method == SkCodecAnimation::DisposalMethod::kKeep;
+  const bool restore_previous_frame =
+      frameInfo.disposal_method ==
+      SkCodecAnimation::DisposalMethod::kRestorePrevious;
+  const bool previous_frame_available = state_.last_required_frame.has_value();
+
+  // Store the current frame in `last_required_frame` if the frame's disposal
+  // method indicates we should do so.
+  // * When the disposal method is "Keep", the stored frame should always be
+  //   overwritten with the new frame we just crafted.
+  // * When the disposal method is "RestorePrevious", the previously stored
+  //   frame should be retained and used as the backdrop for the next frame
+  //   again. If there isn't already a stored frame, that means we haven't
+  //   rendered any frames yet! When this happens, we just fall back to "Keep"
+  //   behavior and store the current frame as the backdrop of the next frame.
+
+  if (keep_current_frame ||
+      (previous_frame_available && !restore_previous_frame)) {
+    // Replace the stored frame. The `last_required_frame` will get used as
+    // the starting backdrop for the next frame.
+    state_.last_required_frame = bitmap;
+  }
+
+  if (frameInfo.disposal_method ==
+      SkCodecAnimation::DisposalMethod::kRestoreBGColor) {
+    state_.restore_bg_color_rect = frameInfo.disposal_rect;
+  } else {
+    state_.restore_bg_color_rect.reset();
+  }
+
+  stats_.decoded_count++;
+  return std::make_pair(
+      Frame{.bitmap = std::move(bitmap), .duration = frameInfo.duration},
+      std::string());
+}
+
+void AnimatedFrameCache::EvictLocked() {
+  const size_t max_frames =
+      std::max<size_t>(std::min<size_t>(needed_frames_, frame_count_), 1);
+  while (frames_.size() > 1 &&
+         (frames_.size() > max_frames || bytes_ > kMaxBytes)) {
+    bytes_ -= frames_.back().frame.bitmap.computeByteSize();
+    frames_.pop_back();
+  }
+}
+
+}  // namespace flutter
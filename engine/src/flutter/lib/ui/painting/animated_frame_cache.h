@@ -0,0 +1,160 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_ANIMATED_FRAME_CACHE_H_
+#define FLUTTER_LIB_UI_PAINTING_ANIMATED_FRAME_CACHE_H_
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "flutter/display_list/image/dl_image.h"
+#include "flutter/fml/macros.h"
+#include "flutter/lib/ui/painting/image_generator.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkData.h"
+#include "third_party/skia/include/core/SkRect.h"
+
+namespace flutter {
+
+/// @brief  Decodes the frames of an animated image and keeps the last ones
+///         used, so that the codecs playing the same animation share the
+///         frames instead of each decoding them.
+///
+///         Every frame is composited over the frames it depends on, and the
+///         compositing state after a frame is kept with it. A frame that is
+///         not cached is decoded from the nearest earlier cached frame, or
+///         from wherever the previous decode stopped, rather than from the
+///         first frame.
+///
+///         The cache keeps as many frames as its clients may need at once:
+///         each client needs its current frame and the frames it decodes
+///         ahead. The least recently used frames are evicted first, and the
+///         frames past |kMaxBytes| are evicted even if they are needed.
+///
+///         This class is thread safe. Decodes of the same animation are
+///         serialized.
+class AnimatedFrameCache {
+ public:
+  static constexpr size_t kMaxBytes = 32 * 1024 * 1024;
+
+  struct Frame {
+    SkBitmap bitmap;
+    int duration = 0;
+    /// The texture the frame was last uploaded to for the upload context it
+    /// was fetched for, or null.
+    sk_sp<DlImage> image;
+  };
+
+  struct Stats {
+    size_t decoded_count = 0;
+    /// The frames that were fetched without being decoded.
+    size_t hit_count = 0;
+    size_t cached_count = 0;
+    size_t cached_bytes = 0;
+  };
+
+  /// @brief  Gets the cache for the animation encoded in `data`, the same
+  ///         one for as long as any codec holds on to it. A new one that
+  ///         decodes with `generator` is created otherwise, or if `data` is
+  ///         null.
+  static std::shared_ptr<AnimatedFrameCache> ForData(
+      const sk_sp<SkData>& data,
+      std::shared_ptr<ImageGenerator> generator);
+
+  explicit AnimatedFrameCache(std::shared_ptr<ImageGenerator> generator,
+                              sk_sp<SkData> data = nullptr);
+
+  ~AnimatedFrameCache();
+
+  int GetFrameCount() const { return frame_count_; }
+
+  int GetRepetitionCount() const { return repetition_count_; }
+
+  /// @brief  Registers a client that decodes `lookahead` frames ahead of the
+  ///         frame it shows, so that the frames it needs are kept.
+  void AddClient(int lookahead);
+
+  void RemoveClient(int lookahead);
+
+  /// @brief  Gets the frame at `index`, decoding it if it is not cached.
+  ///
+  /// @param[in]  upload_context  An opaque identifier of the context the
+  ///                             frame is uploaded with, or null. The
+  ///                             uploaded image is only returned for the
+  ///                             same context.
+  ///
+  /// @return     The frame, or the error the decode failed with.
+  std::pair<std::optional<Frame>, std::string> GetFrame(
+      int index,
+      const void* upload_context);
+
+  /// @brief  Keeps `image` as the texture the frame at `index` was uploaded
+  ///         to with `upload_context`, if the frame is still cached.
+  void SetUploadedImage(int index,
+                        const void* upload_context,
+                        sk_sp<DlImage> image);
+
+  /// @brief  Decodes the `count` frames after `index` that aren't cached.
+  ///         The lock is released between frames, so that the frames that
+  ///         are shown first are not held up.
+  void DecodeAhead(int index, int count);
+
+  Stats GetStats() const;
+
+ private:
+  // The state that frames after a frame are composited with.
+  struct CompositingState {
+    // The last decoded frame that's required to decode any subsequent frames.
+    std::optional<SkBitmap> last_required_frame;
+    // The rectangle that should be cleared if the previous frame's disposal
+    // method was kRestoreBGColor.
+    std::optional<SkIRect> restore_bg_color_rect;
+  };
+
+  struct CachedFrame {
+    int index;
+    Frame frame;
+    const void* upload_context = nullptr;
+    // The state after this frame, which the next frame is decoded with.
+    CompositingState state;
+  };
+
+  const std::shared_ptr<ImageGenerator> generator_;
+  // Keeps the key of the cache in |ForData| from being reused.
+  const sk_sp<SkData> data_;
+  const int frame_count_;
+  const int repetition_count_;
+
+  mutable std::mutex mutex_;
+  // The most recently used frame first.
+  std::list<CachedFrame> frames_;
+  size_t bytes_ = 0;
+  size_t needed_frames_ = 0;
+  Stats stats_;
+  // Where the previous decode stopped.
+  int next_index_ = 0;
+  CompositingState state_;
+
+  std::list<CachedFrame>::iterator FindLocked(int index);
+
+  // Decodes the frames up to `index` from the best starting point.
+  std::pair<std::list<CachedFrame>::iterator, std::string> DecodeLocked(
+      int index);
+
+  // Decodes the frame at |next_index_| with |state_|.
+  std::pair<std::optional<Frame>, std::string> DecodeNextLocked();
+
+  void EvictLocked();
+
+  FML_DISALLOW_COPY_AND_ASSIGN(AnimatedFrameCache);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_ANIMATED_FRAME_CACHE_H_
@@ -0,0 +1,198 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/animated_frame_cache.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "third_party/skia/include/codec/SkCodecAnimation.h"
+#include "third_party/skia/include/core/SkImage.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+// Every frame is blended over the previous one and adds one to its first
+// pixel, so the first pixel of a frame is its index plus one only if it was
+// composited over the right frames.
+class CountingImageGenerator : public ImageGenerator {
+ public:
+  explicit CountingImageGenerator(unsigned int frame_count)
+      : frame_count_(frame_count), info_(SkImageInfo::MakeN32Premul(2, 2)) {}
+
+  ~CountingImageGenerator() override = default;
+
+  const SkImageInfo& GetInfo() override { return info_; }
+
+  unsigned int GetFrameCount() const override { return frame_count_; }
+
+  unsigned int GetPlayCount() const override { return kInfinitePlayCount; }
+
+  const ImageGenerator::FrameInfo GetFrameInfo(
+      unsigned int frame_index) override {
+    std::optional<unsigned int> required_frame;
+    if (frame_index > 0) {
+      required_frame = frame_index - 1;
+    }
+    return {.required_frame = required_frame,
+            .duration = 10 * (frame_index + 1),
+            .disposal_method = SkCodecAnimation::DisposalMethod::kKeep};
+  }
+
+  SkISize GetScaledDimensions(float scale) override {
+    return info_.dimensions();
+  }
+
+  bool GetPixels(const SkImageInfo& info,
+                 void* pixels,
+                 size_t row_bytes,
+                 unsigned int frame_index,
+                 std::optional<unsigned int> prior_frame) override {
+    uint32_t* pixel = static_cast<uint32_t*>(pixels);
+    *pixel = frame_index == 0 ? 1 : *pixel + 1;
+    decoded_frames_.push_back(frame_index);
+    return true;
+  }
+
+  const std::vector<unsigned int>& decoded_frames() const {
+    return decoded_frames_;
+  }
+
+ private:
+  const unsigned int frame_count_;
+  const SkImageInfo info_;
+  std::vector<unsigned int> decoded_frames_;
+};
+
+uint32_t FirstPixel(const AnimatedFrameCache::Frame& frame) {
+  return *static_cast<const uint32_t*>(frame.bitmap.getPixels());
+}
+
+}  // namespace
+
+TEST(AnimatedFrameCacheTest, SharesCacheForTheSameData) {
+  sk_sp<SkData> data = SkData::MakeWithCString("animation");
+  sk_sp<SkData> other_data = SkData::MakeWithCString("animation");
+
+  auto cache = AnimatedFrameCache::ForData(
+      data, std::make_shared<CountingImageGenerator>(4));
+  EXPECT_EQ(AnimatedFrameCache::ForData(
+                data, std::make_shared<CountingImageGenerator>(4)),
+            cache);
+  EXPECT_NE(AnimatedFrameCache::ForData(
+                other_data, std::make_shared<CountingImageGenerator>(4)),
+            cache);
+  EXPECT_NE(AnimatedFrameCache::ForData(
+                nullptr, std::make_shared<CountingImageGenerator>(4)),
+            cache);
+
+  // Once no codec holds on to the cache, a new one is created.
+  std::weak_ptr<AnimatedFrameCache> weak_cache = cache;
+  cache.reset();
+  EXPECT_TRUE(weak_cache.expired());
+  EXPECT_TRUE(AnimatedFrameCache::ForData(
+      data, std::make_shared<CountingImageGenerator>(4)));
+}
+
+TEST(AnimatedFrameCacheTest, ClientsShareDecodedFrames) {
+  auto generator = std::make_shared<CountingImageGenerator>(4);
+  AnimatedFrameCache cache(generator);
+  cache.AddClient(0);
+  cache.AddClient(0);
+
+  for (int i = 0; i < 4; i++) {
+    auto [first, first_error] = cache.GetFrame(i, nullptr);
+    auto [second, second_error] = cache.GetFrame(i, nullptr);
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(FirstPixel(first.value()), static_cast<uint32_t>(i + 1));
+    EXPECT_EQ(FirstPixel(second.value()), static_cast<uint32_t>(i + 1));
+    EXPECT_EQ(first->duration, 10 * (i + 1));
+  }
+  EXPECT_EQ(generator->decoded_frames(),
+            (std::vector<unsigned int>{0, 1, 2, 3}));
+  EXPECT_EQ(cache.GetStats().hit_count, 4u);
+  // Two clients without lookahead need two frames at most.
+  EXPECT_EQ(cache.GetStats().cached_count, 2u);
+
+  cache.RemoveClient(0);
+  EXPECT_EQ(cache.GetStats().cached_count, 1u);
+  cache.RemoveClient(0);
+}
+
+TEST(AnimatedFrameCacheTest, ResumesFromNearestCachedFrame) {
+  auto generator = std::make_shared<CountingImageGenerator>(6);
+  AnimatedFrameCache cache(generator);
+  cache.AddClient(1);
+
+  ASSERT_TRUE(cache.GetFrame(0, nullptr).first.has_value());
+  ASSERT_TRUE(cache.GetFrame(1, nullptr).first.has_value());
+  // Frame 3 continues from where the previous decode stopped.
+  auto [frame, error] = cache.GetFrame(3, nullptr);
+  ASSERT_TRUE(frame.has_value());
+  EXPECT_EQ(FirstPixel(frame.value()), 4u);
+  EXPECT_EQ(generator->decoded_frames(),
+            (std::vector<unsigned int>{0, 1, 2, 3}));
+
+  // Going back to the first frame restarts the decode, but frame 4 is then
+  // decoded from frame 3, which is still cached with the compositing state
+  // after it.
+  std::tie(frame, error) = cache.GetFrame(0, nullptr);
+  ASSERT_TRUE(frame.has_value());
+  EXPECT_EQ(FirstPixel(frame.value()), 1u);
+  std::tie(frame, error) = cache.GetFrame(4, nullptr);
+  ASSERT_TRUE(frame.has_value());
+  EXPECT_EQ(FirstPixel(frame.value()), 5u);
+  EXPECT_EQ(generator->decoded_frames(),
+            (std::vector<unsigned int>{0, 1, 2, 3, 0, 4}));
+  cache.RemoveClient(1);
+}
+
+TEST(AnimatedFrameCacheTest, DecodesAhead) {
+  auto generator = std::make_shared<CountingImageGenerator>(5);
+  AnimatedFrameCache cache(generator);
+  cache.AddClient(2);
+
+  ASSERT_TRUE(cache.GetFrame(3, nullptr).first.has_value());
+  cache.DecodeAhead(3, 2);
+  EXPECT_EQ(generator->decoded_frames(),
+            (std::vector<unsigned int>{0, 1, 2, 3, 4, 0}));
+
+  const size_t decoded_count = cache.GetStats().decoded_count;
+  auto [frame, error] = cache.GetFrame(4, nullptr);
+  ASSERT_TRUE(frame.has_value());
+  EXPECT_EQ(FirstPixel(frame.value()), 5u);
+  std::tie(frame, error) = cache.GetFrame(0, nullptr);
+  ASSERT_TRUE(frame.has_value());
+  EXPECT_EQ(FirstPixel(frame.value()), 1u);
+  EXPECT_EQ(cache.GetStats().decoded_count, decoded_count);
+  cache.RemoveClient(2);
+}
+
+TEST(AnimatedFrameCacheTest, UploadedImagesAreKeptPerContext) {
+  AnimatedFrameCache cache(std::make_shared<CountingImageGenerator>(2));
+  cache.AddClient(0);
+  int context = 0;
+  int other_context = 0;
+
+  auto [frame, error] = cache.GetFrame(0, &context);
+  ASSERT_TRUE(frame.has_value());
+  EXPECT_FALSE(frame->image);
+  sk_sp<DlImage> image =
+      DlImage::Make(SkImages::RasterFromBitmap(frame->bitmap));
+  cache.SetUploadedImage(0, &context, image);
+
+  std::tie(frame, error) = cache.GetFrame(0, &context);
+  ASSERT_TRUE(frame.has_value());
+  EXPECT_EQ(frame->image, image);
+  std::tie(frame, error) = cache.GetFrame(0, &other_context);
+  ASSERT_TRUE(frame.has_value());
+  EXPECT_FALSE(frame->image);
+  cache.RemoveClient(0);
+}
+
+}  // namespace testing
+}  // namespace flutter
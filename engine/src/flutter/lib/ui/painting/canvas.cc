@@ -8,6 +8,7 @@
 
 #include "flutter/display_list/dl_builder.h"
 #include "flutter/lib/ui/floating_point.h"
+#include "flutter/lib/ui/painting/canvas_commands.h"
 #include "flutter/lib/ui/painting/image.h"
 #include "flutter/lib/ui/painting/image_filter.h"
 #include "flutter/lib/ui/painting/paint.h"
@@ -229,8 +230,22 @@ void Canvas::drawLine(double x1,
                       double y2,
                       Dart_Handle paint_objects,
                       Dart_Handle paint_data) {
-  Paint paint(paint_objects, paint_data);
+  DrawLine(x1, y1, x2, y2, Paint(paint_objects, paint_data));
+}
+
+void Canvas::drawLineWithPaintData(double x1,
+                                   double y1,
+                                   double x2,
+                                   double y2,
+                                   const uint8_t* paint_data) {
+  DrawLine(x1, y1, x2, y2, Paint(paint_data));
+}
 
+void Canvas::DrawLine(double x1,
+                      double y1,
+                      double x2,
+                      double y2,
+                      const Paint& paint) {
   FML_DCHECK(paint.isNotNull());
   if (display_list_builder_) {
     DlPaint dl_paint;
@@ -241,8 +256,14 @@ void Canvas::drawLine(double x1,
 }
 
 void Canvas::drawPaint(Dart_Handle paint_objects, Dart_Handle paint_data) {
-  Paint paint(paint_objects, paint_data);
+  DrawPaint(Paint(paint_objects, paint_data));
+}
+
+void Canvas::drawPaintWithPaintData(const uint8_t* paint_data) {
+  DrawPaint(Paint(paint_data));
+}
 
+void Canvas::DrawPaint(const Paint& paint) {
   FML_DCHECK(paint.isNotNull());
   if (display_list_builder_) {
     DlPaint dl_paint;
@@ -263,8 +284,22 @@ void Canvas::drawRect(double left,
                       double bottom,
                       Dart_Handle paint_objects,
                       Dart_Handle paint_data) {
-  Paint paint(paint_objects, paint_data);
+  DrawRect(left, top, right, bottom, Paint(paint_objects, paint_data));
+}
 
+void Canvas::drawRectWithPaintData(double left,
+                                   double top,
+                                   double right,
+                                   double bottom,
+                                   const uint8_t* paint_data) {
+  DrawRect(left, top, right, bottom, Paint(paint_data));
+}
+
+void Canvas::DrawRect(double left,
+                      double top,
+                      double right,
+                      double bottom,
+                      const Paint& paint) {
   FML_DCHECK(paint.isNotNull());
   if (display_list_builder_) {
     DlPaint dl_paint;
@@ -321,8 +356,22 @@ void Canvas::drawOval(double left,
                       double bottom,
                       Dart_Handle paint_objects,
                       Dart_Handle paint_data) {
-  Paint paint(paint_objects, paint_data);
+  DrawOval(left, top, right, bottom, Paint(paint_objects, paint_data));
+}
+
+void Canvas::drawOvalWithPaintData(double left,
+                                   double top,
+                                   double right,
+                                   double bottom,
+                                   const uint8_t* paint_data) {
+  DrawOval(left, top, right, bottom, Paint(paint_data));
+}
 
+void Canvas::DrawOval(double left,
+                      double top,
+                      double right,
+                      double bottom,
+                      const Paint& paint) {
   FML_DCHECK(paint.isNotNull());
   if (display_list_builder_) {
     DlPaint dl_paint;
@@ -338,8 +387,20 @@ void Canvas::drawCircle(double x,
                         double radius,
                         Dart_Handle paint_objects,
                         Dart_Handle paint_data) {
-  Paint paint(paint_objects, paint_data);
+  DrawCircle(x, y, radius, Paint(paint_objects, paint_data));
+}
+
+void Canvas::drawCircleWithPaintData(double x,
+                                     double y,
+                                     double radius,
+                                     const uint8_t* paint_data) {
+  DrawCircle(x, y, radius, Paint(paint_data));
+}
 
+void Canvas::DrawCircle(double x,
+                        double y,
+                        double radius,
+                        const Paint& paint) {
   FML_DCHECK(paint.isNotNull());
   if (display_list_builder_) {
     DlPaint dl_paint;
@@ -358,8 +419,30 @@ void Canvas::drawArc(double left,
                      bool useCenter,
                      Dart_Handle paint_objects,
                      Dart_Handle paint_data) {
-  Paint paint(paint_objects, paint_data);
+  DrawArc(left, top, right, bottom, startAngle, sweepAngle, useCenter,
+          Paint(paint_objects, paint_data));
+}
+
+void Canvas::drawArcWithPaintData(double left,
+                                  double top,
+                                  double right,
+                                  double bottom,
+                                  double startAngle,
+                                  double sweepAngle,
+                                  bool useCenter,
+                                  const uint8_t* paint_data) {
+  DrawArc(left, top, right, bottom, startAngle, sweepAngle, useCenter,
+          Paint(paint_data));
+}
 
+void Canvas::DrawArc(double left,
+                     double top,
+                     double right,
+                     double bottom,
+                     double startAngle,
+                     double sweepAngle,
+                     bool useCenter,
+                     const Paint& paint) {
   FML_DCHECK(paint.isNotNull());
   if (display_list_builder_) {
     DlPaint dl_paint;
@@ -556,6 +639,21 @@ void Canvas::drawPoints(Dart_Handle paint_objects,
   }
 }
 
+void Canvas::drawCommands(Dart_Handle paint_objects,
+                          Dart_Handle paint_data,
+                          const tonic::Float32List& commands) {
+  Paint paint(paint_objects, paint_data);
+
+  FML_DCHECK(paint.isNotNull());
+  if (display_list_builder_) {
+    DlPaint dl_paint;
+    paint.paint(dl_paint, kDrawRectFlags, DlTileMode::kDecal);
+    bool valid = DrawCanvasCommands(*builder(), dl_paint, commands.data(),
+                                    commands.num_elements());
+    FML_DCHECK(valid) << "CanvasCommands wrote an invalid command.";
+  }
+}
+
 void Canvas::drawVertices(const Vertices* vertices,
                           DlBlendMode blend_mode,
                           Dart_Handle paint_objects,
@@ -18,6 +18,7 @@
 
 namespace flutter {
 class CanvasImage;
+class Paint;
 
 class Canvas : public RefCountedDartWrappable<Canvas>, DisplayListOpFlags {
   DEFINE_WRAPPERTYPEINFO();
@@ -76,8 +77,19 @@ class Canvas : public RefCountedDartWrappable<Canvas>, DisplayListOpFlags {
                 Dart_Handle paint_objects,
                 Dart_Handle paint_data);
 
+  // The draw calls that take the paint as |paint_data| are leaf calls for
+  // paints without any objects, which read the bytes of the paint's data in
+  // place instead of through its handle.
+  void drawLineWithPaintData(double x1,
+                             double y1,
+                             double x2,
+                             double y2,
+                             const uint8_t* paint_data);
+
   void drawPaint(Dart_Handle paint_objects, Dart_Handle paint_data);
 
+  void drawPaintWithPaintData(const uint8_t* paint_data);
+
   void drawRect(double left,
                 double top,
                 double right,
@@ -85,6 +97,12 @@ class Canvas : public RefCountedDartWrappable<Canvas>, DisplayListOpFlags {
                 Dart_Handle paint_objects,
                 Dart_Handle paint_data);
 
+  void drawRectWithPaintData(double left,
+                             double top,
+                             double right,
+                             double bottom,
+                             const uint8_t* paint_data);
+
   void drawRRect(const RRect& rrect,
                  Dart_Handle paint_objects,
                  Dart_Handle paint_data);
@@ -105,12 +123,23 @@ class Canvas : public RefCountedDartWrappable<Canvas>, DisplayListOpFlags {
                 Dart_Handle paint_objects,
                 Dart_Handle paint_data);
 
+  void drawOvalWithPaintData(double left,
+                             double top,
+                             double right,
+                             double bottom,
+                             const uint8_t* paint_data);
+
   void drawCircle(double x,
                   double y,
                   double radius,
                   Dart_Handle paint_objects,
                   Dart_Handle paint_data);
 
+  void drawCircleWithPaintData(double x,
+                               double y,
+                               double radius,
+                               const uint8_t* paint_data);
+
   void drawArc(double left,
                double top,
                double right,
@@ -121,6 +150,15 @@ class Canvas : public RefCountedDartWrappable<Canvas>, DisplayListOpFlags {
                Dart_Handle paint_objects,
                Dart_Handle paint_data);
 
+  void drawArcWithPaintData(double left,
+                            double top,
+                            double right,
+                            double bottom,
+                            double startAngle,
+                            double sweepAngle,
+                            bool useCenter,
+                            const uint8_t* paint_data);
+
   void drawPath(const CanvasPath* path,
                 Dart_Handle paint_objects,
                 Dart_Handle paint_data);
@@ -170,6 +208,10 @@ class Canvas : public RefCountedDartWrappable<Canvas>, DisplayListOpFlags {
                   DlPointMode point_mode,
                   const tonic::Float32List& points);
 
+  void drawCommands(Dart_Handle paint_objects,
+                    Dart_Handle paint_data,
+                    const tonic::Float32List& commands);
+
   void drawVertices(const Vertices* vertices,
                     DlBlendMode blend_mode,
                     Dart_Handle paint_objects,
@@ -197,6 +239,28 @@ class Canvas : public RefCountedDartWrappable<Canvas>, DisplayListOpFlags {
  private:
   explicit Canvas(sk_sp<DisplayListBuilder> builder);
 
+  void DrawLine(double x1, double y1, double x2, double y2, const Paint& paint);
+  void DrawPaint(const Paint& paint);
+  void DrawRect(double left,
+                double top,
+                double right,
+                double bottom,
+                const Paint& paint);
+  void DrawOval(double left,
+                double top,
+                double right,
+                double bottom,
+                const Paint& paint);
+  void DrawCircle(double x, double y, double radius, const Paint& paint);
+  void DrawArc(double left,
+               double top,
+               double right,
+               double bottom,
+               double startAngle,
+               double sweepAngle,
+               bool useCenter,
+               const Paint& paint);
+
   sk_sp<DisplayListBuilder> display_list_builder_;
 };
 
@@ -0,0 +1,81 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/canvas_commands.h"
+
+namespace flutter {
+
+namespace {
+
+// The number of arguments that follow each operation.
+size_t GetArgumentCount(CanvasCommand command) {
+  switch (command) {
+    case CanvasCommand::kSetColor:
+      return 5;
+    case CanvasCommand::kSetStrokeWidth:
+      return 1;
+    case CanvasCommand::kDrawLine:
+    case CanvasCommand::kDrawRect:
+    case CanvasCommand::kDrawOval:
+      return 4;
+    case CanvasCommand::kDrawCircle:
+      return 3;
+  }
+  return 0;
+}
+
+}  // namespace
+
+bool DrawCanvasCommands(DlCanvas& canvas,
+                        DlPaint paint,
+                        const float* commands,
+                        size_t length) {
+  size_t index = 0;
+  while (index < length) {
+    const float op = commands[index];
+    if (!(op >= static_cast<float>(CanvasCommand::kSetColor) &&
+          op <= static_cast<float>(CanvasCommand::kDrawCircle))) {
+      return false;
+    }
+    const CanvasCommand command =
+        static_cast<CanvasCommand>(static_cast<int>(op));
+    const size_t argument_count = GetArgumentCount(command);
+    if (length - index - 1 < argument_count) {
+      return false;
+    }
+    const float* args = commands + index + 1;
+    index += 1 + argument_count;
+
+    switch (command) {
+      case CanvasCommand::kSetColor: {
+        const DlColor color(
+            args[3], args[0], args[1], args[2],
+            static_cast<DlColorSpace>(static_cast<int>(args[4])));
+        paint.setColor(color.withColorSpace(DlColorSpace::kExtendedSRGB));
+        break;
+      }
+      case CanvasCommand::kSetStrokeWidth:
+        paint.setStrokeWidth(args[0]);
+        break;
+      case CanvasCommand::kDrawLine:
+        canvas.DrawLine(DlPoint(args[0], args[1]), DlPoint(args[2], args[3]),
+                        paint);
+        break;
+      case CanvasCommand::kDrawRect:
+        canvas.DrawRect(DlRect::MakeLTRB(args[0], args[1], args[2], args[3]),
+                        paint);
+        break;
+      case CanvasCommand::kDrawOval:
+        canvas.DrawOval(DlRect::MakeLTRB(args[0], args[1], args[2], args[3]),
+                        paint);
+        break;
+      case CanvasCommand::kDrawCircle:
+        canvas.DrawCircle(DlPoint(args[0], args[1]), args[2], paint);
+        break;
+    }
+  }
+  return true;
+}
+
+}  // namespace flutter
@@ -0,0 +1,53 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_CANVAS_COMMANDS_H_
+#define FLUTTER_LIB_UI_PAINTING_CANVAS_COMMANDS_H_
+
+#include <cstddef>
+
+#include "flutter/display_list/dl_canvas.h"
+#include "flutter/display_list/dl_paint.h"
+
+namespace flutter {
+
+// The operations of the commands written by a ui.CanvasCommands, each of
+// which is followed by its arguments.
+// Must match the constants of CanvasCommands in //lib/ui/painting.dart.
+enum class CanvasCommand {
+  // red, green, blue, alpha, color space
+  kSetColor = 0,
+  // width
+  kSetStrokeWidth = 1,
+  // x1, y1, x2, y2
+  kDrawLine = 2,
+  // left, top, right, bottom
+  kDrawRect = 3,
+  // left, top, right, bottom
+  kDrawOval = 4,
+  // x, y, radius
+  kDrawCircle = 5,
+};
+
+//------------------------------------------------------------------------------
+/// @brief      Draw the shapes of the commands written by a ui.CanvasCommands
+///             to the canvas, starting with the given paint.
+///
+/// @param[in]  canvas    The canvas to draw to.
+/// @param[in]  paint     The paint of the ui.Canvas.drawCommands call, whose
+///                       color and stroke width the commands may change.
+/// @param[in]  commands  The commands.
+/// @param[in]  length    The number of floats of the commands.
+///
+/// @return     Whether all the commands were valid. Drawing stops at the
+///             first command that is not.
+///
+bool DrawCanvasCommands(DlCanvas& canvas,
+                        DlPaint paint,
+                        const float* commands,
+                        size_t length);
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_CANVAS_COMMANDS_H_
@@ -0,0 +1,105 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/canvas_commands.h"
+
+#include <vector>
+
+#include "flutter/display_list/dl_builder.h"
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+float Op(CanvasCommand command) {
+  return static_cast<float>(command);
+}
+
+}  // namespace
+
+TEST(CanvasCommandsTest, DrawsTheShapesOfTheCommands) {
+  DlPaint paint = DlPaint().setStrokeWidth(3.0f);
+  std::vector<float> commands = {
+      Op(CanvasCommand::kDrawRect), 1.0f, 2.0f, 3.0f, 4.0f,  //
+      Op(CanvasCommand::kDrawLine), 5.0f, 6.0f, 7.0f, 8.0f,  //
+      Op(CanvasCommand::kDrawOval), 1.0f, 2.0f, 9.0f, 9.0f,  //
+      Op(CanvasCommand::kDrawCircle), 5.0f, 5.0f, 2.0f,      //
+  };
+
+  DisplayListBuilder builder;
+  EXPECT_TRUE(
+      DrawCanvasCommands(builder, paint, commands.data(), commands.size()));
+
+  DisplayListBuilder expected;
+  expected.DrawRect(DlRect::MakeLTRB(1.0f, 2.0f, 3.0f, 4.0f), paint);
+  expected.DrawLine(DlPoint(5.0f, 6.0f), DlPoint(7.0f, 8.0f), paint);
+  expected.DrawOval(DlRect::MakeLTRB(1.0f, 2.0f, 9.0f, 9.0f), paint);
+  expected.DrawCircle(DlPoint(5.0f, 5.0f), 2.0f, paint);
+  EXPECT_TRUE(builder.Build()->Equals(expected.Build()));
+}
+
+TEST(CanvasCommandsTest, ChangesTheColorAndStrokeWidthOfThePaint) {
+  DlPaint paint = DlPaint().setDrawStyle(DlDrawStyle::kStroke);
+  std::vector<float> commands = {
+      Op(CanvasCommand::kDrawRect),
+      1.0f,
+      2.0f,
+      3.0f,
+      4.0f,
+      Op(CanvasCommand::kSetColor),
+      1.0f,
+      0.0f,
+      0.0f,
+      0.5f,
+      static_cast<float>(DlColorSpace::kSRGB),
+      Op(CanvasCommand::kSetStrokeWidth),
+      5.0f,
+      Op(CanvasCommand::kDrawRect),
+      1.0f,
+      2.0f,
+      3.0f,
+      4.0f,
+  };
+
+  DisplayListBuilder builder;
+  EXPECT_TRUE(
+      DrawCanvasCommands(builder, paint, commands.data(), commands.size()));
+
+  DisplayListBuilder expected;
+  expected.DrawRect(DlRect::MakeLTRB(1.0f, 2.0f, 3.0f, 4.0f), paint);
+  DlPaint changed = paint;
+  changed.setColor(DlColor(0.5f, 1.0f, 0.0f, 0.0f, DlColorSpace::kSRGB)
+                       .withColorSpace(DlColorSpace::kExtendedSRGB));
+  changed.setStrokeWidth(5.0f);
+  expected.DrawRect(DlRect::MakeLTRB(1.0f, 2.0f, 3.0f, 4.0f), changed);
+  EXPECT_TRUE(builder.Build()->Equals(expected.Build()));
+}
+
+TEST(CanvasCommandsTest, StopsAtAnInvalidCommand) {
+  DlPaint paint;
+  std::vector<float> unknown = {
+      Op(CanvasCommand::kDrawCircle), 5.0f, 5.0f, 2.0f,  //
+      42.0f, 1.0f,                                       //
+  };
+  std::vector<float> truncated = {
+      Op(CanvasCommand::kDrawCircle), 5.0f, 5.0f, 2.0f,  //
+      Op(CanvasCommand::kDrawRect), 1.0f, 2.0f,          //
+  };
+
+  DisplayListBuilder expected;
+  expected.DrawCircle(DlPoint(5.0f, 5.0f), 2.0f, paint);
+  sk_sp<DisplayList> expected_display_list = expected.Build();
+
+  for (const std::vector<float>& commands : {unknown, truncated}) {
+    DisplayListBuilder builder;
+    EXPECT_FALSE(
+        DrawCanvasCommands(builder, paint, commands.data(), commands.size()));
+    EXPECT_TRUE(builder.Build()->Equals(expected_display_list));
+  }
+}
+
+}  // namespace testing
+}  // namespace flutter
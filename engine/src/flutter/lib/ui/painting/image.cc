@@ -42,6 +42,13 @@ void CanvasImage::dispose() {
   ClearDartWrapper();
 }
 
+size_t CanvasImage::GetAllocationSize() const {
+  if (image_) {
+    return sizeof(CanvasImage) + image_->GetApproximateByteSize();
+  }
+  return sizeof(CanvasImage);
+}
+
 int CanvasImage::colorSpace() {
   if (image_->skia_image()) {
     return ColorSpace::kSRGB;
@@ -58,10 +58,18 @@ class CanvasImage final : public RefCountedDartWrappable<CanvasImage> {
   void set_image(const sk_sp<DlImage>& image) {
     FML_DCHECK(image->isUIThreadSafe());
     image_ = image;
+    // Images that are already wrapped, such as the cached frames of codecs,
+    // report the size of their new image.
+    if (dart_wrapper()) {
+      UpdateDartWrapperAllocationSize();
+    }
   }
 
   int colorSpace();
 
+  // |DartWrappable|
+  size_t GetAllocationSize() const override;
+
  private:
   CanvasImage();
 
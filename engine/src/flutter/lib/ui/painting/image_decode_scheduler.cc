@@ -0,0 +1,134 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/image_decode_scheduler.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+ImageDecodeScheduler::ImageDecodeScheduler(
+    std::shared_ptr<fml::BasicTaskRunner> runner,
+    size_t max_bytes_in_flight)
+    : runner_(std::move(runner)), max_bytes_in_flight_(max_bytes_in_flight) {
+  FML_DCHECK(runner_);
+}
+
+ImageDecodeScheduler::~ImageDecodeScheduler() = default;
+
+void ImageDecodeScheduler::SetMaxBytesInFlight(size_t max_bytes_in_flight) {
+  std::vector<PendingDecode> admitted;
+  std::vector<PendingDecode> cancelled;
+  {
+    std::scoped_lock lock(mutex_);
+    max_bytes_in_flight_ = max_bytes_in_flight;
+    AdmitLocked(admitted, cancelled);
+  }
+  Dispatch(std::move(admitted), std::move(cancelled));
+}
+
+void ImageDecodeScheduler::Schedule(size_t bytes,
+                                    fml::closure task,
+                                    std::function<bool()> is_cancelled,
+                                    fml::closure on_cancelled) {
+  FML_DCHECK(task);
+  std::vector<PendingDecode> admitted;
+  std::vector<PendingDecode> cancelled;
+  {
+    std::scoped_lock lock(mutex_);
+    pending_.push_back({
+        .bytes = bytes,
+        .task = std::move(task),
+        .is_cancelled = std::move(is_cancelled),
+        .on_cancelled = std::move(on_cancelled),
+        .requested = fml::TimePoint::Now(),
+    });
+    AdmitLocked(admitted, cancelled);
+  }
+  Dispatch(std::move(admitted), std::move(cancelled));
+}
+
+ImageDecodeScheduler::Stats ImageDecodeScheduler::GetStats() const {
+  std::scoped_lock lock(mutex_);
+  Stats stats = stats_;
+  stats.queue_depth = pending_.size();
+  return stats;
+}
+
+void ImageDecodeScheduler::AdmitLocked(std::vector<PendingDecode>& admitted,
+                                       std::vector<PendingDecode>& cancelled) {
+  // Drops the cancelled decodes first so that they don't hold up the others.
+  auto cancelled_begin = std::stable_partition(
+      pending_.begin(), pending_.end(), [](const PendingDecode& decode) {
+        return !decode.is_cancelled || !decode.is_cancelled();
+      });
+  for (auto it = cancelled_begin; it != pending_.end(); ++it) {
+    cancelled.push_back(std::move(*it));
+  }
+  stats_.cancelled_count += pending_.end() - cancelled_begin;
+  pending_.erase(cancelled_begin, pending_.end());
+
+  const fml::TimePoint now = fml::TimePoint::Now();
+  while (!pending_.empty()) {
+    PendingDecode& decode = pending_.back();
+    if (max_bytes_in_flight_ > 0 && stats_.in_flight_count > 0 &&
+        stats_.in_flight_bytes + decode.bytes > max_bytes_in_flight_) {
+      break;
+    }
+    const fml::TimeDelta wait = now - decode.requested;
+    stats_.max_wait = std::max(stats_.max_wait, wait);
+    stats_.total_wait = stats_.total_wait + wait;
+    stats_.admitted_count++;
+    stats_.in_flight_count++;
+    stats_.in_flight_bytes += decode.bytes;
+    admitted.push_back(std::move(decode));
+    pending_.pop_back();
+  }
+  TraceStatsLocked();
+}
+
+void ImageDecodeScheduler::Dispatch(std::vector<PendingDecode> admitted,
+                                    std::vector<PendingDecode> cancelled) {
+  for (PendingDecode& decode : cancelled) {
+    if (decode.on_cancelled) {
+      decode.on_cancelled();
+    }
+  }
+  for (PendingDecode& decode : admitted) {
+    runner_->PostTask([scheduler = shared_from_this(), bytes = decode.bytes,
+                       task = std::move(decode.task)]() {
+      task();
+      scheduler->OnDecodeDone(bytes);
+    });
+  }
+}
+
+void ImageDecodeScheduler::OnDecodeDone(size_t bytes) {
+  std::vector<PendingDecode> admitted;
+  std::vector<PendingDecode> cancelled;
+  {
+    std::scoped_lock lock(mutex_);
+    FML_DCHECK(stats_.in_flight_count > 0);
+    FML_DCHECK(stats_.in_flight_bytes >= bytes);
+    stats_.in_flight_count--;
+    stats_.in_flight_bytes -= bytes;
+    AdmitLocked(admitted, cancelled);
+  }
+  Dispatch(std::move(admitted), std::move(cancelled));
+}
+
+void ImageDecodeScheduler::TraceStatsLocked() const {
+  FML_TRACE_COUNTER("flutter", "ImageDecodeScheduler",
+                    reinterpret_cast<int64_t>(this),  //
+                    "QueueDepth", pending_.size(),    //
+                    "InFlightCount", stats_.in_flight_count,
+                    "InFlightKBytes", stats_.in_flight_bytes / 1024);
+}
+
+}  // namespace flutter
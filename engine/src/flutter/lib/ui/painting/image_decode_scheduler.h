@@ -0,0 +1,105 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_IMAGE_DECODE_SCHEDULER_H_
+#define FLUTTER_LIB_UI_PAINTING_IMAGE_DECODE_SCHEDULER_H_
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "flutter/fml/closure.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/task_runner.h"
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace flutter {
+
+/// @brief  Admits image decodes to the concurrent task runner so that the
+///         bytes the decodes in flight are estimated to allocate stay within
+///         a bound. Decodes that don't fit wait, and the most recently
+///         requested ones are admitted first, as those are the likeliest to
+///         be visible. Waiting decodes are dropped once they are cancelled.
+///
+///         A decode that doesn't fit the bound on its own is admitted once
+///         no other decodes are in flight. A bound of zero admits every
+///         decode right away.
+///
+///         This class is thread safe, and must be owned by a
+///         `std::shared_ptr`.
+class ImageDecodeScheduler
+    : public std::enable_shared_from_this<ImageDecodeScheduler> {
+ public:
+  struct Stats {
+    /// The decodes waiting to be admitted.
+    size_t queue_depth = 0;
+    /// The decodes admitted whose tasks have not finished.
+    size_t in_flight_count = 0;
+    /// The estimated bytes of the decodes in flight.
+    size_t in_flight_bytes = 0;
+    size_t admitted_count = 0;
+    size_t cancelled_count = 0;
+    /// The longest and the total time decodes waited to be admitted.
+    fml::TimeDelta max_wait;
+    fml::TimeDelta total_wait;
+  };
+
+  explicit ImageDecodeScheduler(std::shared_ptr<fml::BasicTaskRunner> runner,
+                                size_t max_bytes_in_flight = 0);
+
+  ~ImageDecodeScheduler();
+
+  void SetMaxBytesInFlight(size_t max_bytes_in_flight);
+
+  /// @brief  Runs `task` on the runner once `bytes` fit in the bound. The
+  ///         bytes count against the bound until the task returns.
+  ///
+  ///         If `is_cancelled` returns true while the decode waits, the
+  ///         decode is dropped and `on_cancelled` is called instead of
+  ///         `task`, on whichever thread noticed.
+  void Schedule(size_t bytes,
+                fml::closure task,
+                std::function<bool()> is_cancelled = nullptr,
+                fml::closure on_cancelled = nullptr);
+
+  Stats GetStats() const;
+
+ private:
+  struct PendingDecode {
+    size_t bytes;
+    fml::closure task;
+    std::function<bool()> is_cancelled;
+    fml::closure on_cancelled;
+    fml::TimePoint requested;
+  };
+
+  const std::shared_ptr<fml::BasicTaskRunner> runner_;
+  mutable std::mutex mutex_;
+  size_t max_bytes_in_flight_;
+  // The most recently requested decode last.
+  std::deque<PendingDecode> pending_;
+  Stats stats_;
+
+  // Admits the decodes that fit. The cancelled ones are moved to
+  // |cancelled| so that they can be called without the lock held.
+  void AdmitLocked(std::vector<PendingDecode>& admitted,
+                   std::vector<PendingDecode>& cancelled);
+
+  void Dispatch(std::vector<PendingDecode> admitted,
+                std::vector<PendingDecode> cancelled);
+
+  void OnDecodeDone(size_t bytes);
+
+  void TraceStatsLocked() const;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ImageDecodeScheduler);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_IMAGE_DECODE_SCHEDULER_H_
@@ -0,0 +1,120 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/image_decode_scheduler.h"
+
+#include <atomic>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+// Runs the posted tasks only when asked to.
+class ManualTaskRunner : public fml::BasicTaskRunner {
+ public:
+  void PostTask(const fml::closure& task) override { tasks_.push_back(task); }
+
+  size_t GetTaskCount() const { return tasks_.size(); }
+
+  void RunTask(size_t index) {
+    fml::closure task = tasks_[index];
+    tasks_.erase(tasks_.begin() + index);
+    task();
+  }
+
+ private:
+  std::vector<fml::closure> tasks_;
+};
+
+}  // namespace
+
+TEST(ImageDecodeSchedulerTest, AdmitsEverythingWithoutABound) {
+  auto runner = std::make_shared<ManualTaskRunner>();
+  auto scheduler = std::make_shared<ImageDecodeScheduler>(runner);
+  for (int i = 0; i < 10; i++) {
+    scheduler->Schedule(1000, [] {});
+  }
+  EXPECT_EQ(runner->GetTaskCount(), 10u);
+  EXPECT_EQ(scheduler->GetStats().queue_depth, 0u);
+  EXPECT_EQ(scheduler->GetStats().in_flight_bytes, 10000u);
+}
+
+TEST(ImageDecodeSchedulerTest, BoundsBytesInFlight) {
+  auto runner = std::make_shared<ManualTaskRunner>();
+  auto scheduler = std::make_shared<ImageDecodeScheduler>(runner, 2500);
+  std::vector<int> order;
+  for (int i = 0; i < 5; i++) {
+    scheduler->Schedule(1000, [&order, i] { order.push_back(i); });
+  }
+  // The first is admitted right away, and as decodes complete the most
+  // recently requested ones are admitted first.
+  EXPECT_EQ(runner->GetTaskCount(), 2u);
+  EXPECT_EQ(scheduler->GetStats().queue_depth, 3u);
+  EXPECT_EQ(scheduler->GetStats().in_flight_bytes, 2000u);
+
+  runner->RunTask(0);
+  EXPECT_EQ(runner->GetTaskCount(), 2u);
+  runner->RunTask(1);
+  runner->RunTask(0);
+  runner->RunTask(0);
+  runner->RunTask(0);
+  EXPECT_EQ(runner->GetTaskCount(), 0u);
+  EXPECT_EQ(order, (std::vector<int>{0, 4, 1, 3, 2}));
+
+  ImageDecodeScheduler::Stats stats = scheduler->GetStats();
+  EXPECT_EQ(stats.queue_depth, 0u);
+  EXPECT_EQ(stats.in_flight_count, 0u);
+  EXPECT_EQ(stats.in_flight_bytes, 0u);
+  EXPECT_EQ(stats.admitted_count, 5u);
+}
+
+TEST(ImageDecodeSchedulerTest, AdmitsLargeDecodesAlone) {
+  auto runner = std::make_shared<ManualTaskRunner>();
+  auto scheduler = std::make_shared<ImageDecodeScheduler>(runner, 1000);
+  scheduler->Schedule(500, [] {});
+  scheduler->Schedule(5000, [] {});
+  EXPECT_EQ(runner->GetTaskCount(), 1u);
+
+  runner->RunTask(0);
+  EXPECT_EQ(runner->GetTaskCount(), 1u);
+  EXPECT_EQ(scheduler->GetStats().in_flight_bytes, 5000u);
+}
+
+TEST(ImageDecodeSchedulerTest, DropsCancelledDecodes) {
+  auto runner = std::make_shared<ManualTaskRunner>();
+  auto scheduler = std::make_shared<ImageDecodeScheduler>(runner, 1000);
+  std::atomic<bool> cancelled = false;
+  bool ran = false;
+  bool cancel_notified = false;
+  scheduler->Schedule(1000, [] {});
+  scheduler->Schedule(
+      1000, [&ran] { ran = true; }, [&cancelled] { return cancelled.load(); },
+      [&cancel_notified] { cancel_notified = true; });
+  EXPECT_EQ(scheduler->GetStats().queue_depth, 1u);
+
+  cancelled = true;
+  runner->RunTask(0);
+  EXPECT_EQ(runner->GetTaskCount(), 0u);
+  EXPECT_FALSE(ran);
+  EXPECT_TRUE(cancel_notified);
+  EXPECT_EQ(scheduler->GetStats().cancelled_count, 1u);
+}
+
+TEST(ImageDecodeSchedulerTest, RaisingTheBoundAdmitsWaitingDecodes) {
+  auto runner = std::make_shared<ManualTaskRunner>();
+  auto scheduler = std::make_shared<ImageDecodeScheduler>(runner, 1000);
+  scheduler->Schedule(1000, [] {});
+  scheduler->Schedule(1000, [] {});
+  EXPECT_EQ(runner->GetTaskCount(), 1u);
+
+  scheduler->SetMaxBytesInFlight(0);
+  EXPECT_EQ(runner->GetTaskCount(), 2u);
+}
+
+}  // namespace testing
+}  // namespace flutter
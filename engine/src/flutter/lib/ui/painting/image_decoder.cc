@@ -4,6 +4,8 @@
 
 #include "flutter/lib/ui/painting/image_decoder.h"
 
+#include <algorithm>
+
 #include "flutter/lib/ui/painting/image_decoder_skia.h"
 
 #if IMPELLER_SUPPORTS_RENDERING
@@ -18,9 +20,10 @@ std::unique_ptr<ImageDecoder> ImageDecoder::Make(
     std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_task_runner,
     const fml::WeakPtr<IOManager>& io_manager,
     const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch) {
+  std::unique_ptr<ImageDecoder> decoder;
 #if IMPELLER_SUPPORTS_RENDERING
   if (settings.enable_impeller) {
-    return std::make_unique<ImageDecoderImpeller>(
+    decoder = std::make_unique<ImageDecoderImpeller>(
         runners,                            //
         std::move(concurrent_task_runner),  //
         io_manager,                         //
@@ -29,15 +32,24 @@ std::unique_ptr<ImageDecoder> ImageDecoder::Make(
   }
 #endif  // IMPELLER_SUPPORTS_RENDERING
 #if !SLIMPELLER
-  return std::make_unique<ImageDecoderSkia>(
-      runners,                            //
-      std::move(concurrent_task_runner),  //
-      io_manager                          //
-  );
-#else   //  !SLIMPELLER
-  FML_LOG(FATAL) << "Could not setup an image decoder.";
-  return nullptr;
+  if (!decoder) {
+    decoder = std::make_unique<ImageDecoderSkia>(
+        runners,                            //
+        std::move(concurrent_task_runner),  //
+        io_manager                          //
+    );
+  }
 #endif  //  !SLIMPELLER
+  if (!decoder) {
+    FML_LOG(FATAL) << "Could not setup an image decoder.";
+    return nullptr;
+  }
+  decoder->SetMaxDecodeBytesInFlight(settings.image_decode_max_bytes_in_flight);
+  decoder->SetAnimatedImageLookaheadFrames(
+      settings.animated_image_lookahead_frames);
+  decoder->SetCompressImagesOnLowMemory(
+      settings.impeller_compress_images_on_low_memory);
+  return decoder;
 }
 
 ImageDecoder::ImageDecoder(
@@ -47,6 +59,8 @@ ImageDecoder::ImageDecoder(
     : runners_(runners),
       concurrent_task_runner_(std::move(concurrent_task_runner)),
       io_manager_(std::move(io_manager)),
+      decode_scheduler_(
+          std::make_shared<ImageDecodeScheduler>(concurrent_task_runner_)),
       weak_factory_(this) {
   FML_DCHECK(runners_.IsValid());
   FML_DCHECK(runners_.GetUITaskRunner()->RunsTasksOnCurrentThread())
@@ -59,4 +73,80 @@ fml::TaskRunnerAffineWeakPtr<ImageDecoder> ImageDecoder::GetWeakPtr() const {
   return weak_factory_.GetWeakPtr();
 }
 
+void ImageDecoder::SetMaxDecodeBytesInFlight(size_t max_bytes) {
+  decode_scheduler_->SetMaxBytesInFlight(max_bytes);
+}
+
+ImageDecodeScheduler::Stats ImageDecoder::GetDecodeStats() const {
+  return decode_scheduler_->GetStats();
+}
+
+void ImageDecoder::SetAnimatedImageLookaheadFrames(int frames) {
+  animated_image_lookahead_frames_ = std::max(frames, 0);
+}
+
+int ImageDecoder::GetAnimatedImageLookaheadFrames() const {
+  return animated_image_lookahead_frames_;
+}
+
+void ImageDecoder::SetCompressImagesOnLowMemory(bool compress) {
+  compress_images_on_low_memory_ = compress;
+}
+
+void ImageDecoder::NotifyLowMemoryWarning() {
+  is_memory_low_ = true;
+}
+
+ImageDecoder::Options ImageDecoder::GetEffectiveOptions(
+    const Options& options) const {
+  // Compressing small images saves little memory, and the blocks don't fit
+  // them as well.
+  static constexpr size_t kMinCompressedPixels = 64 * 64;
+  Options effective_options = options;
+  if (compress_images_on_low_memory_ && is_memory_low_ &&
+      options.target_format == TargetPixelFormat::kDontCare &&
+      static_cast<size_t>(options.target_width) * options.target_height >=
+          kMinCompressedPixels) {
+    effective_options.target_format = TargetPixelFormat::kCompressed;
+  }
+  return effective_options;
+}
+
+size_t ImageDecoder::EstimateDecodeBytes(const ImageDescriptor& descriptor,
+                                         const Options& options) {
+  const size_t bytes_per_pixel =
+      options.target_format == TargetPixelFormat::kR32G32B32A32Float ? 16 : 4;
+  size_t target_pixels =
+      static_cast<size_t>(options.target_width) * options.target_height;
+  size_t source_pixels =
+      static_cast<size_t>(descriptor.width()) * descriptor.height();
+  if (options.region.has_value() && target_pixels > 0) {
+    const size_t region_pixels =
+        static_cast<size_t>(options.region->width()) * options.region->height();
+    source_pixels = source_pixels * region_pixels / target_pixels;
+    target_pixels = region_pixels;
+  }
+  // Not every codec can decode to a smaller size, so compressed images are
+  // assumed to be decoded at their full size before they are resized.
+  if (!descriptor.is_compressed() || source_pixels == target_pixels) {
+    return target_pixels * bytes_per_pixel;
+  }
+  return (source_pixels + target_pixels) * bytes_per_pixel;
+}
+
+void ImageDecoder::ScheduleDecode(const ImageDescriptor& descriptor,
+                                  const Options& options,
+                                  fml::closure task,
+                                  fml::closure on_cancelled) {
+  std::function<bool()> is_cancelled;
+  if (options.cancelled) {
+    is_cancelled = [cancelled = options.cancelled]() {
+      return cancelled->load();
+    };
+  }
+  decode_scheduler_->Schedule(EstimateDecodeBytes(descriptor, options),
+                              std::move(task), std::move(is_cancelled),
+                              std::move(on_cancelled));
+}
+
 }  // namespace flutter
@@ -5,14 +5,18 @@
 #ifndef FLUTTER_LIB_UI_PAINTING_IMAGE_DECODER_H_
 #define FLUTTER_LIB_UI_PAINTING_IMAGE_DECODER_H_
 
+#include <atomic>
 #include <memory>
+#include <optional>
 
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
 #include "flutter/display_list/image/dl_image.h"
 #include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/lib/ui/io_manager.h"
+#include "flutter/lib/ui/painting/image_decode_scheduler.h"
 #include "flutter/lib/ui/painting/image_descriptor.h"
+#include "third_party/skia/include/core/SkRect.h"
 
 namespace flutter {
 
@@ -41,12 +45,23 @@ class ImageDecoder {
     kDontCare,
     kR32G32B32A32Float,
     kR32Float,
+    /// A block compressed format the GPU samples from, which takes a quarter
+    /// of the memory of 8-bit RGBA at the cost of some quality. The engine
+    /// picks the format, and falls back to |kDontCare| if the backend
+    /// supports none.
+    kCompressed,
   };
 
   struct Options {
     uint32_t target_width = 0;
     uint32_t target_height = 0;
     TargetPixelFormat target_format = TargetPixelFormat::kDontCare;
+    /// If set, only this region of the image at the target size is decoded,
+    /// and the decoded image has the size of the region.
+    std::optional<SkIRect> region;
+    /// If set, and true before the decode is admitted to the concurrent task
+    /// runner, the decode is skipped and the result is null.
+    std::shared_ptr<const std::atomic<bool>> cancelled;
   };
 
   // Takes an image descriptor and returns a handle to a texture resident on the
@@ -60,6 +75,40 @@ class ImageDecoder {
 
   fml::TaskRunnerAffineWeakPtr<ImageDecoder> GetWeakPtr() const;
 
+  // Bounds the bytes that the decodes in flight on the concurrent task runner
+  // are estimated to allocate. Zero, the default, doesn't bound them.
+  void SetMaxDecodeBytesInFlight(size_t max_bytes);
+
+  ImageDecodeScheduler::Stats GetDecodeStats() const;
+
+  // The scheduler of the decodes, whose stats may be read from any thread.
+  const std::shared_ptr<ImageDecodeScheduler>& GetDecodeScheduler() const {
+    return decode_scheduler_;
+  }
+
+  // How many frames the codecs of animated images decode ahead of the frame
+  // they show. Zero, the default, decodes every frame when it is asked for.
+  void SetAnimatedImageLookaheadFrames(int frames);
+
+  int GetAnimatedImageLookaheadFrames() const;
+
+  // Whether the images that don't ask for a pixel format are compressed to a
+  // block compressed format once the platform warns that memory is low.
+  void SetCompressImagesOnLowMemory(bool compress);
+
+  // Called once the platform warns that memory is low. The decoder doesn't
+  // know when memory stops being low, so it stays in that state.
+  void NotifyLowMemoryWarning();
+
+  // The options `options` are decoded with: the images that are large enough
+  // are compressed once memory is low, if enabled.
+  Options GetEffectiveOptions(const Options& options) const;
+
+  // Estimates the bytes that decoding `descriptor` with `options` allocates:
+  // the decoded image, and the intermediate it is resized from.
+  static size_t EstimateDecodeBytes(const ImageDescriptor& descriptor,
+                                    const Options& options);
+
  protected:
   TaskRunners runners_;
   std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_task_runner_;
@@ -70,7 +119,18 @@ class ImageDecoder {
       std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_task_runner,
       fml::WeakPtr<IOManager> io_manager);
 
+  // Runs `task` on the concurrent task runner once the decode is admitted, or
+  // `on_cancelled` if `options` is cancelled before then.
+  void ScheduleDecode(const ImageDescriptor& descriptor,
+                      const Options& options,
+                      fml::closure task,
+                      fml::closure on_cancelled);
+
  private:
+  std::shared_ptr<ImageDecodeScheduler> decode_scheduler_;
+  int animated_image_lookahead_frames_ = 0;
+  bool compress_images_on_low_memory_ = false;
+  bool is_memory_low_ = false;
   fml::TaskRunnerAffineWeakPtrFactory<ImageDecoder> weak_factory_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ImageDecoder);
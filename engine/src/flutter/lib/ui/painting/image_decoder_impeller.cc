@@ -11,10 +11,12 @@
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/mapping.h"
 #include "flutter/fml/trace_event.h"
+#include "flutter/fml/trace_recorder.h"
 #include "flutter/impeller/core/allocator.h"
 #include "flutter/impeller/display_list/dl_image_impeller.h"
 #include "flutter/impeller/renderer/command_buffer.h"
 #include "flutter/impeller/renderer/context.h"
+#include "flutter/lib/ui/painting/texture_compressor.h"
 #include "impeller/core/device_buffer.h"
 #include "impeller/core/formats.h"
 #include "impeller/core/texture_descriptor.h"
@@ -160,11 +162,12 @@ absl::StatusOr<DecodedBitmap> DecodeToBitmap(
     ImageDescriptor* descriptor,
     const SkImageInfo& image_info,
     const SkImageInfo& base_image_info,
-    const std::shared_ptr<impeller::Allocator>& allocator) {
+    const std::shared_ptr<impeller::Allocator>& allocator,
+    bool prefer_host_mapped) {
   std::shared_ptr<SkBitmap> bitmap = std::make_shared<SkBitmap>();
   bitmap->setInfo(image_info);
   std::shared_ptr<ImpellerAllocator> bitmap_allocator =
-      std::make_shared<ImpellerAllocator>(allocator);
+      std::make_shared<ImpellerAllocator>(allocator, prefer_host_mapped);
 
   if (descriptor->is_compressed()) {
     if (!bitmap->tryAllocPixels(bitmap_allocator.get())) {
@@ -200,14 +203,15 @@ absl::StatusOr<DecodedBitmap> DecodeToBitmap(
 absl::StatusOr<DecodedBitmap> HandlePremultiplication(
     const std::shared_ptr<SkBitmap>& bitmap,
     std::shared_ptr<ImpellerAllocator> bitmap_allocator,
-    const std::shared_ptr<impeller::Allocator>& allocator) {
+    const std::shared_ptr<impeller::Allocator>& allocator,
+    bool prefer_host_mapped) {
   if (bitmap->alphaType() != SkAlphaType::kUnpremul_SkAlphaType) {
     return DecodedBitmap{.bitmap = bitmap,
                          .allocator = std::move(bitmap_allocator)};
   }
 
   std::shared_ptr<ImpellerAllocator> premul_allocator =
-      std::make_shared<ImpellerAllocator>(allocator);
+      std::make_shared<ImpellerAllocator>(allocator, prefer_host_mapped);
   std::shared_ptr<SkBitmap> premul_bitmap = std::make_shared<SkBitmap>();
   premul_bitmap->setInfo(bitmap->info().makeAlphaType(kPremul_SkAlphaType));
   if (!premul_bitmap->tryAllocPixels(premul_allocator.get())) {
@@ -263,6 +267,175 @@ absl::StatusOr<ImageDecoderImpeller::DecompressResult> ResizeOnCpu(
       .image_info = decoded_image_info.value()};
 }
 
+std::optional<TextureCompression> ChooseTextureCompression(
+    const impeller::Capabilities& capabilities) {
+  // BC7 keeps more of the quality of the image where it is supported.
+  if (capabilities.SupportsCompressedFormat(
+          impeller::PixelFormat::kBC7UNormInt)) {
+    return TextureCompression::kBC7;
+  }
+  if (capabilities.SupportsCompressedFormat(
+          impeller::PixelFormat::kETC2R8G8B8A8UNormInt)) {
+    return TextureCompression::kETC2RGBA8;
+  }
+  return std::nullopt;
+}
+
+impeller::PixelFormat ToImpellerPixelFormat(TextureCompression compression) {
+  switch (compression) {
+    case TextureCompression::kETC2RGBA8:
+      return impeller::PixelFormat::kETC2R8G8B8A8UNormInt;
+    case TextureCompression::kBC7:
+      return impeller::PixelFormat::kBC7UNormInt;
+  }
+  FML_UNREACHABLE();
+}
+
+absl::StatusOr<ImageDecoderImpeller::DecompressResult> CompressOnCpu(
+    const std::shared_ptr<SkBitmap>& bitmap,
+    const SkISize& target_size,
+    TextureCompression compression,
+    const std::shared_ptr<impeller::Allocator>& allocator) {
+  TRACE_EVENT0("impeller", "CompressOnCpu");
+  // The encoders read 8-bit pixels at the final size, as the compressed
+  // texture can't be resized or converted on the GPU.
+  SkPixmap pixmap = bitmap->pixmap();
+  SkBitmap converted;
+  if (pixmap.dimensions() != target_size ||
+      (pixmap.colorType() != kRGBA_8888_SkColorType &&
+       pixmap.colorType() != kBGRA_8888_SkColorType)) {
+    if (!converted.tryAllocPixels(bitmap->info()
+                                      .makeDimensions(target_size)
+                                      .makeColorType(kN32_SkColorType))) {
+      std::string error = "Could not allocate intermediate for compression.";
+      FML_DLOG(ERROR) << error;
+      return absl::ResourceExhaustedError(error);
+    }
+    if (!pixmap.scalePixels(
+            converted.pixmap(),
+            SkSamplingOptions(SkFilterMode::kLinear, SkMipmapMode::kNone))) {
+      return absl::InternalError("Could not scale decoded bitmap data.");
+    }
+    pixmap = converted.pixmap();
+  }
+
+  impeller::DeviceBufferDescriptor desc;
+  desc.storage_mode = impeller::StorageMode::kHostVisible;
+  desc.size = GetCompressedImageSize(pixmap.width(), pixmap.height());
+  std::shared_ptr<impeller::DeviceBuffer> buffer =
+      allocator->CreateBuffer(desc);
+  if (!buffer) {
+    return absl::ResourceExhaustedError(
+        "Could not create buffer for compressed image.");
+  }
+  CompressImage(compression, static_cast<const uint8_t*>(pixmap.addr()),
+                pixmap.rowBytes(), pixmap.width(), pixmap.height(),
+                /*bgra=*/pixmap.colorType() == kBGRA_8888_SkColorType,
+                buffer->OnGetContents());
+  buffer->Flush();
+
+  return ImageDecoderImpeller::DecompressResult{
+      .device_buffer = std::move(buffer),
+      .image_info = {
+          .size = impeller::ISize(pixmap.width(), pixmap.height()),
+          .format = ToImpellerPixelFormat(compression),
+      }};
+}
+
+absl::StatusOr<ImageDecoderImpeller::DecompressResult> DecompressRegion(
+    ImageDescriptor* descriptor,
+    const ImageDecoder::Options& options,
+    impeller::ISize max_texture_size,
+    bool supports_wide_gamut,
+    const std::shared_ptr<impeller::Allocator>& allocator) {
+  TRACE_EVENT0("impeller", "DecompressRegion");
+  const SkISize source_size = SkISize::Make(descriptor->image_info().width,
+                                            descriptor->image_info().height);
+  const SkISize target_size =
+      SkISize::Make(options.target_width, options.target_height);
+  const SkIRect& region = options.region.value();
+  if (region.isEmpty() || !SkIRect::MakeSize(target_size).contains(region)) {
+    return absl::InvalidArgumentError("Invalid image region.");
+  }
+
+  // The region is decoded from the closest size the codec can decode to, and
+  // then resized to the size it has in the target.
+  SkISize decode_size = source_size;
+  if (descriptor->is_compressed()) {
+    decode_size = descriptor->get_scaled_dimensions(std::max(
+        static_cast<float>(target_size.width()) / source_size.width(),
+        static_cast<float>(target_size.height()) / source_size.height()));
+  }
+  const SkIRect decode_region =
+      ImageDescriptor::MapRegion(region, target_size, decode_size);
+  if (decode_region.isEmpty()) {
+    return absl::InvalidArgumentError("Invalid image region.");
+  }
+
+  const SkImageInfo base_image_info =
+      ImageDescriptor::ToSkImageInfo(descriptor->image_info());
+  const absl::StatusOr<SkImageInfo> image_info =
+      CreateImageInfo(base_image_info, decode_region.size(),
+                      supports_wide_gamut, options.target_format);
+  if (!image_info.ok()) {
+    return image_info.status();
+  }
+  if (!ImageDecoderImpeller::ToPixelFormat(image_info.value().colorType())
+           .has_value()) {
+    std::string decode_error =
+        std::format("Codec pixel format is not supported (SkColorType={})",
+                    static_cast<int>(image_info.value().colorType()));
+    FML_DLOG(ERROR) << decode_error;
+    return absl::InvalidArgumentError(decode_error);
+  }
+
+  std::shared_ptr<SkBitmap> bitmap = std::make_shared<SkBitmap>();
+  std::shared_ptr<ImpellerAllocator> bitmap_allocator =
+      std::make_shared<ImpellerAllocator>(allocator);
+  bitmap->setInfo(image_info.value());
+  if (!bitmap->tryAllocPixels(bitmap_allocator.get())) {
+    std::string error = "Could not allocate intermediate for image region.";
+    FML_DLOG(ERROR) << error;
+    return absl::ResourceExhaustedError(error);
+  }
+  if (!descriptor->get_pixels_in_region(bitmap->pixmap(), decode_size,
+                                        decode_region)) {
+    std::string error = "Could not decompress image region.";
+    FML_DLOG(ERROR) << error;
+    return absl::InvalidArgumentError(error);
+  }
+
+  absl::StatusOr<DecodedBitmap> premultiplied = HandlePremultiplication(
+      bitmap, bitmap_allocator, allocator, /*prefer_host_mapped=*/false);
+  if (!premultiplied.ok()) {
+    return premultiplied.status();
+  }
+
+  const SkISize output_size = SkISize::Make(
+      std::min(max_texture_size.width, static_cast<int64_t>(region.width())),
+      std::min(max_texture_size.height,
+               static_cast<int64_t>(region.height())));
+  if (premultiplied->bitmap->dimensions() != output_size) {
+    return ResizeOnCpu(premultiplied->bitmap, output_size, allocator);
+  }
+
+  std::shared_ptr<impeller::DeviceBuffer> buffer =
+      premultiplied->allocator->GetDeviceBuffer();
+  if (!buffer) {
+    return absl::InternalError("Unable to get device buffer");
+  }
+  buffer->Flush();
+
+  absl::StatusOr<ImageDecoderImpeller::ImageInfo> decoded_image_info =
+      ToImageInfo(premultiplied->bitmap->info());
+  if (!decoded_image_info.ok()) {
+    return decoded_image_info.status();
+  }
+  return ImageDecoderImpeller::DecompressResult{
+      .device_buffer = std::move(buffer),
+      .image_info = decoded_image_info.value()};
+}
+
 bool IsZeroOpConversion(ImageDescriptor::PixelFormat input,
                         ImageDecoder::TargetPixelFormat output) {
   switch (input) {
@@ -335,13 +508,34 @@ ImageDecoderImpeller::DecompressTexture(
     bool supports_wide_gamut,
     const std::shared_ptr<const impeller::Capabilities>& capabilities,
     const std::shared_ptr<impeller::Allocator>& allocator) {
-  TRACE_EVENT0("impeller", __FUNCTION__);
+  FML_RECORDED_TRACE_EVENT0("impeller", __FUNCTION__);
   if (!descriptor) {
     std::string decode_error("Invalid descriptor (should never happen)");
     FML_DLOG(ERROR) << decode_error;
     return absl::InvalidArgumentError(decode_error);
   }
 
+  // Images that are compressed are decoded like the images whose format the
+  // engine picks, and compressed once they have their final size. They are
+  // left uncompressed if the backend supports no compressed format, and so
+  // are regions of images.
+  ImageDecoder::Options decode_options = options;
+  std::optional<TextureCompression> compression;
+  if (options.target_format == ImageDecoder::TargetPixelFormat::kCompressed) {
+    decode_options.target_format = ImageDecoder::TargetPixelFormat::kDontCare;
+    if (!options.region.has_value()) {
+      compression = ChooseTextureCompression(*capabilities);
+    }
+  }
+  if (compression.has_value()) {
+    supports_wide_gamut = false;
+  }
+
+  if (options.region.has_value()) {
+    return DecompressRegion(descriptor, decode_options, max_texture_size,
+                            supports_wide_gamut, allocator);
+  }
+
   const SkISize source_size = SkISize::Make(descriptor->image_info().width,
                                             descriptor->image_info().height);
   const SkISize target_size =
@@ -353,7 +547,7 @@ ImageDecoderImpeller::DecompressTexture(
   // Fast path for when the input requires no decompressing or conversion.
   if (!descriptor->is_compressed() && source_size == target_size &&
       IsZeroOpConversion(descriptor->image_info().format,
-                         options.target_format)) {
+                         decode_options.target_format)) {
     impeller::DeviceBufferDescriptor desc;
     desc.storage_mode = impeller::StorageMode::kHostVisible;
     desc.size = descriptor->data()->size();
@@ -372,7 +566,7 @@ ImageDecoderImpeller::DecompressTexture(
             {
                 .size =
                     impeller::ISize(source_size.width(), source_size.height()),
-                .format = ToImpellerPixelFormat(options.target_format),
+                .format = ToImpellerPixelFormat(decode_options.target_format),
             },
     };
   }
@@ -386,8 +580,9 @@ ImageDecoderImpeller::DecompressTexture(
 
   const SkImageInfo base_image_info =
       ImageDescriptor::ToSkImageInfo(descriptor->image_info());
-  const absl::StatusOr<SkImageInfo> image_info = CreateImageInfo(
-      base_image_info, decode_size, supports_wide_gamut, options.target_format);
+  const absl::StatusOr<SkImageInfo> image_info =
+      CreateImageInfo(base_image_info, decode_size, supports_wide_gamut,
+                      decode_options.target_format);
 
   if (!image_info.ok()) {
     return image_info.status();
@@ -401,14 +596,27 @@ ImageDecoderImpeller::DecompressTexture(
     return absl::InvalidArgumentError(decode_error);
   }
 
+  // When the decoded image needs no resizing, its final pixels may be written
+  // straight into a texture the GPU can sample, which avoids the staging
+  // buffer and the blit. Such textures have no mipmaps, like the frames of
+  // animated images. Only the last bitmap in the chain is placed in one.
+  const bool prefer_host_mapped =
+      !compression.has_value() && decode_size == target_size &&
+      source_size.width() <= max_texture_size.width &&
+      source_size.height() <= max_texture_size.height;
+  const bool needs_premultiplication =
+      image_info.value().alphaType() == SkAlphaType::kUnpremul_SkAlphaType;
+
   absl::StatusOr<DecodedBitmap> decoded = DecodeToBitmap(
-      descriptor, image_info.value(), base_image_info, allocator);
+      descriptor, image_info.value(), base_image_info, allocator,
+      /*prefer_host_mapped=*/prefer_host_mapped && !needs_premultiplication);
   if (!decoded.ok()) {
     return decoded.status();
   }
 
-  absl::StatusOr<DecodedBitmap> premultiplied =
-      HandlePremultiplication(decoded->bitmap, decoded->allocator, allocator);
+  absl::StatusOr<DecodedBitmap> premultiplied = HandlePremultiplication(
+      decoded->bitmap, decoded->allocator, allocator,
+      /*prefer_host_mapped=*/prefer_host_mapped && needs_premultiplication);
   if (!premultiplied.ok()) {
     return premultiplied.status();
   }
@@ -416,6 +624,26 @@ ImageDecoderImpeller::DecompressTexture(
   std::shared_ptr<ImpellerAllocator> bitmap_allocator =
       premultiplied->allocator;
 
+  if (std::optional<impeller::HostMappedTexture>& host_mapped_texture =
+          bitmap_allocator->GetHostMappedTexture();
+      host_mapped_texture.has_value()) {
+    if (!host_mapped_texture->unmap()) {
+      return absl::InternalError("Unable to unmap decoded image texture");
+    }
+    absl::StatusOr<ImageDecoderImpeller::ImageInfo> decoded_image_info =
+        ToImageInfo(bitmap->info());
+    if (!decoded_image_info.ok()) {
+      return decoded_image_info.status();
+    }
+    return ImageDecoderImpeller::DecompressResult{
+        .image_info = decoded_image_info.value(),
+        .texture = std::move(host_mapped_texture->texture)};
+  }
+
+  if (compression.has_value()) {
+    return CompressOnCpu(bitmap, target_size, compression.value(), allocator);
+  }
+
   if (source_size.width() > max_texture_size.width ||
       source_size.height() > max_texture_size.height ||
       !capabilities->SupportsTextureToTextureBlits()) {
@@ -459,6 +687,10 @@ ImageDecoderImpeller::UnsafeUploadTextureToPrivate(
   texture_descriptor.format = image_info.format;
   texture_descriptor.size = {image_info.size.width, image_info.size.height};
   texture_descriptor.mip_count = texture_descriptor.size.MipCount();
+  if (impeller::IsBlockCompressed(image_info.format)) {
+    // Mipmaps can't be generated for compressed textures on the GPU.
+    texture_descriptor.mip_count = 1;
+  }
   if (context->GetBackendType() == impeller::Context::BackendType::kMetal &&
       resize_info.has_value()) {
     // The MPS used to resize images on iOS does not require mip generation.
@@ -607,6 +839,117 @@ void ImageDecoderImpeller::UploadTextureToPrivate(
           }));
 }
 
+// static
+std::pair<sk_sp<DlImage>, std::string>
+ImageDecoderImpeller::UnsafeConvertTextureToShaderRead(
+    const std::shared_ptr<impeller::Context>& context,
+    const std::shared_ptr<impeller::Texture>& texture) {
+  texture->SetLabel(
+      std::format("ui.Image({})", static_cast<const void*>(texture.get()))
+          .c_str());
+
+  // Only Vulkan tracks the layouts of textures.
+  if (context->GetBackendType() != impeller::Context::BackendType::kVulkan) {
+    return std::make_pair(impeller::DlImageImpeller::Make(texture),
+                          std::string());
+  }
+
+  // Creating the command buffer creates the resources of this thread.
+  fml::ScopedCleanupClosure dispose_thread_local_resources(
+      [context]() { context->DisposeThreadLocalCachedResources(); });
+  auto command_buffer = context->CreateCommandBuffer();
+  if (!command_buffer) {
+    std::string decode_error(
+        "Could not create command buffer for layout transition.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  command_buffer->SetLabel("Layout Transition Command Buffer");
+
+  auto blit_pass = command_buffer->CreateBlitPass();
+  if (!blit_pass) {
+    std::string decode_error(
+        "Could not create blit pass for layout transition.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  blit_pass->SetLabel("Layout Transition Blit Pass");
+  if (!blit_pass->ConvertTextureToShaderRead(texture) ||
+      !blit_pass->EncodeCommands()) {
+    std::string decode_error("Could not encode layout transition.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  if (!context->GetCommandQueue()
+           ->Submit(
+               {command_buffer},
+               [](impeller::CommandBuffer::Status status) {
+                 if (status == impeller::CommandBuffer::Status::kError) {
+                   FML_LOG(ERROR)
+                       << "GPU Error submitting image layout command buffer.";
+                 }
+               },
+               /*block_on_schedule=*/true)
+           .ok()) {
+    std::string decode_error("Failed to submit image layout command buffer.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+
+  // Flush the pending command buffer to ensure that its output becomes visible
+  // to the raster thread.
+  if (context->AddTrackingFence(texture)) {
+    command_buffer->WaitUntilScheduled();
+  } else {
+    command_buffer->WaitUntilCompleted();
+  }
+
+  return std::make_pair(impeller::DlImageImpeller::Make(texture),
+                        std::string());
+}
+
+void ImageDecoderImpeller::ConvertTextureToShaderRead(
+    ImageResult result,
+    const std::shared_ptr<impeller::Context>& context,
+    const std::shared_ptr<impeller::Texture>& texture,
+    const std::shared_ptr<const fml::SyncSwitch>& gpu_disabled_switch) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  if (!context) {
+    result(nullptr, "No Impeller context is available");
+    return;
+  }
+  if (!texture) {
+    result(nullptr, "No Impeller texture is available");
+    return;
+  }
+
+  gpu_disabled_switch->Execute(
+      fml::SyncSwitch::Handlers()
+          .SetIfFalse([&result, context, texture] {
+            sk_sp<DlImage> image;
+            std::string decode_error;
+            std::tie(image, decode_error) =
+                UnsafeConvertTextureToShaderRead(context, texture);
+            result(image, decode_error);
+          })
+          .SetIfTrue([&result, context, texture] {
+            auto result_ptr = std::make_shared<ImageResult>(std::move(result));
+            context->StoreTaskForGPU(
+                [result_ptr, context, texture]() {
+                  sk_sp<DlImage> image;
+                  std::string decode_error;
+                  std::tie(image, decode_error) =
+                      UnsafeConvertTextureToShaderRead(context, texture);
+                  (*result_ptr)(image, decode_error);
+                },
+                [result_ptr]() {
+                  (*result_ptr)(
+                      nullptr,
+                      "Image upload failed due to loss of GPU access.");
+                });
+          }));
+}
+
 std::pair<sk_sp<DlImage>, std::string>
 ImageDecoderImpeller::UploadTextureToStorage(
     const std::shared_ptr<impeller::Context>& context,
@@ -664,12 +1007,41 @@ ImageDecoderImpeller::UploadTextureToStorage(
                         std::string());
 }
 
+std::shared_ptr<impeller::Texture>
+ImageDecoderImpeller::DecodeToPlatformTexture(
+    ImageDescriptor* descriptor,
+    const ImageDecoder::Options& options,
+    impeller::ISize max_texture_size,
+    bool supports_wide_gamut,
+    const std::shared_ptr<impeller::Context>& context) {
+  // Images asked to be compressed are left to the generators too: the KTX2
+  // generator decodes to compressed textures, and the textures the platform
+  // decoders decode to are kept as they are.
+  if (!descriptor->is_compressed() || options.region.has_value() ||
+      (options.target_format != ImageDecoder::TargetPixelFormat::kDontCare &&
+       options.target_format != ImageDecoder::TargetPixelFormat::kCompressed) ||
+      (supports_wide_gamut &&
+       IsWideGamut(descriptor->image_info().color_space.get()))) {
+    return nullptr;
+  }
+  const SkISize target_size =
+      SkISize::Make(std::min(max_texture_size.width,
+                             static_cast<int64_t>(options.target_width)),
+                    std::min(max_texture_size.height,
+                             static_cast<int64_t>(options.target_height)));
+  if (target_size.isEmpty()) {
+    return nullptr;
+  }
+  return descriptor->get_texture(target_size, context);
+}
+
 // |ImageDecoder|
 void ImageDecoderImpeller::Decode(fml::RefPtr<ImageDescriptor> descriptor,
-                                  const ImageDecoder::Options& options,
+                                  const ImageDecoder::Options& p_options,
                                   const ImageResult& p_result) {
   FML_DCHECK(descriptor);
   FML_DCHECK(p_result);
+  const ImageDecoder::Options options = GetEffectiveOptions(p_options);
 
   // Wrap the result callback so that it can be invoked from any thread.
   auto raw_descriptor = descriptor.get();
@@ -684,7 +1056,8 @@ void ImageDecoderImpeller::Decode(fml::RefPtr<ImageDescriptor> descriptor,
     });
   };
 
-  concurrent_task_runner_->PostTask(
+  ScheduleDecode(
+      *raw_descriptor, options,
       [raw_descriptor,            //
        context = context_.get(),  //
        options,
@@ -706,17 +1079,35 @@ void ImageDecoderImpeller::Decode(fml::RefPtr<ImageDescriptor> descriptor,
         auto max_size_supported =
             context->GetResourceAllocator()->GetMaxTextureSizeSupported();
 
+        const bool supports_wide_gamut =
+            wide_gamut_enabled &&
+            context->GetCapabilities()->SupportsExtendedRangeFormats();
+
         // Always decompress on the concurrent runner.
-        auto bitmap_result = DecompressTexture(
-            raw_descriptor, options, max_size_supported,
-            /*supports_wide_gamut=*/wide_gamut_enabled &&
-                context->GetCapabilities()->SupportsExtendedRangeFormats(),
-            context->GetCapabilities(), context->GetResourceAllocator());
+        absl::StatusOr<DecompressResult> bitmap_result;
+        if (std::shared_ptr<impeller::Texture> texture =
+                DecodeToPlatformTexture(raw_descriptor, options,
+                                        max_size_supported,
+                                        supports_wide_gamut, context)) {
+          bitmap_result = DecompressResult{.texture = std::move(texture)};
+        } else {
+          bitmap_result = DecompressTexture(
+              raw_descriptor, options, max_size_supported, supports_wide_gamut,
+              context->GetCapabilities(), context->GetResourceAllocator());
+        }
         if (!bitmap_result.ok()) {
           result(nullptr, std::string(bitmap_result.status().message()));
           return;
         }
 
+        // Textures the image was decoded straight into need no upload, but
+        // may still need their layout changed before they are sampled.
+        if (bitmap_result->texture) {
+          ConvertTextureToShaderRead(result, context, bitmap_result->texture,
+                                     gpu_disabled_switch);
+          return;
+        }
+
         auto upload_texture_and_invoke_result = [result, context, bitmap_result,
                                                  gpu_disabled_switch]() {
           UploadTextureToPrivate(result, context,               //
@@ -733,18 +1124,28 @@ void ImageDecoderImpeller::Decode(fml::RefPtr<ImageDescriptor> descriptor,
         } else {
           upload_texture_and_invoke_result();
         }
+      },
+      [result]() {
+        result(nullptr, "The codec was disposed before the image was decoded.");
       });
 }
 
 ImpellerAllocator::ImpellerAllocator(
-    std::shared_ptr<impeller::Allocator> allocator)
-    : allocator_(std::move(allocator)) {}
+    std::shared_ptr<impeller::Allocator> allocator,
+    bool prefer_host_mapped)
+    : allocator_(std::move(allocator)),
+      prefer_host_mapped_(prefer_host_mapped) {}
 
 std::shared_ptr<impeller::DeviceBuffer> ImpellerAllocator::GetDeviceBuffer()
     const {
   return buffer_;
 }
 
+std::optional<impeller::HostMappedTexture>&
+ImpellerAllocator::GetHostMappedTexture() {
+  return host_mapped_texture_;
+}
+
 bool ImpellerAllocator::allocPixelRef(SkBitmap* bitmap) {
   if (!bitmap) {
     return false;
@@ -755,6 +1156,40 @@ bool ImpellerAllocator::allocPixelRef(SkBitmap* bitmap) {
     return false;
   }
 
+  struct ImpellerPixelRef final : public SkPixelRef {
+    ImpellerPixelRef(int w, int h, void* s, size_t r)
+        : SkPixelRef(w, h, s, r) {}
+
+    ~ImpellerPixelRef() override {}
+  };
+
+  if (prefer_host_mapped_) {
+    std::optional<impeller::PixelFormat> format =
+        ImageDecoderImpeller::ToPixelFormat(info.colorType());
+    if (format.has_value()) {
+      impeller::TextureDescriptor texture_descriptor;
+      texture_descriptor.storage_mode = impeller::StorageMode::kHostVisible;
+      texture_descriptor.format = format.value();
+      texture_descriptor.size = {info.width(), info.height()};
+      texture_descriptor.mip_count = 1;
+      std::optional<impeller::HostMappedTexture> texture =
+          allocator_->CreateHostMappedTexture(texture_descriptor);
+      if (texture.has_value() &&
+          texture->bytes_per_row >= info.minRowBytes()) {
+        bitmap->setPixelRef(
+            sk_sp<SkPixelRef>(new ImpellerPixelRef(info.width(), info.height(),
+                                                   texture->contents,
+                                                   texture->bytes_per_row)),
+            0, 0);
+        host_mapped_texture_ = std::move(texture);
+        return true;
+      }
+      if (texture.has_value()) {
+        texture->unmap();
+      }
+    }
+  }
+
   impeller::DeviceBufferDescriptor descriptor;
   descriptor.storage_mode = impeller::StorageMode::kHostVisible;
   descriptor.size = ((bitmap->height() - 1) * bitmap->rowBytes()) +
@@ -766,13 +1201,6 @@ bool ImpellerAllocator::allocPixelRef(SkBitmap* bitmap) {
     return false;
   }
 
-  struct ImpellerPixelRef final : public SkPixelRef {
-    ImpellerPixelRef(int w, int h, void* s, size_t r)
-        : SkPixelRef(w, h, s, r) {}
-
-    ~ImpellerPixelRef() override {}
-  };
-
   auto pixel_ref = sk_sp<SkPixelRef>(
       new ImpellerPixelRef(info.width(), info.height(),
                            device_buffer->OnGetContents(), bitmap->rowBytes()));
@@ -9,6 +9,7 @@
 
 #include "flutter/fml/macros.h"
 #include "flutter/lib/ui/painting/image_decoder.h"
+#include "impeller/core/allocator.h"
 #include "impeller/core/formats.h"
 #include "impeller/geometry/size.h"
 #include "impeller/renderer/capabilities.h"
@@ -18,7 +19,6 @@
 
 namespace impeller {
 class Context;
-class Allocator;
 class DeviceBuffer;
 }  // namespace impeller
 
@@ -26,7 +26,13 @@ namespace flutter {
 
 class ImpellerAllocator : public SkBitmap::Allocator {
  public:
-  explicit ImpellerAllocator(std::shared_ptr<impeller::Allocator> allocator);
+  /// @param allocator           The allocator of the Impeller context.
+  /// @param prefer_host_mapped  Whether pixels should be decoded straight into
+  ///                            a host mapped texture when the backend
+  ///                            supports it. Falls back to a device buffer
+  ///                            otherwise.
+  explicit ImpellerAllocator(std::shared_ptr<impeller::Allocator> allocator,
+                             bool prefer_host_mapped = false);
 
   ~ImpellerAllocator() = default;
 
@@ -35,9 +41,15 @@ class ImpellerAllocator : public SkBitmap::Allocator {
 
   std::shared_ptr<impeller::DeviceBuffer> GetDeviceBuffer() const;
 
+  /// The texture the pixels were allocated in, if a host mapped texture was
+  /// used instead of a device buffer.
+  std::optional<impeller::HostMappedTexture>& GetHostMappedTexture();
+
  private:
   std::shared_ptr<impeller::Allocator> allocator_;
+  const bool prefer_host_mapped_;
   std::shared_ptr<impeller::DeviceBuffer> buffer_;
+  std::optional<impeller::HostMappedTexture> host_mapped_texture_;
 };
 
 class ImageDecoderImpeller final : public ImageDecoder {
@@ -67,6 +79,9 @@ class ImageDecoderImpeller final : public ImageDecoder {
     std::shared_ptr<impeller::DeviceBuffer> device_buffer;
     ImageInfo image_info;
     std::optional<SkImageInfo> resize_info;
+    /// Set instead of |device_buffer| when the image was decoded directly
+    /// into a texture that is ready to be sampled.
+    std::shared_ptr<impeller::Texture> texture;
   };
 
   static absl::StatusOr<DecompressResult> DecompressTexture(
@@ -77,6 +92,20 @@ class ImageDecoderImpeller final : public ImageDecoder {
       const std::shared_ptr<const impeller::Capabilities>& capabilities,
       const std::shared_ptr<impeller::Allocator>& allocator);
 
+  /// @brief Decodes the image straight into a texture with the platform
+  ///        decoder of its generator, if it has one that can, see
+  ///        `ImageGenerator::GetTexture`. Returns null for the images that
+  ///        are decoded with `DecompressTexture`: those of regions, of a
+  ///        target format other than the default, and of wide gamut images
+  ///        when wide gamut is supported, which platform decoders don't
+  ///        decode to.
+  static std::shared_ptr<impeller::Texture> DecodeToPlatformTexture(
+      ImageDescriptor* descriptor,
+      const ImageDecoder::Options& options,
+      impeller::ISize max_texture_size,
+      bool supports_wide_gamut,
+      const std::shared_ptr<impeller::Context>& context);
+
   /// @brief Create a device private texture from the provided host buffer.
   ///
   /// @param result     The image result closure that accepts the DlImage and
@@ -94,6 +123,21 @@ class ImageDecoderImpeller final : public ImageDecoder {
       const std::optional<SkImageInfo>& resize_info,
       const std::shared_ptr<const fml::SyncSwitch>& gpu_disabled_switch);
 
+  /// @brief Make a texture the image was decoded straight into, by
+  ///        `DecodeToPlatformTexture` or into a host mapped texture, ready to
+  ///        be sampled.
+  ///
+  /// @param result     The image result closure that accepts the DlImage and
+  ///                   any encoding error messages.
+  /// @param context    The Impeller graphics context.
+  /// @param texture    The texture holding the decoded image.
+  /// @param gpu_disabled_switch Whether the GPU is available command encoding.
+  static void ConvertTextureToShaderRead(
+      ImageResult result,
+      const std::shared_ptr<impeller::Context>& context,
+      const std::shared_ptr<impeller::Texture>& texture,
+      const std::shared_ptr<const fml::SyncSwitch>& gpu_disabled_switch);
+
   /// @brief Create a texture from the provided bitmap.
   /// @param context     The Impeller graphics context.
   /// @param bitmap      A bitmap containg the image to be uploaded.
@@ -118,6 +162,12 @@ class ImageDecoderImpeller final : public ImageDecoder {
       const ImageInfo& image_info,
       const std::optional<SkImageInfo>& resize_info);
 
+  /// Only call this method if the GPU is available.
+  static std::pair<sk_sp<DlImage>, std::string>
+  UnsafeConvertTextureToShaderRead(
+      const std::shared_ptr<impeller::Context>& context,
+      const std::shared_ptr<impeller::Texture>& texture);
+
   FML_DISALLOW_COPY_AND_ASSIGN(ImageDecoderImpeller);
 };
 
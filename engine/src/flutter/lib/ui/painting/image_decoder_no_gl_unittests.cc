@@ -51,6 +51,52 @@ bool IsPngWithPLTE(const uint8_t* bytes, size_t size) {
   return false;
 }
 
+// A generator whose platform decoder decodes straight into textures.
+class PlatformTextureImageGenerator : public ImageGenerator {
+ public:
+  explicit PlatformTextureImageGenerator(SkISize size)
+      : info_(SkImageInfo::MakeN32Premul(size.width(), size.height())) {}
+
+  const SkImageInfo& GetInfo() override { return info_; }
+
+  unsigned int GetFrameCount() const override { return 1; }
+
+  unsigned int GetPlayCount() const override { return 1; }
+
+  const ImageGenerator::FrameInfo GetFrameInfo(
+      unsigned int frame_index) override {
+    return {std::nullopt, 0, SkCodecAnimation::DisposalMethod::kKeep};
+  }
+
+  SkISize GetScaledDimensions(float scale) override {
+    return info_.dimensions();
+  }
+
+  bool GetPixels(const SkImageInfo& info,
+                 void* pixels,
+                 size_t row_bytes,
+                 unsigned int frame_index,
+                 std::optional<unsigned int> prior_frame) override {
+    return false;
+  }
+
+  std::shared_ptr<impeller::Texture> GetTexture(
+      const SkISize& size,
+      const std::shared_ptr<impeller::Context>& context) override {
+    requested_size_ = size;
+    impeller::TextureDescriptor desc;
+    desc.format = impeller::PixelFormat::kR8G8B8A8UNormInt;
+    desc.size = {size.width(), size.height()};
+    return std::make_shared<impeller::TestImpellerTexture>(desc);
+  }
+
+  std::optional<SkISize> requested_size() const { return requested_size_; }
+
+ private:
+  const SkImageInfo info_;
+  std::optional<SkISize> requested_size_;
+};
+
 }  // namespace
 
 float HalfToFloat(uint16_t half) {
@@ -371,5 +417,91 @@ TEST(ImageDecoderNoGLTest, ImpellerUnmultipliedAlphaPng) {
 #endif  // IMPELLER_SUPPORTS_RENDERING
 }
 
+TEST(ImageDecoderNoGLTest, ImpellerDecodesIntoHostMappedTexture) {
+#if defined(OS_FUCHSIA)
+  GTEST_SKIP() << "Fuchsia can't load the test fixtures.";
+#endif
+  SkCodecs::Register(SkPngDecoder::Decoder());
+  auto data = flutter::testing::OpenFixtureAsSkData("unmultiplied_alpha.png");
+  std::shared_ptr<impeller::Capabilities> capabilities =
+      impeller::CapabilitiesBuilder()
+          .SetSupportsTextureToTextureBlits(true)
+          .Build();
+
+  ImageGeneratorRegistry registry;
+  std::shared_ptr<ImageGenerator> generator =
+      registry.CreateCompatibleGenerator(data);
+  ASSERT_TRUE(generator);
+
+  auto descriptor = fml::MakeRefCounted<ImageDescriptor>(std::move(data),
+                                                         std::move(generator));
+
+#if IMPELLER_SUPPORTS_RENDERING
+  std::shared_ptr<impeller::TestImpellerAllocator> allocator =
+      std::make_shared<impeller::TestImpellerAllocator>(
+          /*supports_host_mapped_textures=*/true);
+  absl::StatusOr<ImageDecoderImpeller::DecompressResult> result =
+      ImageDecoderImpeller::DecompressTexture(
+          descriptor.get(), {.target_width = 11, .target_height = 11}, {11, 11},
+          /*supports_wide_gamut=*/true, capabilities, allocator);
+  ASSERT_TRUE(result.ok());
+  ASSERT_TRUE(result->texture);
+  EXPECT_FALSE(result->device_buffer);
+  EXPECT_TRUE(allocator->IsHostMappedTextureUnmapped());
+
+  // The premultiplied pixels are written straight into the texture.
+  const uint32_t* pixel_ptr = reinterpret_cast<const uint32_t*>(
+      allocator->GetHostMappedContents().data());
+  ASSERT_EQ(*pixel_ptr, (uint32_t)0x1000001);
+  ASSERT_EQ(*(pixel_ptr + 11 * 4 + 4), (uint32_t)0xFF00FF00);
+
+  // Images that still need resizing are uploaded from a device buffer.
+  absl::StatusOr<ImageDecoderImpeller::DecompressResult> resized =
+      ImageDecoderImpeller::DecompressTexture(
+          descriptor.get(), {.target_width = 5, .target_height = 5}, {11, 11},
+          /*supports_wide_gamut=*/true, capabilities, allocator);
+  ASSERT_TRUE(resized.ok());
+  EXPECT_FALSE(resized->texture);
+  EXPECT_TRUE(resized->device_buffer);
+#endif  // IMPELLER_SUPPORTS_RENDERING
+}
+
+TEST(ImageDecoderNoGLTest, ImpellerDecodesWithPlatformDecoder) {
+  auto generator =
+      std::make_shared<PlatformTextureImageGenerator>(SkISize::Make(100, 50));
+  auto descriptor =
+      fml::MakeRefCounted<ImageDescriptor>(SkData::MakeEmpty(), generator);
+
+#if IMPELLER_SUPPORTS_RENDERING
+  // The texture is decoded at the target size, within the max texture size.
+  std::shared_ptr<impeller::Texture> texture =
+      ImageDecoderImpeller::DecodeToPlatformTexture(
+          descriptor.get(), {.target_width = 40, .target_height = 20},
+          {32, 32}, /*supports_wide_gamut=*/false, /*context=*/nullptr);
+  ASSERT_TRUE(texture);
+  EXPECT_EQ(texture->GetSize(), impeller::ISize(32, 20));
+  EXPECT_EQ(generator->requested_size(), SkISize::Make(32, 20));
+
+  // sRGB images are decoded by the platform even if wide gamut is supported.
+  EXPECT_TRUE(ImageDecoderImpeller::DecodeToPlatformTexture(
+      descriptor.get(), {.target_width = 40, .target_height = 20}, {64, 64},
+      /*supports_wide_gamut=*/true, /*context=*/nullptr));
+
+  // Regions and explicit target formats are left to `DecompressTexture`.
+  EXPECT_FALSE(ImageDecoderImpeller::DecodeToPlatformTexture(
+      descriptor.get(),
+      {.target_width = 40,
+       .target_height = 20,
+       .region = SkIRect::MakeWH(10, 10)},
+      {64, 64}, /*supports_wide_gamut=*/false, /*context=*/nullptr));
+  EXPECT_FALSE(ImageDecoderImpeller::DecodeToPlatformTexture(
+      descriptor.get(),
+      {.target_width = 40,
+       .target_height = 20,
+       .target_format = ImageDecoder::TargetPixelFormat::kR32G32B32A32Float},
+      {64, 64}, /*supports_wide_gamut=*/false, /*context=*/nullptr));
+#endif  // IMPELLER_SUPPORTS_RENDERING
+}
+
 }  // namespace testing
 }  // namespace flutter
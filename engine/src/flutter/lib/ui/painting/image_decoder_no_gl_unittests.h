@@ -7,6 +7,8 @@
 
 #include <stdint.h>
 
+#include <vector>
+
 #include "flutter/impeller/core/allocator.h"
 #include "flutter/impeller/core/device_buffer.h"
 #include "flutter/impeller/core/formats.h"
@@ -65,10 +67,18 @@ class TestImpellerDeviceBuffer : public DeviceBuffer {
 
 class TestImpellerAllocator : public impeller::Allocator {
  public:
-  TestImpellerAllocator() {}
+  explicit TestImpellerAllocator(bool supports_host_mapped_textures = false)
+      : supports_host_mapped_textures_(supports_host_mapped_textures) {}
 
   ~TestImpellerAllocator() = default;
 
+  /// The pixels of the most recently created host mapped texture.
+  const std::vector<uint8_t>& GetHostMappedContents() const {
+    return host_mapped_contents_;
+  }
+
+  bool IsHostMappedTextureUnmapped() const { return unmapped_; }
+
  private:
   uint16_t MinimumBytesPerRow(PixelFormat format) const override { return 0; }
 
@@ -85,6 +95,31 @@ class TestImpellerAllocator : public impeller::Allocator {
                                            bool threadsafe) override {
     return std::make_shared<TestImpellerTexture>(desc);
   }
+
+  std::optional<HostMappedTexture> OnCreateHostMappedTexture(
+      const TextureDescriptor& desc) override {
+    if (!supports_host_mapped_textures_) {
+      return std::nullopt;
+    }
+    const size_t bytes_per_row =
+        desc.size.width * BytesPerPixelForPixelFormat(desc.format);
+    host_mapped_contents_.assign(bytes_per_row * desc.size.height, 0u);
+    unmapped_ = false;
+    return HostMappedTexture{
+        .texture = std::make_shared<TestImpellerTexture>(desc),
+        .contents = host_mapped_contents_.data(),
+        .bytes_per_row = bytes_per_row,
+        .unmap =
+            [this]() {
+              unmapped_ = true;
+              return true;
+            },
+    };
+  }
+
+  const bool supports_host_mapped_textures_;
+  std::vector<uint8_t> host_mapped_contents_;
+  bool unmapped_ = false;
 };
 
 }  // namespace impeller
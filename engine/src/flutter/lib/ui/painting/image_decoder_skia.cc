@@ -10,6 +10,7 @@
 
 #include "flutter/fml/logging.h"
 #include "flutter/fml/make_copyable.h"
+#include "flutter/fml/trace_recorder.h"
 #include "flutter/lib/ui/painting/display_list_image_gpu.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkImage.h"
@@ -105,7 +106,7 @@ sk_sp<SkImage> ImageDecoderSkia::ImageFromCompressedData(
     uint32_t target_width,
     uint32_t target_height,
     const fml::tracing::TraceFlow& flow) {
-  TRACE_EVENT0("flutter", __FUNCTION__);
+  FML_RECORDED_TRACE_EVENT0("flutter", __FUNCTION__);
   flow.Step(__FUNCTION__);
 
   if (!descriptor->should_resize(target_width, target_height)) {
@@ -163,6 +164,64 @@ sk_sp<SkImage> ImageDecoderSkia::ImageFromCompressedData(
   return ResizeRasterImage(image, resized_dimensions, flow);
 }
 
+static sk_sp<SkImage> ImageFromRegion(ImageDescriptor* descriptor,
+                                      uint32_t target_width,
+                                      uint32_t target_height,
+                                      const SkIRect& region,
+                                      const fml::tracing::TraceFlow& flow) {
+  TRACE_EVENT0("flutter", __FUNCTION__);
+  flow.Step(__FUNCTION__);
+
+  const SkImageInfo image_info =
+      ImageDescriptor::ToSkImageInfo(descriptor->image_info());
+  const SkISize source_dimensions = image_info.dimensions();
+  const SkISize target_dimensions = {static_cast<int32_t>(target_width),
+                                     static_cast<int32_t>(target_height)};
+  if (region.isEmpty() ||
+      !SkIRect::MakeSize(target_dimensions).contains(region)) {
+    FML_LOG(ERROR) << "Invalid image region.";
+    return nullptr;
+  }
+
+  SkISize decode_dimensions = source_dimensions;
+  if (descriptor->is_compressed()) {
+    decode_dimensions = descriptor->get_scaled_dimensions(
+        std::max(static_cast<float>(target_dimensions.width()) /
+                     source_dimensions.width(),
+                 static_cast<float>(target_dimensions.height()) /
+                     source_dimensions.height()));
+  }
+  const SkIRect decode_region =
+      ImageDescriptor::MapRegion(region, target_dimensions, decode_dimensions);
+  if (decode_region.isEmpty()) {
+    FML_LOG(ERROR) << "Invalid image region.";
+    return nullptr;
+  }
+
+  const SkImageInfo region_info =
+      image_info.makeDimensions(decode_region.size());
+  SkBitmap bitmap;
+  if (!bitmap.tryAllocPixels(region_info)) {
+    FML_LOG(ERROR) << "Failed to allocate memory for bitmap of size "
+                   << region_info.computeMinByteSize() << "B";
+    return nullptr;
+  }
+  if (!descriptor->get_pixels_in_region(bitmap.pixmap(), decode_dimensions,
+                                        decode_region)) {
+    FML_LOG(ERROR) << "Could not decode image region.";
+    return nullptr;
+  }
+  // Marking this as immutable makes the MakeFromBitmap call share the pixels
+  // instead of copying.
+  bitmap.setImmutable();
+
+  auto image = SkImages::RasterFromBitmap(bitmap);
+  if (!image || decode_region.size() == region.size()) {
+    return image;
+  }
+  return ResizeRasterImage(image, region.size(), flow);
+}
+
 static SkiaGPUObject<SkImage> UploadRasterImage(
     sk_sp<SkImage> image,
     const fml::WeakPtr<IOManager>& io_manager,
@@ -267,27 +326,35 @@ void ImageDecoderSkia::Decode(fml::RefPtr<ImageDescriptor> descriptor_ref_ptr,
     return;
   }
 
-  concurrent_task_runner_->PostTask(
+  ScheduleDecode(
+      *raw_descriptor, options,
       fml::MakeCopyable([raw_descriptor,                          //
                          io_manager = io_manager_,                //
                          io_runner = runners_.GetIOTaskRunner(),  //
                          result,                                  //
                          target_width = options.target_width,     //
                          target_height = options.target_height,   //
+                         region = options.region,                 //
                          flow = std::move(flow)                   //
   ]() mutable {
         // Step 1: Decompress the image.
         // On Worker.
 
-        auto decompressed = raw_descriptor->is_compressed()
-                                ? ImageFromCompressedData(raw_descriptor,  //
-                                                          target_width,    //
-                                                          target_height,   //
-                                                          flow)
-                                : ImageFromDecompressedData(raw_descriptor,  //
-                                                            target_width,    //
-                                                            target_height,   //
-                                                            flow);
+        sk_sp<SkImage> decompressed;
+        if (region.has_value()) {
+          decompressed = ImageFromRegion(raw_descriptor, target_width,
+                                         target_height, region.value(), flow);
+        } else if (raw_descriptor->is_compressed()) {
+          decompressed = ImageFromCompressedData(raw_descriptor,  //
+                                                 target_width,    //
+                                                 target_height,   //
+                                                 flow);
+        } else {
+          decompressed = ImageFromDecompressedData(raw_descriptor,  //
+                                                   target_width,    //
+                                                   target_height,   //
+                                                   flow);
+        }
 
         if (!decompressed) {
           FML_DLOG(ERROR) << "Could not decompress image.";
@@ -328,7 +395,12 @@ void ImageDecoderSkia::Decode(fml::RefPtr<ImageDescriptor> descriptor_ref_ptr,
           // Finally, all done.
           result(std::move(uploaded), std::move(flow));
         }));
-      }));
+      }),
+      [result]() {
+        FML_DLOG(INFO)
+            << "The codec was disposed before the image was decoded.";
+        result({}, fml::tracing::TraceFlow(__FUNCTION__));
+      });
 }
 
 }  // namespace flutter
@@ -43,9 +43,10 @@ namespace impeller {
 
 class TestImpellerContext : public impeller::Context {
  public:
-  TestImpellerContext() : impeller::Context(impeller::Flags{}) {}
+  explicit TestImpellerContext(BackendType backend_type = BackendType::kMetal)
+      : impeller::Context(impeller::Flags{}), backend_type_(backend_type) {}
 
-  BackendType GetBackendType() const override { return BackendType::kMetal; }
+  BackendType GetBackendType() const override { return backend_type_; }
 
   std::string DescribeGpuModel() const override { return "TestGpu"; }
 
@@ -113,6 +114,7 @@ class TestImpellerContext : public impeller::Context {
     std::function<void()> task;
     std::function<void()> failure;
   };
+  const BackendType backend_type_;
   std::vector<PendingTask> tasks_;
   std::shared_ptr<const Capabilities> capabilities_;
   bool did_dispose_ = false;
@@ -449,6 +451,73 @@ TEST_F(ImageDecoderFixtureTest,
   EXPECT_NE(message, "");
 }
 
+TEST_F(ImageDecoderFixtureTest, ImpellerConvertTextureToShaderReadNoGpu) {
+#if !IMPELLER_SUPPORTS_RENDERING
+  GTEST_SKIP() << "Impeller only test.";
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
+  auto no_gpu_access_context = std::make_shared<impeller::TestImpellerContext>(
+      impeller::Context::BackendType::kVulkan);
+  auto gpu_disabled_switch = std::make_shared<fml::SyncSwitch>(true);
+
+  impeller::TextureDescriptor desc;
+  desc.format = impeller::PixelFormat::kR8G8B8A8UNormInt;
+  desc.size = impeller::ISize(10, 10);
+  auto texture = std::make_shared<impeller::TestImpellerTexture>(desc);
+
+  bool invoked = false;
+  auto cb = [&invoked](const sk_sp<DlImage>& image,
+                       const std::string& message) { invoked = true; };
+
+  ImageDecoderImpeller::ConvertTextureToShaderRead(
+      cb, no_gpu_access_context, texture, gpu_disabled_switch);
+
+  // The layout transition waits for GPU access.
+  EXPECT_EQ(no_gpu_access_context->command_buffer_count_, 0ul);
+  EXPECT_FALSE(invoked);
+  EXPECT_FALSE(no_gpu_access_context->DidDisposeResources());
+
+  no_gpu_access_context->FlushTasks(/*fail=*/true);
+
+  EXPECT_TRUE(invoked);
+  EXPECT_EQ(no_gpu_access_context->command_buffer_count_, 1ul);
+  EXPECT_TRUE(no_gpu_access_context->DidDisposeResources());
+}
+
+TEST_F(ImageDecoderFixtureTest,
+       ImpellerConvertTextureToShaderReadDisposesResources) {
+#if !IMPELLER_SUPPORTS_RENDERING
+  GTEST_SKIP() << "Impeller only test.";
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
+  auto context = std::make_shared<impeller::TestImpellerContext>(
+      impeller::Context::BackendType::kVulkan);
+  auto gpu_disabled_switch = std::make_shared<fml::SyncSwitch>(false);
+
+  impeller::TextureDescriptor desc;
+  desc.format = impeller::PixelFormat::kR8G8B8A8UNormInt;
+  desc.size = impeller::ISize(10, 10);
+  auto texture = std::make_shared<impeller::TestImpellerTexture>(desc);
+
+  bool invoked = false;
+  std::string message;
+  auto cb = [&invoked, &message](const sk_sp<DlImage>& image,
+                                 const std::string& p_message) {
+    invoked = true;
+    message = p_message;
+  };
+
+  ImageDecoderImpeller::ConvertTextureToShaderRead(cb, context, texture,
+                                                   gpu_disabled_switch);
+
+  EXPECT_TRUE(invoked);
+  EXPECT_EQ(context->command_buffer_count_, 1ul);
+  // The mocked context creates no command buffers, but the resources of the
+  // decoding thread are still released.
+  EXPECT_NE(message, "");
+  EXPECT_TRUE(context->DidDisposeResources());
+}
+
 TEST_F(ImageDecoderFixtureTest, ImpellerNullColorspace) {
   auto info = SkImageInfo::Make(10, 10, SkColorType::kRGBA_8888_SkColorType,
                                 SkAlphaType::kPremul_SkAlphaType);
@@ -4,13 +4,18 @@
 
 #include "flutter/lib/ui/painting/image_descriptor.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/trace_event.h"
+#include "flutter/lib/ui/painting/image.h"
 #include "flutter/lib/ui/painting/multi_frame_codec.h"
 #include "flutter/lib/ui/painting/single_frame_codec.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "third_party/tonic/dart_binding_macros.h"
+#include "third_party/tonic/dart_persistent_value.h"
 #include "third_party/tonic/logging/dart_invoke.h"
 
 namespace flutter {
@@ -185,6 +190,8 @@ ImageDecoder::TargetPixelFormat ToImageDecoderTargetPixelFormat(int32_t value) {
       return ImageDecoder::TargetPixelFormat::kR32G32B32A32Float;
     case 2:
       return ImageDecoder::TargetPixelFormat::kR32Float;
+    case 3:
+      return ImageDecoder::TargetPixelFormat::kCompressed;
     default:
       FML_DCHECK(false) << "Unknown pixel format.";
       return ImageDecoder::TargetPixelFormat::kUnknown;
@@ -203,21 +210,162 @@ void ImageDescriptor::instantiateCodec(Dart_Handle codec_handle,
         target_height,                                    //
         ToImageDecoderTargetPixelFormat(destination_format));
   } else {
-    ui_codec = fml::MakeRefCounted<MultiFrameCodec>(generator_);
+    ui_codec = fml::MakeRefCounted<MultiFrameCodec>(generator_, buffer_);
   }
   ui_codec->AssociateWithDartWrapper(codec_handle);
 }
 
+Dart_Handle ImageDescriptor::decodeRegion(Dart_Handle callback_handle,
+                                          double left,
+                                          double top,
+                                          double right,
+                                          double bottom,
+                                          double scale) {
+  if (!Dart_IsClosure(callback_handle)) {
+    return tonic::ToDart("Callback must be a function");
+  }
+  if (!buffer_) {
+    return tonic::ToDart("ImageDescriptor has been disposed");
+  }
+  if (!(scale > 0.0 && scale <= 1.0)) {
+    return tonic::ToDart("Scale must be greater than 0 and at most 1");
+  }
+
+  const SkISize scaled_size = SkISize::Make(
+      std::max(1, static_cast<int>(std::round(width() * scale))),
+      std::max(1, static_cast<int>(std::round(height() * scale))));
+  SkIRect region =
+      SkRect::MakeLTRB(left * scale, top * scale, right * scale, bottom * scale)
+          .roundOut();
+  if (!region.intersect(SkIRect::MakeSize(scaled_size))) {
+    return tonic::ToDart("Region must overlap the image");
+  }
+
+  if (sk_sp<DlImage> tile = tile_cache_.Get(scaled_size, region)) {
+    auto canvas_image = fml::MakeRefCounted<CanvasImage>();
+    canvas_image->set_image(std::move(tile));
+    tonic::DartInvoke(callback_handle,
+                      {tonic::ToDart(canvas_image), tonic::ToDart("")});
+    return Dart_Null();
+  }
+
+  // This has to be valid because this method is called from Dart.
+  auto dart_state = UIDartState::Current();
+  auto decoder = dart_state->GetImageDecoder();
+  if (!decoder) {
+    return tonic::ToDart(
+        "Failed to access the internal image decoder "
+        "registry on this isolate. Please file a bug on "
+        "https://github.com/flutter/flutter/issues.");
+  }
+
+  // Like in `SingleFrameCodec::getNextFrame`, the descriptor and the callback
+  // are held on the heap so that they are only collected on the UI thread,
+  // where the decoder invokes the result callback.
+  auto* raw_descriptor_ref = new fml::RefPtr<ImageDescriptor>(this);
+  auto* raw_callback =
+      new tonic::DartPersistentValue(dart_state, callback_handle);
+
+  // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
+  decoder->Decode(
+      fml::Ref(this),
+      {.target_width = static_cast<uint32_t>(scaled_size.width()),
+       .target_height = static_cast<uint32_t>(scaled_size.height()),
+       .region = region},
+      [raw_descriptor_ref, raw_callback, scaled_size, region](
+          const auto& image, const auto& decode_error) {
+        std::unique_ptr<fml::RefPtr<ImageDescriptor>> descriptor(
+            raw_descriptor_ref);
+        std::unique_ptr<tonic::DartPersistentValue> callback(raw_callback);
+
+        auto state = callback->dart_state().lock();
+        if (!state) {
+          // The isolate was terminated before the region could be decoded.
+          return;
+        }
+        tonic::DartState::Scope scope(state.get());
+
+        fml::RefPtr<CanvasImage> canvas_image;
+        if (image) {
+          if ((*descriptor)->buffer_) {
+            (*descriptor)->tile_cache_.Put(scaled_size, region, image);
+          }
+          canvas_image = fml::MakeRefCounted<CanvasImage>();
+          canvas_image->set_image(image);
+        }
+        tonic::DartInvoke(callback->value(), {tonic::ToDart(canvas_image),
+                                              tonic::ToDart(decode_error)});
+      });
+
+  return Dart_Null();
+}
+
 sk_sp<SkImage> ImageDescriptor::image() const {
+  std::scoped_lock lock(generator_mutex_);
   return generator_->GetImage();
 }
 
 bool ImageDescriptor::get_pixels(const SkPixmap& pixmap) const {
   FML_DCHECK(generator_);
+  std::scoped_lock lock(generator_mutex_);
   return generator_->GetPixels(pixmap.info(), pixmap.writable_addr(),
                                pixmap.rowBytes());
 }
 
+std::shared_ptr<impeller::Texture> ImageDescriptor::get_texture(
+    const SkISize& size,
+    const std::shared_ptr<impeller::Context>& context) const {
+  if (!generator_) {
+    return nullptr;
+  }
+  std::scoped_lock lock(generator_mutex_);
+  return generator_->GetTexture(size, context);
+}
+
+bool ImageDescriptor::get_pixels_in_region(const SkPixmap& pixmap,
+                                           const SkISize& scaled_size,
+                                           const SkIRect& region) const {
+  FML_DCHECK(pixmap.dimensions() == region.size());
+  if (generator_) {
+    std::scoped_lock lock(generator_mutex_);
+    return generator_->GetPixelsInRegion(pixmap.info(), pixmap.writable_addr(),
+                                         pixmap.rowBytes(), scaled_size,
+                                         region);
+  }
+
+  const SkImageInfo info = ToSkImageInfo(image_info_);
+  SkPixmap source(info, buffer_->data(), row_bytes());
+  const SkIRect source_region =
+      MapRegion(region, scaled_size, info.dimensions());
+  SkPixmap source_subset;
+  if (!source.extractSubset(&source_subset, source_region)) {
+    return false;
+  }
+  if (source_region.size() == region.size()) {
+    return source_subset.readPixels(pixmap);
+  }
+  return source_subset.scalePixels(
+      pixmap, SkSamplingOptions(SkFilterMode::kLinear, SkMipmapMode::kNone));
+}
+
+SkIRect ImageDescriptor::MapRegion(const SkIRect& region,
+                                   const SkISize& from,
+                                   const SkISize& to) {
+  if (from == to) {
+    return region;
+  }
+  const float scale_x = static_cast<float>(to.width()) / from.width();
+  const float scale_y = static_cast<float>(to.height()) / from.height();
+  SkIRect mapped =
+      SkRect::MakeLTRB(region.left() * scale_x, region.top() * scale_y,
+                       region.right() * scale_x, region.bottom() * scale_y)
+          .roundOut();
+  if (!mapped.intersect(SkIRect::MakeSize(to))) {
+    return SkIRect::MakeEmpty();
+  }
+  return mapped;
+}
+
 int ImageDescriptor::bytesPerPixel() const {
   switch (image_info_.format) {
     case kUnknown:
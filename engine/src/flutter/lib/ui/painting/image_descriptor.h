@@ -7,11 +7,13 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <optional>
 
 #include "flutter/fml/macros.h"
 #include "flutter/lib/ui/dart_wrapper.h"
 #include "flutter/lib/ui/painting/image_generator_registry.h"
+#include "flutter/lib/ui/painting/image_tile_cache.h"
 #include "flutter/lib/ui/painting/immutable_buffer.h"
 #include "third_party/skia/include/core/SkColorSpace.h"
 #include "third_party/skia/include/core/SkData.h"
@@ -78,6 +80,18 @@ class ImageDescriptor : public RefCountedDartWrappable<ImageDescriptor> {
                         int32_t target_height,
                         int32_t destination_format);
 
+  /// @brief  Decodes the part of this image within the given rect, as if the
+  ///         image were decoded at `scale` times its size, and calls
+  ///         `callback` with the resulting image. Recently decoded regions
+  ///         are kept in a tile cache.
+  /// @return An error string if the region can't be decoded, or null.
+  Dart_Handle decodeRegion(Dart_Handle callback,
+                           double left,
+                           double top,
+                           double right,
+                           double bottom,
+                           double scale);
+
   /// @brief  The width of this image, EXIF oriented if applicable.
   int width() const { return image_info_.width; }
 
@@ -126,9 +140,33 @@ class ImageDescriptor : public RefCountedDartWrappable<ImageDescriptor> {
   ///         orientation tag, if applicable.
   bool get_pixels(const SkPixmap& pixmap) const;
 
+  /// @brief  Gets the pixels of `region` of this image when it is scaled to
+  ///         `scaled_size`, which must be the size of this image or, for
+  ///         compressed images, one returned by `get_scaled_dimensions`. The
+  ///         size of `pixmap` is the size of `region`.
+  /// @see    `ImageGenerator::GetPixelsInRegion`
+  bool get_pixels_in_region(const SkPixmap& pixmap,
+                            const SkISize& scaled_size,
+                            const SkIRect& region) const;
+
+  /// @brief  Decodes this image at `size` straight into a texture of
+  ///         `context`, if it is backed by an `ImageGenerator` that uses a
+  ///         platform decoder able to do so. Returns null otherwise.
+  /// @see    `ImageGenerator::GetTexture`
+  std::shared_ptr<impeller::Texture> get_texture(
+      const SkISize& size,
+      const std::shared_ptr<impeller::Context>& context) const;
+
+  /// @brief  Maps `region` of an image of size `from` to the smallest region
+  ///         that covers it in the image scaled to size `to`.
+  static SkIRect MapRegion(const SkIRect& region,
+                           const SkISize& from,
+                           const SkISize& to);
+
   void dispose() {
     buffer_.reset();
     generator_.reset();
+    tile_cache_.Clear();
     ClearDartWrapper();
   }
 
@@ -145,7 +183,12 @@ class ImageDescriptor : public RefCountedDartWrappable<ImageDescriptor> {
   sk_sp<SkData> buffer_;
   const ImageInfo image_info_;
   std::shared_ptr<ImageGenerator> generator_;
+  // Generators are not thread safe, and regions may be decoded by several
+  // workers at once.
+  mutable std::mutex generator_mutex_;
   std::optional<size_t> row_bytes_;
+  // Only accessed on the UI thread.
+  ImageTileCache tile_cache_;
 
   DEFINE_WRAPPERTYPEINFO();
   FML_FRIEND_MAKE_REF_COUNTED(ImageDescriptor);
@@ -20,7 +20,6 @@
 #endif  // IMPELLER_SUPPORTS_RENDERING
 #include "flutter/lib/ui/painting/image_encoding_skia.h"
 #include "third_party/skia/include/core/SkImage.h"
-#include "third_party/skia/include/core/SkSurface.h"
 #include "third_party/skia/include/encode/SkPngEncoder.h"
 #include "third_party/tonic/dart_persistent_value.h"
 #include "third_party/tonic/logging/dart_invoke.h"
@@ -83,24 +82,18 @@ fml::StatusOr<sk_sp<SkData>> CopyImageByteData(
     return SkData::MakeWithCopy(pixmap.addr(), pixmap.computeByteSize());
   }
 
-  // Perform swizzle if the type doesnt match the specification.
-  auto surface = SkSurfaces::Raster(
+  // Swizzle straight into the returned buffer. Going through an intermediate
+  // surface would allocate and copy the whole image once more.
+  SkImageInfo info =
       SkImageInfo::Make(raster_image->width(), raster_image->height(),
-                        color_type, alpha_type, nullptr));
-
-  if (!surface) {
-    fml::Status(fml::StatusCode::kInternal,
-                "Could not set up the surface for swizzle.");
-  }
-
-  surface->writePixels(pixmap, 0, 0);
-
-  if (!surface->peekPixels(&pixmap)) {
+                        color_type, alpha_type, nullptr);
+  sk_sp<SkData> data = SkData::MakeUninitialized(info.computeMinByteSize());
+  if (!pixmap.readPixels(info, data->writable_data(), info.minRowBytes())) {
     return fml::Status(fml::StatusCode::kInternal,
-                       "Pixel address is not available.");
+                       "Could not swizzle the pixels of the raster image.");
   }
 
-  return SkData::MakeWithCopy(pixmap.addr(), pixmap.computeByteSize());
+  return data;
 }
 
 void EncodeImageAndInvokeDataCallback(
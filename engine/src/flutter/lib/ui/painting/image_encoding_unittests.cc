@@ -541,6 +541,27 @@ TEST(ImageEncodingImpellerTest, ConvertDlImageToSkImage10XR) {
   EXPECT_TRUE(did_call);
 }
 
+TEST(ImageEncodingTest, RawRGBASwizzlesBGRAImage) {
+  SkImageInfo info =
+      SkImageInfo::Make(4, 2, kBGRA_8888_SkColorType, kPremul_SkAlphaType);
+  auto surface = SkSurfaces::Raster(info);
+  surface->getCanvas()->clear(SK_ColorRED);
+  sk_sp<SkImage> image = surface->makeImageSnapshot();
+
+  fml::StatusOr<sk_sp<SkData>> rgba =
+      EncodeImage(image, ImageByteFormat::kRawRGBA);
+  ASSERT_TRUE(rgba.ok());
+  ASSERT_EQ(rgba.value()->size(), 4u * 2u * 4u);
+
+  const uint8_t* bytes = rgba.value()->bytes();
+  for (size_t i = 0; i < rgba.value()->size(); i += 4) {
+    EXPECT_EQ(bytes[i], 0xFF);
+    EXPECT_EQ(bytes[i + 1], 0x00);
+    EXPECT_EQ(bytes[i + 2], 0x00);
+    EXPECT_EQ(bytes[i + 3], 0xFF);
+  }
+}
+
 TEST(ImageEncodingImpellerTest, PngEncoding10XR) {
   int width = 100;
   int height = 100;
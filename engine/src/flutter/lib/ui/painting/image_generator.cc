@@ -35,6 +35,34 @@ sk_sp<SkImage> ImageGenerator::GetImage() {
   return SkImages::RasterFromBitmap(bitmap);
 }
 
+bool ImageGenerator::GetPixelsInRegion(const SkImageInfo& info,
+                                       void* pixels,
+                                       size_t row_bytes,
+                                       const SkISize& scaled_size,
+                                       const SkIRect& region) {
+  FML_DCHECK(info.dimensions() == region.size());
+  const SkImageInfo scaled_info = info.makeDimensions(scaled_size);
+  SkBitmap bitmap;
+  if (!bitmap.tryAllocPixels(scaled_info)) {
+    FML_DLOG(ERROR) << "Failed to allocate memory for bitmap of size "
+                    << scaled_info.computeMinByteSize() << "B";
+    return false;
+  }
+
+  const auto& pixmap = bitmap.pixmap();
+  if (!GetPixels(pixmap.info(), pixmap.writable_addr(), pixmap.rowBytes())) {
+    FML_DLOG(ERROR) << "Failed to get pixels for image.";
+    return false;
+  }
+  return pixmap.readPixels(info, pixels, row_bytes, region.x(), region.y());
+}
+
+std::shared_ptr<impeller::Texture> ImageGenerator::GetTexture(
+    const SkISize& size,
+    const std::shared_ptr<impeller::Context>& context) {
+  return nullptr;
+}
+
 BuiltinSkiaImageGenerator::~BuiltinSkiaImageGenerator() = default;
 
 BuiltinSkiaImageGenerator::BuiltinSkiaImageGenerator(
@@ -188,6 +216,47 @@ bool BuiltinSkiaCodecImageGenerator::GetPixels(
   return SkPixmapUtils::Orient(output_pixmap, temp_pixmap, origin);
 }
 
+bool BuiltinSkiaCodecImageGenerator::GetPixelsInRegion(
+    const SkImageInfo& info,
+    void* pixels,
+    size_t row_bytes,
+    const SkISize& scaled_size,
+    const SkIRect& region) {
+  FML_DCHECK(info.dimensions() == region.size());
+  // The region is in the coordinates of the oriented image, and scanlines are
+  // only available top-down for some codecs.
+  if (codec_->getOrigin() != kTopLeft_SkEncodedOrigin ||
+      codec_->getScanlineOrder() != SkCodec::kTopDown_SkScanlineOrder) {
+    return ImageGenerator::GetPixelsInRegion(info, pixels, row_bytes,
+                                             scaled_size, region);
+  }
+
+  // Scanline decoders crop columns themselves, and the rows above the region
+  // are skipped without being kept. The rows below it are never decoded.
+  const SkIRect columns = SkIRect::MakeLTRB(region.left(), 0, region.right(),
+                                            scaled_size.height());
+  SkCodec::Options options;
+  options.fSubset = &columns;
+  SkCodec::Result result =
+      codec_->startScanlineDecode(info.makeDimensions(scaled_size), &options);
+  if (result != SkCodec::kSuccess) {
+    FML_DLOG(INFO) << "codec could not decode scanlines. "
+                   << SkCodec::ResultToString(result);
+    return ImageGenerator::GetPixelsInRegion(info, pixels, row_bytes,
+                                             scaled_size, region);
+  }
+  if (!codec_->skipScanlines(region.top())) {
+    FML_DLOG(WARNING) << "codec could not skip scanlines.";
+    return false;
+  }
+  if (codec_->getScanlines(pixels, region.height(), row_bytes) !=
+      region.height()) {
+    FML_DLOG(WARNING) << "codec could not get scanlines.";
+    return false;
+  }
+  return true;
+}
+
 std::unique_ptr<ImageGenerator> BuiltinSkiaCodecImageGenerator::MakeFromData(
     sk_sp<SkData> data) {
   auto codec = SkCodec::MakeFromData(std::move(data));
@@ -15,6 +15,11 @@
 #include "third_party/skia/include/core/SkImageInfo.h"
 #include "third_party/skia/include/core/SkSize.h"
 
+namespace impeller {
+class Context;
+class Texture;
+}  // namespace impeller
+
 namespace flutter {
 
 /// @brief  The minimal interface necessary for defining a decoder that can be
@@ -135,6 +140,50 @@ class ImageGenerator {
       unsigned int frame_index = 0,
       std::optional<unsigned int> prior_frame = std::nullopt) = 0;
 
+  /// @brief      Decode a region of the first frame of the image into a given
+  ///             buffer, as if the whole image were decoded at `scaled_size`.
+  ///             The default implementation decodes the whole image and
+  ///             copies the region out of it; generators that can decode just
+  ///             the rows and columns of the region should override it.
+  /// @param[in]  info         The desired color info of the decoded region.
+  ///                          Its size is the size of `region`.
+  /// @param[in]  pixels       The location where the raw decoded image data
+  ///                          should be written.
+  /// @param[in]  row_bytes    The total number of bytes that should make up a
+  ///                          single row of decoded image data.
+  /// @param[in]  scaled_size  The size of the whole image to decode the region
+  ///                          of. Must be one of the sizes returned by
+  ///                          `GetScaledDimensions`.
+  /// @param[in]  region       The region to decode, within `scaled_size`.
+  /// @return     True if the region was successfully decoded.
+  /// @note       Like `GetPixels`, this should never be executed on the UI
+  ///             thread.
+  /// @see        `GetPixels`
+  virtual bool GetPixelsInRegion(const SkImageInfo& info,
+                                 void* pixels,
+                                 size_t row_bytes,
+                                 const SkISize& scaled_size,
+                                 const SkIRect& region);
+
+  /// @brief      Decode the first frame of the image straight into a texture
+  ///             of `context`, for generators that use a platform decoder
+  ///             able to do so, such as a hardware JPEG decoder. The default
+  ///             implementation returns null, and the image is then decoded
+  ///             with `GetPixels`. The texture need not be in a shader
+  ///             readable layout yet: the decoder transitions it where GPU
+  ///             work may be submitted.
+  /// @param[in]  size     The size of the texture. Unlike for `GetPixels`, it
+  ///                      need not be one of the sizes returned by
+  ///                      `GetScaledDimensions`.
+  /// @param[in]  context  The Impeller context the texture is created in.
+  /// @return     The texture, or null if the image could not be decoded to
+  ///             one, in which case `GetPixels` is used instead.
+  /// @note       Like `GetPixels`, this should never be executed on the UI
+  ///             thread.
+  virtual std::shared_ptr<impeller::Texture> GetTexture(
+      const SkISize& size,
+      const std::shared_ptr<impeller::Context>& context);
+
   /// @brief   Creates an `SkImage` based on the current `ImageInfo` of this
   ///          `ImageGenerator`.
   /// @return  A new `SkImage` containing the decoded image data.
@@ -212,6 +261,13 @@ class BuiltinSkiaCodecImageGenerator : public ImageGenerator {
       unsigned int frame_index = 0,
       std::optional<unsigned int> prior_frame = std::nullopt) override;
 
+  // |ImageGenerator|
+  bool GetPixelsInRegion(const SkImageInfo& info,
+                         void* pixels,
+                         size_t row_bytes,
+                         const SkISize& scaled_size,
+                         const SkIRect& region) override;
+
   static std::unique_ptr<ImageGenerator> MakeFromData(sk_sp<SkData> data);
 
  private:
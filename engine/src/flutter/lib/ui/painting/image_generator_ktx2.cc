@@ -0,0 +1,293 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/image_generator_ktx2.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <optional>
+
+#include "flutter/fml/endianness.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+#include "impeller/core/allocator.h"
+#include "impeller/core/buffer_view.h"
+#include "impeller/core/device_buffer.h"
+#include "impeller/core/texture_descriptor.h"
+#include "impeller/renderer/blit_pass.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/command_queue.h"
+#include "impeller/renderer/context.h"
+#include "third_party/skia/include/codec/SkCodecAnimation.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr uint8_t kKTX2Identifier[12] = {0xAB, 'K',  'T',  'X', ' ',  '2',
+                                         '0',  0xBB, '\r', '\n', 0x1A, '\n'};
+
+// The offsets of the fields of the header, which are all little endian.
+constexpr size_t kVkFormatOffset = 12;
+constexpr size_t kPixelWidthOffset = 20;
+constexpr size_t kPixelHeightOffset = 24;
+constexpr size_t kPixelDepthOffset = 28;
+constexpr size_t kLayerCountOffset = 32;
+constexpr size_t kFaceCountOffset = 36;
+constexpr size_t kLevelCountOffset = 40;
+constexpr size_t kSupercompressionSchemeOffset = 44;
+constexpr size_t kDfdByteOffsetOffset = 48;
+constexpr size_t kDfdByteLengthOffset = 52;
+constexpr size_t kLevelIndexOffset = 80;
+// Each level is indexed by its byte offset, byte length and uncompressed
+// byte length.
+constexpr size_t kLevelIndexEntrySize = 24;
+// The flags of the basic descriptor block of the data format descriptor,
+// after its total size and the vendor, type, version and size of the block.
+constexpr size_t kDfdFlagsOffset = 15;
+constexpr uint8_t kDfdFlagAlphaPremultiplied = 1;
+
+// The formats of the Vulkan specification the files are tagged with.
+constexpr uint32_t kVkFormatBC7UNormBlock = 145;
+constexpr uint32_t kVkFormatETC2R8G8B8A8UNormBlock = 151;
+constexpr uint32_t kVkFormatASTC4x4UNormBlock = 157;
+
+template <typename T>
+T Read(const SkData& data, size_t offset) {
+  T value;
+  memcpy(&value, data.bytes() + offset, sizeof(T));
+  return fml::LittleEndianToArch(value);
+}
+
+std::optional<impeller::PixelFormat> ToPixelFormat(uint32_t vk_format) {
+  switch (vk_format) {
+    case kVkFormatETC2R8G8B8A8UNormBlock:
+      return impeller::PixelFormat::kETC2R8G8B8A8UNormInt;
+    case kVkFormatASTC4x4UNormBlock:
+      return impeller::PixelFormat::kASTC4x4UNormInt;
+    case kVkFormatBC7UNormBlock:
+      return impeller::PixelFormat::kBC7UNormInt;
+    default:
+      return std::nullopt;
+  }
+}
+
+}  // namespace
+
+KTX2ImageGenerator::~KTX2ImageGenerator() = default;
+
+KTX2ImageGenerator::KTX2ImageGenerator(sk_sp<SkData> data,
+                                       const SkImageInfo& info,
+                                       impeller::PixelFormat format,
+                                       std::vector<Level> levels)
+    : data_(std::move(data)),
+      info_(info),
+      format_(format),
+      levels_(std::move(levels)) {}
+
+const SkImageInfo& KTX2ImageGenerator::GetInfo() {
+  return info_;
+}
+
+unsigned int KTX2ImageGenerator::GetFrameCount() const {
+  return 1;
+}
+
+unsigned int KTX2ImageGenerator::GetPlayCount() const {
+  return 1;
+}
+
+const ImageGenerator::FrameInfo KTX2ImageGenerator::GetFrameInfo(
+    unsigned int frame_index) {
+  return {.required_frame = std::nullopt,
+          .duration = 0,
+          .disposal_method = SkCodecAnimation::DisposalMethod::kKeep};
+}
+
+SkISize KTX2ImageGenerator::GetScaledDimensions(float desired_scale) {
+  const SkISize size = SkISize::Make(
+      std::max(1, static_cast<int>(std::ceil(info_.width() * desired_scale))),
+      std::max(1,
+               static_cast<int>(std::ceil(info_.height() * desired_scale))));
+  return levels_[ChooseLevel(size)].size;
+}
+
+bool KTX2ImageGenerator::GetPixels(const SkImageInfo& info,
+                                   void* pixels,
+                                   size_t row_bytes,
+                                   unsigned int frame_index,
+                                   std::optional<unsigned int> prior_frame) {
+  // The blocks are only ever decompressed by the GPU.
+  return false;
+}
+
+size_t KTX2ImageGenerator::ChooseLevel(const SkISize& size) const {
+  size_t level = 0;
+  while (level + 1 < levels_.size() &&
+         levels_[level + 1].size.width() >= size.width() &&
+         levels_[level + 1].size.height() >= size.height()) {
+    level++;
+  }
+  return level;
+}
+
+std::shared_ptr<impeller::Texture> KTX2ImageGenerator::GetTexture(
+    const SkISize& size,
+    const std::shared_ptr<impeller::Context>& context) {
+  if (!context || !context->GetCapabilities()->SupportsCompressedFormat(
+                      format_)) {
+    FML_DLOG(ERROR) << "The backend does not support KTX2 images of format "
+                    << impeller::PixelFormatToString(format_) << ".";
+    return nullptr;
+  }
+  TRACE_EVENT0("flutter", "KTX2ImageGenerator::GetTexture");
+  const size_t first_level = ChooseLevel(size);
+  const Level& base_level = levels_[first_level];
+
+  impeller::TextureDescriptor desc;
+  desc.storage_mode = impeller::StorageMode::kDevicePrivate;
+  desc.format = format_;
+  desc.size = impeller::ISize(base_level.size.width(),
+                              base_level.size.height());
+  desc.mip_count = levels_.size() - first_level;
+  std::shared_ptr<impeller::Texture> texture =
+      context->GetResourceAllocator()->CreateTexture(desc);
+  if (!texture) {
+    FML_DLOG(ERROR) << "Could not create KTX2 texture.";
+    return nullptr;
+  }
+
+  // The levels uploaded are contiguous, from the smallest to the largest.
+  const size_t start = levels_.back().offset;
+  const size_t end = base_level.offset + base_level.length;
+  std::shared_ptr<impeller::DeviceBuffer> buffer =
+      context->GetResourceAllocator()->CreateBufferWithCopy(
+          data_->bytes() + start, end - start);
+  if (!buffer) {
+    FML_DLOG(ERROR) << "Could not create KTX2 staging buffer.";
+    return nullptr;
+  }
+
+  std::shared_ptr<impeller::CommandBuffer> command_buffer =
+      context->CreateCommandBuffer();
+  if (!command_buffer) {
+    return nullptr;
+  }
+  command_buffer->SetLabel("KTX2 Upload Command Buffer");
+  std::shared_ptr<impeller::BlitPass> blit_pass =
+      command_buffer->CreateBlitPass();
+  if (!blit_pass) {
+    return nullptr;
+  }
+  for (size_t level = first_level; level < levels_.size(); level++) {
+    const Level& mip = levels_[level];
+    if (!blit_pass->AddCopy(
+            impeller::BufferView(
+                buffer, impeller::Range(mip.offset - start, mip.length)),
+            texture,
+            impeller::IRect::MakeWH(mip.size.width(), mip.size.height()),
+            "KTX2 Level Upload", level - first_level)) {
+      return nullptr;
+    }
+  }
+  blit_pass->EncodeCommands();
+  if (!context->GetCommandQueue()->Submit({command_buffer}).ok()) {
+    FML_DLOG(ERROR) << "Failed to submit KTX2 upload command buffer.";
+    return nullptr;
+  }
+  // Like the decoded images, the texture must be visible to the raster
+  // thread once it is returned.
+  if (context->AddTrackingFence(texture)) {
+    command_buffer->WaitUntilScheduled();
+  } else {
+    command_buffer->WaitUntilCompleted();
+  }
+  context->DisposeThreadLocalCachedResources();
+  texture->SetCoordinateSystem(
+      impeller::TextureCoordinateSystem::kUploadFromHost);
+  return texture;
+}
+
+std::unique_ptr<ImageGenerator> KTX2ImageGenerator::MakeFromData(
+    sk_sp<SkData> data) {
+  if (!data || data->size() < kLevelIndexOffset ||
+      memcmp(data->bytes(), kKTX2Identifier, sizeof(kKTX2Identifier)) != 0) {
+    return nullptr;
+  }
+
+  const std::optional<impeller::PixelFormat> format =
+      ToPixelFormat(Read<uint32_t>(*data, kVkFormatOffset));
+  const uint32_t width = Read<uint32_t>(*data, kPixelWidthOffset);
+  const uint32_t height = Read<uint32_t>(*data, kPixelHeightOffset);
+  // Only 2D textures that aren't arrays or cube maps are images.
+  if (!format.has_value() || width == 0 || height == 0 ||
+      width > static_cast<uint32_t>(std::numeric_limits<int>::max()) ||
+      height > static_cast<uint32_t>(std::numeric_limits<int>::max()) ||
+      Read<uint32_t>(*data, kPixelDepthOffset) != 0 ||
+      Read<uint32_t>(*data, kLayerCountOffset) > 1 ||
+      Read<uint32_t>(*data, kFaceCountOffset) != 1) {
+    FML_DLOG(ERROR) << "Unsupported KTX2 image.";
+    return nullptr;
+  }
+  if (Read<uint32_t>(*data, kSupercompressionSchemeOffset) != 0) {
+    FML_DLOG(ERROR) << "Supercompressed KTX2 images are not supported.";
+    return nullptr;
+  }
+
+  const uint32_t dfd_offset = Read<uint32_t>(*data, kDfdByteOffsetOffset);
+  const uint32_t dfd_length = Read<uint32_t>(*data, kDfdByteLengthOffset);
+  if (dfd_length <= kDfdFlagsOffset ||
+      static_cast<size_t>(dfd_offset) + dfd_length > data->size()) {
+    return nullptr;
+  }
+  if (!(data->bytes()[dfd_offset + kDfdFlagsOffset] &
+        kDfdFlagAlphaPremultiplied)) {
+    FML_DLOG(ERROR) << "KTX2 images must have premultiplied alpha.";
+    return nullptr;
+  }
+
+  // A level count of zero asks for the mipmaps to be generated, which they
+  // can't be for compressed textures.
+  const uint32_t level_count =
+      std::max<uint32_t>(Read<uint32_t>(*data, kLevelCountOffset), 1);
+  const size_t level_index_end =
+      kLevelIndexOffset + level_count * kLevelIndexEntrySize;
+  if (level_count > 32 || level_index_end > data->size()) {
+    return nullptr;
+  }
+  std::vector<Level> levels;
+  for (uint32_t i = 0; i < level_count; i++) {
+    const size_t entry = kLevelIndexOffset + i * kLevelIndexEntrySize;
+    const uint64_t offset = Read<uint64_t>(*data, entry);
+    const uint64_t length = Read<uint64_t>(*data, entry + 8);
+    const SkISize size = SkISize::Make(std::max<uint32_t>(width >> i, 1),
+                                       std::max<uint32_t>(height >> i, 1));
+    // The levels are stored from the smallest to the largest, each aligned
+    // to its blocks, and are uploaded as a single contiguous range.
+    if (offset > data->size() || length > data->size() - offset ||
+        offset % impeller::kCompressedBlockBytes != 0 ||
+        length != impeller::BytesForPixelFormat(
+                      format.value(),
+                      impeller::ISize(size.width(), size.height())) ||
+        (!levels.empty() && offset + length > levels.back().offset)) {
+      FML_DLOG(ERROR) << "Invalid KTX2 level " << i << ".";
+      return nullptr;
+    }
+    levels.push_back({.size = size,
+                      .offset = static_cast<size_t>(offset),
+                      .length = static_cast<size_t>(length)});
+    if (size.width() == 1 && size.height() == 1) {
+      break;
+    }
+  }
+
+  const SkImageInfo info =
+      SkImageInfo::Make(width, height, kRGBA_8888_SkColorType,
+                        kPremul_SkAlphaType, SkColorSpace::MakeSRGB());
+  return std::unique_ptr<ImageGenerator>(new KTX2ImageGenerator(
+      std::move(data), info, format.value(), std::move(levels)));
+}
+
+}  // namespace flutter
@@ -0,0 +1,93 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_IMAGE_GENERATOR_KTX2_H_
+#define FLUTTER_LIB_UI_PAINTING_IMAGE_GENERATOR_KTX2_H_
+
+#include <vector>
+
+#include "flutter/lib/ui/painting/image_generator.h"
+#include "impeller/core/formats.h"
+
+namespace flutter {
+
+/// @brief  Loads the 2D textures of KTX2 files that are block compressed to
+///         ETC2 RGBA8, ASTC 4x4 or BC7, without supercompression.
+///
+///         The blocks are uploaded as they are, so the images are never
+///         decompressed on the CPU: |GetPixels| always fails, and the images
+///         can only be decoded to a texture, on the backends that support
+///         their format. The mip level uploaded is the smallest one that's
+///         at least as large as the size the image is decoded at, with the
+///         levels below it, so the size of the decoded image is the size of
+///         that level.
+///
+///         The texels must have premultiplied alpha, like the textures
+///         Impeller samples from.
+class KTX2ImageGenerator : public ImageGenerator {
+ public:
+  ~KTX2ImageGenerator() override;
+
+  // |ImageGenerator|
+  const SkImageInfo& GetInfo() override;
+
+  // |ImageGenerator|
+  unsigned int GetFrameCount() const override;
+
+  // |ImageGenerator|
+  unsigned int GetPlayCount() const override;
+
+  // |ImageGenerator|
+  const ImageGenerator::FrameInfo GetFrameInfo(
+      unsigned int frame_index) override;
+
+  // |ImageGenerator|
+  SkISize GetScaledDimensions(float desired_scale) override;
+
+  // |ImageGenerator|
+  bool GetPixels(const SkImageInfo& info,
+                 void* pixels,
+                 size_t row_bytes,
+                 unsigned int frame_index,
+                 std::optional<unsigned int> prior_frame) override;
+
+  // |ImageGenerator|
+  std::shared_ptr<impeller::Texture> GetTexture(
+      const SkISize& size,
+      const std::shared_ptr<impeller::Context>& context) override;
+
+  impeller::PixelFormat GetPixelFormat() const { return format_; }
+
+  size_t GetLevelCount() const { return levels_.size(); }
+
+  static std::unique_ptr<ImageGenerator> MakeFromData(sk_sp<SkData> data);
+
+ private:
+  struct Level {
+    SkISize size;
+    size_t offset;
+    size_t length;
+  };
+
+  const sk_sp<SkData> data_;
+  const SkImageInfo info_;
+  const impeller::PixelFormat format_;
+  // The largest level first.
+  const std::vector<Level> levels_;
+
+  KTX2ImageGenerator(sk_sp<SkData> data,
+                     const SkImageInfo& info,
+                     impeller::PixelFormat format,
+                     std::vector<Level> levels);
+
+  // The smallest level that's at least as large as `size`, or the largest
+  // level.
+  size_t ChooseLevel(const SkISize& size) const;
+
+  FML_DISALLOW_COPY_ASSIGN_AND_MOVE(KTX2ImageGenerator);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_IMAGE_GENERATOR_KTX2_H_
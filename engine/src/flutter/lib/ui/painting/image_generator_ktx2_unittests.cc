@@ -0,0 +1,143 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/image_generator_ktx2.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+void Write32(std::vector<uint8_t>& data, size_t offset, uint32_t value) {
+  for (int i = 0; i < 4; i++) {
+    data[offset + i] = (value >> (i * 8)) & 0xff;
+  }
+}
+
+void Write64(std::vector<uint8_t>& data, size_t offset, uint64_t value) {
+  for (int i = 0; i < 8; i++) {
+    data[offset + i] = (value >> (i * 8)) & 0xff;
+  }
+}
+
+// A BC7 texture of `width` by `height` texels with every mip level, stored
+// from the smallest level to the largest.
+std::vector<uint8_t> MakeKTX2(uint32_t width,
+                              uint32_t height,
+                              uint32_t level_count) {
+  static constexpr uint8_t kIdentifier[12] = {
+      0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+  const size_t dfd_offset = 80 + level_count * 24;
+  const size_t dfd_length = 44;
+  std::vector<uint8_t> data(dfd_offset + dfd_length);
+  memcpy(data.data(), kIdentifier, sizeof(kIdentifier));
+  Write32(data, 12, 145);  // VK_FORMAT_BC7_UNORM_BLOCK
+  Write32(data, 16, 1);
+  Write32(data, 20, width);
+  Write32(data, 24, height);
+  Write32(data, 36, 1);
+  Write32(data, 40, level_count);
+  Write32(data, 48, dfd_offset);
+  Write32(data, 52, dfd_length);
+  Write32(data, dfd_offset, dfd_length);
+  // KHR_DF_FLAG_ALPHA_PREMULTIPLIED.
+  data[dfd_offset + 15] = 1;
+
+  for (int level = level_count - 1; level >= 0; level--) {
+    // The levels are aligned to the 16 bytes of their blocks.
+    data.resize((data.size() + 15) / 16 * 16);
+    const uint32_t blocks_wide = (std::max(width >> level, 1u) + 3) / 4;
+    const uint32_t blocks_high = (std::max(height >> level, 1u) + 3) / 4;
+    const size_t length = blocks_wide * blocks_high * 16;
+    Write64(data, 80 + level * 24, data.size());
+    Write64(data, 80 + level * 24 + 8, length);
+    data.resize(data.size() + length, level);
+  }
+  return data;
+}
+
+std::unique_ptr<ImageGenerator> MakeGenerator(
+    const std::vector<uint8_t>& data) {
+  return KTX2ImageGenerator::MakeFromData(
+      SkData::MakeWithCopy(data.data(), data.size()));
+}
+
+}  // namespace
+
+TEST(ImageGeneratorKTX2Test, ParsesMipmappedTextures) {
+  auto generator = MakeGenerator(MakeKTX2(40, 20, 6));
+  ASSERT_NE(generator, nullptr);
+  auto* ktx2 = static_cast<KTX2ImageGenerator*>(generator.get());
+  EXPECT_EQ(ktx2->GetPixelFormat(), impeller::PixelFormat::kBC7UNormInt);
+  EXPECT_EQ(ktx2->GetLevelCount(), 6u);
+  EXPECT_EQ(generator->GetInfo().width(), 40);
+  EXPECT_EQ(generator->GetInfo().height(), 20);
+  EXPECT_EQ(generator->GetInfo().alphaType(), kPremul_SkAlphaType);
+  EXPECT_EQ(generator->GetFrameCount(), 1u);
+}
+
+TEST(ImageGeneratorKTX2Test, ScalesToTheSmallestLargerLevel) {
+  auto generator = MakeGenerator(MakeKTX2(40, 20, 6));
+  ASSERT_NE(generator, nullptr);
+  EXPECT_EQ(generator->GetScaledDimensions(1.0), SkISize::Make(40, 20));
+  EXPECT_EQ(generator->GetScaledDimensions(0.5), SkISize::Make(20, 10));
+  EXPECT_EQ(generator->GetScaledDimensions(0.4), SkISize::Make(20, 10));
+  EXPECT_EQ(generator->GetScaledDimensions(0.2), SkISize::Make(10, 5));
+  EXPECT_EQ(generator->GetScaledDimensions(0.01), SkISize::Make(1, 1));
+}
+
+TEST(ImageGeneratorKTX2Test, NeverDecodesOnTheCPU) {
+  auto generator = MakeGenerator(MakeKTX2(8, 8, 1));
+  ASSERT_NE(generator, nullptr);
+  std::vector<uint8_t> pixels(8 * 8 * 4);
+  EXPECT_FALSE(generator->GetPixels(generator->GetInfo(), pixels.data(),
+                                    8 * 4, 0, std::nullopt));
+}
+
+TEST(ImageGeneratorKTX2Test, RejectsUnsupportedFiles) {
+  EXPECT_EQ(MakeGenerator({}), nullptr);
+
+  std::vector<uint8_t> data = MakeKTX2(8, 8, 1);
+  data[1] = 'P';
+  EXPECT_EQ(MakeGenerator(data), nullptr);
+
+  // VK_FORMAT_R8G8B8A8_UNORM.
+  data = MakeKTX2(8, 8, 1);
+  Write32(data, 12, 37);
+  EXPECT_EQ(MakeGenerator(data), nullptr);
+
+  // Zstandard supercompression.
+  data = MakeKTX2(8, 8, 1);
+  Write32(data, 44, 2);
+  EXPECT_EQ(MakeGenerator(data), nullptr);
+
+  // Cube maps.
+  data = MakeKTX2(8, 8, 1);
+  Write32(data, 36, 6);
+  EXPECT_EQ(MakeGenerator(data), nullptr);
+
+  // Straight alpha.
+  data = MakeKTX2(8, 8, 1);
+  data[80 + 24 + 15] = 0;
+  EXPECT_EQ(MakeGenerator(data), nullptr);
+
+  // Truncated levels.
+  data = MakeKTX2(8, 8, 1);
+  data.resize(data.size() - 1);
+  EXPECT_EQ(MakeGenerator(data), nullptr);
+
+  // Levels of the wrong size.
+  data = MakeKTX2(8, 8, 1);
+  Write32(data, 20, 12);
+  EXPECT_EQ(MakeGenerator(data), nullptr);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -0,0 +1,67 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/image_tile_cache.h"
+
+#include <utility>
+
+namespace flutter {
+
+ImageTileCache::ImageTileCache(size_t max_bytes) : max_bytes_(max_bytes) {}
+
+ImageTileCache::~ImageTileCache() = default;
+
+std::list<ImageTileCache::Tile>::iterator ImageTileCache::Find(
+    const SkISize& scaled_size,
+    const SkIRect& region) {
+  for (auto it = tiles_.begin(); it != tiles_.end(); ++it) {
+    if (it->scaled_size == scaled_size && it->region == region) {
+      return it;
+    }
+  }
+  return tiles_.end();
+}
+
+sk_sp<DlImage> ImageTileCache::Get(const SkISize& scaled_size,
+                                   const SkIRect& region) {
+  auto it = Find(scaled_size, region);
+  if (it == tiles_.end()) {
+    return nullptr;
+  }
+  tiles_.splice(tiles_.begin(), tiles_, it);
+  return it->image;
+}
+
+void ImageTileCache::Put(const SkISize& scaled_size,
+                         const SkIRect& region,
+                         sk_sp<DlImage> image) {
+  if (!image) {
+    return;
+  }
+  auto it = Find(scaled_size, region);
+  if (it != tiles_.end()) {
+    bytes_ -= it->bytes;
+    tiles_.erase(it);
+  }
+  const size_t bytes = image->GetApproximateByteSize();
+  if (bytes > max_bytes_) {
+    return;
+  }
+  while (bytes_ + bytes > max_bytes_) {
+    bytes_ -= tiles_.back().bytes;
+    tiles_.pop_back();
+  }
+  tiles_.push_front({.scaled_size = scaled_size,
+                     .region = region,
+                     .image = std::move(image),
+                     .bytes = bytes});
+  bytes_ += bytes;
+}
+
+void ImageTileCache::Clear() {
+  tiles_.clear();
+  bytes_ = 0;
+}
+
+}  // namespace flutter
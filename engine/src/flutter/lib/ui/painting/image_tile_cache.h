@@ -0,0 +1,65 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_IMAGE_TILE_CACHE_H_
+#define FLUTTER_LIB_UI_PAINTING_IMAGE_TILE_CACHE_H_
+
+#include <cstddef>
+#include <list>
+
+#include "flutter/display_list/image/dl_image.h"
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkRect.h"
+#include "third_party/skia/include/core/SkSize.h"
+
+namespace flutter {
+
+/// @brief  Keeps the regions of an image that were decoded last, up to a
+///         budget of bytes, so that tiles panned back into view don't have to
+///         be decoded again. The least recently used tiles are evicted first.
+///         The cache is not thread safe.
+class ImageTileCache {
+ public:
+  static constexpr size_t kDefaultMaxBytes = 32 * 1024 * 1024;
+
+  explicit ImageTileCache(size_t max_bytes = kDefaultMaxBytes);
+
+  ~ImageTileCache();
+
+  /// @brief  Gets the tile that was decoded for `region` of the image at
+  ///         `scaled_size`, or null if it is not cached.
+  sk_sp<DlImage> Get(const SkISize& scaled_size, const SkIRect& region);
+
+  /// @brief  Caches `image` as the tile for `region` of the image at
+  ///         `scaled_size`. Tiles larger than the budget are not cached.
+  void Put(const SkISize& scaled_size,
+           const SkIRect& region,
+           sk_sp<DlImage> image);
+
+  void Clear();
+
+  size_t GetByteSize() const { return bytes_; }
+
+ private:
+  struct Tile {
+    SkISize scaled_size;
+    SkIRect region;
+    sk_sp<DlImage> image;
+    size_t bytes;
+  };
+
+  const size_t max_bytes_;
+  // The most recently used tile first.
+  std::list<Tile> tiles_;
+  size_t bytes_ = 0;
+
+  std::list<Tile>::iterator Find(const SkISize& scaled_size,
+                                 const SkIRect& region);
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ImageTileCache);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_IMAGE_TILE_CACHE_H_
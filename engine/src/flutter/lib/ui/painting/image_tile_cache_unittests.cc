@@ -0,0 +1,84 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/image_tile_cache.h"
+
+#include "flutter/lib/ui/painting/testing/mocks.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+sk_sp<DlImage> MakeImage(size_t bytes) {
+  auto image = sk_make_sp<::testing::NiceMock<MockDlImage>>();
+  ON_CALL(*image, GetApproximateByteSize())
+      .WillByDefault(::testing::Return(bytes));
+  return image;
+}
+
+constexpr SkISize kScaledSize = SkISize::Make(1000, 1000);
+
+SkIRect Tile(int x, int y) {
+  return SkIRect::MakeXYWH(x * 100, y * 100, 100, 100);
+}
+
+}  // namespace
+
+TEST(ImageTileCacheTest, GetsTilesThatWerePut) {
+  ImageTileCache cache(1000);
+  sk_sp<DlImage> image = MakeImage(100);
+  cache.Put(kScaledSize, Tile(0, 0), image);
+
+  EXPECT_EQ(cache.Get(kScaledSize, Tile(0, 0)), image);
+  EXPECT_EQ(cache.Get(kScaledSize, Tile(1, 0)), nullptr);
+  EXPECT_EQ(cache.Get(SkISize::Make(500, 500), Tile(0, 0)), nullptr);
+  EXPECT_EQ(cache.GetByteSize(), 100u);
+
+  cache.Clear();
+  EXPECT_EQ(cache.Get(kScaledSize, Tile(0, 0)), nullptr);
+  EXPECT_EQ(cache.GetByteSize(), 0u);
+}
+
+TEST(ImageTileCacheTest, EvictsLeastRecentlyUsedTiles) {
+  ImageTileCache cache(300);
+  cache.Put(kScaledSize, Tile(0, 0), MakeImage(100));
+  cache.Put(kScaledSize, Tile(1, 0), MakeImage(100));
+  cache.Put(kScaledSize, Tile(2, 0), MakeImage(100));
+
+  // Makes the first tile the most recently used one.
+  EXPECT_NE(cache.Get(kScaledSize, Tile(0, 0)), nullptr);
+  cache.Put(kScaledSize, Tile(3, 0), MakeImage(150));
+
+  EXPECT_NE(cache.Get(kScaledSize, Tile(0, 0)), nullptr);
+  EXPECT_EQ(cache.Get(kScaledSize, Tile(1, 0)), nullptr);
+  EXPECT_EQ(cache.Get(kScaledSize, Tile(2, 0)), nullptr);
+  EXPECT_NE(cache.Get(kScaledSize, Tile(3, 0)), nullptr);
+  EXPECT_EQ(cache.GetByteSize(), 250u);
+}
+
+TEST(ImageTileCacheTest, DoesNotCacheTilesLargerThanTheBudget) {
+  ImageTileCache cache(300);
+  cache.Put(kScaledSize, Tile(0, 0), MakeImage(100));
+  cache.Put(kScaledSize, Tile(1, 0), MakeImage(400));
+
+  EXPECT_NE(cache.Get(kScaledSize, Tile(0, 0)), nullptr);
+  EXPECT_EQ(cache.Get(kScaledSize, Tile(1, 0)), nullptr);
+  EXPECT_EQ(cache.GetByteSize(), 100u);
+}
+
+TEST(ImageTileCacheTest, ReplacesTilesThatArePutAgain) {
+  ImageTileCache cache(300);
+  cache.Put(kScaledSize, Tile(0, 0), MakeImage(100));
+  sk_sp<DlImage> image = MakeImage(200);
+  cache.Put(kScaledSize, Tile(0, 0), image);
+
+  EXPECT_EQ(cache.Get(kScaledSize, Tile(0, 0)), image);
+  EXPECT_EQ(cache.GetByteSize(), 200u);
+}
+
+}  // namespace testing
+}  // namespace flutter
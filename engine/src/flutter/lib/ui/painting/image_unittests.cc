@@ -0,0 +1,29 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/image.h"
+
+#include "flutter/lib/ui/painting/testing/mocks.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(CanvasImageTest, AllocationSizeIncludesTheImage) {
+  auto image = CanvasImage::Create();
+  const size_t empty_size = image->GetAllocationSize();
+  constexpr size_t kImageBytes = 4 * 1024 * 1024;
+
+  auto dl_image = sk_make_sp<::testing::NiceMock<MockDlImage>>();
+  ON_CALL(*dl_image, isUIThreadSafe()).WillByDefault(::testing::Return(true));
+  ON_CALL(*dl_image, GetApproximateByteSize())
+      .WillByDefault(::testing::Return(kImageBytes));
+  image->set_image(dl_image);
+
+  EXPECT_EQ(image->GetAllocationSize(), empty_size + kImageBytes);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -108,8 +108,7 @@ Dart_Handle ImmutableBuffer::initFromAsset(Dart_Handle raw_buffer_handle,
         size_t buffer_size = 0;
         if (mapping != nullptr) {
           buffer_size = mapping->GetSize();
-          const void* bytes = static_cast<const void*>(mapping->GetMapping());
-          sk_data = MakeSkDataWithCopy(bytes, buffer_size);
+          sk_data = MakeSkDataFromMapping(std::move(mapping));
         }
         ui_task_runner->PostTask(
             [sk_data = std::move(sk_data), ui_task = ui_task, buffer_size]() {
@@ -178,8 +177,7 @@ Dart_Handle ImmutableBuffer::initFromFile(Dart_Handle raw_buffer_handle,
         size_t buffer_size = 0;
         if (mapping->IsValid()) {
           buffer_size = mapping->GetSize();
-          const void* bytes = static_cast<const void*>(mapping->GetMapping());
-          sk_data = MakeSkDataWithCopy(bytes, buffer_size);
+          sk_data = MakeSkDataFromMapping(std::move(mapping));
         }
         ui_task_runner->PostTask(
             [sk_data = std::move(sk_data), ui_task = ui_task, buffer_size]() {
@@ -189,6 +187,23 @@ Dart_Handle ImmutableBuffer::initFromFile(Dart_Handle raw_buffer_handle,
   return Dart_Null();
 }
 
+sk_sp<SkData> ImmutableBuffer::MakeSkDataFromMapping(
+    std::unique_ptr<fml::Mapping> mapping) {
+  if (mapping->GetSize() == 0 || mapping->GetMapping() == nullptr) {
+    return SkData::MakeEmpty();
+  }
+  if (!mapping->IsDontNeedSafe()) {
+    return MakeSkDataWithCopy(mapping->GetMapping(), mapping->GetSize());
+  }
+
+  const uint8_t* bytes = mapping->GetMapping();
+  const size_t length = mapping->GetSize();
+  SkData::ReleaseProc proc = [](const void* ptr, void* context) {
+    delete reinterpret_cast<fml::Mapping*>(context);
+  };
+  return SkData::MakeWithProc(bytes, length, proc, mapping.release());
+}
+
 #if FML_OS_ANDROID
 
 // Compressed image buffers are allocated on the UI thread but are deleted on a
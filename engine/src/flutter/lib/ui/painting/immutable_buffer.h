@@ -8,6 +8,7 @@
 #include <cstdint>
 
 #include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
 #include "flutter/lib/ui/dart_wrapper.h"
 #include "third_party/skia/include/core/SkData.h"
 #include "third_party/tonic/dart_library_natives.h"
@@ -52,6 +53,9 @@ class ImmutableBuffer : public RefCountedDartWrappable<ImmutableBuffer> {
   ///
   /// The second indexed argument is expected to be a void callback to signal
   /// when the copy has completed.
+  ///
+  /// Assets that are mapped from files are not copied: the buffer holds the
+  /// mapping until it is released.
   static Dart_Handle initFromAsset(Dart_Handle buffer_handle,
                                    Dart_Handle asset_name_handle,
                                    Dart_Handle callback_handle);
@@ -66,6 +70,9 @@ class ImmutableBuffer : public RefCountedDartWrappable<ImmutableBuffer> {
   ///
   /// The second indexed argument is expected to be a void callback to signal
   /// when the copy has completed.
+  ///
+  /// The file is mapped rather than copied, and the buffer holds the mapping
+  /// until it is released.
   static Dart_Handle initFromFile(Dart_Handle buffer_handle,
                                   Dart_Handle file_path_handle,
                                   Dart_Handle callback_handle);
@@ -96,6 +103,13 @@ class ImmutableBuffer : public RefCountedDartWrappable<ImmutableBuffer> {
 
   static sk_sp<SkData> MakeSkDataWithCopy(const void* data, size_t length);
 
+  /// Wraps the bytes of `mapping` without copying them if the mapping is
+  /// backed by a file, in which case the returned data owns the mapping.
+  /// Other mappings are copied with |MakeSkDataWithCopy|, as their memory
+  /// may be tied to the thread or allocator that produced them.
+  static sk_sp<SkData> MakeSkDataFromMapping(
+      std::unique_ptr<fml::Mapping> mapping);
+
   DEFINE_WRAPPERTYPEINFO();
   FML_FRIEND_MAKE_REF_COUNTED(ImmutableBuffer);
   FML_DISALLOW_COPY_AND_ASSIGN(ImmutableBuffer);
@@ -10,12 +10,12 @@
 #include "flutter/fml/make_copyable.h"
 #include "flutter/lib/ui/painting/display_list_image_gpu.h"
 #include "flutter/lib/ui/painting/image.h"
+#include "flutter/lib/ui/painting/image_decoder.h"
 #if IMPELLER_SUPPORTS_RENDERING
 #include "flutter/impeller/renderer/context.h"
 #include "flutter/lib/ui/painting/image_decoder_impeller.h"
 #endif  // IMPELLER_SUPPORTS_RENDERING
 #include "third_party/dart/runtime/include/dart_api.h"
-#include "third_party/skia/include/codec/SkCodecAnimation.h"
 #include "third_party/skia/include/core/SkImage.h"
 #include "third_party/skia/include/core/SkPixelRef.h"
 #include "third_party/skia/include/gpu/ganesh/SkImageGanesh.h"
@@ -24,18 +24,32 @@
 namespace flutter {
 
 MultiFrameCodec::MultiFrameCodec(std::shared_ptr<ImageGenerator> generator)
-    : state_(new State(std::move(generator))) {}
+    : state_(new State(
+          std::make_shared<AnimatedFrameCache>(std::move(generator)))) {}
+
+MultiFrameCodec::MultiFrameCodec(std::shared_ptr<ImageGenerator> generator,
+                                 const sk_sp<SkData>& data)
+    : state_(new State(AnimatedFrameCache::ForData(data,
+                                                   std::move(generator)))) {}
 
 MultiFrameCodec::~MultiFrameCodec() = default;
 
-MultiFrameCodec::State::State(std::shared_ptr<ImageGenerator> generator)
-    : generator_(std::move(generator)),
-      frameCount_(generator_->GetFrameCount()),
-      repetitionCount_(generator_->GetPlayCount() ==
-                               ImageGenerator::kInfinitePlayCount
-                           ? -1
-                           : generator_->GetPlayCount() - 1),
-      is_impeller_enabled_(UIDartState::Current()->IsImpellerEnabled()) {}
+MultiFrameCodec::State::State(std::shared_ptr<AnimatedFrameCache> frames)
+    : frames_(std::move(frames)),
+      frameCount_(frames_->GetFrameCount()),
+      repetitionCount_(frames_->GetRepetitionCount()),
+      is_impeller_enabled_(UIDartState::Current()->IsImpellerEnabled()) {
+  auto* dart_state = UIDartState::Current();
+  if (auto image_decoder = dart_state->GetImageDecoder()) {
+    lookahead_ = image_decoder->GetAnimatedImageLookaheadFrames();
+  }
+  concurrent_task_runner_ = dart_state->GetConcurrentTaskRunner();
+  frames_->AddClient(lookahead_);
+}
+
+MultiFrameCodec::State::~State() {
+  frames_->RemoveClient(lookahead_);
+}
 
 static void InvokeNextFrameCallback(
     const fml::RefPtr<CanvasImage>& image,
@@ -55,94 +69,14 @@ static void InvokeNextFrameCallback(
                      tonic::ToDart(decode_error)});
 }
 
-std::pair<sk_sp<DlImage>, std::string>
-MultiFrameCodec::State::GetNextFrameImage(
+std::pair<sk_sp<DlImage>, std::string> MultiFrameCodec::State::UploadFrame(
+    const SkBitmap& frame_bitmap,
     const fml::WeakPtr<GrDirectContext>& resourceContext,
     const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
     const std::shared_ptr<impeller::Context>& impeller_context,
     const fml::RefPtr<flutter::SkiaUnrefQueue>& unref_queue) {
-  SkBitmap bitmap = SkBitmap();
-  SkImageInfo info = generator_->GetInfo().makeColorType(kN32_SkColorType);
-  if (info.alphaType() == kUnpremul_SkAlphaType) {
-    SkImageInfo updated = info.makeAlphaType(kPremul_SkAlphaType);
-    info = updated;
-  }
-  if (!bitmap.tryAllocPixels(info)) {
-    std::ostringstream ostr;
-    ostr << "Failed to allocate memory for bitmap of size "
-         << info.computeMinByteSize() << "B";
-    std::string decode_error = ostr.str();
-    FML_LOG(ERROR) << decode_error;
-    return std::make_pair(nullptr, decode_error);
-  }
-
-  ImageGenerator::FrameInfo frameInfo =
-      generator_->GetFrameInfo(nextFrameIndex_);
-
-  const int requiredFrameIndex =
-      frameInfo.required_frame.value_or(SkCodec::kNoFrame);
-
-  if (requiredFrameIndex != SkCodec::kNoFrame) {
-    // We are here when the frame said |disposal_method| is
-    // `DisposalMethod::kKeep` or `DisposalMethod::kRestorePrevious` and
-    // |requiredFrameIndex| is set to ex-frame or ex-ex-frame.
-    if (!lastRequiredFrame_.has_value()) {
-      FML_DLOG(INFO)
-          << "Frame " << nextFrameIndex_ << " depends on frame "
-          << requiredFrameIndex
-          << " and no required frames are cached. Using blank slate instead.";
-    } else {
-      // Copy the previous frame's output buffer into the current frame as the
-      // starting point.
-      bitmap.writePixels(lastRequiredFrame_->pixmap());
-      if (restoreBGColorRect_.has_value()) {
-        bitmap.erase(SK_ColorTRANSPARENT, restoreBGColorRect_.value());
-      }
-    }
-  }
-
-  // Write the new frame to the output buffer. The bitmap pixels as supplied
-  // are already set in accordance with the previous frame's disposal policy.
-  if (!generator_->GetPixels(info, bitmap.getPixels(), bitmap.rowBytes(),
-                             nextFrameIndex_, requiredFrameIndex)) {
-    std::ostringstream ostr;
-    ostr << "Could not getPixels for frame " << nextFrameIndex_;
-    std::string decode_error = ostr.str();
-    FML_LOG(ERROR) << decode_error;
-    return std::make_pair(nullptr, decode_error);
-  }
-
-  const bool keep_current_frame =
-      frameInfo.disposal_method == SkCodecAnimation::DisposalMethod::kKeep;
-  const bool restore_previous_frame =
-      frameInfo.disposal_method ==
-      SkCodecAnimation::DisposalMethod::kRestorePrevious;
-  const bool previous_frame_available = lastRequiredFrame_.has_value();
-
-  // Store the current frame in `lastRequiredFrame_` if the frame's disposal
-  // method indicates we should do so.
-  // * When the disposal method is "Keep", the stored frame should always be
-  //   overwritten with the new frame we just crafted.
-  // * When the disposal method is "RestorePrevious", the previously stored
-  //   frame should be retained and used as the backdrop for the next frame
-  //   again. If there isn't already a stored frame, that means we haven't
-  //   rendered any frames yet! When this happens, we just fall back to "Keep"
-  //   behavior and store the current frame as the backdrop of the next frame.
-
-  if (keep_current_frame ||
-      (previous_frame_available && !restore_previous_frame)) {
-    // Replace the stored frame. The `lastRequiredFrame_` will get used as the
-    // starting backdrop for the next frame.
-    lastRequiredFrame_ = bitmap;
-    lastRequiredFrameIndex_ = nextFrameIndex_;
-  }
-
-  if (frameInfo.disposal_method ==
-      SkCodecAnimation::DisposalMethod::kRestoreBGColor) {
-    restoreBGColorRect_ = frameInfo.disposal_rect;
-  } else {
-    restoreBGColorRect_.reset();
-  }
+  SkBitmap bitmap = frame_bitmap;
+  const SkImageInfo& info = bitmap.info();
 
 #if IMPELLER_SUPPORTS_RENDERING
   if (is_impeller_enabled_) {
@@ -245,14 +179,41 @@ void MultiFrameCodec::State::GetNextFrameAndInvokeCallback(
   int duration = 0;
   sk_sp<DlImage> dlImage;
   std::string decode_error;
-  std::tie(dlImage, decode_error) = GetNextFrameImage(
-      resourceContext, gpu_disable_sync_switch, impeller_context, unref_queue);
+  // The textures a frame is uploaded to are shared by the codecs that upload
+  // with the same context.
+  const void* upload_context =
+      is_impeller_enabled_ ? static_cast<const void*>(impeller_context.get())
+                           : static_cast<const void*>(resourceContext.get());
+  auto [frame, frame_error] =
+      frames_->GetFrame(nextFrameIndex_, upload_context);
+  if (frame.has_value()) {
+    dlImage = frame->image;
+    if (!dlImage) {
+      std::tie(dlImage, decode_error) =
+          UploadFrame(frame->bitmap, resourceContext, gpu_disable_sync_switch,
+                      impeller_context, unref_queue);
+      // Images that were not uploaded, such as when the GPU is unavailable,
+      // are not shared so that the next codecs try to upload the frame.
+      if (dlImage && dlImage->isTextureBacked()) {
+        frames_->SetUploadedImage(nextFrameIndex_, upload_context, dlImage);
+      }
+    }
+  } else {
+    decode_error = std::move(frame_error);
+  }
   if (dlImage) {
     image = CanvasImage::Create();
     image->set_image(dlImage);
-    ImageGenerator::FrameInfo frameInfo =
-        generator_->GetFrameInfo(nextFrameIndex_);
-    duration = frameInfo.duration;
+    duration = frame->duration;
+  }
+  if (lookahead_ > 0 && concurrent_task_runner_) {
+    concurrent_task_runner_->PostTask(
+        [weak_frames = std::weak_ptr<AnimatedFrameCache>(frames_),
+         index = nextFrameIndex_, count = lookahead_]() {
+          if (auto frames = weak_frames.lock()) {
+            frames->DecodeAhead(index, count);
+          }
+        });
   }
   nextFrameIndex_ = (nextFrameIndex_ + 1) % frameCount_;
 
@@ -6,6 +6,7 @@
 #define FLUTTER_LIB_UI_PAINTING_MULTI_FRAME_CODEC_H_
 
 #include "flutter/fml/macros.h"
+#include "flutter/lib/ui/painting/animated_frame_cache.h"
 #include "flutter/lib/ui/painting/codec.h"
 #include "flutter/lib/ui/painting/image_generator.h"
 
@@ -17,6 +18,14 @@ class MultiFrameCodec : public Codec {
  public:
   explicit MultiFrameCodec(std::shared_ptr<ImageGenerator> generator);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Creates a codec that shares the decoded frames with the other
+  ///             codecs for the same encoded `data`, see
+  ///             |AnimatedFrameCache|.
+  ///
+  MultiFrameCodec(std::shared_ptr<ImageGenerator> generator,
+                  const sk_sp<SkData>& data);
+
   ~MultiFrameCodec() override;
 
   // |Codec|
@@ -39,27 +48,27 @@ class MultiFrameCodec : public Codec {
   // shares it with the IO task runner's decoding work, and sets the live_
   // member to false when it is destructed.
   struct State {
-    explicit State(std::shared_ptr<ImageGenerator> generator);
+    explicit State(std::shared_ptr<AnimatedFrameCache> frames);
+
+    ~State();
 
-    const std::shared_ptr<ImageGenerator> generator_;
+    // The decoded frames, which may be shared with other codecs.
+    const std::shared_ptr<AnimatedFrameCache> frames_;
     const int frameCount_;
     const int repetitionCount_;
     bool is_impeller_enabled_ = false;
+    // How many frames after the next frame are decoded on the concurrent
+    // task runner while the next frame is shown.
+    int lookahead_ = 0;
+    std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_task_runner_;
 
     // The non-const members and functions below here are only read or written
     // to on the IO thread. They are not safe to access or write on the UI
     // thread.
     int nextFrameIndex_ = 0;
-    // The last decoded frame that's required to decode any subsequent frames.
-    std::optional<SkBitmap> lastRequiredFrame_;
-    // The index of the last decoded required frame.
-    int lastRequiredFrameIndex_ = -1;
-
-    // The rectangle that should be cleared if the previous frame's disposal
-    // method was kRestoreBGColor.
-    std::optional<SkIRect> restoreBGColorRect_;
 
-    std::pair<sk_sp<DlImage>, std::string> GetNextFrameImage(
+    std::pair<sk_sp<DlImage>, std::string> UploadFrame(
+        const SkBitmap& bitmap,
         const fml::WeakPtr<GrDirectContext>& resourceContext,
         const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
         const std::shared_ptr<impeller::Context>& impeller_context,
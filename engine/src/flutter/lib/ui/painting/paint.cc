@@ -61,9 +61,9 @@ constexpr float kStrokeMiterLimitDefault = 4.0f;
 enum MaskFilterType { kNull, kBlur };
 
 namespace {
-DlColor ReadColor(const tonic::DartByteData& byte_data) {
-  const uint32_t* uint_data = static_cast<const uint32_t*>(byte_data.data());
-  const float* float_data = static_cast<const float*>(byte_data.data());
+DlColor ReadColor(const void* data) {
+  const uint32_t* uint_data = static_cast<const uint32_t*>(data);
+  const float* float_data = static_cast<const float*>(data);
 
   float red = float_data[kColorRedIndex];
   float green = float_data[kColorGreenIndex];
@@ -77,14 +77,92 @@ DlColor ReadColor(const tonic::DartByteData& byte_data) {
 
   return dl_color.withColorSpace(DlColorSpace::kExtendedSRGB);
 }
+
+void ClearObjects(DlPaint& paint, const DisplayListAttributeFlags& flags) {
+  if (flags.applies_shader()) {
+    paint.setColorSource(nullptr);
+  }
+  if (flags.applies_color_filter()) {
+    paint.setColorFilter(nullptr);
+  }
+  if (flags.applies_image_filter()) {
+    paint.setImageFilter(nullptr);
+  }
+}
+
+void ReadData(DlPaint& paint,
+              const DisplayListAttributeFlags& flags,
+              const void* data) {
+  const uint32_t* uint_data = static_cast<const uint32_t*>(data);
+  const float* float_data = static_cast<const float*>(data);
+
+  if (flags.applies_anti_alias()) {
+    paint.setAntiAlias(uint_data[kIsAntiAliasIndex] == 0);
+  }
+
+  if (flags.applies_alpha_or_color()) {
+    paint.setColor(ReadColor(data));
+  }
+
+  if (flags.applies_blend()) {
+    uint32_t encoded_blend_mode = uint_data[kBlendModeIndex];
+    uint32_t blend_mode = encoded_blend_mode ^ kBlendModeDefault;
+    paint.setBlendMode(static_cast<DlBlendMode>(blend_mode));
+  }
+
+  if (flags.applies_style()) {
+    uint32_t style = uint_data[kStyleIndex];
+    paint.setDrawStyle(static_cast<DlDrawStyle>(style));
+  }
+
+  if (flags.is_stroked(paint.getDrawStyle())) {
+    float stroke_width = float_data[kStrokeWidthIndex];
+    paint.setStrokeWidth(stroke_width);
+
+    float stroke_miter_limit = float_data[kStrokeMiterLimitIndex];
+    paint.setStrokeMiter(stroke_miter_limit + kStrokeMiterLimitDefault);
+
+    uint32_t stroke_cap = uint_data[kStrokeCapIndex];
+    paint.setStrokeCap(static_cast<DlStrokeCap>(stroke_cap));
+
+    uint32_t stroke_join = uint_data[kStrokeJoinIndex];
+    paint.setStrokeJoin(static_cast<DlStrokeJoin>(stroke_join));
+  }
+
+  if (flags.applies_color_filter()) {
+    paint.setInvertColors(uint_data[kInvertColorIndex] != 0);
+  }
+
+  if (flags.applies_mask_filter()) {
+    switch (uint_data[kMaskFilterIndex]) {
+      case kNull:
+        paint.setMaskFilter(nullptr);
+        break;
+      case kBlur:
+        DlBlurStyle blur_style =
+            static_cast<DlBlurStyle>(uint_data[kMaskFilterBlurStyleIndex]);
+        double sigma = float_data[kMaskFilterSigmaIndex];
+        paint.setMaskFilter(
+            DlBlurMaskFilter::Make(blur_style, SafeNarrow(sigma)));
+        break;
+    }
+  }
+}
 }  // namespace
 
 Paint::Paint(Dart_Handle paint_objects, Dart_Handle paint_data)
     : paint_objects_(paint_objects), paint_data_(paint_data) {}
 
+Paint::Paint(const uint8_t* paint_data) : data_(paint_data) {}
+
 const DlPaint* Paint::paint(DlPaint& paint,
                             const DisplayListAttributeFlags& flags,
                             DlTileMode tile_mode) const {
+  if (data_) {
+    ClearObjects(paint, flags);
+    ReadData(paint, flags, data_);
+    return &paint;
+  }
   if (isNull()) {
     return nullptr;
   }
@@ -92,19 +170,10 @@ const DlPaint* Paint::paint(DlPaint& paint,
   FML_CHECK(byte_data.length_in_bytes() == kDataByteCount);
 
   const uint32_t* uint_data = static_cast<const uint32_t*>(byte_data.data());
-  const float* float_data = static_cast<const float*>(byte_data.data());
 
   Dart_Handle values[kObjectCount];
   if (Dart_IsNull(paint_objects_)) {
-    if (flags.applies_shader()) {
-      paint.setColorSource(nullptr);
-    }
-    if (flags.applies_color_filter()) {
-      paint.setColorFilter(nullptr);
-    }
-    if (flags.applies_image_filter()) {
-      paint.setImageFilter(nullptr);
-    }
+    ClearObjects(paint, flags);
   } else {
     FML_DCHECK(Dart_IsList(paint_objects_));
     intptr_t length = 0;
@@ -154,58 +223,7 @@ const DlPaint* Paint::paint(DlPaint& paint,
     }
   }
 
-  if (flags.applies_anti_alias()) {
-    paint.setAntiAlias(uint_data[kIsAntiAliasIndex] == 0);
-  }
-
-  if (flags.applies_alpha_or_color()) {
-    paint.setColor(ReadColor(byte_data));
-  }
-
-  if (flags.applies_blend()) {
-    uint32_t encoded_blend_mode = uint_data[kBlendModeIndex];
-    uint32_t blend_mode = encoded_blend_mode ^ kBlendModeDefault;
-    paint.setBlendMode(static_cast<DlBlendMode>(blend_mode));
-  }
-
-  if (flags.applies_style()) {
-    uint32_t style = uint_data[kStyleIndex];
-    paint.setDrawStyle(static_cast<DlDrawStyle>(style));
-  }
-
-  if (flags.is_stroked(paint.getDrawStyle())) {
-    float stroke_width = float_data[kStrokeWidthIndex];
-    paint.setStrokeWidth(stroke_width);
-
-    float stroke_miter_limit = float_data[kStrokeMiterLimitIndex];
-    paint.setStrokeMiter(stroke_miter_limit + kStrokeMiterLimitDefault);
-
-    uint32_t stroke_cap = uint_data[kStrokeCapIndex];
-    paint.setStrokeCap(static_cast<DlStrokeCap>(stroke_cap));
-
-    uint32_t stroke_join = uint_data[kStrokeJoinIndex];
-    paint.setStrokeJoin(static_cast<DlStrokeJoin>(stroke_join));
-  }
-
-  if (flags.applies_color_filter()) {
-    paint.setInvertColors(uint_data[kInvertColorIndex] != 0);
-  }
-
-  if (flags.applies_mask_filter()) {
-    switch (uint_data[kMaskFilterIndex]) {
-      case kNull:
-        paint.setMaskFilter(nullptr);
-        break;
-      case kBlur:
-        DlBlurStyle blur_style =
-            static_cast<DlBlurStyle>(uint_data[kMaskFilterBlurStyleIndex]);
-        double sigma = float_data[kMaskFilterSigmaIndex];
-        paint.setMaskFilter(
-            DlBlurMaskFilter::Make(blur_style, SafeNarrow(sigma)));
-        break;
-    }
-  }
-
+  ReadData(paint, flags, byte_data.data());
   return &paint;
 }
 
@@ -15,16 +15,22 @@ class Paint {
  public:
   Paint(Dart_Handle paint_objects, Dart_Handle paint_data);
 
+  // A paint without any objects, whose data is read from the bytes of its
+  // `_data` in place. Unlike the handles, this may be used in leaf calls, as
+  // it never calls into the Dart API.
+  explicit Paint(const uint8_t* paint_data);
+
   const DlPaint* paint(DlPaint& paint,
                        const DisplayListAttributeFlags& flags,
                        DlTileMode tile_mode) const;
 
-  bool isNull() const { return Dart_IsNull(paint_data_); }
-  bool isNotNull() const { return !Dart_IsNull(paint_data_); }
+  bool isNull() const { return !data_ && Dart_IsNull(paint_data_); }
+  bool isNotNull() const { return !isNull(); }
 
  private:
-  Dart_Handle paint_objects_;
-  Dart_Handle paint_data_;
+  Dart_Handle paint_objects_ = nullptr;
+  Dart_Handle paint_data_ = nullptr;
+  const uint8_t* data_ = nullptr;
 };
 
 }  // namespace flutter
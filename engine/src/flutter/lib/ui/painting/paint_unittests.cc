@@ -70,5 +70,68 @@ TEST_F(ShellTest, ConvertPaintToDlPaint) {
   EXPECT_EQ(dl_paint.getDrawStyle(), DlDrawStyle::kStroke);
 }
 
+TEST_F(ShellTest, ConvertPaintDataToDlPaint) {
+  auto message_latch = std::make_shared<fml::AutoResetWaitableEvent>();
+  DlPaint dl_paint;
+  dl_paint.setColorFilter(
+      DlColorFilter::MakeBlend(DlColor(0x55667788), DlBlendMode::kXor));
+
+  auto nativeToDlPaint = [message_latch, &dl_paint](Dart_NativeArguments args) {
+    Dart_Handle dart_paint = Dart_GetNativeArgument(args, 0);
+    Dart_Handle paint_data = Dart_GetField(dart_paint, tonic::ToDart("_data"));
+    Dart_TypedData_Type type;
+    void* data = nullptr;
+    intptr_t length = 0;
+    if (Dart_IsError(
+            Dart_TypedDataAcquireData(paint_data, &type, &data, &length))) {
+      ADD_FAILURE() << "could not acquire the paint data";
+      message_latch->Signal();
+      return;
+    }
+    Paint ui_paint(static_cast<const uint8_t*>(data));
+
+    ui_paint.paint(dl_paint, DisplayListOpFlags::kDrawRectFlags,
+                   DlTileMode::kClamp);
+    Dart_TypedDataReleaseData(paint_data);
+    message_latch->Signal();
+  };
+
+  Settings settings = CreateSettingsForFixture();
+  TaskRunners task_runners("test",                  // label
+                           GetCurrentTaskRunner(),  // platform
+                           CreateNewThread(),       // raster
+                           CreateNewThread(),       // ui
+                           CreateNewThread()        // io
+  );
+
+  AddNativeCallback("ConvertPaintDataToDlPaint",
+                    CREATE_NATIVE_ENTRY(nativeToDlPaint));
+
+  std::unique_ptr<Shell> shell = CreateShell(settings, task_runners);
+
+  ASSERT_TRUE(shell->IsSetup());
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  configuration.SetEntrypoint("convertPaintDataToDlPaint");
+
+  shell->RunEngine(std::move(configuration), [](auto result) {
+    ASSERT_EQ(result, Engine::RunStatus::Success);
+  });
+
+  message_latch->Wait();
+  DestroyShell(std::move(shell), task_runners);
+
+  EXPECT_EQ(dl_paint.getBlendMode(), DlBlendMode::kModulate);
+  EXPECT_EQ(static_cast<uint32_t>(dl_paint.getColor().argb()), 0x11223344u);
+  // The paint has no objects, so the filter it replaces is cleared.
+  EXPECT_EQ(dl_paint.getColorFilter(), nullptr);
+  if (dl_paint.getMaskFilter()) {
+    EXPECT_EQ(*dl_paint.getMaskFilter(),
+              DlBlurMaskFilter(DlBlurStyle::kInner, 0.75));
+  } else {
+    FAIL() << "mask filter was nullptr";
+  }
+  EXPECT_EQ(dl_paint.getDrawStyle(), DlDrawStyle::kStroke);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -34,6 +34,9 @@ CanvasPath::~CanvasPath() = default;
 
 void CanvasPath::resetVolatility() {
   dl_path_.reset();
+  for (auto& measures : contour_measures_) {
+    measures.reset();
+  }
 }
 
 int CanvasPath::getFillType() {
@@ -348,4 +351,17 @@ const DlPath& CanvasPath::path() const {
   return dl_path_.value();
 }
 
+const std::vector<sk_sp<SkContourMeasure>>& CanvasPath::contour_measures(
+    bool force_closed) const {
+  auto& measures = contour_measures_[force_closed ? 1 : 0];
+  if (!measures.has_value()) {
+    measures.emplace();
+    SkContourMeasureIter iter(path().GetSkPath(), force_closed);
+    while (sk_sp<SkContourMeasure> measure = iter.next()) {
+      measures->push_back(std::move(measure));
+    }
+  }
+  return measures.value();
+}
+
 }  // namespace flutter
@@ -5,10 +5,14 @@
 #ifndef FLUTTER_LIB_UI_PAINTING_PATH_H_
 #define FLUTTER_LIB_UI_PAINTING_PATH_H_
 
+#include <optional>
+#include <vector>
+
 #include "flutter/lib/ui/dart_wrapper.h"
 #include "flutter/lib/ui/painting/rrect.h"
 #include "flutter/lib/ui/painting/rsuperellipse.h"
 #include "flutter/lib/ui/ui_dart_state.h"
+#include "third_party/skia/include/core/SkContourMeasure.h"
 #include "third_party/skia/include/core/SkPath.h"
 #include "third_party/skia/include/core/SkPathBuilder.h"
 #include "third_party/skia/include/pathops/SkPathOps.h"
@@ -118,11 +122,20 @@ class CanvasPath : public RefCountedDartWrappable<CanvasPath> {
 
   const DlPath& path() const;
 
+  // The measures of all contours of the path. They are computed on the first
+  // call and kept until the path is mutated, so that measuring a static path
+  // every frame doesn't walk its segments again.
+  const std::vector<sk_sp<SkContourMeasure>>& contour_measures(
+      bool force_closed) const;
+
  private:
   CanvasPath();
 
   SkPathBuilder sk_path_;
   mutable std::optional<const DlPath> dl_path_;
+  // Indexed by whether the contours are measured as closed.
+  mutable std::optional<std::vector<sk_sp<SkContourMeasure>>>
+      contour_measures_[2];
 
   // Must be called whenever the path is created or mutated.
   void resetVolatility();
@@ -27,12 +27,7 @@ void CanvasPathMeasure::Create(Dart_Handle wrapper,
   fml::RefPtr<CanvasPathMeasure> pathMeasure =
       fml::MakeRefCounted<CanvasPathMeasure>();
   if (path) {
-    const SkPath& skPath = path->path().GetSkPath();
-    SkScalar resScale = 1;
-    pathMeasure->path_measure_ =
-        std::make_unique<SkContourMeasureIter>(skPath, forceClosed, resScale);
-  } else {
-    pathMeasure->path_measure_ = std::make_unique<SkContourMeasureIter>();
+    pathMeasure->path_measures_ = path->contour_measures(forceClosed);
   }
   pathMeasure->AssociateWithDartWrapper(wrapper);
 }
@@ -42,7 +37,8 @@ CanvasPathMeasure::CanvasPathMeasure() {}
 CanvasPathMeasure::~CanvasPathMeasure() {}
 
 void CanvasPathMeasure::setPath(const CanvasPath* path, bool isClosed) {
-  path_measure_->reset(path->path().GetSkPath(), isClosed);
+  path_measures_ = path->contour_measures(isClosed);
+  next_contour_ = 0u;
 }
 
 double CanvasPathMeasure::getLength(int contour_index) {
@@ -86,6 +82,7 @@ void CanvasPathMeasure::getSegment(Dart_Handle path_handle,
   if (static_cast<std::vector<sk_sp<SkContourMeasure>>::size_type>(
           contour_index) >= measures_.size()) {
     CanvasPath::Create(path_handle);
+    return;
   }
   SkPath dst;
   bool success = measures_[contour_index]->getSegment(
@@ -106,9 +103,8 @@ bool CanvasPathMeasure::isClosed(int contour_index) {
 }
 
 bool CanvasPathMeasure::nextContour() {
-  auto measure = path_measure_->next();
-  if (measure) {
-    measures_.push_back(std::move(measure));
+  if (next_contour_ < path_measures_.size()) {
+    measures_.push_back(path_measures_[next_contour_++]);
     return true;
   }
   return false;
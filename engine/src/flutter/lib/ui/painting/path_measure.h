@@ -10,11 +10,11 @@
 #include "flutter/lib/ui/dart_wrapper.h"
 #include "flutter/lib/ui/painting/path.h"
 #include "third_party/skia/include/core/SkContourMeasure.h"
-#include "third_party/skia/include/core/SkPath.h"
 #include "third_party/tonic/typed_data/typed_list.h"
 
-// Be sure that the client doesn't modify a path on us before Skia finishes
-// See AOSP's reasoning in PathMeasure.cpp
+// The contour measures are taken from the path when the measure is created,
+// so later modifications of the path don't affect it. See AOSP's reasoning in
+// PathMeasure.cpp
 
 namespace flutter {
 
@@ -39,12 +39,13 @@ class CanvasPathMeasure : public RefCountedDartWrappable<CanvasPathMeasure> {
   bool isClosed(int contour_index);
   bool nextContour();
 
-  const SkContourMeasureIter& pathMeasure() const { return *path_measure_; }
-
  private:
   CanvasPathMeasure();
 
-  std::unique_ptr<SkContourMeasureIter> path_measure_;
+  // All contours of the measured path, shared with the path's cache.
+  std::vector<sk_sp<SkContourMeasure>> path_measures_;
+  size_t next_contour_ = 0u;
+  // The contours iterated so far, which the contour indices refer to.
   std::vector<sk_sp<SkContourMeasure>> measures_;
 };
 
@@ -6,6 +6,7 @@
 
 #include "flutter/lib/ui/painting/canvas.h"
 #include "flutter/lib/ui/painting/picture.h"
+#include "flutter/lib/ui/ui_dart_state.h"
 #include "third_party/tonic/converter/dart_converter.h"
 #include "third_party/tonic/dart_args.h"
 #include "third_party/tonic/dart_binding_macros.h"
@@ -28,6 +29,16 @@ PictureRecorder::~PictureRecorder() {}
 sk_sp<DisplayListBuilder> PictureRecorder::BeginRecording(DlRect bounds) {
   display_list_builder_ =
       sk_make_sp<DisplayListBuilder>(bounds, /*prepare_rtree=*/true);
+  // Pictures are dispatched at least once per frame they are visible in,
+  // so trimming ops that render nothing once at endRecording pays off.
+  display_list_builder_->SetCompactOpStream(true);
+  // Pictures with many thousands of ops spend a noticeable amount of
+  // endRecording building their RTree, part of which can be spread over
+  // the concurrent workers.
+  if (auto* dart_state = UIDartState::Current()) {
+    display_list_builder_->SetRTreeWorkers(
+        dart_state->GetConcurrentTaskRunner());
+  }
   return display_list_builder_;
 }
 
@@ -21,6 +21,11 @@ SingleFrameCodec::SingleFrameCodec(
 
 SingleFrameCodec::~SingleFrameCodec() = default;
 
+void SingleFrameCodec::dispose() {
+  disposed_->store(true);
+  Codec::dispose();
+}
+
 int SingleFrameCodec::frameCount() const {
   return 1;
 }
@@ -78,7 +83,8 @@ Dart_Handle SingleFrameCodec::getNextFrame(Dart_Handle callback_handle) {
       descriptor_,
       {.target_width = target_width_,
        .target_height = target_height_,
-       .target_format = target_format_},
+       .target_format = target_format_,
+       .cancelled = disposed_},
       [raw_codec_ref](const auto& image, const auto& decode_error) {
         std::unique_ptr<fml::RefPtr<SingleFrameCodec>> codec_ref(raw_codec_ref);
         fml::RefPtr<SingleFrameCodec> codec(std::move(*codec_ref));
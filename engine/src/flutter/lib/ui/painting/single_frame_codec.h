@@ -31,6 +31,9 @@ class SingleFrameCodec : public Codec {
   // |Codec|
   Dart_Handle getNextFrame(Dart_Handle args) override;
 
+  // |Codec|
+  void dispose() override;
+
  private:
   enum class Status { kNew, kInProgress, kComplete };
   Status status_ = Status::kNew;
@@ -40,6 +43,10 @@ class SingleFrameCodec : public Codec {
   ImageDecoder::TargetPixelFormat target_format_;
   fml::RefPtr<CanvasImage> cached_image_;
   std::vector<tonic::DartPersistentValue> pending_callbacks_;
+  // Set when the codec is disposed, so that a decode that has not started yet
+  // is skipped.
+  std::shared_ptr<std::atomic<bool>> disposed_ =
+      std::make_shared<std::atomic<bool>>(false);
 
   FML_FRIEND_MAKE_REF_COUNTED(SingleFrameCodec);
   FML_FRIEND_REF_COUNTED_THREAD_SAFE(SingleFrameCodec);
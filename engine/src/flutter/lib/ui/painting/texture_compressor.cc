@@ -0,0 +1,471 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/texture_compressor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr int kBlockSize = 4;
+constexpr size_t kBlockBytes = 16;
+
+// The RGBA pixels of a block, row by row.
+using Block = uint8_t[16][4];
+
+void LoadBlock(const uint8_t* pixels,
+               size_t row_bytes,
+               int width,
+               int height,
+               bool bgra,
+               int block_x,
+               int block_y,
+               Block& block) {
+  for (int y = 0; y < kBlockSize; y++) {
+    // The blocks past the edges of the image repeat its last row and column.
+    const int source_y = std::min(block_y * kBlockSize + y, height - 1);
+    const uint8_t* row = pixels + source_y * row_bytes;
+    for (int x = 0; x < kBlockSize; x++) {
+      const int source_x = std::min(block_x * kBlockSize + x, width - 1);
+      const uint8_t* pixel = row + source_x * 4;
+      uint8_t* target = block[y * kBlockSize + x];
+      target[0] = pixel[bgra ? 2 : 0];
+      target[1] = pixel[1];
+      target[2] = pixel[bgra ? 0 : 2];
+      target[3] = pixel[3];
+    }
+  }
+}
+
+int Clamp255(int value) {
+  return std::clamp(value, 0, 255);
+}
+
+void StoreBigEndian(uint64_t value, uint8_t* bytes) {
+  for (int i = 0; i < 8; i++) {
+    bytes[i] = static_cast<uint8_t>(value >> (56 - 8 * i));
+  }
+}
+
+//------------------------------------------------------------------------------
+// ETC2 RGBA8: an EAC block with the alpha followed by an ETC2 block with the
+// color. Only the ETC1 compatible modes are used for the color.
+//------------------------------------------------------------------------------
+
+constexpr int kEACModifiers[16][8] = {
+    {-3, -6, -9, -15, 2, 5, 8, 14}, {-3, -7, -10, -13, 2, 6, 9, 12},
+    {-2, -5, -8, -13, 1, 4, 7, 12}, {-2, -4, -6, -13, 1, 3, 5, 12},
+    {-3, -6, -8, -12, 2, 5, 7, 11}, {-3, -7, -9, -11, 2, 6, 8, 10},
+    {-4, -7, -8, -11, 3, 6, 7, 10}, {-3, -5, -8, -11, 2, 4, 7, 10},
+    {-2, -6, -8, -10, 1, 5, 7, 9},  {-2, -5, -8, -10, 1, 4, 7, 9},
+    {-2, -4, -8, -10, 1, 3, 7, 9},  {-2, -5, -7, -10, 1, 4, 6, 9},
+    {-3, -4, -7, -10, 2, 3, 6, 9},  {-1, -2, -3, -10, 0, 1, 2, 9},
+    {-4, -6, -8, -9, 3, 5, 7, 8},   {-3, -5, -7, -9, 2, 4, 6, 8},
+};
+
+// The modifiers of the indices 0-3, which the color encodes as an MSB and an
+// LSB.
+constexpr int kETCModifiers[8][4] = {
+    {2, 8, -2, -8},     {5, 17, -5, -17},    {9, 29, -9, -29},
+    {13, 42, -13, -42}, {18, 60, -18, -60},  {24, 80, -24, -80},
+    {33, 106, -33, -106}, {47, 183, -47, -183},
+};
+
+uint64_t EncodeEACAlpha(const Block& block) {
+  int min_alpha = 255;
+  int max_alpha = 0;
+  for (const auto& pixel : block) {
+    min_alpha = std::min<int>(min_alpha, pixel[3]);
+    max_alpha = std::max<int>(max_alpha, pixel[3]);
+  }
+
+  uint64_t best_bits = 0;
+  int best_error = std::numeric_limits<int>::max();
+  for (int table = 0; table < 16; table++) {
+    const int* modifiers = kEACModifiers[table];
+    // Spread the range of the modifiers over the range of the alpha.
+    const int modifier_range = modifiers[7] - modifiers[3];
+    const int multiplier = std::clamp(
+        (max_alpha - min_alpha + modifier_range / 2) / modifier_range, 1, 15);
+    const int base = Clamp255(
+        (min_alpha + max_alpha - multiplier * (modifiers[7] + modifiers[3])) /
+        2);
+
+    uint64_t bits = static_cast<uint64_t>(base) << 56 |
+                    static_cast<uint64_t>(multiplier) << 52 |
+                    static_cast<uint64_t>(table) << 48;
+    int error = 0;
+    for (int x = 0; x < kBlockSize; x++) {
+      for (int y = 0; y < kBlockSize; y++) {
+        const int alpha = block[y * kBlockSize + x][3];
+        int best_index = 0;
+        int best_pixel_error = std::numeric_limits<int>::max();
+        for (int index = 0; index < 8; index++) {
+          const int value = Clamp255(base + modifiers[index] * multiplier);
+          const int pixel_error = (value - alpha) * (value - alpha);
+          if (pixel_error < best_pixel_error) {
+            best_pixel_error = pixel_error;
+            best_index = index;
+          }
+        }
+        error += best_pixel_error;
+        // The indices are stored column by column.
+        bits |= static_cast<uint64_t>(best_index) << (45 - 3 * (x * 4 + y));
+      }
+    }
+    if (error < best_error) {
+      best_error = error;
+      best_bits = bits;
+      if (error == 0) {
+        break;
+      }
+    }
+  }
+  return best_bits;
+}
+
+struct ETCSubblock {
+  int error = 0;
+  int table = 0;
+  // The index of every pixel of the block, of which only the pixels in the
+  // subblock are set.
+  int indices[16] = {};
+};
+
+bool IsInSubblock(bool flip, int subblock, int x, int y) {
+  return ((flip ? y : x) >= 2) == (subblock == 1);
+}
+
+ETCSubblock EncodeETCSubblock(const Block& block,
+                              bool flip,
+                              int subblock,
+                              const int base[3]) {
+  ETCSubblock best;
+  best.error = std::numeric_limits<int>::max();
+  for (int table = 0; table < 8; table++) {
+    ETCSubblock result;
+    result.table = table;
+    for (int i = 0; i < 16; i++) {
+      if (!IsInSubblock(flip, subblock, i % 4, i / 4)) {
+        continue;
+      }
+      int best_pixel_error = std::numeric_limits<int>::max();
+      for (int index = 0; index < 4; index++) {
+        int pixel_error = 0;
+        for (int c = 0; c < 3; c++) {
+          const int value = Clamp255(base[c] + kETCModifiers[table][index]);
+          pixel_error += (value - block[i][c]) * (value - block[i][c]);
+        }
+        if (pixel_error < best_pixel_error) {
+          best_pixel_error = pixel_error;
+          result.indices[i] = index;
+        }
+      }
+      result.error += best_pixel_error;
+    }
+    if (result.error < best.error) {
+      best = result;
+    }
+  }
+  return best;
+}
+
+struct ETCCandidate {
+  int error = std::numeric_limits<int>::max();
+  uint64_t bits = 0;
+};
+
+ETCCandidate EncodeETCColors(const Block& block,
+                             bool flip,
+                             bool differential,
+                             const int colors[2][3]) {
+  int bases[2][3];
+  for (int subblock = 0; subblock < 2; subblock++) {
+    for (int c = 0; c < 3; c++) {
+      const int color = colors[subblock][c];
+      bases[subblock][c] =
+          differential ? (color << 3) | (color >> 2) : (color << 4) | color;
+    }
+  }
+  const ETCSubblock first = EncodeETCSubblock(block, flip, 0, bases[0]);
+  const ETCSubblock second = EncodeETCSubblock(block, flip, 1, bases[1]);
+
+  ETCCandidate candidate;
+  candidate.error = first.error + second.error;
+  for (int c = 0; c < 3; c++) {
+    const int shift = 60 - 8 * c;
+    if (differential) {
+      const int delta = colors[1][c] - colors[0][c];
+      candidate.bits |= static_cast<uint64_t>(colors[0][c]) << (shift - 1) |
+                        static_cast<uint64_t>(delta & 7) << (shift - 4);
+    } else {
+      candidate.bits |= static_cast<uint64_t>(colors[0][c]) << shift |
+                        static_cast<uint64_t>(colors[1][c]) << (shift - 4);
+    }
+  }
+  candidate.bits |= static_cast<uint64_t>(first.table) << 37 |
+                    static_cast<uint64_t>(second.table) << 34 |
+                    static_cast<uint64_t>(differential) << 33 |
+                    static_cast<uint64_t>(flip) << 32;
+  for (int i = 0; i < 16; i++) {
+    const int index = IsInSubblock(flip, 0, i % 4, i / 4)
+                          ? first.indices[i]
+                          : second.indices[i];
+    // The indices are stored column by column, with their MSBs first.
+    const int position = (i % 4) * 4 + i / 4;
+    candidate.bits |= static_cast<uint64_t>(index >> 1) << (16 + position) |
+                      static_cast<uint64_t>(index & 1) << position;
+  }
+  return candidate;
+}
+
+uint64_t EncodeETCColor(const Block& block) {
+  ETCCandidate best;
+  for (bool flip : {false, true}) {
+    float averages[2][3] = {};
+    for (int i = 0; i < 16; i++) {
+      const int subblock = IsInSubblock(flip, 0, i % 4, i / 4) ? 0 : 1;
+      for (int c = 0; c < 3; c++) {
+        averages[subblock][c] += block[i][c] / 8.0f;
+      }
+    }
+
+    // The differential mode has more precision, but only if the colors of
+    // the subblocks are close enough. Colors that aren't are brought closer
+    // together, which may still be better than the individual mode.
+    int differential[2][3];
+    int individual[2][3];
+    for (int c = 0; c < 3; c++) {
+      const int first = std::lround(averages[0][c] * 31.0f / 255.0f);
+      const int second = std::lround(averages[1][c] * 31.0f / 255.0f);
+      differential[0][c] = first;
+      differential[1][c] = std::clamp(second, first - 4, first + 3);
+      // The second color must be a valid 5-bit value too, or the block
+      // would be read as one of the other ETC2 modes.
+      differential[1][c] = std::clamp(differential[1][c], 0, 31);
+      for (int subblock = 0; subblock < 2; subblock++) {
+        individual[subblock][c] =
+            std::lround(averages[subblock][c] * 15.0f / 255.0f);
+      }
+    }
+
+    for (const ETCCandidate& candidate :
+         {EncodeETCColors(block, flip, true, differential),
+          EncodeETCColors(block, flip, false, individual)}) {
+      if (candidate.error < best.error) {
+        best = candidate;
+      }
+    }
+  }
+  return best.bits;
+}
+
+void EncodeETC2RGBA8Block(const Block& block, uint8_t* bytes) {
+  StoreBigEndian(EncodeEACAlpha(block), bytes);
+  StoreBigEndian(EncodeETCColor(block), bytes + 8);
+}
+
+//------------------------------------------------------------------------------
+// BC7 mode 6: a single subset of RGBA endpoints with 7 bits per channel and a
+// shared LSB per endpoint, and 4-bit indices.
+//------------------------------------------------------------------------------
+
+constexpr int kBC7Weights[16] = {0,  4,  9,  13, 17, 21, 26, 30,
+                                 34, 38, 43, 47, 51, 55, 60, 64};
+
+class BitWriter {
+ public:
+  explicit BitWriter(uint8_t* bytes) : bytes_(bytes) {
+    std::fill(bytes_, bytes_ + kBlockBytes, 0);
+  }
+
+  void Write(uint32_t value, int bit_count) {
+    for (int i = 0; i < bit_count; i++, position_++) {
+      bytes_[position_ / 8] |= ((value >> i) & 1) << (position_ % 8);
+    }
+  }
+
+ private:
+  uint8_t* bytes_;
+  int position_ = 0;
+};
+
+// Quantizes an endpoint to 7 bits per channel and the shared LSB that is the
+// closest to it.
+void QuantizeBC7Endpoint(const float endpoint[4], int quantized[4], int& lsb) {
+  float best_error = std::numeric_limits<float>::max();
+  for (int p = 0; p < 2; p++) {
+    float error = 0;
+    int candidate[4];
+    for (int c = 0; c < 4; c++) {
+      candidate[c] =
+          std::clamp<int>(std::lround((endpoint[c] - p) / 2), 0, 127);
+      const float value = candidate[c] * 2 + p;
+      error += (value - endpoint[c]) * (value - endpoint[c]);
+    }
+    if (error < best_error) {
+      best_error = error;
+      lsb = p;
+      std::copy(candidate, candidate + 4, quantized);
+    }
+  }
+}
+
+void EncodeBC7Block(const Block& block, uint8_t* bytes) {
+  float mean[4] = {};
+  for (const auto& pixel : block) {
+    for (int c = 0; c < 4; c++) {
+      mean[c] += pixel[c] / 16.0f;
+    }
+  }
+  float covariance[4][4] = {};
+  for (const auto& pixel : block) {
+    for (int i = 0; i < 4; i++) {
+      for (int j = 0; j < 4; j++) {
+        covariance[i][j] += (pixel[i] - mean[i]) * (pixel[j] - mean[j]);
+      }
+    }
+  }
+
+  // The endpoints are the extremes of the pixels along their principal axis,
+  // which a few iterations of the power method find.
+  float axis[4] = {1, 1, 1, 1};
+  for (int iteration = 0; iteration < 8; iteration++) {
+    float next[4] = {};
+    float length = 0;
+    for (int i = 0; i < 4; i++) {
+      for (int j = 0; j < 4; j++) {
+        next[i] += covariance[i][j] * axis[j];
+      }
+      length = std::max(length, std::abs(next[i]));
+    }
+    if (length == 0) {
+      break;
+    }
+    for (int i = 0; i < 4; i++) {
+      axis[i] = next[i] / length;
+    }
+  }
+  float axis_length_squared = 0;
+  for (float value : axis) {
+    axis_length_squared += value * value;
+  }
+  float min_t = 0;
+  float max_t = 0;
+  for (const auto& pixel : block) {
+    float t = 0;
+    for (int c = 0; c < 4; c++) {
+      t += (pixel[c] - mean[c]) * axis[c];
+    }
+    t /= axis_length_squared;
+    min_t = std::min(min_t, t);
+    max_t = std::max(max_t, t);
+  }
+
+  float endpoints[2][4];
+  for (int c = 0; c < 4; c++) {
+    endpoints[0][c] = std::clamp(mean[c] + min_t * axis[c], 0.0f, 255.0f);
+    endpoints[1][c] = std::clamp(mean[c] + max_t * axis[c], 0.0f, 255.0f);
+  }
+  int quantized[2][4];
+  int lsbs[2];
+  QuantizeBC7Endpoint(endpoints[0], quantized[0], lsbs[0]);
+  QuantizeBC7Endpoint(endpoints[1], quantized[1], lsbs[1]);
+
+  int palette[16][4];
+  for (int index = 0; index < 16; index++) {
+    for (int c = 0; c < 4; c++) {
+      const int first = quantized[0][c] * 2 + lsbs[0];
+      const int second = quantized[1][c] * 2 + lsbs[1];
+      palette[index][c] = ((64 - kBC7Weights[index]) * first +
+                           kBC7Weights[index] * second + 32) >>
+                          6;
+    }
+  }
+  int indices[16];
+  for (int i = 0; i < 16; i++) {
+    int best_error = std::numeric_limits<int>::max();
+    for (int index = 0; index < 16; index++) {
+      int error = 0;
+      for (int c = 0; c < 4; c++) {
+        const int difference = palette[index][c] - block[i][c];
+        error += difference * difference;
+      }
+      if (error < best_error) {
+        best_error = error;
+        indices[i] = index;
+      }
+    }
+  }
+
+  // The MSB of the index of the first pixel is implied to be zero, which
+  // swapping the endpoints guarantees.
+  if (indices[0] >= 8) {
+    std::swap(quantized[0], quantized[1]);
+    std::swap(lsbs[0], lsbs[1]);
+    for (int& index : indices) {
+      index = 15 - index;
+    }
+  }
+
+  BitWriter writer(bytes);
+  writer.Write(1 << 6, 7);
+  for (int c = 0; c < 4; c++) {
+    writer.Write(quantized[0][c], 7);
+    writer.Write(quantized[1][c], 7);
+  }
+  writer.Write(lsbs[0], 1);
+  writer.Write(lsbs[1], 1);
+  writer.Write(indices[0], 3);
+  for (int i = 1; i < 16; i++) {
+    writer.Write(indices[i], 4);
+  }
+}
+
+}  // namespace
+
+size_t GetCompressedImageSize(int width, int height) {
+  const size_t blocks_wide = (width + kBlockSize - 1) / kBlockSize;
+  const size_t blocks_high = (height + kBlockSize - 1) / kBlockSize;
+  return blocks_wide * blocks_high * kBlockBytes;
+}
+
+void CompressImage(TextureCompression compression,
+                   const uint8_t* pixels,
+                   size_t row_bytes,
+                   int width,
+                   int height,
+                   bool bgra,
+                   uint8_t* blocks) {
+  TRACE_EVENT0("flutter", "CompressImage");
+  FML_DCHECK(width > 0 && height > 0);
+  const int blocks_wide = (width + kBlockSize - 1) / kBlockSize;
+  const int blocks_high = (height + kBlockSize - 1) / kBlockSize;
+  Block block;
+  for (int block_y = 0; block_y < blocks_high; block_y++) {
+    for (int block_x = 0; block_x < blocks_wide; block_x++) {
+      LoadBlock(pixels, row_bytes, width, height, bgra, block_x, block_y,
+                block);
+      uint8_t* bytes =
+          blocks + (block_y * blocks_wide + block_x) * kBlockBytes;
+      switch (compression) {
+        case TextureCompression::kETC2RGBA8:
+          EncodeETC2RGBA8Block(block, bytes);
+          break;
+        case TextureCompression::kBC7:
+          EncodeBC7Block(block, bytes);
+          break;
+      }
+    }
+  }
+}
+
+}  // namespace flutter
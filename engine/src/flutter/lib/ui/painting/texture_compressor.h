@@ -0,0 +1,50 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_TEXTURE_COMPRESSOR_H_
+#define FLUTTER_LIB_UI_PAINTING_TEXTURE_COMPRESSOR_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace flutter {
+
+/// The block compressed formats that decoded images can be compressed to on
+/// the CPU before they are uploaded. Both store blocks of 4x4 pixels in 16
+/// bytes, a quarter of the memory of 8-bit RGBA pixels.
+enum class TextureCompression {
+  /// ETC2 color with EAC alpha, which the GPUs of nearly all mobile devices
+  /// sample from.
+  kETC2RGBA8,
+  /// BC7, which desktop GPUs sample from. Only its single subset mode is
+  /// used, which is the fastest to encode.
+  kBC7,
+};
+
+/// @brief  The bytes an image of `width` by `height` pixels takes once it is
+///         compressed. The edges of images whose dimensions aren't multiples
+///         of 4 are padded to whole blocks.
+size_t GetCompressedImageSize(int width, int height);
+
+/// @brief  Compresses 8-bit per channel pixels into `blocks`, which must be
+///         |GetCompressedImageSize| bytes long. The blocks are stored row by
+///         row.
+///
+///         The encoders trade some quality for speed: images are compressed
+///         while they are decoded, so they pick each block's encoding with
+///         a single pass over the block rather than by searching all of them.
+///
+/// @param[in]  bgra  Whether the pixels are in BGRA order rather than RGBA.
+///                   The blocks are RGBA either way.
+void CompressImage(TextureCompression compression,
+                   const uint8_t* pixels,
+                   size_t row_bytes,
+                   int width,
+                   int height,
+                   bool bgra,
+                   uint8_t* blocks);
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_TEXTURE_COMPRESSOR_H_
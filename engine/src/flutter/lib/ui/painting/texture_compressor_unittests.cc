@@ -0,0 +1,250 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/texture_compressor.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+uint64_t LoadBigEndian(const uint8_t* bytes) {
+  uint64_t value = 0;
+  for (int i = 0; i < 8; i++) {
+    value = value << 8 | bytes[i];
+  }
+  return value;
+}
+
+int Clamp255(int value) {
+  return std::clamp(value, 0, 255);
+}
+
+// Decodes a block written by the encoder, which only uses the ETC1
+// compatible modes.
+void DecodeETC2RGBA8Block(const uint8_t* bytes, uint8_t pixels[16][4]) {
+  static constexpr int kEACModifiers[16][8] = {
+      {-3, -6, -9, -15, 2, 5, 8, 14}, {-3, -7, -10, -13, 2, 6, 9, 12},
+      {-2, -5, -8, -13, 1, 4, 7, 12}, {-2, -4, -6, -13, 1, 3, 5, 12},
+      {-3, -6, -8, -12, 2, 5, 7, 11}, {-3, -7, -9, -11, 2, 6, 8, 10},
+      {-4, -7, -8, -11, 3, 6, 7, 10}, {-3, -5, -8, -11, 2, 4, 7, 10},
+      {-2, -6, -8, -10, 1, 5, 7, 9},  {-2, -5, -8, -10, 1, 4, 7, 9},
+      {-2, -4, -8, -10, 1, 3, 7, 9},  {-2, -5, -7, -10, 1, 4, 6, 9},
+      {-3, -4, -7, -10, 2, 3, 6, 9},  {-1, -2, -3, -10, 0, 1, 2, 9},
+      {-4, -6, -8, -9, 3, 5, 7, 8},   {-3, -5, -7, -9, 2, 4, 6, 8},
+  };
+  static constexpr int kETCModifiers[8][4] = {
+      {2, 8, -2, -8},       {5, 17, -5, -17},     {9, 29, -9, -29},
+      {13, 42, -13, -42},   {18, 60, -18, -60},   {24, 80, -24, -80},
+      {33, 106, -33, -106}, {47, 183, -47, -183},
+  };
+
+  const uint64_t alpha = LoadBigEndian(bytes);
+  const int base = alpha >> 56;
+  const int multiplier = (alpha >> 52) & 15;
+  const int alpha_table = (alpha >> 48) & 15;
+
+  const uint64_t color = LoadBigEndian(bytes + 8);
+  const bool differential = (color >> 33) & 1;
+  const bool flip = (color >> 32) & 1;
+  int bases[2][3];
+  for (int c = 0; c < 3; c++) {
+    const int shift = 60 - 8 * c;
+    if (differential) {
+      const int first = (color >> (shift - 1)) & 31;
+      int delta = (color >> (shift - 4)) & 7;
+      delta = delta >= 4 ? delta - 8 : delta;
+      const int second = first + delta;
+      // Other sums make the block one of the other ETC2 modes.
+      EXPECT_GE(second, 0);
+      EXPECT_LE(second, 31);
+      bases[0][c] = (first << 3) | (first >> 2);
+      bases[1][c] = (second << 3) | (second >> 2);
+    } else {
+      const int first = (color >> shift) & 15;
+      const int second = (color >> (shift - 4)) & 15;
+      bases[0][c] = (first << 4) | first;
+      bases[1][c] = (second << 4) | second;
+    }
+  }
+  const int tables[2] = {static_cast<int>((color >> 37) & 7),
+                         static_cast<int>((color >> 34) & 7)};
+
+  for (int x = 0; x < 4; x++) {
+    for (int y = 0; y < 4; y++) {
+      const int position = x * 4 + y;
+      uint8_t* pixel = pixels[y * 4 + x];
+      const int subblock = (flip ? y : x) >= 2 ? 1 : 0;
+      const int index = ((color >> (16 + position)) & 1) << 1 |
+                        ((color >> position) & 1);
+      for (int c = 0; c < 3; c++) {
+        pixel[c] = Clamp255(bases[subblock][c] +
+                            kETCModifiers[tables[subblock]][index]);
+      }
+      const int alpha_index = (alpha >> (45 - 3 * position)) & 7;
+      pixel[3] = Clamp255(base + kEACModifiers[alpha_table][alpha_index] *
+                                     multiplier);
+    }
+  }
+}
+
+// Decodes a block written by the encoder, which only uses mode 6.
+void DecodeBC7Block(const uint8_t* bytes, uint8_t pixels[16][4]) {
+  static constexpr int kWeights[16] = {0,  4,  9,  13, 17, 21, 26, 30,
+                                       34, 38, 43, 47, 51, 55, 60, 64};
+  int position = 0;
+  auto read = [&](int bit_count) {
+    int value = 0;
+    for (int i = 0; i < bit_count; i++, position++) {
+      value |= ((bytes[position / 8] >> (position % 8)) & 1) << i;
+    }
+    return value;
+  };
+  ASSERT_EQ(read(7), 1 << 6);
+  int endpoints[2][4];
+  for (int c = 0; c < 4; c++) {
+    endpoints[0][c] = read(7) << 1;
+    endpoints[1][c] = read(7) << 1;
+  }
+  const int first_lsb = read(1);
+  const int second_lsb = read(1);
+  for (int c = 0; c < 4; c++) {
+    endpoints[0][c] |= first_lsb;
+    endpoints[1][c] |= second_lsb;
+  }
+  for (int i = 0; i < 16; i++) {
+    const int index = read(i == 0 ? 3 : 4);
+    for (int c = 0; c < 4; c++) {
+      pixels[i][c] = ((64 - kWeights[index]) * endpoints[0][c] +
+                      kWeights[index] * endpoints[1][c] + 32) >>
+                     6;
+    }
+  }
+  ASSERT_EQ(position, 128);
+}
+
+std::vector<uint8_t> Decode(TextureCompression compression,
+                            const std::vector<uint8_t>& blocks,
+                            int width,
+                            int height) {
+  const int blocks_wide = (width + 3) / 4;
+  std::vector<uint8_t> pixels(width * height * 4);
+  for (size_t block = 0; block < blocks.size() / 16; block++) {
+    uint8_t decoded[16][4];
+    if (compression == TextureCompression::kETC2RGBA8) {
+      DecodeETC2RGBA8Block(blocks.data() + block * 16, decoded);
+    } else {
+      DecodeBC7Block(blocks.data() + block * 16, decoded);
+    }
+    for (int i = 0; i < 16; i++) {
+      const int x = (block % blocks_wide) * 4 + i % 4;
+      const int y = (block / blocks_wide) * 4 + i / 4;
+      if (x < width && y < height) {
+        std::copy(decoded[i], decoded[i] + 4, &pixels[(y * width + x) * 4]);
+      }
+    }
+  }
+  return pixels;
+}
+
+int MaxError(const std::vector<uint8_t>& expected,
+             const std::vector<uint8_t>& actual) {
+  int max_error = 0;
+  for (size_t i = 0; i < expected.size(); i++) {
+    max_error = std::max(max_error, std::abs(expected[i] - actual[i]));
+  }
+  return max_error;
+}
+
+// A premultiplied image with soft gradients in every channel.
+std::vector<uint8_t> MakeGradient(int width, int height) {
+  std::vector<uint8_t> pixels(width * height * 4);
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      uint8_t* pixel = &pixels[(y * width + x) * 4];
+      pixel[3] = 255 - y * 2;
+      pixel[0] = x * 3 * pixel[3] / 255;
+      pixel[1] = y * 3 * pixel[3] / 255;
+      pixel[2] = (x + y) * pixel[3] / 255;
+    }
+  }
+  return pixels;
+}
+
+class TextureCompressorFormatTest
+    : public ::testing::TestWithParam<TextureCompression> {};
+
+}  // namespace
+
+TEST(TextureCompressorTest, PadsToWholeBlocks) {
+  EXPECT_EQ(GetCompressedImageSize(4, 4), 16u);
+  EXPECT_EQ(GetCompressedImageSize(5, 4), 32u);
+  EXPECT_EQ(GetCompressedImageSize(1, 1), 16u);
+  EXPECT_EQ(GetCompressedImageSize(64, 30), 16u * 16 * 8);
+}
+
+TEST_P(TextureCompressorFormatTest, KeepsSolidColors) {
+  for (uint8_t value : {0, 1, 77, 128, 200, 255}) {
+    std::vector<uint8_t> pixels(6 * 6 * 4, value);
+    std::vector<uint8_t> blocks(GetCompressedImageSize(6, 6));
+    CompressImage(GetParam(), pixels.data(), 6 * 4, 6, 6, /*bgra=*/false,
+                  blocks.data());
+    // ETC colors are 5 bits and BC7 colors 8 bits, one of which is shared.
+    EXPECT_LE(MaxError(pixels, Decode(GetParam(), blocks, 6, 6)), 4)
+        << static_cast<int>(value);
+  }
+}
+
+TEST_P(TextureCompressorFormatTest, ApproximatesGradients) {
+  const std::vector<uint8_t> pixels = MakeGradient(30, 22);
+  std::vector<uint8_t> blocks(GetCompressedImageSize(30, 22));
+  CompressImage(GetParam(), pixels.data(), 30 * 4, 30, 22, /*bgra=*/false,
+                blocks.data());
+  EXPECT_LE(MaxError(pixels, Decode(GetParam(), blocks, 30, 22)), 12);
+}
+
+TEST_P(TextureCompressorFormatTest, SwizzlesBGRA) {
+  const std::vector<uint8_t> pixels = MakeGradient(8, 8);
+  std::vector<uint8_t> bgra_pixels = pixels;
+  for (size_t i = 0; i < bgra_pixels.size(); i += 4) {
+    std::swap(bgra_pixels[i], bgra_pixels[i + 2]);
+  }
+  std::vector<uint8_t> blocks(GetCompressedImageSize(8, 8));
+  std::vector<uint8_t> bgra_blocks(GetCompressedImageSize(8, 8));
+  CompressImage(GetParam(), pixels.data(), 8 * 4, 8, 8, /*bgra=*/false,
+                blocks.data());
+  CompressImage(GetParam(), bgra_pixels.data(), 8 * 4, 8, 8, /*bgra=*/true,
+                bgra_blocks.data());
+  EXPECT_EQ(blocks, bgra_blocks);
+}
+
+TEST_P(TextureCompressorFormatTest, ReadsRowsWithPadding) {
+  const std::vector<uint8_t> pixels = MakeGradient(5, 5);
+  std::vector<uint8_t> padded(8 * 4 * 5, 0xff);
+  for (int y = 0; y < 5; y++) {
+    std::copy(&pixels[y * 5 * 4], &pixels[(y + 1) * 5 * 4],
+              &padded[y * 8 * 4]);
+  }
+  std::vector<uint8_t> blocks(GetCompressedImageSize(5, 5));
+  std::vector<uint8_t> padded_blocks(GetCompressedImageSize(5, 5));
+  CompressImage(GetParam(), pixels.data(), 5 * 4, 5, 5, /*bgra=*/false,
+                blocks.data());
+  CompressImage(GetParam(), padded.data(), 8 * 4, 5, 5, /*bgra=*/false,
+                padded_blocks.data());
+  EXPECT_EQ(blocks, padded_blocks);
+}
+
+INSTANTIATE_TEST_SUITE_P(TextureCompressorTests,
+                         TextureCompressorFormatTest,
+                         ::testing::Values(TextureCompression::kETC2RGBA8,
+                                           TextureCompression::kBC7));
+
+}  // namespace testing
+}  // namespace flutter
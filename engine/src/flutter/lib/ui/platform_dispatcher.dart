@@ -705,6 +705,27 @@ class PlatformDispatcher {
     ByteData? data,
   );
 
+  /// Delivers the messages the platform sends on the channel [name] to [port]
+  /// instead of [onPlatformMessage] and the [channelBuffers].
+  ///
+  /// The messages are posted to [port] straight from the platform thread,
+  /// without involving the UI thread, as a list of the channel name, the
+  /// payload as a [Uint8List] or null, an integer identifying the message, and
+  /// the [SendPort] to send the reply to. The payload is not copied. To reply,
+  /// send a list of the identifier and the reply as a [Uint8List] or null to
+  /// the reply port.
+  ///
+  /// Passing a null [port] delivers the messages on the channel to this
+  /// isolate again. Only callable on the root isolate.
+  void setPortPlatformMessageHandler(String name, SendPort? port) {
+    __setPortPlatformMessageHandler(name, port?.nativePort ?? 0);
+  }
+
+  @Native<Void Function(Handle, Int64)>(
+    symbol: 'PlatformConfigurationNativeApi::SetPortPlatformMessageHandler',
+  )
+  external static void __setPortPlatformMessageHandler(String name, int port);
+
   /// Registers the current isolate with the isolate identified with by the
   /// [token]. This is required if platform channels are to be used on a
   /// background isolate.
@@ -1389,12 +1410,15 @@ class PlatformDispatcher {
   }
 
   // Called from the engine via hooks.dart.
-  void _updateFrameData(int frameNumber) {
+  void _updateFrameData(int frameNumber, int buildDeadlineMicroseconds) {
     final FrameData previous = _frameData;
     if (previous.frameNumber == frameNumber) {
       return;
     }
-    _frameData = FrameData._(frameNumber: frameNumber);
+    _frameData = FrameData._(
+      frameNumber: frameNumber,
+      buildDeadline: Duration(microseconds: buildDeadlineMicroseconds),
+    );
     _invoke(onFrameDataChanged, _onFrameDataChangedZone);
   }
 
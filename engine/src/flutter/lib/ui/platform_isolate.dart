@@ -70,22 +70,7 @@ Future<SendPort> _spawnPlatformIsolate() {
       _platformRunnerSendPort = message.computationPort;
       sendPortCompleter.complete(message.computationPort);
     } else if (message is _ComputationResult) {
-      final Completer<Object?> resultCompleter = _pending.remove(message.id)!;
-      final Object? remoteStack = message.remoteStack;
-      final Object? remoteError = message.remoteError;
-      if (remoteStack != null) {
-        if (remoteStack is StackTrace) {
-          // Typed error.
-          resultCompleter.completeError(remoteError!, remoteStack);
-        } else {
-          // onError handler message, uncaught async error.
-          // Both values are strings, so calling `toString` is efficient.
-          final error = RemoteError(remoteError!.toString(), remoteStack.toString());
-          resultCompleter.completeError(error, error.stackTrace);
-        }
-      } else {
-        resultCompleter.complete(message.result);
-      }
+      _completeComputation(_pending.remove(message.id)!, message);
     } else {
       // We encountered an error while starting the new isolate.
       if (!sendPortCompleter.isCompleted) {
@@ -115,6 +100,24 @@ Future<R> _sendComputation<R>(SendPort port, FutureOr<R> Function() computation)
   return resultCompleter.future;
 }
 
+void _completeComputation(Completer<Object?> resultCompleter, _ComputationResult message) {
+  final Object? remoteStack = message.remoteStack;
+  final Object? remoteError = message.remoteError;
+  if (remoteStack != null) {
+    if (remoteStack is StackTrace) {
+      // Typed error.
+      resultCompleter.completeError(remoteError!, remoteStack);
+    } else {
+      // onError handler message, uncaught async error.
+      // Both values are strings, so calling `toString` is efficient.
+      final error = RemoteError(remoteError!.toString(), remoteStack.toString());
+      resultCompleter.completeError(error, error.stackTrace);
+    }
+  } else {
+    resultCompleter.complete(message.result);
+  }
+}
+
 void _safeSend(SendPort sendPort, int id, Object? result, Object? error, Object? stackTrace) {
   try {
     sendPort.send(_ComputationResult(id, result, error, stackTrace));
@@ -123,6 +126,29 @@ void _safeSend(SendPort sendPort, int id, Object? result, Object? error, Object?
   }
 }
 
+void _runComputation(SendPort sendPort, _ComputationRequest message) {
+  late final FutureOr<Object?> potentiallyAsyncResult;
+  try {
+    potentiallyAsyncResult = message.computation();
+  } catch (e, s) {
+    _safeSend(sendPort, message.id, null, e, s);
+    return;
+  }
+
+  if (potentiallyAsyncResult is Future<Object?>) {
+    potentiallyAsyncResult.then(
+      (Object? result) {
+        _safeSend(sendPort, message.id, result, null, null);
+      },
+      onError: (Object? e, Object? s) {
+        _safeSend(sendPort, message.id, null, e, s ?? StackTrace.empty);
+      },
+    );
+  } else {
+    _safeSend(sendPort, message.id, potentiallyAsyncResult, null, null);
+  }
+}
+
 void _platformIsolateMain(Isolate parentIsolate, SendPort sendPort) {
   final computationPort = RawReceivePort();
   computationPort.handler = (_ComputationRequest? message) {
@@ -131,27 +157,7 @@ void _platformIsolateMain(Isolate parentIsolate, SendPort sendPort) {
       computationPort.keepIsolateAlive = false;
       return;
     }
-
-    late final FutureOr<Object?> potentiallyAsyncResult;
-    try {
-      potentiallyAsyncResult = message.computation();
-    } catch (e, s) {
-      _safeSend(sendPort, message.id, null, e, s);
-      return;
-    }
-
-    if (potentiallyAsyncResult is Future<Object?>) {
-      potentiallyAsyncResult.then(
-        (Object? result) {
-          _safeSend(sendPort, message.id, result, null, null);
-        },
-        onError: (Object? e, Object? s) {
-          _safeSend(sendPort, message.id, null, e, s ?? StackTrace.empty);
-        },
-      );
-    } else {
-      _safeSend(sendPort, message.id, potentiallyAsyncResult, null, null);
-    }
+    _runComputation(sendPort, message);
   };
   Isolate.current.addOnExitListener(sendPort);
   parentIsolate.addOnExitListener(computationPort.sendPort);
@@ -191,3 +197,179 @@ class _ComputationResult {
   final Object? remoteError;
   final Object? remoteStack;
 }
+
+/// Runs [computation] on a background isolate and returns the result.
+///
+/// When the engine is configured to keep a pool of background isolates, the
+/// computation runs on one of its idle isolates instead of on a new isolate.
+/// The isolates of the pool are spawned in the isolate group of the root
+/// isolate once the engine is first idle, and when all of them are busy the
+/// computation waits for the first one to be done. The isolates are reused,
+/// so global state that a computation leaves behind is seen by the later
+/// computations that run on the same isolate.
+///
+/// Without a pool, and when called from another isolate than the root
+/// isolate, this is [Isolate.run].
+///
+/// The [computation] and any state it captures are sent to the isolate it
+/// runs on. See [SendPort.send] for information about what types can be sent.
+///
+/// If [computation] is asynchronous (returns a `Future<R>`) then that future
+/// is awaited on the background isolate before returning the result. If
+/// [computation] throws, the `Future` returned by this function completes
+/// with that error.
+///
+/// This API is currently experimental.
+Future<R> runOnBackgroundIsolate<R>(FutureOr<R> Function() computation) {
+  final _BackgroundIsolatePool? pool = _BackgroundIsolatePool.instance;
+  if (pool == null) {
+    return Isolate.run<R>(computation);
+  }
+  return pool.run<R>(computation);
+}
+
+/// The idle isolates that [runOnBackgroundIsolate] sends computations to.
+class _BackgroundIsolatePool {
+  _BackgroundIsolatePool._(this.size) {
+    _receiver.keepIsolateAlive = false;
+    _receiver.handler = _handleMessage;
+  }
+
+  /// The pool of this isolate, if it keeps one.
+  static final _BackgroundIsolatePool? instance = _backgroundIsolatePoolSize > 0
+      ? _BackgroundIsolatePool._(_backgroundIsolatePoolSize)
+      : null;
+
+  /// The most isolates that the pool spawns.
+  final int size;
+
+  final RawReceivePort _receiver = RawReceivePort();
+
+  // The isolates that were spawned and haven't exited, including those that
+  // are still starting up.
+  int _isolateCount = 0;
+
+  // The computation ports of the isolates that don't run a computation.
+  final List<SendPort> _idle = <SendPort>[];
+
+  // The computations that wait for an isolate to be idle.
+  final collection.Queue<(_ComputationRequest, Completer<Object?>)> _waiting =
+      collection.Queue<(_ComputationRequest, Completer<Object?>)>();
+
+  // The computations that run, by their id, with the port of their isolate.
+  final Map<int, (Completer<Object?>, SendPort)> _running = <int, (Completer<Object?>, SendPort)>{};
+
+  int _nextId = 0;
+
+  /// Spawns the isolates of the pool that aren't spawned yet.
+  void warmUp() {
+    while (_isolateCount < size) {
+      _spawn();
+    }
+  }
+
+  Future<R> run<R>(FutureOr<R> Function() computation) {
+    final resultCompleter = Completer<R>();
+    _waiting.add((_ComputationRequest(++_nextId, computation), resultCompleter));
+    if (_idle.isEmpty && _isolateCount < size) {
+      _spawn();
+    }
+    _dispatch();
+    return resultCompleter.future;
+  }
+
+  void _spawn() {
+    _isolateCount++;
+    Isolate.spawn<(Isolate, SendPort)>(
+      _backgroundIsolateMain,
+      (Isolate.current, _receiver.sendPort),
+      errorsAreFatal: false,
+      debugName: 'BackgroundIsolate',
+    ).then<void>(
+      (Isolate isolate) {},
+      onError: (Object error) {
+        _isolateCount--;
+        _failWaitingIfNoIsolates(error);
+      },
+    );
+  }
+
+  void _dispatch() {
+    while (_idle.isNotEmpty && _waiting.isNotEmpty) {
+      final SendPort port = _idle.removeLast();
+      final (_ComputationRequest request, Completer<Object?> resultCompleter) =
+          _waiting.removeFirst();
+      _running[request.id] = (resultCompleter, port);
+      try {
+        port.send(request);
+      } catch (error, stackTrace) {
+        // The computation can't be sent, so the isolate is still idle.
+        _running.remove(request.id);
+        _idle.add(port);
+        resultCompleter.completeError(error, stackTrace);
+      }
+    }
+  }
+
+  void _failWaitingIfNoIsolates(Object error) {
+    if (_isolateCount > 0) {
+      return;
+    }
+    while (_waiting.isNotEmpty) {
+      _waiting.removeFirst().$2.completeError(
+        IsolateSpawnException('Unable to spawn a background isolate: $error'),
+      );
+    }
+  }
+
+  void _handleMessage(Object? message) {
+    if (message is _BackgroundIsolateReadyMessage) {
+      _idle.add(message.computationPort);
+    } else if (message is _ComputationResult) {
+      final (Completer<Object?> resultCompleter, SendPort port) = _running.remove(message.id)!;
+      _idle.add(port);
+      _completeComputation(resultCompleter, message);
+    } else if (message is SendPort) {
+      // A background isolate exited, which only happens if a computation
+      // shut it down. Its computation fails, and another isolate takes its
+      // place for the computations that wait.
+      _isolateCount--;
+      _idle.remove(message);
+      final List<int> failed = <int>[
+        for (final MapEntry<int, (Completer<Object?>, SendPort)> entry in _running.entries)
+          if (entry.value.$2 == message) entry.key,
+      ];
+      for (final int id in failed) {
+        _running.remove(id)!.$1.completeError(
+          RemoteError('Background isolate shutdown unexpectedly', StackTrace.empty.toString()),
+        );
+      }
+      if (_waiting.isNotEmpty && _idle.isEmpty) {
+        _spawn();
+      }
+    }
+    _dispatch();
+  }
+}
+
+void _backgroundIsolateMain((Isolate, SendPort) arguments) {
+  final (Isolate parentIsolate, SendPort sendPort) = arguments;
+  final computationPort = RawReceivePort(null, 'BackgroundIsolate');
+  computationPort.handler = (_ComputationRequest? message) {
+    if (message == null) {
+      // The parent isolate has shutdown. Allow this isolate to shutdown.
+      computationPort.keepIsolateAlive = false;
+      return;
+    }
+    _runComputation(sendPort, message);
+  };
+  Isolate.current.addOnExitListener(sendPort, response: computationPort.sendPort);
+  parentIsolate.addOnExitListener(computationPort.sendPort);
+  sendPort.send(_BackgroundIsolateReadyMessage(computationPort.sendPort));
+}
+
+class _BackgroundIsolateReadyMessage {
+  _BackgroundIsolateReadyMessage(this.computationPort);
+
+  final SendPort computationPort;
+}
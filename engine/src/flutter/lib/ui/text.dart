@@ -3462,6 +3462,18 @@ abstract class ParagraphBuilder {
   /// [Paragraph].
   factory ParagraphBuilder(ParagraphStyle style) = _NativeParagraphBuilder;
 
+  /// Creates a new [ParagraphBuilder] whose paragraph is shaped and laid out
+  /// on a background thread by [buildAndLayout], so that long paragraphs can
+  /// be prepared, for example before they scroll into view, without blocking
+  /// the UI thread.
+  ///
+  /// The paragraph matches its fonts without the caches shared by the
+  /// paragraphs of other builders, and its shaping isn't reused by them, so
+  /// short paragraphs are cheaper to lay out with a [ParagraphBuilder.new].
+  factory ParagraphBuilder.background(ParagraphStyle style) {
+    return _NativeParagraphBuilder(style, background: true);
+  }
+
   /// The number of placeholders currently in the paragraph.
   int get placeholderCount;
 
@@ -3548,11 +3560,23 @@ abstract class ParagraphBuilder {
   /// After calling this function, the paragraph builder object is invalid and
   /// cannot be used further.
   Paragraph build();
+
+  /// Applies the given paragraph style, lays out a [Paragraph] containing the
+  /// added text and associated styling with the given constraints, and
+  /// completes with it once it is ready to be painted.
+  ///
+  /// The paragraph is laid out on a background thread if this builder was
+  /// created with [ParagraphBuilder.background], and synchronously otherwise.
+  ///
+  /// After calling this function, the paragraph builder object is invalid and
+  /// cannot be used further.
+  Future<Paragraph> buildAndLayout(ParagraphConstraints constraints);
 }
 
 base class _NativeParagraphBuilder extends NativeFieldWrapperClass1 implements ParagraphBuilder {
-  _NativeParagraphBuilder(ParagraphStyle style)
-    : _defaultLeadingDistribution = style._leadingDistribution {
+  _NativeParagraphBuilder(ParagraphStyle style, {bool background = false})
+    : _defaultLeadingDistribution = style._leadingDistribution,
+      _background = background {
     List<String>? strutFontFamilies;
     final StrutStyle? strutStyle = style._strutStyle;
     final ByteData? encodedStrutStyle;
@@ -3579,12 +3603,15 @@ base class _NativeParagraphBuilder extends NativeFieldWrapperClass1 implements P
       style._height ?? 0,
       style._ellipsis ?? '',
       _encodeLocale(style._locale),
+      background,
     );
   }
 
-  @Native<Void Function(Handle, Handle, Handle, Handle, Handle, Double, Double, Handle, Handle)>(
-    symbol: 'ParagraphBuilder::Create',
-  )
+  final bool _background;
+
+  @Native<
+    Void Function(Handle, Handle, Handle, Handle, Handle, Double, Double, Handle, Handle, Bool)
+  >(symbol: 'ParagraphBuilder::Create')
   external void _constructor(
     Int32List encoded,
     ByteData? strutData,
@@ -3594,6 +3621,7 @@ base class _NativeParagraphBuilder extends NativeFieldWrapperClass1 implements P
     double height,
     String ellipsis,
     String locale,
+    bool background,
   );
 
   @override
@@ -3776,6 +3804,32 @@ base class _NativeParagraphBuilder extends NativeFieldWrapperClass1 implements P
   @Native<Void Function(Pointer<Void>, Handle)>(symbol: 'ParagraphBuilder::build')
   external void _build(_NativeParagraph outParagraph);
 
+  @override
+  Future<Paragraph> buildAndLayout(ParagraphConstraints constraints) {
+    if (!_background) {
+      return Future<Paragraph>.value(build()..layout(constraints));
+    }
+    final paragraph = _NativeParagraph._();
+    return _futurize((_Callback<Paragraph> callback) {
+      return _buildInBackground(paragraph, constraints.width, () {
+        assert(() {
+          paragraph._needsLayout = false;
+          return true;
+        }());
+        callback(paragraph);
+      });
+    });
+  }
+
+  @Native<Handle Function(Pointer<Void>, Handle, Double, Handle)>(
+    symbol: 'ParagraphBuilder::buildInBackground',
+  )
+  external String? _buildInBackground(
+    _NativeParagraph outParagraph,
+    double width,
+    void Function() callback,
+  );
+
   @override
   String toString() => 'ParagraphBuilder';
 }
@@ -4,8 +4,14 @@
 
 #include "flutter/lib/ui/text/asset_manager_font_provider.h"
 
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <tuple>
 #include <utility>
 
+#include "flutter/fml/endianness.h"
 #include "flutter/fml/logging.h"
 #include "third_party/skia/include/core/SkData.h"
 #include "third_party/skia/include/core/SkFontMgr.h"
@@ -22,6 +28,97 @@ void MappingReleaseProc(const void* ptr, void* context) {
   delete reinterpret_cast<fml::Mapping*>(context);
 }
 
+// Identifies the contents of a font asset: its name, size and the whole file
+// checksum stored in the 'head' table.
+using SharedTypefaceKey = std::tuple<std::string, size_t, uint32_t>;
+
+uint32_t ReadBigEndian32(const uint8_t* data) {
+  uint32_t value;
+  memcpy(&value, data, sizeof(value));
+  return fml::BigEndianToArch(value);
+}
+
+// Returns the key of an sfnt font file, which only reads its table directory
+// so that the rest of the mapping isn't paged in. Font collections and
+// malformed files have no key and are not shared.
+std::optional<SharedTypefaceKey> GetSharedTypefaceKey(
+    const std::string& asset,
+    const fml::Mapping& mapping) {
+  constexpr size_t kOffsetTableSize = 12;
+  constexpr size_t kTableRecordSize = 16;
+  constexpr uint32_t kHeadTag = 0x68656164;  // 'head'
+  constexpr size_t kCheckSumAdjustmentOffset = 8;
+  constexpr uint32_t kCollectionTag = 0x74746366;  // 'ttcf'
+
+  const uint8_t* data = mapping.GetMapping();
+  const size_t size = mapping.GetSize();
+  if (data == nullptr || size < kOffsetTableSize) {
+    return std::nullopt;
+  }
+  if (ReadBigEndian32(data) == kCollectionTag) {
+    return std::nullopt;
+  }
+  const size_t num_tables = (data[4] << 8) | data[5];
+  if (size < kOffsetTableSize + num_tables * kTableRecordSize) {
+    return std::nullopt;
+  }
+  for (size_t i = 0; i < num_tables; i++) {
+    const uint8_t* record = data + kOffsetTableSize + i * kTableRecordSize;
+    if (ReadBigEndian32(record) != kHeadTag) {
+      continue;
+    }
+    const size_t offset = ReadBigEndian32(record + 8);
+    if (offset > size - kCheckSumAdjustmentOffset - sizeof(uint32_t)) {
+      return std::nullopt;
+    }
+    return SharedTypefaceKey(
+        asset, size,
+        ReadBigEndian32(data + offset + kCheckSumAdjustmentOffset));
+  }
+  return std::nullopt;
+}
+
+// The typefaces loaded from font assets by every engine in the process, so
+// that engines bundling the same fonts share typefaces and their glyph caches
+// instead of loading them again. Entries only hold weak references. Expired
+// entries still keep their typeface's memory, mostly the file backed mapping
+// the OS can reclaim, until they are swept when another typeface is added.
+static std::mutex g_shared_typefaces_mutex;
+static std::map<SharedTypefaceKey, SkTypeface*> g_shared_typefaces;
+
+sk_sp<SkTypeface> FindSharedTypeface(const SharedTypefaceKey& key) {
+  std::scoped_lock lock(g_shared_typefaces_mutex);
+  auto found = g_shared_typefaces.find(key);
+  if (found == g_shared_typefaces.end()) {
+    return nullptr;
+  }
+  if (found->second->try_ref()) {
+    return sk_sp<SkTypeface>(found->second);
+  }
+  found->second->weak_unref();
+  g_shared_typefaces.erase(found);
+  return nullptr;
+}
+
+void AddSharedTypeface(const SharedTypefaceKey& key,
+                       const sk_sp<SkTypeface>& typeface) {
+  std::scoped_lock lock(g_shared_typefaces_mutex);
+  for (auto it = g_shared_typefaces.begin(); it != g_shared_typefaces.end();) {
+    if (it->second->weak_expired()) {
+      it->second->weak_unref();
+      it = g_shared_typefaces.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  typeface->weak_ref();
+  auto [it, inserted] = g_shared_typefaces.emplace(key, typeface.get());
+  if (!inserted) {
+    it->second->weak_unref();
+    it->second = typeface.get();
+  }
+}
+
 }  // anonymous namespace
 
 AssetManagerFontProvider::AssetManagerFontProvider(
@@ -104,6 +201,7 @@ auto AssetManagerFontStyleSet::createTypeface(int i) -> CreateTypefaceRet {
     return nullptr;
   }
 
+  std::scoped_lock lock(typefaces_mutex_);
   TypefaceAsset& asset = assets_[index];
   if (!asset.typeface) {
     std::unique_ptr<fml::Mapping> asset_mapping =
@@ -112,19 +210,33 @@ auto AssetManagerFontStyleSet::createTypeface(int i) -> CreateTypefaceRet {
       return nullptr;
     }
 
-    fml::Mapping* asset_mapping_ptr = asset_mapping.release();
-    sk_sp<SkData> asset_data = SkData::MakeWithProc(
-        asset_mapping_ptr->GetMapping(), asset_mapping_ptr->GetSize(),
-        MappingReleaseProc, asset_mapping_ptr);
-    std::unique_ptr<SkMemoryStream> stream = SkMemoryStream::Make(asset_data);
+    std::optional<SharedTypefaceKey> shared_key =
+        GetSharedTypefaceKey(asset.asset, *asset_mapping);
+    if (shared_key.has_value()) {
+      asset.typeface = FindSharedTypeface(shared_key.value());
+    }
 
-    sk_sp<SkFontMgr> font_mgr = txt::GetDefaultFontManager();
-    // Ownership of the stream is transferred.
-    asset.typeface = font_mgr->makeFromStream(std::move(stream));
     if (!asset.typeface) {
-      FML_DLOG(ERROR) << "Unable to load font asset for family: "
-                      << family_name_;
-      return nullptr;
+      // The typeface reads the font straight from the mapping, which is
+      // backed by the file for assets on disk.
+      fml::Mapping* asset_mapping_ptr = asset_mapping.release();
+      sk_sp<SkData> asset_data = SkData::MakeWithProc(
+          asset_mapping_ptr->GetMapping(), asset_mapping_ptr->GetSize(),
+          MappingReleaseProc, asset_mapping_ptr);
+      std::unique_ptr<SkMemoryStream> stream =
+          SkMemoryStream::Make(asset_data);
+
+      sk_sp<SkFontMgr> font_mgr = txt::GetDefaultFontManager();
+      // Ownership of the stream is transferred.
+      asset.typeface = font_mgr->makeFromStream(std::move(stream));
+      if (!asset.typeface) {
+        FML_DLOG(ERROR) << "Unable to load font asset for family: "
+                        << family_name_;
+        return nullptr;
+      }
+      if (shared_key.has_value()) {
+        AddSharedTypeface(shared_key.value(), asset.typeface);
+      }
     }
   }
 
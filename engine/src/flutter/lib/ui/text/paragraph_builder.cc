@@ -9,7 +9,9 @@
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/make_copyable.h"
 #include "flutter/fml/task_runner.h"
+#include "flutter/fml/trace_event.h"
 #include "flutter/lib/ui/text/font_collection.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "flutter/lib/ui/window/platform_configuration.h"
@@ -25,6 +27,8 @@
 #include "third_party/tonic/dart_args.h"
 #include "third_party/tonic/dart_binding_macros.h"
 #include "third_party/tonic/dart_library_natives.h"
+#include "third_party/tonic/dart_persistent_value.h"
+#include "third_party/tonic/logging/dart_invoke.h"
 #include "third_party/tonic/typed_data/dart_byte_data.h"
 
 namespace flutter {
@@ -153,11 +157,12 @@ void ParagraphBuilder::Create(Dart_Handle wrapper,
                               double fontSize,
                               double height,
                               const std::u16string& ellipsis,
-                              const std::string& locale) {
+                              const std::string& locale,
+                              bool background_layout) {
   UIDartState::ThrowIfUIOperationsProhibited();
   auto res = fml::MakeRefCounted<ParagraphBuilder>(
       encoded_handle, strutData, fontFamily, strutFontFamilies, fontSize,
-      height, ellipsis, locale);
+      height, ellipsis, locale, background_layout);
   res->AssociateWithDartWrapper(wrapper);
 }
 
@@ -226,7 +231,9 @@ ParagraphBuilder::ParagraphBuilder(
     double fontSize,
     double height,
     const std::u16string& ellipsis,
-    const std::string& locale) {
+    const std::string& locale,
+    bool background_layout)
+    : m_background_layout_(background_layout) {
   int32_t mask = 0;
   txt::ParagraphStyle style;
   {
@@ -294,7 +301,8 @@ ParagraphBuilder::ParagraphBuilder(
 
   auto impeller_enabled = UIDartState::Current()->IsImpellerEnabled();
   m_paragraph_builder_ = txt::ParagraphBuilder::CreateSkiaBuilder(
-      style, font_collection.GetFontCollection(), impeller_enabled);
+      style, font_collection.GetFontCollection(), impeller_enabled,
+      /*isolated_font_collection=*/background_layout);
 }
 
 ParagraphBuilder::~ParagraphBuilder() = default;
@@ -530,4 +538,54 @@ void ParagraphBuilder::build(Dart_Handle paragraph_handle) {
   ClearDartWrapper();
 }
 
+Dart_Handle ParagraphBuilder::buildInBackground(Dart_Handle paragraph_handle,
+                                                double width,
+                                                Dart_Handle callback_handle) {
+  if (!Dart_IsClosure(callback_handle)) {
+    return tonic::ToDart("Callback must be a function");
+  }
+  if (!m_background_layout_) {
+    return tonic::ToDart(
+        "ParagraphBuilder was not created for background layout");
+  }
+
+  auto* dart_state = UIDartState::Current();
+  auto ui_task_runner = dart_state->GetTaskRunners().GetUITaskRunner();
+  auto* paragraph_handle_ptr =
+      new tonic::DartPersistentValue(dart_state, paragraph_handle);
+  auto* callback_ptr =
+      new tonic::DartPersistentValue(dart_state, callback_handle);
+  std::unique_ptr<txt::Paragraph> txt_paragraph =
+      m_paragraph_builder_->Build();
+  m_paragraph_builder_.reset();
+  ClearDartWrapper();
+
+  dart_state->GetConcurrentTaskRunner()->PostTask(fml::MakeCopyable(
+      [txt_paragraph = std::move(txt_paragraph), width,
+       ui_task_runner = std::move(ui_task_runner), paragraph_handle_ptr,
+       callback_ptr]() mutable {
+        {
+          TRACE_EVENT0("flutter", "ParagraphBuilder::buildInBackground");
+          txt_paragraph->Layout(width);
+        }
+        ui_task_runner->PostTask(fml::MakeCopyable(
+            [txt_paragraph = std::move(txt_paragraph), paragraph_handle_ptr,
+             callback_ptr]() mutable {
+              std::unique_ptr<tonic::DartPersistentValue> paragraph_handle(
+                  paragraph_handle_ptr);
+              std::unique_ptr<tonic::DartPersistentValue> callback(
+                  callback_ptr);
+              auto dart_state = callback->dart_state().lock();
+              if (!dart_state) {
+                return;
+              }
+              tonic::DartState::Scope scope(dart_state);
+              Paragraph::Create(paragraph_handle->Get(),
+                                std::move(txt_paragraph));
+              tonic::DartInvoke(callback->Get(), {});
+            }));
+      }));
+  return Dart_Null();
+}
+
 }  // namespace flutter
@@ -30,7 +30,8 @@ class ParagraphBuilder : public RefCountedDartWrappable<ParagraphBuilder> {
                      double fontSize,
                      double height,
                      const std::u16string& ellipsis,
-                     const std::string& locale);
+                     const std::string& locale,
+                     bool background_layout);
 
   ~ParagraphBuilder() override;
 
@@ -68,6 +69,16 @@ class ParagraphBuilder : public RefCountedDartWrappable<ParagraphBuilder> {
 
   void build(Dart_Handle paragraph_handle);
 
+  // Builds the paragraph and lays it out at `width` on a concurrent worker,
+  // then associates it with `paragraph_handle` and invokes `callback_handle`
+  // on the UI thread.
+  //
+  // Only builders created for background layout, whose paragraphs have a
+  // font collection of their own, can be laid out off the UI thread.
+  Dart_Handle buildInBackground(Dart_Handle paragraph_handle,
+                                double width,
+                                Dart_Handle callback_handle);
+
  private:
   explicit ParagraphBuilder(Dart_Handle encoded,
                             Dart_Handle strutData,
@@ -76,9 +87,11 @@ class ParagraphBuilder : public RefCountedDartWrappable<ParagraphBuilder> {
                             double fontSize,
                             double height,
                             const std::u16string& ellipsis,
-                            const std::string& locale);
+                            const std::string& locale,
+                            bool background_layout);
 
   std::unique_ptr<txt::ParagraphBuilder> m_paragraph_builder_;
+  bool m_background_layout_;
 };
 
 }  // namespace flutter
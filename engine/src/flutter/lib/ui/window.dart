@@ -1098,7 +1098,7 @@ final SingletonFlutterWindow window = SingletonFlutterWindow._();
 ///  * [PlatformDispatcher.onFrameDataChanged], which notifies listeners when
 ///    a window's frame data has changed.
 class FrameData {
-  const FrameData._({this.frameNumber = -1});
+  const FrameData._({this.frameNumber = -1, this.buildDeadline = Duration.zero});
 
   /// The number of the current frame.
   ///
@@ -1107,6 +1107,16 @@ class FrameData {
   ///
   /// If not provided, defaults to -1.
   final int frameNumber;
+
+  /// The time by which the current frame should be built so that the engine
+  /// can still rasterize it before its target time.
+  ///
+  /// This is on the same clock as the time stamps passed to
+  /// [PlatformDispatcher.onBeginFrame], and is earlier than the target time
+  /// of the frame by the time recent frames took to rasterize.
+  ///
+  /// If not provided, defaults to [Duration.zero].
+  final Duration buildDeadline;
 }
 
 /// Platform specific configuration for gesture behavior, such as touch slop.
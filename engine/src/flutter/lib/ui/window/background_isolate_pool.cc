@@ -0,0 +1,43 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/window/background_isolate_pool.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace flutter {
+
+namespace {
+
+// The pool sized from the cores of a device never has more isolates than
+// this, which is enough to keep the cores of most phones busy.
+constexpr size_t kMaxBackgroundIsolatePoolSizeFromCores = 4;
+
+// The cores the UI and raster threads are expected to keep busy.
+constexpr size_t kEngineThreadCores = 2;
+
+}  // namespace
+
+size_t GetBackgroundIsolatePoolSize(const Settings& settings,
+                                    size_t core_count) {
+  if (settings.background_isolate_pool_size ==
+      Settings::kBackgroundIsolatePoolSizeFromCores) {
+    const size_t free_cores =
+        core_count > kEngineThreadCores ? core_count - kEngineThreadCores : 1;
+    return std::min(free_cores, kMaxBackgroundIsolatePoolSizeFromCores);
+  }
+  if (settings.background_isolate_pool_size <= 0) {
+    return 0;
+  }
+  return std::min(static_cast<size_t>(settings.background_isolate_pool_size),
+                  kMaxBackgroundIsolatePoolSize);
+}
+
+size_t GetBackgroundIsolatePoolSize(const Settings& settings) {
+  return GetBackgroundIsolatePoolSize(settings,
+                                      std::thread::hardware_concurrency());
+}
+
+}  // namespace flutter
@@ -0,0 +1,41 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_WINDOW_BACKGROUND_ISOLATE_POOL_H_
+#define FLUTTER_LIB_UI_WINDOW_BACKGROUND_ISOLATE_POOL_H_
+
+#include <cstddef>
+
+#include "flutter/common/settings.h"
+
+namespace flutter {
+
+/// The most background isolates that are kept spawned, as each one holds on
+/// to its own heap while it is idle.
+constexpr size_t kMaxBackgroundIsolatePoolSize = 16;
+
+//------------------------------------------------------------------------------
+/// @brief      The number of background isolates that the root isolate keeps
+///             spawned for `runOnBackgroundIsolate`, or 0 if it doesn't keep
+///             a pool.
+///
+///             A pool sized from the cores leaves a core to each of the UI
+///             and raster threads, and is kept small so that the idle
+///             isolates don't take much memory.
+///
+/// @param[in]  settings    The settings of the root isolate.
+/// @param[in]  core_count  The number of cores of the device.
+///
+size_t GetBackgroundIsolatePoolSize(const Settings& settings,
+                                    size_t core_count);
+
+//------------------------------------------------------------------------------
+/// @brief      The number of background isolates of the pool of the root
+///             isolate on this device.
+///
+size_t GetBackgroundIsolatePoolSize(const Settings& settings);
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_WINDOW_BACKGROUND_ISOLATE_POOL_H_
@@ -0,0 +1,40 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/window/background_isolate_pool.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(BackgroundIsolatePoolTest, NoPoolByDefault) {
+  Settings settings;
+  EXPECT_EQ(GetBackgroundIsolatePoolSize(settings, 8), 0u);
+}
+
+TEST(BackgroundIsolatePoolTest, RequestedSizeIsCapped) {
+  Settings settings;
+  settings.background_isolate_pool_size = 3;
+  EXPECT_EQ(GetBackgroundIsolatePoolSize(settings, 2), 3u);
+  settings.background_isolate_pool_size = 100;
+  EXPECT_EQ(GetBackgroundIsolatePoolSize(settings, 2),
+            kMaxBackgroundIsolatePoolSize);
+}
+
+TEST(BackgroundIsolatePoolTest, SizeFromCoresLeavesCoresToTheEngine) {
+  Settings settings;
+  settings.background_isolate_pool_size =
+      Settings::kBackgroundIsolatePoolSizeFromCores;
+  // The number of cores is unknown.
+  EXPECT_EQ(GetBackgroundIsolatePoolSize(settings, 0), 1u);
+  EXPECT_EQ(GetBackgroundIsolatePoolSize(settings, 2), 1u);
+  EXPECT_EQ(GetBackgroundIsolatePoolSize(settings, 4), 2u);
+  EXPECT_EQ(GetBackgroundIsolatePoolSize(settings, 5), 3u);
+  EXPECT_EQ(GetBackgroundIsolatePoolSize(settings, 12), 4u);
+  EXPECT_GE(GetBackgroundIsolatePoolSize(settings), 1u);
+}
+
+}  // namespace testing
+}  // namespace flutter
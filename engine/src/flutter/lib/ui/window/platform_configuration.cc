@@ -27,6 +27,26 @@ Dart_Handle ToByteData(const fml::Mapping& buffer) {
   return tonic::DartByteData::Create(buffer.GetMapping(), buffer.GetSize());
 }
 
+void FreeFinalizer(void* isolate_callback_data, void* peer) {
+  free(peer);
+}
+
+// Hands large buffers to Dart as external typed data instead of copying them
+// into the Dart heap.
+Dart_Handle ToByteData(fml::MallocMapping buffer) {
+  size_t size = buffer.GetSize();
+  if (size < tonic::DartByteData::kExternalSizeThreshold) {
+    return ToByteData(static_cast<const fml::Mapping&>(buffer));
+  }
+  uint8_t* data = buffer.Release();
+  Dart_Handle handle = Dart_NewExternalTypedDataWithFinalizer(
+      Dart_TypedData_kByteData, data, size, data, size, FreeFinalizer);
+  if (Dart_IsError(handle)) {
+    free(data);
+  }
+  return handle;
+}
+
 }  // namespace
 
 PlatformConfigurationClient::~PlatformConfigurationClient() {}
@@ -86,6 +106,9 @@ void PlatformConfiguration::DidCreateIsolate() {
                   Dart_GetField(library, tonic::ToDart("_drawFrame")));
   report_timings_.Set(tonic::DartState::Current(),
                       Dart_GetField(library, tonic::ToDart("_reportTimings")));
+  warm_up_background_isolate_pool_.Set(
+      tonic::DartState::Current(),
+      Dart_GetField(library, tonic::ToDart("_warmUpBackgroundIsolatePool")));
 }
 
 bool PlatformConfiguration::AddView(int64_t view_id,
@@ -348,7 +371,7 @@ void PlatformConfiguration::DispatchPlatformMessage(
   }
   tonic::DartState::Scope scope(dart_state);
   Dart_Handle data_handle =
-      (message->hasData()) ? ToByteData(message->data()) : Dart_Null();
+      (message->hasData()) ? ToByteData(message->releaseData()) : Dart_Null();
   if (Dart_IsError(data_handle)) {
     FML_DLOG(WARNING)
         << "Dropping platform message because of a Dart error on channel: "
@@ -413,7 +436,8 @@ void PlatformConfiguration::DispatchSemanticsAction(int64_t view_id,
 }
 
 void PlatformConfiguration::BeginFrame(fml::TimePoint frameTime,
-                                       uint64_t frame_number) {
+                                       uint64_t frame_number,
+                                       fml::TimePoint build_deadline) {
   std::shared_ptr<tonic::DartState> dart_state =
       begin_frame_.dart_state().lock();
   if (!dart_state) {
@@ -440,12 +464,15 @@ void PlatformConfiguration::BeginFrame(fml::TimePoint frameTime,
     microseconds = last_microseconds_;
   }
   last_microseconds_ = microseconds;
+  int64_t build_deadline_microseconds =
+      build_deadline.ToEpochDelta().ToMicroseconds();
 
-  tonic::CheckAndHandleError(
-      tonic::DartInvoke(begin_frame_.Get(), {
-                                                Dart_NewInteger(microseconds),
-                                                Dart_NewInteger(frame_number),
-                                            }));
+  tonic::CheckAndHandleError(tonic::DartInvoke(
+      begin_frame_.Get(), {
+                              Dart_NewInteger(microseconds),
+                              Dart_NewInteger(frame_number),
+                              Dart_NewInteger(build_deadline_microseconds),
+                          }));
 
   UIDartState::Current()->FlushMicrotasksNow();
 
@@ -479,6 +506,17 @@ void PlatformConfiguration::ReportTimings(std::vector<int64_t> timings) {
                                                }));
 }
 
+void PlatformConfiguration::WarmUpBackgroundIsolatePool() {
+  std::shared_ptr<tonic::DartState> dart_state =
+      warm_up_background_isolate_pool_.dart_state().lock();
+  if (!dart_state) {
+    return;
+  }
+  tonic::DartState::Scope scope(dart_state);
+  tonic::CheckAndHandleError(
+      tonic::DartInvoke(warm_up_background_isolate_pool_.Get(), {}));
+}
+
 const ViewportMetrics* PlatformConfiguration::GetMetrics(int view_id) {
   auto found = metrics_.find(view_id);
   if (found != metrics_.end()) {
@@ -742,6 +780,16 @@ void PlatformConfigurationNativeApi::SendChannelUpdate(const std::string& name,
       name, listening);
 }
 
+void PlatformConfigurationNativeApi::SetPortPlatformMessageHandler(
+    const std::string& name,
+    int64_t port) {
+  UIDartState::ThrowIfUIOperationsProhibited();
+  UIDartState::Current()
+      ->platform_configuration()
+      ->client()
+      ->SetPlatformMessagePort(name, port);
+}
+
 double PlatformConfigurationNativeApi::GetScaledFontSize(
     double unscaled_font_size,
     int configuration_id) {
@@ -252,6 +252,18 @@ class PlatformConfigurationClient {
   ///
   virtual void SendChannelUpdate(std::string name, bool listening) = 0;
 
+  //--------------------------------------------------------------------------
+  /// @brief      Invoked when the messages on a platform channel are to be
+  ///             delivered to a Dart port instead of the root isolate.
+  ///
+  /// @param[in]  name             The name of the platform channel.
+  ///
+  /// @param[in]  port             The port to deliver the messages to, or
+  ///                              `ILLEGAL_PORT` to deliver them to the root
+  ///                              isolate again.
+  ///
+  virtual void SetPlatformMessagePort(std::string name, int64_t port) = 0;
+
   //--------------------------------------------------------------------------
   /// @brief      Synchronously invokes platform-specific APIs to apply the
   ///             system text scaling on the given unscaled font size.
@@ -502,7 +514,12 @@ class PlatformConfiguration final {
   ///                          debug information with frame timings and timeline
   ///                          events.
   ///
-  void BeginFrame(fml::TimePoint frame_time, uint64_t frame_number);
+  /// @param[in]  build_deadline The point by which the frame should be built
+  ///                            so that it can be rasterized in time.
+  ///
+  void BeginFrame(fml::TimePoint frame_time,
+                  uint64_t frame_number,
+                  fml::TimePoint build_deadline);
 
   //----------------------------------------------------------------------------
   /// @brief      Dart code cannot fully measure the time it takes for a
@@ -533,6 +550,14 @@ class PlatformConfiguration final {
   ///
   void ReportTimings(std::vector<int64_t> timings);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Spawn the isolates of the pool of background isolates of
+  ///             the root isolate that are not spawned yet, so that the
+  ///             computations of `runOnBackgroundIsolate` don't wait for
+  ///             them. Does nothing if the root isolate doesn't keep a pool.
+  ///
+  void WarmUpBackgroundIsolatePool();
+
   //----------------------------------------------------------------------------
   /// @brief      Retrieves the viewport metrics with the given ID managed by
   ///             the `PlatformConfiguration`.
@@ -588,6 +613,7 @@ class PlatformConfiguration final {
   tonic::DartPersistentValue begin_frame_;
   tonic::DartPersistentValue draw_frame_;
   tonic::DartPersistentValue report_timings_;
+  tonic::DartPersistentValue warm_up_background_isolate_pool_;
 
   uint64_t last_frame_number_ = 0;
   int64_t last_microseconds_ = 0;
@@ -667,6 +693,9 @@ class PlatformConfigurationNativeApi {
 
   static void SendChannelUpdate(const std::string& name, bool listening);
 
+  static void SetPortPlatformMessageHandler(const std::string& name,
+                                            int64_t port);
+
   static void RequestViewFocusChange(int64_t view_id,
                                      int64_t state,
                                      int64_t direction);
@@ -408,9 +408,9 @@ TEST_F(PlatformConfigurationTest, BeginFrameMonotonic) {
         auto one = zero + offset;
         auto two = one + offset;
 
-        platform->BeginFrame(zero, 1);
-        platform->BeginFrame(two, 2);
-        platform->BeginFrame(one, 3);
+        platform->BeginFrame(zero, 1, zero);
+        platform->BeginFrame(two, 2, two);
+        platform->BeginFrame(one, 3, one);
       });
 
   frame_latch->Wait();
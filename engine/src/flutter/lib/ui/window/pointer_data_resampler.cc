@@ -0,0 +1,138 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/window/pointer_data_resampler.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace flutter {
+
+namespace {
+
+bool IsResamplable(const PointerData& data) {
+  return (data.change == PointerData::Change::kMove ||
+          data.change == PointerData::Change::kHover) &&
+         data.signal_kind == PointerData::SignalKind::kNone;
+}
+
+// Whether |next| may replace |previous| in the coalesced pointer data.
+bool CanCoalesce(const PointerData& previous, const PointerData& next) {
+  return previous.change == next.change && previous.kind == next.kind &&
+         previous.buttons == next.buttons && previous.view_id == next.view_id;
+}
+
+std::unique_ptr<PointerDataPacket> CreatePacket(
+    const std::vector<PointerData>& data) {
+  auto packet = std::make_unique<PointerDataPacket>(data.size());
+  for (size_t i = 0; i < data.size(); i++) {
+    packet->SetPointerData(i, data[i]);
+  }
+  return packet;
+}
+
+}  // namespace
+
+PointerDataResampler::PointerDataResampler() = default;
+
+PointerDataResampler::~PointerDataResampler() = default;
+
+bool PointerDataResampler::ContainsResamplableData(
+    const PointerDataPacket& packet) {
+  for (size_t i = 0; i < packet.GetLength(); i++) {
+    if (IsResamplable(packet.GetPointerData(i))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void PointerDataResampler::AddPacket(const PointerDataPacket& packet) {
+  pending_.reserve(pending_.size() + packet.GetLength());
+  for (size_t i = 0; i < packet.GetLength(); i++) {
+    pending_.push_back(packet.GetPointerData(i));
+  }
+}
+
+std::unique_ptr<PointerDataPacket> PointerDataResampler::Resample(
+    int64_t sample_time) {
+  history_.clear();
+
+  // Only the moves of a device after its last other pointer data may be
+  // kept for the next frame, as that pointer data cannot be delayed.
+  std::unordered_map<int64_t, size_t> last_unresamplable;
+  for (size_t i = 0; i < pending_.size(); i++) {
+    if (!IsResamplable(pending_[i])) {
+      last_unresamplable[pending_[i].device] = i;
+    }
+  }
+
+  std::vector<PointerData> resampled;
+  std::vector<PointerData> deferred;
+  // The index in |resampled| of the move each device is coalescing into.
+  std::unordered_map<int64_t, size_t> open_moves;
+  std::unordered_set<int64_t> deferred_devices;
+  for (size_t i = 0; i < pending_.size(); i++) {
+    const PointerData& data = pending_[i];
+    if (!IsResamplable(data)) {
+      open_moves.erase(data.device);
+      resampled.push_back(data);
+      continue;
+    }
+
+    auto last = last_unresamplable.find(data.device);
+    bool trailing = last == last_unresamplable.end() || last->second < i;
+    if (trailing && (deferred_devices.count(data.device) != 0 ||
+                     (data.time_stamp > sample_time &&
+                      data.time_stamp - sample_time <= kMaxDeferralMicros))) {
+      auto open = open_moves.find(data.device);
+      if (open != open_moves.end()) {
+        // Move the coalesced sample to where the pointer was at the sample
+        // time, between it and this sample.
+        PointerData& previous = resampled[open->second];
+        if (CanCoalesce(previous, data) && previous.time_stamp < sample_time) {
+          double t = static_cast<double>(sample_time - previous.time_stamp) /
+                     static_cast<double>(data.time_stamp - previous.time_stamp);
+          previous.physical_x += (data.physical_x - previous.physical_x) * t;
+          previous.physical_y += (data.physical_y - previous.physical_y) * t;
+          previous.time_stamp = sample_time;
+        }
+        open_moves.erase(open);
+      }
+      deferred_devices.insert(data.device);
+      deferred.push_back(data);
+      continue;
+    }
+
+    if (keep_history_) {
+      history_.push_back(data);
+    }
+    auto open = open_moves.find(data.device);
+    if (open != open_moves.end() &&
+        CanCoalesce(resampled[open->second], data)) {
+      resampled[open->second] = data;
+    } else {
+      open_moves[data.device] = resampled.size();
+      resampled.push_back(data);
+    }
+  }
+
+  pending_ = std::move(deferred);
+  return CreatePacket(resampled);
+}
+
+void PointerDataResampler::SetKeepHistory(bool keep_history) {
+  keep_history_ = keep_history;
+  if (!keep_history_) {
+    history_.clear();
+  }
+}
+
+std::unique_ptr<PointerDataPacket> PointerDataResampler::TakeHistory() {
+  auto packet = CreatePacket(history_);
+  history_.clear();
+  return packet;
+}
+
+}  // namespace flutter
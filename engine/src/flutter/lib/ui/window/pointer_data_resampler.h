@@ -0,0 +1,83 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_WINDOW_POINTER_DATA_RESAMPLER_H_
+#define FLUTTER_LIB_UI_WINDOW_POINTER_DATA_RESAMPLER_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "flutter/lib/ui/window/pointer_data_packet.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// Coalesces the pointer data received between two frames into as few events
+/// as possible.
+///
+/// Input devices that are polled faster than the display refreshes, such as
+/// styluses and gaming mice, deliver several moves per frame. The resampler
+/// merges the consecutive moves and hovers of a device into a single event
+/// positioned where the pointer was at the sample time of the frame, which is
+/// interpolated between the two samples around it. Samples taken after the
+/// sample time are kept for the next frame. All other pointer data, such as
+/// downs, ups and signals, is passed through unmodified and in order.
+///
+/// The raw moves and hovers merged into the last resampled packet can be
+/// retrieved with |TakeHistory| once |SetKeepHistory| has been enabled.
+///
+/// The time stamps of the pointer data and the sample times are in
+/// microseconds on the clock of `fml::TimePoint`.
+///
+class PointerDataResampler {
+ public:
+  /// Samples taken further than this after the sample time are assumed to be
+  /// on another clock and are never kept for a later frame.
+  static constexpr int64_t kMaxDeferralMicros = 100000;
+
+  PointerDataResampler();
+
+  ~PointerDataResampler();
+
+  /// Whether |packet| contains moves or hovers that may be resampled.
+  static bool ContainsResamplableData(const PointerDataPacket& packet);
+
+  /// Queues the pointer data of |packet| for the next call to |Resample|.
+  void AddPacket(const PointerDataPacket& packet);
+
+  /// Whether pointer data is queued for a call to |Resample|.
+  bool HasPendingData() const { return !pending_.empty(); }
+
+  //----------------------------------------------------------------------------
+  /// @brief      Coalesces the queued pointer data.
+  ///
+  /// @param[in]  sample_time  The time the moves and hovers are resampled at.
+  ///                          Pass the maximum value of `int64_t` to flush
+  ///                          all queued pointer data without interpolation.
+  ///
+  /// @return     The coalesced pointer data, which may be empty if all queued
+  ///             samples were taken after |sample_time|.
+  ///
+  std::unique_ptr<PointerDataPacket> Resample(int64_t sample_time);
+
+  /// Whether the raw moves and hovers merged by |Resample| are retained.
+  void SetKeepHistory(bool keep_history);
+
+  /// Returns the raw moves and hovers that were merged into the packet
+  /// returned by the last call to |Resample|.
+  std::unique_ptr<PointerDataPacket> TakeHistory();
+
+ private:
+  std::vector<PointerData> pending_;
+  bool keep_history_ = false;
+  std::vector<PointerData> history_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(PointerDataResampler);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_WINDOW_POINTER_DATA_RESAMPLER_H_
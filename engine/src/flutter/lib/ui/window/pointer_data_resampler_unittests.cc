@@ -0,0 +1,141 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/window/pointer_data_resampler.h"
+
+#include <limits>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+PointerData CreateSample(PointerData::Change change,
+                         int64_t device,
+                         int64_t time_stamp,
+                         double x,
+                         double y) {
+  PointerData data;
+  data.Clear();
+  data.change = change;
+  data.kind = PointerData::DeviceKind::kStylus;
+  data.signal_kind = PointerData::SignalKind::kNone;
+  data.device = device;
+  data.time_stamp = time_stamp;
+  data.physical_x = x;
+  data.physical_y = y;
+  return data;
+}
+
+std::unique_ptr<PointerDataPacket> CreatePacket(
+    const std::vector<PointerData>& samples) {
+  auto packet = std::make_unique<PointerDataPacket>(samples.size());
+  for (size_t i = 0; i < samples.size(); i++) {
+    packet->SetPointerData(i, samples[i]);
+  }
+  return packet;
+}
+
+constexpr int64_t kFlush = std::numeric_limits<int64_t>::max();
+
+}  // namespace
+
+TEST(PointerDataResamplerTest, CoalescesMovesOfEachDevice) {
+  PointerDataResampler resampler;
+  resampler.AddPacket(*CreatePacket({
+      CreateSample(PointerData::Change::kMove, 1, 1000, 1, 1),
+      CreateSample(PointerData::Change::kMove, 2, 1000, 10, 10),
+      CreateSample(PointerData::Change::kMove, 1, 2000, 2, 2),
+  }));
+  resampler.AddPacket(*CreatePacket({
+      CreateSample(PointerData::Change::kMove, 1, 3000, 3, 3),
+      CreateSample(PointerData::Change::kMove, 2, 3000, 30, 30),
+  }));
+  EXPECT_TRUE(resampler.HasPendingData());
+
+  auto packet = resampler.Resample(kFlush);
+  ASSERT_EQ(packet->GetLength(), 2u);
+  EXPECT_EQ(packet->GetPointerData(0).device, 1);
+  EXPECT_EQ(packet->GetPointerData(0).physical_x, 3);
+  EXPECT_EQ(packet->GetPointerData(0).time_stamp, 3000);
+  EXPECT_EQ(packet->GetPointerData(1).device, 2);
+  EXPECT_EQ(packet->GetPointerData(1).physical_x, 30);
+  EXPECT_FALSE(resampler.HasPendingData());
+}
+
+TEST(PointerDataResamplerTest, InterpolatesAtSampleTime) {
+  PointerDataResampler resampler;
+  resampler.AddPacket(*CreatePacket({
+      CreateSample(PointerData::Change::kMove, 1, 1000, 0, 0),
+      CreateSample(PointerData::Change::kMove, 1, 2000, 10, 20),
+      CreateSample(PointerData::Change::kMove, 1, 3000, 20, 40),
+  }));
+
+  auto packet = resampler.Resample(2500);
+  ASSERT_EQ(packet->GetLength(), 1u);
+  EXPECT_EQ(packet->GetPointerData(0).time_stamp, 2500);
+  EXPECT_DOUBLE_EQ(packet->GetPointerData(0).physical_x, 15);
+  EXPECT_DOUBLE_EQ(packet->GetPointerData(0).physical_y, 30);
+
+  // The sample after the sample time is left for the next frame.
+  ASSERT_TRUE(resampler.HasPendingData());
+  packet = resampler.Resample(kFlush);
+  ASSERT_EQ(packet->GetLength(), 1u);
+  EXPECT_EQ(packet->GetPointerData(0).time_stamp, 3000);
+  EXPECT_EQ(packet->GetPointerData(0).physical_x, 20);
+}
+
+TEST(PointerDataResamplerTest, DoesNotDelayOrMergeAcrossOtherPointerData) {
+  PointerDataResampler resampler;
+  resampler.AddPacket(*CreatePacket({
+      CreateSample(PointerData::Change::kMove, 1, 1000, 1, 1),
+      CreateSample(PointerData::Change::kMove, 1, 2000, 2, 2),
+      CreateSample(PointerData::Change::kUp, 1, 3000, 2, 2),
+      CreateSample(PointerData::Change::kHover, 1, 4000, 4, 4),
+      CreateSample(PointerData::Change::kHover, 1, 5000, 5, 5),
+  }));
+
+  auto packet = resampler.Resample(1500);
+  ASSERT_EQ(packet->GetLength(), 2u);
+  EXPECT_EQ(packet->GetPointerData(0).change, PointerData::Change::kMove);
+  EXPECT_EQ(packet->GetPointerData(0).physical_x, 2);
+  EXPECT_EQ(packet->GetPointerData(1).change, PointerData::Change::kUp);
+
+  // The hovers after the up can wait for the next frame.
+  packet = resampler.Resample(kFlush);
+  ASSERT_EQ(packet->GetLength(), 1u);
+  EXPECT_EQ(packet->GetPointerData(0).change, PointerData::Change::kHover);
+  EXPECT_EQ(packet->GetPointerData(0).physical_x, 5);
+}
+
+TEST(PointerDataResamplerTest, KeepsHistoryOnRequest) {
+  PointerDataResampler resampler;
+  resampler.AddPacket(*CreatePacket({
+      CreateSample(PointerData::Change::kMove, 1, 1000, 1, 1),
+      CreateSample(PointerData::Change::kMove, 1, 2000, 2, 2),
+  }));
+  resampler.Resample(kFlush);
+  EXPECT_EQ(resampler.TakeHistory()->GetLength(), 0u);
+
+  resampler.SetKeepHistory(true);
+  resampler.AddPacket(*CreatePacket({
+      CreateSample(PointerData::Change::kMove, 1, 3000, 3, 3),
+      CreateSample(PointerData::Change::kMove, 1, 4000, 4, 4),
+      CreateSample(PointerData::Change::kMove, 1, 5000, 5, 5),
+  }));
+  auto packet = resampler.Resample(kFlush);
+  ASSERT_EQ(packet->GetLength(), 1u);
+
+  auto history = resampler.TakeHistory();
+  ASSERT_EQ(history->GetLength(), 3u);
+  EXPECT_EQ(history->GetPointerData(0).physical_x, 3);
+  EXPECT_EQ(history->GetPointerData(1).physical_x, 4);
+  EXPECT_EQ(history->GetPointerData(2).physical_x, 5);
+  EXPECT_EQ(resampler.TakeHistory()->GetLength(), 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
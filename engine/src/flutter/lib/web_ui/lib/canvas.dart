@@ -46,6 +46,18 @@ abstract class Vertices {
   bool get debugDisposed;
 }
 
+abstract class CanvasCommands {
+  factory CanvasCommands() => engine.EngineCanvasCommands();
+  bool get isEmpty;
+  void setColor(Color color);
+  void setStrokeWidth(double width);
+  void drawLine(Offset p1, Offset p2);
+  void drawRect(Rect rect);
+  void drawOval(Rect rect);
+  void drawCircle(Offset c, double radius);
+  void clear();
+}
+
 abstract class PictureRecorder {
   factory PictureRecorder() => engine.renderer.createPictureRecorder();
   bool get isRecording;
@@ -90,6 +102,7 @@ abstract class Canvas {
   void drawParagraph(Paragraph paragraph, Offset offset);
   void drawPoints(PointMode pointMode, List<Offset> points, Paint paint);
   void drawRawPoints(PointMode pointMode, Float32List points, Paint paint);
+  void drawCommands(CanvasCommands commands, Paint paint);
 
   void drawVertices(Vertices vertices, BlendMode blendMode, Paint paint);
   void drawAtlas(
@@ -995,6 +995,10 @@ class ImageDescriptor {
 
     return createBmp(_data!, width, height, _rowBytes ?? width, _format!);
   }
+
+  Future<Image> decodeRegion(Rect region, {double scale = 1.0}) {
+    throw UnsupportedError('ImageDescriptor.decodeRegion is not supported on web.');
+  }
 }
 
 abstract class FragmentProgram {
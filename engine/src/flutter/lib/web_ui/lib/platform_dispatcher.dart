@@ -72,6 +72,8 @@ abstract class PlatformDispatcher {
 
   void registerBackgroundIsolate(RootIsolateToken token);
 
+  void setPortPlatformMessageHandler(String name, Object? port);
+
   PlatformMessageCallback? get onPlatformMessage;
   set onPlatformMessage(PlatformMessageCallback? callback);
 
@@ -31,3 +31,11 @@ Future<R> runOnPlatformThread<R>(FutureOr<R> Function() computation) => Future<R
 
 /// Returns whether the current isolate is running on the platform thread.
 bool isRunningOnPlatformThread = true;
+
+/// Runs [computation] on a background isolate and returns the result.
+///
+/// The web has no isolates, so this runs [computation] in the current
+/// isolate.
+///
+/// This API is currently experimental.
+Future<R> runOnBackgroundIsolate<R>(FutureOr<R> Function() computation) => Future<R>(computation);
@@ -0,0 +1,61 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:ui/ui.dart' as ui;
+
+typedef _CanvasCommand = void Function(ui.Canvas canvas, ui.Paint paint);
+
+/// The [ui.CanvasCommands] of the web engine.
+///
+/// The renderers have no cost per draw call to save, so the canvases draw the
+/// commands by making their draw calls one by one.
+class EngineCanvasCommands implements ui.CanvasCommands {
+  final List<_CanvasCommand> _commands = <_CanvasCommand>[];
+
+  @override
+  bool get isEmpty => _commands.isEmpty;
+
+  @override
+  void setColor(ui.Color color) {
+    _commands.add((ui.Canvas canvas, ui.Paint paint) => paint.color = color);
+  }
+
+  @override
+  void setStrokeWidth(double width) {
+    _commands.add((ui.Canvas canvas, ui.Paint paint) => paint.strokeWidth = width);
+  }
+
+  @override
+  void drawLine(ui.Offset p1, ui.Offset p2) {
+    _commands.add((ui.Canvas canvas, ui.Paint paint) => canvas.drawLine(p1, p2, paint));
+  }
+
+  @override
+  void drawRect(ui.Rect rect) {
+    _commands.add((ui.Canvas canvas, ui.Paint paint) => canvas.drawRect(rect, paint));
+  }
+
+  @override
+  void drawOval(ui.Rect rect) {
+    _commands.add((ui.Canvas canvas, ui.Paint paint) => canvas.drawOval(rect, paint));
+  }
+
+  @override
+  void drawCircle(ui.Offset c, double radius) {
+    _commands.add((ui.Canvas canvas, ui.Paint paint) => canvas.drawCircle(c, radius, paint));
+  }
+
+  @override
+  void clear() {
+    _commands.clear();
+  }
+
+  /// Draws the commands to `canvas`, starting with a copy of `paint`.
+  void drawOn(ui.Canvas canvas, ui.Paint paint) {
+    final ui.Paint commandPaint = ui.Paint.from(paint);
+    for (final _CanvasCommand command in _commands) {
+      command(canvas, commandPaint);
+    }
+  }
+}
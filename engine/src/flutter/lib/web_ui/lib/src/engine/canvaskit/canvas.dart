@@ -255,6 +255,11 @@ class CkCanvas implements LayerCanvas {
     skPaint.delete();
   }
 
+  @override
+  void drawCommands(ui.CanvasCommands commands, ui.Paint paint) {
+    (commands as EngineCanvasCommands).drawOn(this, paint);
+  }
+
   @override
   void drawRRect(ui.RRect rrect, ui.Paint paint) {
     assert(rrectIsValid(rrect));
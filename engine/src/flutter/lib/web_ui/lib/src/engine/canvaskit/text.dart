@@ -1157,6 +1157,11 @@ class CkParagraphBuilder implements ui.ParagraphBuilder {
     return CkParagraph(builtParagraph, _style);
   }
 
+  @override
+  Future<ui.Paragraph> buildAndLayout(ui.ParagraphConstraints constraints) {
+    return Future<ui.Paragraph>.value(build()..layout(constraints));
+  }
+
   /// Builds the CkParagraph with the builder and deletes the builder.
   SkParagraph _buildSkParagraph() {
     _paragraphBuilder.injectClientICUIfNeeded();
@@ -384,6 +384,11 @@ class EnginePlatformDispatcher extends ui.PlatformDispatcher {
     throw Exception("Isolates aren't supported in web.");
   }
 
+  @override
+  void setPortPlatformMessageHandler(String name, Object? port) {
+    throw Exception("Isolates aren't supported in web.");
+  }
+
   // TODO(ianh): Deprecate onPlatformMessage once the framework is moved over
   // to using channel buffers exclusively.
   @override
@@ -309,6 +309,11 @@ class SkwasmCanvas implements LayerCanvas {
         paintDispose(paintHandle);
       });
 
+  @override
+  void drawCommands(ui.CanvasCommands commands, ui.Paint paint) {
+    (commands as EngineCanvasCommands).drawOn(this, paint);
+  }
+
   @override
   void drawVertices(ui.Vertices vertices, ui.BlendMode blendMode, ui.Paint paint) {
     final PaintHandle paintHandle = (paint as SkwasmPaint).toRawPaint();
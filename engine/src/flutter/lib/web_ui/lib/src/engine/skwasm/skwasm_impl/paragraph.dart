@@ -1085,6 +1085,11 @@ class SkwasmParagraphBuilder extends SkwasmObjectWrapper<RawParagraphBuilder>
     return paragraph;
   }
 
+  @override
+  Future<ui.Paragraph> buildAndLayout(ui.ParagraphConstraints constraints) {
+    return Future<ui.Paragraph>.value(build()..layout(constraints));
+  }
+
   @override
   int get placeholderCount => placeholderScales.length;
 
@@ -34,3 +34,6 @@ external bool skwasmIsHeavy();
 
 @Native<Void Function(Pointer<Uint32>)>(symbol: 'skwasm_getLiveObjectCounts', isLeaf: true)
 external void skwasmGetLiveObjectCounts(Pointer<Uint32> objectCounts);
+
+@Native<Void Function(Pointer<Uint32>)>(symbol: 'skwasm_getLiveObjectBytes', isLeaf: true)
+external void skwasmGetLiveObjectBytes(Pointer<Uint32> objectBytes);
@@ -516,6 +516,17 @@ class SkwasmRenderer extends Renderer {
           'verticesCount': counts[27],
         };
         downloadDebugInfo('live_object_counts', countsJson);
+
+        final Pointer<Uint32> bytes = scope.allocUint32Array(5);
+        skwasmGetLiveObjectBytes(bytes);
+        final bytesJson = <String, dynamic>{
+          'dataBytes': bytes[0],
+          'imageBytes': bytes[1],
+          'pictureBytes': bytes[2],
+          'heapSize': bytes[3],
+          'heapAllocatedBytes': bytes[4],
+        };
+        downloadDebugInfo('live_object_bytes', bytesJson);
       });
 
       var i = 0;
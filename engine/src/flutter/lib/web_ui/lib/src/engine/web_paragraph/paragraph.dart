@@ -1303,6 +1303,11 @@ class WebParagraphBuilder implements ui.ParagraphBuilder {
     return paragraph;
   }
 
+  @override
+  Future<ui.Paragraph> buildAndLayout(ui.ParagraphConstraints constraints) {
+    return Future<ui.Paragraph>.value(build()..layout(constraints));
+  }
+
   @override
   int get placeholderCount => _placeholderCount;
   int _placeholderCount = 0;
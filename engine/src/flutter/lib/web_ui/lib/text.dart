@@ -666,11 +666,15 @@ abstract class Paragraph {
 
 abstract class ParagraphBuilder {
   factory ParagraphBuilder(ParagraphStyle style) => engine.renderer.createParagraphBuilder(style);
+  // The web has no background thread to lay out paragraphs on.
+  factory ParagraphBuilder.background(ParagraphStyle style) =>
+      engine.renderer.createParagraphBuilder(style);
 
   void pushStyle(TextStyle style);
   void pop();
   void addText(String text);
   Paragraph build();
+  Future<Paragraph> buildAndLayout(ParagraphConstraints constraints);
   int get placeholderCount;
   List<double> get placeholderScales;
   void addPlaceholder(
@@ -165,7 +165,7 @@ abstract final class IsolateNameServer {
 SingletonFlutterWindow get window => engine.window;
 
 class FrameData {
-  const FrameData({this.frameNumber = 0});
+  const FrameData({this.frameNumber = 0, this.buildDeadline = Duration.zero});
 
   /// The number of the current frame.
   ///
@@ -174,6 +174,12 @@ class FrameData {
   ///
   /// If not provided, defaults to 0.
   final int frameNumber;
+
+  /// The time by which the current frame should be built so that the engine
+  /// can still rasterize it before its target time.
+  ///
+  /// If not provided, defaults to [Duration.zero].
+  final Duration buildDeadline;
 }
 
 class GestureSettings {
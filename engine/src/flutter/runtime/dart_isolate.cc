@@ -882,6 +882,7 @@ bool DartIsolate::MarkIsolateRunnable() {
 [[nodiscard]] static bool InvokeMainEntrypoint(
     Dart_Handle user_entrypoint_function,
     Dart_Handle args) {
+  TRACE_EVENT0("flutter", "InvokeMainEntrypoint");
   if (tonic::CheckAndHandleError(user_entrypoint_function)) {
     FML_LOG(ERROR) << "Could not resolve main entrypoint function.";
     return false;
@@ -1018,10 +1019,16 @@ Dart_Isolate DartIsolate::DartCreateAndStartServiceIsolate(
     return nullptr;
   }
 
+  // A negative port leaves the server stopped until it is requested.
+  const intptr_t server_port =
+      settings.defer_vm_service_server
+          ? -1
+          : static_cast<intptr_t>(settings.vm_service_port);
+
   tonic::DartState::Scope scope(service_isolate);
   if (!DartServiceIsolate::Startup(
           settings.vm_service_host,            // server IP address
-          settings.vm_service_port,            // server VM service port
+          server_port,                         // server VM service port
           tonic::DartState::HandleLibraryTag,  // embedder library tag handler
           false,  //  disable websocket origin check
           settings.disable_service_auth_codes,  // disable VM service auth codes
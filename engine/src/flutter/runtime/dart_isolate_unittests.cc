@@ -733,6 +733,7 @@ class FakePlatformConfigurationClient : public PlatformConfigurationClient {
   }
   void RequestDartDeferredLibrary(intptr_t loading_unit_id) override {}
   void SendChannelUpdate(std::string name, bool listening) override {}
+  void SetPlatformMessagePort(std::string name, int64_t port) override {}
   double GetScaledFontSize(double unscaled_font_size,
                            int configuration_id) const override {
     return 0;
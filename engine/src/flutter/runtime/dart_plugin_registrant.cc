@@ -40,6 +40,7 @@ bool InvokeDartPluginRegistrantIfAvailable(Dart_Handle library_handle) {
 }
 
 bool FindAndInvokeDartPluginRegistrant() {
+  TRACE_EVENT0("flutter", "FindAndInvokeDartPluginRegistrant");
   std::string library_name =
       dart_plugin_registrant_library_override == nullptr
           ? "package:flutter/src/dart_plugin_registrant.dart"
@@ -4,8 +4,10 @@
 
 #include "flutter/runtime/dart_snapshot.h"
 
+#include <optional>
 #include <sstream>
 
+#include "flutter/fml/mapping_registry.h"
 #include "flutter/fml/native_library.h"
 #include "flutter/fml/paths.h"
 #include "flutter/fml/trace_event.h"
@@ -29,14 +31,43 @@ const char* DartSnapshot::kIsolateInstructionsSymbol =
 
 #if !DART_SNAPSHOT_STATIC_LINK
 
-static std::unique_ptr<const fml::Mapping> GetFileMapping(
+// The snapshots found by a path or a symbol are the same for every engine in
+// the process that looks them up, so the engines share one mapping of each.
+static std::shared_ptr<const fml::Mapping> GetFileMapping(
     const std::string& path,
     bool executable) {
-  if (executable) {
-    return fml::FileMapping::CreateReadExecute(path);
-  } else {
-    return fml::FileMapping::CreateReadOnly(path);
-  }
+  return fml::MappingRegistry::GetRegistryForProcess().GetOrCreate(
+      (executable ? "file+x:" : "file:") + path,
+      [&]() -> std::shared_ptr<const fml::Mapping> {
+        if (executable) {
+          return fml::FileMapping::CreateReadExecute(path);
+        } else {
+          return fml::FileMapping::CreateReadOnly(path);
+        }
+      });
+}
+
+// Looks up the symbol in the library at `library_path`, or in the current
+// process if it is std::nullopt.
+static std::shared_ptr<const fml::Mapping> GetSymbolMapping(
+    const std::optional<std::string>& library_path,
+    const char* symbol_name) {
+  return fml::MappingRegistry::GetRegistryForProcess().GetOrCreate(
+      (library_path.has_value() ? "symbol:" + library_path.value()
+                                : std::string("process")) +
+          ":" + symbol_name,
+      [&]() -> std::shared_ptr<const fml::Mapping> {
+        auto native_library =
+            library_path.has_value()
+                ? fml::NativeLibrary::Create(library_path->c_str())
+                : fml::NativeLibrary::CreateForCurrentProcess();
+        auto symbol_mapping = std::make_shared<const fml::SymbolMapping>(
+            native_library, symbol_name);
+        if (symbol_mapping->GetMapping() == nullptr) {
+          return nullptr;
+        }
+        return symbol_mapping;
+      });
 }
 
 // The first party embedders don't yet use the stable embedder API and depend on
@@ -76,25 +107,14 @@ static std::shared_ptr<const fml::Mapping> SearchMapping(
 
   // Look in application specified native library if specified.
   for (const std::string& path : native_library_paths) {
-    auto native_library = fml::NativeLibrary::Create(path.c_str());
-    auto symbol_mapping = std::make_unique<const fml::SymbolMapping>(
-        native_library, native_library_symbol_name);
-    if (symbol_mapping->GetMapping() != nullptr) {
+    if (auto symbol_mapping =
+            GetSymbolMapping(path, native_library_symbol_name)) {
       return symbol_mapping;
     }
   }
 
   // Look inside the currently loaded process.
-  {
-    auto loaded_process = fml::NativeLibrary::CreateForCurrentProcess();
-    auto symbol_mapping = std::make_unique<const fml::SymbolMapping>(
-        loaded_process, native_library_symbol_name);
-    if (symbol_mapping->GetMapping() != nullptr) {
-      return symbol_mapping;
-    }
-  }
-
-  return nullptr;
+  return GetSymbolMapping(std::nullopt, native_library_symbol_name);
 }
 
 #endif  // !DART_SNAPSHOT_STATIC_LINK
@@ -265,6 +285,17 @@ bool DartSnapshot::IsDontNeedSafe() const {
   return true;
 }
 
+std::vector<const fml::Mapping*> DartSnapshot::GetMappings() const {
+  std::vector<const fml::Mapping*> mappings;
+  if (data_) {
+    mappings.push_back(data_.get());
+  }
+  if (instructions_) {
+    mappings.push_back(instructions_.get());
+  }
+  return mappings;
+}
+
 bool DartSnapshot::IsNullSafetyEnabled(const fml::Mapping* kernel) const {
   return ::Dart_DetectNullSafety(
       nullptr,           // script_uri (unsupported by Flutter)
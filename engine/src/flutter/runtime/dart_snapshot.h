@@ -6,6 +6,7 @@
 #define FLUTTER_RUNTIME_DART_SNAPSHOT_H_
 
 #include <memory>
+#include <vector>
 
 #include "flutter/common/settings.h"
 #include "flutter/fml/macros.h"
@@ -164,6 +165,12 @@ class DartSnapshot : public fml::RefCountedThreadSafe<DartSnapshot> {
   ///             safe to use with madvise(DONTNEED).
   bool IsDontNeedSafe() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The mappings of the heap and instructions snapshots, for the
+  ///             components that are present.
+  ///
+  std::vector<const fml::Mapping*> GetMappings() const;
+
   bool IsNullSafetyEnabled(
       const fml::Mapping* application_kernel_mapping) const;
 
@@ -268,15 +268,24 @@ size_t DartVM::GetVMLaunchCount() {
 static constexpr size_t kMinCount = 2;
 static constexpr size_t kMaxCount = 4;
 
+static std::shared_ptr<fml::ConcurrentMessageLoop> CreateConcurrentMessageLoop(
+    const Settings& settings) {
+  if (settings.concurrent_task_executor) {
+    return fml::ConcurrentMessageLoop::CreateWithExecutor(
+        settings.concurrent_task_executor_worker_count,
+        settings.concurrent_task_executor);
+  }
+  return fml::ConcurrentMessageLoop::Create(std::clamp(
+      fml::EfficiencyCoreCount().value_or(std::thread::hardware_concurrency()) /
+          2,
+      kMinCount, kMaxCount));
+}
+
 DartVM::DartVM(const std::shared_ptr<const DartVMData>& vm_data,
                std::shared_ptr<IsolateNameServer> isolate_name_server)
     : settings_(vm_data->GetSettings()),
-      concurrent_message_loop_(fml::ConcurrentMessageLoop::Create(
-          std::clamp(fml::EfficiencyCoreCount().value_or(
-                         std::thread::hardware_concurrency()) /
-                         2,
-                     kMinCount,
-                     kMaxCount))),
+      concurrent_message_loop_(
+          CreateConcurrentMessageLoop(vm_data->GetSettings())),
       skia_concurrent_executor_(
           [runner = concurrent_message_loop_->GetTaskRunner()](
               const fml::closure& work) { runner->PostTask(work); }),
@@ -500,9 +509,15 @@ DartVM::DartVM(const std::shared_ptr<const DartVMData>& vm_data,
                                      dart_library_sources->GetSize());
   }
 
-  // Update thread names now that the Dart VM is initialized.
+  // Update thread names now that the Dart VM is initialized. This does not
+  // reach the threads of an executor, which the engine does not own.
   concurrent_message_loop_->PostTaskToAllWorkers(
-      [] { Dart_SetThreadName("FlutterConcurrentMessageLoopWorker"); });
+      [affinity = settings_.worker_thread_cpu_affinity] {
+        Dart_SetThreadName("FlutterConcurrentMessageLoopWorker");
+        if (affinity.has_value()) {
+          fml::RequestAffinity(affinity.value());
+        }
+      });
 }
 
 DartVM::~DartVM() {
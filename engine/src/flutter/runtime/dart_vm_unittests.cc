@@ -4,6 +4,7 @@
 
 #include "flutter/runtime/dart_vm.h"
 
+#include "flutter/runtime/dart_snapshot.h"
 #include "flutter/runtime/dart_vm_lifecycle.h"
 #include "flutter/testing/fixture_test.h"
 #include "gtest/gtest.h"
@@ -36,6 +37,20 @@ TEST_F(DartVMTest, SimpleIsolateNameServer) {
   ASSERT_TRUE(ns->RemoveIsolateNameMapping("foobar"));
 }
 
+TEST_F(DartVMTest, IsolateSnapshotsFromTheSameSettingsShareMappings) {
+#if (FML_OS_WIN || FML_OS_ANDROID) && FLUTTER_JIT_RUNTIME
+  GTEST_SKIP() << "The snapshots are linked into the executable.";
+#else
+  auto settings = CreateSettingsForFixture();
+  auto first = DartSnapshot::IsolateSnapshotFromSettings(settings);
+  auto second = DartSnapshot::IsolateSnapshotFromSettings(settings);
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+  EXPECT_NE(first.get(), second.get());
+  EXPECT_EQ(first->GetMappings(), second->GetMappings());
+#endif
+}
+
 TEST_F(DartVMTest, OldGenHeapSize) {
   ASSERT_FALSE(DartVMRef::IsInstanceRunning());
   auto settings = CreateSettingsForFixture();
@@ -10,6 +10,7 @@
 #include "flutter/fml/trace_event.h"
 #include "flutter/lib/ui/compositing/scene.h"
 #include "flutter/lib/ui/ui_dart_state.h"
+#include "flutter/lib/ui/window/background_isolate_pool.h"
 #include "flutter/lib/ui/window/platform_configuration.h"
 #include "flutter/lib/ui/window/viewport_metrics.h"
 #include "flutter/runtime/dart_isolate_group_data.h"
@@ -297,10 +298,12 @@ bool RuntimeController::SetAccessibilityFeatures(int32_t flags) {
 }
 
 bool RuntimeController::BeginFrame(fml::TimePoint frame_time,
-                                   uint64_t frame_number) {
+                                   uint64_t frame_number,
+                                   fml::TimePoint build_deadline) {
   MarkAsFrameBorder();
   if (auto* platform_configuration = GetPlatformConfigurationIfAvailable()) {
-    platform_configuration->BeginFrame(frame_time, frame_number);
+    platform_configuration->BeginFrame(frame_time, frame_number,
+                                       build_deadline);
     return true;
   }
 
@@ -340,6 +343,19 @@ bool RuntimeController::NotifyIdle(fml::TimeDelta deadline) {
 
   Dart_NotifyIdle(deadline.ToMicroseconds());
 
+  // Spawn the pool of background isolates the first time the engine is idle,
+  // after the first frames, rather than while the application starts.
+  if (!has_warmed_up_background_isolate_pool_) {
+    has_warmed_up_background_isolate_pool_ = true;
+    if (GetBackgroundIsolatePoolSize(
+            root_isolate->GetIsolateGroupData().GetSettings()) > 0) {
+      if (auto* platform_configuration =
+              GetPlatformConfigurationIfAvailable()) {
+        platform_configuration->WarmUpBackgroundIsolatePool();
+      }
+    }
+  }
+
   // Idle notifications being in isolate scope are part of the contract.
   if (idle_notification_callback_) {
     TRACE_EVENT0("flutter", "EmbedderIdleNotification");
@@ -499,6 +515,11 @@ void RuntimeController::SendChannelUpdate(std::string name, bool listening) {
   client_.SendChannelUpdate(std::move(name), listening);
 }
 
+void RuntimeController::SetPlatformMessagePort(std::string name,
+                                               int64_t port) {
+  client_.SetPlatformMessagePort(std::move(name), port);
+}
+
 Dart_Port RuntimeController::GetMainPort() {
   std::shared_ptr<DartIsolate> root_isolate = root_isolate_.lock();
   return root_isolate ? root_isolate->main_port() : ILLEGAL_PORT;
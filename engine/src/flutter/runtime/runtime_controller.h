@@ -340,10 +340,14 @@ class RuntimeController : public PlatformConfigurationClient,
   ///                         began. May be used by animation interpolators,
   ///                         physics simulations, etc.
   ///
+  /// @param[in]  build_deadline The point by which the frame should be built.
+  ///
   /// @return     If notification to begin frame rendering was delivered to the
   ///             running isolate.
   ///
-  bool BeginFrame(fml::TimePoint frame_time, uint64_t frame_number);
+  bool BeginFrame(fml::TimePoint frame_time,
+                  uint64_t frame_number,
+                  fml::TimePoint build_deadline);
 
   //----------------------------------------------------------------------------
   /// @brief      Dart code cannot fully measure the time it takes for a
@@ -720,6 +724,7 @@ class RuntimeController : public PlatformConfigurationClient,
   std::shared_ptr<PlatformIsolateManager> platform_isolate_manager_ =
       std::shared_ptr<PlatformIsolateManager>(new PlatformIsolateManager());
   bool has_flushed_runtime_state_ = false;
+  bool has_warmed_up_background_isolate_pool_ = false;
 
   // Callbacks when `AddView` was called before the Dart isolate is launched.
   //
@@ -792,6 +797,9 @@ class RuntimeController : public PlatformConfigurationClient,
   // |PlatformConfigurationClient|
   void SendChannelUpdate(std::string name, bool listening) override;
 
+  // |PlatformConfigurationClient|
+  void SetPlatformMessagePort(std::string name, int64_t port) override;
+
   // |PlatformConfigurationClient|
   double GetScaledFontSize(double unscaled_font_size,
                            int configuration_id) const override;
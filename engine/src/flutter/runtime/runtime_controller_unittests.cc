@@ -72,6 +72,8 @@ class MockRuntimeDelegate : public RuntimeDelegate {
 
   void SendChannelUpdate(std::string name, bool listening) override {}
 
+  void SetPlatformMessagePort(std::string name, int64_t port) override {}
+
   double GetScaledFontSize(double unscaled_font_size,
                            int configuration_id) const override {
     return 0.0;
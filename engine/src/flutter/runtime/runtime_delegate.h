@@ -65,6 +65,8 @@ class RuntimeDelegate {
 
   virtual void SendChannelUpdate(std::string name, bool listening) = 0;
 
+  virtual void SetPlatformMessagePort(std::string name, int64_t port) = 0;
+
   virtual double GetScaledFontSize(double unscaled_font_size,
                                    int configuration_id) const = 0;
 
@@ -41,6 +41,14 @@ const std::string_view ServiceProtocol::kReloadAssetFonts =
     "_flutter.reloadAssetFonts";
 const std::string_view ServiceProtocol::kGetPipelineUsageExtensionName =
     "_flutter.getPipelineUsage";
+const std::string_view ServiceProtocol::kGetLayerPaintProfileExtensionName =
+    "_flutter.getLayerPaintProfile";
+const std::string_view ServiceProtocol::kGetRecordedTraceExtensionName =
+    "_flutter.getRecordedTrace";
+const std::string_view ServiceProtocol::kGetSnapshotMemoryUsageExtensionName =
+    "_flutter.getSnapshotMemoryUsage";
+const std::string_view ServiceProtocol::kGetPerformanceCountersExtensionName =
+    "_flutter.getPerformanceCounters";
 
 static constexpr std::string_view kViewIdPrefx = "_flutterView/";
 static constexpr std::string_view kListViewsExtensionName =
@@ -62,6 +70,10 @@ ServiceProtocol::ServiceProtocol()
           kEstimateRasterCacheMemoryExtensionName,
           kReloadAssetFonts,
           kGetPipelineUsageExtensionName,
+          kGetLayerPaintProfileExtensionName,
+          kGetRecordedTraceExtensionName,
+          kGetSnapshotMemoryUsageExtensionName,
+          kGetPerformanceCountersExtensionName,
       }) {}
 
 ServiceProtocol::~ServiceProtocol() {
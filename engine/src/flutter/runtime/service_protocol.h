@@ -30,6 +30,10 @@ class ServiceProtocol {
   static const std::string_view kEstimateRasterCacheMemoryExtensionName;
   static const std::string_view kReloadAssetFonts;
   static const std::string_view kGetPipelineUsageExtensionName;
+  static const std::string_view kGetLayerPaintProfileExtensionName;
+  static const std::string_view kGetRecordedTraceExtensionName;
+  static const std::string_view kGetSnapshotMemoryUsageExtensionName;
+  static const std::string_view kGetPerformanceCountersExtensionName;
 
   class Handler {
    public:
@@ -0,0 +1,270 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/runtime/snapshot_page_hints.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "flutter/fml/file.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/paths.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+namespace {
+
+// The hints are a header, followed by each region as its size and range
+// count and then its ranges. They are only read on the device that wrote
+// them, so they are stored in its byte order and for its page size.
+constexpr uint32_t kMagic = 0x48504e53;  // 'SNPH'
+constexpr uint32_t kVersion = 1;
+
+struct Header {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t page_size;
+  uint32_t region_count;
+};
+
+struct RegionHeader {
+  uint64_t size;
+  uint32_t range_count;
+  uint32_t reserved;
+};
+
+class Reader {
+ public:
+  explicit Reader(const fml::Mapping& data)
+      : bytes_(data.GetMapping()), size_(data.GetSize()) {}
+
+  template <typename T>
+  bool Read(T* value) {
+    if (bytes_ == nullptr || size_ - offset_ < sizeof(T)) {
+      return false;
+    }
+    memcpy(value, bytes_ + offset_, sizeof(T));
+    offset_ += sizeof(T);
+    return true;
+  }
+
+  size_t GetRemaining() const { return size_ - offset_; }
+
+ private:
+  const uint8_t* bytes_;
+  size_t size_;
+  size_t offset_ = 0;
+};
+
+template <typename T>
+void Write(std::vector<uint8_t>& data, const T& value) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+  data.insert(data.end(), bytes, bytes + sizeof(T));
+}
+
+}  // namespace
+
+std::vector<fml::MemoryRegion> SnapshotPageHints::GetRegionsOfMappings(
+    const std::vector<const fml::Mapping*>& mappings) {
+  std::vector<fml::MemoryRegion> regions;
+  for (const fml::Mapping* mapping : mappings) {
+    if (mapping == nullptr || mapping->GetMapping() == nullptr) {
+      continue;
+    }
+    std::optional<fml::MemoryRegion> region;
+    if (mapping->GetSize() > 0) {
+      region =
+          fml::GetPageAlignedRegion(mapping->GetMapping(), mapping->GetSize());
+    } else {
+      region = fml::GetMappedRegionContaining(mapping->GetMapping());
+    }
+    if (region.has_value() &&
+        std::find(regions.begin(), regions.end(), region.value()) ==
+            regions.end()) {
+      regions.push_back(region.value());
+    }
+  }
+  return regions;
+}
+
+std::optional<SnapshotPageHints> SnapshotPageHints::Record(
+    const std::vector<fml::MemoryRegion>& regions) {
+  SnapshotPageHints hints;
+  for (const fml::MemoryRegion& region : regions) {
+    std::optional<std::vector<bool>> resident =
+        fml::GetResidentPages(region);
+    if (!resident.has_value()) {
+      return std::nullopt;
+    }
+    RegionPages pages;
+    pages.size = region.size;
+    for (size_t page = 0; page < resident->size(); page++) {
+      if (!resident.value()[page]) {
+        continue;
+      }
+      if (!pages.ranges.empty() &&
+          pages.ranges.back().first_page + pages.ranges.back().page_count ==
+              page) {
+        pages.ranges.back().page_count++;
+      } else {
+        pages.ranges.push_back({.first_page = static_cast<uint32_t>(page),
+                                .page_count = 1});
+      }
+    }
+    hints.regions_.push_back(std::move(pages));
+  }
+  return hints;
+}
+
+std::optional<SnapshotPageHints> SnapshotPageHints::Deserialize(
+    const fml::Mapping& data) {
+  Reader reader(data);
+  Header header;
+  if (!reader.Read(&header) || header.magic != kMagic ||
+      header.version != kVersion ||
+      header.page_size != fml::GetMemoryPageSize()) {
+    return std::nullopt;
+  }
+  SnapshotPageHints hints;
+  for (uint32_t i = 0; i < header.region_count; i++) {
+    RegionHeader region_header;
+    if (!reader.Read(&region_header) ||
+        reader.GetRemaining() / sizeof(PageRange) <
+            region_header.range_count) {
+      return std::nullopt;
+    }
+    const uint64_t page_count =
+        (region_header.size + header.page_size - 1) / header.page_size;
+    RegionPages pages;
+    pages.size = region_header.size;
+    pages.ranges.resize(region_header.range_count);
+    uint64_t previous_end = 0;
+    for (PageRange& range : pages.ranges) {
+      reader.Read(&range);
+      const uint64_t end =
+          static_cast<uint64_t>(range.first_page) + range.page_count;
+      if (range.page_count == 0 || range.first_page < previous_end ||
+          end > page_count) {
+        return std::nullopt;
+      }
+      previous_end = end;
+    }
+    hints.regions_.push_back(std::move(pages));
+  }
+  return hints;
+}
+
+std::vector<uint8_t> SnapshotPageHints::Serialize() const {
+  std::vector<uint8_t> data;
+  Write(data, Header{
+                  .magic = kMagic,
+                  .version = kVersion,
+                  .page_size = static_cast<uint32_t>(fml::GetMemoryPageSize()),
+                  .region_count = static_cast<uint32_t>(regions_.size()),
+              });
+  for (const RegionPages& pages : regions_) {
+    Write(data, RegionHeader{
+                    .size = pages.size,
+                    .range_count = static_cast<uint32_t>(pages.ranges.size()),
+                    .reserved = 0,
+                });
+    for (const PageRange& range : pages.ranges) {
+      Write(data, range);
+    }
+  }
+  return data;
+}
+
+bool SnapshotPageHints::IsRecordedFor(
+    const std::vector<fml::MemoryRegion>& regions) const {
+  if (regions.size() != regions_.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < regions.size(); i++) {
+    if (regions[i].size != regions_[i].size) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t SnapshotPageHints::GetPageCount() const {
+  size_t page_count = 0;
+  for (const RegionPages& pages : regions_) {
+    for (const PageRange& range : pages.ranges) {
+      page_count += range.page_count;
+    }
+  }
+  return page_count;
+}
+
+size_t SnapshotPageHints::Prefetch(
+    const std::vector<fml::MemoryRegion>& regions) const {
+  FML_DCHECK(IsRecordedFor(regions));
+  const size_t page_size = fml::GetMemoryPageSize();
+  size_t prefetched = 0;
+  for (size_t i = 0; i < regions.size() && i < regions_.size(); i++) {
+    const fml::MemoryRegion& region = regions[i];
+    for (const PageRange& range : regions_[i].ranges) {
+      const size_t offset = range.first_page * page_size;
+      const size_t size =
+          std::min(range.page_count * page_size, region.size - offset);
+      if (fml::PrefetchMemory({.start = region.start + offset, .size = size})) {
+        prefetched += range.page_count;
+      }
+    }
+  }
+  return prefetched;
+}
+
+bool SnapshotPageHints::PrefetchFromDirectory(
+    const std::string& directory,
+    const std::vector<fml::MemoryRegion>& regions) {
+  TRACE_EVENT0("flutter", "SnapshotPageHints::PrefetchFromDirectory");
+  std::unique_ptr<fml::FileMapping> mapping = fml::FileMapping::CreateReadOnly(
+      fml::paths::JoinPaths({directory, kFileName}));
+  if (!mapping) {
+    return false;
+  }
+  std::optional<SnapshotPageHints> hints = Deserialize(*mapping);
+  if (!hints.has_value() || !hints->IsRecordedFor(regions)) {
+    return false;
+  }
+  const size_t prefetched = hints->Prefetch(regions);
+  FML_DLOG(INFO) << "Prefetched " << prefetched << " of "
+                 << hints->GetPageCount() << " snapshot pages.";
+  return true;
+}
+
+bool SnapshotPageHints::RecordToDirectoryIfNeeded(
+    const std::string& directory,
+    const std::vector<fml::MemoryRegion>& regions) {
+  std::unique_ptr<fml::FileMapping> mapping = fml::FileMapping::CreateReadOnly(
+      fml::paths::JoinPaths({directory, kFileName}));
+  if (mapping) {
+    std::optional<SnapshotPageHints> saved = Deserialize(*mapping);
+    if (saved.has_value() && saved->IsRecordedFor(regions)) {
+      return true;
+    }
+  }
+
+  TRACE_EVENT0("flutter", "SnapshotPageHints::RecordToDirectoryIfNeeded");
+  std::optional<SnapshotPageHints> hints = Record(regions);
+  if (!hints.has_value()) {
+    return false;
+  }
+  fml::UniqueFD directory_fd = fml::OpenDirectory(
+      directory.c_str(), false, fml::FilePermission::kReadWrite);
+  if (!directory_fd.is_valid() ||
+      !fml::WriteAtomically(directory_fd, kFileName,
+                            fml::DataMapping(hints->Serialize()))) {
+    FML_LOG(ERROR) << "Could not save the snapshot page hints to "
+                   << directory;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace flutter
@@ -0,0 +1,135 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_RUNTIME_SNAPSHOT_PAGE_HINTS_H_
+#define FLUTTER_RUNTIME_SNAPSHOT_PAGE_HINTS_H_
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/memory_residency.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      The pages of the Dart snapshots that were resident in memory
+///             once a launch of the application rendered its first frame.
+///
+///             The snapshots are mapped by the engine and their pages are
+///             faulted in one at a time as the isolate starts up. A launch
+///             that finds the hints recorded by an earlier one asks the
+///             operating system to read those pages in ahead of time, in the
+///             background, so that far fewer of the faults wait on the disk.
+///
+///             The snapshots are mapped at other addresses in every launch, so
+///             the hints refer to the pages by their index in the regions of
+///             memory that the snapshots are mapped in. The hints are only
+///             used for regions with the sizes they were recorded for, which
+///             change when the application is updated.
+///
+class SnapshotPageHints {
+ public:
+  //----------------------------------------------------------------------------
+  /// The name of the file the hints are saved to in their directory.
+  ///
+  static constexpr char kFileName[] = "flutter_snapshot_page_hints";
+
+  //----------------------------------------------------------------------------
+  /// @brief      The regions of pages that the mappings are in, in the order
+  ///             of the mappings and without duplicates.
+  ///
+  ///             Mappings that don't know their size, such as the symbols
+  ///             of a snapshot linked into a library, are resolved to the
+  ///             whole region of the library they are mapped in. Mappings
+  ///             whose region can't be found are skipped.
+  ///
+  static std::vector<fml::MemoryRegion> GetRegionsOfMappings(
+      const std::vector<const fml::Mapping*>& mappings);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Record the pages of the regions that are resident now.
+  ///
+  /// @return     The hints, or std::nullopt if the residency of pages can't
+  ///             be queried on this platform.
+  ///
+  static std::optional<SnapshotPageHints> Record(
+      const std::vector<fml::MemoryRegion>& regions);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Read hints written by |Serialize|.
+  ///
+  /// @return     The hints, or std::nullopt if the data is not valid hints
+  ///             for this device.
+  ///
+  static std::optional<SnapshotPageHints> Deserialize(
+      const fml::Mapping& data);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Load the hints saved in `directory` and prefetch their pages
+  ///             of the regions if they were recorded for them.
+  ///
+  /// @return     Whether hints for the regions were found.
+  ///
+  static bool PrefetchFromDirectory(
+      const std::string& directory,
+      const std::vector<fml::MemoryRegion>& regions);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Record the resident pages of the regions and save them to
+  ///             `directory`, unless hints for the regions are saved there
+  ///             already.
+  ///
+  ///             The hints of a launch that prefetched pages would include
+  ///             the pages that it read in but didn't use, so hints that
+  ///             are still valid are never recorded again.
+  ///
+  /// @return     Whether hints for the regions are saved in the directory.
+  ///
+  static bool RecordToDirectoryIfNeeded(
+      const std::string& directory,
+      const std::vector<fml::MemoryRegion>& regions);
+
+  std::vector<uint8_t> Serialize() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether the hints were recorded for regions of the same
+  ///             sizes as these.
+  ///
+  bool IsRecordedFor(const std::vector<fml::MemoryRegion>& regions) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of pages of all the regions that were resident.
+  ///
+  size_t GetPageCount() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Hint to the operating system that the recorded pages of the
+  ///             regions will be accessed soon.
+  ///
+  ///             The regions must be ones the hints were recorded for.
+  ///
+  /// @return     The number of pages that were prefetched.
+  ///
+  size_t Prefetch(const std::vector<fml::MemoryRegion>& regions) const;
+
+ private:
+  struct PageRange {
+    uint32_t first_page;
+    uint32_t page_count;
+  };
+
+  struct RegionPages {
+    uint64_t size = 0;
+    std::vector<PageRange> ranges;
+  };
+
+  std::vector<RegionPages> regions_;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_RUNTIME_SNAPSHOT_PAGE_HINTS_H_
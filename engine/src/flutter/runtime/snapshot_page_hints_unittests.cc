@@ -0,0 +1,143 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/runtime/snapshot_page_hints.h"
+
+#include <vector>
+
+#include "flutter/fml/build_config.h"
+#include "flutter/fml/file.h"
+#include "flutter/fml/paths.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+// Whether the residency of pages can be queried, which recording the hints
+// needs.
+bool CanRecordHints() {
+#if FML_OS_WIN || FML_OS_FUCHSIA
+  return false;
+#else
+  return true;
+#endif
+}
+
+}  // namespace
+
+TEST(SnapshotPageHintsTest, RegionsOfMappingsAreDeduplicated) {
+  const size_t page_size = fml::GetMemoryPageSize();
+  std::vector<uint8_t> buffer(page_size * 3, 1);
+  fml::NonOwnedMapping first(buffer.data(), page_size);
+  fml::NonOwnedMapping same_pages(buffer.data() + 1, page_size - 2);
+  fml::NonOwnedMapping missing(nullptr, 0);
+
+  std::vector<fml::MemoryRegion> regions =
+      SnapshotPageHints::GetRegionsOfMappings(
+          {&first, nullptr, &same_pages, &missing});
+  ASSERT_EQ(regions.size(), 1u);
+  EXPECT_EQ(regions[0], fml::GetPageAlignedRegion(buffer.data(), page_size));
+}
+
+TEST(SnapshotPageHintsTest, RecordsResidentPagesAndRoundTrips) {
+  if (!CanRecordHints()) {
+    GTEST_SKIP() << "The residency of pages can't be queried.";
+  }
+  const size_t page_size = fml::GetMemoryPageSize();
+  std::vector<uint8_t> buffer(page_size * 4, 1);
+  std::vector<fml::MemoryRegion> regions = {
+      fml::GetPageAlignedRegion(buffer.data(), buffer.size())};
+
+  std::optional<SnapshotPageHints> hints = SnapshotPageHints::Record(regions);
+  ASSERT_TRUE(hints.has_value());
+  EXPECT_EQ(hints->GetPageCount(), regions[0].GetPageCount());
+  EXPECT_TRUE(hints->IsRecordedFor(regions));
+  EXPECT_EQ(hints->Prefetch(regions), regions[0].GetPageCount());
+
+  fml::DataMapping data(hints->Serialize());
+  std::optional<SnapshotPageHints> read = SnapshotPageHints::Deserialize(data);
+  ASSERT_TRUE(read.has_value());
+  EXPECT_EQ(read->GetPageCount(), hints->GetPageCount());
+  EXPECT_TRUE(read->IsRecordedFor(regions));
+
+  // The hints are only used for regions of the sizes they were recorded for.
+  fml::MemoryRegion smaller = regions[0];
+  smaller.size -= page_size;
+  EXPECT_FALSE(read->IsRecordedFor({smaller}));
+  EXPECT_FALSE(read->IsRecordedFor({regions[0], regions[0]}));
+}
+
+TEST(SnapshotPageHintsTest, RejectsInvalidData) {
+  if (!CanRecordHints()) {
+    GTEST_SKIP() << "The residency of pages can't be queried.";
+  }
+  const size_t page_size = fml::GetMemoryPageSize();
+  std::vector<uint8_t> buffer(page_size * 2, 1);
+  std::vector<fml::MemoryRegion> regions = {
+      fml::GetPageAlignedRegion(buffer.data(), buffer.size())};
+  std::optional<SnapshotPageHints> hints = SnapshotPageHints::Record(regions);
+  ASSERT_TRUE(hints.has_value());
+  std::vector<uint8_t> data = hints->Serialize();
+
+  std::vector<uint8_t> truncated(data.begin(), data.end() - 1);
+  EXPECT_FALSE(SnapshotPageHints::Deserialize(
+                   fml::DataMapping(std::move(truncated)))
+                   .has_value());
+
+  std::vector<uint8_t> other_magic = data;
+  other_magic[0] ^= 0xff;
+  EXPECT_FALSE(SnapshotPageHints::Deserialize(
+                   fml::DataMapping(std::move(other_magic)))
+                   .has_value());
+
+  EXPECT_FALSE(
+      SnapshotPageHints::Deserialize(fml::DataMapping(std::vector<uint8_t>()))
+          .has_value());
+}
+
+TEST(SnapshotPageHintsTest, HintsAreSavedOnceForTheirRegions) {
+  if (!CanRecordHints()) {
+    GTEST_SKIP() << "The residency of pages can't be queried.";
+  }
+  fml::ScopedTemporaryDirectory directory;
+  const size_t page_size = fml::GetMemoryPageSize();
+  std::vector<uint8_t> buffer(page_size * 2, 1);
+  std::vector<fml::MemoryRegion> regions = {
+      fml::GetPageAlignedRegion(buffer.data(), buffer.size())};
+
+  EXPECT_FALSE(
+      SnapshotPageHints::PrefetchFromDirectory(directory.path(), regions));
+  ASSERT_TRUE(
+      SnapshotPageHints::RecordToDirectoryIfNeeded(directory.path(), regions));
+  EXPECT_TRUE(
+      SnapshotPageHints::PrefetchFromDirectory(directory.path(), regions));
+
+  const std::string path = fml::paths::JoinPaths(
+      {directory.path(), SnapshotPageHints::kFileName});
+  auto get_saved_size = [&path]() {
+    return fml::FileMapping::CreateReadOnly(path)->GetSize();
+  };
+  const size_t saved_size = get_saved_size();
+
+  // Hints that are still valid are kept, and others are replaced.
+  std::vector<uint8_t> larger(page_size * 8, 1);
+  std::vector<fml::MemoryRegion> other_regions = {
+      fml::GetPageAlignedRegion(buffer.data(), buffer.size()),
+      fml::GetPageAlignedRegion(larger.data(), larger.size())};
+  ASSERT_TRUE(
+      SnapshotPageHints::RecordToDirectoryIfNeeded(directory.path(), regions));
+  EXPECT_EQ(get_saved_size(), saved_size);
+  EXPECT_FALSE(SnapshotPageHints::PrefetchFromDirectory(directory.path(),
+                                                        other_regions));
+  ASSERT_TRUE(SnapshotPageHints::RecordToDirectoryIfNeeded(directory.path(),
+                                                           other_regions));
+  EXPECT_GT(get_saved_size(), saved_size);
+  EXPECT_TRUE(SnapshotPageHints::PrefetchFromDirectory(directory.path(),
+                                                       other_regions));
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -4,10 +4,14 @@
 
 #include "flutter/shell/common/animator.h"
 
+#include <algorithm>
+
 #include "flutter/common/constants.h"
 #include "flutter/flow/frame_timings.h"
+#include "flutter/fml/make_copyable.h"
 #include "flutter/fml/time/time_point.h"
 #include "flutter/fml/trace_event.h"
+#include "flutter/fml/trace_recorder.h"
 #include "third_party/dart/runtime/include/dart_tools_api.h"
 
 namespace flutter {
@@ -20,6 +24,41 @@ namespace {
 constexpr fml::TimeDelta kNotifyIdleTaskWaitTime =
     fml::TimeDelta::FromMilliseconds(51);
 
+// The number of frames between two reads of the frame timing summary.
+constexpr size_t kFramePipelineUpdateInterval = 30;
+
+// The number of rasterized frames the frame timing summary must cover before
+// the build of frames is delayed or the adaptive mode switches modes.
+constexpr size_t kMinFramesForFramePipelineUpdate = 30;
+
+// The slack left between the predicted end of the rasterization and the
+// target time of a frame built in the low latency mode.
+constexpr fml::TimeDelta kLowLatencyFrameSlack =
+    fml::TimeDelta::FromMilliseconds(2);
+
+// The weight of the most recent frame in the moving estimate of the build
+// time is 1 / kBuildTimeEstimateWeight.
+constexpr int64_t kBuildTimeEstimateWeight = 8;
+
+// The number of frame intervals after which the last vsync reported by the
+// vsync waiter no longer predicts the upcoming vsyncs.
+constexpr int64_t kMaxVsyncPredictionIntervals = 4;
+
+uint32_t GetDefaultPipelineDepth(
+    [[maybe_unused]] const TaskRunners& task_runners) {
+#if SHELL_ENABLE_METAL
+  return 2;
+#else   // SHELL_ENABLE_METAL
+  // TODO(dnfield): We should remove this logic and set the pipeline depth
+  // back to 2 in this case. See
+  // https://github.com/flutter/engine/pull/9132 for discussion.
+  return task_runners.GetPlatformTaskRunner() ==
+                 task_runners.GetRasterTaskRunner()
+             ? 1
+             : 2;
+#endif  // SHELL_ENABLE_METAL
+}
+
 }  // namespace
 
 Animator::Animator(Delegate& delegate,
@@ -28,20 +67,13 @@ Animator::Animator(Delegate& delegate,
     : delegate_(delegate),
       task_runners_(task_runners),
       waiter_(std::move(waiter)),
-#if SHELL_ENABLE_METAL
-      layer_tree_pipeline_(std::make_shared<FramePipeline>(2)),
-#else   // SHELL_ENABLE_METAL
-      // TODO(dnfield): We should remove this logic and set the pipeline depth
-      // back to 2 in this case. See
-      // https://github.com/flutter/engine/pull/9132 for discussion.
-      layer_tree_pipeline_(std::make_shared<FramePipeline>(
-          task_runners.GetPlatformTaskRunner() ==
-                  task_runners.GetRasterTaskRunner()
-              ? 1
-              : 2)),
-#endif  // SHELL_ENABLE_METAL
+      default_pipeline_depth_(GetDefaultPipelineDepth(task_runners)),
+      layer_tree_pipeline_(
+          std::make_shared<FramePipeline>(kMaxFramePipelineDepth,
+                                          default_pipeline_depth_)),
       pending_frame_semaphore_(1),
       weak_factory_(this) {
+  SetThreadCpuAffinity(std::nullopt);
 }
 
 Animator::~Animator() = default;
@@ -70,6 +102,7 @@ void Animator::BeginFrame(
 
   frame_timings_recorder_ = std::move(frame_timings_recorder);
   frame_timings_recorder_->RecordBuildStart(fml::TimePoint::Now());
+  last_frame_target_time_ = frame_timings_recorder_->GetVsyncTargetTime();
 
   size_t flow_id_count = trace_flow_ids_.size();
   std::unique_ptr<uint64_t[]> flow_ids =
@@ -115,7 +148,8 @@ void Animator::BeginFrame(
       frame_timings_recorder_->GetVsyncTargetTime();
   dart_frame_deadline_ = frame_target_time.ToEpochDelta();
   uint64_t frame_number = frame_timings_recorder_->GetFrameNumber();
-  delegate_.OnAnimatorBeginFrame(frame_target_time, frame_number);
+  delegate_.OnAnimatorBeginFrame(frame_target_time, frame_number,
+                                 frame_target_time - raster_time_estimate_);
 }
 
 void Animator::EndFrame() {
@@ -127,7 +161,18 @@ void Animator::EndFrame() {
   }
   if (!layer_trees_tasks_.empty()) {
     // The build is completed in OnAnimatorBeginFrame.
-    frame_timings_recorder_->RecordBuildEnd(fml::TimePoint::Now());
+    const fml::TimePoint build_end = fml::TimePoint::Now();
+    frame_timings_recorder_->RecordBuildEnd(build_end);
+    const fml::TimeDelta build_time =
+        build_end - frame_timings_recorder_->GetBuildStartTime();
+    build_time_estimate_ =
+        build_time_estimate_ +
+        (build_time - build_time_estimate_) / kBuildTimeEstimateWeight;
+    placement_monitor_->RecordWork(
+        frame_timings_recorder_->GetBuildStartTime(), build_end);
+    fml::tracing::TraceRecorder::GetInstance().Record(
+        "Animator::Build", frame_timings_recorder_->GetBuildStartTime(),
+        build_end);
 
     delegate_.OnAnimatorUpdateLatestFrameTargetTime(
         frame_timings_recorder_->GetVsyncTargetTime());
@@ -215,6 +260,116 @@ const std::weak_ptr<VsyncWaiter> Animator::GetVsyncWaiter() const {
   return weak;
 }
 
+void Animator::SetFramePipelineMode(Settings::FramePipelineMode mode) {
+  frame_pipeline_mode_ = mode;
+  // The adaptive mode starts out smooth until the frame timings show that
+  // there is room in the frame budget.
+  low_latency_ = mode == Settings::FramePipelineMode::kLowLatency;
+  predicted_frame_time_ = fml::TimeDelta::Zero();
+  frames_until_pipeline_update_ = 0;
+  ApplyFramePipelineDepth();
+}
+
+uint32_t Animator::GetFramePipelineDepth() const {
+  return layer_tree_pipeline_->GetDepth();
+}
+
+void Animator::SetPredictiveFrameScheduling(bool enabled) {
+  predictive_frame_scheduling_ = enabled;
+}
+
+void Animator::SetThreadCpuAffinity(std::optional<fml::CpuAffinity> affinity) {
+  placement_monitor_ =
+      std::make_unique<ThreadPlacementMonitor>("UIThreadCpuClusters", affinity);
+}
+
+fml::TimeDelta Animator::GetFrameLeadTime(
+    fml::TimeDelta frame_interval) const {
+  if (frame_interval <= fml::TimeDelta::Zero()) {
+    return fml::TimeDelta::Zero();
+  }
+  return std::clamp(
+      build_time_estimate_ + raster_time_estimate_ - frame_interval,
+      fml::TimeDelta::Zero(), frame_interval);
+}
+
+void Animator::ApplyFramePipelineDepth() {
+  uint32_t depth = default_pipeline_depth_;
+  if (frame_pipeline_mode_ != Settings::FramePipelineMode::kDefault &&
+      default_pipeline_depth_ > 1) {
+    depth = low_latency_ ? 1 : kMaxFramePipelineDepth;
+  }
+  layer_tree_pipeline_->SetDepth(depth);
+}
+
+void Animator::UpdateFramePipeline(fml::TimeDelta frame_interval) {
+  if (frames_until_pipeline_update_ > 0) {
+    frames_until_pipeline_update_--;
+    return;
+  }
+  frames_until_pipeline_update_ = kFramePipelineUpdateInterval;
+
+  FrameTimingHistory::Summary summary = delegate_.GetFrameTimingSummary();
+  if (summary.frame_count < kMinFramesForFramePipelineUpdate) {
+    predicted_frame_time_ = fml::TimeDelta::Zero();
+    raster_time_estimate_ = fml::TimeDelta::Zero();
+    return;
+  }
+  raster_time_estimate_ = summary.Get(FrameTimingHistory::Phase::kRaster).p90;
+  predicted_frame_time_ =
+      summary.Get(FrameTimingHistory::Phase::kBuild).p90 +
+      raster_time_estimate_;
+
+  if (frame_pipeline_mode_ != Settings::FramePipelineMode::kAdaptive ||
+      frame_interval <= fml::TimeDelta::Zero()) {
+    return;
+  }
+  // Switch at different thresholds so that frames close to a threshold do not
+  // flip the mode back and forth.
+  bool low_latency = low_latency_
+                         ? predicted_frame_time_ < frame_interval * 9 / 10
+                         : predicted_frame_time_ < frame_interval * 6 / 10;
+  if (low_latency != low_latency_) {
+    TRACE_EVENT1("flutter", "Animator::SwitchFramePipelineMode", "mode",
+                 low_latency ? "latency" : "throughput");
+    low_latency_ = low_latency;
+    ApplyFramePipelineDepth();
+  }
+}
+
+void Animator::OnVsync(
+    std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder) {
+  UpdateFramePipeline(frame_timings_recorder->GetVsyncTargetTime() -
+                      frame_timings_recorder->GetVsyncStartTime());
+
+  if (low_latency_ && predicted_frame_time_ > fml::TimeDelta::Zero()) {
+    // Build as late as possible so that the frame reflects the most recent
+    // input, while still being rasterized before its target time.
+    const fml::TimePoint build_start_time =
+        frame_timings_recorder->GetVsyncTargetTime() - predicted_frame_time_ -
+        kLowLatencyFrameSlack;
+    if (build_start_time > fml::TimePoint::Now()) {
+      TRACE_EVENT0("flutter", "Animator::DelayBuildForLatency");
+      task_runners_.GetUITaskRunner()->PostTaskForTime(
+          fml::MakeCopyable(
+              [self = weak_factory_.GetWeakPtr(),
+               frame_timings_recorder =
+                   std::move(frame_timings_recorder)]() mutable {
+                if (!self) {
+                  return;
+                }
+                self->BeginFrame(std::move(frame_timings_recorder));
+                self->EndFrame();
+              }),
+          build_start_time);
+      return;
+    }
+  }
+
+  BeginFrame(std::move(frame_timings_recorder));
+  EndFrame();
+}
+
 bool Animator::CanReuseLastLayerTrees() {
   return !regenerate_layer_trees_;
 }
@@ -270,7 +425,80 @@ void Animator::RequestFrame(bool regenerate_layer_trees) {
   frame_scheduled_ = true;
 }
 
+bool Animator::ScheduleFrameAheadOfVsync() {
+  if (!predictive_frame_scheduling_ || low_latency_) {
+    return false;
+  }
+  std::optional<VsyncWaiter::VsyncTimes> last_vsync =
+      waiter_->GetLastVsyncTimes();
+  if (!last_vsync.has_value()) {
+    return false;
+  }
+  const fml::TimeDelta frame_interval =
+      last_vsync->frame_target_time - last_vsync->frame_start_time;
+  const fml::TimeDelta lead_time = GetFrameLeadTime(frame_interval);
+  if (lead_time <= fml::TimeDelta::Zero()) {
+    return false;
+  }
+  const fml::TimePoint now = fml::TimePoint::Now();
+  if (now - last_vsync->frame_target_time >
+      frame_interval * kMaxVsyncPredictionIntervals) {
+    // The display may have stopped or changed its refresh rate since. Wait
+    // for the vsync instead.
+    return false;
+  }
+
+  // Predict the next vsync from the last one reported by the waiter.
+  fml::TimePoint vsync_start_time = last_vsync->frame_target_time;
+  if (vsync_start_time <= now) {
+    vsync_start_time =
+        vsync_start_time +
+        frame_interval * ((now - vsync_start_time) / frame_interval + 1);
+  }
+  if (vsync_start_time + frame_interval <= last_frame_target_time_) {
+    // The frame started ahead of that vsync already targets its end.
+    vsync_start_time = last_frame_target_time_;
+  }
+  const fml::TimePoint build_start_time =
+      std::max(now, vsync_start_time - lead_time);
+
+  auto frame_timings_recorder = std::make_unique<FrameTimingsRecorder>();
+  frame_timings_recorder->RecordVsync(vsync_start_time,
+                                      vsync_start_time + frame_interval);
+  TRACE_EVENT0("flutter", "Animator::ScheduleFrameAheadOfVsync");
+  task_runners_.GetUITaskRunner()->PostTaskForTime(
+      fml::MakeCopyable(
+          [self = weak_factory_.GetWeakPtr(),
+           frame_interval,
+           frame_timings_recorder =
+               std::move(frame_timings_recorder)]() mutable {
+            if (!self) {
+              return;
+            }
+            if (self->CanReuseLastLayerTrees()) {
+              self->DrawLastLayerTrees(std::move(frame_timings_recorder));
+              return;
+            }
+            self->UpdateFramePipeline(frame_interval);
+            self->BeginFrame(std::move(frame_timings_recorder));
+            self->EndFrame();
+          }),
+      build_start_time);
+
+  // Keep the waiter reporting vsyncs so that the next prediction is based on
+  // the current refresh rate.
+  waiter_->ScheduleSecondaryCallback(
+      reinterpret_cast<uintptr_t>(&predictive_frame_scheduling_), [] {});
+  return true;
+}
+
 void Animator::AwaitVSync() {
+  if (ScheduleFrameAheadOfVsync()) {
+    if (has_rendered_) {
+      delegate_.OnAnimatorNotifyIdle(dart_frame_deadline_);
+    }
+    return;
+  }
   waiter_->AsyncWaitForVsync(
       [self = weak_factory_.GetWeakPtr()](
           std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder) {
@@ -278,8 +506,7 @@ void Animator::AwaitVSync() {
           if (self->CanReuseLastLayerTrees()) {
             self->DrawLastLayerTrees(std::move(frame_timings_recorder));
           } else {
-            self->BeginFrame(std::move(frame_timings_recorder));
-            self->EndFrame();
+            self->OnVsync(std::move(frame_timings_recorder));
           }
         }
       });
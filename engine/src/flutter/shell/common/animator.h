@@ -7,7 +7,9 @@
 
 #include <deque>
 
+#include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
+#include "flutter/flow/frame_timing_history.h"
 #include "flutter/flow/frame_timings.h"
 #include "flutter/fml/memory/ref_ptr.h"
 #include "flutter/fml/memory/weak_ptr.h"
@@ -15,6 +17,7 @@
 #include "flutter/fml/time/time_point.h"
 #include "flutter/shell/common/pipeline.h"
 #include "flutter/shell/common/rasterizer.h"
+#include "flutter/shell/common/thread_placement_monitor.h"
 #include "flutter/shell/common/vsync_waiter.h"
 
 namespace flutter {
@@ -31,8 +34,12 @@ class Animator final {
  public:
   class Delegate {
    public:
+    /// Called at the start of building a frame. The |build_deadline| is the
+    /// time by which the frame should be built so that it can still be
+    /// rasterized before |frame_target_time|.
     virtual void OnAnimatorBeginFrame(fml::TimePoint frame_target_time,
-                                      uint64_t frame_number) = 0;
+                                      uint64_t frame_number,
+                                      fml::TimePoint build_deadline) = 0;
 
     virtual void OnAnimatorNotifyIdle(fml::TimeDelta deadline) = 0;
 
@@ -43,8 +50,18 @@ class Animator final {
 
     virtual void OnAnimatorDrawLastLayerTrees(
         std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder) = 0;
+
+    /// The percentiles of the phases of the most recently rasterized frames,
+    /// which the low latency and adaptive frame pipeline modes are based on.
+    virtual FrameTimingHistory::Summary GetFrameTimingSummary() const {
+      return {};
+    }
   };
 
+  /// The most frames that can be in flight between the animator and the
+  /// rasterizer, which is the depth used by the throughput pipeline mode.
+  static constexpr uint32_t kMaxFramePipelineDepth = 3;
+
   Animator(Delegate& delegate,
            const TaskRunners& task_runners,
            std::unique_ptr<VsyncWaiter> waiter);
@@ -89,6 +106,52 @@ class Animator final {
 
   const std::weak_ptr<VsyncWaiter> GetVsyncWaiter() const;
 
+  //--------------------------------------------------------------------------
+  /// @brief    Selects how frames are pipelined between the animator and the
+  ///           rasterizer.
+  ///
+  ///           The low latency mode keeps a single frame in flight and
+  ///           delays the build of each frame so that it is rasterized just
+  ///           in time for its target time, based on the 90th percentiles of
+  ///           the recent build and raster times. The throughput mode keeps
+  ///           up to |kMaxFramePipelineDepth| frames in flight. The adaptive
+  ///           mode uses the throughput mode while the recent frames take
+  ///           most of the frame budget and the low latency mode otherwise.
+  ///
+  ///           Pipelines whose platform and raster threads are merged keep a
+  ///           single frame in flight in all modes.
+  ///
+  void SetFramePipelineMode(Settings::FramePipelineMode mode);
+
+  /// The maximum number of frames currently allowed in flight.
+  uint32_t GetFramePipelineDepth() const;
+
+  //--------------------------------------------------------------------------
+  /// @brief    Enables starting frames ahead of the vsync they are aligned to.
+  ///
+  ///           When the moving estimate of the build time plus the recent
+  ///           raster time exceeds the frame interval, the build of a frame
+  ///           starts earlier than its vsync by the excess so that it can
+  ///           still be presented at its target time. The upcoming vsyncs
+  ///           are predicted from the last vsync reported by the
+  ///           |VsyncWaiter|, which is kept current with secondary callbacks.
+  ///
+  ///           Has no effect while the low latency pipeline mode is active.
+  ///
+  void SetPredictiveFrameScheduling(bool enabled);
+
+  //--------------------------------------------------------------------------
+  /// @brief    Keeps the UI thread on the cores of the given |affinity|, and
+  ///           accounts for the time the frames are built on each cluster.
+  ///           See |ThreadPlacementMonitor|.
+  ///
+  ///           Must not be set when the UI thread is the platform thread.
+  ///
+  void SetThreadCpuAffinity(std::optional<fml::CpuAffinity> affinity);
+
+  /// How much earlier than its vsync the build of the next frame would start.
+  fml::TimeDelta GetFrameLeadTime(fml::TimeDelta frame_interval) const;
+
   //--------------------------------------------------------------------------
   /// @brief    Schedule a secondary callback to be executed right after the
   ///           main `VsyncWaiter::AsyncWaitForVsync` callback (which is added
@@ -128,6 +191,22 @@ class Animator final {
 
   void AwaitVSync();
 
+  // Starts the frame of |frame_timings_recorder|, delaying it as far as the
+  // low latency mode allows.
+  void OnVsync(std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder);
+
+  // Refreshes the predicted frame and raster times from the recent frame
+  // timings and, in the adaptive mode, switches between low latency and
+  // throughput.
+  void UpdateFramePipeline(fml::TimeDelta frame_interval);
+
+  // Schedules the next frame ahead of the upcoming vsync if predictive frame
+  // scheduling calls for it. Returns false if the frame should wait for the
+  // vsync instead.
+  bool ScheduleFrameAheadOfVsync();
+
+  void ApplyFramePipelineDepth();
+
   // Clear |trace_flow_ids_| if |frame_scheduled_| is false.
   void ScheduleMaybeClearTraceFlowIds();
 
@@ -140,7 +219,26 @@ class Animator final {
       layer_trees_tasks_;
   uint64_t frame_request_number_ = 1;
   fml::TimeDelta dart_frame_deadline_;
+  const uint32_t default_pipeline_depth_;
   std::shared_ptr<FramePipeline> layer_tree_pipeline_;
+  Settings::FramePipelineMode frame_pipeline_mode_ =
+      Settings::FramePipelineMode::kDefault;
+  // Whether frames are currently built just in time with a single frame in
+  // flight.
+  bool low_latency_ = false;
+  // The 90th percentile of the build plus the raster time of recent frames,
+  // or zero if there are not enough recent frames.
+  fml::TimeDelta predicted_frame_time_;
+  // The 90th percentile of the raster time of recent frames, or zero if there
+  // are not enough recent frames.
+  fml::TimeDelta raster_time_estimate_;
+  size_t frames_until_pipeline_update_ = 0;
+  bool predictive_frame_scheduling_ = false;
+  // An exponential moving average of the time spent building frames.
+  fml::TimeDelta build_time_estimate_;
+  std::unique_ptr<ThreadPlacementMonitor> placement_monitor_;
+  // The target time of the last frame that started building.
+  fml::TimePoint last_frame_target_time_;
   fml::Semaphore pending_frame_semaphore_;
   FramePipeline::ProducerContinuation producer_continuation_;
   bool regenerate_layer_trees_ = false;
@@ -29,7 +29,9 @@ class FakeAnimatorDelegate : public Animator::Delegate {
  public:
   MOCK_METHOD(void,
               OnAnimatorBeginFrame,
-              (fml::TimePoint frame_target_time, uint64_t frame_number),
+              (fml::TimePoint frame_target_time,
+               uint64_t frame_number,
+               fml::TimePoint build_deadline),
               (override));
 
   void OnAnimatorNotifyIdle(fml::TimeDelta deadline) override {
@@ -261,6 +263,91 @@ TEST_F(ShellTest, AnimatorDoesNotNotifyDelegateIfPipelineIsNotEmpty) {
   PostTaskSync(task_runners.GetUITaskRunner(), [&] { animator.reset(); });
 }
 
+TEST_F(ShellTest, AnimatorFramePipelineModeSetsPipelineDepth) {
+  FakeAnimatorDelegate delegate;
+  TaskRunners task_runners = {
+      "test",
+      CreateNewThread(),  // platform
+      CreateNewThread(),  // raster
+      CreateNewThread(),  // ui
+      CreateNewThread()   // io
+  };
+
+  auto clock = std::make_shared<ShellTestVsyncClock>();
+  PostTaskSync(task_runners.GetUITaskRunner(), [&] {
+    auto vsync_waiter = static_cast<std::unique_ptr<VsyncWaiter>>(
+        std::make_unique<ShellTestVsyncWaiter>(task_runners, clock));
+    auto animator = std::make_unique<Animator>(delegate, task_runners,
+                                               std::move(vsync_waiter));
+    EXPECT_EQ(animator->GetFramePipelineDepth(), 2u);
+
+    animator->SetFramePipelineMode(Settings::FramePipelineMode::kLowLatency);
+    EXPECT_EQ(animator->GetFramePipelineDepth(), 1u);
+
+    animator->SetFramePipelineMode(Settings::FramePipelineMode::kThroughput);
+    EXPECT_EQ(animator->GetFramePipelineDepth(),
+              Animator::kMaxFramePipelineDepth);
+
+    // The adaptive mode favors smoothness until frames have been timed.
+    animator->SetFramePipelineMode(Settings::FramePipelineMode::kAdaptive);
+    EXPECT_EQ(animator->GetFramePipelineDepth(),
+              Animator::kMaxFramePipelineDepth);
+
+    animator->SetFramePipelineMode(Settings::FramePipelineMode::kDefault);
+    EXPECT_EQ(animator->GetFramePipelineDepth(), 2u);
+  });
+}
+
+TEST_F(ShellTest, AnimatorPredictiveSchedulingWaitsForVsyncWithoutHistory) {
+  FakeAnimatorDelegate delegate;
+  TaskRunners task_runners = {
+      "test",
+      CreateNewThread(),  // platform
+      CreateNewThread(),  // raster
+      CreateNewThread(),  // ui
+      CreateNewThread()   // io
+  };
+
+  auto clock = std::make_shared<ShellTestVsyncClock>();
+  std::shared_ptr<Animator> animator;
+
+  auto flush_vsync_task = [&] {
+    fml::AutoResetWaitableEvent ui_latch;
+    task_runners.GetUITaskRunner()->PostTask([&] { ui_latch.Signal(); });
+    do {
+      clock->SimulateVSync();
+    } while (ui_latch.WaitWithTimeout(fml::TimeDelta::FromMilliseconds(1)));
+  };
+
+  PostTaskSync(task_runners.GetUITaskRunner(), [&] {
+    auto vsync_waiter = static_cast<std::unique_ptr<VsyncWaiter>>(
+        std::make_unique<ShellTestVsyncWaiter>(task_runners, clock));
+    animator = std::make_unique<Animator>(delegate, task_runners,
+                                          std::move(vsync_waiter));
+    animator->SetPredictiveFrameScheduling(true);
+    // Nothing has been built or rasterized yet.
+    EXPECT_EQ(
+        animator->GetFrameLeadTime(fml::TimeDelta::FromMilliseconds(8)),
+        fml::TimeDelta::Zero());
+  });
+
+  fml::AutoResetWaitableEvent begin_frame_latch;
+  task_runners.GetUITaskRunner()->PostTask([&] {
+    EXPECT_CALL(delegate, OnAnimatorBeginFrame)
+        .WillOnce([&](fml::TimePoint frame_target_time, uint64_t frame_number,
+                      fml::TimePoint build_deadline) {
+          // Without raster timings the whole frame is left for the build.
+          EXPECT_EQ(build_deadline, frame_target_time);
+          begin_frame_latch.Signal();
+        });
+    animator->RequestFrame();
+    task_runners.GetPlatformTaskRunner()->PostTask(flush_vsync_task);
+  });
+  begin_frame_latch.Wait();
+
+  PostTaskSync(task_runners.GetUITaskRunner(), [&] { animator.reset(); });
+}
+
 }  // namespace testing
 }  // namespace flutter
 
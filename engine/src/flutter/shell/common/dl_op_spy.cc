@@ -10,6 +10,18 @@ bool DlOpSpy::did_draw() {
   return did_draw_;
 }
 
+std::optional<DlColor> DlOpSpy::solid_color() const {
+  return solid_color_;
+}
+
+void DlOpSpy::OnDraw(bool draws) {
+  // Even transparent draws change the fill if they don't blend with src over.
+  if (draws || blend_mode_ != DlBlendMode::kSrcOver) {
+    solid_color_.reset();
+  }
+  did_draw_ |= draws;
+}
+
 void DlOpSpy::setColor(DlColor color) {
   color_ = color;
   if (color.isTransparent()) {
@@ -18,6 +30,9 @@ void DlOpSpy::setColor(DlColor color) {
     will_draw_ = true;
   }
 }
+void DlOpSpy::setBlendMode(DlBlendMode mode) {
+  blend_mode_ = mode;
+}
 void DlOpSpy::setColorSource(const DlColorSource* source) {
   if (!source) {
     // Restore settings based on previously set color
@@ -26,65 +41,94 @@ void DlOpSpy::setColorSource(const DlColorSource* source) {
   }
   will_draw_ = true;
 }
+void DlOpSpy::clipRect(const DlRect& rect, DlClipOp clip_op, bool is_aa) {
+  fills_canvas_ = false;
+}
+void DlOpSpy::clipOval(const DlRect& bounds, DlClipOp clip_op, bool is_aa) {
+  fills_canvas_ = false;
+}
+void DlOpSpy::clipRoundRect(const DlRoundRect& rrect,
+                            DlClipOp clip_op,
+                            bool is_aa) {
+  fills_canvas_ = false;
+}
+void DlOpSpy::clipRoundSuperellipse(const DlRoundSuperellipse& rse,
+                                    DlClipOp clip_op,
+                                    bool is_aa) {
+  fills_canvas_ = false;
+}
+void DlOpSpy::clipPath(const DlPath& path, DlClipOp clip_op, bool is_aa) {
+  fills_canvas_ = false;
+}
 void DlOpSpy::save() {}
 void DlOpSpy::saveLayer(const DlRect& bounds,
                         const SaveLayerOptions options,
                         const DlImageFilter* backdrop,
-                        std::optional<int64_t> backdrop_id) {}
+                        std::optional<int64_t> backdrop_id) {
+  fills_canvas_ = false;
+}
 void DlOpSpy::restore() {}
 void DlOpSpy::drawColor(DlColor color, DlBlendMode mode) {
+  // An opaque color replaces everything drawn before it.
+  if (fills_canvas_ && color.isOpaque() &&
+      (mode == DlBlendMode::kSrc || mode == DlBlendMode::kSrcOver)) {
+    solid_color_ = color;
+    did_draw_ = true;
+    return;
+  }
+  solid_color_.reset();
   did_draw_ |= !color.isTransparent();
 }
 void DlOpSpy::drawPaint() {
-  did_draw_ |= will_draw_;
+  OnDraw(will_draw_);
 }
 // TODO(cyanglaz): check whether the shape (line, rect, oval, etc) needs to be
 // evaluated. https://github.com/flutter/flutter/issues/123803
 void DlOpSpy::drawLine(const DlPoint& p0, const DlPoint& p1) {
-  did_draw_ |= will_draw_;
+  OnDraw(will_draw_);
 }
 void DlOpSpy::drawDashedLine(const DlPoint& p0,
                              const DlPoint& p1,
                              DlScalar on_length,
                              DlScalar off_length) {
-  did_draw_ |= will_draw_;
+  OnDraw(will_draw_);
 }
 void DlOpSpy::drawRect(const DlRect& rect) {
-  did_draw_ |= will_draw_;
+  OnDraw(will_draw_);
 }
 void DlOpSpy::drawOval(const DlRect& bounds) {
-  did_draw_ |= will_draw_;
+  OnDraw(will_draw_);
 }
 void DlOpSpy::drawCircle(const DlPoint& center, DlScalar radius) {
-  did_draw_ |= will_draw_;
+  OnDraw(will_draw_);
 }
 void DlOpSpy::drawRoundRect(const DlRoundRect& rrect) {
-  did_draw_ |= will_draw_;
+  OnDraw(will_draw_);
 }
 void DlOpSpy::drawDiffRoundRect(const DlRoundRect& outer,
                                 const DlRoundRect& inner) {
-  did_draw_ |= will_draw_;
+  OnDraw(will_draw_);
 }
 void DlOpSpy::drawRoundSuperellipse(const DlRoundSuperellipse& rse) {
-  did_draw_ |= will_draw_;
+  OnDraw(will_draw_);
 }
 void DlOpSpy::drawPath(const DlPath& path) {
-  did_draw_ |= will_draw_;
+  OnDraw(will_draw_);
 }
 void DlOpSpy::drawArc(const DlRect& oval_bounds,
                       DlScalar start_degrees,
                       DlScalar sweep_degrees,
                       bool use_center) {
-  did_draw_ |= will_draw_;
+  OnDraw(will_draw_);
 }
 void DlOpSpy::drawPoints(DlPointMode mode,
                          uint32_t count,
                          const DlPoint points[]) {
-  did_draw_ |= will_draw_;
+  OnDraw(will_draw_);
 }
 void DlOpSpy::drawVertices(const std::shared_ptr<DlVertices>& vertices,
                            DlBlendMode mode) {
-  did_draw_ |= will_draw_;
+  OnDraw(will_draw_);
 }
 // In theory, below drawImage methods can produce a transparent screen when a
 // transparent image is provided. The operation of determine whether an image is
@@ -95,7 +139,7 @@ void DlOpSpy::drawImage(const sk_sp<DlImage> image,
                         const DlPoint& point,
                         DlImageSampling sampling,
                         bool render_with_attributes) {
-  did_draw_ = true;
+  OnDraw(true);
 }
 void DlOpSpy::drawImageRect(const sk_sp<DlImage> image,
                             const DlRect& src,
@@ -103,14 +147,14 @@ void DlOpSpy::drawImageRect(const sk_sp<DlImage> image,
                             DlImageSampling sampling,
                             bool render_with_attributes,
                             DlSrcRectConstraint constraint) {
-  did_draw_ = true;
+  OnDraw(true);
 }
 void DlOpSpy::drawImageNine(const sk_sp<DlImage> image,
                             const DlIRect& center,
                             const DlRect& dst,
                             DlFilterMode filter,
                             bool render_with_attributes) {
-  did_draw_ = true;
+  OnDraw(true);
 }
 void DlOpSpy::drawAtlas(const sk_sp<DlImage> atlas,
                         const DlRSTransform xform[],
@@ -121,22 +165,27 @@ void DlOpSpy::drawAtlas(const sk_sp<DlImage> atlas,
                         DlImageSampling sampling,
                         const DlRect* cull_rect,
                         bool render_with_attributes) {
-  did_draw_ = true;
+  OnDraw(true);
 }
 void DlOpSpy::drawDisplayList(const sk_sp<DisplayList> display_list,
                               DlScalar opacity) {
-  if (did_draw_ || opacity == 0) {
+  if ((did_draw_ && !solid_color_.has_value()) || opacity == 0) {
     return;
   }
   DlOpSpy receiver;
   display_list->Dispatch(receiver);
-  did_draw_ |= receiver.did_draw();
+  if (receiver.solid_color().has_value() && fills_canvas_ && opacity >= 1) {
+    solid_color_ = receiver.solid_color();
+    did_draw_ = true;
+    return;
+  }
+  OnDraw(receiver.did_draw());
 }
 
 void DlOpSpy::drawText(const std::shared_ptr<flutter::DlText>& text_frame,
                        DlScalar x,
                        DlScalar y) {
-  did_draw_ |= will_draw_;
+  OnDraw(will_draw_);
 }
 
 void DlOpSpy::drawShadow(const DlPath& path,
@@ -144,7 +193,7 @@ void DlOpSpy::drawShadow(const DlPath& path,
                          const DlScalar elevation,
                          bool transparent_occluder,
                          DlScalar dpr) {
-  did_draw_ |= !color.isTransparent();
+  OnDraw(!color.isTransparent());
 }
 
 }  // namespace flutter
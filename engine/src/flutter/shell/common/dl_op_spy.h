@@ -5,6 +5,8 @@
 #ifndef FLUTTER_SHELL_COMMON_DL_OP_SPY_H_
 #define FLUTTER_SHELL_COMMON_DL_OP_SPY_H_
 
+#include <optional>
+
 #include "flutter/display_list/dl_op_receiver.h"
 #include "flutter/display_list/utils/dl_receiver_utils.h"
 
@@ -14,7 +16,7 @@ namespace flutter {
 /// Receives to drawing commands of a DisplayListBuilder.
 ///
 /// This is used to determine whether any non-transparent pixels will be drawn
-/// on the canvas.
+/// on the canvas, and whether the canvas is just filled with a single color.
 /// All the drawImage operations are considered drawing non-transparent pixels.
 ///
 /// To use this class, dispatch the operations from DisplayList to a concrete
@@ -28,16 +30,35 @@ namespace flutter {
 ///
 class DlOpSpy final : public virtual DlOpReceiver,
                       private IgnoreAttributeDispatchHelper,
-                      private IgnoreClipDispatchHelper,
                       private IgnoreTransformDispatchHelper {
  public:
   //----------------------------------------------------------------------------
   /// @brief      Returns true if any non transparent content has been drawn.
   bool did_draw();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Returns the color the whole canvas is filled with, if the
+  ///             operations amount to a single opaque fill.
+  ///
+  ///             The classification is conservative: only unclipped
+  ///             drawColor operations outside of save layers are considered,
+  ///             and anything drawn after the fill makes the content complex.
+  ///             A canvas with this content can be rendered with a clear.
+  std::optional<DlColor> solid_color() const;
+
  private:
   void setColor(DlColor color) override;
+  void setBlendMode(DlBlendMode mode) override;
   void setColorSource(const DlColorSource* source) override;
+  void clipRect(const DlRect& rect, DlClipOp clip_op, bool is_aa) override;
+  void clipOval(const DlRect& bounds, DlClipOp clip_op, bool is_aa) override;
+  void clipRoundRect(const DlRoundRect& rrect,
+                     DlClipOp clip_op,
+                     bool is_aa) override;
+  void clipRoundSuperellipse(const DlRoundSuperellipse& rse,
+                             DlClipOp clip_op,
+                             bool is_aa) override;
+  void clipPath(const DlPath& path, DlClipOp clip_op, bool is_aa) override;
   void save() override;
   void saveLayer(const DlRect& bounds,
                  const SaveLayerOptions options,
@@ -113,6 +134,19 @@ class DlOpSpy final : public virtual DlOpReceiver,
   bool will_draw_ = true;
 
   bool did_draw_ = false;
+
+  // The most recently set blend mode.
+  DlBlendMode blend_mode_ = DlBlendMode::kSrcOver;
+
+  // Whether a draw color operation still fills the whole canvas, which stops
+  // being the case after the first clip or save layer.
+  bool fills_canvas_ = true;
+
+  // The color of the fill, as long as nothing else has been drawn since.
+  std::optional<DlColor> solid_color_;
+
+  // Record a drawing operation other than a full canvas fill.
+  void OnDraw(bool draws);
 };
 
 }  // namespace flutter
@@ -618,5 +618,67 @@ TEST(DlOpSpy, DrawShadow) {
   }
 }
 
+TEST(DlOpSpy, SolidColor) {
+  {  // opaque draw color
+    DisplayListBuilder builder;
+    builder.DrawColor(DlColor::kRed(), DlBlendMode::kSrcOver);
+    sk_sp<DisplayList> dl = builder.Build();
+    DlOpSpy dl_op_spy;
+    dl->Dispatch(dl_op_spy);
+    ASSERT_DID_DRAW(dl_op_spy, dl);
+    ASSERT_EQ(dl_op_spy.solid_color(), DlColor::kRed());
+  }
+  {  // content covered by an opaque draw color
+    DisplayListBuilder builder;
+    builder.DrawRect(DlRect::MakeWH(5, 5), DlPaint(DlColor::kBlue()));
+    builder.DrawColor(DlColor::kRed(), DlBlendMode::kSrc);
+    sk_sp<DisplayList> dl = builder.Build();
+    DlOpSpy dl_op_spy;
+    dl->Dispatch(dl_op_spy);
+    ASSERT_EQ(dl_op_spy.solid_color(), DlColor::kRed());
+  }
+  {  // content drawn over the fill
+    DisplayListBuilder builder;
+    builder.DrawColor(DlColor::kRed(), DlBlendMode::kSrc);
+    builder.DrawRect(DlRect::MakeWH(5, 5), DlPaint(DlColor::kBlue()));
+    sk_sp<DisplayList> dl = builder.Build();
+    DlOpSpy dl_op_spy;
+    dl->Dispatch(dl_op_spy);
+    ASSERT_DID_DRAW(dl_op_spy, dl);
+    ASSERT_FALSE(dl_op_spy.solid_color().has_value());
+  }
+  {  // translucent draw color
+    DisplayListBuilder builder;
+    builder.DrawColor(DlColor::kRed().withAlpha(0x80), DlBlendMode::kSrcOver);
+    sk_sp<DisplayList> dl = builder.Build();
+    DlOpSpy dl_op_spy;
+    dl->Dispatch(dl_op_spy);
+    ASSERT_DID_DRAW(dl_op_spy, dl);
+    ASSERT_FALSE(dl_op_spy.solid_color().has_value());
+  }
+  {  // clipped draw color
+    DisplayListBuilder builder;
+    builder.ClipRect(DlRect::MakeWH(5, 5));
+    builder.DrawColor(DlColor::kRed(), DlBlendMode::kSrc);
+    sk_sp<DisplayList> dl = builder.Build();
+    DlOpSpy dl_op_spy;
+    dl->Dispatch(dl_op_spy);
+    ASSERT_DID_DRAW(dl_op_spy, dl);
+    ASSERT_FALSE(dl_op_spy.solid_color().has_value());
+  }
+  {  // nested display list
+    DisplayListBuilder child_builder;
+    child_builder.DrawColor(DlColor::kRed(), DlBlendMode::kSrc);
+    sk_sp<DisplayList> child = child_builder.Build();
+    DisplayListBuilder builder;
+    builder.DrawDisplayList(child);
+    sk_sp<DisplayList> dl = builder.Build();
+    DlOpSpy dl_op_spy;
+    dl->Dispatch(dl_op_spy);
+    ASSERT_DID_DRAW(dl_op_spy, dl);
+    ASSERT_EQ(dl_op_spy.solid_color(), DlColor::kRed());
+  }
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -12,6 +12,8 @@
 
 #include "flutter/assets/native_assets.h"
 #include "flutter/common/settings.h"
+#include "flutter/fml/closure.h"
+#include "flutter/fml/synchronization/waitable_event.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/impeller/core/runtime_types.h"
 #include "flutter/lib/ui/text/font_collection.h"
@@ -31,6 +33,26 @@ namespace {
 fml::MallocMapping MakeMapping(const std::string& str) {
   return fml::MallocMapping::Copy(str.c_str(), str.length());
 }
+
+// Registers the fonts and native assets of the bundle. This doesn't need the
+// isolate, and may run on any thread as long as nothing else uses the font
+// collection and native assets manager meanwhile.
+void RegisterAssets(const Settings& settings,
+                    FontCollection& font_collection,
+                    NativeAssetsManager& native_assets_manager,
+                    const std::shared_ptr<AssetManager>& asset_manager) {
+  TRACE_EVENT0("flutter", "Engine::RegisterAssets");
+  // Using libTXT as the text engine.
+  if (settings.use_asset_fonts) {
+    font_collection.RegisterFonts(asset_manager);
+  }
+
+  if (settings.use_test_fonts) {
+    font_collection.RegisterTestFonts();
+  }
+
+  native_assets_manager.RegisterNativeAssets(asset_manager);
+}
 }  // namespace
 
 Engine::Engine(
@@ -156,6 +178,10 @@ fml::TaskRunnerAffineWeakPtr<Engine> Engine::GetWeakPtr() const {
 
 void Engine::SetupDefaultFontManager() {
   TRACE_EVENT0("flutter", "Engine::SetupDefaultFontManager");
+  if (!settings_.temp_directory_path.empty()) {
+    font_collection_->GetFontCollection()->SetFallbackFontIndexDirectory(
+        settings_.temp_directory_path);
+  }
   font_collection_->SetupDefaultFontManager(settings_.font_initialization_data);
 }
 
@@ -167,6 +193,10 @@ fml::TaskRunnerAffineWeakPtr<ImageDecoder> Engine::GetImageDecoderWeakPtr() {
   return image_decoder_->GetWeakPtr();
 }
 
+std::shared_ptr<ImageDecodeScheduler> Engine::GetImageDecodeScheduler() const {
+  return image_decoder_->GetDecodeScheduler();
+}
+
 fml::TaskRunnerAffineWeakPtr<ImageGeneratorRegistry>
 Engine::GetImageGeneratorRegistry() {
   return image_generator_registry_.GetWeakPtr();
@@ -174,6 +204,16 @@ Engine::GetImageGeneratorRegistry() {
 
 bool Engine::UpdateAssetManager(
     const std::shared_ptr<AssetManager>& new_asset_manager) {
+  if (!SetAssetManager(new_asset_manager)) {
+    return false;
+  }
+  RegisterAssets(settings_, *font_collection_, *native_assets_manager_,
+                 asset_manager_);
+  return true;
+}
+
+bool Engine::SetAssetManager(
+    const std::shared_ptr<AssetManager>& new_asset_manager) {
   if (asset_manager_ && new_asset_manager &&
       *asset_manager_ == *new_asset_manager) {
     return false;
@@ -185,20 +225,9 @@ bool Engine::UpdateAssetManager(
     return false;
   }
 
-  // Using libTXT as the text engine.
-  if (settings_.use_asset_fonts) {
-    font_collection_->RegisterFonts(asset_manager_);
-  }
-
-  if (settings_.use_test_fonts) {
-    font_collection_->RegisterTestFonts();
-  }
-
   if (native_assets_manager_ == nullptr) {
     native_assets_manager_ = std::make_shared<NativeAssetsManager>();
   }
-  native_assets_manager_->RegisterNativeAssets(asset_manager_);
-
   return true;
 }
 
@@ -229,7 +258,37 @@ Engine::RunStatus Engine::Run(RunConfiguration configuration) {
 
   last_engine_id_ = configuration.GetEngineId();
 
-  UpdateAssetManager(configuration.GetAssetManager());
+  // The fonts and native assets of the bundle are registered on a worker
+  // while the root isolate is created, and waited for before the entrypoint
+  // runs or this returns, whichever comes first.
+  fml::AutoResetWaitableEvent assets_registered;
+  bool assets_pending = false;
+  if (SetAssetManager(configuration.GetAssetManager())) {
+    DartVM* vm = runtime_controller_->GetDartVM();
+    if (vm && vm->GetConcurrentWorkerTaskRunner()) {
+      assets_pending = true;
+      vm->GetConcurrentWorkerTaskRunner()->PostTask(
+          [&assets_registered, &settings = settings_,
+           font_collection = font_collection_,
+           native_assets_manager = native_assets_manager_,
+           asset_manager = asset_manager_]() {
+            RegisterAssets(settings, *font_collection, *native_assets_manager,
+                           asset_manager);
+            assets_registered.Signal();
+          });
+    } else {
+      RegisterAssets(settings_, *font_collection_, *native_assets_manager_,
+                     asset_manager_);
+    }
+  }
+  auto wait_for_assets = [&]() {
+    if (assets_pending) {
+      TRACE_EVENT0("flutter", "Engine::WaitForRegisterAssets");
+      assets_registered.Wait();
+      assets_pending = false;
+    }
+  };
+  fml::ScopedCleanupClosure wait_for_assets_on_return(wait_for_assets);
 
   if (runtime_controller_->IsRootIsolateRunning()) {
     return RunStatus::FailureAlreadyRunning;
@@ -239,6 +298,7 @@ Engine::RunStatus Engine::Run(RunConfiguration configuration) {
   // font manager later in the engine launch process.  This makes it less
   // likely that the setup will need to wait for the prefetch to complete.
   auto root_isolate_create_callback = [&]() {
+    wait_for_assets();
     if (settings_.prefetched_default_font_manager) {
       SetupDefaultFontManager();
     }
@@ -293,8 +353,10 @@ Engine::RunStatus Engine::Run(RunConfiguration configuration) {
   return Engine::RunStatus::Success;
 }
 
-void Engine::BeginFrame(fml::TimePoint frame_time, uint64_t frame_number) {
-  runtime_controller_->BeginFrame(frame_time, frame_number);
+void Engine::BeginFrame(fml::TimePoint frame_time,
+                        uint64_t frame_number,
+                        fml::TimePoint build_deadline) {
+  runtime_controller_->BeginFrame(frame_time, frame_number, build_deadline);
 }
 
 void Engine::ReportTimings(std::vector<int64_t> timings) {
@@ -303,6 +365,9 @@ void Engine::ReportTimings(std::vector<int64_t> timings) {
 
 void Engine::NotifyIdle(fml::TimeDelta deadline) {
   runtime_controller_->NotifyIdle(deadline);
+  // The fallback fonts found while the frames were shaped are saved once the
+  // UI thread has nothing else to do.
+  font_collection_->GetFontCollection()->SaveFallbackFontIndex();
 }
 
 std::optional<uint32_t> Engine::GetUIIsolateReturnCode() {
@@ -589,6 +654,13 @@ void Engine::ScheduleSecondaryVsyncCallback(uintptr_t id,
   animator_->ScheduleSecondaryVsyncCallback(id, callback);
 }
 
+std::optional<VsyncWaiter::VsyncTimes> Engine::GetLastVsyncTimes() const {
+  if (auto waiter = animator_->GetVsyncWaiter().lock()) {
+    return waiter->GetLastVsyncTimes();
+  }
+  return std::nullopt;
+}
+
 void Engine::HandleAssetPlatformMessage(
     std::unique_ptr<PlatformMessage> message) {
   fml::RefPtr<PlatformMessageResponse> response = message->response();
@@ -641,6 +713,10 @@ void Engine::SendChannelUpdate(std::string name, bool listening) {
   delegate_.OnEngineChannelUpdate(std::move(name), listening);
 }
 
+void Engine::SetPlatformMessagePort(std::string name, int64_t port) {
+  delegate_.OnEngineSetPlatformMessagePort(std::move(name), port);
+}
+
 void Engine::LoadDartDeferredLibrary(
     intptr_t loading_unit_id,
     std::unique_ptr<const fml::Mapping> snapshot_data,
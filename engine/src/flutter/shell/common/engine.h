@@ -325,6 +325,21 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
     ///
     virtual void OnEngineChannelUpdate(std::string name, bool listening) = 0;
 
+    //--------------------------------------------------------------------------
+    /// @brief      Invoked when the messages on a platform channel are to be
+    ///             delivered to a Dart port, bypassing the UI thread.
+    ///
+    /// @param[in]  name             The name of the platform channel.
+    ///
+    /// @param[in]  port             The port to deliver the messages to, or
+    ///                              `ILLEGAL_PORT` to deliver them to the
+    ///                              engine again.
+    ///
+    /// @see        `PlatformMessagePortRouter`
+    ///
+    virtual void OnEngineSetPlatformMessagePort(std::string name,
+                                                int64_t port) = 0;
+
     //--------------------------------------------------------------------------
     /// @brief      Synchronously invokes platform-specific APIs to apply the
     ///             system text scaling on the given unscaled font size.
@@ -577,7 +592,13 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
   ///                          by the framework to associate frame specific
   ///                          debug information with frame timings and timeline
   ///                          events.
-  void BeginFrame(fml::TimePoint frame_time, uint64_t frame_number);
+  ///
+  /// @param[in]  build_deadline The point by which the frame should be built
+  ///                            so that it can be rasterized in time. Exposed
+  ///                            to the framework as `FrameData.buildDeadline`.
+  void BeginFrame(fml::TimePoint frame_time,
+                  uint64_t frame_number,
+                  fml::TimePoint build_deadline);
 
   //----------------------------------------------------------------------------
   /// @brief      Notifies the engine that the UI task runner is not expected to
@@ -893,6 +914,14 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
   // Return the weak_ptr of ImageDecoder.
   fml::TaskRunnerAffineWeakPtr<ImageDecoder> GetImageDecoderWeakPtr();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Get the scheduler of the image decodes of the engine.
+  ///
+  /// @attention  Unlike the image decoder, the scheduler may be used from any
+  ///             thread, and outlives the engine while it is held.
+  ///
+  std::shared_ptr<ImageDecodeScheduler> GetImageDecodeScheduler() const;
+
   //----------------------------------------------------------------------------
   /// @brief      Get the `ImageGeneratorRegistry` associated with the current
   ///             engine.
@@ -910,6 +939,9 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
   void ScheduleSecondaryVsyncCallback(uintptr_t id,
                                       const fml::closure& callback) override;
 
+  // |PointerDataDispatcher::Delegate|
+  std::optional<VsyncWaiter::VsyncTimes> GetLastVsyncTimes() const override;
+
   //----------------------------------------------------------------------------
   /// @brief      Get the last Entrypoint that was used in the RunConfiguration
   ///             when |Engine::Run| was called.
@@ -1066,6 +1098,9 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
   // |RuntimeDelegate|
   void SendChannelUpdate(std::string name, bool listening) override;
 
+  // |RuntimeDelegate|
+  void SetPlatformMessagePort(std::string name, int64_t port) override;
+
   // |RuntimeDelegate|
   double GetScaledFontSize(double unscaled_font_size,
                            int configuration_id) const override;
@@ -1075,6 +1110,10 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
 
   void SetNeedsReportTimings(bool value) override;
 
+  // Replaces the asset manager like |UpdateAssetManager|, but leaves the
+  // registration of its fonts and native assets to the caller.
+  bool SetAssetManager(const std::shared_ptr<AssetManager>& asset_manager);
+
   bool HandleLifecyclePlatformMessage(PlatformMessage* message);
 
   bool HandleNavigationPlatformMessage(
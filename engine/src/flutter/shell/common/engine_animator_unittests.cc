@@ -84,6 +84,10 @@ class MockDelegate : public Engine::Delegate {
               (),
               (const, override));
   MOCK_METHOD(void, OnEngineChannelUpdate, (std::string, bool), (override));
+  MOCK_METHOD(void,
+              OnEngineSetPlatformMessagePort,
+              (std::string, int64_t),
+              (override));
   MOCK_METHOD(double,
               GetScaledFontSize,
               (double font_size, int configuration_id),
@@ -99,7 +103,9 @@ class MockAnimatorDelegate : public Animator::Delegate {
   /* Animator::Delegate */
   MOCK_METHOD(void,
               OnAnimatorBeginFrame,
-              (fml::TimePoint frame_target_time, uint64_t frame_number),
+              (fml::TimePoint frame_target_time,
+               uint64_t frame_number,
+               fml::TimePoint build_deadline),
               (override));
   MOCK_METHOD(void,
               OnAnimatorNotifyIdle,
@@ -299,9 +305,10 @@ TEST_F(EngineAnimatorTest, AnimatorAcceptsMultipleRenders) {
           }));
   EXPECT_CALL(animator_delegate, OnAnimatorBeginFrame)
       .WillOnce(Invoke([&engine_context](fml::TimePoint frame_target_time,
-                                         uint64_t frame_number) {
+                                         uint64_t frame_number,
+                                         fml::TimePoint build_deadline) {
         engine_context->EngineTaskSync([&](Engine& engine) {
-          engine.BeginFrame(frame_target_time, frame_number);
+          engine.BeginFrame(frame_target_time, frame_number, build_deadline);
         });
       }));
 
@@ -362,9 +369,10 @@ TEST_F(EngineAnimatorTest, IgnoresOutOfFrameRenders) {
           }));
   EXPECT_CALL(animator_delegate, OnAnimatorBeginFrame)
       .WillOnce(Invoke([&engine_context](fml::TimePoint frame_target_time,
-                                         uint64_t frame_number) {
+                                         uint64_t frame_number,
+                                         fml::TimePoint build_deadline) {
         engine_context->EngineTaskSync([&](Engine& engine) {
-          engine.BeginFrame(frame_target_time, frame_number);
+          engine.BeginFrame(frame_target_time, frame_number, build_deadline);
         });
       }));
 
@@ -437,9 +445,10 @@ TEST_F(EngineAnimatorTest, IgnoresDuplicateRenders) {
       }));
   EXPECT_CALL(animator_delegate, OnAnimatorBeginFrame)
       .WillOnce(Invoke([&engine_context](fml::TimePoint frame_target_time,
-                                         uint64_t frame_number) {
+                                         uint64_t frame_number,
+                                         fml::TimePoint build_deadline) {
         engine_context->EngineTaskSync([&](Engine& engine) {
-          engine.BeginFrame(frame_target_time, frame_number);
+          engine.BeginFrame(frame_target_time, frame_number, build_deadline);
         });
       }));
 
@@ -493,9 +502,10 @@ TEST_F(EngineAnimatorTest, AnimatorSubmitsImplicitViewBeforeDrawFrameEnds) {
       }));
   EXPECT_CALL(animator_delegate, OnAnimatorBeginFrame)
       .WillRepeatedly(Invoke([&engine_context](fml::TimePoint frame_target_time,
-                                               uint64_t frame_number) {
+                                               uint64_t frame_number,
+                                               fml::TimePoint build_deadline) {
         engine_context->EngineTaskSync([&](Engine& engine) {
-          engine.BeginFrame(frame_target_time, frame_number);
+          engine.BeginFrame(frame_target_time, frame_number, build_deadline);
         });
       }));
 
@@ -559,10 +569,12 @@ TEST_F(EngineAnimatorTest, AnimatorSubmitWarmUpImplicitView) {
   EXPECT_CALL(animator_delegate, OnAnimatorBeginFrame)
       .WillRepeatedly(
           Invoke([&engine_context, &continuation_ready_latch](
-                     fml::TimePoint frame_target_time, uint64_t frame_number) {
+                     fml::TimePoint frame_target_time, uint64_t frame_number,
+                     fml::TimePoint build_deadline) {
             continuation_ready_latch.Signal();
             engine_context->EngineTaskSync([&](Engine& engine) {
-              engine.BeginFrame(frame_target_time, frame_number);
+              engine.BeginFrame(frame_target_time, frame_number,
+                                build_deadline);
             });
           }));
 
@@ -629,10 +641,12 @@ TEST_F(EngineAnimatorTest, AnimatorSubmitPartialViewsForWarmUp) {
   EXPECT_CALL(animator_delegate, OnAnimatorBeginFrame)
       .WillRepeatedly(
           Invoke([&engine_context, &continuation_ready_latch](
-                     fml::TimePoint frame_target_time, uint64_t frame_number) {
+                     fml::TimePoint frame_target_time, uint64_t frame_number,
+                     fml::TimePoint build_deadline) {
             continuation_ready_latch.Signal();
             engine_context->EngineTaskSync([&](Engine& engine) {
-              engine.BeginFrame(frame_target_time, frame_number);
+              engine.BeginFrame(frame_target_time, frame_number,
+                                build_deadline);
             });
           }));
 
@@ -91,6 +91,10 @@ class MockDelegate : public Engine::Delegate {
               (),
               (const, override));
   MOCK_METHOD(void, OnEngineChannelUpdate, (std::string, bool), (override));
+  MOCK_METHOD(void,
+              OnEngineSetPlatformMessagePort,
+              (std::string, int64_t),
+              (override));
   MOCK_METHOD(double,
               GetScaledFontSize,
               (double font_size, int configuration_id),
@@ -144,6 +148,7 @@ class MockRuntimeDelegate : public RuntimeDelegate {
               (),
               (const, override));
   MOCK_METHOD(void, SendChannelUpdate, (std::string, bool), (override));
+  MOCK_METHOD(void, SetPlatformMessagePort, (std::string, int64_t), (override));
   MOCK_METHOD(double,
               GetScaledFontSize,
               (double font_size, int configuration_id),
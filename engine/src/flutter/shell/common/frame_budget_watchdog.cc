@@ -0,0 +1,81 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/frame_budget_watchdog.h"
+
+#include <utility>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+const char* QualityDegradationToString(QualityDegradation degradation) {
+  switch (degradation) {
+    case QualityDegradation::kNone:
+      return "none";
+    case QualityDegradation::kOffscreenMsaaDisabled:
+      return "offscreenMsaaDisabled";
+    case QualityDegradation::kBlurQualityReduced:
+      return "blurQualityReduced";
+    case QualityDegradation::kRasterCacheThresholdsReduced:
+      return "rasterCacheThresholdsReduced";
+    case QualityDegradation::kBackdropFiltersDisabled:
+      return "backdropFiltersDisabled";
+  }
+  FML_UNREACHABLE();
+}
+
+FrameBudgetWatchdog::FrameBudgetWatchdog(size_t misses_to_degrade,
+                                         DegradationChangedCallback callback,
+                                         size_t frames_to_recover)
+    : misses_to_degrade_(misses_to_degrade),
+      frames_to_recover_(frames_to_recover),
+      callback_(std::move(callback)) {
+  FML_DCHECK(misses_to_degrade_ > 0);
+}
+
+FrameBudgetWatchdog::~FrameBudgetWatchdog() = default;
+
+void FrameBudgetWatchdog::OnFrameRasterized(const FrameTiming& timing,
+                                            fml::TimeDelta frame_budget) {
+  fml::TimeDelta raster_time = timing.Get(FrameTiming::kRasterFinish) -
+                               timing.Get(FrameTiming::kRasterStart);
+  if (raster_time > frame_budget) {
+    consecutive_hits_ = 0;
+    if (++consecutive_misses_ >= misses_to_degrade_ &&
+        degradation_ != QualityDegradation::kBackdropFiltersDisabled) {
+      SetDegradation(static_cast<QualityDegradation>(
+          static_cast<int>(degradation_) + 1));
+    }
+    return;
+  }
+
+  consecutive_misses_ = 0;
+  // Frames that only just fit would likely miss again at a higher quality.
+  if (raster_time * 4 > frame_budget * 3) {
+    consecutive_hits_ = 0;
+    return;
+  }
+  if (++consecutive_hits_ >= frames_to_recover_ &&
+      degradation_ != QualityDegradation::kNone) {
+    SetDegradation(
+        static_cast<QualityDegradation>(static_cast<int>(degradation_) - 1));
+  }
+}
+
+void FrameBudgetWatchdog::SetDegradation(QualityDegradation degradation) {
+  TRACE_EVENT1("flutter", "FrameBudgetWatchdog::SetDegradation", "degradation",
+               QualityDegradationToString(degradation));
+  FML_DLOG(INFO) << "Raster quality degradation changed to "
+                 << QualityDegradationToString(degradation) << ".";
+  degradation_ = degradation;
+  consecutive_misses_ = 0;
+  consecutive_hits_ = 0;
+  if (callback_) {
+    callback_(degradation_);
+  }
+}
+
+}  // namespace flutter
@@ -0,0 +1,88 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_FRAME_BUDGET_WATCHDOG_H_
+#define FLUTTER_SHELL_COMMON_FRAME_BUDGET_WATCHDOG_H_
+
+#include <cstddef>
+#include <functional>
+
+#include "flutter/common/settings.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_delta.h"
+
+namespace flutter {
+
+/// The steps in which rendering quality is reduced when the raster thread
+/// keeps missing its frame budget. Each step includes the previous ones.
+enum class QualityDegradation {
+  kNone,
+  /// Offscreen passes are rendered without multisampling.
+  kOffscreenMsaaDisabled,
+  /// Gaussian blurs are down-sampled further.
+  kBlurQualityReduced,
+  /// The raster cache caches entries sooner and caches cheaper ones.
+  kRasterCacheThresholdsReduced,
+  /// Backdrop filters are not applied.
+  kBackdropFiltersDisabled,
+};
+
+const char* QualityDegradationToString(QualityDegradation degradation);
+
+//------------------------------------------------------------------------------
+/// Watches the raster time of frames against the frame budget of the display
+/// and steps the |QualityDegradation| up after a number of consecutive frames
+/// that missed it, and back down after a longer run of frames that met it
+/// with some margin.
+///
+/// This is meant to keep devices that are thermally throttled smooth, at a
+/// lower quality, rather than missing frames indefinitely.
+///
+/// This is not thread-safe and is used on the raster thread.
+///
+class FrameBudgetWatchdog {
+ public:
+  using DegradationChangedCallback =
+      std::function<void(QualityDegradation degradation)>;
+
+  /// The number of consecutive frames that must meet the budget with
+  /// headroom before the degradation is stepped back down.
+  static constexpr size_t kDefaultFramesToRecover = 600;
+
+  //----------------------------------------------------------------------------
+  /// @param[in]  misses_to_degrade  The number of consecutive frames that
+  ///                                must miss the budget before the
+  ///                                degradation is stepped up.
+  /// @param[in]  callback           Called with the new degradation every
+  ///                                time it changes.
+  /// @param[in]  frames_to_recover  See |kDefaultFramesToRecover|.
+  ///
+  FrameBudgetWatchdog(size_t misses_to_degrade,
+                      DegradationChangedCallback callback,
+                      size_t frames_to_recover = kDefaultFramesToRecover);
+
+  ~FrameBudgetWatchdog();
+
+  /// Accounts for the raster time of a frame rendered with the given budget.
+  void OnFrameRasterized(const FrameTiming& timing,
+                         fml::TimeDelta frame_budget);
+
+  QualityDegradation GetDegradation() const { return degradation_; }
+
+ private:
+  void SetDegradation(QualityDegradation degradation);
+
+  const size_t misses_to_degrade_;
+  const size_t frames_to_recover_;
+  const DegradationChangedCallback callback_;
+  QualityDegradation degradation_ = QualityDegradation::kNone;
+  size_t consecutive_misses_ = 0;
+  size_t consecutive_hits_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FrameBudgetWatchdog);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_FRAME_BUDGET_WATCHDOG_H_
@@ -0,0 +1,103 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/frame_budget_watchdog.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+constexpr fml::TimeDelta kBudget = fml::TimeDelta::FromMilliseconds(16);
+
+FrameTiming MakeTiming(fml::TimeDelta raster_time) {
+  FrameTiming timing;
+  fml::TimePoint start = fml::TimePoint::Now();
+  timing.Set(FrameTiming::kRasterStart, start);
+  timing.Set(FrameTiming::kRasterFinish, start + raster_time);
+  return timing;
+}
+
+void Rasterize(FrameBudgetWatchdog& watchdog,
+               fml::TimeDelta raster_time,
+               size_t frames) {
+  for (size_t i = 0; i < frames; i++) {
+    watchdog.OnFrameRasterized(MakeTiming(raster_time), kBudget);
+  }
+}
+
+}  // namespace
+
+TEST(FrameBudgetWatchdogTest, DegradesAfterConsecutiveMisses) {
+  std::vector<QualityDegradation> changes;
+  FrameBudgetWatchdog watchdog(
+      3, [&](QualityDegradation degradation) { changes.push_back(degradation); });
+
+  Rasterize(watchdog, fml::TimeDelta::FromMilliseconds(20), 2);
+  // A frame that fits resets the misses.
+  Rasterize(watchdog, fml::TimeDelta::FromMilliseconds(10), 1);
+  Rasterize(watchdog, fml::TimeDelta::FromMilliseconds(20), 2);
+  EXPECT_EQ(watchdog.GetDegradation(), QualityDegradation::kNone);
+  EXPECT_TRUE(changes.empty());
+
+  Rasterize(watchdog, fml::TimeDelta::FromMilliseconds(20), 1);
+  EXPECT_EQ(watchdog.GetDegradation(),
+            QualityDegradation::kOffscreenMsaaDisabled);
+
+  // Every further step takes as many misses.
+  Rasterize(watchdog, fml::TimeDelta::FromMilliseconds(20), 2);
+  EXPECT_EQ(watchdog.GetDegradation(),
+            QualityDegradation::kOffscreenMsaaDisabled);
+  Rasterize(watchdog, fml::TimeDelta::FromMilliseconds(20), 100);
+  EXPECT_EQ(watchdog.GetDegradation(),
+            QualityDegradation::kBackdropFiltersDisabled);
+
+  std::vector<QualityDegradation> expected = {
+      QualityDegradation::kOffscreenMsaaDisabled,
+      QualityDegradation::kBlurQualityReduced,
+      QualityDegradation::kRasterCacheThresholdsReduced,
+      QualityDegradation::kBackdropFiltersDisabled,
+  };
+  EXPECT_EQ(changes, expected);
+}
+
+TEST(FrameBudgetWatchdogTest, RecoversAfterFramesWithHeadroom) {
+  std::vector<QualityDegradation> changes;
+  FrameBudgetWatchdog watchdog(
+      2, [&](QualityDegradation degradation) { changes.push_back(degradation); },
+      /*frames_to_recover=*/5);
+
+  Rasterize(watchdog, fml::TimeDelta::FromMilliseconds(20), 4);
+  EXPECT_EQ(watchdog.GetDegradation(), QualityDegradation::kBlurQualityReduced);
+
+  // Frames that only just fit neither degrade nor recover.
+  Rasterize(watchdog, fml::TimeDelta::FromMilliseconds(15), 100);
+  EXPECT_EQ(watchdog.GetDegradation(), QualityDegradation::kBlurQualityReduced);
+
+  Rasterize(watchdog, fml::TimeDelta::FromMilliseconds(8), 4);
+  Rasterize(watchdog, fml::TimeDelta::FromMilliseconds(15), 1);
+  Rasterize(watchdog, fml::TimeDelta::FromMilliseconds(8), 4);
+  EXPECT_EQ(watchdog.GetDegradation(), QualityDegradation::kBlurQualityReduced);
+
+  Rasterize(watchdog, fml::TimeDelta::FromMilliseconds(8), 1);
+  EXPECT_EQ(watchdog.GetDegradation(),
+            QualityDegradation::kOffscreenMsaaDisabled);
+  Rasterize(watchdog, fml::TimeDelta::FromMilliseconds(8), 100);
+  EXPECT_EQ(watchdog.GetDegradation(), QualityDegradation::kNone);
+
+  std::vector<QualityDegradation> expected = {
+      QualityDegradation::kOffscreenMsaaDisabled,
+      QualityDegradation::kBlurQualityReduced,
+      QualityDegradation::kOffscreenMsaaDisabled,
+      QualityDegradation::kNone,
+  };
+  EXPECT_EQ(changes, expected);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -0,0 +1,37 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/gpu_memory_pressure_monitor.h"
+
+#include <algorithm>
+
+namespace flutter {
+
+GpuMemoryPressureMonitor::GpuMemoryPressureMonitor(size_t threshold_bytes,
+                                                   fml::TimeDelta min_interval)
+    : threshold_bytes_(threshold_bytes), min_interval_(min_interval) {}
+
+GpuMemoryPressureMonitor::~GpuMemoryPressureMonitor() = default;
+
+bool GpuMemoryPressureMonitor::OnFrameRasterized(size_t allocated_bytes,
+                                                 fml::TimePoint now) {
+  if (allocated_bytes < threshold_bytes_) {
+    last_request_time_.reset();
+    return false;
+  }
+  if (last_request_time_.has_value()) {
+    // Memory the collection released counts towards the growth again.
+    lowest_bytes_ = std::min(lowest_bytes_, allocated_bytes);
+    if (now - last_request_time_.value() < min_interval_ ||
+        allocated_bytes - lowest_bytes_ < threshold_bytes_ / 4) {
+      return false;
+    }
+  }
+  last_request_time_ = now;
+  lowest_bytes_ = allocated_bytes;
+  request_count_++;
+  return true;
+}
+
+}  // namespace flutter
@@ -0,0 +1,71 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_GPU_MEMORY_PRESSURE_MONITOR_H_
+#define FLUTTER_SHELL_COMMON_GPU_MEMORY_PRESSURE_MONITOR_H_
+
+#include <cstddef>
+#include <optional>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// Watches the GPU memory allocated by the rasterizer after each frame and
+/// decides when the Dart heap should be collected to release it.
+///
+/// The textures of images and pictures that are only referenced by garbage
+/// Dart objects stay allocated until the garbage collector finalizes those
+/// objects, which it otherwise may not do until its own heap grows. A
+/// collection is requested once the allocated memory reaches the threshold.
+/// If the memory stays above it, because it is in use, another one is only
+/// requested after the memory grew by a quarter of the threshold from its
+/// lowest point since the last request, and at least the minimum interval
+/// has passed, so that live memory doesn't cause a collection every frame.
+///
+/// This is not thread-safe and is used on the raster thread.
+///
+class GpuMemoryPressureMonitor {
+ public:
+  /// The least time between two requested collections.
+  static constexpr fml::TimeDelta kDefaultMinInterval =
+      fml::TimeDelta::FromSeconds(1);
+
+  //----------------------------------------------------------------------------
+  /// @param[in]  threshold_bytes  The allocated bytes from which on the
+  ///                              monitor requests collections.
+  /// @param[in]  min_interval     See |kDefaultMinInterval|.
+  ///
+  explicit GpuMemoryPressureMonitor(
+      size_t threshold_bytes,
+      fml::TimeDelta min_interval = kDefaultMinInterval);
+
+  ~GpuMemoryPressureMonitor();
+
+  /// Accounts for the bytes allocated after a frame that was rasterized at
+  /// `now`, and returns whether a collection should be requested.
+  bool OnFrameRasterized(size_t allocated_bytes, fml::TimePoint now);
+
+  /// The number of collections that were requested.
+  size_t GetRequestCount() const { return request_count_; }
+
+ private:
+  const size_t threshold_bytes_;
+  const fml::TimeDelta min_interval_;
+  // The time of the last request, unset while the allocated bytes are below
+  // the threshold.
+  std::optional<fml::TimePoint> last_request_time_;
+  // The fewest bytes allocated since the last request.
+  size_t lowest_bytes_ = 0;
+  size_t request_count_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(GpuMemoryPressureMonitor);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_GPU_MEMORY_PRESSURE_MONITOR_H_
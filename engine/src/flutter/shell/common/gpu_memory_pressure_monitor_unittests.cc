@@ -0,0 +1,66 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/gpu_memory_pressure_monitor.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+constexpr size_t kThreshold = 100;
+constexpr fml::TimeDelta kInterval = fml::TimeDelta::FromSeconds(1);
+
+}  // namespace
+
+TEST(GpuMemoryPressureMonitorTest, RequestsCollectionAtThreshold) {
+  GpuMemoryPressureMonitor monitor(kThreshold, kInterval);
+  fml::TimePoint now = fml::TimePoint::Now();
+  EXPECT_FALSE(monitor.OnFrameRasterized(99, now));
+  EXPECT_TRUE(monitor.OnFrameRasterized(100, now));
+  EXPECT_EQ(monitor.GetRequestCount(), 1u);
+}
+
+TEST(GpuMemoryPressureMonitorTest, DoesNotRepeatForLiveMemory) {
+  GpuMemoryPressureMonitor monitor(kThreshold, kInterval);
+  fml::TimePoint now = fml::TimePoint::Now();
+  EXPECT_TRUE(monitor.OnFrameRasterized(150, now));
+  for (int i = 1; i <= 10; i++) {
+    EXPECT_FALSE(monitor.OnFrameRasterized(150, now + kInterval * i));
+  }
+  EXPECT_EQ(monitor.GetRequestCount(), 1u);
+}
+
+TEST(GpuMemoryPressureMonitorTest, RepeatsAfterGrowthAndInterval) {
+  GpuMemoryPressureMonitor monitor(kThreshold, kInterval);
+  fml::TimePoint now = fml::TimePoint::Now();
+  EXPECT_TRUE(monitor.OnFrameRasterized(150, now));
+  // Grown enough, but too soon.
+  EXPECT_FALSE(monitor.OnFrameRasterized(200, now + kInterval / 2));
+  EXPECT_TRUE(monitor.OnFrameRasterized(200, now + kInterval));
+  EXPECT_EQ(monitor.GetRequestCount(), 2u);
+}
+
+TEST(GpuMemoryPressureMonitorTest, GrowthIsMeasuredFromLowestBytes) {
+  GpuMemoryPressureMonitor monitor(kThreshold, kInterval);
+  fml::TimePoint now = fml::TimePoint::Now();
+  EXPECT_TRUE(monitor.OnFrameRasterized(200, now));
+  // The collection released some memory.
+  EXPECT_FALSE(monitor.OnFrameRasterized(120, now + kInterval));
+  EXPECT_TRUE(monitor.OnFrameRasterized(145, now + kInterval * 2));
+}
+
+TEST(GpuMemoryPressureMonitorTest, RearmsBelowThreshold) {
+  GpuMemoryPressureMonitor monitor(kThreshold, kInterval);
+  fml::TimePoint now = fml::TimePoint::Now();
+  EXPECT_TRUE(monitor.OnFrameRasterized(100, now));
+  EXPECT_FALSE(monitor.OnFrameRasterized(50, now));
+  EXPECT_TRUE(monitor.OnFrameRasterized(100, now));
+  EXPECT_EQ(monitor.GetRequestCount(), 2u);
+}
+
+}  // namespace testing
+}  // namespace flutter
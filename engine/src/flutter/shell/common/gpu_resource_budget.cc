@@ -0,0 +1,74 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/gpu_resource_budget.h"
+
+#include <algorithm>
+
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+void GpuResourceBudget::AddItem(
+    const std::shared_ptr<GpuResourceBudgetItem>& item) {
+  items_.push_back(item);
+}
+
+std::vector<std::shared_ptr<GpuResourceBudgetItem>>
+GpuResourceBudget::LockItems() {
+  std::vector<std::shared_ptr<GpuResourceBudgetItem>> live_items;
+  std::vector<std::weak_ptr<GpuResourceBudgetItem>> weak_items;
+  for (const auto& weak_item : items_) {
+    if (auto item = weak_item.lock()) {
+      live_items.push_back(std::move(item));
+      weak_items.push_back(weak_item);
+    }
+  }
+  items_ = std::move(weak_items);
+  std::stable_sort(live_items.begin(), live_items.end(),
+                   [](const auto& a, const auto& b) {
+                     return a->GetTrimPriority() < b->GetTrimPriority();
+                   });
+  return live_items;
+}
+
+size_t GpuResourceBudget::GetResourceBytes() {
+  size_t bytes = 0;
+  for (const auto& item : LockItems()) {
+    bytes += item->GetResourceBytes();
+  }
+  return bytes;
+}
+
+size_t GpuResourceBudget::TrimToFit(size_t max_bytes) {
+  auto items = LockItems();
+  std::vector<size_t> item_bytes;
+  size_t bytes = 0;
+  for (const auto& item : items) {
+    item_bytes.push_back(item->GetResourceBytes());
+    bytes += item_bytes.back();
+  }
+  if (bytes <= max_bytes) {
+    return bytes;
+  }
+
+  TRACE_EVENT0("flutter", "GpuResourceBudget::TrimToFit");
+  for (size_t i = 0; i < items.size() && bytes > max_bytes; i++) {
+    if (item_bytes[i] == 0) {
+      continue;
+    }
+    items[i]->TrimResources();
+    bytes = bytes - item_bytes[i] + items[i]->GetResourceBytes();
+  }
+  return bytes;
+}
+
+void GpuResourceBudget::TrimAll() {
+  TRACE_EVENT0("flutter", "GpuResourceBudget::TrimAll");
+  for (const auto& item : LockItems()) {
+    item->TrimResources();
+  }
+}
+
+}  // namespace flutter
@@ -0,0 +1,77 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_GPU_RESOURCE_BUDGET_H_
+#define FLUTTER_SHELL_COMMON_GPU_RESOURCE_BUDGET_H_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+
+namespace flutter {
+
+// A cache of GPU resources whose memory is accounted for in a
+// |GpuResourceBudget|. This will be called on the raster thread.
+class GpuResourceBudgetItem {
+ public:
+  // The order in which items are trimmed when the budget is exceeded. Items
+  // that are cheap to recreate are trimmed first.
+  enum class Priority {
+    kLow,
+    kMedium,
+    kHigh,
+  };
+
+  // The number of bytes of GPU memory held by the cache.
+  virtual size_t GetResourceBytes() = 0;
+
+  virtual Priority GetTrimPriority() = 0;
+
+  // Release the resources that are not needed by the frame being drawn.
+  virtual void TrimResources() = 0;
+
+ protected:
+  virtual ~GpuResourceBudgetItem() = default;
+};
+
+// Accounts for the GPU memory of the caches that are not managed by Skia, and
+// trims them in priority order when they exceed a shared budget or when the
+// system is low on memory.
+//
+// The budget is shared by the shells spawned from the same shell, which share
+// a raster thread. This will be called on the raster thread.
+class GpuResourceBudget {
+ public:
+  GpuResourceBudget() = default;
+
+  ~GpuResourceBudget() = default;
+
+  // Items are held weakly and dropped once they are destroyed.
+  void AddItem(const std::shared_ptr<GpuResourceBudgetItem>& item);
+
+  // The number of bytes held by all items.
+  size_t GetResourceBytes();
+
+  // Trim items, lowest priority first, until all items together hold at most
+  // |max_bytes|. Returns the number of bytes held afterwards.
+  size_t TrimToFit(size_t max_bytes);
+
+  // Trim all items, lowest priority first, for example in response to a low
+  // memory warning.
+  void TrimAll();
+
+ private:
+  // The live items, sorted by priority, lowest first.
+  std::vector<std::shared_ptr<GpuResourceBudgetItem>> LockItems();
+
+  std::vector<std::weak_ptr<GpuResourceBudgetItem>> items_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(GpuResourceBudget);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_GPU_RESOURCE_BUDGET_H_
@@ -0,0 +1,85 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/gpu_resource_budget.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+class TestGpuResourceBudgetItem : public GpuResourceBudgetItem {
+ public:
+  TestGpuResourceBudgetItem(std::string name,
+                            size_t bytes,
+                            Priority priority,
+                            std::vector<std::string>* trimmed)
+      : name_(std::move(name)),
+        bytes_(bytes),
+        priority_(priority),
+        trimmed_(trimmed) {}
+
+  size_t GetResourceBytes() override { return bytes_; }
+
+  Priority GetTrimPriority() override { return priority_; }
+
+  void TrimResources() override {
+    bytes_ = 0;
+    trimmed_->push_back(name_);
+  }
+
+ private:
+  std::string name_;
+  size_t bytes_;
+  Priority priority_;
+  std::vector<std::string>* trimmed_;
+};
+
+TEST(GpuResourceBudgetTest, AccountsForLiveItems) {
+  std::vector<std::string> trimmed;
+  GpuResourceBudget budget;
+  auto item1 = std::make_shared<TestGpuResourceBudgetItem>(
+      "1", 100u, GpuResourceBudgetItem::Priority::kLow, &trimmed);
+  auto item2 = std::make_shared<TestGpuResourceBudgetItem>(
+      "2", 200u, GpuResourceBudgetItem::Priority::kHigh, &trimmed);
+  budget.AddItem(item1);
+  budget.AddItem(item2);
+  EXPECT_EQ(budget.GetResourceBytes(), 300u);
+
+  item1.reset();
+  EXPECT_EQ(budget.GetResourceBytes(), 200u);
+  EXPECT_TRUE(trimmed.empty());
+}
+
+TEST(GpuResourceBudgetTest, TrimsLowestPriorityFirstUntilItFits) {
+  std::vector<std::string> trimmed;
+  GpuResourceBudget budget;
+  auto high = std::make_shared<TestGpuResourceBudgetItem>(
+      "high", 100u, GpuResourceBudgetItem::Priority::kHigh, &trimmed);
+  auto low = std::make_shared<TestGpuResourceBudgetItem>(
+      "low", 100u, GpuResourceBudgetItem::Priority::kLow, &trimmed);
+  auto medium = std::make_shared<TestGpuResourceBudgetItem>(
+      "medium", 100u, GpuResourceBudgetItem::Priority::kMedium, &trimmed);
+  budget.AddItem(high);
+  budget.AddItem(low);
+  budget.AddItem(medium);
+
+  EXPECT_EQ(budget.TrimToFit(300u), 300u);
+  EXPECT_TRUE(trimmed.empty());
+
+  EXPECT_EQ(budget.TrimToFit(150u), 100u);
+  EXPECT_EQ(trimmed, std::vector<std::string>({"low", "medium"}));
+
+  trimmed.clear();
+  budget.TrimAll();
+  EXPECT_EQ(trimmed, std::vector<std::string>({"low", "medium", "high"}));
+  EXPECT_EQ(budget.GetResourceBytes(), 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -0,0 +1,154 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/idle_task_scheduler.h"
+
+#include <iterator>
+#include <utility>
+
+#include "flutter/fml/make_copyable.h"
+#include "flutter/fml/time/time_point.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+namespace {
+
+fml::TimeDelta Now() {
+  return fml::TimePoint::Now().ToEpochDelta();
+}
+
+}  // namespace
+
+IdleTaskScheduler::IdleTaskScheduler() = default;
+
+IdleTaskScheduler::~IdleTaskScheduler() = default;
+
+void IdleTaskScheduler::PostIdleTask(
+    const char* name,
+    const fml::RefPtr<fml::TaskRunner>& task_runner,
+    const fml::closure& task,
+    fml::TimeDelta estimated_duration,
+    fml::TimeDelta max_delay) {
+  uint64_t id;
+  {
+    std::scoped_lock lock(mutex_);
+    id = next_id_++;
+    tasks_.push_back({
+        .id = id,
+        .name = name,
+        .task_runner = task_runner,
+        .task = task,
+        .estimated_duration = estimated_duration,
+    });
+  }
+  task_runner->PostDelayedTask(
+      [weak = weak_from_this(), id]() {
+        if (auto self = weak.lock()) {
+          self->RunOverdueTask(id);
+        }
+      },
+      max_delay);
+}
+
+void IdleTaskScheduler::OnIdle(fml::TimeDelta deadline) {
+  fml::TimeDelta available = deadline - Now();
+  if (available <= fml::TimeDelta::Zero()) {
+    return;
+  }
+
+  struct Batch {
+    fml::RefPtr<fml::TaskRunner> task_runner;
+    std::vector<Task> tasks;
+    fml::TimeDelta estimated_duration;
+  };
+  std::vector<Batch> batches;
+  {
+    std::scoped_lock lock(mutex_);
+    for (auto it = tasks_.begin(); it != tasks_.end();) {
+      auto batch = batches.begin();
+      while (batch != batches.end() && batch->task_runner != it->task_runner) {
+        ++batch;
+      }
+      if (batch == batches.end()) {
+        batches.push_back({.task_runner = it->task_runner});
+        batch = std::prev(batches.end());
+      }
+      if (batch->estimated_duration + it->estimated_duration > available) {
+        ++it;
+        continue;
+      }
+      batch->estimated_duration = batch->estimated_duration +
+                                  it->estimated_duration;
+      batch->tasks.push_back(std::move(*it));
+      it = tasks_.erase(it);
+    }
+  }
+
+  for (Batch& batch : batches) {
+    if (batch.tasks.empty()) {
+      continue;
+    }
+    if (batch.task_runner->RunsTasksOnCurrentThread()) {
+      RunTasks(std::move(batch.tasks), deadline);
+      continue;
+    }
+    batch.task_runner->PostTask(fml::MakeCopyable(
+        [weak = weak_from_this(), tasks = std::move(batch.tasks),
+         deadline]() mutable {
+          if (auto self = weak.lock()) {
+            self->RunTasks(std::move(tasks), deadline);
+          }
+        }));
+  }
+}
+
+size_t IdleTaskScheduler::GetPendingTaskCount() const {
+  std::scoped_lock lock(mutex_);
+  return tasks_.size();
+}
+
+void IdleTaskScheduler::RunTasks(std::vector<Task> tasks,
+                                 fml::TimeDelta deadline) {
+  auto task = tasks.begin();
+  for (; task != tasks.end(); ++task) {
+    if (Now() + task->estimated_duration > deadline) {
+      break;
+    }
+    RunTask(*task, "idle");
+  }
+  if (task == tasks.end()) {
+    return;
+  }
+  // The idle period ended early, for example because another task ran
+  // longer than expected. Wait for the next one.
+  std::scoped_lock lock(mutex_);
+  tasks_.insert(tasks_.begin(), std::make_move_iterator(task),
+                std::make_move_iterator(tasks.end()));
+}
+
+void IdleTaskScheduler::RunOverdueTask(uint64_t id) {
+  Task task;
+  {
+    std::scoped_lock lock(mutex_);
+    auto it = tasks_.begin();
+    while (it != tasks_.end() && it->id != id) {
+      ++it;
+    }
+    if (it == tasks_.end()) {
+      return;
+    }
+    task = std::move(*it);
+    tasks_.erase(it);
+  }
+  RunTask(task, "overdue");
+}
+
+void IdleTaskScheduler::RunTask(const Task& task, const char* reason) {
+  TRACE_EVENT2("flutter", "IdleTaskScheduler::RunTask", "name", task.name,
+               "reason", reason);
+  task.task();
+}
+
+}  // namespace flutter
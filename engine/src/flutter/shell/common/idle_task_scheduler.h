@@ -0,0 +1,99 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_IDLE_TASK_SCHEDULER_H_
+#define FLUTTER_SHELL_COMMON_IDLE_TASK_SCHEDULER_H_
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "flutter/fml/closure.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/task_runner.h"
+#include "flutter/fml/time/time_delta.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// Runs deferrable work, such as cache trimming, when the animator reports
+/// that a frame has been produced and there is time left before the next
+/// one.
+///
+/// Each task runs on its own task runner and only if its estimated duration
+/// fits in the time left before the idle deadline, so that it does not delay
+/// the next frame. Tasks on different task runners share the idle period, as
+/// they run in parallel. A task that has not found the time to run after its
+/// maximum delay runs anyway, so that work is not postponed forever by
+/// continuous animations.
+///
+/// Idle deadlines are in the time base of `fml::TimePoint::Now()`, like the
+/// deadlines passed to `Animator::Delegate::OnAnimatorNotifyIdle`.
+///
+/// The scheduler must be owned by a `std::shared_ptr`. All methods are
+/// thread-safe.
+///
+class IdleTaskScheduler
+    : public std::enable_shared_from_this<IdleTaskScheduler> {
+ public:
+  IdleTaskScheduler();
+
+  ~IdleTaskScheduler();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Schedules |task| to run on |task_runner| in idle time.
+  ///
+  /// @param[in]  name                A static string that identifies the task
+  ///                                 in traces.
+  /// @param[in]  task_runner         The task runner to run the task on.
+  /// @param[in]  task                The work to do.
+  /// @param[in]  estimated_duration  How long the task is expected to take.
+  /// @param[in]  max_delay           How long the task may wait for idle time
+  ///                                 before it runs regardless.
+  ///
+  void PostIdleTask(const char* name,
+                    const fml::RefPtr<fml::TaskRunner>& task_runner,
+                    const fml::closure& task,
+                    fml::TimeDelta estimated_duration,
+                    fml::TimeDelta max_delay);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Runs the pending tasks that fit before |deadline|, oldest
+  ///             first. Tasks for other task runners are posted to them.
+  ///
+  void OnIdle(fml::TimeDelta deadline);
+
+  /// The number of tasks that have not run yet.
+  size_t GetPendingTaskCount() const;
+
+ private:
+  struct Task {
+    uint64_t id;
+    const char* name;
+    fml::RefPtr<fml::TaskRunner> task_runner;
+    fml::closure task;
+    fml::TimeDelta estimated_duration;
+  };
+
+  // Runs |tasks| in order, on the current thread, until the next one no
+  // longer fits before |deadline|. The remaining tasks are scheduled again.
+  void RunTasks(std::vector<Task> tasks, fml::TimeDelta deadline);
+
+  // Runs the task |id| if it has not run yet.
+  void RunOverdueTask(uint64_t id);
+
+  static void RunTask(const Task& task, const char* reason);
+
+  mutable std::mutex mutex_;
+  std::list<Task> tasks_;
+  uint64_t next_id_ = 1;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(IdleTaskScheduler);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_IDLE_TASK_SCHEDULER_H_
@@ -0,0 +1,102 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/idle_task_scheduler.h"
+
+#include <memory>
+
+#include "flutter/fml/message_loop.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/thread.h"
+#include "flutter/fml/time/time_point.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+fml::TimeDelta DeadlineIn(fml::TimeDelta delay) {
+  return fml::TimePoint::Now().ToEpochDelta() + delay;
+}
+
+}  // namespace
+
+TEST(IdleTaskSchedulerTest, RunsTasksThatFitBeforeTheDeadline) {
+  fml::MessageLoop::EnsureInitializedForCurrentThread();
+  auto task_runner = fml::MessageLoop::GetCurrent().GetTaskRunner();
+  auto scheduler = std::make_shared<IdleTaskScheduler>();
+
+  int run_count = 0;
+  scheduler->PostIdleTask(
+      "Test", task_runner, [&run_count]() { run_count++; },
+      /*estimated_duration=*/fml::TimeDelta::FromMilliseconds(1),
+      /*max_delay=*/fml::TimeDelta::FromSeconds(60));
+  EXPECT_EQ(scheduler->GetPendingTaskCount(), 1u);
+  EXPECT_EQ(run_count, 0);
+
+  scheduler->OnIdle(DeadlineIn(fml::TimeDelta::FromSeconds(10)));
+  EXPECT_EQ(run_count, 1);
+  EXPECT_EQ(scheduler->GetPendingTaskCount(), 0u);
+}
+
+TEST(IdleTaskSchedulerTest, KeepsTasksThatDoNotFitBeforeTheDeadline) {
+  fml::MessageLoop::EnsureInitializedForCurrentThread();
+  auto task_runner = fml::MessageLoop::GetCurrent().GetTaskRunner();
+  auto scheduler = std::make_shared<IdleTaskScheduler>();
+
+  int run_count = 0;
+  scheduler->PostIdleTask(
+      "Test", task_runner, [&run_count]() { run_count++; },
+      /*estimated_duration=*/fml::TimeDelta::FromSeconds(10),
+      /*max_delay=*/fml::TimeDelta::FromSeconds(60));
+
+  scheduler->OnIdle(DeadlineIn(fml::TimeDelta::FromMilliseconds(1)));
+  EXPECT_EQ(run_count, 0);
+  EXPECT_EQ(scheduler->GetPendingTaskCount(), 1u);
+
+  // A deadline that has already passed runs nothing.
+  scheduler->OnIdle(DeadlineIn(fml::TimeDelta::FromSeconds(-1)));
+  EXPECT_EQ(run_count, 0);
+  EXPECT_EQ(scheduler->GetPendingTaskCount(), 1u);
+}
+
+TEST(IdleTaskSchedulerTest, RunsTasksOnTheirTaskRunner) {
+  fml::Thread thread("IdleTaskSchedulerTest");
+  auto task_runner = thread.GetTaskRunner();
+  auto scheduler = std::make_shared<IdleTaskScheduler>();
+
+  fml::AutoResetWaitableEvent latch;
+  bool ran_on_task_runner = false;
+  scheduler->PostIdleTask(
+      "Test", task_runner,
+      [&]() {
+        ran_on_task_runner = task_runner->RunsTasksOnCurrentThread();
+        latch.Signal();
+      },
+      /*estimated_duration=*/fml::TimeDelta::FromMilliseconds(1),
+      /*max_delay=*/fml::TimeDelta::FromSeconds(60));
+
+  scheduler->OnIdle(DeadlineIn(fml::TimeDelta::FromSeconds(10)));
+  latch.Wait();
+  EXPECT_TRUE(ran_on_task_runner);
+  EXPECT_EQ(scheduler->GetPendingTaskCount(), 0u);
+}
+
+TEST(IdleTaskSchedulerTest, RunsOverdueTasksWithoutIdleTime) {
+  fml::Thread thread("IdleTaskSchedulerTest");
+  auto scheduler = std::make_shared<IdleTaskScheduler>();
+
+  fml::AutoResetWaitableEvent latch;
+  scheduler->PostIdleTask(
+      "Test", thread.GetTaskRunner(), [&latch]() { latch.Signal(); },
+      /*estimated_duration=*/fml::TimeDelta::FromSeconds(10),
+      /*max_delay=*/fml::TimeDelta::FromMilliseconds(1));
+
+  latch.Wait();
+  EXPECT_EQ(scheduler->GetPendingTaskCount(), 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -5,6 +5,7 @@
 #include "flutter/common/graphics/persistent_cache.h"
 
 #include <memory>
+#include <vector>
 
 #include "flutter/assets/directory_asset_bundle.h"
 #include "flutter/flow/layers/container_layer.h"
@@ -199,5 +200,52 @@ TEST_F(PersistentCacheTest, PurgeAllowsFutureSkSLCache) {
   DestroyShell(std::move(shell));
 }
 
+TEST_F(PersistentCacheTest, EvictsLeastRecentlyUsedShaders) {
+  fml::ScopedTemporaryDirectory base_dir;
+  ASSERT_TRUE(base_dir.fd().is_valid());
+  PersistentCache::SetCacheDirectoryPath(base_dir.path());
+  PersistentCache::ResetCacheForProcess();
+
+  std::vector<sk_sp<SkData>> keys = {SkData::MakeWithCString("key_a"),
+                                     SkData::MakeWithCString("key_b"),
+                                     SkData::MakeWithCString("key_c")};
+  sk_sp<SkData> shader_value = SkData::MakeWithCString("value");
+
+  auto settings = CreateSettingsForFixture();
+  // Room for two of the shaders.
+  settings.persistent_cache_max_bytes =
+      2 * (sizeof(PersistentCache::CacheObjectHeader) + keys[0]->size() +
+           shader_value->size());
+  auto config = RunConfiguration::InferFromSettings(settings);
+  std::unique_ptr<Shell> shell = CreateShell(settings);
+  RunEngine(shell.get(), std::move(config));
+  auto persistent_cache = PersistentCache::GetCacheForProcess();
+
+  auto flush_io = [&shell]() {
+    std::promise<bool> io_flushed;
+    shell->GetTaskRunners().GetIOTaskRunner()->PostTask(
+        [&io_flushed]() { io_flushed.set_value(true); });
+    io_flushed.get_future().get();
+  };
+
+  StorePersistentCache(persistent_cache, *keys[0], *shader_value);
+  StorePersistentCache(persistent_cache, *keys[1], *shader_value);
+  flush_io();
+
+  // Using the first shader makes the second one the least recently used.
+  ASSERT_NE(persistent_cache->load(*keys[0]), nullptr);
+  StorePersistentCache(persistent_cache, *keys[2], *shader_value);
+  flush_io();
+
+  EXPECT_NE(persistent_cache->load(*keys[0]), nullptr);
+  EXPECT_EQ(persistent_cache->load(*keys[1]), nullptr);
+  EXPECT_NE(persistent_cache->load(*keys[2]), nullptr);
+
+  // Cleanup
+  PersistentCache::SetCacheSizeLimit(0);
+  fml::RemoveFilesInDirectory(base_dir.fd());
+  DestroyShell(std::move(shell));
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -5,6 +5,8 @@
 #ifndef FLUTTER_SHELL_COMMON_PIPELINE_H_
 #define FLUTTER_SHELL_COMMON_PIPELINE_H_
 
+#include <algorithm>
+#include <atomic>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -39,6 +41,11 @@ size_t GetNextPipelineTraceID();
 /// A thread-safe queue of resources for a single consumer and a single
 /// producer, with a maximum queue depth.
 ///
+/// The depth may be changed at runtime with |SetDepth|, up to the capacity the
+/// pipeline was created with. Lowering the depth does not drop resources that
+/// are already in flight, it only stops new ones from being produced until
+/// enough of them have been consumed.
+///
 /// Pipelines support two key operations: produce and consume.
 ///
 /// The consumer calls |Consume| to wait for a resource to be produced and
@@ -128,20 +135,41 @@ class Pipeline {
     FML_DISALLOW_COPY_AND_ASSIGN(ProducerContinuation);
   };
 
-  explicit Pipeline(uint32_t depth)
-      : empty_(depth), available_(0), inflight_(0) {}
+  explicit Pipeline(uint32_t depth) : Pipeline(depth, depth) {}
+
+  /// Creates a pipeline with an initial maximum depth of |depth| that may be
+  /// raised up to |capacity| with |SetDepth|.
+  Pipeline(uint32_t capacity, uint32_t depth)
+      : capacity_(capacity),
+        depth_(std::min(depth, capacity)),
+        empty_(capacity),
+        available_(0),
+        inflight_(0) {}
 
   ~Pipeline() = default;
 
   bool IsValid() const { return empty_.IsValid() && available_.IsValid(); }
 
+  uint32_t GetCapacity() const { return capacity_; }
+
+  uint32_t GetDepth() const { return depth_.load(); }
+
+  /// Sets the maximum number of resources in flight, clamped to at least one
+  /// and at most the capacity of the pipeline.
+  void SetDepth(uint32_t depth) {
+    depth_ = std::clamp(depth, std::min(1u, capacity_), capacity_);
+    FML_TRACE_COUNTER("flutter", "Pipeline Max Depth",
+                      reinterpret_cast<int64_t>(this),  //
+                      "max frames in flight", depth_.load());
+  }
+
   /// Creates a `ProducerContinuation` that a producer can use to add a
   /// resource to the queue.
   ///
   /// If the queue is already at its maximum depth, the `ProducerContinuation`
   /// is returned with success = false.
   ProducerContinuation Produce() {
-    if (!empty_.TryWait()) {
+    if (IsAtDepth() || !empty_.TryWait()) {
       return {};
     }
     ++inflight_;
@@ -162,7 +190,7 @@ class Pipeline {
   /// Prefer using |Produce|. ProducerContinuation returned by this method
   /// doesn't guarantee that the frame will be rendered.
   ProducerContinuation ProduceIfEmpty() {
-    if (!empty_.TryWait()) {
+    if (IsAtDepth() || !empty_.TryWait()) {
       return {};
     }
     ++inflight_;
@@ -213,12 +241,18 @@ class Pipeline {
   }
 
  private:
+  const uint32_t capacity_;
+  std::atomic<uint32_t> depth_;
   fml::Semaphore empty_;
   fml::Semaphore available_;
   std::atomic<int> inflight_;
   std::mutex queue_mutex_;
   std::deque<std::pair<ResourcePtr, size_t>> queue_;
 
+  bool IsAtDepth() const {
+    return inflight_.load() >= static_cast<int>(depth_.load());
+  }
+
   /// Commits a produced resource to the queue and signals the consumer that a
   /// resource is available.
   PipelineProduceResult ProducerCommit(ResourcePtr resource, size_t trace_id) {
@@ -242,6 +276,7 @@ class Pipeline {
         // Bail if the queue is not empty, opens up spaces to produce other
         // frames.
         empty_.Signal();
+        --inflight_;
         return {.success = false, .is_first_item = false};
       }
       queue_.emplace_back(std::move(resource), trace_id);
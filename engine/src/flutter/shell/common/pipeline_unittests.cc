@@ -107,6 +107,59 @@ TEST(PipelineTest, PushingMultiProcessesInOrder) {
   ASSERT_EQ(consume_result_2, PipelineConsumeResult::Done);
 }
 
+TEST(PipelineTest, SetDepthLimitsResourcesInFlight) {
+  std::shared_ptr<IntPipeline> pipeline =
+      std::make_shared<IntPipeline>(/*capacity=*/3, /*depth=*/1);
+  ASSERT_EQ(pipeline->GetCapacity(), 3u);
+  ASSERT_EQ(pipeline->GetDepth(), 1u);
+
+  Continuation continuation_1 = pipeline->Produce();
+  ASSERT_TRUE(continuation_1);
+  ASSERT_FALSE(pipeline->Produce());
+
+  pipeline->SetDepth(3);
+  Continuation continuation_2 = pipeline->Produce();
+  Continuation continuation_3 = pipeline->Produce();
+  ASSERT_TRUE(continuation_2);
+  ASSERT_TRUE(continuation_3);
+  ASSERT_FALSE(pipeline->Produce());
+
+  ASSERT_TRUE(continuation_1.Complete(std::make_unique<int>(1)).success);
+  ASSERT_TRUE(continuation_2.Complete(std::make_unique<int>(2)).success);
+  ASSERT_TRUE(continuation_3.Complete(std::make_unique<int>(3)).success);
+
+  // Lowering the depth keeps the resources in flight but stops producing new
+  // ones until they are consumed.
+  pipeline->SetDepth(1);
+  ASSERT_FALSE(pipeline->Produce());
+  int expected = 1;
+  for (int i = 0; i < 3; i++) {
+    PipelineConsumeResult consume_result =
+        pipeline->Consume([&expected](std::unique_ptr<int> v) {
+          ASSERT_EQ(*v, expected);
+          expected++;
+        });
+    ASSERT_NE(consume_result, PipelineConsumeResult::NoneAvailable);
+  }
+  ASSERT_TRUE(pipeline->Produce());
+
+  pipeline->SetDepth(5);
+  ASSERT_EQ(pipeline->GetDepth(), 3u);
+  pipeline->SetDepth(0);
+  ASSERT_EQ(pipeline->GetDepth(), 1u);
+}
+
+TEST(PipelineTest, FailedProduceIfEmptyReleasesDepth) {
+  std::shared_ptr<IntPipeline> pipeline = std::make_shared<IntPipeline>(2);
+
+  Continuation continuation_1 = pipeline->Produce();
+  Continuation continuation_2 = pipeline->ProduceIfEmpty();
+  ASSERT_TRUE(continuation_1.Complete(std::make_unique<int>(1)).success);
+  ASSERT_FALSE(continuation_2.Complete(std::make_unique<int>(2)).success);
+
+  ASSERT_TRUE(pipeline->Produce());
+}
+
 TEST(PipelineTest, ProduceIfEmptyDoesNotConsumeWhenQueueIsNotEmpty) {
   const int depth = 2;
   std::shared_ptr<IntPipeline> pipeline = std::make_shared<IntPipeline>(depth);
@@ -0,0 +1,193 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/platform_message_port_router.h"
+
+#include <array>
+#include <cstdlib>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+#include "flutter/lib/ui/window/platform_message_response.h"
+
+namespace flutter {
+
+namespace {
+
+// The routers by their reply port, as the native message handler of a port
+// has no other way of getting to its router.
+std::mutex g_routers_mutex;
+std::unordered_map<Dart_Port, std::weak_ptr<PlatformMessagePortRouter>>
+    g_routers;
+
+void FreeFinalizer(void* isolate_callback_data, void* peer) {
+  free(peer);
+}
+
+}  // namespace
+
+PlatformMessagePortRouter::PlatformMessagePortRouter() = default;
+
+PlatformMessagePortRouter::~PlatformMessagePortRouter() {
+  if (reply_port_ != ILLEGAL_PORT) {
+    {
+      std::scoped_lock lock(g_routers_mutex);
+      g_routers.erase(reply_port_);
+    }
+    Dart_CloseNativePort(reply_port_);
+  }
+  for (auto& [response_id, response] : pending_responses_) {
+    response->CompleteEmpty();
+  }
+}
+
+void PlatformMessagePortRouter::SetPort(const std::string& channel,
+                                        Dart_Port port) {
+  std::scoped_lock lock(mutex_);
+  if (port == ILLEGAL_PORT) {
+    ports_.erase(channel);
+    return;
+  }
+  if (reply_port_ == ILLEGAL_PORT) {
+    reply_port_ = Dart_NewNativePort("flutter.platform_message_replies",
+                                     &PlatformMessagePortRouter::HandleReply,
+                                     /*handle_concurrently=*/false);
+    if (reply_port_ == ILLEGAL_PORT) {
+      FML_LOG(ERROR) << "Could not create the reply port for channel "
+                     << channel;
+      return;
+    }
+    std::scoped_lock routers_lock(g_routers_mutex);
+    g_routers[reply_port_] = weak_from_this();
+  }
+  ports_[channel] = port;
+}
+
+Dart_Port PlatformMessagePortRouter::GetReplyPort() const {
+  std::scoped_lock lock(mutex_);
+  return reply_port_;
+}
+
+bool PlatformMessagePortRouter::Route(
+    std::unique_ptr<PlatformMessage>& message) {
+  std::scoped_lock lock(mutex_);
+  auto port = ports_.find(message->channel());
+  if (port == ports_.end()) {
+    return false;
+  }
+  TRACE_EVENT1("flutter", "PlatformMessagePortRouter::Route", "channel",
+               message->channel().c_str());
+
+  int64_t response_id = 0;
+  if (message->response()) {
+    response_id = next_response_id_++;
+  }
+
+  Dart_CObject channel = {.type = Dart_CObject_kString};
+  channel.value.as_string = message->channel().c_str();
+
+  size_t size = message->data().GetSize();
+  uint8_t* data = nullptr;
+  Dart_CObject payload = {.type = Dart_CObject_kNull};
+  if (message->hasData()) {
+    fml::MallocMapping mapping = message->releaseData();
+    data = mapping.Release();
+    payload.type = Dart_CObject_kExternalTypedData;
+    payload.value.as_external_typed_data.type = Dart_TypedData_kUint8;
+    payload.value.as_external_typed_data.length = size;
+    payload.value.as_external_typed_data.data = data;
+    payload.value.as_external_typed_data.peer = data;
+    payload.value.as_external_typed_data.callback = FreeFinalizer;
+  }
+
+  Dart_CObject identifier = {.type = Dart_CObject_kInt64};
+  identifier.value.as_int64 = response_id;
+
+  Dart_CObject reply_port = {.type = Dart_CObject_kSendPort};
+  reply_port.value.as_send_port.id = reply_port_;
+  reply_port.value.as_send_port.origin_id = ILLEGAL_PORT;
+
+  std::array<Dart_CObject*, 4> values = {&channel, &payload, &identifier,
+                                         &reply_port};
+  Dart_CObject routed_message = {.type = Dart_CObject_kArray};
+  routed_message.value.as_array.length = values.size();
+  routed_message.value.as_array.values = values.data();
+
+  if (!Dart_PostCObject(port->second, &routed_message)) {
+    // The port has been closed, the payload is still owned by the message.
+    ports_.erase(port);
+    if (data) {
+      message = std::make_unique<PlatformMessage>(
+          message->channel(), fml::MallocMapping(data, size),
+          message->response());
+    }
+    return false;
+  }
+  if (response_id != 0) {
+    pending_responses_[response_id] = message->response();
+  }
+  message.reset();
+  return true;
+}
+
+void PlatformMessagePortRouter::Respond(int64_t response_id,
+                                        std::unique_ptr<fml::Mapping> data) {
+  fml::RefPtr<PlatformMessageResponse> response;
+  {
+    std::scoped_lock lock(mutex_);
+    auto it = pending_responses_.find(response_id);
+    if (it == pending_responses_.end()) {
+      return;
+    }
+    response = std::move(it->second);
+    pending_responses_.erase(it);
+  }
+  if (data) {
+    response->Complete(std::move(data));
+  } else {
+    response->CompleteEmpty();
+  }
+}
+
+void PlatformMessagePortRouter::HandleReply(Dart_Port reply_port,
+                                            Dart_CObject* message) {
+  std::shared_ptr<PlatformMessagePortRouter> router;
+  {
+    std::scoped_lock lock(g_routers_mutex);
+    auto it = g_routers.find(reply_port);
+    if (it != g_routers.end()) {
+      router = it->second.lock();
+    }
+  }
+  if (!router) {
+    return;
+  }
+  if (message->type != Dart_CObject_kArray ||
+      message->value.as_array.length != 2) {
+    FML_LOG(ERROR) << "Platform message replies must be [responseId, data].";
+    return;
+  }
+  const Dart_CObject* identifier = message->value.as_array.values[0];
+  const Dart_CObject* data = message->value.as_array.values[1];
+  int64_t response_id;
+  if (identifier->type == Dart_CObject_kInt32) {
+    response_id = identifier->value.as_int32;
+  } else if (identifier->type == Dart_CObject_kInt64) {
+    response_id = identifier->value.as_int64;
+  } else {
+    FML_LOG(ERROR) << "Platform message replies must start with an int.";
+    return;
+  }
+  if (data->type == Dart_CObject_kTypedData) {
+    // The data of the reply is only valid for the duration of this call.
+    router->Respond(response_id, std::make_unique<fml::MallocMapping>(
+                                     fml::MallocMapping::Copy(
+                                         data->value.as_typed_data.values,
+                                         data->value.as_typed_data.length)));
+  } else {
+    router->Respond(response_id, nullptr);
+  }
+}
+
+}  // namespace flutter
@@ -0,0 +1,75 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_PLATFORM_MESSAGE_PORT_ROUTER_H_
+#define FLUTTER_SHELL_COMMON_PLATFORM_MESSAGE_PORT_ROUTER_H_
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/lib/ui/window/platform_message.h"
+#include "third_party/dart/runtime/include/dart_native_api.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// Delivers the platform messages of selected channels straight to a Dart
+/// port, bypassing the UI thread.
+///
+/// A channel is routed with `PlatformDispatcher.setPortPlatformMessageHandler`,
+/// typically to the port of a background isolate. Every message on the
+/// channel is then posted from the platform thread as the list
+/// `[String channel, Uint8List? data, int responseId, SendPort replyPort]`.
+/// The payload is handed to Dart as external typed data without being
+/// copied. The isolate answers by sending `[int responseId, Uint8List? data]`
+/// to the reply port, which completes the response of the message on the
+/// thread the VM handles the native reply port on.
+///
+/// All methods are thread-safe.
+///
+class PlatformMessagePortRouter
+    : public std::enable_shared_from_this<PlatformMessagePortRouter> {
+ public:
+  PlatformMessagePortRouter();
+
+  /// Completes the responses of the messages that have not been answered.
+  ~PlatformMessagePortRouter();
+
+  /// Routes the messages on |channel| to |port|, or delivers them to the UI
+  /// isolate again if |port| is `ILLEGAL_PORT`.
+  void SetPort(const std::string& channel, Dart_Port port);
+
+  /// Posts |message| to the port registered for its channel and takes
+  /// ownership of it. Returns false and leaves |message| untouched if the
+  /// channel is not routed or its port has been closed.
+  bool Route(std::unique_ptr<PlatformMessage>& message);
+
+  /// Completes the response of the routed message |response_id| with |data|,
+  /// or with an empty response if |data| is null.
+  void Respond(int64_t response_id, std::unique_ptr<fml::Mapping> data);
+
+  /// The port replies to routed messages are sent to, or `ILLEGAL_PORT`
+  /// before the first channel is routed.
+  Dart_Port GetReplyPort() const;
+
+ private:
+  static void HandleReply(Dart_Port reply_port, Dart_CObject* message);
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, Dart_Port> ports_;
+  std::unordered_map<int64_t, fml::RefPtr<PlatformMessageResponse>>
+      pending_responses_;
+  int64_t next_response_id_ = 1;
+  Dart_Port reply_port_ = ILLEGAL_PORT;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(PlatformMessagePortRouter);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_PLATFORM_MESSAGE_PORT_ROUTER_H_
@@ -0,0 +1,137 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/platform_message_port_router.h"
+
+#include <array>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/lib/ui/window/platform_message_response.h"
+#include "flutter/runtime/dart_vm.h"
+#include "flutter/shell/common/shell_test.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+class TestResponse : public PlatformMessageResponse {
+ public:
+  void Complete(std::unique_ptr<fml::Mapping> data) override {
+    data_.assign(data->GetMapping(), data->GetMapping() + data->GetSize());
+    is_complete_ = true;
+    latch_.Signal();
+  }
+
+  void CompleteEmpty() override {
+    is_complete_ = true;
+    latch_.Signal();
+  }
+
+  const std::vector<uint8_t>& data() const { return data_; }
+
+  void Wait() { latch_.Wait(); }
+
+ private:
+  std::vector<uint8_t> data_;
+  fml::AutoResetWaitableEvent latch_;
+};
+
+struct RoutedMessage {
+  std::string channel;
+  std::vector<uint8_t> data;
+  int64_t response_id = 0;
+  Dart_Port reply_port = ILLEGAL_PORT;
+};
+
+RoutedMessage g_routed_message;
+fml::AutoResetWaitableEvent g_routed_latch;
+
+void HandleRoutedMessage(Dart_Port port, Dart_CObject* message) {
+  ASSERT_EQ(message->type, Dart_CObject_kArray);
+  ASSERT_EQ(message->value.as_array.length, 4);
+  Dart_CObject** values = message->value.as_array.values;
+  g_routed_message.channel = values[0]->value.as_string;
+  if (values[1]->type == Dart_CObject_kExternalTypedData) {
+    const uint8_t* data = values[1]->value.as_external_typed_data.data;
+    g_routed_message.data.assign(
+        data, data + values[1]->value.as_external_typed_data.length);
+  } else if (values[1]->type == Dart_CObject_kTypedData) {
+    const uint8_t* data = values[1]->value.as_typed_data.values;
+    g_routed_message.data.assign(
+        data, data + values[1]->value.as_typed_data.length);
+  }
+  g_routed_message.response_id = values[2]->value.as_int64;
+  g_routed_message.reply_port = values[3]->value.as_send_port.id;
+  g_routed_latch.Signal();
+}
+
+}  // namespace
+
+TEST_F(ShellTest, PlatformMessagePortRouterRoutesToPort) {
+  auto vm_ref = DartVMRef::Create(CreateSettingsForFixture());
+  ASSERT_TRUE(vm_ref);
+
+  auto router = std::make_shared<PlatformMessagePortRouter>();
+  auto response = fml::MakeRefCounted<TestResponse>();
+  auto message = std::make_unique<PlatformMessage>(
+      "camera", fml::MallocMapping::Copy("frame", 5), response);
+
+  // Channels that are not routed are left for the UI isolate.
+  EXPECT_FALSE(router->Route(message));
+  ASSERT_NE(message, nullptr);
+
+  Dart_Port port = Dart_NewNativePort("test", &HandleRoutedMessage,
+                                      /*handle_concurrently=*/false);
+  ASSERT_NE(port, ILLEGAL_PORT);
+  router->SetPort("camera", port);
+  ASSERT_NE(router->GetReplyPort(), ILLEGAL_PORT);
+
+  EXPECT_TRUE(router->Route(message));
+  EXPECT_EQ(message, nullptr);
+  g_routed_latch.Wait();
+  EXPECT_EQ(g_routed_message.channel, "camera");
+  EXPECT_EQ(std::string(g_routed_message.data.begin(),
+                        g_routed_message.data.end()),
+            "frame");
+  EXPECT_NE(g_routed_message.response_id, 0);
+  EXPECT_EQ(g_routed_message.reply_port, router->GetReplyPort());
+
+  // Reply the way a background isolate would.
+  std::array<uint8_t, 2> reply_data = {4, 2};
+  Dart_CObject identifier = {.type = Dart_CObject_kInt64};
+  identifier.value.as_int64 = g_routed_message.response_id;
+  Dart_CObject data = {.type = Dart_CObject_kTypedData};
+  data.value.as_typed_data.type = Dart_TypedData_kUint8;
+  data.value.as_typed_data.length = reply_data.size();
+  data.value.as_typed_data.values = reply_data.data();
+  std::array<Dart_CObject*, 2> values = {&identifier, &data};
+  Dart_CObject reply = {.type = Dart_CObject_kArray};
+  reply.value.as_array.length = values.size();
+  reply.value.as_array.values = values.data();
+  ASSERT_TRUE(Dart_PostCObject(g_routed_message.reply_port, &reply));
+  response->Wait();
+  EXPECT_EQ(response->data(), std::vector<uint8_t>({4, 2}));
+
+  // Unrouted channels are delivered to the UI isolate again.
+  router->SetPort("camera", ILLEGAL_PORT);
+  message = std::make_unique<PlatformMessage>(
+      "camera", fml::MallocMapping::Copy("frame", 5), nullptr);
+  EXPECT_FALSE(router->Route(message));
+
+  // Messages to closed ports are delivered to the UI isolate with their data.
+  router->SetPort("camera", port);
+  Dart_CloseNativePort(port);
+  EXPECT_FALSE(router->Route(message));
+  ASSERT_NE(message, nullptr);
+  EXPECT_EQ(message->data().GetSize(), 5u);
+  EXPECT_EQ(memcmp(message->data().GetMapping(), "frame", 5), 0);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -4,6 +4,9 @@
 
 #include "flutter/shell/common/pointer_data_dispatcher.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "flutter/fml/trace_event.h"
 
 namespace flutter {
@@ -15,6 +18,11 @@ SmoothPointerDataDispatcher::SmoothPointerDataDispatcher(Delegate& delegate)
     : DefaultPointerDataDispatcher(delegate), weak_factory_(this) {}
 SmoothPointerDataDispatcher::~SmoothPointerDataDispatcher() = default;
 
+ResamplingPointerDataDispatcher::ResamplingPointerDataDispatcher(
+    Delegate& delegate)
+    : DefaultPointerDataDispatcher(delegate), weak_factory_(this) {}
+ResamplingPointerDataDispatcher::~ResamplingPointerDataDispatcher() = default;
+
 void DefaultPointerDataDispatcher::DispatchPacket(
     std::unique_ptr<PointerDataPacket> packet,
     uint64_t trace_flow_id) {
@@ -72,4 +80,80 @@ void SmoothPointerDataDispatcher::DispatchPendingPacket() {
   ScheduleSecondaryVsyncCallback();
 }
 
+void ResamplingPointerDataDispatcher::DispatchPacket(
+    std::unique_ptr<PointerDataPacket> packet,
+    uint64_t trace_flow_id) {
+  TRACE_EVENT0_WITH_FLOW_IDS("flutter",
+                             "ResamplingPointerDataDispatcher::DispatchPacket",
+                             /*flow_id_count=*/1, &trace_flow_id);
+  TRACE_FLOW_STEP("flutter", "PointerEvent", trace_flow_id);
+
+  resampler_.AddPacket(*packet);
+  pending_trace_flow_ids_.push_back(trace_flow_id);
+  if (!PointerDataResampler::ContainsResamplableData(*packet)) {
+    // Do not delay downs, ups and signals until the next frame.
+    DispatchResampledPacket(std::numeric_limits<int64_t>::max());
+    return;
+  }
+  ScheduleSecondaryVsyncCallback();
+}
+
+void ResamplingPointerDataDispatcher::SetKeepRawHistory(
+    bool keep_raw_history) {
+  resampler_.SetKeepHistory(keep_raw_history);
+}
+
+std::unique_ptr<PointerDataPacket>
+ResamplingPointerDataDispatcher::TakeRawHistory() {
+  return resampler_.TakeHistory();
+}
+
+void ResamplingPointerDataDispatcher::ScheduleSecondaryVsyncCallback() {
+  delegate_.ScheduleSecondaryVsyncCallback(
+      reinterpret_cast<uintptr_t>(this),
+      [dispatcher = weak_factory_.GetWeakPtr()]() {
+        if (!dispatcher || !dispatcher->resampler_.HasPendingData()) {
+          return;
+        }
+        fml::TimePoint vsync_time = fml::TimePoint::Now();
+        fml::TimeDelta latency = kResampleLatency;
+        if (auto vsync = dispatcher->delegate_.GetLastVsyncTimes()) {
+          vsync_time = vsync->frame_start_time;
+          latency = std::min(
+              latency,
+              (vsync->frame_target_time - vsync->frame_start_time) / 2);
+        }
+        dispatcher->DispatchResampledPacket(
+            (vsync_time - latency).ToEpochDelta().ToMicroseconds());
+        if (dispatcher->resampler_.HasPendingData()) {
+          dispatcher->ScheduleSecondaryVsyncCallback();
+        }
+      });
+}
+
+void ResamplingPointerDataDispatcher::DispatchResampledPacket(
+    int64_t sample_time) {
+  std::unique_ptr<PointerDataPacket> packet =
+      resampler_.Resample(sample_time);
+  if (packet->GetLength() == 0) {
+    return;
+  }
+  FML_DCHECK(!pending_trace_flow_ids_.empty());
+  // The flow of the last packet continues with the next frame if some of its
+  // samples were left for that frame.
+  size_t dispatched_count = pending_trace_flow_ids_.size();
+  if (resampler_.HasPendingData()) {
+    dispatched_count--;
+  }
+  uint64_t trace_flow_id = pending_trace_flow_ids_.front();
+  for (size_t i = 1; i < dispatched_count; i++) {
+    TRACE_FLOW_END("flutter", "PointerEvent", pending_trace_flow_ids_[i]);
+  }
+  pending_trace_flow_ids_.erase(
+      pending_trace_flow_ids_.begin(),
+      pending_trace_flow_ids_.begin() + dispatched_count);
+  DefaultPointerDataDispatcher::DispatchPacket(std::move(packet),
+                                               trace_flow_id);
+}
+
 }  // namespace flutter
@@ -5,6 +5,10 @@
 #ifndef FLUTTER_SHELL_COMMON_POINTER_DATA_DISPATCHER_H_
 #define FLUTTER_SHELL_COMMON_POINTER_DATA_DISPATCHER_H_
 
+#include <optional>
+#include <vector>
+
+#include "flutter/lib/ui/window/pointer_data_resampler.h"
 #include "flutter/runtime/runtime_controller.h"
 #include "flutter/shell/common/animator.h"
 
@@ -64,6 +68,14 @@ class PointerDataDispatcher {
     virtual void ScheduleSecondaryVsyncCallback(
         uintptr_t id,
         const fml::closure& callback) = 0;
+
+    //--------------------------------------------------------------------------
+    /// @brief    The start and target time of the last vsync, used by
+    ///           `ResamplingPointerDataDispatcher` to align the resampled
+    ///           events to the frame.
+    virtual std::optional<VsyncWaiter::VsyncTimes> GetLastVsyncTimes() const {
+      return std::nullopt;
+    }
   };
 
   //----------------------------------------------------------------------------
@@ -164,6 +176,52 @@ class SmoothPointerDataDispatcher : public DefaultPointerDataDispatcher {
   FML_DISALLOW_COPY_AND_ASSIGN(SmoothPointerDataDispatcher);
 };
 
+//------------------------------------------------------------------------------
+/// A dispatcher that delivers at most one move or hover per device and frame.
+///
+/// Input devices polled at 240 Hz or more deliver several packets per frame,
+/// all of which would otherwise be decoded and handled on the UI thread. This
+/// dispatcher queues the packets until the next vsync and then dispatches
+/// them as a single packet in which the moves and hovers of each device are
+/// resampled by a `PointerDataResampler` at a short latency before the vsync.
+/// Packets without moves or hovers, such as downs and ups, are dispatched
+/// right away together with everything queued before them.
+///
+/// The raw moves and hovers of the last dispatched packet are available from
+/// |TakeRawHistory| once |SetKeepRawHistory| has been enabled.
+class ResamplingPointerDataDispatcher : public DefaultPointerDataDispatcher {
+ public:
+  /// The time before the vsync the moves are resampled at, so that most
+  /// frames have samples on both sides to interpolate between.
+  static constexpr fml::TimeDelta kResampleLatency =
+      fml::TimeDelta::FromMilliseconds(5);
+
+  explicit ResamplingPointerDataDispatcher(Delegate& delegate);
+
+  // |PointerDataDispatcer|
+  void DispatchPacket(std::unique_ptr<PointerDataPacket> packet,
+                      uint64_t trace_flow_id) override;
+
+  virtual ~ResamplingPointerDataDispatcher();
+
+  void SetKeepRawHistory(bool keep_raw_history);
+
+  std::unique_ptr<PointerDataPacket> TakeRawHistory();
+
+ private:
+  void DispatchResampledPacket(int64_t sample_time);
+  void ScheduleSecondaryVsyncCallback();
+
+  PointerDataResampler resampler_;
+  // The trace flow ids of the queued packets.
+  std::vector<uint64_t> pending_trace_flow_ids_;
+
+  // WeakPtrFactory must be the last member.
+  fml::TaskRunnerAffineWeakPtrFactory<ResamplingPointerDataDispatcher>
+      weak_factory_;
+  FML_DISALLOW_COPY_AND_ASSIGN(ResamplingPointerDataDispatcher);
+};
+
 //--------------------------------------------------------------------------
 /// @brief      Signature for constructing PointerDataDispatcher.
 ///
@@ -15,6 +15,7 @@
 #include "flutter/flow/layers/offscreen_surface.h"
 #include "flutter/fml/time/time_delta.h"
 #include "flutter/fml/time/time_point.h"
+#include "flutter/fml/trace_recorder.h"
 #include "flutter/shell/common/base64.h"
 #include "flutter/shell/common/serialization_callbacks.h"
 #include "fml/closure.h"
@@ -46,11 +47,125 @@
 
 namespace flutter {
 
+namespace {
+
+#if IMPELLER_SUPPORTS_RENDERING
+// The offscreen render targets that were not used by the last frame.
+class RenderTargetCacheBudgetItem : public GpuResourceBudgetItem {
+ public:
+  explicit RenderTargetCacheBudgetItem(
+      const std::shared_ptr<impeller::AiksContext>& aiks_context)
+      : aiks_context_(aiks_context) {}
+
+  size_t GetResourceBytes() override {
+    auto aiks_context = aiks_context_.lock();
+    if (!aiks_context) {
+      return 0u;
+    }
+    return aiks_context->GetContentContext()
+        .GetRenderTargetCache()
+        ->GetCachedBytes();
+  }
+
+  Priority GetTrimPriority() override { return Priority::kLow; }
+
+  void TrimResources() override {
+    if (auto aiks_context = aiks_context_.lock()) {
+      aiks_context->GetContentContext().GetRenderTargetCache()->Trim();
+    }
+  }
+
+ private:
+  std::weak_ptr<impeller::AiksContext> aiks_context_;
+};
+
+// The rendered text shadows, which are expensive to render again.
+class TextShadowCacheBudgetItem : public GpuResourceBudgetItem {
+ public:
+  explicit TextShadowCacheBudgetItem(
+      const std::shared_ptr<impeller::AiksContext>& aiks_context)
+      : aiks_context_(aiks_context) {}
+
+  size_t GetResourceBytes() override {
+    auto aiks_context = aiks_context_.lock();
+    if (!aiks_context) {
+      return 0u;
+    }
+    return aiks_context->GetContentContext()
+        .GetTextShadowCache()
+        .GetStats()
+        .resident_bytes;
+  }
+
+  Priority GetTrimPriority() override { return Priority::kHigh; }
+
+  void TrimResources() override {
+    if (auto aiks_context = aiks_context_.lock()) {
+      aiks_context->GetContentContext().GetTextShadowCache().Clear();
+    }
+  }
+
+ private:
+  std::weak_ptr<impeller::AiksContext> aiks_context_;
+};
+
+class RetainedGeometryCacheBudgetItem : public GpuResourceBudgetItem {
+ public:
+  explicit RetainedGeometryCacheBudgetItem(
+      const std::shared_ptr<impeller::AiksContext>& aiks_context)
+      : aiks_context_(aiks_context) {}
+
+  size_t GetResourceBytes() override {
+    auto aiks_context = aiks_context_.lock();
+    if (!aiks_context) {
+      return 0u;
+    }
+    return aiks_context->GetContentContext()
+        .GetRetainedGeometryCache()
+        .GetRetainedBytes();
+  }
+
+  Priority GetTrimPriority() override { return Priority::kHigh; }
+
+  void TrimResources() override {
+    if (auto aiks_context = aiks_context_.lock()) {
+      aiks_context->GetContentContext().GetRetainedGeometryCache().Clear();
+    }
+  }
+
+ private:
+  std::weak_ptr<impeller::AiksContext> aiks_context_;
+};
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
+// The multisample attachments of the snapshots that are not in use.
+class SnapshotTexturePoolBudgetItem : public GpuResourceBudgetItem {
+ public:
+  explicit SnapshotTexturePoolBudgetItem(ImpellerSnapshotTexturePool* pool)
+      : pool_(pool) {}
+
+  size_t GetResourceBytes() override { return pool_->GetCachedBytes(); }
+
+  Priority GetTrimPriority() override { return Priority::kMedium; }
+
+  void TrimResources() override { pool_->Clear(); }
+
+ private:
+  ImpellerSnapshotTexturePool* pool_;
+};
+
+}  // namespace
+
 // The rasterizer will tell Skia to purge cached resources that have not been
 // used within this interval.
 [[maybe_unused]] static constexpr std::chrono::milliseconds
     kSkiaCleanupExpiration(15000);
 
+// How long the caches may exceed the GPU resource budget while waiting for
+// idle time to be trimmed in.
+static constexpr fml::TimeDelta kGpuResourceTrimMaxDelay =
+    fml::TimeDelta::FromMilliseconds(500);
+
 Rasterizer::Rasterizer(Delegate& delegate,
                        MakeGpuImageBehavior gpu_image_behavior)
     : delegate_(delegate),
@@ -60,6 +175,17 @@ Rasterizer::Rasterizer(Delegate& delegate,
           SnapshotController::Make(*this, delegate.GetSettings())),
       weak_factory_(this) {
   FML_DCHECK(compositor_context_);
+  if (delegate.GetSettings().enable_impeller) {
+    impeller_snapshot_texture_pool_ =
+        std::make_unique<ImpellerSnapshotTexturePool>();
+  } else {
+#if !SLIMPELLER
+    skia_snapshot_surface_pool_ = std::make_unique<SkiaSnapshotSurfacePool>();
+    if (delegate.GetSettings().enable_skia_picture_cache) {
+      skia_picture_cache_ = std::make_unique<DlSkPictureCache>();
+    }
+#endif  //  !SLIMPELLER
+  }
 }
 
 Rasterizer::~Rasterizer() = default;
@@ -78,8 +204,146 @@ void Rasterizer::SetImpellerContext(
   impeller_context_ = std::move(impeller_context);
 }
 
+void Rasterizer::SetGpuResourceBudget(
+    std::shared_ptr<GpuResourceBudget> budget) {
+  gpu_resource_budget_ = std::move(budget);
+  AddGpuResourceBudgetItems();
+}
+
+void Rasterizer::SetIdleTaskScheduler(
+    std::shared_ptr<IdleTaskScheduler> scheduler) {
+  idle_task_scheduler_ = std::move(scheduler);
+}
+
+void Rasterizer::ScheduleGpuResourceTrimIfNeeded() {
+  if (!gpu_resource_budget_ || !max_cache_bytes_.has_value() ||
+      gpu_resource_budget_items_.empty() || gpu_resource_trim_scheduled_) {
+    return;
+  }
+  if (!idle_task_scheduler_) {
+    gpu_resource_budget_->TrimToFit(max_cache_bytes_.value());
+    return;
+  }
+  if (gpu_resource_budget_->GetResourceBytes() <= max_cache_bytes_.value()) {
+    return;
+  }
+  // Releasing the resources may wait for the GPU, keep it off the frame.
+  gpu_resource_trim_scheduled_ = true;
+  idle_task_scheduler_->PostIdleTask(
+      "GpuResourceTrim", delegate_.GetTaskRunners().GetRasterTaskRunner(),
+      [weak = GetWeakPtr()]() {
+        if (!weak) {
+          return;
+        }
+        weak->gpu_resource_trim_scheduled_ = false;
+        if (weak->gpu_resource_budget_ && weak->max_cache_bytes_.has_value()) {
+          weak->gpu_resource_budget_->TrimToFit(weak->max_cache_bytes_.value());
+        }
+      },
+      /*estimated_duration=*/fml::TimeDelta::FromMilliseconds(1),
+      /*max_delay=*/kGpuResourceTrimMaxDelay);
+}
+
+void Rasterizer::AddGpuResourceBudgetItems() {
+  gpu_resource_budget_items_.clear();
+#if IMPELLER_SUPPORTS_RENDERING
+  if (!gpu_resource_budget_ || !surface_) {
+    return;
+  }
+  std::shared_ptr<impeller::AiksContext> aiks_context =
+      surface_->GetAiksContext();
+  if (!aiks_context) {
+    return;
+  }
+  gpu_resource_budget_items_.push_back(
+      std::make_shared<RenderTargetCacheBudgetItem>(aiks_context));
+  gpu_resource_budget_items_.push_back(
+      std::make_shared<TextShadowCacheBudgetItem>(aiks_context));
+  gpu_resource_budget_items_.push_back(
+      std::make_shared<RetainedGeometryCacheBudgetItem>(aiks_context));
+  if (impeller_snapshot_texture_pool_) {
+    gpu_resource_budget_items_.push_back(
+        std::make_shared<SnapshotTexturePoolBudgetItem>(
+            impeller_snapshot_texture_pool_.get()));
+  }
+  for (const auto& item : gpu_resource_budget_items_) {
+    gpu_resource_budget_->AddItem(item);
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
+}
+
+void Rasterizer::SetQualityDegradation(QualityDegradation degradation) {
+  quality_degradation_changed_ = degradation != quality_degradation_;
+  quality_degradation_ = degradation;
+  ApplyQualityDegradation();
+}
+
+void Rasterizer::SetParallelRecordingTaskRunner(
+    std::shared_ptr<fml::ConcurrentTaskRunner> task_runner) {
+  parallel_recording_task_runner_ = std::move(task_runner);
+  ApplyParallelRecordingTaskRunner();
+}
+
+void Rasterizer::ApplyParallelRecordingTaskRunner() {
+#if IMPELLER_SUPPORTS_RENDERING
+  if (!surface_) {
+    return;
+  }
+  if (std::shared_ptr<impeller::AiksContext> aiks_context =
+          surface_->GetAiksContext()) {
+    aiks_context->GetContentContext().SetParallelRecordingTaskRunner(
+        parallel_recording_task_runner_);
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
+}
+
+void Rasterizer::ApplyQualityDegradation() {
+  compositor_context_->SetBackdropFiltersDisabled(
+      quality_degradation_ >= QualityDegradation::kBackdropFiltersDisabled);
+
+#if !SLIMPELLER
+  // Cache sooner, and cache cheaper content under Impeller, so that fewer
+  // display lists are rendered again every frame.
+  const bool reduce_raster_cache_thresholds =
+      quality_degradation_ >= QualityDegradation::kRasterCacheThresholdsReduced;
+  RasterCache& raster_cache = compositor_context_->raster_cache();
+  raster_cache.SetAccessThreshold(reduce_raster_cache_thresholds
+                                      ? 1u
+                                      : RasterCache::kDefaultAccessThreshold);
+  RasterCacheUtil::ImpellerCacheLimits limits;
+  if (reduce_raster_cache_thresholds) {
+    limits.complexity_per_megapixel /= 2;
+  }
+  raster_cache.SetImpellerCacheLimits(limits);
+#endif  //  !SLIMPELLER
+
+#if IMPELLER_SUPPORTS_RENDERING
+  if (!surface_) {
+    return;
+  }
+  std::shared_ptr<impeller::AiksContext> aiks_context =
+      surface_->GetAiksContext();
+  if (!aiks_context) {
+    return;
+  }
+  impeller::ContentContext::QualityReductions reductions;
+  reductions.disable_offscreen_msaa =
+      quality_degradation_ >= QualityDegradation::kOffscreenMsaaDisabled;
+  reductions.reduce_blur_quality =
+      quality_degradation_ >= QualityDegradation::kBlurQualityReduced;
+  aiks_context->GetContentContext().SetQualityReductions(reductions);
+#endif  // IMPELLER_SUPPORTS_RENDERING
+}
+
 void Rasterizer::Setup(std::unique_ptr<Surface> surface) {
   surface_ = std::move(surface);
+  AddGpuResourceBudgetItems();
+  if (quality_degradation_ != QualityDegradation::kNone) {
+    ApplyQualityDegradation();
+  }
+  if (parallel_recording_task_runner_) {
+    ApplyParallelRecordingTaskRunner();
+  }
 
   if (max_cache_bytes_.has_value()) {
     SetResourceCacheMaxBytes(max_cache_bytes_.value(),
@@ -119,8 +383,11 @@ void Rasterizer::TeardownExternalViewEmbedder() {
 
 void Rasterizer::Teardown() {
   is_torn_down_ = true;
+  gpu_resource_budget_items_.clear();
   if (surface_) {
     auto context_switch = surface_->MakeRenderContextCurrent();
+    // The pooled surfaces must be released with the context current.
+    ClearSnapshotSurfacePools();
     if (context_switch->GetResult()) {
       compositor_context_->OnGrContextDestroyed();
 #if !SLIMPELLER
@@ -168,7 +435,35 @@ void Rasterizer::DisableThreadMergerIfNeeded() {
   }
 }
 
+void Rasterizer::ClearSnapshotSurfacePools() const {
+#if !SLIMPELLER
+  if (skia_snapshot_surface_pool_) {
+    skia_snapshot_surface_pool_->Clear();
+  }
+#endif  //  !SLIMPELLER
+  if (impeller_snapshot_texture_pool_) {
+    impeller_snapshot_texture_pool_->Clear();
+  }
+}
+
 void Rasterizer::NotifyLowMemoryWarning() const {
+  compositor_context_->texture_registry()->OnTrimMemory();
+#if IMPELLER_SUPPORTS_RENDERING
+  if (surface_) {
+    if (std::shared_ptr<impeller::AiksContext> aiks_context =
+            surface_->GetAiksContext()) {
+      if (gpu_resource_budget_) {
+        // Also trims the caches of the rasterizers sharing the budget.
+        gpu_resource_budget_->TrimAll();
+      } else {
+        aiks_context->GetContentContext().GetRenderTargetCache()->Trim();
+        aiks_context->GetContentContext().GetRetainedGeometryCache().Clear();
+        ClearSnapshotSurfacePools();
+      }
+      return;
+    }
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
 #if !SLIMPELLER
   if (!surface_) {
     FML_DLOG(INFO)
@@ -185,6 +480,7 @@ void Rasterizer::NotifyLowMemoryWarning() const {
   if (!context_switch->GetResult()) {
     return;
   }
+  ClearSnapshotSurfacePools();
   context->performDeferredCleanup(std::chrono::milliseconds(0));
 #endif  //  !SLIMPELLER
 }
@@ -486,6 +782,7 @@ Rasterizer::DoDrawResult Rasterizer::DoDraw(
   TRACE_EVENT_WITH_FRAME_NUMBER(frame_timings_recorder, "flutter",
                                 "Rasterizer::DoDraw", /*flow_id_count=*/0,
                                 /*flow_ids=*/nullptr);
+  fml::tracing::ScopedRecordedEvent recorded_event("Rasterizer::DoDraw");
   FML_DCHECK(delegate_.GetTaskRunners()
                  .GetRasterTaskRunner()
                  ->RunsTasksOnCurrentThread());
@@ -503,8 +800,19 @@ Rasterizer::DoDrawResult Rasterizer::DoDraw(
   persistent_cache->ResetStoredNewShaders();
 #endif  //  !SLIMPELLER
 
+  const fml::TimePoint draw_start = fml::TimePoint::Now();
   DoDrawResult result =
       DrawToSurfaces(*frame_timings_recorder, std::move(tasks));
+  // While the threads are merged, this is the platform thread, whose
+  // placement is up to the platform.
+  if (!raster_thread_merger_ || !raster_thread_merger_->IsMerged()) {
+    if (!placement_monitor_) {
+      placement_monitor_ = std::make_unique<ThreadPlacementMonitor>(
+          "RasterThreadCpuClusters",
+          delegate_.GetSettings().raster_thread_cpu_affinity);
+    }
+    placement_monitor_->RecordWork(draw_start, fml::TimePoint::Now());
+  }
 
   FML_DCHECK(result.status != DoDrawStatus::kEnqueuePipeline);
   if (result.status == DoDrawStatus::kGpuUnavailable) {
@@ -685,6 +993,12 @@ std::unique_ptr<FrameItem> Rasterizer::DrawToSurfacesUnsafe(
           view_id, std::move(layer_tree), device_pixel_ratio));
     }
   }
+  if (external_view_embedder_) {
+    ExternalViewEmbedder::OverlayLayerStatistics overlay_layers =
+        external_view_embedder_->TakeOverlayLayerStatistics();
+    frame_timings_recorder.RecordOverlayLayers(overlay_layers.count,
+                                               overlay_layers.pixels);
+  }
   // TODO(dkwingsmt): Pass in raster cache(s) for all views.
   // See https://github.com/flutter/flutter/issues/135530, item 4.
   frame_timings_recorder.RecordRasterEnd(
@@ -692,6 +1006,8 @@ std::unique_ptr<FrameItem> Rasterizer::DrawToSurfacesUnsafe(
 
   FireNextFrameCallbackIfPresent();
 
+  ScheduleGpuResourceTrimIfNeeded();
+
 #if !SLIMPELLER
   if (surface_->GetContext()) {
     surface_->GetContext()->performDeferredCleanup(kSkiaCleanupExpiration);
@@ -732,6 +1048,11 @@ DrawSurfaceStatus Rasterizer::DrawToSurfaceUnsafe(
   if (frame == nullptr) {
     return DrawSurfaceStatus::kFailed;
   }
+#if !SLIMPELLER
+  if (skia_picture_cache_) {
+    frame->set_picture_cache(skia_picture_cache_.get());
+  }
+#endif  //  !SLIMPELLER
 
   // If the external view embedder has specified an optional root surface, the
   // root surface transformation is set by the embedder instead of
@@ -763,9 +1084,14 @@ DrawSurfaceStatus Rasterizer::DrawToSurfaceUnsafe(
       // involved - ExternalViewEmbedder unconditionally clears the entire
       // surface and also partial repaint with platform view present is
       // something that still need to be figured out.
+      //
+      // The previous frame was also painted at another quality if the
+      // quality degradation changed since.
       bool force_full_repaint =
-          external_view_embedder_ &&
-          (!raster_thread_merger_ || raster_thread_merger_->IsMerged());
+          (external_view_embedder_ &&
+           (!raster_thread_merger_ || raster_thread_merger_->IsMerged())) ||
+          quality_degradation_changed_;
+      quality_degradation_changed_ = false;
 
       damage = std::make_unique<FrameDamage>();
       auto existing_damage = frame->framebuffer_info().existing_damage;
@@ -775,6 +1101,8 @@ DrawSurfaceStatus Rasterizer::DrawToSurfaceUnsafe(
         damage->SetClipAlignment(
             frame->framebuffer_info().horizontal_clip_alignment,
             frame->framebuffer_info().vertical_clip_alignment);
+        damage->SetMaxFrameDamageRects(
+            frame->framebuffer_info().max_frame_damage_rects);
       }
     }
 
@@ -796,6 +1124,7 @@ DrawSurfaceStatus Rasterizer::DrawToSurfaceUnsafe(
     submit_info.presentation_time = presentation_time;
     if (damage) {
       submit_info.frame_damage = damage->GetFrameDamage();
+      submit_info.frame_damage_rects = damage->GetFrameDamageRects();
       submit_info.buffer_damage = damage->GetBufferDamage();
     }
 
@@ -816,6 +1145,9 @@ DrawSurfaceStatus Rasterizer::DrawToSurfaceUnsafe(
     // indicates that the frame was not actually painted.
     if (frame_status != RasterStatus::kResubmit) {
       compositor_context_->raster_cache().EndFrame();
+      if (skia_picture_cache_) {
+        skia_picture_cache_->EndFrame();
+      }
     }
 #endif  //  !SLIMPELLER
 
@@ -912,6 +1244,9 @@ Rasterizer::ScreenshotFormat ToScreenshotFormat(impeller::PixelFormat format) {
     case impeller::PixelFormat::kB10G10R10XR:
     case impeller::PixelFormat::kB10G10R10A10XR:
     case impeller::PixelFormat::kR32Float:
+    case impeller::PixelFormat::kETC2R8G8B8A8UNormInt:
+    case impeller::PixelFormat::kASTC4x4UNormInt:
+    case impeller::PixelFormat::kBC7UNormInt:
       FML_DCHECK(false);
       return Rasterizer::ScreenshotFormat::kUnknown;
     case impeller::PixelFormat::kR8G8B8A8UNormInt:
@@ -1001,7 +1336,8 @@ Rasterizer::ScreenshotLayerTreeAsImage(
   // Attempt to create a snapshot surface depending on whether we have access
   // to a valid GPU rendering context.
   std::unique_ptr<OffscreenSurface> snapshot_surface =
-      std::make_unique<OffscreenSurface>(surface_context, tree->frame_size());
+      std::make_unique<OffscreenSurface>(surface_context, tree->frame_size(),
+                                         skia_snapshot_surface_pool_.get());
 
   if (!snapshot_surface->IsValid()) {
     FML_LOG(ERROR) << "Screenshot: unable to create snapshot surface";
@@ -1123,7 +1459,6 @@ void Rasterizer::FireNextFrameCallbackIfPresent() {
 }
 
 void Rasterizer::SetResourceCacheMaxBytes(size_t max_bytes, bool from_user) {
-#if !SLIMPELLER
   user_override_resource_cache_bytes_ |= from_user;
 
   if (!from_user && user_override_resource_cache_bytes_) {
@@ -1133,6 +1468,8 @@ void Rasterizer::SetResourceCacheMaxBytes(size_t max_bytes, bool from_user) {
   }
 
   max_cache_bytes_ = max_bytes;
+
+#if !SLIMPELLER
   if (!surface_) {
     return;
   }
@@ -9,16 +9,19 @@
 #include <memory>
 #include <optional>
 #include <unordered_map>
+#include <vector>
 
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
 #include "flutter/display_list/image/dl_image.h"
+#include "flutter/display_list/skia/dl_sk_picture_cache.h"
 #include "flutter/flow/compositor_context.h"
 #include "flutter/flow/embedded_views.h"
 #include "flutter/flow/frame_timings.h"
 #include "flutter/flow/layers/layer_tree.h"
 #include "flutter/flow/surface.h"
 #include "flutter/fml/closure.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/fml/raster_thread_merger.h"
 #include "flutter/fml/synchronization/sync_switch.h"
@@ -32,9 +35,13 @@
 #include "impeller/typographer/backends/skia/typographer_context_skia.h"  // nogncheck
 #endif  // IMPELLER_SUPPORTS_RENDERING
 #include "flutter/lib/ui/snapshot_delegate.h"
+#include "flutter/shell/common/frame_budget_watchdog.h"
+#include "flutter/shell/common/gpu_resource_budget.h"
+#include "flutter/shell/common/idle_task_scheduler.h"
 #include "flutter/shell/common/pipeline.h"
 #include "flutter/shell/common/snapshot_controller.h"
 #include "flutter/shell/common/snapshot_surface_producer.h"
+#include "flutter/shell/common/thread_placement_monitor.h"
 #include "third_party/skia/include/core/SkData.h"
 #include "third_party/skia/include/core/SkImage.h"
 #include "third_party/skia/include/gpu/ganesh/GrDirectContext.h"
@@ -208,6 +215,44 @@ class Rasterizer final : public SnapshotDelegate,
   void SetImpellerContext(
       std::shared_ptr<impeller::ImpellerContextFuture> impeller_context);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Sets the budget that the GPU resources cached by Impeller are
+  ///             accounted for in. The caches are trimmed, lowest priority
+  ///             first, when the resources of all rasterizers sharing the
+  ///             budget exceed the resource cache limit after a frame.
+  ///
+  /// @param[in]  budget  The budget shared with the spawned rasterizers.
+  ///
+  void SetGpuResourceBudget(std::shared_ptr<GpuResourceBudget> budget);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Sets the scheduler that deferrable work, such as trimming
+  ///             the caches that exceed the GPU resource budget, is posted
+  ///             to. The work is done right away if there is no scheduler.
+  ///
+  void SetIdleTaskScheduler(std::shared_ptr<IdleTaskScheduler> scheduler);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Reduces the rendering quality of the following frames to
+  ///             |degradation|, or restores it with
+  ///             |QualityDegradation::kNone|. The degradation is kept across
+  ///             surface changes.
+  ///
+  void SetQualityDegradation(QualityDegradation degradation);
+
+  QualityDegradation GetQualityDegradation() const {
+    return quality_degradation_;
+  }
+
+  //----------------------------------------------------------------------------
+  /// @brief      Sets the task runner that Impeller collects the independent
+  ///             save layer subtrees of each frame on, or nullptr to collect
+  ///             them on the raster thread. The task runner is kept across
+  ///             surface changes.
+  ///
+  void SetParallelRecordingTaskRunner(
+      std::shared_ptr<fml::ConcurrentTaskRunner> task_runner);
+
   //----------------------------------------------------------------------------
   /// @brief      Rasterizers may be created well before an on-screen surface is
   ///             available for rendering. Shells usually create a rasterizer in
@@ -517,6 +562,20 @@ class Rasterizer final : public SnapshotDelegate,
     return compositor_context_.get();
   }
 
+  //----------------------------------------------------------------------------
+  /// @brief      Returns the Impeller context that the surface renders with,
+  ///             or `nullptr` if there is no surface or it does not render
+  ///             with Impeller.
+  ///
+  std::shared_ptr<impeller::AiksContext> GetSurfaceAiksContext() const {
+#if IMPELLER_SUPPORTS_RENDERING
+    if (surface_) {
+      return surface_->GetAiksContext();
+    }
+#endif
+    return nullptr;
+  }
+
   //----------------------------------------------------------------------------
   /// @brief      Returns the raster thread merger used by this rasterizer.
   ///             This may be `nullptr`.
@@ -715,6 +774,37 @@ class Rasterizer final : public SnapshotDelegate,
     return delegate_.GetIsGpuDisabledSyncSwitch();
   }
 
+#if !SLIMPELLER
+  // |SnapshotController::Delegate|
+  SkiaSnapshotSurfacePool* GetSkiaSnapshotSurfacePool() const override {
+    return skia_snapshot_surface_pool_.get();
+  }
+#endif  //  !SLIMPELLER
+
+  // |SnapshotController::Delegate|
+  ImpellerSnapshotTexturePool* GetImpellerSnapshotTexturePool()
+      const override {
+    return impeller_snapshot_texture_pool_.get();
+  }
+
+  // Drops the snapshot surfaces that are not in use.
+  void ClearSnapshotSurfacePools() const;
+
+  // Registers the caches of the current surface with the budget.
+  void AddGpuResourceBudgetItems();
+
+  // Applies |quality_degradation_| to the compositor context, the raster
+  // cache and the content context of the surface, if any.
+  void ApplyQualityDegradation();
+
+  // Hands |parallel_recording_task_runner_| to the content context of the
+  // surface, if any.
+  void ApplyParallelRecordingTaskRunner();
+
+  // Trims the caches of the budget in idle time if they exceed the resource
+  // cache limit.
+  void ScheduleGpuResourceTrimIfNeeded();
+
   std::pair<sk_sp<SkData>, ScreenshotFormat> ScreenshotLayerTreeAsImage(
       flutter::LayerTree* tree,
       flutter::CompositorContext& compositor_context,
@@ -778,6 +868,23 @@ class Rasterizer final : public SnapshotDelegate,
   fml::RefPtr<fml::RasterThreadMerger> raster_thread_merger_;
   std::shared_ptr<ExternalViewEmbedder> external_view_embedder_;
   std::unique_ptr<SnapshotController> snapshot_controller_;
+#if !SLIMPELLER
+  std::unique_ptr<SkiaSnapshotSurfacePool> skia_snapshot_surface_pool_;
+  // Only created if enabled in the settings.
+  std::unique_ptr<DlSkPictureCache> skia_picture_cache_;
+#endif  //  !SLIMPELLER
+  std::unique_ptr<ImpellerSnapshotTexturePool> impeller_snapshot_texture_pool_;
+  std::shared_ptr<GpuResourceBudget> gpu_resource_budget_;
+  // Declared after the pools the items refer to.
+  std::vector<std::shared_ptr<GpuResourceBudgetItem>>
+      gpu_resource_budget_items_;
+  std::shared_ptr<IdleTaskScheduler> idle_task_scheduler_;
+  bool gpu_resource_trim_scheduled_ = false;
+  QualityDegradation quality_degradation_ = QualityDegradation::kNone;
+  bool quality_degradation_changed_ = false;
+  std::shared_ptr<fml::ConcurrentTaskRunner> parallel_recording_task_runner_;
+  // Created on the first frame, from the settings.
+  std::unique_ptr<ThreadPlacementMonitor> placement_monitor_;
 
   // WeakPtrFactory must be the last member.
   fml::TaskRunnerAffineWeakPtrFactory<Rasterizer> weak_factory_;
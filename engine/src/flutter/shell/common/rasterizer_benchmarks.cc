@@ -0,0 +1,136 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <vector>
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/common/settings.h"
+#include "flutter/display_list/dl_builder.h"
+#include "flutter/flow/layers/display_list_layer.h"
+#include "flutter/shell/common/shell_test.h"
+#include "flutter/shell/common/shell_test_platform_view.h"
+
+namespace flutter {
+
+namespace {
+
+class RasterizerBenchmarkFixture : public testing::ShellTest {
+  void TestBody() override {};
+};
+
+constexpr double kViewWidth = 1024;
+constexpr double kViewHeight = 768;
+
+// A grid of overlapping translucent rects and round rects, which is the bulk
+// of what typical frames draw.
+sk_sp<DisplayList> MakeBenchmarkDisplayList(int64_t draw_count) {
+  DisplayListBuilder builder(DlRect::MakeWH(kViewWidth, kViewHeight));
+  DlPaint paint;
+  for (int64_t i = 0; i < draw_count; i++) {
+    const DlScalar x = static_cast<DlScalar>((i * 37) % 960);
+    const DlScalar y = static_cast<DlScalar>((i * 53) % 704);
+    const DlRect rect = DlRect::MakeXYWH(x, y, 64, 64);
+    paint.setColor(DlColor(0x80000000 | ((i * 0x10203) & 0xFFFFFF)));
+    if (i % 2 == 0) {
+      builder.DrawRect(rect, paint);
+    } else {
+      builder.DrawRoundRect(DlRoundRect::MakeRectXY(rect, 8, 8), paint);
+    }
+  }
+  return builder.Build();
+}
+
+double Percentile(std::vector<double>& samples, double percentile) {
+  if (samples.empty()) {
+    return 0.0;
+  }
+  std::sort(samples.begin(), samples.end());
+  size_t index = static_cast<size_t>(samples.size() * percentile / 100.0);
+  return samples[std::min(index, samples.size() - 1)];
+}
+
+}  // namespace
+
+// Renders frames of |state.range(0)| draw calls through the whole shell:
+// the layer tree is submitted on the UI thread as the framework would, and
+// the rasterizer draws it onto the default test backend.
+//
+// The iteration time is the raster time of a frame. The UI and raster time
+// percentiles are reported as counters, so runs on different engine builds
+// can be compared with --benchmark_format=json.
+static void BM_ShellRasterizeFrame(benchmark::State& state,
+                                   bool enable_impeller) {
+  RasterizerBenchmarkFixture fixture;
+  Settings settings = fixture.CreateSettingsForFixture();
+  settings.enable_impeller = enable_impeller;
+
+  FrameTiming timing;
+  fml::AutoResetWaitableEvent rasterized;
+  settings.frame_rasterized_callback = [&timing,
+                                        &rasterized](const FrameTiming& t) {
+    timing = t;
+    rasterized.Signal();
+  };
+
+  std::unique_ptr<Shell> shell = fixture.CreateShell(settings);
+  FML_CHECK(shell);
+  testing::ShellTest::PlatformViewNotifyCreated(shell.get());
+
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  configuration.SetEntrypoint("emptyMain");
+  testing::ShellTest::RunEngine(shell.get(), std::move(configuration));
+
+  sk_sp<DisplayList> display_list = MakeBenchmarkDisplayList(state.range(0));
+  testing::LayerTreeBuilder builder =
+      [&display_list](const std::shared_ptr<ContainerLayer>& root) {
+        // Mark the picture as changing so that the raster cache doesn't
+        // take over after a few frames.
+        root->Add(std::make_shared<DisplayListLayer>(
+            DlPoint(), display_list, /*is_complex=*/false,
+            /*will_change=*/true));
+      };
+
+  std::vector<double> build_samples;
+  std::vector<double> raster_samples;
+  while (state.KeepRunning()) {
+    testing::ShellTest::PumpOneFrame(
+        shell.get(),
+        testing::ViewContent::ImplicitView(kViewWidth, kViewHeight, builder));
+    rasterized.Wait();
+
+    const fml::TimeDelta build_time = timing.Get(FrameTiming::kBuildFinish) -
+                                      timing.Get(FrameTiming::kBuildStart);
+    const fml::TimeDelta raster_time = timing.Get(FrameTiming::kRasterFinish) -
+                                       timing.Get(FrameTiming::kRasterStart);
+    build_samples.push_back(build_time.ToMillisecondsF());
+    raster_samples.push_back(raster_time.ToMillisecondsF());
+    state.SetIterationTime(raster_time.ToSecondsF());
+  }
+
+  state.counters["ui_p50_ms"] = Percentile(build_samples, 50);
+  state.counters["ui_p90_ms"] = Percentile(build_samples, 90);
+  state.counters["ui_p99_ms"] = Percentile(build_samples, 99);
+  state.counters["raster_p50_ms"] = Percentile(raster_samples, 50);
+  state.counters["raster_p90_ms"] = Percentile(raster_samples, 90);
+  state.counters["raster_p99_ms"] = Percentile(raster_samples, 99);
+
+  fixture.DestroyShell(std::move(shell));
+}
+
+BENCHMARK_CAPTURE(BM_ShellRasterizeFrame, Skia, /*enable_impeller=*/false)
+    ->RangeMultiplier(10)
+    ->Range(10, 10000)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+#ifdef IMPELLER_SUPPORTS_RENDERING
+BENCHMARK_CAPTURE(BM_ShellRasterizeFrame, Impeller, /*enable_impeller=*/true)
+    ->RangeMultiplier(10)
+    ->Range(10, 10000)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
+}  // namespace flutter
@@ -6,10 +6,12 @@
 #define FLUTTER_SHELL_COMMON_RESOURCE_CACHE_LIMIT_CALCULATOR_H_
 
 #include <cstdint>
+#include <memory>
 #include <unordered_map>
 
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/weak_ptr.h"
+#include "flutter/shell/common/gpu_resource_budget.h"
 
 namespace flutter {
 class ResourceCacheLimitItem {
@@ -25,7 +27,8 @@ class ResourceCacheLimitItem {
 class ResourceCacheLimitCalculator {
  public:
   explicit ResourceCacheLimitCalculator(size_t max_bytes_threshold)
-      : max_bytes_threshold_(max_bytes_threshold) {}
+      : max_bytes_threshold_(max_bytes_threshold),
+        gpu_resource_budget_(std::make_shared<GpuResourceBudget>()) {}
 
   ~ResourceCacheLimitCalculator() = default;
 
@@ -39,9 +42,17 @@ class ResourceCacheLimitCalculator {
   // 'ResourceCacheLimitItem's. This will be called on the platform thread.
   size_t GetResourceCacheMaxBytes();
 
+  // The budget of the GPU resources that are not managed by Skia, shared by
+  // the rasterizers of the shells sharing this calculator. The budget is only
+  // used on the raster thread.
+  const std::shared_ptr<GpuResourceBudget>& GetGpuResourceBudget() const {
+    return gpu_resource_budget_;
+  }
+
  private:
   std::vector<fml::WeakPtr<ResourceCacheLimitItem>> items_;
   size_t max_bytes_threshold_;
+  std::shared_ptr<GpuResourceBudget> gpu_resource_budget_;
   FML_DISALLOW_COPY_AND_ASSIGN(ResourceCacheLimitCalculator);
 };
 }  // namespace flutter
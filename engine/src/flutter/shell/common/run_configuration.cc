@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "flutter/assets/directory_asset_bundle.h"
+#include "flutter/assets/packed_asset_bundle.h"
 #include "flutter/common/graphics/persistent_cache.h"
 #include "flutter/fml/file.h"
 #include "flutter/fml/unique_fd.h"
@@ -16,6 +17,22 @@
 
 namespace flutter {
 
+namespace {
+
+// Adds the assets of the directory, preceded by those of the pack in it if
+// there is one, so that the assets in the pack are found first.
+void PushBackDirectoryAssets(AssetManager& asset_manager,
+                             std::unique_ptr<DirectoryAssetBundle> bundle) {
+  std::unique_ptr<PackedAssetBundle> pack =
+      PackedAssetBundle::OpenFromResolver(*bundle, true);
+  if (pack) {
+    asset_manager.PushBack(std::move(pack));
+  }
+  asset_manager.PushBack(std::move(bundle));
+}
+
+}  // namespace
+
 RunConfiguration RunConfiguration::InferFromSettings(
     const Settings& settings,
     const fml::RefPtr<fml::TaskRunner>& io_worker,
@@ -23,14 +40,16 @@ RunConfiguration RunConfiguration::InferFromSettings(
   auto asset_manager = std::make_shared<AssetManager>();
 
   if (fml::UniqueFD::traits_type::IsValid(settings.assets_dir)) {
-    asset_manager->PushBack(std::make_unique<DirectoryAssetBundle>(
-        fml::Duplicate(settings.assets_dir), true));
+    PushBackDirectoryAssets(*asset_manager,
+                            std::make_unique<DirectoryAssetBundle>(
+                                fml::Duplicate(settings.assets_dir), true));
   }
 
-  asset_manager->PushBack(std::make_unique<DirectoryAssetBundle>(
-      fml::OpenDirectory(settings.assets_path.c_str(), false,
-                         fml::FilePermission::kRead),
-      true));
+  PushBackDirectoryAssets(
+      *asset_manager, std::make_unique<DirectoryAssetBundle>(
+                          fml::OpenDirectory(settings.assets_path.c_str(),
+                                             false, fml::FilePermission::kRead),
+                          true));
 
   return {IsolateConfiguration::InferFromSettings(settings, asset_manager,
                                                   io_worker, launch_type),
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
 #include <future>
 #include "fml/task_runner.h"
 #include "impeller/core/runtime_types.h"
@@ -11,28 +12,38 @@
 
 #include <memory>
 #include <sstream>
+#include <tuple>
 #include <utility>
 #include <vector>
 
 #include "flutter/assets/directory_asset_bundle.h"
 #include "flutter/common/constants.h"
 #include "flutter/common/graphics/persistent_cache.h"
+#include "flutter/display_list/benchmarking/dl_complexity.h"
 #include "flutter/fml/base32.h"
 #include "flutter/fml/file.h"
 #include "flutter/fml/icu_util.h"
 #include "flutter/fml/log_settings.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/make_copyable.h"
+#include "flutter/fml/memory_residency.h"
 #include "flutter/fml/message_loop.h"
+#include "flutter/fml/message_loop_task_queues.h"
 #include "flutter/fml/paths.h"
 #include "flutter/fml/trace_event.h"
+#include "flutter/fml/trace_recorder.h"
 #include "flutter/runtime/dart_vm.h"
+#include "flutter/runtime/snapshot_page_hints.h"
 #include "flutter/shell/common/base64.h"
 #include "flutter/shell/common/engine.h"
 #include "flutter/shell/common/skia_event_tracer_impl.h"
+#include "flutter/shell/common/startup_timeline.h"
 #include "flutter/shell/common/switches.h"
 #include "flutter/shell/common/vsync_waiter.h"
 #include "impeller/renderer/pipeline_library.h"
+#if IMPELLER_SUPPORTS_RENDERING
+#include "impeller/display_list/aiks_context.h"  // nogncheck
+#endif  // IMPELLER_SUPPORTS_RENDERING
 #include "rapidjson/stringbuffer.h"
 #include "rapidjson/writer.h"
 #include "third_party/dart/runtime/include/dart_tools_api.h"
@@ -46,6 +57,7 @@
 #include "third_party/skia/include/codec/SkWebpDecoder.h"
 #include "third_party/skia/include/core/SkGraphics.h"
 #include "third_party/tonic/common/log.h"
+#include "txt/platform.h"
 
 namespace flutter {
 
@@ -53,9 +65,65 @@ constexpr char kSkiaChannel[] = "flutter/skia";
 constexpr char kSystemChannel[] = "flutter/system";
 constexpr char kTypeKey[] = "type";
 constexpr char kFontChange[] = "fontsChange";
+constexpr char kQualityDegradation[] = "qualityDegradation";
+constexpr char kDegradationKey[] = "degradation";
+
+// Frames that take more than this many frame budgets from their vsync to the
+// end of their rasterization dump the recorded trace.
+constexpr int64_t kJankFrameBudgets = 2;
+// Consecutive janky frames share a dump.
+constexpr fml::TimeDelta kRecordedTraceDumpInterval =
+    fml::TimeDelta::FromSeconds(30);
+constexpr char kRecordedTraceFileName[] = "flutter_recorded_trace.json";
 
 namespace {
 
+// The regions of memory that the snapshots the VM was launched with are
+// mapped in.
+std::vector<fml::MemoryRegion> GetSnapshotRegions(const DartVMData& vm_data) {
+  std::vector<const fml::Mapping*> mappings =
+      vm_data.GetVMSnapshot().GetMappings();
+  fml::RefPtr<const DartSnapshot> isolate_snapshot =
+      vm_data.GetIsolateSnapshot();
+  if (isolate_snapshot) {
+    std::vector<const fml::Mapping*> isolate_mappings =
+        isolate_snapshot->GetMappings();
+    mappings.insert(mappings.end(), isolate_mappings.begin(),
+                    isolate_mappings.end());
+  }
+  return SnapshotPageHints::GetRegionsOfMappings(mappings);
+}
+
+// The size of the regions that the mappings are in and how much of them is
+// resident.
+std::pair<uint64_t, uint64_t> GetMappedAndResidentBytes(
+    const std::vector<const fml::Mapping*>& mappings) {
+  const size_t page_size = fml::GetMemoryPageSize();
+  uint64_t mapped_bytes = 0;
+  uint64_t resident_bytes = 0;
+  for (const fml::MemoryRegion& region :
+       SnapshotPageHints::GetRegionsOfMappings(mappings)) {
+    mapped_bytes += region.size;
+    std::optional<std::vector<bool>> resident = fml::GetResidentPages(region);
+    if (resident.has_value()) {
+      resident_bytes += std::count(resident->begin(), resident->end(), true) *
+                        static_cast<uint64_t>(page_size);
+    }
+  }
+  return {mapped_bytes, std::min(resident_bytes, mapped_bytes)};
+}
+
+void AddSnapshotMemoryUsage(rapidjson::Document* response,
+                            const char* name,
+                            const std::vector<const fml::Mapping*>& mappings) {
+  auto& allocator = response->GetAllocator();
+  auto [mapped_bytes, resident_bytes] = GetMappedAndResidentBytes(mappings);
+  rapidjson::Value usage(rapidjson::kObjectType);
+  usage.AddMember<uint64_t>("mappedBytes", mapped_bytes, allocator);
+  usage.AddMember<uint64_t>("residentBytes", resident_bytes, allocator);
+  response->AddMember(rapidjson::StringRef(name), usage, allocator);
+}
+
 std::unique_ptr<Engine> CreateEngine(
     Engine::Delegate& delegate,
     const PointerDataDispatcherMaker& dispatcher_maker,
@@ -147,6 +215,7 @@ void PerformInitializationTasks(Settings& settings) {
 
 #if !SLIMPELLER
   PersistentCache::SetCacheSkSL(settings.cache_sksl);
+  PersistentCache::SetCacheSizeLimit(settings.persistent_cache_max_bytes);
 #endif  //  !SLIMPELLER
 }
 
@@ -236,6 +305,18 @@ std::unique_ptr<Shell> Shell::Create(
       std::make_shared<ResourceCacheLimitCalculator>(
           settings.resource_cache_max_bytes_threshold);
 
+  // Discovering the system fonts can take tens of milliseconds. Start it now so
+  // that it overlaps with the setup of the GPU, IO and UI subsystems instead of
+  // delaying the first frame after the engine is created. Spawned shells share
+  // the font collection of the shell they are spawned from.
+  if (!settings.prefetched_default_font_manager) {
+    vm->GetConcurrentWorkerTaskRunner()->PostTask(
+        [font_initialization_data = settings.font_initialization_data]() {
+          TRACE_EVENT0("flutter", "PrefetchDefaultFontManager");
+          txt::PrefetchDefaultFontManager(font_initialization_data);
+        });
+  }
+
   return CreateWithSnapshot(platform_data,                     //
                             task_runners,                      //
                             /*parent_thread_merger=*/nullptr,  //
@@ -268,12 +349,38 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
     return nullptr;
   }
 
+  // When tracing startup, the steps below are recorded so that the chain of
+  // steps that startup waited on can be logged once the shell is set up.
+  std::shared_ptr<StartupTimeline> startup_timeline;
+  if (settings.trace_startup) {
+    startup_timeline = std::make_shared<StartupTimeline>();
+  }
+
+  // Have the pages of the snapshots that an earlier launch needed by its first
+  // frame read in while the platform view and the isolate are set up, instead
+  // of faulting them in one at a time as the isolate starts.
+  if (settings.prefetch_snapshot_pages &&
+      !settings.temp_directory_path.empty()) {
+    vm->GetConcurrentWorkerTaskRunner()->PostTask(
+        [startup_timeline, vm_data = vm->GetVMData(),
+         directory = settings.temp_directory_path]() {
+          StartupTimeline::ScopedStep step(startup_timeline.get(),
+                                           "PrefetchSnapshotPages");
+          SnapshotPageHints::PrefetchFromDirectory(
+              directory, GetSnapshotRegions(*vm_data));
+        });
+  }
+
   auto shell = std::unique_ptr<Shell>(
       new Shell(std::move(vm), task_runners, std::move(parent_merger),
                 resource_cache_limit_calculator, settings, is_gpu_disabled));
 
   // Create the platform view on the platform thread (this thread).
-  auto platform_view = on_create_platform_view(*shell.get());
+  std::unique_ptr<PlatformView> platform_view;
+  {
+    StartupTimeline::ScopedStep step(startup_timeline.get(), "PlatformView");
+    platform_view = on_create_platform_view(*shell.get());
+  }
   if (!platform_view || !platform_view->GetWeakPtr()) {
     return nullptr;
   }
@@ -296,10 +403,16 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
       [&rasterizer_promise,  //
        &snapshot_delegate_promise, impeller_context_future,
        on_create_rasterizer,  //
+       startup_timeline,      //
        shell = shell.get()]() {
         TRACE_EVENT0("flutter", "ShellSetupGPUSubsystem");
+        StartupTimeline::ScopedStep step(startup_timeline.get(), "Rasterizer",
+                                         {"PlatformView"});
         std::unique_ptr<Rasterizer> rasterizer(on_create_rasterizer(*shell));
         rasterizer->SetImpellerContext(impeller_context_future);
+        rasterizer->SetGpuResourceBudget(
+            shell->resource_cache_limit_calculator_->GetGpuResourceBudget());
+        rasterizer->SetIdleTaskScheduler(shell->idle_task_scheduler_);
         snapshot_delegate_promise.set_value(rasterizer->GetSnapshotDelegate());
         rasterizer_promise.set_value(std::move(rasterizer));
       });
@@ -317,8 +430,11 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
       fml::MakeCopyable(
           [impeller_context_promise = std::move(impeller_context_promise),  //
            runtime_stage_backend = std::move(runtime_stage_backend),        //
+           startup_timeline,                                                //
            platform_view_ptr]() mutable {
             TRACE_EVENT0("flutter", "CreateImpellerContext");
+            StartupTimeline::ScopedStep step(startup_timeline.get(),
+                                             "ImpellerContext", {"Rasterizer"});
             platform_view_ptr->SetupImpellerContext();
             std::shared_ptr<impeller::Context> impeller_context =
                 platform_view_ptr->GetImpellerContext();
@@ -339,6 +455,7 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
   if (!vsync_waiter) {
     return nullptr;
   }
+  vsync_waiter->SetPrioritizeFrames(settings.prioritize_vsync_frames);
 
   // Create the IO manager on the IO thread. The IO manager must be initialized
   // first because it has state that the other subsystems depend on. It must
@@ -364,27 +481,35 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
        io_task_runner,                                                     //
        is_backgrounded_sync_switch = shell->GetIsGpuDisabledSyncSwitch(),  //
        impeller_enabled = settings.enable_impeller,                        //
+       startup_timeline,                                                   //
        impeller_context_future]() {
         TRACE_EVENT0("flutter", "ShellSetupIOSubsystem");
         std::shared_ptr<ShellIOManager> io_manager;
-        if (parent_io_manager) {
-          io_manager = parent_io_manager;
-        } else {
-          io_manager = std::make_shared<ShellIOManager>(
-              nullptr,                      // resource context
-              is_backgrounded_sync_switch,  // sync switch
-              io_task_runner,               // unref queue task runner
-              impeller_context_future,      // impeller context
-              impeller_enabled              //
-          );
+        {
+          StartupTimeline::ScopedStep step(startup_timeline.get(),
+                                           "IOManager", {"PlatformView"});
+          if (parent_io_manager) {
+            io_manager = parent_io_manager;
+          } else {
+            io_manager = std::make_shared<ShellIOManager>(
+                nullptr,                      // resource context
+                is_backgrounded_sync_switch,  // sync switch
+                io_task_runner,               // unref queue task runner
+                impeller_context_future,      // impeller context
+                impeller_enabled              //
+            );
+          }
+          weak_io_manager_promise.set_value(io_manager->GetWeakPtr());
+          unref_queue_promise.set_value(io_manager->GetSkiaUnrefQueue());
+          io_manager_promise.set_value(io_manager);
         }
-        weak_io_manager_promise.set_value(io_manager->GetWeakPtr());
-        unref_queue_promise.set_value(io_manager->GetSkiaUnrefQueue());
-        io_manager_promise.set_value(io_manager);
 
         // Wait until Impeller context setup is complete before creating the
         // resource context.
         io_manager->GetImpellerContext();
+        StartupTimeline::ScopedStep step(startup_timeline.get(),
+                                         "ResourceContext",
+                                         {"IOManager", "ImpellerContext"});
         sk_sp<GrDirectContext> resource_context =
             platform_view_ptr->CreateResourceContext();
         io_manager->NotifyResourceContextAvailable(resource_context);
@@ -393,6 +518,11 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
   // Send dispatcher_maker to the engine constructor because shell won't have
   // platform_view set until Shell::Setup is called later.
   auto dispatcher_maker = platform_view->GetDispatcherMaker();
+  if (settings.enable_pointer_resampling) {
+    dispatcher_maker = [](PointerDataDispatcher::Delegate& delegate) {
+      return std::make_unique<ResamplingPointerDataDispatcher>(delegate);
+    };
+  }
 
   // Create the engine on the UI thread.
   std::promise<std::unique_ptr<Engine>> engine_promise;
@@ -409,14 +539,26 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
                          &snapshot_delegate_future,                       //
                          &runtime_stage_future,                           //
                          &unref_queue_future,                             //
+                         startup_timeline,                                //
                          &on_create_engine]() mutable {
         TRACE_EVENT0("flutter", "ShellSetupUISubsystem");
+        StartupTimeline::ScopedStep step(startup_timeline.get(), "Engine",
+                                         {"Rasterizer", "IOManager"});
         const auto& task_runners = shell->GetTaskRunners();
 
         // The animator is owned by the UI thread but it gets its vsync pulses
         // from the platform.
         auto animator = std::make_unique<Animator>(*shell, task_runners,
                                                    std::move(vsync_waiter));
+        animator->SetFramePipelineMode(
+            shell->GetSettings().frame_pipeline_mode);
+        animator->SetPredictiveFrameScheduling(
+            shell->GetSettings().enable_predictive_frame_scheduling);
+        if (task_runners.GetUITaskRunner() !=
+            task_runners.GetPlatformTaskRunner()) {
+          animator->SetThreadCpuAffinity(
+              shell->GetSettings().ui_thread_cpu_affinity);
+        }
 
         engine_promise.set_value(
             on_create_engine(*shell,                               //
@@ -434,14 +576,28 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
                              runtime_stage_future));
       }));
 
-  if (!shell->Setup(std::move(platform_view),  //
-                    engine_future.get(),       //
-                    rasterizer_future.get(),   //
-                    io_manager_future.get())   //
-  ) {
+  auto engine = engine_future.get();
+  auto rasterizer = rasterizer_future.get();
+  auto io_manager = io_manager_future.get();
+  bool setup = false;
+  {
+    StartupTimeline::ScopedStep step(startup_timeline.get(), "Setup",
+                                     {"Engine", "Rasterizer", "IOManager"});
+    setup = shell->Setup(std::move(platform_view),  //
+                         std::move(engine),         //
+                         std::move(rasterizer),     //
+                         io_manager);
+  }
+  if (!setup) {
     return nullptr;
   }
 
+  if (startup_timeline) {
+    std::string critical_path = startup_timeline->CriticalPathToString("Setup");
+    TRACE_EVENT_INSTANT1("flutter", "StartupCriticalPath", "path",
+                         critical_path.c_str());
+  }
+
   return shell;
 }
 
@@ -600,6 +756,25 @@ Shell::Shell(DartVMRef vm,
       {task_runners_.GetIOTaskRunner(),
        std::bind(&Shell::OnServiceProtocolGetPipelineUsage, this,
                  std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_
+      [ServiceProtocol::kGetLayerPaintProfileExtensionName] = {
+          task_runners_.GetRasterTaskRunner(),
+          std::bind(&Shell::OnServiceProtocolGetLayerPaintProfile, this,
+                    std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_[ServiceProtocol::kGetRecordedTraceExtensionName] =
+      {task_runners_.GetIOTaskRunner(),
+       std::bind(&Shell::OnServiceProtocolGetRecordedTrace, this,
+                 std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_
+      [ServiceProtocol::kGetSnapshotMemoryUsageExtensionName] = {
+          task_runners_.GetUITaskRunner(),
+          std::bind(&Shell::OnServiceProtocolGetSnapshotMemoryUsage, this,
+                    std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_
+      [ServiceProtocol::kGetPerformanceCountersExtensionName] = {
+          task_runners_.GetRasterTaskRunner(),
+          std::bind(&Shell::OnServiceProtocolGetPerformanceCounters, this,
+                    std::placeholders::_1, std::placeholders::_2)};
 }
 
 Shell::~Shell() {
@@ -757,6 +932,19 @@ void Shell::NotifyLowMemoryWarning() const {
       });
   // The IO Manager uses resource cache limits of 0, so it is not necessary
   // to purge them.
+
+  // The shaped paragraphs are cached on the UI thread, and the images that
+  // are decoded next may be stored more compactly.
+  task_runners_.GetUITaskRunner()->PostTask([engine = weak_engine_]() {
+    if (!engine) {
+      return;
+    }
+    engine->GetFontCollection().GetFontCollection()->ClearParagraphCache();
+    if (fml::TaskRunnerAffineWeakPtr<ImageDecoder> image_decoder =
+            engine->GetImageDecoderWeakPtr()) {
+      image_decoder->NotifyLowMemoryWarning();
+    }
+  });
 }
 
 void Shell::FlushMicrotaskQueue() const {
@@ -885,6 +1073,8 @@ bool Shell::Setup(std::unique_ptr<PlatformView> platform_view,
   weak_engine_ = engine_->GetWeakPtr();
   weak_rasterizer_ = rasterizer_->GetWeakPtr();
   weak_platform_view_ = platform_view_->GetWeakPtr();
+  image_decode_scheduler_ = engine_->GetImageDecodeScheduler();
+  last_performance_counters_poll_.time = fml::TimePoint::Now();
 
   // Add the implicit view with empty metrics.
   engine_->AddView(kFlutterImplicitViewId, ViewportMetrics{}, [](bool added) {
@@ -903,6 +1093,73 @@ bool Shell::Setup(std::unique_ptr<PlatformView> platform_view,
 
   is_set_up_ = true;
 
+  if (settings_.enable_parallel_preroll) {
+    fml::TaskRunner::RunNowOrPostTask(
+        task_runners_.GetRasterTaskRunner(),
+        [rasterizer = weak_rasterizer_,
+         task_runner = GetConcurrentWorkerTaskRunner()]() mutable {
+          if (rasterizer) {
+            rasterizer->compositor_context()->SetPrerollTaskRunner(
+                std::move(task_runner));
+          }
+        });
+  }
+
+  if (settings_.enable_parallel_recording) {
+    fml::TaskRunner::RunNowOrPostTask(
+        task_runners_.GetRasterTaskRunner(),
+        [rasterizer = weak_rasterizer_,
+         task_runner = GetConcurrentWorkerTaskRunner()]() mutable {
+          if (rasterizer) {
+            rasterizer->SetParallelRecordingTaskRunner(std::move(task_runner));
+          }
+        });
+  }
+
+  if (settings_.task_wake_up_slack.has_value()) {
+    for (const fml::RefPtr<fml::TaskRunner>& task_runner :
+         {task_runners_.GetPlatformTaskRunner(),
+          task_runners_.GetUITaskRunner(), task_runners_.GetRasterTaskRunner(),
+          task_runners_.GetIOTaskRunner()}) {
+      // Embedder supplied task runners have no task queue.
+      fml::TaskQueueId queue_id = task_runner->GetTaskQueueId();
+      if (queue_id.is_valid()) {
+        fml::MessageLoopTaskQueues::GetInstance()->SetWakeUpSlack(
+            queue_id, settings_.task_wake_up_slack);
+      }
+    }
+  }
+
+  if (settings_.enable_layer_paint_profiling) {
+    fml::TaskRunner::RunNowOrPostTask(task_runners_.GetRasterTaskRunner(),
+                                      [rasterizer = weak_rasterizer_]() {
+                                        if (rasterizer) {
+                                          rasterizer->compositor_context()
+                                              ->EnableLayerPaintProfiling();
+                                        }
+                                      });
+  }
+
+  if (!settings_.complexity_calibration_path.empty()) {
+    // The calculators are only consulted on the raster thread, so the
+    // profile is read here but handed to them there.
+    std::optional<DlComplexityCalibration> calibration =
+        DlComplexityCalibration::LoadFromFile(
+            settings_.complexity_calibration_path);
+    if (calibration.has_value()) {
+      fml::TaskRunner::RunNowOrPostTask(
+          task_runners_.GetRasterTaskRunner(),
+          [calibration = std::move(calibration.value())]() {
+            if (!DisplayListComplexityCalculator::ApplyCalibration(
+                    calibration)) {
+              FML_LOG(ERROR) << "Complexity calibration profile is for an "
+                                "unknown backend: "
+                             << calibration.GetBackend();
+            }
+          });
+    }
+  }
+
 #if !SLIMPELLER
   PersistentCache::GetCacheForProcess()->AddWorkerTaskRunner(
       task_runners_.GetIOTaskRunner());
@@ -1194,6 +1451,10 @@ void Shell::OnPlatformViewDispatchPlatformMessage(
   }
 #endif  // FLUTTER_RUNTIME_MODE == FLUTTER_RUNTIME_MODE_DEBUG
 
+  if (platform_message_port_router_->Route(message)) {
+    return;
+  }
+
   // The static leak checker gets confused by the use of fml::MakeCopyable.
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
   fml::TaskRunner::RunNowAndFlushMessages(
@@ -1358,7 +1619,8 @@ const Settings& Shell::OnPlatformViewGetSettings() const {
 
 // |Animator::Delegate|
 void Shell::OnAnimatorBeginFrame(fml::TimePoint frame_target_time,
-                                 uint64_t frame_number) {
+                                 uint64_t frame_number,
+                                 fml::TimePoint build_deadline) {
   FML_DCHECK(is_set_up_);
   FML_DCHECK(task_runners_.GetUITaskRunner()->RunsTasksOnCurrentThread());
 
@@ -1368,7 +1630,7 @@ void Shell::OnAnimatorBeginFrame(fml::TimePoint frame_target_time,
     latest_frame_target_time_.emplace(frame_target_time);
   }
   if (engine_) {
-    engine_->BeginFrame(frame_target_time, frame_number);
+    engine_->BeginFrame(frame_target_time, frame_number, build_deadline);
   }
 }
 
@@ -1380,6 +1642,7 @@ void Shell::OnAnimatorNotifyIdle(fml::TimeDelta deadline) {
   if (engine_) {
     engine_->NotifyIdle(deadline);
   }
+  idle_task_scheduler_->OnIdle(deadline);
 }
 
 void Shell::OnAnimatorUpdateLatestFrameTargetTime(
@@ -1552,6 +1815,11 @@ void Shell::OnEngineChannelUpdate(std::string name, bool listening) {
       });
 }
 
+void Shell::OnEngineSetPlatformMessagePort(std::string name, int64_t port) {
+  FML_DCHECK(is_set_up_);
+  platform_message_port_router_->SetPort(name, port);
+}
+
 void Shell::HandleEngineSkiaMessage(std::unique_ptr<PlatformMessage> message) {
   const auto& data = message->data();
 
@@ -1743,6 +2011,33 @@ void Shell::OnFrameRasterized(const FrameTiming& timing) {
     settings_.frame_rasterized_callback(timing);
   }
 
+  frame_timing_history_.Record(timing);
+
+  if (settings_.dump_recorded_trace_on_jank) {
+    DumpRecordedTraceOnJank(timing);
+  }
+
+  if (settings_.prefetch_snapshot_pages && !snapshot_page_hints_recorded_) {
+    snapshot_page_hints_recorded_ = true;
+    RecordSnapshotPageHints();
+  }
+
+  if (settings_.frame_budget_watchdog_misses > 0) {
+    if (!frame_budget_watchdog_) {
+      frame_budget_watchdog_ = std::make_unique<FrameBudgetWatchdog>(
+          settings_.frame_budget_watchdog_misses,
+          [this](QualityDegradation degradation) {
+            OnQualityDegradationChanged(degradation);
+          });
+    }
+    frame_budget_watchdog_->OnFrameRasterized(
+        timing, fml::TimeDelta::FromMillisecondsF(GetFrameBudget().count()));
+  }
+
+  if (settings_.gpu_memory_gc_threshold_mb > 0) {
+    CollectGarbageOnGpuMemoryPressure(timing);
+  }
+
   if (!needs_report_timings_) {
     return;
   }
@@ -2205,6 +2500,376 @@ bool Shell::OnServiceProtocolGetPipelineUsage(
   return true;
 }
 
+bool Shell::OnServiceProtocolGetLayerPaintProfile(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+
+  response->SetObject();
+
+  LayerPaintProfiler* profiler =
+      rasterizer_ ? rasterizer_->compositor_context()->layer_paint_profiler()
+                  : nullptr;
+  if (!profiler) {
+    ServiceProtocolFailureError(
+        response,
+        "Layer paint profiling is not enabled. Run with "
+        "--profile-layer-paint.");
+    return false;
+  }
+
+  auto& allocator = response->GetAllocator();
+  auto write_stats = [&allocator](rapidjson::Value& value,
+                                  const LayerPaintProfiler::Stats& stats) {
+    value.AddMember<uint64_t>("paintCount", stats.paint_count, allocator);
+    value.AddMember<int64_t>("totalMicros", stats.total_time.ToMicroseconds(),
+                             allocator);
+    value.AddMember<int64_t>("selfMicros", stats.self_time.ToMicroseconds(),
+                             allocator);
+  };
+
+  rapidjson::Value types_json(rapidjson::kArrayType);
+  for (const auto& [type_name, stats] : profiler->GetTypeStats()) {
+    rapidjson::Value type_json(rapidjson::kObjectType);
+    type_json.AddMember(
+        "type", rapidjson::Value(type_name.data(), type_name.size(), allocator),
+        allocator);
+    write_stats(type_json, stats);
+    types_json.PushBack(type_json, allocator);
+  }
+
+  rapidjson::Value layers_json(rapidjson::kArrayType);
+  for (const auto& [id, layer_stats] : profiler->GetLayerStats()) {
+    rapidjson::Value layer_json(rapidjson::kObjectType);
+    layer_json.AddMember<uint64_t>("id", id, allocator);
+    layer_json.AddMember("type", rapidjson::StringRef(layer_stats.type_name),
+                         allocator);
+    write_stats(layer_json, layer_stats.stats);
+    layers_json.PushBack(layer_json, allocator);
+  }
+
+  response->AddMember("type", "LayerPaintProfile", allocator);
+  response->AddMember<uint64_t>("frameCount", profiler->GetFrameCount(),
+                                allocator);
+  response->AddMember("types", types_json, allocator);
+  response->AddMember("layers", layers_json, allocator);
+
+  auto reset = params.find("reset");
+  if (reset != params.end() && reset->second == "true") {
+    profiler->Reset();
+  }
+  return true;
+}
+
+bool Shell::OnServiceProtocolGetRecordedTrace(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetIOTaskRunner()->RunsTasksOnCurrentThread());
+
+  std::string trace = fml::tracing::TraceRecorder::GetInstance().ToJson();
+  auto& allocator = response->GetAllocator();
+  response->SetObject();
+  response->AddMember("type", "RecordedTrace", allocator);
+  response->AddMember("trace",
+                      rapidjson::Value(trace.data(), trace.size(), allocator),
+                      allocator);
+  return true;
+}
+
+bool Shell::OnServiceProtocolGetSnapshotMemoryUsage(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetUITaskRunner()->RunsTasksOnCurrentThread());
+
+  response->SetObject();
+  response->AddMember("type", "SnapshotMemoryUsage",
+                      response->GetAllocator());
+  AddSnapshotMemoryUsage(response, "vmSnapshot",
+                         vm_->GetVMData()->GetVMSnapshot().GetMappings());
+  std::vector<const fml::Mapping*> isolate_mappings;
+  if (engine_ && engine_->GetRuntimeController()) {
+    if (const auto& isolate_snapshot =
+            engine_->GetRuntimeController()->GetIsolateSnapshot()) {
+      isolate_mappings = isolate_snapshot->GetMappings();
+    }
+  }
+  AddSnapshotMemoryUsage(response, "isolateSnapshot", isolate_mappings);
+  return true;
+}
+
+bool Shell::OnServiceProtocolGetPerformanceCounters(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+
+  auto& allocator = response->GetAllocator();
+  response->SetObject();
+  response->AddMember("type", "PerformanceCounters", allocator);
+
+  // The share of the interval since the last poll that the threads spent on
+  // the phases of the frames rasterized in it.
+  const PerformanceCountersPoll poll = {
+      .time = fml::TimePoint::Now(),
+      .frame_count = frame_timing_history_.GetRecordedFrameCount(),
+      .build_time = frame_timing_history_.GetTotalDuration(
+          FrameTimingHistory::Phase::kBuild),
+      .raster_time = frame_timing_history_.GetTotalDuration(
+          FrameTimingHistory::Phase::kRaster),
+  };
+  const PerformanceCountersPoll last = last_performance_counters_poll_;
+  last_performance_counters_poll_ = poll;
+  const fml::TimeDelta interval = poll.time - last.time;
+  auto busy_percent = [interval](fml::TimeDelta busy) {
+    return interval > fml::TimeDelta::Zero()
+               ? std::min(100.0, 100.0 * busy.ToSecondsF() /
+                                     interval.ToSecondsF())
+               : 0.0;
+  };
+  rapidjson::Value threads(rapidjson::kObjectType);
+  threads.AddMember<int64_t>("intervalMicros", interval.ToMicroseconds(),
+                             allocator);
+  threads.AddMember<uint64_t>("frameCount",
+                              poll.frame_count - last.frame_count, allocator);
+  threads.AddMember("uiBusyPercent",
+                    busy_percent(poll.build_time - last.build_time),
+                    allocator);
+  threads.AddMember("rasterBusyPercent",
+                    busy_percent(poll.raster_time - last.raster_time),
+                    allocator);
+  response->AddMember("threads", threads, allocator);
+
+#if !SLIMPELLER
+  if (rasterizer_) {
+    const auto& raster_cache =
+        rasterizer_->compositor_context()->raster_cache();
+    rapidjson::Value cache(rapidjson::kObjectType);
+    auto add_metrics = [&cache, &allocator](const char* count_key,
+                                            const char* bytes_key,
+                                            const char* evicted_key,
+                                            const RasterCacheMetrics& metrics) {
+      cache.AddMember<uint64_t>(rapidjson::StringRef(count_key),
+                                metrics.in_use_count, allocator);
+      cache.AddMember<uint64_t>(rapidjson::StringRef(bytes_key),
+                                metrics.in_use_bytes, allocator);
+      cache.AddMember<uint64_t>(rapidjson::StringRef(evicted_key),
+                                metrics.eviction_count, allocator);
+    };
+    add_metrics("layerCount", "layerBytes", "layerEvictedCount",
+                raster_cache.layer_metrics());
+    add_metrics("pictureCount", "pictureBytes", "pictureEvictedCount",
+                raster_cache.picture_metrics());
+    response->AddMember("rasterCache", cache, allocator);
+  }
+#endif  //  !SLIMPELLER
+
+#if IMPELLER_SUPPORTS_RENDERING
+  if (auto aiks_context =
+          rasterizer_ ? rasterizer_->GetSurfaceAiksContext() : nullptr) {
+    const impeller::ContentContext& content_context =
+        aiks_context->GetContentContext();
+
+    const impeller::TextShadowCache::Stats& shadow_stats =
+        content_context.GetTextShadowCache().GetStats();
+    rapidjson::Value text_shadow_cache(rapidjson::kObjectType);
+    text_shadow_cache.AddMember<uint64_t>("hitCount", shadow_stats.hit_count,
+                                          allocator);
+    text_shadow_cache.AddMember<uint64_t>("missCount",
+                                          shadow_stats.miss_count, allocator);
+    text_shadow_cache.AddMember<uint64_t>(
+        "evictedCount", shadow_stats.evicted_count, allocator);
+    text_shadow_cache.AddMember<uint64_t>(
+        "residentBytes", shadow_stats.resident_bytes, allocator);
+    response->AddMember("textShadowCache", text_shadow_cache, allocator);
+
+    rapidjson::Value glyph_atlas(rapidjson::kObjectType);
+    for (auto [type, count_key, bytes_key] : {
+             std::make_tuple(impeller::GlyphAtlas::Type::kAlphaBitmap,
+                             "alphaGlyphCount", "alphaTextureBytes"),
+             std::make_tuple(impeller::GlyphAtlas::Type::kColorBitmap,
+                             "colorGlyphCount", "colorTextureBytes"),
+         }) {
+      impeller::LazyGlyphAtlas::AtlasStats atlas_stats =
+          content_context.GetLazyGlyphAtlas()->GetAtlasStats(type);
+      glyph_atlas.AddMember<uint64_t>(rapidjson::StringRef(count_key),
+                                      atlas_stats.glyph_count, allocator);
+      glyph_atlas.AddMember<uint64_t>(rapidjson::StringRef(bytes_key),
+                                      atlas_stats.texture_bytes, allocator);
+    }
+    response->AddMember("glyphAtlas", glyph_atlas, allocator);
+
+    rapidjson::Value render_target_cache(rapidjson::kObjectType);
+    render_target_cache.AddMember<uint64_t>(
+        "cachedBytes", content_context.GetRenderTargetCache()->GetCachedBytes(),
+        allocator);
+    response->AddMember("renderTargetCache", render_target_cache, allocator);
+
+    impeller::HostBuffer& host_buffer =
+        content_context.GetTransientsDataBuffer();
+    rapidjson::Value host_buffer_json(rapidjson::kObjectType);
+    host_buffer_json.AddMember<uint64_t>("usedBytes",
+                                         host_buffer.GetUsedBytes(), allocator);
+    host_buffer_json.AddMember<uint64_t>(
+        "peakBlockCount", host_buffer.GetPeakBlockCount(), allocator);
+    response->AddMember("hostBuffer", host_buffer_json, allocator);
+
+    impeller::PipelineLibrary::CompileStats compile_stats =
+        aiks_context->GetContext()
+            ->GetPipelineLibrary()
+            ->GetPipelineCompileStats();
+    rapidjson::Value pipelines(rapidjson::kObjectType);
+    pipelines.AddMember<uint64_t>("compileCount", compile_stats.compile_count,
+                                  allocator);
+    pipelines.AddMember<int64_t>(
+        "totalCompileMicros",
+        compile_stats.total_compile_time.ToMicroseconds(), allocator);
+    pipelines.AddMember<int64_t>(
+        "maxCompileMicros", compile_stats.max_compile_time.ToMicroseconds(),
+        allocator);
+    response->AddMember("pipelines", pipelines, allocator);
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
+  if (image_decode_scheduler_) {
+    ImageDecodeScheduler::Stats decode_stats =
+        image_decode_scheduler_->GetStats();
+    rapidjson::Value image_decodes(rapidjson::kObjectType);
+    image_decodes.AddMember<uint64_t>("queueDepth", decode_stats.queue_depth,
+                                      allocator);
+    image_decodes.AddMember<uint64_t>("inFlightCount",
+                                      decode_stats.in_flight_count, allocator);
+    image_decodes.AddMember<uint64_t>("inFlightBytes",
+                                      decode_stats.in_flight_bytes, allocator);
+    image_decodes.AddMember<uint64_t>("admittedCount",
+                                      decode_stats.admitted_count, allocator);
+    image_decodes.AddMember<uint64_t>("cancelledCount",
+                                      decode_stats.cancelled_count, allocator);
+    image_decodes.AddMember<int64_t>(
+        "maxWaitMicros", decode_stats.max_wait.ToMicroseconds(), allocator);
+    image_decodes.AddMember<int64_t>(
+        "totalWaitMicros", decode_stats.total_wait.ToMicroseconds(), allocator);
+    response->AddMember("imageDecodes", image_decodes, allocator);
+  }
+  return true;
+}
+
+void Shell::DumpRecordedTraceOnJank(const FrameTiming& timing) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+  if (settings_.temp_directory_path.empty()) {
+    return;
+  }
+  const fml::TimePoint raster_finish = timing.Get(FrameTiming::kRasterFinish);
+  const fml::TimeDelta frame_time =
+      raster_finish - timing.Get(FrameTiming::kVsyncStart);
+  const fml::TimeDelta frame_budget =
+      fml::TimeDelta::FromMillisecondsF(GetFrameBudget().count());
+  if (frame_time <= frame_budget * kJankFrameBudgets) {
+    return;
+  }
+  if (last_recorded_trace_dump_time_.has_value() &&
+      raster_finish - last_recorded_trace_dump_time_.value() <
+          kRecordedTraceDumpInterval) {
+    return;
+  }
+  last_recorded_trace_dump_time_ = raster_finish;
+
+  task_runners_.GetIOTaskRunner()->PostTask(
+      [directory = settings_.temp_directory_path]() {
+        TRACE_EVENT0("flutter", "Shell::DumpRecordedTraceOnJank");
+        fml::DataMapping trace(
+            fml::tracing::TraceRecorder::GetInstance().ToJson());
+        fml::UniqueFD directory_fd = fml::OpenDirectory(
+            directory.c_str(), false, fml::FilePermission::kReadWrite);
+        if (!fml::WriteAtomically(directory_fd, kRecordedTraceFileName,
+                                  trace)) {
+          FML_LOG(ERROR) << "Could not write the recorded trace to "
+                         << directory;
+          return;
+        }
+        FML_LOG(INFO) << "Wrote the recorded trace of a janky frame to "
+                      << fml::paths::JoinPaths(
+                             {directory, kRecordedTraceFileName});
+      });
+}
+
+void Shell::RecordSnapshotPageHints() {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+  if (settings_.temp_directory_path.empty()) {
+    return;
+  }
+  task_runners_.GetIOTaskRunner()->PostTask(
+      [vm_data = vm_->GetVMData(),
+       directory = settings_.temp_directory_path]() {
+        SnapshotPageHints::RecordToDirectoryIfNeeded(
+            directory, GetSnapshotRegions(*vm_data));
+      });
+}
+
+void Shell::CollectGarbageOnGpuMemoryPressure(const FrameTiming& timing) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+#if IMPELLER_SUPPORTS_RENDERING
+  std::shared_ptr<impeller::AiksContext> aiks_context =
+      rasterizer_ ? rasterizer_->GetSurfaceAiksContext() : nullptr;
+  if (!aiks_context) {
+    return;
+  }
+  std::optional<impeller::Bytes> allocated =
+      aiks_context->GetContext()->GetResourceAllocator()->GetAllocatedBytes();
+  if (!allocated.has_value()) {
+    return;
+  }
+  if (!gpu_memory_pressure_monitor_) {
+    gpu_memory_pressure_monitor_ = std::make_unique<GpuMemoryPressureMonitor>(
+        impeller::MebiBytes(settings_.gpu_memory_gc_threshold_mb)
+            .GetByteSize());
+  }
+  if (!gpu_memory_pressure_monitor_->OnFrameRasterized(
+          allocated->GetByteSize(), timing.Get(FrameTiming::kRasterFinish))) {
+    return;
+  }
+  TRACE_EVENT_INSTANT0("flutter", "Shell::GpuMemoryPressure");
+  // Collect on the UI thread so that the raster thread can't wait for the
+  // safepoint of the isolates. The finalizers of the images and pictures
+  // then release their textures through the unref queue.
+  task_runners_.GetUITaskRunner()->PostTask([]() {
+    TRACE_EVENT0("flutter", "Shell::CollectGarbageOnGpuMemoryPressure");
+    ::Dart_NotifyLowMemory();
+  });
+#endif  // IMPELLER_SUPPORTS_RENDERING
+}
+
+void Shell::OnQualityDegradationChanged(QualityDegradation degradation) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+  if (rasterizer_) {
+    rasterizer_->SetQualityDegradation(degradation);
+  }
+
+  rapidjson::Document document;
+  document.SetObject();
+  auto& allocator = document.GetAllocator();
+  document.AddMember(kTypeKey, rapidjson::StringRef(kQualityDegradation),
+                     allocator);
+  document.AddMember(
+      kDegradationKey,
+      rapidjson::StringRef(QualityDegradationToString(degradation)),
+      allocator);
+
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  document.Accept(writer);
+  std::string message = buffer.GetString();
+  task_runners_.GetPlatformTaskRunner()->PostTask(
+      [shell = weak_factory_.GetWeakPtr(), message = std::move(message)]() {
+        if (!shell) {
+          return;
+        }
+        shell->OnPlatformViewDispatchPlatformMessage(
+            std::make_unique<PlatformMessage>(
+                kSystemChannel,
+                fml::MallocMapping::Copy(message.c_str(), message.length()),
+                nullptr));
+      });
+}
+
 void Shell::SendFontChangeNotification() {
   // After system fonts are reloaded, we send a system channel message
   // to notify flutter framework.
@@ -2470,6 +3135,10 @@ Shell::GetConcurrentWorkerTaskRunner() const {
   return vm_->GetConcurrentWorkerTaskRunner();
 }
 
+FrameTimingHistory::Summary Shell::GetFrameTimingSummary() const {
+  return frame_timing_history_.ComputeSummary();
+}
+
 BoxConstraints Shell::ExpectedFrameConstraints(int64_t view_id) {
   auto found = expected_frame_constraints_.find(view_id);
 
@@ -14,6 +14,7 @@
 #include "flutter/common/graphics/texture.h"
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
+#include "flutter/flow/frame_timing_history.h"
 #include "flutter/flow/surface.h"
 #include "flutter/fml/closure.h"
 #include "flutter/fml/macros.h"
@@ -35,6 +36,10 @@
 #include "flutter/shell/common/animator.h"
 #include "flutter/shell/common/display_manager.h"
 #include "flutter/shell/common/engine.h"
+#include "flutter/shell/common/frame_budget_watchdog.h"
+#include "flutter/shell/common/gpu_memory_pressure_monitor.h"
+#include "flutter/shell/common/idle_task_scheduler.h"
+#include "flutter/shell/common/platform_message_port_router.h"
 #include "flutter/shell/common/platform_view.h"
 #include "flutter/shell/common/rasterizer.h"
 #include "flutter/shell/common/resource_cache_limit_calculator.h"
@@ -389,6 +394,15 @@ class Shell final : public PlatformView::Delegate,
   /// @brief     Marks the GPU as available or unavailable.
   void SetGpuAvailability(GpuAvailability availability);
 
+  //----------------------------------------------------------------------------
+  /// @brief      The scheduler of deferrable work, such as cache trimming,
+  ///             that runs when the animator reports idle time between
+  ///             frames.
+  ///
+  const std::shared_ptr<IdleTaskScheduler>& GetIdleTaskScheduler() const {
+    return idle_task_scheduler_;
+  }
+
   //----------------------------------------------------------------------------
   /// @brief      Get a pointer to the Dart VM used by this running shell
   ///             instance.
@@ -431,6 +445,17 @@ class Shell final : public PlatformView::Delegate,
   const std::shared_ptr<fml::ConcurrentTaskRunner>
   GetConcurrentWorkerTaskRunner() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Summarizes the phases of the most recently rasterized frames
+  ///             as percentiles.
+  ///
+  ///             Unlike the timings reported to the framework, the history
+  ///             is kept without any work on the UI thread.
+  ///
+  /// @attention  This method may be called from any thread.
+  ///
+  FrameTimingHistory::Summary GetFrameTimingSummary() const override;
+
   // Infer the VM ref and the isolate snapshot based on the settings.
   //
   // If the VM is already running, the settings are ignored, but the returned
@@ -472,6 +497,11 @@ class Shell final : public PlatformView::Delegate,
   std::shared_ptr<fml::SyncSwitch> is_gpu_disabled_sync_switch_;
   std::shared_ptr<PlatformMessageHandler> platform_message_handler_;
   std::atomic<bool> route_messages_through_platform_thread_ = false;
+  const std::shared_ptr<PlatformMessagePortRouter>
+      platform_message_port_router_ =
+          std::make_shared<PlatformMessagePortRouter>();
+  const std::shared_ptr<IdleTaskScheduler> idle_task_scheduler_ =
+      std::make_shared<IdleTaskScheduler>();
 
   fml::TaskRunnerAffineWeakPtr<Engine>
       weak_engine_;  // to be shared across threads
@@ -508,6 +538,43 @@ class Shell final : public PlatformView::Delegate,
   // stored here for easier conversions to Dart objects.
   std::vector<int64_t> unreported_timings_;
 
+  // The phase durations of the most recently rasterized frames. Written on
+  // the raster thread and read from any thread.
+  FrameTimingHistory frame_timing_history_;
+
+  // When the recorded trace was last written for a janky frame. Only
+  // accessed on the raster thread.
+  std::optional<fml::TimePoint> last_recorded_trace_dump_time_;
+
+  // Whether the pages of the snapshots resident by the first rasterized frame
+  // were recorded. Only accessed on the raster thread.
+  bool snapshot_page_hints_recorded_ = false;
+
+  // The scheduler of the image decodes of the engine, which the performance
+  // counters are read from on the raster thread.
+  std::shared_ptr<ImageDecodeScheduler> image_decode_scheduler_;
+
+  // The totals of the frame phases when the performance counters were last
+  // polled, or when the shell was set up, to report how busy the threads
+  // were in between. Only accessed on the raster thread once set up.
+  struct PerformanceCountersPoll {
+    fml::TimePoint time;
+    uint64_t frame_count = 0;
+    fml::TimeDelta build_time;
+    fml::TimeDelta raster_time;
+  };
+  PerformanceCountersPoll last_performance_counters_poll_;
+
+  // Reduces the rendering quality when frames keep missing their budget.
+  // Created on the first rasterized frame if enabled in the settings, and
+  // only accessed on the raster thread.
+  std::unique_ptr<FrameBudgetWatchdog> frame_budget_watchdog_;
+
+  // Decides when the GPU memory allocated after a frame warrants collecting
+  // the Dart heap. Created on the first rasterized frame if enabled in the
+  // settings, and only accessed on the raster thread.
+  std::unique_ptr<GpuMemoryPressureMonitor> gpu_memory_pressure_monitor_;
+
   /// Manages the displays. This class is thread safe, can be accessed from
   /// any of the threads.
   std::unique_ptr<DisplayManager> display_manager_;
@@ -653,7 +720,8 @@ class Shell final : public PlatformView::Delegate,
 
   // |Animator::Delegate|
   void OnAnimatorBeginFrame(fml::TimePoint frame_target_time,
-                            uint64_t frame_number) override;
+                            uint64_t frame_number,
+                            fml::TimePoint build_deadline) override;
 
   // |Animator::Delegate|
   void OnAnimatorNotifyIdle(fml::TimeDelta deadline) override;
@@ -713,6 +781,9 @@ class Shell final : public PlatformView::Delegate,
   // |Engine::Delegate|
   void OnEngineChannelUpdate(std::string name, bool listening) override;
 
+  // |Engine::Delegate|
+  void OnEngineSetPlatformMessagePort(std::string name, int64_t port) override;
+
   // |Engine::Delegate|
   double GetScaledFontSize(double unscaled_font_size,
                            int configuration_id) const override;
@@ -803,9 +874,68 @@ class Shell final : public PlatformView::Delegate,
       const ServiceProtocol::Handler::ServiceProtocolMap& params,
       rapidjson::Document* response);
 
+  // Service protocol handler
+  //
+  // Reports the paint time attributed to each layer type and layer since the
+  // last reset. Passing the "reset" parameter as "true" clears the
+  // statistics after they are reported.
+  bool OnServiceProtocolGetLayerPaintProfile(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
+  // Service protocol handler
+  //
+  // Returns the events of the |fml::tracing::TraceRecorder| as a string in
+  // the JSON trace event format.
+  bool OnServiceProtocolGetRecordedTrace(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
+  // Service protocol handler
+  //
+  // Reports the bytes of the regions that the VM snapshot and the isolate
+  // snapshot of this engine are mapped in, and how many of them are resident.
+  // Engines in the process that run the same snapshots share one mapping of
+  // them, so the same bytes are reported for each of them.
+  bool OnServiceProtocolGetSnapshotMemoryUsage(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
+  // Service protocol handler
+  //
+  // Reports the counters of the caches, pipelines, buffers and image decodes
+  // of the engine, and the share of time the UI and raster threads spent on
+  // frames. Counts and sizes are totals at the time of the call, or those of
+  // the last frame for the per-frame caches. The thread usage is measured
+  // since the previous call, or since the shell was set up for the first
+  // one, so that a client polling the extension sees each interval.
+  bool OnServiceProtocolGetPerformanceCounters(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
   // Send a system font change notification.
   void SendFontChangeNotification();
 
+  // Writes the events of the |fml::tracing::TraceRecorder| to the temporary
+  // directory if |timing| is for a janky frame, at most every
+  // |kRecordedTraceDumpInterval|.
+  void DumpRecordedTraceOnJank(const FrameTiming& timing);
+
+  // Records the pages of the snapshots that are resident to the temporary
+  // directory for the next launches to prefetch, unless they were recorded
+  // already for the same snapshots.
+  void RecordSnapshotPageHints();
+
+  // Asks the Dart VM to collect garbage on the UI thread if the GPU memory
+  // allocated by the Impeller context of the rasterizer reached
+  // |Settings::gpu_memory_gc_threshold_mb|. The caches of the engine are left
+  // alone, unlike for |NotifyLowMemoryWarning|.
+  void CollectGarbageOnGpuMemoryPressure(const FrameTiming& timing);
+
+  // Applies |degradation| to the rasterizer and reports it to the framework
+  // on the system channel.
+  void OnQualityDegradationChanged(QualityDegradation degradation);
+
   // |ResourceCacheLimitItem|
   size_t GetResourceCacheLimit() override { return resource_cache_limit_; };
 
@@ -331,6 +331,12 @@ void ShellTest::OnServiceProtocol(
           case ServiceProtocolEnum::kRunInView:
             shell->OnServiceProtocolRunInView(params, response);
             break;
+          case ServiceProtocolEnum::kGetSnapshotMemoryUsage:
+            shell->OnServiceProtocolGetSnapshotMemoryUsage(params, response);
+            break;
+          case ServiceProtocolEnum::kGetPerformanceCounters:
+            shell->OnServiceProtocolGetPerformanceCounters(params, response);
+            break;
         }
         finished.set_value(true);
       });
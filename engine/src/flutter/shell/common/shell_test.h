@@ -142,6 +142,8 @@ class ShellTest : public FixtureTest {
     kEstimateRasterCacheMemory,
     kSetAssetBundlePath,
     kRunInView,
+    kGetSnapshotMemoryUsage,
+    kGetPerformanceCounters,
   };
 
   // Helper method to test private method Shell::OnServiceProtocolGetSkSLs.
@@ -2603,6 +2603,75 @@ TEST_F(ShellTest, OnServiceProtocolEstimateRasterCacheMemoryWorks) {
   DestroyShell(std::move(shell));
 }
 
+TEST_F(ShellTest, OnServiceProtocolGetSnapshotMemoryUsageWorks) {
+  auto settings = CreateSettingsForFixture();
+  auto shell = CreateShell(settings);
+  ASSERT_TRUE(ValidateShell(shell.get()));
+
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  ASSERT_TRUE(configuration.IsValid());
+  configuration.SetEntrypoint("emptyMain");
+  RunEngine(shell.get(), std::move(configuration));
+
+  ServiceProtocol::Handler::ServiceProtocolMap empty_params;
+  rapidjson::Document document;
+  OnServiceProtocol(shell.get(), ServiceProtocolEnum::kGetSnapshotMemoryUsage,
+                    shell->GetTaskRunners().GetUITaskRunner(), empty_params,
+                    &document);
+  ASSERT_TRUE(document.IsObject());
+  EXPECT_STREQ(document["type"].GetString(), "SnapshotMemoryUsage");
+  for (const char* snapshot : {"vmSnapshot", "isolateSnapshot"}) {
+    ASSERT_TRUE(document.HasMember(snapshot)) << snapshot;
+    const auto& usage = document[snapshot];
+    ASSERT_TRUE(usage["mappedBytes"].IsUint64());
+    EXPECT_LE(usage["residentBytes"].GetUint64(),
+              usage["mappedBytes"].GetUint64());
+  }
+
+  DestroyShell(std::move(shell));
+}
+
+TEST_F(ShellTest, OnServiceProtocolGetPerformanceCountersWorks) {
+  auto settings = CreateSettingsForFixture();
+  fml::AutoResetWaitableEvent rasterized_latch;
+  settings.frame_rasterized_callback =
+      [&rasterized_latch](const FrameTiming&) { rasterized_latch.Signal(); };
+  auto shell = CreateShell(settings);
+  ASSERT_TRUE(ValidateShell(shell.get()));
+  PlatformViewNotifyCreated(shell.get());
+
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  ASSERT_TRUE(configuration.IsValid());
+  configuration.SetEntrypoint("emptyMain");
+  RunEngine(shell.get(), std::move(configuration));
+  PumpOneFrame(shell.get());
+  rasterized_latch.Wait();
+
+  ServiceProtocol::Handler::ServiceProtocolMap empty_params;
+  rapidjson::Document document;
+  OnServiceProtocol(shell.get(), ServiceProtocolEnum::kGetPerformanceCounters,
+                    shell->GetTaskRunners().GetRasterTaskRunner(),
+                    empty_params, &document);
+  ASSERT_TRUE(document.IsObject());
+  EXPECT_STREQ(document["type"].GetString(), "PerformanceCounters");
+  const auto& threads = document["threads"];
+  EXPECT_GE(threads["frameCount"].GetUint64(), 1u);
+  EXPECT_GT(threads["intervalMicros"].GetInt64(), 0);
+  EXPECT_GE(threads["uiBusyPercent"].GetDouble(), 0.0);
+  EXPECT_LE(threads["rasterBusyPercent"].GetDouble(), 100.0);
+  ASSERT_TRUE(document.HasMember("imageDecodes"));
+  EXPECT_EQ(document["imageDecodes"]["queueDepth"].GetUint64(), 0u);
+
+  // The thread usage of the next poll only covers the frames since this one.
+  rapidjson::Document next_document;
+  OnServiceProtocol(shell.get(), ServiceProtocolEnum::kGetPerformanceCounters,
+                    shell->GetTaskRunners().GetRasterTaskRunner(),
+                    empty_params, &next_document);
+  EXPECT_EQ(next_document["threads"]["frameCount"].GetUint64(), 0u);
+
+  DestroyShell(std::move(shell));
+}
+
 // TODO(https://github.com/flutter/flutter/issues/100273): Disabled due to
 // flakiness.
 // TODO(https://github.com/flutter/flutter/issues/100299): Fix it when
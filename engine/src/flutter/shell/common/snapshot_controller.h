@@ -7,6 +7,7 @@
 
 #include "flutter/common/settings.h"
 #include "flutter/display_list/image/dl_image.h"
+#include "flutter/flow/snapshot_surface_pool.h"
 #include "flutter/flow/surface.h"
 #include "flutter/fml/synchronization/sync_switch.h"
 #include "flutter/lib/ui/snapshot_delegate.h"
@@ -31,6 +32,19 @@ class SnapshotController {
     GetSnapshotSurfaceProducer() const = 0;
     virtual std::shared_ptr<const fml::SyncSwitch> GetIsGpuDisabledSyncSwitch()
         const = 0;
+#if !SLIMPELLER
+    /// The pool of render targets for snapshots rendered into the context of
+    /// |GetSurface|, if any.
+    virtual SkiaSnapshotSurfacePool* GetSkiaSnapshotSurfacePool() const {
+      return nullptr;
+    }
+#endif  //  !SLIMPELLER
+    /// The pool of multisample attachments for snapshots rendered with
+    /// |GetAiksContext|, if any.
+    virtual ImpellerSnapshotTexturePool* GetImpellerSnapshotTexturePool()
+        const {
+      return nullptr;
+    }
   };
 
   static std::unique_ptr<SnapshotController> Make(const Delegate& delegate,
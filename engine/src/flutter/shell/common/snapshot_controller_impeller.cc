@@ -23,7 +23,8 @@ sk_sp<DlImage> DoMakeRasterSnapshot(
     const sk_sp<DisplayList>& display_list,
     DlISize size,
     const std::shared_ptr<impeller::AiksContext>& context,
-    SnapshotPixelFormat pixel_format) {
+    SnapshotPixelFormat pixel_format,
+    ImpellerSnapshotTexturePool* pool) {
   TRACE_EVENT0("flutter", __FUNCTION__);
   if (!context) {
     return nullptr;
@@ -61,12 +62,35 @@ sk_sp<DlImage> DoMakeRasterSnapshot(
       break;
   }
 
-  return impeller::DlImageImpeller::Make(
-      impeller::DisplayListToTexture(display_list, render_target_size, *context,
-                                     /*reset_host_buffer=*/false,
-                                     /*generate_mips=*/true,
-                                     impeller_pixel_format),
-      DlImage::OwningContext::kRaster);
+  // Snapshots of the same size share their multisample attachment. The
+  // resolved texture is the resulting image and is never pooled.
+  ImpellerSnapshotTexturePool::Key pool_key{
+      .size = DlISize(static_cast<int32_t>(render_target_size.width),
+                      static_cast<int32_t>(render_target_size.height)),
+      .format = static_cast<uint32_t>(
+          impeller_pixel_format.value_or(impeller::PixelFormat::kUnknown)),
+  };
+  std::shared_ptr<impeller::Texture> msaa_texture;
+  if (pool) {
+    msaa_texture = pool->Acquire(pool_key);
+  }
+
+  std::shared_ptr<impeller::Texture> texture = impeller::DisplayListToTexture(
+      display_list, render_target_size, *context,
+      /*reset_host_buffer=*/false,
+      /*generate_mips=*/true, impeller_pixel_format,
+      pool ? &msaa_texture : nullptr);
+
+  if (pool && msaa_texture) {
+    const impeller::TextureDescriptor& desc =
+        msaa_texture->GetTextureDescriptor();
+    size_t byte_size = desc.GetByteSizeOfBaseMipLevel() *
+                       static_cast<size_t>(desc.sample_count);
+    pool->Release(pool_key, std::move(msaa_texture), byte_size);
+  }
+
+  return impeller::DlImageImpeller::Make(texture,
+                                         DlImage::OwningContext::kRaster);
 }
 
 sk_sp<DlImage> DoMakeRasterSnapshot(
@@ -89,7 +113,8 @@ sk_sp<DlImage> DoMakeRasterSnapshot(
   }
 
   return DoMakeRasterSnapshot(display_list, size, delegate.GetAiksContext(),
-                              pixel_format);
+                              pixel_format,
+                              delegate.GetImpellerSnapshotTexturePool());
 }
 
 sk_sp<DlImage> DoMakeRasterSnapshot(
@@ -106,7 +131,7 @@ sk_sp<DlImage> DoMakeRasterSnapshot(
                            .SetIfFalse([&] {
                              result = DoMakeRasterSnapshot(
                                  display_list, picture_size, context,
-                                 pixel_format);
+                                 pixel_format, /*pool=*/nullptr);
                            }));
 
   return result;
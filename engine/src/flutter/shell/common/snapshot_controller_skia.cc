@@ -10,6 +10,7 @@
 #include "flutter/flow/surface.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/shell/common/snapshot_controller.h"
+#include "third_party/skia/include/core/SkCanvas.h"
 #include "third_party/skia/include/core/SkColorSpace.h"
 #include "third_party/skia/include/core/SkSurface.h"
 #include "third_party/skia/include/gpu/ganesh/SkSurfaceGanesh.h"
@@ -116,13 +117,35 @@ sk_sp<DlImage> SnapshotControllerSkia::DoMakeRasterSnapshot(
                     static_cast<double>(image_info.height()) * scale_factor);
               }
 
+              // The pbuffer surfaces only live for a single snapshot, so only
+              // reuse render targets of the on screen surface.
+              SkiaSnapshotSurfacePool* pool =
+                  pbuffer_surface ? nullptr
+                                  : delegate.GetSkiaSnapshotSurfacePool();
+              SkiaSnapshotSurfacePool::Key pool_key{
+                  .size = DlISize(image_info.width(), image_info.height())};
+
               // When there is an on screen surface, we need a render target
               // SkSurface because we want to access texture backed images.
-              sk_sp<SkSurface> sk_surface =
-                  SkSurfaces::RenderTarget(context,               // context
-                                           skgpu::Budgeted::kNo,  // budgeted
-                                           image_info             // image info
-                  );
+              sk_sp<SkSurface> sk_surface;
+              if (pool) {
+                sk_surface = pool->Acquire(pool_key);
+                if (sk_surface && sk_surface->recordingContext() != context) {
+                  sk_surface = nullptr;
+                }
+              }
+              if (sk_surface) {
+                SkCanvas* canvas = sk_surface->getCanvas();
+                canvas->restoreToCount(1);
+                canvas->resetMatrix();
+                canvas->clear(SK_ColorTRANSPARENT);
+              } else {
+                sk_surface = SkSurfaces::RenderTarget(
+                    context,               // context
+                    skgpu::Budgeted::kNo,  // budgeted
+                    image_info             // image info
+                );
+              }
               if (!sk_surface) {
                 FML_LOG(ERROR)
                     << "DoMakeRasterSnapshot can not create GPU render target";
@@ -131,6 +154,13 @@ sk_sp<DlImage> SnapshotControllerSkia::DoMakeRasterSnapshot(
 
               sk_surface->getCanvas()->scale(scale_factor, scale_factor);
               result = DrawSnapshot(sk_surface, draw_callback);
+
+              // The result is a copy in host memory, so the render target can
+              // be reused by the next snapshot of the same size.
+              if (pool) {
+                pool->Release(pool_key, std::move(sk_surface),
+                              image_info.computeMinByteSize());
+              }
             }));
   }
 
@@ -0,0 +1,103 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/startup_timeline.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+
+namespace flutter {
+
+StartupTimeline::ScopedStep::ScopedStep(StartupTimeline* timeline,
+                                        std::string name,
+                                        std::vector<std::string> dependencies)
+    : timeline_(timeline),
+      name_(std::move(name)),
+      dependencies_(std::move(dependencies)),
+      start_(fml::TimePoint::Now()) {}
+
+StartupTimeline::ScopedStep::~ScopedStep() {
+  if (timeline_) {
+    timeline_->RecordStep(std::move(name_), start_, fml::TimePoint::Now(),
+                          std::move(dependencies_));
+  }
+}
+
+StartupTimeline::StartupTimeline() = default;
+
+StartupTimeline::~StartupTimeline() = default;
+
+void StartupTimeline::RecordStep(std::string name,
+                                 fml::TimePoint start,
+                                 fml::TimePoint end,
+                                 std::vector<std::string> dependencies) {
+  std::scoped_lock lock(mutex_);
+  steps_.push_back({
+      .name = std::move(name),
+      .start = start,
+      .end = end,
+      .dependencies = std::move(dependencies),
+  });
+}
+
+const StartupTimeline::Step* StartupTimeline::FindStep(
+    const std::string& name) const {
+  auto it =
+      std::find_if(steps_.begin(), steps_.end(),
+                   [&name](const Step& step) { return step.name == name; });
+  return it == steps_.end() ? nullptr : &*it;
+}
+
+std::vector<StartupTimeline::Step> StartupTimeline::GetCriticalPath(
+    const std::string& last_step) const {
+  std::scoped_lock lock(mutex_);
+  std::vector<Step> path;
+  const Step* step = FindStep(last_step);
+  // Dependencies end before the steps that wait for them. The bound on the
+  // length of the path only guards against cycles in malformed timelines.
+  while (step && path.size() <= steps_.size()) {
+    path.push_back(*step);
+    const Step* critical_dependency = nullptr;
+    for (const std::string& name : step->dependencies) {
+      const Step* dependency = FindStep(name);
+      if (dependency && (!critical_dependency ||
+                         dependency->end > critical_dependency->end)) {
+        critical_dependency = dependency;
+      }
+    }
+    step = critical_dependency;
+  }
+  std::reverse(path.begin(), path.end());
+  return path;
+}
+
+std::string StartupTimeline::CriticalPathToString(
+    const std::string& last_step) const {
+  std::vector<Step> path = GetCriticalPath(last_step);
+  if (path.empty()) {
+    return "";
+  }
+  std::stringstream stream;
+  stream << std::fixed << std::setprecision(2);
+  const fml::TimePoint origin = path.front().start;
+  stream << "Startup critical path ("
+         << (path.back().end - origin).ToMillisecondsF() << "ms):";
+  for (size_t i = 0; i < path.size(); i++) {
+    const Step& step = path[i];
+    stream << std::endl << "  " << step.name << ": ran "
+           << (step.end - step.start).ToMillisecondsF() << "ms";
+    if (i > 0) {
+      // A step that started before its dependency ended blocked on it, and
+      // that time is counted in its duration instead.
+      fml::TimeDelta wait = std::max(step.start - path[i - 1].end,
+                                     fml::TimeDelta::Zero());
+      stream << ", waited " << wait.ToMillisecondsF() << "ms";
+    }
+  }
+  return stream.str();
+}
+
+}  // namespace flutter
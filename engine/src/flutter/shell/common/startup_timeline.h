@@ -0,0 +1,93 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_STARTUP_TIMELINE_H_
+#define FLUTTER_SHELL_COMMON_STARTUP_TIMELINE_H_
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// Records the steps of shell startup, when each ran, and which steps each
+/// one had to wait for. This tells which chain of steps (the critical path)
+/// determined how long startup took, and how much time was lost between
+/// steps, for example waiting for a task to be picked up by another thread.
+///
+/// All methods are thread-safe.
+///
+class StartupTimeline {
+ public:
+  struct Step {
+    std::string name;
+    fml::TimePoint start;
+    fml::TimePoint end;
+    std::vector<std::string> dependencies;
+  };
+
+  //----------------------------------------------------------------------------
+  /// Records the step a scope covers. The timeline may be null, in which
+  /// case nothing is recorded.
+  ///
+  class ScopedStep {
+   public:
+    ScopedStep(StartupTimeline* timeline,
+               std::string name,
+               std::vector<std::string> dependencies = {});
+
+    ~ScopedStep();
+
+   private:
+    StartupTimeline* timeline_;
+    std::string name_;
+    std::vector<std::string> dependencies_;
+    fml::TimePoint start_;
+
+    FML_DISALLOW_COPY_AND_ASSIGN(ScopedStep);
+  };
+
+  StartupTimeline();
+
+  ~StartupTimeline();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Records a step that ran from |start| to |end| and could not
+  ///             start before the steps named in |dependencies| ended.
+  ///
+  void RecordStep(std::string name,
+                  fml::TimePoint start,
+                  fml::TimePoint end,
+                  std::vector<std::string> dependencies);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The chain of steps that ends with |last_step|, in the order
+  ///             they ran. Each step is followed by the dependency that
+  ///             ended last, as that is the one it waited for.
+  ///
+  std::vector<Step> GetCriticalPath(const std::string& last_step) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      A human readable report of the critical path ending with
+  ///             |last_step|, with the duration of each step and how long it
+  ///             waited after its dependency ended.
+  ///
+  std::string CriticalPathToString(const std::string& last_step) const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<Step> steps_;
+
+  const Step* FindStep(const std::string& name) const;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(StartupTimeline);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_STARTUP_TIMELINE_H_
@@ -0,0 +1,67 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/startup_timeline.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+fml::TimePoint AtMilliseconds(int64_t milliseconds) {
+  return fml::TimePoint::FromEpochDelta(
+      fml::TimeDelta::FromMilliseconds(milliseconds));
+}
+
+}  // namespace
+
+TEST(StartupTimelineTest, CriticalPathFollowsTheLastDependencyToEnd) {
+  StartupTimeline timeline;
+  timeline.RecordStep("PlatformView", AtMilliseconds(0), AtMilliseconds(10),
+                      {});
+  timeline.RecordStep("Rasterizer", AtMilliseconds(12), AtMilliseconds(40),
+                      {"PlatformView"});
+  timeline.RecordStep("IOManager", AtMilliseconds(11), AtMilliseconds(15),
+                      {"PlatformView"});
+  timeline.RecordStep("Engine", AtMilliseconds(45), AtMilliseconds(60),
+                      {"Rasterizer", "IOManager"});
+
+  std::vector<StartupTimeline::Step> path =
+      timeline.GetCriticalPath("Engine");
+  ASSERT_EQ(path.size(), 3u);
+  EXPECT_EQ(path[0].name, "PlatformView");
+  EXPECT_EQ(path[1].name, "Rasterizer");
+  EXPECT_EQ(path[2].name, "Engine");
+
+  EXPECT_EQ(timeline.CriticalPathToString("Engine"),
+            "Startup critical path (60.00ms):\n"
+            "  PlatformView: ran 10.00ms\n"
+            "  Rasterizer: ran 28.00ms, waited 2.00ms\n"
+            "  Engine: ran 15.00ms, waited 5.00ms");
+}
+
+TEST(StartupTimelineTest, IgnoresStepsThatWereNotRecorded) {
+  StartupTimeline timeline;
+  timeline.RecordStep("Setup", AtMilliseconds(5), AtMilliseconds(6),
+                      {"Engine"});
+
+  std::vector<StartupTimeline::Step> path = timeline.GetCriticalPath("Setup");
+  ASSERT_EQ(path.size(), 1u);
+  EXPECT_EQ(path[0].name, "Setup");
+  EXPECT_TRUE(timeline.GetCriticalPath("Engine").empty());
+  EXPECT_EQ(timeline.CriticalPathToString("Engine"), "");
+}
+
+TEST(StartupTimelineTest, ScopedStepWithoutTimelineRecordsNothing) {
+  StartupTimeline timeline;
+  { StartupTimeline::ScopedStep step(nullptr, "Setup"); }
+  { StartupTimeline::ScopedStep step(&timeline, "Engine"); }
+  EXPECT_TRUE(timeline.GetCriticalPath("Setup").empty());
+  EXPECT_EQ(timeline.GetCriticalPath("Engine").size(), 1u);
+}
+
+}  // namespace testing
+}  // namespace flutter
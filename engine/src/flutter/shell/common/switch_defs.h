@@ -79,6 +79,12 @@ DEF_SWITCH(
     "disable-vm-service",
     "Disable the Dart VM Service. The Dart VM Service is never available "
     "in release mode.")
+DEF_SWITCH(DeferVMServiceServer,
+           "defer-vm-service-server",
+           "Start the Dart VM Service isolate without binding its HTTP server. "
+           "The server is only started once the application requests it, "
+           "for example with Service.controlWebServer from dart:developer. "
+           "This keeps profile mode launches closer to release mode.")
 DEF_SWITCH(DisableVMServicePublication,
            "disable-vm-service-publication",
            "Disable mDNS Dart VM Service publication.")
@@ -167,6 +173,21 @@ DEF_SWITCH(PurgePersistentCache,
            "purge-persistent-cache",
            "Remove all existing persistent cache. This is mainly for debugging "
            "purposes such as reproducing the shader compilation jank.")
+DEF_SWITCH(EnableSkiaPictureCache,
+           "enable-skia-picture-cache",
+           "Draw the pictures that are unchanged for a few frames from "
+           "recorded SkPictures, which Skia replays with fewer CPU cycles than "
+           "the DisplayList ops. Only used by the Skia backend.")
+DEF_SWITCH(PersistentCacheMaxBytes,
+           "persistent-cache-max-bytes",
+           "The max bytes of shaders kept in the persistent cache, or 0 for "
+           "unlimited. The least recently used shaders are removed first.")
+DEF_SWITCH(ComplexityCalibrationPath,
+           "complexity-calibration-path",
+           "Load a DisplayList complexity calibration profile, as written by "
+           "the display_list_benchmarks suite, from the specified path. The "
+           "profile corrects the cost estimates used to decide which pictures "
+           "are worth caching for the device it was measured on.")
 DEF_SWITCH(
     TraceSystrace,
     "trace-systrace",
@@ -222,6 +243,116 @@ DEF_SWITCH(EnableSerialGC,
            "GC tasks on threads can cause them to contend with the UI thread "
            "which could potentially lead to jank. This option turns off all "
            "concurrent GC activities")
+DEF_SWITCH(EnableParallelPreroll,
+           "enable-parallel-preroll",
+           "Preroll large sets of sibling layers, such as big grids of "
+           "pictures, in parallel on the concurrent worker pool instead of on "
+           "the raster thread alone.")
+DEF_SWITCH(EnableParallelRecording,
+           "enable-parallel-recording",
+           "When using Impeller, collect the text and backdrop filters of "
+           "independent save layers of each frame in parallel on the "
+           "concurrent worker pool instead of on the raster thread alone.")
+DEF_SWITCH(ProfileLayerPaint,
+           "profile-layer-paint",
+           "Attribute the time spent painting each frame to the individual "
+           "layers of the layer tree. Every painted layer emits a timeline "
+           "event and the accumulated statistics are available through the "
+           "_flutter.getLayerPaintProfile service protocol extension.")
+DEF_SWITCH(FramePipelineMode,
+           "frame-pipeline-mode",
+           "Selects how frames are pipelined between the UI and raster "
+           "threads. 'latency' keeps one frame in flight and builds it just "
+           "in time for the vsync, 'throughput' keeps up to three frames in "
+           "flight, and 'adaptive' switches between the two based on the "
+           "recent frame timings.")
+DEF_SWITCH(EnablePredictiveFrameScheduling,
+           "enable-predictive-frame-scheduling",
+           "Start building a frame ahead of its vsync when the moving "
+           "estimate of the build time plus the recent raster time exceeds "
+           "the frame interval.")
+DEF_SWITCH(PrioritizeVsyncFrames,
+           "prioritize-vsync-frames",
+           "Run the frame started by a vsync on the UI thread before the other "
+           "tasks that are due, such as platform messages. Pointer events "
+           "queued before the vsync are then dispatched after the frame.")
+DEF_SWITCH(EnablePointerResampling,
+           "enable-pointer-resampling",
+           "Coalesce the pointer moves and hovers delivered between two "
+           "frames into a single event per device, resampled at the vsync. "
+           "Reduces the input handling cost of devices polled faster than "
+           "the display refreshes.")
+DEF_SWITCH(ThreadCpuAffinity,
+           "thread-cpu-affinity",
+           "Comma-separated thread:cores pairs that place the engine threads "
+           "on the cores of a given speed, on devices whose cores have "
+           "different speeds. The threads are 'ui', 'raster', 'io' and "
+           "'worker', and the cores are 'performance', 'efficiency', "
+           "'not-performance' and 'not-efficiency'. For example, "
+           "'raster:performance,io:efficiency'. Only honored on Android.")
+DEF_SWITCH(DumpRecordedTraceOnJank,
+           "dump-recorded-trace-on-jank",
+           "Write the recently recorded trace events, in the JSON trace event "
+           "format, to the temporary directory when a frame takes more than "
+           "twice its budget. The events are recorded in all runtime modes.")
+DEF_SWITCH(PrefetchSnapshotPages,
+           "prefetch-snapshot-pages",
+           "Record the pages of the Dart snapshots that were read in by the "
+           "time the first frame was rasterized to the cache directory, and "
+           "have the next launches read those pages in ahead of time in the "
+           "background.")
+DEF_SWITCH(FrameBudgetWatchdogMisses,
+           "frame-budget-watchdog-misses",
+           "Reduce the rendering quality in steps every time this many "
+           "consecutive frames take longer than the frame budget to "
+           "rasterize, and restore it once frames fit again. Each step is "
+           "reported to the framework on the flutter/system channel. By "
+           "default, the quality is never reduced.")
+DEF_SWITCH(GpuMemoryGcThresholdMb,
+           "gpu-memory-gc-threshold-mb",
+           "Ask the Dart VM to collect garbage when the GPU memory allocated "
+           "by Impeller reaches this many megabytes after a frame, so that "
+           "the textures of unreachable images and pictures are released "
+           "sooner. This is only supported on the Metal and Vulkan backends. "
+           "By default, the GPU memory does not trigger collections.")
+DEF_SWITCH(TaskWakeUpSlackUs,
+           "task-wake-up-slack-us",
+           "Let the tasks posted to the engine threads run up to this many "
+           "microseconds late when their thread is already due to wake up "
+           "by then, instead of waking it up again. A value of 0 only skips "
+           "the wake ups that would not make any task run sooner. By "
+           "default, every posted task wakes up its thread.")
+DEF_SWITCH(BackgroundIsolatePoolSize,
+           "background-isolate-pool-size",
+           "The number of idle background isolates that are spawned ahead of "
+           "time, once the engine is first idle, to run the computations of "
+           "runOnBackgroundIsolate without spawning an isolate for each. "
+           "'auto' sizes the pool from the number of cores. By default, "
+           "there is no pool.")
+DEF_SWITCH(ImageDecodeMaxBytesInFlight,
+           "image-decode-max-bytes-in-flight",
+           "The max bytes of decoded pixels that the images being decoded at "
+           "once may take, or 0 for unlimited. The decodes that don't fit "
+           "wait, and the most recently requested one starts first.")
+DEF_SWITCH(AnimatedImageLookaheadFrames,
+           "animated-image-lookahead-frames",
+           "How many frames of an animated image are decoded ahead of the "
+           "frame being shown, on a worker thread. Each frame decoded ahead "
+           "takes the memory of a decoded frame. Defaults to 0.")
+DEF_SWITCH(EnableHardwareImageDecoding,
+           "enable-hardware-image-decoding",
+           "Decode JPEG and HEIF images with the image decoders of the "
+           "platform, which use the hardware decoders of the device where "
+           "there are some, straight into textures where the backend allows "
+           "it. Only honored with Impeller, on iOS and on Android API level "
+           "31 and above.")
+DEF_SWITCH(ImpellerCompressImagesOnLowMemory,
+           "impeller-compress-images-on-low-memory",
+           "Once the platform warns that memory is low, compress the images "
+           "that are decoded next to a block compressed texture format on "
+           "the CPU, which takes a quarter of the memory of a decoded image "
+           "at the cost of some quality. Only honored with Impeller on the "
+           "backends that support such formats.")
 DEF_SWITCH(DisallowInsecureConnections,
            "disallow-insecure-connections",
            "By default, dart:io allows all socket connections. If this switch "
@@ -252,6 +383,20 @@ DEF_SWITCH(ImpellerBackend,
            "impeller-backend",
            "Requests a particular Impeller backend on platforms that support "
            "multiple backends. (ex `opengles` or `vulkan`)")
+DEF_SWITCH(ImpellerVulkanAllowlist,
+           "impeller-vulkan-allowlist",
+           "A comma-separated list of Android board, hardware or SoC names on "
+           "which Impeller tries Vulkan even when the device would otherwise "
+           "use OpenGLES.")
+DEF_SWITCH(ImpellerVulkanDenylist,
+           "impeller-vulkan-denylist",
+           "A comma-separated list of Android board, hardware or SoC names on "
+           "which Impeller uses OpenGLES instead of Vulkan.")
+DEF_SWITCH(ImpellerVulkanBundledPipelineCaches,
+           "impeller-vulkan-bundled-pipeline-caches",
+           "A comma-separated list of paths of pipeline cache files shipped "
+           "with the application. The file generated on the same GPU model "
+           "and driver is merged into the Impeller Vulkan pipeline cache.")
 DEF_SWITCH(EnableVulkanValidation,
            "enable-vulkan-validation",
            "Enable loading Vulkan validation layers. The layers must be "
@@ -6,9 +6,12 @@
 #include <iomanip>
 #include <iostream>
 #include <iterator>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <string_view>
 
+#include "flutter/fml/cpu_affinity.h"
 #include "flutter/fml/native_library.h"
 #include "flutter/fml/paths.h"
 #include "flutter/shell/version/version.h"
@@ -162,6 +165,48 @@ static std::vector<std::string> ParseCommaDelimited(const std::string& input) {
   return result;
 }
 
+static std::optional<fml::CpuAffinity> CpuAffinityFromName(
+    std::string_view name) {
+  if (name == "performance") {
+    return fml::CpuAffinity::kPerformance;
+  } else if (name == "efficiency") {
+    return fml::CpuAffinity::kEfficiency;
+  } else if (name == "not-performance") {
+    return fml::CpuAffinity::kNotPerformance;
+  } else if (name == "not-efficiency") {
+    return fml::CpuAffinity::kNotEfficiency;
+  }
+  return std::nullopt;
+}
+
+static void ParseThreadCpuAffinity(const std::string& input,
+                                   Settings& settings) {
+  for (const std::string& placement : ParseCommaDelimited(input)) {
+    const size_t separator = placement.find(':');
+    std::optional<fml::CpuAffinity> affinity;
+    std::optional<fml::CpuAffinity>* thread_affinity = nullptr;
+    if (separator != std::string::npos) {
+      affinity = CpuAffinityFromName(
+          std::string_view(placement).substr(separator + 1));
+      const std::string thread = placement.substr(0, separator);
+      if (thread == "ui") {
+        thread_affinity = &settings.ui_thread_cpu_affinity;
+      } else if (thread == "raster") {
+        thread_affinity = &settings.raster_thread_cpu_affinity;
+      } else if (thread == "io") {
+        thread_affinity = &settings.io_thread_cpu_affinity;
+      } else if (thread == "worker") {
+        thread_affinity = &settings.worker_thread_cpu_affinity;
+      }
+    }
+    if (!affinity.has_value() || thread_affinity == nullptr) {
+      FML_LOG(ERROR) << "Unknown thread CPU affinity: " << placement;
+      continue;
+    }
+    *thread_affinity = affinity;
+  }
+}
+
 static bool IsAllowedDartVMFlag(const std::string& flag) {
   for (uint32_t i = 0; i < std::size(kAllowedDartFlags); ++i) {
     const std::string& allowed = kAllowedDartFlags[i];
@@ -240,6 +285,10 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line,
   settings.enable_vm_service =
       !command_line.HasOption(FlagForSwitch(Switch::DisableVMService));
 
+  // Defer starting the VM Service HTTP server
+  settings.defer_vm_service_server =
+      command_line.HasOption(FlagForSwitch(Switch::DeferVMServiceServer));
+
   // Enable mDNS VM Service Publication
   settings.enable_vm_service_publication = !command_line.HasOption(
       FlagForSwitch(Switch::DisableVMServicePublication));
@@ -310,6 +359,15 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line,
   settings.enable_serial_gc =
       command_line.HasOption(FlagForSwitch(Switch::EnableSerialGC));
 
+  settings.enable_parallel_preroll =
+      command_line.HasOption(FlagForSwitch(Switch::EnableParallelPreroll));
+
+  settings.enable_parallel_recording =
+      command_line.HasOption(FlagForSwitch(Switch::EnableParallelRecording));
+
+  settings.enable_layer_paint_profiling =
+      command_line.HasOption(FlagForSwitch(Switch::ProfileLayerPaint));
+
 #if !FLUTTER_RELEASE
   settings.trace_skia = true;
 
@@ -455,6 +513,25 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line,
     }
   }
 
+  std::string impeller_vulkan_allowlist;
+  command_line.GetOptionValue(FlagForSwitch(Switch::ImpellerVulkanAllowlist),
+                              &impeller_vulkan_allowlist);
+  settings.impeller_vulkan_allowlist =
+      ParseCommaDelimited(impeller_vulkan_allowlist);
+
+  std::string impeller_vulkan_denylist;
+  command_line.GetOptionValue(FlagForSwitch(Switch::ImpellerVulkanDenylist),
+                              &impeller_vulkan_denylist);
+  settings.impeller_vulkan_denylist =
+      ParseCommaDelimited(impeller_vulkan_denylist);
+
+  std::string impeller_vulkan_bundled_pipeline_caches;
+  command_line.GetOptionValue(
+      FlagForSwitch(Switch::ImpellerVulkanBundledPipelineCaches),
+      &impeller_vulkan_bundled_pipeline_caches);
+  settings.impeller_vulkan_bundled_pipeline_caches =
+      ParseCommaDelimited(impeller_vulkan_bundled_pipeline_caches);
+
   settings.enable_vulkan_validation =
       command_line.HasOption(FlagForSwitch(Switch::EnableVulkanValidation));
   settings.enable_opengl_gpu_tracing =
@@ -494,6 +571,20 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line,
   settings.purge_persistent_cache =
       command_line.HasOption(FlagForSwitch(Switch::PurgePersistentCache));
 
+  settings.enable_skia_picture_cache =
+      command_line.HasOption(FlagForSwitch(Switch::EnableSkiaPictureCache));
+
+  if (command_line.HasOption(FlagForSwitch(Switch::PersistentCacheMaxBytes))) {
+    std::string persistent_cache_max_bytes;
+    command_line.GetOptionValue(FlagForSwitch(Switch::PersistentCacheMaxBytes),
+                                &persistent_cache_max_bytes);
+    settings.persistent_cache_max_bytes =
+        std::stoull(persistent_cache_max_bytes);
+  }
+
+  command_line.GetOptionValue(FlagForSwitch(Switch::ComplexityCalibrationPath),
+                              &settings.complexity_calibration_path);
+
   if (command_line.HasOption(FlagForSwitch(Switch::OldGenHeapSize))) {
     std::string old_gen_heap_size;
     command_line.GetOptionValue(FlagForSwitch(Switch::OldGenHeapSize),
@@ -517,6 +608,110 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line,
   settings.enable_surface_control = command_line.HasOption(
       FlagForSwitch(Switch::EnableAndroidSurfaceControl));
 
+  if (command_line.HasOption(FlagForSwitch(Switch::FramePipelineMode))) {
+    std::string frame_pipeline_mode;
+    command_line.GetOptionValue(FlagForSwitch(Switch::FramePipelineMode),
+                                &frame_pipeline_mode);
+    if (frame_pipeline_mode == "latency") {
+      settings.frame_pipeline_mode = Settings::FramePipelineMode::kLowLatency;
+    } else if (frame_pipeline_mode == "throughput") {
+      settings.frame_pipeline_mode = Settings::FramePipelineMode::kThroughput;
+    } else if (frame_pipeline_mode == "adaptive") {
+      settings.frame_pipeline_mode = Settings::FramePipelineMode::kAdaptive;
+    } else {
+      FML_LOG(ERROR) << "Unknown frame pipeline mode: " << frame_pipeline_mode;
+    }
+  }
+
+  settings.enable_predictive_frame_scheduling = command_line.HasOption(
+      FlagForSwitch(Switch::EnablePredictiveFrameScheduling));
+
+  settings.prioritize_vsync_frames =
+      command_line.HasOption(FlagForSwitch(Switch::PrioritizeVsyncFrames));
+
+  settings.enable_pointer_resampling =
+      command_line.HasOption(FlagForSwitch(Switch::EnablePointerResampling));
+
+  if (command_line.HasOption(FlagForSwitch(Switch::ThreadCpuAffinity))) {
+    std::string thread_cpu_affinity;
+    command_line.GetOptionValue(FlagForSwitch(Switch::ThreadCpuAffinity),
+                                &thread_cpu_affinity);
+    ParseThreadCpuAffinity(thread_cpu_affinity, settings);
+  }
+
+  settings.dump_recorded_trace_on_jank =
+      command_line.HasOption(FlagForSwitch(Switch::DumpRecordedTraceOnJank));
+
+  settings.prefetch_snapshot_pages =
+      command_line.HasOption(FlagForSwitch(Switch::PrefetchSnapshotPages));
+
+  if (command_line.HasOption(
+          FlagForSwitch(Switch::FrameBudgetWatchdogMisses))) {
+    std::string frame_budget_watchdog_misses;
+    command_line.GetOptionValue(
+        FlagForSwitch(Switch::FrameBudgetWatchdogMisses),
+        &frame_budget_watchdog_misses);
+    settings.frame_budget_watchdog_misses =
+        std::stoull(frame_budget_watchdog_misses);
+  }
+
+  if (command_line.HasOption(FlagForSwitch(Switch::GpuMemoryGcThresholdMb))) {
+    std::string gpu_memory_gc_threshold_mb;
+    command_line.GetOptionValue(FlagForSwitch(Switch::GpuMemoryGcThresholdMb),
+                                &gpu_memory_gc_threshold_mb);
+    settings.gpu_memory_gc_threshold_mb =
+        std::stoull(gpu_memory_gc_threshold_mb);
+  }
+
+  if (command_line.HasOption(FlagForSwitch(Switch::TaskWakeUpSlackUs))) {
+    std::string task_wake_up_slack_us;
+    command_line.GetOptionValue(FlagForSwitch(Switch::TaskWakeUpSlackUs),
+                                &task_wake_up_slack_us);
+    settings.task_wake_up_slack =
+        fml::TimeDelta::FromMicroseconds(std::stoll(task_wake_up_slack_us));
+  }
+
+  if (command_line.HasOption(
+          FlagForSwitch(Switch::BackgroundIsolatePoolSize))) {
+    std::string background_isolate_pool_size;
+    command_line.GetOptionValue(
+        FlagForSwitch(Switch::BackgroundIsolatePoolSize),
+        &background_isolate_pool_size);
+    if (background_isolate_pool_size == "auto") {
+      settings.background_isolate_pool_size =
+          Settings::kBackgroundIsolatePoolSizeFromCores;
+    } else {
+      settings.background_isolate_pool_size =
+          std::max(std::stoi(background_isolate_pool_size), 0);
+    }
+  }
+
+  if (command_line.HasOption(
+          FlagForSwitch(Switch::ImageDecodeMaxBytesInFlight))) {
+    std::string image_decode_max_bytes_in_flight;
+    command_line.GetOptionValue(
+        FlagForSwitch(Switch::ImageDecodeMaxBytesInFlight),
+        &image_decode_max_bytes_in_flight);
+    settings.image_decode_max_bytes_in_flight =
+        std::stoull(image_decode_max_bytes_in_flight);
+  }
+
+  if (command_line.HasOption(
+          FlagForSwitch(Switch::AnimatedImageLookaheadFrames))) {
+    std::string animated_image_lookahead_frames;
+    command_line.GetOptionValue(
+        FlagForSwitch(Switch::AnimatedImageLookaheadFrames),
+        &animated_image_lookahead_frames);
+    settings.animated_image_lookahead_frames =
+        std::stoi(animated_image_lookahead_frames);
+  }
+
+  settings.enable_hardware_image_decoding = command_line.HasOption(
+      FlagForSwitch(Switch::EnableHardwareImageDecoding));
+
+  settings.impeller_compress_images_on_low_memory = command_line.HasOption(
+      FlagForSwitch(Switch::ImpellerCompressImagesOnLowMemory));
+
   constexpr std::string_view kMergedThreadEnabled = "enabled";
   constexpr std::string_view kMergedThreadDisabled = "disabled";
   constexpr std::string_view kMergedThreadMergeAfterLaunch = "mergeAfterLaunch";
@@ -139,6 +139,38 @@ TEST(SwitchesTest, ProfileStartup) {
   }
 }
 
+TEST(SwitchesTest, EnableSkiaPictureCache) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--enable-skia-picture-cache"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_TRUE(settings.enable_skia_picture_cache);
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_FALSE(settings.enable_skia_picture_cache);
+  }
+}
+
+TEST(SwitchesTest, DeferVMServiceServer) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--defer-vm-service-server"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_TRUE(settings.defer_vm_service_server);
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_FALSE(settings.defer_vm_service_server);
+  }
+}
+
 #if !FLUTTER_RELEASE
 TEST(SwitchesTest, EnableAsserts) {
   fml::CommandLine command_line = fml::CommandLineFromInitializerList(
@@ -149,6 +181,345 @@ TEST(SwitchesTest, EnableAsserts) {
 }
 #endif
 
+TEST(SwitchesTest, FramePipelineMode) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--frame-pipeline-mode=latency"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.frame_pipeline_mode,
+              Settings::FramePipelineMode::kLowLatency);
+  }
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--frame-pipeline-mode=adaptive"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.frame_pipeline_mode,
+              Settings::FramePipelineMode::kAdaptive);
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.frame_pipeline_mode,
+              Settings::FramePipelineMode::kDefault);
+  }
+}
+
+TEST(SwitchesTest, EnablePredictiveFrameScheduling) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--enable-predictive-frame-scheduling"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_TRUE(settings.enable_predictive_frame_scheduling);
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_FALSE(settings.enable_predictive_frame_scheduling);
+  }
+}
+
+TEST(SwitchesTest, EnableParallelRecording) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--enable-parallel-recording"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_TRUE(settings.enable_parallel_recording);
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_FALSE(settings.enable_parallel_recording);
+  }
+}
+
+TEST(SwitchesTest, PrioritizeVsyncFrames) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--prioritize-vsync-frames"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_TRUE(settings.prioritize_vsync_frames);
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_FALSE(settings.prioritize_vsync_frames);
+  }
+}
+
+TEST(SwitchesTest, EnablePointerResampling) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--enable-pointer-resampling"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_TRUE(settings.enable_pointer_resampling);
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_FALSE(settings.enable_pointer_resampling);
+  }
+}
+
+TEST(SwitchesTest, ThreadCpuAffinity) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command",
+         "--thread-cpu-affinity=ui:performance,raster:performance,"
+         "io:efficiency,worker:not-performance,bogus:efficiency,ui"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.ui_thread_cpu_affinity, fml::CpuAffinity::kPerformance);
+    EXPECT_EQ(settings.raster_thread_cpu_affinity,
+              fml::CpuAffinity::kPerformance);
+    EXPECT_EQ(settings.io_thread_cpu_affinity, fml::CpuAffinity::kEfficiency);
+    EXPECT_EQ(settings.worker_thread_cpu_affinity,
+              fml::CpuAffinity::kNotPerformance);
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_FALSE(settings.ui_thread_cpu_affinity.has_value());
+    EXPECT_FALSE(settings.raster_thread_cpu_affinity.has_value());
+    EXPECT_FALSE(settings.io_thread_cpu_affinity.has_value());
+    EXPECT_FALSE(settings.worker_thread_cpu_affinity.has_value());
+  }
+}
+
+TEST(SwitchesTest, DumpRecordedTraceOnJank) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--dump-recorded-trace-on-jank"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_TRUE(settings.dump_recorded_trace_on_jank);
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_FALSE(settings.dump_recorded_trace_on_jank);
+  }
+}
+
+TEST(SwitchesTest, PrefetchSnapshotPages) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--prefetch-snapshot-pages"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_TRUE(settings.prefetch_snapshot_pages);
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_FALSE(settings.prefetch_snapshot_pages);
+  }
+}
+
+TEST(SwitchesTest, FrameBudgetWatchdogMisses) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--frame-budget-watchdog-misses=30"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.frame_budget_watchdog_misses, 30u);
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.frame_budget_watchdog_misses, 0u);
+  }
+}
+
+TEST(SwitchesTest, GpuMemoryGcThresholdMb) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--gpu-memory-gc-threshold-mb=256"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.gpu_memory_gc_threshold_mb, 256u);
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.gpu_memory_gc_threshold_mb, 0u);
+  }
+}
+
+TEST(SwitchesTest, TaskWakeUpSlackUs) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--task-wake-up-slack-us=500"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.task_wake_up_slack,
+              fml::TimeDelta::FromMicroseconds(500));
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_FALSE(settings.task_wake_up_slack.has_value());
+  }
+}
+
+TEST(SwitchesTest, ImageDecodeMaxBytesInFlight) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--image-decode-max-bytes-in-flight=67108864"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.image_decode_max_bytes_in_flight, 67108864u);
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.image_decode_max_bytes_in_flight, 0u);
+  }
+}
+
+TEST(SwitchesTest, BackgroundIsolatePoolSize) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--background-isolate-pool-size=3"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.background_isolate_pool_size, 3);
+  }
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--background-isolate-pool-size=auto"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.background_isolate_pool_size,
+              Settings::kBackgroundIsolatePoolSizeFromCores);
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.background_isolate_pool_size, 0);
+  }
+}
+
+TEST(SwitchesTest, AnimatedImageLookaheadFrames) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--animated-image-lookahead-frames=3"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.animated_image_lookahead_frames, 3);
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.animated_image_lookahead_frames, 0);
+  }
+}
+
+TEST(SwitchesTest, EnableHardwareImageDecoding) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--enable-hardware-image-decoding"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_TRUE(settings.enable_hardware_image_decoding);
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_FALSE(settings.enable_hardware_image_decoding);
+  }
+}
+
+TEST(SwitchesTest, ImpellerCompressImagesOnLowMemory) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--impeller-compress-images-on-low-memory"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_TRUE(settings.impeller_compress_images_on_low_memory);
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_FALSE(settings.impeller_compress_images_on_low_memory);
+  }
+}
+
+TEST(SwitchesTest, PersistentCacheMaxBytes) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--persistent-cache-max-bytes=1048576"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.persistent_cache_max_bytes, 1048576u);
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.persistent_cache_max_bytes, 0u);
+  }
+}
+
+TEST(SwitchesTest, ImpellerVulkanAllowlistAndDenylist) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command", "--impeller-vulkan-allowlist=board1,board2",
+         "--impeller-vulkan-denylist=board3"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.impeller_vulkan_allowlist,
+              (std::vector<std::string>{"board1", "board2"}));
+    EXPECT_EQ(settings.impeller_vulkan_denylist,
+              std::vector<std::string>{"board3"});
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_TRUE(settings.impeller_vulkan_allowlist.empty());
+    EXPECT_TRUE(settings.impeller_vulkan_denylist.empty());
+  }
+}
+
+TEST(SwitchesTest, ImpellerVulkanBundledPipelineCaches) {
+  {
+    fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+        {"command",
+         "--impeller-vulkan-bundled-pipeline-caches=/a/gpu1.vkcache,/a/"
+         "gpu2.vkcache"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_EQ(settings.impeller_vulkan_bundled_pipeline_caches,
+              (std::vector<std::string>{"/a/gpu1.vkcache", "/a/gpu2.vkcache"}));
+  }
+  {
+    // default
+    fml::CommandLine command_line =
+        fml::CommandLineFromInitializerList({"command"});
+    Settings settings = SettingsFromCommandLine(command_line);
+    EXPECT_TRUE(settings.impeller_vulkan_bundled_pipeline_caches.empty());
+  }
+}
+
 #ifndef OS_FUCHSIA
 TEST(SwitchesTest, RequireMergedPlatformUIThread) {
   fml::CommandLine command_line = fml::CommandLineFromInitializerList(
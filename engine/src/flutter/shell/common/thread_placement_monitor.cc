@@ -0,0 +1,47 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/thread_placement_monitor.h"
+
+#include <utility>
+
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+ThreadPlacementMonitor::ThreadPlacementMonitor(
+    const char* trace_name,
+    std::optional<fml::CpuAffinity> affinity,
+    ClusterGetter get_cluster)
+    : trace_name_(trace_name),
+      affinity_(affinity),
+      get_cluster_(std::move(get_cluster)) {}
+
+ThreadPlacementMonitor::~ThreadPlacementMonitor() = default;
+
+void ThreadPlacementMonitor::RecordWork(fml::TimePoint start,
+                                        fml::TimePoint end) {
+  if (affinity_.has_value() &&
+      end - last_affinity_request_ >= kAffinityRequestInterval) {
+    last_affinity_request_ = end;
+    fml::RequestAffinity(affinity_.value());
+  }
+
+  fml::CpuCluster cluster = get_cluster_();
+  if (cluster == fml::CpuCluster::kUnknown) {
+    // The cores are all alike, or the platform cannot tell them apart.
+    return;
+  }
+  times_.Add(cluster, end - start);
+  FML_TRACE_COUNTER(
+      "flutter", trace_name_, reinterpret_cast<int64_t>(this),  //
+      "EfficiencyMillis",
+      times_.Get(fml::CpuCluster::kEfficiency).ToMilliseconds(),  //
+      "MiddleMillis",
+      times_.Get(fml::CpuCluster::kMiddle).ToMilliseconds(),  //
+      "PerformanceMillis",
+      times_.Get(fml::CpuCluster::kPerformance).ToMilliseconds());
+}
+
+}  // namespace flutter
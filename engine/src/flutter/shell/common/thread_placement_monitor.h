@@ -0,0 +1,62 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_THREAD_PLACEMENT_MONITOR_H_
+#define FLUTTER_SHELL_COMMON_THREAD_PLACEMENT_MONITOR_H_
+
+#include <functional>
+#include <optional>
+
+#include "flutter/fml/cpu_affinity.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// Accounts for the time that the frame work of an engine thread spends on
+/// each CPU cluster, and keeps the thread on the cores that the
+/// `Settings` ask for.
+///
+/// The affinity is requested again every `kAffinityRequestInterval`, so that
+/// a thread placed on the performance cores moves off them while they are
+/// throttled and back once the throttling ends, see `fml::RequestAffinity`.
+///
+/// This must only be used on the thread it monitors.
+///
+class ThreadPlacementMonitor {
+ public:
+  static constexpr fml::TimeDelta kAffinityRequestInterval =
+      fml::TimeDelta::FromSeconds(2);
+
+  using ClusterGetter = std::function<fml::CpuCluster()>;
+
+  /// The |trace_name| is the name of the trace counter of the cluster times.
+  /// A null |affinity| leaves the thread where the embedder placed it.
+  ThreadPlacementMonitor(const char* trace_name,
+                         std::optional<fml::CpuAffinity> affinity,
+                         ClusterGetter get_cluster = fml::CurrentCpuCluster);
+
+  ~ThreadPlacementMonitor();
+
+  /// Accounts for work that ran on this thread from |start| to |end|, on the
+  /// cluster that the thread is running on now.
+  void RecordWork(fml::TimePoint start, fml::TimePoint end);
+
+  const fml::CpuClusterTimes& GetClusterTimes() const { return times_; }
+
+ private:
+  const char* trace_name_;
+  const std::optional<fml::CpuAffinity> affinity_;
+  const ClusterGetter get_cluster_;
+  fml::CpuClusterTimes times_;
+  fml::TimePoint last_affinity_request_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ThreadPlacementMonitor);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_THREAD_PLACEMENT_MONITOR_H_
@@ -0,0 +1,44 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/thread_placement_monitor.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(ThreadPlacementMonitorTest, AccountsForTimeOnEachCluster) {
+  fml::CpuCluster cluster = fml::CpuCluster::kPerformance;
+  ThreadPlacementMonitor monitor("Test", std::nullopt,
+                                 [&cluster] { return cluster; });
+  fml::TimePoint start = fml::TimePoint::Now();
+
+  monitor.RecordWork(start, start + fml::TimeDelta::FromMilliseconds(4));
+  cluster = fml::CpuCluster::kEfficiency;
+  monitor.RecordWork(start, start + fml::TimeDelta::FromMilliseconds(10));
+  cluster = fml::CpuCluster::kPerformance;
+  monitor.RecordWork(start, start + fml::TimeDelta::FromMilliseconds(3));
+
+  const fml::CpuClusterTimes& times = monitor.GetClusterTimes();
+  EXPECT_EQ(times.Get(fml::CpuCluster::kPerformance),
+            fml::TimeDelta::FromMilliseconds(7));
+  EXPECT_EQ(times.Get(fml::CpuCluster::kEfficiency),
+            fml::TimeDelta::FromMilliseconds(10));
+  EXPECT_EQ(times.Get(fml::CpuCluster::kMiddle), fml::TimeDelta::Zero());
+}
+
+TEST(ThreadPlacementMonitorTest, IgnoresUnknownCluster) {
+  ThreadPlacementMonitor monitor("Test", fml::CpuAffinity::kPerformance,
+                                 [] { return fml::CpuCluster::kUnknown; });
+  fml::TimePoint start = fml::TimePoint::Now();
+
+  monitor.RecordWork(start, start + fml::TimeDelta::FromMilliseconds(4));
+
+  EXPECT_EQ(monitor.GetClusterTimes().Get(fml::CpuCluster::kUnknown),
+            fml::TimeDelta::Zero());
+}
+
+}  // namespace testing
+}  // namespace flutter
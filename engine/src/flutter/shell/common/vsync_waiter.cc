@@ -84,6 +84,15 @@ void VsyncWaiter::ScheduleSecondaryCallback(uintptr_t id,
   AwaitVSyncForSecondaryCallback();
 }
 
+std::optional<VsyncWaiter::VsyncTimes> VsyncWaiter::GetLastVsyncTimes() const {
+  std::scoped_lock lock(callback_mutex_);
+  return last_vsync_times_;
+}
+
+void VsyncWaiter::SetPrioritizeFrames(bool prioritize_frames) {
+  prioritize_frames_ = prioritize_frames;
+}
+
 void VsyncWaiter::FireCallback(fml::TimePoint frame_start_time,
                                fml::TimePoint frame_target_time,
                                bool pause_secondary_tasks) {
@@ -94,6 +103,10 @@ void VsyncWaiter::FireCallback(fml::TimePoint frame_start_time,
 
   {
     std::scoped_lock lock(callback_mutex_);
+    last_vsync_times_ = VsyncTimes{
+        .frame_start_time = frame_start_time,
+        .frame_target_time = frame_target_time,
+    };
     callback = std::move(callback_);
     for (auto& pair : secondary_callbacks_) {
       secondary_callbacks.push_back(std::move(pair.second));
@@ -127,7 +140,7 @@ void VsyncWaiter::FireCallback(fml::TimePoint frame_start_time,
 
     fml::TaskQueueId ui_task_queue_id =
         task_runners_.GetUITaskRunner()->GetTaskQueueId();
-    task_runners_.GetUITaskRunner()->PostTask(
+    fml::closure frame_task =
         [ui_task_queue_id, callback, flow_identifier, frame_start_time,
          frame_target_time, pause_secondary_tasks]() {
           FML_TRACE_EVENT_WITH_FLOW_IDS(
@@ -143,7 +156,16 @@ void VsyncWaiter::FireCallback(fml::TimePoint frame_start_time,
           if (pause_secondary_tasks) {
             ResumeDartEventLoopTasks(ui_task_queue_id);
           }
-        });
+        };
+    if (prioritize_frames_) {
+      // The frame runs before the other due tasks of the UI thread, such as
+      // platform messages, without waiting for them.
+      task_runners_.GetUITaskRunner()->PostTaskWithGrade(
+          frame_task, fml::TaskSourceGrade::kUserInteraction,
+          frame_target_time);
+    } else {
+      task_runners_.GetUITaskRunner()->PostTask(frame_task);
+    }
   }
 
   for (auto& secondary_callback : secondary_callbacks) {
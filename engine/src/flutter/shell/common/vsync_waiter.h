@@ -8,6 +8,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <unordered_map>
 
 #include "flutter/common/task_runners.h"
@@ -35,6 +36,23 @@ class VsyncWaiter : public std::enable_shared_from_this<VsyncWaiter> {
   /// |Animator::ScheduleMaybeClearTraceFlowIds|.
   void ScheduleSecondaryCallback(uintptr_t id, const fml::closure& callback);
 
+  struct VsyncTimes {
+    fml::TimePoint frame_start_time;
+    fml::TimePoint frame_target_time;
+  };
+
+  /// The times of the most recent vsync reported by the platform, for either
+  /// a frame or secondary callbacks, or nullopt if none has been reported
+  /// yet.
+  ///
+  /// Used by the |Animator| to predict upcoming vsyncs.
+  std::optional<VsyncTimes> GetLastVsyncTimes() const;
+
+  /// Whether the frame callback runs ahead of the other due tasks of the UI
+  /// thread, see |Settings::prioritize_vsync_frames|. Must be set before the
+  /// first vsync is awaited.
+  void SetPrioritizeFrames(bool prioritize_frames);
+
  protected:
   // On some backends, the |FireCallback| needs to be made from a static C
   // method.
@@ -75,9 +93,11 @@ class VsyncWaiter : public std::enable_shared_from_this<VsyncWaiter> {
                     bool pause_secondary_tasks = true);
 
  private:
-  std::mutex callback_mutex_;
+  mutable std::mutex callback_mutex_;
   Callback callback_;
   std::unordered_map<uintptr_t, fml::closure> secondary_callbacks_;
+  std::optional<VsyncTimes> last_vsync_times_;
+  bool prioritize_frames_ = false;
 
   void PauseDartEventLoopTasks();
   static void ResumeDartEventLoopTasks(fml::TaskQueueId ui_task_queue_id);
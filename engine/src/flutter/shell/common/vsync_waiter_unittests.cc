@@ -4,9 +4,12 @@
 #define FML_USED_ON_EMBEDDER
 
 #include <initializer_list>
+#include <string>
+#include <vector>
 
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
+#include "flutter/fml/message_loop.h"
 #include "flutter/shell/common/switches.h"
 
 #include "gtest/gtest.h"
@@ -23,6 +26,10 @@ class TestVsyncWaiter : public VsyncWaiter {
 
   int await_vsync_call_count_ = 0;
 
+  void Fire(fml::TimePoint frame_start_time, fml::TimePoint frame_target_time) {
+    FireCallback(frame_start_time, frame_target_time);
+  }
+
  protected:
   void AwaitVSync() override { await_vsync_call_count_++; }
 };
@@ -46,5 +53,77 @@ TEST(VsyncWaiterTest, NoUnneededAwaitVsync) {
   EXPECT_EQ(vsync_waiter.await_vsync_call_count_, 1);
 }
 
+TEST(VsyncWaiterTest, RecordsLastVsyncTimes) {
+  fml::MessageLoop::EnsureInitializedForCurrentThread();
+  auto task_runner = fml::MessageLoop::GetCurrent().GetTaskRunner();
+
+  const flutter::TaskRunners task_runners("vsync_waiter_test", task_runner,
+                                          task_runner, task_runner,
+                                          task_runner);
+
+  TestVsyncWaiter vsync_waiter(task_runners);
+  EXPECT_FALSE(vsync_waiter.GetLastVsyncTimes().has_value());
+
+  const fml::TimePoint start = fml::TimePoint::Now();
+  const fml::TimePoint target = start + fml::TimeDelta::FromMilliseconds(8);
+  vsync_waiter.ScheduleSecondaryCallback(1, [] {});
+  vsync_waiter.Fire(start, target);
+
+  std::optional<VsyncWaiter::VsyncTimes> times =
+      vsync_waiter.GetLastVsyncTimes();
+  ASSERT_TRUE(times.has_value());
+  EXPECT_EQ(times->frame_start_time, start);
+  EXPECT_EQ(times->frame_target_time, target);
+}
+
+// Pointer data packets are posted to the UI thread as regular tasks. One that
+// is queued before the vsync fires must be dispatched before the frame.
+TEST(VsyncWaiterTest, QueuedPointerEventRunsBeforeFrame) {
+  fml::MessageLoop::EnsureInitializedForCurrentThread();
+  auto task_runner = fml::MessageLoop::GetCurrent().GetTaskRunner();
+
+  const flutter::TaskRunners task_runners("vsync_waiter_test", task_runner,
+                                          task_runner, task_runner,
+                                          task_runner);
+
+  TestVsyncWaiter vsync_waiter(task_runners);
+  std::vector<std::string> order;
+  vsync_waiter.AsyncWaitForVsync(
+      [&order](std::unique_ptr<FrameTimingsRecorder>) {
+        order.push_back("frame");
+      });
+  task_runner->PostTask([&order] { order.push_back("pointer"); });
+
+  const fml::TimePoint start = fml::TimePoint::Now();
+  vsync_waiter.Fire(start, start + fml::TimeDelta::FromMilliseconds(16));
+  fml::MessageLoop::GetCurrent().RunExpiredTasksNow();
+
+  EXPECT_EQ(order, (std::vector<std::string>{"pointer", "frame"}));
+}
+
+TEST(VsyncWaiterTest, PrioritizedFrameRunsBeforeQueuedTasks) {
+  fml::MessageLoop::EnsureInitializedForCurrentThread();
+  auto task_runner = fml::MessageLoop::GetCurrent().GetTaskRunner();
+
+  const flutter::TaskRunners task_runners("vsync_waiter_test", task_runner,
+                                          task_runner, task_runner,
+                                          task_runner);
+
+  TestVsyncWaiter vsync_waiter(task_runners);
+  vsync_waiter.SetPrioritizeFrames(true);
+  std::vector<std::string> order;
+  vsync_waiter.AsyncWaitForVsync(
+      [&order](std::unique_ptr<FrameTimingsRecorder>) {
+        order.push_back("frame");
+      });
+  task_runner->PostTask([&order] { order.push_back("message"); });
+
+  const fml::TimePoint start = fml::TimePoint::Now();
+  vsync_waiter.Fire(start, start + fml::TimeDelta::FromMilliseconds(16));
+  fml::MessageLoop::GetCurrent().RunExpiredTasksNow();
+
+  EXPECT_EQ(order, (std::vector<std::string>{"frame", "message"}));
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -6,6 +6,7 @@
 #define FLUTTER_SHELL_GPU_GPU_SURFACE_GL_DELEGATE_H_
 
 #include <optional>
+#include <vector>
 
 #include "flutter/common/graphics/gl_context_switch.h"
 #include "flutter/flow/embedded_views.h"
@@ -50,6 +51,10 @@ struct GLPresentInfo {
   // The buffer damage refers to the region that needs to be set as damaged
   // within the frame buffer.
   const std::optional<DlIRect>& buffer_damage;
+
+  // The frame damage split into separate rects, each of which is contained in
+  // frame_damage. See |SurfaceFrame::FramebufferInfo::max_frame_damage_rects|.
+  std::vector<DlIRect> frame_damage_rects = {};
 };
 
 class GPUSurfaceGLDelegate {
@@ -15,7 +15,8 @@ namespace flutter {
 GPUSurfaceGLImpeller::GPUSurfaceGLImpeller(
     GPUSurfaceGLDelegate* delegate,
     std::shared_ptr<impeller::Context> context,
-    bool render_to_surface)
+    bool render_to_surface,
+    const std::shared_ptr<impeller::AiksContext>& parent_aiks_context)
     : weak_factory_(this) {
   if (delegate == nullptr) {
     return;
@@ -25,8 +26,12 @@ GPUSurfaceGLImpeller::GPUSurfaceGLImpeller(
     return;
   }
 
-  auto aiks_context = std::make_shared<impeller::AiksContext>(
-      context, impeller::TypographerContextSkia::Make());
+  auto aiks_context =
+      parent_aiks_context
+          ? std::make_shared<impeller::AiksContext>(context,
+                                                    *parent_aiks_context)
+          : std::make_shared<impeller::AiksContext>(
+                context, impeller::TypographerContextSkia::Make());
 
   if (!aiks_context->IsValid()) {
     return;
@@ -166,11 +171,6 @@ bool GPUSurfaceGLImpeller::AllowsDrawingWhenGpuDisabled() const {
   return delegate_->AllowsDrawingWhenGpuDisabled();
 }
 
-// |Surface|
-bool GPUSurfaceGLImpeller::EnableRasterCache() const {
-  return false;
-}
-
 // |Surface|
 std::shared_ptr<impeller::AiksContext> GPUSurfaceGLImpeller::GetAiksContext()
     const {
@@ -17,9 +17,14 @@ namespace flutter {
 
 class GPUSurfaceGLImpeller final : public Surface {
  public:
-  explicit GPUSurfaceGLImpeller(GPUSurfaceGLDelegate* delegate,
-                                std::shared_ptr<impeller::Context> context,
-                                bool render_to_surface);
+  /// If |parent_aiks_context| is provided, the pipelines and the glyph atlas
+  /// of the surface are shared with it.
+  explicit GPUSurfaceGLImpeller(
+      GPUSurfaceGLDelegate* delegate,
+      std::shared_ptr<impeller::Context> context,
+      bool render_to_surface,
+      const std::shared_ptr<impeller::AiksContext>& parent_aiks_context =
+          nullptr);
 
   // |Surface|
   ~GPUSurfaceGLImpeller() override;
@@ -53,9 +58,6 @@ class GPUSurfaceGLImpeller final : public Surface {
   // |Surface|
   bool AllowsDrawingWhenGpuDisabled() const override;
 
-  // |Surface|
-  bool EnableRasterCache() const override;
-
   // |Surface|
   std::shared_ptr<impeller::AiksContext> GetAiksContext() const override;
 
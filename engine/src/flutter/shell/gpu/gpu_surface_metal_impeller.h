@@ -71,9 +71,6 @@ class IMPELLER_CA_METAL_LAYER_AVAILABLE GPUSurfaceMetalImpeller
   // |Surface|
   bool AllowsDrawingWhenGpuDisabled() const override;
 
-  // |Surface|
-  bool EnableRasterCache() const override;
-
   // |Surface|
   std::shared_ptr<impeller::AiksContext> GetAiksContext() const override;
 
@@ -357,11 +357,6 @@ bool GPUSurfaceMetalImpeller::AllowsDrawingWhenGpuDisabled() const {
   return delegate_->AllowsDrawingWhenGpuDisabled();
 }
 
-// |Surface|
-bool GPUSurfaceMetalImpeller::EnableRasterCache() const {
-  return false;
-}
-
 // |Surface|
 std::shared_ptr<impeller::AiksContext> GPUSurfaceMetalImpeller::GetAiksContext() const {
   return aiks_context_;
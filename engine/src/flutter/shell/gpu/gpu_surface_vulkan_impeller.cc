@@ -48,14 +48,19 @@ class WrappedTextureSourceVK : public impeller::TextureSourceVK {
 
 GPUSurfaceVulkanImpeller::GPUSurfaceVulkanImpeller(
     GPUSurfaceVulkanDelegate* delegate,
-    std::shared_ptr<impeller::Context> context)
+    std::shared_ptr<impeller::Context> context,
+    const std::shared_ptr<impeller::AiksContext>& parent_aiks_context)
     : delegate_(delegate) {
   if (!context || !context->IsValid()) {
     return;
   }
 
-  auto aiks_context = std::make_shared<impeller::AiksContext>(
-      context, impeller::TypographerContextSkia::Make());
+  auto aiks_context =
+      parent_aiks_context
+          ? std::make_shared<impeller::AiksContext>(context,
+                                                    *parent_aiks_context)
+          : std::make_shared<impeller::AiksContext>(
+                context, impeller::TypographerContextSkia::Make());
   if (!aiks_context->IsValid()) {
     return;
   }
@@ -296,11 +301,6 @@ GPUSurfaceVulkanImpeller::MakeRenderContextCurrent() {
   return std::make_unique<GLContextDefaultResult>(true);
 }
 
-// |Surface|
-bool GPUSurfaceVulkanImpeller::EnableRasterCache() const {
-  return false;
-}
-
 // |Surface|
 std::shared_ptr<impeller::AiksContext>
 GPUSurfaceVulkanImpeller::GetAiksContext() const {
@@ -18,8 +18,13 @@ namespace flutter {
 
 class GPUSurfaceVulkanImpeller final : public Surface {
  public:
-  explicit GPUSurfaceVulkanImpeller(GPUSurfaceVulkanDelegate* delegate,
-                                    std::shared_ptr<impeller::Context> context);
+  /// If |parent_aiks_context| is provided, the pipelines and the glyph atlas
+  /// of the surface are shared with it.
+  explicit GPUSurfaceVulkanImpeller(
+      GPUSurfaceVulkanDelegate* delegate,
+      std::shared_ptr<impeller::Context> context,
+      const std::shared_ptr<impeller::AiksContext>& parent_aiks_context =
+          nullptr);
 
   // |Surface|
   ~GPUSurfaceVulkanImpeller() override;
@@ -46,9 +51,6 @@ class GPUSurfaceVulkanImpeller final : public Surface {
   // |Surface|
   std::unique_ptr<GLContextResult> MakeRenderContextCurrent() override;
 
-  // |Surface|
-  bool EnableRasterCache() const override;
-
   // |Surface|
   std::shared_ptr<impeller::AiksContext> GetAiksContext() const override;
 
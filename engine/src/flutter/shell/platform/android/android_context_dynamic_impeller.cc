@@ -6,8 +6,13 @@
 
 #include <android/api-level.h>
 #include <sys/system_properties.h>
+#include <algorithm>
 #include <memory>
+#include <string_view>
 
+#include "flutter/fml/file.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/paths.h"
 #include "flutter/impeller/base/validation.h"
 #include "shell/platform/android/android_rendering_selector.h"
 
@@ -74,10 +79,101 @@ static bool IsKnownBadSOC(std::string_view hardware) {
   return false;
 }
 
-static std::shared_ptr<AndroidContextVKImpeller>
-GetActualRenderingAPIForImpeller(
-    int api_level,
-    const AndroidContext::ContextSettings& settings) {
+// The outcome of the last attempt to create a Vulkan context, recorded in the
+// caches directory together with the build fingerprint of the device.
+static constexpr const char* kVulkanHistoryFileName = "impeller_vulkan_history";
+
+enum class VulkanHistory {
+  // Vulkan has not been tried since the last system update.
+  kUnknown,
+  // Vulkan was tried, but the process ended before the context was created.
+  kPending,
+  kSucceeded,
+  kFailed,
+};
+
+static const char* VulkanHistoryToString(VulkanHistory history) {
+  switch (history) {
+    case VulkanHistory::kUnknown:
+      return "unknown";
+    case VulkanHistory::kPending:
+      return "pending";
+    case VulkanHistory::kSucceeded:
+      return "succeeded";
+    case VulkanHistory::kFailed:
+      return "failed";
+  }
+  FML_UNREACHABLE();
+}
+
+static std::string GetBuildFingerprint() {
+  char property[PROP_VALUE_MAX];
+  __system_property_get("ro.build.fingerprint", property);
+  return property;
+}
+
+static VulkanHistory ReadVulkanHistory(const fml::UniqueFD& directory,
+                                       const std::string& fingerprint) {
+  if (!directory.is_valid() || fingerprint.empty()) {
+    return VulkanHistory::kUnknown;
+  }
+  auto mapping =
+      fml::FileMapping::CreateReadOnly(directory, kVulkanHistoryFileName);
+  if (!mapping || mapping->GetMapping() == nullptr) {
+    return VulkanHistory::kUnknown;
+  }
+  // The file holds the outcome, a newline and the fingerprint. A system or
+  // driver update changes the fingerprint, which discards the outcome.
+  std::string_view contents(
+      reinterpret_cast<const char*>(mapping->GetMapping()), mapping->GetSize());
+  size_t newline = contents.find('\n');
+  if (newline == std::string_view::npos ||
+      contents.substr(newline + 1) != fingerprint) {
+    return VulkanHistory::kUnknown;
+  }
+  std::string_view outcome = contents.substr(0, newline);
+  for (auto history : {VulkanHistory::kPending, VulkanHistory::kSucceeded,
+                       VulkanHistory::kFailed}) {
+    if (outcome == VulkanHistoryToString(history)) {
+      return history;
+    }
+  }
+  return VulkanHistory::kUnknown;
+}
+
+static void WriteVulkanHistory(const fml::UniqueFD& directory,
+                               const std::string& fingerprint,
+                               VulkanHistory history) {
+  if (!directory.is_valid() || fingerprint.empty()) {
+    return;
+  }
+  fml::DataMapping mapping(std::string(VulkanHistoryToString(history)) + "\n" +
+                           fingerprint);
+  if (!fml::WriteAtomically(directory, kVulkanHistoryFileName, mapping)) {
+    FML_DLOG(WARNING) << "Could not record the Vulkan backend outcome.";
+  }
+}
+
+// Whether any of the board, hardware or SoC names of this device are in
+// [list].
+static bool IsDeviceInList(const std::vector<std::string>& list) {
+  if (list.empty()) {
+    return false;
+  }
+  char property[PROP_VALUE_MAX];
+  for (const char* name : {"ro.product.board", "ro.hardware", "ro.soc.model"}) {
+    if (__system_property_get(name, property) <= 0) {
+      continue;
+    }
+    if (std::find(list.begin(), list.end(), property) != list.end()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Whether this device is known to have problems with Vulkan.
+static bool ShouldAvoidVulkan(int api_level) {
   constexpr int kMinimumAndroidApiLevelForMediaTekVulkan = 31;
 
   // have requisite features to support platform views.
@@ -87,7 +183,7 @@ GetActualRenderingAPIForImpeller(
   // feature. In these cases it will use OpenGLES.
   if (IsDeviceEmulator()) {
     // Avoid using Vulkan on known emulators.
-    return nullptr;
+    return true;
   }
 
   char property[PROP_VALUE_MAX];
@@ -95,25 +191,67 @@ GetActualRenderingAPIForImpeller(
   if (strcmp(property, kAndroidHuawei) == 0) {
     // Avoid using Vulkan on Huawei as AHB imports do not
     // consistently work.
-    return nullptr;
+    return true;
   }
 
   if (api_level < kMinimumAndroidApiLevelForMediaTekVulkan &&
       __system_property_find("ro.vendor.mediatek.platform") != nullptr) {
     // Probably MediaTek. Avoid Vulkan if older than 34 to work around
     // crashes when importing AHB.
-    return nullptr;
+    return true;
   }
 
   __system_property_get("ro.product.board", property);
   if (IsKnownBadSOC(property)) {
     FML_LOG(INFO)
         << "Known bad Vulkan driver encountered, falling back to OpenGLES.";
+    return true;
+  }
+  return false;
+}
+
+static std::shared_ptr<AndroidContextVKImpeller>
+GetActualRenderingAPIForImpeller(
+    int api_level,
+    const AndroidContext::ContextSettings& settings) {
+  if (IsDeviceInList(settings.vulkan_denylist)) {
+    FML_LOG(INFO) << "Device is in the Vulkan denylist, using OpenGLES.";
+    return nullptr;
+  }
+  // Devices in the allowlist skip the checks below, including the outcome of
+  // previous attempts.
+  const bool allowlisted = IsDeviceInList(settings.vulkan_allowlist);
+  if (!allowlisted && ShouldAvoidVulkan(api_level)) {
     return nullptr;
   }
 
+  fml::UniqueFD caches_directory = fml::paths::GetCachesDirectory();
+  const std::string fingerprint = GetBuildFingerprint();
+  const VulkanHistory history =
+      ReadVulkanHistory(caches_directory, fingerprint);
+  if (!allowlisted) {
+    switch (history) {
+      case VulkanHistory::kPending:
+        // Creating the context may have crashed in the driver.
+        FML_LOG(INFO) << "The previous attempt to use Vulkan did not "
+                         "complete, falling back to OpenGLES.";
+        return nullptr;
+      case VulkanHistory::kFailed:
+        // Skip creating a context that is known to be invalid.
+        return nullptr;
+      case VulkanHistory::kUnknown:
+      case VulkanHistory::kSucceeded:
+        break;
+    }
+  }
+
   // Determine if Vulkan is supported by creating a Vulkan context and
   // checking if it is valid.
+  // Once Vulkan has worked on this build, there is nothing left to record.
+  const bool record_history = history != VulkanHistory::kSucceeded;
+  if (record_history) {
+    WriteVulkanHistory(caches_directory, fingerprint, VulkanHistory::kPending);
+  }
   impeller::ScopedValidationDisable disable_validation;
   auto vulkan_backend = std::make_shared<AndroidContextVKImpeller>(
       AndroidContext::ContextSettings{
@@ -130,10 +268,17 @@ GetActualRenderingAPIForImpeller(
                   .antialiased_lines =
                       settings.impeller_flags.antialiased_lines,
               },
+          .vulkan_bundled_pipeline_caches =
+              settings.vulkan_bundled_pipeline_caches,
       });
   if (!vulkan_backend->IsValid()) {
+    WriteVulkanHistory(caches_directory, fingerprint, VulkanHistory::kFailed);
     return nullptr;
   }
+  if (record_history) {
+    WriteVulkanHistory(caches_directory, fingerprint,
+                       VulkanHistory::kSucceeded);
+  }
   return vulkan_backend;
 }
 }  // namespace
@@ -4,6 +4,7 @@
 
 #include "flutter/shell/platform/android/android_context_gl_impeller.h"
 
+#include "flutter/fml/paths.h"
 #include "flutter/impeller/renderer/backend/gles/context_gles.h"
 #include "flutter/impeller/renderer/backend/gles/proc_table_gles.h"
 #include "flutter/impeller/renderer/backend/gles/reactor_gles.h"
@@ -85,11 +86,11 @@ static std::shared_ptr<impeller::Context> CreateImpellerContext(
   auto context = impeller::ContextGLES::Create(
       impeller::Flags{}, std::move(proc_table),
       is_gles3 ? gles3_shader_mappings : gles2_shader_mappings,
-      enable_gpu_tracing);
+      enable_gpu_tracing, fml::paths::GetCachesDirectory());
 #else
-  auto context =
-      impeller::ContextGLES::Create(impeller::Flags{}, std::move(proc_table),
-                                    gles2_shader_mappings, enable_gpu_tracing);
+  auto context = impeller::ContextGLES::Create(
+      impeller::Flags{}, std::move(proc_table), gles2_shader_mappings,
+      enable_gpu_tracing, fml::paths::GetCachesDirectory());
 #endif  // !SLIMPELLER
 
   if (!context) {
@@ -0,0 +1,265 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/android/android_hardware_image_generator.h"
+
+#include <android/bitmap.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#include "flutter/fml/platform/android/jni_util.h"
+#include "flutter/fml/trace_event.h"
+#include "flutter/impeller/renderer/backend/vulkan/android/ahb_texture_source_vk.h"
+#include "flutter/impeller/renderer/backend/vulkan/texture_vk.h"
+#include "flutter/impeller/toolkit/android/hardware_buffer.h"
+#include "flutter/impeller/toolkit/android/proc_table.h"
+#include "third_party/skia/include/codec/SkCodecAnimation.h"
+
+namespace flutter {
+
+static fml::jni::ScopedJavaGlobalRef<jclass>* g_flutter_jni_class = nullptr;
+static jmethodID g_decode_image_size_method = nullptr;
+static jmethodID g_decode_image_to_hardware_buffer_method = nullptr;
+static jmethodID g_decode_image_to_bitmap_method = nullptr;
+static jmethodID g_hardware_buffer_close_method = nullptr;
+
+namespace {
+
+// Whether `data` starts like a JPEG or HEIF image. This saves calling into
+// Java for the images of other formats.
+bool LooksLikeJpegOrHeif(const SkData& data) {
+  const uint8_t* bytes = data.bytes();
+  if (data.size() >= 3 && bytes[0] == 0xFF && bytes[1] == 0xD8 &&
+      bytes[2] == 0xFF) {
+    return true;
+  }
+  // The "ftyp" box of the ISO base media file format. The major brand is
+  // checked by the platform, which may also find AVIF images here.
+  return data.size() >= 12 && memcmp(bytes + 4, "ftyp", 4) == 0;
+}
+
+jobject NewDirectByteBuffer(JNIEnv* env, const sk_sp<SkData>& data) {
+  return env->NewDirectByteBuffer(const_cast<void*>(data->data()),
+                                  data->size());
+}
+
+}  // namespace
+
+AndroidHardwareImageGenerator::AndroidHardwareImageGenerator(
+    sk_sp<SkData> data,
+    const SkImageInfo& info)
+    : data_(std::move(data)), info_(info) {}
+
+AndroidHardwareImageGenerator::~AndroidHardwareImageGenerator() = default;
+
+const SkImageInfo& AndroidHardwareImageGenerator::GetInfo() {
+  return info_;
+}
+
+unsigned int AndroidHardwareImageGenerator::GetFrameCount() const {
+  return 1;
+}
+
+unsigned int AndroidHardwareImageGenerator::GetPlayCount() const {
+  return 1;
+}
+
+const ImageGenerator::FrameInfo AndroidHardwareImageGenerator::GetFrameInfo(
+    unsigned int frame_index) {
+  return {.required_frame = std::nullopt,
+          .duration = 0,
+          .disposal_method = SkCodecAnimation::DisposalMethod::kKeep};
+}
+
+SkISize AndroidHardwareImageGenerator::GetScaledDimensions(
+    float desired_scale) {
+  // The platform decoder decodes at any size, so the image never needs to be
+  // resized after it is decoded.
+  if (desired_scale >= 1.0f) {
+    return info_.dimensions();
+  }
+  return SkISize::Make(
+      std::max(1, static_cast<int>(std::ceil(info_.width() * desired_scale))),
+      std::max(1,
+               static_cast<int>(std::ceil(info_.height() * desired_scale))));
+}
+
+bool AndroidHardwareImageGenerator::GetPixels(
+    const SkImageInfo& info,
+    void* pixels,
+    size_t row_bytes,
+    unsigned int frame_index,
+    std::optional<unsigned int> prior_frame) {
+  TRACE_EVENT0("flutter", "AndroidHardwareImageGenerator::GetPixels");
+  if (frame_index != 0 || info.colorType() != kRGBA_8888_SkColorType) {
+    return false;
+  }
+  switch (info.alphaType()) {
+    case kOpaque_SkAlphaType:
+      if (info_.alphaType() != kOpaque_SkAlphaType) {
+        return false;
+      }
+      break;
+    case kPremul_SkAlphaType:
+      break;
+    default:
+      return false;
+  }
+
+  JNIEnv* env = fml::jni::AttachCurrentThread();
+  fml::jni::ScopedJavaLocalFrame scoped_local_reference_frame(env);
+
+  jobject bitmap = env->CallStaticObjectMethod(
+      g_flutter_jni_class->obj(), g_decode_image_to_bitmap_method,
+      NewDirectByteBuffer(env, data_), info.width(), info.height());
+  FML_CHECK(fml::jni::CheckException(env));
+  if (bitmap == nullptr) {
+    return false;
+  }
+
+  AndroidBitmapInfo bitmap_info;
+  if (AndroidBitmap_getInfo(env, bitmap, &bitmap_info) < 0 ||
+      bitmap_info.format != ANDROID_BITMAP_FORMAT_RGBA_8888 ||
+      static_cast<int>(bitmap_info.width) != info.width() ||
+      static_cast<int>(bitmap_info.height) != info.height()) {
+    FML_DLOG(ERROR) << "The decoded bitmap does not match the image info.";
+    return false;
+  }
+
+  void* bitmap_pixels;
+  if (AndroidBitmap_lockPixels(env, bitmap, &bitmap_pixels) < 0) {
+    FML_DLOG(ERROR) << "Failed to lock the pixels of the decoded bitmap.";
+    return false;
+  }
+  const size_t copied_row_bytes = info.minRowBytes();
+  for (int row = 0; row < info.height(); row++) {
+    memcpy(static_cast<uint8_t*>(pixels) + row * row_bytes,
+           static_cast<const uint8_t*>(bitmap_pixels) +
+               row * bitmap_info.stride,
+           copied_row_bytes);
+  }
+  AndroidBitmap_unlockPixels(env, bitmap);
+  return true;
+}
+
+std::shared_ptr<impeller::Texture> AndroidHardwareImageGenerator::GetTexture(
+    const SkISize& size,
+    const std::shared_ptr<impeller::Context>& context) {
+  // Only Vulkan can import hardware buffers as textures without a copy.
+  if (!context ||
+      context->GetBackendType() != impeller::Context::BackendType::kVulkan) {
+    return nullptr;
+  }
+  const auto& from_hardware_buffer =
+      impeller::android::GetProcTable().AHardwareBuffer_fromHardwareBuffer;
+  if (!from_hardware_buffer) {
+    return nullptr;
+  }
+  TRACE_EVENT0("flutter", "AndroidHardwareImageGenerator::GetTexture");
+
+  JNIEnv* env = fml::jni::AttachCurrentThread();
+  fml::jni::ScopedJavaLocalFrame scoped_local_reference_frame(env);
+
+  jobject hardware_buffer = env->CallStaticObjectMethod(
+      g_flutter_jni_class->obj(), g_decode_image_to_hardware_buffer_method,
+      NewDirectByteBuffer(env, data_), size.width(), size.height());
+  FML_CHECK(fml::jni::CheckException(env));
+  if (hardware_buffer == nullptr) {
+    return nullptr;
+  }
+
+  // Importing the buffer into Vulkan memory acquires a reference to it, so
+  // the Java object is closed as soon as the texture source is created.
+  std::shared_ptr<impeller::AHBTextureSourceVK> texture_source;
+  AHardwareBuffer* buffer = from_hardware_buffer(env, hardware_buffer);
+  std::optional<AHardwareBuffer_Desc> desc =
+      buffer ? impeller::android::HardwareBuffer::Describe(buffer)
+             : std::nullopt;
+  if (desc.has_value()) {
+    texture_source = std::make_shared<impeller::AHBTextureSourceVK>(
+        context, buffer, desc.value());
+  }
+  env->CallVoidMethod(hardware_buffer, g_hardware_buffer_close_method);
+  FML_CHECK(fml::jni::CheckException(env));
+  if (!texture_source || !texture_source->IsValid()) {
+    return nullptr;
+  }
+
+  // ImageDecoderImpeller transitions the texture to shader read where it may
+  // submit GPU work.
+  return std::make_shared<impeller::TextureVK>(context, texture_source);
+}
+
+bool AndroidHardwareImageGenerator::Register(JNIEnv* env) {
+  g_flutter_jni_class = new fml::jni::ScopedJavaGlobalRef<jclass>(
+      env, env->FindClass("io/flutter/embedding/engine/FlutterJNI"));
+  FML_DCHECK(!g_flutter_jni_class->is_null());
+
+  g_decode_image_size_method =
+      env->GetStaticMethodID(g_flutter_jni_class->obj(),
+                             "decodeImageSizeForHardware",
+                             "(Ljava/nio/ByteBuffer;)[I");
+  g_decode_image_to_hardware_buffer_method = env->GetStaticMethodID(
+      g_flutter_jni_class->obj(), "decodeImageToHardwareBuffer",
+      "(Ljava/nio/ByteBuffer;II)Landroid/hardware/HardwareBuffer;");
+  g_decode_image_to_bitmap_method = env->GetStaticMethodID(
+      g_flutter_jni_class->obj(), "decodeImageToBitmap",
+      "(Ljava/nio/ByteBuffer;II)Landroid/graphics/Bitmap;");
+
+  fml::jni::ScopedJavaLocalRef<jclass> hardware_buffer_class(
+      env, env->FindClass("android/hardware/HardwareBuffer"));
+  if (hardware_buffer_class.is_null()) {
+    // Hardware buffers were added in API level 26.
+    env->ExceptionClear();
+    return true;
+  }
+  g_hardware_buffer_close_method =
+      env->GetMethodID(hardware_buffer_class.obj(), "close", "()V");
+
+  if (!g_decode_image_size_method ||
+      !g_decode_image_to_hardware_buffer_method ||
+      !g_decode_image_to_bitmap_method || !g_hardware_buffer_close_method) {
+    FML_LOG(ERROR) << "Could not locate the hardware image decoding methods";
+    return false;
+  }
+  return true;
+}
+
+std::shared_ptr<ImageGenerator> AndroidHardwareImageGenerator::MakeFromData(
+    sk_sp<SkData> data) {
+  if (!g_hardware_buffer_close_method || !data ||
+      !LooksLikeJpegOrHeif(*data)) {
+    return nullptr;
+  }
+  TRACE_EVENT0("flutter", "AndroidHardwareImageGenerator::MakeFromData");
+
+  JNIEnv* env = fml::jni::AttachCurrentThread();
+  fml::jni::ScopedJavaLocalFrame scoped_local_reference_frame(env);
+
+  auto size = static_cast<jintArray>(
+      env->CallStaticObjectMethod(g_flutter_jni_class->obj(),
+                                  g_decode_image_size_method,
+                                  NewDirectByteBuffer(env, data)));
+  FML_CHECK(fml::jni::CheckException(env));
+  if (size == nullptr || env->GetArrayLength(size) != 2) {
+    return nullptr;
+  }
+  jint dimensions[2];
+  env->GetIntArrayRegion(size, 0, 2, dimensions);
+
+  // JPEG images have no alpha channel.
+  const bool is_jpeg = data->bytes()[0] == 0xFF;
+  const SkImageInfo info = SkImageInfo::Make(
+      dimensions[0], dimensions[1], kRGBA_8888_SkColorType,
+      is_jpeg ? kOpaque_SkAlphaType : kPremul_SkAlphaType,
+      SkColorSpace::MakeSRGB());
+  return std::shared_ptr<ImageGenerator>(
+      new AndroidHardwareImageGenerator(std::move(data), info));
+}
+
+}  // namespace flutter
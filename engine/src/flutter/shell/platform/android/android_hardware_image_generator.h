@@ -0,0 +1,78 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_ANDROID_ANDROID_HARDWARE_IMAGE_GENERATOR_H_
+#define FLUTTER_SHELL_PLATFORM_ANDROID_ANDROID_HARDWARE_IMAGE_GENERATOR_H_
+
+#include <jni.h>
+
+#include "flutter/lib/ui/painting/image_generator.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// An |ImageGenerator| for JPEG and HEIF images that decodes them with the
+/// platform `ImageDecoder`, which uses the hardware decoders of the device
+/// where there are some.
+///
+/// With the Vulkan backend of Impeller, images are decoded into hardware
+/// buffers that are imported as textures, so that their pixels are never
+/// copied. Otherwise, they are decoded into software bitmaps. Unlike the
+/// |AndroidImageGenerator|, nothing is decoded before the image is asked for,
+/// and images are decoded at the size they are asked for.
+///
+/// Requires API level 31, where hardware bitmaps expose their buffer.
+///
+class AndroidHardwareImageGenerator : public ImageGenerator {
+ public:
+  ~AndroidHardwareImageGenerator() override;
+
+  // |ImageGenerator|
+  const SkImageInfo& GetInfo() override;
+
+  // |ImageGenerator|
+  unsigned int GetFrameCount() const override;
+
+  // |ImageGenerator|
+  unsigned int GetPlayCount() const override;
+
+  // |ImageGenerator|
+  const ImageGenerator::FrameInfo GetFrameInfo(
+      unsigned int frame_index) override;
+
+  // |ImageGenerator|
+  SkISize GetScaledDimensions(float desired_scale) override;
+
+  // |ImageGenerator|
+  bool GetPixels(const SkImageInfo& info,
+                 void* pixels,
+                 size_t row_bytes,
+                 unsigned int frame_index,
+                 std::optional<unsigned int> prior_frame) override;
+
+  // |ImageGenerator|
+  std::shared_ptr<impeller::Texture> GetTexture(
+      const SkISize& size,
+      const std::shared_ptr<impeller::Context>& context) override;
+
+  static bool Register(JNIEnv* env);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Returns a generator for `data` if it is a JPEG or HEIF image
+  ///             that the platform decoder can decode, and null otherwise.
+  ///
+  static std::shared_ptr<ImageGenerator> MakeFromData(sk_sp<SkData> data);
+
+ private:
+  AndroidHardwareImageGenerator(sk_sp<SkData> data, const SkImageInfo& info);
+
+  sk_sp<SkData> data_;
+  const SkImageInfo info_;
+
+  FML_DISALLOW_COPY_ASSIGN_AND_MOVE(AndroidHardwareImageGenerator);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_ANDROID_ANDROID_HARDWARE_IMAGE_GENERATOR_H_
@@ -14,6 +14,7 @@
 #include <utility>
 
 #include "common/settings.h"
+#include "flutter/assets/packed_asset_bundle.h"
 #include "flutter/fml/cpu_affinity.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/message_loop.h"
@@ -22,6 +23,7 @@
 #include "flutter/shell/common/run_configuration.h"
 #include "flutter/shell/common/thread_host.h"
 #include "flutter/shell/platform/android/android_display.h"
+#include "flutter/shell/platform/android/android_hardware_image_generator.h"
 #include "flutter/shell/platform/android/android_image_generator.h"
 #include "flutter/shell/platform/android/android_rendering_selector.h"
 #include "flutter/shell/platform/android/android_shell_holder.h"
@@ -73,6 +75,37 @@ static void AndroidPlatformThreadConfigSetter(
       }
   }
 }
+
+/// Applies the thread placement of the |settings| on top of the defaults of
+/// |AndroidPlatformThreadConfigSetter|. The threads are told apart by the
+/// priorities they are configured with below.
+static fml::Thread::ThreadConfigSetter MakeThreadConfigSetter(
+    const flutter::Settings& settings) {
+  return [ui_affinity = settings.ui_thread_cpu_affinity,
+          raster_affinity = settings.raster_thread_cpu_affinity,
+          io_affinity = settings.io_thread_cpu_affinity](
+             const fml::Thread::ThreadConfig& config) {
+    AndroidPlatformThreadConfigSetter(config);
+    std::optional<fml::CpuAffinity> affinity;
+    switch (config.priority) {
+      case fml::Thread::ThreadPriority::kDisplay:
+        affinity = ui_affinity;
+        break;
+      case fml::Thread::ThreadPriority::kRaster:
+        affinity = raster_affinity;
+        break;
+      case fml::Thread::ThreadPriority::kNormal:
+        affinity = io_affinity;
+        break;
+      default:
+        break;
+    }
+    if (affinity.has_value()) {
+      fml::RequestAffinity(affinity.value());
+    }
+  };
+}
+
 static PlatformData GetDefaultPlatformData() {
   PlatformData platform_data;
   platform_data.lifecycle_state = "AppLifecycleState.detached";
@@ -96,7 +129,7 @@ AndroidShellHolder::AndroidShellHolder(
   }
 
   flutter::ThreadHost::ThreadHostConfig host_config(
-      thread_label, mask, AndroidPlatformThreadConfigSetter);
+      thread_label, mask, MakeThreadConfigSetter(settings));
   host_config.ui_config = fml::Thread::ThreadConfig(
       flutter::ThreadHost::ThreadHostConfig::MakeThreadName(
           flutter::ThreadHost::Type::kUi, thread_label),
@@ -176,6 +209,18 @@ AndroidShellHolder::AndroidShellHolder(
         },
         -1);
     FML_DLOG(INFO) << "Registered Android SDK image decoder (API level 28+)";
+
+    // Takes precedence over the builtin decoders for the JPEG and HEIF images
+    // the platform can decode, see |AndroidHardwareImageGenerator|.
+    if (settings_.enable_impeller &&
+        settings_.enable_hardware_image_decoding) {
+      shell_->RegisterImageDecoder(
+          [](sk_sp<SkData> buffer) {
+            return AndroidHardwareImageGenerator::MakeFromData(
+                std::move(buffer));
+          },
+          1);
+    }
   }
 
   platform_view_ = weak_platform_view;
@@ -343,6 +388,12 @@ std::optional<RunConfiguration> AndroidShellHolder::BuildRunConfiguration(
   }
 
   RunConfiguration config(std::move(isolate_configuration));
+  // The assets in the pack, if the application has one, are found without
+  // a lookup in the APK each.
+  if (auto pack =
+          PackedAssetBundle::OpenFromResolver(*apk_asset_provider_, true)) {
+    config.AddAssetResolver(std::move(pack));
+  }
   config.AddAssetResolver(apk_asset_provider_->Clone());
 
   {
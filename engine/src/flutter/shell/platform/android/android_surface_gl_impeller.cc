@@ -35,14 +35,18 @@ bool AndroidSurfaceGLImpeller::IsValid() const {
 // |AndroidSurface|
 std::unique_ptr<Surface> AndroidSurfaceGLImpeller::CreateGPUSurface(
     GrDirectContext* gr_context) {
-  auto surface = std::make_unique<GPUSurfaceGLImpeller>(
+  std::unique_ptr<Surface> surface = std::make_unique<GPUSurfaceGLImpeller>(
       this,                                    // delegate
       android_context_->GetImpellerContext(),  // context
-      true                                     // render to surface
+      true,                                    // render to surface
+      android_context_->GetMainAiksContext()   // parent aiks context
   );
   if (!surface->IsValid()) {
     return nullptr;
   }
+  if (!android_context_->GetMainAiksContext()) {
+    android_context_->SetMainAiksContext(surface->GetAiksContext());
+  }
   return surface;
 }
 
@@ -98,7 +102,8 @@ std::unique_ptr<Surface> AndroidSurfaceGLImpeller::CreateSnapshotSurface() {
   return std::make_unique<GPUSurfaceGLImpeller>(
       this,                                    // delegate
       android_context_->GetImpellerContext(),  // context
-      true                                     // render to surface
+      true,                                    // render to surface
+      android_context_->GetMainAiksContext()   // parent aiks context
   );
 }
 
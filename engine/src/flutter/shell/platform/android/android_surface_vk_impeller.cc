@@ -20,7 +20,8 @@
 namespace flutter {
 
 AndroidSurfaceVKImpeller::AndroidSurfaceVKImpeller(
-    const std::shared_ptr<AndroidContextVKImpeller>& android_context) {
+    const std::shared_ptr<AndroidContextVKImpeller>& android_context)
+    : android_context_(android_context) {
   is_valid_ = android_context->IsValid();
 
   auto& context_vk =
@@ -48,12 +49,16 @@ std::unique_ptr<Surface> AndroidSurfaceVKImpeller::CreateGPUSurface(
     return nullptr;
   }
 
-  std::unique_ptr<GPUSurfaceVulkanImpeller> gpu_surface =
-      std::make_unique<GPUSurfaceVulkanImpeller>(nullptr, surface_context_vk_);
+  std::unique_ptr<Surface> gpu_surface =
+      std::make_unique<GPUSurfaceVulkanImpeller>(
+          nullptr, surface_context_vk_, android_context_->GetMainAiksContext());
 
   if (!gpu_surface->IsValid()) {
     return nullptr;
   }
+  if (!android_context_->GetMainAiksContext()) {
+    android_context_->SetMainAiksContext(gpu_surface->GetAiksContext());
+  }
 
   return gpu_surface;
 }
@@ -53,6 +53,7 @@ class AndroidSurfaceVKImpeller : public AndroidSurface {
  private:
   std::shared_ptr<impeller::SurfaceContextVK> surface_context_vk_;
   fml::RefPtr<AndroidNativeWindow> native_window_;
+  std::shared_ptr<AndroidContextVKImpeller> android_context_;
   bool is_valid_ = false;
 
   FML_DISALLOW_COPY_AND_ASSIGN(AndroidSurfaceVKImpeller);
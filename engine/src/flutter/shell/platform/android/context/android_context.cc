@@ -15,6 +15,8 @@ AndroidContext::~AndroidContext() {
     main_context_->releaseResourcesAndAbandonContext();
   }
 #endif  // !SLIMPELLER
+  // The shared resources must be released before the context shuts down.
+  main_aiks_context_.reset();
   if (impeller_context_) {
     impeller_context_->Shutdown();
   }
@@ -50,6 +52,16 @@ std::shared_ptr<impeller::Context> AndroidContext::GetImpellerContext() const {
   return impeller_context_;
 }
 
+void AndroidContext::SetMainAiksContext(
+    const std::shared_ptr<impeller::AiksContext>& main_aiks_context) {
+  main_aiks_context_ = main_aiks_context;
+}
+
+std::shared_ptr<impeller::AiksContext> AndroidContext::GetMainAiksContext()
+    const {
+  return main_aiks_context_;
+}
+
 bool AndroidContext::IsDynamicSelection() const {
   return false;
 }
@@ -5,9 +5,13 @@
 #ifndef FLUTTER_SHELL_PLATFORM_ANDROID_CONTEXT_ANDROID_CONTEXT_H_
 #define FLUTTER_SHELL_PLATFORM_ANDROID_CONTEXT_ANDROID_CONTEXT_H_
 
+#include <string>
+#include <vector>
+
 #include "flutter/common/macros.h"
 #include "flutter/fml/macros.h"
 #include "flutter/impeller/base/flags.h"
+#include "flutter/impeller/display_list/aiks_context.h"
 #include "flutter/impeller/renderer/context.h"
 #include "flutter/shell/platform/android/android_rendering_selector.h"
 
@@ -35,6 +39,11 @@ class AndroidContext {
     bool enable_surface_control = false;
     bool quiet = false;
     impeller::Flags impeller_flags;
+    // Device names that override the automatic Vulkan selection.
+    std::vector<std::string> vulkan_allowlist;
+    std::vector<std::string> vulkan_denylist;
+    // Paths of the pipeline cache files shipped with the application.
+    std::vector<std::string> vulkan_bundled_pipeline_caches;
   };
 
   virtual AndroidRenderingAPI RenderingApi() const;
@@ -74,6 +83,27 @@ class AndroidContext {
   ///
   virtual std::shared_ptr<impeller::Context> GetImpellerContext() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Setter for the Aiks context whose pipelines and glyph atlas
+  ///             are shared by subsequent AndroidSurfaces.
+  /// @details    This avoids building the pipelines again for the surfaces of
+  ///             spawned engines, which share this AndroidContext. Each
+  ///             surface still has its own transient buffers and caches.
+  ///
+  ///             The first Impeller AndroidSurface should set this for the
+  ///             AndroidContext if the AndroidContext does not yet have an
+  ///             Aiks context to share via GetMainAiksContext. This is only
+  ///             used on the raster thread.
+  ///
+  void SetMainAiksContext(
+      const std::shared_ptr<impeller::AiksContext>& main_aiks_context);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Accessor for the Aiks context set by SetMainAiksContext.
+  /// @returns    `nullptr` when no Aiks context has been set yet.
+  ///
+  std::shared_ptr<impeller::AiksContext> GetMainAiksContext() const;
+
   //----------------------------------------------------------------------------
   /// @brief      Perform deferred setup for the impeller Context.
   ///
@@ -89,6 +119,7 @@ class AndroidContext {
   // This is the Skia context used for on-screen rendering.
   NOT_SLIMPELLER(sk_sp<GrDirectContext> main_context_);
   std::shared_ptr<impeller::Context> impeller_context_;
+  std::shared_ptr<impeller::AiksContext> main_aiks_context_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(AndroidContext);
 };
@@ -81,12 +81,15 @@ void AndroidExternalViewEmbedder::SubmitFlutterView(
     view_rects[platform_id] = GetViewRect(platform_id);
   }
 
-  std::unordered_map<int64_t, DlRect> overlay_layers =
-      SliceViews(frame->Canvas(),     //
-                 composition_order_,  //
-                 slices_,             //
-                 view_rects           //
-      );
+  std::unordered_map<int64_t, SlicedOverlay> overlay_layers =
+      SliceViewsIntoOverlays(frame->Canvas(),     //
+                             composition_order_,  //
+                             slices_,             //
+                             view_rects,          //
+                             {
+                                 .merge_overlays = true,
+                                 .max_overlay_count = kMaxOverlayLayers,
+                             });
 
   // Submit the background canvas frame before switching the GL context to
   // the overlay surfaces.
@@ -113,17 +116,15 @@ void AndroidExternalViewEmbedder::SubmitFlutterView(
         params.sizePoints().height * device_pixel_ratio_,
         params.mutatorsStack()  //
     );
-    std::unordered_map<int64_t, DlRect>::const_iterator overlay =
+    std::unordered_map<int64_t, SlicedOverlay>::const_iterator overlay =
         overlay_layers.find(view_id);
     if (overlay == overlay_layers.end()) {
       continue;
     }
     std::unique_ptr<SurfaceFrame> frame =
-        CreateSurfaceIfNeeded(context,                    //
-                              view_id,                    //
-                              slices_.at(view_id).get(),  //
-                              overlay->second             //
-        );
+        CreateSurfaceIfNeeded(context, overlay->second);
+    DlIRect overlay_bounds = DlIRect::RoundOut(overlay->second.rect);
+    RecordOverlayLayers(1u, static_cast<size_t>(overlay_bounds.Area()));
     if (should_submit_current_frame) {
       frame->Submit();
     }
@@ -132,10 +133,10 @@ void AndroidExternalViewEmbedder::SubmitFlutterView(
 
 // |ExternalViewEmbedder|
 std::unique_ptr<SurfaceFrame>
-AndroidExternalViewEmbedder::CreateSurfaceIfNeeded(GrDirectContext* context,
-                                                   int64_t view_id,
-                                                   EmbedderViewSlice* slice,
-                                                   const DlRect& rect) {
+AndroidExternalViewEmbedder::CreateSurfaceIfNeeded(
+    GrDirectContext* context,
+    const SlicedOverlay& overlay) {
+  const DlRect& rect = overlay.rect;
   std::shared_ptr<OverlayLayer> layer = surface_pool_->GetLayer(
       context, android_context_, jni_facade_, surface_factory_);
 
@@ -154,7 +155,7 @@ AndroidExternalViewEmbedder::CreateSurfaceIfNeeded(GrDirectContext* context,
   // Offset the picture since its absolute position on the scene is determined
   // by the position of the overlay view.
   overlay_canvas->Translate(-rect.GetX(), -rect.GetY());
-  slice->render_into(overlay_canvas);
+  overlay.RenderInto(overlay_canvas, slices_);
   return frame;
 }
 
@@ -9,6 +9,7 @@
 
 #include "flutter/common/task_runners.h"
 #include "flutter/flow/embedded_views.h"
+#include "flutter/flow/view_slicer.h"
 #include "flutter/shell/platform/android/context/android_context.h"
 #include "flutter/shell/platform/android/external_view_embedder/surface_pool.h"
 #include "flutter/shell/platform/android/jni/platform_view_android_jni.h"
@@ -26,6 +27,12 @@ namespace flutter {
 /// that render above (by Z order) the Android view corresponding to
 /// |flutter::PlatformViewLayer|.
 ///
+/// The Android views are positioned synchronously from |SubmitFlutterView|,
+/// so this embedder merges the raster thread into the platform thread while
+/// platform views are displayed. Where SurfaceControl is available,
+/// |AndroidExternalViewEmbedder2| is used instead, which composites without
+/// merging the threads.
+///
 class AndroidExternalViewEmbedder final : public ExternalViewEmbedder {
  public:
   AndroidExternalViewEmbedder(
@@ -92,6 +99,12 @@ class AndroidExternalViewEmbedder final : public ExternalViewEmbedder {
   // where the platform view might be momentarily off the screen.
   static const int kDefaultMergedLeaseDuration = 10;
 
+  // The maximum number of overlay surfaces used in a frame. Each overlay
+  // surface is backed by its own frame sized buffers, so beyond this count
+  // the platform views stacked in between overlays are cut out of the
+  // overlay content instead.
+  static const size_t kMaxOverlayLayers = 8;
+
   // Provides metadata to the Android surfaces.
   const AndroidContext& android_context_;
 
@@ -142,11 +155,10 @@ class AndroidExternalViewEmbedder final : public ExternalViewEmbedder {
   bool FrameHasPlatformLayers();
 
   // Creates a Surface when needed or recycles an existing one.
-  // Finally, draws the picture on the frame's canvas.
-  std::unique_ptr<SurfaceFrame> CreateSurfaceIfNeeded(GrDirectContext* context,
-                                                      int64_t view_id,
-                                                      EmbedderViewSlice* slice,
-                                                      const DlRect& rect);
+  // Finally, draws the overlay on the frame's canvas.
+  std::unique_ptr<SurfaceFrame> CreateSurfaceIfNeeded(
+      GrDirectContext* context,
+      const SlicedOverlay& overlay);
 };
 
 }  // namespace flutter
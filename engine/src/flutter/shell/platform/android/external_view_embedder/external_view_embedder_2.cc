@@ -101,10 +101,13 @@ void AndroidExternalViewEmbedder2::SubmitFlutterView(
                  view_rects           //
       );
 
-  // If there is no overlay Surface, initialize one on the platform thread. This
-  // will only be done once per application launch, as the singular overlay
-  // surface is never released.
-  if (!surface_pool_->HasLayers()) {
+  // If Flutter content needs to be drawn over a platform view and there is no
+  // overlay Surface yet, initialize one on the platform thread. This will only
+  // be done once per application launch, as the singular overlay surface is
+  // never released. Until then, frames are composed only by the surface
+  // controls of the Flutter view and the platform views, without an overlay
+  // buffer to allocate, clear and blend.
+  if (!overlay_layers.empty() && !surface_pool_->HasLayers()) {
     std::shared_ptr<fml::CountDownLatch> latch =
         std::make_shared<fml::CountDownLatch>(1u);
     task_runners_.GetPlatformTaskRunner()->PostTask(
@@ -120,7 +123,7 @@ void AndroidExternalViewEmbedder2::SubmitFlutterView(
   // Create Overlay frame. If overlay surface creation failed,
   // all this work must be skipped.
   std::unique_ptr<SurfaceFrame> overlay_frame;
-  if (surface_pool_->HasLayers()) {
+  if (!overlay_layers.empty() && surface_pool_->HasLayers()) {
     for (size_t i = 0; i < composition_order_.size(); i++) {
       int64_t view_id = composition_order_[i];
       std::unordered_map<int64_t, DlRect>::const_iterator overlay =
@@ -159,6 +162,14 @@ void AndroidExternalViewEmbedder2::SubmitFlutterView(
     overlay_frame->set_submit_info({.frame_boundary = false});
     overlay_frame->Submit();
     overlay_layer_has_content_this_frame_ = true;
+
+    // All overlays share a single surface.
+    DlRect overlay_bounds;
+    for (const auto& [view_id, overlay_rect] : overlay_layers) {
+      overlay_bounds = overlay_bounds.Union(overlay_rect);
+    }
+    RecordOverlayLayers(
+        1u, static_cast<size_t>(DlIRect::RoundOut(overlay_bounds).Area()));
   } else {
     overlay_layer_has_content_this_frame_ = false;
   }
@@ -236,8 +236,7 @@ void FlutterMain::SetupDartVMServiceUriCallback(JNIEnv* env) {
 }
 
 static void PrefetchDefaultFontManager(JNIEnv* env, jclass jcaller) {
-  // Initialize a singleton owned by Skia.
-  txt::GetDefaultFontManager();
+  txt::PrefetchDefaultFontManager();
 }
 
 bool FlutterMain::Register(JNIEnv* env) {
@@ -34,6 +34,10 @@ void ImageExternalTexture::Paint(PaintContext& context,
     return;
   }
   Attach(context);
+  if (trim_pending_) {
+    trim_pending_ = false;
+    OnImagesEvicted(image_lru_.Trim());
+  }
   const bool should_process_frame = !freeze;
   if (should_process_frame) {
     ProcessFrame(context, ToSkRect(bounds));
@@ -60,6 +64,11 @@ void ImageExternalTexture::MarkNewFrameAvailable() {
 // Implementing flutter::Texture.
 void ImageExternalTexture::OnTextureUnregistered() {}
 
+// Implementing flutter::Texture.
+void ImageExternalTexture::OnTrimMemory() {
+  trim_pending_ = true;
+}
+
 // Implementing flutter::ContextListener.
 void ImageExternalTexture::OnGrContextCreated() {
   state_ = AttachmentState::kUninitialized;
@@ -66,6 +66,11 @@ class ImageExternalTexture : public flutter::Texture {
 
   virtual void Detach() = 0;
 
+  /// @brief      Called when the images for [keys] are removed from
+  ///             |image_lru_|, so that subclasses can release any resources
+  ///             they keep for those hardware buffers.
+  virtual void OnImagesEvicted(const std::vector<HardwareBufferKey>& keys) {}
+
   JavaLocalRef AcquireLatestImage();
 
   void CloseImage(const fml::jni::JavaRef<jobject>& image);
@@ -98,6 +103,9 @@ class ImageExternalTexture : public flutter::Texture {
   // |flutter::Texture|
   void OnTextureUnregistered() override;
 
+  // |flutter::Texture|
+  void OnTrimMemory() override;
+
   // |flutter::ContextListener|
   void OnGrContextCreated() override;
 
@@ -105,6 +113,9 @@ class ImageExternalTexture : public flutter::Texture {
   void OnGrContextDestroyed() override;
 
   const ImageLifecycle texture_lifecycle_;
+  // Trimming is deferred until the next paint, when the rendering context
+  // that created the cached images is current.
+  bool trim_pending_ = false;
   FML_DISALLOW_COPY_AND_ASSIGN(ImageExternalTexture);
 };
 
@@ -61,7 +61,7 @@ void ImageExternalTextureGL::UpdateImage(JavaLocalRef& hardware_buffer,
 
   dl_image_ = CreateDlImage(context, bounds, key, std::move(egl_image));
   if (key.has_value()) {
-    gl_entries_.erase(image_lru_.AddImage(dl_image_, key.value()));
+    OnImagesEvicted(image_lru_.AddImage(dl_image_, key.value()));
   }
 }
 
@@ -81,6 +81,13 @@ void ImageExternalTextureGL::Detach() {
   gl_entries_.clear();
 }
 
+void ImageExternalTextureGL::OnImagesEvicted(
+    const std::vector<HardwareBufferKey>& keys) {
+  for (HardwareBufferKey key : keys) {
+    gl_entries_.erase(key);
+  }
+}
+
 impeller::UniqueEGLImageKHR ImageExternalTextureGL::CreateEGLImage(
     AHardwareBuffer* hardware_buffer) {
   if (hardware_buffer == nullptr) {
@@ -30,6 +30,9 @@ class ImageExternalTextureGL : public ImageExternalTexture {
   // |ImageExternalTexture|
   void Detach() override;
 
+  // |ImageExternalTexture|
+  void OnImagesEvicted(const std::vector<HardwareBufferKey>& keys) override;
+
   // |ImageExternalTexture|
   void ProcessFrame(PaintContext& context, const SkRect& bounds) override;
 
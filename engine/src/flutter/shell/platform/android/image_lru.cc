@@ -4,63 +4,72 @@
 
 #include "flutter/shell/platform/android/image_lru.h"
 
+#include <algorithm>
+
 namespace flutter {
 
+ImageLRU::ImageLRU(size_t max_images, size_t max_bytes)
+    : max_images_(std::max<size_t>(max_images, 1u)), max_bytes_(max_bytes) {
+  images_.reserve(max_images_);
+}
+
 sk_sp<flutter::DlImage> ImageLRU::FindImage(
     std::optional<HardwareBufferKey> key) {
   if (!key.has_value()) {
+    miss_count_++;
     return nullptr;
   }
   auto key_value = key.value();
-  for (size_t i = 0u; i < kImageReaderSwapchainSize; i++) {
-    if (images_[i].key == key_value) {
-      auto result = images_[i].value;
-      UpdateKey(result, key_value);
-      return result;
-    }
+  auto it = std::find_if(images_.begin(), images_.end(),
+                         [key_value](const Data& data) {
+                           return data.key == key_value;
+                         });
+  if (it == images_.end()) {
+    miss_count_++;
+    return nullptr;
   }
-  return nullptr;
+  hit_count_++;
+  // Marks [key] as the most recently used.
+  std::rotate(images_.begin(), it, it + 1);
+  return images_.front().value;
 }
 
-void ImageLRU::UpdateKey(const sk_sp<flutter::DlImage>& image,
-                         HardwareBufferKey key) {
-  if (images_[0].key == key) {
-    return;
-  }
-  size_t i = 1u;
-  for (; i < kImageReaderSwapchainSize; i++) {
-    if (images_[i].key == key) {
-      break;
-    }
+std::vector<HardwareBufferKey> ImageLRU::AddImage(
+    const sk_sp<flutter::DlImage>& image,
+    HardwareBufferKey key) {
+  auto it = std::find_if(images_.begin(), images_.end(),
+                         [key](const Data& data) { return data.key == key; });
+  if (it != images_.end()) {
+    byte_size_ -= it->byte_size;
+    images_.erase(it);
   }
-  for (auto j = i; j > 0; j--) {
-    images_[j] = images_[j - 1];
-  }
-  images_[0] = Data{.key = key, .value = image};
+  size_t byte_size = image ? image->GetApproximateByteSize() : 0u;
+  images_.insert(images_.begin(),
+                 Data{.key = key, .value = image, .byte_size = byte_size});
+  byte_size_ += byte_size;
+  return EvictUntil(max_images_, max_bytes_, 1u);
 }
 
-HardwareBufferKey ImageLRU::AddImage(const sk_sp<flutter::DlImage>& image,
-                                     HardwareBufferKey key) {
-  HardwareBufferKey lru_key = images_[kImageReaderSwapchainSize - 1].key;
-  bool updated_image = false;
-  for (size_t i = 0u; i < kImageReaderSwapchainSize; i++) {
-    if (images_[i].key == lru_key) {
-      updated_image = true;
-      images_[i] = Data{.key = key, .value = image};
-      break;
-    }
-  }
-  if (!updated_image) {
-    images_[0] = Data{.key = key, .value = image};
+std::vector<HardwareBufferKey> ImageLRU::Trim() {
+  return EvictUntil(1u, 0u, 1u);
+}
+
+std::vector<HardwareBufferKey> ImageLRU::EvictUntil(size_t max_images,
+                                                    size_t max_bytes,
+                                                    size_t min_images) {
+  std::vector<HardwareBufferKey> evicted;
+  while (images_.size() > min_images &&
+         (images_.size() > max_images || byte_size_ > max_bytes)) {
+    byte_size_ -= images_.back().byte_size;
+    evicted.push_back(images_.back().key);
+    images_.pop_back();
   }
-  UpdateKey(image, key);
-  return lru_key;
+  return evicted;
 }
 
 void ImageLRU::Clear() {
-  for (size_t i = 0u; i < kImageReaderSwapchainSize; i++) {
-    images_[i] = Data{.key = 0u, .value = nullptr};
-  }
+  images_.clear();
+  byte_size_ = 0u;
 }
 
 }  // namespace flutter
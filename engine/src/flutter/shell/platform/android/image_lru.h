@@ -5,8 +5,9 @@
 #ifndef FLUTTER_SHELL_PLATFORM_ANDROID_IMAGE_LRU_H_
 #define FLUTTER_SHELL_PLATFORM_ANDROID_IMAGE_LRU_H_
 
-#include <array>
 #include <cstddef>
+#include <optional>
+#include <vector>
 
 #include "display_list/image/dl_image.h"
 
@@ -19,37 +20,72 @@ namespace flutter {
 // necessary.
 static constexpr size_t kImageReaderSwapchainSize = 6u;
 
+// The default number of bytes of images the cache may retain. The most
+// recently used image is always kept, even if it alone exceeds the budget.
+static constexpr size_t kImageLRUDefaultByteBudget = 64u * 1024u * 1024u;
+
 using HardwareBufferKey = uint64_t;
 
 class ImageLRU {
  public:
-  ImageLRU() = default;
+  explicit ImageLRU(size_t max_images = kImageReaderSwapchainSize,
+                    size_t max_bytes = kImageLRUDefaultByteBudget);
 
   ~ImageLRU() = default;
 
   /// @brief Retrieve the image associated with the given [key], or nullptr.
+  ///
+  /// Each call counts as either a hit or a miss.
   sk_sp<flutter::DlImage> FindImage(std::optional<HardwareBufferKey> key);
 
-  /// @brief Add a new image to the cache with a key, returning the key of the
-  ///        LRU entry that was removed.
+  /// @brief Add a new image to the cache with a key, returning the keys of the
+  ///        LRU entries that were removed to stay within the limits.
   ///
-  /// The value may be `0`, in which case nothing was removed.
-  HardwareBufferKey AddImage(const sk_sp<flutter::DlImage>& image,
-                             HardwareBufferKey key);
+  /// The result may be empty, in which case nothing was removed.
+  std::vector<HardwareBufferKey> AddImage(const sk_sp<flutter::DlImage>& image,
+                                          HardwareBufferKey key);
+
+  /// @brief Remove all but the most recently used entry, returning the keys
+  ///        of the removed entries.
+  ///
+  /// Used to release memory when the system is running low.
+  std::vector<HardwareBufferKey> Trim();
 
   /// @brief Remove all entires from the image cache.
   void Clear();
 
- private:
-  /// @brief Marks [key] as the most recently used.
-  void UpdateKey(const sk_sp<flutter::DlImage>& image, HardwareBufferKey key);
+  /// @brief The number of images currently in the cache.
+  size_t GetImageCount() const { return images_.size(); }
 
+  /// @brief The approximate number of bytes of the images in the cache.
+  size_t GetByteSize() const { return byte_size_; }
+
+  /// @brief The number of lookups that found a cached image.
+  size_t GetHitCount() const { return hit_count_; }
+
+  /// @brief The number of lookups that did not find a cached image.
+  size_t GetMissCount() const { return miss_count_; }
+
+ private:
   struct Data {
     HardwareBufferKey key = 0u;
     sk_sp<flutter::DlImage> value;
+    size_t byte_size = 0u;
   };
 
-  std::array<Data, kImageReaderSwapchainSize> images_;
+  /// @brief Removes entries from the back until the cache is within
+  ///        [max_images] and [max_bytes], or only [min_images] remain.
+  std::vector<HardwareBufferKey> EvictUntil(size_t max_images,
+                                            size_t max_bytes,
+                                            size_t min_images);
+
+  const size_t max_images_;
+  const size_t max_bytes_;
+  // Ordered from most to least recently used.
+  std::vector<Data> images_;
+  size_t byte_size_ = 0u;
+  size_t hit_count_ = 0u;
+  size_t miss_count_ = 0u;
 };
 
 }  // namespace flutter
@@ -25,7 +25,7 @@ TEST(ImageLRU, EvictsLRU) {
 
   // Fill up the cache, nothing is removed
   for (auto i = 0u; i < kImageReaderSwapchainSize; i++) {
-    EXPECT_EQ(image_lru.AddImage(image, i + 1), 0u);
+    EXPECT_TRUE(image_lru.AddImage(image, i + 1).empty());
   }
   // Confirm each image is in the cache. This should keep the LRU
   // order the same.
@@ -34,7 +34,70 @@ TEST(ImageLRU, EvictsLRU) {
   }
 
   // Insert new image and verify least recently used was removed.
-  EXPECT_EQ(image_lru.AddImage(image, 100), 1u);
+  EXPECT_EQ(image_lru.AddImage(image, 100),
+            std::vector<HardwareBufferKey>{1u});
+}
+
+TEST(ImageLRU, EvictsToStayWithinByteBudget) {
+  auto image = DlImage::Make(nullptr);
+  size_t image_size = image->GetApproximateByteSize();
+  ImageLRU image_lru(kImageReaderSwapchainSize, image_size * 2);
+
+  EXPECT_TRUE(image_lru.AddImage(image, 1).empty());
+  EXPECT_TRUE(image_lru.AddImage(image, 2).empty());
+  EXPECT_EQ(image_lru.GetByteSize(), image_size * 2);
+
+  // Using the first image makes the second one the least recently used.
+  EXPECT_EQ(image_lru.FindImage(1), image);
+  EXPECT_EQ(image_lru.AddImage(image, 3), std::vector<HardwareBufferKey>{2u});
+  EXPECT_EQ(image_lru.GetImageCount(), 2u);
+  EXPECT_EQ(image_lru.GetByteSize(), image_size * 2);
+}
+
+TEST(ImageLRU, KeepsMostRecentImageOverByteBudget) {
+  auto image = DlImage::Make(nullptr);
+  ImageLRU image_lru(kImageReaderSwapchainSize, 0u);
+
+  EXPECT_TRUE(image_lru.AddImage(image, 1).empty());
+  EXPECT_EQ(image_lru.AddImage(image, 2), std::vector<HardwareBufferKey>{1u});
+  EXPECT_EQ(image_lru.FindImage(2), image);
+}
+
+TEST(ImageLRU, ReplacesImageWithSameKey) {
+  auto image = DlImage::Make(nullptr);
+  auto other_image = DlImage::Make(nullptr);
+  ImageLRU image_lru;
+
+  EXPECT_TRUE(image_lru.AddImage(image, 1).empty());
+  EXPECT_TRUE(image_lru.AddImage(other_image, 1).empty());
+  EXPECT_EQ(image_lru.GetImageCount(), 1u);
+  EXPECT_EQ(image_lru.FindImage(1), other_image);
+}
+
+TEST(ImageLRU, TrimKeepsMostRecentImage) {
+  auto image = DlImage::Make(nullptr);
+  ImageLRU image_lru;
+
+  for (auto i = 0u; i < 3u; i++) {
+    EXPECT_TRUE(image_lru.AddImage(image, i + 1).empty());
+  }
+  EXPECT_EQ(image_lru.Trim(), (std::vector<HardwareBufferKey>{1u, 2u}));
+  EXPECT_EQ(image_lru.GetImageCount(), 1u);
+  EXPECT_EQ(image_lru.FindImage(3), image);
+  EXPECT_TRUE(image_lru.Trim().empty());
+}
+
+TEST(ImageLRU, CountsHitsAndMisses) {
+  auto image = DlImage::Make(nullptr);
+  ImageLRU image_lru;
+
+  EXPECT_EQ(image_lru.FindImage(1), nullptr);
+  EXPECT_EQ(image_lru.FindImage(std::nullopt), nullptr);
+  image_lru.AddImage(image, 1);
+  EXPECT_EQ(image_lru.FindImage(1), image);
+
+  EXPECT_EQ(image_lru.GetHitCount(), 1u);
+  EXPECT_EQ(image_lru.GetMissCount(), 2u);
 }
 
 TEST(ImageLRU, CanClear) {
@@ -43,7 +106,7 @@ TEST(ImageLRU, CanClear) {
 
   // Fill up the cache, nothing is removed
   for (auto i = 0u; i < kImageReaderSwapchainSize; i++) {
-    EXPECT_EQ(image_lru.AddImage(image, i + 1), 0u);
+    EXPECT_TRUE(image_lru.AddImage(image, i + 1).empty());
   }
   image_lru.Clear();
 
@@ -11,6 +11,7 @@ import android.content.Context;
 import android.content.res.AssetManager;
 import android.graphics.Bitmap;
 import android.graphics.SurfaceTexture;
+import android.hardware.HardwareBuffer;
 import android.os.Build;
 import android.os.Looper;
 import android.util.DisplayMetrics;
@@ -29,6 +30,7 @@ import io.flutter.embedding.engine.FlutterEngine.EngineLifecycleListener;
 import io.flutter.embedding.engine.dart.PlatformMessageHandler;
 import io.flutter.embedding.engine.deferredcomponents.DeferredComponentManager;
 import io.flutter.embedding.engine.image.FlutterImageDecoder;
+import io.flutter.embedding.engine.image.HardwareImageDecoder;
 import io.flutter.embedding.engine.mutatorsstack.FlutterMutatorsStack;
 import io.flutter.embedding.engine.renderer.FlutterUiDisplayListener;
 import io.flutter.embedding.engine.renderer.FlutterUiResizeListener;
@@ -583,6 +585,49 @@ public class FlutterJNI {
     return null;
   }
 
+  /**
+   * Called by native to find whether an image can be decoded with {@link HardwareImageDecoder}, and
+   * at which size. Like {@link #decodeImage}, this is called on worker threads.
+   */
+  @SuppressWarnings("unused")
+  @VisibleForTesting
+  @Nullable
+  public static int[] decodeImageSizeForHardware(@NonNull ByteBuffer buffer) {
+    if (Build.VERSION.SDK_INT >= API_LEVELS.API_31) {
+      return HardwareImageDecoder.decodeImageSize(buffer);
+    }
+    return null;
+  }
+
+  /**
+   * Called by native to decode an image found by {@link #decodeImageSizeForHardware} into a {@link
+   * HardwareBuffer} that the native code imports as a texture and then closes.
+   */
+  @SuppressWarnings("unused")
+  @VisibleForTesting
+  @Nullable
+  public static HardwareBuffer decodeImageToHardwareBuffer(
+      @NonNull ByteBuffer buffer, int width, int height) {
+    if (Build.VERSION.SDK_INT >= API_LEVELS.API_31) {
+      return HardwareImageDecoder.decodeImageToHardwareBuffer(buffer, width, height);
+    }
+    return null;
+  }
+
+  /**
+   * Called by native to decode an image found by {@link #decodeImageSizeForHardware} into a
+   * software {@link Bitmap}, when it can't be decoded into a {@link HardwareBuffer}.
+   */
+  @SuppressWarnings("unused")
+  @VisibleForTesting
+  @Nullable
+  public static Bitmap decodeImageToBitmap(@NonNull ByteBuffer buffer, int width, int height) {
+    if (Build.VERSION.SDK_INT >= API_LEVELS.API_31) {
+      return HardwareImageDecoder.decodeImageToBitmap(buffer, width, height);
+    }
+    return null;
+  }
+
   // Called by native to notify first Flutter frame rendered.
   @SuppressWarnings("unused")
   @VisibleForTesting
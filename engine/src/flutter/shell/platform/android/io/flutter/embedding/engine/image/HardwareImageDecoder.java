@@ -0,0 +1,130 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+package io.flutter.embedding.engine.image;
+
+import android.graphics.Bitmap;
+import android.graphics.ColorSpace;
+import android.hardware.HardwareBuffer;
+import androidx.annotation.NonNull;
+import androidx.annotation.Nullable;
+import androidx.annotation.RequiresApi;
+import androidx.exifinterface.media.ExifInterface;
+import io.flutter.Build;
+import io.flutter.Log;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+
+/**
+ * Decodes JPEG and HEIF images with {@link android.graphics.ImageDecoder}, which uses the hardware
+ * decoders of the device where there are some.
+ *
+ * <p>Images are decoded at the size they are drawn at, either into a {@link HardwareBuffer} that
+ * the GPU samples from without a copy, or into a software {@link Bitmap}. Images that are mirrored
+ * by their EXIF orientation are not supported, since {@link android.graphics.ImageDecoder} does not
+ * mirror every format.
+ */
+@RequiresApi(Build.API_LEVELS.API_31)
+public final class HardwareImageDecoder {
+  private static final String TAG = "HardwareImageDecoder";
+
+  private HardwareImageDecoder() {}
+
+  /**
+   * Returns the size of the image in the given {@link ByteBuffer} once it is rotated by its
+   * orientation, as {@code {width, height}}, or null if the image is not one this class decodes.
+   *
+   * @param buffer The {@link ByteBuffer} containing the encoded image.
+   * @return The width and height of the image, or null.
+   */
+  @Nullable
+  public static int[] decodeImageSize(@NonNull ByteBuffer buffer) {
+    byte[] bytes = ImageUtils.getBytes(buffer);
+    Metadata metadata = new Metadata();
+    BitmapMetadataReader.read(bytes, metadata);
+    if (!"image/jpeg".equals(metadata.mimeType) && !metadata.isHeif()) {
+      return null;
+    }
+    if (metadata.originalWidth <= 0 || metadata.originalHeight <= 0) {
+      return null;
+    }
+    metadata.orientation = ExifInterface.ORIENTATION_NORMAL;
+    ExifMetadataReader.read(bytes, metadata);
+    if (ImageUtils.isFlipCase(metadata.orientation)) {
+      return null;
+    }
+
+    if (metadata.isHeif()) {
+      // HEIF images are rotated by their track format rather than their EXIF data.
+      MediaMetadataReader.read(bytes, metadata);
+      if (metadata.width <= 0 || metadata.height <= 0) {
+        return null;
+      }
+      return new int[] {metadata.width, metadata.height};
+    }
+    switch (metadata.orientation) {
+      case ExifInterface.ORIENTATION_ROTATE_90:
+      case ExifInterface.ORIENTATION_ROTATE_270:
+        return new int[] {metadata.originalHeight, metadata.originalWidth};
+      default:
+        return new int[] {metadata.originalWidth, metadata.originalHeight};
+    }
+  }
+
+  /**
+   * Decodes the image in the given {@link ByteBuffer} at the given size into a {@link
+   * HardwareBuffer}.
+   *
+   * @param buffer The {@link ByteBuffer} containing the encoded image.
+   * @param width The width to decode the image at.
+   * @param height The height to decode the image at.
+   * @return The {@link HardwareBuffer} the image was decoded into, which the caller must close, or
+   *     null if decoding fails.
+   */
+  @Nullable
+  public static HardwareBuffer decodeImageToHardwareBuffer(
+      @NonNull ByteBuffer buffer, int width, int height) {
+    Bitmap bitmap =
+        decodeImage(buffer, width, height, android.graphics.ImageDecoder.ALLOCATOR_HARDWARE);
+    if (bitmap == null) {
+      return null;
+    }
+    HardwareBuffer hardwareBuffer = bitmap.getHardwareBuffer();
+    bitmap.recycle();
+    return hardwareBuffer;
+  }
+
+  /**
+   * Decodes the image in the given {@link ByteBuffer} at the given size into a software {@link
+   * Bitmap} in the {@link Bitmap.Config#ARGB_8888} configuration.
+   *
+   * @param buffer The {@link ByteBuffer} containing the encoded image.
+   * @param width The width to decode the image at.
+   * @param height The height to decode the image at.
+   * @return The decoded {@link Bitmap}, or null if decoding fails.
+   */
+  @Nullable
+  public static Bitmap decodeImageToBitmap(@NonNull ByteBuffer buffer, int width, int height) {
+    return decodeImage(buffer, width, height, android.graphics.ImageDecoder.ALLOCATOR_SOFTWARE);
+  }
+
+  @Nullable
+  private static Bitmap decodeImage(
+      @NonNull ByteBuffer buffer, int width, int height, int allocator) {
+    android.graphics.ImageDecoder.Source source =
+        android.graphics.ImageDecoder.createSource(buffer);
+    try {
+      return android.graphics.ImageDecoder.decodeBitmap(
+          source,
+          (decoder, info, src) -> {
+            decoder.setTargetColorSpace(ColorSpace.get(ColorSpace.Named.SRGB));
+            decoder.setAllocator(allocator);
+            decoder.setTargetSize(width, height);
+          });
+    } catch (IOException e) {
+      Log.e(TAG, "Failed to decode image", e);
+      return null;
+    }
+  }
+}
@@ -46,6 +46,10 @@ public class FlutterLoader {
       "io.flutter.embedding.android.EnableVulkanValidation";
   private static final String IMPELLER_BACKEND_META_DATA_KEY =
       "io.flutter.embedding.android.ImpellerBackend";
+  private static final String IMPELLER_VULKAN_ALLOWLIST_META_DATA_KEY =
+      "io.flutter.embedding.android.ImpellerVulkanAllowlist";
+  private static final String IMPELLER_VULKAN_DENYLIST_META_DATA_KEY =
+      "io.flutter.embedding.android.ImpellerVulkanDenylist";
   private static final String IMPELLER_OPENGL_GPU_TRACING_DATA_KEY =
       "io.flutter.embedding.android.EnableOpenGLGPUTracing";
   private static final String IMPELLER_VULKAN_GPU_TRACING_DATA_KEY =
@@ -59,6 +63,10 @@ public class FlutterLoader {
       "io.flutter.embedding.android.ImpellerLazyShaderInitialization";
   private static final String IMPELLER_ANTIALIAS_LINES =
       "io.flutter.embedding.android.ImpellerAntialiasLines";
+  private static final String ENABLE_HARDWARE_IMAGE_DECODING =
+      "io.flutter.embedding.android.EnableHardwareImageDecoding";
+  private static final String PREFETCH_SNAPSHOT_PAGES =
+      "io.flutter.embedding.android.PrefetchSnapshotPages";
 
   /**
    * Set whether leave or clean up the VM after the last shell shuts down. It can be set from app's
@@ -444,12 +452,26 @@ public class FlutterLoader {
         if (backend != null) {
           shellArgs.add("--impeller-backend=" + backend);
         }
+        String vulkanAllowlist = metaData.getString(IMPELLER_VULKAN_ALLOWLIST_META_DATA_KEY);
+        if (vulkanAllowlist != null) {
+          shellArgs.add("--impeller-vulkan-allowlist=" + vulkanAllowlist);
+        }
+        String vulkanDenylist = metaData.getString(IMPELLER_VULKAN_DENYLIST_META_DATA_KEY);
+        if (vulkanDenylist != null) {
+          shellArgs.add("--impeller-vulkan-denylist=" + vulkanDenylist);
+        }
         if (metaData.getBoolean(IMPELLER_LAZY_SHADER_MODE)) {
           shellArgs.add("--impeller-lazy-shader-mode");
         }
         if (metaData.getBoolean(IMPELLER_ANTIALIAS_LINES)) {
           shellArgs.add("--impeller-antialias-lines");
         }
+        if (metaData.getBoolean(ENABLE_HARDWARE_IMAGE_DECODING, false)) {
+          shellArgs.add("--enable-hardware-image-decoding");
+        }
+        if (metaData.getBoolean(PREFETCH_SNAPSHOT_PAGES, false)) {
+          shellArgs.add("--prefetch-snapshot-pages");
+        }
       }
 
       final String leakVM = isLeakVM(metaData) ? "true" : "false";
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "flutter/fml/platform/android/jni_util.h"
+#include "flutter/shell/platform/android/android_hardware_image_generator.h"
 #include "flutter/shell/platform/android/android_image_generator.h"
 #include "flutter/shell/platform/android/flutter_main.h"
 #include "flutter/shell/platform/android/platform_view_android.h"
@@ -32,5 +33,9 @@ JNIEXPORT jint JNI_OnLoad(JavaVM* vm, void* reserved) {
   result = flutter::AndroidImageGenerator::Register(env);
   FML_CHECK(result);
 
+  // Register AndroidHardwareImageGenerator.
+  result = flutter::AndroidHardwareImageGenerator::Register(env);
+  FML_CHECK(result);
+
   return JNI_VERSION_1_4;
 }
@@ -63,6 +63,10 @@ AndroidContext::ContextSettings CreateContextSettings(
       p_settings.impeller_enable_lazy_shader_mode;
   settings.impeller_flags.antialiased_lines =
       p_settings.impeller_antialiased_lines;
+  settings.vulkan_allowlist = p_settings.impeller_vulkan_allowlist;
+  settings.vulkan_denylist = p_settings.impeller_vulkan_denylist;
+  settings.vulkan_bundled_pipeline_caches =
+      p_settings.impeller_vulkan_bundled_pipeline_caches;
   return settings;
 }
 }  // namespace
@@ -129,10 +129,19 @@ void SurfaceTextureExternalTextureVKImpeller::ProcessFrame(
       SurfaceContextVK::Cast(*context.aiks_context->GetContext());
   const auto& context_vk = ContextVK::Cast(*surface_context.GetParent());
 
-  auto dst_texture = GetCachedTextureSource(
-      surface_context.GetParent(),                                        //
-      ISize::MakeWH(mapped_bounds.GetWidth(), mapped_bounds.GetHeight())  //
-  );
+  const ISize target_size =
+      ISize::MakeWH(mapped_bounds.GetWidth(), mapped_bounds.GetHeight());
+
+  // Copying through the trampoline costs a full-frame pass. When the surface
+  // texture has not produced a new frame, the last copy is still current.
+  if (dl_image_ && cached_texture_source_ &&
+      cached_texture_source_->GetTextureDescriptor().size == target_size &&
+      !ShouldUpdate()) {
+    return;
+  }
+
+  auto dst_texture =
+      GetCachedTextureSource(surface_context.GetParent(), target_size);
   if (!dst_texture || !dst_texture->IsValid()) {
     VALIDATION_LOG << "Could not fetch trampoline texture target.";
     return;
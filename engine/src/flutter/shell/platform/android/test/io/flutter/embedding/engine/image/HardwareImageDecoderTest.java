@@ -0,0 +1,47 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+package io.flutter.embedding.engine.image;
+
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertNull;
+
+import android.graphics.Bitmap;
+import androidx.test.ext.junit.runners.AndroidJUnit4;
+import io.flutter.Build;
+import java.io.ByteArrayOutputStream;
+import java.nio.ByteBuffer;
+import org.junit.Test;
+import org.junit.runner.RunWith;
+import org.robolectric.annotation.Config;
+
+/** Unit tests for {@link HardwareImageDecoder}. */
+@RunWith(AndroidJUnit4.class)
+@Config(minSdk = Build.API_LEVELS.API_31)
+public class HardwareImageDecoderTest {
+
+  private byte[] createTestImage(int width, int height, Bitmap.CompressFormat format) {
+    Bitmap bitmap = Bitmap.createBitmap(width, height, Bitmap.Config.ARGB_8888);
+    ByteArrayOutputStream stream = new ByteArrayOutputStream();
+    bitmap.compress(format, 100, stream);
+    bitmap.recycle();
+    return stream.toByteArray();
+  }
+
+  @Test
+  public void decodeImageSize_returnsSizeOfJpeg() {
+    byte[] imageBytes = createTestImage(120, 250, Bitmap.CompressFormat.JPEG);
+
+    int[] size = HardwareImageDecoder.decodeImageSize(ByteBuffer.wrap(imageBytes));
+
+    assertArrayEquals(new int[] {120, 250}, size);
+  }
+
+  @Test
+  public void decodeImageSize_returnsNullForPng() {
+    byte[] imageBytes = createTestImage(120, 250, Bitmap.CompressFormat.PNG);
+
+    assertNull(HardwareImageDecoder.decodeImageSize(ByteBuffer.wrap(imageBytes)));
+  }
+}
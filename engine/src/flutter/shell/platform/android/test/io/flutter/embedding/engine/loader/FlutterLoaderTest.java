@@ -409,6 +409,36 @@ public class FlutterLoaderTest {
     assertTrue(arguments.contains(shaderModeArg));
   }
 
+  @Test
+  public void itSetsVulkanAllowlistAndDenylistFromMetaData() {
+    FlutterJNI mockFlutterJNI = mock(FlutterJNI.class);
+    FlutterLoader flutterLoader = new FlutterLoader(mockFlutterJNI);
+    Bundle metaData = new Bundle();
+    metaData.putString("io.flutter.embedding.android.ImpellerVulkanAllowlist", "board1,board2");
+    metaData.putString("io.flutter.embedding.android.ImpellerVulkanDenylist", "board3");
+    ctx.getApplicationInfo().metaData = metaData;
+
+    FlutterLoader.Settings settings = new FlutterLoader.Settings();
+    assertFalse(flutterLoader.initialized());
+    flutterLoader.startInitialization(ctx, settings);
+    flutterLoader.ensureInitializationComplete(ctx, null);
+    shadowOf(getMainLooper()).idle();
+
+    ArgumentCaptor<String[]> shellArgsCaptor = ArgumentCaptor.forClass(String[].class);
+    verify(mockFlutterJNI, times(1))
+        .init(
+            eq(ctx),
+            shellArgsCaptor.capture(),
+            anyString(),
+            anyString(),
+            anyString(),
+            anyLong(),
+            anyInt());
+    List<String> arguments = Arrays.asList(shellArgsCaptor.getValue());
+    assertTrue(arguments.contains("--impeller-vulkan-allowlist=board1,board2"));
+    assertTrue(arguments.contains("--impeller-vulkan-denylist=board3"));
+  }
+
   @Test
   public void itSetsAotSharedLibraryNameIfPathIsInInternalStorage() throws IOException {
     FlutterJNI mockFlutterJNI = mock(FlutterJNI.class);
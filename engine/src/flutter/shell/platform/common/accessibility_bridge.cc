@@ -19,6 +19,39 @@ constexpr int kHasScrollingAction =
     FlutterSemanticsAction::kFlutterSemanticsActionScrollUp |
     FlutterSemanticsAction::kFlutterSemanticsActionScrollDown;
 
+namespace {
+
+// Whether a node of the tree already has the data converted from an update.
+//
+// The offset container of the node is not compared, as the tree sets it to
+// the parent of the node once an update is applied.
+bool HasSameData(const ui::AXNodeData& existing,
+                 const ui::AXNodeData& updated) {
+  if (existing.role != updated.role || existing.state != updated.state ||
+      existing.actions != updated.actions ||
+      existing.string_attributes != updated.string_attributes ||
+      existing.int_attributes != updated.int_attributes ||
+      existing.float_attributes != updated.float_attributes ||
+      existing.bool_attributes != updated.bool_attributes ||
+      existing.intlist_attributes != updated.intlist_attributes ||
+      existing.stringlist_attributes != updated.stringlist_attributes ||
+      existing.html_attributes != updated.html_attributes ||
+      existing.child_ids != updated.child_ids ||
+      existing.relative_bounds.bounds != updated.relative_bounds.bounds) {
+    return false;
+  }
+  const gfx::Transform* existing_transform =
+      existing.relative_bounds.transform.get();
+  const gfx::Transform* updated_transform =
+      updated.relative_bounds.transform.get();
+  if (existing_transform == nullptr || updated_transform == nullptr) {
+    return existing_transform == updated_transform;
+  }
+  return *existing_transform == *updated_transform;
+}
+
+}  // namespace
+
 // AccessibilityBridge
 AccessibilityBridge::AccessibilityBridge()
     : tree_(std::make_unique<ui::AXTree>()) {
@@ -135,7 +168,24 @@ AccessibilityBridge::GetFlutterPlatformNodeDelegateFromID(
     return iter->second;
   }
 
-  return std::weak_ptr<FlutterPlatformNodeDelegate>();
+  // Delegates are only created once a node is first asked for, which is
+  // usually when the assistive technology walks to it. Large semantics trees
+  // would otherwise create a platform node for every semantics node up
+  // front.
+  ui::AXNode* node = tree_->GetFromId(id);
+  if (!node) {
+    return std::weak_ptr<FlutterPlatformNodeDelegate>();
+  }
+  auto bridge =
+      std::const_pointer_cast<AccessibilityBridge>(shared_from_this());
+  std::shared_ptr<FlutterPlatformNodeDelegate> delegate =
+      bridge->CreateFlutterPlatformNodeDelegate();
+  id_wrapper_map_[id] = delegate;
+  delegate->Init(
+      std::static_pointer_cast<FlutterPlatformNodeDelegate::OwnerBridge>(
+          bridge),
+      node);
+  return delegate;
 }
 
 const ui::AXTreeData& AccessibilityBridge::GetAXTreeData() const {
@@ -167,20 +217,17 @@ void AccessibilityBridge::OnNodeDataChanged(
     ui::AXTree* tree,
     const ui::AXNodeData& old_node_data,
     const ui::AXNodeData& new_node_data) {
-  auto platform_view =
-      GetFlutterPlatformNodeDelegateFromID(new_node_data.id).lock();
-  if (platform_view) {
-    platform_view->NodeDataChanged(old_node_data, new_node_data);
+  // Nodes without a delegate have not been seen by the assistive technology
+  // yet, their delegate will be created from the new data.
+  auto iter = id_wrapper_map_.find(new_node_data.id);
+  if (iter != id_wrapper_map_.end()) {
+    iter->second->NodeDataChanged(old_node_data, new_node_data);
   }
 }
 
 void AccessibilityBridge::OnNodeCreated(ui::AXTree* tree, ui::AXNode* node) {
   BASE_DCHECK(node);
-  id_wrapper_map_[node->id()] = CreateFlutterPlatformNodeDelegate();
-  id_wrapper_map_[node->id()]->Init(
-      std::static_pointer_cast<FlutterPlatformNodeDelegate::OwnerBridge>(
-          shared_from_this()),
-      node);
+  // The delegate is created lazily by GetFlutterPlatformNodeDelegateFromID.
 }
 
 void AccessibilityBridge::OnNodeDeleted(ui::AXTree* tree,
@@ -307,7 +354,16 @@ void AccessibilityBridge::ConvertFlutterUpdate(const SemanticsNode& node,
     node_data.child_ids.push_back(child);
   }
   SetTreeData(node, tree_update);
-  tree_update.nodes.push_back(node_data);
+
+  // The framework sends every node of a dirty subtree, most of which are
+  // often unchanged. Leaving those out of the tree update saves the tree
+  // from diffing their attributes and the platforms from handling their
+  // data changes.
+  ui::AXNode* existing = tree_->GetFromId(node.id);
+  if (existing && HasSameData(existing->data(), node_data)) {
+    return;
+  }
+  tree_update.nodes.push_back(std::move(node_data));
 }
 
 void AccessibilityBridge::SetRoleFromFlutterUpdate(ui::AXNodeData& node_data,
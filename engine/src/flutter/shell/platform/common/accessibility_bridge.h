@@ -81,7 +81,8 @@ class AccessibilityBridge
   /// @brief      Get the flutter platform node delegate with the given id from
   ///             this accessibility bridge. Returns expired weak_ptr if the
   ///             delegate associated with the id does not exist or has been
-  ///             removed from the accessibility tree.
+  ///             removed from the accessibility tree. The delegate of a node
+  ///             that was not asked for before is created by this call.
   ///
   /// @param[in]  id           The id of the flutter accessibility node you want
   ///                          to retrieve.
@@ -193,8 +194,10 @@ class AccessibilityBridge
     std::string hint;
   } SemanticsCustomAction;
 
-  std::unordered_map<AccessibilityNodeId,
-                     std::shared_ptr<FlutterPlatformNodeDelegate>>
+  // The delegates of the nodes that were asked for, see
+  // |GetFlutterPlatformNodeDelegateFromID|.
+  mutable std::unordered_map<AccessibilityNodeId,
+                             std::shared_ptr<FlutterPlatformNodeDelegate>>
       id_wrapper_map_;
   std::unique_ptr<ui::AXTree> tree_;
   ui::AXEventGenerator event_generator_;
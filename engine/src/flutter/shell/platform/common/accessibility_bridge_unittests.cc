@@ -73,6 +73,81 @@ TEST(AccessibilityBridgeTest, BasicTest) {
   EXPECT_EQ(child2_node->GetName(), "child 2");
 }
 
+TEST(AccessibilityBridgeTest, OnlyAppliesChangedNodes) {
+  std::shared_ptr<TestAccessibilityBridge> bridge =
+      std::make_shared<TestAccessibilityBridge>();
+
+  std::vector<int32_t> children{1, 2};
+  FlutterSemanticsNode2 root = CreateSemanticsNode(0, "root", &children);
+  FlutterSemanticsNode2 child1 = CreateSemanticsNode(1, "child 1");
+  FlutterSemanticsNode2 child2 = CreateSemanticsNode(2, "child 2");
+
+  bridge->AddFlutterSemanticsNodeUpdate(root);
+  bridge->AddFlutterSemanticsNodeUpdate(child1);
+  bridge->AddFlutterSemanticsNodeUpdate(child2);
+  bridge->CommitUpdates();
+  bridge->accessibility_events.clear();
+  bridge->changed_node_ids.clear();
+
+  // Delegates only get notified of changes once they have been created.
+  for (AccessibilityNodeId id = 0; id <= 2; id++) {
+    ASSERT_FALSE(bridge->GetFlutterPlatformNodeDelegateFromID(id).expired());
+  }
+
+  // Resend the whole tree with only the label of child 2 changed.
+  child2.label = "new child 2";
+  bridge->AddFlutterSemanticsNodeUpdate(root);
+  bridge->AddFlutterSemanticsNodeUpdate(child1);
+  bridge->AddFlutterSemanticsNodeUpdate(child2);
+  bridge->CommitUpdates();
+
+  EXPECT_EQ(bridge->changed_node_ids, std::vector<AccessibilityNodeId>{2});
+  EXPECT_THAT(bridge->accessibility_events,
+              Contains(ui::AXEventGenerator::Event::NAME_CHANGED).Times(1));
+  EXPECT_EQ(
+      bridge->GetFlutterPlatformNodeDelegateFromID(2).lock()->GetName(),
+      "new child 2");
+
+  // Resending the unchanged tree does not change any nodes.
+  bridge->changed_node_ids.clear();
+  bridge->AddFlutterSemanticsNodeUpdate(root);
+  bridge->AddFlutterSemanticsNodeUpdate(child1);
+  bridge->AddFlutterSemanticsNodeUpdate(child2);
+  bridge->CommitUpdates();
+
+  EXPECT_TRUE(bridge->changed_node_ids.empty());
+  EXPECT_EQ(bridge->GetFlutterPlatformNodeDelegateFromID(0).lock()->GetName(),
+            "root");
+}
+
+TEST(AccessibilityBridgeTest, CreatesPlatformNodeDelegatesOnDemand) {
+  std::shared_ptr<TestAccessibilityBridge> bridge =
+      std::make_shared<TestAccessibilityBridge>();
+
+  std::vector<int32_t> children{1};
+  FlutterSemanticsNode2 root = CreateSemanticsNode(0, "root", &children);
+  FlutterSemanticsNode2 child = CreateSemanticsNode(1, "child");
+  bridge->AddFlutterSemanticsNodeUpdate(root);
+  bridge->AddFlutterSemanticsNodeUpdate(child);
+  bridge->CommitUpdates();
+  bridge->changed_node_ids.clear();
+
+  // The child was never asked for, so there is no delegate to notify.
+  child.label = "new child";
+  bridge->AddFlutterSemanticsNodeUpdate(child);
+  bridge->CommitUpdates();
+  EXPECT_TRUE(bridge->changed_node_ids.empty());
+
+  // The delegate created on demand reflects the latest data.
+  auto delegate = bridge->GetFlutterPlatformNodeDelegateFromID(1).lock();
+  ASSERT_TRUE(delegate);
+  EXPECT_EQ(delegate->GetName(), "new child");
+  EXPECT_EQ(bridge->GetFlutterPlatformNodeDelegateFromID(1).lock(), delegate);
+
+  // Nodes that are not in the tree have no delegate.
+  EXPECT_TRUE(bridge->GetFlutterPlatformNodeDelegateFromID(2).expired());
+}
+
 // Flutter used to assume that the accessibility root had ID 0.
 // In a multi-view world, each view has its own accessibility root
 // with a globally unique node ID.
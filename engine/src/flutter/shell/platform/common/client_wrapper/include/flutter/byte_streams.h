@@ -22,6 +22,12 @@ class ByteStreamReader {
   // is responsible for ensuring that |buffer| is large enough.
   virtual void ReadBytes(uint8_t* buffer, size_t length) = 0;
 
+  // Returns the next |length| bytes of the stream where they are, and advances
+  // past them. Returns null without reading anything if the stream can't
+  // expose its bytes, in which case ReadBytes must be used instead. The bytes
+  // remain valid for as long as the data the stream reads from.
+  virtual const uint8_t* ReadBytesInPlace(size_t length) { return nullptr; }
+
   // Advances the read cursor to the next multiple of |alignment| relative to
   // the start of the stream, unless it is already aligned.
   virtual void ReadAlignment(uint8_t alignment) = 0;
@@ -5,11 +5,50 @@
 #ifndef FLUTTER_SHELL_PLATFORM_COMMON_CLIENT_WRAPPER_INCLUDE_FLUTTER_STANDARD_CODEC_SERIALIZER_H_
 #define FLUTTER_SHELL_PLATFORM_COMMON_CLIENT_WRAPPER_INCLUDE_FLUTTER_STANDARD_CODEC_SERIALIZER_H_
 
+#include <string_view>
+
 #include "byte_streams.h"
 #include "encodable_value.h"
 
 namespace flutter {
 
+// Receives the contents of an encoded value as they are decoded by
+// StandardCodecSerializer::ReadValue, without building an EncodableValue.
+//
+// Strings and typed lists point into the message being decoded when possible,
+// so they are only valid for the duration of the call. Methods that are not
+// overridden ignore their values.
+class StandardCodecValueHandler {
+ public:
+  virtual ~StandardCodecValueHandler() = default;
+
+  virtual void OnNull() {}
+  virtual void OnBool(bool value) {}
+  virtual void OnInt32(int32_t value) {}
+  virtual void OnInt64(int64_t value) {}
+  virtual void OnDouble(double value) {}
+  virtual void OnString(std::string_view value) {}
+  virtual void OnUInt8List(const uint8_t* values, size_t count) {}
+  virtual void OnInt32List(const int32_t* values, size_t count) {}
+  virtual void OnInt64List(const int64_t* values, size_t count) {}
+  virtual void OnFloat32List(const float* values, size_t count) {}
+  virtual void OnFloat64List(const double* values, size_t count) {}
+
+  // Called before the |size| elements of a list, which are followed by a call
+  // to OnListEnd.
+  virtual void OnListStart(size_t size) {}
+  virtual void OnListEnd() {}
+
+  // Called before the |size| entries of a map, each given as its key followed
+  // by its value, which are followed by a call to OnMapEnd.
+  virtual void OnMapStart(size_t size) {}
+  virtual void OnMapEnd() {}
+
+  // Called with a value of a type added by a subclass of
+  // StandardCodecSerializer, as returned by its ReadValueOfType.
+  virtual void OnCustomValue(const EncodableValue& value) {}
+};
+
 // Encapsulates the logic for encoding/decoding EncodableValues to/from the
 // standard codec binary representation.
 //
@@ -29,6 +68,14 @@ class StandardCodecSerializer {
   // Reads and returns the next value from |stream|.
   EncodableValue ReadValue(ByteStreamReader* stream) const;
 
+  // Reads the next value from |stream| and passes its contents to |handler|.
+  //
+  // This avoids allocating an EncodableValue for each element of large
+  // messages. Only values of types added by subclasses are read with
+  // ReadValueOfType.
+  void ReadValue(ByteStreamReader* stream,
+                 StandardCodecValueHandler* handler) const;
+
   // Writes the encoding of |value| to |stream|, including the initial type
   // discrimination byte.
   //
@@ -65,10 +112,19 @@ class StandardCodecSerializer {
   template <typename T>
   EncodableValue ReadVector(ByteStreamReader* stream) const;
 
+  // Reads a fixed-type list like the above, and passes it to |callback| of
+  // |handler|, in place if the stream allows it.
+  template <typename T>
+  void ReadVector(ByteStreamReader* stream,
+                  StandardCodecValueHandler* handler,
+                  void (StandardCodecValueHandler::*callback)(const T*, size_t))
+      const;
+
   // Writes |vector| to |stream| as a fixed-type list. |T| must correspond to
   // one of the supported list value types of EncodableValue.
   template <typename T>
-  void WriteVector(const std::vector<T> vector, ByteStreamWriter* stream) const;
+  void WriteVector(const std::vector<T>& vector,
+                   ByteStreamWriter* stream) const;
 };
 
 }  // namespace flutter
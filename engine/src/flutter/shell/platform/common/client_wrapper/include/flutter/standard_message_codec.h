@@ -35,6 +35,14 @@ class StandardMessageCodec : public MessageCodec<EncodableValue> {
   StandardMessageCodec(StandardMessageCodec const&) = delete;
   StandardMessageCodec& operator=(StandardMessageCodec const&) = delete;
 
+  using MessageCodec<EncodableValue>::DecodeMessage;
+
+  // Passes the contents of the message encoded in |binary_message| to
+  // |handler| as they are decoded, see StandardCodecSerializer::ReadValue.
+  void DecodeMessage(const uint8_t* binary_message,
+                     const size_t message_size,
+                     StandardCodecValueHandler* handler) const;
+
  protected:
   // |flutter::MessageCodec|
   std::unique_ptr<EncodableValue> DecodeMessageInternal(
@@ -12,6 +12,7 @@
 #include <iostream>
 #include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "byte_buffer_streams.h"
@@ -95,6 +96,88 @@ EncodableValue StandardCodecSerializer::ReadValue(
   return ReadValueOfType(type, stream);
 }
 
+void StandardCodecSerializer::ReadValue(
+    ByteStreamReader* stream,
+    StandardCodecValueHandler* handler) const {
+  uint8_t type = stream->ReadByte();
+  switch (static_cast<EncodedType>(type)) {
+    case EncodedType::kNull:
+      handler->OnNull();
+      return;
+    case EncodedType::kTrue:
+      handler->OnBool(true);
+      return;
+    case EncodedType::kFalse:
+      handler->OnBool(false);
+      return;
+    case EncodedType::kInt32:
+      handler->OnInt32(stream->ReadInt32());
+      return;
+    case EncodedType::kInt64:
+      handler->OnInt64(stream->ReadInt64());
+      return;
+    case EncodedType::kFloat64:
+      stream->ReadAlignment(8);
+      handler->OnDouble(stream->ReadDouble());
+      return;
+    case EncodedType::kLargeInt:
+    case EncodedType::kString: {
+      size_t size = ReadSize(stream);
+      const uint8_t* bytes = stream->ReadBytesInPlace(size);
+      if (bytes) {
+        handler->OnString(
+            std::string_view(reinterpret_cast<const char*>(bytes), size));
+        return;
+      }
+      std::string string_value;
+      string_value.resize(size);
+      stream->ReadBytes(reinterpret_cast<uint8_t*>(&string_value[0]), size);
+      handler->OnString(string_value);
+      return;
+    }
+    case EncodedType::kUInt8List:
+      ReadVector<uint8_t>(stream, handler,
+                          &StandardCodecValueHandler::OnUInt8List);
+      return;
+    case EncodedType::kInt32List:
+      ReadVector<int32_t>(stream, handler,
+                          &StandardCodecValueHandler::OnInt32List);
+      return;
+    case EncodedType::kInt64List:
+      ReadVector<int64_t>(stream, handler,
+                          &StandardCodecValueHandler::OnInt64List);
+      return;
+    case EncodedType::kFloat64List:
+      ReadVector<double>(stream, handler,
+                         &StandardCodecValueHandler::OnFloat64List);
+      return;
+    case EncodedType::kList: {
+      size_t length = ReadSize(stream);
+      handler->OnListStart(length);
+      for (size_t i = 0; i < length; ++i) {
+        ReadValue(stream, handler);
+      }
+      handler->OnListEnd();
+      return;
+    }
+    case EncodedType::kMap: {
+      size_t length = ReadSize(stream);
+      handler->OnMapStart(length);
+      for (size_t i = 0; i < length; ++i) {
+        ReadValue(stream, handler);
+        ReadValue(stream, handler);
+      }
+      handler->OnMapEnd();
+      return;
+    }
+    case EncodedType::kFloat32List:
+      ReadVector<float>(stream, handler,
+                        &StandardCodecValueHandler::OnFloat32List);
+      return;
+  }
+  handler->OnCustomValue(ReadValueOfType(type, stream));
+}
+
 void StandardCodecSerializer::WriteValue(const EncodableValue& value,
                                          ByteStreamWriter* stream) const {
   stream->WriteByte(static_cast<uint8_t>(EncodedTypeForValue(value)));
@@ -188,7 +271,7 @@ EncodableValue StandardCodecSerializer::ReadValueOfType(
       std::string string_value;
       string_value.resize(size);
       stream->ReadBytes(reinterpret_cast<uint8_t*>(&string_value[0]), size);
-      return EncodableValue(string_value);
+      return EncodableValue(std::move(string_value));
     }
     case EncodedType::kUInt8List:
       return ReadVector<uint8_t>(stream);
@@ -205,7 +288,7 @@ EncodableValue StandardCodecSerializer::ReadValueOfType(
       for (size_t i = 0; i < length; ++i) {
         list_value.push_back(ReadValue(stream));
       }
-      return EncodableValue(list_value);
+      return EncodableValue(std::move(list_value));
     }
     case EncodedType::kMap: {
       size_t length = ReadSize(stream);
@@ -215,7 +298,7 @@ EncodableValue StandardCodecSerializer::ReadValueOfType(
         EncodableValue value = ReadValue(stream);
         map_value.emplace(std::move(key), std::move(value));
       }
-      return EncodableValue(map_value);
+      return EncodableValue(std::move(map_value));
     }
     case EncodedType::kFloat32List: {
       return ReadVector<float>(stream);
@@ -268,11 +351,38 @@ EncodableValue StandardCodecSerializer::ReadVector(
   }
   stream->ReadBytes(reinterpret_cast<uint8_t*>(vector.data()),
                     count * type_size);
-  return EncodableValue(vector);
+  return EncodableValue(std::move(vector));
+}
+
+template <typename T>
+void StandardCodecSerializer::ReadVector(
+    ByteStreamReader* stream,
+    StandardCodecValueHandler* handler,
+    void (StandardCodecValueHandler::*callback)(const T*, size_t)) const {
+  size_t count = ReadSize(stream);
+  uint8_t type_size = static_cast<uint8_t>(sizeof(T));
+  if (type_size > 1) {
+    stream->ReadAlignment(type_size);
+  }
+  // The encoding aligns elements relative to the start of the message, so
+  // they can only be used in place if the message itself is aligned.
+  const uint8_t* bytes = stream->ReadBytesInPlace(count * type_size);
+  if (bytes && reinterpret_cast<uintptr_t>(bytes) % alignof(T) == 0) {
+    (handler->*callback)(reinterpret_cast<const T*>(bytes), count);
+    return;
+  }
+  std::vector<T> vector(count);
+  if (bytes) {
+    std::memcpy(vector.data(), bytes, count * type_size);
+  } else {
+    stream->ReadBytes(reinterpret_cast<uint8_t*>(vector.data()),
+                      count * type_size);
+  }
+  (handler->*callback)(vector.data(), count);
 }
 
 template <typename T>
-void StandardCodecSerializer::WriteVector(const std::vector<T> vector,
+void StandardCodecSerializer::WriteVector(const std::vector<T>& vector,
                                           ByteStreamWriter* stream) const {
   size_t count = vector.size();
   WriteSize(count, stream);
@@ -335,6 +445,18 @@ StandardMessageCodec::EncodeMessageInternal(
   return encoded;
 }
 
+void StandardMessageCodec::DecodeMessage(
+    const uint8_t* binary_message,
+    const size_t message_size,
+    StandardCodecValueHandler* handler) const {
+  if (!binary_message) {
+    handler->OnNull();
+    return;
+  }
+  ByteBufferStreamReader stream(binary_message, message_size);
+  serializer_->ReadValue(&stream, handler);
+}
+
 // ===== standard_method_codec.h =====
 
 // static
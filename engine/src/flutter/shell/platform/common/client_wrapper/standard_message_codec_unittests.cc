@@ -5,6 +5,8 @@
 #include "flutter/shell/platform/common/client_wrapper/include/flutter/standard_message_codec.h"
 
 #include <map>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include "flutter/shell/platform/common/client_wrapper/testing/test_codec_extensions.h"
@@ -26,6 +28,54 @@ class MockStandardCodecSerializer : public StandardCodecSerializer {
               (uint8_t type, ByteStreamReader* stream),
               (const, override));
 };
+
+// Records the calls made while streaming a message as readable strings.
+class RecordingValueHandler : public StandardCodecValueHandler {
+ public:
+  void OnNull() override { events.push_back("null"); }
+  void OnBool(bool value) override {
+    events.push_back(value ? "true" : "false");
+  }
+  void OnInt32(int32_t value) override {
+    events.push_back("int32 " + std::to_string(value));
+  }
+  void OnInt64(int64_t value) override {
+    events.push_back("int64 " + std::to_string(value));
+  }
+  void OnString(std::string_view value) override {
+    events.push_back("string " + std::string(value));
+  }
+  void OnInt32List(const int32_t* values, size_t count) override {
+    std::string event = "int32 list";
+    for (size_t i = 0; i < count; ++i) {
+      event += " " + std::to_string(values[i]);
+    }
+    events.push_back(event);
+  }
+  void OnFloat64List(const double* values, size_t count) override {
+    std::string event = "float64 list";
+    for (size_t i = 0; i < count; ++i) {
+      event += " " + std::to_string(values[i]);
+    }
+    events.push_back(event);
+  }
+  void OnListStart(size_t size) override {
+    events.push_back("list " + std::to_string(size));
+  }
+  void OnListEnd() override { events.push_back("list end"); }
+  void OnMapStart(size_t size) override {
+    events.push_back("map " + std::to_string(size));
+  }
+  void OnMapEnd() override { events.push_back("map end"); }
+  void OnCustomValue(const EncodableValue& value) override {
+    const Point& point =
+        std::any_cast<Point>(std::get<CustomEncodableValue>(value));
+    events.push_back("point " + std::to_string(point.x()) + " " +
+                     std::to_string(point.y()));
+  }
+
+  std::vector<std::string> events;
+};
 }  // namespace
 
 // Validates round-trip encoding and decoding of |value|, and checks that the
@@ -262,4 +312,59 @@ TEST(StandardMessageCodec, CanEncodeAndDecodeVariableLengthCustomType) {
                     some_data_comparator);
 }
 
+TEST(StandardMessageCodec, CanStreamDecodedValuesToHandler) {
+  EncodableValue value(EncodableList{
+      EncodableValue(),
+      EncodableValue(true),
+      EncodableValue(int64_t{1} << 40),
+      EncodableValue("hello"),
+      EncodableValue(std::vector<int32_t>{1, 2}),
+      EncodableValue(EncodableMap{{EncodableValue("key"), EncodableValue(7)}}),
+      CustomEncodableValue(Point(9, 16)),
+  });
+  const StandardMessageCodec& codec = StandardMessageCodec::GetInstance(
+      &PointExtensionSerializer::GetInstance());
+  auto encoded = codec.EncodeMessage(value);
+  ASSERT_TRUE(encoded);
+
+  RecordingValueHandler handler;
+  codec.DecodeMessage(encoded->data(), encoded->size(), &handler);
+  EXPECT_EQ(handler.events, std::vector<std::string>({
+                                "list 7",
+                                "null",
+                                "true",
+                                "int64 1099511627776",
+                                "string hello",
+                                "int32 list 1 2",
+                                "map 1",
+                                "string key",
+                                "int32 7",
+                                "map end",
+                                "point 9 16",
+                                "list end",
+                            }));
+}
+
+TEST(StandardMessageCodec, StreamsTypedListsFromUnalignedMessages) {
+  const StandardMessageCodec& codec = StandardMessageCodec::GetInstance();
+  auto encoded =
+      codec.EncodeMessage(EncodableValue(std::vector<double>{0.5, 2.0}));
+  ASSERT_TRUE(encoded);
+  // Offset the message by one byte so that its elements can't be used in
+  // place.
+  std::vector<uint8_t> buffer(encoded->size() + 1);
+  std::copy(encoded->begin(), encoded->end(), buffer.begin() + 1);
+
+  RecordingValueHandler handler;
+  codec.DecodeMessage(buffer.data() + 1, encoded->size(), &handler);
+  EXPECT_EQ(handler.events,
+            std::vector<std::string>({"float64 list 0.500000 2.000000"}));
+}
+
+TEST(StandardMessageCodec, StreamsNullForMissingMessage) {
+  RecordingValueHandler handler;
+  StandardMessageCodec::GetInstance().DecodeMessage(nullptr, 0, &handler);
+  EXPECT_EQ(handler.events, std::vector<std::string>({"null"}));
+}
+
 }  // namespace flutter
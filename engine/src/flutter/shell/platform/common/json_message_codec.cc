@@ -6,13 +6,38 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "rapidjson/error/en.h"
-#include "rapidjson/stringbuffer.h"
 #include "rapidjson/writer.h"
 
 namespace flutter {
 
+namespace {
+
+// A rapidjson output stream that writes directly into the encoded message,
+// rather than into an intermediate buffer that then has to be copied.
+class VectorOutputStream {
+ public:
+  using Ch = char;
+
+  explicit VectorOutputStream(std::vector<uint8_t>* buffer)
+      : buffer_(buffer) {}
+
+  void Put(Ch c) { buffer_->push_back(static_cast<uint8_t>(c)); }
+
+  void Flush() {}
+
+ private:
+  std::vector<uint8_t>* buffer_;
+};
+
+// Most messages sent through JSON channels, such as key events, are small
+// enough to be encoded without growing the buffer.
+constexpr size_t kInitialEncodeCapacity = 256;
+
+}  // namespace
+
 // static
 const JsonMessageCodec& JsonMessageCodec::GetInstance() {
   static JsonMessageCodec sInstance;
@@ -21,15 +46,15 @@ const JsonMessageCodec& JsonMessageCodec::GetInstance() {
 
 std::unique_ptr<std::vector<uint8_t>> JsonMessageCodec::EncodeMessageInternal(
     const rapidjson::Document& message) const {
-  rapidjson::StringBuffer buffer;
-  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  auto encoded = std::make_unique<std::vector<uint8_t>>();
+  encoded->reserve(kInitialEncodeCapacity);
+  VectorOutputStream stream(encoded.get());
+  rapidjson::Writer<VectorOutputStream> writer(stream);
   // clang-tidy has trouble reasoning about some of the complicated array and
   // pointer-arithmetic code in rapidjson.
   // NOLINTNEXTLINE(clang-analyzer-core.*,clang-analyzer-security.*)
   message.Accept(writer);
-  const char* buffer_start = buffer.GetString();
-  return std::make_unique<std::vector<uint8_t>>(
-      buffer_start, buffer_start + buffer.GetSize());
+  return encoded;
 }
 
 std::unique_ptr<rapidjson::Document> JsonMessageCodec::DecodeMessageInternal(
@@ -6,6 +6,7 @@
 
 #include <limits>
 #include <map>
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -44,4 +45,17 @@ TEST(JsonMessageCodec, EncodeDecode) {
   CheckEncodeDecode(array);
 }
 
+// Tests that the encoded message is exactly the serialized JSON.
+TEST(JsonMessageCodec, EncodesCompactJson) {
+  rapidjson::Document event(rapidjson::kObjectType);
+  auto& allocator = event.GetAllocator();
+  event.AddMember("keyCode", 65, allocator);
+  event.AddMember("type", "keydown", allocator);
+
+  auto encoded = JsonMessageCodec::GetInstance().EncodeMessage(event);
+  ASSERT_TRUE(encoded);
+  std::string json(encoded->begin(), encoded->end());
+  EXPECT_EQ(json, R"({"keyCode":65,"type":"keydown"})");
+}
+
 }  // namespace flutter
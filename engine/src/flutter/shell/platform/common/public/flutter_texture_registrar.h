@@ -49,9 +49,28 @@ typedef enum {
   kFlutterDesktopPixelFormatRGBA8888,
   // Represents a 32-bit BGRA color format with 8 bits each for blue, green, red
   // and alpha.
-  kFlutterDesktopPixelFormatBGRA8888
+  kFlutterDesktopPixelFormatBGRA8888,
+  // Represents a YUV 4:2:0 format with an 8-bit luma plane followed by a plane
+  // of interleaved 8-bit chroma samples. Only supported by GPU surfaces, which
+  // are converted to RGB on the GPU.
+  kFlutterDesktopPixelFormatNV12
 } FlutterDesktopPixelFormat;
 
+// How reading a GPU surface is synchronized with the producer of its contents.
+typedef enum {
+  // No synchronization. The producer must have finished writing the surface
+  // before returning it.
+  kFlutterDesktopGpuSurfaceSyncNone,
+  // The surface was created with |D3D11_RESOURCE_MISC_SHARED_KEYEDMUTEX|.
+  // Flutter acquires its mutex with |sync_acquire_value| before reading it and
+  // releases it with |sync_release_value| once the read has been queued.
+  kFlutterDesktopGpuSurfaceSyncKeyedMutex,
+  // |sync_fence| is an |ID3D11Fence*|. Flutter's GPU work waits for the fence
+  // to reach |sync_acquire_value| before reading the surface and signals it
+  // with |sync_release_value| once the surface has been read.
+  kFlutterDesktopGpuSurfaceSyncFence
+} FlutterDesktopGpuSurfaceSyncType;
+
 // An image buffer object.
 typedef struct {
   // The pixel data buffer.
@@ -100,6 +119,18 @@ typedef struct {
   void (*release_callback)(void* release_context);
   // Opaque data passed to |release_callback|.
   void* release_context;
+  // How reading the surface is synchronized with its producer.
+  //
+  // Surfaces that are synchronized or are in |kFlutterDesktopPixelFormatNV12|
+  // are copied on the GPU into a texture owned by Flutter, so the producer may
+  // write the next frame as soon as Flutter releases the surface.
+  FlutterDesktopGpuSurfaceSyncType sync_type;
+  // The fence used with |kFlutterDesktopGpuSurfaceSyncFence|.
+  void* sync_fence;
+  // The key or fence value to wait for before reading the surface.
+  uint64_t sync_acquire_value;
+  // The key or fence value to release the surface with after reading it.
+  uint64_t sync_release_value;
 } FlutterDesktopGpuSurfaceDescriptor;
 
 // The pixel buffer copy callback definition provided to
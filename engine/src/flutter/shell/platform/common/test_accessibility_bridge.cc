@@ -6,9 +6,29 @@
 
 namespace flutter {
 
+namespace {
+
+class TestFlutterPlatformNodeDelegate : public FlutterPlatformNodeDelegate {
+ public:
+  explicit TestFlutterPlatformNodeDelegate(
+      std::vector<AccessibilityNodeId>& changed_node_ids)
+      : changed_node_ids_(changed_node_ids) {}
+
+  // |FlutterPlatformNodeDelegate|
+  void NodeDataChanged(const ui::AXNodeData& old_node_data,
+                       const ui::AXNodeData& new_node_data) override {
+    changed_node_ids_.push_back(new_node_data.id);
+  }
+
+ private:
+  std::vector<AccessibilityNodeId>& changed_node_ids_;
+};
+
+}  // namespace
+
 std::shared_ptr<FlutterPlatformNodeDelegate>
 TestAccessibilityBridge::CreateFlutterPlatformNodeDelegate() {
-  return std::make_unique<FlutterPlatformNodeDelegate>();
+  return std::make_unique<TestFlutterPlatformNodeDelegate>(changed_node_ids);
 };
 
 void TestAccessibilityBridge::OnAccessibilityEvent(
@@ -19,6 +19,8 @@ class TestAccessibilityBridge : public AccessibilityBridge {
 
   std::vector<ui::AXEventGenerator::Event> accessibility_events;
   std::vector<FlutterSemanticsAction> performed_actions;
+  // The IDs of the nodes whose data has changed, in the order they changed.
+  std::vector<AccessibilityNodeId> changed_node_ids;
 
  protected:
   void OnAccessibilityEvent(
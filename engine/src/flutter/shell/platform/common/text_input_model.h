@@ -190,6 +190,12 @@ class TextInputModel {
   // Gets the current text as UTF-8.
   std::string GetText() const;
 
+  // Gets the current text as UTF-16.
+  //
+  // Unlike GetText(), this neither converts nor copies the text, which
+  // matters for large documents.
+  const std::u16string& GetTextUtf16() const { return text_; }
+
   // Gets the cursor position as a byte offset in UTF-8 string returned from
   // GetText().
   int GetCursorOffset() const;
@@ -1729,4 +1729,12 @@ TEST(TextInputModel, GetCursorOffsetReverseSelection) {
   EXPECT_EQ(model->GetCursorOffset(), 1);
 }
 
+TEST(TextInputModel, GetTextUtf16) {
+  auto model = std::make_unique<TextInputModel>();
+  model->SetText("$¢€𐍈");
+  EXPECT_EQ(model->GetTextUtf16(), u"$¢€𐍈");
+  model->AddText(u"A");
+  EXPECT_EQ(model->GetTextUtf16(), u"$¢€𐍈A");
+}
+
 }  // namespace flutter
@@ -225,6 +225,12 @@ flutter::Settings FLTDefaultSettingsForBundle(NSBundle* bundle, NSProcessInfo* p
     settings.enable_flutter_gpu = enableFlutterGPU.boolValue;
   }
 
+  NSNumber* enableHardwareImageDecoding =
+      [mainBundle objectForInfoDictionaryKey:@"FLTEnableHardwareImageDecoding"];
+  if (enableHardwareImageDecoding != nil) {
+    settings.enable_hardware_image_decoding = enableHardwareImageDecoding.boolValue;
+  }
+
 #if FLUTTER_RUNTIME_MODE == FLUTTER_RUNTIME_MODE_DEBUG
   // There are no ownership concerns here as all mappings are owned by the
   // embedder and not the engine.
@@ -40,6 +40,7 @@
 #import "flutter/shell/platform/darwin/ios/framework/Source/platform_message_response_darwin.h"
 #import "flutter/shell/platform/darwin/ios/framework/Source/profiler_metrics_ios.h"
 #import "flutter/shell/platform/darwin/ios/framework/Source/vsync_waiter_ios.h"
+#import "flutter/shell/platform/darwin/ios/ios_image_generator.h"
 #import "flutter/shell/platform/darwin/ios/platform_view_ios.h"
 #import "flutter/shell/platform/darwin/ios/rendering_api_selection.h"
 #include "flutter/shell/profiling/sampling_profiler.h"
@@ -787,6 +788,21 @@ NSString* const kFlutterApplicationRegistrarKey = @"io.flutter.flutter.applicati
   [self maybeSetupPlatformViewChannels];
   _shell->SetGpuAvailability(_isGpuDisabled ? flutter::GpuAvailability::kUnavailable
                                             : flutter::GpuAvailability::kAvailable);
+  [self maybeRegisterHardwareImageDecoder];
+}
+
+- (void)maybeRegisterHardwareImageDecoder {
+  const flutter::Settings& settings = _shell->GetSettings();
+  if (!settings.enable_impeller || !settings.enable_hardware_image_decoding) {
+    return;
+  }
+  // Takes precedence over the builtin decoders for JPEG and HEIF images. Wide
+  // gamut images are left to the builtin decoders when wide gamut is enabled.
+  _shell->RegisterImageDecoder(
+      [rejectWideGamut = settings.enable_wide_gamut](sk_sp<SkData> buffer) {
+        return flutter::IOSImageGenerator::MakeFromData(std::move(buffer), rejectWideGamut);
+      },
+      1);
 }
 
 + (BOOL)isProfilerEnabled {
@@ -967,6 +983,27 @@ static void SetEntryPoint(flutter::Settings* settings, NSString* entrypoint, NSS
   _shell->OnDisplayUpdates(std::move(displays));
 }
 
+- (std::shared_ptr<flutter::VsyncWaiterIOS>)vsyncWaiter {
+  if (!_shell) {
+    return nullptr;
+  }
+  return std::static_pointer_cast<flutter::VsyncWaiterIOS>(_shell->GetVsyncWaiter().lock());
+}
+
+- (void)setFrameRateHint:(double)frameRate {
+  std::shared_ptr<flutter::VsyncWaiterIOS> vsync_waiter = [self vsyncWaiter];
+  if (vsync_waiter) {
+    vsync_waiter->SetFrameRateHint(frameRate);
+  }
+}
+
+- (void)setUserInteracting:(BOOL)interacting {
+  std::shared_ptr<flutter::VsyncWaiterIOS> vsync_waiter = [self vsyncWaiter];
+  if (vsync_waiter) {
+    vsync_waiter->SetUserInteracting(interacting);
+  }
+}
+
 - (BOOL)run {
   return [self runWithEntrypoint:FlutterDefaultDartEntrypoint
                       libraryURI:nil
@@ -63,6 +63,13 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)attachView;
 - (void)notifyLowMemory;
 
+/// Hints the frame rate the content needs, so that ProMotion displays can refresh at a lower rate.
+/// A rate of 0 removes the hint. See `flutter::VsyncWaiterIOS::SetFrameRateHint`.
+- (void)setFrameRateHint:(double)frameRate;
+
+/// Sets whether the user is touching the engine's view, which overrides the frame rate hint.
+- (void)setUserInteracting:(BOOL)interacting;
+
 /// Blocks until the first frame is presented or the timeout is exceeded, then invokes callback.
 - (void)waitForFirstFrameSync:(NSTimeInterval)timeout
                      callback:(NS_NOESCAPE void (^)(BOOL didTimeout))callback;
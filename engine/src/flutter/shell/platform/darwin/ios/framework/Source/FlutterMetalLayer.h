@@ -24,6 +24,7 @@
 @property CGSize drawableSize;
 @property BOOL presentsWithTransaction;
 @property(nullable) CGColorSpaceRef colorspace;
+@property NSUInteger maximumDrawableCount;
 
 - (nullable id<CAMetalDrawable>)nextDrawable;
 
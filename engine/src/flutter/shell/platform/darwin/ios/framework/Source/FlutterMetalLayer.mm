@@ -11,6 +11,7 @@
 
 #import "flutter/shell/platform/darwin/common/InternalFlutterSwiftCommon/InternalFlutterSwiftCommon.h"
 #import "flutter/shell/platform/darwin/common/framework/Headers/FlutterMacros.h"
+#include "flutter/fml/trace_event.h"
 
 FLUTTER_ASSERT_ARC
 
@@ -33,8 +34,12 @@ extern CFTimeInterval display_link_target;
   // Access to these variables must be synchronized.
   NSMutableSet<FlutterTexture*>* _availableTextures;
   NSUInteger _totalTextures;
+  NSUInteger _maximumDrawableCount;
   FlutterTexture* _front;
 
+  // Signaled whenever a texture may have become available, so that waiting for one doesn't spin.
+  NSCondition* _textureAvailableCondition;
+
   // There must be a CADisplayLink scheduled *on main thread* otherwise
   // core animation only updates layers 60 times a second.
   CADisplayLink* _displayLink;
@@ -54,6 +59,7 @@ extern CFTimeInterval display_link_target;
 - (void)onDisplayLink:(CADisplayLink*)link;
 - (void)presentTexture:(FlutterTexture*)texture;
 - (void)returnTexture:(FlutterTexture*)texture;
+- (void)textureDidComplete:(FlutterTexture*)texture;
 
 @end
 
@@ -149,9 +155,11 @@ extern CFTimeInterval display_link_target;
 
 - (void)flutterPrepareForPresent:(nonnull id<MTLCommandBuffer>)commandBuffer {
   FlutterTexture* texture = _texture;
+  __weak FlutterMetalLayer* weakLayer = _layer;
   texture.waitingForCompletion = YES;
   [commandBuffer addCompletedHandler:^(id<MTLCommandBuffer> buffer) {
     texture.waitingForCompletion = NO;
+    [weakLayer textureDidComplete:texture];
   }];
 }
 
@@ -185,6 +193,8 @@ extern CFTimeInterval display_link_target;
     self.device = self.preferredDevice;
     self.pixelFormat = MTLPixelFormatBGRA8Unorm;
     _availableTextures = [[NSMutableSet alloc] init];
+    _maximumDrawableCount = 3;
+    _textureAvailableCondition = [[NSCondition alloc] init];
 
     FlutterMetalLayerDisplayLinkProxy* proxy =
         [[FlutterMetalLayerDisplayLinkProxy alloc] initWithLayer:self];
@@ -254,6 +264,69 @@ extern CFTimeInterval display_link_target;
     _totalTextures = 0;
     _drawableSize = drawableSize;
   }
+  [self prefetchTextures];
+}
+
+- (NSUInteger)maximumDrawableCount {
+  @synchronized(self) {
+    return _maximumDrawableCount;
+  }
+}
+
+- (void)setMaximumDrawableCount:(NSUInteger)maximumDrawableCount {
+  // Same range as CAMetalLayer.
+  if (maximumDrawableCount < 2 || maximumDrawableCount > 3) {
+    [FlutterLogger
+        logWarning:[NSString stringWithFormat:@"Unsupported maximum drawable count: %lu",
+                                              (unsigned long)maximumDrawableCount]];
+    return;
+  }
+  @synchronized(self) {
+    _maximumDrawableCount = maximumDrawableCount;
+  }
+  [self signalTextureAvailable];
+}
+
+/// Creates the textures for the current drawable size in the background, so that acquiring a
+/// drawable after a resize doesn't have to allocate them on the raster thread.
+- (void)prefetchTextures {
+  __weak FlutterMetalLayer* weakSelf = self;
+  dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INTERACTIVE, 0), ^{
+    while (true) {
+      FlutterMetalLayer* strongSelf = weakSelf;
+      if (strongSelf == nil) {
+        return;
+      }
+      CGSize size;
+      @synchronized(strongSelf) {
+        if (strongSelf->_totalTextures >= strongSelf->_maximumDrawableCount) {
+          return;
+        }
+        ++strongSelf->_totalTextures;
+        size = strongSelf->_drawableSize;
+      }
+      TRACE_EVENT0("flutter", "FlutterMetalLayer::PrefetchTexture");
+      FlutterTexture* texture = [strongSelf createTextureWithSize:size];
+      @synchronized(strongSelf) {
+        if (!CGSizeEqualToSize(size, strongSelf->_drawableSize)) {
+          // The layer was resized, which started another round of prefetching.
+          return;
+        }
+        if (texture == nil) {
+          --strongSelf->_totalTextures;
+          return;
+        }
+        [strongSelf->_availableTextures addObject:texture];
+      }
+      [strongSelf signalTextureAvailable];
+    }
+  });
+}
+
+- (void)signalTextureAvailable {
+  [_textureAvailableCondition lock];
+  [_textureAvailableCondition broadcast];
+  [_textureAvailableCondition unlock];
 }
 
 - (void)didEnterBackground:(id)notification {
@@ -270,7 +343,7 @@ extern CFTimeInterval display_link_target;
   }
 }
 
-- (IOSurface*)createIOSurface {
+- (IOSurface*)createIOSurfaceWithSize:(CGSize)size {
   unsigned pixelFormat;
   unsigned bytesPerElement;
   if (self.pixelFormat == MTLPixelFormatRGBA16Float) {
@@ -288,13 +361,11 @@ extern CFTimeInterval display_link_target;
     [FlutterLogger logError:errorMessage];
     return nil;
   }
-  size_t bytesPerRow =
-      IOSurfaceAlignProperty(kIOSurfaceBytesPerRow, _drawableSize.width * bytesPerElement);
-  size_t totalBytes =
-      IOSurfaceAlignProperty(kIOSurfaceAllocSize, _drawableSize.height * bytesPerRow);
+  size_t bytesPerRow = IOSurfaceAlignProperty(kIOSurfaceBytesPerRow, size.width * bytesPerElement);
+  size_t totalBytes = IOSurfaceAlignProperty(kIOSurfaceAllocSize, size.height * bytesPerRow);
   NSDictionary* options = @{
-    (id)kIOSurfaceWidth : @(_drawableSize.width),
-    (id)kIOSurfaceHeight : @(_drawableSize.height),
+    (id)kIOSurfaceWidth : @(size.width),
+    (id)kIOSurfaceHeight : @(size.height),
     (id)kIOSurfacePixelFormat : @(pixelFormat),
     (id)kIOSurfaceBytesPerElement : @(bytesPerElement),
     (id)kIOSurfaceBytesPerRow : @(bytesPerRow),
@@ -318,50 +389,67 @@ extern CFTimeInterval display_link_target;
   return (__bridge_transfer IOSurface*)res;
 }
 
+- (FlutterTexture*)createTextureWithSize:(CGSize)size {
+  IOSurface* surface = [self createIOSurfaceWithSize:size];
+  if (surface == nil) {
+    return nil;
+  }
+  MTLTextureDescriptor* textureDescriptor =
+      [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:self.pixelFormat
+                                                         width:size.width
+                                                        height:size.height
+                                                     mipmapped:NO];
+
+  if (self.framebufferOnly) {
+    textureDescriptor.usage = MTLTextureUsageRenderTarget;
+  } else {
+    textureDescriptor.usage =
+        MTLTextureUsageRenderTarget | MTLTextureUsageShaderRead | MTLTextureUsageShaderWrite;
+  }
+  id<MTLTexture> texture = [self.device newTextureWithDescriptor:textureDescriptor
+                                                       iosurface:(__bridge IOSurfaceRef)surface
+                                                           plane:0];
+  return [[FlutterTexture alloc] initWithTexture:texture surface:surface];
+}
+
 - (FlutterTexture*)nextTexture {
   CFTimeInterval start = CACurrentMediaTime();
+  NSDate* deadline = [NSDate dateWithTimeIntervalSinceNow:1.0];
+  FlutterTexture* texture = nil;
+  // Holding the condition's lock between checking for a texture and waiting ensures that a texture
+  // becoming available in between isn't missed.
+  [_textureAvailableCondition lock];
   while (true) {
-    FlutterTexture* texture = [self tryNextTexture];
+    texture = [self tryNextTexture];
     if (texture != nil) {
-      return texture;
+      break;
     }
-    CFTimeInterval elapsed = CACurrentMediaTime() - start;
-    if (elapsed > 1.0) {
-      NSLog(@"Waited %f seconds for a drawable, giving up.", elapsed);
-      return nil;
+    TRACE_EVENT0("flutter", "FlutterMetalLayer::WaitForTexture");
+    if (![_textureAvailableCondition waitUntilDate:deadline]) {
+      NSLog(@"Waited %f seconds for a drawable, giving up.", CACurrentMediaTime() - start);
+      break;
     }
   }
+  [_textureAvailableCondition unlock];
+  return texture;
 }
 
 - (FlutterTexture*)tryNextTexture {
   @synchronized(self) {
-    if (_front != nil && _front.waitingForCompletion) {
+    // Allow encoding a frame while earlier ones are still rendered by the GPU, as long as one
+    // drawable is left for them to be presented from.
+    NSUInteger texturesWaitingForCompletion = _front.waitingForCompletion ? 1 : 0;
+    for (FlutterTexture* texture in _availableTextures) {
+      if (texture.waitingForCompletion) {
+        ++texturesWaitingForCompletion;
+      }
+    }
+    if (texturesWaitingForCompletion + 1 >= _maximumDrawableCount) {
       return nil;
     }
-    if (_totalTextures < 3) {
+    if (_totalTextures < _maximumDrawableCount) {
       ++_totalTextures;
-      IOSurface* surface = [self createIOSurface];
-      if (surface == nil) {
-        return nil;
-      }
-      MTLTextureDescriptor* textureDescriptor =
-          [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:_pixelFormat
-                                                             width:_drawableSize.width
-                                                            height:_drawableSize.height
-                                                         mipmapped:NO];
-
-      if (_framebufferOnly) {
-        textureDescriptor.usage = MTLTextureUsageRenderTarget;
-      } else {
-        textureDescriptor.usage =
-            MTLTextureUsageRenderTarget | MTLTextureUsageShaderRead | MTLTextureUsageShaderWrite;
-      }
-      id<MTLTexture> texture = [self.device newTextureWithDescriptor:textureDescriptor
-                                                           iosurface:(__bridge IOSurfaceRef)surface
-                                                               plane:0];
-      FlutterTexture* flutterTexture = [[FlutterTexture alloc] initWithTexture:texture
-                                                                       surface:surface];
-      return flutterTexture;
+      return [self createTextureWithSize:_drawableSize];
     } else {
       // Prefer surface that is not in use and has been presented the longest
       // time ago.
@@ -373,6 +461,10 @@ extern CFTimeInterval display_link_target;
       // has not decreased the use count yet (there seems to be certain latency).
       FlutterTexture* res = nil;
       for (FlutterTexture* texture in _availableTextures) {
+        if (texture.waitingForCompletion) {
+          // The GPU is still rendering into this texture.
+          continue;
+        }
         if (res == nil) {
           res = texture;
         } else if (res.surface.isInUse && !texture.surface.isInUse) {
@@ -450,6 +542,7 @@ extern CFTimeInterval display_link_target;
       });
     }
   }
+  [self signalTextureAvailable];
 }
 
 - (void)returnTexture:(FlutterTexture*)texture {
@@ -462,6 +555,11 @@ extern CFTimeInterval display_link_target;
       [_availableTextures addObject:texture];
     }
   }
+  [self signalTextureAvailable];
+}
+
+- (void)textureDidComplete:(FlutterTexture*)texture {
+  [self signalTextureAvailable];
 }
 
 + (BOOL)enabled {
@@ -240,6 +240,8 @@
 
 - (void)testTimeout {
   FlutterMetalLayer* layer = [self addMetalLayer];
+  // With two drawables, a frame must complete before the next one can start.
+  layer.maximumDrawableCount = 2;
   TestCompositor* compositor = [[TestCompositor alloc] initWithLayer:layer];
 
   id<CAMetalDrawable> drawable = [layer nextDrawable];
@@ -271,6 +273,45 @@
   [self removeMetalLayer:layer];
 }
 
+- (void)testDrawableIsAvailableWhilePreviousFrameIsOnGPU {
+  FlutterMetalLayer* layer = [self addMetalLayer];
+  TestCompositor* compositor = [[TestCompositor alloc] initWithLayer:layer];
+
+  __block NSMutableArray<MTLCommandBufferHandler>* handlers = [NSMutableArray array];
+  id<MTLCommandBuffer> mockCommandBuffer = OCMProtocolMock(@protocol(MTLCommandBuffer));
+  OCMStub([mockCommandBuffer addCompletedHandler:OCMOCK_ANY]).andDo(^(NSInvocation* invocation) {
+    MTLCommandBufferHandler handlerOnStack;
+    [invocation getArgument:&handlerOnStack atIndex:2];
+    // Required to copy stack block to heap.
+    [handlers addObject:[handlerOnStack copy]];
+  });
+
+  id<CAMetalDrawable> drawable = [layer nextDrawable];
+  BAIL_IF_NO_DRAWABLE(drawable);
+  id<MTLTexture> firstTexture = drawable.texture;
+  [(id<FlutterMetalDrawable>)drawable flutterPrepareForPresent:mockCommandBuffer];
+  [drawable present];
+  [compositor commitTransaction];
+
+  // The next frame can be encoded while the first one is still on the GPU.
+  drawable = [layer nextDrawable];
+  BAIL_IF_NO_DRAWABLE(drawable);
+  XCTAssertNotEqual(drawable.texture, firstTexture);
+  [(id<FlutterMetalDrawable>)drawable flutterPrepareForPresent:mockCommandBuffer];
+  [drawable present];
+  [compositor commitTransaction];
+
+  // But not while two frames are.
+  drawable = [layer nextDrawable];
+  XCTAssertNil(drawable);
+
+  handlers[0](mockCommandBuffer);
+  drawable = [layer nextDrawable];
+  XCTAssertNotNil(drawable);
+
+  [self removeMetalLayer:layer];
+}
+
 - (void)testDealloc {
   __weak FlutterMetalLayer* weakLayer;
   @autoreleasepool {
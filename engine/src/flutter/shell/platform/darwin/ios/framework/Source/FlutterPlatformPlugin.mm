@@ -137,6 +137,11 @@ static void SetStatusBarStyleForSharedApplication(UIStatusBarStyle style) {
   } else if ([method isEqualToString:@"SystemChrome.setSystemUIOverlayStyle"]) {
     [self setSystemChromeSystemUIOverlayStyle:args];
     result(nil);
+  } else if ([method isEqualToString:@"SystemChrome.setFrameRateHint"]) {
+    // A null argument removes the hint.
+    double frameRate = [args isKindOfClass:[NSNumber class]] ? [args doubleValue] : 0;
+    [self.engine setFrameRateHint:frameRate];
+    result(nil);
   } else if ([method isEqualToString:@"SystemNavigator.pop"]) {
     NSNumber* isAnimated = args;
     [self popSystemNavigator:isAnimated.boolValue];
@@ -40,6 +40,20 @@ NS_ASSUME_NONNULL_BEGIN
 /// @brief The flutter view controller.
 @property(nonatomic, weak) UIViewController<FlutterViewResponder>* _Nullable flutterViewController;
 
+/// @brief The number of overlay layers encoded by the last call to `submitFrame:withIosContext:`.
+@property(nonatomic, readonly) size_t submittedOverlayLayerCount;
+
+/// @brief The number of pixels covered by the overlay layers encoded by the last call to
+/// `submitFrame:withIosContext:`.
+@property(nonatomic, readonly) size_t submittedOverlayLayerPixels;
+
+/// @brief The number of overlay layers created since this controller was initialized.
+@property(nonatomic, readonly) size_t createdOverlayLayerCount;
+
+/// @brief The number of times an overlay layer was reused in a later frame instead of being
+/// created.
+@property(nonatomic, readonly) size_t reusedOverlayLayerCount;
+
 /// @brief set the factory used to construct embedded UI Views.
 - (void)registerViewFactory:(NSObject<FlutterPlatformViewFactory>*)factory
                               withId:(NSString*)factoryId
@@ -24,6 +24,11 @@ using flutter::DlRoundRect;
 
 static constexpr NSUInteger kFlutterClippingMaskViewPoolCapacity = 5;
 
+// The maximum number of overlay layers used in a frame. Each overlay layer is backed by its own
+// frame sized IOSurfaces, so beyond this count the platform views stacked in between overlays are
+// cut out of the overlay content instead.
+static constexpr size_t kMaxOverlayLayers = 8;
+
 struct LayerData {
   DlRect rect;
   int64_t view_id;
@@ -160,6 +165,9 @@ static CGRect GetCGRectFromDlRect(const DlRect& clipDlRect) {
 /// Defaults to YES, but becomes NO if blurred backdrop filters cannot be applied.
 @property(nonatomic, assign) BOOL canApplyBlurBackdrop;
 
+@property(nonatomic, readwrite) size_t submittedOverlayLayerCount;
+@property(nonatomic, readwrite) size_t submittedOverlayLayerPixels;
+
 /// Populate any missing overlay layers.
 ///
 /// This requires posting a task to the platform thread and blocking on its completion.
@@ -705,6 +713,8 @@ static CGRect GetCGRectFromDlRect(const DlRect& clipDlRect) {
 - (BOOL)submitFrame:(std::unique_ptr<flutter::SurfaceFrame>)background_frame
      withIosContext:(const std::shared_ptr<flutter::IOSContext>&)iosContext {
   TRACE_EVENT0("flutter", "PlatformViewsController::SubmitFrame");
+  self.submittedOverlayLayerCount = 0;
+  self.submittedOverlayLayerPixels = 0;
 
   // No platform views to render.
   if (self.flutterView == nil || (self.compositionOrder.empty() && !self.hadPlatformViews)) {
@@ -737,12 +747,18 @@ static CGRect GetCGRectFromDlRect(const DlRect& clipDlRect) {
     viewRects[viewId] = self.currentCompositionParams[viewId].finalBoundingRect();
   }
 
-  std::unordered_map<int64_t, DlRect> overlayLayers =
-      SliceViews(background_frame->Canvas(), self.compositionOrder, self.slices, viewRects);
+  std::unordered_map<int64_t, flutter::SlicedOverlay> overlayLayers =
+      flutter::SliceViewsIntoOverlays(background_frame->Canvas(), self.compositionOrder,
+                                      self.slices, viewRects,
+                                      {
+                                          .merge_overlays = true,
+                                          .max_overlay_count = kMaxOverlayLayers,
+                                      });
 
   size_t requiredOverlayLayers = 0;
   for (int64_t viewId : self.compositionOrder) {
-    std::unordered_map<int64_t, DlRect>::const_iterator overlay = overlayLayers.find(viewId);
+    std::unordered_map<int64_t, flutter::SlicedOverlay>::const_iterator overlay =
+        overlayLayers.find(viewId);
     if (overlay == overlayLayers.end()) {
       continue;
     }
@@ -756,7 +772,8 @@ static CGRect GetCGRectFromDlRect(const DlRect& clipDlRect) {
 
   int64_t overlayId = 0;
   for (int64_t viewId : self.compositionOrder) {
-    std::unordered_map<int64_t, DlRect>::const_iterator overlay = overlayLayers.find(viewId);
+    std::unordered_map<int64_t, flutter::SlicedOverlay>::const_iterator overlay =
+        overlayLayers.find(viewId);
     if (overlay == overlayLayers.end()) {
       continue;
     }
@@ -773,9 +790,9 @@ static CGRect GetCGRectFromDlRect(const DlRect& clipDlRect) {
     flutter::DlCanvas* overlayCanvas = frame->Canvas();
     int restoreCount = overlayCanvas->GetSaveCount();
     overlayCanvas->Save();
-    overlayCanvas->ClipRect(overlay->second);
+    overlayCanvas->ClipRect(overlay->second.rect);
     overlayCanvas->Clear(flutter::DlColor::kTransparent());
-    self.slices[viewId]->render_into(overlayCanvas);
+    overlay->second.RenderInto(overlayCanvas, self.slices);
     overlayCanvas->RestoreToCount(restoreCount);
 
     // This flutter view is never the last in a frame, since we always submit the
@@ -785,18 +802,22 @@ static CGRect GetCGRectFromDlRect(const DlRect& clipDlRect) {
 
     didEncode &= layer->did_submit_last_frame;
     platformViewLayers[viewId] = LayerData{
-        .rect = overlay->second,  //
-        .view_id = viewId,        //
-        .overlay_id = overlayId,  //
-        .layer = layer            //
+        .rect = overlay->second.rect,  //
+        .view_id = viewId,             //
+        .overlay_id = overlayId,       //
+        .layer = layer                 //
     };
     surfaceFrames.push_back(std::move(frame));
     overlayId++;
+    self.submittedOverlayLayerCount++;
+    self.submittedOverlayLayerPixels +=
+        static_cast<size_t>(flutter::DlIRect::RoundOut(overlay->second.rect).Area());
   }
 
   auto previousSubmitInfo = background_frame->submit_info();
   background_frame->set_submit_info({
       .frame_damage = previousSubmitInfo.frame_damage,
+      .frame_damage_rects = previousSubmitInfo.frame_damage_rects,
       .buffer_damage = previousSubmitInfo.buffer_damage,
       .present_with_transaction = true,
   });
@@ -1055,6 +1076,14 @@ static CGRect GetCGRectFromDlRect(const DlRect& clipDlRect) {
   return _layerPool.get();
 }
 
+- (size_t)createdOverlayLayerCount {
+  return _layerPool->created_layer_count();
+}
+
+- (size_t)reusedOverlayLayerCount {
+  return _layerPool->reused_layer_count();
+}
+
 - (std::unordered_map<int64_t, std::unique_ptr<flutter::EmbedderViewSlice>>&)slices {
   return _slices;
 }
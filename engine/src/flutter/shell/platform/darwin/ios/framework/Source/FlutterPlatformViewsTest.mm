@@ -5084,11 +5084,68 @@ fml::RefPtr<fml::TaskRunner> GetDefaultTaskRunner() {
   pool.CreateLayer(ios_context, MTLPixelFormatBGRA8Unorm);
   XCTAssertEqual(pool.size(), 2u);
 
+  XCTAssertEqual(pool.created_layer_count(), 2u);
+
   // Mark all layers as unused.
   pool.RecycleLayers();
   XCTAssertEqual(pool.size(), 2u);
 
-  // Free the unused layers. One should remain.
+  // Unused layers are kept for a while.
+  auto unused_layers = pool.RemoveUnusedLayers();
+  XCTAssertEqual(unused_layers.size(), 2u);
+  XCTAssertEqual(pool.size(), 2u);
+
+  // Free the layers once they've been unused for long enough. One should remain.
+  for (size_t i = 1; i < flutter::OverlayLayerPool::kMaxUnusedFrames; i++) {
+    pool.RecycleLayers();
+    unused_layers = pool.RemoveUnusedLayers();
+  }
+  XCTAssertEqual(unused_layers.size(), 2u);
+  XCTAssertEqual(pool.size(), 1u);
+  XCTAssertEqual(pool.released_layer_count(), 1u);
+}
+
+- (void)testLayerPoolReusesLayers {
+  FlutterEngine* engine = [[FlutterEngine alloc] initWithName:@"foobar"];
+  [engine run];
+  XCTAssertTrue(engine.platformView != nullptr);
+  auto ios_context = engine.platformView->GetIosContext();
+
+  auto pool = flutter::OverlayLayerPool{};
+  pool.CreateLayer(ios_context, MTLPixelFormatBGRA8Unorm);
+  pool.CreateLayer(ios_context, MTLPixelFormatBGRA8Unorm);
+
+  // Use both layers, then only one of them for a few frames.
+  XCTAssertNotEqual(pool.GetNextLayer(), nullptr);
+  XCTAssertNotEqual(pool.GetNextLayer(), nullptr);
+  pool.RemoveUnusedLayers();
+  pool.RecycleLayers();
+  for (int i = 0; i < 3; i++) {
+    XCTAssertNotEqual(pool.GetNextLayer(), nullptr);
+    XCTAssertEqual(pool.RemoveUnusedLayers().size(), 1u);
+    pool.RecycleLayers();
+  }
+
+  // The unused layer is still available when it's needed again.
+  XCTAssertNotEqual(pool.GetNextLayer(), nullptr);
+  XCTAssertNotEqual(pool.GetNextLayer(), nullptr);
+  XCTAssertEqual(pool.created_layer_count(), 2u);
+  XCTAssertEqual(pool.reused_layer_count(), 5u);
+  XCTAssertEqual(pool.released_layer_count(), 0u);
+}
+
+- (void)testLayerPoolReleasesLayersOverBudget {
+  FlutterEngine* engine = [[FlutterEngine alloc] initWithName:@"foobar"];
+  [engine run];
+  XCTAssertTrue(engine.platformView != nullptr);
+  auto ios_context = engine.platformView->GetIosContext();
+
+  // A budget that doesn't allow any unused layers.
+  auto pool = flutter::OverlayLayerPool{/*max_unused_bytes=*/0};
+  pool.CreateLayer(ios_context, MTLPixelFormatBGRA8Unorm);
+  pool.CreateLayer(ios_context, MTLPixelFormatBGRA8Unorm);
+  pool.RecycleLayers();
+
   auto unused_layers = pool.RemoveUnusedLayers();
   XCTAssertEqual(unused_layers.size(), 2u);
   XCTAssertEqual(pool.size(), 1u);
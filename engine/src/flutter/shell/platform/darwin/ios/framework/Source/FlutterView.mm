@@ -165,6 +165,23 @@ static void PrintWideGamutWarningOnce() {
   did_print = YES;
 }
 
+// Returns the number of drawables the Metal layer may use, set by FLTMaximumDrawableCount in the
+// Info.plist, or 0 to keep the layer's default of 3.
+//
+// Using 2 drawables lowers latency and memory use, but the raster thread then has to wait for each
+// frame to finish on the GPU before it can start the next one.
+static NSUInteger GetMaximumDrawableCount() {
+  static NSUInteger maximum_drawable_count = 0;
+  static dispatch_once_t once_token;
+  dispatch_once(&once_token, ^{
+    NSNumber* count = [NSBundle.mainBundle objectForInfoDictionaryKey:@"FLTMaximumDrawableCount"];
+    if (count != nil) {
+      maximum_drawable_count = count.unsignedIntegerValue;
+    }
+  });
+  return maximum_drawable_count;
+}
+
 - (void)layoutSubviews {
   if ([self.layer isKindOfClass:[CAMetalLayer class]]) {
 // It is a known Apple bug that CAMetalLayer incorrectly reports its supported
@@ -178,6 +195,10 @@ static void PrintWideGamutWarningOnce() {
     layer.contentsScale = screenScale;
     layer.rasterizationScale = screenScale;
     layer.framebufferOnly = flutter::Settings::kSurfaceDataAccessible ? NO : YES;
+    NSUInteger maximumDrawableCount = GetMaximumDrawableCount();
+    if (maximumDrawableCount == 2 || maximumDrawableCount == 3) {
+      layer.maximumDrawableCount = maximumDrawableCount;
+    }
     if (_isWideGamutEnabled && self.isWideGamutSupported) {
       fml::CFRef<CGColorSpaceRef> srgb(CGColorSpaceCreateWithName(kCGColorSpaceExtendedSRGB));
       layer.colorspace = srgb;
@@ -1410,12 +1410,6 @@ static flutter::PointerData::DeviceKind DeviceKindFromTouchType(UITouch* touch)
 }
 
 - (void)triggerTouchRateCorrectionIfNeeded:(NSSet*)touches {
-  if (_touchRateCorrectionVSyncClient == nil) {
-    // If the _touchRateCorrectionVSyncClient is not created, means current devices doesn't
-    // need to correct the touch rate. So just return.
-    return;
-  }
-
   // As long as there is a touch's phase is UITouchPhaseBegan or UITouchPhaseMoved,
   // activate the correction. Otherwise pause the correction.
   BOOL isUserInteracting = NO;
@@ -1426,6 +1420,18 @@ static flutter::PointerData::DeviceKind DeviceKindFromTouchType(UITouch* touch)
     }
   }
 
+  // Frames are scheduled at the maximum rate while the user interacts, regardless of any frame
+  // rate hint.
+  if (self.engine.viewController == self) {
+    [self.engine setUserInteracting:isUserInteracting];
+  }
+
+  if (_touchRateCorrectionVSyncClient == nil) {
+    // If the _touchRateCorrectionVSyncClient is not created, means current devices doesn't
+    // need to correct the touch rate. So just return.
+    return;
+  }
+
   if (isUserInteracting && self.engine.viewController == self) {
     [_touchRateCorrectionVSyncClient await];
   } else {
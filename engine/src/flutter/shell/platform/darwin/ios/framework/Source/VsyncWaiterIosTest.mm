@@ -71,6 +71,38 @@ fml::RefPtr<fml::TaskRunner> CreateNewThread(const std::string& name) {
   }
 }
 
+- (void)testSetPreferredFrameRateBelowMaxRefreshRate {
+  auto thread_task_runner = CreateNewThread("VsyncWaiterIosTest");
+  auto callback = [](std::unique_ptr<flutter::FrameTimingsRecorder> recorder) {};
+  id bundleMock = OCMPartialMock([NSBundle mainBundle]);
+  OCMStub([bundleMock objectForInfoDictionaryKey:kCADisableMinimumFrameDurationOnPhoneKey])
+      .andReturn(@YES);
+  id mockDisplayLinkManager = [OCMockObject mockForClass:[DisplayLinkManager class]];
+  double maxFrameRate = 120;
+  [[[mockDisplayLinkManager stub] andReturnValue:@(maxFrameRate)] displayRefreshRate];
+
+  VSyncClient* vsyncClient = [[VSyncClient alloc] initWithTaskRunner:thread_task_runner
+                                                            callback:callback];
+  CADisplayLink* link = [vsyncClient getDisplayLink];
+  [vsyncClient setMaxRefreshRate:maxFrameRate preferredFrameRate:30];
+  if (@available(iOS 15.0, *)) {
+    XCTAssertEqualWithAccuracy(link.preferredFrameRateRange.maximum, maxFrameRate, 0.1);
+    XCTAssertEqualWithAccuracy(link.preferredFrameRateRange.preferred, 30, 0.1);
+    XCTAssertEqualWithAccuracy(link.preferredFrameRateRange.minimum, 30, 0.1);
+  } else {
+    XCTAssertEqualWithAccuracy(link.preferredFramesPerSecond, 30, 0.1);
+  }
+
+  // Preferring the maximum rate restores the default range.
+  [vsyncClient setMaxRefreshRate:maxFrameRate preferredFrameRate:maxFrameRate];
+  if (@available(iOS 15.0, *)) {
+    XCTAssertEqualWithAccuracy(link.preferredFrameRateRange.preferred, maxFrameRate, 0.1);
+    XCTAssertEqualWithAccuracy(link.preferredFrameRateRange.minimum, maxFrameRate / 2, 0.1);
+  } else {
+    XCTAssertEqualWithAccuracy(link.preferredFramesPerSecond, maxFrameRate, 0.1);
+  }
+}
+
 - (void)testDoNotSetVariableRefreshRatesIfCADisableMinimumFrameDurationOnPhoneIsNotOn {
   auto thread_task_runner = CreateNewThread("VsyncWaiterIosTest");
   auto callback = [](std::unique_ptr<flutter::FrameTimingsRecorder> recorder) {};
@@ -35,18 +35,39 @@ struct OverlayLayer {
   // Whether a frame for this layer was submitted.
   bool did_submit_last_frame;
 
+  // An estimate of the memory used by one buffer of this layer, in bytes.
+  size_t byte_size = 0;
+
+  // The number of consecutive frames this layer wasn't used in.
+  size_t unused_frame_count = 0;
+
+  // Whether this layer was used in a frame yet.
+  bool was_used = false;
+
   void UpdateViewState(UIView* flutter_view, DlRect rect, int64_t view_id, int64_t overlay_id);
 };
 
 /// @brief Storage for Overlay layers across frames.
 ///
+/// Layers that aren't used in a frame are kept around for a while, so that platform views
+/// scrolling in and out of view don't allocate overlays repeatedly. They are released once they
+/// haven't been used for |kMaxUnusedFrames| frames, or earlier if the unused layers use more
+/// memory than the pool's budget. All layers cover the whole Flutter view, so any layer can be
+/// reused for any overlay.
+///
 /// Note: this class does not synchronize access to its layers or any layer removal. As it
 /// is currently used, layers must be created on the platform thread but other methods of
 /// it are called on the raster thread. This is safe as overlay layers are only ever added
 /// while the raster thread is latched.
 class OverlayLayerPool {
  public:
-  OverlayLayerPool() = default;
+  /// @brief The number of frames an unused layer is kept for before it's released.
+  static constexpr size_t kMaxUnusedFrames = 60;
+
+  /// @brief The default budget for the memory used by unused layers, in bytes.
+  static constexpr size_t kDefaultMaxUnusedBytes = 64 * 1024 * 1024;
+
+  explicit OverlayLayerPool(size_t max_unused_bytes = kDefaultMaxUnusedBytes);
 
   ~OverlayLayerPool() = default;
 
@@ -60,7 +81,11 @@ class OverlayLayerPool {
   /// This method can only be called on the Platform thread.
   void CreateLayer(const std::shared_ptr<IOSContext>& ios_context, MTLPixelFormat pixel_format);
 
-  /// @brief Removes unused layers from the pool. Returns the unused layers.
+  /// @brief Returns the layers that weren't used in this frame, so they can be removed from the
+  /// view hierarchy.
+  ///
+  /// Layers that haven't been used for too long, or that exceed the memory budget, are also
+  /// removed from the pool.
   std::vector<std::shared_ptr<OverlayLayer>> RemoveUnusedLayers();
 
   /// @brief Marks the layers in the pool as available for reuse.
@@ -69,6 +94,15 @@ class OverlayLayerPool {
   /// @brief The count of layers currently in the pool.
   size_t size() const;
 
+  /// @brief The number of layers created by this pool.
+  size_t created_layer_count() const { return created_layer_count_; }
+
+  /// @brief The number of times a layer was used again in a later frame.
+  size_t reused_layer_count() const { return reused_layer_count_; }
+
+  /// @brief The number of layers released by this pool.
+  size_t released_layer_count() const { return released_layer_count_; }
+
  private:
   OverlayLayerPool(const OverlayLayerPool&) = delete;
   OverlayLayerPool& operator=(const OverlayLayerPool&) = delete;
@@ -87,6 +121,11 @@ class OverlayLayerPool {
   /// cannot be reused.
   size_t available_layer_index_ = 0;
   std::vector<std::shared_ptr<OverlayLayer>> layers_;
+
+  const size_t max_unused_bytes_;
+  size_t created_layer_count_ = 0;
+  size_t reused_layer_count_ = 0;
+  size_t released_layer_count_ = 0;
 };
 
 }  // namespace flutter
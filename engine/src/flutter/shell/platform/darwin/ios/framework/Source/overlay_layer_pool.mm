@@ -4,6 +4,7 @@
 
 #include "flutter/shell/platform/darwin/ios/framework/Source/overlay_layer_pool.h"
 
+#include "flutter/fml/trace_event.h"
 #import "flutter/shell/platform/darwin/ios/framework/Source/FlutterOverlayView.h"
 #import "flutter/shell/platform/darwin/ios/ios_surface.h"
 
@@ -43,11 +44,33 @@ void OverlayLayer::UpdateViewState(UIView* flutter_view,
 // OverlayLayerPool
 ////////////////////////////////////////////////////////
 
+namespace {
+
+size_t BytesPerPixel(MTLPixelFormat pixel_format) {
+  switch (pixel_format) {
+    case MTLPixelFormatRGBA16Float:
+    case MTLPixelFormatBGRA10_XR:
+      return 8;
+    default:
+      return 4;
+  }
+}
+
+}  // namespace
+
+OverlayLayerPool::OverlayLayerPool(size_t max_unused_bytes)
+    : max_unused_bytes_(max_unused_bytes) {}
+
 std::shared_ptr<OverlayLayer> OverlayLayerPool::GetNextLayer() {
   std::shared_ptr<OverlayLayer> result;
   if (available_layer_index_ < layers_.size()) {
     result = layers_[available_layer_index_];
     available_layer_index_++;
+    if (result->was_used) {
+      reused_layer_count_++;
+    }
+    result->was_used = true;
+    result->unused_frame_count = 0;
   }
 
   return result;
@@ -72,6 +95,10 @@ void OverlayLayerPool::CreateLayer(const std::shared_ptr<IOSContext>& ios_contex
 
   layer = std::make_shared<OverlayLayer>(overlay_view, overlay_view_wrapper, std::move(ios_surface),
                                          std::move(surface));
+  // Overlays are the size of the Flutter view, which is usually the size of the screen.
+  CGSize screenSize = [UIScreen mainScreen].nativeBounds.size;
+  layer->byte_size = static_cast<size_t>(screenSize.width * screenSize.height) *
+                     BytesPerPixel(pixel_format);
 
   // The overlay view wrapper masks the overlay view.
   // This is required to keep the backing surface size unchanged between frames.
@@ -91,6 +118,7 @@ void OverlayLayerPool::CreateLayer(const std::shared_ptr<IOSContext>& ios_contex
   [layer->overlay_view_wrapper addSubview:layer->overlay_view];
 
   layers_.push_back(layer);
+  created_layer_count_++;
 }
 
 void OverlayLayerPool::RecycleLayers() {
@@ -99,18 +127,34 @@ void OverlayLayerPool::RecycleLayers() {
 
 std::vector<std::shared_ptr<OverlayLayer>> OverlayLayerPool::RemoveUnusedLayers() {
   std::vector<std::shared_ptr<OverlayLayer>> results;
+  size_t unused_bytes = 0;
   for (size_t i = available_layer_index_; i < layers_.size(); i++) {
+    layers_[i]->unused_frame_count++;
+    unused_bytes += layers_[i]->byte_size;
     results.push_back(layers_[i]);
   }
+  // Layers are handed out in order, so the layers at the end of the pool are the ones that have
+  // gone unused the longest. Release those first.
+  //
   // Leave at least one overlay layer, to work around cases where scrolling
   // platform views under an app bar continually adds and removes an
   // overlay layer. This logic could be removed if https://github.com/flutter/flutter/issues/150646
   // is fixed.
   static constexpr size_t kLeakLayerCount = 1;
   size_t erase_offset = std::max(available_layer_index_, kLeakLayerCount);
-  if (erase_offset < layers_.size()) {
-    layers_.erase(layers_.begin() + erase_offset, layers_.end());
+  while (erase_offset < layers_.size()) {
+    const std::shared_ptr<OverlayLayer>& layer = layers_.back();
+    if (layer->unused_frame_count < kMaxUnusedFrames && unused_bytes <= max_unused_bytes_) {
+      break;
+    }
+    unused_bytes -= layer->byte_size;
+    layers_.pop_back();
+    released_layer_count_++;
   }
+  FML_TRACE_COUNTER("flutter", "OverlayLayerPool", reinterpret_cast<int64_t>(this),  //
+                    "LayerCount", layers_.size(),                                   //
+                    "CreatedLayerCount", created_layer_count_,                      //
+                    "ReusedLayerCount", reused_layer_count_);
   return results;
 }
 
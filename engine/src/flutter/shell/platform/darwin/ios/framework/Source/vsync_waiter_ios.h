@@ -7,7 +7,10 @@
 
 #include <QuartzCore/CADisplayLink.h>
 
+#include <atomic>
+
 #include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_delta.h"
 #include "flutter/shell/common/variable_refresh_rate_reporter.h"
 #include "flutter/shell/common/vsync_waiter.h"
 
@@ -70,6 +73,14 @@ extern NSString* const kCADisableMinimumFrameDurationOnPhoneKey;
 
 - (void)setMaxRefreshRate:(double)refreshRate;
 
+//------------------------------------------------------------------------------
+/// @brief      Sets the range of refresh rates the display link asks for.
+///
+/// @param refreshRate         The maximum refresh rate of the display.
+/// @param preferredFrameRate  The refresh rate the content needs, at most `refreshRate`.
+///
+- (void)setMaxRefreshRate:(double)refreshRate preferredFrameRate:(double)preferredFrameRate;
+
 @end
 
 namespace flutter {
@@ -87,9 +98,40 @@ class VsyncWaiterIOS final : public VsyncWaiter, public VariableRefreshRateRepor
   // Made public for testing.
   void AwaitVSync() override;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Hints the frame rate the content needs, so that ProMotion displays can refresh
+  ///             at a lower rate while frames are scheduled. A rate of 0 removes the hint.
+  ///
+  ///             The hint is ignored while the user is interacting with the app, see
+  ///             `SetUserInteracting`.
+  ///
+  /// @attention  This may be called on any thread. It takes effect from the next frame.
+  ///
+  void SetFrameRateHint(double frame_rate);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Sets whether the user is touching the app. Frames are scheduled at the maximum
+  ///             refresh rate while they are, and for `kInteractionFrameRateDuration` after, so
+  ///             that scrolling and flinging stay smooth.
+  ///
+  /// @attention  This may be called on any thread.
+  ///
+  void SetUserInteracting(bool interacting);
+
  private:
+  // How long after the user stops touching the app frames keep being scheduled at the maximum
+  // refresh rate.
+  static constexpr fml::TimeDelta kInteractionFrameRateDuration = fml::TimeDelta::FromSeconds(1);
+
   VSyncClient* client_;
   double max_refresh_rate_;
+  double preferred_frame_rate_;
+  std::atomic<double> frame_rate_hint_{0};
+  std::atomic_bool user_interacting_{false};
+  std::atomic<int64_t> interaction_end_time_us_{0};
+
+  // Returns the refresh rate to ask the display link for.
+  double GetPreferredFrameRate() const;
 
   FML_DISALLOW_COPY_AND_ASSIGN(VsyncWaiterIOS);
 };
@@ -39,6 +39,7 @@ VsyncWaiterIOS::VsyncWaiterIOS(const flutter::TaskRunners& task_runners)
   client_ = [[VSyncClient alloc] initWithTaskRunner:task_runners_.GetUITaskRunner()
                                            callback:callback];
   max_refresh_rate_ = DisplayLinkManager.displayRefreshRate;
+  preferred_frame_rate_ = max_refresh_rate_;
 }
 
 VsyncWaiterIOS::~VsyncWaiterIOS() {
@@ -49,13 +50,47 @@ VsyncWaiterIOS::~VsyncWaiterIOS() {
 
 void VsyncWaiterIOS::AwaitVSync() {
   double new_max_refresh_rate = DisplayLinkManager.displayRefreshRate;
-  if (fabs(new_max_refresh_rate - max_refresh_rate_) > kRefreshRateDiffToIgnore) {
+  bool max_refresh_rate_changed =
+      fabs(new_max_refresh_rate - max_refresh_rate_) > kRefreshRateDiffToIgnore;
+  if (max_refresh_rate_changed) {
     max_refresh_rate_ = new_max_refresh_rate;
-    [client_ setMaxRefreshRate:max_refresh_rate_];
+  }
+  double new_preferred_frame_rate = GetPreferredFrameRate();
+  if (max_refresh_rate_changed ||
+      fabs(new_preferred_frame_rate - preferred_frame_rate_) > kRefreshRateDiffToIgnore) {
+    preferred_frame_rate_ = new_preferred_frame_rate;
+    [client_ setMaxRefreshRate:max_refresh_rate_ preferredFrameRate:preferred_frame_rate_];
   }
   [client_ await];
 }
 
+void VsyncWaiterIOS::SetFrameRateHint(double frame_rate) {
+  frame_rate_hint_.store(fmax(frame_rate, 0));
+}
+
+void VsyncWaiterIOS::SetUserInteracting(bool interacting) {
+  if (!interacting && user_interacting_.load()) {
+    interaction_end_time_us_.store(fml::TimePoint::Now().ToEpochDelta().ToMicroseconds());
+  }
+  user_interacting_.store(interacting);
+}
+
+double VsyncWaiterIOS::GetPreferredFrameRate() const {
+  double hint = frame_rate_hint_.load();
+  if (hint <= 0) {
+    return max_refresh_rate_;
+  }
+  if (user_interacting_.load()) {
+    return max_refresh_rate_;
+  }
+  fml::TimePoint interaction_end_time = fml::TimePoint::FromEpochDelta(
+      fml::TimeDelta::FromMicroseconds(interaction_end_time_us_.load()));
+  if (fml::TimePoint::Now() - interaction_end_time < kInteractionFrameRateDuration) {
+    return max_refresh_rate_;
+  }
+  return fmin(hint, max_refresh_rate_);
+}
+
 // |VariableRefreshRateReporter|
 double VsyncWaiterIOS::GetRefreshRate() const {
   return client_.refreshRate;
@@ -92,16 +127,31 @@ double VsyncWaiterIOS::GetRefreshRate() const {
 }
 
 - (void)setMaxRefreshRate:(double)refreshRate {
+  [self setMaxRefreshRate:refreshRate preferredFrameRate:refreshRate];
+}
+
+- (void)setMaxRefreshRate:(double)refreshRate preferredFrameRate:(double)preferredFrameRate {
   if (!DisplayLinkManager.maxRefreshRateEnabledOnIPhone) {
     return;
   }
   double maxFrameRate = fmax(refreshRate, 60);
-  double minFrameRate = fmax(maxFrameRate / 2, 60);
+  if (preferredFrameRate >= refreshRate) {
+    double minFrameRate = fmax(maxFrameRate / 2, 60);
+    if (@available(iOS 15.0, *)) {
+      _displayLink.preferredFrameRateRange =
+          CAFrameRateRangeMake(minFrameRate, maxFrameRate, maxFrameRate);
+    } else {
+      _displayLink.preferredFramesPerSecond = maxFrameRate;
+    }
+    return;
+  }
+  // Ask for a stable rate below the maximum, while still allowing the system to go faster if
+  // other content on screen needs it.
+  double frameRate = fmax(preferredFrameRate, 1);
   if (@available(iOS 15.0, *)) {
-    _displayLink.preferredFrameRateRange =
-        CAFrameRateRangeMake(minFrameRate, maxFrameRate, maxFrameRate);
+    _displayLink.preferredFrameRateRange = CAFrameRateRangeMake(frameRate, maxFrameRate, frameRate);
   } else {
-    _displayLink.preferredFramesPerSecond = maxFrameRate;
+    _displayLink.preferredFramesPerSecond = frameRate;
   }
 }
 
@@ -84,6 +84,8 @@ void IOSExternalViewEmbedder::SubmitFlutterView(
   FML_DCHECK(flutter_view_id == kFlutterImplicitViewId);
   FML_CHECK(platform_views_controller_);
   [platform_views_controller_ submitFrame:std::move(frame) withIosContext:ios_context_];
+  RecordOverlayLayers(platform_views_controller_.submittedOverlayLayerCount,
+                      platform_views_controller_.submittedOverlayLayerPixels);
   TRACE_EVENT0("flutter", "IOSExternalViewEmbedder::DidSubmitFrame");
 }
 
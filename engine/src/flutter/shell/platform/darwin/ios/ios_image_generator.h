@@ -0,0 +1,93 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_DARWIN_IOS_IOS_IMAGE_GENERATOR_H_
+#define FLUTTER_SHELL_PLATFORM_DARWIN_IOS_IOS_IMAGE_GENERATOR_H_
+
+#include <ImageIO/ImageIO.h>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/platform/darwin/cf_utils.h"
+#include "flutter/lib/ui/painting/image_generator.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// An |ImageGenerator| for JPEG and HEIF images that decodes them with
+/// ImageIO, which uses the hardware decoders of the device.
+///
+/// With Impeller, images are decoded into IOSurfaces that Metal samples from
+/// without an upload. Images are decoded at the size they are asked for, and
+/// rotated by their orientation.
+///
+class IOSImageGenerator : public ImageGenerator {
+ public:
+  ~IOSImageGenerator() override;
+
+  // |ImageGenerator|
+  const SkImageInfo& GetInfo() override;
+
+  // |ImageGenerator|
+  unsigned int GetFrameCount() const override;
+
+  // |ImageGenerator|
+  unsigned int GetPlayCount() const override;
+
+  // |ImageGenerator|
+  const ImageGenerator::FrameInfo GetFrameInfo(
+      unsigned int frame_index) override;
+
+  // |ImageGenerator|
+  SkISize GetScaledDimensions(float desired_scale) override;
+
+  // |ImageGenerator|
+  bool GetPixels(const SkImageInfo& info,
+                 void* pixels,
+                 size_t row_bytes,
+                 unsigned int frame_index,
+                 std::optional<unsigned int> prior_frame) override;
+
+  // |ImageGenerator|
+  std::shared_ptr<impeller::Texture> GetTexture(
+      const SkISize& size,
+      const std::shared_ptr<impeller::Context>& context) override;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Returns a generator for `data` if it is a JPEG or HEIF
+  ///             image, and null otherwise.
+  ///
+  /// @param[in]  data                The encoded image.
+  /// @param[in]  reject_wide_gamut   Whether images with a color profile
+  ///                                 other than sRGB are left to the builtin
+  ///                                 decoders, which decode them to wide
+  ///                                 gamut formats.
+  ///
+  static std::shared_ptr<ImageGenerator> MakeFromData(sk_sp<SkData> data,
+                                                      bool reject_wide_gamut);
+
+ private:
+  IOSImageGenerator(sk_sp<SkData> data,
+                    fml::CFRef<CGImageSourceRef> source,
+                    size_t index,
+                    const SkImageInfo& info);
+
+  // Decodes the image into a bitmap context over `pixels`, with the same
+  // layout as a |kBGRA_8888_SkColorType| or |kRGBA_8888_SkColorType| image.
+  bool Draw(const SkISize& size,
+            bool bgra,
+            void* pixels,
+            size_t row_bytes) const;
+
+  // Keeps the bytes that |source_| reads from alive.
+  const sk_sp<SkData> data_;
+  const fml::CFRef<CGImageSourceRef> source_;
+  const size_t index_;
+  const SkImageInfo info_;
+
+  FML_DISALLOW_COPY_ASSIGN_AND_MOVE(IOSImageGenerator);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_DARWIN_IOS_IOS_IMAGE_GENERATOR_H_
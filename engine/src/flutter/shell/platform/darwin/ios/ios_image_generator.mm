@@ -0,0 +1,225 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "flutter/shell/platform/darwin/ios/ios_image_generator.h"
+
+#import <CoreVideo/CoreVideo.h>
+#import <IOSurface/IOSurfaceRef.h>
+#import <Metal/Metal.h>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+#import "flutter/shell/platform/darwin/common/framework/Headers/FlutterMacros.h"
+#include "impeller/renderer/backend/metal/context_mtl.h"
+#include "impeller/renderer/backend/metal/texture_mtl.h"
+#include "third_party/skia/include/codec/SkCodecAnimation.h"
+
+FLUTTER_ASSERT_ARC
+
+namespace flutter {
+
+namespace {
+
+bool IsJpegOrHeif(CGImageSourceRef source) {
+  CFStringRef type = CGImageSourceGetType(source);
+  return type && (CFEqual(type, CFSTR("public.jpeg")) || CFEqual(type, CFSTR("public.heic")) ||
+                  CFEqual(type, CFSTR("public.heif")));
+}
+
+// Whether the EXIF orientation swaps the width and the height of the image.
+bool SwapsDimensions(int orientation) {
+  return orientation >= kCGImagePropertyOrientationLeftMirrored &&
+         orientation <= kCGImagePropertyOrientationLeft;
+}
+
+}  // namespace
+
+IOSImageGenerator::IOSImageGenerator(sk_sp<SkData> data,
+                                     fml::CFRef<CGImageSourceRef> source,
+                                     size_t index,
+                                     const SkImageInfo& info)
+    : data_(std::move(data)), source_(std::move(source)), index_(index), info_(info) {}
+
+IOSImageGenerator::~IOSImageGenerator() = default;
+
+const SkImageInfo& IOSImageGenerator::GetInfo() {
+  return info_;
+}
+
+unsigned int IOSImageGenerator::GetFrameCount() const {
+  return 1;
+}
+
+unsigned int IOSImageGenerator::GetPlayCount() const {
+  return 1;
+}
+
+const ImageGenerator::FrameInfo IOSImageGenerator::GetFrameInfo(unsigned int frame_index) {
+  return {.required_frame = std::nullopt,
+          .duration = 0,
+          .disposal_method = SkCodecAnimation::DisposalMethod::kKeep};
+}
+
+SkISize IOSImageGenerator::GetScaledDimensions(float desired_scale) {
+  // ImageIO decodes at any size, so the image never needs to be resized after
+  // it is decoded.
+  if (desired_scale >= 1.0f) {
+    return info_.dimensions();
+  }
+  return SkISize::Make(std::max(1, static_cast<int>(std::ceil(info_.width() * desired_scale))),
+                       std::max(1, static_cast<int>(std::ceil(info_.height() * desired_scale))));
+}
+
+bool IOSImageGenerator::Draw(const SkISize& size,
+                             bool bgra,
+                             void* pixels,
+                             size_t row_bytes) const {
+  // Decoding a thumbnail lets ImageIO decode the image at a smaller size,
+  // rather than decoding all of it to scale it afterwards.
+  NSDictionary* options = @{
+    (id)kCGImageSourceCreateThumbnailFromImageAlways : @YES,
+    (id)kCGImageSourceCreateThumbnailWithTransform : @YES,
+    (id)kCGImageSourceThumbnailMaxPixelSize : @(std::max(size.width(), size.height())),
+  };
+  fml::CFRef<CGImageRef> image(
+      CGImageSourceCreateThumbnailAtIndex(source_, index_, (__bridge CFDictionaryRef)options));
+  if (!image) {
+    FML_DLOG(ERROR) << "ImageIO could not decode the image.";
+    return false;
+  }
+
+  fml::CFRef<CGColorSpaceRef> color_space(CGColorSpaceCreateWithName(kCGColorSpaceSRGB));
+  const uint32_t bitmap_info =
+      bgra ? kCGImageAlphaPremultipliedFirst | kCGBitmapByteOrder32Little
+           : kCGImageAlphaPremultipliedLast | kCGBitmapByteOrder32Big;
+  fml::CFRef<CGContextRef> context(CGBitmapContextCreate(pixels, size.width(), size.height(), 8,
+                                                         row_bytes, color_space, bitmap_info));
+  if (!context) {
+    return false;
+  }
+  CGContextSetBlendMode(context, kCGBlendModeCopy);
+  CGContextSetInterpolationQuality(context, kCGInterpolationHigh);
+  // The thumbnail keeps the aspect ratio of the image, which the requested
+  // size may not.
+  CGContextDrawImage(context, CGRectMake(0, 0, size.width(), size.height()), image);
+  return true;
+}
+
+bool IOSImageGenerator::GetPixels(const SkImageInfo& info,
+                                  void* pixels,
+                                  size_t row_bytes,
+                                  unsigned int frame_index,
+                                  std::optional<unsigned int> prior_frame) {
+  TRACE_EVENT0("flutter", "IOSImageGenerator::GetPixels");
+  if (frame_index != 0) {
+    return false;
+  }
+  if (info.colorType() != kBGRA_8888_SkColorType && info.colorType() != kRGBA_8888_SkColorType) {
+    return false;
+  }
+  if (info.alphaType() != kPremul_SkAlphaType &&
+      !(info.alphaType() == kOpaque_SkAlphaType && info_.isOpaque())) {
+    return false;
+  }
+  return Draw(info.dimensions(), info.colorType() == kBGRA_8888_SkColorType, pixels, row_bytes);
+}
+
+std::shared_ptr<impeller::Texture> IOSImageGenerator::GetTexture(
+    const SkISize& size,
+    const std::shared_ptr<impeller::Context>& context) {
+  if (!context || context->GetBackendType() != impeller::Context::BackendType::kMetal) {
+    return nullptr;
+  }
+  TRACE_EVENT0("flutter", "IOSImageGenerator::GetTexture");
+
+  NSDictionary* properties = @{
+    (id)kIOSurfaceWidth : @(size.width()),
+    (id)kIOSurfaceHeight : @(size.height()),
+    (id)kIOSurfaceBytesPerElement : @4,
+    (id)kIOSurfaceBytesPerRow : @(IOSurfaceAlignProperty(kIOSurfaceBytesPerRow, size.width() * 4)),
+    (id)kIOSurfacePixelFormat : @(kCVPixelFormatType_32BGRA),
+  };
+  fml::CFRef<IOSurfaceRef> surface(IOSurfaceCreate((__bridge CFDictionaryRef)properties));
+  if (!surface) {
+    return nullptr;
+  }
+
+  // The decoded pixels are written straight into the memory that Metal
+  // samples from.
+  IOSurfaceLock(surface, 0, nullptr);
+  const bool drawn = Draw(size, /*bgra=*/true, IOSurfaceGetBaseAddress(surface),
+                          IOSurfaceGetBytesPerRow(surface));
+  IOSurfaceUnlock(surface, 0, nullptr);
+  if (!drawn) {
+    return nullptr;
+  }
+
+  MTLTextureDescriptor* mtl_desc =
+      [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatBGRA8Unorm
+                                                         width:size.width()
+                                                        height:size.height()
+                                                     mipmapped:NO];
+  mtl_desc.usage = MTLTextureUsageShaderRead;
+  id<MTLTexture> mtl_texture =
+      [impeller::ContextMTL::Cast(*context).GetMTLDevice() newTextureWithDescriptor:mtl_desc
+                                                                          iosurface:surface
+                                                                              plane:0];
+  if (!mtl_texture) {
+    return nullptr;
+  }
+
+  impeller::TextureDescriptor desc;
+  desc.storage_mode = impeller::StorageMode::kDevicePrivate;
+  desc.format = impeller::PixelFormat::kB8G8R8A8UNormInt;
+  desc.size = impeller::ISize(size.width(), size.height());
+  desc.mip_count = 1;
+  auto texture = impeller::TextureMTL::Wrapper(desc, mtl_texture, [surface]() {});
+  texture->SetCoordinateSystem(impeller::TextureCoordinateSystem::kUploadFromHost);
+  return texture;
+}
+
+std::shared_ptr<ImageGenerator> IOSImageGenerator::MakeFromData(sk_sp<SkData> data,
+                                                                bool reject_wide_gamut) {
+  if (!data || data->size() == 0) {
+    return nullptr;
+  }
+  // The generator keeps the bytes alive for as long as the source reads them.
+  fml::CFRef<CFDataRef> cf_data(CFDataCreateWithBytesNoCopy(
+      kCFAllocatorDefault, data->bytes(), data->size(), kCFAllocatorNull));
+  NSDictionary* source_options = @{(id)kCGImageSourceShouldCache : @NO};
+  fml::CFRef<CGImageSourceRef> source(
+      CGImageSourceCreateWithData(cf_data, (__bridge CFDictionaryRef)source_options));
+  if (!source || !IsJpegOrHeif(source)) {
+    return nullptr;
+  }
+  const size_t index = CGImageSourceGetPrimaryImageIndex(source);
+
+  NSDictionary* properties = CFBridgingRelease(
+      CGImageSourceCopyPropertiesAtIndex(source, index, (__bridge CFDictionaryRef)source_options));
+  NSNumber* width = properties[(id)kCGImagePropertyPixelWidth];
+  NSNumber* height = properties[(id)kCGImagePropertyPixelHeight];
+  if (width.intValue <= 0 || height.intValue <= 0) {
+    return nullptr;
+  }
+  NSString* profile = properties[(id)kCGImagePropertyProfileName];
+  if (reject_wide_gamut && profile && ![profile hasPrefix:@"sRGB"]) {
+    return nullptr;
+  }
+
+  const int orientation = [properties[(id)kCGImagePropertyOrientation] intValue];
+  const bool swap = SwapsDimensions(orientation);
+  const bool has_alpha = [properties[(id)kCGImagePropertyHasAlpha] boolValue];
+  const SkImageInfo info = SkImageInfo::Make(
+      swap ? height.intValue : width.intValue, swap ? width.intValue : height.intValue,
+      kBGRA_8888_SkColorType, has_alpha ? kPremul_SkAlphaType : kOpaque_SkAlphaType,
+      SkColorSpace::MakeSRGB());
+  return std::shared_ptr<ImageGenerator>(
+      new IOSImageGenerator(std::move(data), std::move(source), index, info));
+}
+
+}  // namespace flutter
@@ -5,6 +5,10 @@
 #ifndef FLUTTER_SHELL_PLATFORM_DARWIN_IOS_PLATFORM_MESSAGE_HANDLER_IOS_H_
 #define FLUTTER_SHELL_PLATFORM_DARWIN_IOS_PLATFORM_MESSAGE_HANDLER_IOS_H_
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "flutter/fml/task_runner.h"
 #include "flutter/shell/common/platform_message_handler.h"
 #import "flutter/shell/platform/darwin/ios/flutter_task_queue_dispatch.h"
@@ -36,6 +40,20 @@ class PlatformMessageHandlerIos : public PlatformMessageHandler {
   };
 
  private:
+  /// Handlers waiting to run on the main queue. They are shared with the
+  /// block that runs them, which can outlive this object.
+  struct MainQueueHandlers {
+    std::mutex mutex;
+    std::vector<dispatch_block_t> handlers;
+  };
+
+  /// Runs |handler| on the main queue. Handlers that are scheduled before the
+  /// main queue gets to the previous ones run in the same main queue task, in
+  /// the order they were scheduled.
+  void DispatchToMainQueue(dispatch_block_t handler);
+
+  const std::shared_ptr<MainQueueHandlers> main_queue_handlers_ =
+      std::make_shared<MainQueueHandlers>();
   std::unordered_map<std::string, HandlerInfo> message_handlers_;
   const fml::RefPtr<fml::TaskRunner> platform_task_runner_;
   std::mutex message_handlers_mutex_;
@@ -83,7 +83,7 @@ void PlatformMessageHandlerIos::HandlePlatformMessage(std::unique_ptr<PlatformMe
       if (handler_info.task_queue) {
         [handler_info.task_queue dispatch:run_handler];
       } else {
-        dispatch_async(dispatch_get_main_queue(), run_handler);
+        DispatchToMainQueue(run_handler);
       }
     } else {
       if (completer) {
@@ -93,6 +93,32 @@ void PlatformMessageHandlerIos::HandlePlatformMessage(std::unique_ptr<PlatformMe
   }
 }
 
+void PlatformMessageHandlerIos::DispatchToMainQueue(dispatch_block_t handler) {
+  std::shared_ptr<MainQueueHandlers> pending = main_queue_handlers_;
+  {
+    std::lock_guard lock(pending->mutex);
+    pending->handlers.push_back(handler);
+    if (pending->handlers.size() > 1) {
+      // A task that will run this handler has already been dispatched.
+      return;
+    }
+  }
+  dispatch_async(dispatch_get_main_queue(), ^{
+    std::vector<dispatch_block_t> handlers;
+    {
+      std::lock_guard lock(pending->mutex);
+      handlers.swap(pending->handlers);
+    }
+    TRACE_EVENT1("flutter", "PlatformMessageHandlerIos::RunMainQueueHandlers", "count",
+                 std::to_string(handlers.size()).c_str());
+    for (dispatch_block_t run_handler : handlers) {
+      @autoreleasepool {
+        run_handler();
+      }
+    }
+  });
+}
+
 bool PlatformMessageHandlerIos::DoesHandlePlatformMessageOnPlatformThread() const {
   return false;
 }
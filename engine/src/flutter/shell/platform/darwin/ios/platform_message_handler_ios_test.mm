@@ -132,5 +132,41 @@ class MockPlatformMessageResponse : public PlatformMessageResponse {
   [self waitForExpectationsWithTimeout:1.0 handler:nil];
   XCTAssertTrue(response->is_complete());
 }
+
+- (void)testMainQueueHandlersRunInOrder {
+  ThreadHost thread_host("io.flutter.test." + std::string(self.name.UTF8String),
+                         ThreadHost::Type::kRaster | ThreadHost::Type::kIo | ThreadHost::Type::kUi);
+  TaskRunners task_runners(
+      "test", GetCurrentTaskRunner(), thread_host.raster_thread->GetTaskRunner(),
+      thread_host.ui_thread->GetTaskRunner(), thread_host.io_thread->GetTaskRunner());
+
+  auto handler = std::make_unique<PlatformMessageHandlerIos>(task_runners.GetPlatformTaskRunner());
+  std::string channel = "foo";
+  const int message_count = 10;
+  XCTestExpectation* didCallReply = [self expectationWithDescription:@"didCallReply"];
+  didCallReply.expectedFulfillmentCount = message_count;
+  NSMutableArray<NSData*>* received = [[NSMutableArray alloc] init];
+  handler->SetMessageHandler(
+      channel,
+      ^(NSData* _Nullable data, FlutterBinaryReply _Nonnull reply) {
+        XCTAssertTrue([NSThread isMainThread]);
+        [received addObject:data];
+        reply(nil);
+        [didCallReply fulfill];
+      },
+      nil);
+  task_runners.GetUITaskRunner()->PostTask([channel, &handler] {
+    for (uint8_t i = 0; i < message_count; i++) {
+      auto platform_message = std::make_unique<flutter::PlatformMessage>(
+          channel, fml::MallocMapping::Copy(&i, sizeof(i)), MockPlatformMessageResponse::Create());
+      handler->HandlePlatformMessage(std::move(platform_message));
+    }
+  });
+  [self waitForExpectationsWithTimeout:1.0 handler:nil];
+  XCTAssertEqual(received.count, static_cast<NSUInteger>(message_count));
+  for (uint8_t i = 0; i < received.count; i++) {
+    XCTAssertEqual(static_cast<const uint8_t*>(received[i].bytes)[0], i);
+  }
+}
 @end
 // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks)
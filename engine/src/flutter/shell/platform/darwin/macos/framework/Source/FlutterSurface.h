@@ -31,6 +31,9 @@
 
 @property(readonly, nonatomic, nonnull) IOSurfaceRef ioSurface;
 @property(readonly, nonatomic) CGSize size;
+// The part of the surface, anchored at its top left corner, that Flutter renders into and
+// that is presented. Equal to `size` unless the surface was allocated larger than needed.
+@property(readwrite, nonatomic) CGSize viewportSize;
 @property(readonly, nonatomic) int64_t textureId;
 // Whether the surface is currently in use by the compositor.
 @property(readonly, nonatomic) BOOL isInUse;
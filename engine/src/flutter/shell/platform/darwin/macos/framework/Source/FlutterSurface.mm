@@ -11,6 +11,7 @@
 
 @interface FlutterSurface () {
   CGSize _size;
+  CGSize _viewportSize;
   fml::CFRef<IOSurfaceRef> _ioSurface;
   id<MTLTexture> _texture;
   // Used for testing.
@@ -28,6 +29,14 @@
   return _size;
 }
 
+- (CGSize)viewportSize {
+  return _viewportSize;
+}
+
+- (void)setViewportSize:(CGSize)viewportSize {
+  _viewportSize = viewportSize;
+}
+
 - (int64_t)textureId {
   return reinterpret_cast<int64_t>(_texture);
 }
@@ -47,6 +56,7 @@
 - (instancetype)initWithSize:(CGSize)size device:(id<MTLDevice>)device {
   if (self = [super init]) {
     self->_size = size;
+    self->_viewportSize = size;
     self->_ioSurface.Reset([FlutterSurface createIOSurfaceWithSize:size]);
     self->_texture = [FlutterSurface createTextureForIOSurface:_ioSurface size:size device:device];
   }
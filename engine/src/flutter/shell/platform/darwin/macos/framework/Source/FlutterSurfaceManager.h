@@ -58,6 +58,9 @@
  * Returns a back buffer surface of the given size to which Flutter can render content.
  * A cached surface will be returned if available; otherwise a new one will be created.
  *
+ * During a live resize the surface may be larger than requested, in which case its
+ * `viewportSize` is the requested size.
+ *
  * Must be called on raster thread.
  */
 - (nonnull FlutterSurface*)surfaceForSize:(CGSize)size;
@@ -75,6 +78,15 @@
                  atTime:(CFTimeInterval)presentationTime
                  notify:(nullable dispatch_block_t)notify;
 
+/**
+ * Whether the view is being resized interactively. While it is, surfaces are allocated in size
+ * classes so that one surface can be reused for many intermediate sizes instead of allocating
+ * an IOSurface for every frame.
+ *
+ * Can be set from any thread.
+ */
+@property(readwrite, atomic) BOOL liveResizing;
+
 @end
 
 /**
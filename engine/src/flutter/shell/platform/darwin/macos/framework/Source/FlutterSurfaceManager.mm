@@ -7,6 +7,7 @@
 #import <Metal/Metal.h>
 
 #include <algorithm>
+#include <cmath>
 
 #include "flutter/fml/logging.h"
 #import "flutter/shell/platform/darwin/macos/framework/Source/FlutterSurface.h"
@@ -130,11 +131,22 @@ static void UpdateContentSubLayers(CALayer* layer,
   return _layers;
 }
 
+// During live resize surface dimensions are rounded up to a multiple of this many pixels.
+static const CGFloat kLiveResizeSurfaceAlignment = 256;
+
+static CGSize GetLiveResizeSurfaceSize(CGSize size) {
+  CGFloat alignment = kLiveResizeSurfaceAlignment;
+  return CGSizeMake(std::ceil(size.width / alignment) * alignment,
+                    std::ceil(size.height / alignment) * alignment);
+}
+
 - (FlutterSurface*)surfaceForSize:(CGSize)size {
-  FlutterSurface* surface = [_backBufferCache removeSurfaceForSize:size];
+  CGSize surfaceSize = self.liveResizing ? GetLiveResizeSurfaceSize(size) : size;
+  FlutterSurface* surface = [_backBufferCache removeSurfaceForSize:surfaceSize];
   if (surface == nil) {
-    surface = [[FlutterSurface alloc] initWithSize:size device:_device];
+    surface = [[FlutterSurface alloc] initWithSize:surfaceSize device:_device];
   }
+  surface.viewportSize = size;
   return surface;
 }
 
@@ -180,8 +192,11 @@ static void UpdateContentSubLayers(CALayer* layer,
     CALayer* layer = _layers[i];
     CGFloat scale = _containingLayer.contentsScale;
     if (i == 0) {
+      CGSize viewportSize = info.surface.viewportSize;
       layer.frame = CGRectMake(info.offset.x / scale, info.offset.y / scale,
-                               info.surface.size.width / scale, info.surface.size.height / scale);
+                               viewportSize.width / scale, viewportSize.height / scale);
+      layer.contentsRect = CGRectMake(0, 0, viewportSize.width / info.surface.size.width,
+                                      viewportSize.height / info.surface.size.height);
       layer.contents = (__bridge id)info.surface.ioSurface;
     } else {
       layer.frame = CGRectZero;
@@ -209,8 +224,8 @@ static void UpdateContentSubLayers(CALayer* layer,
 static CGSize GetRequiredFrameSize(NSArray<FlutterSurfacePresentInfo*>* surfaces) {
   CGSize size = CGSizeZero;
   for (FlutterSurfacePresentInfo* info in surfaces) {
-    size = CGSizeMake(std::max(size.width, info.offset.x + info.surface.size.width),
-                      std::max(size.height, info.offset.y + info.surface.size.height));
+    size = CGSizeMake(std::max(size.width, info.offset.x + info.surface.viewportSize.width),
+                      std::max(size.height, info.offset.y + info.surface.viewportSize.height));
   }
   return size;
 }
@@ -170,6 +170,36 @@ TEST(FlutterSurfaceManager, SurfacesAreRecycled) {
   EXPECT_EQ(surface3, surface1);
 }
 
+TEST(FlutterSurfaceManager, SurfacesAreReusedDuringLiveResize) {
+  TestView* testView = [[TestView alloc] init];
+  FlutterSurfaceManager* surfaceManager = CreateSurfaceManager(testView);
+  surfaceManager.liveResizing = YES;
+
+  auto surface1 = [surfaceManager surfaceForSize:CGSizeMake(100, 60)];
+  EXPECT_TRUE(CGSizeEqualToSize(surface1.size, CGSizeMake(256, 256)));
+  EXPECT_TRUE(CGSizeEqualToSize(surface1.viewportSize, CGSizeMake(100, 60)));
+  [surfaceManager presentSurfaces:@[ CreatePresentInfo(surface1) ] atTime:0 notify:nil];
+
+  // Only the viewport is presented.
+  EXPECT_TRUE(CGSizeEqualToSize(testView.presentedFrameSize, CGSizeMake(100, 60)));
+  CALayer* layer = testView.layer.sublayers[0];
+  EXPECT_TRUE(CGRectEqualToRect(layer.frame, CGRectMake(0, 0, 50, 30)));
+  EXPECT_TRUE(CGRectEqualToRect(layer.contentsRect, CGRectMake(0, 0, 100.0 / 256, 60.0 / 256)));
+
+  // A surface of a different size in the same size class is reused.
+  auto surface2 = [surfaceManager surfaceForSize:CGSizeMake(110, 70)];
+  [surfaceManager presentSurfaces:@[ CreatePresentInfo(surface2) ] atTime:0 notify:nil];
+  auto surface3 = [surfaceManager surfaceForSize:CGSizeMake(120, 80)];
+  EXPECT_EQ(surface3, surface1);
+  EXPECT_TRUE(CGSizeEqualToSize(surface3.viewportSize, CGSizeMake(120, 80)));
+
+  // Surfaces have exact sizes once the resize is over.
+  surfaceManager.liveResizing = NO;
+  auto surface4 = [surfaceManager surfaceForSize:CGSizeMake(120, 80)];
+  EXPECT_TRUE(CGSizeEqualToSize(surface4.size, CGSizeMake(120, 80)));
+  EXPECT_TRUE(CGSizeEqualToSize(surface4.viewportSize, CGSizeMake(120, 80)));
+}
+
 TEST(FlutterSurfaceManager, BackingStoreCacheSurfaceStuckInUse) {
   TestView* testView = [[TestView alloc] init];
   FlutterSurfaceManager* surfaceManager = CreateSurfaceManager(testView);
@@ -20,6 +20,10 @@
 
 @end
 
+// How long a live resize waits for a frame at the new size before the window moves on and
+// shows the previous frame until the new one is presented.
+static const NSTimeInterval kLiveResizeTimeout = 2.0 / 60.0;
+
 @implementation FlutterView
 
 - (instancetype)initWithMTLDevice:(id<MTLDevice>)device
@@ -63,6 +67,17 @@
 - (void)setFrameSize:(NSSize)newSize {
   [super setFrameSize:newSize];
   CGSize scaledSize = [self convertSizeToBacking:self.bounds.size];
+  if (self.inLiveResize) {
+    // Don't hold up the window for slow frames; the frame that matches the
+    // final size is presented as soon as it is ready.
+    [_resizeSynchronizer beginResizeForSize:scaledSize
+                                    timeout:kLiveResizeTimeout
+                                     notify:^{
+                                       [_viewDelegate viewDidReshape:self];
+                                     }
+                                  onTimeout:nil];
+    return;
+  }
   [_resizeSynchronizer beginResizeForSize:scaledSize
       notify:^{
         [_viewDelegate viewDidReshape:self];
@@ -72,6 +87,18 @@
       }];
 }
 
+- (void)viewWillStartLiveResize {
+  [super viewWillStartLiveResize];
+  _surfaceManager.liveResizing = YES;
+}
+
+- (void)viewDidEndLiveResize {
+  [super viewDidEndLiveResize];
+  _surfaceManager.liveResizing = NO;
+  // Redraw so that the final frame is rendered into a surface of the exact size.
+  [_viewDelegate viewDidReshape:self];
+}
+
 /**
  * Declares that the view uses a flipped coordinate system, consistent with Flutter conventions.
  */
@@ -34,7 +34,9 @@ import Foundation
 /// Safeguards:
 ///   - Timeout: `beginResize()` includes a timeout mechanism to prevent indefinite blocking if a
 ///     matching frame isn't committed in a timely manner. An optional `onTimeout` closure can be
-///     provided to handle this event.
+///     provided to handle this event. During a live resize callers can pass a short timeout so
+///     that the window keeps showing the last frame, padded to the new size, instead of stalling;
+///     the matching frame is committed whenever it arrives.
 ///   - Shutdown: The synchronization can be cleanly interrupted by calling `shutDown()`, which will
 ///     also unblock any pending `beginResize()` call. After shutdown, `beginResize()` will no
 ///     longer block.
@@ -44,6 +46,9 @@ import Foundation
 public final class ResizeSynchronizer: NSObject {
   private static let invalidSize = CGSize(width: -1, height: -1)
 
+  // How long `beginResize(forSize:notify:onTimeout:)` waits for a matching frame.
+  private static let defaultTimeout: TimeInterval = 1.0
+
   // Synchronizes access to _isInResize_unsafe: isInResize is accessed from multiple threads and
   // thus requires synchronized access to the underlying storage.
   private let isInResizeLock = NSLock()
@@ -79,6 +84,21 @@ public final class ResizeSynchronizer: NSObject {
     forSize size: CGSize,
     notify: () -> Void,
     onTimeout: (() -> Void)? = nil
+  ) {
+    beginResize(
+      forSize: size, timeout: ResizeSynchronizer.defaultTimeout, notify: notify,
+      onTimeout: onTimeout)
+  }
+
+  /// Begins window resize operation to the specified size, blocking for at most `timeout` seconds.
+  ///
+  /// Behaves like `beginResize(forSize:notify:onTimeout:)`. If no matching frame is committed
+  /// within `timeout`, `onTimeout` is called and the thread is unblocked.
+  @objc public func beginResize(
+    forSize size: CGSize,
+    timeout: TimeInterval,
+    notify: () -> Void,
+    onTimeout: (() -> Void)? = nil
   ) {
     if !didReceiveFrame || isShuttingDown {
       // If we haven't yet received a frame, or we're shutting down, there's nothing to do.
@@ -93,9 +113,8 @@ public final class ResizeSynchronizer: NSObject {
     // Call the notify callback.
     notify()
 
-    // Spin, waiting for the commit (during frame present) for up to 1 second, then time out.
+    // Spin, waiting for the commit (during frame present) until the timeout.
     let startTime = CFAbsoluteTimeGetCurrent()
-    let timeoutDuration: TimeInterval = 1.0
     while true {
       // If no change to size, or we got a shutdown notice, bail out.
       if contentSize == size || isShuttingDown {
@@ -103,7 +122,7 @@ public final class ResizeSynchronizer: NSObject {
       }
 
       // If we've hit the timeout, notify the caller and bail out.
-      if CFAbsoluteTimeGetCurrent() - startTime > timeoutDuration {
+      if CFAbsoluteTimeGetCurrent() - startTime > timeout {
         onTimeout?()
         break
       }
@@ -147,6 +147,38 @@ struct ResizeSynchronizerTest {
     #expect(didReceiveFrame == true)
   }
 
+  @MainActor
+  @Test("beginResize with a short timeout stops blocking after the timeout")
+  func testBeginResizeHonorsTimeout() async {
+    FlutterRunLoop.ensureMainLoopInitialized()
+
+    // Resize synchronizer must have presented a frame in order to block.
+    let synchronizer = ResizeSynchronizer()
+    var didReceiveFrame = false
+    synchronizer.performCommit(forSize: CGSize(width: 10, height: 10), afterDelay: 0) {
+      didReceiveFrame = true
+    }
+    do {
+      try await waitForCondition("didReceiveFrame to be true", timeout: 1.0) { didReceiveFrame }
+    } catch {
+      // Record the timeout and bail out of the test.
+      Issue.record("\(error)")
+      return
+    }
+
+    // No frame matching the new size is ever committed.
+    var didTimeout = false
+    let startTime = CFAbsoluteTimeGetCurrent()
+    synchronizer.beginResize(forSize: CGSize(width: 100, height: 100), timeout: 0.05) {
+    } onTimeout: {
+      didTimeout = true
+    }
+    let elapsed = CFAbsoluteTimeGetCurrent() - startTime
+
+    #expect(didTimeout == true)
+    #expect(elapsed < 0.5, "beginResize blocked for \(elapsed) seconds")
+  }
+
   @MainActor
   @Test("shutDown unblocks an active beginResize and prevents future blocking")
   func testUnblocksOnShutdown() async {
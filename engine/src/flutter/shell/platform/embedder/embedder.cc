@@ -102,6 +102,15 @@ extern const intptr_t kPlatformStrongDillSize;
 #ifdef SHELL_ENABLE_VULKAN
 #include "third_party/skia/include/gpu/ganesh/vk/GrVkBackendSurface.h"
 #include "third_party/skia/include/gpu/ganesh/vk/GrVkTypes.h"
+#ifdef IMPELLER_SUPPORTS_RENDERING
+#include "flutter/shell/platform/embedder/embedder_render_target_impeller.h"  // nogncheck
+#include "impeller/renderer/backend/vulkan/context_vk.h"         // nogncheck
+#include "impeller/renderer/backend/vulkan/formats_vk.h"         // nogncheck
+#include "impeller/renderer/backend/vulkan/pipeline_cache_data_vk.h"  // nogncheck
+#include "impeller/renderer/backend/vulkan/texture_source_vk.h"  // nogncheck
+#include "impeller/renderer/backend/vulkan/texture_vk.h"         // nogncheck
+#include "impeller/renderer/render_target.h"                     // nogncheck
+#endif  // IMPELLER_SUPPORTS_RENDERING
 #endif  // SHELL_ENABLE_VULKAN
 
 const int32_t kFlutterSemanticsNodeIdBatchEnd = -1;
@@ -328,17 +337,20 @@ InferOpenGLPlatformViewCreationCallback(
     if (present) {
       return present(user_data);
     } else {
-      // Format the frame and buffer damages accordingly. Note that, since the
-      // current compute damage algorithm only returns one rectangle for damage
-      // we are assuming the number of rectangles provided in frame and buffer
-      // damage are always 1. Once the function that computes damage implements
-      // support for multiple damage rectangles, GLPresentInfo should also
-      // contain the number of damage rectangles.
-
-      std::optional<FlutterRect> frame_damage_rect;
+      // Format the frame and buffer damages accordingly. The frame damage is
+      // only split into more than one rectangle if the embedder opted into
+      // that with |max_frame_damage_rects|, the buffer damage is always a
+      // single rectangle.
+      std::vector<FlutterRect> frame_damage_rects;
       if (gl_present_info.frame_damage) {
-        frame_damage_rect =
-            DlIRectToFlutterRect(*(gl_present_info.frame_damage));
+        if (gl_present_info.frame_damage_rects.empty()) {
+          frame_damage_rects.push_back(
+              DlIRectToFlutterRect(*(gl_present_info.frame_damage)));
+        } else {
+          for (const auto& rect : gl_present_info.frame_damage_rects) {
+            frame_damage_rects.push_back(DlIRectToFlutterRect(rect));
+          }
+        }
       }
       std::optional<FlutterRect> buffer_damage_rect;
       if (gl_present_info.buffer_damage) {
@@ -348,8 +360,9 @@ InferOpenGLPlatformViewCreationCallback(
 
       FlutterDamage frame_damage{
           .struct_size = sizeof(FlutterDamage),
-          .num_rects = frame_damage_rect ? size_t{1} : size_t{0},
-          .damage = frame_damage_rect ? &frame_damage_rect.value() : nullptr,
+          .num_rects = frame_damage_rects.size(),
+          .damage = frame_damage_rects.empty() ? nullptr
+                                               : frame_damage_rects.data(),
       };
       FlutterDamage buffer_damage{
           .struct_size = sizeof(FlutterDamage),
@@ -468,6 +481,9 @@ InferOpenGLPlatformViewCreationCallback(
   bool fbo_reset_after_present =
       SAFE_ACCESS(open_gl_config, fbo_reset_after_present, false);
 
+  size_t max_frame_damage_rects =
+      SAFE_ACCESS(open_gl_config, max_frame_damage_rects, 1);
+
   flutter::EmbedderSurfaceGLSkia::GLDispatchTable gl_dispatch_table = {
       gl_make_current,                     // gl_make_current_callback
       gl_clear_current,                    // gl_clear_current_callback
@@ -477,6 +493,7 @@ InferOpenGLPlatformViewCreationCallback(
       gl_surface_transformation_callback,  // gl_surface_transformation_callback
       gl_proc_resolver,                    // gl_proc_resolver
       gl_populate_existing_damage,         // gl_populate_existing_damage
+      max_frame_damage_rects,              // max_frame_damage_rects
   };
 
   return fml::MakeCopyable(
@@ -615,7 +632,8 @@ InferVulkanPlatformViewCreationCallback(
         platform_dispatch_table,
     std::unique_ptr<flutter::EmbedderExternalViewEmbedder>
         external_view_embedder,
-    bool enable_impeller) {
+    bool enable_impeller,
+    const std::vector<std::string>& bundled_pipeline_caches) {
   if (config->type != kVulkan) {
     return nullptr;
   }
@@ -679,7 +697,8 @@ InferVulkanPlatformViewCreationCallback(
             static_cast<VkDevice>(config->vulkan.device),
             config->vulkan.queue_family_index,
             static_cast<VkQueue>(config->vulkan.queue), vulkan_dispatch_table,
-            view_embedder);
+            view_embedder,
+            impeller::PipelineCacheDataReadBundled(bundled_pipeline_caches));
 
     return fml::MakeCopyable(
         [embedder_surface = std::move(embedder_surface),
@@ -815,7 +834,8 @@ InferPlatformViewCreationCallback(
         platform_dispatch_table,
     std::unique_ptr<flutter::EmbedderExternalViewEmbedder>
         external_view_embedder,
-    bool enable_impeller) {
+    bool enable_impeller,
+    const std::vector<std::string>& vulkan_bundled_pipeline_caches) {
   if (config == nullptr) {
     return nullptr;
   }
@@ -836,7 +856,8 @@ InferPlatformViewCreationCallback(
     case kVulkan:
       return InferVulkanPlatformViewCreationCallback(
           config, user_data, platform_dispatch_table,
-          std::move(external_view_embedder), enable_impeller);
+          std::move(external_view_embedder), enable_impeller,
+          vulkan_bundled_pipeline_caches);
     default:
       return nullptr;
   }
@@ -1297,6 +1318,149 @@ MakeRenderTargetFromBackingStoreImpeller(
 #endif
 }
 
+#if defined(SHELL_ENABLE_VULKAN) && defined(IMPELLER_SUPPORTS_RENDERING)
+namespace {
+
+// An image provided by the embedder in a Vulkan backing store.
+//
+// It is treated as a swapchain image so that the render passes that draw into
+// it leave it in VK_IMAGE_LAYOUT_GENERAL, where the embedder can read it
+// without knowing how Impeller last used it.
+class EmbedderBackingStoreTextureSourceVK final
+    : public impeller::TextureSourceVK {
+ public:
+  EmbedderBackingStoreTextureSourceVK(
+      const impeller::TextureDescriptor& desc,
+      impeller::vk::Image image,
+      impeller::vk::UniqueImageView image_view,
+      fml::closure on_release)
+      : TextureSourceVK(desc),
+        image_(image),
+        image_view_(std::move(image_view)),
+        on_release_(std::move(on_release)) {}
+
+  ~EmbedderBackingStoreTextureSourceVK() override {
+    image_view_.reset();
+    if (on_release_) {
+      on_release_();
+    }
+  }
+
+ private:
+  impeller::vk::Image GetImage() const override { return image_; }
+
+  impeller::vk::ImageView GetImageView() const override {
+    return image_view_.get();
+  }
+
+  impeller::vk::ImageView GetRenderTargetView() const override {
+    return image_view_.get();
+  }
+
+  bool IsSwapchainImage() const override { return true; }
+
+  impeller::vk::Image image_;
+  impeller::vk::UniqueImageView image_view_;
+  fml::closure on_release_;
+};
+
+}  // namespace
+#endif
+
+static std::unique_ptr<flutter::EmbedderRenderTarget>
+MakeRenderTargetFromBackingStoreImpeller(
+    FlutterBackingStore backing_store,
+    const fml::closure& on_release,
+    const std::shared_ptr<impeller::AiksContext>& aiks_context,
+    const FlutterBackingStoreConfig& config,
+    const FlutterVulkanBackingStore* vulkan) {
+#if defined(SHELL_ENABLE_VULKAN) && defined(IMPELLER_SUPPORTS_RENDERING)
+  if (!vulkan->image || !vulkan->image->image) {
+    FML_LOG(ERROR) << "Embedder supplied null Vulkan image.";
+    return nullptr;
+  }
+
+  std::optional<impeller::PixelFormat> format =
+      impeller::VkFormatToImpellerFormat(
+          static_cast<impeller::vk::Format>(vulkan->image->format));
+  if (!format.has_value()) {
+    FML_LOG(ERROR) << "Embedder supplied Vulkan image has unsupported format.";
+    return nullptr;
+  }
+
+  const auto size = impeller::ISize(config.size.width, config.size.height);
+  const std::shared_ptr<impeller::Context>& context =
+      aiks_context->GetContext();
+
+  impeller::TextureDescriptor resolve_tex_desc;
+  resolve_tex_desc.format = format.value();
+  resolve_tex_desc.size = size;
+  resolve_tex_desc.sample_count = impeller::SampleCount::kCount1;
+  resolve_tex_desc.storage_mode = impeller::StorageMode::kDevicePrivate;
+  resolve_tex_desc.usage = impeller::TextureUsage::kRenderTarget |
+                           impeller::TextureUsage::kShaderRead;
+
+  impeller::vk::Image image(reinterpret_cast<VkImage>(vulkan->image->image));
+  impeller::vk::ImageViewCreateInfo view_info = {};
+  view_info.image = image;
+  view_info.viewType = impeller::vk::ImageViewType::e2D;
+  view_info.format = impeller::ToVKImageFormat(resolve_tex_desc.format);
+  view_info.subresourceRange.aspectMask =
+      impeller::vk::ImageAspectFlagBits::eColor;
+  view_info.subresourceRange.levelCount = 1u;
+  view_info.subresourceRange.layerCount = 1u;
+  auto [result, image_view] =
+      impeller::ContextVK::Cast(*context).GetDevice().createImageViewUnique(
+          view_info);
+  if (result != impeller::vk::Result::eSuccess) {
+    FML_LOG(ERROR) << "Could not create an image view for embedder supplied "
+                      "Vulkan image: "
+                   << impeller::vk::to_string(result);
+    return nullptr;
+  }
+
+  auto resolve_tex = std::make_shared<impeller::TextureVK>(
+      context, std::make_shared<EmbedderBackingStoreTextureSourceVK>(
+                   resolve_tex_desc, image, std::move(image_view),
+                   [callback = vulkan->destruction_callback,
+                    user_data = vulkan->user_data]() { callback(user_data); }));
+  resolve_tex->SetLabel("ImpellerBackingStoreResolve");
+
+  impeller::TextureDescriptor msaa_tex_desc;
+  msaa_tex_desc.storage_mode = impeller::StorageMode::kDeviceTransient;
+  msaa_tex_desc.type = impeller::TextureType::kTexture2DMultisample;
+  msaa_tex_desc.sample_count = impeller::SampleCount::kCount4;
+  msaa_tex_desc.format = resolve_tex_desc.format;
+  msaa_tex_desc.size = size;
+  msaa_tex_desc.usage = impeller::TextureUsage::kRenderTarget;
+
+  auto msaa_tex =
+      context->GetResourceAllocator()->CreateTexture(msaa_tex_desc);
+  if (!msaa_tex) {
+    FML_LOG(ERROR) << "Could not allocate MSAA color texture.";
+    return nullptr;
+  }
+  msaa_tex->SetLabel("ImpellerBackingStoreColorMSAA");
+
+  impeller::ColorAttachment color0;
+  color0.texture = msaa_tex;
+  color0.clear_color = impeller::Color::DarkSlateGray();
+  color0.load_action = impeller::LoadAction::kClear;
+  color0.store_action = impeller::StoreAction::kMultisampleResolve;
+  color0.resolve_texture = resolve_tex;
+
+  impeller::RenderTarget render_target_desc;
+  render_target_desc.SetColorAttachment(color0, 0u);
+
+  return std::make_unique<flutter::EmbedderRenderTargetImpeller>(
+      backing_store, aiks_context,
+      std::make_unique<impeller::RenderTarget>(std::move(render_target_desc)),
+      on_release, fml::closure());
+#else
+  return nullptr;
+#endif
+}
+
 static sk_sp<SkSurface> MakeSkSurfaceFromBackingStore(
     GrDirectContext* context,
     const FlutterBackingStoreConfig& config,
@@ -1509,7 +1673,9 @@ CreateEmbedderRenderTarget(
     }
     case kFlutterBackingStoreTypeVulkan: {
       if (enable_impeller) {
-        FML_LOG(ERROR) << "Unimplemented";
+        render_target = MakeRenderTargetFromBackingStoreImpeller(
+            backing_store, collect_callback.Release(), aiks_context, config,
+            &backing_store.vulkan);
         break;
       } else {
         auto skia_surface = MakeSkSurfaceFromBackingStore(
@@ -1528,12 +1694,137 @@ CreateEmbedderRenderTarget(
   return render_target;
 }
 
+#ifdef SHELL_ENABLE_GL
+/// Resolves OpenGL functions with the resolver of the embedder, or the default
+/// one of the platform. Returns null if there is neither.
+static std::function<void*(const char*)> InferOpenGLProcResolver(
+    const FlutterOpenGLRendererConfig* open_gl_config,
+    void* user_data) {
+  if (SAFE_ACCESS(open_gl_config, gl_proc_resolver, nullptr) != nullptr) {
+    return [ptr = open_gl_config->gl_proc_resolver,
+            user_data](const char* gl_proc_name) {
+      return ptr(user_data, gl_proc_name);
+    };
+  }
+#if FML_OS_LINUX || FML_OS_WIN
+  return DefaultGLProcResolver;
+#else
+  return nullptr;
+#endif  // FML_OS_LINUX || FML_OS_WIN
+}
+#endif  // SHELL_ENABLE_GL
+
+/// Creates a fence that is signaled once the GPU has finished all commands the
+/// engine submitted so far. Returns false if no fence could be created.
+using RenderFenceCallback = std::function<bool(FlutterRenderFence* fence)>;
+
+/// Creates the callback that makes fences for the renderer, or returns null if
+/// the renderer doesn't support fences.
+static RenderFenceCallback InferRenderFenceCallback(
+    const FlutterRendererConfig* config,
+    void* user_data) {
+  switch (config->type) {
+#ifdef SHELL_ENABLE_GL
+    case kOpenGL: {
+      std::function<void*(const char*)> gl_proc_resolver =
+          InferOpenGLProcResolver(&config->open_gl, user_data);
+      if (!gl_proc_resolver) {
+        return nullptr;
+      }
+
+      // GL_SYNC_GPU_COMMANDS_COMPLETE.
+      static constexpr uint32_t kSyncGpuCommandsComplete = 0x9117;
+      using FenceSyncProc = void* (*)(uint32_t condition, uint32_t flags);
+      using FlushProc = void (*)();
+      struct GLFenceProcs {
+        FenceSyncProc fence_sync = nullptr;
+        FlushProc flush = nullptr;
+      };
+      // Some resolvers need a current context, so the functions are resolved
+      // on the raster thread when the first fence is created.
+      return [gl_proc_resolver, procs = std::make_shared<GLFenceProcs>()](
+                 FlutterRenderFence* fence) {
+        if (procs->fence_sync == nullptr || procs->flush == nullptr) {
+          procs->fence_sync =
+              reinterpret_cast<FenceSyncProc>(gl_proc_resolver("glFenceSync"));
+          procs->flush =
+              reinterpret_cast<FlushProc>(gl_proc_resolver("glFlush"));
+          if (procs->fence_sync == nullptr || procs->flush == nullptr) {
+            return false;
+          }
+        }
+        void* sync = procs->fence_sync(kSyncGpuCommandsComplete, 0);
+        if (sync == nullptr) {
+          return false;
+        }
+        // A fence that was never flushed can't be waited on in another
+        // context.
+        procs->flush();
+        fence->type = kFlutterRenderFenceTypeOpenGL;
+        fence->open_gl_sync = sync;
+        return true;
+      };
+    }
+#endif  // SHELL_ENABLE_GL
+#ifdef SHELL_ENABLE_VULKAN
+    case kVulkan: {
+      auto get_proc = config->vulkan.get_instance_proc_address_callback;
+      auto instance = static_cast<VkInstance>(config->vulkan.instance);
+      auto create_semaphore = reinterpret_cast<PFN_vkCreateSemaphore>(
+          get_proc(user_data, instance, "vkCreateSemaphore"));
+      auto destroy_semaphore = reinterpret_cast<PFN_vkDestroySemaphore>(
+          get_proc(user_data, instance, "vkDestroySemaphore"));
+      // The embedder swaps this one out for a variant that locks the queue.
+      auto queue_submit = reinterpret_cast<PFN_vkQueueSubmit>(
+          get_proc(user_data, instance, "vkQueueSubmit"));
+      if (create_semaphore == nullptr || destroy_semaphore == nullptr ||
+          queue_submit == nullptr) {
+        return nullptr;
+      }
+      return [create_semaphore, destroy_semaphore, queue_submit,
+              device = static_cast<VkDevice>(config->vulkan.device),
+              queue = static_cast<VkQueue>(config->vulkan.queue)](
+                 FlutterRenderFence* fence) {
+        VkSemaphoreCreateInfo create_info = {
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+        };
+        VkSemaphore semaphore = VK_NULL_HANDLE;
+        if (create_semaphore(device, &create_info, nullptr, &semaphore) !=
+            VK_SUCCESS) {
+          return false;
+        }
+        // A signal waits for all commands submitted to the queue before it,
+        // so an empty submission is enough to cover the rendering.
+        VkSubmitInfo submit_info = {
+            .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+            .signalSemaphoreCount = 1,
+            .pSignalSemaphores = &semaphore,
+        };
+        if (queue_submit(queue, 1, &submit_info, VK_NULL_HANDLE) !=
+            VK_SUCCESS) {
+          destroy_semaphore(device, semaphore, nullptr);
+          return false;
+        }
+        fence->type = kFlutterRenderFenceTypeVulkan;
+        fence->vulkan_semaphore =
+            reinterpret_cast<FlutterVulkanSemaphoreHandle>(semaphore);
+        return true;
+      };
+    }
+#endif  // SHELL_ENABLE_VULKAN
+    default:
+      return nullptr;
+  }
+}
+
 /// Creates an EmbedderExternalViewEmbedder.
 ///
 /// When a non-OK status is returned, engine startup should be halted.
 static fml::StatusOr<std::unique_ptr<flutter::EmbedderExternalViewEmbedder>>
 InferExternalViewEmbedderFromArgs(const FlutterCompositor* compositor,
-                                  bool enable_impeller) {
+                                  bool enable_impeller,
+                                  const FlutterRendererConfig* config,
+                                  void* engine_user_data) {
   if (compositor == nullptr) {
     return std::unique_ptr<flutter::EmbedderExternalViewEmbedder>{nullptr};
   }
@@ -1548,6 +1839,10 @@ InferExternalViewEmbedderFromArgs(const FlutterCompositor* compositor,
       SAFE_ACCESS(compositor, present_view_callback, nullptr);
   bool avoid_backing_store_cache =
       SAFE_ACCESS(compositor, avoid_backing_store_cache, false);
+  RenderFenceCallback render_fence_callback =
+      SAFE_ACCESS(compositor, create_render_fences, false)
+          ? InferRenderFenceCallback(config, engine_user_data)
+          : nullptr;
 
   // Make sure the required callbacks are present
   if (!c_create_callback || !c_collect_callback) {
@@ -1586,16 +1881,25 @@ InferExternalViewEmbedderFromArgs(const FlutterCompositor* compositor,
   } else {
     FML_DCHECK(c_present_view_callback != nullptr);
     present_callback = [c_present_view_callback,
-                        user_data = compositor->user_data](
-                           FlutterViewId view_id, const auto& layers) {
+                        user_data = compositor->user_data,
+                        render_fence_callback](FlutterViewId view_id,
+                                               const auto& layers) {
       TRACE_EVENT0("flutter", "FlutterCompositorPresentLayers");
 
+      // The layers have been rendered and flushed by now.
+      FlutterRenderFence render_fence = {
+          .struct_size = sizeof(FlutterRenderFence),
+      };
+      bool has_render_fence =
+          render_fence_callback && render_fence_callback(&render_fence);
+
       FlutterPresentViewInfo info = {
           .struct_size = sizeof(FlutterPresentViewInfo),
           .view_id = view_id,
           .layers = const_cast<const FlutterLayer**>(layers.data()),
           .layers_count = layers.size(),
           .user_data = user_data,
+          .render_fence = has_render_fence ? &render_fence : nullptr,
       };
 
       return c_present_view_callback(&info);
@@ -2079,6 +2383,32 @@ FlutterEngineResult FlutterEngineInitialize(size_t version,
   settings.leak_vm = !SAFE_ACCESS(args, shutdown_dart_vm_when_done, false);
   settings.old_gen_heap_size = SAFE_ACCESS(args, dart_old_gen_heap_size, -1);
 
+  if (const FlutterWorkerPool* worker_pool =
+          SAFE_ACCESS(args, worker_pool, nullptr)) {
+    FlutterWorkerPoolPostTaskCallback post_task_callback =
+        SAFE_ACCESS(worker_pool, post_task_callback, nullptr);
+    size_t worker_count = SAFE_ACCESS(worker_pool, worker_count, 0);
+    if (post_task_callback == nullptr || worker_count == 0) {
+      return LOG_EMBEDDER_ERROR(
+          kInvalidArguments,
+          "The worker pool must specify a post task callback and at least "
+          "one worker.");
+    }
+    settings.concurrent_task_executor =
+        [post_task_callback,
+         pool_user_data = SAFE_ACCESS(worker_pool, user_data, nullptr)](
+            const fml::closure& task) {
+          post_task_callback(
+              [](void* task) {
+                std::unique_ptr<fml::closure> closure(
+                    static_cast<fml::closure*>(task));
+                (*closure)();
+              },
+              new fml::closure(task), pool_user_data);
+        };
+    settings.concurrent_task_executor_worker_count = worker_count;
+  }
+
   if (!flutter::DartVM::IsRunningPrecompiledCode()) {
     // Verify the assets path contains Dart 2 kernel assets.
     const std::string kApplicationKernelSnapshotFileName = "kernel_blob.bin";
@@ -2123,6 +2453,26 @@ FlutterEngineResult FlutterEngineInitialize(size_t version,
     settings.log_tag = SAFE_ACCESS(args, log_tag, nullptr);
   }
 
+  if (FlutterFrameTimingsCallback callback =
+          SAFE_ACCESS(args, frame_timings_callback, nullptr)) {
+    settings.frame_rasterized_callback =
+        [callback, user_data](const flutter::FrameTiming& timing) {
+          auto nanos = [&timing](flutter::FrameTiming::Phase phase) {
+            return static_cast<uint64_t>(
+                timing.Get(phase).ToEpochDelta().ToNanoseconds());
+          };
+          FlutterFrameTimings timings = {};
+          timings.struct_size = sizeof(FlutterFrameTimings);
+          timings.frame_number = timing.GetFrameNumber();
+          timings.vsync_start = nanos(flutter::FrameTiming::kVsyncStart);
+          timings.build_start = nanos(flutter::FrameTiming::kBuildStart);
+          timings.build_finish = nanos(flutter::FrameTiming::kBuildFinish);
+          timings.raster_start = nanos(flutter::FrameTiming::kRasterStart);
+          timings.raster_finish = nanos(flutter::FrameTiming::kRasterFinish);
+          callback(&timings, user_data);
+        };
+  }
+
   bool has_update_semantics_2_callback =
       SAFE_ACCESS(args, update_semantics_callback2, nullptr) != nullptr;
   bool has_update_semantics_callback =
@@ -2262,7 +2612,8 @@ FlutterEngineResult FlutterEngineInitialize(size_t version,
   }
 
   auto external_view_embedder_result = InferExternalViewEmbedderFromArgs(
-      SAFE_ACCESS(args, compositor, nullptr), settings.enable_impeller);
+      SAFE_ACCESS(args, compositor, nullptr), settings.enable_impeller, config,
+      user_data);
   if (!external_view_embedder_result.ok()) {
     FML_LOG(ERROR) << external_view_embedder_result.status().message();
     return LOG_EMBEDDER_ERROR(kInvalidArguments,
@@ -2283,7 +2634,8 @@ FlutterEngineResult FlutterEngineInitialize(size_t version,
   auto on_create_platform_view = InferPlatformViewCreationCallback(
       config, user_data, platform_dispatch_table,
       std::move(external_view_embedder_result.value()),
-      settings.enable_impeller);
+      settings.enable_impeller,
+      settings.impeller_vulkan_bundled_pipeline_caches);
 
   if (!on_create_platform_view) {
     return LOG_EMBEDDER_ERROR(
@@ -2318,9 +2670,36 @@ FlutterEngineResult FlutterEngineInitialize(size_t version,
         }
         return texture;
       };
-      external_texture_resolver =
-          std::make_unique<ExternalTextureResolver>(external_texture_callback);
     }
+
+    // Frames pushed with FlutterEnginePushExternalTextureFrameGL are accepted
+    // with or without the callback.
+    flutter::EmbedderExternalTextureFramesGL::WaitSyncCallback wait_sync;
+    if (std::function<void*(const char*)> gl_proc_resolver =
+            InferOpenGLProcResolver(open_gl_config, user_data)) {
+      // GL_TIMEOUT_IGNORED.
+      static constexpr uint64_t kTimeoutIgnored = 0xFFFFFFFFFFFFFFFFull;
+      using WaitSyncProc =
+          void (*)(void* sync, uint32_t flags, uint64_t timeout);
+      // Like the fence functions, this is resolved on the raster thread when
+      // the first frame with a fence is drawn.
+      wait_sync = [gl_proc_resolver, wait_sync_proc = WaitSyncProc{nullptr}](
+                      void* sync) mutable {
+        if (wait_sync_proc == nullptr) {
+          wait_sync_proc =
+              reinterpret_cast<WaitSyncProc>(gl_proc_resolver("glWaitSync"));
+          if (wait_sync_proc == nullptr) {
+            FML_LOG(ERROR) << "Could not resolve glWaitSync.";
+            return;
+          }
+        }
+        wait_sync_proc(sync, 0, kTimeoutIgnored);
+      };
+    }
+    external_texture_resolver = std::make_unique<ExternalTextureResolver>(
+        external_texture_callback,
+        std::make_shared<flutter::EmbedderExternalTextureFramesGL>(
+            std::move(wait_sync)));
   }
 #endif
 #ifdef SHELL_ENABLE_METAL
@@ -3165,6 +3544,39 @@ FlutterEngineResult FlutterEngineMarkExternalTextureFrameAvailable(
   return kSuccess;
 }
 
+FlutterEngineResult FlutterEnginePushExternalTextureFrameGL(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    int64_t texture_identifier,
+    const FlutterOpenGLTextureFrame* frame) {
+  if (engine == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Invalid engine handle.");
+  }
+  if (texture_identifier == 0) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Invalid texture identifier.");
+  }
+  if (frame == nullptr || !STRUCT_HAS_MEMBER(frame, texture)) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Invalid frame.");
+  }
+  void* sync = nullptr;
+  if (const FlutterRenderFence* fence = SAFE_ACCESS(frame, fence, nullptr)) {
+    if (SAFE_ACCESS(fence, type, kFlutterRenderFenceTypeVulkan) !=
+            kFlutterRenderFenceTypeOpenGL ||
+        fence->open_gl_sync == nullptr) {
+      return LOG_EMBEDDER_ERROR(kInvalidArguments,
+                                "The frame fence must be an OpenGL sync.");
+    }
+    sync = fence->open_gl_sync;
+  }
+  if (!reinterpret_cast<flutter::EmbedderEngine*>(engine)->PushTextureFrameGL(
+          texture_identifier, frame->texture, sync)) {
+    return LOG_EMBEDDER_ERROR(
+        kInternalInconsistency,
+        "Could not push the texture frame. Frames can only be pushed to "
+        "engines with an OpenGL renderer.");
+  }
+  return kSuccess;
+}
+
 FlutterEngineResult FlutterEngineUpdateSemanticsEnabled(
     FLUTTER_API_SYMBOL(FlutterEngine) engine,
     bool enabled) {
@@ -3693,6 +4105,44 @@ FlutterEngineResult FlutterEngineSetNextFrameCallback(
   return kSuccess;
 }
 
+FlutterEngineResult FlutterEngineGetFrameTimingSummary(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterFrameTimingSummary* summary) {
+  if (engine == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Invalid engine handle.");
+  }
+
+  if (summary == nullptr ||
+      summary->struct_size < sizeof(FlutterFrameTimingSummary)) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments,
+                              "Invalid frame timing summary specified.");
+  }
+
+  flutter::FrameTimingHistory::Summary history =
+      reinterpret_cast<flutter::EmbedderEngine*>(engine)
+          ->GetShell()
+          .GetFrameTimingSummary();
+
+  auto convert = [&history](flutter::FrameTimingHistory::Phase phase) {
+    const flutter::FrameTimingHistory::Percentiles& percentiles =
+        history.Get(phase);
+    return FlutterFramePhasePercentiles{
+        .p50 = static_cast<uint64_t>(percentiles.p50.ToMicroseconds()),
+        .p90 = static_cast<uint64_t>(percentiles.p90.ToMicroseconds()),
+        .p99 = static_cast<uint64_t>(percentiles.p99.ToMicroseconds()),
+    };
+  };
+
+  using Phase = flutter::FrameTimingHistory::Phase;
+  summary->frame_count = history.frame_count;
+  summary->vsync = convert(Phase::kVsync);
+  summary->build = convert(Phase::kBuild);
+  summary->raster_wait = convert(Phase::kRasterWait);
+  summary->raster = convert(Phase::kRaster);
+  summary->total = convert(Phase::kTotal);
+  return kSuccess;
+}
+
 FlutterEngineResult FlutterEngineGetProcAddresses(
     FlutterEngineProcTable* table) {
   if (!table) {
@@ -3749,6 +4199,9 @@ FlutterEngineResult FlutterEngineGetProcAddresses(
   SET_PROC(AddView, FlutterEngineAddView);
   SET_PROC(RemoveView, FlutterEngineRemoveView);
   SET_PROC(SendViewFocusEvent, FlutterEngineSendViewFocusEvent);
+  SET_PROC(GetFrameTimingSummary, FlutterEngineGetFrameTimingSummary);
+  SET_PROC(PushExternalTextureFrameGL,
+           FlutterEnginePushExternalTextureFrameGL);
 #undef SET_PROC
 
   return kSuccess;
@@ -794,6 +794,14 @@ typedef struct {
   /// ID. Not specifying populate_existing_damage will result in full
   /// repaint (i.e. rendering all the pixels on the screen at every frame).
   FlutterFrameBufferWithDamageCallback populate_existing_damage;
+  /// The maximum number of rectangles the embedder accepts in the
+  /// `frame_damage` of the `FlutterPresentInfo` passed to
+  /// `present_with_info`. When this is zero or one, the frame damage is
+  /// always a single rectangle bounding all the changes in the frame. Larger
+  /// values allow separate changes, such as a blinking cursor and a clock in
+  /// opposite corners of the screen, to be reported without the unchanged
+  /// area between them. The buffer damage is always a single rectangle.
+  size_t max_frame_damage_rects;
 } FlutterOpenGLRendererConfig;
 
 /// Alias for id<MTLDevice>.
@@ -923,6 +931,9 @@ typedef void* FlutterVulkanQueueHandle;
 /// Alias for VkImage.
 typedef uint64_t FlutterVulkanImageHandle;
 
+/// Alias for VkSemaphore.
+typedef uint64_t FlutterVulkanSemaphoreHandle;
+
 typedef struct {
   /// The size of this struct. Must be sizeof(FlutterVulkanImage).
   size_t struct_size;
@@ -1843,6 +1854,30 @@ typedef void (*FlutterViewFocusChangeRequestCallback)(
     const FlutterViewFocusChangeRequest* /* request */,
     void* /* user data */);
 
+/// The timings of one frame rasterized by the engine. All timestamps are in
+/// nanoseconds, on the clock of `FlutterEngineGetCurrentTime`.
+typedef struct {
+  /// The size of this struct. Must be sizeof(FlutterFrameTimings).
+  size_t struct_size;
+  /// The number of the frame, as also reported to the framework.
+  uint64_t frame_number;
+  /// When the vsync signal the frame was produced for was received.
+  uint64_t vsync_start;
+  /// When the UI thread started building the frame.
+  uint64_t build_start;
+  /// When the UI thread finished building the frame.
+  uint64_t build_finish;
+  /// When the raster thread started rasterizing the frame.
+  uint64_t raster_start;
+  /// When the raster thread finished rasterizing the frame. The GPU work may
+  /// still be in flight.
+  uint64_t raster_finish;
+} FlutterFrameTimings;
+
+typedef void (*FlutterFrameTimingsCallback)(
+    const FlutterFrameTimings* /* timings */,
+    void* /* user data */);
+
 typedef struct _FlutterTaskRunner* FlutterTaskRunner;
 
 typedef struct {
@@ -1908,6 +1943,31 @@ typedef struct {
   const FlutterTaskRunnerDescription* ui_task_runner;
 } FlutterCustomTaskRunners;
 
+/// Runs a task handed to the embedder by a `FlutterWorkerPoolPostTaskCallback`.
+typedef void (*FlutterWorkerTaskCallback)(void* /* task */);
+
+/// Called by the engine from any thread to run `task` on a thread of the
+/// worker pool of the embedder. The embedder must call `callback` with `task`
+/// exactly once, on any thread, and may do so before returning.
+typedef void (*FlutterWorkerPoolPostTaskCallback)(
+    FlutterWorkerTaskCallback /* callback */,
+    void* /* task */,
+    void* /* user data */);
+
+/// A worker pool of the embedder, such as the job system of a game engine, on
+/// which the engine runs its background work, for example image decoding.
+/// Without one, the engine creates worker threads of its own.
+typedef struct {
+  /// The size of this struct. Must be sizeof(FlutterWorkerPool).
+  size_t struct_size;
+  void* user_data;
+  /// The number of tasks the pool may run in parallel. The engine splits up
+  /// parallel work into this many parts. Must be at least 1.
+  size_t worker_count;
+  /// @attention     This field is required.
+  FlutterWorkerPoolPostTaskCallback post_task_callback;
+} FlutterWorkerPool;
+
 typedef struct {
   /// The type of the OpenGL backing store. Currently, it can either be a
   /// texture or a framebuffer.
@@ -1984,6 +2044,10 @@ typedef struct {
   /// sync for all layers prior to calling the compositor present callback, and
   /// so the written layer images can be freely bound by the embedder without
   /// any additional synchronization.
+  ///
+  /// When rendering with Impeller, the image is left in
+  /// VK_IMAGE_LAYOUT_GENERAL and must have been created with at least the
+  /// VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT and VK_IMAGE_USAGE_SAMPLED_BIT usages.
   const FlutterVulkanImage* image;
   /// A baton that is not interpreted by the engine in any way. It will be given
   /// back to the embedder in the destruction callback below. Embedder resources
@@ -2155,6 +2219,37 @@ typedef struct {
   uint64_t presentation_time;
 } FlutterLayer;
 
+typedef enum {
+  /// A `GLsync` created with `glFenceSync` on the OpenGL context the engine
+  /// renders with.
+  kFlutterRenderFenceTypeOpenGL,
+  /// A binary `VkSemaphore` signaled on the queue of the
+  /// `FlutterVulkanRendererConfig`.
+  kFlutterRenderFenceTypeVulkan,
+} FlutterRenderFenceType;
+
+/// A fence that is signaled once the GPU has finished rendering the layers
+/// being presented. Waiting on the fence on the GPU lets the embedder composite
+/// the layers without first waiting for the rendering on the CPU.
+///
+/// The embedder owns the fence once it is passed to the present callback.
+typedef struct {
+  /// The size of this struct. Must be sizeof(FlutterRenderFence).
+  size_t struct_size;
+  /// The type of the fence.
+  FlutterRenderFenceType type;
+  union {
+    /// The `GLsync`. It may be waited on with `glWaitSync` in a context that
+    /// shares objects with the context of the engine, and must be deleted with
+    /// `glDeleteSync`.
+    void* open_gl_sync;
+    /// The semaphore. It must be waited on once, for example by the queue
+    /// submission that composites the layers, and destroyed with
+    /// `vkDestroySemaphore` once that wait has completed.
+    FlutterVulkanSemaphoreHandle vulkan_semaphore;
+  };
+} FlutterRenderFence;
+
 typedef struct {
   /// The size of this struct.
   /// Must be sizeof(FlutterPresentViewInfo).
@@ -2171,6 +2266,12 @@ typedef struct {
 
   /// The |FlutterCompositor.user_data|.
   void* user_data;
+
+  /// The fence signaled once the layers have been rendered, if
+  /// `FlutterCompositor.create_render_fences` is set and a fence could be
+  /// created. If this is null, the embedder must make sure that rendering has
+  /// completed before using the layers, for example with `glFinish`.
+  const FlutterRenderFence* render_fence;
 } FlutterPresentViewInfo;
 
 typedef bool (*FlutterBackingStoreCreateCallback)(
@@ -2248,6 +2349,11 @@ typedef struct {
   ///
   /// The callback should return true if the operation was successful.
   FlutterPresentViewCallback present_view_callback;
+  /// Whether the engine passes a `FlutterRenderFence` to
+  /// `present_view_callback` instead of leaving it to the embedder to wait for
+  /// the rendering of the layers to complete. Fences are available with the
+  /// OpenGL and Vulkan renderers.
+  bool create_render_fences;
 } FlutterCompositor;
 
 typedef struct {
@@ -2763,6 +2869,23 @@ typedef struct {
   /// `PlatformDispatcher.instance.engineId`. Can be used in native code to
   /// retrieve the engine instance that is running the Dart code.
   int64_t engine_id;
+
+  /// The worker pool of the embedder on which the engine runs its background
+  /// tasks, or null for the engine to create its own worker threads.
+  ///
+  /// The workers are shared by all engines in the process, so only the pool
+  /// of the engine that launches the Dart VM is used. The pool must remain
+  /// valid until the Dart VM shuts down, which only happens before the
+  /// process exits if `shutdown_dart_vm_when_done` is set.
+  /// `FlutterEnginePostCallbackOnAllNativeThreads` does not run callbacks on
+  /// the threads of the pool.
+  const FlutterWorkerPool* worker_pool;
+
+  /// The callback invoked by the engine with the timings of every frame it
+  /// rasterized, without involving the Dart isolate. The callback is invoked
+  /// on the raster thread right after the frame was rasterized, so it must
+  /// return quickly. The timings are only valid for the duration of the call.
+  FlutterFrameTimingsCallback frame_timings_callback;
 } FlutterProjectArgs;
 
 typedef struct {
@@ -2786,6 +2909,52 @@ typedef struct {
   size_t data_length;
 } FlutterSendSemanticsActionInfo;
 
+/// Percentiles of the duration of one phase of the rasterized frames, in
+/// microseconds.
+typedef struct {
+  uint64_t p50;
+  uint64_t p90;
+  uint64_t p99;
+} FlutterFramePhasePercentiles;
+
+/// A summary of the most recently rasterized frames, filled by
+/// `FlutterEngineGetFrameTimingSummary`.
+typedef struct {
+  /// The size of this struct. Must be sizeof(FlutterFrameTimingSummary).
+  size_t struct_size;
+  /// The number of frames the percentiles were computed over. All percentiles
+  /// are zero if no frame has been rasterized yet.
+  size_t frame_count;
+  /// From the vsync signal until the UI thread started building the frame.
+  FlutterFramePhasePercentiles vsync;
+  /// From the start until the end of the frame building on the UI thread.
+  FlutterFramePhasePercentiles build;
+  /// From the end of the frame building until the raster thread picked up the
+  /// frame.
+  FlutterFramePhasePercentiles raster_wait;
+  /// From the start until the end of the rasterization of the frame.
+  FlutterFramePhasePercentiles raster;
+  /// From the vsync signal until the end of the rasterization.
+  FlutterFramePhasePercentiles total;
+} FlutterFrameTimingSummary;
+
+/// A frame of an external texture, pushed to the engine with
+/// `FlutterEnginePushExternalTextureFrameGL`.
+typedef struct {
+  /// The size of this struct. Must be sizeof(FlutterOpenGLTextureFrame).
+  size_t struct_size;
+  /// The texture of the frame. The engine calls its destruction callback once
+  /// the frame is no longer used, or right away if the frame is replaced by a
+  /// newer one before it was drawn.
+  FlutterOpenGLTexture texture;
+  /// An optional fence of type `kFlutterRenderFenceTypeOpenGL` that is
+  /// signaled once the producer has finished rendering the texture. The engine
+  /// waits on it on the GPU before sampling the texture. The fence stays owned
+  /// by the embedder, which may delete it once the destruction callback of the
+  /// texture was called.
+  const FlutterRenderFence* fence;
+} FlutterOpenGLTextureFrame;
+
 #ifndef FLUTTER_ENGINE_NO_PROTOTYPES
 
 // NOLINTBEGIN(google-objc-function-naming)
@@ -3503,6 +3672,9 @@ FlutterEngineResult FlutterEngineNotifyLowMemoryWarning(
 /// @attention  In case there are multiple running Flutter engine instances,
 ///             their workers are shared.
 ///
+/// @attention  The threads of a `FlutterWorkerPool` are owned by the embedder
+///             and are not called back.
+///
 /// @param[in]  engine     A running engine instance.
 /// @param[in]  callback   The callback that will get called multiple times on
 ///                        each engine managed thread.
@@ -3565,6 +3737,54 @@ FlutterEngineResult FlutterEngineSetNextFrameCallback(
     VoidCallback callback,
     void* user_data);
 
+//------------------------------------------------------------------------------
+/// @brief      Summarizes the phases of the most recently rasterized frames
+///             as percentiles. The engine keeps the history on the raster
+///             thread, so unlike the timings reported to the framework, this
+///             does not perturb the UI thread. May be called from any thread.
+///
+/// @param[in]  engine   A running engine instance.
+/// @param[out] summary  The summary to fill. Its struct_size must be set.
+///
+/// @return     The result of the call.
+///
+FLUTTER_EXPORT
+FlutterEngineResult FlutterEngineGetFrameTimingSummary(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterFrameTimingSummary* summary);
+
+//------------------------------------------------------------------------------
+/// @brief      Push a new frame for a registered external texture of an
+///             OpenGL renderer. Unlike
+///             `FlutterEngineMarkExternalTextureFrameAvailable`, the engine
+///             does not call `gl_external_texture_frame_callback` for the
+///             texture. The raster thread samples the most recently pushed
+///             frame, so it never waits for the embedder to produce one.
+///
+///             The engine holds on to at most two frames of a texture: the
+///             one being drawn and the most recently pushed one. A producer
+///             rendering into a third texture never has to wait for the
+///             engine. A pushed frame that is replaced before it was drawn is
+///             released on the thread that pushed the replacing frame.
+///
+///             May be called from any thread. Frames must not be pushed for a
+///             texture once it is unregistered.
+///
+/// @see        FlutterEngineRegisterExternalTexture()
+/// @see        FlutterEngineUnregisterExternalTexture()
+///
+/// @param[in]  engine              A running engine instance.
+/// @param[in]  texture_identifier  The identifier of the texture.
+/// @param[in]  frame               The frame to display next.
+///
+/// @return     The result of the call.
+///
+FLUTTER_EXPORT
+FlutterEngineResult FlutterEnginePushExternalTextureFrameGL(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    int64_t texture_identifier,
+    const FlutterOpenGLTextureFrame* frame);
+
 #endif  // !FLUTTER_ENGINE_NO_PROTOTYPES
 
 // Typedefs for the function pointers in FlutterEngineProcTable.
@@ -3699,6 +3919,13 @@ typedef FlutterEngineResult (*FlutterEngineRemoveViewFnPtr)(
 typedef FlutterEngineResult (*FlutterEngineSendViewFocusEventFnPtr)(
     FLUTTER_API_SYMBOL(FlutterEngine) engine,
     const FlutterViewFocusEvent* event);
+typedef FlutterEngineResult (*FlutterEngineGetFrameTimingSummaryFnPtr)(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterFrameTimingSummary* summary);
+typedef FlutterEngineResult (*FlutterEnginePushExternalTextureFrameGLFnPtr)(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    int64_t texture_identifier,
+    const FlutterOpenGLTextureFrame* frame);
 
 /// Function-pointer-based versions of the APIs above.
 typedef struct {
@@ -3749,6 +3976,8 @@ typedef struct {
   FlutterEngineRemoveViewFnPtr RemoveView;
   FlutterEngineSendViewFocusEventFnPtr SendViewFocusEvent;
   FlutterEngineSendSemanticsActionFnPtr SendSemanticsAction;
+  FlutterEngineGetFrameTimingSummaryFnPtr GetFrameTimingSummary;
+  FlutterEnginePushExternalTextureFrameGLFnPtr PushExternalTextureFrameGL;
 } FlutterEngineProcTable;
 
 //------------------------------------------------------------------------------
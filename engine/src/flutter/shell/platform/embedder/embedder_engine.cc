@@ -210,6 +210,20 @@ bool EmbedderEngine::MarkTextureFrameAvailable(int64_t texture) {
   return true;
 }
 
+bool EmbedderEngine::PushTextureFrameGL(int64_t texture,
+                                        const FlutterOpenGLTexture& frame,
+                                        void* sync) {
+  if (!IsValid()) {
+    return false;
+  }
+  if (!external_texture_resolver_->PushFrameGL(texture, frame, sync)) {
+    return false;
+  }
+  // Schedules a frame. The texture picks up the pushed frame when painted.
+  shell_->GetPlatformView()->MarkTextureFrameAvailable(texture);
+  return true;
+}
+
 bool EmbedderEngine::SetSemanticsEnabled(bool enabled) {
   if (!IsValid()) {
     return false;
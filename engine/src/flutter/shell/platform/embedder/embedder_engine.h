@@ -64,6 +64,10 @@ class EmbedderEngine {
 
   bool MarkTextureFrameAvailable(int64_t texture);
 
+  bool PushTextureFrameGL(int64_t texture,
+                          const FlutterOpenGLTexture& frame,
+                          void* sync);
+
   bool SetSemanticsEnabled(bool enabled);
 
   bool SetAccessibilityFeatures(int32_t flags);
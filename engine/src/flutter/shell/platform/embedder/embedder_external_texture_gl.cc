@@ -4,6 +4,8 @@
 
 #include "flutter/shell/platform/embedder/embedder_external_texture_gl.h"
 
+#include <utility>
+
 #include "flutter/fml/logging.h"
 #include "impeller/core/texture_descriptor.h"
 #include "impeller/display_list/aiks_context.h"
@@ -11,6 +13,8 @@
 #include "impeller/geometry/size.h"
 #include "impeller/renderer/backend/gles/context_gles.h"
 #include "impeller/renderer/backend/gles/handle_gles.h"
+#include "impeller/renderer/backend/gles/proc_table_gles.h"
+#include "impeller/renderer/backend/gles/reactor_gles.h"
 #include "impeller/renderer/backend/gles/texture_gles.h"
 
 #include "include/core/SkPaint.h"
@@ -27,11 +31,75 @@
 
 namespace flutter {
 
+namespace {
+
+void ReleaseTexture(const FlutterOpenGLTexture& texture) {
+  if (texture.destruction_callback) {
+    texture.destruction_callback(texture.user_data);
+  }
+}
+
+}  // namespace
+
+EmbedderExternalTextureFramesGL::EmbedderExternalTextureFramesGL(
+    WaitSyncCallback wait_sync)
+    : wait_sync_(std::move(wait_sync)) {}
+
+EmbedderExternalTextureFramesGL::~EmbedderExternalTextureFramesGL() {
+  for (const auto& [texture_id, frame] : pending_frames_) {
+    ReleaseTexture(frame.texture);
+  }
+}
+
+void EmbedderExternalTextureFramesGL::Push(int64_t texture_id,
+                                           const Frame& frame) {
+  std::optional<Frame> replaced;
+  {
+    std::scoped_lock lock(mutex_);
+    auto [it, inserted] = pending_frames_.try_emplace(texture_id, frame);
+    if (!inserted) {
+      replaced = it->second;
+      it->second = frame;
+    }
+  }
+  // The embedder may push the next frame from the callback.
+  if (replaced.has_value()) {
+    ReleaseTexture(replaced->texture);
+  }
+}
+
+std::optional<EmbedderExternalTextureFramesGL::Frame>
+EmbedderExternalTextureFramesGL::Take(int64_t texture_id) {
+  std::scoped_lock lock(mutex_);
+  auto found = pending_frames_.find(texture_id);
+  if (found == pending_frames_.end()) {
+    return std::nullopt;
+  }
+  Frame frame = found->second;
+  pending_frames_.erase(found);
+  return frame;
+}
+
+void EmbedderExternalTextureFramesGL::Remove(int64_t texture_id) {
+  std::optional<Frame> frame = Take(texture_id);
+  if (frame.has_value()) {
+    ReleaseTexture(frame->texture);
+  }
+}
+
+const EmbedderExternalTextureFramesGL::WaitSyncCallback&
+EmbedderExternalTextureFramesGL::GetWaitSyncCallback() const {
+  return wait_sync_;
+}
+
 EmbedderExternalTextureGL::EmbedderExternalTextureGL(
     int64_t texture_identifier,
-    const ExternalTextureCallback& callback)
-    : Texture(texture_identifier), external_texture_callback_(callback) {
-  FML_DCHECK(external_texture_callback_);
+    const ExternalTextureCallback& callback,
+    std::shared_ptr<EmbedderExternalTextureFramesGL> frames)
+    : Texture(texture_identifier),
+      external_texture_callback_(callback),
+      frames_(std::move(frames)) {
+  FML_DCHECK(external_texture_callback_ || frames_);
 }
 
 EmbedderExternalTextureGL::~EmbedderExternalTextureGL() = default;
@@ -41,7 +109,20 @@ void EmbedderExternalTextureGL::Paint(PaintContext& context,
                                       const DlRect& bounds,
                                       bool freeze,
                                       const DlImageSampling sampling) {
-  if (last_image_ == nullptr) {
+  std::optional<EmbedderExternalTextureFramesGL::Frame> frame;
+  if (frames_ && !freeze) {
+    frame = frames_->Take(Id());
+  }
+  if (frame.has_value()) {
+    uses_pushed_frames_ = true;
+    last_image_ = ResolvePushedFrame(
+        frame.value(),                                        //
+        context.gr_context,                                   //
+        context.aiks_context,                                 //
+        SkISize::Make(bounds.GetWidth(), bounds.GetHeight())  //
+    );
+  } else if (last_image_ == nullptr && !uses_pushed_frames_ &&
+             external_texture_callback_) {
     last_image_ =
         ResolveTexture(Id(),                                                 //
                        context.gr_context,                                   //
@@ -69,39 +150,79 @@ sk_sp<DlImage> EmbedderExternalTextureGL::ResolveTexture(
     impeller::AiksContext* aiks_context,
     const SkISize& size) {
   if (!!aiks_context) {
-    return ResolveTextureImpeller(texture_id, aiks_context, size);
+    std::unique_ptr<FlutterOpenGLTexture> texture =
+        external_texture_callback_(texture_id, size.width(), size.height());
+    if (!texture) {
+      return nullptr;
+    }
+    return WrapTextureImpeller(*texture, aiks_context);
   } else {
-    return ResolveTextureSkia(texture_id, context, size);
+    context->flushAndSubmit();
+    context->resetContext(kAll_GrBackendState);
+    std::unique_ptr<FlutterOpenGLTexture> texture =
+        external_texture_callback_(texture_id, size.width(), size.height());
+    if (!texture) {
+      return nullptr;
+    }
+    return WrapTextureSkia(*texture, context, size);
   }
 }
 
-sk_sp<DlImage> EmbedderExternalTextureGL::ResolveTextureSkia(
-    int64_t texture_id,
+sk_sp<DlImage> EmbedderExternalTextureGL::ResolvePushedFrame(
+    const EmbedderExternalTextureFramesGL::Frame& frame,
     GrDirectContext* context,
+    impeller::AiksContext* aiks_context,
     const SkISize& size) {
-  context->flushAndSubmit();
-  context->resetContext(kAll_GrBackendState);
-  std::unique_ptr<FlutterOpenGLTexture> texture =
-      external_texture_callback_(texture_id, size.width(), size.height());
-
-  if (!texture) {
-    return nullptr;
+  // The wait is queued on the GPU ahead of the commands that sample the
+  // texture, so the raster thread doesn't block on the producer.
+  if (!!aiks_context) {
+    if (frame.sync) {
+      impeller::ContextGLES& gles_context =
+          impeller::ContextGLES::Cast(*aiks_context->GetContext());
+      if (!gles_context.GetReactor()->AddOperation(
+              [sync = frame.sync](const impeller::ReactorGLES& reactor) {
+                const impeller::ProcTableGLES& gl = reactor.GetProcTable();
+                if (gl.WaitSync.IsAvailable()) {
+                  gl.WaitSync(static_cast<GLsync>(sync), 0,
+                              GL_TIMEOUT_IGNORED);
+                }
+              })) {
+        FML_LOG(ERROR) << "Could not wait on the external texture frame.";
+      }
+    }
+    return WrapTextureImpeller(frame.texture, aiks_context);
+  } else {
+    if (frame.sync) {
+      const EmbedderExternalTextureFramesGL::WaitSyncCallback& wait_sync =
+          frames_->GetWaitSyncCallback();
+      if (wait_sync) {
+        wait_sync(frame.sync);
+      } else {
+        FML_LOG(ERROR) << "Could not wait on the external texture frame.";
+      }
+    }
+    return WrapTextureSkia(frame.texture, context, size);
   }
+}
 
-  GrGLTextureInfo gr_texture_info = {texture->target, texture->name,
-                                     texture->format};
+sk_sp<DlImage> EmbedderExternalTextureGL::WrapTextureSkia(
+    const FlutterOpenGLTexture& texture,
+    GrDirectContext* context,
+    const SkISize& size) {
+  GrGLTextureInfo gr_texture_info = {texture.target, texture.name,
+                                     texture.format};
 
   size_t width = size.width();
   size_t height = size.height();
 
-  if (texture->width != 0 && texture->height != 0) {
-    width = texture->width;
-    height = texture->height;
+  if (texture.width != 0 && texture.height != 0) {
+    width = texture.width;
+    height = texture.height;
   }
 
   auto gr_backend_texture = GrBackendTextures::MakeGL(
       width, height, skgpu::Mipmapped::kNo, gr_texture_info);
-  SkImages::TextureReleaseProc release_proc = texture->destruction_callback;
+  SkImages::TextureReleaseProc release_proc = texture.destruction_callback;
   auto image =
       SkImages::BorrowTextureFrom(context,                   // context
                                   gr_backend_texture,        // texture handle
@@ -109,15 +230,15 @@ sk_sp<DlImage> EmbedderExternalTextureGL::ResolveTextureSkia(
                                   kRGBA_8888_SkColorType,    // color type
                                   kPremul_SkAlphaType,       // alpha type
                                   nullptr,                   // colorspace
-                                  release_proc,       // texture release proc
-                                  texture->user_data  // texture release context
+                                  release_proc,      // texture release proc
+                                  texture.user_data  // texture release context
       );
 
   if (!image) {
     // In case Skia rejects the image, call the release proc so that
     // embedders can perform collection of intermediates.
     if (release_proc) {
-      release_proc(texture->user_data);
+      release_proc(texture.user_data);
     }
     FML_LOG(ERROR) << "Could not create external texture->";
     return nullptr;
@@ -127,41 +248,33 @@ sk_sp<DlImage> EmbedderExternalTextureGL::ResolveTextureSkia(
   return DlImage::Make(std::move(image));
 }
 
-sk_sp<DlImage> EmbedderExternalTextureGL::ResolveTextureImpeller(
-    int64_t texture_id,
-    impeller::AiksContext* aiks_context,
-    const SkISize& size) {
-  std::unique_ptr<FlutterOpenGLTexture> texture =
-      external_texture_callback_(texture_id, size.width(), size.height());
-
-  if (!texture) {
-    return nullptr;
-  }
-
+sk_sp<DlImage> EmbedderExternalTextureGL::WrapTextureImpeller(
+    const FlutterOpenGLTexture& texture,
+    impeller::AiksContext* aiks_context) {
   impeller::TextureDescriptor desc;
-  desc.size = impeller::ISize(texture->width, texture->height);
+  desc.size = impeller::ISize(texture.width, texture.height);
 
   impeller::ContextGLES& context =
       impeller::ContextGLES::Cast(*aiks_context->GetContext());
   impeller::HandleGLES handle = context.GetReactor()->CreateHandle(
-      impeller::HandleType::kTexture, texture->target);
+      impeller::HandleType::kTexture, texture.target);
   std::shared_ptr<impeller::TextureGLES> image =
       impeller::TextureGLES::WrapTexture(context.GetReactor(), desc, handle);
 
   if (!image) {
     // In case Skia rejects the image, call the release proc so that
     // embedders can perform collection of intermediates.
-    if (texture->destruction_callback) {
-      texture->destruction_callback(texture->user_data);
+    if (texture.destruction_callback) {
+      texture.destruction_callback(texture.user_data);
     }
     FML_LOG(ERROR) << "Could not create external texture";
     return nullptr;
   }
-  if (texture->destruction_callback &&
+  if (texture.destruction_callback &&
       !context.GetReactor()->RegisterCleanupCallback(
           handle,
-          [callback = texture->destruction_callback,
-           user_data = texture->user_data]() { callback(user_data); })) {
+          [callback = texture.destruction_callback,
+           user_data = texture.user_data]() { callback(user_data); })) {
     FML_LOG(ERROR) << "Could not register destruction callback";
     return nullptr;
   }
@@ -177,10 +290,18 @@ void EmbedderExternalTextureGL::OnGrContextDestroyed() {}
 
 // |flutter::Texture|
 void EmbedderExternalTextureGL::MarkNewFrameAvailable() {
-  last_image_ = nullptr;
+  // Pushed frames are taken when painting, keep showing the current one
+  // until then.
+  if (!uses_pushed_frames_) {
+    last_image_ = nullptr;
+  }
 }
 
 // |flutter::Texture|
-void EmbedderExternalTextureGL::OnTextureUnregistered() {}
+void EmbedderExternalTextureGL::OnTextureUnregistered() {
+  if (frames_) {
+    frames_->Remove(Id());
+  }
+}
 
 }  // namespace flutter
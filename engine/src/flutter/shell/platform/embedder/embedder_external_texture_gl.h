@@ -5,6 +5,12 @@
 #ifndef FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_EXTERNAL_TEXTURE_GL_H_
 #define FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_EXTERNAL_TEXTURE_GL_H_
 
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
 #include "flutter/common/graphics/texture.h"
 #include "flutter/fml/macros.h"
 #include "flutter/shell/platform/embedder/embedder.h"
@@ -12,32 +18,90 @@
 
 namespace flutter {
 
+//------------------------------------------------------------------------------
+/// The frames pushed with |FlutterEnginePushExternalTextureFrameGL| that the
+/// external textures of an engine have yet to draw. Frames may be pushed on
+/// any thread and are taken by the textures on the raster thread. Only the
+/// most recent frame of each texture is kept.
+///
+class EmbedderExternalTextureFramesGL {
+ public:
+  struct Frame {
+    FlutterOpenGLTexture texture = {};
+    /// The |GLsync| to wait on before sampling the texture, if any.
+    void* sync = nullptr;
+  };
+
+  /// Makes the GPU wait on a |GLsync| before executing further commands of
+  /// the raster thread's context. Used by the Skia backend, Impeller waits
+  /// on the sync itself.
+  using WaitSyncCallback = std::function<void(void* sync)>;
+
+  explicit EmbedderExternalTextureFramesGL(WaitSyncCallback wait_sync);
+
+  /// Releases the frames that were never taken.
+  ~EmbedderExternalTextureFramesGL();
+
+  /// Make the frame the next one to be drawn by the texture. A frame pushed
+  /// earlier that was not taken yet is released on the calling thread.
+  void Push(int64_t texture_id, const Frame& frame);
+
+  /// Take the most recently pushed frame of the texture, if there is a new
+  /// one since the last call.
+  std::optional<Frame> Take(int64_t texture_id);
+
+  /// Release the frame of a texture that is unregistered.
+  void Remove(int64_t texture_id);
+
+  const WaitSyncCallback& GetWaitSyncCallback() const;
+
+ private:
+  const WaitSyncCallback wait_sync_;
+  std::mutex mutex_;
+  std::unordered_map<int64_t, Frame> pending_frames_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(EmbedderExternalTextureFramesGL);
+};
+
 class EmbedderExternalTextureGL : public flutter::Texture {
  public:
   using ExternalTextureCallback = std::function<
       std::unique_ptr<FlutterOpenGLTexture>(int64_t, size_t, size_t)>;
 
-  EmbedderExternalTextureGL(int64_t texture_identifier,
-                            const ExternalTextureCallback& callback);
+  /// The callback may be empty if the embedder only pushes frames. The
+  /// frames may be null if the embedder never does.
+  EmbedderExternalTextureGL(
+      int64_t texture_identifier,
+      const ExternalTextureCallback& callback,
+      std::shared_ptr<EmbedderExternalTextureFramesGL> frames = nullptr);
 
   ~EmbedderExternalTextureGL();
 
  private:
   const ExternalTextureCallback& external_texture_callback_;
+  const std::shared_ptr<EmbedderExternalTextureFramesGL> frames_;
   sk_sp<DlImage> last_image_;
+  // Set once a pushed frame was drawn. From then on the texture only shows
+  // pushed frames and never calls back into the embedder.
+  bool uses_pushed_frames_ = false;
 
   sk_sp<DlImage> ResolveTexture(int64_t texture_id,
                                 GrDirectContext* context,
                                 impeller::AiksContext* aiks_context,
                                 const SkISize& size);
 
-  sk_sp<DlImage> ResolveTextureSkia(int64_t texture_id,
-                                    GrDirectContext* context,
-                                    const SkISize& size);
+  sk_sp<DlImage> ResolvePushedFrame(
+      const EmbedderExternalTextureFramesGL::Frame& frame,
+      GrDirectContext* context,
+      impeller::AiksContext* aiks_context,
+      const SkISize& size);
+
+  sk_sp<DlImage> WrapTextureSkia(const FlutterOpenGLTexture& texture,
+                                 GrDirectContext* context,
+                                 const SkISize& size);
 
-  sk_sp<DlImage> ResolveTextureImpeller(int64_t texture_id,
-                                        impeller::AiksContext* aiks_context,
-                                        const SkISize& size);
+  sk_sp<DlImage> WrapTextureImpeller(const FlutterOpenGLTexture& texture,
+                                     impeller::AiksContext* aiks_context);
 
   // |flutter::Texture|
   void Paint(PaintContext& context,
@@ -11,8 +11,9 @@ namespace flutter {
 
 #ifdef SHELL_ENABLE_GL
 EmbedderExternalTextureResolver::EmbedderExternalTextureResolver(
-    EmbedderExternalTextureGL::ExternalTextureCallback gl_callback)
-    : gl_callback_(std::move(gl_callback)) {}
+    EmbedderExternalTextureGL::ExternalTextureCallback gl_callback,
+    std::shared_ptr<EmbedderExternalTextureFramesGL> gl_frames)
+    : gl_callback_(std::move(gl_callback)), gl_frames_(std::move(gl_frames)) {}
 #endif
 
 #ifdef SHELL_ENABLE_METAL
@@ -24,9 +25,9 @@ EmbedderExternalTextureResolver::EmbedderExternalTextureResolver(
 std::unique_ptr<Texture>
 EmbedderExternalTextureResolver::ResolveExternalTexture(int64_t texture_id) {
 #ifdef SHELL_ENABLE_GL
-  if (gl_callback_) {
-    return std::make_unique<EmbedderExternalTextureGL>(texture_id,
-                                                       gl_callback_);
+  if (gl_callback_ || gl_frames_) {
+    return std::make_unique<EmbedderExternalTextureGL>(texture_id, gl_callback_,
+                                                       gl_frames_);
   }
 #endif
 
@@ -42,7 +43,7 @@ EmbedderExternalTextureResolver::ResolveExternalTexture(int64_t texture_id) {
 
 bool EmbedderExternalTextureResolver::SupportsExternalTextures() {
 #ifdef SHELL_ENABLE_GL
-  if (gl_callback_) {
+  if (gl_callback_ || gl_frames_) {
     return true;
   }
 #endif
@@ -56,4 +57,18 @@ bool EmbedderExternalTextureResolver::SupportsExternalTextures() {
   return false;
 }
 
+bool EmbedderExternalTextureResolver::PushFrameGL(
+    int64_t texture_id,
+    const FlutterOpenGLTexture& texture,
+    void* sync) {
+#ifdef SHELL_ENABLE_GL
+  if (gl_frames_) {
+    gl_frames_->Push(texture_id, {.texture = texture, .sync = sync});
+    return true;
+  }
+#endif
+
+  return false;
+}
+
 }  // namespace flutter
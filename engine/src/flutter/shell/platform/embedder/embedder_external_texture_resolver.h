@@ -8,6 +8,7 @@
 #include <memory>
 
 #include "flutter/common/graphics/texture.h"
+#include "flutter/shell/platform/embedder/embedder.h"
 
 #ifdef SHELL_ENABLE_GL
 #include "flutter/shell/platform/embedder/embedder_external_texture_gl.h"
@@ -26,7 +27,8 @@ class EmbedderExternalTextureResolver {
 
 #ifdef SHELL_ENABLE_GL
   explicit EmbedderExternalTextureResolver(
-      EmbedderExternalTextureGL::ExternalTextureCallback gl_callback);
+      EmbedderExternalTextureGL::ExternalTextureCallback gl_callback,
+      std::shared_ptr<EmbedderExternalTextureFramesGL> gl_frames = nullptr);
 #endif
 
 #ifdef SHELL_ENABLE_METAL
@@ -38,9 +40,16 @@ class EmbedderExternalTextureResolver {
 
   bool SupportsExternalTextures();
 
+  // Hands a frame pushed by the embedder to the OpenGL texture. Returns false
+  // if the renderer doesn't accept pushed frames.
+  bool PushFrameGL(int64_t texture_id,
+                   const FlutterOpenGLTexture& texture,
+                   void* sync);
+
  private:
 #ifdef SHELL_ENABLE_GL
   EmbedderExternalTextureGL::ExternalTextureCallback gl_callback_;
+  std::shared_ptr<EmbedderExternalTextureFramesGL> gl_frames_;
 #endif
 
 #ifdef SHELL_ENABLE_METAL
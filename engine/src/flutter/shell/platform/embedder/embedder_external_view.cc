@@ -77,6 +77,9 @@ bool EmbedderExternalView::HasEngineRenderedContents() {
   DlOpSpy dl_op_spy;
   slice_->dispatch(dl_op_spy);
   has_engine_rendered_contents_ = dl_op_spy.did_draw() && !slice_->is_empty();
+  if (has_engine_rendered_contents_.value()) {
+    solid_color_ = dl_op_spy.solid_color();
+  }
   // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
   return has_engine_rendered_contents_.value();
 }
@@ -125,8 +128,12 @@ bool EmbedderExternalView::Render(const EmbedderRenderTarget& render_target,
     auto aiks_context = render_target.GetAiksContext();
 
     auto dl_builder = DisplayListBuilder();
-    dl_builder.SetTransform(surface_transformation_);
-    slice_->render_into(&dl_builder);
+    if (solid_color_.has_value()) {
+      dl_builder.DrawColor(solid_color_.value(), DlBlendMode::kSrc);
+    } else {
+      dl_builder.SetTransform(surface_transformation_);
+      slice_->render_into(&dl_builder);
+    }
     auto display_list = dl_builder.Build();
 
     auto cull_rect =
@@ -180,6 +187,11 @@ bool EmbedderExternalView::Render(const EmbedderRenderTarget& render_target,
     return false;
   }
   DlSkCanvasAdapter dl_canvas(canvas);
+  if (solid_color_.has_value()) {
+    dl_canvas.Clear(solid_color_.value());
+    dl_canvas.Flush();
+    return true;
+  }
   int restore_count = dl_canvas.GetSaveCount();
   dl_canvas.SetTransform(surface_transformation_);
   if (clear_surface) {
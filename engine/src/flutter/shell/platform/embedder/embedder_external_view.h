@@ -118,6 +118,9 @@ class EmbedderExternalView {
   std::unique_ptr<EmbeddedViewParams> embedded_view_params_;
   std::unique_ptr<DisplayListEmbedderViewSlice> slice_;
   std::optional<bool> has_engine_rendered_contents_;
+  // If the slice only fills the surface with an opaque color, which can be
+  // rendered with a clear instead of replaying the slice.
+  std::optional<DlColor> solid_color_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(EmbedderExternalView);
 };
@@ -5,9 +5,11 @@
 #include "flutter/shell/platform/embedder/embedder_external_view_embedder.h"
 
 #include <cassert>
+#include <string>
 #include <utility>
 
 #include "flutter/common/constants.h"
+#include "flutter/fml/trace_event.h"
 #include "flutter/shell/platform/embedder/embedder_layers.h"
 #include "flutter/shell/platform/embedder/embedder_render_target.h"
 #include "third_party/skia/include/gpu/ganesh/GrDirectContext.h"
@@ -59,7 +61,11 @@ void EmbedderExternalViewEmbedder::CancelFrame() {
 // |ExternalViewEmbedder|
 void EmbedderExternalViewEmbedder::BeginFrame(
     GrDirectContext* context,
-    const fml::RefPtr<fml::RasterThreadMerger>& raster_thread_merger) {}
+    const fml::RefPtr<fml::RasterThreadMerger>& raster_thread_merger) {
+  // Views are normally presented in |EndFrame|. Don't let a frame that wasn't
+  // ended hold on to them.
+  PresentPendingViews();
+}
 
 // |ExternalViewEmbedder|
 void EmbedderExternalViewEmbedder::PrepareFlutterView(
@@ -455,25 +461,10 @@ void EmbedderExternalViewEmbedder::SubmitFlutterView(
     return create_render_target_callback_(context, aiks_context, config);
   });
 
-  // This is where unused render targets will be collected. Control may flow
-  // to the embedder. Here, the embedder has the opportunity to trample on the
-  // OpenGL context.
-  //
-  // For optimum performance, we should tell the render target cache to clear
-  // its unused entries before allocating new ones. This collection step
-  // before allocating new render targets ameliorates peak memory usage within
-  // the frame. But, this causes an issue in a known internal embedder. To
-  // work around this issue while that embedder migrates, collection of render
-  // targets is deferred after the presentation.
-  //
-  // @warning: Embedder may trample on our OpenGL context here.
-  auto deferred_cleanup_render_targets =
-      render_target_cache.ClearAllRenderTargetsInCache();
-
 #if !SLIMPELLER
   // The OpenGL context could have been trampled by the embedder at this point
-  // as it attempted to collect old render targets and create new ones. Tell
-  // Skia to not rely on existing bindings.
+  // as it attempted to create new render targets. Tell Skia to not rely on
+  // existing bindings.
   if (context) {
     context->resetContext(kAll_GrBackendState);
   }
@@ -492,39 +483,71 @@ void EmbedderExternalViewEmbedder::SubmitFlutterView(
   }
 #endif  //  !SLIMPELLER
 
-  {
-    auto presentation_time_optional = frame->submit_info().presentation_time;
-    uint64_t presentation_time =
-        presentation_time_optional.has_value()
-            ? presentation_time_optional->ToEpochDelta().ToNanoseconds()
-            : 0;
-
-    // Submit the scribbled layer to the embedder for presentation.
-    //
-    // @warning: Embedder may trample on our OpenGL context here.
-    EmbedderLayers presented_layers(
-        pending_frame_size_, pending_device_pixel_ratio_,
-        pending_surface_transformation_, presentation_time);
+  auto presentation_time_optional = frame->submit_info().presentation_time;
+  uint64_t presentation_time =
+      presentation_time_optional.has_value()
+          ? presentation_time_optional->ToEpochDelta().ToNanoseconds()
+          : 0;
+
+  auto presented_layers = std::make_unique<EmbedderLayers>(
+      pending_frame_size_, pending_device_pixel_ratio_,
+      pending_surface_transformation_, presentation_time);
+
+  builder.PushLayers(*presented_layers);
+
+  // The presentation is deferred to the end of the frame so that the views of
+  // a multi-view frame are all rendered before the embedder, which may block
+  // on each present, gets to see any of them.
+  pending_presents_.push_back(PendingPresent{
+      .flutter_view_id = flutter_view_id,
+      .layers = std::move(presented_layers),
+      .render_targets = builder.ClearAndCollectRenderTargets(),
+      .frame = std::move(frame),
+  });
+}
 
-    builder.PushLayers(presented_layers);
+// |ExternalViewEmbedder|
+void EmbedderExternalViewEmbedder::EndFrame(
+    bool should_resubmit_frame,
+    const fml::RefPtr<fml::RasterThreadMerger>& raster_thread_merger) {
+  PresentPendingViews();
+}
 
-    presented_layers.InvokePresentCallback(flutter_view_id, present_callback_);
+void EmbedderExternalViewEmbedder::PresentPendingViews() {
+  if (pending_presents_.empty()) {
+    return;
   }
+  TRACE_EVENT1("flutter", "EmbedderExternalViewEmbedder::PresentPendingViews",
+               "views", std::to_string(pending_presents_.size()).c_str());
 
-  // See why this is necessary in the comment where this collection in
-  // realized.
+  // Submit the scribbled layers to the embedder for presentation.
   //
   // @warning: Embedder may trample on our OpenGL context here.
-  deferred_cleanup_render_targets.clear();
+  for (const auto& pending : pending_presents_) {
+    pending.layers->InvokePresentCallback(pending.flutter_view_id,
+                                          present_callback_);
+  }
 
-  auto render_targets = builder.ClearAndCollectRenderTargets();
-  for (auto& render_target : render_targets) {
-    if (!avoid_backing_store_cache_) {
-      render_target_cache.CacheRenderTarget(std::move(render_target));
+  for (auto& pending : pending_presents_) {
+    // The render targets of a view collected in the meantime are dropped.
+    auto found = render_target_caches_.find(pending.flutter_view_id);
+    if (!avoid_backing_store_cache_ && found != render_target_caches_.end()) {
+      EmbedderRenderTargetCache& render_target_cache = found->second;
+      for (auto& render_target : pending.render_targets) {
+        render_target_cache.CacheRenderTarget(std::move(render_target));
+      }
+
+      // This is where render targets left unused for too long are collected,
+      // after the presentation, as a known internal embedder can't collect
+      // them before new ones are allocated. Control may flow to the embedder.
+      //
+      // @warning: Embedder may trample on our OpenGL context here.
+      render_target_cache.EndFrame();
     }
-  }
 
-  frame->Submit();
+    pending.frame->Submit();
+  }
+  pending_presents_.clear();
 }
 
 }  // namespace flutter
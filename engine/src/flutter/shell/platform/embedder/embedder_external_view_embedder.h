@@ -13,6 +13,7 @@
 #include "flutter/fml/hash_combine.h"
 #include "flutter/fml/macros.h"
 #include "flutter/shell/platform/embedder/embedder_external_view.h"
+#include "flutter/shell/platform/embedder/embedder_layers.h"
 #include "flutter/shell/platform/embedder/embedder_render_target_cache.h"
 
 namespace flutter {
@@ -111,7 +112,21 @@ class EmbedderExternalViewEmbedder final : public ExternalViewEmbedder {
   // |ExternalViewEmbedder|
   DlCanvas* GetRootCanvas() override;
 
+  // |ExternalViewEmbedder|
+  void EndFrame(bool should_resubmit_frame,
+                const fml::RefPtr<fml::RasterThreadMerger>&
+                    raster_thread_merger) override;
+
  private:
+  // A view that has been rendered this frame but not handed to the embedder
+  // yet. Its render targets are held until then.
+  struct PendingPresent {
+    int64_t flutter_view_id;
+    std::unique_ptr<EmbedderLayers> layers;
+    std::vector<std::unique_ptr<EmbedderRenderTarget>> render_targets;
+    std::unique_ptr<SurfaceFrame> frame;
+  };
+
   const bool avoid_backing_store_cache_;
   const CreateRenderTargetCallback create_render_target_callback_;
   const PresentCallback present_callback_;
@@ -123,9 +138,15 @@ class EmbedderExternalViewEmbedder final : public ExternalViewEmbedder {
   std::vector<EmbedderExternalView::ViewIdentifier> composition_order_;
   // The render target caches for views. Each key is a view ID.
   std::unordered_map<int64_t, EmbedderRenderTargetCache> render_target_caches_;
+  // The views submitted this frame, in submission order. They are presented
+  // together once every view has been rendered.
+  std::vector<PendingPresent> pending_presents_;
 
   void Reset();
 
+  // Hand all pending views to the embedder, then recycle their render targets.
+  void PresentPendingViews();
+
   DlMatrix GetSurfaceTransformation() const;
 
   FML_DISALLOW_COPY_AND_ASSIGN(EmbedderExternalViewEmbedder);
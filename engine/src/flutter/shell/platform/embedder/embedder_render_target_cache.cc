@@ -4,6 +4,9 @@
 
 #include "flutter/shell/platform/embedder/embedder_render_target_cache.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace flutter {
 
 EmbedderRenderTargetCache::EmbedderRenderTargetCache() = default;
@@ -13,25 +16,19 @@ EmbedderRenderTargetCache::~EmbedderRenderTargetCache() = default;
 std::unique_ptr<EmbedderRenderTarget>
 EmbedderRenderTargetCache::GetRenderTarget(
     const EmbedderExternalView::RenderTargetDescriptor& descriptor) {
-  auto compatible_target = cached_render_targets_.find(descriptor);
-  if (compatible_target == cached_render_targets_.end()) {
+  auto [begin, end] = cached_render_targets_.equal_range(descriptor);
+  if (begin == end) {
     return nullptr;
   }
-  auto target = std::move(compatible_target->second);
+  auto compatible_target = std::max_element(
+      begin, end, [](const auto& lhs, const auto& rhs) {
+        return lhs.second.last_used_frame < rhs.second.last_used_frame;
+      });
+  auto target = std::move(compatible_target->second.target);
   cached_render_targets_.erase(compatible_target);
   return target;
 }
 
-std::set<std::unique_ptr<EmbedderRenderTarget>>
-EmbedderRenderTargetCache::ClearAllRenderTargetsInCache() {
-  std::set<std::unique_ptr<EmbedderRenderTarget>> cleared_targets;
-  for (auto& targets : cached_render_targets_) {
-    cleared_targets.insert(std::move(targets.second));
-  }
-  cached_render_targets_.clear();
-  return cleared_targets;
-}
-
 void EmbedderRenderTargetCache::CacheRenderTarget(
     std::unique_ptr<EmbedderRenderTarget> target) {
   if (target == nullptr) {
@@ -39,7 +36,41 @@ void EmbedderRenderTargetCache::CacheRenderTarget(
   }
   auto desc = EmbedderExternalView::RenderTargetDescriptor{
       target->GetRenderTargetSize()};
-  cached_render_targets_.insert(std::make_pair(desc, std::move(target)));
+  cached_render_targets_.insert(std::make_pair(
+      desc, CachedRenderTarget{std::move(target), frame_}));
+}
+
+std::set<std::unique_ptr<EmbedderRenderTarget>>
+EmbedderRenderTargetCache::EndFrame() {
+  int64_t used_area = 0;
+  std::vector<CachedRenderTargets::iterator> unused_targets;
+  for (auto it = cached_render_targets_.begin();
+       it != cached_render_targets_.end(); ++it) {
+    if (it->second.last_used_frame == frame_) {
+      used_area += it->first.surface_size.Area();
+    } else {
+      unused_targets.push_back(it);
+    }
+  }
+
+  // Keep the most recently used targets within the budget.
+  std::sort(unused_targets.begin(), unused_targets.end(),
+            [](const auto& lhs, const auto& rhs) {
+              return lhs->second.last_used_frame > rhs->second.last_used_frame;
+            });
+  std::set<std::unique_ptr<EmbedderRenderTarget>> evicted_targets;
+  int64_t unused_area = 0;
+  for (auto it : unused_targets) {
+    unused_area += it->first.surface_size.Area();
+    if (frame_ - it->second.last_used_frame >= kMaxUnusedFrames ||
+        unused_area > used_area) {
+      evicted_targets.insert(std::move(it->second.target));
+      cached_render_targets_.erase(it);
+    }
+  }
+
+  frame_++;
+  return evicted_targets;
 }
 
 size_t EmbedderRenderTargetCache::GetCachedTargetsCount() const {
@@ -23,30 +23,59 @@ namespace flutter {
 ///             instance of this class manages the cached render targets for a
 ///             view.
 ///
+///             Render targets that a frame did not use are kept for a while,
+///             so that layers coming and going with platform views don't have
+///             the embedder create and collect backing stores on every layout
+///             change. The least recently used ones are collected once they
+///             have not been used for |kMaxUnusedFrames| frames, or once the
+///             unused targets take more pixels than the ones in use.
+///
 class EmbedderRenderTargetCache {
  public:
+  // About a second at 60 Hz.
+  static constexpr size_t kMaxUnusedFrames = 60;
+
   EmbedderRenderTargetCache();
 
   ~EmbedderRenderTargetCache();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Takes the most recently used render target matching
+  ///             |descriptor| out of the cache, if any.
+  ///
   std::unique_ptr<EmbedderRenderTarget> GetRenderTarget(
       const EmbedderExternalView::RenderTargetDescriptor& descriptor);
 
-  std::set<std::unique_ptr<EmbedderRenderTarget>>
-  ClearAllRenderTargetsInCache();
-
+  //----------------------------------------------------------------------------
+  /// @brief      Gives back a render target used in the current frame.
+  ///
   void CacheRenderTarget(std::unique_ptr<EmbedderRenderTarget> target);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Ends the current frame, after all render targets it used
+  ///             have been given back with |CacheRenderTarget|.
+  ///
+  /// @return     The render targets evicted from the cache, to be collected
+  ///             by the caller.
+  ///
+  std::set<std::unique_ptr<EmbedderRenderTarget>> EndFrame();
+
   size_t GetCachedTargetsCount() const;
 
  private:
+  struct CachedRenderTarget {
+    std::unique_ptr<EmbedderRenderTarget> target;
+    size_t last_used_frame = 0;
+  };
+
   using CachedRenderTargets = std::unordered_multimap<
       EmbedderExternalView::RenderTargetDescriptor,
-      std::unique_ptr<EmbedderRenderTarget>,
+      CachedRenderTarget,
       EmbedderExternalView::RenderTargetDescriptor::Hash,
       EmbedderExternalView::RenderTargetDescriptor::Equal>;
 
   CachedRenderTargets cached_render_targets_;
+  size_t frame_ = 0;
 
   FML_DISALLOW_COPY_AND_ASSIGN(EmbedderRenderTargetCache);
 };
@@ -0,0 +1,87 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/embedder/embedder_render_target_cache.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+namespace {
+
+class FakeRenderTarget : public EmbedderRenderTarget {
+ public:
+  FakeRenderTarget(DlISize size, size_t* released_count)
+      : EmbedderRenderTarget({}, [released_count]() { (*released_count)++; }),
+        size_(size) {}
+
+  sk_sp<SkSurface> GetSkiaSurface() const override { return nullptr; }
+
+  impeller::RenderTarget* GetImpellerRenderTarget() const override {
+    return nullptr;
+  }
+
+  std::shared_ptr<impeller::AiksContext> GetAiksContext() const override {
+    return nullptr;
+  }
+
+  DlISize GetRenderTargetSize() const override { return size_; }
+
+ private:
+  DlISize size_;
+};
+
+using Descriptor = EmbedderExternalView::RenderTargetDescriptor;
+
+}  // namespace
+
+TEST(EmbedderRenderTargetCacheTest, KeepsTargetsUnusedForAFewFrames) {
+  size_t released_count = 0;
+  EmbedderRenderTargetCache cache;
+  const DlISize size(100, 100);
+
+  cache.CacheRenderTarget(
+      std::make_unique<FakeRenderTarget>(size, &released_count));
+  cache.CacheRenderTarget(
+      std::make_unique<FakeRenderTarget>(size, &released_count));
+  cache.EndFrame();
+
+  // The next frame only needs one of the two targets.
+  auto target = cache.GetRenderTarget(Descriptor(size));
+  ASSERT_NE(target, nullptr);
+  cache.CacheRenderTarget(std::move(target));
+  cache.EndFrame();
+  EXPECT_EQ(released_count, 0u);
+  EXPECT_EQ(cache.GetCachedTargetsCount(), 2u);
+
+  for (size_t i = 0; i < EmbedderRenderTargetCache::kMaxUnusedFrames; ++i) {
+    cache.CacheRenderTarget(cache.GetRenderTarget(Descriptor(size)));
+    cache.EndFrame();
+  }
+  EXPECT_EQ(released_count, 1u);
+  EXPECT_EQ(cache.GetCachedTargetsCount(), 1u);
+}
+
+TEST(EmbedderRenderTargetCacheTest, EvictsUnusedTargetsOverTheBudget) {
+  size_t released_count = 0;
+  EmbedderRenderTargetCache cache;
+  const DlISize old_size(100, 100);
+  const DlISize new_size(50, 50);
+
+  cache.CacheRenderTarget(
+      std::make_unique<FakeRenderTarget>(old_size, &released_count));
+  cache.EndFrame();
+
+  // After a resize, the old target takes more pixels than the new one.
+  EXPECT_EQ(cache.GetRenderTarget(Descriptor(new_size)), nullptr);
+  cache.CacheRenderTarget(
+      std::make_unique<FakeRenderTarget>(new_size, &released_count));
+  cache.EndFrame();
+  EXPECT_EQ(released_count, 1u);
+  EXPECT_EQ(cache.GetRenderTarget(Descriptor(old_size)), nullptr);
+  EXPECT_NE(cache.GetRenderTarget(Descriptor(new_size)), nullptr);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -29,7 +29,8 @@ EmbedderSurfaceVulkanImpeller::EmbedderSurfaceVulkanImpeller(
     uint32_t queue_family_index,
     VkQueue queue,
     const VulkanDispatchTable& vulkan_dispatch_table,
-    std::shared_ptr<EmbedderExternalViewEmbedder> external_view_embedder)
+    std::shared_ptr<EmbedderExternalViewEmbedder> external_view_embedder,
+    std::vector<std::shared_ptr<fml::Mapping>> bundled_pipeline_caches)
     : vk_(fml::MakeRefCounted<vulkan::VulkanProcTable>(
           vulkan_dispatch_table.get_instance_proc_address)),
       vulkan_dispatch_table_(vulkan_dispatch_table),
@@ -54,6 +55,7 @@ EmbedderSurfaceVulkanImpeller::EmbedderSurfaceVulkanImpeller(
   settings.shader_libraries_data = shader_mappings;
   settings.proc_address_callback =
       vulkan_dispatch_table.get_instance_proc_address;
+  settings.bundled_pipeline_caches = std::move(bundled_pipeline_caches);
 
   impeller::ContextVK::EmbedderData data;
   data.instance = instance;
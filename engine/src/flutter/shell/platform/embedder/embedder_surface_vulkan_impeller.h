@@ -39,7 +39,8 @@ class EmbedderSurfaceVulkanImpeller final : public EmbedderSurface,
       uint32_t queue_family_index,
       VkQueue queue,
       const VulkanDispatchTable& vulkan_dispatch_table,
-      std::shared_ptr<EmbedderExternalViewEmbedder> external_view_embedder);
+      std::shared_ptr<EmbedderExternalViewEmbedder> external_view_embedder,
+      std::vector<std::shared_ptr<fml::Mapping>> bundled_pipeline_caches = {});
 
   ~EmbedderSurfaceVulkanImpeller() override;
 
@@ -4,9 +4,12 @@
 
 #include "flutter/shell/platform/embedder/platform_view_embedder.h"
 
+#include <mutex>
+#include <string>
 #include <utility>
+#include <vector>
 
-#include "flutter/fml/make_copyable.h"
+#include "flutter/fml/trace_event.h"
 
 namespace flutter {
 
@@ -19,16 +22,34 @@ class PlatformViewEmbedder::EmbedderPlatformMessageHandler
       : parent_(std::move(parent)),
         platform_task_runner_(std::move(platform_task_runner)) {}
 
+  // Messages that arrive before the platform thread has handled the previous
+  // ones are delivered together by a single task, in the order they arrived.
   virtual void HandlePlatformMessage(std::unique_ptr<PlatformMessage> message) {
-    platform_task_runner_->PostTask(fml::MakeCopyable(
-        [parent = parent_, message = std::move(message)]() mutable {
-          if (parent) {
-            parent->HandlePlatformMessage(std::move(message));
-          } else {
-            FML_DLOG(WARNING) << "Deleted engine dropping message on channel "
-                              << message->channel();
-          }
-        }));
+    {
+      std::scoped_lock lock(pending_->mutex);
+      pending_->messages.push_back(std::move(message));
+      if (pending_->messages.size() > 1) {
+        // A task to deliver the messages is already posted.
+        return;
+      }
+    }
+    platform_task_runner_->PostTask([parent = parent_, pending = pending_]() {
+      std::vector<std::unique_ptr<PlatformMessage>> messages;
+      {
+        std::scoped_lock lock(pending->mutex);
+        messages.swap(pending->messages);
+      }
+      TRACE_EVENT1("flutter", "EmbedderPlatformMessageHandler::Deliver",
+                   "count", std::to_string(messages.size()).c_str());
+      for (auto& message : messages) {
+        if (parent) {
+          parent->HandlePlatformMessage(std::move(message));
+        } else {
+          FML_DLOG(WARNING) << "Deleted engine dropping message on channel "
+                            << message->channel();
+        }
+      }
+    });
   }
 
   virtual bool DoesHandlePlatformMessageOnPlatformThread() const {
@@ -41,8 +62,15 @@ class PlatformViewEmbedder::EmbedderPlatformMessageHandler
   virtual void InvokePlatformMessageEmptyResponseCallback(int response_id) {}
 
  private:
+  struct PendingMessages {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<PlatformMessage>> messages;
+  };
+
   fml::WeakPtr<PlatformView> parent_;
   fml::RefPtr<fml::TaskRunner> platform_task_runner_;
+  std::shared_ptr<PendingMessages> pending_ =
+      std::make_shared<PendingMessages>();
 };
 
 PlatformViewEmbedder::PlatformViewEmbedder(
@@ -211,6 +211,72 @@ TEST_F(EmbedderTest, CompositorMustBeAbleToRenderToOpenGLFramebuffer) {
   latch.Wait();
 }
 
+//------------------------------------------------------------------------------
+/// The compositor must receive a fence for the rendering of the layers if it
+/// asks for one.
+///
+TEST_F(EmbedderTest, CompositorMustReceiveRenderFences) {
+  auto& context = GetEmbedderContext<EmbedderTestContextGL>();
+
+  EmbedderConfigBuilder builder(context);
+  builder.SetSurface(DlISize(800, 600));
+  builder.SetCompositor();
+  builder.SetDartEntrypoint("can_composite_platform_views");
+
+  builder.SetRenderTargetType(
+      EmbedderTestBackingStoreProducer::RenderTargetType::kOpenGLTexture);
+
+  typedef void (*glDeleteSyncProc)(void* sync);
+  static glDeleteSyncProc glDeleteSync;
+  glDeleteSync = reinterpret_cast<glDeleteSyncProc>(
+      context.GLGetProcAddress("glDeleteSync"));
+  ASSERT_NE(glDeleteSync, nullptr);
+
+  builder.GetCompositor().create_render_fences = true;
+  builder.GetCompositor().present_view_callback =
+      [](const FlutterPresentViewInfo* info) {
+        EXPECT_NE(info->render_fence, nullptr);
+        if (info->render_fence != nullptr) {
+          EXPECT_EQ(info->render_fence->struct_size,
+                    sizeof(FlutterRenderFence));
+          EXPECT_EQ(info->render_fence->type, kFlutterRenderFenceTypeOpenGL);
+          EXPECT_NE(info->render_fence->open_gl_sync, nullptr);
+          glDeleteSync(info->render_fence->open_gl_sync);
+        }
+        auto compositor =
+            reinterpret_cast<EmbedderTestCompositor*>(info->user_data);
+        return compositor->Present(info->view_id, info->layers,
+                                   info->layers_count);
+      };
+
+  fml::CountDownLatch latch(2);
+  context.GetCompositor().SetNextPresentCallback(
+      [&](FlutterViewId view_id, const FlutterLayer** layers,
+          size_t layers_count) {
+        ASSERT_EQ(layers_count, 3u);
+        latch.CountDown();
+      });
+
+  context.AddNativeCallback(
+      "SignalNativeTest",
+      CREATE_NATIVE_ENTRY(
+          [&latch](Dart_NativeArguments args) { latch.CountDown(); }));
+
+  auto engine = builder.LaunchEngine();
+
+  // Send a window metrics events so frames may be scheduled.
+  FlutterWindowMetricsEvent event = {};
+  event.struct_size = sizeof(event);
+  event.width = 800;
+  event.height = 600;
+  event.pixel_ratio = 1.0;
+  ASSERT_EQ(FlutterEngineSendWindowMetricsEvent(engine.get(), &event),
+            kSuccess);
+  ASSERT_TRUE(engine.is_valid());
+
+  latch.Wait();
+}
+
 //------------------------------------------------------------------------------
 /// Layers in a hierarchy containing a platform view should not be cached. The
 /// other layers in the hierarchy should be, however.
@@ -4620,6 +4686,86 @@ TEST_F(EmbedderTest, ExternalTextureGLRefreshedTooOften) {
   glFinish();
 }
 
+TEST_F(EmbedderTest, ExternalTextureGLDrawsLatestPushedFrame) {
+  TestGLSurface surface(DlISize(100, 100));
+  auto context = surface.GetGrContext();
+
+  typedef void (*glGenTexturesProc)(uint32_t n, uint32_t* textures);
+  typedef void (*glFinishProc)();
+
+  glGenTexturesProc glGenTextures;
+  glFinishProc glFinish;
+
+  glGenTextures = reinterpret_cast<glGenTexturesProc>(
+      surface.GetProcAddress("glGenTextures"));
+  glFinish = reinterpret_cast<glFinishProc>(surface.GetProcAddress("glFinish"));
+
+  uint32_t names[2];
+  glGenTextures(2, names);
+
+  bool resolve_called = false;
+  EmbedderExternalTextureGL::ExternalTextureCallback callback(
+      [&](int64_t, size_t, size_t) -> std::unique_ptr<FlutterOpenGLTexture> {
+        resolve_called = true;
+        return nullptr;
+      });
+
+  std::vector<void*> waited_syncs;
+  auto frames = std::make_shared<EmbedderExternalTextureFramesGL>(
+      [&waited_syncs](void* sync) { waited_syncs.push_back(sync); });
+  EmbedderExternalTextureGL texture(1, callback, frames);
+
+  size_t released[2] = {};
+  auto make_frame = [&](size_t index) {
+    EmbedderExternalTextureFramesGL::Frame frame;
+    frame.texture.target = GL_TEXTURE_2D;
+    frame.texture.name = names[index];
+    frame.texture.format = GL_RGBA8;
+    frame.texture.user_data = &released[index];
+    frame.texture.destruction_callback = [](void* user_data) {
+      ++*static_cast<size_t*>(user_data);
+    };
+    frame.texture.width = frame.texture.height = 100;
+    frame.sync = &names[index];
+    return frame;
+  };
+
+  // The first frame is replaced before it is drawn.
+  frames->Push(1, make_frame(0));
+  frames->Push(1, make_frame(1));
+  EXPECT_EQ(released[0], 1u);
+  EXPECT_EQ(released[1], 0u);
+
+  auto skia_surface = surface.GetOnscreenSurface();
+  DlSkCanvasAdapter canvas(skia_surface->getCanvas());
+
+  Texture* texture_ = &texture;
+  Texture::PaintContext ctx{
+      .canvas = &canvas,
+      .gr_context = context.get(),
+  };
+  texture_->Paint(ctx, DlRect::MakeXYWH(0, 0, 100, 100), false,
+                  DlImageSampling::kLinear);
+
+  EXPECT_FALSE(resolve_called);
+  ASSERT_EQ(waited_syncs.size(), 1u);
+  EXPECT_EQ(waited_syncs[0], &names[1]);
+
+  // The embedder is not asked for a frame, the pushed one keeps being drawn.
+  texture_->MarkNewFrameAvailable();
+  texture_->Paint(ctx, DlRect::MakeXYWH(0, 0, 100, 100), false,
+                  DlImageSampling::kLinear);
+
+  EXPECT_FALSE(resolve_called);
+  EXPECT_EQ(waited_syncs.size(), 1u);
+
+  frames->Push(1, make_frame(0));
+  texture_->OnTextureUnregistered();
+  EXPECT_EQ(released[0], 2u);
+
+  glFinish();
+}
+
 TEST_F(
     EmbedderTest,
     PresentInfoReceivesFullScreenDamageWhenPopulateExistingDamageIsNotProvided) {
@@ -77,6 +77,18 @@ TEST_F(EmbedderTest, CanLaunchAndShutdownWithValidProjectArgs) {
   engine.reset();
 }
 
+TEST_F(EmbedderTest, MustNotRunWithInvalidWorkerPool) {
+  auto& context = GetEmbedderContext<EmbedderTestContextSoftware>();
+  EmbedderConfigBuilder builder(context);
+  builder.SetSurface(DlISize(1, 1));
+  FlutterWorkerPool worker_pool = {};
+  worker_pool.struct_size = sizeof(FlutterWorkerPool);
+  worker_pool.worker_count = 2;
+  builder.GetProjectArgs().worker_pool = &worker_pool;
+  auto engine = builder.LaunchEngine();
+  ASSERT_FALSE(engine.is_valid());
+}
+
 // TODO(41999): Disabled because flaky.
 TEST_F(EmbedderTest, DISABLED_CanLaunchAndShutdownMultipleTimes) {
   auto& context = GetEmbedderContext<EmbedderTestContextSoftware>();
@@ -3862,6 +3874,66 @@ TEST_F(EmbedderTest, CanSetNextFrameCallback) {
   callback_latch.Wait();
 }
 
+TEST_F(EmbedderTest, CanGetFrameTimingSummary) {
+  auto& context = GetEmbedderContext<EmbedderTestContextSoftware>();
+  EmbedderConfigBuilder builder(context);
+  builder.SetSurface(DlISize(1, 1));
+
+  auto engine = builder.LaunchEngine();
+  ASSERT_TRUE(engine.is_valid());
+
+  FlutterFrameTimingSummary summary = {};
+  ASSERT_EQ(FlutterEngineGetFrameTimingSummary(engine.get(), &summary),
+            kInvalidArguments);
+  ASSERT_EQ(FlutterEngineGetFrameTimingSummary(engine.get(), nullptr),
+            kInvalidArguments);
+
+  summary.struct_size = sizeof(summary);
+  ASSERT_EQ(FlutterEngineGetFrameTimingSummary(engine.get(), &summary),
+            kSuccess);
+  // Nothing has been rasterized yet.
+  EXPECT_EQ(summary.frame_count, 0u);
+  EXPECT_EQ(summary.total.p99, 0u);
+}
+
+TEST_F(EmbedderTest, FrameTimingsCallbackReportsRasterizedFrames) {
+  auto& context = GetEmbedderContext<EmbedderTestContextSoftware>();
+
+  EmbedderConfigBuilder builder(context);
+  builder.SetSurface(DlISize(800, 600));
+  builder.SetCompositor();
+  builder.SetDartEntrypoint("render_implicit_view");
+  builder.SetRenderTargetType(
+      EmbedderTestBackingStoreProducer::RenderTargetType::kSoftwareBuffer);
+
+  static fml::AutoResetWaitableEvent latch;
+  static FlutterFrameTimings reported_timings;
+  builder.GetProjectArgs().frame_timings_callback =
+      [](const FlutterFrameTimings* timings, void* user_data) {
+        reported_timings = *timings;
+        latch.Signal();
+      };
+
+  auto engine = builder.LaunchEngine();
+  ASSERT_TRUE(engine.is_valid());
+
+  FlutterWindowMetricsEvent event = {};
+  event.struct_size = sizeof(event);
+  event.width = 300;
+  event.height = 200;
+  event.pixel_ratio = 1.0;
+  ASSERT_EQ(FlutterEngineSendWindowMetricsEvent(engine.get(), &event),
+            kSuccess);
+  latch.Wait();
+
+  EXPECT_EQ(reported_timings.struct_size, sizeof(FlutterFrameTimings));
+  EXPECT_LE(reported_timings.vsync_start, reported_timings.build_start);
+  EXPECT_LE(reported_timings.build_start, reported_timings.build_finish);
+  EXPECT_LE(reported_timings.build_finish, reported_timings.raster_start);
+  EXPECT_LE(reported_timings.raster_start, reported_timings.raster_finish);
+  EXPECT_LE(reported_timings.raster_finish, FlutterEngineGetCurrentTime());
+}
+
 #if defined(FML_OS_MACOSX)
 
 static void MockThreadConfigSetter(const fml::Thread::ThreadConfig& config) {
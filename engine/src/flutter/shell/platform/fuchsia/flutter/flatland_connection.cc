@@ -11,9 +11,11 @@
 #include <zircon/status.h>
 #include <zircon/types.h>
 
+#include <algorithm>
 #include <utility>
 
 #include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
 
 namespace flutter_runner {
 
@@ -25,6 +27,15 @@ double DeltaFromNowInNanoseconds(const fml::TimePoint& now,
   return (time - now).ToNanoseconds();
 }
 
+// Frames that take longer than this many vsync intervals are not used to
+// predict frame durations.
+constexpr int64_t kMaxFrameDurationInVsyncs = 4;
+
+fml::TimePoint TimePointFromNanoseconds(zx_time_t nanoseconds) {
+  return fml::TimePoint::FromEpochDelta(
+      fml::TimeDelta::FromNanoseconds(nanoseconds));
+}
+
 }  // namespace
 
 FlatlandConnection::FlatlandConnection(
@@ -56,7 +67,26 @@ FlatlandConnection::~FlatlandConnection() = default;
 // This method is called from the raster thread.
 void FlatlandConnection::Present() {
   TRACE_DURATION("flutter", "FlatlandConnection::Present");
+  const auto now = fml::TimePoint::Now();
   std::scoped_lock<std::mutex> lock(threadsafe_state_.mutex_);
+  // Smooth the time from the start of the frame to this call, which covers
+  // the UI and raster work, over the last few frames. Much longer durations
+  // mean the UI was idle rather than busy, so they are ignored.
+  const auto frame_duration =
+      threadsafe_state_.pending_frame_start_.has_value()
+          ? now - threadsafe_state_.pending_frame_start_.value()
+          : fml::TimeDelta::Zero();
+  if (frame_duration > fml::TimeDelta::Zero() &&
+      frame_duration <
+          threadsafe_state_.vsync_interval_ * kMaxFrameDurationInVsyncs) {
+    threadsafe_state_.predicted_frame_duration_ =
+        threadsafe_state_.predicted_frame_duration_ == fml::TimeDelta::Zero()
+            ? frame_duration
+            : (threadsafe_state_.predicted_frame_duration_ * 3 +
+               frame_duration) /
+                  4;
+  }
+  threadsafe_state_.pending_frame_start_.reset();
   if (threadsafe_state_.present_credits_ > 0) {
     DoPresent();
   } else {
@@ -76,6 +106,14 @@ void FlatlandConnection::DoPresent() {
   FML_CHECK(threadsafe_state_.present_credits_ > 0);
   --threadsafe_state_.present_credits_;
 
+  if (threadsafe_state_.pending_latch_point_.has_value() &&
+      fml::TimePoint::Now() > threadsafe_state_.pending_latch_point_.value()) {
+    ++threadsafe_state_.latch_miss_count_;
+    TRACE_COUNTER("flutter", "FlatlandLatchMisses", 0u, "LatchMissCount",
+                  threadsafe_state_.latch_miss_count_);
+  }
+  threadsafe_state_.pending_latch_point_.reset();
+
   fuchsia::ui::composition::PresentArgs present_args;
   present_args.set_requested_presentation_time(0);
   present_args.set_acquire_fences(std::move(acquire_fences_));
@@ -246,10 +284,15 @@ void FlatlandConnection::OnNextFrameBegin(
   }
 
   // Update next_presentation_times_.
-  std::queue<fml::TimePoint> new_times;
+  std::queue<PresentationTime> new_times;
   for (const auto& info : values.future_presentation_infos()) {
-    new_times.emplace(fml::TimePoint::FromEpochDelta(
-        fml::TimeDelta::FromNanoseconds(info.presentation_time())));
+    PresentationTime time = {
+        .presentation_time = TimePointFromNanoseconds(info.presentation_time()),
+    };
+    if (info.has_latch_point()) {
+      time.latch_point = TimePointFromNanoseconds(info.latch_point());
+    }
+    new_times.push(time);
   }
   threadsafe_state_.next_presentation_times_.swap(new_times);
 
@@ -282,8 +325,8 @@ void FlatlandConnection::OnFramePresented(
 }
 
 // Parses and updates next_presentation_times_.
-fml::TimePoint FlatlandConnection::GetNextPresentationTime(
-    const fml::TimePoint& now) {
+FlatlandConnection::PresentationTime
+FlatlandConnection::GetNextPresentationTime(const fml::TimePoint& now) {
   const fml::TimePoint& cutoff =
       now > threadsafe_state_.last_presentation_time_
           ? now
@@ -292,7 +335,25 @@ fml::TimePoint FlatlandConnection::GetNextPresentationTime(
   // Remove presentation times that may have been passed. This may happen after
   // a long draw call.
   while (!threadsafe_state_.next_presentation_times_.empty() &&
-         threadsafe_state_.next_presentation_times_.front() <= cutoff) {
+         threadsafe_state_.next_presentation_times_.front().presentation_time <=
+             cutoff) {
+    threadsafe_state_.next_presentation_times_.pop();
+  }
+
+  // Skip presentation times whose latch point a frame started now would
+  // likely miss, as long as a later one is known. Targeting the later
+  // presentation directly keeps the frame times accurate instead of
+  // presenting late.
+  const auto predicted_present_time =
+      now + threadsafe_state_.predicted_frame_duration_ + kLatchPointHeadroom;
+  while (threadsafe_state_.next_presentation_times_.size() > 1 &&
+         threadsafe_state_.predicted_frame_duration_ > fml::TimeDelta::Zero()) {
+    const auto& latch_point =
+        threadsafe_state_.next_presentation_times_.front().latch_point;
+    if (!latch_point.has_value() ||
+        latch_point.value() >= predicted_present_time) {
+      break;
+    }
     threadsafe_state_.next_presentation_times_.pop();
   }
 
@@ -305,7 +366,7 @@ fml::TimePoint FlatlandConnection::GetNextPresentationTime(
     while (result <= cutoff) {
       result = result + threadsafe_state_.vsync_interval_;
     }
-    return result;
+    return {.presentation_time = result};
   }
 
   // Return the next presentation time in the queue for the regular case.
@@ -334,9 +395,26 @@ bool FlatlandConnection::MaybeRunInitialVsyncCallback(
 // because VsyncWaiter posts the vsync callback on UI thread.
 void FlatlandConnection::RunVsyncCallback(const fml::TimePoint& now,
                                           FireCallbackCallback& callback) {
-  const auto& frame_end = GetNextPresentationTime(now);
-  const auto& frame_start = frame_end - threadsafe_state_.vsync_offset_;
+  const auto next_presentation_time = GetNextPresentationTime(now);
+  const auto& frame_end = next_presentation_time.presentation_time;
+  auto frame_start = frame_end - threadsafe_state_.vsync_offset_;
+  // Once frame durations are known, start the frame just early enough to
+  // reach the latch point instead of at a fixed offset from the presentation.
+  const auto& latch_point = next_presentation_time.latch_point;
+  if (latch_point.has_value() &&
+      threadsafe_state_.predicted_frame_duration_ > fml::TimeDelta::Zero()) {
+    frame_start = std::min(latch_point.value() -
+                               threadsafe_state_.predicted_frame_duration_ -
+                               kLatchPointHeadroom,
+                           frame_end);
+  }
   threadsafe_state_.last_presentation_time_ = frame_end;
+  // Secondary callbacks may run before the frame is presented. Keep the
+  // start of the first one.
+  if (!threadsafe_state_.pending_frame_start_.has_value()) {
+    threadsafe_state_.pending_frame_start_ = std::max(frame_start, now);
+    threadsafe_state_.pending_latch_point_ = latch_point;
+  }
   TRACE_DURATION("flutter", "FlatlandConnection::RunVsyncCallback",
                  "frame_start_delta",
                  DeltaFromNowInNanoseconds(now, frame_start), "frame_end_delta",
@@ -344,6 +422,16 @@ void FlatlandConnection::RunVsyncCallback(const fml::TimePoint& now,
   callback(frame_start, frame_end);
 }
 
+uint64_t FlatlandConnection::latch_miss_count() {
+  std::scoped_lock<std::mutex> lock(threadsafe_state_.mutex_);
+  return threadsafe_state_.latch_miss_count_;
+}
+
+fml::TimeDelta FlatlandConnection::predicted_frame_duration() {
+  std::scoped_lock<std::mutex> lock(threadsafe_state_.mutex_);
+  return threadsafe_state_.predicted_frame_duration_;
+}
+
 // Enqueue a single fence into either the "base" vector of fences, or a
 // "special" overflow multiplexer.
 //
@@ -20,6 +20,7 @@
 
 #include <cstdint>
 #include <mutex>
+#include <optional>
 #include <queue>
 #include <string>
 
@@ -46,6 +47,11 @@ using on_frame_presented_event =
 static constexpr fml::TimeDelta kInitialFlatlandVsyncOffset =
     fml::TimeDelta::FromMilliseconds(10);
 
+// Headroom added to the predicted frame duration when scheduling a frame
+// against the latch point of its presentation.
+static constexpr fml::TimeDelta kLatchPointHeadroom =
+    fml::TimeDelta::FromMilliseconds(2);
+
 // The component residing on the raster thread that is responsible for
 // maintaining the Flatland instance connection and presenting updates.
 class FlatlandConnection final {
@@ -97,7 +103,22 @@ class FlatlandConnection final {
   // See the performance notes on EnqueueAcquireFence for performance details.
   void EnqueueReleaseFence(zx::event fence);
 
+  // The number of frames that were presented after the latch point they were
+  // scheduled for, and so were shown at least one vsync late.
+  uint64_t latch_miss_count();
+
+  // The predicted time from the start of a frame to its Present() call, based
+  // on the durations of previous frames.
+  fml::TimeDelta predicted_frame_duration();
+
  private:
+  struct PresentationTime {
+    fml::TimePoint presentation_time;
+    // The last time Flatland accepts a present for |presentation_time|, if
+    // known.
+    std::optional<fml::TimePoint> latch_point;
+  };
+
   void OnError(fuchsia::ui::composition::FlatlandError error);
 
   void OnNextFrameBegin(
@@ -105,7 +126,7 @@ class FlatlandConnection final {
   void OnFramePresented(fuchsia::scenic::scheduling::FramePresentedInfo info);
   void DoPresent();
 
-  fml::TimePoint GetNextPresentationTime(const fml::TimePoint& now);
+  PresentationTime GetNextPresentationTime(const fml::TimePoint& now);
   bool MaybeRunInitialVsyncCallback(const fml::TimePoint& now,
                                     FireCallbackCallback& callback);
   void RunVsyncCallback(const fml::TimePoint& now,
@@ -131,13 +152,19 @@ class FlatlandConnection final {
   // You should always lock mutex_ before touching anything in this struct
   struct {
     std::mutex mutex_;
-    std::queue<fml::TimePoint> next_presentation_times_;
+    std::queue<PresentationTime> next_presentation_times_;
     fml::TimeDelta vsync_interval_ = kInitialFlatlandVsyncOffset;
     fml::TimeDelta vsync_offset_ = kInitialFlatlandVsyncOffset;
     fml::TimePoint last_presentation_time_;
     FireCallbackCallback pending_fire_callback_;
     uint32_t present_credits_ = 1;
     bool initial_vsync_callback_ran_ = false;
+    // The start and target latch point of the frame that has not been
+    // presented yet.
+    std::optional<fml::TimePoint> pending_frame_start_;
+    std::optional<fml::TimePoint> pending_latch_point_;
+    fml::TimeDelta predicted_frame_duration_;
+    uint64_t latch_miss_count_ = 0;
   } threadsafe_state_;
 
   // Acquire fences sent to Flatland.
@@ -67,6 +67,18 @@ CreateFuturePresentationInfos(const fml::TimePoint& presentation_time_1,
   return infos;
 }
 
+std::vector<fuchsia::scenic::scheduling::PresentationInfo>
+CreateFuturePresentationInfos(const fml::TimePoint& presentation_time_1,
+                              const fml::TimePoint& latch_point_1,
+                              const fml::TimePoint& presentation_time_2,
+                              const fml::TimePoint& latch_point_2) {
+  auto infos =
+      CreateFuturePresentationInfos(presentation_time_1, presentation_time_2);
+  infos[0].set_latch_point(latch_point_1.ToEpochDelta().ToNanoseconds());
+  infos[1].set_latch_point(latch_point_2.ToEpochDelta().ToNanoseconds());
+  return infos;
+}
+
 }  // namespace
 
 class FlatlandConnectionTest : public ::testing::Test {
@@ -344,6 +356,69 @@ TEST_F(FlatlandConnectionTest, RunsOutOfFuturePresentationInfos) {
   EXPECT_TRUE(await_vsync_callback_fired);
 }
 
+TEST_F(FlatlandConnectionTest, CountsPresentsAfterLatchPoint) {
+  size_t presents_called = 0u;
+  fake_flatland().SetPresentHandler(
+      [&presents_called](auto present_args) { presents_called++; });
+
+  // Create the FlatlandConnection but don't pump the loop.  No FIDL calls are
+  // completed yet.
+  flutter_runner::FlatlandConnection flatland_connection(
+      GetCurrentTestName(), TakeFlatlandHandle(), []() { FAIL(); },
+      [](auto...) {}, loop().dispatcher());
+  loop().RunUntilIdle();
+
+  // The first frame has no latch point to miss.
+  bool await_vsync_fired = false;
+  AwaitVsyncChecked(flatland_connection, await_vsync_fired,
+                    kInitialFlatlandVsyncOffset);
+  EXPECT_TRUE(await_vsync_fired);
+  flatland_connection.Present();
+  loop().RunUntilIdle();
+  EXPECT_EQ(presents_called, 1u);
+  EXPECT_EQ(flatland_connection.latch_miss_count(), 0u);
+
+  // Target a presentation whose latch point has already passed.
+  auto now = fml::TimePoint::Now();
+  const auto kPresentationTime1 = now + fml::TimeDelta::FromSeconds(100);
+  const auto kPresentationTime2 = now + fml::TimeDelta::FromSeconds(200);
+  fuchsia::ui::composition::OnNextFrameBeginValues late_values;
+  late_values.set_additional_present_credits(1);
+  late_values.set_future_presentation_infos(CreateFuturePresentationInfos(
+      kPresentationTime1, now - fml::TimeDelta::FromMilliseconds(1),
+      kPresentationTime2, kPresentationTime2));
+  fake_flatland().FireOnNextFrameBeginEvent(std::move(late_values));
+  loop().RunUntilIdle();
+
+  await_vsync_fired = false;
+  AwaitVsyncChecked(flatland_connection, await_vsync_fired, kPresentationTime1);
+  EXPECT_TRUE(await_vsync_fired);
+  flatland_connection.Present();
+  loop().RunUntilIdle();
+  EXPECT_EQ(presents_called, 2u);
+  EXPECT_EQ(flatland_connection.latch_miss_count(), 1u);
+
+  // Target a presentation whose latch point is still ahead.
+  now = fml::TimePoint::Now();
+  const auto kPresentationTime3 = now + fml::TimeDelta::FromSeconds(300);
+  const auto kPresentationTime4 = now + fml::TimeDelta::FromSeconds(400);
+  fuchsia::ui::composition::OnNextFrameBeginValues early_values;
+  early_values.set_additional_present_credits(1);
+  early_values.set_future_presentation_infos(CreateFuturePresentationInfos(
+      kPresentationTime3, kPresentationTime3, kPresentationTime4,
+      kPresentationTime4));
+  fake_flatland().FireOnNextFrameBeginEvent(std::move(early_values));
+  loop().RunUntilIdle();
+
+  await_vsync_fired = false;
+  AwaitVsyncChecked(flatland_connection, await_vsync_fired, kPresentationTime3);
+  EXPECT_TRUE(await_vsync_fired);
+  flatland_connection.Present();
+  loop().RunUntilIdle();
+  EXPECT_EQ(presents_called, 3u);
+  EXPECT_EQ(flatland_connection.latch_miss_count(), 1u);
+}
+
 TEST_F(FlatlandConnectionTest, PresentCreditExhaustion) {
   // Set up callbacks which allow sensing of how many presents were handled.
   size_t num_presents_called = 0u;
@@ -73,6 +73,11 @@ std::unique_ptr<VulkanSurface> VulkanSurfacePool::GetCachedOrCreateSurface(
     const SkISize& size) {
   TRACE_EVENT2("flutter", "VulkanSurfacePool::GetCachedOrCreateSurface",
                "width", size.width(), "height", size.height());
+  if (std::find(requested_sizes_.begin(), requested_sizes_.end(), size) ==
+      requested_sizes_.end()) {
+    requested_sizes_.push_back(size);
+  }
+
   // First try to find a surface that exactly matches |size|.
   {
     auto exact_match_it =
@@ -84,10 +89,19 @@ std::unique_ptr<VulkanSurface> VulkanSurfacePool::GetCachedOrCreateSurface(
       auto acquired_surface = std::move(*exact_match_it);
       available_surfaces_.erase(exact_match_it);
       TRACE_EVENT_INSTANT0("flutter", "Exact match found");
+      trace_surfaces_reused_++;
       return acquired_surface;
     }
   }
 
+  // Make room for the new surface before allocating it, so that the surfaces
+  // it replaces and the new surface don't exceed the budget together.
+  const size_t new_surface_bytes =
+      static_cast<size_t>(size.width()) * size.height() * 4;
+  if (new_surface_bytes < kMaxCachedBytes) {
+    ReleaseCachedSurfaces(kMaxCachedBytes - new_surface_bytes);
+  }
+
   return CreateSurface(size);
 }
 
@@ -158,6 +172,7 @@ void VulkanSurfacePool::RecycleSurface(std::unique_ptr<VulkanSurface> surface) {
   // have not reached the maximum amount of cached surfaces.
   if (available_surfaces_.size() < kMaxSurfaces) {
     available_surfaces_.push_back(std::move(surface));
+    ReleaseCachedSurfaces(kMaxCachedBytes);
   } else {
     TRACE_EVENT_INSTANT0("flutter", "Too many surfaces in pool, dropping");
   }
@@ -167,15 +182,24 @@ void VulkanSurfacePool::RecycleSurface(std::unique_ptr<VulkanSurface> surface) {
 void VulkanSurfacePool::AgeAndCollectOldBuffers() {
   TRACE_EVENT0("flutter", "VulkanSurfacePool::AgeAndCollectOldBuffers");
 
-  // Remove all surfaces that are no longer valid or are too old.
+  // Remove all surfaces that are no longer valid or are too old.  Once a frame
+  // has asked for surfaces, those of other sizes (for example from before a
+  // resize) will not be reused, so they are removed right away.
   size_t size_before = available_surfaces_.size();
   available_surfaces_.erase(
-      std::remove_if(available_surfaces_.begin(), available_surfaces_.end(),
-                     [&](auto& surface) {
-                       return !surface->IsValid() ||
-                              surface->AdvanceAndGetAge() >= kMaxSurfaceAge;
-                     }),
+      std::remove_if(
+          available_surfaces_.begin(), available_surfaces_.end(),
+          [&](auto& surface) {
+            const bool size_requested =
+                requested_sizes_.empty() ||
+                std::find(requested_sizes_.begin(), requested_sizes_.end(),
+                          surface->GetSize()) != requested_sizes_.end();
+            return !surface->IsValid() ||
+                   surface->AdvanceAndGetAge() >= kMaxSurfaceAge ||
+                   !size_requested;
+          }),
       available_surfaces_.end());
+  requested_sizes_.clear();
   TRACE_EVENT1("flutter", "AgeAndCollect", "aged surfaces",
                (size_before - available_surfaces_.size()));
 
@@ -232,12 +256,50 @@ void VulkanSurfacePool::ShrinkToFit() {
   TraceStats();
 }
 
-void VulkanSurfacePool::TraceStats() {
-  // Resources held in cached buffers.
-  size_t cached_surfaces_bytes = 0;
+size_t VulkanSurfacePool::GetCachedBytes() const {
+  size_t cached_bytes = 0;
   for (const auto& surface : available_surfaces_) {
-    cached_surfaces_bytes += surface->GetAllocationSize();
+    cached_bytes += surface->GetAllocationSize();
+  }
+  return cached_bytes;
+}
+
+void VulkanSurfacePool::ReleaseCachedSurfaces(size_t max_bytes) {
+  size_t cached_bytes = GetCachedBytes();
+  if (cached_bytes <= max_bytes) {
+    return;
   }
+  TRACE_EVENT0("flutter", "VulkanSurfacePool::ReleaseCachedSurfaces");
+
+  // |available_surfaces_| is in the order the surfaces were recycled, so the
+  // first pass releases the least recently used surfaces of unrequested sizes
+  // and the second pass the least recently used of the rest.
+  for (bool release_requested_sizes : {false, true}) {
+    for (auto& surface : available_surfaces_) {
+      if (cached_bytes <= max_bytes) {
+        break;
+      }
+      if (!surface) {
+        continue;
+      }
+      const bool size_requested =
+          std::find(requested_sizes_.begin(), requested_sizes_.end(),
+                    surface->GetSize()) != requested_sizes_.end();
+      if (size_requested && !release_requested_sizes) {
+        continue;
+      }
+      cached_bytes -= surface->GetAllocationSize();
+      surface.reset();
+    }
+  }
+  available_surfaces_.erase(std::remove(available_surfaces_.begin(),
+                                        available_surfaces_.end(), nullptr),
+                            available_surfaces_.end());
+}
+
+void VulkanSurfacePool::TraceStats() {
+  // Resources held in cached buffers.
+  const size_t cached_surfaces_bytes = GetCachedBytes();
 
   // Resources held by Skia.
   int skia_resources = 0;
@@ -22,6 +22,9 @@ class VulkanSurfacePool final {
   static constexpr int kMaxSurfaces = 12;
   // If a surface doesn't get used for 3 or more generations, we discard it.
   static constexpr int kMaxSurfaceAge = 3;
+  // The most memory that cached surfaces may hold.  Surfaces of sizes that
+  // are no longer requested are released first when this is exceeded.
+  static constexpr size_t kMaxCachedBytes = 128u * 1024u * 1024u;
 
   VulkanSurfacePool(vulkan::VulkanProvider& vulkan_provider,
                     sk_sp<GrDirectContext> context);
@@ -48,11 +51,21 @@ class VulkanSurfacePool final {
   std::unordered_map<uintptr_t, std::unique_ptr<VulkanSurface>>
       pending_surfaces_;
 
+  // The sizes requested since the last call to |AgeAndCollectOldBuffers|.
+  std::vector<SkISize> requested_sizes_;
+
   size_t trace_surfaces_created_ = 0;
   size_t trace_surfaces_reused_ = 0;
 
   std::unique_ptr<VulkanSurface> GetCachedOrCreateSurface(const SkISize& size);
 
+  size_t GetCachedBytes() const;
+
+  // Releases cached surfaces, starting with the least recently recycled ones
+  // whose size was not requested recently, until they hold no more than
+  // |max_bytes|.
+  void ReleaseCachedSurfaces(size_t max_bytes);
+
   void RecycleSurface(std::unique_ptr<VulkanSurface> surface);
 
   void RecyclePendingSurface(uintptr_t surface_key);
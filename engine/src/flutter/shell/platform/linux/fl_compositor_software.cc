@@ -4,6 +4,8 @@
 
 #include "fl_compositor_software.h"
 
+#include <cmath>
+
 struct _FlCompositorSoftware {
   FlCompositor parent_instance;
 
@@ -19,6 +21,11 @@ struct _FlCompositorSoftware {
   // Surface to draw on view.
   cairo_surface_t* surface;
 
+  // Surface the next frame is composited into, only accessed from the Flutter
+  // rendering thread. Swapped with [surface] when complete so the buffers are
+  // reused and GTK isn't blocked while compositing.
+  cairo_surface_t* back_surface;
+
   // Ensure Flutter and GTK can access the surface.
   GMutex frame_mutex;
 };
@@ -27,41 +34,123 @@ G_DEFINE_TYPE(FlCompositorSoftware,
               fl_compositor_software,
               fl_compositor_get_type())
 
+// Limits drawing to the area of @layer that contains Flutter contents.
+// Returns TRUE if this is less than the whole frame.
+static gboolean clip_to_paint_region(cairo_t* cr, const FlutterLayer* layer) {
+  const FlutterRegion* region =
+      layer->backing_store_present_info != nullptr
+          ? layer->backing_store_present_info->paint_region
+          : nullptr;
+  if (region == nullptr) {
+    cairo_rectangle(cr, layer->offset.x, layer->offset.y, layer->size.width,
+                    layer->size.height);
+    cairo_clip(cr);
+    cairo_surface_t* target = cairo_get_target(cr);
+    return layer->offset.x != 0 || layer->offset.y != 0 ||
+           layer->size.width < cairo_image_surface_get_width(target) ||
+           layer->size.height < cairo_image_surface_get_height(target);
+  }
+
+  for (size_t i = 0; i < region->rects_count; i++) {
+    // Round out to whole pixels so the copy doesn't need antialiasing.
+    const FlutterRect* rect = &region->rects[i];
+    double left = floor(rect->left);
+    double top = floor(rect->top);
+    cairo_rectangle(cr, layer->offset.x + left, layer->offset.y + top,
+                    ceil(rect->right) - left, ceil(rect->bottom) - top);
+  }
+  cairo_clip(cr);
+  return TRUE;
+}
+
+// Composites @layer into @cr. The first layer replaces the existing contents,
+// others are blended over them.
+static void composite_layer(cairo_t* cr,
+                            const FlutterLayer* layer,
+                            gboolean first) {
+  const FlutterSoftwareBackingStore* software = &layer->backing_store->software;
+
+  // Flutter renders premultiplied BGRA, which is the same as Cairo's
+  // native-endian ARGB32 so the pixels are used without conversion.
+  cairo_surface_t* source = cairo_image_surface_create_for_data(
+      static_cast<unsigned char*>(const_cast<void*>(software->allocation)),
+      CAIRO_FORMAT_ARGB32, software->row_bytes / 4, software->height,
+      software->row_bytes);
+
+  cairo_save(cr);
+  // Everything outside the paint region is transparent, so only the region
+  // needs to be copied or blended.
+  if (clip_to_paint_region(cr, layer) && first) {
+    cairo_save(cr);
+    cairo_reset_clip(cr);
+    cairo_set_operator(cr, CAIRO_OPERATOR_CLEAR);
+    cairo_paint(cr);
+    cairo_restore(cr);
+  }
+  cairo_set_operator(cr, first ? CAIRO_OPERATOR_SOURCE : CAIRO_OPERATOR_OVER);
+  cairo_set_source_surface(cr, source, layer->offset.x, layer->offset.y);
+  cairo_paint(cr);
+  cairo_restore(cr);
+
+  cairo_surface_destroy(source);
+}
+
 static gboolean fl_compositor_software_present_layers(
     FlCompositor* compositor,
     const FlutterLayer** layers,
     size_t layers_count) {
   FlCompositorSoftware* self = FL_COMPOSITOR_SOFTWARE(compositor);
 
-  g_autoptr(GMutexLocker) locker = g_mutex_locker_new(&self->frame_mutex);
-
   if (layers_count == 0) {
     return TRUE;
   }
 
-  self->width = layers[0]->size.width;
-  self->height = layers[0]->size.height;
+  size_t width = layers[0]->size.width;
+  size_t height = layers[0]->size.height;
+
+  // Reuse the surface from two frames ago unless the size has changed.
+  if (self->back_surface != nullptr &&
+      (static_cast<size_t>(cairo_image_surface_get_width(
+           self->back_surface)) != width ||
+       static_cast<size_t>(cairo_image_surface_get_height(
+           self->back_surface)) != height)) {
+    g_clear_pointer(&self->back_surface, cairo_surface_destroy);
+  }
+  if (self->back_surface == nullptr) {
+    self->back_surface =
+        cairo_image_surface_create(CAIRO_FORMAT_ARGB32, width, height);
+  }
 
-  // TODO(robert-ancell): Support multiple layers
-  if (layers_count == 1) {
-    const FlutterLayer* layer = layers[0];
-    g_assert(layer->type == kFlutterLayerContentTypeBackingStore);
+  // The scale is set when drawing on the view, compositing is in pixels.
+  cairo_surface_set_device_scale(self->back_surface, 1.0, 1.0);
+
+  // Pixman implements the copies and blending with SIMD where supported.
+  cairo_t* cr = cairo_create(self->back_surface);
+  gboolean first = TRUE;
+  for (size_t i = 0; i < layers_count; i++) {
+    const FlutterLayer* layer = layers[i];
+    // Platform views are not supported.
+    if (layer->type != kFlutterLayerContentTypeBackingStore) {
+      continue;
+    }
     g_assert(layer->backing_store->type == kFlutterBackingStoreTypeSoftware);
-    const FlutterBackingStore* backing_store = layer->backing_store;
-
-    size_t allocation_length =
-        backing_store->software.row_bytes * backing_store->software.height;
-    unsigned char* old_data = self->surface != nullptr
-                                  ? cairo_image_surface_get_data(self->surface)
-                                  : nullptr;
-    unsigned char* data =
-        static_cast<unsigned char*>(realloc(old_data, allocation_length));
-    memcpy(data, backing_store->software.allocation, allocation_length);
-    cairo_surface_destroy(self->surface);
-    self->surface = cairo_image_surface_create_for_data(
-        data, CAIRO_FORMAT_ARGB32, backing_store->software.row_bytes / 4,
-        backing_store->software.height, backing_store->software.row_bytes);
+    composite_layer(cr, layer, first);
+    first = FALSE;
+  }
+  if (first) {
+    cairo_set_operator(cr, CAIRO_OPERATOR_CLEAR);
+    cairo_paint(cr);
   }
+  cairo_destroy(cr);
+  cairo_surface_flush(self->back_surface);
+
+  g_mutex_lock(&self->frame_mutex);
+  cairo_surface_t* surface = self->surface;
+  self->surface = self->back_surface;
+  self->back_surface = surface;
+  self->width = width;
+  self->height = height;
+  g_mutex_unlock(&self->frame_mutex);
 
   fl_task_runner_stop_wait(self->task_runner);
 
@@ -100,10 +189,8 @@ static void fl_compositor_software_dispose(GObject* object) {
   FlCompositorSoftware* self = FL_COMPOSITOR_SOFTWARE(object);
 
   g_clear_object(&self->task_runner);
-  if (self->surface != nullptr) {
-    free(cairo_image_surface_get_data(self->surface));
-  }
   g_clear_pointer(&self->surface, cairo_surface_destroy);
+  g_clear_pointer(&self->back_surface, cairo_surface_destroy);
   g_mutex_clear(&self->frame_mutex);
 
   G_OBJECT_CLASS(fl_compositor_software_parent_class)->dispose(object);
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include <thread>
+#include <vector>
 #include "gtest/gtest.h"
 
 #include "flutter/common/constants.h"
@@ -115,3 +116,68 @@ TEST(FlCompositorSoftwareTest, Resize) {
 
   latch.Wait();
 }
+
+TEST(FlCompositorSoftwareTest, MultipleLayers) {
+  g_autoptr(FlDartProject) project = fl_dart_project_new();
+  g_autoptr(FlEngine) engine = fl_engine_new(project);
+  g_autoptr(FlTaskRunner) task_runner = fl_task_runner_new(engine);
+
+  g_autoptr(FlCompositorSoftware) compositor =
+      fl_compositor_software_new(task_runner);
+
+  // Opaque red background.
+  constexpr size_t width = 100;
+  constexpr size_t height = 100;
+  std::vector<uint32_t> layer1_data(width * height, 0xffff0000);
+  FlutterBackingStore backing_store1 = {
+      .type = kFlutterBackingStoreTypeSoftware,
+      .software = {.allocation = layer1_data.data(),
+                   .row_bytes = width * 4,
+                   .height = height}};
+  FlutterLayer layer1 = {.type = kFlutterLayerContentTypeBackingStore,
+                         .backing_store = &backing_store1,
+                         .offset = {0, 0},
+                         .size = {width, height}};
+
+  // Half transparent blue, of which only the top left is painted.
+  std::vector<uint32_t> layer2_data(width * height, 0x80000080);
+  FlutterBackingStore backing_store2 = {
+      .type = kFlutterBackingStoreTypeSoftware,
+      .software = {.allocation = layer2_data.data(),
+                   .row_bytes = width * 4,
+                   .height = height}};
+  FlutterRect paint_rect = {0, 0, 50, 50};
+  FlutterRegion paint_region = {.struct_size = sizeof(FlutterRegion),
+                                .rects_count = 1,
+                                .rects = &paint_rect};
+  FlutterBackingStorePresentInfo present_info = {
+      .struct_size = sizeof(FlutterBackingStorePresentInfo),
+      .paint_region = &paint_region};
+  FlutterLayer layer2 = {.type = kFlutterLayerContentTypeBackingStore,
+                         .backing_store = &backing_store2,
+                         .offset = {0, 0},
+                         .size = {width, height},
+                         .backing_store_present_info = &present_info};
+
+  const FlutterLayer* layers[2] = {&layer1, &layer2};
+  std::thread([&]() {
+    fl_compositor_present_layers(FL_COMPOSITOR(compositor), layers, 2);
+  }).join();
+
+  int stride = cairo_format_stride_for_width(CAIRO_FORMAT_ARGB32, width);
+  g_autofree unsigned char* image_data =
+      static_cast<unsigned char*>(malloc(height * stride));
+  cairo_surface_t* surface = cairo_image_surface_create_for_data(
+      image_data, CAIRO_FORMAT_ARGB32, width, height, stride);
+  cairo_t* cr = cairo_create(surface);
+  fl_compositor_render(FL_COMPOSITOR(compositor), cr, nullptr);
+  cairo_surface_flush(surface);
+
+  // Blue blended over red inside the paint region, red outside it.
+  const uint32_t* pixels = reinterpret_cast<uint32_t*>(image_data);
+  EXPECT_EQ(pixels[10 * stride / 4 + 10], 0xff7f0080);
+  EXPECT_EQ(pixels[75 * stride / 4 + 75], 0xffff0000);
+
+  cairo_surface_destroy(surface);
+  cairo_destroy(cr);
+}
@@ -0,0 +1,708 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "fl_compositor_vulkan.h"
+
+#include <gdk/gdkwayland.h>
+#include <gdk/gdkx.h>
+#include <vulkan/vulkan_wayland.h>
+#include <vulkan/vulkan_xlib.h>
+
+#include <cstring>
+
+struct _FlCompositorVulkan {
+  FlCompositor parent_instance;
+
+  // Task runner to wait for frames on.
+  FlTaskRunner* task_runner;
+
+  // Vulkan device and queue shared with Flutter.
+  FlVulkanManager* vulkan_manager;
+
+  // Surface frames are presented to.
+  VkSurfaceKHR surface;
+
+  // When using Wayland, the subsurface the Vulkan surface is on.
+  struct wl_subcompositor* wl_subcompositor;
+  struct wl_surface* wl_surface;
+  struct wl_subsurface* wl_subsurface;
+
+  // Swapchain on [surface], accessed from the Flutter rendering thread.
+  VkSwapchainKHR swapchain;
+  VkExtent2D swapchain_extent;
+  gboolean swapchain_out_of_date;
+
+  // Images in [swapchain] and the semaphores presenting each one waits on.
+  GArray* swapchain_images;
+  GArray* present_semaphores;
+
+  // Commands to copy a layer into the swapchain.
+  VkCommandPool command_pool;
+  VkCommandBuffer command_buffer;
+
+  // Signalled when a swapchain image is acquired.
+  VkSemaphore acquire_semaphore;
+
+  // Signalled when [command_buffer] has completed.
+  VkFence fence;
+
+  // Size of the last presented frame in pixels.
+  size_t width;
+  size_t height;
+
+  // Ensure Flutter and GTK can access the frame size.
+  GMutex frame_mutex;
+};
+
+G_DEFINE_TYPE(FlCompositorVulkan,
+              fl_compositor_vulkan,
+              fl_compositor_get_type())
+
+static void registry_handle_global(void* data,
+                                   struct wl_registry* registry,
+                                   uint32_t name,
+                                   const char* interface,
+                                   uint32_t version) {
+  FlCompositorVulkan* self = FL_COMPOSITOR_VULKAN(data);
+  if (strcmp(interface, wl_subcompositor_interface.name) == 0) {
+    self->wl_subcompositor = static_cast<struct wl_subcompositor*>(
+        wl_registry_bind(registry, name, &wl_subcompositor_interface, 1));
+  }
+}
+
+static void registry_handle_global_remove(void* data,
+                                          struct wl_registry* registry,
+                                          uint32_t name) {}
+
+static const struct wl_registry_listener registry_listener = {
+    .global = registry_handle_global,
+    .global_remove = registry_handle_global_remove,
+};
+
+// Binds the subcompositor, which GDK does not expose. A private queue is used
+// so GDK doesn't receive the registry events.
+static void bind_wl_subcompositor(FlCompositorVulkan* self,
+                                  struct wl_display* wl_display) {
+  struct wl_event_queue* queue = wl_display_create_queue(wl_display);
+  struct wl_display* wrapper =
+      static_cast<struct wl_display*>(wl_proxy_create_wrapper(wl_display));
+  wl_proxy_set_queue(reinterpret_cast<struct wl_proxy*>(wrapper), queue);
+  struct wl_registry* registry = wl_display_get_registry(wrapper);
+  wl_registry_add_listener(registry, &registry_listener, self);
+  wl_display_roundtrip_queue(wl_display, queue);
+  wl_registry_destroy(registry);
+  wl_proxy_wrapper_destroy(wrapper);
+  if (self->wl_subcompositor != nullptr) {
+    wl_proxy_set_queue(
+        reinterpret_cast<struct wl_proxy*>(self->wl_subcompositor), nullptr);
+  }
+  wl_event_queue_destroy(queue);
+}
+
+// Creates a surface on a subsurface of the toplevel of @window.
+static VkSurfaceKHR create_wayland_surface(FlCompositorVulkan* self,
+                                           GdkWindow* window) {
+  GdkDisplay* display = gdk_window_get_display(window);
+  struct wl_display* wl_display = gdk_wayland_display_get_wl_display(display);
+  struct wl_compositor* wl_compositor =
+      gdk_wayland_display_get_wl_compositor(display);
+  struct wl_surface* parent =
+      gdk_wayland_window_get_wl_surface(gdk_window_get_toplevel(window));
+
+  bind_wl_subcompositor(self, wl_display);
+  if (self->wl_subcompositor == nullptr || parent == nullptr) {
+    g_warning("Failed to create Wayland subsurface for Vulkan");
+    return VK_NULL_HANDLE;
+  }
+
+  self->wl_surface = wl_compositor_create_surface(wl_compositor);
+  self->wl_subsurface = wl_subcompositor_get_subsurface(
+      self->wl_subcompositor, self->wl_surface, parent);
+  // Frames are presented independently of GTK drawing the toplevel.
+  wl_subsurface_set_desync(self->wl_subsurface);
+  // Let input go through to the window below.
+  struct wl_region* region = wl_compositor_create_region(wl_compositor);
+  wl_surface_set_input_region(self->wl_surface, region);
+  wl_region_destroy(region);
+
+  const FlVulkanProcs* procs =
+      fl_vulkan_manager_get_procs(self->vulkan_manager);
+  VkInstance instance = fl_vulkan_manager_get_instance(self->vulkan_manager);
+  auto create_surface = reinterpret_cast<PFN_vkCreateWaylandSurfaceKHR>(
+      procs->GetInstanceProcAddr(instance, "vkCreateWaylandSurfaceKHR"));
+  VkWaylandSurfaceCreateInfoKHR create_info = {};
+  create_info.sType = VK_STRUCTURE_TYPE_WAYLAND_SURFACE_CREATE_INFO_KHR;
+  create_info.display = wl_display;
+  create_info.surface = self->wl_surface;
+  VkSurfaceKHR surface = VK_NULL_HANDLE;
+  if (create_surface == nullptr ||
+      create_surface(instance, &create_info, nullptr, &surface) !=
+          VK_SUCCESS) {
+    g_warning("Failed to create Vulkan surface");
+    return VK_NULL_HANDLE;
+  }
+  return surface;
+}
+
+// Creates a surface on native X11 @window.
+static VkSurfaceKHR create_xlib_surface(FlCompositorVulkan* self,
+                                        GdkWindow* window) {
+  const FlVulkanProcs* procs =
+      fl_vulkan_manager_get_procs(self->vulkan_manager);
+  VkInstance instance = fl_vulkan_manager_get_instance(self->vulkan_manager);
+  auto create_surface = reinterpret_cast<PFN_vkCreateXlibSurfaceKHR>(
+      procs->GetInstanceProcAddr(instance, "vkCreateXlibSurfaceKHR"));
+  VkXlibSurfaceCreateInfoKHR create_info = {};
+  create_info.sType = VK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR;
+  create_info.dpy =
+      gdk_x11_display_get_xdisplay(gdk_window_get_display(window));
+  create_info.window = gdk_x11_window_get_xid(window);
+  VkSurfaceKHR surface = VK_NULL_HANDLE;
+  if (create_surface == nullptr ||
+      create_surface(instance, &create_info, nullptr, &surface) !=
+          VK_SUCCESS) {
+    g_warning("Failed to create Vulkan surface");
+    return VK_NULL_HANDLE;
+  }
+  return surface;
+}
+
+// Destroys the swapchain and the semaphores for its images.
+static void destroy_swapchain(FlCompositorVulkan* self) {
+  const FlVulkanProcs* procs =
+      fl_vulkan_manager_get_procs(self->vulkan_manager);
+  VkDevice device = fl_vulkan_manager_get_device(self->vulkan_manager);
+
+  for (guint i = 0; i < self->present_semaphores->len; i++) {
+    procs->DestroySemaphore(
+        device, g_array_index(self->present_semaphores, VkSemaphore, i),
+        nullptr);
+  }
+  g_array_set_size(self->present_semaphores, 0);
+  g_array_set_size(self->swapchain_images, 0);
+  if (self->swapchain != VK_NULL_HANDLE) {
+    procs->DestroySwapchainKHR(device, self->swapchain, nullptr);
+    self->swapchain = VK_NULL_HANDLE;
+  }
+}
+
+// Picks the swapchain format, preferring the format Flutter renders in so no
+// conversion is required.
+static VkSurfaceFormatKHR pick_surface_format(FlCompositorVulkan* self) {
+  const FlVulkanProcs* procs =
+      fl_vulkan_manager_get_procs(self->vulkan_manager);
+  VkPhysicalDevice physical_device =
+      fl_vulkan_manager_get_physical_device(self->vulkan_manager);
+
+  uint32_t formats_count = 0;
+  procs->GetPhysicalDeviceSurfaceFormatsKHR(physical_device, self->surface,
+                                            &formats_count, nullptr);
+  g_autofree VkSurfaceFormatKHR* formats =
+      g_new0(VkSurfaceFormatKHR, formats_count);
+  procs->GetPhysicalDeviceSurfaceFormatsKHR(physical_device, self->surface,
+                                            &formats_count, formats);
+  VkSurfaceFormatKHR format = {VK_FORMAT_B8G8R8A8_UNORM,
+                               VK_COLOR_SPACE_SRGB_NONLINEAR_KHR};
+  for (uint32_t i = 0; i < formats_count; i++) {
+    if (formats[i].format == VK_FORMAT_B8G8R8A8_UNORM &&
+        formats[i].colorSpace == VK_COLOR_SPACE_SRGB_NONLINEAR_KHR) {
+      return formats[i];
+    }
+  }
+  if (formats_count > 0) {
+    format = formats[0];
+  }
+  return format;
+}
+
+// (Re)creates the swapchain for frames of the given size.
+static gboolean create_swapchain(FlCompositorVulkan* self,
+                                 uint32_t width,
+                                 uint32_t height) {
+  const FlVulkanProcs* procs =
+      fl_vulkan_manager_get_procs(self->vulkan_manager);
+  VkPhysicalDevice physical_device =
+      fl_vulkan_manager_get_physical_device(self->vulkan_manager);
+  VkDevice device = fl_vulkan_manager_get_device(self->vulkan_manager);
+
+  VkSurfaceCapabilitiesKHR capabilities;
+  if (procs->GetPhysicalDeviceSurfaceCapabilitiesKHR(
+          physical_device, self->surface, &capabilities) != VK_SUCCESS) {
+    return FALSE;
+  }
+
+  // X11 sizes the swapchain to the window, Wayland to the frames.
+  VkExtent2D extent = capabilities.currentExtent;
+  if (extent.width == UINT32_MAX) {
+    extent.width = CLAMP(width, capabilities.minImageExtent.width,
+                         capabilities.maxImageExtent.width);
+    extent.height = CLAMP(height, capabilities.minImageExtent.height,
+                          capabilities.maxImageExtent.height);
+  }
+  if (extent.width == 0 || extent.height == 0) {
+    return FALSE;
+  }
+
+  uint32_t image_count = capabilities.minImageCount + 1;
+  if (capabilities.maxImageCount > 0 &&
+      image_count > capabilities.maxImageCount) {
+    image_count = capabilities.maxImageCount;
+  }
+
+  // Frames have premultiplied alpha, so prefer showing what is behind them.
+  VkCompositeAlphaFlagBitsKHR composite_alpha =
+      VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+  if (capabilities.supportedCompositeAlpha &
+      VK_COMPOSITE_ALPHA_PRE_MULTIPLIED_BIT_KHR) {
+    composite_alpha = VK_COMPOSITE_ALPHA_PRE_MULTIPLIED_BIT_KHR;
+  } else if (capabilities.supportedCompositeAlpha &
+             VK_COMPOSITE_ALPHA_INHERIT_BIT_KHR) {
+    composite_alpha = VK_COMPOSITE_ALPHA_INHERIT_BIT_KHR;
+  }
+
+  VkSurfaceFormatKHR format = pick_surface_format(self);
+
+  VkSwapchainKHR old_swapchain = self->swapchain;
+  VkSwapchainCreateInfoKHR create_info = {};
+  create_info.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
+  create_info.surface = self->surface;
+  create_info.minImageCount = image_count;
+  create_info.imageFormat = format.format;
+  create_info.imageColorSpace = format.colorSpace;
+  create_info.imageExtent = extent;
+  create_info.imageArrayLayers = 1;
+  create_info.imageUsage =
+      VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+  create_info.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
+  create_info.preTransform = capabilities.currentTransform;
+  create_info.compositeAlpha = composite_alpha;
+  // Presents at the display refresh rate, and is always supported.
+  create_info.presentMode = VK_PRESENT_MODE_FIFO_KHR;
+  create_info.clipped = VK_TRUE;
+  create_info.oldSwapchain = old_swapchain;
+  VkSwapchainKHR swapchain = VK_NULL_HANDLE;
+  VkResult result =
+      procs->CreateSwapchainKHR(device, &create_info, nullptr, &swapchain);
+
+  // Images of the old swapchain may still be being presented.
+  procs->QueueWaitIdle(fl_vulkan_manager_get_queue(self->vulkan_manager));
+  destroy_swapchain(self);
+  if (result != VK_SUCCESS) {
+    g_warning("Failed to create Vulkan swapchain: %d", result);
+    return FALSE;
+  }
+  self->swapchain = swapchain;
+  self->swapchain_extent = extent;
+  self->swapchain_out_of_date = FALSE;
+
+  uint32_t images_count = 0;
+  procs->GetSwapchainImagesKHR(device, swapchain, &images_count, nullptr);
+  g_array_set_size(self->swapchain_images, images_count);
+  procs->GetSwapchainImagesKHR(
+      device, swapchain, &images_count,
+      reinterpret_cast<VkImage*>(self->swapchain_images->data));
+
+  VkSemaphoreCreateInfo semaphore_info = {};
+  semaphore_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+  for (uint32_t i = 0; i < images_count; i++) {
+    VkSemaphore semaphore = VK_NULL_HANDLE;
+    procs->CreateSemaphore(device, &semaphore_info, nullptr, &semaphore);
+    g_array_append_val(self->present_semaphores, semaphore);
+  }
+
+  return TRUE;
+}
+
+// Records commands to copy @image into @swapchain_image.
+static void record_copy(FlCompositorVulkan* self,
+                        const FlutterLayer* layer,
+                        VkImage image,
+                        VkImage swapchain_image) {
+  const FlVulkanProcs* procs =
+      fl_vulkan_manager_get_procs(self->vulkan_manager);
+
+  VkCommandBufferBeginInfo begin_info = {};
+  begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+  begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+  procs->BeginCommandBuffer(self->command_buffer, &begin_info);
+
+  VkImageSubresourceRange range = {};
+  range.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+  range.levelCount = 1;
+  range.layerCount = 1;
+
+  // Flutter leaves the image it rendered in VK_IMAGE_LAYOUT_GENERAL, after
+  // submitting to the same queue.
+  VkImageMemoryBarrier barriers[2] = {};
+  barriers[0].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+  barriers[0].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+  barriers[0].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+  barriers[0].oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+  barriers[0].newLayout = VK_IMAGE_LAYOUT_GENERAL;
+  barriers[0].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+  barriers[0].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+  barriers[0].image = image;
+  barriers[0].subresourceRange = range;
+  barriers[1].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+  barriers[1].srcAccessMask = 0;
+  barriers[1].dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+  barriers[1].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+  barriers[1].newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+  barriers[1].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+  barriers[1].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+  barriers[1].image = swapchain_image;
+  barriers[1].subresourceRange = range;
+  procs->CmdPipelineBarrier(self->command_buffer,
+                            VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+                                VK_PIPELINE_STAGE_TRANSFER_BIT,
+                            VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                            nullptr, 2, barriers);
+
+  // The swapchain only differs in size from the frame while resizing.
+  int32_t width = MIN(static_cast<int32_t>(layer->size.width),
+                      static_cast<int32_t>(self->swapchain_extent.width));
+  int32_t height = MIN(static_cast<int32_t>(layer->size.height),
+                       static_cast<int32_t>(self->swapchain_extent.height));
+  if (width != static_cast<int32_t>(self->swapchain_extent.width) ||
+      height != static_cast<int32_t>(self->swapchain_extent.height)) {
+    VkClearColorValue transparent = {};
+    procs->CmdClearColorImage(self->command_buffer, swapchain_image,
+                              VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                              &transparent, 1, &range);
+    VkMemoryBarrier clear_barrier = {};
+    clear_barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    clear_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    clear_barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    procs->CmdPipelineBarrier(
+        self->command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &clear_barrier, 0, nullptr, 0,
+        nullptr);
+  }
+
+  VkImageBlit region = {};
+  region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+  region.srcSubresource.layerCount = 1;
+  region.srcOffsets[1] = {width, height, 1};
+  region.dstSubresource = region.srcSubresource;
+  region.dstOffsets[1] = {width, height, 1};
+  procs->CmdBlitImage(self->command_buffer, image, VK_IMAGE_LAYOUT_GENERAL,
+                      swapchain_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1,
+                      &region, VK_FILTER_NEAREST);
+
+  // Flutter must not render the next frame into the image until it has been
+  // copied.
+  barriers[0].srcAccessMask = 0;
+  barriers[0].dstAccessMask = 0;
+  barriers[1].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+  barriers[1].dstAccessMask = 0;
+  barriers[1].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+  barriers[1].newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+  procs->CmdPipelineBarrier(self->command_buffer,
+                            VK_PIPELINE_STAGE_TRANSFER_BIT,
+                            VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+                                VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                            0, 0, nullptr, 0, nullptr, 2, barriers);
+
+  procs->EndCommandBuffer(self->command_buffer);
+}
+
+// Copies the backing store of a layer into the swapchain and presents it.
+static gboolean present_layer(FlCompositorVulkan* self,
+                              const FlutterLayer* layer) {
+  const FlVulkanProcs* procs =
+      fl_vulkan_manager_get_procs(self->vulkan_manager);
+  VkDevice device = fl_vulkan_manager_get_device(self->vulkan_manager);
+  VkQueue queue = fl_vulkan_manager_get_queue(self->vulkan_manager);
+
+  // Wait for the previous frame to be copied before reusing its resources.
+  procs->WaitForFences(device, 1, &self->fence, VK_TRUE, UINT64_MAX);
+
+  uint32_t width = layer->size.width;
+  uint32_t height = layer->size.height;
+  if (self->swapchain == VK_NULL_HANDLE || self->swapchain_out_of_date ||
+      self->swapchain_extent.width != width ||
+      self->swapchain_extent.height != height) {
+    if (!create_swapchain(self, width, height)) {
+      return FALSE;
+    }
+  }
+
+  uint32_t image_index = 0;
+  VkResult result = procs->AcquireNextImageKHR(
+      device, self->swapchain, UINT64_MAX, self->acquire_semaphore,
+      VK_NULL_HANDLE, &image_index);
+  if (result == VK_ERROR_OUT_OF_DATE_KHR) {
+    if (!create_swapchain(self, width, height)) {
+      return FALSE;
+    }
+    result = procs->AcquireNextImageKHR(device, self->swapchain, UINT64_MAX,
+                                        self->acquire_semaphore,
+                                        VK_NULL_HANDLE, &image_index);
+  }
+  if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) {
+    g_warning("Failed to acquire Vulkan swapchain image: %d", result);
+    return FALSE;
+  }
+
+  VkImage image = reinterpret_cast<VkImage>(
+      layer->backing_store->vulkan.image->image);
+  VkImage swapchain_image =
+      g_array_index(self->swapchain_images, VkImage, image_index);
+  record_copy(self, layer, image, swapchain_image);
+
+  VkSemaphore present_semaphore =
+      g_array_index(self->present_semaphores, VkSemaphore, image_index);
+  VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+  VkSubmitInfo submit_info = {};
+  submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+  submit_info.waitSemaphoreCount = 1;
+  submit_info.pWaitSemaphores = &self->acquire_semaphore;
+  submit_info.pWaitDstStageMask = &wait_stage;
+  submit_info.commandBufferCount = 1;
+  submit_info.pCommandBuffers = &self->command_buffer;
+  submit_info.signalSemaphoreCount = 1;
+  submit_info.pSignalSemaphores = &present_semaphore;
+  procs->ResetFences(device, 1, &self->fence);
+  result = procs->QueueSubmit(queue, 1, &submit_info, self->fence);
+  if (result != VK_SUCCESS) {
+    g_warning("Failed to submit Vulkan commands: %d", result);
+    return FALSE;
+  }
+
+  VkPresentInfoKHR present_info = {};
+  present_info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+  present_info.waitSemaphoreCount = 1;
+  present_info.pWaitSemaphores = &present_semaphore;
+  present_info.swapchainCount = 1;
+  present_info.pSwapchains = &self->swapchain;
+  present_info.pImageIndices = &image_index;
+  result = procs->QueuePresentKHR(queue, &present_info);
+  if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR) {
+    self->swapchain_out_of_date = TRUE;
+  } else if (result != VK_SUCCESS) {
+    g_warning("Failed to present Vulkan swapchain image: %d", result);
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+static gboolean fl_compositor_vulkan_present_layers(FlCompositor* compositor,
+                                                    const FlutterLayer** layers,
+                                                    size_t layers_count) {
+  FlCompositorVulkan* self = FL_COMPOSITOR_VULKAN(compositor);
+
+  if (layers_count == 0) {
+    return TRUE;
+  }
+
+  // The Linux embedder has no platform views, which are the only content
+  // that splits a frame into more than one layer.
+  const FlutterLayer* layer = layers[0];
+  gboolean result = TRUE;
+  if (self->surface != VK_NULL_HANDLE &&
+      layer->type == kFlutterLayerContentTypeBackingStore) {
+    result = present_layer(self, layer);
+  }
+
+  // Update the size even if the frame couldn't be shown so GTK doesn't wait
+  // for it forever.
+  g_mutex_lock(&self->frame_mutex);
+  self->width = layer->size.width;
+  self->height = layer->size.height;
+  g_mutex_unlock(&self->frame_mutex);
+
+  fl_task_runner_stop_wait(self->task_runner);
+
+  return result;
+}
+
+static gboolean fl_compositor_vulkan_render(FlCompositor* compositor,
+                                            cairo_t* cr,
+                                            GdkWindow* window) {
+  FlCompositorVulkan* self = FL_COMPOSITOR_VULKAN(compositor);
+
+  gint scale_factor = gdk_window_get_scale_factor(window);
+
+  // Keep the subsurface over the window. This takes effect when GTK commits
+  // the toplevel after drawing.
+  if (self->wl_subsurface != nullptr) {
+    GdkWindow* toplevel = gdk_window_get_toplevel(window);
+    gint x = 0, y = 0;
+    for (GdkWindow* w = window; w != nullptr && w != toplevel;
+         w = gdk_window_get_parent(w)) {
+      gint window_x, window_y;
+      gdk_window_get_position(w, &window_x, &window_y);
+      x += window_x;
+      y += window_y;
+    }
+    wl_subsurface_set_position(self->wl_subsurface, x, y);
+    wl_surface_set_buffer_scale(self->wl_surface, scale_factor);
+  }
+
+  g_autoptr(GMutexLocker) locker = g_mutex_locker_new(&self->frame_mutex);
+
+  if (self->width == 0 || self->height == 0) {
+    return FALSE;
+  }
+
+  // If frame not ready, then wait for it. Frames are shown when presented, so
+  // this only keeps resizing the window in step with Flutter.
+  size_t width = gdk_window_get_width(window) * scale_factor;
+  size_t height = gdk_window_get_height(window) * scale_factor;
+  while (self->width != width || self->height != height) {
+    g_mutex_unlock(&self->frame_mutex);
+    fl_task_runner_wait(self->task_runner);
+    g_mutex_lock(&self->frame_mutex);
+  }
+
+  return TRUE;
+}
+
+static void fl_compositor_vulkan_dispose(GObject* object) {
+  FlCompositorVulkan* self = FL_COMPOSITOR_VULKAN(object);
+
+  if (self->vulkan_manager != nullptr) {
+    const FlVulkanProcs* procs =
+        fl_vulkan_manager_get_procs(self->vulkan_manager);
+    VkDevice device = fl_vulkan_manager_get_device(self->vulkan_manager);
+    procs->QueueWaitIdle(fl_vulkan_manager_get_queue(self->vulkan_manager));
+
+    destroy_swapchain(self);
+    if (self->surface != VK_NULL_HANDLE) {
+      procs->DestroySurfaceKHR(
+          fl_vulkan_manager_get_instance(self->vulkan_manager), self->surface,
+          nullptr);
+      self->surface = VK_NULL_HANDLE;
+    }
+    if (self->fence != VK_NULL_HANDLE) {
+      procs->DestroyFence(device, self->fence, nullptr);
+      self->fence = VK_NULL_HANDLE;
+    }
+    if (self->acquire_semaphore != VK_NULL_HANDLE) {
+      procs->DestroySemaphore(device, self->acquire_semaphore, nullptr);
+      self->acquire_semaphore = VK_NULL_HANDLE;
+    }
+    if (self->command_pool != VK_NULL_HANDLE) {
+      procs->DestroyCommandPool(device, self->command_pool, nullptr);
+      self->command_pool = VK_NULL_HANDLE;
+    }
+  }
+
+  g_clear_pointer(&self->wl_subsurface, wl_subsurface_destroy);
+  g_clear_pointer(&self->wl_surface, wl_surface_destroy);
+  g_clear_pointer(&self->wl_subcompositor, wl_subcompositor_destroy);
+  g_clear_pointer(&self->swapchain_images, g_array_unref);
+  g_clear_pointer(&self->present_semaphores, g_array_unref);
+  g_clear_object(&self->vulkan_manager);
+  g_clear_object(&self->task_runner);
+  g_mutex_clear(&self->frame_mutex);
+
+  G_OBJECT_CLASS(fl_compositor_vulkan_parent_class)->dispose(object);
+}
+
+static void fl_compositor_vulkan_class_init(FlCompositorVulkanClass* klass) {
+  FL_COMPOSITOR_CLASS(klass)->present_layers =
+      fl_compositor_vulkan_present_layers;
+  FL_COMPOSITOR_CLASS(klass)->render = fl_compositor_vulkan_render;
+
+  G_OBJECT_CLASS(klass)->dispose = fl_compositor_vulkan_dispose;
+}
+
+static void fl_compositor_vulkan_init(FlCompositorVulkan* self) {
+  self->swapchain_images = g_array_new(FALSE, TRUE, sizeof(VkImage));
+  self->present_semaphores = g_array_new(FALSE, TRUE, sizeof(VkSemaphore));
+  g_mutex_init(&self->frame_mutex);
+}
+
+// Creates a compositor that is not yet presenting to a surface.
+static FlCompositorVulkan* compositor_new(FlTaskRunner* task_runner,
+                                          FlVulkanManager* vulkan_manager) {
+  FlCompositorVulkan* self = FL_COMPOSITOR_VULKAN(
+      g_object_new(fl_compositor_vulkan_get_type(), nullptr));
+
+  self->task_runner = FL_TASK_RUNNER(g_object_ref(task_runner));
+  self->vulkan_manager = FL_VULKAN_MANAGER(g_object_ref(vulkan_manager));
+
+  const FlVulkanProcs* procs = fl_vulkan_manager_get_procs(vulkan_manager);
+  VkDevice device = fl_vulkan_manager_get_device(vulkan_manager);
+  uint32_t queue_family_index =
+      fl_vulkan_manager_get_queue_family_index(vulkan_manager);
+
+  VkCommandPoolCreateInfo pool_info = {};
+  pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+  pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+  pool_info.queueFamilyIndex = queue_family_index;
+  procs->CreateCommandPool(device, &pool_info, nullptr, &self->command_pool);
+
+  VkCommandBufferAllocateInfo buffer_info = {};
+  buffer_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+  buffer_info.commandPool = self->command_pool;
+  buffer_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+  buffer_info.commandBufferCount = 1;
+  procs->AllocateCommandBuffers(device, &buffer_info, &self->command_buffer);
+
+  VkSemaphoreCreateInfo semaphore_info = {};
+  semaphore_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+  procs->CreateSemaphore(device, &semaphore_info, nullptr,
+                         &self->acquire_semaphore);
+
+  // Signalled as there is no previous frame to wait for.
+  VkFenceCreateInfo fence_info = {};
+  fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+  fence_info.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+  procs->CreateFence(device, &fence_info, nullptr, &self->fence);
+
+  return self;
+}
+
+// Presents to @surface if the queue supports it.
+static void set_surface(FlCompositorVulkan* self, VkSurfaceKHR surface) {
+  const FlVulkanProcs* procs =
+      fl_vulkan_manager_get_procs(self->vulkan_manager);
+
+  VkBool32 supported = VK_FALSE;
+  if (surface != VK_NULL_HANDLE) {
+    procs->GetPhysicalDeviceSurfaceSupportKHR(
+        fl_vulkan_manager_get_physical_device(self->vulkan_manager),
+        fl_vulkan_manager_get_queue_family_index(self->vulkan_manager),
+        surface, &supported);
+    if (!supported) {
+      g_warning("Vulkan queue can't present to window");
+      procs->DestroySurfaceKHR(
+          fl_vulkan_manager_get_instance(self->vulkan_manager), surface,
+          nullptr);
+      surface = VK_NULL_HANDLE;
+    }
+  }
+  self->surface = surface;
+}
+
+FlCompositorVulkan* fl_compositor_vulkan_new(FlTaskRunner* task_runner,
+                                             FlVulkanManager* vulkan_manager,
+                                             GdkWindow* window) {
+  FlCompositorVulkan* self = compositor_new(task_runner, vulkan_manager);
+
+  GdkDisplay* display = gdk_window_get_display(window);
+  VkSurfaceKHR surface = VK_NULL_HANDLE;
+  if (GDK_IS_WAYLAND_DISPLAY(display)) {
+    surface = create_wayland_surface(self, window);
+  } else if (GDK_IS_X11_DISPLAY(display)) {
+    surface = create_xlib_surface(self, window);
+  } else {
+    g_warning("Unsupported GDK backend, unable to present with Vulkan");
+  }
+  set_surface(self, surface);
+
+  return self;
+}
+
+FlCompositorVulkan* fl_compositor_vulkan_new_for_surface(
+    FlTaskRunner* task_runner,
+    FlVulkanManager* vulkan_manager,
+    VkSurfaceKHR surface) {
+  FlCompositorVulkan* self = compositor_new(task_runner, vulkan_manager);
+  set_surface(self, surface);
+  return self;
+}
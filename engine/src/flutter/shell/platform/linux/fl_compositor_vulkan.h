@@ -0,0 +1,61 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_LINUX_FL_COMPOSITOR_VULKAN_H_
+#define FLUTTER_SHELL_PLATFORM_LINUX_FL_COMPOSITOR_VULKAN_H_
+
+#include "flutter/shell/platform/linux/fl_compositor.h"
+#include "flutter/shell/platform/linux/fl_task_runner.h"
+#include "flutter/shell/platform/linux/fl_vulkan_manager.h"
+
+G_BEGIN_DECLS
+
+G_DECLARE_FINAL_TYPE(FlCompositorVulkan,
+                     fl_compositor_vulkan,
+                     FL,
+                     COMPOSITOR_VULKAN,
+                     FlCompositor)
+
+/**
+ * FlCompositorVulkan:
+ *
+ * #FlCompositorVulkan is a class that implements compositing using Vulkan.
+ * Frames are copied into a swapchain and presented without going through GTK.
+ * On X11 the swapchain is on @window, which must be native. On Wayland it is
+ * on a subsurface of the toplevel window that is kept over @window.
+ */
+
+/**
+ * fl_compositor_vulkan_new:
+ * @task_runner: an #FlTaskRunner.
+ * @vulkan_manager: an #FlVulkanManager.
+ * @window: the window to show frames in.
+ *
+ * Creates a new Vulkan compositor.
+ *
+ * Returns: a new #FlCompositorVulkan.
+ */
+FlCompositorVulkan* fl_compositor_vulkan_new(FlTaskRunner* task_runner,
+                                             FlVulkanManager* vulkan_manager,
+                                             GdkWindow* window);
+
+/**
+ * fl_compositor_vulkan_new_for_surface:
+ * @task_runner: an #FlTaskRunner.
+ * @vulkan_manager: an #FlVulkanManager.
+ * @surface: the surface to show frames on, which the compositor takes
+ * ownership of.
+ *
+ * Creates a new Vulkan compositor that presents to an existing surface.
+ *
+ * Returns: a new #FlCompositorVulkan.
+ */
+FlCompositorVulkan* fl_compositor_vulkan_new_for_surface(
+    FlTaskRunner* task_runner,
+    FlVulkanManager* vulkan_manager,
+    VkSurfaceKHR surface);
+
+G_END_DECLS
+
+#endif  // FLUTTER_SHELL_PLATFORM_LINUX_FL_COMPOSITOR_VULKAN_H_
@@ -0,0 +1,188 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <thread>
+#include "gtest/gtest.h"
+
+#include "flutter/shell/platform/linux/fl_compositor_vulkan.h"
+#include "flutter/shell/platform/linux/fl_engine_private.h"
+#include "flutter/shell/platform/linux/fl_vulkan_manager.h"
+#include "flutter/shell/platform/linux/public/flutter_linux/fl_dart_project.h"
+#include "flutter/shell/platform/linux/testing/mock_vulkan.h"
+
+using ::testing::_;
+using ::testing::AllOf;
+using ::testing::DoDefault;
+using ::testing::Field;
+using ::testing::InSequence;
+using ::testing::IsNull;
+using ::testing::NotNull;
+using ::testing::Pointee;
+using ::testing::Return;
+
+// Presents a frame of the given size from a raster thread.
+static void present_frame(FlCompositorVulkan* compositor,
+                          FlVulkanManager* manager,
+                          size_t width,
+                          size_t height) {
+  FlutterVulkanImage* image =
+      fl_vulkan_manager_create_image(manager, width, height);
+  ASSERT_NE(image, nullptr);
+  FlutterBackingStore backing_store = {
+      .type = kFlutterBackingStoreTypeVulkan,
+      .vulkan = {.struct_size = sizeof(FlutterVulkanBackingStore),
+                 .image = image}};
+  FlutterLayer layer = {.type = kFlutterLayerContentTypeBackingStore,
+                        .backing_store = &backing_store,
+                        .offset = {0, 0},
+                        .size = {static_cast<double>(width),
+                                 static_cast<double>(height)}};
+  const FlutterLayer* layers[1] = {&layer};
+  std::thread([&]() {
+    EXPECT_TRUE(
+        fl_compositor_present_layers(FL_COMPOSITOR(compositor), layers, 1));
+  }).join();
+  fl_vulkan_manager_destroy_image(manager, image);
+}
+
+TEST(FlCompositorVulkanTest, Present) {
+  ::testing::NiceMock<flutter::testing::MockVulkan> vulkan;
+  g_autoptr(FlDartProject) project = fl_dart_project_new();
+  g_autoptr(FlEngine) engine = fl_engine_new(project);
+  g_autoptr(FlTaskRunner) task_runner = fl_task_runner_new(engine);
+  g_autoptr(FlVulkanManager) manager =
+      fl_vulkan_manager_new(gdk_display_get_default(), nullptr);
+  ASSERT_NE(manager, nullptr);
+
+  g_autoptr(FlCompositorVulkan) compositor =
+      fl_compositor_vulkan_new_for_surface(task_runner, manager,
+                                           vulkan.mock_surface());
+
+  // Frames of the same size reuse the swapchain.
+  EXPECT_CALL(vulkan, vkCreateSwapchainKHR(_, _, _, _)).Times(1);
+  EXPECT_CALL(vulkan, vkQueuePresentKHR(_, _)).Times(2);
+  present_frame(compositor, manager, 100, 100);
+  present_frame(compositor, manager, 100, 100);
+}
+
+TEST(FlCompositorVulkanTest, Resize) {
+  ::testing::NiceMock<flutter::testing::MockVulkan> vulkan;
+  g_autoptr(FlDartProject) project = fl_dart_project_new();
+  g_autoptr(FlEngine) engine = fl_engine_new(project);
+  g_autoptr(FlTaskRunner) task_runner = fl_task_runner_new(engine);
+  g_autoptr(FlVulkanManager) manager =
+      fl_vulkan_manager_new(gdk_display_get_default(), nullptr);
+  ASSERT_NE(manager, nullptr);
+
+  g_autoptr(FlCompositorVulkan) compositor =
+      fl_compositor_vulkan_new_for_surface(task_runner, manager,
+                                           vulkan.mock_surface());
+
+  {
+    InSequence s;
+    EXPECT_CALL(
+        vulkan,
+        vkCreateSwapchainKHR(
+            _,
+            Pointee(AllOf(
+                Field(&VkSwapchainCreateInfoKHR::imageExtent,
+                      AllOf(Field(&VkExtent2D::width, 100u),
+                            Field(&VkExtent2D::height, 100u))),
+                Field(&VkSwapchainCreateInfoKHR::oldSwapchain, IsNull()))),
+            _, _));
+    // The new swapchain replaces the old one.
+    EXPECT_CALL(
+        vulkan,
+        vkCreateSwapchainKHR(
+            _,
+            Pointee(AllOf(
+                Field(&VkSwapchainCreateInfoKHR::imageExtent,
+                      AllOf(Field(&VkExtent2D::width, 200u),
+                            Field(&VkExtent2D::height, 100u))),
+                Field(&VkSwapchainCreateInfoKHR::oldSwapchain, NotNull()))),
+            _, _));
+  }
+
+  present_frame(compositor, manager, 100, 100);
+  present_frame(compositor, manager, 200, 100);
+}
+
+TEST(FlCompositorVulkanTest, AcquireOutOfDate) {
+  ::testing::NiceMock<flutter::testing::MockVulkan> vulkan;
+  g_autoptr(FlDartProject) project = fl_dart_project_new();
+  g_autoptr(FlEngine) engine = fl_engine_new(project);
+  g_autoptr(FlTaskRunner) task_runner = fl_task_runner_new(engine);
+  g_autoptr(FlVulkanManager) manager =
+      fl_vulkan_manager_new(gdk_display_get_default(), nullptr);
+  ASSERT_NE(manager, nullptr);
+
+  g_autoptr(FlCompositorVulkan) compositor =
+      fl_compositor_vulkan_new_for_surface(task_runner, manager,
+                                           vulkan.mock_surface());
+
+  // The swapchain is recreated and the frame still presented.
+  EXPECT_CALL(vulkan, vkAcquireNextImageKHR(_, _, _, _, _, _))
+      .WillOnce(Return(VK_ERROR_OUT_OF_DATE_KHR))
+      .WillRepeatedly(DoDefault());
+  EXPECT_CALL(vulkan, vkCreateSwapchainKHR(_, _, _, _)).Times(2);
+  EXPECT_CALL(vulkan, vkQueuePresentKHR(_, _)).Times(1);
+  present_frame(compositor, manager, 100, 100);
+}
+
+TEST(FlCompositorVulkanTest, PresentSuboptimal) {
+  ::testing::NiceMock<flutter::testing::MockVulkan> vulkan;
+  g_autoptr(FlDartProject) project = fl_dart_project_new();
+  g_autoptr(FlEngine) engine = fl_engine_new(project);
+  g_autoptr(FlTaskRunner) task_runner = fl_task_runner_new(engine);
+  g_autoptr(FlVulkanManager) manager =
+      fl_vulkan_manager_new(gdk_display_get_default(), nullptr);
+  ASSERT_NE(manager, nullptr);
+
+  g_autoptr(FlCompositorVulkan) compositor =
+      fl_compositor_vulkan_new_for_surface(task_runner, manager,
+                                           vulkan.mock_surface());
+
+  // The swapchain is recreated for the next frame.
+  EXPECT_CALL(vulkan, vkQueuePresentKHR(_, _))
+      .WillOnce(Return(VK_SUBOPTIMAL_KHR))
+      .WillOnce(Return(VK_SUCCESS));
+  EXPECT_CALL(vulkan, vkCreateSwapchainKHR(_, _, _, _)).Times(2);
+  present_frame(compositor, manager, 100, 100);
+  present_frame(compositor, manager, 100, 100);
+}
+
+TEST(FlCompositorVulkanTest, SwapchainCreationFails) {
+  ::testing::NiceMock<flutter::testing::MockVulkan> vulkan;
+  g_autoptr(FlDartProject) project = fl_dart_project_new();
+  g_autoptr(FlEngine) engine = fl_engine_new(project);
+  g_autoptr(FlTaskRunner) task_runner = fl_task_runner_new(engine);
+  g_autoptr(FlVulkanManager) manager =
+      fl_vulkan_manager_new(gdk_display_get_default(), nullptr);
+  ASSERT_NE(manager, nullptr);
+
+  g_autoptr(FlCompositorVulkan) compositor =
+      fl_compositor_vulkan_new_for_surface(task_runner, manager,
+                                           vulkan.mock_surface());
+
+  EXPECT_CALL(vulkan, vkCreateSwapchainKHR(_, _, _, _))
+      .WillOnce(Return(VK_ERROR_SURFACE_LOST_KHR));
+  EXPECT_CALL(vulkan, vkQueuePresentKHR(_, _)).Times(0);
+
+  FlutterVulkanImage* image =
+      fl_vulkan_manager_create_image(manager, 100, 100);
+  FlutterBackingStore backing_store = {
+      .type = kFlutterBackingStoreTypeVulkan,
+      .vulkan = {.struct_size = sizeof(FlutterVulkanBackingStore),
+                 .image = image}};
+  FlutterLayer layer = {.type = kFlutterLayerContentTypeBackingStore,
+                        .backing_store = &backing_store,
+                        .offset = {0, 0},
+                        .size = {100, 100}};
+  const FlutterLayer* layers[1] = {&layer};
+  std::thread([&]() {
+    EXPECT_FALSE(
+        fl_compositor_present_layers(FL_COMPOSITOR(compositor), layers, 1));
+  }).join();
+  fl_vulkan_manager_destroy_image(manager, image);
+}
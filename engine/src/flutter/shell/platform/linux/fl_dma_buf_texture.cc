@@ -0,0 +1,212 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/linux/public/flutter_linux/fl_dma_buf_texture.h"
+
+#include <epoxy/egl.h>
+#include <epoxy/gl.h>
+#include <gmodule.h>
+
+#include "flutter/shell/platform/linux/fl_dma_buf_texture_private.h"
+
+// DRM_FORMAT_MOD_INVALID from drm_fourcc.h.
+static constexpr uint64_t kDrmFormatModInvalid = 0x00ffffffffffffffULL;
+
+// The EGL attributes of each plane of a buffer.
+static constexpr EGLint kPlaneAttributes[FL_DMA_BUF_MAX_PLANES][5] = {
+    {EGL_DMA_BUF_PLANE0_FD_EXT, EGL_DMA_BUF_PLANE0_OFFSET_EXT,
+     EGL_DMA_BUF_PLANE0_PITCH_EXT, EGL_DMA_BUF_PLANE0_MODIFIER_LO_EXT,
+     EGL_DMA_BUF_PLANE0_MODIFIER_HI_EXT},
+    {EGL_DMA_BUF_PLANE1_FD_EXT, EGL_DMA_BUF_PLANE1_OFFSET_EXT,
+     EGL_DMA_BUF_PLANE1_PITCH_EXT, EGL_DMA_BUF_PLANE1_MODIFIER_LO_EXT,
+     EGL_DMA_BUF_PLANE1_MODIFIER_HI_EXT},
+    {EGL_DMA_BUF_PLANE2_FD_EXT, EGL_DMA_BUF_PLANE2_OFFSET_EXT,
+     EGL_DMA_BUF_PLANE2_PITCH_EXT, EGL_DMA_BUF_PLANE2_MODIFIER_LO_EXT,
+     EGL_DMA_BUF_PLANE2_MODIFIER_HI_EXT},
+    {EGL_DMA_BUF_PLANE3_FD_EXT, EGL_DMA_BUF_PLANE3_OFFSET_EXT,
+     EGL_DMA_BUF_PLANE3_PITCH_EXT, EGL_DMA_BUF_PLANE3_MODIFIER_LO_EXT,
+     EGL_DMA_BUF_PLANE3_MODIFIER_HI_EXT},
+};
+
+typedef struct {
+  int64_t id;
+  GLuint texture_id;
+} FlDmaBufTexturePrivate;
+
+G_DEFINE_QUARK(fl_dma_buf_texture_error_quark, fl_dma_buf_texture_error)
+
+static void fl_dma_buf_texture_iface_init(FlTextureInterface* iface);
+
+G_DEFINE_TYPE_WITH_CODE(FlDmaBufTexture,
+                        fl_dma_buf_texture,
+                        G_TYPE_OBJECT,
+                        G_IMPLEMENT_INTERFACE(fl_texture_get_type(),
+                                              fl_dma_buf_texture_iface_init);
+                        G_ADD_PRIVATE(FlDmaBufTexture))
+
+// Implements FlTexture::set_id
+static void fl_dma_buf_texture_set_id(FlTexture* texture, int64_t id) {
+  FlDmaBufTexture* self = FL_DMA_BUF_TEXTURE(texture);
+  FlDmaBufTexturePrivate* priv = reinterpret_cast<FlDmaBufTexturePrivate*>(
+      fl_dma_buf_texture_get_instance_private(self));
+  priv->id = id;
+}
+
+// Implements FlTexture::get_id
+static int64_t fl_dma_buf_texture_get_id(FlTexture* texture) {
+  FlDmaBufTexture* self = FL_DMA_BUF_TEXTURE(texture);
+  FlDmaBufTexturePrivate* priv = reinterpret_cast<FlDmaBufTexturePrivate*>(
+      fl_dma_buf_texture_get_instance_private(self));
+  return priv->id;
+}
+
+static void fl_dma_buf_texture_iface_init(FlTextureInterface* iface) {
+  iface->set_id = fl_dma_buf_texture_set_id;
+  iface->get_id = fl_dma_buf_texture_get_id;
+}
+
+static void fl_dma_buf_texture_dispose(GObject* object) {
+  FlDmaBufTexture* self = FL_DMA_BUF_TEXTURE(object);
+  FlDmaBufTexturePrivate* priv = reinterpret_cast<FlDmaBufTexturePrivate*>(
+      fl_dma_buf_texture_get_instance_private(self));
+
+  if (priv->texture_id) {
+    glDeleteTextures(1, &priv->texture_id);
+    priv->texture_id = 0;
+  }
+
+  G_OBJECT_CLASS(fl_dma_buf_texture_parent_class)->dispose(object);
+}
+
+static void fl_dma_buf_texture_class_init(FlDmaBufTextureClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = fl_dma_buf_texture_dispose;
+}
+
+static void fl_dma_buf_texture_init(FlDmaBufTexture* self) {}
+
+// Creates an EGL image that refers to the planes of a buffer.
+static EGLImageKHR create_egl_image(EGLDisplay display,
+                                    const FlDmaBuf* buffer,
+                                    GError** error) {
+  if (!epoxy_has_egl_extension(display, "EGL_EXT_image_dma_buf_import")) {
+    g_set_error(error, fl_dma_buf_texture_error_quark(),
+                FL_DMA_BUF_TEXTURE_ERROR_FAILED,
+                "EGL_EXT_image_dma_buf_import is not supported");
+    return EGL_NO_IMAGE_KHR;
+  }
+
+  gboolean has_modifier = buffer->modifier != kDrmFormatModInvalid;
+  if (has_modifier &&
+      !epoxy_has_egl_extension(display,
+                               "EGL_EXT_image_dma_buf_import_modifiers")) {
+    g_set_error(error, fl_dma_buf_texture_error_quark(),
+                FL_DMA_BUF_TEXTURE_ERROR_FAILED,
+                "EGL_EXT_image_dma_buf_import_modifiers is not supported");
+    return EGL_NO_IMAGE_KHR;
+  }
+
+  // The fourth plane can only be described with the modifiers extension.
+  guint max_planes = has_modifier ? FL_DMA_BUF_MAX_PLANES : 3;
+  if (buffer->n_planes == 0 || buffer->n_planes > max_planes) {
+    g_set_error(error, fl_dma_buf_texture_error_quark(),
+                FL_DMA_BUF_TEXTURE_ERROR_FAILED,
+                "Invalid number of DMA-BUF planes %u", buffer->n_planes);
+    return EGL_NO_IMAGE_KHR;
+  }
+
+  // The format, size and the attributes of each plane, followed by EGL_NONE.
+  EGLint attributes[6 + FL_DMA_BUF_MAX_PLANES * 10 + 1];
+  size_t n_attributes = 0;
+  auto add_attribute = [&](EGLint name, EGLint value) {
+    attributes[n_attributes++] = name;
+    attributes[n_attributes++] = value;
+  };
+  add_attribute(EGL_WIDTH, static_cast<EGLint>(buffer->width));
+  add_attribute(EGL_HEIGHT, static_cast<EGLint>(buffer->height));
+  add_attribute(EGL_LINUX_DRM_FOURCC_EXT, static_cast<EGLint>(buffer->fourcc));
+  for (guint i = 0; i < buffer->n_planes; i++) {
+    const FlDmaBufPlane* plane = &buffer->planes[i];
+    add_attribute(kPlaneAttributes[i][0], plane->fd);
+    add_attribute(kPlaneAttributes[i][1], static_cast<EGLint>(plane->offset));
+    add_attribute(kPlaneAttributes[i][2], static_cast<EGLint>(plane->pitch));
+    if (has_modifier) {
+      add_attribute(kPlaneAttributes[i][3],
+                    static_cast<EGLint>(buffer->modifier & 0xffffffff));
+      add_attribute(kPlaneAttributes[i][4],
+                    static_cast<EGLint>(buffer->modifier >> 32));
+    }
+  }
+  attributes[n_attributes] = EGL_NONE;
+
+  // Images of DMA-BUFs are not created from a context.
+  EGLImageKHR image = eglCreateImageKHR(display, EGL_NO_CONTEXT,
+                                        EGL_LINUX_DMA_BUF_EXT, nullptr,
+                                        attributes);
+  if (image == EGL_NO_IMAGE_KHR) {
+    g_set_error(error, fl_dma_buf_texture_error_quark(),
+                FL_DMA_BUF_TEXTURE_ERROR_FAILED,
+                "Failed to import DMA-BUF: EGL error 0x%x", eglGetError());
+  }
+  return image;
+}
+
+gboolean fl_dma_buf_texture_populate(FlDmaBufTexture* texture,
+                                     uint32_t width,
+                                     uint32_t height,
+                                     FlutterOpenGLTexture* opengl_texture,
+                                     GError** error) {
+  FlDmaBufTexture* self = FL_DMA_BUF_TEXTURE(texture);
+  FlDmaBufTexturePrivate* priv = reinterpret_cast<FlDmaBufTexturePrivate*>(
+      fl_dma_buf_texture_get_instance_private(self));
+
+  FlDmaBuf buffer = {};
+  buffer.width = width;
+  buffer.height = height;
+  buffer.modifier = kDrmFormatModInvalid;
+  if (!FL_DMA_BUF_TEXTURE_GET_CLASS(self)->get_buffer(self, &buffer, error)) {
+    return FALSE;
+  }
+
+  EGLDisplay display = eglGetCurrentDisplay();
+  if (display == EGL_NO_DISPLAY) {
+    g_set_error(error, fl_dma_buf_texture_error_quark(),
+                FL_DMA_BUF_TEXTURE_ERROR_FAILED,
+                "Failed to import DMA-BUF: No current EGL display");
+    return FALSE;
+  }
+
+  EGLImageKHR image = create_egl_image(display, &buffer, error);
+  if (image == EGL_NO_IMAGE_KHR) {
+    return FALSE;
+  }
+
+  // YUV buffers can only be sampled through external textures, which also
+  // work for RGB buffers.
+  if (priv->texture_id == 0) {
+    glGenTextures(1, &priv->texture_id);
+    glBindTexture(GL_TEXTURE_EXTERNAL_OES, priv->texture_id);
+    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_WRAP_S,
+                    GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_WRAP_T,
+                    GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  } else {
+    glBindTexture(GL_TEXTURE_EXTERNAL_OES, priv->texture_id);
+  }
+  glEGLImageTargetTexture2DOES(GL_TEXTURE_EXTERNAL_OES, image);
+
+  // The texture keeps the buffer referenced by the image alive.
+  eglDestroyImageKHR(display, image);
+
+  opengl_texture->target = GL_TEXTURE_EXTERNAL_OES;
+  opengl_texture->name = priv->texture_id;
+  opengl_texture->format = GL_RGBA8;
+  opengl_texture->destruction_callback = nullptr;
+  opengl_texture->user_data = nullptr;
+  opengl_texture->width = buffer.width;
+  opengl_texture->height = buffer.height;
+
+  return TRUE;
+}
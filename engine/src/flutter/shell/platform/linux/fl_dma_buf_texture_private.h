@@ -0,0 +1,44 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_LINUX_FL_DMA_BUF_TEXTURE_PRIVATE_H_
+#define FLUTTER_SHELL_PLATFORM_LINUX_FL_DMA_BUF_TEXTURE_PRIVATE_H_
+
+#include "flutter/shell/platform/embedder/embedder.h"
+#include "flutter/shell/platform/linux/public/flutter_linux/fl_dma_buf_texture.h"
+
+G_BEGIN_DECLS
+
+typedef enum {
+  FL_DMA_BUF_TEXTURE_ERROR_FAILED,
+} FlDmaBufTextureError;
+
+GQuark fl_dma_buf_texture_error_quark(void) G_GNUC_CONST;
+
+/**
+ * fl_dma_buf_texture_populate:
+ * @texture: an #FlDmaBufTexture.
+ * @width: width of the texture.
+ * @height: height of the texture.
+ * @opengl_texture: (out): return an #FlutterOpenGLTexture.
+ * @error: (allow-none): #GError location to store the error occurring, or
+ * %NULL to ignore. If `error` is not %NULL, `*error` must be initialized
+ * (typically %NULL, but an error from a previous call using GLib error handling
+ * is explicitly valid).
+ *
+ * Imports the current buffer of the texture into an external OpenGL texture
+ * and populates the specified @opengl_texture with its details. Must be called
+ * with an EGL context current.
+ *
+ * Returns: %TRUE on success.
+ */
+gboolean fl_dma_buf_texture_populate(FlDmaBufTexture* texture,
+                                     uint32_t width,
+                                     uint32_t height,
+                                     FlutterOpenGLTexture* opengl_texture,
+                                     GError** error);
+
+G_END_DECLS
+
+#endif  // FLUTTER_SHELL_PLATFORM_LINUX_FL_DMA_BUF_TEXTURE_PRIVATE_H_
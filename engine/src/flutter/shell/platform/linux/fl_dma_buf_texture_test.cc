@@ -0,0 +1,148 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/linux/public/flutter_linux/fl_dma_buf_texture.h"
+#include "flutter/shell/platform/linux/fl_dma_buf_texture_private.h"
+#include "flutter/shell/platform/linux/fl_texture_private.h"
+#include "flutter/shell/platform/linux/testing/mock_epoxy.h"
+#include "gtest/gtest.h"
+
+#include <epoxy/egl.h>
+#include <epoxy/gl.h>
+
+#include <map>
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::Return;
+using ::testing::StrEq;
+
+static constexpr uint32_t kTextureWidth = 4u;
+static constexpr uint32_t kTextureHeight = 4u;
+static constexpr uint32_t kBufferWidth = 1920u;
+static constexpr uint32_t kBufferHeight = 1080u;
+static constexpr uint32_t kBufferPitch = 2048u;
+static constexpr int kBufferFd = 42;
+// DRM_FORMAT_NV12 from drm_fourcc.h.
+static constexpr uint32_t kNV12 = 0x3231564e;
+
+G_DECLARE_FINAL_TYPE(FlTestDmaBufTexture,
+                     fl_test_dma_buf_texture,
+                     FL,
+                     TEST_DMA_BUF_TEXTURE,
+                     FlDmaBufTexture)
+
+/// A texture that shows a fixed NV12 buffer.
+struct _FlTestDmaBufTexture {
+  FlDmaBufTexture parent_instance;
+};
+
+G_DEFINE_TYPE(FlTestDmaBufTexture,
+              fl_test_dma_buf_texture,
+              fl_dma_buf_texture_get_type())
+
+static gboolean fl_test_dma_buf_texture_get_buffer(FlDmaBufTexture* texture,
+                                                   FlDmaBuf* buffer,
+                                                   GError** error) {
+  EXPECT_TRUE(FL_IS_TEST_DMA_BUF_TEXTURE(texture));
+  EXPECT_EQ(buffer->width, kTextureWidth);
+  EXPECT_EQ(buffer->height, kTextureHeight);
+
+  buffer->width = kBufferWidth;
+  buffer->height = kBufferHeight;
+  buffer->fourcc = kNV12;
+  buffer->n_planes = 2;
+  buffer->planes[0].fd = kBufferFd;
+  buffer->planes[0].offset = 0;
+  buffer->planes[0].pitch = kBufferPitch;
+  buffer->planes[1].fd = kBufferFd;
+  buffer->planes[1].offset = kBufferPitch * kBufferHeight;
+  buffer->planes[1].pitch = kBufferPitch;
+
+  return TRUE;
+}
+
+static void fl_test_dma_buf_texture_class_init(
+    FlTestDmaBufTextureClass* klass) {
+  FL_DMA_BUF_TEXTURE_CLASS(klass)->get_buffer =
+      fl_test_dma_buf_texture_get_buffer;
+}
+
+static void fl_test_dma_buf_texture_init(FlTestDmaBufTexture* self) {}
+
+static FlTestDmaBufTexture* fl_test_dma_buf_texture_new() {
+  return FL_TEST_DMA_BUF_TEXTURE(
+      g_object_new(fl_test_dma_buf_texture_get_type(), nullptr));
+}
+
+// Test that getting the texture ID works.
+TEST(FlDmaBufTextureTest, TextureID) {
+  g_autoptr(FlTexture) texture = FL_TEXTURE(fl_test_dma_buf_texture_new());
+  fl_texture_set_id(texture, 42);
+  EXPECT_EQ(fl_texture_get_id(texture), static_cast<int64_t>(42));
+}
+
+// Test that the buffer is imported into an external texture.
+TEST(FlDmaBufTextureTest, PopulateTexture) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+
+  EXPECT_CALL(epoxy,
+              epoxy_has_egl_extension(_, StrEq("EGL_EXT_image_dma_buf_import")))
+      .WillOnce(Return(true));
+  std::map<EGLint, EGLint> attributes;
+  EXPECT_CALL(epoxy, eglCreateImageKHR(_, EGL_NO_CONTEXT, EGL_LINUX_DMA_BUF_EXT,
+                                       nullptr, _))
+      .WillOnce(Invoke([&attributes](EGLDisplay dpy, EGLContext ctx,
+                                     EGLenum target, EGLClientBuffer buffer,
+                                     const EGLint* attrib_list) {
+        for (const EGLint* a = attrib_list; *a != EGL_NONE; a += 2) {
+          attributes[a[0]] = a[1];
+        }
+      }));
+  EXPECT_CALL(epoxy,
+              glEGLImageTargetTexture2DOES(GL_TEXTURE_EXTERNAL_OES, _));
+  EXPECT_CALL(epoxy, eglDestroyImageKHR);
+
+  g_autoptr(FlDmaBufTexture) texture =
+      FL_DMA_BUF_TEXTURE(fl_test_dma_buf_texture_new());
+  FlutterOpenGLTexture opengl_texture = {0};
+  g_autoptr(GError) error = nullptr;
+  EXPECT_TRUE(fl_dma_buf_texture_populate(
+      texture, kTextureWidth, kTextureHeight, &opengl_texture, &error));
+  EXPECT_EQ(error, nullptr);
+  EXPECT_EQ(opengl_texture.target,
+            static_cast<uint32_t>(GL_TEXTURE_EXTERNAL_OES));
+  EXPECT_EQ(opengl_texture.width, kBufferWidth);
+  EXPECT_EQ(opengl_texture.height, kBufferHeight);
+
+  EXPECT_EQ(attributes[EGL_WIDTH], static_cast<EGLint>(kBufferWidth));
+  EXPECT_EQ(attributes[EGL_HEIGHT], static_cast<EGLint>(kBufferHeight));
+  EXPECT_EQ(attributes[EGL_LINUX_DRM_FOURCC_EXT], static_cast<EGLint>(kNV12));
+  EXPECT_EQ(attributes[EGL_DMA_BUF_PLANE0_FD_EXT], kBufferFd);
+  EXPECT_EQ(attributes[EGL_DMA_BUF_PLANE0_PITCH_EXT],
+            static_cast<EGLint>(kBufferPitch));
+  EXPECT_EQ(attributes[EGL_DMA_BUF_PLANE1_FD_EXT], kBufferFd);
+  EXPECT_EQ(attributes[EGL_DMA_BUF_PLANE1_OFFSET_EXT],
+            static_cast<EGLint>(kBufferPitch * kBufferHeight));
+  EXPECT_EQ(attributes.count(EGL_DMA_BUF_PLANE2_FD_EXT), 0u);
+  // The driver infers the layout of buffers without a modifier.
+  EXPECT_EQ(attributes.count(EGL_DMA_BUF_PLANE0_MODIFIER_LO_EXT), 0u);
+}
+
+// Test that populating fails if DMA-BUFs can't be imported.
+TEST(FlDmaBufTextureTest, ImportNotSupported) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+
+  EXPECT_CALL(epoxy, epoxy_has_egl_extension).WillRepeatedly(Return(false));
+  EXPECT_CALL(epoxy, eglCreateImageKHR).Times(0);
+
+  g_autoptr(FlDmaBufTexture) texture =
+      FL_DMA_BUF_TEXTURE(fl_test_dma_buf_texture_new());
+  FlutterOpenGLTexture opengl_texture = {0};
+  g_autoptr(GError) error = nullptr;
+  EXPECT_FALSE(fl_dma_buf_texture_populate(
+      texture, kTextureWidth, kTextureHeight, &opengl_texture, &error));
+  EXPECT_TRUE(g_error_matches(error, fl_dma_buf_texture_error_quark(),
+                              FL_DMA_BUF_TEXTURE_ERROR_FAILED));
+}
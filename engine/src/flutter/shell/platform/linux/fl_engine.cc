@@ -16,6 +16,7 @@
 #include "flutter/shell/platform/linux/fl_binary_messenger_private.h"
 #include "flutter/shell/platform/linux/fl_dart_project_private.h"
 #include "flutter/shell/platform/linux/fl_display_monitor.h"
+#include "flutter/shell/platform/linux/fl_dma_buf_texture_private.h"
 #include "flutter/shell/platform/linux/fl_engine_private.h"
 #include "flutter/shell/platform/linux/fl_framebuffer.h"
 #include "flutter/shell/platform/linux/fl_keyboard_handler.h"
@@ -26,6 +27,7 @@
 #include "flutter/shell/platform/linux/fl_settings_handler.h"
 #include "flutter/shell/platform/linux/fl_texture_gl_private.h"
 #include "flutter/shell/platform/linux/fl_texture_registrar_private.h"
+#include "flutter/shell/platform/linux/fl_vulkan_manager.h"
 #include "flutter/shell/platform/linux/public/flutter_linux/fl_plugin_registry.h"
 
 // Unique number associated with platform tasks.
@@ -54,6 +56,9 @@ struct _FlEngine {
   // Manages OpenGL contexts.
   FlOpenGLManager* opengl_manager;
 
+  // Manages the Vulkan device when rendering with Vulkan.
+  FlVulkanManager* vulkan_manager;
+
   // Messenger used to send and receive platform messages.
   FlBinaryMessenger* binary_messenger;
 
@@ -327,6 +332,38 @@ static bool collect_software_backing_store(
   return true;
 }
 
+static bool create_vulkan_backing_store(
+    FlEngine* self,
+    const FlutterBackingStoreConfig* config,
+    FlutterBackingStore* backing_store_out) {
+  FlutterVulkanImage* image = fl_vulkan_manager_create_image(
+      self->vulkan_manager, config->size.width, config->size.height);
+  if (image == nullptr) {
+    g_warning("Failed to create backing store");
+    return false;
+  }
+
+  backing_store_out->type = kFlutterBackingStoreTypeVulkan;
+  backing_store_out->vulkan.struct_size = sizeof(FlutterVulkanBackingStore);
+  backing_store_out->vulkan.image = image;
+  backing_store_out->vulkan.user_data = nullptr;
+  backing_store_out->vulkan.destruction_callback = [](void* p) {
+    // Backing store destroyed in collect_vulkan_backing_store(), set on
+    // FlutterCompositor.collect_backing_store_callback during engine start.
+  };
+
+  return true;
+}
+
+static bool collect_vulkan_backing_store(
+    FlEngine* self,
+    const FlutterBackingStore* backing_store) {
+  fl_vulkan_manager_destroy_image(
+      self->vulkan_manager,
+      const_cast<FlutterVulkanImage*>(backing_store->vulkan.image));
+  return true;
+}
+
 // Called when engine needs a backing store for a specific #FlutterLayer.
 static bool compositor_create_backing_store_callback(
     const FlutterBackingStoreConfig* config,
@@ -338,6 +375,8 @@ static bool compositor_create_backing_store_callback(
       return create_opengl_backing_store(self, config, backing_store_out);
     case kSoftware:
       return create_software_backing_store(self, config, backing_store_out);
+    case kVulkan:
+      return create_vulkan_backing_store(self, config, backing_store_out);
     default:
       return false;
   }
@@ -353,6 +392,8 @@ static bool compositor_collect_backing_store_callback(
       return collect_opengl_backing_store(self, backing_store);
     case kSoftware:
       return collect_software_backing_store(self, backing_store);
+    case kVulkan:
+      return collect_vulkan_backing_store(self, backing_store);
     default:
       return false;
   }
@@ -431,6 +472,9 @@ static bool fl_engine_gl_external_texture_frame_callback(
     result =
         fl_pixel_buffer_texture_populate(FL_PIXEL_BUFFER_TEXTURE(texture),
                                          width, height, opengl_texture, &error);
+  } else if (FL_IS_DMA_BUF_TEXTURE(texture)) {
+    result = fl_dma_buf_texture_populate(FL_DMA_BUF_TEXTURE(texture), width,
+                                         height, opengl_texture, &error);
   } else {
     g_warning("Unsupported texture type %" G_GINT64_FORMAT, texture_id);
     return false;
@@ -583,6 +627,7 @@ static void fl_engine_dispose(GObject* object) {
   g_clear_object(&self->project);
   g_clear_object(&self->display_monitor);
   g_clear_object(&self->opengl_manager);
+  g_clear_object(&self->vulkan_manager);
   g_clear_object(&self->texture_registrar);
   g_clear_object(&self->binary_messenger);
   g_clear_object(&self->settings_handler);
@@ -667,6 +712,17 @@ static FlEngine* fl_engine_new_full(FlDartProject* project,
         "\n"
         "To switch back to the default renderer, unset the "
         "FLUTTER_LINUX_RENDERER environment variable.");
+  } else if (g_strcmp0(renderer, "vulkan") == 0) {
+    g_autoptr(GError) error = nullptr;
+    self->vulkan_manager =
+        fl_vulkan_manager_new(gdk_display_get_default(), &error);
+    if (self->vulkan_manager != nullptr) {
+      self->renderer_type = kVulkan;
+    } else {
+      g_warning("Failed to set up Vulkan, defaulting to opengl: %s",
+                error->message);
+      self->renderer_type = kOpenGL;
+    }
   } else {
     if (renderer != nullptr && strcmp(renderer, "opengl") != 0) {
       g_warning("Unknown renderer type '%s', defaulting to opengl", renderer);
@@ -718,6 +774,11 @@ FlOpenGLManager* fl_engine_get_opengl_manager(FlEngine* self) {
   return self->opengl_manager;
 }
 
+FlVulkanManager* fl_engine_get_vulkan_manager(FlEngine* self) {
+  g_return_val_if_fail(FL_IS_ENGINE(self), nullptr);
+  return self->vulkan_manager;
+}
+
 FlDisplayMonitor* fl_engine_get_display_monitor(FlEngine* self) {
   g_return_val_if_fail(FL_IS_ENGINE(self), nullptr);
   return self->display_monitor;
@@ -750,8 +811,22 @@ gboolean fl_engine_start(FlEngine* self, GError** error) {
       config.open_gl.gl_external_texture_frame_callback =
           fl_engine_gl_external_texture_frame_callback;
       break;
-    case kMetal:
     case kVulkan:
+      config.vulkan.struct_size = sizeof(FlutterVulkanRendererConfig);
+      fl_vulkan_manager_populate_renderer_config(self->vulkan_manager,
+                                                 &config.vulkan);
+      // Not called, as every frame is rendered into a backing store and
+      // presented in compositor_present_view_callback.
+      config.vulkan.get_next_image_callback =
+          [](void* user_data, const FlutterFrameInfo* frame_info) {
+            return FlutterVulkanImage{};
+          };
+      config.vulkan.present_image_callback =
+          [](void* user_data, const FlutterVulkanImage* image) {
+            return true;
+          };
+      break;
+    case kMetal:
     default:
       g_set_error(error, fl_engine_error_quark(), FL_ENGINE_ERROR_FAILED,
                   "Unsupported renderer type");
@@ -785,6 +860,10 @@ gboolean fl_engine_start(FlEngine* self, GError** error) {
   for (const auto& env_switch : flutter::GetSwitchesFromEnvironment()) {
     g_ptr_array_add(command_line_args, g_strdup(env_switch.c_str()));
   }
+  // The engine only supports Vulkan backing stores with Impeller.
+  if (self->renderer_type == kVulkan) {
+    g_ptr_array_add(command_line_args, g_strdup("--enable-impeller"));
+  }
 
   gchar** dart_entrypoint_args =
       fl_dart_project_get_dart_entrypoint_arguments(self->project);
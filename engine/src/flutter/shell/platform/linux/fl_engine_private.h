@@ -15,6 +15,7 @@
 #include "flutter/shell/platform/linux/fl_renderable.h"
 #include "flutter/shell/platform/linux/fl_task_runner.h"
 #include "flutter/shell/platform/linux/fl_text_input_handler.h"
+#include "flutter/shell/platform/linux/fl_vulkan_manager.h"
 #include "flutter/shell/platform/linux/public/flutter_linux/fl_dart_project.h"
 #include "flutter/shell/platform/linux/public/flutter_linux/fl_engine.h"
 
@@ -81,6 +82,16 @@ FlutterRendererType fl_engine_get_renderer_type(FlEngine* engine);
  */
 FlOpenGLManager* fl_engine_get_opengl_manager(FlEngine* engine);
 
+/**
+ * fl_engine_get_vulkan_manager:
+ * @engine: an #FlEngine.
+ *
+ * Gets the Vulkan manager used by this engine.
+ *
+ * Returns: an #FlVulkanManager or %NULL if not rendering with Vulkan.
+ */
+FlVulkanManager* fl_engine_get_vulkan_manager(FlEngine* engine);
+
 /**
  * fl_engine_get_display_monitor:
  * @engine: an #FlEngine.
@@ -11,6 +11,7 @@
 #include "flutter/shell/platform/linux/public/flutter_linux/fl_json_message_codec.h"
 #include "flutter/shell/platform/linux/public/flutter_linux/fl_string_codec.h"
 #include "flutter/shell/platform/linux/testing/mock_renderable.h"
+#include "flutter/shell/platform/linux/testing/mock_vulkan.h"
 
 // MOCK_ENGINE_PROC is leaky by design
 // NOLINTBEGIN(clang-analyzer-core.StackAddressEscape)
@@ -1064,4 +1065,67 @@ TEST(FlEngineTest, ChildObjects) {
   EXPECT_NE(fl_engine_get_mouse_cursor_handler(engine), nullptr);
 }
 
+// Checks the engine renders with Vulkan when requested.
+TEST(FlEngineTest, VulkanRenderer) {
+  ::testing::NiceMock<flutter::testing::MockVulkan> vulkan;
+  g_autofree gchar* initial_renderer =
+      g_strdup(g_getenv("FLUTTER_LINUX_RENDERER"));
+  g_setenv("FLUTTER_LINUX_RENDERER", "vulkan", TRUE);
+
+  g_autoptr(FlDartProject) project = fl_dart_project_new();
+  g_autoptr(FlEngine) engine = fl_engine_new(project);
+  EXPECT_EQ(fl_engine_get_renderer_type(engine), kVulkan);
+  EXPECT_NE(fl_engine_get_vulkan_manager(engine), nullptr);
+
+  if (initial_renderer) {
+    g_setenv("FLUTTER_LINUX_RENDERER", initial_renderer, TRUE);
+  } else {
+    g_unsetenv("FLUTTER_LINUX_RENDERER");
+  }
+}
+
+// Checks the engine uses OpenGL if no Vulkan instance can be created.
+TEST(FlEngineTest, VulkanInstanceFallback) {
+  ::testing::NiceMock<flutter::testing::MockVulkan> vulkan;
+  EXPECT_CALL(vulkan, vkCreateInstance(::testing::_, ::testing::_,
+                                       ::testing::_))
+      .WillOnce(::testing::Return(VK_ERROR_INCOMPATIBLE_DRIVER));
+  g_autofree gchar* initial_renderer =
+      g_strdup(g_getenv("FLUTTER_LINUX_RENDERER"));
+  g_setenv("FLUTTER_LINUX_RENDERER", "vulkan", TRUE);
+
+  g_autoptr(FlDartProject) project = fl_dart_project_new();
+  g_autoptr(FlEngine) engine = fl_engine_new(project);
+  EXPECT_EQ(fl_engine_get_renderer_type(engine), kOpenGL);
+  EXPECT_EQ(fl_engine_get_vulkan_manager(engine), nullptr);
+
+  if (initial_renderer) {
+    g_setenv("FLUTTER_LINUX_RENDERER", initial_renderer, TRUE);
+  } else {
+    g_unsetenv("FLUTTER_LINUX_RENDERER");
+  }
+}
+
+// Checks the engine uses OpenGL if no Vulkan device can be created.
+TEST(FlEngineTest, VulkanDeviceFallback) {
+  ::testing::NiceMock<flutter::testing::MockVulkan> vulkan;
+  EXPECT_CALL(vulkan, vkCreateDevice(::testing::_, ::testing::_, ::testing::_,
+                                     ::testing::_))
+      .WillOnce(::testing::Return(VK_ERROR_INITIALIZATION_FAILED));
+  g_autofree gchar* initial_renderer =
+      g_strdup(g_getenv("FLUTTER_LINUX_RENDERER"));
+  g_setenv("FLUTTER_LINUX_RENDERER", "vulkan", TRUE);
+
+  g_autoptr(FlDartProject) project = fl_dart_project_new();
+  g_autoptr(FlEngine) engine = fl_engine_new(project);
+  EXPECT_EQ(fl_engine_get_renderer_type(engine), kOpenGL);
+  EXPECT_EQ(fl_engine_get_vulkan_manager(engine), nullptr);
+
+  if (initial_renderer) {
+    g_setenv("FLUTTER_LINUX_RENDERER", initial_renderer, TRUE);
+  } else {
+    g_unsetenv("FLUTTER_LINUX_RENDERER");
+  }
+}
+
 // NOLINTEND(clang-analyzer-core.StackAddressEscape)
@@ -7,6 +7,7 @@
 #include <gmodule.h>
 
 #include "flutter/shell/platform/embedder/embedder.h"
+#include "flutter/shell/platform/linux/fl_dma_buf_texture_private.h"
 #include "flutter/shell/platform/linux/fl_engine_private.h"
 #include "flutter/shell/platform/linux/fl_pixel_buffer_texture_private.h"
 #include "flutter/shell/platform/linux/fl_texture_gl_private.h"
@@ -76,7 +77,8 @@ static gboolean register_texture(FlTextureRegistrar* registrar,
                                  FlTexture* texture) {
   FlTextureRegistrarImpl* self = FL_TEXTURE_REGISTRAR_IMPL(registrar);
 
-  if (FL_IS_TEXTURE_GL(texture) || FL_IS_PIXEL_BUFFER_TEXTURE(texture)) {
+  if (FL_IS_TEXTURE_GL(texture) || FL_IS_PIXEL_BUFFER_TEXTURE(texture) ||
+      FL_IS_DMA_BUF_TEXTURE(texture)) {
     g_autoptr(FlEngine) engine = FL_ENGINE(g_weak_ref_get(&self->engine));
     if (engine == nullptr) {
       return FALSE;
@@ -14,6 +14,7 @@
 #include "flutter/shell/platform/linux/fl_accessible_node.h"
 #include "flutter/shell/platform/linux/fl_compositor_opengl.h"
 #include "flutter/shell/platform/linux/fl_compositor_software.h"
+#include "flutter/shell/platform/linux/fl_compositor_vulkan.h"
 #include "flutter/shell/platform/linux/fl_engine_private.h"
 #include "flutter/shell/platform/linux/fl_key_event.h"
 #include "flutter/shell/platform/linux/fl_opengl_manager.h"
@@ -46,6 +47,10 @@ struct _FlView {
   // Combines layers into frame.
   FlCompositor* compositor;
 
+  // TRUE if the compositor presents directly to the window of the render
+  // area, so GTK must not draw over it.
+  gboolean presents_to_window;
+
   // Signal subscription for engine restart signal.
   guint on_pre_engine_restart_cb_id;
 
@@ -461,6 +466,25 @@ static void setup_software(FlView* self) {
       fl_compositor_software_new(fl_engine_get_task_runner(self->engine)));
 }
 
+static void setup_vulkan(FlView* self) {
+  GdkWindow* window = gtk_widget_get_window(GTK_WIDGET(self->render_area));
+
+  // On X11 frames are presented to the window of the render area, which
+  // needs its own X window that GTK doesn't draw to. Wayland uses a
+  // subsurface.
+  if (!GDK_IS_WAYLAND_DISPLAY(gtk_widget_get_display(GTK_WIDGET(self)))) {
+    gdk_window_ensure_native(window);
+    G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+    gtk_widget_set_double_buffered(GTK_WIDGET(self->render_area), FALSE);
+    G_GNUC_END_IGNORE_DEPRECATIONS
+    self->presents_to_window = TRUE;
+  }
+
+  self->compositor = FL_COMPOSITOR(fl_compositor_vulkan_new(
+      fl_engine_get_task_runner(self->engine),
+      fl_engine_get_vulkan_manager(self->engine), window));
+}
+
 static void realize_cb(FlView* self) {
   switch (fl_engine_get_renderer_type(self->engine)) {
     case kOpenGL:
@@ -469,6 +493,9 @@ static void realize_cb(FlView* self) {
     case kSoftware:
       setup_software(self);
       break;
+    case kVulkan:
+      setup_vulkan(self);
+      break;
     default:
       break;
   }
@@ -520,7 +547,9 @@ static void paint_background(FlView* self, cairo_t* cr) {
 }
 
 static gboolean draw_cb(FlView* self, cairo_t* cr) {
-  paint_background(self, cr);
+  if (!self->presents_to_window) {
+    paint_background(self, cr);
+  }
 
   if (self->render_context) {
     gdk_gl_context_make_current(self->render_context);
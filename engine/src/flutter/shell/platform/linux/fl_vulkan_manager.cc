@@ -0,0 +1,654 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/linux/fl_vulkan_manager.h"
+
+#include <gdk/gdkwayland.h>
+#include <gdk/gdkx.h>
+#include <gmodule.h>
+#include <vulkan/vulkan_wayland.h>
+#include <vulkan/vulkan_xlib.h>
+
+#include <cstring>
+
+// The version of Vulkan Impeller requires.
+static constexpr uint32_t kVulkanVersion = VK_API_VERSION_1_1;
+
+// Format of the images Flutter renders layers into.
+static constexpr VkFormat kImageFormat = VK_FORMAT_B8G8R8A8_UNORM;
+
+struct _FlVulkanManager {
+  GObject parent_instance;
+
+  // The Vulkan loader.
+  GModule* library;
+
+  // Functions used by the embedder.
+  FlVulkanProcs procs;
+
+  PFN_vkDestroyInstance destroy_instance;
+  PFN_vkDestroyDevice destroy_device;
+  PFN_vkCreateImage create_image;
+  PFN_vkDestroyImage destroy_image;
+  PFN_vkGetImageMemoryRequirements get_image_memory_requirements;
+  PFN_vkAllocateMemory allocate_memory;
+  PFN_vkFreeMemory free_memory;
+  PFN_vkBindImageMemory bind_image_memory;
+
+  VkInstance instance;
+  VkPhysicalDevice physical_device;
+  VkDevice device;
+  uint32_t queue_family_index;
+  VkQueue queue;
+
+  // Memory types of the physical device.
+  VkPhysicalDeviceMemoryProperties memory_properties;
+
+  // Names of the enabled extensions, as static strings.
+  GPtrArray* instance_extensions;
+  GPtrArray* device_extensions;
+};
+
+// An image created by fl_vulkan_manager_create_image().
+typedef struct {
+  FlutterVulkanImage image;
+  VkDeviceMemory memory;
+} FlVulkanManagerImage;
+
+G_DEFINE_QUARK(fl_vulkan_manager_error_quark, fl_vulkan_manager_error)
+
+G_DEFINE_TYPE(FlVulkanManager, fl_vulkan_manager, G_TYPE_OBJECT)
+
+// The queue is shared by the engine and the compositor, which use it from
+// different threads. Vulkan requires access to it to be externally
+// synchronized, so every function that uses it is replaced by one that holds
+// this lock.
+//
+// The engine looks up functions without passing any user data, so the lock and
+// the functions it wraps are global. The functions are the loader's, which
+// dispatch to any device.
+static GMutex queue_mutex;
+static PFN_vkGetInstanceProcAddr real_get_instance_proc_addr = nullptr;
+static PFN_vkGetDeviceProcAddr real_get_device_proc_addr = nullptr;
+static PFN_vkQueueSubmit real_queue_submit = nullptr;
+static PFN_vkQueueWaitIdle real_queue_wait_idle = nullptr;
+static PFN_vkQueuePresentKHR real_queue_present = nullptr;
+static PFN_vkDeviceWaitIdle real_device_wait_idle = nullptr;
+
+// Replaces the function provided by the library, see
+// fl_vulkan_manager_set_get_instance_proc_addr().
+static PFN_vkGetInstanceProcAddr override_get_instance_proc_addr = nullptr;
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+locked_queue_submit(VkQueue queue,
+                    uint32_t count,
+                    const VkSubmitInfo* submits,
+                    VkFence fence) {
+  g_autoptr(GMutexLocker) locker = g_mutex_locker_new(&queue_mutex);
+  return real_queue_submit(queue, count, submits, fence);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL locked_queue_wait_idle(VkQueue queue) {
+  g_autoptr(GMutexLocker) locker = g_mutex_locker_new(&queue_mutex);
+  return real_queue_wait_idle(queue);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+locked_queue_present(VkQueue queue, const VkPresentInfoKHR* present_info) {
+  g_autoptr(GMutexLocker) locker = g_mutex_locker_new(&queue_mutex);
+  return real_queue_present(queue, present_info);
+}
+
+// Waiting for a device requires access to all its queues.
+static VKAPI_ATTR VkResult VKAPI_CALL locked_device_wait_idle(VkDevice device) {
+  g_autoptr(GMutexLocker) locker = g_mutex_locker_new(&queue_mutex);
+  return real_device_wait_idle(device);
+}
+
+// Returns the replacement for a queue function or nullptr if the function does
+// not use the queue.
+static PFN_vkVoidFunction get_locked_proc(const char* name) {
+  if (strcmp(name, "vkQueueSubmit") == 0) {
+    return reinterpret_cast<PFN_vkVoidFunction>(locked_queue_submit);
+  } else if (strcmp(name, "vkQueueWaitIdle") == 0) {
+    return reinterpret_cast<PFN_vkVoidFunction>(locked_queue_wait_idle);
+  } else if (strcmp(name, "vkQueuePresentKHR") == 0) {
+    return reinterpret_cast<PFN_vkVoidFunction>(locked_queue_present);
+  } else if (strcmp(name, "vkDeviceWaitIdle") == 0) {
+    return reinterpret_cast<PFN_vkVoidFunction>(locked_device_wait_idle);
+  }
+  return nullptr;
+}
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL
+get_device_proc_addr(VkDevice device, const char* name) {
+  PFN_vkVoidFunction proc = get_locked_proc(name);
+  if (proc != nullptr) {
+    return proc;
+  }
+  return real_get_device_proc_addr(device, name);
+}
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL
+get_instance_proc_addr(VkInstance instance, const char* name) {
+  if (strcmp(name, "vkGetInstanceProcAddr") == 0) {
+    return reinterpret_cast<PFN_vkVoidFunction>(get_instance_proc_addr);
+  } else if (strcmp(name, "vkGetDeviceProcAddr") == 0) {
+    return reinterpret_cast<PFN_vkVoidFunction>(get_device_proc_addr);
+  }
+  PFN_vkVoidFunction proc = get_locked_proc(name);
+  if (proc != nullptr) {
+    return proc;
+  }
+  return real_get_instance_proc_addr(instance, name);
+}
+
+// Implements FlutterVulkanRendererConfig::get_instance_proc_address_callback.
+static void* get_instance_proc_address_cb(void* user_data,
+                                          FlutterVulkanInstanceHandle instance,
+                                          const char* name) {
+  return reinterpret_cast<void*>(
+      get_instance_proc_addr(static_cast<VkInstance>(instance), name));
+}
+
+// Returns TRUE if @name is in the list of extension properties.
+static gboolean has_extension(const VkExtensionProperties* extensions,
+                              uint32_t extensions_count,
+                              const char* name) {
+  for (uint32_t i = 0; i < extensions_count; i++) {
+    if (strcmp(extensions[i].extensionName, name) == 0) {
+      return TRUE;
+    }
+  }
+  return FALSE;
+}
+
+static gboolean load_library(FlVulkanManager* self, GError** error) {
+  if (override_get_instance_proc_addr != nullptr) {
+    real_get_instance_proc_addr = override_get_instance_proc_addr;
+    self->procs.GetInstanceProcAddr = get_instance_proc_addr;
+    return TRUE;
+  }
+
+  self->library = g_module_open("libvulkan.so.1", G_MODULE_BIND_LAZY);
+  if (self->library == nullptr) {
+    g_set_error(error, fl_vulkan_manager_error_quark(),
+                FL_VULKAN_MANAGER_ERROR_FAILED,
+                "Failed to load Vulkan library: %s", g_module_error());
+    return FALSE;
+  }
+
+  gpointer get_instance_proc_addr_symbol = nullptr;
+  if (!g_module_symbol(self->library, "vkGetInstanceProcAddr",
+                       &get_instance_proc_addr_symbol)) {
+    g_set_error(error, fl_vulkan_manager_error_quark(),
+                FL_VULKAN_MANAGER_ERROR_FAILED,
+                "Vulkan library does not provide vkGetInstanceProcAddr");
+    return FALSE;
+  }
+  real_get_instance_proc_addr = reinterpret_cast<PFN_vkGetInstanceProcAddr>(
+      get_instance_proc_addr_symbol);
+  self->procs.GetInstanceProcAddr = get_instance_proc_addr;
+
+  return TRUE;
+}
+
+static gboolean create_instance(FlVulkanManager* self,
+                                GdkDisplay* display,
+                                GError** error) {
+  auto enumerate_instance_extension_properties =
+      reinterpret_cast<PFN_vkEnumerateInstanceExtensionProperties>(
+          real_get_instance_proc_addr(
+              nullptr, "vkEnumerateInstanceExtensionProperties"));
+  auto vk_create_instance = reinterpret_cast<PFN_vkCreateInstance>(
+      real_get_instance_proc_addr(nullptr, "vkCreateInstance"));
+  if (enumerate_instance_extension_properties == nullptr ||
+      vk_create_instance == nullptr) {
+    g_set_error(error, fl_vulkan_manager_error_quark(),
+                FL_VULKAN_MANAGER_ERROR_FAILED,
+                "Vulkan library is missing instance functions");
+    return FALSE;
+  }
+
+  uint32_t extensions_count = 0;
+  enumerate_instance_extension_properties(nullptr, &extensions_count, nullptr);
+  g_autofree VkExtensionProperties* extensions =
+      g_new0(VkExtensionProperties, extensions_count);
+  enumerate_instance_extension_properties(nullptr, &extensions_count,
+                                          extensions);
+
+  const char* surface_extension = nullptr;
+  if (GDK_IS_WAYLAND_DISPLAY(display)) {
+    surface_extension = VK_KHR_WAYLAND_SURFACE_EXTENSION_NAME;
+  } else if (GDK_IS_X11_DISPLAY(display)) {
+    surface_extension = VK_KHR_XLIB_SURFACE_EXTENSION_NAME;
+  }
+  if (surface_extension == nullptr ||
+      !has_extension(extensions, extensions_count,
+                     VK_KHR_SURFACE_EXTENSION_NAME) ||
+      !has_extension(extensions, extensions_count, surface_extension)) {
+    g_set_error(error, fl_vulkan_manager_error_quark(),
+                FL_VULKAN_MANAGER_ERROR_FAILED,
+                "Vulkan can't present to this display");
+    return FALSE;
+  }
+  g_ptr_array_add(self->instance_extensions,
+                  const_cast<char*>(VK_KHR_SURFACE_EXTENSION_NAME));
+  g_ptr_array_add(self->instance_extensions,
+                  const_cast<char*>(surface_extension));
+
+  VkApplicationInfo application_info = {};
+  application_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+  application_info.pApplicationName = g_get_prgname();
+  application_info.pEngineName = "Flutter";
+  application_info.apiVersion = kVulkanVersion;
+
+  VkInstanceCreateInfo create_info = {};
+  create_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+  create_info.pApplicationInfo = &application_info;
+  create_info.enabledExtensionCount = self->instance_extensions->len;
+  create_info.ppEnabledExtensionNames =
+      reinterpret_cast<const char* const*>(self->instance_extensions->pdata);
+  VkResult result = vk_create_instance(&create_info, nullptr, &self->instance);
+  if (result != VK_SUCCESS) {
+    g_set_error(error, fl_vulkan_manager_error_quark(),
+                FL_VULKAN_MANAGER_ERROR_FAILED,
+                "Failed to create Vulkan instance: %d", result);
+    return FALSE;
+  }
+
+  self->destroy_instance = reinterpret_cast<PFN_vkDestroyInstance>(
+      real_get_instance_proc_addr(self->instance, "vkDestroyInstance"));
+
+  return TRUE;
+}
+
+// Picks the physical device to render with and the family of the queue to
+// use, preferring discrete GPUs.
+static gboolean pick_physical_device(FlVulkanManager* self, GError** error) {
+  auto enumerate_physical_devices =
+      reinterpret_cast<PFN_vkEnumeratePhysicalDevices>(
+          real_get_instance_proc_addr(self->instance,
+                                      "vkEnumeratePhysicalDevices"));
+  auto get_physical_device_properties =
+      reinterpret_cast<PFN_vkGetPhysicalDeviceProperties>(
+          real_get_instance_proc_addr(self->instance,
+                                      "vkGetPhysicalDeviceProperties"));
+  auto get_physical_device_queue_family_properties =
+      reinterpret_cast<PFN_vkGetPhysicalDeviceQueueFamilyProperties>(
+          real_get_instance_proc_addr(
+              self->instance, "vkGetPhysicalDeviceQueueFamilyProperties"));
+  auto enumerate_device_extension_properties =
+      reinterpret_cast<PFN_vkEnumerateDeviceExtensionProperties>(
+          real_get_instance_proc_addr(self->instance,
+                                      "vkEnumerateDeviceExtensionProperties"));
+
+  uint32_t devices_count = 0;
+  enumerate_physical_devices(self->instance, &devices_count, nullptr);
+  g_autofree VkPhysicalDevice* devices =
+      g_new0(VkPhysicalDevice, devices_count);
+  enumerate_physical_devices(self->instance, &devices_count, devices);
+
+  gboolean found = FALSE;
+  gboolean found_discrete = FALSE;
+  for (uint32_t i = 0; i < devices_count && !found_discrete; i++) {
+    VkPhysicalDeviceProperties properties;
+    get_physical_device_properties(devices[i], &properties);
+    if (properties.apiVersion < kVulkanVersion) {
+      continue;
+    }
+
+    uint32_t extensions_count = 0;
+    enumerate_device_extension_properties(devices[i], nullptr,
+                                          &extensions_count, nullptr);
+    g_autofree VkExtensionProperties* extensions =
+        g_new0(VkExtensionProperties, extensions_count);
+    enumerate_device_extension_properties(devices[i], nullptr,
+                                          &extensions_count, extensions);
+    if (!has_extension(extensions, extensions_count,
+                       VK_KHR_SWAPCHAIN_EXTENSION_NAME)) {
+      continue;
+    }
+
+    uint32_t families_count = 0;
+    get_physical_device_queue_family_properties(devices[i], &families_count,
+                                                nullptr);
+    g_autofree VkQueueFamilyProperties* families =
+        g_new0(VkQueueFamilyProperties, families_count);
+    get_physical_device_queue_family_properties(devices[i], &families_count,
+                                                families);
+    for (uint32_t j = 0; j < families_count; j++) {
+      if ((families[j].queueFlags & VK_QUEUE_GRAPHICS_BIT) == 0) {
+        continue;
+      }
+
+      self->physical_device = devices[i];
+      self->queue_family_index = j;
+      found = TRUE;
+      found_discrete =
+          properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU;
+      break;
+    }
+  }
+
+  if (!found) {
+    g_set_error(error, fl_vulkan_manager_error_quark(),
+                FL_VULKAN_MANAGER_ERROR_FAILED,
+                "No Vulkan %d.%d device can render and present",
+                VK_API_VERSION_MAJOR(kVulkanVersion),
+                VK_API_VERSION_MINOR(kVulkanVersion));
+    return FALSE;
+  }
+
+  auto get_physical_device_memory_properties =
+      reinterpret_cast<PFN_vkGetPhysicalDeviceMemoryProperties>(
+          real_get_instance_proc_addr(self->instance,
+                                      "vkGetPhysicalDeviceMemoryProperties"));
+  get_physical_device_memory_properties(self->physical_device,
+                                        &self->memory_properties);
+
+  return TRUE;
+}
+
+static gboolean create_device(FlVulkanManager* self, GError** error) {
+  auto vk_create_device = reinterpret_cast<PFN_vkCreateDevice>(
+      real_get_instance_proc_addr(self->instance, "vkCreateDevice"));
+
+  g_ptr_array_add(self->device_extensions,
+                  const_cast<char*>(VK_KHR_SWAPCHAIN_EXTENSION_NAME));
+
+  const float queue_priority = 1.0f;
+  VkDeviceQueueCreateInfo queue_info = {};
+  queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+  queue_info.queueFamilyIndex = self->queue_family_index;
+  queue_info.queueCount = 1;
+  queue_info.pQueuePriorities = &queue_priority;
+
+  VkDeviceCreateInfo create_info = {};
+  create_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+  create_info.queueCreateInfoCount = 1;
+  create_info.pQueueCreateInfos = &queue_info;
+  create_info.enabledExtensionCount = self->device_extensions->len;
+  create_info.ppEnabledExtensionNames =
+      reinterpret_cast<const char* const*>(self->device_extensions->pdata);
+  VkResult result = vk_create_device(self->physical_device, &create_info,
+                                     nullptr, &self->device);
+  if (result != VK_SUCCESS) {
+    g_set_error(error, fl_vulkan_manager_error_quark(),
+                FL_VULKAN_MANAGER_ERROR_FAILED,
+                "Failed to create Vulkan device: %d", result);
+    return FALSE;
+  }
+
+  real_get_device_proc_addr = reinterpret_cast<PFN_vkGetDeviceProcAddr>(
+      real_get_instance_proc_addr(self->instance, "vkGetDeviceProcAddr"));
+  auto get_device_queue = reinterpret_cast<PFN_vkGetDeviceQueue>(
+      real_get_device_proc_addr(self->device, "vkGetDeviceQueue"));
+  get_device_queue(self->device, self->queue_family_index, 0, &self->queue);
+
+  return TRUE;
+}
+
+// Looks up the functions used after the device is created.
+static void load_procs(FlVulkanManager* self) {
+  auto get_proc = [self](const char* name) {
+    return real_get_instance_proc_addr(self->instance, name);
+  };
+
+  real_queue_submit =
+      reinterpret_cast<PFN_vkQueueSubmit>(get_proc("vkQueueSubmit"));
+  real_queue_wait_idle =
+      reinterpret_cast<PFN_vkQueueWaitIdle>(get_proc("vkQueueWaitIdle"));
+  real_queue_present =
+      reinterpret_cast<PFN_vkQueuePresentKHR>(get_proc("vkQueuePresentKHR"));
+  real_device_wait_idle =
+      reinterpret_cast<PFN_vkDeviceWaitIdle>(get_proc("vkDeviceWaitIdle"));
+
+  FlVulkanProcs* procs = &self->procs;
+  procs->DestroySurfaceKHR = reinterpret_cast<PFN_vkDestroySurfaceKHR>(
+      get_proc("vkDestroySurfaceKHR"));
+  procs->GetPhysicalDeviceSurfaceSupportKHR =
+      reinterpret_cast<PFN_vkGetPhysicalDeviceSurfaceSupportKHR>(
+          get_proc("vkGetPhysicalDeviceSurfaceSupportKHR"));
+  procs->GetPhysicalDeviceSurfaceCapabilitiesKHR =
+      reinterpret_cast<PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR>(
+          get_proc("vkGetPhysicalDeviceSurfaceCapabilitiesKHR"));
+  procs->GetPhysicalDeviceSurfaceFormatsKHR =
+      reinterpret_cast<PFN_vkGetPhysicalDeviceSurfaceFormatsKHR>(
+          get_proc("vkGetPhysicalDeviceSurfaceFormatsKHR"));
+  procs->QueueSubmit = locked_queue_submit;
+  procs->QueueWaitIdle = locked_queue_wait_idle;
+  procs->QueuePresentKHR = locked_queue_present;
+  procs->DeviceWaitIdle = locked_device_wait_idle;
+  procs->CreateSwapchainKHR = reinterpret_cast<PFN_vkCreateSwapchainKHR>(
+      get_proc("vkCreateSwapchainKHR"));
+  procs->DestroySwapchainKHR = reinterpret_cast<PFN_vkDestroySwapchainKHR>(
+      get_proc("vkDestroySwapchainKHR"));
+  procs->GetSwapchainImagesKHR = reinterpret_cast<PFN_vkGetSwapchainImagesKHR>(
+      get_proc("vkGetSwapchainImagesKHR"));
+  procs->AcquireNextImageKHR = reinterpret_cast<PFN_vkAcquireNextImageKHR>(
+      get_proc("vkAcquireNextImageKHR"));
+  procs->CreateCommandPool = reinterpret_cast<PFN_vkCreateCommandPool>(
+      get_proc("vkCreateCommandPool"));
+  procs->DestroyCommandPool = reinterpret_cast<PFN_vkDestroyCommandPool>(
+      get_proc("vkDestroyCommandPool"));
+  procs->AllocateCommandBuffers =
+      reinterpret_cast<PFN_vkAllocateCommandBuffers>(
+          get_proc("vkAllocateCommandBuffers"));
+  procs->BeginCommandBuffer = reinterpret_cast<PFN_vkBeginCommandBuffer>(
+      get_proc("vkBeginCommandBuffer"));
+  procs->EndCommandBuffer =
+      reinterpret_cast<PFN_vkEndCommandBuffer>(get_proc("vkEndCommandBuffer"));
+  procs->CmdPipelineBarrier = reinterpret_cast<PFN_vkCmdPipelineBarrier>(
+      get_proc("vkCmdPipelineBarrier"));
+  procs->CmdClearColorImage = reinterpret_cast<PFN_vkCmdClearColorImage>(
+      get_proc("vkCmdClearColorImage"));
+  procs->CmdBlitImage =
+      reinterpret_cast<PFN_vkCmdBlitImage>(get_proc("vkCmdBlitImage"));
+  procs->CreateFence =
+      reinterpret_cast<PFN_vkCreateFence>(get_proc("vkCreateFence"));
+  procs->DestroyFence =
+      reinterpret_cast<PFN_vkDestroyFence>(get_proc("vkDestroyFence"));
+  procs->WaitForFences =
+      reinterpret_cast<PFN_vkWaitForFences>(get_proc("vkWaitForFences"));
+  procs->ResetFences =
+      reinterpret_cast<PFN_vkResetFences>(get_proc("vkResetFences"));
+  procs->CreateSemaphore =
+      reinterpret_cast<PFN_vkCreateSemaphore>(get_proc("vkCreateSemaphore"));
+  procs->DestroySemaphore =
+      reinterpret_cast<PFN_vkDestroySemaphore>(get_proc("vkDestroySemaphore"));
+
+  self->destroy_device =
+      reinterpret_cast<PFN_vkDestroyDevice>(get_proc("vkDestroyDevice"));
+  self->create_image =
+      reinterpret_cast<PFN_vkCreateImage>(get_proc("vkCreateImage"));
+  self->destroy_image =
+      reinterpret_cast<PFN_vkDestroyImage>(get_proc("vkDestroyImage"));
+  self->get_image_memory_requirements =
+      reinterpret_cast<PFN_vkGetImageMemoryRequirements>(
+          get_proc("vkGetImageMemoryRequirements"));
+  self->allocate_memory =
+      reinterpret_cast<PFN_vkAllocateMemory>(get_proc("vkAllocateMemory"));
+  self->free_memory =
+      reinterpret_cast<PFN_vkFreeMemory>(get_proc("vkFreeMemory"));
+  self->bind_image_memory =
+      reinterpret_cast<PFN_vkBindImageMemory>(get_proc("vkBindImageMemory"));
+}
+
+static void fl_vulkan_manager_dispose(GObject* object) {
+  FlVulkanManager* self = FL_VULKAN_MANAGER(object);
+
+  if (self->device != VK_NULL_HANDLE) {
+    locked_device_wait_idle(self->device);
+    self->destroy_device(self->device, nullptr);
+    self->device = VK_NULL_HANDLE;
+  }
+  if (self->instance != VK_NULL_HANDLE) {
+    self->destroy_instance(self->instance, nullptr);
+    self->instance = VK_NULL_HANDLE;
+  }
+  g_clear_pointer(&self->instance_extensions, g_ptr_array_unref);
+  g_clear_pointer(&self->device_extensions, g_ptr_array_unref);
+  g_clear_pointer(&self->library, g_module_close);
+
+  G_OBJECT_CLASS(fl_vulkan_manager_parent_class)->dispose(object);
+}
+
+static void fl_vulkan_manager_class_init(FlVulkanManagerClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = fl_vulkan_manager_dispose;
+}
+
+static void fl_vulkan_manager_init(FlVulkanManager* self) {
+  self->instance_extensions = g_ptr_array_new();
+  self->device_extensions = g_ptr_array_new();
+}
+
+FlVulkanManager* fl_vulkan_manager_new(GdkDisplay* display, GError** error) {
+  g_return_val_if_fail(GDK_IS_DISPLAY(display), nullptr);
+
+  g_autoptr(FlVulkanManager) self =
+      FL_VULKAN_MANAGER(g_object_new(fl_vulkan_manager_get_type(), nullptr));
+
+  if (!load_library(self, error) || !create_instance(self, display, error) ||
+      !pick_physical_device(self, error) || !create_device(self, error)) {
+    return nullptr;
+  }
+  load_procs(self);
+
+  return FL_VULKAN_MANAGER(g_object_ref(self));
+}
+
+void fl_vulkan_manager_set_get_instance_proc_addr(
+    PFN_vkGetInstanceProcAddr get_instance_proc_addr) {
+  override_get_instance_proc_addr = get_instance_proc_addr;
+}
+
+const FlVulkanProcs* fl_vulkan_manager_get_procs(FlVulkanManager* self) {
+  g_return_val_if_fail(FL_IS_VULKAN_MANAGER(self), nullptr);
+  return &self->procs;
+}
+
+VkInstance fl_vulkan_manager_get_instance(FlVulkanManager* self) {
+  g_return_val_if_fail(FL_IS_VULKAN_MANAGER(self), VK_NULL_HANDLE);
+  return self->instance;
+}
+
+VkPhysicalDevice fl_vulkan_manager_get_physical_device(FlVulkanManager* self) {
+  g_return_val_if_fail(FL_IS_VULKAN_MANAGER(self), VK_NULL_HANDLE);
+  return self->physical_device;
+}
+
+VkDevice fl_vulkan_manager_get_device(FlVulkanManager* self) {
+  g_return_val_if_fail(FL_IS_VULKAN_MANAGER(self), VK_NULL_HANDLE);
+  return self->device;
+}
+
+uint32_t fl_vulkan_manager_get_queue_family_index(FlVulkanManager* self) {
+  g_return_val_if_fail(FL_IS_VULKAN_MANAGER(self), 0);
+  return self->queue_family_index;
+}
+
+VkQueue fl_vulkan_manager_get_queue(FlVulkanManager* self) {
+  g_return_val_if_fail(FL_IS_VULKAN_MANAGER(self), VK_NULL_HANDLE);
+  return self->queue;
+}
+
+void fl_vulkan_manager_populate_renderer_config(
+    FlVulkanManager* self,
+    FlutterVulkanRendererConfig* config) {
+  g_return_if_fail(FL_IS_VULKAN_MANAGER(self));
+
+  config->version = kVulkanVersion;
+  config->instance = self->instance;
+  config->physical_device = self->physical_device;
+  config->device = self->device;
+  config->queue_family_index = self->queue_family_index;
+  config->queue = self->queue;
+  config->enabled_instance_extension_count = self->instance_extensions->len;
+  config->enabled_instance_extensions =
+      reinterpret_cast<const char**>(self->instance_extensions->pdata);
+  config->enabled_device_extension_count = self->device_extensions->len;
+  config->enabled_device_extensions =
+      reinterpret_cast<const char**>(self->device_extensions->pdata);
+  config->get_instance_proc_address_callback = get_instance_proc_address_cb;
+}
+
+FlutterVulkanImage* fl_vulkan_manager_create_image(FlVulkanManager* self,
+                                                   size_t width,
+                                                   size_t height) {
+  g_return_val_if_fail(FL_IS_VULKAN_MANAGER(self), nullptr);
+
+  VkImageCreateInfo create_info = {};
+  create_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+  create_info.imageType = VK_IMAGE_TYPE_2D;
+  create_info.format = kImageFormat;
+  create_info.extent = {static_cast<uint32_t>(width),
+                        static_cast<uint32_t>(height), 1};
+  create_info.mipLevels = 1;
+  create_info.arrayLayers = 1;
+  create_info.samples = VK_SAMPLE_COUNT_1_BIT;
+  create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+  create_info.usage =
+      VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT |
+      VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
+      VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+  create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+  create_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+  VkImage image = VK_NULL_HANDLE;
+  if (self->create_image(self->device, &create_info, nullptr, &image) !=
+      VK_SUCCESS) {
+    g_warning("Failed to create Vulkan image");
+    return nullptr;
+  }
+
+  VkMemoryRequirements requirements;
+  self->get_image_memory_requirements(self->device, image, &requirements);
+  uint32_t memory_type_index = self->memory_properties.memoryTypeCount;
+  for (uint32_t i = 0; i < self->memory_properties.memoryTypeCount; i++) {
+    if ((requirements.memoryTypeBits & (1u << i)) != 0 &&
+        (self->memory_properties.memoryTypes[i].propertyFlags &
+         VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) != 0) {
+      memory_type_index = i;
+      break;
+    }
+  }
+
+  VkMemoryAllocateInfo allocate_info = {};
+  allocate_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+  allocate_info.allocationSize = requirements.size;
+  allocate_info.memoryTypeIndex = memory_type_index;
+  VkDeviceMemory memory = VK_NULL_HANDLE;
+  if (memory_type_index == self->memory_properties.memoryTypeCount ||
+      self->allocate_memory(self->device, &allocate_info, nullptr, &memory) !=
+          VK_SUCCESS ||
+      self->bind_image_memory(self->device, image, memory, 0) != VK_SUCCESS) {
+    g_warning("Failed to allocate memory for Vulkan image");
+    if (memory != VK_NULL_HANDLE) {
+      self->free_memory(self->device, memory, nullptr);
+    }
+    self->destroy_image(self->device, image, nullptr);
+    return nullptr;
+  }
+
+  FlVulkanManagerImage* result = g_new0(FlVulkanManagerImage, 1);
+  result->image.struct_size = sizeof(FlutterVulkanImage);
+  result->image.image = reinterpret_cast<FlutterVulkanImageHandle>(image);
+  result->image.format = kImageFormat;
+  result->memory = memory;
+  return &result->image;
+}
+
+void fl_vulkan_manager_destroy_image(FlVulkanManager* self,
+                                     FlutterVulkanImage* image) {
+  g_return_if_fail(FL_IS_VULKAN_MANAGER(self));
+
+  FlVulkanManagerImage* manager_image =
+      reinterpret_cast<FlVulkanManagerImage*>(image);
+  // The image may still be being rendered into or copied from.
+  self->procs.QueueWaitIdle(self->queue);
+  self->destroy_image(self->device, reinterpret_cast<VkImage>(image->image),
+                      nullptr);
+  self->free_memory(self->device, manager_image->memory, nullptr);
+  g_free(manager_image);
+}
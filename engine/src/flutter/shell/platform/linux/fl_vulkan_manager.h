@@ -0,0 +1,190 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_LINUX_FL_VULKAN_MANAGER_H_
+#define FLUTTER_SHELL_PLATFORM_LINUX_FL_VULKAN_MANAGER_H_
+
+#include <gdk/gdk.h>
+
+// Vulkan is loaded at runtime, so only the function pointers in
+// #FlVulkanProcs may be used.
+#ifndef VK_NO_PROTOTYPES
+#define VK_NO_PROTOTYPES
+#endif
+#include <vulkan/vulkan.h>
+
+#include "flutter/shell/platform/embedder/embedder.h"
+
+G_BEGIN_DECLS
+
+typedef enum {
+  FL_VULKAN_MANAGER_ERROR_FAILED,
+} FlVulkanManagerError;
+
+GQuark fl_vulkan_manager_error_quark(void) G_GNUC_CONST;
+
+/**
+ * FlVulkanProcs:
+ *
+ * The Vulkan functions used by the embedder. The queue functions take the
+ * same lock as the engine does when it uses the queue.
+ */
+typedef struct {
+  PFN_vkGetInstanceProcAddr GetInstanceProcAddr;
+  PFN_vkDestroySurfaceKHR DestroySurfaceKHR;
+  PFN_vkGetPhysicalDeviceSurfaceSupportKHR GetPhysicalDeviceSurfaceSupportKHR;
+  PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR
+      GetPhysicalDeviceSurfaceCapabilitiesKHR;
+  PFN_vkGetPhysicalDeviceSurfaceFormatsKHR GetPhysicalDeviceSurfaceFormatsKHR;
+  PFN_vkQueueSubmit QueueSubmit;
+  PFN_vkQueueWaitIdle QueueWaitIdle;
+  PFN_vkQueuePresentKHR QueuePresentKHR;
+  PFN_vkDeviceWaitIdle DeviceWaitIdle;
+  PFN_vkCreateSwapchainKHR CreateSwapchainKHR;
+  PFN_vkDestroySwapchainKHR DestroySwapchainKHR;
+  PFN_vkGetSwapchainImagesKHR GetSwapchainImagesKHR;
+  PFN_vkAcquireNextImageKHR AcquireNextImageKHR;
+  PFN_vkCreateCommandPool CreateCommandPool;
+  PFN_vkDestroyCommandPool DestroyCommandPool;
+  PFN_vkAllocateCommandBuffers AllocateCommandBuffers;
+  PFN_vkBeginCommandBuffer BeginCommandBuffer;
+  PFN_vkEndCommandBuffer EndCommandBuffer;
+  PFN_vkCmdPipelineBarrier CmdPipelineBarrier;
+  PFN_vkCmdClearColorImage CmdClearColorImage;
+  PFN_vkCmdBlitImage CmdBlitImage;
+  PFN_vkCreateFence CreateFence;
+  PFN_vkDestroyFence DestroyFence;
+  PFN_vkWaitForFences WaitForFences;
+  PFN_vkResetFences ResetFences;
+  PFN_vkCreateSemaphore CreateSemaphore;
+  PFN_vkDestroySemaphore DestroySemaphore;
+} FlVulkanProcs;
+
+G_DECLARE_FINAL_TYPE(FlVulkanManager,
+                     fl_vulkan_manager,
+                     FL,
+                     VULKAN_MANAGER,
+                     GObject)
+
+/**
+ * fl_vulkan_manager_new:
+ * @display: the display Flutter will present to.
+ * @error: (allow-none): #GError location to store the error occurring, or
+ * %NULL to ignore.
+ *
+ * Creates an object that allows Flutter to render by Vulkan. Loads the Vulkan
+ * library and creates an instance that can present to @display and a device
+ * with a queue that supports graphics.
+ *
+ * Returns: a new #FlVulkanManager or %NULL if Vulkan is not available.
+ */
+FlVulkanManager* fl_vulkan_manager_new(GdkDisplay* display, GError** error);
+
+/**
+ * fl_vulkan_manager_set_get_instance_proc_addr:
+ * @get_instance_proc_addr: (allow-none): the function to look up Vulkan
+ * functions with or %NULL.
+ *
+ * Makes the managers created afterwards look up Vulkan functions with
+ * @get_instance_proc_addr instead of loading the Vulkan library, or load the
+ * library again if %NULL. This is used to test with a mock implementation.
+ */
+void fl_vulkan_manager_set_get_instance_proc_addr(
+    PFN_vkGetInstanceProcAddr get_instance_proc_addr);
+
+/**
+ * fl_vulkan_manager_get_procs:
+ * @manager: an #FlVulkanManager.
+ *
+ * Gets the Vulkan functions used by the embedder.
+ *
+ * Returns: a table of Vulkan functions.
+ */
+const FlVulkanProcs* fl_vulkan_manager_get_procs(FlVulkanManager* manager);
+
+/**
+ * fl_vulkan_manager_get_instance:
+ * @manager: an #FlVulkanManager.
+ *
+ * Returns: the Vulkan instance.
+ */
+VkInstance fl_vulkan_manager_get_instance(FlVulkanManager* manager);
+
+/**
+ * fl_vulkan_manager_get_physical_device:
+ * @manager: an #FlVulkanManager.
+ *
+ * Returns: the physical device Flutter renders with.
+ */
+VkPhysicalDevice fl_vulkan_manager_get_physical_device(
+    FlVulkanManager* manager);
+
+/**
+ * fl_vulkan_manager_get_device:
+ * @manager: an #FlVulkanManager.
+ *
+ * Returns: the logical device Flutter renders with.
+ */
+VkDevice fl_vulkan_manager_get_device(FlVulkanManager* manager);
+
+/**
+ * fl_vulkan_manager_get_queue_family_index:
+ * @manager: an #FlVulkanManager.
+ *
+ * Returns: the family of the queue returned by fl_vulkan_manager_get_queue().
+ */
+uint32_t fl_vulkan_manager_get_queue_family_index(FlVulkanManager* manager);
+
+/**
+ * fl_vulkan_manager_get_queue:
+ * @manager: an #FlVulkanManager.
+ *
+ * Gets the queue Flutter renders with. It must only be used with the queue
+ * functions from fl_vulkan_manager_get_procs().
+ *
+ * Returns: a Vulkan queue.
+ */
+VkQueue fl_vulkan_manager_get_queue(FlVulkanManager* manager);
+
+/**
+ * fl_vulkan_manager_populate_renderer_config:
+ * @manager: an #FlVulkanManager.
+ * @config: the configuration to populate.
+ *
+ * Populates the parts of a renderer configuration that describe the instance,
+ * device and queue. The configuration refers to memory owned by @manager.
+ */
+void fl_vulkan_manager_populate_renderer_config(
+    FlVulkanManager* manager,
+    FlutterVulkanRendererConfig* config);
+
+/**
+ * fl_vulkan_manager_create_image:
+ * @manager: an #FlVulkanManager.
+ * @width: width of the image in pixels.
+ * @height: height of the image in pixels.
+ *
+ * Creates an image in device memory for Flutter to render a layer into and
+ * for the compositor to copy from.
+ *
+ * Returns: a new image to be destroyed with fl_vulkan_manager_destroy_image()
+ * or %NULL on error.
+ */
+FlutterVulkanImage* fl_vulkan_manager_create_image(FlVulkanManager* manager,
+                                                   size_t width,
+                                                   size_t height);
+
+/**
+ * fl_vulkan_manager_destroy_image:
+ * @manager: an #FlVulkanManager.
+ * @image: an image created with fl_vulkan_manager_create_image().
+ *
+ * Destroys an image and frees its memory.
+ */
+void fl_vulkan_manager_destroy_image(FlVulkanManager* manager,
+                                     FlutterVulkanImage* image);
+
+G_END_DECLS
+
+#endif  // FLUTTER_SHELL_PLATFORM_LINUX_FL_VULKAN_MANAGER_H_
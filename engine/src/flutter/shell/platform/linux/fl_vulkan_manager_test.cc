@@ -0,0 +1,88 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "gtest/gtest.h"
+
+#include "flutter/shell/platform/linux/fl_vulkan_manager.h"
+#include "flutter/shell/platform/linux/testing/mock_vulkan.h"
+
+#include <vulkan/vulkan_wayland.h>
+
+using ::testing::_;
+using ::testing::Return;
+
+TEST(FlVulkanManagerTest, CreatesDevice) {
+  ::testing::NiceMock<flutter::testing::MockVulkan> vulkan;
+
+  g_autoptr(GError) error = nullptr;
+  g_autoptr(FlVulkanManager) manager =
+      fl_vulkan_manager_new(gdk_display_get_default(), &error);
+  ASSERT_NE(manager, nullptr);
+  EXPECT_EQ(error, nullptr);
+
+  EXPECT_NE(fl_vulkan_manager_get_instance(manager), VK_NULL_HANDLE);
+  EXPECT_NE(fl_vulkan_manager_get_physical_device(manager), VK_NULL_HANDLE);
+  EXPECT_NE(fl_vulkan_manager_get_device(manager), VK_NULL_HANDLE);
+  EXPECT_NE(fl_vulkan_manager_get_queue(manager), VK_NULL_HANDLE);
+  EXPECT_EQ(fl_vulkan_manager_get_queue_family_index(manager), 0u);
+
+  FlutterVulkanRendererConfig config = {};
+  fl_vulkan_manager_populate_renderer_config(manager, &config);
+  EXPECT_EQ(config.instance, fl_vulkan_manager_get_instance(manager));
+  EXPECT_EQ(config.device, fl_vulkan_manager_get_device(manager));
+  EXPECT_EQ(config.queue, fl_vulkan_manager_get_queue(manager));
+  ASSERT_EQ(config.enabled_instance_extension_count, 2u);
+  EXPECT_STREQ(config.enabled_instance_extensions[0],
+               VK_KHR_SURFACE_EXTENSION_NAME);
+  EXPECT_STREQ(config.enabled_instance_extensions[1],
+               VK_KHR_WAYLAND_SURFACE_EXTENSION_NAME);
+  ASSERT_EQ(config.enabled_device_extension_count, 1u);
+  EXPECT_STREQ(config.enabled_device_extensions[0],
+               VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+  EXPECT_NE(config.get_instance_proc_address_callback, nullptr);
+}
+
+TEST(FlVulkanManagerTest, InstanceCreationFails) {
+  ::testing::NiceMock<flutter::testing::MockVulkan> vulkan;
+
+  EXPECT_CALL(vulkan, vkCreateInstance(_, _, _))
+      .WillOnce(Return(VK_ERROR_INCOMPATIBLE_DRIVER));
+  EXPECT_CALL(vulkan, vkCreateDevice(_, _, _, _)).Times(0);
+
+  g_autoptr(GError) error = nullptr;
+  g_autoptr(FlVulkanManager) manager =
+      fl_vulkan_manager_new(gdk_display_get_default(), &error);
+  EXPECT_EQ(manager, nullptr);
+  EXPECT_TRUE(g_error_matches(error, fl_vulkan_manager_error_quark(),
+                              FL_VULKAN_MANAGER_ERROR_FAILED));
+}
+
+TEST(FlVulkanManagerTest, DeviceCreationFails) {
+  ::testing::NiceMock<flutter::testing::MockVulkan> vulkan;
+
+  EXPECT_CALL(vulkan, vkCreateDevice(_, _, _, _))
+      .WillOnce(Return(VK_ERROR_INITIALIZATION_FAILED));
+
+  g_autoptr(GError) error = nullptr;
+  g_autoptr(FlVulkanManager) manager =
+      fl_vulkan_manager_new(gdk_display_get_default(), &error);
+  EXPECT_EQ(manager, nullptr);
+  EXPECT_TRUE(g_error_matches(error, fl_vulkan_manager_error_quark(),
+                              FL_VULKAN_MANAGER_ERROR_FAILED));
+}
+
+TEST(FlVulkanManagerTest, CreateImage) {
+  ::testing::NiceMock<flutter::testing::MockVulkan> vulkan;
+
+  g_autoptr(FlVulkanManager) manager =
+      fl_vulkan_manager_new(gdk_display_get_default(), nullptr);
+  ASSERT_NE(manager, nullptr);
+
+  FlutterVulkanImage* image =
+      fl_vulkan_manager_create_image(manager, 100, 100);
+  ASSERT_NE(image, nullptr);
+  EXPECT_NE(image->image, 0u);
+  EXPECT_EQ(image->format, static_cast<uint32_t>(VK_FORMAT_B8G8R8A8_UNORM));
+  fl_vulkan_manager_destroy_image(manager, image);
+}
@@ -0,0 +1,152 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_LINUX_PUBLIC_FLUTTER_LINUX_FL_DMA_BUF_TEXTURE_H_
+#define FLUTTER_SHELL_PLATFORM_LINUX_PUBLIC_FLUTTER_LINUX_FL_DMA_BUF_TEXTURE_H_
+
+#if !defined(__FLUTTER_LINUX_INSIDE__) && !defined(FLUTTER_LINUX_COMPILATION)
+#error "Only <flutter_linux/flutter_linux.h> can be included directly."
+#endif
+
+#include <gmodule.h>
+
+#include "fl_texture.h"
+
+G_BEGIN_DECLS
+
+/**
+ * FL_DMA_BUF_MAX_PLANES:
+ *
+ * The maximum number of planes of an #FlDmaBuf.
+ */
+#define FL_DMA_BUF_MAX_PLANES 4
+
+/**
+ * FlDmaBufPlane:
+ * @fd: file descriptor of the DMA-BUF the plane is in.
+ * @offset: offset of the plane in the DMA-BUF in bytes.
+ * @pitch: number of bytes between the starts of two rows of the plane.
+ *
+ * A plane of an #FlDmaBuf. The planes of a buffer may share a DMA-BUF.
+ */
+typedef struct {
+  int fd;
+  uint32_t offset;
+  uint32_t pitch;
+} FlDmaBufPlane;
+
+/**
+ * FlDmaBuf:
+ * @width: width of the buffer in pixels.
+ * @height: height of the buffer in pixels.
+ * @fourcc: format of the buffer, as a DRM_FORMAT_* fourcc code from
+ * drm_fourcc.h, e.g. DRM_FORMAT_ARGB8888 or DRM_FORMAT_NV12.
+ * @modifier: layout of the buffer, as a DRM_FORMAT_MOD_* code from
+ * drm_fourcc.h, or DRM_FORMAT_MOD_INVALID to let the driver infer it.
+ * @n_planes: number of planes of the buffer, e.g. two for NV12.
+ * @planes: the planes of the buffer.
+ *
+ * A buffer of pixels in one or more DMA-BUFs, such as a frame decoded by a
+ * hardware video decoder or captured by a camera.
+ */
+typedef struct {
+  uint32_t width;
+  uint32_t height;
+  uint32_t fourcc;
+  uint64_t modifier;
+  guint n_planes;
+  FlDmaBufPlane planes[FL_DMA_BUF_MAX_PLANES];
+} FlDmaBuf;
+
+G_MODULE_EXPORT
+G_DECLARE_DERIVABLE_TYPE(FlDmaBufTexture,
+                         fl_dma_buf_texture,
+                         FL,
+                         DMA_BUF_TEXTURE,
+                         GObject)
+
+/**
+ * FlDmaBufTexture:
+ *
+ * #FlDmaBufTexture represents an OpenGL texture imported from DMA-BUFs
+ * without copying their pixels.
+ *
+ * The buffers are imported with the EGL_EXT_image_dma_buf_import extension,
+ * so this texture can only be used when Flutter renders with EGL. Buffers
+ * in YUV formats such as NV12 are converted to RGB by the GPU as they are
+ * sampled.
+ *
+ * The following example shows how to implement an #FlDmaBufTexture.
+ * ![<!-- language="C" -->
+ *   struct _MyTexture {
+ *     FlDmaBufTexture parent_instance;
+ *   }
+ *
+ *   G_DEFINE_TYPE(MyTexture,
+ *                 my_texture,
+ *                 fl_dma_buf_texture_get_type ())
+ *
+ *   static gboolean
+ *   my_texture_get_buffer (FlDmaBufTexture* texture,
+ *                          FlDmaBuf* buffer,
+ *                          GError** error) {
+ *     // This method is called on Render Thread. Be careful with your
+ *     // cross-thread operation.
+ *
+ *     // @buffer is initially the canvas size in Flutter.
+ *     MyFrame* frame = get_latest_decoded_frame ();
+ *
+ *     buffer->width = frame->width;
+ *     buffer->height = frame->height;
+ *     buffer->fourcc = DRM_FORMAT_NV12;
+ *     buffer->modifier = DRM_FORMAT_MOD_LINEAR;
+ *     buffer->n_planes = 2;
+ *     buffer->planes[0].fd = frame->fd;
+ *     buffer->planes[0].offset = 0;
+ *     buffer->planes[0].pitch = frame->stride;
+ *     buffer->planes[1].fd = frame->fd;
+ *     buffer->planes[1].offset = frame->stride * frame->height;
+ *     buffer->planes[1].pitch = frame->stride;
+ *     return TRUE;
+ *   }
+ *
+ *   static void my_texture_class_init(MyTextureClass* klass) {
+ *     FL_DMA_BUF_TEXTURE_CLASS(klass)->get_buffer = my_texture_get_buffer;
+ *   }
+ *
+ *   static void my_texture_init(MyTexture* self) {}
+ * ]|
+ */
+
+struct _FlDmaBufTextureClass {
+  GObjectClass parent_class;
+
+  /**
+   * FlDmaBufTexture::get_buffer:
+   * @texture: an #FlDmaBufTexture.
+   * @buffer: (inout): the buffer to show. Its width and height are initially
+   * the size of the texture in Flutter.
+   * @error: (allow-none): #GError location to store the error occurring, or
+   * %NULL to ignore. If `error` is not %NULL, `*error` must be initialized
+   * (typically %NULL, but an error from a previous call using GLib error
+   * handling is explicitly valid).
+   *
+   * Retrieve the buffer to show in the texture.
+   *
+   * As this method is usually invoked from the render thread, you must
+   * take care of proper synchronization. Flutter renders from the buffer
+   * without copying its pixels, so its contents must not change until this
+   * method is called again. The file descriptors are not taken ownership
+   * of, and are no longer used once this method has returned.
+   *
+   * Returns: %TRUE on success.
+   */
+  gboolean (*get_buffer)(FlDmaBufTexture* texture,
+                         FlDmaBuf* buffer,
+                         GError** error);
+};
+
+G_END_DECLS
+
+#endif  // FLUTTER_SHELL_PLATFORM_LINUX_PUBLIC_FLUTTER_LINUX_FL_DMA_BUF_TEXTURE_H_
@@ -384,6 +384,11 @@ EGLImageKHR _eglCreateImageKHR(EGLDisplay dpy,
   return &mock_image;
 }
 
+EGLBoolean _eglDestroyImageKHR(EGLDisplay dpy, EGLImageKHR image) {
+  mock->eglDestroyImageKHR(dpy, image);
+  return bool_success();
+}
+
 static GLuint bound_texture_2d;
 
 static std::map<GLenum, GLuint> framebuffer_renderbuffers;
@@ -489,6 +494,12 @@ static void _glGenTextures(GLsizei n, GLuint* textures) {
   }
 }
 
+static void _glEGLImageTargetTexture2DOES(GLenum target, GLeglImageOES image) {
+  if (mock) {
+    mock->glEGLImageTargetTexture2DOES(target, image);
+  }
+}
+
 static void _glGenFramebuffers(GLsizei n, GLuint* framebuffers) {
   for (GLsizei i = 0; i < n; i++) {
     framebuffers[i] = 0;
@@ -593,6 +604,10 @@ void _glShaderSource(GLuint shader,
                      const GLchar* const* string,
                      const GLint* length) {}
 
+bool epoxy_has_egl_extension(EGLDisplay dpy, const char* extension) {
+  return mock->epoxy_has_egl_extension(dpy, extension);
+}
+
 bool epoxy_has_gl_extension(const char* extension) {
   return mock->epoxy_has_gl_extension(extension);
 }
@@ -663,6 +678,7 @@ EGLImageKHR (*epoxy_eglCreateImageKHR)(EGLDisplay dpy,
                                        EGLenum target,
                                        EGLClientBuffer buffer,
                                        const EGLint* attrib_list);
+EGLBoolean (*epoxy_eglDestroyImageKHR)(EGLDisplay dpy, EGLImageKHR image);
 
 void (*epoxy_glAttachShader)(GLuint program, GLuint shader);
 void (*epoxy_glBindFramebuffer)(GLenum target, GLuint framebuffer);
@@ -684,6 +700,7 @@ GLuint (*epoxy_glCreateShader)(GLenum shaderType);
 void (*epoxy_glDeleteFramebuffers)(GLsizei n, const GLuint* framebuffers);
 void (*expoxy_glDeleteShader)(GLuint shader);
 void (*epoxy_glDeleteTextures)(GLsizei n, const GLuint* textures);
+void (*epoxy_glEGLImageTargetTexture2DOES)(GLenum target, GLeglImageOES image);
 void (*epoxy_glFramebufferRenderbuffer)(GLenum target,
                                         GLenum attachment,
                                         GLenum renderbuffertarget,
@@ -739,6 +756,7 @@ static void library_init() {
   epoxy_eglQueryContext = _eglQueryContext;
   epoxy_eglSwapBuffers = _eglSwapBuffers;
   epoxy_eglCreateImageKHR = _eglCreateImageKHR;
+  epoxy_eglDestroyImageKHR = _eglDestroyImageKHR;
 
   epoxy_glAttachShader = _glAttachShader;
   epoxy_glBindFramebuffer = _glBindFramebuffer;
@@ -753,6 +771,7 @@ static void library_init() {
   epoxy_glDeleteRenderbuffers = _glDeleteRenderbuffers;
   epoxy_glDeleteShader = _glDeleteShader;
   epoxy_glDeleteTextures = _glDeleteTextures;
+  epoxy_glEGLImageTargetTexture2DOES = _glEGLImageTargetTexture2DOES;
   epoxy_glDisable = _glDisable;
   epoxy_glEnable = _glEnable;
   epoxy_glFramebufferRenderbuffer = _glFramebufferRenderbuffer;
@@ -18,6 +18,9 @@ class MockEpoxy {
   MockEpoxy();
   ~MockEpoxy();
 
+  MOCK_METHOD(bool,
+              epoxy_has_egl_extension,
+              (EGLDisplay dpy, const char* extension));
   MOCK_METHOD(bool, epoxy_has_gl_extension, (const char* extension));
   MOCK_METHOD(bool, epoxy_is_desktop_gl, ());
   MOCK_METHOD(int, epoxy_gl_version, ());
@@ -28,6 +31,7 @@ class MockEpoxy {
                EGLenum target,
                EGLClientBuffer buffer,
                const EGLint* attrib_list));
+  MOCK_METHOD(void, eglDestroyImageKHR, (EGLDisplay dpy, EGLImageKHR image));
   MOCK_METHOD(void, glClearColor, (GLfloat r, GLfloat g, GLfloat b, GLfloat a));
   MOCK_METHOD(void,
               glBlitFramebuffer,
@@ -48,6 +52,9 @@ class MockEpoxy {
               glDeleteRenderbuffers,
               (GLsizei n, const GLuint* renderbuffers));
   MOCK_METHOD(void, glDeleteTextures, (GLsizei n, const GLuint* textures));
+  MOCK_METHOD(void,
+              glEGLImageTargetTexture2DOES,
+              (GLenum target, GLeglImageOES image));
   MOCK_METHOD(void, glGenFramebuffers, (GLsizei n, GLuint* framebuffers));
   MOCK_METHOD(void, glGenRenderbuffers, (GLsizei n, GLuint* renderbuffers));
   MOCK_METHOD(void, glGenTextures, (GLsizei n, GLuint* textures));
@@ -0,0 +1,550 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/linux/testing/mock_vulkan.h"
+
+#include <gdk/gdkx.h>
+#include <vulkan/vulkan_wayland.h>
+#include <vulkan/vulkan_xlib.h>
+
+#include <cstring>
+
+using namespace flutter::testing;
+
+static MockVulkan* mock = nullptr;
+
+// Non-zero handles for the objects the mock creates. The Linux embedder only
+// supports 64-bit platforms, where all Vulkan handles are pointers.
+template <typename T>
+static T make_handle(uintptr_t value) {
+  return reinterpret_cast<T>(value);
+}
+
+static uintptr_t next_handle = 1;
+
+template <typename T>
+static T new_handle() {
+  return make_handle<T>(next_handle++);
+}
+
+static const VkPhysicalDevice mock_physical_device =
+    make_handle<VkPhysicalDevice>(0x1000);
+static const VkQueue mock_queue = make_handle<VkQueue>(0x2000);
+
+static constexpr uint32_t kMockSwapchainImageCount = 3;
+
+static void set_extensions(const char* const* names,
+                           uint32_t names_count,
+                           uint32_t* count,
+                           VkExtensionProperties* properties) {
+  if (properties == nullptr) {
+    *count = names_count;
+    return;
+  }
+  for (uint32_t i = 0; i < *count && i < names_count; i++) {
+    strncpy(properties[i].extensionName, names[i], VK_MAX_EXTENSION_NAME_SIZE);
+    properties[i].specVersion = 1;
+  }
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_enumerate_instance_extension_properties(const char* layer_name,
+                                           uint32_t* count,
+                                           VkExtensionProperties* properties) {
+  const char* names[] = {VK_KHR_SURFACE_EXTENSION_NAME,
+                         VK_KHR_WAYLAND_SURFACE_EXTENSION_NAME,
+                         VK_KHR_XLIB_SURFACE_EXTENSION_NAME};
+  set_extensions(names, G_N_ELEMENTS(names), count, properties);
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_create_instance(const VkInstanceCreateInfo* create_info,
+                   const VkAllocationCallbacks* allocator,
+                   VkInstance* instance) {
+  return mock->vkCreateInstance(create_info, allocator, instance);
+}
+
+static VKAPI_ATTR void VKAPI_CALL
+vk_destroy_instance(VkInstance instance,
+                    const VkAllocationCallbacks* allocator) {}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_enumerate_physical_devices(VkInstance instance,
+                              uint32_t* count,
+                              VkPhysicalDevice* physical_devices) {
+  if (physical_devices == nullptr) {
+    *count = 1;
+    return VK_SUCCESS;
+  }
+  if (*count >= 1) {
+    physical_devices[0] = mock_physical_device;
+  }
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL
+vk_get_physical_device_properties(VkPhysicalDevice physical_device,
+                                  VkPhysicalDeviceProperties* properties) {
+  *properties = {};
+  properties->apiVersion = VK_API_VERSION_1_1;
+  properties->deviceType = VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU;
+  strncpy(properties->deviceName, "Mock GPU",
+          VK_MAX_PHYSICAL_DEVICE_NAME_SIZE);
+}
+
+static VKAPI_ATTR void VKAPI_CALL vk_get_physical_device_queue_family_properties(
+    VkPhysicalDevice physical_device,
+    uint32_t* count,
+    VkQueueFamilyProperties* properties) {
+  if (properties == nullptr) {
+    *count = 1;
+    return;
+  }
+  if (*count >= 1) {
+    properties[0] = {};
+    properties[0].queueFlags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_TRANSFER_BIT;
+    properties[0].queueCount = 1;
+  }
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_enumerate_device_extension_properties(VkPhysicalDevice physical_device,
+                                         const char* layer_name,
+                                         uint32_t* count,
+                                         VkExtensionProperties* properties) {
+  const char* names[] = {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
+  set_extensions(names, G_N_ELEMENTS(names), count, properties);
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL vk_get_physical_device_memory_properties(
+    VkPhysicalDevice physical_device,
+    VkPhysicalDeviceMemoryProperties* properties) {
+  *properties = {};
+  properties->memoryTypeCount = 1;
+  properties->memoryTypes[0].propertyFlags =
+      VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+  properties->memoryHeapCount = 1;
+  properties->memoryHeaps[0].size = 1024 * 1024 * 1024;
+  properties->memoryHeaps[0].flags = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_create_device(VkPhysicalDevice physical_device,
+                 const VkDeviceCreateInfo* create_info,
+                 const VkAllocationCallbacks* allocator,
+                 VkDevice* device) {
+  return mock->vkCreateDevice(physical_device, create_info, allocator, device);
+}
+
+static VKAPI_ATTR void VKAPI_CALL
+vk_destroy_device(VkDevice device, const VkAllocationCallbacks* allocator) {}
+
+static VKAPI_ATTR void VKAPI_CALL vk_get_device_queue(VkDevice device,
+                                                      uint32_t family_index,
+                                                      uint32_t index,
+                                                      VkQueue* queue) {
+  *queue = mock_queue;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_queue_submit(VkQueue queue,
+                uint32_t count,
+                const VkSubmitInfo* submits,
+                VkFence fence) {
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vk_queue_wait_idle(VkQueue queue) {
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_queue_present(VkQueue queue, const VkPresentInfoKHR* present_info) {
+  return mock->vkQueuePresentKHR(queue, present_info);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vk_device_wait_idle(VkDevice device) {
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL
+vk_destroy_surface(VkInstance instance,
+                   VkSurfaceKHR surface,
+                   const VkAllocationCallbacks* allocator) {}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_get_physical_device_surface_support(VkPhysicalDevice physical_device,
+                                       uint32_t family_index,
+                                       VkSurfaceKHR surface,
+                                       VkBool32* supported) {
+  *supported = VK_TRUE;
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_get_physical_device_surface_capabilities(
+    VkPhysicalDevice physical_device,
+    VkSurfaceKHR surface,
+    VkSurfaceCapabilitiesKHR* capabilities) {
+  return mock->vkGetPhysicalDeviceSurfaceCapabilitiesKHR(physical_device,
+                                                         surface, capabilities);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_get_physical_device_surface_formats(VkPhysicalDevice physical_device,
+                                       VkSurfaceKHR surface,
+                                       uint32_t* count,
+                                       VkSurfaceFormatKHR* formats) {
+  if (formats == nullptr) {
+    *count = 1;
+    return VK_SUCCESS;
+  }
+  if (*count >= 1) {
+    formats[0].format = VK_FORMAT_B8G8R8A8_UNORM;
+    formats[0].colorSpace = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
+  }
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_create_swapchain(VkDevice device,
+                    const VkSwapchainCreateInfoKHR* create_info,
+                    const VkAllocationCallbacks* allocator,
+                    VkSwapchainKHR* swapchain) {
+  return mock->vkCreateSwapchainKHR(device, create_info, allocator, swapchain);
+}
+
+static VKAPI_ATTR void VKAPI_CALL
+vk_destroy_swapchain(VkDevice device,
+                     VkSwapchainKHR swapchain,
+                     const VkAllocationCallbacks* allocator) {
+  mock->vkDestroySwapchainKHR(device, swapchain, allocator);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_get_swapchain_images(VkDevice device,
+                        VkSwapchainKHR swapchain,
+                        uint32_t* count,
+                        VkImage* images) {
+  if (images == nullptr) {
+    *count = kMockSwapchainImageCount;
+    return VK_SUCCESS;
+  }
+  for (uint32_t i = 0; i < *count && i < kMockSwapchainImageCount; i++) {
+    images[i] = new_handle<VkImage>();
+  }
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_acquire_next_image(VkDevice device,
+                      VkSwapchainKHR swapchain,
+                      uint64_t timeout,
+                      VkSemaphore semaphore,
+                      VkFence fence,
+                      uint32_t* image_index) {
+  return mock->vkAcquireNextImageKHR(device, swapchain, timeout, semaphore,
+                                     fence, image_index);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_create_command_pool(VkDevice device,
+                       const VkCommandPoolCreateInfo* create_info,
+                       const VkAllocationCallbacks* allocator,
+                       VkCommandPool* command_pool) {
+  *command_pool = new_handle<VkCommandPool>();
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL
+vk_destroy_command_pool(VkDevice device,
+                        VkCommandPool command_pool,
+                        const VkAllocationCallbacks* allocator) {}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_allocate_command_buffers(VkDevice device,
+                            const VkCommandBufferAllocateInfo* allocate_info,
+                            VkCommandBuffer* command_buffers) {
+  for (uint32_t i = 0; i < allocate_info->commandBufferCount; i++) {
+    command_buffers[i] = new_handle<VkCommandBuffer>();
+  }
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_begin_command_buffer(VkCommandBuffer command_buffer,
+                        const VkCommandBufferBeginInfo* begin_info) {
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_end_command_buffer(VkCommandBuffer command_buffer) {
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL
+vk_cmd_pipeline_barrier(VkCommandBuffer command_buffer,
+                        VkPipelineStageFlags src_stage_mask,
+                        VkPipelineStageFlags dst_stage_mask,
+                        VkDependencyFlags dependency_flags,
+                        uint32_t memory_barrier_count,
+                        const VkMemoryBarrier* memory_barriers,
+                        uint32_t buffer_memory_barrier_count,
+                        const VkBufferMemoryBarrier* buffer_memory_barriers,
+                        uint32_t image_memory_barrier_count,
+                        const VkImageMemoryBarrier* image_memory_barriers) {}
+
+static VKAPI_ATTR void VKAPI_CALL
+vk_cmd_clear_color_image(VkCommandBuffer command_buffer,
+                         VkImage image,
+                         VkImageLayout layout,
+                         const VkClearColorValue* color,
+                         uint32_t range_count,
+                         const VkImageSubresourceRange* ranges) {}
+
+static VKAPI_ATTR void VKAPI_CALL
+vk_cmd_blit_image(VkCommandBuffer command_buffer,
+                  VkImage src_image,
+                  VkImageLayout src_layout,
+                  VkImage dst_image,
+                  VkImageLayout dst_layout,
+                  uint32_t region_count,
+                  const VkImageBlit* regions,
+                  VkFilter filter) {}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_create_fence(VkDevice device,
+                const VkFenceCreateInfo* create_info,
+                const VkAllocationCallbacks* allocator,
+                VkFence* fence) {
+  *fence = new_handle<VkFence>();
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL
+vk_destroy_fence(VkDevice device,
+                 VkFence fence,
+                 const VkAllocationCallbacks* allocator) {}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vk_wait_for_fences(VkDevice device,
+                                                         uint32_t count,
+                                                         const VkFence* fences,
+                                                         VkBool32 wait_all,
+                                                         uint64_t timeout) {
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vk_reset_fences(VkDevice device,
+                                                      uint32_t count,
+                                                      const VkFence* fences) {
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_create_semaphore(VkDevice device,
+                    const VkSemaphoreCreateInfo* create_info,
+                    const VkAllocationCallbacks* allocator,
+                    VkSemaphore* semaphore) {
+  *semaphore = new_handle<VkSemaphore>();
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL
+vk_destroy_semaphore(VkDevice device,
+                     VkSemaphore semaphore,
+                     const VkAllocationCallbacks* allocator) {}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_create_image(VkDevice device,
+                const VkImageCreateInfo* create_info,
+                const VkAllocationCallbacks* allocator,
+                VkImage* image) {
+  *image = new_handle<VkImage>();
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL
+vk_destroy_image(VkDevice device,
+                 VkImage image,
+                 const VkAllocationCallbacks* allocator) {}
+
+static VKAPI_ATTR void VKAPI_CALL
+vk_get_image_memory_requirements(VkDevice device,
+                                 VkImage image,
+                                 VkMemoryRequirements* requirements) {
+  requirements->size = 4096;
+  requirements->alignment = 256;
+  requirements->memoryTypeBits = 1;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+vk_allocate_memory(VkDevice device,
+                   const VkMemoryAllocateInfo* allocate_info,
+                   const VkAllocationCallbacks* allocator,
+                   VkDeviceMemory* memory) {
+  *memory = new_handle<VkDeviceMemory>();
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL
+vk_free_memory(VkDevice device,
+               VkDeviceMemory memory,
+               const VkAllocationCallbacks* allocator) {}
+
+static VKAPI_ATTR VkResult VKAPI_CALL vk_bind_image_memory(VkDevice device,
+                                                           VkImage image,
+                                                           VkDeviceMemory memory,
+                                                           VkDeviceSize offset) {
+  return VK_SUCCESS;
+}
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL
+vk_get_device_proc_addr(VkDevice device, const char* name);
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL
+vk_get_instance_proc_addr(VkInstance instance, const char* name) {
+  struct {
+    const char* name;
+    PFN_vkVoidFunction function;
+  } functions[] = {
+#define MOCK_VULKAN_FUNCTION(name, function) \
+  {name, reinterpret_cast<PFN_vkVoidFunction>(function)}
+      MOCK_VULKAN_FUNCTION("vkGetInstanceProcAddr", vk_get_instance_proc_addr),
+      MOCK_VULKAN_FUNCTION("vkGetDeviceProcAddr", vk_get_device_proc_addr),
+      MOCK_VULKAN_FUNCTION("vkEnumerateInstanceExtensionProperties",
+                           vk_enumerate_instance_extension_properties),
+      MOCK_VULKAN_FUNCTION("vkCreateInstance", vk_create_instance),
+      MOCK_VULKAN_FUNCTION("vkDestroyInstance", vk_destroy_instance),
+      MOCK_VULKAN_FUNCTION("vkEnumeratePhysicalDevices",
+                           vk_enumerate_physical_devices),
+      MOCK_VULKAN_FUNCTION("vkGetPhysicalDeviceProperties",
+                           vk_get_physical_device_properties),
+      MOCK_VULKAN_FUNCTION("vkGetPhysicalDeviceQueueFamilyProperties",
+                           vk_get_physical_device_queue_family_properties),
+      MOCK_VULKAN_FUNCTION("vkEnumerateDeviceExtensionProperties",
+                           vk_enumerate_device_extension_properties),
+      MOCK_VULKAN_FUNCTION("vkGetPhysicalDeviceMemoryProperties",
+                           vk_get_physical_device_memory_properties),
+      MOCK_VULKAN_FUNCTION("vkCreateDevice", vk_create_device),
+      MOCK_VULKAN_FUNCTION("vkDestroyDevice", vk_destroy_device),
+      MOCK_VULKAN_FUNCTION("vkGetDeviceQueue", vk_get_device_queue),
+      MOCK_VULKAN_FUNCTION("vkQueueSubmit", vk_queue_submit),
+      MOCK_VULKAN_FUNCTION("vkQueueWaitIdle", vk_queue_wait_idle),
+      MOCK_VULKAN_FUNCTION("vkQueuePresentKHR", vk_queue_present),
+      MOCK_VULKAN_FUNCTION("vkDeviceWaitIdle", vk_device_wait_idle),
+      MOCK_VULKAN_FUNCTION("vkDestroySurfaceKHR", vk_destroy_surface),
+      MOCK_VULKAN_FUNCTION("vkGetPhysicalDeviceSurfaceSupportKHR",
+                           vk_get_physical_device_surface_support),
+      MOCK_VULKAN_FUNCTION("vkGetPhysicalDeviceSurfaceCapabilitiesKHR",
+                           vk_get_physical_device_surface_capabilities),
+      MOCK_VULKAN_FUNCTION("vkGetPhysicalDeviceSurfaceFormatsKHR",
+                           vk_get_physical_device_surface_formats),
+      MOCK_VULKAN_FUNCTION("vkCreateSwapchainKHR", vk_create_swapchain),
+      MOCK_VULKAN_FUNCTION("vkDestroySwapchainKHR", vk_destroy_swapchain),
+      MOCK_VULKAN_FUNCTION("vkGetSwapchainImagesKHR", vk_get_swapchain_images),
+      MOCK_VULKAN_FUNCTION("vkAcquireNextImageKHR", vk_acquire_next_image),
+      MOCK_VULKAN_FUNCTION("vkCreateCommandPool", vk_create_command_pool),
+      MOCK_VULKAN_FUNCTION("vkDestroyCommandPool", vk_destroy_command_pool),
+      MOCK_VULKAN_FUNCTION("vkAllocateCommandBuffers",
+                           vk_allocate_command_buffers),
+      MOCK_VULKAN_FUNCTION("vkBeginCommandBuffer", vk_begin_command_buffer),
+      MOCK_VULKAN_FUNCTION("vkEndCommandBuffer", vk_end_command_buffer),
+      MOCK_VULKAN_FUNCTION("vkCmdPipelineBarrier", vk_cmd_pipeline_barrier),
+      MOCK_VULKAN_FUNCTION("vkCmdClearColorImage", vk_cmd_clear_color_image),
+      MOCK_VULKAN_FUNCTION("vkCmdBlitImage", vk_cmd_blit_image),
+      MOCK_VULKAN_FUNCTION("vkCreateFence", vk_create_fence),
+      MOCK_VULKAN_FUNCTION("vkDestroyFence", vk_destroy_fence),
+      MOCK_VULKAN_FUNCTION("vkWaitForFences", vk_wait_for_fences),
+      MOCK_VULKAN_FUNCTION("vkResetFences", vk_reset_fences),
+      MOCK_VULKAN_FUNCTION("vkCreateSemaphore", vk_create_semaphore),
+      MOCK_VULKAN_FUNCTION("vkDestroySemaphore", vk_destroy_semaphore),
+      MOCK_VULKAN_FUNCTION("vkCreateImage", vk_create_image),
+      MOCK_VULKAN_FUNCTION("vkDestroyImage", vk_destroy_image),
+      MOCK_VULKAN_FUNCTION("vkGetImageMemoryRequirements",
+                           vk_get_image_memory_requirements),
+      MOCK_VULKAN_FUNCTION("vkAllocateMemory", vk_allocate_memory),
+      MOCK_VULKAN_FUNCTION("vkFreeMemory", vk_free_memory),
+      MOCK_VULKAN_FUNCTION("vkBindImageMemory", vk_bind_image_memory),
+#undef MOCK_VULKAN_FUNCTION
+  };
+  for (const auto& function : functions) {
+    if (strcmp(function.name, name) == 0) {
+      return function.function;
+    }
+  }
+  return nullptr;
+}
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL
+vk_get_device_proc_addr(VkDevice device, const char* name) {
+  return vk_get_instance_proc_addr(nullptr, name);
+}
+
+MockVulkan::MockVulkan() {
+  mock = this;
+  fl_vulkan_manager_set_get_instance_proc_addr(vk_get_instance_proc_addr);
+
+  ON_CALL(*this, vkCreateInstance)
+      .WillByDefault([](const VkInstanceCreateInfo* create_info,
+                        const VkAllocationCallbacks* allocator,
+                        VkInstance* instance) {
+        *instance = new_handle<VkInstance>();
+        return VK_SUCCESS;
+      });
+  ON_CALL(*this, vkCreateDevice)
+      .WillByDefault([](VkPhysicalDevice physical_device,
+                        const VkDeviceCreateInfo* create_info,
+                        const VkAllocationCallbacks* allocator,
+                        VkDevice* device) {
+        *device = new_handle<VkDevice>();
+        return VK_SUCCESS;
+      });
+  // Like Wayland, the swapchain is sized to the frames.
+  ON_CALL(*this, vkGetPhysicalDeviceSurfaceCapabilitiesKHR)
+      .WillByDefault([](VkPhysicalDevice physical_device, VkSurfaceKHR surface,
+                        VkSurfaceCapabilitiesKHR* capabilities) {
+        *capabilities = {};
+        capabilities->minImageCount = 2;
+        capabilities->currentExtent = {UINT32_MAX, UINT32_MAX};
+        capabilities->minImageExtent = {1, 1};
+        capabilities->maxImageExtent = {16384, 16384};
+        capabilities->maxImageArrayLayers = 1;
+        capabilities->supportedTransforms =
+            VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+        capabilities->currentTransform = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+        capabilities->supportedCompositeAlpha =
+            VK_COMPOSITE_ALPHA_PRE_MULTIPLIED_BIT_KHR;
+        capabilities->supportedUsageFlags = VK_IMAGE_USAGE_TRANSFER_DST_BIT |
+                                            VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+        return VK_SUCCESS;
+      });
+  ON_CALL(*this, vkCreateSwapchainKHR)
+      .WillByDefault([](VkDevice device,
+                        const VkSwapchainCreateInfoKHR* create_info,
+                        const VkAllocationCallbacks* allocator,
+                        VkSwapchainKHR* swapchain) {
+        *swapchain = new_handle<VkSwapchainKHR>();
+        return VK_SUCCESS;
+      });
+  ON_CALL(*this, vkAcquireNextImageKHR)
+      .WillByDefault([](VkDevice device, VkSwapchainKHR swapchain,
+                        uint64_t timeout, VkSemaphore semaphore, VkFence fence,
+                        uint32_t* image_index) {
+        *image_index = 0;
+        return VK_SUCCESS;
+      });
+}
+
+MockVulkan::~MockVulkan() {
+  if (mock == this) {
+    mock = nullptr;
+    fl_vulkan_manager_set_get_instance_proc_addr(nullptr);
+  }
+}
+
+VkSurfaceKHR MockVulkan::mock_surface() const {
+  return make_handle<VkSurfaceKHR>(0x3000);
+}
@@ -0,0 +1,70 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_LINUX_TESTING_MOCK_VULKAN_H_
+#define FLUTTER_SHELL_PLATFORM_LINUX_TESTING_MOCK_VULKAN_H_
+
+#include "gmock/gmock.h"
+
+#include "flutter/shell/platform/linux/fl_vulkan_manager.h"
+
+namespace flutter {
+namespace testing {
+
+// Mock for the Vulkan library loaded by #FlVulkanManager.
+//
+// While it exists, managers look up Vulkan functions from a single device that
+// can render and present to Wayland and X11. By default all functions succeed.
+class MockVulkan {
+ public:
+  MockVulkan();
+  ~MockVulkan();
+
+  // Returns a surface to present to.
+  VkSurfaceKHR mock_surface() const;
+
+  MOCK_METHOD(VkResult,
+              vkCreateInstance,
+              (const VkInstanceCreateInfo* create_info,
+               const VkAllocationCallbacks* allocator,
+               VkInstance* instance));
+  MOCK_METHOD(VkResult,
+              vkCreateDevice,
+              (VkPhysicalDevice physical_device,
+               const VkDeviceCreateInfo* create_info,
+               const VkAllocationCallbacks* allocator,
+               VkDevice* device));
+  MOCK_METHOD(VkResult,
+              vkGetPhysicalDeviceSurfaceCapabilitiesKHR,
+              (VkPhysicalDevice physical_device,
+               VkSurfaceKHR surface,
+               VkSurfaceCapabilitiesKHR* capabilities));
+  MOCK_METHOD(VkResult,
+              vkCreateSwapchainKHR,
+              (VkDevice device,
+               const VkSwapchainCreateInfoKHR* create_info,
+               const VkAllocationCallbacks* allocator,
+               VkSwapchainKHR* swapchain));
+  MOCK_METHOD(void,
+              vkDestroySwapchainKHR,
+              (VkDevice device,
+               VkSwapchainKHR swapchain,
+               const VkAllocationCallbacks* allocator));
+  MOCK_METHOD(VkResult,
+              vkAcquireNextImageKHR,
+              (VkDevice device,
+               VkSwapchainKHR swapchain,
+               uint64_t timeout,
+               VkSemaphore semaphore,
+               VkFence fence,
+               uint32_t* image_index));
+  MOCK_METHOD(VkResult,
+              vkQueuePresentKHR,
+              (VkQueue queue, const VkPresentInfoKHR* present_info));
+};
+
+}  // namespace testing
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_LINUX_TESTING_MOCK_VULKAN_H_
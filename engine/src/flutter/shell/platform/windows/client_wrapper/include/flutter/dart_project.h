@@ -35,6 +35,16 @@ enum class UIThreadPolicy {
   RunOnSeparateThread,
 };
 
+// Configures how views present frames to the screen.
+enum class PresentMode {
+  // Default value. Present through a swapchain on the view's window.
+  Default,
+  // Present through a DirectComposition visual backed by a flip model
+  // swapchain, which reduces latency and improves frame pacing. Falls back to
+  // the default if not supported.
+  DirectComposition,
+};
+
 // A set of Flutter and Dart assets used to initialize a Flutter engine.
 class DartProject {
  public:
@@ -114,6 +124,15 @@ class DartProject {
   // Defaults to UIThreadPolicy::Default.
   UIThreadPolicy ui_thread_policy() const { return ui_thread_policy_; }
 
+  // Sets how views present frames to the screen.
+  void set_present_mode(PresentMode present_mode) {
+    present_mode_ = present_mode;
+  }
+
+  // Returns how views present frames to the screen.
+  // Defaults to PresentMode::Default.
+  PresentMode present_mode() const { return present_mode_; }
+
  private:
   // Accessors for internals are private, so that they can be changed if more
   // flexible options for project structures are needed later without it
@@ -142,6 +161,8 @@ class DartProject {
   GpuPreference gpu_preference_ = GpuPreference::NoPreference;
   // Thread policy for UI isolate.
   UIThreadPolicy ui_thread_policy_ = UIThreadPolicy::Default;
+  // How views present frames to the screen.
+  PresentMode present_mode_ = PresentMode::Default;
 };
 
 }  // namespace flutter
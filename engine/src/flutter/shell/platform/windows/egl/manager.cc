@@ -4,32 +4,50 @@
 
 #include "flutter/shell/platform/windows/egl/manager.h"
 
+#include <sstream>
 #include <vector>
 
 #include "flutter/fml/logging.h"
 #include "flutter/shell/platform/windows/egl/egl.h"
 
+// From EGL_ANGLE_direct_composition, which ANGLE may not declare.
+#ifndef EGL_DIRECT_COMPOSITION_ANGLE
+#define EGL_DIRECT_COMPOSITION_ANGLE 0x33A5
+#endif
+
 namespace flutter {
 namespace egl {
 
 int Manager::instance_count_ = 0;
 
-std::unique_ptr<Manager> Manager::Create(GpuPreference gpu_preference) {
+std::unique_ptr<Manager> Manager::Create(GpuPreference gpu_preference,
+                                         PresentMode present_mode) {
   std::unique_ptr<Manager> manager;
-  manager.reset(new Manager(gpu_preference));
+  manager.reset(new Manager(gpu_preference, present_mode));
   if (!manager->IsValid()) {
     return nullptr;
   }
   return std::move(manager);
 }
 
-Manager::Manager(GpuPreference gpu_preference) {
+Manager::Manager(GpuPreference gpu_preference, PresentMode present_mode) {
   ++instance_count_;
 
   if (!InitializeDisplay(gpu_preference)) {
     return;
   }
 
+  // ANGLE then creates window surfaces as a flip model swapchain in a
+  // DirectComposition visual instead of a blit model swapchain on the HWND.
+  if (present_mode == PresentMode::DirectComposition) {
+    use_direct_composition_ =
+        HasDisplayExtension("EGL_ANGLE_direct_composition");
+    if (!use_direct_composition_) {
+      FML_LOG(WARNING) << "DirectComposition is not supported, presenting "
+                          "to the window instead.";
+    }
+  }
+
   if (!InitializeConfig()) {
     return;
   }
@@ -184,6 +202,22 @@ bool Manager::InitializeDisplay(GpuPreference gpu_preference) {
   FML_UNREACHABLE();
 }
 
+bool Manager::HasDisplayExtension(std::string_view name) const {
+  const char* extensions = ::eglQueryString(display_, EGL_EXTENSIONS);
+  if (extensions == nullptr) {
+    return false;
+  }
+
+  std::istringstream stream(extensions);
+  std::string extension;
+  while (stream >> extension) {
+    if (extension == name) {
+      return true;
+    }
+  }
+  return false;
+}
+
 bool Manager::InitializeConfig() {
   const EGLint config_attributes[] = {EGL_RED_SIZE,   8, EGL_GREEN_SIZE,   8,
                                       EGL_BLUE_SIZE,  8, EGL_ALPHA_SIZE,   8,
@@ -290,17 +324,21 @@ std::unique_ptr<WindowSurface> Manager::CreateWindowSurface(HWND hwnd,
   // Disable ANGLE's automatic surface resizing and provide an explicit size.
   // The surface will need to be destroyed and re-created if the HWND is
   // resized.
-  const EGLint surface_attributes[] = {EGL_FIXED_SIZE_ANGLE,
-                                       EGL_TRUE,
-                                       EGL_WIDTH,
-                                       static_cast<EGLint>(width),
-                                       EGL_HEIGHT,
-                                       static_cast<EGLint>(height),
-                                       EGL_NONE};
+  std::vector<EGLint> surface_attributes = {EGL_FIXED_SIZE_ANGLE,
+                                            EGL_TRUE,
+                                            EGL_WIDTH,
+                                            static_cast<EGLint>(width),
+                                            EGL_HEIGHT,
+                                            static_cast<EGLint>(height)};
+  if (use_direct_composition_) {
+    surface_attributes.push_back(EGL_DIRECT_COMPOSITION_ANGLE);
+    surface_attributes.push_back(EGL_TRUE);
+  }
+  surface_attributes.push_back(EGL_NONE);
 
   auto const surface = ::eglCreateWindowSurface(
       display_, config_, static_cast<EGLNativeWindowType>(hwnd),
-      surface_attributes);
+      surface_attributes.data());
   if (surface == EGL_NO_SURFACE) {
     LogEGLError("Surface creation failed.");
     return nullptr;
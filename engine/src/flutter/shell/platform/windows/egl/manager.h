@@ -20,6 +20,7 @@
 #include <wrl/client.h>
 #include <memory>
 #include <optional>
+#include <string_view>
 
 #include "flutter/fml/macros.h"
 #include "flutter/shell/platform/windows/egl/context.h"
@@ -35,11 +36,18 @@ enum class GpuPreference {
   HighPerformancePreference,
 };
 
+enum class PresentMode {
+  Default,
+  DirectComposition,
+};
+
 // A manager for initializing ANGLE correctly and using it to create and
 // destroy surfaces
 class Manager {
  public:
-  static std::unique_ptr<Manager> Create(GpuPreference gpu_preference);
+  static std::unique_ptr<Manager> Create(
+      GpuPreference gpu_preference,
+      PresentMode present_mode = PresentMode::Default);
 
   virtual ~Manager();
 
@@ -87,7 +95,8 @@ class Manager {
  protected:
   // Creates a new surface manager retaining reference to the passed-in target
   // for the lifetime of the manager.
-  explicit Manager(GpuPreference gpu_preference);
+  explicit Manager(GpuPreference gpu_preference,
+                   PresentMode present_mode = PresentMode::Default);
 
  private:
   // Number of active instances of Manager
@@ -100,6 +109,9 @@ class Manager {
   // Initialize the EGL display.
   bool InitializeDisplay(GpuPreference gpu_preference);
 
+  // Whether the EGL display supports an extension.
+  bool HasDisplayExtension(std::string_view name) const;
+
   // Initialize the EGL configs.
   bool InitializeConfig();
 
@@ -120,6 +132,9 @@ class Manager {
   // EGL framebuffer configuration.
   EGLConfig config_ = nullptr;
 
+  // Whether window surfaces present through DirectComposition.
+  bool use_direct_composition_ = false;
+
   // The EGL context used to render Flutter views.
   std::unique_ptr<Context> render_context_;
 
@@ -4,16 +4,37 @@
 
 #include "flutter/shell/platform/windows/external_texture_d3d.h"
 
+#include <d3d11_4.h>
+
 #include "flutter/fml/logging.h"
 #include "flutter/shell/platform/embedder/embedder_struct_macros.h"
 
+using Microsoft::WRL::ComPtr;
+
 namespace flutter {
 
+namespace {
+
+// How long to wait for the producer to release a keyed mutex. If it takes
+// longer than about a frame, the previous contents are shown instead.
+constexpr DWORD kKeyedMutexTimeoutMs = 16;
+
+// Whether the surface must be copied into a texture owned by Flutter.
+bool NeedsCopy(const FlutterDesktopGpuSurfaceDescriptor* descriptor) {
+  return SAFE_ACCESS(descriptor, sync_type,
+                     kFlutterDesktopGpuSurfaceSyncNone) !=
+             kFlutterDesktopGpuSurfaceSyncNone ||
+         SAFE_ACCESS(descriptor, format, kFlutterDesktopPixelFormatNone) ==
+             kFlutterDesktopPixelFormatNV12;
+}
+
+}  // namespace
+
 ExternalTextureD3d::ExternalTextureD3d(
     FlutterDesktopGpuSurfaceType type,
     const FlutterDesktopGpuSurfaceTextureCallback texture_callback,
     void* user_data,
-    const egl::Manager* egl_manager,
+    egl::Manager* egl_manager,
     std::shared_ptr<egl::ProcTable> gl)
     : type_(type),
       texture_callback_(texture_callback),
@@ -80,26 +101,52 @@ bool ExternalTextureD3d::CreateOrUpdateTexture(
     gl_->BindTexture(GL_TEXTURE_2D, gl_texture_);
   }
 
-  auto handle = SAFE_ACCESS(descriptor, handle, nullptr);
+  bool result = true;
+  if (NeedsCopy(descriptor)) {
+    // The copy is bound rather than the surface, so the producer only needs
+    // to keep the surface until it is released.
+    result = CopySurface(descriptor);
+    if (result) {
+      D3D11_TEXTURE2D_DESC copy_description;
+      copy_texture_->GetDesc(&copy_description);
+      result = BindImage(copy_texture_.Get(), EGL_D3D_TEXTURE_ANGLE,
+                         copy_description.Width, copy_description.Height);
+    }
+  } else {
+    result = BindImage(SAFE_ACCESS(descriptor, handle, nullptr),
+                       (type_ == kFlutterDesktopGpuSurfaceTypeD3d11Texture2D)
+                           ? EGL_D3D_TEXTURE_ANGLE
+                           : EGL_D3D_TEXTURE_2D_SHARE_HANDLE_ANGLE,
+                       SAFE_ACCESS(descriptor, width, 0),
+                       SAFE_ACCESS(descriptor, height, 0));
+  }
+
+  auto release_callback = SAFE_ACCESS(descriptor, release_callback, nullptr);
+  if (release_callback) {
+    release_callback(SAFE_ACCESS(descriptor, release_context, nullptr));
+  }
+  return result;
+}
+
+bool ExternalTextureD3d::BindImage(void* handle,
+                                   EGLenum handle_type,
+                                   UINT width,
+                                   UINT height) {
   if (handle != last_surface_handle_) {
     ReleaseImage();
 
-    EGLint attributes[] = {
-        EGL_WIDTH,
-        static_cast<EGLint>(SAFE_ACCESS(descriptor, width, 0)),
-        EGL_HEIGHT,
-        static_cast<EGLint>(SAFE_ACCESS(descriptor, height, 0)),
-        EGL_TEXTURE_TARGET,
-        EGL_TEXTURE_2D,
-        EGL_TEXTURE_FORMAT,
-        EGL_TEXTURE_RGBA,  // always EGL_TEXTURE_RGBA
-        EGL_NONE};
-
-    egl_surface_ = egl_manager_->CreateSurfaceFromHandle(
-        (type_ == kFlutterDesktopGpuSurfaceTypeD3d11Texture2D)
-            ? EGL_D3D_TEXTURE_ANGLE
-            : EGL_D3D_TEXTURE_2D_SHARE_HANDLE_ANGLE,
-        handle, attributes);
+    EGLint attributes[] = {EGL_WIDTH,
+                           static_cast<EGLint>(width),
+                           EGL_HEIGHT,
+                           static_cast<EGLint>(height),
+                           EGL_TEXTURE_TARGET,
+                           EGL_TEXTURE_2D,
+                           EGL_TEXTURE_FORMAT,
+                           EGL_TEXTURE_RGBA,  // always EGL_TEXTURE_RGBA
+                           EGL_NONE};
+
+    egl_surface_ =
+        egl_manager_->CreateSurfaceFromHandle(handle_type, handle, attributes);
 
     if (egl_surface_ == EGL_NO_SURFACE ||
         eglBindTexImage(egl_manager_->egl_display(), egl_surface_,
@@ -109,11 +156,216 @@ bool ExternalTextureD3d::CreateOrUpdateTexture(
     last_surface_handle_ = handle;
   }
 
-  auto release_callback = SAFE_ACCESS(descriptor, release_callback, nullptr);
-  if (release_callback) {
-    release_callback(SAFE_ACCESS(descriptor, release_context, nullptr));
-  }
   return egl_surface_ != EGL_NO_SURFACE;
 }
 
+bool ExternalTextureD3d::CopySurface(
+    const FlutterDesktopGpuSurfaceDescriptor* descriptor) {
+  if (!d3d_device_ && !egl_manager_->GetDevice(d3d_device_.GetAddressOf())) {
+    FML_LOG(ERROR) << "Failed to get the D3D11 device to copy surfaces with.";
+    return false;
+  }
+
+  void* handle = SAFE_ACCESS(descriptor, handle, nullptr);
+  if (handle != last_copy_handle_) {
+    copy_source_ = OpenSurface(handle);
+    last_copy_handle_ = handle;
+  }
+  if (!copy_source_) {
+    return false;
+  }
+
+  bool convert = SAFE_ACCESS(descriptor, format,
+                             kFlutterDesktopPixelFormatNone) ==
+                 kFlutterDesktopPixelFormatNV12;
+  D3D11_TEXTURE2D_DESC source_description;
+  copy_source_->GetDesc(&source_description);
+  DXGI_FORMAT format =
+      convert ? DXGI_FORMAT_B8G8R8A8_UNORM : source_description.Format;
+
+  D3D11_TEXTURE2D_DESC copy_description = {};
+  if (copy_texture_) {
+    copy_texture_->GetDesc(&copy_description);
+  }
+  if (!copy_texture_ || copy_description.Width != source_description.Width ||
+      copy_description.Height != source_description.Height ||
+      copy_description.Format != format) {
+    copy_description = {};
+    copy_description.Width = source_description.Width;
+    copy_description.Height = source_description.Height;
+    copy_description.MipLevels = 1;
+    copy_description.ArraySize = 1;
+    copy_description.Format = format;
+    copy_description.SampleDesc.Count = 1;
+    copy_description.Usage = D3D11_USAGE_DEFAULT;
+    copy_description.BindFlags =
+        D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
+    ComPtr<ID3D11Texture2D> texture;
+    if (FAILED(d3d_device_->CreateTexture2D(&copy_description, nullptr,
+                                            texture.GetAddressOf()))) {
+      FML_LOG(ERROR) << "Failed to create texture to copy surface into.";
+      return false;
+    }
+    copy_texture_ = texture;
+    has_copied_frame_ = false;
+    video_processor_.Reset();
+    video_enumerator_.Reset();
+  }
+
+  ComPtr<ID3D11DeviceContext> context;
+  d3d_device_->GetImmediateContext(context.GetAddressOf());
+
+  auto sync_type =
+      SAFE_ACCESS(descriptor, sync_type, kFlutterDesktopGpuSurfaceSyncNone);
+  auto acquire_value = SAFE_ACCESS(descriptor, sync_acquire_value, 0);
+  auto release_value = SAFE_ACCESS(descriptor, sync_release_value, 0);
+  ComPtr<IDXGIKeyedMutex> keyed_mutex;
+  ComPtr<ID3D11DeviceContext4> context4;
+  ID3D11Fence* fence = nullptr;
+  switch (sync_type) {
+    case kFlutterDesktopGpuSurfaceSyncKeyedMutex: {
+      if (FAILED(copy_source_.As(&keyed_mutex))) {
+        FML_LOG(ERROR) << "Surface doesn't have a keyed mutex.";
+        return false;
+      }
+      HRESULT result =
+          keyed_mutex->AcquireSync(acquire_value, kKeyedMutexTimeoutMs);
+      if (result == static_cast<HRESULT>(WAIT_TIMEOUT)) {
+        return has_copied_frame_;
+      } else if (result != S_OK) {
+        FML_LOG(ERROR) << "Failed to acquire surface keyed mutex.";
+        return false;
+      }
+      break;
+    }
+    case kFlutterDesktopGpuSurfaceSyncFence:
+      fence = static_cast<ID3D11Fence*>(
+          SAFE_ACCESS(descriptor, sync_fence, nullptr));
+      if (fence == nullptr || FAILED(context.As(&context4))) {
+        FML_LOG(ERROR) << "Synchronizing with a fence requires D3D11.4.";
+        return false;
+      }
+      // Waits on the GPU, the raster thread isn't blocked.
+      context4->Wait(fence, acquire_value);
+      break;
+    case kFlutterDesktopGpuSurfaceSyncNone:
+    default:
+      break;
+  }
+
+  bool result = true;
+  if (convert) {
+    result = ConvertNV12(copy_source_.Get(), source_description.Width,
+                         source_description.Height);
+  } else {
+    context->CopySubresourceRegion(copy_texture_.Get(), 0, 0, 0, 0,
+                                   copy_source_.Get(), 0, nullptr);
+  }
+
+  // ANGLE samples the copy with the same context, after the copy.
+  if (keyed_mutex) {
+    keyed_mutex->ReleaseSync(release_value);
+  }
+  if (fence != nullptr) {
+    context4->Signal(fence, release_value);
+  }
+  // Submit now so the producer isn't waiting for ANGLE to flush.
+  context->Flush();
+
+  has_copied_frame_ = has_copied_frame_ || result;
+  return result;
+}
+
+ComPtr<ID3D11Texture2D> ExternalTextureD3d::OpenSurface(void* handle) {
+  ComPtr<ID3D11Texture2D> texture;
+  if (handle == nullptr) {
+    return nullptr;
+  }
+
+  if (type_ == kFlutterDesktopGpuSurfaceTypeD3d11Texture2D) {
+    texture = static_cast<ID3D11Texture2D*>(handle);
+    ComPtr<ID3D11Device> device;
+    texture->GetDevice(device.GetAddressOf());
+    if (device.Get() != d3d_device_.Get()) {
+      FML_LOG(ERROR) << "Texture is from a different D3D11 device, use "
+                        "kFlutterDesktopGpuSurfaceTypeDxgiSharedHandle.";
+      return nullptr;
+    }
+    return texture;
+  }
+
+  // NT handles, such as those of D3D12 resources, need ID3D11Device1.
+  ComPtr<ID3D11Device1> device1;
+  if (SUCCEEDED(d3d_device_.As(&device1)) &&
+      SUCCEEDED(device1->OpenSharedResource1(
+          handle, IID_PPV_ARGS(texture.GetAddressOf())))) {
+    return texture;
+  }
+  if (FAILED(d3d_device_->OpenSharedResource(
+          handle, IID_PPV_ARGS(texture.GetAddressOf())))) {
+    FML_LOG(ERROR) << "Failed to open shared surface.";
+    return nullptr;
+  }
+  return texture;
+}
+
+bool ExternalTextureD3d::ConvertNV12(ID3D11Texture2D* source,
+                                     UINT width,
+                                     UINT height) {
+  ComPtr<ID3D11DeviceContext> context;
+  d3d_device_->GetImmediateContext(context.GetAddressOf());
+  ComPtr<ID3D11VideoDevice> video_device;
+  ComPtr<ID3D11VideoContext> video_context;
+  if (FAILED(d3d_device_.As(&video_device)) ||
+      FAILED(context.As(&video_context))) {
+    FML_LOG(ERROR) << "D3D11 video processing is not supported.";
+    return false;
+  }
+
+  if (!video_processor_) {
+    D3D11_VIDEO_PROCESSOR_CONTENT_DESC content_description = {};
+    content_description.InputFrameFormat =
+        D3D11_VIDEO_FRAME_FORMAT_PROGRESSIVE;
+    content_description.InputWidth = width;
+    content_description.InputHeight = height;
+    content_description.OutputWidth = width;
+    content_description.OutputHeight = height;
+    content_description.Usage = D3D11_VIDEO_USAGE_PLAYBACK_NORMAL;
+    if (FAILED(video_device->CreateVideoProcessorEnumerator(
+            &content_description, video_enumerator_.GetAddressOf())) ||
+        FAILED(video_device->CreateVideoProcessor(
+            video_enumerator_.Get(), 0, video_processor_.GetAddressOf()))) {
+      FML_LOG(ERROR) << "Failed to create NV12 video processor.";
+      video_enumerator_.Reset();
+      return false;
+    }
+  }
+
+  D3D11_VIDEO_PROCESSOR_INPUT_VIEW_DESC input_description = {};
+  input_description.ViewDimension = D3D11_VPIV_DIMENSION_TEXTURE2D;
+  ComPtr<ID3D11VideoProcessorInputView> input_view;
+  D3D11_VIDEO_PROCESSOR_OUTPUT_VIEW_DESC output_description = {};
+  output_description.ViewDimension = D3D11_VPOV_DIMENSION_TEXTURE2D;
+  ComPtr<ID3D11VideoProcessorOutputView> output_view;
+  if (FAILED(video_device->CreateVideoProcessorInputView(
+          source, video_enumerator_.Get(), &input_description,
+          input_view.GetAddressOf())) ||
+      FAILED(video_device->CreateVideoProcessorOutputView(
+          copy_texture_.Get(), video_enumerator_.Get(), &output_description,
+          output_view.GetAddressOf()))) {
+    FML_LOG(ERROR) << "Failed to create NV12 video processor views.";
+    return false;
+  }
+
+  D3D11_VIDEO_PROCESSOR_STREAM stream = {};
+  stream.Enable = TRUE;
+  stream.pInputSurface = input_view.Get();
+  if (FAILED(video_context->VideoProcessorBlt(
+          video_processor_.Get(), output_view.Get(), 0, 1, &stream))) {
+    FML_LOG(ERROR) << "Failed to convert NV12 surface.";
+    return false;
+  }
+  return true;
+}
+
 }  // namespace flutter
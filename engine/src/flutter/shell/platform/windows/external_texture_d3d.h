@@ -22,7 +22,7 @@ class ExternalTextureD3d : public ExternalTexture {
       FlutterDesktopGpuSurfaceType type,
       const FlutterDesktopGpuSurfaceTextureCallback texture_callback,
       void* user_data,
-      const egl::Manager* egl_manager,
+      egl::Manager* egl_manager,
       std::shared_ptr<egl::ProcTable> gl);
   virtual ~ExternalTextureD3d();
 
@@ -39,15 +39,45 @@ class ExternalTextureD3d : public ExternalTexture {
   // Detaches the previously attached surface, if any.
   void ReleaseImage();
 
+  // Attaches |handle| to the backing texture.
+  bool BindImage(void* handle, EGLenum handle_type, UINT width, UINT height);
+
+  // Copies a surface that is synchronized with its producer or needs
+  // converting into |copy_texture_|, without leaving the GPU.
+  bool CopySurface(const FlutterDesktopGpuSurfaceDescriptor* descriptor);
+
+  // Returns the D3D11 texture for the surface |handle|.
+  Microsoft::WRL::ComPtr<ID3D11Texture2D> OpenSurface(void* handle);
+
+  // Converts |source| from NV12 into |copy_texture_|.
+  bool ConvertNV12(ID3D11Texture2D* source, UINT width, UINT height);
+
   FlutterDesktopGpuSurfaceType type_;
   const FlutterDesktopGpuSurfaceTextureCallback texture_callback_;
   void* const user_data_;
-  const egl::Manager* egl_manager_;
+  egl::Manager* egl_manager_;
   std::shared_ptr<egl::ProcTable> gl_;
   GLuint gl_texture_ = 0;
   EGLSurface egl_surface_ = EGL_NO_SURFACE;
   void* last_surface_handle_ = nullptr;
 
+  // The device ANGLE renders with, used to copy surfaces.
+  Microsoft::WRL::ComPtr<ID3D11Device> d3d_device_;
+
+  // The last surface copied from and the texture it was opened as.
+  void* last_copy_handle_ = nullptr;
+  Microsoft::WRL::ComPtr<ID3D11Texture2D> copy_source_;
+
+  // Texture owned by Flutter that copied surfaces are sampled from.
+  Microsoft::WRL::ComPtr<ID3D11Texture2D> copy_texture_;
+
+  // Whether |copy_texture_| has contents to show.
+  bool has_copied_frame_ = false;
+
+  // Converts NV12 surfaces into |copy_texture_|.
+  Microsoft::WRL::ComPtr<ID3D11VideoProcessorEnumerator> video_enumerator_;
+  Microsoft::WRL::ComPtr<ID3D11VideoProcessor> video_processor_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(ExternalTextureD3d);
 };
 
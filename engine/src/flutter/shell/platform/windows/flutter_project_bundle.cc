@@ -36,6 +36,8 @@ FlutterProjectBundle::FlutterProjectBundle(
   ui_thread_policy_ =
       static_cast<FlutterUIThreadPolicy>(properties.ui_thread_policy);
 
+  present_mode_ = static_cast<FlutterPresentMode>(properties.present_mode);
+
   // Resolve any relative paths.
   if (assets_path_.is_relative() || icu_path_.is_relative() ||
       (!aot_library_path_.empty() && aot_library_path_.is_relative())) {
@@ -29,6 +29,11 @@ enum class FlutterUIThreadPolicy {
   RunOnSeparateThread,
 };
 
+enum class FlutterPresentMode {
+  Default,
+  DirectComposition,
+};
+
 // The data associated with a Flutter project needed to run it in an engine.
 class FlutterProjectBundle {
  public:
@@ -77,6 +82,9 @@ class FlutterProjectBundle {
   // Returns thread policy for running the UI isolate.
   FlutterUIThreadPolicy ui_thread_policy() { return ui_thread_policy_; }
 
+  // Returns how views present frames to the screen.
+  FlutterPresentMode present_mode() const { return present_mode_; }
+
  private:
   std::filesystem::path assets_path_;
   std::filesystem::path icu_path_;
@@ -98,6 +106,9 @@ class FlutterProjectBundle {
 
   // Thread policy for running the UI isolate.
   FlutterUIThreadPolicy ui_thread_policy_;
+
+  // How views present frames to the screen.
+  FlutterPresentMode present_mode_;
 };
 
 }  // namespace flutter
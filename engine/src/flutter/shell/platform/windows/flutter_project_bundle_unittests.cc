@@ -65,6 +65,19 @@ TEST(FlutterProjectBundle, DartEntrypointArguments) {
   EXPECT_EQ(retrieved_arguments[1], "arg2");
 }
 
+TEST(FlutterProjectBundle, PresentMode) {
+  FlutterDesktopEngineProperties properties = {};
+  properties.assets_path = L"foo\\flutter_assets";
+  properties.icu_data_path = L"foo\\icudtl.dat";
+
+  EXPECT_EQ(FlutterProjectBundle(properties).present_mode(),
+            FlutterPresentMode::Default);
+
+  properties.present_mode = DirectCompositionPresentMode;
+  EXPECT_EQ(FlutterProjectBundle(properties).present_mode(),
+            FlutterPresentMode::DirectComposition);
+}
+
 #ifndef FLUTTER_RELEASE
 TEST(FlutterProjectBundle, Switches) {
   FlutterDesktopEngineProperties properties = {};
@@ -6,6 +6,7 @@
 
 #include <dwmapi.h>
 
+#include <algorithm>
 #include <filesystem>
 #include <shared_mutex>
 #include <sstream>
@@ -50,6 +51,21 @@ static std::chrono::nanoseconds SnapToNextTick(
   return value + offset;
 }
 
+// Converts a QueryPerformanceCounter value to nanoseconds, as used by the
+// steady clock that the engine's time is from.
+static std::chrono::nanoseconds QpcToNanoseconds(uint64_t qpc) {
+  static const uint64_t frequency = []() {
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    return static_cast<uint64_t>(frequency.QuadPart);
+  }();
+  // Split to avoid overflow, as the steady clock does.
+  uint64_t seconds = qpc / frequency;
+  uint64_t remainder = qpc % frequency;
+  return std::chrono::nanoseconds(seconds * 1000000000 +
+                                  remainder * 1000000000 / frequency);
+}
+
 // Creates and returns a FlutterRendererConfig that renders to the view (if any)
 // of a FlutterWindowsEngine, using OpenGL (via ANGLE).
 // The user_data received by the render callbacks refers to the
@@ -198,7 +214,8 @@ FlutterWindowsEngine::FlutterWindowsEngine(
                                "--enable-impeller=true") != switches.end();
 
   egl_manager_ = egl::Manager::Create(
-      static_cast<egl::GpuPreference>(project_->gpu_preference()));
+      static_cast<egl::GpuPreference>(project_->gpu_preference()),
+      static_cast<egl::PresentMode>(project_->present_mode()));
   window_proc_delegate_manager_ = std::make_unique<WindowProcDelegateManager>();
 
   display_manager_ = std::make_shared<DisplayManagerWin32>(this);
@@ -661,7 +678,28 @@ void FlutterWindowsEngine::OnVsync(intptr_t baton) {
   std::chrono::nanoseconds current_time =
       std::chrono::nanoseconds(embedder_api_.GetCurrentTime());
   std::chrono::nanoseconds frame_interval = FrameInterval();
-  auto next = SnapToNextTick(current_time, start_time_, frame_interval);
+  std::chrono::nanoseconds phase = start_time_;
+
+  // Align frames with the compositor's vblanks when its clock runs at the
+  // rate frames are scheduled at. It doesn't if the views are on a display
+  // with a different refresh rate to the one the compositor follows.
+  if (!frame_interval_override_.has_value()) {
+    DWM_TIMING_INFO timing_info = {};
+    timing_info.cbSize = sizeof(timing_info);
+    if (windows_proc_table_->DwmGetCompositionTimingInfo(
+            nullptr, &timing_info) == S_OK &&
+        timing_info.qpcRefreshPeriod > 0) {
+      std::chrono::nanoseconds compositor_interval =
+          QpcToNanoseconds(timing_info.qpcRefreshPeriod);
+      if (std::chrono::abs(compositor_interval - frame_interval) <
+          frame_interval / 20) {
+        frame_interval = compositor_interval;
+        phase = QpcToNanoseconds(timing_info.qpcVBlank);
+      }
+    }
+  }
+
+  auto next = SnapToNextTick(current_time, phase, frame_interval);
   embedder_api_.OnVsync(engine_, baton, next.count(),
                         (next + frame_interval).count());
 }
@@ -672,9 +710,18 @@ std::chrono::nanoseconds FlutterWindowsEngine::FrameInterval() {
   }
   uint64_t interval = 16600000;
 
+  // Schedule for the fastest display with a view so animations are smooth on
+  // it. Views on slower displays drop frames instead.
+  double refresh_rate = ViewsRefreshRate();
+  if (refresh_rate > 1.0) {
+    return std::chrono::nanoseconds(
+        static_cast<uint64_t>(1000000000.0 / refresh_rate));
+  }
+
   DWM_TIMING_INFO timing_info = {};
   timing_info.cbSize = sizeof(timing_info);
-  HRESULT result = DwmGetCompositionTimingInfo(NULL, &timing_info);
+  HRESULT result =
+      windows_proc_table_->DwmGetCompositionTimingInfo(nullptr, &timing_info);
   if (result == S_OK && timing_info.rateRefresh.uiDenominator > 0 &&
       timing_info.rateRefresh.uiNumerator > 0) {
     interval = static_cast<double>(timing_info.rateRefresh.uiDenominator *
@@ -685,6 +732,28 @@ std::chrono::nanoseconds FlutterWindowsEngine::FrameInterval() {
   return std::chrono::nanoseconds(interval);
 }
 
+double FlutterWindowsEngine::ViewsRefreshRate() const {
+  double refresh_rate = 0.0;
+
+  std::shared_lock read_lock(views_mutex_);
+  std::lock_guard displays_lock(displays_mutex_);
+  for (const auto& [view_id, view] : views_) {
+    HWND hwnd = view->GetWindowHandle();
+    if (hwnd == nullptr) {
+      continue;
+    }
+
+    HMONITOR monitor = ::MonitorFromWindow(hwnd, MONITOR_DEFAULTTONEAREST);
+    auto iterator = display_refresh_rates_.find(
+        reinterpret_cast<FlutterEngineDisplayId>(monitor));
+    if (iterator != display_refresh_rates_.end()) {
+      refresh_rate = std::max(refresh_rate, iterator->second);
+    }
+  }
+
+  return refresh_rate;
+}
+
 FlutterWindowsView* FlutterWindowsEngine::view(FlutterViewId view_id) const {
   std::shared_lock read_lock(views_mutex_);
 
@@ -709,6 +778,14 @@ void FlutterWindowsEngine::AddPluginRegistrarDestructionCallback(
 
 void FlutterWindowsEngine::UpdateDisplay(
     const std::vector<FlutterEngineDisplay>& displays) {
+  {
+    std::lock_guard lock(displays_mutex_);
+    display_refresh_rates_.clear();
+    for (const auto& display : displays) {
+      display_refresh_rates_[display.display_id] = display.refresh_rate;
+    }
+  }
+
   if (engine_) {
     embedder_api_.NotifyDisplayUpdate(engine_,
                                       kFlutterEngineDisplaysUpdateTypeStartup,
@@ -8,6 +8,7 @@
 #include <chrono>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <shared_mutex>
 #include <string>
@@ -490,6 +491,16 @@ class FlutterWindowsEngine {
   // The approximate time between vblank events.
   std::chrono::nanoseconds FrameInterval();
 
+  // The refresh rate of the fastest display showing a view, or 0 if unknown.
+  double ViewsRefreshRate() const;
+
+  // Refresh rates of the displays from the last display update, by display
+  // ID. Protected by |displays_mutex_|.
+  std::unordered_map<FlutterEngineDisplayId, double> display_refresh_rates_;
+
+  // Guards |display_refresh_rates_|, which is read when scheduling frames.
+  mutable std::mutex displays_mutex_;
+
   // The start time used to align frames.
   std::chrono::nanoseconds start_time_ = std::chrono::nanoseconds::zero();
 
@@ -321,6 +321,44 @@ TEST_F(FlutterWindowsEngineTest, ConfiguresFrameVsync) {
   EXPECT_TRUE(on_vsync_called);
 }
 
+TEST_F(FlutterWindowsEngineTest, AlignsFramesWithCompositorClock) {
+  LARGE_INTEGER frequency;
+  QueryPerformanceFrequency(&frequency);
+
+  // A 100Hz compositor clock that had a vblank at 1s.
+  auto windows_proc_table = std::make_shared<MockWindowsProcTable>();
+  EXPECT_CALL(*windows_proc_table, DwmGetCompositionTimingInfo)
+      .WillRepeatedly([&frequency](HWND hwnd, DWM_TIMING_INFO* timing_info) {
+        timing_info->rateRefresh = {100, 1};
+        timing_info->qpcVBlank = frequency.QuadPart;
+        timing_info->qpcRefreshPeriod = frequency.QuadPart / 100;
+        return S_OK;
+      });
+
+  FlutterWindowsEngineBuilder builder{GetContext()};
+  builder.SetWindowsProcTable(windows_proc_table);
+  std::unique_ptr<FlutterWindowsEngine> engine = builder.Build();
+  EngineModifier modifier(engine.get());
+  bool on_vsync_called = false;
+
+  modifier.embedder_api().GetCurrentTime = MOCK_ENGINE_PROC(
+      GetCurrentTime, ([]() -> uint64_t { return 1005000000; }));
+  modifier.embedder_api().OnVsync = MOCK_ENGINE_PROC(
+      OnVsync,
+      ([&on_vsync_called](FLUTTER_API_SYMBOL(FlutterEngine) engine,
+                          intptr_t baton, uint64_t frame_start_time_nanos,
+                          uint64_t frame_target_time_nanos) {
+        EXPECT_EQ(frame_start_time_nanos, 1010000000u);
+        EXPECT_EQ(frame_target_time_nanos, 1020000000u);
+        on_vsync_called = true;
+        return kSuccess;
+      }));
+
+  engine->OnVsync(1);
+
+  EXPECT_TRUE(on_vsync_called);
+}
+
 TEST_F(FlutterWindowsEngineTest, RunWithoutANGLEUsesSoftware) {
   FlutterWindowsEngineBuilder builder{GetContext()};
   std::unique_ptr<FlutterWindowsEngine> engine = builder.Build();
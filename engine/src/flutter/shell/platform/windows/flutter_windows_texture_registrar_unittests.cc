@@ -38,9 +38,11 @@ std::unique_ptr<FlutterWindowsEngine> GetTestEngine() {
 }
 
 // Creates a ID3D11Texture2D with the specified size.
-ComPtr<ID3D11Texture2D> CreateD3dTexture(FlutterWindowsEngine* engine,
-                                         UINT width,
-                                         UINT height) {
+ComPtr<ID3D11Texture2D> CreateD3dTexture(
+    FlutterWindowsEngine* engine,
+    UINT width,
+    UINT height,
+    UINT misc_flags = D3D11_RESOURCE_MISC_SHARED) {
   ComPtr<ID3D11Device> d3d_device;
   ComPtr<ID3D11Texture2D> d3d_texture;
   if (engine->egl_manager()->GetDevice(d3d_device.GetAddressOf())) {
@@ -54,7 +56,7 @@ ComPtr<ID3D11Texture2D> CreateD3dTexture(FlutterWindowsEngine* engine,
     texture_description.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
     texture_description.Height = width;
     texture_description.Width = height;
-    texture_description.MiscFlags = D3D11_RESOURCE_MISC_SHARED;
+    texture_description.MiscFlags = misc_flags;
 
     d3d_device->CreateTexture2D(&texture_description, nullptr,
                                 d3d_texture.GetAddressOf());
@@ -320,6 +322,64 @@ TEST(FlutterWindowsTextureRegistrarTest, PopulateD3dTexture) {
   EXPECT_TRUE(release_callback_called);
 }
 
+TEST(FlutterWindowsTextureRegistrarTest, PopulateD3dTextureWithKeyedMutex) {
+  std::unique_ptr<FlutterWindowsEngine> engine = GetTestEngine();
+  auto gl = std::make_shared<egl::MockProcTable>();
+  FlutterWindowsTextureRegistrar registrar(engine.get(), gl);
+
+  UINT width = 100;
+  UINT height = 100;
+  auto d3d_texture = CreateD3dTexture(engine.get(), width, height,
+                                      D3D11_RESOURCE_MISC_SHARED_KEYEDMUTEX);
+  EXPECT_TRUE(d3d_texture);
+
+  FlutterDesktopGpuSurfaceDescriptor surface_descriptor = {};
+  surface_descriptor.struct_size = sizeof(FlutterDesktopGpuSurfaceDescriptor);
+  surface_descriptor.handle = d3d_texture.Get();
+  surface_descriptor.width = surface_descriptor.visible_width = width;
+  surface_descriptor.height = surface_descriptor.visible_height = height;
+  surface_descriptor.sync_type = kFlutterDesktopGpuSurfaceSyncKeyedMutex;
+  surface_descriptor.sync_acquire_value = 0;
+  surface_descriptor.sync_release_value = 1;
+
+  FlutterDesktopTextureInfo texture_info = {};
+  texture_info.type = kFlutterDesktopGpuSurfaceTexture;
+  texture_info.gpu_surface_config.struct_size =
+      sizeof(FlutterDesktopGpuSurfaceTextureConfig);
+  texture_info.gpu_surface_config.type =
+      kFlutterDesktopGpuSurfaceTypeD3d11Texture2D;
+  texture_info.gpu_surface_config.user_data = &surface_descriptor;
+  texture_info.gpu_surface_config.callback =
+      [](size_t width, size_t height,
+         void* user_data) -> const FlutterDesktopGpuSurfaceDescriptor* {
+    return reinterpret_cast<const FlutterDesktopGpuSurfaceDescriptor*>(
+        user_data);
+  };
+
+  FlutterOpenGLTexture flutter_texture = {};
+  auto texture_id = registrar.RegisterTexture(&texture_info);
+  EXPECT_NE(texture_id, -1);
+
+  EXPECT_CALL(*gl.get(), GenTextures(1, _))
+      .Times(1)
+      .WillOnce([](GLsizei n, GLuint* textures) { textures[0] = 1; });
+  EXPECT_CALL(*gl.get(), BindTexture).Times(1);
+  EXPECT_CALL(*gl.get(), TexParameteri).Times(AtLeast(1));
+  EXPECT_CALL(*gl.get(), DeleteTextures(1, _)).Times(1);
+
+  auto result =
+      registrar.PopulateTexture(texture_id, 640, 480, &flutter_texture);
+  EXPECT_TRUE(result);
+  EXPECT_EQ(flutter_texture.width, width);
+  EXPECT_EQ(flutter_texture.height, height);
+
+  // The surface was copied and released to the producer.
+  ComPtr<IDXGIKeyedMutex> keyed_mutex;
+  EXPECT_TRUE(SUCCEEDED(d3d_texture.As(&keyed_mutex)));
+  EXPECT_EQ(keyed_mutex->AcquireSync(1, 0), S_OK);
+  keyed_mutex->ReleaseSync(0);
+}
+
 TEST(FlutterWindowsTextureRegistrarTest, PopulateInvalidTexture) {
   std::unique_ptr<FlutterWindowsEngine> engine = GetTestEngine();
   auto gl = std::make_shared<egl::MockProcTable>();
@@ -6,6 +6,8 @@
 
 #include <windows.h>
 
+#include <cstddef>
+
 #include "flutter/fml/logging.h"
 #include "flutter/shell/platform/common/json_message_codec.h"
 #include "flutter/shell/platform/windows/keyboard_utils.h"
@@ -28,6 +30,10 @@ static constexpr char kWindowsKeyMap[] = "windows";
 static constexpr char kKeyUp[] = "keyup";
 static constexpr char kKeyDown[] = "keydown";
 
+// The size of the stack buffer key event messages are built in, which fits
+// the members of an event without allocating a pool chunk per key stroke.
+static constexpr size_t kEventBufferSize = 1024;
+
 // The maximum number of pending events to keep before
 // emitting a warning on the console about unhandled events.
 static constexpr int kMaxPendingEvents = 1000;
@@ -131,7 +137,10 @@ void KeyboardKeyChannelHandler::KeyboardHook(
     std::function<void(bool)> callback) {
   // TODO: Translate to a cross-platform key code system rather than passing
   // the native key code.
-  rapidjson::Document event(rapidjson::kObjectType);
+  alignas(std::max_align_t) char event_buffer[kEventBufferSize];
+  rapidjson::MemoryPoolAllocator<> event_allocator(event_buffer,
+                                                   sizeof(event_buffer));
+  rapidjson::Document event(rapidjson::kObjectType, &event_allocator);
   auto& allocator = event.GetAllocator();
   event.AddMember(kKeyCodeKey, key, allocator);
   event.AddMember(kScanCodeKey, scancode | (extended ? kScancodeExtended : 0),
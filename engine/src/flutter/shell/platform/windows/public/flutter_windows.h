@@ -60,6 +60,16 @@ typedef enum {
   RunOnSeparateThread,
 } FlutterDesktopUIThreadPolicy;
 
+// Configures how views present frames to the screen.
+typedef enum {
+  // Default value. Present through a swapchain on the view's window.
+  DefaultPresentMode,
+  // Present through a DirectComposition visual backed by a flip model
+  // swapchain, which reduces latency and improves frame pacing. Falls back to
+  // the default if not supported.
+  DirectCompositionPresentMode,
+} FlutterDesktopPresentMode;
+
 // Properties for configuring a Flutter engine instance.
 typedef struct {
   // The path to the flutter_assets folder for the application to be run.
@@ -98,6 +108,9 @@ typedef struct {
 
   // Policy for the thread that runs UI isolate.
   FlutterDesktopUIThreadPolicy ui_thread_policy;
+
+  // How views present frames to the screen.
+  FlutterDesktopPresentMode present_mode;
 } FlutterDesktopEngineProperties;
 
 // ========== View Controller ==========
@@ -34,6 +34,11 @@ class MockWindowsProcTable : public WindowsProcTable {
 
   MOCK_METHOD(HRESULT, DwmFlush, (), (const, override));
 
+  MOCK_METHOD(HRESULT,
+              DwmGetCompositionTimingInfo,
+              (HWND, DWM_TIMING_INFO*),
+              (const, override));
+
   MOCK_METHOD(HCURSOR,
               LoadCursor,
               (HINSTANCE instance, LPCWSTR cursor_name),
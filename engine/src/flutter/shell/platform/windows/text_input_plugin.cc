@@ -69,8 +69,12 @@ void TextInputPlugin::TextHook(const std::u16string& text) {
   if (active_model_ == nullptr) {
     return;
   }
-  std::u16string text_before_change =
-      fml::Utf8ToUtf16(active_model_->GetText());
+  // Only the delta model sends the text from before the change, so avoid
+  // copying the whole document otherwise.
+  std::u16string text_before_change;
+  if (enable_delta_model) {
+    text_before_change = active_model_->GetTextUtf16();
+  }
   TextRange selection_before_change = active_model_->selection();
   active_model_->AddText(text);
 
@@ -129,9 +133,7 @@ void TextInputPlugin::ComposeBeginHook() {
   }
   active_model_->BeginComposing();
   if (enable_delta_model) {
-    std::string text = active_model_->GetText();
-    TextRange selection = active_model_->selection();
-    TextEditingDelta delta = TextEditingDelta(text);
+    TextEditingDelta delta = TextEditingDelta(active_model_->GetTextUtf16());
     SendStateUpdateWithDelta(*active_model_, &delta);
   } else {
     SendStateUpdate(*active_model_);
@@ -142,11 +144,6 @@ void TextInputPlugin::ComposeCommitHook() {
   if (active_model_ == nullptr) {
     return;
   }
-  std::string text_before_change = active_model_->GetText();
-  TextRange selection_before_change = active_model_->selection();
-  TextRange composing_before_change = active_model_->composing_range();
-  std::string composing_text_before_change = text_before_change.substr(
-      composing_before_change.start(), composing_before_change.length());
   active_model_->CommitComposing();
 
   // We do not trigger SendStateUpdate here.
@@ -177,13 +174,10 @@ void TextInputPlugin::ComposeEndHook() {
   if (active_model_ == nullptr) {
     return;
   }
-  std::string text_before_change = active_model_->GetText();
-  TextRange selection_before_change = active_model_->selection();
   active_model_->CommitComposing();
   active_model_->EndComposing();
   if (enable_delta_model) {
-    std::string text = active_model_->GetText();
-    TextEditingDelta delta = TextEditingDelta(text);
+    TextEditingDelta delta = TextEditingDelta(active_model_->GetTextUtf16());
     SendStateUpdateWithDelta(*active_model_, &delta);
   } else {
     SendStateUpdate(*active_model_);
@@ -195,14 +189,16 @@ void TextInputPlugin::ComposeChangeHook(const std::u16string& text,
   if (active_model_ == nullptr) {
     return;
   }
-  std::string text_before_change = active_model_->GetText();
+  std::u16string text_before_change;
+  if (enable_delta_model) {
+    text_before_change = active_model_->GetTextUtf16();
+  }
   TextRange composing_before_change = active_model_->composing_range();
   active_model_->AddText(text);
   active_model_->UpdateComposingText(text, TextRange(cursor_pos, cursor_pos));
-  std::string text_after_change = active_model_->GetText();
   if (enable_delta_model) {
-    TextEditingDelta delta = TextEditingDelta(
-        fml::Utf8ToUtf16(text_before_change), composing_before_change, text);
+    TextEditingDelta delta =
+        TextEditingDelta(text_before_change, composing_before_change, text);
     SendStateUpdateWithDelta(*active_model_, &delta);
   } else {
     SendStateUpdate(*active_model_);
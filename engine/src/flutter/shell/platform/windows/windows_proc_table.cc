@@ -67,6 +67,12 @@ HRESULT WindowsProcTable::DwmFlush() const {
   return ::DwmFlush();
 }
 
+HRESULT WindowsProcTable::DwmGetCompositionTimingInfo(
+    HWND hwnd,
+    DWM_TIMING_INFO* timing_info) const {
+  return ::DwmGetCompositionTimingInfo(hwnd, timing_info);
+}
+
 HCURSOR WindowsProcTable::LoadCursor(HINSTANCE instance,
                                      LPCWSTR cursor_name) const {
   return ::LoadCursorW(instance, cursor_name);
@@ -66,6 +66,15 @@ class WindowsProcTable {
   // https://learn.microsoft.com/windows/win32/api/dwmapi/nf-dwmapi-dwmflush
   virtual HRESULT DwmFlush() const;
 
+  // Retrieves the current composition timing information, including the time
+  // of the last vblank and the refresh period of the compositor clock.
+  //
+  // See:
+  // https://learn.microsoft.com/windows/win32/api/dwmapi/nf-dwmapi-dwmgetcompositiontiminginfo
+  virtual HRESULT DwmGetCompositionTimingInfo(
+      HWND hwnd,
+      DWM_TIMING_INFO* timing_info) const;
+
   // Loads the specified cursor resource from the executable (.exe) file
   // associated with an application instance.
   //
@@ -6,6 +6,7 @@
 
 #include "flutter/display_list/image/dl_image.h"
 #include "flutter/skwasm/export.h"
+#include "flutter/skwasm/images.h"
 #include "flutter/skwasm/live_objects.h"
 #include "flutter/skwasm/skwasm_support.h"
 #include "third_party/skia/include/android/SkAnimatedImage.h"
@@ -77,6 +78,6 @@ SKWASM_EXPORT void animatedImage_decodeNextFrame(SkAnimatedImage* image) {
 
 SKWASM_EXPORT flutter::DlImage* animatedImage_getCurrentFrame(
     SkAnimatedImage* image) {
-  Skwasm::live_image_count++;
-  return flutter::DlImage::Make(image->getCurrentFrame()).release();
+  return Skwasm::TrackLiveImage(
+      flutter::DlImage::Make(image->getCurrentFrame()));
 }
@@ -8,6 +8,7 @@
 
 SKWASM_EXPORT SkData* skData_create(size_t size) {
   Skwasm::live_data_count++;
+  Skwasm::live_data_bytes += size;
   return SkData::MakeUninitialized(size).release();
 }
 
@@ -25,5 +26,6 @@ SKWASM_EXPORT size_t skData_getSize(SkData* data) {
 
 SKWASM_EXPORT void skData_dispose(SkData* data) {
   Skwasm::live_data_count--;
+  Skwasm::live_data_bytes -= data->size();
   return data->unref();
 }
@@ -18,6 +18,11 @@ SKWASM_EXPORT Skwasm::FlutterFontCollection* fontCollection_create() {
   auto provider = sk_make_sp<skia::textlayout::TypefaceFontProvider>();
   collection->enableFontFallback();
   collection->setDefaultFontManager(provider, "Roboto");
+  // Paragraphs are frequently rebuilt with the same text and styles, for
+  // example when only their width or paint changes. The paragraph cache lets
+  // them reuse the shaping of an earlier paragraph. It is reset, along with
+  // the other caches, by fontCollection_clearCaches when fonts are added.
+  collection->getParagraphCache()->turnOn(true);
   return new Skwasm::FlutterFontCollection{
       std::move(collection),
       std::move(provider),
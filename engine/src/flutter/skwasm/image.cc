@@ -9,12 +9,20 @@
 #include "flutter/skwasm/surface.h"
 #include "flutter/skwasm/wrappers.h"
 
+flutter::DlImage* Skwasm::TrackLiveImage(sk_sp<flutter::DlImage> image) {
+  Skwasm::live_image_count++;
+  if (image) {
+    Skwasm::live_image_bytes += image->GetApproximateByteSize();
+  }
+  return image.release();
+}
+
 SKWASM_EXPORT flutter::DlImage* image_createFromPicture(
     flutter::DisplayList* display_list,
     int32_t width,
     int32_t height) {
-  Skwasm::live_image_count++;
-  return Skwasm::MakeImageFromPicture(display_list, width, height).release();
+  return Skwasm::TrackLiveImage(
+      Skwasm::MakeImageFromPicture(display_list, width, height));
 }
 
 SKWASM_EXPORT flutter::DlImage* image_createFromPixels(
@@ -23,10 +31,8 @@ SKWASM_EXPORT flutter::DlImage* image_createFromPixels(
     int height,
     Skwasm::PixelFormat pixel_format,
     size_t row_byte_count) {
-  Skwasm::live_image_count++;
-  return Skwasm::MakeImageFromPixels(data, width, height, pixel_format,
-                                     row_byte_count)
-      .release();
+  return Skwasm::TrackLiveImage(Skwasm::MakeImageFromPixels(
+      data, width, height, pixel_format, row_byte_count));
 }
 
 SKWASM_EXPORT flutter::DlImage* image_createFromTextureSource(
@@ -34,18 +40,19 @@ SKWASM_EXPORT flutter::DlImage* image_createFromTextureSource(
     int width,
     int height,
     Skwasm::Surface* surface) {
-  Skwasm::live_image_count++;
-  return Skwasm::MakeImageFromTexture(texture_source, width, height, surface)
-      .release();
+  return Skwasm::TrackLiveImage(
+      Skwasm::MakeImageFromTexture(texture_source, width, height, surface));
 }
 
 SKWASM_EXPORT void image_ref(flutter::DlImage* image) {
   Skwasm::live_image_count++;
+  Skwasm::live_image_bytes += image->GetApproximateByteSize();
   image->ref();
 }
 
 SKWASM_EXPORT void image_dispose(flutter::DlImage* image) {
   Skwasm::live_image_count--;
+  Skwasm::live_image_bytes -= image->GetApproximateByteSize();
   image->unref();
 }
 
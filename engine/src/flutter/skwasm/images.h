@@ -30,6 +30,9 @@ extern sk_sp<flutter::DlImage> MakeImageFromPixels(SkData* data,
                                                    PixelFormat pixel_format,
                                                    size_t row_byte_count);
 
+// Counts |image| as a live image and releases it to the caller.
+extern flutter::DlImage* TrackLiveImage(sk_sp<flutter::DlImage> image);
+
 }  // namespace Skwasm
 
 #endif  // FLUTTER_SKWASM_IMAGES_H_
@@ -4,6 +4,9 @@
 
 #include "flutter/skwasm/live_objects.h"
 
+#include <emscripten/heap.h>
+#include <malloc.h>
+
 #include "flutter/skwasm/export.h"
 
 uint32_t Skwasm::live_line_break_buffer_count = 0;
@@ -35,6 +38,10 @@ uint32_t Skwasm::live_string16_count = 0;
 uint32_t Skwasm::live_surface_count = 0;
 uint32_t Skwasm::live_vertices_count = 0;
 
+uint32_t Skwasm::live_data_bytes = 0;
+uint32_t Skwasm::live_image_bytes = 0;
+uint32_t Skwasm::live_picture_bytes = 0;
+
 namespace {
 struct LiveObjectCounts {
   uint32_t line_break_buffer_count;
@@ -66,6 +73,14 @@ struct LiveObjectCounts {
   uint32_t surface_count;
   uint32_t vertices_count;
 };
+
+struct LiveObjectBytes {
+  uint32_t data_bytes;
+  uint32_t image_bytes;
+  uint32_t picture_bytes;
+  uint32_t heap_size;
+  uint32_t heap_allocated_bytes;
+};
 }  // namespace
 
 SKWASM_EXPORT void skwasm_getLiveObjectCounts(LiveObjectCounts* counts) {
@@ -99,3 +114,11 @@ SKWASM_EXPORT void skwasm_getLiveObjectCounts(LiveObjectCounts* counts) {
   counts->surface_count = Skwasm::live_surface_count;
   counts->vertices_count = Skwasm::live_vertices_count;
 }
+
+SKWASM_EXPORT void skwasm_getLiveObjectBytes(LiveObjectBytes* bytes) {
+  bytes->data_bytes = Skwasm::live_data_bytes;
+  bytes->image_bytes = Skwasm::live_image_bytes;
+  bytes->picture_bytes = Skwasm::live_picture_bytes;
+  bytes->heap_size = emscripten_get_heap_size();
+  bytes->heap_allocated_bytes = mallinfo().uordblks;
+}
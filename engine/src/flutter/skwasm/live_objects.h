@@ -38,6 +38,13 @@ extern uint32_t live_string16_count;
 extern uint32_t live_surface_count;
 extern uint32_t live_vertices_count;
 
+// The approximate heap bytes held by the live objects of the types that
+// usually dominate the heap. An object that is referenced several times is
+// counted once per reference, like the counts above.
+extern uint32_t live_data_bytes;
+extern uint32_t live_image_bytes;
+extern uint32_t live_picture_bytes;
+
 }  // namespace Skwasm
 
 #endif  // FLUTTER_SKWASM_LIVE_OBJECTS_H_
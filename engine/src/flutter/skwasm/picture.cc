@@ -48,7 +48,9 @@ SKWASM_EXPORT flutter::DisplayListBuilder* pictureRecorder_beginRecording(
 SKWASM_EXPORT flutter::DisplayList* pictureRecorder_endRecording(
     PictureRecorder* recorder) {
   Skwasm::live_picture_count++;
-  return recorder->FinishRecordingAsPicture().release();
+  sk_sp<flutter::DisplayList> picture = recorder->FinishRecordingAsPicture();
+  Skwasm::live_picture_bytes += picture->bytes();
+  return picture.release();
 }
 
 SKWASM_EXPORT void picture_getCullRect(flutter::DisplayList* picture,
@@ -58,11 +60,13 @@ SKWASM_EXPORT void picture_getCullRect(flutter::DisplayList* picture,
 
 SKWASM_EXPORT void picture_ref(flutter::DisplayList* picture) {
   Skwasm::live_picture_count++;
+  Skwasm::live_picture_bytes += picture->bytes();
   picture->ref();
 }
 
 SKWASM_EXPORT void picture_dispose(flutter::DisplayList* picture) {
   Skwasm::live_picture_count--;
+  Skwasm::live_picture_bytes -= picture->bytes();
   picture->unref();
 }
 
@@ -145,15 +145,16 @@ void Skwasm::Surface::RenderPicturesOnWorker(
     Init();
   }
 
+  // Every picture in a batch has the same size and is rendered into the same
+  // context, so the canvas is sized and made current once per batch.
+  ResizeSurface(width, height);
+  Skwasm::makeCurrent(gl_context_);
+
   // This is initialized on the first call to `skwasm_captureImageBitmap` and
   // then populated with more bitmaps on subsequent calls.
   Skwasm::SkwasmObject image_bitmap_array = __builtin_wasm_ref_null_extern();
   for (int i = 0; i < picture_count; i++) {
-    sk_sp<flutter::DisplayList> picture = pictures[i];
-    ResizeSurface(width, height);
-    Skwasm::makeCurrent(gl_context_);
-
-    render_context_->RenderPicture(picture);
+    render_context_->RenderPicture(pictures[i]);
 
     image_bitmap_array =
         skwasm_captureImageBitmap(gl_context_, image_bitmap_array);
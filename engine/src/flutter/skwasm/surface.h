@@ -50,6 +50,10 @@ class Surface {
   // Main thread only
   void Dispose();
   void SetResourceCacheLimit(int bytes);
+
+  // Pictures live in the shared wasm heap and are reference counted
+  // atomically, so only a reference to each of them is handed to the worker.
+  // The ops are read in place and never copied or serialized.
   uint32_t RenderPictures(flutter::DisplayList** pictures,
                           int width,
                           int height,
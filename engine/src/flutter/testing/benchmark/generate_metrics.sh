@@ -19,3 +19,4 @@ ${ENGINE_PATH}/src/out/${VARIANT}/display_list_builder_benchmarks --benchmark_fo
 ${ENGINE_PATH}/src/out/${VARIANT}/display_list_region_benchmarks --benchmark_format=json > ${ENGINE_PATH}/src/out/${VARIANT}/display_list_region_benchmarks.json
 ${ENGINE_PATH}/src/out/${VARIANT}/display_list_transform_benchmarks --benchmark_format=json > ${ENGINE_PATH}/src/out/${VARIANT}/display_list_transform_benchmarks.json
 ${ENGINE_PATH}/src/out/${VARIANT}/geometry_benchmarks --benchmark_format=json > ${ENGINE_PATH}/src/out/${VARIANT}/geometry_benchmarks.json
+${ENGINE_PATH}/src/out/${VARIANT}/entity_benchmarks --benchmark_format=json > ${ENGINE_PATH}/src/out/${VARIANT}/entity_benchmarks.json
@@ -857,6 +857,47 @@ void main() async {
     await comparer.addGoldenImage(image, 'render_unordered_rects.png');
   });
 
+  test('Canvas.drawCommands draws the same shapes as the draw calls', () async {
+    Future<Uint8List> render(void Function(Canvas canvas, Paint paint) draw) async {
+      final recorder = PictureRecorder();
+      final canvas = Canvas(recorder);
+      draw(canvas, Paint()..color = const Color(0xFF2196F3));
+      final Image image = await recorder.endRecording().toImage(100, 100);
+      return (await image.toByteData())!.buffer.asUint8List();
+    }
+
+    final commands = CanvasCommands();
+    expect(commands.isEmpty, isTrue);
+    commands
+      ..drawRect(const Rect.fromLTRB(40, 40, 10, 10))
+      ..setColor(const Color(0xFF4CAF50))
+      ..drawCircle(const Offset(70, 30), 15)
+      ..setStrokeWidth(4)
+      ..drawLine(const Offset(10, 90), const Offset(90, 60))
+      ..drawOval(const Rect.fromLTWH(50, 60, 40, 20));
+    expect(commands.isEmpty, isFalse);
+
+    final Uint8List batched = await render((Canvas canvas, Paint paint) {
+      canvas.drawCommands(commands, paint);
+    });
+    final Uint8List individual = await render((Canvas canvas, Paint paint) {
+      canvas.drawRect(const Rect.fromLTRB(10, 10, 40, 40), paint);
+      paint.color = const Color(0xFF4CAF50);
+      canvas.drawCircle(const Offset(70, 30), 15, paint);
+      paint.strokeWidth = 4;
+      canvas.drawLine(const Offset(10, 90), const Offset(90, 60), paint);
+      canvas.drawOval(const Rect.fromLTWH(50, 60, 40, 20), paint);
+    });
+    expect(batched, equals(individual));
+
+    commands.clear();
+    expect(commands.isEmpty, isTrue);
+    final Uint8List empty = await render((Canvas canvas, Paint paint) {
+      canvas.drawCommands(commands, paint);
+    });
+    expect(empty.every((int byte) => byte == 0), isTrue);
+  });
+
   test('Canvas.translate affects canvas.getTransform', () async {
     final recorder = PictureRecorder();
     final canvas = Canvas(recorder);
@@ -187,6 +187,23 @@ void main() async {
     expect(view1.lengthInBytes, 4);
   }, skip: !impellerEnabled);
 
+  test('HostBuffer.allocate', () async {
+    final gpu.HostBuffer hostBuffer = gpu.gpuContext.createHostBuffer();
+
+    final gpu.BufferView view0 = hostBuffer.allocate(4);
+    expect(view0.offsetInBytes, 0);
+    expect(view0.lengthInBytes, 4);
+
+    final gpu.BufferView view1 = hostBuffer.allocate(4);
+    expect(view1.offsetInBytes, equals(gpu.gpuContext.minimumUniformByteAlignment));
+    expect(view1.lengthInBytes, 4);
+
+    final ByteData bytes = view1.buffer.asByteData();
+    bytes.setUint32(view1.offsetInBytes, 0xdeadbeef, Endian.little);
+    view1.buffer.flush(offsetInBytes: view1.offsetInBytes, lengthInBytes: view1.lengthInBytes);
+    expect(bytes.getUint32(view1.offsetInBytes, Endian.little), 0xdeadbeef);
+  }, skip: !impellerEnabled);
+
   test('HostBuffer.reset', () async {
     final gpu.HostBuffer hostBuffer = gpu.gpuContext.createHostBuffer();
 
@@ -244,6 +261,35 @@ void main() async {
     expect(success, true);
   }, skip: !impellerEnabled);
 
+  test('DeviceBuffer.asByteData aliases the buffer contents', () async {
+    final gpu.DeviceBuffer deviceBuffer = gpu.gpuContext.createDeviceBuffer(
+      gpu.StorageMode.hostVisible,
+      4,
+    );
+
+    final ByteData bytes = deviceBuffer.asByteData();
+    expect(bytes.lengthInBytes, 4);
+    expect(identical(bytes, deviceBuffer.asByteData()), true);
+
+    deviceBuffer.overwrite(Int8List.fromList(<int>[0, 1, 2, 3]).buffer.asByteData());
+    deviceBuffer.flush();
+    expect(bytes.getInt8(3), 3);
+  }, skip: !impellerEnabled);
+
+  test('DeviceBuffer.asByteData throws for device private buffers', () async {
+    final gpu.DeviceBuffer deviceBuffer = gpu.gpuContext.createDeviceBuffer(
+      gpu.StorageMode.devicePrivate,
+      4,
+    );
+
+    try {
+      deviceBuffer.asByteData();
+      fail('Exception not thrown for a device private buffer.');
+    } catch (e) {
+      expect(e.toString(), contains('can only be used with DeviceBuffers that are host visible'));
+    }
+  }, skip: !impellerEnabled);
+
   test('DeviceBuffer.overwrite fails when out of bounds', () async {
     final gpu.DeviceBuffer deviceBuffer = gpu.gpuContext.createDeviceBuffer(
       gpu.StorageMode.hostVisible,
@@ -521,6 +567,54 @@ void main() async {
     await comparer.addGoldenImage(image, 'flutter_gpu_test_triangle.png');
   }, skip: !impellerEnabled);
 
+  test('Can render triangle with an indirect draw', () async {
+    final RenderPassState state = createSimpleRenderPass();
+    final gpu.RenderPipeline pipeline = createUnlitRenderPipeline();
+    state.renderPass.bindPipeline(pipeline);
+
+    final gpu.HostBuffer transients = gpu.gpuContext.createHostBuffer();
+    final gpu.BufferView vertices = transients.emplace(
+      float32(<double>[
+        -0.5, 0.5, //
+        0.0, -0.5, //
+        0.5, 0.5, //
+      ]),
+    );
+    final gpu.BufferView vertInfoData = transients.emplace(
+      unlitUBO(Matrix4.identity(), Colors.lime),
+    );
+    state.renderPass.bindVertexBuffer(vertices, 3);
+    state.renderPass.bindUniform(pipeline.vertexShader.getUniformSlot('VertInfo'), vertInfoData);
+
+    // vertexCount, instanceCount, firstVertex, firstInstance.
+    final gpu.BufferView arguments = transients.emplace(
+      Uint32List.fromList(<int>[3, 1, 0, 0]).buffer.asByteData(),
+    );
+    state.renderPass.drawIndirect(arguments);
+    state.commandBuffer.submit();
+
+    final ui.Image image = state.renderTexture.asImage();
+    await comparer.addGoldenImage(image, 'flutter_gpu_test_triangle_indirect.png');
+  }, skip: !impellerEnabled || !gpu.gpuContext.doesSupportIndirectDraw);
+
+  test('RenderPass.drawIndirect throws for invalid draw counts', () async {
+    final RenderPassState state = createSimpleRenderPass();
+    final gpu.DeviceBuffer arguments = gpu.gpuContext.createDeviceBuffer(
+      gpu.StorageMode.hostVisible,
+      16,
+    );
+
+    try {
+      state.renderPass.drawIndirect(
+        gpu.BufferView(arguments, offsetInBytes: 0, lengthInBytes: 16),
+        drawCount: 0,
+      );
+      fail('Exception not thrown for a draw count of zero.');
+    } catch (e) {
+      expect(e.toString(), contains('drawCount must be positive'));
+    }
+  }, skip: !impellerEnabled);
+
   // Renders a green triangle pointing downwards using polygon mode line.
   test('Can render triangle with polygon mode line.', () async {
     final RenderPassState state = createSimpleRenderPass();
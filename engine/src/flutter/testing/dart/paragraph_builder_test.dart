@@ -67,4 +67,37 @@ void main() {
     expect(metrics.first.baseline, 10.5);
     expect(metrics.first.lineNumber, 0);
   });
+
+  test('Paragraphs laid out in the background match synchronous ones', () async {
+    final style = ParagraphStyle(fontFamily: 'Ahem', fontSize: 14.0);
+    const text = 'Hello world, this paragraph wraps onto a few lines.';
+    const constraints = ParagraphConstraints(width: 100.0);
+
+    final builder = ParagraphBuilder(style);
+    builder.addText(text);
+    final Paragraph expected = builder.build()..layout(constraints);
+
+    final backgroundBuilder = ParagraphBuilder.background(style);
+    backgroundBuilder.addText(text);
+    final Paragraph paragraph = await backgroundBuilder.buildAndLayout(constraints);
+
+    expect(paragraph.width, expected.width);
+    expect(paragraph.height, expected.height);
+    expect(paragraph.numberOfLines, expected.numberOfLines);
+    expect(paragraph.longestLine, expected.longestLine);
+
+    // The paragraph can be laid out again on the UI thread.
+    paragraph.layout(const ParagraphConstraints(width: 800.0));
+    expect(paragraph.numberOfLines, 1);
+  });
+
+  test('buildAndLayout lays out synchronous builders', () async {
+    final builder = ParagraphBuilder(ParagraphStyle());
+    builder.addText('Hello');
+    final Paragraph paragraph = await builder.buildAndLayout(
+      const ParagraphConstraints(width: 800.0),
+    );
+    expect(paragraph.width, 800.0);
+    expect(paragraph.height, 14.0);
+  });
 }
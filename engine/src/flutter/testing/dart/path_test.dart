@@ -208,6 +208,17 @@ void main() {
     expect(metrics[1].extractPath(4.0, 6.0).computeMetrics().first.length, 2.0);
   });
 
+  test('PathMetrics of an unchanged path are measured per forceClosed', () {
+    final path = Path()
+      ..lineTo(0, 10)
+      ..lineTo(10, 10);
+    expect(path.computeMetrics().first.length, 20);
+    expect(path.computeMetrics(forceClosed: true).first.length, closeTo(34.14, 0.01));
+    expect(path.computeMetrics(forceClosed: true).first.isClosed, true);
+    expect(path.computeMetrics().first.length, 20);
+    expect(path.computeMetrics().first.isClosed, false);
+  });
+
   test('PathMetrics on a mutated path', () {
     final path = Path()..lineTo(0, 10);
     final PathMetrics metrics = path.computeMetrics();
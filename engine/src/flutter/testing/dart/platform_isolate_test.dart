@@ -195,4 +195,30 @@ void main() {
     }
     expect(throws, true);
   });
+
+  test('runOnBackgroundIsolate runs off the platform thread', () async {
+    final bool isPlatThread = await runOnBackgroundIsolate(() => isRunningOnPlatformThread);
+    expect(isPlatThread, isFalse);
+  });
+
+  test('runOnBackgroundIsolate, concurrent jobs', () async {
+    final List<Future<int>> futures = <Future<int>>[
+      for (int i = 0; i < 8; i++)
+        runOnBackgroundIsolate(() async {
+          await Future<void>.delayed(const Duration(milliseconds: 10));
+          return i;
+        }),
+    ];
+    expect(await Future.wait(futures), <int>[0, 1, 2, 3, 4, 5, 6, 7]);
+  });
+
+  test('runOnBackgroundIsolate, throws', () async {
+    Object? thrown;
+    try {
+      await runOnBackgroundIsolate<int>(() => throw StateError('failed'));
+    } catch (error) {
+      thrown = error;
+    }
+    expect(thrown, isA<StateError>());
+  });
 }
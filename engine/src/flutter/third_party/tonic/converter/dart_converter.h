@@ -572,6 +572,30 @@ struct DartConverter<Dart_Handle> {
   static bool AllowedInLeafCall() { return kAllowedInLeafCall; }
 };
 
+////////////////////////////////////////////////////////////////////////////////
+// Pointers to typed data
+
+// The elements of a typed data list, which leaf calls can pass as the
+// `address` of the list. The pointer is only valid for the duration of the
+// call, as the list may be moved by the garbage collector afterwards.
+template <typename T>
+struct DartConverter<
+    const T*,
+    typename std::enable_if<std::is_arithmetic<T>::value &&
+                            !std::is_same<T, char>::value>::type> {
+  using NativeType = const T*;
+  using FfiType = const T*;
+  static constexpr const char* kFfiRepresentation = "Pointer";
+  static constexpr const char* kDartRepresentation = "Pointer";
+  static constexpr bool kAllowedInLeafCall = true;
+
+  static NativeType FromFfi(FfiType val) { return val; }
+  static FfiType ToFfi(NativeType val) { return val; }
+  static const char* GetFfiRepresentation() { return kFfiRepresentation; }
+  static const char* GetDartRepresentation() { return kDartRepresentation; }
+  static bool AllowedInLeafCall() { return kAllowedInLeafCall; }
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // Convenience wrappers using type inference
 
@@ -33,6 +33,9 @@ class DartWeakPersistentValue {
            Dart_HandleFinalizer callback);
   void Clear();
   Dart_Handle Get();
+  // Reports the new size of the memory that the object keeps alive outside of
+  // the Dart heap. Must be called on the mutator thread.
+  void UpdateExternalSize(intptr_t external_allocation_size);
 
   const std::weak_ptr<DartState>& dart_state() const { return dart_state_; }
 
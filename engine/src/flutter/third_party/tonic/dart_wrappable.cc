@@ -38,7 +38,7 @@ Dart_Handle DartWrappable::CreateDartWrapper(DartState* dart_state) {
   TONIC_DCHECK(!CheckAndHandleError(res));
 
   this->RetainDartWrappableReference();  // Balanced in FinalizeDartWrapper.
-  dart_wrapper_.Set(dart_state, wrapper, this, sizeof(*this),
+  dart_wrapper_.Set(dart_state, wrapper, this, GetAllocationSize(),
                     &FinalizeDartWrapper);
 
   return wrapper;
@@ -59,7 +59,7 @@ void DartWrappable::AssociateWithDartWrapper(Dart_Handle wrapper) {
   this->RetainDartWrappableReference();  // Balanced in FinalizeDartWrapper.
 
   DartState* dart_state = DartState::Current();
-  dart_wrapper_.Set(dart_state, wrapper, this, sizeof(*this),
+  dart_wrapper_.Set(dart_state, wrapper, this, GetAllocationSize(),
                     &FinalizeDartWrapper);
 }
 
@@ -72,6 +72,14 @@ void DartWrappable::ClearDartWrapper() {
   this->ReleaseDartWrappableReference();
 }
 
+void DartWrappable::UpdateDartWrapperAllocationSize() {
+  dart_wrapper_.UpdateExternalSize(GetAllocationSize());
+}
+
+size_t DartWrappable::GetAllocationSize() const {
+  return sizeof(*this);
+}
+
 void DartWrappable::FinalizeDartWrapper(void* isolate_callback_data,
                                         void* peer) {
   DartWrappable* wrappable = reinterpret_cast<DartWrappable*>(peer);
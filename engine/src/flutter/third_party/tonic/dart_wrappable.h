@@ -38,12 +38,20 @@ class DartWrappable {
 
   virtual void ReleaseDartWrappableReference() const = 0;
 
+  // The number of bytes that this object keeps alive outside of the Dart
+  // heap. It is reported to the garbage collector as the external size of the
+  // wrapper, so that unreachable wrappers of large objects, such as images
+  // backed by textures, are collected sooner. Subclasses whose size changes
+  // after they were wrapped must call UpdateDartWrapperAllocationSize.
+  virtual size_t GetAllocationSize() const;
+
   // Use this method sparingly. It follows a slower path using Dart_New.
   // Prefer constructing the object in Dart code and using
   // AssociateWithDartWrapper.
   Dart_Handle CreateDartWrapper(DartState* dart_state);
   void AssociateWithDartWrapper(Dart_Handle wrappable);
   void ClearDartWrapper();  // Warning: Might delete this.
+  void UpdateDartWrapperAllocationSize();
   Dart_WeakPersistentHandle dart_wrapper() const {
     return dart_wrapper_.value();
   }
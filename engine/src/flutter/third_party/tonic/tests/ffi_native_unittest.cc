@@ -315,6 +315,28 @@ TEST_F(FfiNativeTest, SerialiseEchoTypedList) {
       /*leaf=*/false, "Handle", "Object", "Handle", "Object");
 }
 
+// Call and serialise function with the address of a typed list.
+
+double SumTypedListAddress(const float* arg, int length) {
+  double sum = 0;
+  for (int i = 0; i < length; i++) {
+    sum += arg[i];
+  }
+  EXPECT_NEAR(sum, 103.05, 0.01);
+  return sum;
+}
+
+TEST_F(FfiNativeTest, FfiBindingCallSumTypedListAddress) {
+  DoCallThroughTest<void, decltype(&SumTypedListAddress),
+                    &SumTypedListAddress>("SumTypedListAddress",
+                                          "callSumTypedListAddress");
+}
+
+TEST_F(FfiNativeTest, SerialiseSumTypedListAddress) {
+  DoSerialiseTest<void, decltype(&SumTypedListAddress), &SumTypedListAddress>(
+      /*leaf=*/true, "Double", "double", "Pointer, Int32", "Pointer, int");
+}
+
 // Call and serialise a static class member function.
 
 TEST_F(FfiNativeTest, FfiBindingCallClassMemberFunction) {
@@ -166,6 +166,17 @@ void callEchoTypedList() {
   }
 }
 
+@Native<Double Function(Pointer<Float>, Int32)>(symbol: 'SumTypedListAddress', isLeaf: true)
+external double sumTypedListAddress(Pointer<Float> arg, int length);
+
+@pragma('vm:entry-point')
+void callSumTypedListAddress() {
+  final typedList = Float32List.fromList([99.9, 3.14, 0.01]);
+  if ((sumTypedListAddress(typedList.address, typedList.length) - 103.05).abs() < 0.01) {
+    signalDone();
+  }
+}
+
 //
 
 @pragma('vm:entry-point')
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <iterator>
 #include <sstream>
 
 #include "flutter/fml/command_line.h"
@@ -198,6 +199,42 @@ BENCHMARK_REGISTER_F(SkParagraphFixture, StylesBigO)
     ->Range(1 << 3, 1 << 12)
     ->Complexity(benchmark::oN);
 
+// Builds and lays out the paragraphs of a list whose items repeat a few
+// labels, at alternating widths. The argument is whether the paragraph cache
+// of the font collection is enabled, so that the shaping of the repeated
+// labels is reused.
+BENCHMARK_DEFINE_F(SkParagraphFixture, RepeatedListItemsLayout)
+(benchmark::State& state) {
+  const char* labels[] = {
+      "Delivered",
+      "Read 5 minutes ago",
+      "This is a longer message that will wrap onto a second line when the "
+      "list is narrow.",
+      "Typing...",
+  };
+  font_collection_->getParagraphCache()->reset();
+  font_collection_->getParagraphCache()->turnOn(state.range(0));
+  sktxt::ParagraphStyle paragraph_style;
+  sktxt::TextStyle text_style;
+  text_style.setFontFamilies({SkString("Roboto")});
+  text_style.setColor(SK_ColorBLACK);
+  int item = 0;
+  while (state.KeepRunning()) {
+    auto builder = sktxt::ParagraphBuilder::make(
+        paragraph_style, font_collection_, SkUnicodes::ICU::Make());
+    builder->pushStyle(text_style);
+    builder->addText(labels[item % std::size(labels)]);
+    builder->pop();
+    auto paragraph = builder->Build();
+    paragraph->layout(item % 2 == 0 ? 300 : 200);
+    item++;
+  }
+  font_collection_->getParagraphCache()->turnOn(true);
+}
+BENCHMARK_REGISTER_F(SkParagraphFixture, RepeatedListItemsLayout)
+    ->Arg(false)
+    ->Arg(true);
+
 BENCHMARK_F(SkParagraphFixture, PaintSimple)(benchmark::State& state) {
   const char* text = "This is a simple sentence to test drawing.";
   sktxt::ParagraphStyle paragraph_style;
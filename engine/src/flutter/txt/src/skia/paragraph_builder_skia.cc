@@ -35,10 +35,14 @@ SkFontStyle MakeSkFontStyle(int font_weight, txt::FontStyle font_style) {
 ParagraphBuilderSkia::ParagraphBuilderSkia(
     const ParagraphStyle& style,
     const std::shared_ptr<FontCollection>& font_collection,
-    const bool impeller_enabled)
+    const bool impeller_enabled,
+    const bool isolated_font_collection)
     : base_style_(style.GetTextStyle()), impeller_enabled_(impeller_enabled) {
   builder_ = skt::ParagraphBuilder::make(
-      TxtToSkia(style), font_collection->CreateSktFontCollection(),
+      TxtToSkia(style),
+      isolated_font_collection
+          ? font_collection->CreateIsolatedSktFontCollection()
+          : font_collection->CreateSktFontCollection(),
       SkUnicodes::ICU::Make());
 }
 
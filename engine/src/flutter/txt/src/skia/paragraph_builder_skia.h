@@ -21,7 +21,8 @@ class ParagraphBuilderSkia : public ParagraphBuilder {
  public:
   ParagraphBuilderSkia(const ParagraphStyle& style,
                        const std::shared_ptr<FontCollection>& font_collection,
-                       const bool impeller_enabled);
+                       const bool impeller_enabled,
+                       const bool isolated_font_collection = false);
 
   virtual ~ParagraphBuilderSkia();
 
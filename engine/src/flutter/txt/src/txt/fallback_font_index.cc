@@ -0,0 +1,280 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "txt/fallback_font_index.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "flutter/fml/logging.h"
+
+namespace txt {
+
+namespace {
+
+// The index is a header, followed by the end offsets of the strings it
+// refers to, the strings, and the entries sorted by locale and character.
+// It is only ever read on the device that wrote it, so it is stored in the
+// byte order of that device, which the magic number is also written in.
+constexpr uint32_t kMagic = 0x58494646;  // 'FFIX'
+constexpr uint32_t kVersion = 1;
+
+struct Header {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t fingerprint;
+  uint32_t string_count;
+  uint32_t entry_count;
+};
+
+constexpr size_t AlignTo4(size_t size) {
+  return (size + 3) & ~static_cast<size_t>(3);
+}
+
+}  // namespace
+
+struct FallbackFontIndex::MappedEntry {
+  uint16_t locale;
+  uint16_t family;
+  uint32_t character;
+};
+
+FallbackFontIndex::FallbackFontIndex(uint64_t fingerprint)
+    : fingerprint_(fingerprint) {}
+
+FallbackFontIndex::FallbackFontIndex(
+    uint64_t fingerprint,
+    std::unique_ptr<const fml::Mapping> mapping)
+    : fingerprint_(fingerprint), mapping_(std::move(mapping)) {
+  if (!ReadMapping()) {
+    mapping_.reset();
+    mapped_strings_.clear();
+    mapped_string_indices_.clear();
+    mapped_entries_ = nullptr;
+    mapped_entry_count_ = 0;
+  }
+}
+
+FallbackFontIndex::~FallbackFontIndex() = default;
+
+bool FallbackFontIndex::ReadMapping() {
+  if (!mapping_ || mapping_->GetMapping() == nullptr) {
+    return false;
+  }
+  const uint8_t* bytes = mapping_->GetMapping();
+  const size_t size = mapping_->GetSize();
+  Header header;
+  if (size < sizeof(Header) ||
+      reinterpret_cast<uintptr_t>(bytes) % alignof(MappedEntry) != 0) {
+    return false;
+  }
+  memcpy(&header, bytes, sizeof(Header));
+  if (header.magic != kMagic || header.version != kVersion) {
+    FML_DLOG(WARNING) << "Ignoring a font fallback index of another version.";
+    return false;
+  }
+  if (header.fingerprint != fingerprint_) {
+    // The system fonts changed since the index was written.
+    return false;
+  }
+  if (header.string_count > std::numeric_limits<uint16_t>::max() ||
+      header.entry_count > kMaxEntries) {
+    return false;
+  }
+
+  const size_t offsets_start = sizeof(Header);
+  const size_t strings_start =
+      offsets_start + header.string_count * sizeof(uint32_t);
+  if (strings_start > size) {
+    return false;
+  }
+  const char* strings = reinterpret_cast<const char*>(bytes + strings_start);
+  size_t string_start = 0;
+  for (uint32_t i = 0; i < header.string_count; i++) {
+    uint32_t string_end;
+    memcpy(&string_end, bytes + offsets_start + i * sizeof(uint32_t),
+           sizeof(uint32_t));
+    if (string_end < string_start || string_end > size - strings_start) {
+      return false;
+    }
+    std::string_view string(strings + string_start, string_end - string_start);
+    mapped_string_indices_.emplace(string, i);
+    mapped_strings_.push_back(string);
+    string_start = string_end;
+  }
+
+  const size_t entries_start = AlignTo4(strings_start + string_start);
+  if (entries_start > size ||
+      (size - entries_start) / sizeof(MappedEntry) < header.entry_count) {
+    return false;
+  }
+  mapped_entries_ =
+      reinterpret_cast<const MappedEntry*>(bytes + entries_start);
+  for (uint32_t i = 0; i < header.entry_count; i++) {
+    const MappedEntry& entry = mapped_entries_[i];
+    if (entry.locale >= header.string_count ||
+        entry.family >= header.string_count) {
+      return false;
+    }
+    if (i > 0) {
+      const MappedEntry& previous = mapped_entries_[i - 1];
+      if (std::tie(previous.locale, previous.character) >=
+          std::tie(entry.locale, entry.character)) {
+        return false;
+      }
+    }
+  }
+  mapped_entry_count_ = header.entry_count;
+  return true;
+}
+
+const FallbackFontIndex::MappedEntry* FallbackFontIndex::FindMappedEntry(
+    std::string_view locale,
+    uint32_t character) const {
+  auto found_locale = mapped_string_indices_.find(locale);
+  if (found_locale == mapped_string_indices_.end()) {
+    return nullptr;
+  }
+  const uint16_t locale_index = found_locale->second;
+  const MappedEntry* end = mapped_entries_ + mapped_entry_count_;
+  const MappedEntry* entry = std::lower_bound(
+      mapped_entries_, end, std::make_pair(locale_index, character),
+      [](const MappedEntry& entry, const std::pair<uint16_t, uint32_t>& key) {
+        return std::tie(entry.locale, entry.character) <
+               std::tie(key.first, key.second);
+      });
+  if (entry == end || entry->locale != locale_index ||
+      entry->character != character) {
+    return nullptr;
+  }
+  return entry;
+}
+
+std::optional<std::string_view> FallbackFontIndex::Find(
+    std::string_view locale,
+    uint32_t character) const {
+  auto added = added_entries_.find({std::string(locale), character});
+  if (added != added_entries_.end()) {
+    return added->second;
+  }
+  const MappedEntry* entry = FindMappedEntry(locale, character);
+  if (entry == nullptr) {
+    return std::nullopt;
+  }
+  return mapped_strings_[entry->family];
+}
+
+void FallbackFontIndex::Add(std::string_view locale,
+                            uint32_t character,
+                            std::string_view family) {
+  const MappedEntry* mapped = FindMappedEntry(locale, character);
+  if (mapped != nullptr && mapped_strings_[mapped->family] == family) {
+    return;
+  }
+  auto key = std::make_pair(std::string(locale), character);
+  auto added = added_entries_.find(key);
+  if (added != added_entries_.end()) {
+    if (added->second == family) {
+      return;
+    }
+    added->second = std::string(family);
+  } else {
+    if (mapped == nullptr) {
+      if (GetEntryCount() >= kMaxEntries) {
+        return;
+      }
+      new_entry_count_++;
+    }
+    added_entries_.emplace(std::move(key), std::string(family));
+  }
+  has_changes_ = true;
+}
+
+size_t FallbackFontIndex::GetEntryCount() const {
+  return mapped_entry_count_ + new_entry_count_;
+}
+
+std::vector<uint8_t> FallbackFontIndex::Serialize() {
+  std::map<std::pair<std::string_view, uint32_t>, std::string_view> entries;
+  for (size_t i = 0; i < mapped_entry_count_; i++) {
+    const MappedEntry& entry = mapped_entries_[i];
+    entries[{mapped_strings_[entry.locale], entry.character}] =
+        mapped_strings_[entry.family];
+  }
+  for (const auto& [key, family] : added_entries_) {
+    entries[{key.first, key.second}] = family;
+  }
+
+  std::vector<std::string_view> strings;
+  std::unordered_map<std::string_view, uint16_t> string_indices;
+  auto intern = [&](std::string_view string) -> std::optional<uint16_t> {
+    auto found = string_indices.find(string);
+    if (found != string_indices.end()) {
+      return found->second;
+    }
+    if (strings.size() > std::numeric_limits<uint16_t>::max()) {
+      return std::nullopt;
+    }
+    const uint16_t index = strings.size();
+    strings.push_back(string);
+    string_indices.emplace(string, index);
+    return index;
+  };
+  std::vector<MappedEntry> sorted_entries;
+  sorted_entries.reserve(entries.size());
+  for (const auto& [key, family] : entries) {
+    std::optional<uint16_t> locale_index = intern(key.first);
+    std::optional<uint16_t> family_index = intern(family);
+    if (!locale_index.has_value() || !family_index.has_value()) {
+      break;
+    }
+    sorted_entries.push_back({.locale = locale_index.value(),
+                              .family = family_index.value(),
+                              .character = key.second});
+  }
+  // The entries were sorted by the locale strings, but are searched by the
+  // indices of the locales.
+  std::sort(sorted_entries.begin(), sorted_entries.end(),
+            [](const MappedEntry& a, const MappedEntry& b) {
+              return std::tie(a.locale, a.character) <
+                     std::tie(b.locale, b.character);
+            });
+
+  size_t strings_size = 0;
+  for (std::string_view string : strings) {
+    strings_size += string.size();
+  }
+  const size_t strings_start =
+      sizeof(Header) + strings.size() * sizeof(uint32_t);
+  const size_t entries_start = AlignTo4(strings_start + strings_size);
+  std::vector<uint8_t> data(entries_start +
+                            sorted_entries.size() * sizeof(MappedEntry));
+
+  const Header header = {
+      .magic = kMagic,
+      .version = kVersion,
+      .fingerprint = fingerprint_,
+      .string_count = static_cast<uint32_t>(strings.size()),
+      .entry_count = static_cast<uint32_t>(sorted_entries.size()),
+  };
+  memcpy(data.data(), &header, sizeof(Header));
+  uint32_t string_end = 0;
+  for (size_t i = 0; i < strings.size(); i++) {
+    memcpy(data.data() + strings_start + string_end, strings[i].data(),
+           strings[i].size());
+    string_end += strings[i].size();
+    memcpy(data.data() + sizeof(Header) + i * sizeof(uint32_t), &string_end,
+           sizeof(uint32_t));
+  }
+  if (!sorted_entries.empty()) {
+    memcpy(data.data() + entries_start, sorted_entries.data(),
+           sorted_entries.size() * sizeof(MappedEntry));
+  }
+
+  has_changes_ = false;
+  return data;
+}
+
+}  // namespace txt
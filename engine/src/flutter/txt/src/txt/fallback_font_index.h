@@ -0,0 +1,113 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TXT_SRC_TXT_FALLBACK_FONT_INDEX_H_
+#define FLUTTER_TXT_SRC_TXT_FALLBACK_FONT_INDEX_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
+
+namespace txt {
+
+//------------------------------------------------------------------------------
+/// @brief      An index of the font families that the system font manager
+///             falls back to for characters, by the locale they are looked up
+///             for, so that the search across the system fonts only happens
+///             the first time a character is ever seen.
+///
+///             The index is identified by a fingerprint of the fonts it was
+///             built from, and is discarded when they change. An index read
+///             from a file is kept memory mapped and searched in place, while
+///             the entries added since are kept in memory until the index is
+///             serialized again.
+///
+class FallbackFontIndex {
+ public:
+  /// The family of the characters that no system font covers.
+  static constexpr std::string_view kNoCoverage = "";
+
+  /// The most entries that are added to an index, which bounds its size.
+  static constexpr size_t kMaxEntries = 1 << 16;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Creates an empty index of the fonts identified by
+  ///             `fingerprint`.
+  ///
+  explicit FallbackFontIndex(uint64_t fingerprint);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Reads an index written by |Serialize|. The index is empty if
+  ///             the mapping isn't a valid index of the fonts identified by
+  ///             `fingerprint`.
+  ///
+  FallbackFontIndex(uint64_t fingerprint,
+                    std::unique_ptr<const fml::Mapping> mapping);
+
+  ~FallbackFontIndex();
+
+  //----------------------------------------------------------------------------
+  /// @brief      The family that `character` falls back to for `locale`,
+  ///             |kNoCoverage| if no family covers it, or nothing if it isn't
+  ///             in the index.
+  ///
+  std::optional<std::string_view> Find(std::string_view locale,
+                                       uint32_t character) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Records the family that `character` falls back to for
+  ///             `locale`, replacing the one in the index if there is one.
+  ///
+  void Add(std::string_view locale,
+           uint32_t character,
+           std::string_view family);
+
+  size_t GetEntryCount() const;
+
+  /// Whether entries were added since the index was read or serialized.
+  bool HasChanges() const { return has_changes_; }
+
+  //----------------------------------------------------------------------------
+  /// @brief      Writes the index in the format read by the constructor, and
+  ///             clears |HasChanges|.
+  ///
+  std::vector<uint8_t> Serialize();
+
+ private:
+  struct MappedEntry;
+
+  const uint64_t fingerprint_;
+  std::unique_ptr<const fml::Mapping> mapping_;
+  // The strings and entries of the mapping, which point into it.
+  std::vector<std::string_view> mapped_strings_;
+  std::unordered_map<std::string_view, uint16_t> mapped_string_indices_;
+  const MappedEntry* mapped_entries_ = nullptr;
+  size_t mapped_entry_count_ = 0;
+  // The entries added since the mapping was read, by locale and character.
+  std::map<std::pair<std::string, uint32_t>, std::string> added_entries_;
+  // The number of the added entries that aren't in the mapping.
+  size_t new_entry_count_ = 0;
+  bool has_changes_ = false;
+
+  bool ReadMapping();
+
+  const MappedEntry* FindMappedEntry(std::string_view locale,
+                                     uint32_t character) const;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FallbackFontIndex);
+};
+
+}  // namespace txt
+
+#endif  // FLUTTER_TXT_SRC_TXT_FALLBACK_FONT_INDEX_H_
@@ -0,0 +1,231 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "txt/fallback_index_font_manager.h"
+
+#include <utility>
+#include <vector>
+
+#include "flutter/fml/file.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/paths.h"
+#include "flutter/fml/trace_event.h"
+#include "third_party/skia/include/core/SkString.h"
+#include "third_party/skia/include/core/SkTypeface.h"
+
+namespace txt {
+
+namespace {
+
+// The locales of a lookup, which fall back to different fonts for the same
+// characters, joined into the key of the index.
+std::string JoinLocales(const char* bcp47[], int bcp47Count) {
+  std::string locales;
+  for (int i = 0; i < bcp47Count; i++) {
+    if (i > 0) {
+      locales += ',';
+    }
+    locales += bcp47[i];
+  }
+  return locales;
+}
+
+bool Covers(const sk_sp<SkTypeface>& typeface, SkUnichar character) {
+  return typeface != nullptr && typeface->unicharToGlyph(character) != 0;
+}
+
+}  // namespace
+
+FallbackIndexFontManager::FallbackIndexFontManager(
+    sk_sp<SkFontMgr> base_manager,
+    std::string cache_directory)
+    : base_manager_(std::move(base_manager)),
+      cache_directory_(std::move(cache_directory)) {
+  FML_DCHECK(base_manager_ != nullptr);
+}
+
+FallbackIndexFontManager::~FallbackIndexFontManager() = default;
+
+uint64_t FallbackIndexFontManager::GetFontsFingerprint() const {
+  // FNV-1a of the names of the system font families.
+  uint64_t hash = 0xcbf29ce484222325;
+  auto add = [&hash](const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++) {
+      hash = (hash ^ bytes[i]) * 0x100000001b3;
+    }
+  };
+  const int count = base_manager_->countFamilies();
+  add(&count, sizeof(count));
+  for (int i = 0; i < count; i++) {
+    SkString name;
+    base_manager_->getFamilyName(i, &name);
+    add(name.c_str(), name.size() + 1);
+  }
+  return hash;
+}
+
+FallbackFontIndex& FallbackIndexFontManager::GetIndex() const {
+  if (!index_) {
+    TRACE_EVENT0("flutter", "FallbackIndexFontManager::GetIndex");
+    const uint64_t fingerprint = GetFontsFingerprint();
+    std::unique_ptr<fml::FileMapping> mapping =
+        fml::FileMapping::CreateReadOnly(
+            fml::paths::JoinPaths({cache_directory_, kIndexFileName}));
+    if (mapping) {
+      index_ =
+          std::make_unique<FallbackFontIndex>(fingerprint, std::move(mapping));
+    } else {
+      index_ = std::make_unique<FallbackFontIndex>(fingerprint);
+    }
+  }
+  return *index_;
+}
+
+sk_sp<SkTypeface> FallbackIndexFontManager::MatchIndexedFamily(
+    const std::string& family,
+    const SkFontStyle& style,
+    SkUnichar character) const {
+  sk_sp<SkTypeface> typeface =
+      base_manager_->matchFamilyStyle(family.c_str(), style);
+  return Covers(typeface, character) ? typeface : nullptr;
+}
+
+bool FallbackIndexFontManager::SaveIndexIfNeeded() {
+  std::vector<uint8_t> data;
+  {
+    std::scoped_lock lock(mutex_);
+    if (!index_ || !index_->HasChanges()) {
+      return true;
+    }
+    data = index_->Serialize();
+  }
+  TRACE_EVENT0("flutter", "FallbackIndexFontManager::SaveIndexIfNeeded");
+  fml::UniqueFD directory = fml::OpenDirectory(
+      cache_directory_.c_str(), false, fml::FilePermission::kReadWrite);
+  if (!directory.is_valid() ||
+      !fml::WriteAtomically(directory, kIndexFileName,
+                            fml::DataMapping(std::move(data)))) {
+    FML_LOG(ERROR) << "Could not save the font fallback index to "
+                   << cache_directory_;
+    return false;
+  }
+  return true;
+}
+
+int FallbackIndexFontManager::onCountFamilies() const {
+  return base_manager_->countFamilies();
+}
+
+void FallbackIndexFontManager::onGetFamilyName(int index,
+                                               SkString* familyName) const {
+  base_manager_->getFamilyName(index, familyName);
+}
+
+sk_sp<SkFontStyleSet> FallbackIndexFontManager::onCreateStyleSet(
+    int index) const {
+  return base_manager_->createStyleSet(index);
+}
+
+sk_sp<SkFontStyleSet> FallbackIndexFontManager::onMatchFamily(
+    const char familyName[]) const {
+  return base_manager_->matchFamily(familyName);
+}
+
+sk_sp<SkTypeface> FallbackIndexFontManager::onMatchFamilyStyle(
+    const char familyName[],
+    const SkFontStyle& style) const {
+  return base_manager_->matchFamilyStyle(familyName, style);
+}
+
+sk_sp<SkTypeface> FallbackIndexFontManager::onMatchFamilyStyleCharacter(
+    const char familyName[],
+    const SkFontStyle& style,
+    const char* bcp47[],
+    int bcp47Count,
+    SkUnichar character) const {
+  // The fallbacks of a requested family depend on that family, and are not
+  // what the shaper asks for when it runs out of the fonts of the collection.
+  if (familyName != nullptr && familyName[0] != '\0') {
+    return base_manager_->matchFamilyStyleCharacter(familyName, style, bcp47,
+                                                    bcp47Count, character);
+  }
+
+  std::string locales = JoinLocales(bcp47, bcp47Count);
+  std::scoped_lock lock(mutex_);
+  MatchKey key(locales, character, style.weight(), style.width(),
+               style.slant());
+  auto match = matches_.find(key);
+  if (match != matches_.end()) {
+    return match->second;
+  }
+  if (matches_.size() >= FallbackFontIndex::kMaxEntries) {
+    matches_.clear();
+  }
+
+  FallbackFontIndex& index = GetIndex();
+  std::optional<std::string_view> indexed = index.Find(locales, character);
+  if (indexed.has_value()) {
+    if (indexed.value() == FallbackFontIndex::kNoCoverage) {
+      matches_.emplace(std::move(key), nullptr);
+      return nullptr;
+    }
+    sk_sp<SkTypeface> typeface =
+        MatchIndexedFamily(std::string(indexed.value()), style, character);
+    if (typeface) {
+      matches_.emplace(std::move(key), typeface);
+      return typeface;
+    }
+    // The family no longer covers the character, so it is looked up again.
+  }
+
+  TRACE_EVENT0("flutter", "FallbackIndexFontManager::SearchSystemFonts");
+  sk_sp<SkTypeface> typeface = base_manager_->matchFamilyStyleCharacter(
+      familyName, style, bcp47, bcp47Count, character);
+  if (typeface == nullptr) {
+    index.Add(locales, character, FallbackFontIndex::kNoCoverage);
+  } else {
+    // Fallback fonts that don't have a family name, or whose name doesn't
+    // match them again, can't be indexed and are only remembered.
+    SkString family;
+    typeface->getFamilyName(&family);
+    if (!family.isEmpty() &&
+        MatchIndexedFamily(family.c_str(), style, character) != nullptr) {
+      index.Add(locales, character, family.c_str());
+    }
+  }
+  matches_.emplace(std::move(key), typeface);
+  return typeface;
+}
+
+sk_sp<SkTypeface> FallbackIndexFontManager::onMakeFromData(sk_sp<SkData> data,
+                                                           int ttcIndex) const {
+  return base_manager_->makeFromData(std::move(data), ttcIndex);
+}
+
+sk_sp<SkTypeface> FallbackIndexFontManager::onMakeFromStreamIndex(
+    std::unique_ptr<SkStreamAsset> stream,
+    int ttcIndex) const {
+  return base_manager_->makeFromStream(std::move(stream), ttcIndex);
+}
+
+sk_sp<SkTypeface> FallbackIndexFontManager::onMakeFromStreamArgs(
+    std::unique_ptr<SkStreamAsset> stream,
+    const SkFontArguments& args) const {
+  return base_manager_->makeFromStream(std::move(stream), args);
+}
+
+sk_sp<SkTypeface> FallbackIndexFontManager::onMakeFromFile(const char path[],
+                                                           int ttcIndex) const {
+  return base_manager_->makeFromFile(path, ttcIndex);
+}
+
+sk_sp<SkTypeface> FallbackIndexFontManager::onLegacyMakeTypeface(
+    const char familyName[],
+    SkFontStyle style) const {
+  return base_manager_->legacyMakeTypeface(familyName, style);
+}
+
+}  // namespace txt
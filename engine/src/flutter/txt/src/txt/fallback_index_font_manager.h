@@ -0,0 +1,120 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TXT_SRC_TXT_FALLBACK_INDEX_FONT_MANAGER_H_
+#define FLUTTER_TXT_SRC_TXT_FALLBACK_INDEX_FONT_MANAGER_H_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkFontMgr.h"
+#include "third_party/skia/include/core/SkStream.h"
+#include "txt/fallback_font_index.h"
+
+namespace txt {
+
+//------------------------------------------------------------------------------
+/// @brief      A font manager that forwards to the system font manager, but
+///             remembers the fonts it falls back to for characters that are
+///             missing from the requested families.
+///
+///             Finding the fallback font of a character searches every system
+///             font, which happens each time a script is first seen by the
+///             shaper of a process. The fallbacks found are remembered for
+///             the life of the manager, and those that can be matched again
+///             by their family name are also kept in a |FallbackFontIndex|
+///             saved in `cache_directory`, so that later processes only open
+///             the font they need.
+///
+class FallbackIndexFontManager : public SkFontMgr {
+ public:
+  /// The name of the index file in the cache directory.
+  static constexpr char kIndexFileName[] = "flutter_font_fallback_index";
+
+  FallbackIndexFontManager(sk_sp<SkFontMgr> base_manager,
+                           std::string cache_directory);
+
+  ~FallbackIndexFontManager() override;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Writes the index to the cache directory if fallbacks were
+  ///             added to it since it was read or last saved.
+  ///
+  /// @return     Whether the index is up to date on disk.
+  ///
+  bool SaveIndexIfNeeded();
+
+ private:
+  using MatchKey = std::tuple<std::string, SkUnichar, int, int, int>;
+
+  const sk_sp<SkFontMgr> base_manager_;
+  const std::string cache_directory_;
+  mutable std::mutex mutex_;
+  // Read from the cache directory the first time a fallback is looked up.
+  mutable std::unique_ptr<FallbackFontIndex> index_;
+  // The fallbacks found by this manager, including the characters that no
+  // font covers.
+  mutable std::map<MatchKey, sk_sp<SkTypeface>> matches_;
+
+  FallbackFontIndex& GetIndex() const;
+
+  uint64_t GetFontsFingerprint() const;
+
+  sk_sp<SkTypeface> MatchIndexedFamily(const std::string& family,
+                                       const SkFontStyle& style,
+                                       SkUnichar character) const;
+
+  // |SkFontMgr|
+  int onCountFamilies() const override;
+
+  // |SkFontMgr|
+  void onGetFamilyName(int index, SkString* familyName) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkFontStyleSet> onCreateStyleSet(int index) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkFontStyleSet> onMatchFamily(const char familyName[]) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMatchFamilyStyle(const char familyName[],
+                                       const SkFontStyle&) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMatchFamilyStyleCharacter(
+      const char familyName[],
+      const SkFontStyle&,
+      const char* bcp47[],
+      int bcp47Count,
+      SkUnichar character) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMakeFromData(sk_sp<SkData>, int ttcIndex) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMakeFromStreamIndex(std::unique_ptr<SkStreamAsset>,
+                                          int ttcIndex) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMakeFromStreamArgs(std::unique_ptr<SkStreamAsset>,
+                                         const SkFontArguments&) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMakeFromFile(const char path[],
+                                   int ttcIndex) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onLegacyMakeTypeface(const char familyName[],
+                                         SkFontStyle) const override;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FallbackIndexFontManager);
+};
+
+}  // namespace txt
+
+#endif  // FLUTTER_TXT_SRC_TXT_FALLBACK_INDEX_FONT_MANAGER_H_
@@ -19,7 +19,8 @@
 
 namespace txt {
 
-FontCollection::FontCollection() : enable_font_fallback_(true) {}
+FontCollection::FontCollection()
+    : enable_font_fallback_(true), enable_paragraph_cache_(true) {}
 
 FontCollection::~FontCollection() {
   if (skt_collection_) {
@@ -33,15 +34,36 @@ size_t FontCollection::GetFontManagersCount() const {
 
 void FontCollection::SetupDefaultFontManager(
     uint32_t font_initialization_data) {
-  default_font_manager_ = GetDefaultFontManager(font_initialization_data);
+  sk_sp<SkFontMgr> font_manager =
+      GetDefaultFontManager(font_initialization_data);
+  if (font_manager && !fallback_font_index_directory_.empty()) {
+    fallback_index_font_manager_ = sk_make_sp<FallbackIndexFontManager>(
+        std::move(font_manager), fallback_font_index_directory_);
+    default_font_manager_ = fallback_index_font_manager_;
+  } else {
+    fallback_index_font_manager_.reset();
+    default_font_manager_ = std::move(font_manager);
+  }
   skt_collection_.reset();
 }
 
 void FontCollection::SetDefaultFontManager(sk_sp<SkFontMgr> font_manager) {
+  fallback_index_font_manager_.reset();
   default_font_manager_ = std::move(font_manager);
   skt_collection_.reset();
 }
 
+void FontCollection::SetFallbackFontIndexDirectory(
+    std::string cache_directory) {
+  fallback_font_index_directory_ = std::move(cache_directory);
+}
+
+void FontCollection::SaveFallbackFontIndex() {
+  if (fallback_index_font_manager_) {
+    fallback_index_font_manager_->SaveIndexIfNeeded();
+  }
+}
+
 void FontCollection::SetAssetFontManager(sk_sp<SkFontMgr> font_manager) {
   asset_font_manager_ = std::move(font_manager);
   skt_collection_.reset();
@@ -88,26 +110,54 @@ void FontCollection::ClearFontFamilyCache() {
   }
 }
 
+void FontCollection::SetParagraphCacheEnabled(bool enabled) {
+  enable_paragraph_cache_ = enabled;
+  if (skt_collection_) {
+    skt_collection_->getParagraphCache()->reset();
+    skt_collection_->getParagraphCache()->turnOn(enabled);
+  }
+}
+
+void FontCollection::ClearParagraphCache() {
+  if (skt_collection_) {
+    skt_collection_->getParagraphCache()->reset();
+  }
+}
+
 sk_sp<skia::textlayout::FontCollection>
 FontCollection::CreateSktFontCollection() {
   if (!skt_collection_) {
-    skt_collection_ = sk_make_sp<skia::textlayout::FontCollection>();
-
-    std::vector<SkString> default_font_families;
-    for (const std::string& family : GetDefaultFontFamilies()) {
-      default_font_families.emplace_back(family);
-    }
-    skt_collection_->setDefaultFontManager(default_font_manager_,
-                                           default_font_families);
-    skt_collection_->setAssetFontManager(asset_font_manager_);
-    skt_collection_->setDynamicFontManager(dynamic_font_manager_);
-    skt_collection_->setTestFontManager(test_font_manager_);
-    if (!enable_font_fallback_) {
-      skt_collection_->disableFontFallback();
-    }
+    skt_collection_ = MakeSktFontCollection();
+    skt_collection_->getParagraphCache()->turnOn(enable_paragraph_cache_);
   }
 
   return skt_collection_;
 }
 
+sk_sp<skia::textlayout::FontCollection>
+FontCollection::CreateIsolatedSktFontCollection() {
+  sk_sp<skia::textlayout::FontCollection> collection = MakeSktFontCollection();
+  collection->getParagraphCache()->turnOn(false);
+  return collection;
+}
+
+sk_sp<skia::textlayout::FontCollection> FontCollection::MakeSktFontCollection()
+    const {
+  auto collection = sk_make_sp<skia::textlayout::FontCollection>();
+
+  std::vector<SkString> default_font_families;
+  for (const std::string& family : GetDefaultFontFamilies()) {
+    default_font_families.emplace_back(family);
+  }
+  collection->setDefaultFontManager(default_font_manager_,
+                                    default_font_families);
+  collection->setAssetFontManager(asset_font_manager_);
+  collection->setDynamicFontManager(dynamic_font_manager_);
+  collection->setTestFontManager(test_font_manager_);
+  if (!enable_font_fallback_) {
+    collection->disableFontFallback();
+  }
+  return collection;
+}
+
 }  // namespace txt
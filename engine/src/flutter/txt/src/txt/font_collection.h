@@ -16,6 +16,7 @@
 #include "third_party/skia/include/core/SkRefCnt.h"
 #include "third_party/skia/modules/skparagraph/include/FontCollection.h"  // nogncheck
 #include "txt/asset_font_manager.h"
+#include "txt/fallback_index_font_manager.h"
 #include "txt/text_style.h"
 
 namespace txt {
@@ -41,21 +42,58 @@ class FontCollection : public std::enable_shared_from_this<FontCollection> {
   // Remove all entries in the font family cache.
   void ClearFontFamilyCache();
 
+  // Whether paragraphs built with this collection reuse the shaping of
+  // earlier paragraphs with the same text, styles and font features. The
+  // cache is shared by all the paragraphs of the collection, holds a bounded
+  // number of the most recently shaped paragraphs, and is enabled by default.
+  //
+  // The cache only holds the shaped runs, so a paragraph found in it is still
+  // broken into lines for its own width.
+  void SetParagraphCacheEnabled(bool enabled);
+
+  // Remove all the shaped paragraphs from the paragraph cache, for example to
+  // release their memory when the system is low on memory.
+  void ClearParagraphCache();
+
+  // Remember the fonts the default font manager falls back to for
+  // characters in an index saved in `cache_directory`, so that they are
+  // found without searching all the system fonts again. The index is used by
+  // the default font manager set up after this call.
+  void SetFallbackFontIndexDirectory(std::string cache_directory);
+
+  // Write the fallback font index to its directory if fonts were added to it
+  // since it was last saved.
+  void SaveFallbackFontIndex();
+
   // Construct a Skia text layout FontCollection based on this collection.
   sk_sp<skia::textlayout::FontCollection> CreateSktFontCollection();
 
+  // Construct a Skia text layout FontCollection with the fonts of this
+  // collection that isn't shared with any other paragraph.
+  //
+  // The Skia collections cache the fonts they match without any locking, so
+  // a paragraph can only be laid out on another thread if its collection is
+  // its own. The collection doesn't cache shaped paragraphs, as none other
+  // would reuse them.
+  sk_sp<skia::textlayout::FontCollection> CreateIsolatedSktFontCollection();
+
  private:
   sk_sp<SkFontMgr> default_font_manager_;
   sk_sp<SkFontMgr> asset_font_manager_;
   sk_sp<SkFontMgr> dynamic_font_manager_;
   sk_sp<SkFontMgr> test_font_manager_;
   bool enable_font_fallback_;
+  bool enable_paragraph_cache_;
+  std::string fallback_font_index_directory_;
+  sk_sp<FallbackIndexFontManager> fallback_index_font_manager_;
 
   // An equivalent font collection usable by the Skia text shaper library.
   sk_sp<skia::textlayout::FontCollection> skt_collection_;
 
   std::vector<sk_sp<SkFontMgr>> GetFontManagerOrder() const;
 
+  sk_sp<skia::textlayout::FontCollection> MakeSktFontCollection() const;
+
   FML_DISALLOW_COPY_AND_ASSIGN(FontCollection);
 };
 
@@ -16,12 +16,17 @@ namespace txt {
 /// @param[in]  style             The style to use for the paragraph.
 /// @param[in]  font_collection   The font collection to use for the paragraph.
 /// @param[in]  impeller_enabled  Whether Impeller is enabled in the runtime.
+/// @param[in]  isolated_font_collection  Whether the paragraph matches its
+///                                       fonts with a collection of its own,
+///                                       so that it can be laid out on any
+///                                       thread.
 std::unique_ptr<ParagraphBuilder> ParagraphBuilder::CreateSkiaBuilder(
     const ParagraphStyle& style,
     const std::shared_ptr<FontCollection>& font_collection,
-    const bool impeller_enabled) {
-  return std::make_unique<ParagraphBuilderSkia>(style, font_collection,
-                                                impeller_enabled);
+    const bool impeller_enabled,
+    const bool isolated_font_collection) {
+  return std::make_unique<ParagraphBuilderSkia>(
+      style, font_collection, impeller_enabled, isolated_font_collection);
 }
 
 }  // namespace txt
@@ -22,7 +22,8 @@ class ParagraphBuilder {
   static std::unique_ptr<ParagraphBuilder> CreateSkiaBuilder(
       const ParagraphStyle& style,
       const std::shared_ptr<FontCollection>& font_collection,
-      const bool impeller_enabled);
+      const bool impeller_enabled,
+      const bool isolated_font_collection = false);
 
   virtual ~ParagraphBuilder() = default;
 
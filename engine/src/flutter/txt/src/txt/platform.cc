@@ -23,4 +23,8 @@ sk_sp<SkFontMgr> GetDefaultFontManager(uint32_t font_initialization_data) {
   return mgr;
 }
 
+void PrefetchDefaultFontManager(uint32_t font_initialization_data) {
+  GetDefaultFontManager(font_initialization_data);
+}
+
 }  // namespace txt
@@ -17,6 +17,11 @@ std::vector<std::string> GetDefaultFontFamilies();
 
 sk_sp<SkFontMgr> GetDefaultFontManager(uint32_t font_initialization_data = 0);
 
+// Creates the default font manager ahead of its first use, from any thread,
+// on the platforms that create it once per process. Does nothing where a new
+// font manager is created for every call.
+void PrefetchDefaultFontManager(uint32_t font_initialization_data = 0);
+
 }  // namespace txt
 
 #endif  // FLUTTER_TXT_SRC_TXT_PLATFORM_H_
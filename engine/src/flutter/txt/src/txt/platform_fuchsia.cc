@@ -34,4 +34,11 @@ sk_sp<SkFontMgr> GetDefaultFontManager(uint32_t font_initialization_data) {
   }
 }
 
+void PrefetchDefaultFontManager(uint32_t font_initialization_data) {
+  // The font provider channel can only be bound once.
+  if (!font_initialization_data) {
+    GetDefaultFontManager(font_initialization_data);
+  }
+}
+
 }  // namespace txt
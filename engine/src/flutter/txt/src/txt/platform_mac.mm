@@ -43,6 +43,10 @@ sk_sp<SkFontMgr> GetDefaultFontManager(uint32_t font_initialization_data) {
   return mgr;
 }
 
+void PrefetchDefaultFontManager(uint32_t font_initialization_data) {
+  GetDefaultFontManager(font_initialization_data);
+}
+
 fml::CFRef<CTFontRef> MatchSystemUIFont(float desired_weight, float size) {
   fml::CFRef<CTFontRef> ct_font(
       CTFontCreateUIFontForLanguage(kCTFontUIFontSystem, size, nullptr));
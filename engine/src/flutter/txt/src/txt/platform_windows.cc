@@ -15,4 +15,9 @@ sk_sp<SkFontMgr> GetDefaultFontManager(uint32_t font_initialization_data) {
   return SkFontMgr_New_DirectWrite();
 }
 
+void PrefetchDefaultFontManager(uint32_t font_initialization_data) {
+  // A font manager is created for every call so that reloading the system
+  // fonts picks up newly installed ones.
+}
+
 }  // namespace txt
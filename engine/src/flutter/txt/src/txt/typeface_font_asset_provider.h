@@ -5,6 +5,7 @@
 #ifndef FLUTTER_TXT_SRC_TXT_TYPEFACE_FONT_ASSET_PROVIDER_H_
 #define FLUTTER_TXT_SRC_TXT_TYPEFACE_FONT_ASSET_PROVIDER_H_
 
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -15,6 +16,8 @@
 
 namespace txt {
 
+// The typefaces can be registered while paragraphs are laid out on other
+// threads, so the style sets and the provider are thread safe.
 class TypefaceFontStyleSet : public SkFontStyleSet {
  public:
   TypefaceFontStyleSet();
@@ -36,6 +39,7 @@ class TypefaceFontStyleSet : public SkFontStyleSet {
   sk_sp<SkTypeface> matchStyle(const SkFontStyle& pattern) override;
 
  private:
+  std::mutex mutex_;
   std::vector<sk_sp<SkTypeface>> typefaces_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(TypefaceFontStyleSet);
@@ -61,6 +65,7 @@ class TypefaceFontAssetProvider : public FontAssetProvider {
   sk_sp<SkFontStyleSet> MatchFamily(const std::string& family_name) override;
 
  private:
+  mutable std::mutex mutex_;
   std::unordered_map<std::string, sk_sp<TypefaceFontStyleSet>>
       registered_families_;
   std::vector<std::string> family_names_;
@@ -0,0 +1,126 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "gtest/gtest.h"
+
+#include "txt/fallback_font_index.h"
+
+namespace txt {
+namespace testing {
+
+namespace {
+
+std::unique_ptr<fml::Mapping> MakeMapping(std::vector<uint8_t> data) {
+  return std::make_unique<fml::DataMapping>(std::move(data));
+}
+
+}  // namespace
+
+TEST(FallbackFontIndexTest, FindsAddedEntries) {
+  FallbackFontIndex index(1);
+  EXPECT_FALSE(index.HasChanges());
+  EXPECT_EQ(index.Find("ja", 0x3042), std::nullopt);
+
+  index.Add("ja", 0x3042, "Noto Sans CJK JP");
+  index.Add("", 0x1F600, "Noto Color Emoji");
+  index.Add("ja", 0x10FFFF, FallbackFontIndex::kNoCoverage);
+  EXPECT_TRUE(index.HasChanges());
+  EXPECT_EQ(index.GetEntryCount(), 3u);
+  EXPECT_EQ(index.Find("ja", 0x3042), "Noto Sans CJK JP");
+  EXPECT_EQ(index.Find("", 0x1F600), "Noto Color Emoji");
+  EXPECT_EQ(index.Find("ja", 0x10FFFF), FallbackFontIndex::kNoCoverage);
+  // The fallbacks depend on the locale.
+  EXPECT_EQ(index.Find("zh-Hans", 0x3042), std::nullopt);
+}
+
+TEST(FallbackFontIndexTest, ReadsSerializedIndex) {
+  FallbackFontIndex index(1);
+  index.Add("ja", 0x3042, "Noto Sans CJK JP");
+  index.Add("zh-Hans", 0x3042, "Noto Sans CJK SC");
+  index.Add("ja", 0x10FFFF, FallbackFontIndex::kNoCoverage);
+  std::vector<uint8_t> data = index.Serialize();
+  EXPECT_FALSE(index.HasChanges());
+
+  FallbackFontIndex read(1, MakeMapping(data));
+  EXPECT_FALSE(read.HasChanges());
+  EXPECT_EQ(read.GetEntryCount(), 3u);
+  EXPECT_EQ(read.Find("ja", 0x3042), "Noto Sans CJK JP");
+  EXPECT_EQ(read.Find("zh-Hans", 0x3042), "Noto Sans CJK SC");
+  EXPECT_EQ(read.Find("ja", 0x10FFFF), FallbackFontIndex::kNoCoverage);
+  EXPECT_EQ(read.Find("ko", 0x3042), std::nullopt);
+}
+
+TEST(FallbackFontIndexTest, MergesAddedEntriesWithReadIndex) {
+  FallbackFontIndex index(1);
+  index.Add("ja", 0x3042, "Noto Sans CJK JP");
+  index.Add("", 0x0E01, "Noto Sans Thai");
+  FallbackFontIndex read(1, MakeMapping(index.Serialize()));
+
+  // Entries that are already in the index are not changes.
+  read.Add("ja", 0x3042, "Noto Sans CJK JP");
+  EXPECT_FALSE(read.HasChanges());
+
+  read.Add("ja", 0x3042, "Droid Sans Japanese");
+  read.Add("", 0x0627, "Noto Naskh Arabic");
+  EXPECT_TRUE(read.HasChanges());
+  EXPECT_EQ(read.GetEntryCount(), 3u);
+
+  FallbackFontIndex merged(1, MakeMapping(read.Serialize()));
+  EXPECT_EQ(merged.GetEntryCount(), 3u);
+  EXPECT_EQ(merged.Find("ja", 0x3042), "Droid Sans Japanese");
+  EXPECT_EQ(merged.Find("", 0x0E01), "Noto Sans Thai");
+  EXPECT_EQ(merged.Find("", 0x0627), "Noto Naskh Arabic");
+}
+
+TEST(FallbackFontIndexTest, DiscardsIndexOfOtherFonts) {
+  FallbackFontIndex index(1);
+  index.Add("ja", 0x3042, "Noto Sans CJK JP");
+  FallbackFontIndex read(2, MakeMapping(index.Serialize()));
+  EXPECT_EQ(read.GetEntryCount(), 0u);
+  EXPECT_EQ(read.Find("ja", 0x3042), std::nullopt);
+}
+
+TEST(FallbackFontIndexTest, DiscardsInvalidIndex) {
+  FallbackFontIndex index(1);
+  index.Add("ja", 0x3042, "Noto Sans CJK JP");
+  index.Add("", 0x0E01, "Noto Sans Thai");
+  const std::vector<uint8_t> data = index.Serialize();
+
+  EXPECT_EQ(FallbackFontIndex(1, MakeMapping({})).GetEntryCount(), 0u);
+  for (size_t size = 0; size < data.size(); size++) {
+    std::vector<uint8_t> truncated(data.begin(), data.begin() + size);
+    EXPECT_EQ(FallbackFontIndex(1, MakeMapping(truncated)).GetEntryCount(), 0u)
+        << size;
+  }
+
+  std::vector<uint8_t> bad_magic = data;
+  bad_magic[0] ^= 0xff;
+  EXPECT_EQ(FallbackFontIndex(1, MakeMapping(bad_magic)).GetEntryCount(), 0u);
+
+  // The entries reference strings out of the table.
+  std::vector<uint8_t> bad_entry = data;
+  bad_entry[bad_entry.size() - 8] = 0xff;
+  bad_entry[bad_entry.size() - 7] = 0xff;
+  EXPECT_EQ(FallbackFontIndex(1, MakeMapping(bad_entry)).GetEntryCount(), 0u);
+}
+
+TEST(FallbackFontIndexTest, BoundsTheNumberOfEntries) {
+  FallbackFontIndex index(1);
+  for (uint32_t i = 0; i < FallbackFontIndex::kMaxEntries + 10; i++) {
+    index.Add("", i, "Noto Sans");
+  }
+  EXPECT_EQ(index.GetEntryCount(), FallbackFontIndex::kMaxEntries);
+  EXPECT_EQ(index.Find("", FallbackFontIndex::kMaxEntries), std::nullopt);
+  // Existing entries can still be replaced.
+  index.Add("", 0, "Noto Serif");
+  EXPECT_EQ(index.Find("", 0), "Noto Serif");
+
+  FallbackFontIndex read(1, MakeMapping(index.Serialize()));
+  EXPECT_EQ(read.GetEntryCount(), FallbackFontIndex::kMaxEntries);
+  EXPECT_EQ(read.Find("", 0), "Noto Serif");
+  EXPECT_EQ(read.Find("", 100), "Noto Sans");
+}
+
+}  // namespace testing
+}  // namespace txt
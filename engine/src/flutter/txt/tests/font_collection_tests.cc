@@ -6,7 +6,10 @@
 
 #include <sstream>
 
+#include "flutter/runtime/test_font_data.h"
+#include "skia/paragraph_builder_skia.h"
 #include "txt/font_collection.h"
+#include "txt/typeface_font_asset_provider.h"
 
 namespace txt {
 namespace testing {
@@ -27,5 +30,56 @@ TEST_F(FontCollectionTests, SettingUpDefaultFontManagerClearsCache) {
   sk_font_collection = font_collection.CreateSktFontCollection();
   ASSERT_NE(sk_font_collection->getFallbackManager().get(), nullptr);
 }
+
+namespace {
+
+std::shared_ptr<FontCollection> MakeTestFontCollection() {
+  auto font_provider = std::make_unique<TypefaceFontAssetProvider>();
+  for (auto& font : flutter::GetTestFontData()) {
+    font_provider->RegisterTypeface(font);
+  }
+  auto font_collection = std::make_shared<FontCollection>();
+  font_collection->SetAssetFontManager(
+      sk_make_sp<AssetFontManager>(std::move(font_provider)));
+  return font_collection;
+}
+
+void LayoutParagraph(const std::shared_ptr<FontCollection>& font_collection,
+                     double width) {
+  TextStyle style;
+  style.font_families.push_back("ahem");
+  ParagraphBuilderSkia builder(ParagraphStyle(), font_collection, false);
+  builder.PushStyle(style);
+  builder.AddText(u"Hello World!");
+  builder.Pop();
+  builder.Build()->Layout(width);
+}
+
+}  // namespace
+
+TEST_F(FontCollectionTests, ParagraphsShareShapingAcrossWidths) {
+  std::shared_ptr<FontCollection> font_collection = MakeTestFontCollection();
+  auto* cache = font_collection->CreateSktFontCollection()->getParagraphCache();
+  LayoutParagraph(font_collection, 1000);
+  ASSERT_EQ(cache->count(), 1);
+  LayoutParagraph(font_collection, 10);
+  ASSERT_EQ(cache->count(), 1);
+
+  font_collection->ClearParagraphCache();
+  ASSERT_EQ(cache->count(), 0);
+}
+
+TEST_F(FontCollectionTests, ParagraphCacheCanBeDisabled) {
+  std::shared_ptr<FontCollection> font_collection = MakeTestFontCollection();
+  font_collection->SetParagraphCacheEnabled(false);
+  // The setting outlives the Skia collection, which is rebuilt when the font
+  // managers change.
+  font_collection->SetupDefaultFontManager(0);
+  LayoutParagraph(font_collection, 1000);
+  ASSERT_EQ(
+      font_collection->CreateSktFontCollection()->getParagraphCache()->count(),
+      0);
+}
+
 }  // namespace testing
 }  // namespace txt